@@ -177,6 +177,7 @@ typedef t_ply_odriver *p_ply_odriver;
  * obj_info: obj_info items for this file
  * nobj_infos: number of obj_info items in file
  * fp: file pointer associated with ply file
+ * own_fp: should ply_close close the file pointer?
  * rn: skip extra char after end_header? 
  * buffer: last word/chunck of data read from ply file
  * buffer_first, buffer_last: interval of untouched good data in buffer
@@ -200,6 +201,7 @@ typedef struct t_ply_ {
     char *obj_info;
     long nobj_infos;
     FILE *fp;
+    int own_fp;
     int rn;
     char buffer[BUFFERSIZE];
     size_t buffer_first, buffer_token, buffer_last;
@@ -378,6 +380,30 @@ p_ply ply_open(const char *name, p_ply_error_cb error_cb,
         return NULL;
     }
     ply->fp = fp;
+    ply->own_fp = 1;
+    return ply;
+}
+
+p_ply ply_open_from_file(FILE *fp, p_ply_error_cb error_cb, 
+        long idata, void *pdata) {
+    p_ply ply = ply_alloc();
+    if (error_cb == NULL) error_cb = ply_error_cb;
+    if (!ply) {
+        error_cb(NULL, "Out of memory");
+        return NULL;
+    }
+    ply->idata = idata;
+    ply->pdata = pdata;
+    ply->io_mode = PLY_READ;
+    ply->error_cb = error_cb;
+    if (!ply_type_check()) {
+        error_cb(ply, "Incompatible type system");
+        free(ply);
+        return NULL;
+    }
+    assert(fp);
+    ply->fp = fp;
+    ply->own_fp = 0;
     return ply;
 }
 
@@ -475,6 +501,36 @@ p_ply ply_create(const char *name, e_ply_storage_mode storage_mode,
     else ply->odriver = &ply_odriver_binary_reverse;
     ply->storage_mode = storage_mode;
     ply->fp = fp;
+    ply->own_fp = 1;
+    ply->error_cb = error_cb;
+    return ply;
+}
+
+p_ply ply_create_to_file(FILE *fp, e_ply_storage_mode storage_mode, 
+        p_ply_error_cb error_cb, long idata, void *pdata) {
+    p_ply ply = ply_alloc();
+    if (error_cb == NULL) error_cb = ply_error_cb;
+    if (!ply) {
+        error_cb(NULL, "Out of memory");
+        return NULL;
+    }
+    if (!ply_type_check()) {
+        error_cb(ply, "Incompatible type system");
+        free(ply);
+        return NULL;
+    }
+    assert(fp && storage_mode <= PLY_DEFAULT);
+    ply->idata = idata;
+    ply->pdata = pdata;
+    ply->io_mode = PLY_WRITE;
+    if (storage_mode == PLY_DEFAULT) storage_mode = ply_arch_endian();
+    if (storage_mode == PLY_ASCII) ply->odriver = &ply_odriver_ascii;
+    else if (storage_mode == ply_arch_endian()) 
+        ply->odriver = &ply_odriver_binary;
+    else ply->odriver = &ply_odriver_binary_reverse;
+    ply->storage_mode = storage_mode;
+    ply->fp = fp;
+    ply->own_fp = 0;
     ply->error_cb = error_cb;
     return ply;
 }
@@ -676,7 +732,7 @@ int ply_close(p_ply ply) {
         ply_ferror(ply, "Error closing up");
         return 0;
     }
-    fclose(ply->fp);
+    if (ply->own_fp) fclose(ply->fp);
     /* free all memory used by handle */
     if (ply->element) {
         for (i = 0; i < ply->nelements; i++) {
@@ -9,6 +9,8 @@
  * at the end of this file.
  * ---------------------------------------------------------------------- */
 
+#include <stdio.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -71,6 +73,20 @@ int ply_get_ply_user_data(p_ply ply, void **pdata, long *idata);
 p_ply ply_open(const char *name, p_ply_error_cb error_cb, long idata, 
         void *pdata);
 
+/* ----------------------------------------------------------------------
+ * Reads a PLY file from an already open file pointer, e.g. one that reads 
+ * from memory (fails if file is not a PLY file). ply_close does not close 
+ * the file pointer.
+ *
+ * fp: file pointer opened for reading in binary mode
+ * error_cb: error callback function
+ * idata,pdata: contextual information available to users
+ *
+ * Returns handle to PLY file if successful, NULL otherwise
+ * ---------------------------------------------------------------------- */
+p_ply ply_open_from_file(FILE *fp, p_ply_error_cb error_cb, long idata, 
+        void *pdata);
+
 /* ----------------------------------------------------------------------
  * Reads and parses the header of a PLY file returned by ply_open
  *
@@ -245,6 +261,18 @@ int ply_get_property_info(p_ply_property property, const char** name,
 p_ply ply_create(const char *name, e_ply_storage_mode storage_mode, 
         p_ply_error_cb error_cb, long idata, void *pdata);
 
+/* ----------------------------------------------------------------------
+ * Creates a new PLY file on an already open file pointer, e.g. one that 
+ * writes to memory. ply_close does not close the file pointer.
+ *
+ * fp: file pointer opened for writing in binary mode
+ * storage_mode: file format mode
+ *
+ * Returns handle to PLY file if successfull, NULL otherwise
+ * ---------------------------------------------------------------------- */
+p_ply ply_create_to_file(FILE *fp, e_ply_storage_mode storage_mode, 
+        p_ply_error_cb error_cb, long idata, void *pdata);
+
 /* ----------------------------------------------------------------------
  * Adds a new element to the PLY file created by ply_create
  *
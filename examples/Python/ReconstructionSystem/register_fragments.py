@@ -45,8 +45,10 @@ def register_point_cloud_fpfh(source, target, source_fpfh, target_fpfh, config):
             ], o3d.registration.RANSACConvergenceCriteria(4000000, 500))
     if (result.transformation.trace() == 4.0):
         return (False, np.identity(4), np.zeros((6, 6)))
-    information = o3d.registration.get_information_matrix_from_point_clouds(
-        source, target, distance_threshold, result.transformation)
+    # Both global registrations return the correspondences of their final
+    # transformation within distance_threshold.
+    information = o3d.registration.get_information_matrix_from_correspondences(
+        target, result.correspondence_set)
     if information[5, 5] / min(len(source.points), len(target.points)) < 0.3:
         return (False, np.identity(4), np.zeros((6, 6)))
     return (True, result.transformation, information)
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+/// Malloc and Free of n Float32 elements. On CUDA, this measures the caching
+/// allocator.
+static void MallocFree(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    int64_t byte_size = GetNumElements(state) *
+                        DtypeUtil::ByteSize(Dtype::Float32);
+    for (auto _ : state) {
+        void* ptr = MemoryManager::Malloc(byte_size, device);
+        benchmark::DoNotOptimize(ptr);
+        MemoryManager::Free(ptr, device);
+    }
+    state.SetLabel(Label(device));
+}
+
+/// Allocation and zero-filling of a tensor.
+static void Zeros(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    for (auto _ : state) {
+        Tensor dst = Tensor::Zeros({n}, dtype, device);
+        Synchronize(device);
+    }
+    ReportThroughput(state, n * DtypeUtil::ByteSize(dtype),
+                     Label(device, dtype));
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(MallocFree)->Apply(DeviceArguments);
+BENCHMARK(Zeros)->Apply(CoreArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
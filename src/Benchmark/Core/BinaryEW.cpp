@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+/// Benchmarks op(lhs, rhs) with lhs of shape {n / rhs_cols, rhs_cols} and rhs
+/// of shape \p rhs_shape, which is {n / rhs_cols, rhs_cols} or broadcastable
+/// to it.
+template <typename func_t>
+static void BenchmarkBinaryEW(benchmark::State& state,
+                              const SizeVector& rhs_shape,
+                              Dtype dst_dtype,
+                              func_t op) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    int64_t cols = rhs_shape.back();
+    Tensor lhs = Tensor::Ones({n / cols, cols}, dtype, device);
+    Tensor rhs = Tensor::Ones(rhs_shape, dtype, device);
+    Tensor warm_up = op(lhs, rhs);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = op(lhs, rhs);
+        Synchronize(device);
+    }
+    int64_t bytes = n * DtypeUtil::ByteSize(dtype) +
+                    rhs.NumElements() * DtypeUtil::ByteSize(dtype) +
+                    n * DtypeUtil::ByteSize(dst_dtype);
+    ReportThroughput(state, bytes, Label(device, dtype));
+}
+
+static void BinaryEWAdd(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {GetNumElements(state) / 4, 4}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Add(rhs);
+                      });
+}
+
+static void BinaryEWMul(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {GetNumElements(state) / 4, 4}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Mul(rhs);
+                      });
+}
+
+static void BinaryEWDiv(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {GetNumElements(state) / 4, 4}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Div(rhs);
+                      });
+}
+
+static void BinaryEWGt(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {GetNumElements(state) / 4, 4}, Dtype::Bool,
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Gt(rhs);
+                      });
+}
+
+/// Adds a row to every row, e.g. translating (N, 4) homogeneous points.
+static void BinaryEWAddBroadcastRow(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {4}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Add(rhs);
+                      });
+}
+
+/// Adds a scalar to every element.
+static void BinaryEWAddBroadcastScalar(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {1}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          return lhs.Add(rhs);
+                      });
+}
+
+/// In-place add, without allocating the output.
+static void BinaryEWAddInplace(benchmark::State& state) {
+    BenchmarkBinaryEW(state, {GetNumElements(state) / 4, 4}, GetDtype(state),
+                      [](const Tensor& lhs, const Tensor& rhs) {
+                          Tensor dst = lhs;
+                          return dst.Add_(rhs);
+                      });
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(BinaryEWAdd)->Apply(CoreArguments);
+BENCHMARK(BinaryEWMul)->Apply(CoreArguments);
+BENCHMARK(BinaryEWDiv)->Apply(CoreArguments);
+BENCHMARK(BinaryEWGt)->Apply(CoreArguments);
+BENCHMARK(BinaryEWAddBroadcastRow)->Apply(CoreArguments);
+BENCHMARK(BinaryEWAddBroadcastScalar)->Apply(CoreArguments);
+BENCHMARK(BinaryEWAddInplace)->Apply(CoreArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+/// Contiguous copy on the same device.
+static void Copy(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n}, dtype, device);
+    Tensor warm_up = src.Copy(device);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.Copy(device);
+        Synchronize(device);
+    }
+    ReportThroughput(state, 2 * n * DtypeUtil::ByteSize(dtype),
+                     Label(device, dtype));
+}
+
+/// Contiguous() of a transposed (n / 64, 64) tensor.
+static void Contiguous(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n / 64, 64}, dtype, device).T();
+    Tensor warm_up = src.Contiguous();
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.Contiguous();
+        Synchronize(device);
+    }
+    ReportThroughput(state, 2 * n * DtypeUtil::ByteSize(dtype),
+                     Label(device, dtype));
+}
+
+/// Contiguous copy of the permuted \p src, converted to \p dst_dtype.
+static void BenchmarkPermutedCopy(benchmark::State& state,
+                                  const Tensor& src,
+                                  Dtype dst_dtype) {
+    Device device = src.GetDevice();
+    Tensor warm_up = src.To(dst_dtype, /*copy=*/true);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.To(dst_dtype, /*copy=*/true);
+        Synchronize(device);
+    }
+    int64_t bytes = src.NumElements() * (DtypeUtil::ByteSize(src.GetDtype()) +
+                                         DtypeUtil::ByteSize(dst_dtype));
+    ReportThroughput(state, bytes, Label(device, src.GetDtype()));
+}
+
+/// Contiguous() of (n / 3, 3) points transposed to (3, n / 3).
+static void ContiguousPointsT(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    BenchmarkPermutedCopy(
+            state, Tensor::Ones({n / 3, 3}, dtype, device).T(), dtype);
+}
+
+/// Contiguous() of an (h, 64, 3) HWC image permuted to CHW.
+static void ContiguousHWCToCHW(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n / (64 * 3), 64, 3}, dtype, device);
+    BenchmarkPermutedCopy(state, src.Permute({2, 0, 1}), dtype);
+}
+
+/// Conversion of an (h, 64, 3) UInt8 HWC image to a Float32 CHW image, as fed
+/// to networks.
+static void HWCUInt8ToCHWFloat32(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n / (64 * 3), 64, 3}, Dtype::UInt8, device);
+    BenchmarkPermutedCopy(state, src.Permute({2, 0, 1}), Dtype::Float32);
+}
+
+/// Converts to Float32, or to Float64 for Float32 tensors.
+static void ToDtype(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    Dtype dst_dtype = dtype == Dtype::Float32 ? Dtype::Float64 : Dtype::Float32;
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n}, dtype, device);
+    Tensor warm_up = src.To(dst_dtype);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.To(dst_dtype);
+        Synchronize(device);
+    }
+    int64_t bytes = n * (DtypeUtil::ByteSize(dtype) +
+                         DtypeUtil::ByteSize(dst_dtype));
+    ReportThroughput(state, bytes, Label(device, dtype));
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(Copy)->Apply(CoreArguments);
+BENCHMARK(Contiguous)->Apply(CoreArguments);
+BENCHMARK(ToDtype)->Apply(CoreArguments);
+BENCHMARK(ContiguousPointsT)->Apply(CoreArguments);
+BENCHMARK(ContiguousHWCToCHW)->Apply(CoreArguments);
+BENCHMARK(HWCUInt8ToCHWFloat32)->Apply(DeviceArguments);
+
+#ifdef BUILD_CUDA_MODULE
+
+/// Host-to-device and device-to-host copies, with pageable or pinned host
+/// memory.
+static void BenchmarkHostDeviceCopy(benchmark::State& state,
+                                    bool to_device,
+                                    bool pinned) {
+    Device host("CPU:0");
+    Device device("CUDA:0");
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    int64_t n = GetNumElements(state);
+    Tensor src = to_device ? Tensor::Ones({n}, Dtype::Float32, host)
+                           : Tensor::Ones({n}, Dtype::Float32, device);
+    if (to_device && pinned) {
+        src = src.PinMemory();
+    }
+    Device dst_device = to_device ? device : host;
+    for (auto _ : state) {
+        Tensor dst = src.Copy(dst_device);
+        Synchronize(device);
+    }
+    ReportThroughput(state, n * DtypeUtil::ByteSize(Dtype::Float32),
+                     pinned ? "Float32 pinned" : "Float32 pageable");
+}
+
+static void HostToDeviceCopy(benchmark::State& state) {
+    BenchmarkHostDeviceCopy(state, /*to_device=*/true, /*pinned=*/false);
+}
+
+static void HostToDeviceCopyPinned(benchmark::State& state) {
+    BenchmarkHostDeviceCopy(state, /*to_device=*/true, /*pinned=*/true);
+}
+
+static void DeviceToHostCopy(benchmark::State& state) {
+    BenchmarkHostDeviceCopy(state, /*to_device=*/false, /*pinned=*/false);
+}
+
+BENCHMARK(HostToDeviceCopy)->Apply(SizeArguments);
+BENCHMARK(HostToDeviceCopyPinned)->Apply(SizeArguments);
+BENCHMARK(DeviceToHostCopy)->Apply(SizeArguments);
+
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Tensor.h"
+
+// Helpers shared by the Core benchmarks. Benchmarks are parameterized by the
+// arguments {num_elements, device, dtype} generated by CoreArguments(),
+// {num_elements, device} generated by DeviceArguments() or {num_elements}
+// generated by SizeArguments(), where device and dtype are indices into
+// BenchmarkDevices() and BenchmarkDtypes().
+
+namespace open3d {
+namespace benchmarks {
+
+inline const std::vector<Device>& BenchmarkDevices() {
+#ifdef BUILD_CUDA_MODULE
+    static const std::vector<Device> devices{Device("CPU:0"),
+                                             Device("CUDA:0")};
+#else
+    static const std::vector<Device> devices{Device("CPU:0")};
+#endif
+    return devices;
+}
+
+inline const std::vector<Dtype>& BenchmarkDtypes() {
+    static const std::vector<Dtype> dtypes{Dtype::Float32, Dtype::Float64,
+                                           Dtype::Int32, Dtype::Int64};
+    return dtypes;
+}
+
+/// Number of elements: 4K (launch overhead), 1M and 16M (bandwidth).
+static constexpr int64_t BENCHMARK_SIZES[] = {1 << 12, 1 << 20, 1 << 24};
+
+inline int64_t GetNumElements(const benchmark::State& state) {
+    return state.range(0);
+}
+
+inline Device GetDevice(const benchmark::State& state) {
+    return BenchmarkDevices()[state.range(1)];
+}
+
+inline Dtype GetDtype(const benchmark::State& state) {
+    return BenchmarkDtypes()[state.range(2)];
+}
+
+inline void CoreArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "device", "dtype"});
+    for (size_t device_idx = 0; device_idx < BenchmarkDevices().size();
+         ++device_idx) {
+        for (size_t dtype_idx = 0; dtype_idx < BenchmarkDtypes().size();
+             ++dtype_idx) {
+            for (int64_t n : BENCHMARK_SIZES) {
+                b->Args({n, static_cast<int64_t>(device_idx),
+                         static_cast<int64_t>(dtype_idx)});
+            }
+        }
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+/// For benchmarks whose cost does not depend on a dtype argument.
+inline void DeviceArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "device"});
+    for (size_t device_idx = 0; device_idx < BenchmarkDevices().size();
+         ++device_idx) {
+        for (int64_t n : BENCHMARK_SIZES) {
+            b->Args({n, static_cast<int64_t>(device_idx)});
+        }
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+/// For benchmarks that only depend on the size.
+inline void SizeArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n"});
+    for (int64_t n : BENCHMARK_SIZES) {
+        b->Args({n});
+    }
+    b->Unit(benchmark::kMicrosecond);
+}
+
+/// Waits for the pending work on \p device, such that CUDA kernels are
+/// included in the measured time.
+inline void Synchronize(const Device& device) {
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        CUDAStream::GetCurrent(device).Synchronize();
+    }
+}
+
+/// Returns true and skips the benchmark if \p device is not available.
+inline bool SkipIfUnavailable(benchmark::State& state, const Device& device) {
+    if (device.GetType() == Device::DeviceType::CUDA &&
+        device.GetID() >= cuda::DeviceCount()) {
+        state.SkipWithError("CUDA device is not available.");
+        return true;
+    }
+    return false;
+}
+
+/// Reports the throughput as bytes_per_second, with \p bytes_per_iteration
+/// bytes read and written per iteration, and labels the benchmark.
+inline void ReportThroughput(benchmark::State& state,
+                             int64_t bytes_per_iteration,
+                             const std::string& label) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            bytes_per_iteration);
+    state.SetLabel(label);
+}
+
+inline std::string Label(const Device& device) { return device.ToString(); }
+
+inline std::string Label(const Device& device, Dtype dtype) {
+    return device.ToString() + " " + DtypeUtil::ToString(dtype);
+}
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+/// Returns n / 2 scattered indices into [0, n), visiting each index at most
+/// once.
+static Tensor MakeScatteredIndices(int64_t n, const Device& device) {
+    std::vector<int64_t> indices(n / 2);
+    for (int64_t i = 0; i < n / 2; ++i) {
+        // Even indices permuted within blocks of 64, to make the access
+        // pattern irregular while keeping the indices unique.
+        int64_t block = (2 * i) / 64 * 64;
+        int64_t offset = (2 * i) % 64;
+        indices[i] = block + ((offset * 37) % 64);
+    }
+    return Tensor(indices, {n / 2}, Dtype::Int64, device);
+}
+
+static void IndexGet(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n}, dtype, device);
+    Tensor index = MakeScatteredIndices(n, device);
+    Tensor warm_up = src.IndexGet({index});
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({index});
+        Synchronize(device);
+    }
+    // Read index and src, write dst.
+    int64_t bytes = index.NumElements() *
+                    (DtypeUtil::ByteSize(Dtype::Int64) +
+                     2 * DtypeUtil::ByteSize(dtype));
+    ReportThroughput(state, bytes, Label(device, dtype));
+}
+
+static void IndexSet(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor dst = Tensor::Zeros({n}, dtype, device);
+    Tensor index = MakeScatteredIndices(n, device);
+    Tensor src = Tensor::Ones({index.NumElements()}, dtype, device);
+    dst.IndexSet({index}, src);
+    Synchronize(device);
+    for (auto _ : state) {
+        dst.IndexSet({index}, src);
+        Synchronize(device);
+    }
+    // Read index and src, write dst.
+    int64_t bytes = index.NumElements() *
+                    (DtypeUtil::ByteSize(Dtype::Int64) +
+                     2 * DtypeUtil::ByteSize(dtype));
+    ReportThroughput(state, bytes, Label(device, dtype));
+}
+
+/// Selects half of the rows of an (n / 4, 4) tensor with a boolean mask.
+static void IndexGetMask(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    int64_t rows = n / 4;
+    Tensor src = Tensor::Ones({rows, 4}, dtype, device);
+    std::vector<bool> mask_values(rows);
+    for (int64_t i = 0; i < rows; ++i) {
+        mask_values[i] = i % 2 == 0;
+    }
+    Tensor mask(mask_values, {rows}, Dtype::Bool, device);
+    Tensor warm_up = src.IndexGet({mask});
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({mask});
+        Synchronize(device);
+    }
+    // Read mask and src, write half of src.
+    int64_t bytes = rows * DtypeUtil::ByteSize(Dtype::Bool) +
+                    n * DtypeUtil::ByteSize(dtype) * 3 / 2;
+    ReportThroughput(state, bytes, Label(device, dtype));
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(IndexGet)->Apply(CoreArguments);
+BENCHMARK(IndexSet)->Apply(CoreArguments);
+BENCHMARK(IndexGetMask)->Apply(CoreArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+/// NonZero of an (n / 4, 4) boolean tensor with every third element true.
+static void NonZero(benchmark::State& state) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    int64_t n = GetNumElements(state);
+    std::vector<bool> values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        values[i] = i % 3 == 0;
+    }
+    Tensor src(values, {n / 4, 4}, Dtype::Bool, device);
+    Tensor warm_up = src.NonZero();
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = src.NonZero();
+        Synchronize(device);
+    }
+    // Read src, write 2 Int64 indices per non-zero element.
+    int64_t num_non_zeros = (n + 2) / 3;
+    int64_t bytes = n * DtypeUtil::ByteSize(Dtype::Bool) +
+                    2 * num_non_zeros * DtypeUtil::ByteSize(Dtype::Int64);
+    ReportThroughput(state, bytes, Label(device));
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(NonZero)->Apply(DeviceArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+// Latency of ops on tensors of shape {n, n}, with n = 4 for poses and n = 6 for
+// 6x6 systems, where the cost of creating the output tensor, its shape and
+// strides and the Indexer dominates the arithmetic.
+
+static void SmallTensorArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"n", "device"});
+    for (size_t device_idx = 0; device_idx < BenchmarkDevices().size();
+         ++device_idx) {
+        for (int64_t n : {4, 6}) {
+            b->Args({n, static_cast<int64_t>(device_idx)});
+        }
+    }
+    b->Unit(benchmark::kNanosecond);
+}
+
+template <typename func_t>
+static void BenchmarkSmallTensor(benchmark::State& state, func_t op) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    int64_t n = GetNumElements(state);
+    Tensor lhs = Tensor::Eye(n, Dtype::Float64, device).Mul(2);
+    Tensor rhs = Tensor::Ones({n, n}, Dtype::Float64, device);
+    Tensor warm_up = op(lhs, rhs);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = op(lhs, rhs);
+        benchmark::DoNotOptimize(dst.GetDataPtr());
+        Synchronize(device);
+    }
+    state.SetLabel(Label(device));
+}
+
+/// Shallow copy, e.g. passing a tensor by value.
+static void SmallTensorShallowCopy(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return Tensor(lhs);
+    });
+}
+
+static void SmallTensorEmpty(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return Tensor::Empty(lhs.GetShapeRef(), lhs.GetDtype(),
+                             lhs.GetDevice());
+    });
+}
+
+static void SmallTensorGetItem(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs[1];
+    });
+}
+
+static void SmallTensorView(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs.View({lhs.NumElements()});
+    });
+}
+
+static void SmallTensorAdd(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs.Add(rhs);
+    });
+}
+
+static void SmallTensorAddInplace(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        Tensor dst = rhs;
+        return dst.Add_(lhs);
+    });
+}
+
+static void SmallTensorTransposeContiguous(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return rhs.T().Contiguous();
+    });
+}
+
+static void SmallTensorSum(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs.Sum({0});
+    });
+}
+
+static void SmallTensorMatmul(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs.Matmul(rhs);
+    });
+}
+
+static void SmallTensorSolve(benchmark::State& state) {
+    BenchmarkSmallTensor(state, [](const Tensor& lhs, const Tensor& rhs) {
+        return lhs.Solve(rhs);
+    });
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(SmallTensorShallowCopy)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorEmpty)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorGetItem)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorView)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorAdd)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorAddInplace)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorTransposeContiguous)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorSum)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorMatmul)->Apply(SmallTensorArguments);
+BENCHMARK(SmallTensorSolve)->Apply(SmallTensorArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Benchmark/Core/CoreBenchmark.h"
+#include "Open3D/Core/Tensor.h"
+
+#include <benchmark/benchmark.h>
+
+namespace open3d {
+namespace benchmarks {
+
+template <typename func_t>
+static void BenchmarkUnaryEW(benchmark::State& state, func_t op) {
+    Device device = GetDevice(state);
+    if (SkipIfUnavailable(state, device)) {
+        return;
+    }
+    Dtype dtype = GetDtype(state);
+    int64_t n = GetNumElements(state);
+    Tensor src = Tensor::Ones({n}, dtype, device);
+    Tensor warm_up = op(src);
+    (void)warm_up;
+    Synchronize(device);
+    for (auto _ : state) {
+        Tensor dst = op(src);
+        Synchronize(device);
+    }
+    ReportThroughput(state, 2 * n * DtypeUtil::ByteSize(dtype),
+                     Label(device, dtype));
+}
+
+static void UnaryEWNeg(benchmark::State& state) {
+    BenchmarkUnaryEW(state, [](const Tensor& src) { return src.Neg(); });
+}
+
+static void UnaryEWSqrt(benchmark::State& state) {
+    BenchmarkUnaryEW(state, [](const Tensor& src) { return src.Sqrt(); });
+}
+
+static void UnaryEWExp(benchmark::State& state) {
+    BenchmarkUnaryEW(state, [](const Tensor& src) { return src.Exp(); });
+}
+
+// Fixture does play very well with static initialization in Open3D. Use the
+// simple BENCHMARK here.
+// https://github.com/google/benchmark/issues/498
+BENCHMARK(UnaryEWNeg)->Apply(CoreArguments);
+BENCHMARK(UnaryEWSqrt)->Apply(CoreArguments);
+BENCHMARK(UnaryEWExp)->Apply(CoreArguments);
+
+}  // namespace benchmarks
+}  // namespace open3d
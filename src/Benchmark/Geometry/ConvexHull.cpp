@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ConvexHull.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <random>
+
+namespace open3d {
+namespace benchmarks {
+
+// Points in a thin spherical shell, so many of them are on the hull.
+static std::vector<Eigen::Vector3d> CreateShell(int num_points) {
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal;
+    std::uniform_real_distribution<double> uniform(1.0, 1.001);
+    std::vector<Eigen::Vector3d> points(num_points);
+    for (Eigen::Vector3d& point : points) {
+        point = Eigen::Vector3d(normal(rng), normal(rng), normal(rng));
+        point *= uniform(rng) / point.norm();
+    }
+    return points;
+}
+
+// {number of points}
+static void BM_ComputeConvexHull(benchmark::State& state) {
+    const auto points = CreateShell(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto hull = geometry::ConvexHull::ComputeConvexHull(points);
+        benchmark::DoNotOptimize(std::get<0>(hull)->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+BENCHMARK(BM_ComputeConvexHull)
+        ->Arg(100000)
+        ->Arg(2000000)
+        ->Unit(benchmark::kMillisecond);
+
+// {number of points, number of camera locations}
+static void BM_HiddenPointRemoval(benchmark::State& state) {
+    geometry::PointCloud pcd;
+    pcd.points_ = CreateShell(static_cast<int>(state.range(0)));
+    std::vector<Eigen::Vector3d> camera_locations;
+    for (int64_t i = 0; i < state.range(1); ++i) {
+        const double angle = 2 * M_PI * i / state.range(1);
+        camera_locations.emplace_back(5 * std::cos(angle), 5 * std::sin(angle),
+                                      1);
+    }
+    for (auto _ : state) {
+        auto results = pcd.HiddenPointRemoval(camera_locations, 100.0);
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * camera_locations.size());
+}
+
+BENCHMARK(BM_HiddenPointRemoval)
+        ->Args({100000, 1})
+        ->Args({100000, 16})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Image.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// VGA float image as used by odometry and color map optimization.
+static geometry::Image MakeFloatImage() {
+    geometry::Image image;
+    image.Prepare(640, 480, 1, 4);
+    float* data = reinterpret_cast<float*>(image.data_.data());
+    for (int i = 0; i < image.width_ * image.height_; ++i) {
+        data[i] = float((i * 7919) % 1009) / 1009.0f;
+    }
+    return image;
+}
+
+static void BM_ImageFilterGaussian3(benchmark::State& state) {
+    geometry::Image image = MakeFloatImage();
+    for (auto _ : state) {
+        auto output = image.Filter(geometry::Image::FilterType::Gaussian3);
+        benchmark::DoNotOptimize(output->data_.data());
+    }
+}
+
+static void BM_ImageFilterSobel3Dx(benchmark::State& state) {
+    geometry::Image image = MakeFloatImage();
+    for (auto _ : state) {
+        auto output = image.Filter(geometry::Image::FilterType::Sobel3Dx);
+        benchmark::DoNotOptimize(output->data_.data());
+    }
+}
+
+static void BM_ImageDownsample(benchmark::State& state) {
+    geometry::Image image = MakeFloatImage();
+    for (auto _ : state) {
+        auto output = image.Downsample();
+        benchmark::DoNotOptimize(output->data_.data());
+    }
+}
+
+static void BM_ImageCreatePyramid(benchmark::State& state) {
+    geometry::Image image = MakeFloatImage();
+    for (auto _ : state) {
+        auto pyramid = image.CreatePyramid(4);
+        benchmark::DoNotOptimize(pyramid.data());
+    }
+}
+
+static void BM_ImagePyramidBuilder(benchmark::State& state) {
+    geometry::Image image = MakeFloatImage();
+    geometry::ImagePyramidBuilder builder;
+    geometry::ImagePyramid pyramid;
+    geometry::ImagePyramid pyramid_dx;
+    for (auto _ : state) {
+        builder.CreatePyramid(image, 4, true, pyramid);
+        builder.FilterPyramid(pyramid, geometry::Image::FilterType::Sobel3Dx,
+                              pyramid_dx);
+        benchmark::DoNotOptimize(pyramid_dx.data());
+    }
+}
+
+static void BM_ImageConvertDepthToFloatImage(benchmark::State& state) {
+    geometry::Image depth;
+    depth.Prepare(640, 480, 1, 2);
+    uint16_t* data = reinterpret_cast<uint16_t*>(depth.data_.data());
+    for (int i = 0; i < depth.width_ * depth.height_; ++i) {
+        data[i] = uint16_t((i * 7919) % 4000);
+    }
+    for (auto _ : state) {
+        auto output = depth.ConvertDepthToFloatImage();
+        benchmark::DoNotOptimize(output->data_.data());
+    }
+}
+
+BENCHMARK(BM_ImageFilterGaussian3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImageFilterSobel3Dx)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImageDownsample)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImageCreatePyramid)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImagePyramidBuilder)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ImageConvertDepthToFloatImage)->Unit(benchmark::kMicrosecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
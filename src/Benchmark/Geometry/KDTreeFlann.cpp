@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeIndex.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "benchmark/benchmark.h"
@@ -94,3 +95,103 @@ BENCHMARK(BM_TestKDTreeLine0)->Args({1 << 5, 1 << 10})->Args({1 << 9, 1 << 11});
 BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
+
+// Batched queries: KDTreeFlann answers them one by one on a single thread,
+// KDTreeIndex answers the whole batch in parallel.
+class TestKDTreeBatch {
+    geometry::PointCloud pc_;
+    vector<Vector3d> queries_;
+    int size_ = 0;
+
+public:
+    geometry::KDTreeFlann kdtree_flann_;
+    geometry::KDTreeIndex kdtree_index_;
+
+    void setup(int size) {
+        if (this->size_ == size) return;
+        utility::LogInfo("setup KDTree batch size={:d}", size);
+        this->size_ = size;
+        pc_.points_.resize(size);
+        queries_.resize(size);
+        for (int i = 0; i < size; ++i) {
+            pc_.points_[i] = Vector3d::Random();
+            queries_[i] = Vector3d::Random();
+        }
+        kdtree_flann_.SetGeometry(pc_);
+        kdtree_index_.SetGeometry(pc_);
+    }
+
+    const vector<Vector3d>& queries() const { return queries_; }
+};
+TestKDTreeBatch testKDTreeBatch;
+
+static void BM_KDTreeFlannBatchKNN(benchmark::State& state) {
+    int knn = state.range(0);
+    testKDTreeBatch.setup(state.range(1));
+    vector<int> indices;
+    vector<double> distance2;
+    for (auto _ : state) {
+        for (const Vector3d& query : testKDTreeBatch.queries()) {
+            testKDTreeBatch.kdtree_flann_.SearchKNN(query, knn, indices,
+                                                    distance2);
+        }
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+static void BM_KDTreeIndexBatchKNN(benchmark::State& state) {
+    int knn = state.range(0);
+    testKDTreeBatch.setup(state.range(1));
+    vector<int> indices;
+    vector<float> distance2;
+    for (auto _ : state) {
+        testKDTreeBatch.kdtree_index_.SearchKNN(testKDTreeBatch.queries(), knn,
+                                                indices, distance2);
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+static void BM_KDTreeFlannBatchRadius(benchmark::State& state) {
+    double radius = state.range(0) * 0.01;
+    testKDTreeBatch.setup(state.range(1));
+    vector<int> indices;
+    vector<double> distance2;
+    for (auto _ : state) {
+        for (const Vector3d& query : testKDTreeBatch.queries()) {
+            testKDTreeBatch.kdtree_flann_.SearchRadius(query, radius, indices,
+                                                       distance2);
+        }
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+static void BM_KDTreeIndexBatchRadius(benchmark::State& state) {
+    double radius = state.range(0) * 0.01;
+    testKDTreeBatch.setup(state.range(1));
+    vector<int> indices;
+    vector<float> distance2;
+    vector<int64_t> offsets;
+    for (auto _ : state) {
+        testKDTreeBatch.kdtree_index_.SearchRadius(testKDTreeBatch.queries(),
+                                                   radius, indices, distance2,
+                                                   offsets);
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+// {knn, number of points and queries}
+BENCHMARK(BM_KDTreeFlannBatchKNN)
+        ->Args({1, 1 << 16})
+        ->Args({30, 1 << 16})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KDTreeIndexBatchKNN)
+        ->Args({1, 1 << 16})
+        ->Args({30, 1 << 16})
+        ->Unit(benchmark::kMillisecond);
+// {radius in hundredths, number of points and queries}
+BENCHMARK(BM_KDTreeFlannBatchRadius)
+        ->Args({5, 1 << 16})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KDTreeIndexBatchRadius)
+        ->Args({5, 1 << 16})
+        ->Unit(benchmark::kMillisecond);
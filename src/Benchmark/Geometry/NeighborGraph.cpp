@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static geometry::PointCloud MakeRandomPointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d::Random() * 10.0;
+    }
+    return pcd;
+}
+
+// Normals and FPFH features, each searching their own neighborhoods.
+static void BM_NormalsAndFPFH(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const geometry::KDTreeSearchParamKNN param(int(state.range(1)));
+    for (auto _ : state) {
+        pcd.normals_.clear();
+        pcd.EstimateNormals(param);
+        auto feature = registration::ComputeFPFHFeature(pcd, param);
+        benchmark::DoNotOptimize(feature->data_.data());
+    }
+}
+
+// Normals and FPFH features from a shared neighbor graph.
+static void BM_NormalsAndFPFHFromNeighborGraph(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const geometry::KDTreeSearchParamKNN param(int(state.range(1)));
+    for (auto _ : state) {
+        pcd.normals_.clear();
+        auto graph = geometry::NeighborGraph::CreateFromPointCloud(pcd, param);
+        pcd.EstimateNormals(*graph);
+        auto feature = registration::ComputeFPFHFeature(pcd, *graph);
+        benchmark::DoNotOptimize(feature->data_.data());
+    }
+}
+
+// Radius and statistical outlier removal chained, each searching their own
+// neighborhoods and copying the inliers.
+static void BM_RemoveOutliers(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        auto radius_inliers = std::get<0>(pcd.RemoveRadiusOutliers(16, 1.0));
+        auto inliers =
+                std::get<0>(radius_inliers->RemoveStatisticalOutliers(20, 2.0));
+        benchmark::DoNotOptimize(inliers->points_.data());
+    }
+}
+
+// Radius and statistical inlier masks from a shared neighbor graph.
+static void BM_OutlierMasksFromNeighborGraph(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const geometry::KDTreeSearchParamHybrid param(1.0, 30);
+    for (auto _ : state) {
+        auto graph = geometry::NeighborGraph::CreateFromPointCloud(pcd, param);
+        std::vector<bool> mask = pcd.ComputeRadiusInlierMask(16, 1.0, *graph);
+        std::vector<bool> statistical_mask =
+                pcd.ComputeStatisticalInlierMask(20, 2.0, *graph);
+        for (size_t i = 0; i < mask.size(); ++i) {
+            mask[i] = mask[i] && statistical_mask[i];
+        }
+        benchmark::DoNotOptimize(mask.size());
+    }
+}
+
+// Consistent tangent plane orientation of the normals of a sphere, from a
+// prebuilt neighbor graph.
+static void BM_OrientNormalsConsistentTangentPlane(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    for (auto& point : pcd.points_) {
+        point.normalize();
+        pcd.normals_.push_back(point);
+    }
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pcd, geometry::KDTreeSearchParamKNN(int(state.range(1))));
+    for (auto _ : state) {
+        pcd.OrientNormalsConsistentTangentPlane(*graph);
+        benchmark::DoNotOptimize(pcd.normals_.data());
+    }
+}
+
+BENCHMARK(BM_NormalsAndFPFH)
+        ->Args({1 << 16, 30})
+        ->Args({1 << 18, 30})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NormalsAndFPFHFromNeighborGraph)
+        ->Args({1 << 16, 30})
+        ->Args({1 << 18, 30})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_OrientNormalsConsistentTangentPlane)
+        ->Args({1 << 16, 10})
+        ->Args({1 << 18, 10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_RemoveOutliers)
+        ->Args({1 << 16})
+        ->Args({1 << 18})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OutlierMasksFromNeighborGraph)
+        ->Args({1 << 16})
+        ->Args({1 << 18})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
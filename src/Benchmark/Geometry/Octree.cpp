@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static geometry::PointCloud MakeRandomPointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d::Random() * 10.0;
+        pcd.colors_[i] = (Eigen::Vector3d::Random().array() + 1.0) * 0.5;
+    }
+    return pcd;
+}
+
+// {number of points, max depth}
+static void BM_LinearOctreeConvertFromPointCloud(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        geometry::LinearOctree linear_octree(state.range(1));
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+        benchmark::DoNotOptimize(linear_octree.nodes_.data());
+    }
+}
+
+static void BM_OctreeConvertFromPointCloud(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        geometry::Octree octree(state.range(1));
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        benchmark::DoNotOptimize(octree.root_node_.get());
+    }
+}
+
+static void BM_LinearOctreeLocateLeafNode(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    geometry::LinearOctree linear_octree(state.range(1));
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < pcd.points_.size(); i += 16) {
+            sum += linear_octree.LocateLeafNode(pcd.points_[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_LinearOctreeBoundingBox(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    geometry::LinearOctree linear_octree(state.range(1));
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-3, -2, -1),
+                                          Eigen::Vector3d(4, 5, 6));
+    for (auto _ : state) {
+        auto indices = linear_octree.GetPointIndicesWithinBoundingBox(bbox);
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+
+BENCHMARK(BM_LinearOctreeConvertFromPointCloud)
+        ->Args({1 << 20, 6})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OctreeConvertFromPointCloud)
+        ->Args({1 << 20, 6})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LinearOctreeLocateLeafNode)
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LinearOctreeBoundingBox)
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Two independent samplings of the same unit sphere, as when comparing a
+// reconstruction against its ground truth.
+static void MakeClouds(int num_points,
+                       geometry::PointCloud& source,
+                       geometry::PointCloud& target) {
+    source.points_.resize(num_points);
+    target.points_.resize(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        source.points_[i] = Eigen::Vector3d::Random().normalized();
+        target.points_[i] = Eigen::Vector3d::Random().normalized();
+    }
+}
+
+static void BM_ComputePointCloudDistance(benchmark::State& state) {
+    geometry::PointCloud source, target;
+    MakeClouds(static_cast<int>(state.range(0)), source, target);
+    for (auto _ : state) {
+        auto distances = source.ComputePointCloudDistance(target);
+        benchmark::DoNotOptimize(distances.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ComputeChamferDistance(benchmark::State& state) {
+    geometry::PointCloud source, target;
+    MakeClouds(static_cast<int>(state.range(0)), source, target);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.ComputeChamferDistance(target));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+static void BM_ComputeDistanceToMesh(benchmark::State& state) {
+    geometry::PointCloud source, target;
+    MakeClouds(static_cast<int>(state.range(0)), source, target);
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 300);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    for (auto _ : state) {
+        auto distances = source.ComputeDistanceToMesh(bvh);
+        benchmark::DoNotOptimize(distances.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ComputePointCloudDistance)
+        ->Arg(1 << 14)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ComputeChamferDistance)
+        ->Arg(1 << 14)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ComputeDistanceToMesh)
+        ->Arg(1 << 14)
+        ->Arg(1 << 18)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
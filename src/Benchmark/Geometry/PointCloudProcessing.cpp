@@ -0,0 +1,239 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thread>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Parallel.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// A plane of 10 x 10 with half of the points, and 8 boxes of 1 x 1 x 1 above
+// it with the other half, all with a little noise.
+static geometry::PointCloud MakeScenePointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Vector3d noise = Eigen::Vector3d::Random() * 0.001;
+        if (i % 2 == 0) {
+            pcd.points_[i] = Eigen::Vector3d::Random().cwiseProduct(
+                                     Eigen::Vector3d(5.0, 5.0, 0.0)) +
+                             noise;
+        } else {
+            const int box = int(i / 2 % 8);
+            const Eigen::Vector3d center(-3.0 + 2.0 * (box % 4),
+                                         -2.0 + 4.0 * (box / 4), 2.0);
+            pcd.points_[i] = center + Eigen::Vector3d::Random() * 0.5 + noise;
+        }
+        pcd.colors_[i] = (Eigen::Vector3d::Random().array() + 1.0) * 0.5;
+    }
+    return pcd;
+}
+
+// Fibonacci sphere of n evenly spaced points with outward normals.
+static geometry::PointCloud MakeSpherePointCloud(int64_t n) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(n);
+    for (int64_t i = 0; i < n; ++i) {
+        const double z = 1 - (2 * i + 1) / double(n);
+        const double r = std::sqrt(1 - z * z);
+        const double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_[i] = Eigen::Vector3d(r * std::cos(phi), r * std::sin(phi),
+                                         z);
+    }
+    pcd.normals_ = pcd.points_;
+    return pcd;
+}
+
+// Registers {number of points, number of threads} for every size, and 1, 2,
+// 4, ... threads up to the number of hardware threads.
+static void ThreadSweep(benchmark::internal::Benchmark* b,
+                        const std::vector<int64_t>& sizes) {
+    const int max_threads =
+            std::max(1, int(std::thread::hardware_concurrency()));
+    for (int64_t size : sizes) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            b->Args({size, threads});
+        }
+        b->Args({size, max_threads});
+    }
+    b->ArgNames({"points", "threads"})->Unit(benchmark::kMillisecond);
+    b->UseRealTime();
+}
+
+// About 10^5, 10^6 and 10^7 points, for the linear time operations.
+static void LargeSweep(benchmark::internal::Benchmark* b) {
+    ThreadSweep(b, {1 << 17, 1 << 20, 1 << 23});
+}
+
+// About 10^5 and 10^6 points, for the operations searching neighborhoods.
+static void NeighborhoodSweep(benchmark::internal::Benchmark* b) {
+    ThreadSweep(b, {1 << 17, 1 << 20});
+}
+
+static void BM_PointCloudVoxelDownSample(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = pcd.VoxelDownSample(0.05);
+        benchmark::DoNotOptimize(output->points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudEstimateNormals(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        pcd.normals_.clear();
+        pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+        benchmark::DoNotOptimize(pcd.normals_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudOrientNormalsConsistentTangentPlane(
+        benchmark::State& state) {
+    geometry::PointCloud pcd = MakeSpherePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        pcd.OrientNormalsConsistentTangentPlane(10);
+        benchmark::DoNotOptimize(pcd.normals_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudRemoveStatisticalOutliers(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = pcd.RemoveStatisticalOutliers(20, 2.0);
+        benchmark::DoNotOptimize(std::get<0>(output)->points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudRemoveRadiusOutliers(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = pcd.RemoveRadiusOutliers(16, 0.05);
+        benchmark::DoNotOptimize(std::get<0>(output)->points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudClusterDBSCAN(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        std::vector<int> labels = pcd.ClusterDBSCAN(0.05, 10);
+        benchmark::DoNotOptimize(labels.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudSegmentPlane(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        // A probability of 1 runs all the iterations.
+        auto output = pcd.SegmentPlane(0.01, 3, 1000, 1.0);
+        benchmark::DoNotOptimize(std::get<1>(output).data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudCropAxisAlignedBoundingBox(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    const geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-2, -2, -1),
+                                                Eigen::Vector3d(2, 2, 3));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = pcd.Crop(bbox);
+        benchmark::DoNotOptimize(output->points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudCropOrientedBoundingBox(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeScenePointCloud(state.range(0));
+    const geometry::OrientedBoundingBox bbox(
+            Eigen::Vector3d(0, 0, 1),
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 1, 1).normalized())
+                    .toRotationMatrix(),
+            Eigen::Vector3d(4, 4, 4));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = pcd.Crop(bbox);
+        benchmark::DoNotOptimize(output->points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointCloudTransform(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeSpherePointCloud(state.range(0));
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(1e-3, Eigen::Vector3d::UnitZ())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1e-3, 0, 0);
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        pcd.Transform(transformation);
+        benchmark::DoNotOptimize(pcd.points_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_PointCloudVoxelDownSample)->Apply(LargeSweep);
+BENCHMARK(BM_PointCloudEstimateNormals)->Apply(NeighborhoodSweep);
+BENCHMARK(BM_PointCloudOrientNormalsConsistentTangentPlane)
+        ->Apply(NeighborhoodSweep);
+BENCHMARK(BM_PointCloudRemoveStatisticalOutliers)->Apply(NeighborhoodSweep);
+BENCHMARK(BM_PointCloudRemoveRadiusOutliers)->Apply(NeighborhoodSweep);
+BENCHMARK(BM_PointCloudClusterDBSCAN)->Apply(NeighborhoodSweep);
+BENCHMARK(BM_PointCloudSegmentPlane)->Apply(LargeSweep);
+BENCHMARK(BM_PointCloudCropAxisAlignedBoundingBox)->Apply(LargeSweep);
+BENCHMARK(BM_PointCloudCropOrientedBoundingBox)->Apply(LargeSweep);
+BENCHMARK(BM_PointCloudTransform)->Apply(LargeSweep);
+
+}  // namespace benchmarks
+}  // namespace open3d
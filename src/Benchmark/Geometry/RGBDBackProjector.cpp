@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RGBDBackProjector.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// VGA uint16_t depth in mm with a few invalid pixels, as from a depth camera.
+static geometry::Image MakeDepthImage() {
+    geometry::Image depth;
+    depth.Prepare(640, 480, 1, 2);
+    uint16_t* data = reinterpret_cast<uint16_t*>(depth.data_.data());
+    for (int i = 0; i < depth.width_ * depth.height_; ++i) {
+        data[i] = (i % 11 == 0) ? 0 : uint16_t(500 + (i * 7919) % 3000);
+    }
+    return depth;
+}
+
+static void BM_PointCloudCreateFromDepthImage(benchmark::State& state) {
+    geometry::Image depth = MakeDepthImage();
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    for (auto _ : state) {
+        auto pointcloud =
+                geometry::PointCloud::CreateFromDepthImage(depth, intrinsic);
+        benchmark::DoNotOptimize(pointcloud->points_.data());
+    }
+}
+
+static void BM_RGBDBackProjectorCreateFromDepthImage(benchmark::State& state) {
+    geometry::Image depth = MakeDepthImage();
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    geometry::RGBDBackProjector projector;
+    geometry::PointCloud pointcloud;
+    for (auto _ : state) {
+        projector.CreateFromDepthImage(depth, intrinsic,
+                                       Eigen::Matrix4d::Identity(), pointcloud);
+        benchmark::DoNotOptimize(pointcloud.points_.data());
+    }
+}
+
+static void BM_RGBDBackProjectorCreateFromRGBDImage(benchmark::State& state) {
+    geometry::Image depth = MakeDepthImage();
+    geometry::Image color;
+    color.Prepare(640, 480, 3, 1);
+    for (size_t i = 0; i < color.data_.size(); ++i) {
+        color.data_[i] = uint8_t(i * 13);
+    }
+    geometry::RGBDImage rgbd(color, *depth.ConvertDepthToFloatImage());
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    geometry::RGBDBackProjector projector;
+    geometry::PointCloud pointcloud;
+    for (auto _ : state) {
+        projector.CreateFromRGBDImage(rgbd, intrinsic,
+                                      Eigen::Matrix4d::Identity(), pointcloud);
+        benchmark::DoNotOptimize(pointcloud.points_.data());
+    }
+}
+
+BENCHMARK(BM_PointCloudCreateFromDepthImage)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RGBDBackProjectorCreateFromDepthImage)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RGBDBackProjectorCreateFromRGBDImage)
+        ->Unit(benchmark::kMicrosecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
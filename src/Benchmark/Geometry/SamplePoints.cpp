@@ -46,7 +46,25 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Poisson)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({100000});
+
+BENCHMARK_DEFINE_F(SamplePointsFixture, PoissonParallelGrid)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        trimesh->SamplePointsPoissonDisk(
+                state.range(0), 5, nullptr, false, -1,
+                open3d::geometry::MeshBase::PoissonDiskSamplingMethod::
+                        ParallelGrid);
+    }
+}
+
+BENCHMARK_REGISTER_F(SamplePointsFixture, PoissonParallelGrid)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({100000});
 
 BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     for (auto _ : state) {
@@ -54,4 +72,7 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({1000000});
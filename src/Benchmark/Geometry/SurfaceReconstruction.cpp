@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AlphaComplex.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TetraMesh.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Fibonacci sphere of n evenly spaced points with outward normals.
+static geometry::PointCloud MakeSpherePointCloud(int n) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1) / double(n);
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_.push_back({r * std::cos(phi), r * std::sin(phi), z});
+    }
+    pcd.normals_ = pcd.points_;
+    return pcd;
+}
+
+// Args are the number of points and max_points_per_tile.
+static void BM_CreateFromPointCloudBallPivoting(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    geometry::PointCloud pcd = MakeSpherePointCloud(n);
+    // About the point spacing of the sphere.
+    const double spacing = std::sqrt(4 * M_PI / n);
+    const std::vector<double> radii = {spacing, 2 * spacing};
+    for (auto _ : state) {
+        auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                pcd, radii, static_cast<size_t>(state.range(1)));
+        benchmark::DoNotOptimize(mesh->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_CreateFromPointCloudBallPivoting)
+        ->Args({100000, 0})
+        ->Args({100000, 25000})
+        ->Unit(benchmark::kMillisecond);
+
+// Alpha shapes of 20 alpha values from a precomputed tetrahedralization.
+static const int kNumAlphaValues = 20;
+
+static double AlphaValue(int i, int n) {
+    // From about the point spacing of the sphere to a few times it.
+    return std::sqrt(4 * M_PI / n) * (0.5 + 0.25 * i);
+}
+
+static void BM_AlphaShapeSweep(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    geometry::PointCloud pcd = MakeSpherePointCloud(n);
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::TetraMesh::CreateFromPointCloud(pcd);
+    for (auto _ : state) {
+        for (int i = 0; i < kNumAlphaValues; ++i) {
+            auto mesh = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                    pcd, AlphaValue(i, n), tetra_mesh, &pt_map);
+            benchmark::DoNotOptimize(mesh->triangles_.data());
+        }
+    }
+}
+
+static void BM_AlphaComplexSweep(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    geometry::PointCloud pcd = MakeSpherePointCloud(n);
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::TetraMesh::CreateFromPointCloud(pcd);
+    for (auto _ : state) {
+        auto alpha_complex = geometry::AlphaComplex::CreateFromPointCloud(
+                pcd, tetra_mesh, &pt_map);
+        for (int i = 0; i < kNumAlphaValues; ++i) {
+            auto mesh = alpha_complex->ExtractAlphaShape(AlphaValue(i, n));
+            benchmark::DoNotOptimize(mesh->triangles_.data());
+        }
+    }
+}
+
+BENCHMARK(BM_AlphaShapeSweep)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AlphaComplexSweep)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
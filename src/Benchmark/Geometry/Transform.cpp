@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static geometry::PointCloud MakeTransformPointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d::Random() * 10.0;
+        pcd.normals_[i] = Eigen::Vector3d::Random().normalized();
+    }
+    return pcd;
+}
+
+static Eigen::Matrix4d MakeRigidTransformation() {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.1, 0.2, 0.3});
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, 2.0, 3.0);
+    return transformation;
+}
+
+// Copy and transform, as registration did for every evaluation.
+static void BM_PointCloudCopyAndTransform(benchmark::State& state) {
+    const geometry::PointCloud pcd = MakeTransformPointCloud(state.range(0));
+    const Eigen::Matrix4d transformation = MakeRigidTransformation();
+    for (auto _ : state) {
+        geometry::PointCloud dst = pcd;
+        dst.Transform(transformation);
+        benchmark::DoNotOptimize(dst.points_.data());
+    }
+}
+
+static void BM_PointCloudTransformInto(benchmark::State& state) {
+    const geometry::PointCloud pcd = MakeTransformPointCloud(state.range(0));
+    const Eigen::Matrix4d transformation = MakeRigidTransformation();
+    geometry::PointCloud dst;
+    for (auto _ : state) {
+        pcd.TransformInto(transformation, dst);
+        benchmark::DoNotOptimize(dst.points_.data());
+    }
+}
+
+static void BM_PointCloudRotate(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeTransformPointCloud(state.range(0));
+    const Eigen::Matrix3d R =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.1, 0.2, 0.3});
+    const Eigen::Vector3d center(1.0, 2.0, 3.0);
+    for (auto _ : state) {
+        pcd.Rotate(R, center);
+        benchmark::DoNotOptimize(pcd.points_.data());
+    }
+}
+
+BENCHMARK(BM_PointCloudCopyAndTransform)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PointCloudTransformInto)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PointCloudRotate)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMicrosecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
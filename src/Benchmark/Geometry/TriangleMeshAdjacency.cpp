@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static void BM_TriangleMeshAdjacencyCreate(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto adjacency =
+                geometry::TriangleMeshAdjacency::CreateFromTriangleMesh(*mesh);
+        benchmark::DoNotOptimize(adjacency->edges_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_GetEdgeToTrianglesMap(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto edges_to_triangles = mesh->GetEdgeToTrianglesMap();
+        benchmark::DoNotOptimize(edges_to_triangles.size());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_FilterSmoothTaubin(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto output = mesh->FilterSmoothTaubin(10);
+        benchmark::DoNotOptimize(output->vertices_.data());
+    }
+}
+
+static void BM_ClusterConnectedTriangles(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto clusters = mesh->ClusterConnectedTriangles();
+        benchmark::DoNotOptimize(std::get<0>(clusters).data());
+    }
+}
+
+static void BM_OrientTriangles(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh->OrientTriangles());
+    }
+}
+
+BENCHMARK(BM_TriangleMeshAdjacencyCreate)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetEdgeToTrianglesMap)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FilterSmoothTaubin)->Arg(700)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ClusterConnectedTriangles)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OrientTriangles)->Arg(700)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Sphere with 2 * resolution * (resolution - 1) triangles.
+static std::shared_ptr<geometry::TriangleMesh> MakeSphere(int resolution) {
+    return geometry::TriangleMesh::CreateSphere(1.0, resolution);
+}
+
+static void BM_TriangleMeshBVHBuild(benchmark::State& state) {
+    auto mesh = MakeSphere(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        geometry::TriangleMeshBVH bvh(*mesh);
+        benchmark::DoNotOptimize(bvh.nodes_.data());
+    }
+}
+
+// Rays from random points outside the sphere towards random points inside.
+static void BM_TriangleMeshBVHCastRays(benchmark::State& state) {
+    auto mesh = MakeSphere(static_cast<int>(state.range(0)));
+    geometry::TriangleMeshBVH bvh(*mesh);
+    const int num_rays = 1 << 16;
+    std::vector<Eigen::Vector3d> origins(num_rays);
+    std::vector<Eigen::Vector3d> directions(num_rays);
+    for (int i = 0; i < num_rays; ++i) {
+        origins[i] = Eigen::Vector3d::Random().normalized() * 3.0;
+        directions[i] = Eigen::Vector3d::Random() * 0.5 - origins[i];
+    }
+    for (auto _ : state) {
+        auto hits = bvh.CastRays(origins, directions);
+        benchmark::DoNotOptimize(hits.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rays);
+}
+
+static void BM_TriangleMeshBVHRenderDepthImage(benchmark::State& state) {
+    auto mesh = MakeSphere(static_cast<int>(state.range(0)));
+    geometry::TriangleMeshBVH bvh(*mesh);
+    camera::PinholeCameraParameters camera_parameter;
+    camera_parameter.intrinsic_.SetIntrinsics(640, 480, 525.0, 525.0, 319.5,
+                                              239.5);
+    camera_parameter.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera_parameter.extrinsic_(2, 3) = 2.0;
+    for (auto _ : state) {
+        auto depth = bvh.RenderDepthImage(camera_parameter);
+        benchmark::DoNotOptimize(depth->data_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 640 * 480);
+}
+
+static void BM_TriangleMeshBVHComputeClosestPoints(benchmark::State& state) {
+    auto mesh = MakeSphere(static_cast<int>(state.range(0)));
+    geometry::TriangleMeshBVH bvh(*mesh);
+    const int num_queries = 1 << 16;
+    std::vector<Eigen::Vector3d> queries(num_queries);
+    // Points near the surface, as in registration or distance queries.
+    for (int i = 0; i < num_queries; ++i) {
+        queries[i] = Eigen::Vector3d::Random().normalized() *
+                     (1.0 + 0.1 * Eigen::internal::random<double>(-1.0, 1.0));
+    }
+    for (auto _ : state) {
+        auto closest = bvh.ComputeClosestPoints(queries);
+        benchmark::DoNotOptimize(closest.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_queries);
+}
+
+static void BM_GetSelfIntersectingTriangles(benchmark::State& state) {
+    auto mesh = MakeSphere(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        auto pairs = mesh->GetSelfIntersectingTriangles();
+        benchmark::DoNotOptimize(pairs.data());
+    }
+}
+
+BENCHMARK(BM_TriangleMeshBVHBuild)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TriangleMeshBVHCastRays)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TriangleMeshBVHRenderDepthImage)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TriangleMeshBVHComputeClosestPoints)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetSelfIntersectingTriangles)
+        ->Arg(50)
+        ->Arg(300)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Fixes the lower cap of a sphere and drags its top vertex.
+static void MakeHandleConstraints(
+        const geometry::TriangleMesh& mesh,
+        double drag,
+        std::vector<int>& constraint_ids,
+        std::vector<Eigen::Vector3d>& constraint_pos) {
+    constraint_ids.clear();
+    constraint_pos.clear();
+    for (int i = 0; i < int(mesh.vertices_.size()); ++i) {
+        if (mesh.vertices_[i](2) < -0.8) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh.vertices_[i]);
+        } else if (mesh.vertices_[i](2) > 0.9999) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh.vertices_[i] +
+                                     Eigen::Vector3d(drag, 0, 0));
+        }
+    }
+}
+
+// {sphere resolution, iterations}, set up for every drag.
+static void BM_DeformAsRigidAsPossible(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    MakeHandleConstraints(*mesh, 0.2, constraint_ids, constraint_pos);
+    for (auto _ : state) {
+        auto output = mesh->DeformAsRigidAsPossible(
+                constraint_ids, constraint_pos, size_t(state.range(1)));
+        benchmark::DoNotOptimize(output->vertices_.data());
+    }
+}
+
+// {sphere resolution, iterations}, one deformer for all drags, each starting
+// from the result of the previous one.
+static void BM_AsRigidAsPossibleDeformerDrag(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    MakeHandleConstraints(*mesh, 0.0, constraint_ids, constraint_pos);
+    geometry::AsRigidAsPossibleDeformer deformer(*mesh, constraint_ids);
+    std::vector<Eigen::Vector3d> vertices;
+    double drag = 0;
+    for (auto _ : state) {
+        drag += 0.01;
+        MakeHandleConstraints(*mesh, drag, constraint_ids, constraint_pos);
+        deformer.Deform(constraint_pos, vertices, size_t(state.range(1)));
+        benchmark::DoNotOptimize(vertices.data());
+    }
+}
+
+BENCHMARK(BM_DeformAsRigidAsPossible)
+        ->Args({100, 1})
+        ->Args({100, 5})
+        ->Args({300, 1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AsRigidAsPossibleDeformerDrag)
+        ->Args({100, 1})
+        ->Args({100, 5})
+        ->Args({300, 1})
+        ->Args({500, 1})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thread>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/SurfaceReconstructionPoisson.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Fibonacci sphere of n evenly spaced points with outward normals.
+static geometry::PointCloud MakeSpherePointCloud(int64_t n) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(n);
+    for (int64_t i = 0; i < n; ++i) {
+        const double z = 1 - (2 * i + 1) / double(n);
+        const double r = std::sqrt(1 - z * z);
+        const double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_[i] = Eigen::Vector3d(r * std::cos(phi), r * std::sin(phi),
+                                         z);
+    }
+    pcd.normals_ = pcd.points_;
+    return pcd;
+}
+
+// Registers {size, number of threads} for every size, and 1, 2, 4, ...
+// threads up to the number of hardware threads.
+static void ThreadSweep(benchmark::internal::Benchmark* b,
+                        const std::vector<int64_t>& sizes,
+                        const std::string& size_name) {
+    const int max_threads =
+            std::max(1, int(std::thread::hardware_concurrency()));
+    for (int64_t size : sizes) {
+        for (int threads = 1; threads < max_threads; threads *= 2) {
+            b->Args({size, threads});
+        }
+        b->Args({size, max_threads});
+    }
+    b->ArgNames({size_name, "threads"})->Unit(benchmark::kMillisecond);
+    b->UseRealTime();
+}
+
+// Sphere resolutions of about 10^5, 10^6 and 10^7 triangles.
+static void LargeMeshSweep(benchmark::internal::Benchmark* b) {
+    ThreadSweep(b, {224, 708, 2236}, "resolution");
+}
+
+// Sphere resolutions of about 10^5 and 10^6 triangles.
+static void MeshSweep(benchmark::internal::Benchmark* b) {
+    ThreadSweep(b, {224, 708}, "resolution");
+}
+
+// About 10^5 and 10^6 points.
+static void PointCloudSweep(benchmark::internal::Benchmark* b) {
+    ThreadSweep(b, {1 << 17, 1 << 20}, "points");
+}
+
+static void BM_TriangleMeshSimplifyQuadricDecimation(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    const int target = int(mesh->triangles_.size() / 10);
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->SimplifyQuadricDecimation(
+                target, geometry::MeshBase::QuadricDecimationMethod::Parallel);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshSimplifyVertexClustering(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->SimplifyVertexClustering(0.01);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshFilterSmoothSimple(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->FilterSmoothSimple(5);
+        benchmark::DoNotOptimize(output->vertices_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshFilterSmoothLaplacian(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->FilterSmoothLaplacian(5, 0.5);
+        benchmark::DoNotOptimize(output->vertices_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshFilterSmoothTaubin(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->FilterSmoothTaubin(5);
+        benchmark::DoNotOptimize(output->vertices_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshSubdivideMidpoint(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->SubdivideMidpoint(1);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshSubdivideLoop(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, int(state.range(0)));
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = mesh->SubdivideLoop(1);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+static void BM_TriangleMeshCreateFromPointCloudPoisson(
+        benchmark::State& state) {
+    geometry::PointCloud pcd = MakeSpherePointCloud(state.range(0));
+    const geometry::PoissonReconstructionOption option(8, 0, 1.1f, false,
+                                                       int(state.range(1)));
+    for (auto _ : state) {
+        auto output = geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                pcd, option);
+        benchmark::DoNotOptimize(std::get<0>(output)->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TriangleMeshCreateFromPointCloudBallPivoting(
+        benchmark::State& state) {
+    geometry::PointCloud pcd = MakeSpherePointCloud(state.range(0));
+    // About the point spacing of the sphere.
+    const double spacing = std::sqrt(4 * M_PI / state.range(0));
+    const std::vector<double> radii = {spacing, 2 * spacing};
+    utility::SetNumThreads(int(state.range(1)));
+    for (auto _ : state) {
+        auto output = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                pcd, radii);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    utility::SetNumThreads(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_TriangleMeshSimplifyQuadricDecimation)->Apply(MeshSweep);
+BENCHMARK(BM_TriangleMeshSimplifyVertexClustering)->Apply(LargeMeshSweep);
+BENCHMARK(BM_TriangleMeshFilterSmoothSimple)->Apply(LargeMeshSweep);
+BENCHMARK(BM_TriangleMeshFilterSmoothLaplacian)->Apply(LargeMeshSweep);
+BENCHMARK(BM_TriangleMeshFilterSmoothTaubin)->Apply(LargeMeshSweep);
+BENCHMARK(BM_TriangleMeshSubdivideMidpoint)->Apply(MeshSweep);
+BENCHMARK(BM_TriangleMeshSubdivideLoop)->Apply(MeshSweep);
+BENCHMARK(BM_TriangleMeshCreateFromPointCloudPoisson)->Apply(PointCloudSweep);
+BENCHMARK(BM_TriangleMeshCreateFromPointCloudBallPivoting)
+        ->Apply(PointCloudSweep);
+
+}  // namespace benchmarks
+}  // namespace open3d
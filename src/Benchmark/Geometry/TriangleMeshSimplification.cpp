@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// {sphere resolution, method, target in permille of the triangles}
+static void BM_SimplifyQuadricDecimation(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    const auto method =
+            static_cast<geometry::MeshBase::QuadricDecimationMethod>(
+                    state.range(1));
+    const int target =
+            static_cast<int>(mesh->triangles_.size() * state.range(2) / 1000);
+    for (auto _ : state) {
+        auto output = mesh->SimplifyQuadricDecimation(target, method);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+BENCHMARK(BM_SimplifyQuadricDecimation)
+        ->Args({100, 0, 100})
+        ->Args({100, 1, 100})
+        ->Args({700, 0, 100})
+        ->Args({700, 1, 100})
+        ->Args({700, 1, 10})
+        ->Unit(benchmark::kMillisecond);
+
+// {sphere resolution, contraction, voxel size in permille of the radius}
+static void BM_SimplifyVertexClustering(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    const auto contraction =
+            static_cast<geometry::MeshBase::SimplificationContraction>(
+                    state.range(1));
+    const double voxel_size = state.range(2) / 1000.0;
+    for (auto _ : state) {
+        auto output = mesh->SimplifyVertexClustering(voxel_size, contraction);
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+BENCHMARK(BM_SimplifyVertexClustering)
+        ->Args({700, 0, 5})
+        ->Args({700, 1, 5})
+        ->Args({700, 0, 50})
+        ->Unit(benchmark::kMillisecond);
+
+// {sphere resolution}: a sphere with every triangle on its own vertices.
+static std::shared_ptr<geometry::TriangleMesh> CreateTriangleSoup(
+        int resolution) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, resolution);
+    auto soup = std::make_shared<geometry::TriangleMesh>();
+    for (const Eigen::Vector3i& triangle : sphere->triangles_) {
+        const int vidx = static_cast<int>(soup->vertices_.size());
+        for (int k = 0; k < 3; ++k) {
+            soup->vertices_.push_back(sphere->vertices_[triangle(k)]);
+        }
+        soup->triangles_.emplace_back(vidx, vidx + 1, vidx + 2);
+    }
+    return soup;
+}
+
+static void BM_RemoveDuplicatedVertices(benchmark::State& state) {
+    auto soup = CreateTriangleSoup(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        geometry::TriangleMesh mesh = *soup;
+        mesh.RemoveDuplicatedVertices();
+        benchmark::DoNotOptimize(mesh.vertices_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * soup->vertices_.size());
+}
+
+BENCHMARK(BM_RemoveDuplicatedVertices)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+
+static void BM_MergeCloseVertices(benchmark::State& state) {
+    auto soup = CreateTriangleSoup(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        geometry::TriangleMesh mesh = *soup;
+        mesh.MergeCloseVertices(1e-6);
+        benchmark::DoNotOptimize(mesh.vertices_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * soup->vertices_.size());
+}
+
+BENCHMARK(BM_MergeCloseVertices)
+        ->Arg(100)
+        ->Arg(700)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// {sphere resolution, iterations}
+static void BM_SubdivideMidpoint(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    mesh->ComputeVertexNormals();
+    for (auto _ : state) {
+        auto output = mesh->SubdivideMidpoint(static_cast<int>(state.range(1)));
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+BENCHMARK(BM_SubdivideMidpoint)
+        ->Args({100, 1})
+        ->Args({200, 2})
+        ->Unit(benchmark::kMillisecond);
+
+// {sphere resolution, iterations}
+static void BM_SubdivideLoop(benchmark::State& state) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(
+            1.0, static_cast<int>(state.range(0)));
+    mesh->ComputeVertexNormals();
+    for (auto _ : state) {
+        auto output = mesh->SubdivideLoop(static_cast<int>(state.range(1)));
+        benchmark::DoNotOptimize(output->triangles_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->triangles_.size());
+}
+
+BENCHMARK(BM_SubdivideLoop)
+        ->Args({100, 1})
+        ->Args({200, 2})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static geometry::PointCloud MakeRandomPointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d::Random() * 10.0;
+        pcd.normals_[i] = Eigen::Vector3d::Random().normalized();
+        pcd.colors_[i] = (Eigen::Vector3d::Random().array() + 1.0) * 0.5;
+    }
+    return pcd;
+}
+
+// {number of points, voxel size in hundredths}
+static void BM_VoxelDownSample(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const double voxel_size = state.range(1) * 0.01;
+    for (auto _ : state) {
+        std::shared_ptr<geometry::PointCloud> output =
+                pcd.VoxelDownSample(voxel_size);
+        benchmark::DoNotOptimize(output->points_.data());
+    }
+}
+
+static void BM_VoxelDownSampleAndTrace(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const double voxel_size = state.range(1) * 0.01;
+    for (auto _ : state) {
+        auto output = pcd.VoxelDownSampleAndTrace(
+                voxel_size, pcd.GetMinBound(), pcd.GetMaxBound());
+        benchmark::DoNotOptimize(std::get<0>(output)->points_.data());
+    }
+}
+
+static void BM_CompactVoxelDownSample(benchmark::State& state) {
+    auto pcd = geometry::CompactPointCloud::CreateFromPointCloud(
+            MakeRandomPointCloud(state.range(0)));
+    const double voxel_size = state.range(1) * 0.01;
+    for (auto _ : state) {
+        std::shared_ptr<geometry::CompactPointCloud> output =
+                pcd->VoxelDownSample(voxel_size);
+        benchmark::DoNotOptimize(output->points_.data());
+    }
+}
+
+BENCHMARK(BM_VoxelDownSample)
+        ->Args({1 << 20, 5})
+        ->Args({1 << 20, 50})
+        ->Args({1 << 22, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompactVoxelDownSample)
+        ->Args({1 << 20, 5})
+        ->Args({1 << 20, 50})
+        ->Args({1 << 22, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoxelDownSampleAndTrace)
+        ->Args({1 << 20, 5})
+        ->Args({1 << 20, 50})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/CompactVoxelGrid.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static geometry::PointCloud MakeRandomPointCloud(int64_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d::Random() * 10.0;
+        pcd.colors_[i] = (Eigen::Vector3d::Random().array() + 1.0) * 0.5;
+    }
+    return pcd;
+}
+
+// Camera in front of the unit cube and a circular silhouette.
+static void MakeSilhouette(camera::PinholeCameraParameters& camera,
+                           geometry::Image& silhouette) {
+    camera.intrinsic_ =
+            camera::PinholeCameraIntrinsic(640, 480, 500, 500, 319.5, 239.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_.block<3, 1>(0, 3) = Eigen::Vector3d(-0.5, -0.5, 1.0);
+    silhouette.Prepare(640, 480, 1, 4);
+    for (int v = 0; v < 480; v++) {
+        for (int u = 0; u < 640; u++) {
+            double r2 = (u - 320) * (u - 320) + (v - 240) * (v - 240);
+            *silhouette.PointerAt<float>(u, v) = r2 < 150 * 150 ? 1.0f : 0.0f;
+        }
+    }
+}
+
+// {number of points, voxel size in hundredths}
+static void BM_VoxelGridCreateFromPointCloud(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const double voxel_size = state.range(1) * 0.01;
+    for (auto _ : state) {
+        auto voxel_grid =
+                geometry::VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+        benchmark::DoNotOptimize(voxel_grid->voxels_.size());
+    }
+}
+
+static void BM_CompactVoxelGridCreateFromPointCloud(benchmark::State& state) {
+    geometry::PointCloud pcd = MakeRandomPointCloud(state.range(0));
+    const double voxel_size = state.range(1) * 0.01;
+    for (auto _ : state) {
+        auto voxel_grid = geometry::CompactVoxelGrid::CreateFromPointCloud(
+                pcd, voxel_size);
+        benchmark::DoNotOptimize(voxel_grid->NumVoxels());
+        state.counters["bytes_per_voxel"] =
+                double(voxel_grid->GetStorageBytes()) /
+                double(voxel_grid->NumVoxels());
+    }
+}
+
+// {voxels per axis}
+static void BM_VoxelGridCarveSilhouette(benchmark::State& state) {
+    camera::PinholeCameraParameters camera;
+    geometry::Image silhouette;
+    MakeSilhouette(camera, silhouette);
+    const double voxel_size = 1.0 / state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto voxel_grid = geometry::VoxelGrid::CreateDense(
+                Eigen::Vector3d(0, 0, 0), voxel_size, 1, 1, 1);
+        state.ResumeTiming();
+        voxel_grid->CarveSilhouette(silhouette, camera, true);
+        benchmark::DoNotOptimize(voxel_grid->voxels_.size());
+    }
+}
+
+static void BM_CompactVoxelGridCarveSilhouette(benchmark::State& state) {
+    camera::PinholeCameraParameters camera;
+    geometry::Image silhouette;
+    MakeSilhouette(camera, silhouette);
+    const double voxel_size = 1.0 / state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto voxel_grid = geometry::CompactVoxelGrid::CreateDense(
+                Eigen::Vector3d(0, 0, 0), voxel_size, 1, 1, 1);
+        state.ResumeTiming();
+        voxel_grid->CarveSilhouette(silhouette, camera, true);
+        benchmark::DoNotOptimize(voxel_grid->NumVoxels());
+    }
+}
+
+BENCHMARK(BM_VoxelGridCreateFromPointCloud)
+        ->Args({1 << 21, 20})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompactVoxelGridCreateFromPointCloud)
+        ->Args({1 << 21, 20})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoxelGridCarveSilhouette)->Arg(128)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompactVoxelGridCarveSilhouette)
+        ->Arg(128)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
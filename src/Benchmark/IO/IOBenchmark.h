@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Helpers shared by the IO benchmarks. Every format is benchmarked by a write
+// and a read benchmark on synthetic data of a few sizes. They report bytes/s
+// of file data, items/s, i.e. points, vertices or pixels per second, and the
+// file size. To track the results over time, write them as JSON:
+//
+//   benchmarks --benchmark_filter=Read|Write --benchmark_out=io.json
+//              --benchmark_out_format=json
+
+namespace open3d {
+namespace benchmarks {
+
+/// Returns the size of \p filename in bytes, or 0 if it cannot be opened.
+inline int64_t GetFileSize(const std::string& filename) {
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    const int64_t size = ftell(file);
+    fclose(file);
+    return size > 0 ? size : 0;
+}
+
+/// Reports the throughput of a benchmark that wrote or read \p filename,
+/// which holds \p num_items points, vertices or pixels, once per iteration.
+/// The bytes per item compare the storage cost of the formats.
+inline void SetIOCounters(benchmark::State& state,
+                          const std::string& filename,
+                          int64_t num_items) {
+    const int64_t file_size = GetFileSize(filename);
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.SetItemsProcessed(state.iterations() * num_items);
+    state.counters["file_bytes"] = double(file_size);
+    state.counters["bytes_per_item"] =
+            num_items > 0 ? double(file_size) / double(num_items) : 0.0;
+    state.SetLabel(filename);
+}
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "benchmark/benchmark.h"
+
+#include "Benchmark/IO/IOBenchmark.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+struct ReadWriteImageArgs {
+    std::string filename;
+    int num_of_channels;
+    int bytes_per_channel;
+};
+const std::vector<ReadWriteImageArgs> g_image_args({
+        {"test_color.png", 3, 1},  // 0
+        {"test_depth.png", 1, 2},  // 1
+        {"test_color.jpg", 3, 1},  // 2
+        {"test_gray.jpg", 1, 1},   // 3
+});
+
+/// Smooth gradients with noise, so that the compression ratio is close to
+/// the one of camera images. The same image is reused by all benchmarks with
+/// the same arguments.
+const geometry::Image &GetImage(int args_id, int width) {
+    static int image_args_id = -1;
+    static int image_width = 0;
+    static geometry::Image image;
+    if (image_args_id != args_id || image_width != width) {
+        const auto &args = g_image_args[args_id];
+        const int height = width * 3 / 4;
+        image.Prepare(width, height, args.num_of_channels,
+                      args.bytes_per_channel);
+        uint32_t state = 1;
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                for (int c = 0; c < args.num_of_channels; ++c) {
+                    state = state * 1664525u + 1013904223u;
+                    const int noise = int(state >> 29);
+                    const int value = (u + 2 * v + 64 * c) % 256 + noise;
+                    if (args.bytes_per_channel == 1) {
+                        *image.PointerAt<uint8_t>(u, v, c) =
+                                uint8_t(std::min(value, 255));
+                    } else {
+                        *image.PointerAt<uint16_t>(u, v, c) =
+                                uint16_t(value * 16);
+                    }
+                }
+            }
+        }
+        image_args_id = args_id;
+        image_width = width;
+    }
+    return image;
+}
+
+}  // namespace
+
+static void BM_WriteImage(::benchmark::State &state) {
+    const auto &args = g_image_args[state.range(0)];
+    const auto &image = GetImage(state.range(0), state.range(1));
+    for (auto _ : state) {
+        if (!io::WriteImage(args.filename, image)) {
+            utility::LogError("Failed to write to {}", args.filename);
+        }
+    }
+    SetIOCounters(state, args.filename, int64_t(image.width_) * image.height_);
+}
+
+static void BM_ReadImage(::benchmark::State &state) {
+    const auto &args = g_image_args[state.range(0)];
+    const auto &image = GetImage(state.range(0), state.range(1));
+    if (!io::WriteImage(args.filename, image)) {
+        utility::LogError("Failed to write to {}", args.filename);
+    }
+    geometry::Image image2;
+    for (auto _ : state) {
+        if (!io::ReadImage(args.filename, image2)) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+    SetIOCounters(state, args.filename, int64_t(image.width_) * image.height_);
+}
+
+static void BM_ImageIO_Args(benchmark::internal::Benchmark *b) {
+    // 640x480, 1280x960 and 2560x1920 pixels
+    for (int width = 640; width <= 2560; width *= 2) {
+        for (int i = 0; i < int(g_image_args.size()); ++i) {
+            b->Args({i, width});
+        }
+    }
+}
+
+BENCHMARK(BM_WriteImage)->MinTime(0.1)->Apply(BM_ImageIO_Args);
+BENCHMARK(BM_ReadImage)->MinTime(0.1)->Apply(BM_ImageIO_Args);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include "Benchmark/IO/IOBenchmark.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
 
@@ -87,6 +88,10 @@ std::vector<ReadWritePCArgs> g_pc_args({
          Compare::NORMALS},  // 7
         {"test.xyzrgb", IsAscii::BINARY, Compressed::UNCOMPRESSED,
          Compare::COLORS},  // 8
+        {"test.o3dg", IsAscii::BINARY, Compressed::UNCOMPRESSED,
+         Compare::NORMALS_AND_COLORS},  // 9
+        {"test.las", IsAscii::BINARY, Compressed::UNCOMPRESSED,
+         Compare::COLORS},  // 10
 });
 
 class TestPCGrid0 {
@@ -117,20 +122,30 @@ public:
         }
     }
 
-    void WriteRead(int pc_args_id) {
+    void Write(int pc_args_id) const {
         const auto &args = g_pc_args[pc_args_id];
-        const auto &pc = pc_;
-        // we loose some precision when saving generated data
-        if (!WritePointCloud(args.filename, pc,
+        if (!WritePointCloud(args.filename, pc_,
                              {bool(args.write_ascii), bool(args.compressed),
                               print_progress})) {
             utility::LogError("Failed to write to {}", args.filename);
         }
-        geometry::PointCloud pc2;
-        if (!ReadPointCloud(args.filename, pc2,
+    }
+
+    void Read(int pc_args_id, geometry::PointCloud &pc) const {
+        const auto &args = g_pc_args[pc_args_id];
+        if (!ReadPointCloud(args.filename, pc,
                             {"auto", false, false, print_progress})) {
             utility::LogError("Failed to read from {}", args.filename);
         }
+    }
+
+    void WriteRead(int pc_args_id) {
+        const auto &args = g_pc_args[pc_args_id];
+        const auto &pc = pc_;
+        // we loose some precision when saving generated data
+        Write(pc_args_id);
+        geometry::PointCloud pc2;
+        Read(pc_args_id, pc2);
         auto CheckLE = [](double a, double b) {
             if (a <= b) return;
             utility::LogError("Error too high: {} {}", a, b);
@@ -176,5 +191,30 @@ static void BM_TestPCGrid0_Args(benchmark::internal::Benchmark *b) {
 
 BENCHMARK(BM_TestPCGrid0)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
 
+static void BM_WritePointCloud(::benchmark::State &state) {
+    int pc_args_id = state.range(0);
+    int size = state.range(1);
+    test_pc_grid0.Setup(size);
+    for (auto _ : state) {
+        test_pc_grid0.Write(pc_args_id);
+    }
+    SetIOCounters(state, g_pc_args[pc_args_id].filename, size);
+}
+
+static void BM_ReadPointCloud(::benchmark::State &state) {
+    int pc_args_id = state.range(0);
+    int size = state.range(1);
+    test_pc_grid0.Setup(size);
+    test_pc_grid0.Write(pc_args_id);
+    geometry::PointCloud pc;
+    for (auto _ : state) {
+        test_pc_grid0.Read(pc_args_id, pc);
+    }
+    SetIOCounters(state, g_pc_args[pc_args_id].filename, size);
+}
+
+BENCHMARK(BM_WritePointCloud)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
+BENCHMARK(BM_ReadPointCloud)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
+
 }  // namespace benchmarks
 }  // namespace open3d
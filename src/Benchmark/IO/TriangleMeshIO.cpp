@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+
+#include "Benchmark/IO/IOBenchmark.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+struct ReadWriteMeshArgs {
+    std::string filename;
+    bool write_ascii;
+};
+const std::vector<ReadWriteMeshArgs> g_mesh_args({
+        {"testb.ply", false},  // 0
+        {"testa.ply", true},   // 1
+        {"testb.stl", false},  // 2
+        {"test.obj", true},    // 3
+        {"test.off", true},    // 4
+        {"test.gltf", false},  // 5
+        {"test.glb", false},   // 6
+        {"test.o3dg", false},  // 7
+});
+
+/// Sphere with vertex normals, vertex colors and triangle normals. The same
+/// mesh is reused by all benchmarks with the same resolution.
+const geometry::TriangleMesh &GetMesh(int resolution) {
+    static int mesh_resolution = 0;
+    static geometry::TriangleMesh mesh;
+    if (mesh_resolution != resolution) {
+        mesh = *geometry::TriangleMesh::CreateSphere(1.0, resolution);
+        mesh.ComputeVertexNormals();
+        mesh.vertex_colors_.resize(mesh.vertices_.size());
+        for (size_t i = 0; i < mesh.vertices_.size(); ++i) {
+            mesh.vertex_colors_[i] = {std::fmod(i * .4241490710, 1.0),
+                                      std::fmod(i * .6468026221, 1.0),
+                                      std::fmod(i * .5376722873, 1.0)};
+        }
+        mesh_resolution = resolution;
+    }
+    return mesh;
+}
+
+void WriteMesh(const ReadWriteMeshArgs &args,
+               const geometry::TriangleMesh &mesh) {
+    if (!io::WriteTriangleMesh(args.filename, mesh, args.write_ascii)) {
+        utility::LogError("Failed to write to {}", args.filename);
+    }
+}
+
+}  // namespace
+
+static void BM_WriteTriangleMesh(::benchmark::State &state) {
+    const auto &args = g_mesh_args[state.range(0)];
+    const auto &mesh = GetMesh(state.range(1));
+    for (auto _ : state) {
+        WriteMesh(args, mesh);
+    }
+    SetIOCounters(state, args.filename, mesh.vertices_.size());
+    state.counters["triangles"] = double(mesh.triangles_.size());
+}
+
+static void BM_ReadTriangleMesh(::benchmark::State &state) {
+    const auto &args = g_mesh_args[state.range(0)];
+    const auto &mesh = GetMesh(state.range(1));
+    WriteMesh(args, mesh);
+    geometry::TriangleMesh mesh2;
+    for (auto _ : state) {
+        if (!io::ReadTriangleMesh(args.filename, mesh2)) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+    SetIOCounters(state, args.filename, mesh.vertices_.size());
+    state.counters["triangles"] = double(mesh.triangles_.size());
+}
+
+static void BM_TriangleMeshIO_Args(benchmark::internal::Benchmark *b) {
+    // 10K, 160K and 2.5M triangles
+    for (int resolution = 50; resolution <= 800; resolution *= 4) {
+        for (int i = 0; i < int(g_mesh_args.size()); ++i) {
+            b->Args({i, resolution});
+        }
+    }
+}
+
+BENCHMARK(BM_WriteTriangleMesh)->MinTime(0.1)->Apply(BM_TriangleMeshIO_Args);
+BENCHMARK(BM_ReadTriangleMesh)->MinTime(0.1)->Apply(BM_TriangleMeshIO_Args);
+
+}  // namespace benchmarks
+}  // namespace open3d
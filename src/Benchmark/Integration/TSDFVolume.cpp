@@ -0,0 +1,291 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// TSDF benchmarks on the RGBD sequence of the test data. Integration reports
+// frames/s, and voxels/s over the voxels it updates: all voxels of a
+// UniformTSDFVolume, the voxels of the allocated units of a
+// ScalableTSDFVolume. Extraction reports voxels/s over the voxels it scans.
+//   Uniform: state.range(0) is the resolution over 4 m,
+//   Scalable: state.range(0) is the voxel size in millimeters.
+// The truncation is four voxels.
+
+struct RGBDSequence {
+    camera::PinholeCameraTrajectory trajectory;
+    std::vector<geometry::RGBDImage> images;
+};
+
+// Loads the sequence once.
+static const RGBDSequence& LoadRGBDSequence() {
+    static RGBDSequence sequence;
+    if (!sequence.images.empty()) {
+        return sequence;
+    }
+    io::ReadPinholeCameraTrajectory(TEST_DATA_DIR "/RGBD/odometry.log",
+                                    sequence.trajectory);
+    for (size_t i = 0; i < sequence.trajectory.parameters_.size(); i++) {
+        std::ostringstream color_path, depth_path;
+        color_path << TEST_DATA_DIR "/RGBD/color/" << std::setfill('0')
+                   << std::setw(5) << i << ".jpg";
+        depth_path << TEST_DATA_DIR "/RGBD/depth/" << std::setfill('0')
+                   << std::setw(5) << i << ".png";
+        geometry::Image color, depth;
+        io::ReadImage(color_path.str(), color);
+        io::ReadImage(depth_path.str(), depth);
+        sequence.images.push_back(*geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 4.0, false));
+    }
+    return sequence;
+}
+
+static void IntegrateRGBDSequence(integration::TSDFVolume& volume) {
+    const RGBDSequence& sequence = LoadRGBDSequence();
+    for (size_t i = 0; i < sequence.images.size(); i++) {
+        const camera::PinholeCameraParameters& camera =
+                sequence.trajectory.parameters_[i];
+        volume.Integrate(sequence.images[i], camera.intrinsic_,
+                         camera.extrinsic_);
+    }
+}
+
+// Integrates groups of num_cameras consecutive frames as the views of one
+// multi-camera frame.
+static void IntegrateRGBDSequenceMultiCamera(integration::TSDFVolume& volume,
+                                             int64_t num_cameras) {
+    const RGBDSequence& sequence = LoadRGBDSequence();
+    for (size_t i = 0; i < sequence.images.size(); i += num_cameras) {
+        std::vector<integration::TSDFCameraView> views;
+        for (size_t j = i;
+             j < std::min(sequence.images.size(), i + size_t(num_cameras));
+             j++) {
+            const camera::PinholeCameraParameters& camera =
+                    sequence.trajectory.parameters_[j];
+            views.emplace_back(sequence.images[j], camera.intrinsic_,
+                               camera.extrinsic_);
+        }
+        volume.IntegrateMultiCamera(views);
+    }
+}
+
+static std::shared_ptr<integration::UniformTSDFVolume> CreateUniformVolume(
+        int64_t resolution) {
+    const double length = 4.0;
+    return std::make_shared<integration::UniformTSDFVolume>(
+            length, int(resolution), 4.0 * length / resolution,
+            integration::TSDFVolumeColorType::RGB8);
+}
+
+static std::shared_ptr<integration::ScalableTSDFVolume> CreateScalableVolume(
+        int64_t voxel_size_mm) {
+    const double voxel_length = voxel_size_mm * 1e-3;
+    return std::make_shared<integration::ScalableTSDFVolume>(
+            voxel_length, 4.0 * voxel_length,
+            integration::TSDFVolumeColorType::RGB8);
+}
+
+// Voxels of the allocated units.
+static int64_t GetNumVoxels(const integration::ScalableTSDFVolume& volume) {
+    const int64_t resolution = volume.volume_unit_resolution_;
+    return int64_t(volume.volume_units_.size()) * resolution * resolution *
+           resolution;
+}
+
+static void SetFrameCounters(benchmark::State& state,
+                             int64_t num_voxels_per_frame) {
+    const int64_t num_frames =
+            int64_t(LoadRGBDSequence().images.size()) * state.iterations();
+    state.counters["frames/s"] =
+            benchmark::Counter(double(num_frames), benchmark::Counter::kIsRate);
+    state.SetItemsProcessed(num_frames * num_voxels_per_frame);
+}
+
+static void BM_UniformTSDFVolumeIntegrate(benchmark::State& state) {
+    auto volume = CreateUniformVolume(state.range(0));
+    for (auto _ : state) {
+        IntegrateRGBDSequence(*volume);
+    }
+    SetFrameCounters(state, volume->voxel_num_);
+}
+
+static void BM_ScalableTSDFVolumeIntegrate(benchmark::State& state) {
+    int64_t num_voxels = 0;
+    size_t num_units = 0;
+    for (auto _ : state) {
+        // A new volume per iteration, so that allocation is measured.
+        state.PauseTiming();
+        auto volume = CreateScalableVolume(state.range(0));
+        state.ResumeTiming();
+        IntegrateRGBDSequence(*volume);
+        num_voxels = GetNumVoxels(*volume);
+        num_units = volume->volume_units_.size();
+    }
+    SetFrameCounters(state, num_voxels);
+    state.counters["units"] = double(num_units);
+}
+
+// state.range(1) is the number of cameras of a multi-camera frame; the
+// frames/s are those of single images.
+static void BM_UniformTSDFVolumeIntegrateMultiCamera(benchmark::State& state) {
+    auto volume = CreateUniformVolume(state.range(0));
+    for (auto _ : state) {
+        IntegrateRGBDSequenceMultiCamera(*volume, state.range(1));
+    }
+    SetFrameCounters(state, volume->voxel_num_);
+}
+
+static void BM_ScalableTSDFVolumeIntegrateMultiCamera(
+        benchmark::State& state) {
+    int64_t num_voxels = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto volume = CreateScalableVolume(state.range(0));
+        state.ResumeTiming();
+        IntegrateRGBDSequenceMultiCamera(*volume, state.range(1));
+        num_voxels = GetNumVoxels(*volume);
+    }
+    SetFrameCounters(state, num_voxels);
+}
+
+static void BM_UniformTSDFVolumeExtractPointCloud(benchmark::State& state) {
+    auto volume = CreateUniformVolume(state.range(0));
+    IntegrateRGBDSequence(*volume);
+    size_t num_points = 0;
+    for (auto _ : state) {
+        num_points = volume->ExtractPointCloud()->points_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * volume->voxel_num_);
+    state.counters["points"] = double(num_points);
+}
+
+static void BM_UniformTSDFVolumeExtractTriangleMesh(benchmark::State& state) {
+    auto volume = CreateUniformVolume(state.range(0));
+    IntegrateRGBDSequence(*volume);
+    size_t num_triangles = 0;
+    for (auto _ : state) {
+        num_triangles = volume->ExtractTriangleMesh()->triangles_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * volume->voxel_num_);
+    state.counters["triangles"] = double(num_triangles);
+}
+
+static void BM_ScalableTSDFVolumeExtractPointCloud(benchmark::State& state) {
+    auto volume = CreateScalableVolume(state.range(0));
+    IntegrateRGBDSequence(*volume);
+    size_t num_points = 0;
+    for (auto _ : state) {
+        num_points = volume->ExtractPointCloud()->points_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * GetNumVoxels(*volume));
+    state.counters["points"] = double(num_points);
+}
+
+static void BM_ScalableTSDFVolumeExtractVoxelPointCloud(
+        benchmark::State& state) {
+    auto volume = CreateScalableVolume(state.range(0));
+    IntegrateRGBDSequence(*volume);
+    size_t num_points = 0;
+    for (auto _ : state) {
+        num_points = volume->ExtractVoxelPointCloud()->points_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * GetNumVoxels(*volume));
+    state.counters["points"] = double(num_points);
+}
+
+static void BM_ScalableTSDFVolumeExtractTriangleMesh(benchmark::State& state) {
+    auto volume = CreateScalableVolume(state.range(0));
+    IntegrateRGBDSequence(*volume);
+    size_t num_triangles = 0;
+    for (auto _ : state) {
+        num_triangles = volume->ExtractTriangleMesh()->triangles_.size();
+    }
+    state.SetItemsProcessed(state.iterations() * GetNumVoxels(*volume));
+    state.counters["triangles"] = double(num_triangles);
+}
+
+BENCHMARK(BM_UniformTSDFVolumeIntegrate)
+        ->Arg(128)
+        ->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScalableTSDFVolumeIntegrate)
+        ->Arg(16)
+        ->Arg(8)
+        ->Arg(4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UniformTSDFVolumeIntegrateMultiCamera)
+        ->Args({128, 1})
+        ->Args({128, 4})
+        ->Args({256, 1})
+        ->Args({256, 4})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScalableTSDFVolumeIntegrateMultiCamera)
+        ->Args({8, 1})
+        ->Args({8, 4})
+        ->Args({4, 1})
+        ->Args({4, 4})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UniformTSDFVolumeExtractPointCloud)
+        ->Arg(128)
+        ->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_UniformTSDFVolumeExtractTriangleMesh)
+        ->Arg(128)
+        ->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScalableTSDFVolumeExtractPointCloud)
+        ->Arg(16)
+        ->Arg(8)
+        ->Arg(4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScalableTSDFVolumeExtractVoxelPointCloud)
+        ->Arg(16)
+        ->Arg(8)
+        ->Arg(4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ScalableTSDFVolumeExtractTriangleMesh)
+        ->Arg(16)
+        ->Arg(8)
+        ->Arg(4)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
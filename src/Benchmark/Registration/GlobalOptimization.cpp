@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GlobalOptimization.h"
+
+#include <Eigen/Geometry>
+#include <map>
+#include <random>
+
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
+#include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Pose graph optimization benchmarks. The optimization changes the graph in
+// place, so every iteration optimizes a fresh copy made outside of the timed
+// region.
+
+enum class PoseGraphMethod { GaussNewton = 0, LevenbergMarquardt = 1 };
+
+static const int kPoseGraphLoopClosures = 4;
+
+// Synthetic trajectory on a circle of state.range(0) nodes, with odometry
+// edges between consecutive nodes and kPoseGraphLoopClosures uncertain loop
+// closures per node. The initial poses are perturbed and every tenth loop
+// closure is an outlier. The generator has a fixed seed, so the graph is the
+// same in every run.
+static const registration::PoseGraph& CreateSyntheticPoseGraph(
+        int64_t num_nodes) {
+    static std::map<int64_t, registration::PoseGraph> cache;
+    auto it = cache.find(num_nodes);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    std::mt19937 rng(static_cast<unsigned int>(num_nodes));
+    std::normal_distribution<double> noise(0.0, 0.01);
+    std::uniform_int_distribution<int64_t> node(0, num_nodes - 1);
+    auto perturbation = [&](double scale) {
+        Eigen::Vector6d delta;
+        for (int i = 0; i < 6; i++) {
+            delta(i) = noise(rng) * scale;
+        }
+        return utility::TransformVector6dToMatrix4d(delta);
+    };
+
+    std::vector<Eigen::Matrix4d> poses(num_nodes);
+    for (int64_t i = 0; i < num_nodes; i++) {
+        const double angle = 2.0 * M_PI * double(i) / double(num_nodes);
+        poses[i].setIdentity();
+        poses[i].block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitZ()).matrix();
+        poses[i].block<3, 1>(0, 3) = Eigen::Vector3d(
+                std::cos(angle), std::sin(angle), 0.0) * num_nodes * 0.05;
+    }
+    auto relative = [&](int64_t s, int64_t t) -> Eigen::Matrix4d {
+        return poses[t].inverse() * poses[s];
+    };
+
+    registration::PoseGraph& pose_graph = cache[num_nodes];
+    for (int64_t i = 0; i < num_nodes; i++) {
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(
+                poses[i] * perturbation(double(i) / num_nodes)));
+    }
+    for (int64_t i = 0; i + 1 < num_nodes; i++) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                int(i), int(i + 1), relative(i, i + 1) * perturbation(0.1),
+                Eigen::Matrix6d::Identity() * 1e3, false));
+    }
+    int loop_closure = 0;
+    for (int64_t i = 0; i < num_nodes; i++) {
+        for (int k = 0; k < kPoseGraphLoopClosures; k++) {
+            const int64_t j = node(rng);
+            if (std::abs(j - i) < 2) {
+                continue;
+            }
+            const bool outlier = loop_closure++ % 10 == 0;
+            const Eigen::Matrix4d transformation =
+                    outlier ? Eigen::Matrix4d(perturbation(10.0))
+                            : Eigen::Matrix4d(relative(i, j) *
+                                              perturbation(0.1));
+            pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                    int(i), int(j), transformation,
+                    Eigen::Matrix6d::Identity() * 1e2, true));
+        }
+    }
+    return pose_graph;
+}
+
+static std::shared_ptr<registration::GlobalOptimizationMethod> CreateMethod(
+        PoseGraphMethod method) {
+    if (method == PoseGraphMethod::GaussNewton) {
+        return std::make_shared<registration::GlobalOptimizationGaussNewton>();
+    }
+    return std::make_shared<
+            registration::GlobalOptimizationLevenbergMarquardt>();
+}
+
+static void OptimizePoseGraph(benchmark::State& state,
+                              const registration::PoseGraph& input,
+                              PoseGraphMethod method,
+                              const registration::GlobalOptimizationOption&
+                                      option) {
+    const auto optimizer = CreateMethod(method);
+    const registration::GlobalOptimizationConvergenceCriteria criteria;
+    for (auto _ : state) {
+        state.PauseTiming();
+        registration::PoseGraph pose_graph = input;
+        state.ResumeTiming();
+        registration::GlobalOptimization(pose_graph, *optimizer, criteria,
+                                         option);
+        benchmark::DoNotOptimize(pose_graph.nodes_.data());
+    }
+    state.counters["nodes"] = double(input.nodes_.size());
+    state.counters["edges"] = double(input.edges_.size());
+}
+
+static void BM_PoseGraphSynthetic(benchmark::State& state) {
+    const registration::PoseGraph& input =
+            CreateSyntheticPoseGraph(state.range(0));
+    OptimizePoseGraph(state, input, PoseGraphMethod(state.range(1)),
+                      registration::GlobalOptimizationOption(0.075, 0.25, 1.0,
+                                                             0));
+}
+
+// Node counts times optimization methods.
+static void PoseGraphArguments(benchmark::internal::Benchmark* b) {
+    for (int num_nodes : {50, 100, 200}) {
+        for (PoseGraphMethod method : {PoseGraphMethod::GaussNewton,
+                                       PoseGraphMethod::LevenbergMarquardt}) {
+            b->Args({num_nodes, int(method)});
+        }
+    }
+}
+
+BENCHMARK(BM_PoseGraphSynthetic)
+        ->Apply(PoseGraphArguments)
+        ->Unit(benchmark::kMillisecond);
+
+// Pose graph of the reconstruction system that links the 100 frames of one
+// fragment.
+static void BM_PoseGraphExample(benchmark::State& state,
+                                const std::string& filename,
+                                const registration::GlobalOptimizationOption&
+                                        option) {
+    registration::PoseGraph input;
+    io::ReadPoseGraph(TEST_DATA_DIR "/GraphOptimization/" + filename, input);
+    OptimizePoseGraph(state, input, PoseGraphMethod::LevenbergMarquardt,
+                      option);
+}
+
+BENCHMARK_CAPTURE(BM_PoseGraphExample,
+                  Fragment,
+                  "pose_graph_example_fragment.json",
+                  registration::GlobalOptimizationOption(0.03, 0.25, 0.1, 0))
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
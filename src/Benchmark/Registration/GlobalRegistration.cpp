@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <map>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Global registration benchmarks on the fragments of the global registration
+// tutorial, downsampled to state.range(0) millimeters. Every stage has its
+// own benchmark next to the full registrations:
+//   FPFH: normals and FPFH features of one fragment,
+//   FeatureCorrespondences: mutual nearest neighbors of the features,
+//   RANSAC and FGR: registration from the features.
+// RANSAC and FGR draw their samples from randomly seeded generators, so their
+// times vary more between runs than those of the other stages.
+
+struct FeatureFragments {
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+    std::shared_ptr<registration::Feature> source_feature;
+    std::shared_ptr<registration::Feature> target_feature;
+};
+
+static geometry::PointCloud DownSampleWithNormals(
+        const geometry::PointCloud& pcd, double voxel_size) {
+    geometry::PointCloud down = *pcd.VoxelDownSample(voxel_size);
+    down.EstimateNormals(
+            geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+    return down;
+}
+
+static geometry::KDTreeSearchParamHybrid FPFHParam(double voxel_size) {
+    return geometry::KDTreeSearchParamHybrid(voxel_size * 5.0, 100);
+}
+
+// Loads, downsamples and computes the features once per voxel size.
+static const FeatureFragments& LoadFeatureFragments(int64_t voxel_size_mm) {
+    static std::map<int64_t, FeatureFragments> cache;
+    auto it = cache.find(voxel_size_mm);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    const double voxel_size = voxel_size_mm * 1e-3;
+    geometry::PointCloud source, target;
+    io::ReadPointCloud(TEST_DATA_DIR "/ICP/cloud_bin_0.pcd", source);
+    io::ReadPointCloud(TEST_DATA_DIR "/ICP/cloud_bin_1.pcd", target);
+    FeatureFragments& fragments = cache[voxel_size_mm];
+    fragments.source = DownSampleWithNormals(source, voxel_size);
+    fragments.target = DownSampleWithNormals(target, voxel_size);
+    fragments.source_feature = registration::ComputeFPFHFeature(
+            fragments.source, FPFHParam(voxel_size));
+    fragments.target_feature = registration::ComputeFPFHFeature(
+            fragments.target, FPFHParam(voxel_size));
+    utility::LogInfo("Feature fragments at {:d} mm: {:d} and {:d} points",
+                     voxel_size_mm, fragments.source.points_.size(),
+                     fragments.target.points_.size());
+    return fragments;
+}
+
+static void SetResultCounters(benchmark::State& state,
+                              const registration::RegistrationResult& result,
+                              size_t num_points) {
+    state.counters["points"] = double(num_points);
+    state.counters["fitness"] = result.fitness_;
+    state.counters["rmse"] = result.inlier_rmse_;
+}
+
+static void BM_FPFH(benchmark::State& state) {
+    const FeatureFragments& fragments = LoadFeatureFragments(state.range(0));
+    const double voxel_size = state.range(0) * 1e-3;
+    geometry::PointCloud pcd = fragments.source;
+    for (auto _ : state) {
+        pcd.normals_.clear();
+        pcd.EstimateNormals(
+                geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+        auto feature =
+                registration::ComputeFPFHFeature(pcd, FPFHParam(voxel_size));
+        benchmark::DoNotOptimize(feature->data_.data());
+    }
+    state.counters["points"] = double(pcd.points_.size());
+}
+
+static void BM_FeatureCorrespondences(benchmark::State& state) {
+    const FeatureFragments& fragments = LoadFeatureFragments(state.range(0));
+    registration::CorrespondenceSet corres;
+    for (auto _ : state) {
+        corres = registration::CorrespondencesFromFeatures(
+                *fragments.source_feature, *fragments.target_feature, true);
+        benchmark::DoNotOptimize(corres.data());
+    }
+    state.counters["correspondences"] = double(corres.size());
+}
+
+static void BM_RANSACFeatureMatching(benchmark::State& state) {
+    const FeatureFragments& fragments = LoadFeatureFragments(state.range(0));
+    const double distance = state.range(0) * 1.5e-3;
+    const registration::CorrespondenceCheckerBasedOnEdgeLength edge_length(
+            0.9);
+    const registration::CorrespondenceCheckerBasedOnDistance max_distance(
+            distance);
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::RegistrationRANSACBasedOnFeatureMatching(
+                fragments.source, fragments.target, *fragments.source_feature,
+                *fragments.target_feature, distance,
+                registration::TransformationEstimationPointToPoint(false), 4,
+                {edge_length, max_distance},
+                registration::RANSACConvergenceCriteria(4000000, 500));
+        benchmark::DoNotOptimize(result.transformation_.data());
+    }
+    SetResultCounters(state, result, fragments.source.points_.size());
+}
+
+static void BM_FGR(benchmark::State& state) {
+    const FeatureFragments& fragments = LoadFeatureFragments(state.range(0));
+    const registration::FastGlobalRegistrationOption option(
+            1.4, false, true, state.range(0) * 0.5e-3);
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::FastGlobalRegistration(
+                fragments.source, fragments.target, *fragments.source_feature,
+                *fragments.target_feature, option);
+        benchmark::DoNotOptimize(result.transformation_.data());
+    }
+    SetResultCounters(state, result, fragments.source.points_.size());
+}
+
+BENCHMARK(BM_FPFH)->Arg(50)->Arg(30)->Arg(20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FeatureCorrespondences)
+        ->Arg(50)
+        ->Arg(30)
+        ->Arg(20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RANSACFeatureMatching)
+        ->Arg(50)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FGR)->Arg(50)->Arg(30)->Arg(20)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,254 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/Registration.h"
+
+#include <map>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/RegistrationTarget.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+#include "Open3D/Utility/Console.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// ICP benchmarks on the fragments of the ICP tutorial, downsampled to
+// state.range(0) millimeters, so that the problem size varies. Every stage of
+// ICP has its own benchmark next to the full registration:
+//   IndexBuild: KDTree of the target,
+//   Correspondences: one nearest neighbor search of all source points,
+//   Solve: one linearized step from given correspondences.
+
+enum class ICPMethod { PointToPoint = 0, PointToPlane = 1 };
+
+// Initial alignment and correspondence distance of the ICP tutorial.
+static Eigen::Matrix4d ICPInit() {
+    Eigen::Matrix4d init;
+    init << 0.862, 0.011, -0.507, 0.5, -0.139, 0.967, -0.215, 0.7, 0.487,
+            0.255, 0.835, -1.4, 0.0, 0.0, 0.0, 1.0;
+    return init;
+}
+static const double kICPMaxDistance = 0.02;
+
+struct ICPFragments {
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+};
+
+// Loads and downsamples the fragments once per voxel size.
+static const ICPFragments& LoadICPFragments(int64_t voxel_size_mm) {
+    static std::map<int64_t, ICPFragments> cache;
+    auto it = cache.find(voxel_size_mm);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    geometry::PointCloud source, target;
+    io::ReadPointCloud(TEST_DATA_DIR "/ICP/cloud_bin_0.pcd", source);
+    io::ReadPointCloud(TEST_DATA_DIR "/ICP/cloud_bin_1.pcd", target);
+    ICPFragments& fragments = cache[voxel_size_mm];
+    fragments.source = *source.VoxelDownSample(voxel_size_mm * 1e-3);
+    fragments.target = *target.VoxelDownSample(voxel_size_mm * 1e-3);
+    fragments.target.EstimateNormals(geometry::KDTreeSearchParamHybrid(
+            voxel_size_mm * 2e-3 + 0.01, 30));
+    utility::LogInfo("ICP fragments at {:d} mm: {:d} and {:d} points",
+                     voxel_size_mm, fragments.source.points_.size(),
+                     fragments.target.points_.size());
+    return fragments;
+}
+
+static std::shared_ptr<registration::TransformationEstimation>
+CreateEstimation(ICPMethod method) {
+    if (method == ICPMethod::PointToPlane) {
+        return std::make_shared<
+                registration::TransformationEstimationPointToPlane>();
+    }
+    return std::make_shared<
+            registration::TransformationEstimationPointToPoint>();
+}
+
+static void SetResultCounters(benchmark::State& state,
+                              const registration::RegistrationResult& result,
+                              size_t num_points) {
+    state.counters["points"] = double(num_points);
+    state.counters["fitness"] = result.fitness_;
+    state.counters["rmse"] = result.inlier_rmse_;
+}
+
+static void BM_ICPIndexBuild(benchmark::State& state) {
+    const ICPFragments& fragments = LoadICPFragments(state.range(0));
+    for (auto _ : state) {
+        registration::RegistrationTarget target(fragments.target);
+        benchmark::DoNotOptimize(&target);
+    }
+    state.counters["points"] = double(fragments.target.points_.size());
+}
+
+static void BM_ICPCorrespondences(benchmark::State& state) {
+    const ICPFragments& fragments = LoadICPFragments(state.range(0));
+    const registration::RegistrationTarget target(fragments.target);
+    // No iteration: only the correspondences of the initial alignment.
+    const registration::ICPConvergenceCriteria criteria(1e-6, 1e-6, 0);
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::RegistrationICP(
+                fragments.source, target, kICPMaxDistance, ICPInit(),
+                registration::TransformationEstimationPointToPoint(),
+                criteria);
+        benchmark::DoNotOptimize(result.correspondence_set_.data());
+    }
+    SetResultCounters(state, result, fragments.source.points_.size());
+}
+
+static void BM_ICPSolve(benchmark::State& state) {
+    const ICPFragments& fragments = LoadICPFragments(state.range(0));
+    const auto estimation = CreateEstimation(ICPMethod(state.range(1)));
+    geometry::PointCloud source = fragments.source;
+    source.Transform(ICPInit());
+    const auto result = registration::EvaluateRegistration(
+            source, fragments.target, kICPMaxDistance);
+    for (auto _ : state) {
+        Eigen::Matrix4d update = estimation->ComputeTransformation(
+                source, fragments.target, result.correspondence_set_);
+        benchmark::DoNotOptimize(update.data());
+    }
+    state.counters["correspondences"] =
+            double(result.correspondence_set_.size());
+}
+
+static void BM_ICP(benchmark::State& state) {
+    const ICPFragments& fragments = LoadICPFragments(state.range(0));
+    const auto estimation = CreateEstimation(ICPMethod(state.range(1)));
+    const registration::RegistrationTarget target(fragments.target);
+    const registration::ICPConvergenceCriteria criteria(1e-6, 1e-6, 30);
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::RegistrationICP(fragments.source, target,
+                                               kICPMaxDistance, ICPInit(),
+                                               *estimation, criteria);
+        benchmark::DoNotOptimize(result.transformation_.data());
+    }
+    SetResultCounters(state, result, fragments.source.points_.size());
+}
+
+BENCHMARK(BM_ICPIndexBuild)
+        ->Arg(50)
+        ->Arg(20)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ICPCorrespondences)
+        ->Arg(50)
+        ->Arg(20)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+// Voxel sizes in millimeters times ICP methods.
+static void ICPArguments(benchmark::internal::Benchmark* b) {
+    for (int voxel_size_mm : {50, 20, 10}) {
+        for (ICPMethod method :
+             {ICPMethod::PointToPoint, ICPMethod::PointToPlane}) {
+            b->Args({voxel_size_mm, int(method)});
+        }
+    }
+}
+
+BENCHMARK(BM_ICPSolve)->Apply(ICPArguments)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ICP)->Apply(ICPArguments)->Unit(benchmark::kMillisecond);
+
+// Colored ICP on the fragments of the colored ICP tutorial, downsampled to
+// state.range(0) millimeters. The target with its color gradients is built
+// once, as when it is reused across calls, and separately benchmarked.
+
+struct ColoredICPFragments {
+    geometry::PointCloud source;
+    geometry::PointCloud target;
+};
+
+static const ColoredICPFragments& LoadColoredICPFragments(
+        int64_t voxel_size_mm) {
+    static std::map<int64_t, ColoredICPFragments> cache;
+    auto it = cache.find(voxel_size_mm);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    geometry::PointCloud source, target;
+    io::ReadPointCloud(TEST_DATA_DIR "/ColoredICP/frag_115.ply", source);
+    io::ReadPointCloud(TEST_DATA_DIR "/ColoredICP/frag_116.ply", target);
+    const double voxel_size = voxel_size_mm * 1e-3;
+    const geometry::KDTreeSearchParamHybrid param(voxel_size * 2.0, 30);
+    ColoredICPFragments& fragments = cache[voxel_size_mm];
+    fragments.source = *source.VoxelDownSample(voxel_size);
+    fragments.target = *target.VoxelDownSample(voxel_size);
+    fragments.source.EstimateNormals(param);
+    fragments.target.EstimateNormals(param);
+    return fragments;
+}
+
+static void BM_ColoredICPTargetBuild(benchmark::State& state) {
+    const ColoredICPFragments& fragments =
+            LoadColoredICPFragments(state.range(0));
+    const double max_distance = state.range(0) * 1e-3;
+    for (auto _ : state) {
+        registration::RegistrationTarget target(fragments.target,
+                                                max_distance * 2.0);
+        benchmark::DoNotOptimize(&target);
+    }
+    state.counters["points"] = double(fragments.target.points_.size());
+}
+
+static void BM_ColoredICP(benchmark::State& state) {
+    const ColoredICPFragments& fragments =
+            LoadColoredICPFragments(state.range(0));
+    const double max_distance = state.range(0) * 1e-3;
+    const registration::RegistrationTarget target(fragments.target,
+                                                  max_distance * 2.0);
+    const registration::ICPConvergenceCriteria criteria(1e-6, 1e-6, 30);
+    registration::RegistrationResult result;
+    for (auto _ : state) {
+        result = registration::RegistrationColoredICP(
+                fragments.source, target, max_distance,
+                Eigen::Matrix4d::Identity(), criteria);
+        benchmark::DoNotOptimize(result.transformation_.data());
+    }
+    SetResultCounters(state, result, fragments.source.points_.size());
+}
+
+BENCHMARK(BM_ColoredICPTargetBuild)
+        ->Arg(40)
+        ->Arg(20)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColoredICP)
+        ->Arg(40)
+        ->Arg(20)
+        ->Arg(10)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -56,6 +56,22 @@ PinholeCameraIntrinsic::PinholeCameraIntrinsic(
 
 PinholeCameraIntrinsic::~PinholeCameraIntrinsic() {}
 
+Eigen::Vector2d PinholeCameraIntrinsic::DistortNormalizedPoint(
+        const Eigen::Vector2d &xy) const {
+    const double k1 = distortion_coeffs_(0);
+    const double k2 = distortion_coeffs_(1);
+    const double p1 = distortion_coeffs_(2);
+    const double p2 = distortion_coeffs_(3);
+    const double k3 = distortion_coeffs_(4);
+    const double x = xy(0);
+    const double y = xy(1);
+    const double r2 = x * x + y * y;
+    const double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+    return Eigen::Vector2d(
+            x * radial + 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x),
+            y * radial + p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y);
+}
+
 bool PinholeCameraIntrinsic::ConvertToJsonValue(Json::Value &value) const {
     value["width"] = width_;
     value["height"] = height_;
@@ -63,6 +79,12 @@ bool PinholeCameraIntrinsic::ConvertToJsonValue(Json::Value &value) const {
                                   value["intrinsic_matrix"])) {
         return false;
     }
+    if (HasDistortion()) {
+        value["distortion_coeffs"].resize(5);
+        for (Json::ArrayIndex i = 0; i < 5; i++) {
+            value["distortion_coeffs"][i] = distortion_coeffs_(i);
+        }
+    }
     return true;
 }
 
@@ -81,6 +103,19 @@ bool PinholeCameraIntrinsic::ConvertFromJsonValue(const Json::Value &value) {
                 "PinholeCameraParameters read JSON failed: wrong format.");
         return false;
     }
+    // Optional, without distortion by default.
+    distortion_coeffs_.setZero();
+    const Json::Value &coeffs = value["distortion_coeffs"];
+    if (!coeffs.isNull()) {
+        if (!coeffs.isArray() || coeffs.size() != 5) {
+            utility::LogWarning(
+                    "PinholeCameraParameters read JSON failed: wrong format.");
+            return false;
+        }
+        for (Json::ArrayIndex i = 0; i < 5; i++) {
+            distortion_coeffs_(i) = coeffs[i].asDouble();
+        }
+    }
     return true;
 }
 }  // namespace camera
@@ -103,6 +103,28 @@ public:
     /// Returns the skew.
     double GetSkew() const { return intrinsic_matrix_(0, 1); }
 
+    /// \brief Set the lens distortion coefficients.
+    ///
+    /// \param k1 - first radial distortion coefficient.
+    /// \param k2 - second radial distortion coefficient.
+    /// \param p1 - first tangential distortion coefficient.
+    /// \param p2 - second tangential distortion coefficient.
+    /// \param k3 - third radial distortion coefficient.
+    void SetDistortion(
+            double k1, double k2, double p1, double p2, double k3 = 0.0) {
+        distortion_coeffs_ << k1, k2, p1, p2, k3;
+    }
+
+    /// Returns `true` iff a distortion coefficient is not 0.
+    bool HasDistortion() const { return !distortion_coeffs_.isZero(0.0); }
+
+    /// \brief Applies the lens distortion to a point in normalized image
+    /// coordinates.
+    ///
+    /// \param xy Undistorted point ((u - cx) / fx, (v - cy) / fy), without
+    /// skew.
+    Eigen::Vector2d DistortNormalizedPoint(const Eigen::Vector2d &xy) const;
+
     /// Returns `true` iff both the width and height are greater than 0.
     bool IsValid() const { return (width_ > 0 && height_ > 0); }
 
@@ -120,6 +142,11 @@ public:
     ///`` [0, fy, cy],``\n
     ///`` [0, 0, 1]]``
     Eigen::Matrix3d intrinsic_matrix_;
+    /// Lens distortion coefficients ``[k1, k2, p1, p2, k3]`` of the
+    /// Brown-Conrady model, in the order used by OpenCV. All 0 without
+    /// distortion.
+    Eigen::Matrix<double, 5, 1> distortion_coeffs_ =
+            Eigen::Matrix<double, 5, 1>::Zero();
 };
 }  // namespace camera
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "Open3D/ColorMap/ColorMapOptimization.h"
 
+#include <algorithm>
+
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ColorMapOptimizationJacobian.h"
 #include "Open3D/ColorMap/ImageWarpingField.h"
@@ -38,6 +40,7 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/SparseLinearSolver.h"
 
 namespace open3d {
 
@@ -52,15 +55,17 @@ void OptimizeImageCoorNonrigid(
         std::vector<ImageWarpingField>& warping_fields,
         const std::vector<ImageWarpingField>& warping_fields_init,
         camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
     auto n_vertex = mesh.vertices_.size();
     int n_camera = int(camera.parameters_.size());
     SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                               visibility_vertex_to_image, proxy_intensity,
+                               visibility, proxy_intensity,
                                option.image_boundary_margin_);
+    // The sparsity pattern of JTJ of a camera rarely changes between
+    // iterations, so its symbolic analysis is reused.
+    std::vector<utility::SparseLinearSolverPSD> solvers(n_camera);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
@@ -89,34 +94,45 @@ void OptimizeImageCoorNonrigid(
                         i, J_r, r, pattern, mesh, proxy_intensity,
                         images_gray[c], images_dx[c], images_dy[c],
                         warping_fields[c], warping_fields_init[c], intr,
-                        extrinsic, visibility_image_to_vertex[c],
+                        extrinsic, visibility.ImageVertices(c),
                         option.image_boundary_margin_);
             };
-            Eigen::MatrixXd JTJ;
+            // Flow parameters only couple with neighboring anchors, so JTJ is
+            // sparse and the system is solved without forming it densely.
+            Eigen::SparseMatrix<double> JTJ;
             Eigen::VectorXd JTr;
             double r2;
-            std::tie(JTJ, JTr, r2) =
-                    ComputeJTJandJTrNonRigid<Eigen::Vector14d, Eigen::Vector14i,
-                                             Eigen::MatrixXd, Eigen::VectorXd>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            nonrigidval, false);
+            std::tie(JTJ, JTr, r2) = ComputeSparseJTJandJTrNonRigid(
+                    f_lambda, int(visibility.NumImageVertices(c)), nonrigidval,
+                    warping_fields[c].anchor_w_);
 
             double weight = option.non_rigid_anchor_point_weight_ *
-                            visibility_image_to_vertex[c].size() / n_vertex;
+                            visibility.NumImageVertices(c) / n_vertex;
+            std::vector<Eigen::Triplet<double>> regularization;
+            regularization.reserve(nonrigidval);
             for (int j = 0; j < nonrigidval; j++) {
                 double r = weight * (warping_fields[c].flow_(j) -
                                      warping_fields_init[c].flow_(j));
-                JTJ(6 + j, 6 + j) += weight * weight;
+                regularization.emplace_back(6 + j, 6 + j, weight * weight);
                 JTr(6 + j) += weight * r;
                 rr_reg += r * r;
             }
+            Eigen::SparseMatrix<double> JTJ_reg(JTJ.rows(), JTJ.cols());
+            JTJ_reg.setFromTriplets(regularization.begin(),
+                                    regularization.end());
+            JTJ += JTJ_reg;
 
-            bool success;
+            bool success = false;
             Eigen::VectorXd result;
-            std::tie(success, result) = utility::SolveLinearSystemPSD(
-                    JTJ, -JTr, /*prefer_sparse=*/false,
-                    /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            if (solvers[c].Compute(JTJ)) {
+                std::tie(success, result) = solvers[c].Solve(-JTr);
+            }
+            if (!success) {
+                std::tie(success, result) = utility::SolveLinearSystemPSD(
+                        Eigen::MatrixXd(JTJ), -JTr, /*prefer_sparse=*/false,
+                        /*check_symmetric=*/false,
+                        /*check_det=*/false, /*check_psd=*/false);
+            }
             Eigen::Vector6d result_pose;
             result_pose << result.block(0, 0, 6, 1);
             auto delta = utility::TransformVector6dToMatrix4d(result_pose);
@@ -138,7 +154,7 @@ void OptimizeImageCoorNonrigid(
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
         SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
-                                   visibility_vertex_to_image, proxy_intensity,
+                                   visibility, proxy_intensity,
                                    option.image_boundary_margin_);
     }
 }
@@ -149,21 +165,23 @@ void OptimizeImageCoorRigid(
         const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
         const std::vector<std::shared_ptr<geometry::Image>>& images_dy,
         camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        const std::vector<std::vector<int>>& visibility_image_to_vertex,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         const ColorMapOptimizationOption& option) {
-    int total_num_ = 0;
     int n_camera = int(camera.parameters_.size());
+    int stride = std::max(option.rigid_vertex_sample_stride_, 1);
     SetProxyIntensityForVertex(mesh, images_gray, camera,
-                               visibility_vertex_to_image, proxy_intensity,
+                               visibility, proxy_intensity,
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
-        total_num_ = 0;
+        int total_num_ = 0;
+        // Cameras are solved concurrently, each thread accumulates the 6x6
+        // system of a camera on its own. The number of visible vertices
+        // varies a lot between cameras, so they are scheduled dynamically.
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(dynamic) reduction(+ : residual, total_num_)
 #endif
         for (int c = 0; c < n_camera; c++) {
             Eigen::Matrix4d pose;
@@ -176,20 +194,22 @@ void OptimizeImageCoorRigid(
             intr.block<3, 3>(0, 0) = intrinsic;
             intr(3, 3) = 1.0;
 
-            auto f_lambda = [&](int i, Eigen::Vector6d& J_r, double& r) {
+            const int* visible = visibility.ImageVertices(c);
+            const int n_visible = int(visibility.NumImageVertices(c));
+            Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+            Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+            Eigen::Vector6d J_r;
+            double r;
+            double r2 = 0.0;
+            for (int i = 0; i < n_visible; i += stride) {
                 jac.ComputeJacobianAndResidualRigid(
                         i, J_r, r, mesh, proxy_intensity, images_gray[c],
-                        images_dx[c], images_dy[c], intr, extrinsic,
-                        visibility_image_to_vertex[c],
+                        images_dx[c], images_dy[c], intr, extrinsic, visible,
                         option.image_boundary_margin_);
-            };
-            Eigen::Matrix6d JTJ;
-            Eigen::Vector6d JTr;
-            double r2;
-            std::tie(JTJ, JTr, r2) =
-                    utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                            f_lambda, int(visibility_image_to_vertex[c].size()),
-                            false);
+                JTJ.noalias() += J_r * J_r.transpose();
+                JTr.noalias() += J_r * r;
+                r2 += r * r;
+            }
 
             bool is_success;
             Eigen::Matrix4d delta;
@@ -198,65 +218,30 @@ void OptimizeImageCoorRigid(
                                                                          JTr);
             pose = delta * pose;
             camera.parameters_[c].extrinsic_ = pose;
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-            {
-                residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
-            }
+            residual += r2;
+            total_num_ += (n_visible + stride - 1) / stride;
         }
         utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
                           residual / total_num_);
         SetProxyIntensityForVertex(mesh, images_gray, camera,
-                                   visibility_vertex_to_image, proxy_intensity,
+                                   visibility, proxy_intensity,
                                    option.image_boundary_margin_);
     }
 }
 
-std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>,
-           std::vector<std::shared_ptr<geometry::Image>>>
-CreateGradientImages(
-        const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd) {
-    std::vector<std::shared_ptr<geometry::Image>> images_gray;
-    std::vector<std::shared_ptr<geometry::Image>> images_dx;
-    std::vector<std::shared_ptr<geometry::Image>> images_dy;
-    std::vector<std::shared_ptr<geometry::Image>> images_color;
-    std::vector<std::shared_ptr<geometry::Image>> images_depth;
-    for (size_t i = 0; i < images_rgbd.size(); i++) {
-        auto gray_image = images_rgbd[i]->color_.CreateFloatImage();
-        auto gray_image_filtered =
-                gray_image->Filter(geometry::Image::FilterType::Gaussian3);
-        images_gray.push_back(gray_image_filtered);
-        images_dx.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dx));
-        images_dy.push_back(gray_image_filtered->Filter(
-                geometry::Image::FilterType::Sobel3Dy));
-        auto color = std::make_shared<geometry::Image>(images_rgbd[i]->color_);
-        auto depth = std::make_shared<geometry::Image>(images_rgbd[i]->depth_);
-        images_color.push_back(color);
-        images_depth.push_back(depth);
-    }
-    return std::make_tuple(images_gray, images_dx, images_dy, images_color,
-                           images_depth);
-}
-
-std::vector<std::shared_ptr<geometry::Image>> CreateDepthBoundaryMasks(
-        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
-        const ColorMapOptimizationOption& option) {
-    auto n_images = images_depth.size();
-    std::vector<std::shared_ptr<geometry::Image>> masks;
-    for (size_t i = 0; i < n_images; i++) {
-        utility::LogDebug("[MakeDepthMasks] geometry::Image {:d}/{:d}", i,
-                          n_images);
-        masks.push_back(images_depth[i]->CreateDepthBoundaryMask(
-                option.depth_threshold_for_discontinuity_check_,
-                option.half_dilation_kernel_size_for_discontinuity_map_));
-    }
-    return masks;
+/// Creates the smoothed gray image of \p image_rgbd and its gradients.
+std::tuple<std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>>
+CreateGradientImages(const geometry::RGBDImage& image_rgbd) {
+    auto gray_image = image_rgbd.color_.CreateFloatImage();
+    auto gray_image_filtered =
+            gray_image->Filter(geometry::Image::FilterType::Gaussian3);
+    return std::make_tuple(gray_image_filtered,
+                           gray_image_filtered->Filter(
+                                   geometry::Image::FilterType::Sobel3Dx),
+                           gray_image_filtered->Filter(
+                                   geometry::Image::FilterType::Sobel3Dy));
 }
 
 std::vector<ImageWarpingField> CreateWarpingFields(
@@ -281,45 +266,68 @@ void ColorMapOptimization(
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option
         /* = ColorMapOptimizationOption()*/) {
-    utility::LogDebug("[ColorMapOptimization]");
-    std::vector<std::shared_ptr<geometry::Image>> images_gray, images_dx,
-            images_dy, images_color, images_depth;
-    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
-            CreateGradientImages(images_rgbd);
-
-    utility::LogDebug("[ColorMapOptimization] :: MakingMasks");
-    auto images_mask = CreateDepthBoundaryMasks(images_depth, option);
+    if (images_rgbd.size() != camera.parameters_.size()) {
+        utility::LogError(
+                "[ColorMapOptimization] The number of images and cameras "
+                "differ.");
+    }
+    ColorMapOptimization(
+            mesh, [&images_rgbd](int i) { return images_rgbd[i]; }, camera,
+            option);
+}
 
+void ColorMapOptimization(geometry::TriangleMesh& mesh,
+                          const RGBDImageLoader& image_loader,
+                          camera::PinholeCameraTrajectory& camera,
+                          const ColorMapOptimizationOption& option
+                          /* = ColorMapOptimizationOption()*/) {
+    utility::LogDebug("[ColorMapOptimization]");
+    // Every image is loaded once for its gradient images, its depth boundary
+    // mask and its visibility. Only the gradient images are kept.
+    int n_camera = int(camera.parameters_.size());
+    std::vector<std::shared_ptr<geometry::Image>> images_gray(n_camera),
+            images_dx(n_camera), images_dy(n_camera);
+    VertexAndImageVisibility visibility;
+    visibility.image_offsets_.push_back(0);
+    for (int c = 0; c < n_camera; c++) {
+        utility::LogDebug("[ColorMapOptimization] :: Image {:d}/{:d}", c + 1,
+                          n_camera);
+        std::shared_ptr<geometry::RGBDImage> image_rgbd = image_loader(c);
+        std::tie(images_gray[c], images_dx[c], images_dy[c]) =
+                CreateGradientImages(*image_rgbd);
+        auto mask = image_rgbd->depth_.CreateDepthBoundaryMask(
+                option.depth_threshold_for_discontinuity_check_,
+                option.half_dilation_kernel_size_for_discontinuity_map_);
+        AddImageVisibility(mesh, image_rgbd->depth_, *mask, camera, c,
+                           option.maximum_allowable_depth_,
+                           option.depth_threshold_for_visibility_check_,
+                           visibility);
+    }
     utility::LogDebug("[ColorMapOptimization] :: VisibilityCheck");
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    std::vector<std::vector<int>> visibility_image_to_vertex;
-    std::tie(visibility_vertex_to_image, visibility_image_to_vertex) =
-            CreateVertexAndImageVisibility(
-                    mesh, images_depth, images_mask, camera,
-                    option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+    ComputeVertexToImageVisibility(mesh.vertices_.size(), visibility);
 
     std::vector<double> proxy_intensity;
     if (option.non_rigid_camera_coordinate_) {
         utility::LogDebug("[ColorMapOptimization] :: Non-Rigid Optimization");
         auto warping_uv_ = CreateWarpingFields(images_gray, option);
         auto warping_uv_init_ = CreateWarpingFields(images_gray, option);
-        OptimizeImageCoorNonrigid(
-                mesh, images_gray, images_dx, images_dy, warping_uv_,
-                warping_uv_init_, camera, visibility_vertex_to_image,
-                visibility_image_to_vertex, proxy_intensity, option);
-        SetGeometryColorAverage(mesh, images_color, warping_uv_, camera,
-                                visibility_vertex_to_image,
-                                option.image_boundary_margin_,
+        OptimizeImageCoorNonrigid(mesh, images_gray, images_dx, images_dy,
+                                  warping_uv_, warping_uv_init_, camera,
+                                  visibility, proxy_intensity, option);
+        images_gray.clear();
+        images_dx.clear();
+        images_dy.clear();
+        SetGeometryColorAverage(mesh, image_loader, warping_uv_, camera,
+                                visibility, option.image_boundary_margin_,
                                 option.invisible_vertex_color_knn_);
     } else {
         utility::LogDebug("[ColorMapOptimization] :: Rigid Optimization");
         OptimizeImageCoorRigid(mesh, images_gray, images_dx, images_dy, camera,
-                               visibility_vertex_to_image,
-                               visibility_image_to_vertex, proxy_intensity,
-                               option);
-        SetGeometryColorAverage(mesh, images_color, camera,
-                                visibility_vertex_to_image,
+                               visibility, proxy_intensity, option);
+        images_gray.clear();
+        images_dx.clear();
+        images_dy.clear();
+        SetGeometryColorAverage(mesh, image_loader, camera, visibility,
                                 option.image_boundary_margin_,
                                 option.invisible_vertex_color_knn_);
     }
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -46,6 +47,11 @@ class PinholeCameraTrajectory;
 
 namespace color_map {
 
+/// Returns the RGB-D image of camera i, e.g. read from disk, so that the
+/// images do not all have to be held in memory.
+typedef std::function<std::shared_ptr<geometry::RGBDImage>(int)>
+        RGBDImageLoader;
+
 /// \class ColorMapOptimizationOption
 ///
 /// \brief Defines options for color map optimization.
@@ -63,7 +69,8 @@ public:
             double depth_threshold_for_discontinuity_check = 0.1,
             int half_dilation_kernel_size_for_discontinuity_map = 3,
             int image_boundary_margin = 10,
-            int invisible_vertex_color_knn = 3)
+            int invisible_vertex_color_knn = 3,
+            int rigid_vertex_sample_stride = 1)
         : non_rigid_camera_coordinate_(non_rigid_camera_coordinate),
           number_of_vertical_anchors_(number_of_vertical_anchors),
           non_rigid_anchor_point_weight_(non_rigid_anchor_point_weight),
@@ -76,7 +83,8 @@ public:
           half_dilation_kernel_size_for_discontinuity_map_(
                   half_dilation_kernel_size_for_discontinuity_map),
           image_boundary_margin_(image_boundary_margin),
-          invisible_vertex_color_knn_(invisible_vertex_color_knn) {}
+          invisible_vertex_color_knn_(invisible_vertex_color_knn),
+          rigid_vertex_sample_stride_(rigid_vertex_sample_stride) {}
     ~ColorMapOptimizationOption() {}
 
 public:
@@ -131,6 +139,11 @@ public:
     ///  of the k nearest visible vertices to fill the invisible vertex. Set to
     ///  0 to disable this feature and all invisible vertices will be black.
     int invisible_vertex_color_knn_;
+    ///  Only every rigid_vertex_sample_stride-th vertex visible from an image
+    ///  contributes to the rigid optimization of its camera. Set to a value
+    ///  larger than 1 to speed up the rigid optimization of large meshes. The
+    ///  proxy intensities and the final colors still use all vertices.
+    int rigid_vertex_sample_stride_;
 };
 
 /// \brief Function for color mapping of reconstructed scenes via optimization.
@@ -151,5 +164,24 @@ void ColorMapOptimization(
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option =
                 ColorMapOptimizationOption());
+
+/// \brief Function for color mapping of reconstructed scenes via optimization,
+/// with RGB-D images loaded on demand.
+///
+/// Every image is loaded twice, once to compute its gradient images and its
+/// visibility, and once to compute the final vertex colors. Only the gradient
+/// images are kept in memory during the optimization.
+///
+/// \param mesh The input geometry mesh.
+/// \param image_loader Returns the RGBDImage seen by camera i, for every
+/// camera of \p camera.
+/// \param camera Cameras' parameters.
+/// \param option Color map optimization options. Takes the original
+/// ColorMapOptimizationOption values by default.
+void ColorMapOptimization(geometry::TriangleMesh& mesh,
+                          const RGBDImageLoader& image_loader,
+                          camera::PinholeCameraTrajectory& camera,
+                          const ColorMapOptimizationOption& option =
+                                  ColorMapOptimizationOption());
 }  // namespace color_map
 }  // namespace open3d
@@ -44,7 +44,7 @@ void ColorMapOptimizationJacobian::ComputeJacobianAndResidualRigid(
         const std::shared_ptr<geometry::Image>& images_dy,
         const Eigen::Matrix4d& intrinsic,
         const Eigen::Matrix4d& extrinsic,
-        const std::vector<int>& visibility_image_to_vertex,
+        const int* visibility_image_to_vertex,
         const int image_boundary_margin) {
     J_r.setZero();
     r = 0;
@@ -88,7 +88,7 @@ void ColorMapOptimizationJacobian::ComputeJacobianAndResidualNonRigid(
         const ImageWarpingField& warping_fields_init,
         const Eigen::Matrix4d& intrinsic,
         const Eigen::Matrix4d& extrinsic,
-        const std::vector<int>& visibility_image_to_vertex,
+        const int* visibility_image_to_vertex,
         const int image_boundary_margin) {
     J_r.setZero();
     pattern.setZero();
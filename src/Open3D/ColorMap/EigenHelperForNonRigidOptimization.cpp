@@ -27,6 +27,8 @@
 #include "Open3D/ColorMap/EigenHelperForNonRigidOptimization.h"
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace color_map {
@@ -98,5 +100,123 @@ ComputeJTJandJTrNonRigid(
         int nonrigidval,
         bool verbose);
 
+namespace {
+
+/// Normal equations of ComputeSparseJTJandJTrNonRigid. The flow block keeps
+/// the 2x2 blocks of every anchor with its 3x3 neighborhood of anchors.
+struct NonRigidNormalEquations {
+    NonRigidNormalEquations() {}
+    NonRigidNormalEquations(int nonrigidval)
+        : pose_flow_(Eigen::MatrixXd::Zero(6, nonrigidval)),
+          flow_flow_(size_t(nonrigidval / 2) * 9 * 4, 0.0),
+          JTr_(Eigen::VectorXd::Zero(6 + nonrigidval)) {
+        pose_pose_.setZero();
+    }
+
+    NonRigidNormalEquations &operator+=(const NonRigidNormalEquations &other) {
+        pose_pose_ += other.pose_pose_;
+        pose_flow_ += other.pose_flow_;
+        for (size_t i = 0; i < flow_flow_.size(); i++) {
+            flow_flow_[i] += other.flow_flow_[i];
+        }
+        JTr_ += other.JTr_;
+        r2_sum_ += other.r2_sum_;
+        return *this;
+    }
+
+    Eigen::Matrix6d_u pose_pose_;
+    Eigen::MatrixXd pose_flow_;
+    std::vector<double> flow_flow_;
+    Eigen::VectorXd JTr_;
+    double r2_sum_ = 0.0;
+};
+
+}  // unnamed namespace
+
+std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd, double>
+ComputeSparseJTJandJTrNonRigid(
+        std::function<
+                void(int, Eigen::Vector14d &, double &, Eigen::Vector14i &)> f,
+        int iteration_num,
+        int nonrigidval,
+        int anchor_w) {
+    // Slot of anchor b in the neighborhood of anchor a.
+    auto neighbor_slot = [anchor_w](int a, int b) {
+        const int di = b % anchor_w - a % anchor_w;
+        const int dj = b / anchor_w - a / anchor_w;
+        return (dj + 1) * 3 + di + 1;
+    };
+    const NonRigidNormalEquations identity(nonrigidval);
+    const NonRigidNormalEquations sum = utility::ParallelReduce(
+            0, iteration_num, identity,
+            [&](int64_t begin, int64_t end,
+                const NonRigidNormalEquations &init) {
+                NonRigidNormalEquations eq = init;
+                Eigen::Vector14d J_r;
+                Eigen::Vector14i pattern;
+                double r;
+                for (int64_t i = begin; i < end; i++) {
+                    f(int(i), J_r, r, pattern);
+                    eq.r2_sum_ += r * r;
+                    if (pattern(6) < 6) {
+                        continue;
+                    }
+                    eq.pose_pose_ += J_r.head<6>() * J_r.head<6>().transpose();
+                    eq.JTr_.head<6>() += r * J_r.head<6>();
+                    for (int k = 6; k < 14; k++) {
+                        const int flow_k = pattern(k) - 6;
+                        const int anchor_k = flow_k / 2;
+                        eq.pose_flow_.col(flow_k) += J_r(k) * J_r.head<6>();
+                        eq.JTr_(pattern(k)) += r * J_r(k);
+                        for (int l = 6; l < 14; l++) {
+                            const int flow_l = pattern(l) - 6;
+                            const int slot =
+                                    neighbor_slot(anchor_k, flow_l / 2);
+                            eq.flow_flow_[(anchor_k * 9 + slot) * 4 +
+                                          (flow_k % 2) * 2 + flow_l % 2] +=
+                                    J_r(k) * J_r(l);
+                        }
+                    }
+                }
+                return eq;
+            },
+            [](NonRigidNormalEquations lhs,
+               const NonRigidNormalEquations &rhs) {
+                lhs += rhs;
+                return lhs;
+            },
+            4096);
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(36 + 12 * nonrigidval + 18 * nonrigidval);
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            triplets.emplace_back(i, j, sum.pose_pose_(i, j));
+        }
+        for (int j = 0; j < nonrigidval; j++) {
+            if (sum.pose_flow_(i, j) != 0.0) {
+                triplets.emplace_back(i, 6 + j, sum.pose_flow_(i, j));
+                triplets.emplace_back(6 + j, i, sum.pose_flow_(i, j));
+            }
+        }
+    }
+    const int num_anchors = nonrigidval / 2;
+    for (int a = 0; a < num_anchors; a++) {
+        for (int slot = 0; slot < 9; slot++) {
+            const int b = a + (slot / 3 - 1) * anchor_w + slot % 3 - 1;
+            for (int d = 0; d < 4; d++) {
+                const double value = sum.flow_flow_[(a * 9 + slot) * 4 + d];
+                if (value != 0.0) {
+                    triplets.emplace_back(6 + a * 2 + d / 2,
+                                          6 + b * 2 + d % 2, value);
+                }
+            }
+        }
+    }
+    Eigen::SparseMatrix<double> JTJ(6 + nonrigidval, 6 + nonrigidval);
+    JTJ.setFromTriplets(triplets.begin(), triplets.end());
+    return std::make_tuple(std::move(JTJ), sum.JTr_, sum.r2_sum_);
+}
+
 }  // namespace color_map
 }  // namespace open3d
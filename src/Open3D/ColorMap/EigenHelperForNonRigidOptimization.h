@@ -27,6 +27,8 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <functional>
 #include <tuple>
 #include <vector>
 
@@ -57,5 +59,22 @@ std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
         int nonrigidval,
         bool verbose = true);
 
+/// \brief Function to compute JTJ and JTr of the non-rigid optimization of
+/// one image, with a sparse JTJ.
+///
+/// The rows are those of ComputeJacobianAndResidualNonRigid: the 6 pose
+/// parameters and the flow of the 4 anchors around the pixel of a vertex.
+/// Flow parameters therefore only share rows with anchors at most one cell
+/// away, and JTJ has O(nonrigidval) non-zeros instead of nonrigidval^2. The
+/// anchors are laid out in rows of \p anchor_w, as in ImageWarpingField.
+/// Rows with a zero pattern, i.e. of vertices outside the image, are skipped.
+std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd, double>
+ComputeSparseJTJandJTrNonRigid(
+        std::function<
+                void(int, Eigen::Vector14d &, double &, Eigen::Vector14i &)> f,
+        int iteration_num,
+        int nonrigidval,
+        int anchor_w);
+
 }  // namespace color_map
 }  // namespace open3d
@@ -26,15 +26,27 @@
 
 #include "Open3D/ColorMap/TriangleMeshAndImageUtilities.h"
 
+#include <algorithm>
+
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ImageWarpingField.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace color_map {
+
+namespace {
+
+// Vertices per task of the visibility computations.
+constexpr int64_t kVisibilityBlockSize = 4096;
+
+}  // unnamed namespace
+
 inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
         const Eigen::Vector3d X,
         const camera::PinholeCameraTrajectory& camera,
@@ -51,49 +63,43 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
     return std::make_tuple(u, v, z);
 }
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
-        const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
-        const camera::PinholeCameraTrajectory& camera,
-        double maximum_allowable_depth,
-        double depth_threshold_for_visibility_check) {
-    size_t n_camera = camera.parameters_.size();
-    size_t n_vertex = mesh.vertices_.size();
-    // visibility_image_to_vertex[c]: vertices visible by camera c.
-    std::vector<std::vector<int>> visibility_image_to_vertex;
-    visibility_image_to_vertex.resize(n_camera);
-    // visibility_vertex_to_image[v]: cameras that can see vertex v.
-    std::vector<std::vector<int>> visibility_vertex_to_image;
-    visibility_vertex_to_image.resize(n_vertex);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+void AddImageVisibility(const geometry::TriangleMesh& mesh,
+                        const geometry::Image& depth,
+                        const geometry::Image& mask,
+                        const camera::PinholeCameraTrajectory& camera,
+                        int camid,
+                        double maximum_allowable_depth,
+                        double depth_threshold_for_visibility_check,
+                        VertexAndImageVisibility& visibility) {
+    const int64_t n_vertex = int64_t(mesh.vertices_.size());
+    // Blocks of vertices are tested in parallel, without locks, and then
+    // concatenated in order.
+    const int64_t n_block =
+            (n_vertex + kVisibilityBlockSize - 1) / kVisibilityBlockSize;
+    std::vector<std::vector<int>> block_visibility(n_block);
+    utility::ParallelFor(0, n_block, [&](int64_t block) {
+        const int64_t vertex_end =
+                std::min(n_vertex, (block + 1) * kVisibilityBlockSize);
+        std::vector<int>& visible = block_visibility[block];
+        for (int64_t vertex_id = block * kVisibilityBlockSize;
+             vertex_id < vertex_end; vertex_id++) {
             Eigen::Vector3d X = mesh.vertices_[vertex_id];
             float u, v, d;
-            std::tie(u, v, d) =
-                    Project3DPointAndGetUVDepth(X, camera, camera_id);
+            std::tie(u, v, d) = Project3DPointAndGetUVDepth(X, camera, camid);
             int u_d = int(round(u)), v_d = int(round(v));
             // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id]->TestImageBoundary(u_d, v_d)) {
+            if (d < 0.0 || !depth.TestImageBoundary(u_d, v_d)) {
                 continue;
             }
             // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id]->PointerAt<float>(u_d, v_d);
+            float d_sensor = *depth.PointerAt<float>(u_d, v_d);
             if (d_sensor > maximum_allowable_depth) {
                 continue;
             }
             // Check depth boundary mask. If a vertex is located at the boundary
             // of an object, its color will be highly diverse from different
             // viewing angles.
-            if (*images_mask[camera_id]->PointerAt<unsigned char>(u_d, v_d) ==
-                255) {
+            if (*mask.PointerAt<unsigned char>(u_d, v_d) == 255) {
                 continue;
             }
             // Check depth errors.
@@ -101,24 +107,90 @@ CreateVertexAndImageVisibility(
                 depth_threshold_for_visibility_check) {
                 continue;
             }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+            visible.push_back(int(vertex_id));
         }
+    });
+
+    if (visibility.image_offsets_.empty()) {
+        visibility.image_offsets_.push_back(0);
+    }
+    std::vector<int>& image_vertices = visibility.image_vertices_;
+    for (const std::vector<int>& visible : block_visibility) {
+        image_vertices.insert(image_vertices.end(), visible.begin(),
+                              visible.end());
     }
+    visibility.image_offsets_.push_back(int64_t(image_vertices.size()));
+    const int64_t n_visible_vertex = visibility.NumImageVertices(camid);
+    utility::LogDebug("[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible",
+                      camid, n_visible_vertex, n_vertex,
+                      double(n_visible_vertex) / n_vertex * 100);
+}
 
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        size_t n_visible_vertex = visibility_image_to_vertex[camera_id].size();
-        utility::LogDebug(
-                "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible",
-                camera_id, n_visible_vertex, n_vertex,
-                double(n_visible_vertex) / n_vertex * 100);
+void ComputeVertexToImageVisibility(size_t n_vertex,
+                                    VertexAndImageVisibility& visibility) {
+    const int64_t n_camera = int64_t(visibility.NumImages());
+    const int64_t n_block =
+            (int64_t(n_vertex) + kVisibilityBlockSize - 1) /
+            kVisibilityBlockSize;
+    // The visible vertices of a camera are sorted, so the ones of a block are
+    // found by binary search. Every block is transposed by one task, cameras
+    // in increasing order, first to count and then to fill.
+    auto for_each_in_block = [&](int64_t block, auto func) {
+        const int vertex_begin = int(block * kVisibilityBlockSize);
+        const int vertex_end = int(std::min(int64_t(n_vertex),
+                                            (block + 1) * kVisibilityBlockSize));
+        for (int64_t c = 0; c < n_camera; c++) {
+            const int* begin = visibility.ImageVertices(c);
+            const int* end = begin + visibility.NumImageVertices(c);
+            for (const int* it = std::lower_bound(begin, end, vertex_begin);
+                 it != end && *it < vertex_end; ++it) {
+                func(*it, int(c));
+            }
+        }
+    };
+
+    std::vector<int64_t>& offsets = visibility.vertex_offsets_;
+    offsets.assign(n_vertex + 1, 0);
+    utility::ParallelFor(0, n_block, [&](int64_t block) {
+        for_each_in_block(block, [&](int vertex_id, int) {
+            offsets[vertex_id + 1]++;
+        });
+    });
+    for (size_t i = 0; i < n_vertex; i++) {
+        offsets[i + 1] += offsets[i];
     }
+    visibility.vertex_images_.resize(offsets[n_vertex]);
+    utility::ParallelFor(0, n_block, [&](int64_t block) {
+        const int vertex_begin = int(block * kVisibilityBlockSize);
+        const int vertex_end = int(std::min(int64_t(n_vertex),
+                                            (block + 1) * kVisibilityBlockSize));
+        std::vector<int64_t> fill(offsets.begin() + vertex_begin,
+                                  offsets.begin() + vertex_end);
+        for_each_in_block(block, [&](int vertex_id, int camera_id) {
+            visibility.vertex_images_[fill[vertex_id - vertex_begin]++] =
+                    camera_id;
+        });
+    });
+}
 
-    return std::make_tuple(visibility_vertex_to_image,
-                           visibility_image_to_vertex);
+VertexAndImageVisibility CreateVertexAndImageVisibility(
+        const geometry::TriangleMesh& mesh,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
+        const camera::PinholeCameraTrajectory& camera,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    VertexAndImageVisibility visibility;
+    visibility.image_offsets_.push_back(0);
+    for (int camera_id = 0; camera_id < int(camera.parameters_.size());
+         camera_id++) {
+        AddImageVisibility(mesh, *images_depth[camera_id],
+                           *images_mask[camera_id], camera, camera_id,
+                           maximum_allowable_depth,
+                           depth_threshold_for_visibility_check, visibility);
+    }
+    ComputeVertexToImageVisibility(mesh.vertices_.size(), visibility);
+    return visibility;
 }
 
 template <typename T>
@@ -179,7 +251,7 @@ void SetProxyIntensityForVertex(
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<ImageWarpingField>& warping_field,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin) {
     auto n_vertex = mesh.vertices_.size();
@@ -191,9 +263,9 @@ void SetProxyIntensityForVertex(
     for (int i = 0; i < int(n_vertex); i++) {
         proxy_intensity[i] = 0.0;
         float sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
+        const int* images = visibility.VertexImages(i);
+        for (int64_t iter = 0; iter < visibility.NumVertexImages(i); iter++) {
+            int j = images[iter];
             float gray;
             bool valid = false;
             std::tie(valid, gray) = QueryImageIntensity<float>(
@@ -214,7 +286,7 @@ void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin) {
     auto n_vertex = mesh.vertices_.size();
@@ -226,9 +298,9 @@ void SetProxyIntensityForVertex(
     for (int i = 0; i < int(n_vertex); i++) {
         proxy_intensity[i] = 0.0;
         float sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
+        const int* images = visibility.VertexImages(i);
+        for (int64_t iter = 0; iter < visibility.NumVertexImages(i); iter++) {
+            int j = images[iter];
             float gray;
             bool valid = false;
             std::tie(valid, gray) = QueryImageIntensity<float>(
@@ -245,56 +317,52 @@ void SetProxyIntensityForVertex(
     }
 }
 
-void SetGeometryColorAverage(
-        geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
-        const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
-        int image_boundary_margin /*= 10*/,
-        int invisible_vertex_color_knn /*= 3*/) {
+namespace {
+
+/// Colors the vertices with the average of the colors returned by
+/// query_color(image, vertex_id, camera_id, color) for the cameras that see
+/// them, loading one image at a time. Vertices seen by no camera get the
+/// average color of their invisible_vertex_color_knn nearest colored
+/// vertices.
+template <typename QueryColor>
+void SetGeometryColorAverageImpl(geometry::TriangleMesh& mesh,
+                                 const RGBDImageLoader& image_loader,
+                                 const VertexAndImageVisibility& visibility,
+                                 int invisible_vertex_color_knn,
+                                 const QueryColor& query_color) {
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
+    mesh.vertex_colors_.resize(n_vertex, Eigen::Vector3d::Zero());
+    // The vertices of a camera are distinct, so every camera accumulates into
+    // its vertices in parallel. A vertex adds its cameras in increasing order.
+    std::vector<int> n_valid(n_vertex, 0);
+    for (int c = 0; c < int(visibility.NumImages()); c++) {
+        const int64_t n_image_vertex = visibility.NumImageVertices(c);
+        if (n_image_vertex == 0) {
+            continue;
+        }
+        std::shared_ptr<geometry::RGBDImage> image = image_loader(c);
+        const int* vertices = visibility.ImageVertices(c);
+        utility::ParallelFor(
+                0, n_image_vertex,
+                [&](int64_t k) {
+                    const int i = vertices[k];
+                    Eigen::Vector3d color;
+                    if (query_color(image->color_, i, c, color)) {
+                        mesh.vertex_colors_[i] += color;
+                        n_valid[i]++;
+                    }
+                },
+                kVisibilityBlockSize);
+    }
     std::vector<size_t> valid_vertices;
     std::vector<size_t> invalid_vertices;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 0,
-                    image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 1,
-                    image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], mesh.vertices_[i], camera, j, 2,
-                    image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (n_valid[i] > 0) {
+            mesh.vertex_colors_[i] /= double(n_valid[i]);
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
@@ -322,82 +390,65 @@ void SetGeometryColorAverage(
     }
 }
 
+}  // unnamed namespace
+
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_color,
+        const RGBDImageLoader& image_loader,
+        const camera::PinholeCameraTrajectory& camera,
+        const VertexAndImageVisibility& visibility,
+        int image_boundary_margin /*= 10*/,
+        int invisible_vertex_color_knn /*= 3*/) {
+    SetGeometryColorAverageImpl(
+            mesh, image_loader, visibility, invisible_vertex_color_knn,
+            [&](const geometry::Image& image, int i, int j,
+                Eigen::Vector3d& color) {
+                unsigned char r_temp, g_temp, b_temp;
+                bool valid = false;
+                std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
+                        image, mesh.vertices_[i], camera, j, 0,
+                        image_boundary_margin);
+                std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
+                        image, mesh.vertices_[i], camera, j, 1,
+                        image_boundary_margin);
+                std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
+                        image, mesh.vertices_[i], camera, j, 2,
+                        image_boundary_margin);
+                color = Eigen::Vector3d((float)r_temp / 255.0f,
+                                        (float)g_temp / 255.0f,
+                                        (float)b_temp / 255.0f);
+                return valid;
+            });
+}
+
+void SetGeometryColorAverage(
+        geometry::TriangleMesh& mesh,
+        const RGBDImageLoader& image_loader,
         const std::vector<ImageWarpingField>& warping_fields,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         int image_boundary_margin /*= 10*/,
         int invisible_vertex_color_knn /*= 3*/) {
-    size_t n_vertex = mesh.vertices_.size();
-    mesh.vertex_colors_.clear();
-    mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)n_vertex; i++) {
-        mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
-        double sum = 0.0;
-        for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
-             iter++) {
-            int j = visibility_vertex_to_image[i][iter];
-            unsigned char r_temp, g_temp, b_temp;
-            bool valid = false;
-            std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 0, image_boundary_margin);
-            std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 1, image_boundary_margin);
-            std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
-                    *images_color[j], warping_fields[j], mesh.vertices_[i],
-                    camera, j, 2, image_boundary_margin);
-            float r = (float)r_temp / 255.0f;
-            float g = (float)g_temp / 255.0f;
-            float b = (float)b_temp / 255.0f;
-            if (valid) {
-                mesh.vertex_colors_[i] += Eigen::Vector3d(r, g, b);
-                sum += 1.0;
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
-        }
-    }
-    if (invisible_vertex_color_knn > 0) {
-        std::shared_ptr<geometry::TriangleMesh> valid_mesh =
-                mesh.SelectByIndex(valid_vertices);
-        geometry::KDTreeFlann kd_tree(*valid_mesh);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
-            size_t invalid_vertex = invalid_vertices[i];
-            std::vector<int> indices;  // indices to valid_mesh
-            std::vector<double> dists;
-            kd_tree.SearchKNN(mesh.vertices_[invalid_vertex],
-                              invisible_vertex_color_knn, indices, dists);
-            Eigen::Vector3d new_color(0, 0, 0);
-            for (const int& index : indices) {
-                new_color += valid_mesh->vertex_colors_[index];
-            }
-            if (indices.size() > 0) {
-                new_color /= static_cast<double>(indices.size());
-            }
-            mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
-    }
+    SetGeometryColorAverageImpl(
+            mesh, image_loader, visibility, invisible_vertex_color_knn,
+            [&](const geometry::Image& image, int i, int j,
+                Eigen::Vector3d& color) {
+                unsigned char r_temp, g_temp, b_temp;
+                bool valid = false;
+                std::tie(valid, r_temp) = QueryImageIntensity<unsigned char>(
+                        image, warping_fields[j], mesh.vertices_[i], camera,
+                        j, 0, image_boundary_margin);
+                std::tie(valid, g_temp) = QueryImageIntensity<unsigned char>(
+                        image, warping_fields[j], mesh.vertices_[i], camera,
+                        j, 1, image_boundary_margin);
+                std::tie(valid, b_temp) = QueryImageIntensity<unsigned char>(
+                        image, warping_fields[j], mesh.vertices_[i], camera,
+                        j, 2, image_boundary_margin);
+                color = Eigen::Vector3d((float)r_temp / 255.0f,
+                                        (float)g_temp / 255.0f,
+                                        (float)b_temp / 255.0f);
+                return valid;
+            });
 }
 }  // namespace color_map
 }  // namespace open3d
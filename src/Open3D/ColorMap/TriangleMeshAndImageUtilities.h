@@ -26,9 +26,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "Open3D/ColorMap/ColorMapOptimization.h"
 #include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
@@ -56,10 +58,75 @@ inline std::tuple<float, float, float> Project3DPointAndGetUVDepth(
         const camera::PinholeCameraTrajectory& camera,
         int camid);
 
-std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
-CreateVertexAndImageVisibility(
+/// \class VertexAndImageVisibility
+///
+/// \brief Visibility of the vertices of a mesh from the cameras, in both
+/// directions, stored in compressed sparse row layout with 32-bit indices.
+///
+/// The vertices visible from camera c are
+/// image_vertices_[image_offsets_[c]] to
+/// image_vertices_[image_offsets_[c + 1] - 1] in increasing order. The
+/// cameras that see vertex v are vertex_images_[vertex_offsets_[v]] to
+/// vertex_images_[vertex_offsets_[v + 1] - 1] in increasing order.
+class VertexAndImageVisibility {
+public:
+    /// Returns the number of cameras.
+    size_t NumImages() const {
+        return image_offsets_.empty() ? 0 : image_offsets_.size() - 1;
+    }
+    /// Returns the number of vertices.
+    size_t NumVertices() const {
+        return vertex_offsets_.empty() ? 0 : vertex_offsets_.size() - 1;
+    }
+    /// Returns the number of vertices visible from camera \p c.
+    int64_t NumImageVertices(size_t c) const {
+        return image_offsets_[c + 1] - image_offsets_[c];
+    }
+    /// Returns the number of cameras that see vertex \p v.
+    int64_t NumVertexImages(size_t v) const {
+        return vertex_offsets_[v + 1] - vertex_offsets_[v];
+    }
+    /// Returns the vertices visible from camera \p c.
+    const int* ImageVertices(size_t c) const {
+        return image_vertices_.data() + image_offsets_[c];
+    }
+    /// Returns the cameras that see vertex \p v.
+    const int* VertexImages(size_t v) const {
+        return vertex_images_.data() + vertex_offsets_[v];
+    }
+
+public:
+    /// Visible vertices of all cameras, concatenated.
+    std::vector<int> image_vertices_;
+    /// Offsets of the cameras in image_vertices_, of size NumImages() + 1.
+    std::vector<int64_t> image_offsets_;
+    /// Cameras of all vertices, concatenated.
+    std::vector<int> vertex_images_;
+    /// Offsets of the vertices in vertex_images_, of size NumVertices() + 1.
+    std::vector<int64_t> vertex_offsets_;
+};
+
+/// Appends the vertices of \p mesh visible from the next camera \p camid of
+/// \p camera, tested in parallel against its \p depth and boundary \p mask.
+/// Cameras are added in order, and the vertex to image direction is computed
+/// by ComputeVertexToImageVisibility once all cameras are added.
+void AddImageVisibility(const geometry::TriangleMesh& mesh,
+                        const geometry::Image& depth,
+                        const geometry::Image& mask,
+                        const camera::PinholeCameraTrajectory& camera,
+                        int camid,
+                        double maximum_allowable_depth,
+                        double depth_threshold_for_visibility_check,
+                        VertexAndImageVisibility& visibility);
+
+/// Computes the vertex to image direction of \p visibility from the image to
+/// vertex direction, in parallel over blocks of vertices.
+void ComputeVertexToImageVisibility(size_t n_vertex,
+                                    VertexAndImageVisibility& visibility);
+
+VertexAndImageVisibility CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
+        const std::vector<std::shared_ptr<geometry::Image>>& images_depth,
         const std::vector<std::shared_ptr<geometry::Image>>& images_mask,
         const camera::PinholeCameraTrajectory& camera,
         double maximum_allowable_depth,
@@ -89,7 +156,7 @@ void SetProxyIntensityForVertex(
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<ImageWarpingField>& warping_field,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin);
 
@@ -97,24 +164,26 @@ void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         std::vector<double>& proxy_intensity,
         int image_boundary_margin);
 
+/// Colors the vertices with the average color of the cameras that see them.
+/// The color images are loaded one at a time by \p image_loader.
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
+        const RGBDImageLoader& image_loader,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         int image_boundary_margin = 10,
         int invisible_vertex_color_knn = 3);
 
 void SetGeometryColorAverage(
         geometry::TriangleMesh& mesh,
-        const std::vector<std::shared_ptr<geometry::Image>>& images_rgbd,
+        const RGBDImageLoader& image_loader,
         const std::vector<ImageWarpingField>& warping_fields,
         const camera::PinholeCameraTrajectory& camera,
-        const std::vector<std::vector<int>>& visibility_vertex_to_image,
+        const VertexAndImageVisibility& visibility,
         int image_boundary_margin = 10,
         int invisible_vertex_color_knn = 3);
 }  // namespace color_map
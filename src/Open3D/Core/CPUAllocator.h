@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/MemoryManager.h"
+
+namespace open3d {
+
+/// \class CPUAllocator
+///
+/// \brief Standard allocator that allocates through MemoryManager on CPU:0,
+/// such that large arrays follow the CPUAllocationPolicy and are counted in
+/// the memory statistics.
+///
+/// Blocks are aligned like malloc, or to a page for large blocks that follow
+/// a policy, so it can replace std::allocator but not
+/// Eigen::aligned_allocator for over-aligned types.
+///
+/// Example:
+/// ```cpp
+/// CPUAllocationPolicy policy;
+/// policy.placement_ = CPUAllocationPolicy::Placement::FirstTouch;
+/// CPUMemoryManager::SetAllocationPolicy(policy);
+/// std::vector<Eigen::Vector3d, CPUAllocator<Eigen::Vector3d>> points(n);
+/// ```
+template <typename T>
+class CPUAllocator {
+public:
+    using value_type = T;
+
+    CPUAllocator() = default;
+    template <typename U>
+    CPUAllocator(const CPUAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(
+                MemoryManager::Malloc(n * sizeof(T), Device("CPU:0")));
+    }
+
+    void deallocate(T* ptr, std::size_t) {
+        MemoryManager::Free(ptr, Device("CPU:0"));
+    }
+
+    template <typename U>
+    bool operator==(const CPUAllocator<U>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const CPUAllocator<U>&) const {
+        return false;
+    }
+};
+
+}  // namespace open3d
@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAStream.h"
+
+#include <unordered_map>
+
+#ifdef BUILD_CUDA_MODULE
+#include "Open3D/Core/CUDAState.cuh"
+#endif
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+static void AssertCUDADevice(const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("Expected a CUDA device, but got {}.",
+                          device.ToString());
+    }
+#ifndef BUILD_CUDA_MODULE
+    utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+}
+
+/// Current stream of the calling thread, indexed by CUDA device id. Devices
+/// without an entry use the default stream.
+static std::unordered_map<int, CUDAStream>& GetCurrentStreams() {
+    static thread_local std::unordered_map<int, CUDAStream> current_streams;
+    return current_streams;
+}
+
+CUDAStream CUDAStream::Default(const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("Expected a CUDA device, but got {}.",
+                          device.ToString());
+    }
+    return CUDAStream(device, nullptr);
+}
+
+CUDAStream CUDAStream::Create(const Device& device) {
+    AssertCUDADevice(device);
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t stream;
+    OPEN3D_CUDA_CHECK(
+            cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    return CUDAStream(device, std::shared_ptr<void>(stream, [](void* ptr) {
+                          cudaStreamDestroy(static_cast<cudaStream_t>(ptr));
+                      }));
+#else
+    return Default(device);
+#endif
+}
+
+CUDAStream CUDAStream::FromHandle(const Device& device, void* handle) {
+    AssertCUDADevice(device);
+    if (handle == nullptr) {
+        return Default(device);
+    }
+    return CUDAStream(device, std::shared_ptr<void>(handle, [](void*) {}));
+}
+
+CUDAStream CUDAStream::GetCurrent(const Device& device) {
+    std::unordered_map<int, CUDAStream>& current_streams = GetCurrentStreams();
+    auto it = current_streams.find(device.GetID());
+    if (it == current_streams.end()) {
+        return Default(device);
+    }
+    return it->second;
+}
+
+void CUDAStream::SetCurrent(const CUDAStream& stream) {
+    std::unordered_map<int, CUDAStream>& current_streams = GetCurrentStreams();
+    current_streams.erase(stream.GetDevice().GetID());
+    if (!stream.IsDefault()) {
+        current_streams.emplace(stream.GetDevice().GetID(), stream);
+    }
+}
+
+void CUDAStream::Synchronize() const {
+    AssertCUDADevice(device_);
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device_);
+    OPEN3D_CUDA_CHECK(
+            cudaStreamSynchronize(static_cast<cudaStream_t>(GetHandle())));
+#endif
+}
+
+bool CUDAStream::IsIdle() const {
+    AssertCUDADevice(device_);
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device_);
+    cudaError_t err = cudaStreamQuery(static_cast<cudaStream_t>(GetHandle()));
+    if (err == cudaErrorNotReady) {
+        return false;
+    }
+    OPEN3D_CUDA_CHECK(err);
+#endif
+    return true;
+}
+
+void CUDAStream::WaitEvent(const CUDAEvent& event) const {
+    AssertCUDADevice(device_);
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device_);
+    OPEN3D_CUDA_CHECK(
+            cudaStreamWaitEvent(static_cast<cudaStream_t>(GetHandle()),
+                                static_cast<cudaEvent_t>(event.GetHandle()),
+                                0));
+#endif
+}
+
+CUDAEvent::CUDAEvent(const Device& device) : device_(device) {
+    AssertCUDADevice(device);
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device);
+    cudaEvent_t event;
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&event));
+    event_ = std::shared_ptr<void>(event, [](void* ptr) {
+        cudaEventDestroy(static_cast<cudaEvent_t>(ptr));
+    });
+#endif
+}
+
+void CUDAEvent::Record(const CUDAStream& stream) {
+    if (stream.GetDevice() != device_) {
+        utility::LogError("Device mismatch {} != {}.", device_.ToString(),
+                          stream.GetDevice().ToString());
+    }
+#ifdef BUILD_CUDA_MODULE
+    CUDADeviceSwitcher switcher(device_);
+    OPEN3D_CUDA_CHECK(
+            cudaEventRecord(static_cast<cudaEvent_t>(GetHandle()),
+                            static_cast<cudaStream_t>(stream.GetHandle())));
+#endif
+}
+
+void CUDAEvent::Synchronize() const {
+#ifdef BUILD_CUDA_MODULE
+    OPEN3D_CUDA_CHECK(
+            cudaEventSynchronize(static_cast<cudaEvent_t>(GetHandle())));
+#endif
+}
+
+bool CUDAEvent::IsCompleted() const {
+#ifdef BUILD_CUDA_MODULE
+    cudaError_t err = cudaEventQuery(static_cast<cudaEvent_t>(GetHandle()));
+    if (err == cudaErrorNotReady) {
+        return false;
+    }
+    OPEN3D_CUDA_CHECK(err);
+#endif
+    return true;
+}
+
+float CUDAEvent::ElapsedMilliseconds(const CUDAEvent& end) const {
+    float ms = 0;
+#ifdef BUILD_CUDA_MODULE
+    OPEN3D_CUDA_CHECK(
+            cudaEventElapsedTime(&ms, static_cast<cudaEvent_t>(GetHandle()),
+                                 static_cast<cudaEvent_t>(end.GetHandle())));
+#endif
+    return ms;
+}
+
+#ifdef BUILD_CUDA_MODULE
+namespace cuda {
+
+cudaStream_t GetCurrentStream() {
+    int device_id;
+    OPEN3D_CUDA_CHECK(cudaGetDevice(&device_id));
+    std::unordered_map<int, CUDAStream>& current_streams = GetCurrentStreams();
+    auto it = current_streams.find(device_id);
+    if (it == current_streams.end()) {
+        return nullptr;
+    }
+    return static_cast<cudaStream_t>(it->second.GetHandle());
+}
+
+}  // namespace cuda
+#endif
+
+}  // namespace open3d
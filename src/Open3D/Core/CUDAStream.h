@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CUDAStream.h
+///
+/// CUDAStream.h may be included from CPU-only code. Without CUDA support,
+/// creating streams or events throws.
+
+#pragma once
+
+#include <memory>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Device.h"
+
+namespace open3d {
+
+class CUDAEvent;
+
+/// \class CUDAStream
+///
+/// A handle to a CUDA stream of a device. Copies of a CUDAStream refer to the
+/// same underlying stream, which is destroyed with the last copy.
+///
+/// Every thread has a current stream per CUDA device, initially the default
+/// stream. Core kernels and MemoryManager::Memcpy enqueue their work on the
+/// current stream of the device they run on. On the default stream, ops
+/// synchronize implicitly as before. On other streams, host-to-device and
+/// device-to-device copies and kernels return without waiting, and
+/// device-to-host copies wait only for their own stream.
+///
+/// Example:
+/// ```cpp
+/// CUDAStream upload = CUDAStream::Create(Device("CUDA:0"));
+/// CUDAEvent uploaded(Device("CUDA:0"));
+/// {
+///     CUDAStreamGuard guard(upload);
+///     next_frame_gpu = next_frame_cpu.Copy(Device("CUDA:0"));
+///     uploaded.Record(upload);
+/// }
+/// Integrate(frame_gpu);  // Runs concurrently on the default stream.
+/// CUDAStream::GetCurrent(Device("CUDA:0")).WaitEvent(uploaded);
+/// ```
+///
+/// Memory released while work is pending on a non-default stream may be
+/// handed out again by the caching allocator. Synchronize the stream before
+/// releasing tensors that another stream may still use.
+class CUDAStream {
+public:
+    /// Returns the default stream of \p device.
+    static CUDAStream Default(const Device& device);
+
+    /// Creates a new non-blocking stream on \p device.
+    static CUDAStream Create(const Device& device);
+
+    /// Wraps a stream created outside of Open3D, e.g. by PyTorch or CuPy. The
+    /// returned CUDAStream does not own \p handle; the stream must outlive it.
+    /// A null \p handle refers to the default stream.
+    static CUDAStream FromHandle(const Device& device, void* handle);
+
+    /// Returns the current stream of the calling thread on \p device.
+    static CUDAStream GetCurrent(const Device& device);
+
+    /// Sets \p stream as the current stream of the calling thread on the
+    /// stream's device.
+    static void SetCurrent(const CUDAStream& stream);
+
+    /// Blocks until all work enqueued on the stream has finished.
+    void Synchronize() const;
+
+    /// Returns true if all work enqueued on the stream has finished.
+    bool IsIdle() const;
+
+    /// Makes all future work enqueued on this stream wait for \p event.
+    void WaitEvent(const CUDAEvent& event) const;
+
+    bool IsDefault() const { return stream_ == nullptr; }
+
+    Device GetDevice() const { return device_; }
+
+    /// Returns the underlying cudaStream_t, or nullptr for the default stream.
+    void* GetHandle() const { return stream_.get(); }
+
+    bool operator==(const CUDAStream& other) const {
+        return device_ == other.device_ && stream_ == other.stream_;
+    }
+
+    bool operator!=(const CUDAStream& other) const {
+        return !operator==(other);
+    }
+
+protected:
+    CUDAStream(const Device& device, const std::shared_ptr<void>& stream)
+        : device_(device), stream_(stream) {}
+
+protected:
+    Device device_;
+    std::shared_ptr<void> stream_;
+};
+
+/// \class CUDAStreamGuard
+///
+/// Sets the current stream of the calling thread in the current scope, and
+/// resets the previous stream of the same device when leaving the scope.
+class CUDAStreamGuard {
+public:
+    CUDAStreamGuard(const CUDAStream& stream)
+        : prev_stream_(CUDAStream::GetCurrent(stream.GetDevice())) {
+        CUDAStream::SetCurrent(stream);
+    }
+
+    ~CUDAStreamGuard() { CUDAStream::SetCurrent(prev_stream_); }
+
+    CUDAStreamGuard(CUDAStreamGuard const&) = delete;
+
+    void operator=(CUDAStreamGuard const&) = delete;
+
+private:
+    CUDAStream prev_stream_;
+};
+
+/// \class CUDAEvent
+///
+/// A CUDA event for synchronization across streams and for timing.
+class CUDAEvent {
+public:
+    CUDAEvent(const Device& device);
+
+    /// Captures the work currently enqueued on \p stream.
+    void Record(const CUDAStream& stream);
+
+    /// Blocks until the captured work has finished.
+    void Synchronize() const;
+
+    /// Returns true if the captured work has finished.
+    bool IsCompleted() const;
+
+    /// Returns the elapsed time in milliseconds from this event to \p end.
+    /// Both events must have completed.
+    float ElapsedMilliseconds(const CUDAEvent& end) const;
+
+    Device GetDevice() const { return device_; }
+
+    /// Returns the underlying cudaEvent_t.
+    void* GetHandle() const { return event_.get(); }
+
+protected:
+    Device device_;
+    std::shared_ptr<void> event_;
+};
+
+#ifdef BUILD_CUDA_MODULE
+namespace cuda {
+
+/// Returns the current stream of the calling thread on the current CUDA
+/// device. Kernels should be launched on this stream.
+cudaStream_t GetCurrentStream();
+
+}  // namespace cuda
+#endif
+
+}  // namespace open3d
@@ -44,5 +44,20 @@ int DeviceCount() {
 
 bool IsAvailable() { return cuda::DeviceCount() > 0; }
 
+int GetPointerDeviceID(const void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    cudaPointerAttributes attributes;
+    OPEN3D_CUDA_CHECK(cudaPointerGetAttributes(&attributes, ptr));
+    if (attributes.type != cudaMemoryTypeDevice &&
+        attributes.type != cudaMemoryTypeManaged) {
+        utility::LogError("Pointer {} is not CUDA device memory.", ptr);
+    }
+    return attributes.device;
+#else
+    utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+    return -1;
+#endif
+}
+
 }  // namespace cuda
 }  // namespace open3d
@@ -87,5 +87,8 @@ namespace cuda {
 int DeviceCount();
 bool IsAvailable();
 
+/// Returns the id of the CUDA device that holds the memory at \p ptr.
+int GetPointerDeviceID(const void* ptr);
+
 }  // namespace cuda
 }  // namespace open3d
@@ -61,6 +61,9 @@ DLManagedTensor* ToDLPack(const Tensor& t) {
 
     DLDataType dl_data_type;
     switch (t.GetDtype()) {
+        case Dtype::Float16:
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+            break;
         case Dtype::Float32:
             dl_data_type.code = DLDataTypeCode::kDLFloat;
             break;
@@ -76,6 +79,9 @@ DLManagedTensor* ToDLPack(const Tensor& t) {
         case Dtype::UInt8:
             dl_data_type.code = DLDataTypeCode::kDLUInt;
             break;
+        case Dtype::UInt16:
+            dl_data_type.code = DLDataTypeCode::kDLUInt;
+            break;
         default:
             utility::LogError("Unsupported data type");
     }
@@ -132,6 +138,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
                 case 8:
                     dtype = Dtype::UInt8;
                     break;
+                case 16:
+                    dtype = Dtype::UInt16;
+                    break;
                 default:
                     utility::LogError("Unsupported kDLUInt bits {}",
                                       src->dl_tensor.dtype.bits);
@@ -152,6 +161,9 @@ Tensor FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
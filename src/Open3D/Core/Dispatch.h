@@ -49,6 +49,10 @@
 #define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)               \
     [&] {                                                    \
         switch (DTYPE) {                                     \
+            case open3d::Dtype::Float16: {                   \
+                using scalar_t = open3d::Half;               \
+                return __VA_ARGS__();                        \
+            }                                                \
             case open3d::Dtype::Float32: {                   \
                 using scalar_t = float;                      \
                 return __VA_ARGS__();                        \
@@ -69,6 +73,10 @@
                 using scalar_t = uint8_t;                    \
                 return __VA_ARGS__();                        \
             }                                                \
+            case open3d::Dtype::UInt16: {                    \
+                using scalar_t = uint16_t;                   \
+                return __VA_ARGS__();                        \
+            }                                                \
             default:                                         \
                 utility::LogError("Unsupported data type."); \
         }                                                    \
@@ -83,3 +91,20 @@
             DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
         }                                                   \
     }()
+
+/// DISPATCH_DTYPE_TO_TEMPLATE for Float32 and Float64 only, for functions
+/// that are only instantiated for floating point types.
+#define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)                     \
+    [&] {                                                                \
+        if (DTYPE == open3d::Dtype::Float32) {                           \
+            using scalar_t = float;                                      \
+            return __VA_ARGS__();                                        \
+        } else if (DTYPE == open3d::Dtype::Float64) {                    \
+            using scalar_t = double;                                     \
+            return __VA_ARGS__();                                        \
+        } else {                                                         \
+            utility::LogError("Unsupported data type {}, expected "      \
+                              "Float32 or Float64.",                     \
+                              open3d::DtypeUtil::ToString(DTYPE));       \
+        }                                                                \
+    }()
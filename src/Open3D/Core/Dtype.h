@@ -29,6 +29,7 @@
 #include "string"
 
 #include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Half.h"
 #include "Open3D/Utility/Console.h"
 
 static_assert(sizeof(float) == 4,
@@ -42,17 +43,21 @@ static_assert(sizeof(int64_t) == 8,
               "Unsupported platform: int64_t must be 8 bytes");
 static_assert(sizeof(uint8_t) == 1,
               "Unsupported platform: uint8_t must be 1 byte");
+static_assert(sizeof(uint16_t) == 2,
+              "Unsupported platform: uint16_t must be 2 bytes");
 static_assert(sizeof(bool) == 1, "Unsupported platform: bool must be 1 byte");
 
 namespace open3d {
 
 enum class Dtype {
     Undefined,  // Dtype for uninitialized Tensor
+    Float16,
     Float32,
     Float64,
     Int32,
     Int64,
     UInt8,
+    UInt16,
     Bool,
 };
 
@@ -61,6 +66,9 @@ public:
     static int64_t ByteSize(const Dtype &dtype) {
         int64_t byte_size = 0;
         switch (dtype) {
+            case Dtype::Float16:
+                byte_size = 2;
+                break;
             case Dtype::Float32:
                 byte_size = 4;
                 break;
@@ -76,6 +84,9 @@ public:
             case Dtype::UInt8:
                 byte_size = 1;
                 break;
+            case Dtype::UInt16:
+                byte_size = 2;
+                break;
             case Dtype::Bool:
                 byte_size = 1;
                 break;
@@ -85,6 +96,12 @@ public:
         return byte_size;
     }
 
+    /// Returns true for Float16, Float32 and Float64.
+    static bool IsFloat(const Dtype &dtype) {
+        return dtype == Dtype::Float16 || dtype == Dtype::Float32 ||
+               dtype == Dtype::Float64;
+    }
+
     /// Convert from C++ types to Dtype. Known types are explicitly specialized,
     /// e.g. DtypeUtil::FromType<float>(). Unsupported type will result in an
     /// exception.
@@ -100,6 +117,9 @@ public:
             case Dtype::Undefined:
                 str = "Undefined";
                 break;
+            case Dtype::Float16:
+                str = "Float16";
+                break;
             case Dtype::Float32:
                 str = "Float32";
                 break;
@@ -115,6 +135,9 @@ public:
             case Dtype::UInt8:
                 str = "UInt8";
                 break;
+            case Dtype::UInt16:
+                str = "UInt16";
+                break;
             case Dtype::Bool:
                 str = "Bool";
                 break;
@@ -125,6 +148,11 @@ public:
     }
 };
 
+template <>
+inline Dtype DtypeUtil::FromType<Half>() {
+    return Dtype::Float16;
+}
+
 template <>
 inline Dtype DtypeUtil::FromType<float>() {
     return Dtype::Float32;
@@ -150,6 +178,11 @@ inline Dtype DtypeUtil::FromType<uint8_t>() {
     return Dtype::UInt8;
 }
 
+template <>
+inline Dtype DtypeUtil::FromType<uint16_t>() {
+    return Dtype::UInt16;
+}
+
 template <>
 inline Dtype DtypeUtil::FromType<bool>() {
     return Dtype::Bool;
@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+#ifdef __CUDACC__
+#include <cuda_fp16.h>
+#endif
+
+namespace open3d {
+
+/// \class Half
+///
+/// IEEE 754 half precision (binary16) floating point number, the C++ type of
+/// Dtype::Float16.
+///
+/// Half is a storage type: it converts implicitly from arithmetic types and to
+/// float, so generic kernels compute in float and round on store. CUDA kernels
+/// may use native half instructions instead, see BinaryEWCUDA.cu.
+struct Half {
+    Half() = default;
+
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    OPEN3D_HOST_DEVICE Half(T value)
+        : bits_(FloatToBits(static_cast<float>(value))) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return BitsToFloat(bits_); }
+
+    static OPEN3D_HOST_DEVICE Half FromBits(uint16_t bits) {
+        Half h;
+        h.bits_ = bits;
+        return h;
+    }
+
+    /// Converts with round-to-nearest-even. Overflows become infinity.
+    static OPEN3D_HOST_DEVICE uint16_t FloatToBits(float value) {
+#ifdef __CUDA_ARCH__
+        return __half_as_ushort(__float2half_rn(value));
+#else
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+        const uint16_t sign = static_cast<uint16_t>((f >> 16) & 0x8000);
+        const uint32_t abs_f = f & 0x7fffffff;
+        if (abs_f >= 0x7f800000) {
+            // Inf or NaN, NaN stays quiet.
+            return sign | 0x7c00 | (abs_f > 0x7f800000 ? 0x0200 : 0);
+        }
+        if (abs_f >= 0x477ff000) {
+            // Rounds to a magnitude >= 65520, which overflows.
+            return sign | 0x7c00;
+        }
+        uint32_t bits;
+        uint32_t shift;
+        uint32_t mantissa;
+        if (abs_f >= 0x38800000) {
+            // Normal half: re-bias the exponent from 127 to 15.
+            mantissa = abs_f - (112u << 23);
+            shift = 13;
+        } else if (abs_f >= 0x33000000) {
+            // Subnormal half, including values that round up to normal.
+            mantissa = (abs_f & 0x007fffff) | 0x00800000;
+            shift = 126 - (abs_f >> 23);
+        } else {
+            return sign;
+        }
+        bits = mantissa >> shift;
+        const uint32_t round_bit = (mantissa >> (shift - 1)) & 1;
+        const uint32_t sticky_bits = mantissa & ((1u << (shift - 1)) - 1);
+        if (round_bit && (sticky_bits || (bits & 1))) {
+            ++bits;
+        }
+        return sign | static_cast<uint16_t>(bits);
+#endif
+    }
+
+    static OPEN3D_HOST_DEVICE float BitsToFloat(uint16_t bits) {
+#ifdef __CUDA_ARCH__
+        return __half2float(__ushort_as_half(bits));
+#else
+        const uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+        uint32_t exponent = (bits >> 10) & 0x1f;
+        uint32_t mantissa = bits & 0x03ff;
+        uint32_t f;
+        if (exponent == 0x1f) {
+            f = sign | 0x7f800000 | (mantissa << 13);
+        } else if (exponent != 0) {
+            f = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        } else if (mantissa == 0) {
+            f = sign;
+        } else {
+            // Subnormal half, normalized in float.
+            exponent = 113;
+            while (!(mantissa & 0x0400)) {
+                mantissa <<= 1;
+                --exponent;
+            }
+            f = sign | (exponent << 23) | ((mantissa & 0x03ff) << 13);
+        }
+        float value;
+        std::memcpy(&value, &f, sizeof(value));
+        return value;
+#endif
+    }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes");
+
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::Half> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+
+    static OPEN3D_HOST_DEVICE open3d::Half min() {
+        return open3d::Half::FromBits(0x0400);
+    }
+    static OPEN3D_HOST_DEVICE open3d::Half lowest() {
+        return open3d::Half::FromBits(0xfbff);
+    }
+    static OPEN3D_HOST_DEVICE open3d::Half max() {
+        return open3d::Half::FromBits(0x7bff);
+    }
+    static OPEN3D_HOST_DEVICE open3d::Half epsilon() {
+        return open3d::Half::FromBits(0x1400);
+    }
+    static OPEN3D_HOST_DEVICE open3d::Half infinity() {
+        return open3d::Half::FromBits(0x7c00);
+    }
+    static OPEN3D_HOST_DEVICE open3d::Half quiet_NaN() {
+        return open3d::Half::FromBits(0x7e00);
+    }
+};
+
+}  // namespace std
+
+namespace fmt {
+template <>
+struct formatter<open3d::Half> {
+    template <typename FormatContext>
+    auto format(const open3d::Half& h, FormatContext& ctx) const
+            -> decltype(ctx.out()) {
+        return format_to(ctx.out(), "{}", static_cast<float>(h));
+    }
+
+    template <typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) -> decltype(ctx.begin()) {
+        return ctx.begin();
+    }
+};
+}  // namespace fmt
@@ -0,0 +1,288 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap/Hashmap.h"
+
+#include <algorithm>
+
+#include "Open3D/Core/Hashmap/HashmapKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// Minimum number of slots of a table.
+static constexpr int64_t MIN_HASHMAP_CAPACITY = 16;
+
+/// Slots per entry the table keeps at least, i.e. the max load factor is 0.5.
+static constexpr int64_t SLOTS_PER_ENTRY = 2;
+
+static hashmap::HashmapView MakeView(Tensor& states,
+                                     Tensor& keys,
+                                     Tensor& values,
+                                     int64_t capacity) {
+    hashmap::HashmapView view;
+    view.states_ = static_cast<int*>(states.GetDataPtr());
+    view.keys_ = static_cast<uint8_t*>(keys.GetDataPtr());
+    view.values_ = static_cast<uint8_t*>(values.GetDataPtr());
+    view.capacity_ = capacity;
+    view.key_bytes_ = capacity == 0 ? 0
+                                    : keys.NumElements() / capacity *
+                                              DtypeUtil::ByteSize(
+                                                      keys.GetDtype());
+    view.value_bytes_ = capacity == 0 ? 0
+                                      : values.NumElements() / capacity *
+                                                DtypeUtil::ByteSize(
+                                                        values.GetDtype());
+    return view;
+}
+
+static int64_t CountTrue(const Tensor& masks) {
+    if (masks.NumElements() == 0) {
+        return 0;
+    }
+    return masks.To(Dtype::Int64).Sum({0}).Item<int64_t>();
+}
+
+static SizeVector PrependDim(int64_t dim, const SizeVector& shape) {
+    SizeVector result{dim};
+    result.insert(result.end(), shape.begin(), shape.end());
+    return result;
+}
+
+Hashmap::Hashmap(int64_t init_capacity,
+                 Dtype key_dtype,
+                 const SizeVector& key_element_shape,
+                 Dtype value_dtype,
+                 const SizeVector& value_element_shape,
+                 const Device& device)
+    : key_dtype_(key_dtype),
+      key_element_shape_(key_element_shape),
+      value_dtype_(value_dtype),
+      value_element_shape_(value_element_shape),
+      device_(device) {
+    if (key_element_shape.NumElements() == 0) {
+        utility::LogError("Hashmap keys must not be empty.");
+    }
+    Allocate(std::max(init_capacity * SLOTS_PER_ENTRY, MIN_HASHMAP_CAPACITY));
+}
+
+void Hashmap::Allocate(int64_t capacity) {
+    capacity_ = capacity;
+    states_ = Tensor::Zeros({capacity}, Dtype::Int32, device_);
+    keys_ = Tensor(PrependDim(capacity, key_element_shape_), key_dtype_,
+                   device_);
+    values_ = Tensor(PrependDim(capacity, value_element_shape_), value_dtype_,
+                     device_);
+    size_ = 0;
+    num_used_slots_ = 0;
+}
+
+void Hashmap::Reserve(int64_t num_keys) {
+    if ((num_used_slots_ + num_keys) * SLOTS_PER_ENTRY <= capacity_) {
+        return;
+    }
+    // Rehashing also drops deleted slots, so the capacity only grows if the
+    // live entries need it.
+    int64_t new_capacity = capacity_;
+    while (new_capacity < (size_ + num_keys) * SLOTS_PER_ENTRY) {
+        new_capacity *= 2;
+    }
+    Rehash(new_capacity);
+}
+
+void Hashmap::AssertKeys(const Tensor& keys) const {
+    if (keys.GetDevice() != device_) {
+        utility::LogError("Device mismatch {} != {}.",
+                          keys.GetDevice().ToString(), device_.ToString());
+    }
+    if (keys.GetDtype() != key_dtype_) {
+        utility::LogError("Key dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(keys.GetDtype()),
+                          DtypeUtil::ToString(key_dtype_));
+    }
+    if (keys.NumDims() == 0 ||
+        keys.GetShape() != PrependDim(keys.GetShape(0), key_element_shape_)) {
+        utility::LogError("Expected keys of shape (N, {}), but got {}.",
+                          key_element_shape_, keys.GetShape());
+    }
+}
+
+void Hashmap::InsertImpl(const Tensor& keys,
+                         const Tensor* values,
+                         Tensor& output_addrs,
+                         Tensor& output_masks) {
+    const int64_t num_keys = keys.GetShape(0);
+    output_addrs = Tensor({num_keys}, Dtype::Int64, device_);
+    output_masks = Tensor({num_keys}, Dtype::Bool, device_);
+    if (num_keys == 0) {
+        return;
+    }
+
+    Tensor keys_contiguous = keys.Contiguous();
+    Tensor values_contiguous;
+    if (values) {
+        values_contiguous = values->Contiguous();
+    }
+    const void* values_ptr = values ? values_contiguous.GetDataPtr() : nullptr;
+    hashmap::HashmapView view = MakeView(states_, keys_, values_, capacity_);
+    int64_t* addrs_ptr = static_cast<int64_t*>(output_addrs.GetDataPtr());
+    bool* masks_ptr = static_cast<bool*>(output_masks.GetDataPtr());
+
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        hashmap::InsertCPU(view, keys_contiguous.GetDataPtr(), values_ptr,
+                           num_keys, addrs_ptr, masks_ptr);
+    } else if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        hashmap::InsertCUDA(view, keys_contiguous.GetDataPtr(), values_ptr,
+                            num_keys, addrs_ptr, masks_ptr);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Hashmap: Unimplemented device");
+    }
+
+    const int64_t num_inserted = CountTrue(output_masks);
+    size_ += num_inserted;
+    num_used_slots_ += num_inserted;
+}
+
+void Hashmap::Insert(const Tensor& keys,
+                     const Tensor& values,
+                     Tensor& output_addrs,
+                     Tensor& output_masks) {
+    AssertKeys(keys);
+    if (values.GetDevice() != device_ || values.GetDtype() != value_dtype_ ||
+        values.GetShape() !=
+                PrependDim(keys.GetShape(0), value_element_shape_)) {
+        utility::LogError(
+                "Expected values of shape (N, {}) with dtype {} on {}, but "
+                "got {} with dtype {} on {}.",
+                value_element_shape_, DtypeUtil::ToString(value_dtype_),
+                device_.ToString(), values.GetShape(),
+                DtypeUtil::ToString(values.GetDtype()),
+                values.GetDevice().ToString());
+    }
+    Reserve(keys.GetShape(0));
+    InsertImpl(keys, &values, output_addrs, output_masks);
+}
+
+void Hashmap::Activate(const Tensor& keys,
+                       Tensor& output_addrs,
+                       Tensor& output_masks) {
+    AssertKeys(keys);
+    Reserve(keys.GetShape(0));
+    InsertImpl(keys, nullptr, output_addrs, output_masks);
+}
+
+void Hashmap::Find(const Tensor& keys,
+                   Tensor& output_addrs,
+                   Tensor& output_masks) {
+    AssertKeys(keys);
+    const int64_t num_keys = keys.GetShape(0);
+    output_addrs = Tensor({num_keys}, Dtype::Int64, device_);
+    output_masks = Tensor({num_keys}, Dtype::Bool, device_);
+    if (num_keys == 0) {
+        return;
+    }
+
+    Tensor keys_contiguous = keys.Contiguous();
+    hashmap::HashmapView view = MakeView(states_, keys_, values_, capacity_);
+    int64_t* addrs_ptr = static_cast<int64_t*>(output_addrs.GetDataPtr());
+    bool* masks_ptr = static_cast<bool*>(output_masks.GetDataPtr());
+
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        hashmap::FindCPU(view, keys_contiguous.GetDataPtr(), num_keys,
+                         addrs_ptr, masks_ptr);
+    } else if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        hashmap::FindCUDA(view, keys_contiguous.GetDataPtr(), num_keys,
+                          addrs_ptr, masks_ptr);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Hashmap: Unimplemented device");
+    }
+}
+
+void Hashmap::Erase(const Tensor& keys, Tensor& output_masks) {
+    AssertKeys(keys);
+    const int64_t num_keys = keys.GetShape(0);
+    output_masks = Tensor({num_keys}, Dtype::Bool, device_);
+    if (num_keys == 0) {
+        return;
+    }
+
+    Tensor keys_contiguous = keys.Contiguous();
+    hashmap::HashmapView view = MakeView(states_, keys_, values_, capacity_);
+    bool* masks_ptr = static_cast<bool*>(output_masks.GetDataPtr());
+
+    if (device_.GetType() == Device::DeviceType::CPU) {
+        hashmap::EraseCPU(view, keys_contiguous.GetDataPtr(), num_keys,
+                          masks_ptr);
+    } else if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        hashmap::EraseCUDA(view, keys_contiguous.GetDataPtr(), num_keys,
+                           masks_ptr);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Hashmap: Unimplemented device");
+    }
+
+    // Erased slots stay used until the next rehash.
+    size_ -= CountTrue(output_masks);
+}
+
+void Hashmap::Rehash(int64_t new_capacity) {
+    if (new_capacity < size_ * SLOTS_PER_ENTRY) {
+        utility::LogError("Capacity {} is too small for {} entries.",
+                          new_capacity, size_);
+    }
+    new_capacity = std::max(new_capacity, MIN_HASHMAP_CAPACITY);
+
+    Tensor active_indices = GetActiveIndices();
+    Tensor active_keys = keys_.IndexGet({active_indices});
+    Tensor active_values = values_.IndexGet({active_indices});
+
+    Allocate(new_capacity);
+    Tensor output_addrs, output_masks;
+    InsertImpl(active_keys, &active_values, output_addrs, output_masks);
+}
+
+Tensor Hashmap::GetActiveIndices() const {
+    Tensor occupied = Tensor::Full({}, static_cast<int>(hashmap::OCCUPIED),
+                                   Dtype::Int32, device_);
+    return states_.Eq(occupied).NonZeroNumpy()[0];
+}
+
+hashmap::HashmapView Hashmap::GetView() {
+    return MakeView(states_, keys_, values_, capacity_);
+}
+
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Hashmap/HashmapKernel.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// \class Hashmap
+///
+/// A parallel hash map from fixed-size keys to fixed-size values, stored in
+/// Tensors on a CPU or CUDA device. Keys are compared and hashed bytewise, so
+/// any dtype and element shape work, e.g. Int32 keys of shape {3} for voxel
+/// coordinates.
+///
+/// All operations work in bulk on a Tensor of N keys of shape
+/// (N, *key_element_shape) and return per-key buffer addresses (Int64, -1 if
+/// not applicable) and masks (Bool, true where the operation succeeded). The
+/// address of a key indexes GetKeyTensor() and GetValueTensor(), so callers
+/// may read and update values in place with Tensor ops.
+///
+/// The map uses open addressing with linear probing and lock-free slot
+/// claiming; it grows automatically before an insertion would exceed a load
+/// factor of 0.5. Growing (Rehash) moves entries and invalidates previously
+/// returned addresses.
+///
+/// Example:
+/// ```cpp
+/// Hashmap map(1000, Dtype::Int32, {3}, Dtype::Float32, {1}, device);
+/// Tensor addrs, masks;
+/// map.Insert(voxel_coords, voxel_weights, addrs, masks);
+/// ```
+class Hashmap {
+public:
+    Hashmap(int64_t init_capacity,
+            Dtype key_dtype,
+            const SizeVector& key_element_shape,
+            Dtype value_dtype,
+            const SizeVector& value_element_shape,
+            const Device& device = Device("CPU:0"));
+
+    /// Inserts \p keys with \p values. Keys that are already present keep
+    /// their values. Masks are true for newly inserted keys; addresses are
+    /// valid for all keys.
+    void Insert(const Tensor& keys,
+                const Tensor& values,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
+    /// Inserts \p keys with zero-initialized values, same as Insert
+    /// otherwise.
+    void Activate(const Tensor& keys,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    /// Looks up \p keys. Masks are true for keys that are present.
+    void Find(const Tensor& keys, Tensor& output_addrs, Tensor& output_masks);
+
+    /// Removes \p keys. Masks are true for keys that were present.
+    void Erase(const Tensor& keys, Tensor& output_masks);
+
+    /// Rebuilds the table with \p new_capacity slots, which must be able to
+    /// hold all entries. Invalidates all addresses.
+    void Rehash(int64_t new_capacity);
+
+    /// Returns the Int64 addresses of all entries.
+    Tensor GetActiveIndices() const;
+
+    /// Number of entries.
+    int64_t Size() const { return size_; }
+
+    int64_t GetCapacity() const { return capacity_; }
+
+    Device GetDevice() const { return device_; }
+
+    /// Key buffer of shape (capacity, *key_element_shape).
+    Tensor GetKeyTensor() const { return keys_; }
+
+    /// Value buffer of shape (capacity, *value_element_shape).
+    Tensor GetValueTensor() const { return values_; }
+
+    /// Raw buffers of the table, for kernels that look up keys with
+    /// hashmap::FindKey on the device of the map. Valid until the next
+    /// insertion or rehash.
+    hashmap::HashmapView GetView();
+
+protected:
+    void Allocate(int64_t capacity);
+
+    /// Grows the table if inserting \p num_keys would exceed the maximum load.
+    void Reserve(int64_t num_keys);
+
+    void AssertKeys(const Tensor& keys) const;
+
+    /// Inserts without growing the table. \p values may be nullptr.
+    void InsertImpl(const Tensor& keys,
+                    const Tensor* values,
+                    Tensor& output_addrs,
+                    Tensor& output_masks);
+
+protected:
+    int64_t capacity_ = 0;
+    Dtype key_dtype_;
+    SizeVector key_element_shape_;
+    Dtype value_dtype_;
+    SizeVector value_element_shape_;
+    Device device_;
+
+    /// Number of entries.
+    int64_t size_ = 0;
+    /// Number of occupied or deleted slots.
+    int64_t num_used_slots_ = 0;
+
+    Tensor states_;
+    Tensor keys_;
+    Tensor values_;
+};
+
+}  // namespace open3d
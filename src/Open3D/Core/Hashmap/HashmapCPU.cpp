@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap/HashmapKernel.h"
+
+namespace open3d {
+namespace hashmap {
+
+void InsertCPU(const HashmapView& view,
+               const void* keys,
+               const void* values,
+               int64_t num_keys,
+               int64_t* output_addrs,
+               bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+    const uint8_t* value_ptr = static_cast<const uint8_t*>(values);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_keys; ++i) {
+        bool inserted;
+        output_addrs[i] = InsertKey(
+                view, key_ptr + i * view.key_bytes_,
+                value_ptr ? value_ptr + i * view.value_bytes_ : nullptr,
+                inserted);
+        output_masks[i] = inserted;
+    }
+}
+
+void FindCPU(const HashmapView& view,
+             const void* keys,
+             int64_t num_keys,
+             int64_t* output_addrs,
+             bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_keys; ++i) {
+        output_addrs[i] = FindKey(view, key_ptr + i * view.key_bytes_);
+        output_masks[i] = output_addrs[i] >= 0;
+    }
+}
+
+void EraseCPU(const HashmapView& view,
+              const void* keys,
+              int64_t num_keys,
+              bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_keys; ++i) {
+        output_masks[i] = EraseKey(view, key_ptr + i * view.key_bytes_);
+    }
+}
+
+}  // namespace hashmap
+}  // namespace open3d
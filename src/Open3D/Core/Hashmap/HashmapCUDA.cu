@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAState.cuh"
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Hashmap/HashmapKernel.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+
+namespace open3d {
+namespace hashmap {
+
+template <typename func_t>
+static void LaunchHashmapKernel(int64_t num_keys, func_t f) {
+    if (num_keys == 0) {
+        return;
+    }
+    int64_t items_per_block = default_block_size * default_thread_size;
+    int64_t grid_size = (num_keys + items_per_block - 1) / items_per_block;
+    kernel::ElementWiseKernel<default_block_size, default_thread_size>
+            <<<grid_size, default_block_size, 0, cuda::GetCurrentStream()>>>(
+                    num_keys, f);
+    OPEN3D_GET_LAST_CUDA_ERROR("Hashmap kernel failed.");
+}
+
+void InsertCUDA(const HashmapView& view,
+                const void* keys,
+                const void* values,
+                int64_t num_keys,
+                int64_t* output_addrs,
+                bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+    const uint8_t* value_ptr = static_cast<const uint8_t*>(values);
+    LaunchHashmapKernel(num_keys, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        bool inserted;
+        output_addrs[i] = InsertKey(
+                view, key_ptr + i * view.key_bytes_,
+                value_ptr ? value_ptr + i * view.value_bytes_ : nullptr,
+                inserted);
+        output_masks[i] = inserted;
+    });
+}
+
+void FindCUDA(const HashmapView& view,
+              const void* keys,
+              int64_t num_keys,
+              int64_t* output_addrs,
+              bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+    LaunchHashmapKernel(num_keys, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        output_addrs[i] = FindKey(view, key_ptr + i * view.key_bytes_);
+        output_masks[i] = output_addrs[i] >= 0;
+    });
+}
+
+void EraseCUDA(const HashmapView& view,
+               const void* keys,
+               int64_t num_keys,
+               bool* output_masks) {
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys);
+    LaunchHashmapKernel(num_keys, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        output_masks[i] = EraseKey(view, key_ptr + i * view.key_bytes_);
+    });
+}
+
+}  // namespace hashmap
+}  // namespace open3d
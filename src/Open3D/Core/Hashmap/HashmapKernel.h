@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file HashmapKernel.h
+///
+/// Open addressing hash table probing shared by the CPU and CUDA backends.
+/// Functions are marked OPEN3D_HOST_DEVICE and pick the matching atomic
+/// primitives at compile time.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace hashmap {
+
+/// Slot states. A slot is BUSY while its key and value are being written.
+/// Erased slots become DELETED so that probe chains stay intact, and are
+/// reclaimed by a rehash.
+enum SlotState : int { EMPTY = 0, BUSY = 1, OCCUPIED = 2, DELETED = 3 };
+
+/// Raw buffers of a hash table. Slot i owns key i and value i.
+struct HashmapView {
+    int* states_;
+    uint8_t* keys_;
+    uint8_t* values_;
+    int64_t capacity_;
+    int64_t key_bytes_;
+    int64_t value_bytes_;
+};
+
+OPEN3D_HOST_DEVICE inline int AtomicLoad(const int* addr) {
+#if defined(__CUDA_ARCH__)
+    return *static_cast<const volatile int*>(addr);
+#else
+    // std::atomic<int> is layout compatible with int on all supported
+    // platforms, which allows atomic access to plain Tensor memory.
+    return reinterpret_cast<const std::atomic<int>*>(addr)->load(
+            std::memory_order_acquire);
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline void AtomicStore(int* addr, int value) {
+#if defined(__CUDA_ARCH__)
+    __threadfence();
+    atomicExch(addr, value);
+#else
+    reinterpret_cast<std::atomic<int>*>(addr)->store(value,
+                                                     std::memory_order_release);
+#endif
+}
+
+/// Returns true if *addr was \p expected and has been set to \p desired.
+OPEN3D_HOST_DEVICE inline bool AtomicCAS(int* addr, int expected, int desired) {
+#if defined(__CUDA_ARCH__)
+    return atomicCAS(addr, expected, desired) == expected;
+#else
+    return reinterpret_cast<std::atomic<int>*>(addr)->compare_exchange_strong(
+            expected, desired, std::memory_order_acq_rel);
+#endif
+}
+
+/// FNV-1a over the key bytes.
+OPEN3D_HOST_DEVICE inline uint64_t HashKey(const uint8_t* key,
+                                           int64_t key_bytes) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (int64_t i = 0; i < key_bytes; ++i) {
+        hash ^= key[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/// \p slot_key is a key stored in the table, \p rhs a query key.
+OPEN3D_HOST_DEVICE inline bool KeyEqual(const uint8_t* slot_key,
+                                        const uint8_t* rhs,
+                                        int64_t key_bytes) {
+#if defined(__CUDA_ARCH__)
+    // Bypass the non-coherent L1 cache, the key may have been written by
+    // another multiprocessor.
+    const volatile uint8_t* lhs = slot_key;
+#else
+    const uint8_t* lhs = slot_key;
+#endif
+    for (int64_t i = 0; i < key_bytes; ++i) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Inserts \p key with \p value (zeros if nullptr) unless it is present.
+/// Returns the slot of the key, or -1 if the table is full. \p inserted is
+/// true if the key was newly inserted.
+OPEN3D_HOST_DEVICE inline int64_t InsertKey(const HashmapView& view,
+                                            const uint8_t* key,
+                                            const uint8_t* value,
+                                            bool& inserted) {
+    inserted = false;
+    const int64_t start = HashKey(key, view.key_bytes_) % view.capacity_;
+    for (int64_t probe = 0; probe < view.capacity_;) {
+        const int64_t slot = (start + probe) % view.capacity_;
+        const int state = AtomicLoad(view.states_ + slot);
+        if (state == EMPTY) {
+            if (AtomicCAS(view.states_ + slot, EMPTY, BUSY)) {
+                uint8_t* slot_key = view.keys_ + slot * view.key_bytes_;
+                uint8_t* slot_value = view.values_ + slot * view.value_bytes_;
+                for (int64_t i = 0; i < view.key_bytes_; ++i) {
+                    slot_key[i] = key[i];
+                }
+                for (int64_t i = 0; i < view.value_bytes_; ++i) {
+                    slot_value[i] = value ? value[i] : 0;
+                }
+                AtomicStore(view.states_ + slot, OCCUPIED);
+                inserted = true;
+                return slot;
+            }
+            // Lost the race for this slot, inspect it again.
+        } else if (state == BUSY) {
+            // Another thread is writing this slot, possibly the same key.
+        } else {
+            if (state == OCCUPIED &&
+                KeyEqual(view.keys_ + slot * view.key_bytes_, key,
+                         view.key_bytes_)) {
+                return slot;
+            }
+            ++probe;
+        }
+    }
+    return -1;
+}
+
+/// Returns the slot of \p key, or -1 if it is not present.
+OPEN3D_HOST_DEVICE inline int64_t FindKey(const HashmapView& view,
+                                          const uint8_t* key) {
+    const int64_t start = HashKey(key, view.key_bytes_) % view.capacity_;
+    for (int64_t probe = 0; probe < view.capacity_; ++probe) {
+        const int64_t slot = (start + probe) % view.capacity_;
+        const int state = AtomicLoad(view.states_ + slot);
+        if (state == EMPTY) {
+            return -1;
+        }
+        if (state == OCCUPIED && KeyEqual(view.keys_ + slot * view.key_bytes_,
+                                          key, view.key_bytes_)) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+/// Erases \p key. Returns true if this call removed it.
+OPEN3D_HOST_DEVICE inline bool EraseKey(const HashmapView& view,
+                                        const uint8_t* key) {
+    const int64_t slot = FindKey(view, key);
+    return slot >= 0 && AtomicCAS(view.states_ + slot, OCCUPIED, DELETED);
+}
+
+/// Bulk operations. Each key i writes output_addrs[i] (slot or -1) and
+/// output_masks[i] (whether the operation succeeded for that key).
+void InsertCPU(const HashmapView& view,
+               const void* keys,
+               const void* values,
+               int64_t num_keys,
+               int64_t* output_addrs,
+               bool* output_masks);
+void FindCPU(const HashmapView& view,
+             const void* keys,
+             int64_t num_keys,
+             int64_t* output_addrs,
+             bool* output_masks);
+void EraseCPU(const HashmapView& view,
+              const void* keys,
+              int64_t num_keys,
+              bool* output_masks);
+
+#ifdef BUILD_CUDA_MODULE
+void InsertCUDA(const HashmapView& view,
+                const void* keys,
+                const void* values,
+                int64_t num_keys,
+                int64_t* output_addrs,
+                bool* output_masks);
+void FindCUDA(const HashmapView& view,
+              const void* keys,
+              int64_t num_keys,
+              int64_t* output_addrs,
+              bool* output_masks);
+void EraseCUDA(const HashmapView& view,
+               const void* keys,
+               int64_t num_keys,
+               bool* output_masks);
+#endif
+
+}  // namespace hashmap
+}  // namespace open3d
@@ -386,6 +386,30 @@ int64_t Indexer::NumOutputElements() const {
     return num_output_elements;
 }
 
+int64_t Indexer::GetLinearByteStride(const TensorRef& tr) const {
+    bool is_contiguous = true;
+    bool is_scalar = true;
+    for (int64_t i = 0; i < ndims_; ++i) {
+        // The stride of a size-1 dimension has no effect on the offsets.
+        if (master_shape_[i] <= 1) {
+            continue;
+        }
+        if (tr.byte_strides_[i] != master_strides_[i] * tr.dtype_byte_size_) {
+            is_contiguous = false;
+        }
+        if (tr.byte_strides_[i] != 0) {
+            is_scalar = false;
+        }
+    }
+    if (is_contiguous) {
+        return tr.dtype_byte_size_;
+    } else if (is_scalar) {
+        return 0;
+    } else {
+        return -1;
+    }
+}
+
 void Indexer::CoalesceDimensions() {
     if (ndims_ <= 1) {
         return;
@@ -41,9 +41,6 @@ class Indexer;
 
 class IndexerIterator;
 
-// Maximum number of dimensions of TensorRef.
-static constexpr int64_t MAX_DIMS = 10;
-
 // Maximum number of inputs of an op.
 // MAX_INPUTS shall be >= MAX_DIMS to support advanced indexing.
 static constexpr int64_t MAX_INPUTS = 10;
@@ -393,6 +390,24 @@ public:
         return outputs_[0].byte_strides_[dim] == 0 && master_shape_[dim] > 1;
     }
 
+    /// Returns the byte stride between two consecutive workloads of the \p
+    /// input_idx -th input, if the input can be addressed linearly in the
+    /// workload order, i.e. the input is contiguous with respect to the
+    /// master shape, or it is a broadcasted scalar (stride 0). Returns -1
+    /// otherwise.
+    ///
+    /// For linearly addressable inputs, the data pointer of \p workload_idx
+    /// is GetInputPtr(input_idx, 0) + workload_idx * stride.
+    int64_t GetInputLinearByteStride(int64_t input_idx) const {
+        return GetLinearByteStride(GetInput(input_idx));
+    }
+
+    /// Same as GetInputLinearByteStride(), but for the \p output_idx -th
+    /// output.
+    int64_t GetOutputLinearByteStride(int64_t output_idx = 0) const {
+        return GetLinearByteStride(GetOutput(output_idx));
+    }
+
     /// Get input Tensor data pointer based on \p workload_idx.
     ///
     /// \param input_idx Input tensor index.
@@ -468,6 +483,9 @@ protected:
                                   const int64_t* src_shape,
                                   const SizeVector& reduction_dims);
 
+    /// See GetInputLinearByteStride().
+    int64_t GetLinearByteStride(const TensorRef& tr) const;
+
     /// Get data pointer from a TensorRef with \p workload_idx.
     /// Note: can be optimized by computing all input ptrs and output ptr
     /// together.
@@ -526,6 +544,121 @@ protected:
     bool accumulate_ = false;
 };
 
+/// Indexer with all operands linearly addressable, i.e. contiguous with
+/// respect to the master shape or broadcasted scalars. The data pointer of a
+/// workload is computed with a single multiply-add per operand.
+///
+/// The specialized indexers have the same GetInputPtr() and GetOutputPtr()
+/// interface as Indexer and are chosen at launch time by the kernel launchers.
+template <int NINPUTS>
+class LinearIndexer {
+public:
+    /// Returns true if all inputs and the output of \p indexer are linearly
+    /// addressable.
+    static bool CanUse(const Indexer& indexer) {
+        if (indexer.NumInputs() < NINPUTS ||
+            indexer.GetOutputLinearByteStride() < 0) {
+            return false;
+        }
+        for (int i = 0; i < NINPUTS; ++i) {
+            if (indexer.GetInputLinearByteStride(i) < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    LinearIndexer(const Indexer& indexer) {
+        for (int i = 0; i < NINPUTS; ++i) {
+            input_ptrs_[i] = indexer.GetInputPtr(i, 0);
+            input_byte_strides_[i] = indexer.GetInputLinearByteStride(i);
+        }
+        output_ptr_ = indexer.GetOutputPtr(0);
+        output_byte_stride_ = indexer.GetOutputLinearByteStride();
+    }
+
+    OPEN3D_HOST_DEVICE char* GetInputPtr(int64_t input_idx,
+                                         int64_t workload_idx) const {
+        return input_ptrs_[input_idx] +
+               workload_idx * input_byte_strides_[input_idx];
+    }
+
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
+        return output_ptr_ + workload_idx * output_byte_stride_;
+    }
+
+protected:
+    char* input_ptrs_[NINPUTS];
+    int64_t input_byte_strides_[NINPUTS];
+    char* output_ptr_;
+    int64_t output_byte_stride_;
+};
+
+/// Indexer with a compile-time number of dimensions, such that the offset
+/// computation loop is unrolled. Requires indexer.NumDims() == NDIMS. Only
+/// the first NINPUTS inputs and the first output are addressable.
+template <int NDIMS, int NINPUTS>
+class FixedRankIndexer {
+public:
+    static_assert(NDIMS >= 1 && NDIMS <= MAX_DIMS, "Invalid NDIMS.");
+
+    FixedRankIndexer(const Indexer& indexer) {
+        if (indexer.NumDims() != NDIMS || indexer.NumInputs() < NINPUTS) {
+            utility::LogError(
+                    "Internal error: FixedRankIndexer<{}, {}> created from "
+                    "Indexer with {} dims and {} inputs.",
+                    NDIMS, NINPUTS, indexer.NumDims(), indexer.NumInputs());
+        }
+        for (int d = 0; d < NDIMS; ++d) {
+            master_strides_[d] = indexer.GetMasterStrides()[d];
+        }
+        for (int i = 0; i < NINPUTS; ++i) {
+            const TensorRef& input = indexer.GetInput(i);
+            input_ptrs_[i] = static_cast<char*>(input.data_ptr_);
+            for (int d = 0; d < NDIMS; ++d) {
+                input_byte_strides_[i][d] = input.byte_strides_[d];
+            }
+        }
+        const TensorRef& output = indexer.GetOutput(0);
+        output_ptr_ = static_cast<char*>(output.data_ptr_);
+        for (int d = 0; d < NDIMS; ++d) {
+            output_byte_strides_[d] = output.byte_strides_[d];
+        }
+    }
+
+    OPEN3D_HOST_DEVICE char* GetInputPtr(int64_t input_idx,
+                                         int64_t workload_idx) const {
+        return input_ptrs_[input_idx] +
+               GetOffset(input_byte_strides_[input_idx], workload_idx);
+    }
+
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
+        return output_ptr_ + GetOffset(output_byte_strides_, workload_idx);
+    }
+
+protected:
+    /// The master stride of the last dimension is always 1, so the last
+    /// dimension needs no division.
+    OPEN3D_HOST_DEVICE int64_t GetOffset(const int64_t* byte_strides,
+                                         int64_t workload_idx) const {
+        int64_t offset = 0;
+#if defined(__CUDA_ARCH__)
+#pragma unroll
+#endif
+        for (int d = 0; d < NDIMS - 1; ++d) {
+            offset += workload_idx / master_strides_[d] * byte_strides[d];
+            workload_idx = workload_idx % master_strides_[d];
+        }
+        return offset + workload_idx * byte_strides[NDIMS - 1];
+    }
+
+    int64_t master_strides_[NDIMS];
+    char* input_ptrs_[NINPUTS];
+    int64_t input_byte_strides_[NINPUTS][NDIMS];
+    char* output_ptr_;
+    int64_t output_byte_strides_[NDIMS];
+};
+
 class IndexerIterator {
 public:
     struct Iterator {
@@ -49,25 +49,25 @@ void BinaryEW(const Tensor& lhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
     // lhs, rhs and dst must be on the same device.
-    for (auto device :
-         std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
-        if (lhs.GetDevice() != device) {
+    const Device lhs_device = lhs.GetDevice();
+    for (const Device& device : {rhs.GetDevice(), dst.GetDevice()}) {
+        if (lhs_device != device) {
             utility::LogError("Device mismatch {} != {}.",
-                              lhs.GetDevice().ToString(), device.ToString());
+                              lhs_device.ToString(), device.ToString());
         }
     }
 
     // broadcast(lhs.shape, rhs.shape) must be dst.shape.
-    const SizeVector broadcasted_input_shape =
-            shape_util::BroadcastedShape(lhs.GetShape(), rhs.GetShape());
-    if (broadcasted_input_shape != dst.GetShape()) {
+    const SizeVector broadcasted_input_shape = shape_util::BroadcastedShape(
+            lhs.GetShapeRef(), rhs.GetShapeRef());
+    if (broadcasted_input_shape != dst.GetShapeRef()) {
         utility::LogError(
                 "The broadcasted input shape {} does not match the output "
                 "shape {}.",
                 broadcasted_input_shape, dst.GetShape());
     }
 
-    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    Device::DeviceType device_type = lhs_device.GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
     } else if (device_type == Device::DeviceType::CUDA) {
@@ -67,6 +67,64 @@ static OPEN3D_HOST_DEVICE void CUDADivElementKernel(const void* lhs,
                                    *static_cast<const scalar_t*>(rhs);
 }
 
+// Half arithmetic uses native instructions on sm_53 and newer. Older
+// architectures compute in float.
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 530
+#define OPEN3D_CUDA_NATIVE_HALF
+#endif
+
+template <>
+OPEN3D_HOST_DEVICE void CUDAAddElementKernel<Half>(const void* lhs,
+                                                   const void* rhs,
+                                                   void* dst) {
+#ifdef OPEN3D_CUDA_NATIVE_HALF
+    *static_cast<__half*>(dst) = __hadd(*static_cast<const __half*>(lhs),
+                                        *static_cast<const __half*>(rhs));
+#else
+    *static_cast<Half*>(dst) = *static_cast<const Half*>(lhs) +
+                               *static_cast<const Half*>(rhs);
+#endif
+}
+
+template <>
+OPEN3D_HOST_DEVICE void CUDASubElementKernel<Half>(const void* lhs,
+                                                   const void* rhs,
+                                                   void* dst) {
+#ifdef OPEN3D_CUDA_NATIVE_HALF
+    *static_cast<__half*>(dst) = __hsub(*static_cast<const __half*>(lhs),
+                                        *static_cast<const __half*>(rhs));
+#else
+    *static_cast<Half*>(dst) = *static_cast<const Half*>(lhs) -
+                               *static_cast<const Half*>(rhs);
+#endif
+}
+
+template <>
+OPEN3D_HOST_DEVICE void CUDAMulElementKernel<Half>(const void* lhs,
+                                                   const void* rhs,
+                                                   void* dst) {
+#ifdef OPEN3D_CUDA_NATIVE_HALF
+    *static_cast<__half*>(dst) = __hmul(*static_cast<const __half*>(lhs),
+                                        *static_cast<const __half*>(rhs));
+#else
+    *static_cast<Half*>(dst) = *static_cast<const Half*>(lhs) *
+                               *static_cast<const Half*>(rhs);
+#endif
+}
+
+template <>
+OPEN3D_HOST_DEVICE void CUDADivElementKernel<Half>(const void* lhs,
+                                                   const void* rhs,
+                                                   void* dst) {
+#ifdef OPEN3D_CUDA_NATIVE_HALF
+    *static_cast<__half*>(dst) = __hdiv(*static_cast<const __half*>(lhs),
+                                        *static_cast<const __half*>(rhs));
+#else
+    *static_cast<Half*>(dst) = *static_cast<const Half*>(lhs) /
+                               *static_cast<const Half*>(rhs);
+#endif
+}
+
 template <typename src_t, typename dst_t>
 static OPEN3D_HOST_DEVICE void CUDALogicalAndElementKernel(const void* lhs,
                                                            const void* rhs,
@@ -34,50 +34,194 @@
 #include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
 
+/// Element kernels shall be passed as lambdas rather than function pointers,
+/// such that they can be inlined (and auto-vectorized) in the parallel loops.
 class CPULauncher {
 public:
+    /// Minimum number of elementwise workloads per parallel chunk. Smaller
+    /// kernels run on the calling thread.
+    static constexpr int64_t GRAIN_SIZE = 32768;
+
+    /// Launch elementwise kernel with one input.
+    ///
+    /// If the input and output can be addressed linearly (contiguous or
+    /// scalar-broadcasted), pointers are computed with a single multiply-add
+    /// per operand instead of a full stride decomposition. Otherwise, indexers
+    /// with a compile-time rank are used for up to 3 dimensions.
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        const int64_t src_stride = indexer.GetInputLinearByteStride(0);
+        const int64_t dst_stride = indexer.GetOutputLinearByteStride();
+        if (src_stride >= 0 && dst_stride >= 0) {
+            const char* src = indexer.GetInputPtr(0, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t n = indexer.NumWorkloads();
+            if (src_stride == dst_stride) {
+                // Same element size, a single offset for both operands.
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            const int64_t offset = workload_idx * dst_stride;
+                            element_kernel(src + offset, dst + offset);
+                        },
+                        GRAIN_SIZE);
+            } else {
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            element_kernel(src + workload_idx * src_stride,
+                                           dst + workload_idx * dst_stride);
+                        },
+                        GRAIN_SIZE);
+            }
+            return;
         }
+
+        switch (indexer.NumDims()) {
+            case 1:
+                LaunchUnaryEWKernel(FixedRankIndexer<1, 1>(indexer),
+                                    indexer.NumWorkloads(), element_kernel);
+                break;
+            case 2:
+                LaunchUnaryEWKernel(FixedRankIndexer<2, 1>(indexer),
+                                    indexer.NumWorkloads(), element_kernel);
+                break;
+            case 3:
+                LaunchUnaryEWKernel(FixedRankIndexer<3, 1>(indexer),
+                                    indexer.NumWorkloads(), element_kernel);
+                break;
+            default:
+                LaunchUnaryEWKernel(indexer, indexer.NumWorkloads(),
+                                    element_kernel);
+                break;
+        }
+    }
+
+    /// Launch elementwise kernel with one input for \p n workloads, addressing
+    /// the operands with \p indexer, which is an Indexer or one of its
+    /// compile-time specializations in Indexer.h.
+    template <typename indexer_t, typename func_t>
+    static void LaunchUnaryEWKernel(const indexer_t& indexer,
+                                    int64_t n,
+                                    func_t element_kernel) {
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                GRAIN_SIZE);
     }
 
+    /// Launch elementwise kernel with two inputs.
+    ///
+    /// If all operands can be addressed linearly (contiguous or
+    /// scalar-broadcasted), pointers are computed with a single multiply-add
+    /// per operand instead of a full stride decomposition. The common cases
+    /// of two contiguous inputs and of a contiguous input with a scalar are
+    /// handled with dedicated loops. Otherwise, indexers with a compile-time
+    /// rank are used for up to 3 dimensions.
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+        const int64_t lhs_stride = indexer.GetInputLinearByteStride(0);
+        const int64_t rhs_stride = indexer.GetInputLinearByteStride(1);
+        const int64_t dst_stride = indexer.GetOutputLinearByteStride();
+        if (lhs_stride >= 0 && rhs_stride >= 0 && dst_stride >= 0) {
+            const char* lhs = indexer.GetInputPtr(0, 0);
+            const char* rhs = indexer.GetInputPtr(1, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t n = indexer.NumWorkloads();
+            if (lhs_stride == dst_stride && rhs_stride == dst_stride) {
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            const int64_t offset = workload_idx * dst_stride;
+                            element_kernel(lhs + offset, rhs + offset,
+                                           dst + offset);
+                        },
+                        GRAIN_SIZE);
+            } else if (lhs_stride == dst_stride && rhs_stride == 0) {
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            const int64_t offset = workload_idx * dst_stride;
+                            element_kernel(lhs + offset, rhs, dst + offset);
+                        },
+                        GRAIN_SIZE);
+            } else if (lhs_stride == 0 && rhs_stride == dst_stride) {
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            const int64_t offset = workload_idx * dst_stride;
+                            element_kernel(lhs, rhs + offset, dst + offset);
+                        },
+                        GRAIN_SIZE);
+            } else {
+                utility::ParallelFor(
+                        0, n,
+                        [&](int64_t workload_idx) {
+                            element_kernel(lhs + workload_idx * lhs_stride,
+                                           rhs + workload_idx * rhs_stride,
+                                           dst + workload_idx * dst_stride);
+                        },
+                        GRAIN_SIZE);
+            }
+            return;
         }
+
+        switch (indexer.NumDims()) {
+            case 1:
+                LaunchBinaryEWKernel(FixedRankIndexer<1, 2>(indexer),
+                                     indexer.NumWorkloads(), element_kernel);
+                break;
+            case 2:
+                LaunchBinaryEWKernel(FixedRankIndexer<2, 2>(indexer),
+                                     indexer.NumWorkloads(), element_kernel);
+                break;
+            case 3:
+                LaunchBinaryEWKernel(FixedRankIndexer<3, 2>(indexer),
+                                     indexer.NumWorkloads(), element_kernel);
+                break;
+            default:
+                LaunchBinaryEWKernel(indexer, indexer.NumWorkloads(),
+                                     element_kernel);
+                break;
+        }
+    }
+
+    /// Launch elementwise kernel with two inputs for \p n workloads. See the
+    /// unary version.
+    template <typename indexer_t, typename func_t>
+    static void LaunchBinaryEWKernel(const indexer_t& indexer,
+                                     int64_t n,
+                                     func_t element_kernel) {
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetInputPtr(1, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                GRAIN_SIZE);
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        utility::ParallelFor(
+                0, indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                GRAIN_SIZE);
     }
 
     template <typename scalar_t, typename func_t>
@@ -107,18 +251,18 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                element_kernel(indexer.GetInputPtr(0, workload_idx),
-                               &thread_results[thread_idx]);
-            }
-        }
+        utility::ParallelFor(
+                0, num_threads,
+                [&](int64_t thread_idx) {
+                    int64_t start = thread_idx * workload_per_thread;
+                    int64_t end = std::min(start + workload_per_thread,
+                                           num_workloads);
+                    for (int64_t workload_idx = start; workload_idx < end;
+                         ++workload_idx) {
+                        element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                       &thread_results[thread_idx]);
+                    }
+                });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -153,14 +297,14 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        utility::ParallelFor(
+                0, indexer_shape[best_dim],
+                [&](int64_t i) {
+                    Indexer sub_indexer(indexer);
+                    sub_indexer.ShrinkDim(best_dim, i, 1);
+                    LaunchReductionKernelSerial<scalar_t>(sub_indexer,
+                                                          element_kernel);
+                });
     }
 };
 
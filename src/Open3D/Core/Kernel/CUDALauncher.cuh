@@ -30,6 +30,7 @@
 #include <cuda_runtime.h>
 
 #include "Open3D/Core/AdvancedIndexing.h"
+#include "Open3D/Core/CUDAStream.h"
 #include "Open3D/Core/CUDAUtils.h"
 #include "Open3D/Core/Indexer.h"
 #include "Open3D/Core/SizeVector.h"
@@ -64,6 +65,30 @@ __global__ void ElementWiseKernel(int64_t n, func_t f) {
 
 class CUDALauncher {
 public:
+    /// Launch a kernel calling element_kernel(workload_idx) for each
+    /// workload_idx in [0, n), for kernels that compute their own pointers.
+    template <typename func_t>
+    static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
+        OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
+
+        if (n == 0) {
+            return;
+        }
+        int64_t items_per_block = default_block_size * default_thread_size;
+        int64_t grid_size = (n + items_per_block - 1) / items_per_block;
+
+        ElementWiseKernel<default_block_size, default_thread_size>
+                <<<grid_size, default_block_size, 0,
+                   cuda::GetCurrentStream()>>>(n, element_kernel);
+        OPEN3D_GET_LAST_CUDA_ERROR("LaunchGeneralKernel failed.");
+    }
+
+    /// Launch elementwise kernel with one input.
+    ///
+    /// The operand pointers are computed with an indexer specialized at
+    /// compile time if possible: a single multiply-add per operand if all
+    /// operands are linearly addressable (contiguous or scalar-broadcasted),
+    /// or an unrolled stride decomposition for up to 3 dimensions.
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
@@ -73,6 +98,36 @@ public:
         if (n == 0) {
             return;
         }
+        if (LinearIndexer<1>::CanUse(indexer)) {
+            LaunchUnaryEWKernel(LinearIndexer<1>(indexer), n, element_kernel);
+            return;
+        }
+        switch (indexer.NumDims()) {
+            case 1:
+                LaunchUnaryEWKernel(FixedRankIndexer<1, 1>(indexer), n,
+                                    element_kernel);
+                break;
+            case 2:
+                LaunchUnaryEWKernel(FixedRankIndexer<2, 1>(indexer), n,
+                                    element_kernel);
+                break;
+            case 3:
+                LaunchUnaryEWKernel(FixedRankIndexer<3, 1>(indexer), n,
+                                    element_kernel);
+                break;
+            default:
+                LaunchUnaryEWKernel(indexer, n, element_kernel);
+                break;
+        }
+    }
+
+    /// Launch elementwise kernel with one input for \p n workloads, addressing
+    /// the operands with \p indexer, which is an Indexer or one of its
+    /// compile-time specializations in Indexer.h.
+    template <typename indexer_t, typename func_t>
+    static void LaunchUnaryEWKernel(const indexer_t& indexer,
+                                    int64_t n,
+                                    func_t element_kernel) {
         int64_t items_per_block = default_block_size * default_thread_size;
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
@@ -82,10 +137,12 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   cuda::GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
     }
 
+    /// Launch elementwise kernel with two inputs. See the unary version.
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
@@ -95,6 +152,35 @@ public:
         if (n == 0) {
             return;
         }
+        if (LinearIndexer<2>::CanUse(indexer)) {
+            LaunchBinaryEWKernel(LinearIndexer<2>(indexer), n, element_kernel);
+            return;
+        }
+        switch (indexer.NumDims()) {
+            case 1:
+                LaunchBinaryEWKernel(FixedRankIndexer<1, 2>(indexer), n,
+                                     element_kernel);
+                break;
+            case 2:
+                LaunchBinaryEWKernel(FixedRankIndexer<2, 2>(indexer), n,
+                                     element_kernel);
+                break;
+            case 3:
+                LaunchBinaryEWKernel(FixedRankIndexer<3, 2>(indexer), n,
+                                     element_kernel);
+                break;
+            default:
+                LaunchBinaryEWKernel(indexer, n, element_kernel);
+                break;
+        }
+    }
+
+    /// Launch elementwise kernel with two inputs for \p n workloads. See the
+    /// unary version.
+    template <typename indexer_t, typename func_t>
+    static void LaunchBinaryEWKernel(const indexer_t& indexer,
+                                     int64_t n,
+                                     func_t element_kernel) {
         int64_t items_per_block = default_block_size * default_thread_size;
         int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
@@ -105,7 +191,8 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   cuda::GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
     }
 
@@ -127,7 +214,8 @@ public:
         };
 
         ElementWiseKernel<default_block_size, default_thread_size>
-                <<<grid_size, default_block_size, 0>>>(n, f);
+                <<<grid_size, default_block_size, 0,
+                   cuda::GetCurrentStream()>>>(n, f);
         OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
     }
 };
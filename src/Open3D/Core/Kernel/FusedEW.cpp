@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    const int64_t num_inputs = static_cast<int64_t>(inputs.size());
+    const int64_t num_instructions = static_cast<int64_t>(program.size());
+    if (num_inputs == 0 || num_inputs > MAX_FUSED_INPUTS) {
+        utility::LogError("FusedEW: number of inputs {} not in [1, {}].",
+                          num_inputs, MAX_FUSED_INPUTS);
+    }
+    if (num_instructions == 0 || num_instructions > MAX_FUSED_INSTRUCTIONS) {
+        utility::LogError("FusedEW: number of instructions {} not in [1, {}].",
+                          num_instructions, MAX_FUSED_INSTRUCTIONS);
+    }
+    if (!dst.IsContiguous()) {
+        utility::LogError("FusedEW: dst must be contiguous.");
+    }
+
+    const Dtype dtype = dst.GetDtype();
+    const Device device = dst.GetDevice();
+    if (dtype == Dtype::Bool) {
+        utility::LogError("FusedEW: Bool dtype is not supported.");
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(), device.ToString());
+        }
+        if (input.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(input.GetDtype()),
+                              DtypeUtil::ToString(dtype));
+        }
+        bool is_dense = input.IsContiguous() &&
+                        input.GetShape() == dst.GetShape();
+        if (!is_dense && input.NumElements() != 1) {
+            utility::LogError(
+                    "FusedEW: input of shape {} must be contiguous with shape "
+                    "{} or have a single element.",
+                    input.GetShape(), dst.GetShape());
+        }
+    }
+
+    const bool is_float = DtypeUtil::IsFloat(dtype);
+    for (int64_t i = 0; i < num_instructions; ++i) {
+        const FusedEWInstruction& inst = program[i];
+        const int64_t num_valid_regs = num_inputs + i;
+        bool lhs_valid = inst.lhs_ >= 0 && inst.lhs_ < num_valid_regs;
+        bool rhs_valid = inst.rhs_ >= 0 && inst.rhs_ < num_valid_regs;
+        if (!lhs_valid || (inst.is_binary_ && !rhs_valid)) {
+            utility::LogError("FusedEW: instruction {} has invalid operands.",
+                              i);
+        }
+        if (inst.is_binary_) {
+            switch (inst.binary_op_code_) {
+                case BinaryEWOpCode::Add:
+                case BinaryEWOpCode::Sub:
+                case BinaryEWOpCode::Mul:
+                case BinaryEWOpCode::Div:
+                    break;
+                default:
+                    utility::LogError("FusedEW: unsupported binary op code.");
+            }
+        } else {
+            switch (inst.unary_op_code_) {
+                case UnaryEWOpCode::Sqrt:
+                case UnaryEWOpCode::Sin:
+                case UnaryEWOpCode::Cos:
+                case UnaryEWOpCode::Exp:
+                    if (!is_float) {
+                        utility::LogError(
+                                "Only supports Float32 and Float64, but {} is "
+                                "used.",
+                                DtypeUtil::ToString(dtype));
+                    }
+                    break;
+                case UnaryEWOpCode::Neg:
+                case UnaryEWOpCode::Abs:
+                    break;
+                default:
+                    utility::LogError("FusedEW: unsupported unary op code.");
+            }
+        }
+    }
+    if (dst.NumElements() == 0) {
+        return;
+    }
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, program, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Maximum number of input tensors of a fused elementwise program.
+static constexpr int64_t MAX_FUSED_INPUTS = 8;
+
+/// Maximum number of instructions of a fused elementwise program.
+static constexpr int64_t MAX_FUSED_INSTRUCTIONS = 24;
+
+/// One operation of a fused elementwise program. Registers
+/// [0, num_inputs) hold the input values, register num_inputs + i holds the
+/// result of the i-th instruction. Operands may only refer to inputs or to
+/// earlier instructions.
+struct FusedEWInstruction {
+    bool is_binary_ = false;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    int lhs_ = 0;
+    int rhs_ = 0;
+};
+
+/// Evaluates \p program for every element in a single pass and writes the
+/// result of the last instruction to \p dst, without allocating intermediate
+/// tensors. Each input must either be contiguous with the shape of \p dst or
+/// contain exactly one element, which is then broadcasted. Inputs and \p dst
+/// must share the same dtype and device. Only arithmetic op codes
+/// (Add, Sub, Mul, Div, Sqrt, Sin, Cos, Neg, Exp, Abs) are supported.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const std::vector<FusedEWInstruction>& program,
+                 Tensor& dst);
+#endif
+
+}  // namespace kernel
+}  // namespace open3d
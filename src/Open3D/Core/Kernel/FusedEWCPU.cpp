@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Number of elements evaluated per instruction before moving on to the next
+/// instruction. Intermediate results of one chunk stay in L1/L2 cache.
+static constexpr int64_t FUSED_CHUNK_SIZE = 1024;
+
+template <typename scalar_t, typename func_t>
+static void CPUFusedUnaryLoop(const scalar_t* src,
+                              int64_t src_stride,
+                              scalar_t* dst,
+                              int64_t n,
+                              func_t element_kernel) {
+    if (src_stride == 0) {
+        const scalar_t v = element_kernel(*src);
+        std::fill(dst, dst + n, v);
+    } else {
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = element_kernel(src[i]);
+        }
+    }
+}
+
+template <typename scalar_t, typename func_t>
+static void CPUFusedBinaryLoop(const scalar_t* lhs,
+                               int64_t lhs_stride,
+                               const scalar_t* rhs,
+                               int64_t rhs_stride,
+                               scalar_t* dst,
+                               int64_t n,
+                               func_t element_kernel) {
+    if (lhs_stride == 1 && rhs_stride == 1) {
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = element_kernel(lhs[i], rhs[i]);
+        }
+    } else if (lhs_stride == 1) {
+        const scalar_t r = *rhs;
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = element_kernel(lhs[i], r);
+        }
+    } else if (rhs_stride == 1) {
+        const scalar_t l = *lhs;
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = element_kernel(l, rhs[i]);
+        }
+    } else {
+        const scalar_t v = element_kernel(*lhs, *rhs);
+        std::fill(dst, dst + n, v);
+    }
+}
+
+template <typename scalar_t>
+static void CPUFusedUnary(UnaryEWOpCode op_code,
+                          const scalar_t* src,
+                          int64_t src_stride,
+                          scalar_t* dst,
+                          int64_t n) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(std::sqrt(x));
+            });
+            break;
+        case UnaryEWOpCode::Sin:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(std::sin(x));
+            });
+            break;
+        case UnaryEWOpCode::Cos:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(std::cos(x));
+            });
+            break;
+        case UnaryEWOpCode::Neg:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(-x);
+            });
+            break;
+        case UnaryEWOpCode::Exp:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(std::exp(x));
+            });
+            break;
+        case UnaryEWOpCode::Abs:
+            CPUFusedUnaryLoop(src, src_stride, dst, n, [](scalar_t x) {
+                return static_cast<scalar_t>(
+                        std::abs(static_cast<double>(x)));
+            });
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void CPUFusedBinary(BinaryEWOpCode op_code,
+                           const scalar_t* lhs,
+                           int64_t lhs_stride,
+                           const scalar_t* rhs,
+                           int64_t rhs_stride,
+                           scalar_t* dst,
+                           int64_t n) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            CPUFusedBinaryLoop(lhs, lhs_stride, rhs, rhs_stride, dst, n,
+                               [](scalar_t a, scalar_t b) { return a + b; });
+            break;
+        case BinaryEWOpCode::Sub:
+            CPUFusedBinaryLoop(lhs, lhs_stride, rhs, rhs_stride, dst, n,
+                               [](scalar_t a, scalar_t b) { return a - b; });
+            break;
+        case BinaryEWOpCode::Mul:
+            CPUFusedBinaryLoop(lhs, lhs_stride, rhs, rhs_stride, dst, n,
+                               [](scalar_t a, scalar_t b) { return a * b; });
+            break;
+        case BinaryEWOpCode::Div:
+            CPUFusedBinaryLoop(lhs, lhs_stride, rhs, rhs_stride, dst, n,
+                               [](scalar_t a, scalar_t b) { return a / b; });
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void CPUFusedEW(const std::vector<Tensor>& inputs,
+                       const std::vector<FusedEWInstruction>& program,
+                       Tensor& dst) {
+    const int64_t num_elements = dst.NumElements();
+    const int64_t num_inputs = static_cast<int64_t>(inputs.size());
+    const int64_t num_instructions = static_cast<int64_t>(program.size());
+    const int64_t num_chunks =
+            (num_elements + FUSED_CHUNK_SIZE - 1) / FUSED_CHUNK_SIZE;
+
+    std::vector<const scalar_t*> input_ptrs(num_inputs);
+    std::vector<int64_t> input_strides(num_inputs);
+    for (int64_t i = 0; i < num_inputs; ++i) {
+        input_ptrs[i] = static_cast<const scalar_t*>(inputs[i].GetDataPtr());
+        input_strides[i] = inputs[i].NumElements() == 1 ? 0 : 1;
+    }
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Per-thread scratch space for intermediate results of a chunk.
+        std::vector<scalar_t> buffer((num_instructions - 1) *
+                                     FUSED_CHUNK_SIZE);
+        std::vector<const scalar_t*> reg_ptrs(num_inputs + num_instructions);
+        std::vector<int64_t> reg_strides(num_inputs + num_instructions, 1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t start = chunk * FUSED_CHUNK_SIZE;
+            const int64_t n = std::min(FUSED_CHUNK_SIZE, num_elements - start);
+            for (int64_t i = 0; i < num_inputs; ++i) {
+                reg_ptrs[i] = input_ptrs[i] + start * input_strides[i];
+                reg_strides[i] = input_strides[i];
+            }
+            for (int64_t i = 0; i < num_instructions; ++i) {
+                const FusedEWInstruction& inst = program[i];
+                scalar_t* out = i == num_instructions - 1
+                                        ? dst_ptr + start
+                                        : buffer.data() + i * FUSED_CHUNK_SIZE;
+                if (inst.is_binary_) {
+                    CPUFusedBinary(inst.binary_op_code_, reg_ptrs[inst.lhs_],
+                                   reg_strides[inst.lhs_], reg_ptrs[inst.rhs_],
+                                   reg_strides[inst.rhs_], out, n);
+                } else {
+                    CPUFusedUnary(inst.unary_op_code_, reg_ptrs[inst.lhs_],
+                                  reg_strides[inst.lhs_], out, n);
+                }
+                reg_ptrs[num_inputs + i] = out;
+            }
+        }
+    }
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPUFusedEW<scalar_t>(inputs, program, dst);
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
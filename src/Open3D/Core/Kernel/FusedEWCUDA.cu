@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAState.cuh"
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/Kernel/FusedEW.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Fixed-size copy of a fused program, passed to the device by value.
+template <typename scalar_t>
+struct CUDAFusedEWProgram {
+    int num_inputs_;
+    int num_instructions_;
+    const scalar_t* input_ptrs_[MAX_FUSED_INPUTS];
+    int64_t input_strides_[MAX_FUSED_INPUTS];
+    FusedEWInstruction instructions_[MAX_FUSED_INSTRUCTIONS];
+};
+
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE scalar_t CUDAFusedUnary(UnaryEWOpCode op_code,
+                                                  scalar_t x) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            return static_cast<scalar_t>(sqrt(static_cast<double>(x)));
+        case UnaryEWOpCode::Sin:
+            return static_cast<scalar_t>(sin(static_cast<double>(x)));
+        case UnaryEWOpCode::Cos:
+            return static_cast<scalar_t>(cos(static_cast<double>(x)));
+        case UnaryEWOpCode::Neg:
+            return static_cast<scalar_t>(-x);
+        case UnaryEWOpCode::Exp:
+            return static_cast<scalar_t>(exp(static_cast<double>(x)));
+        case UnaryEWOpCode::Abs:
+            return static_cast<scalar_t>(fabs(static_cast<double>(x)));
+        default:
+            return x;
+    }
+}
+
+template <typename scalar_t>
+static OPEN3D_HOST_DEVICE scalar_t CUDAFusedBinary(BinaryEWOpCode op_code,
+                                                   scalar_t a,
+                                                   scalar_t b) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            return a + b;
+        case BinaryEWOpCode::Sub:
+            return a - b;
+        case BinaryEWOpCode::Mul:
+            return a * b;
+        case BinaryEWOpCode::Div:
+            return a / b;
+        default:
+            return a;
+    }
+}
+
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const std::vector<FusedEWInstruction>& program,
+                 Tensor& dst) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    const int64_t n = dst.NumElements();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CUDAFusedEWProgram<scalar_t> fused;
+        fused.num_inputs_ = static_cast<int>(inputs.size());
+        fused.num_instructions_ = static_cast<int>(program.size());
+        for (int i = 0; i < fused.num_inputs_; ++i) {
+            fused.input_ptrs_[i] =
+                    static_cast<const scalar_t*>(inputs[i].GetDataPtr());
+            fused.input_strides_[i] = inputs[i].NumElements() == 1 ? 0 : 1;
+        }
+        for (int i = 0; i < fused.num_instructions_; ++i) {
+            fused.instructions_[i] = program[i];
+        }
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+        auto f = [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+            scalar_t regs[MAX_FUSED_INPUTS + MAX_FUSED_INSTRUCTIONS];
+            for (int i = 0; i < fused.num_inputs_; ++i) {
+                regs[i] = fused.input_ptrs_[i][workload_idx *
+                                               fused.input_strides_[i]];
+            }
+            for (int i = 0; i < fused.num_instructions_; ++i) {
+                const FusedEWInstruction& inst = fused.instructions_[i];
+                regs[fused.num_inputs_ + i] =
+                        inst.is_binary_
+                                ? CUDAFusedBinary(inst.binary_op_code_,
+                                                  regs[inst.lhs_],
+                                                  regs[inst.rhs_])
+                                : CUDAFusedUnary(inst.unary_op_code_,
+                                                 regs[inst.lhs_]);
+            }
+            dst_ptr[workload_idx] =
+                    regs[fused.num_inputs_ + fused.num_instructions_ - 1];
+        };
+
+        int64_t items_per_block = default_block_size * default_thread_size;
+        int64_t grid_size = (n + items_per_block - 1) / items_per_block;
+        ElementWiseKernel<default_block_size, default_thread_size>
+                <<<grid_size, default_block_size, 0,
+                   cuda::GetCurrentStream()>>>(n, f);
+        OPEN3D_GET_LAST_CUDA_ERROR("FusedEWCUDA failed.");
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
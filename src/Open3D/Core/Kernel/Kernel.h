@@ -27,7 +27,12 @@
 #pragma once
 
 #include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/FusedEW.h"
 #include "Open3D/Core/Kernel/IndexGetSet.h"
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
 #include "Open3D/Core/Kernel/NonZero.h"
+#include "Open3D/Core/Kernel/Random.h"
 #include "Open3D/Core/Kernel/Reduction.h"
+#include "Open3D/Core/Kernel/Scan.h"
+#include "Open3D/Core/Kernel/Sort.h"
 #include "Open3D/Core/Kernel/UnaryEW.h"
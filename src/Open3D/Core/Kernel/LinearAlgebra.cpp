@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+
+#include <vector>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+static void AssertLinearAlgebraOperands(const std::vector<Tensor>& tensors) {
+    const Device device = tensors[0].GetDevice();
+    const Dtype dtype = tensors[0].GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          DtypeUtil::ToString(dtype));
+    }
+    for (const Tensor& t : tensors) {
+        if (t.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              t.GetDevice().ToString(), device.ToString());
+        }
+        if (t.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              DtypeUtil::ToString(t.GetDtype()),
+                              DtypeUtil::ToString(dtype));
+        }
+        if (t.NumDims() != 3 || !t.IsContiguous()) {
+            utility::LogError(
+                    "Expected contiguous 3D tensors, but got shape {}.",
+                    t.GetShape());
+        }
+    }
+}
+
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    AssertLinearAlgebraOperands({lhs, rhs, dst});
+    const int64_t batch_size = dst.GetShape(0);
+    const int64_t m = lhs.GetShape(1);
+    const int64_t k = lhs.GetShape(2);
+    const int64_t n = rhs.GetShape(2);
+    if (rhs.GetShape(1) != k || dst.GetShape(1) != m || dst.GetShape(2) != n ||
+        (lhs.GetShape(0) != batch_size && lhs.GetShape(0) != 1) ||
+        (rhs.GetShape(0) != batch_size && rhs.GetShape(0) != 1)) {
+        utility::LogError("Matmul: incompatible shapes {} @ {} -> {}.",
+                          lhs.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+    if (dst.NumElements() == 0) {
+        return;
+    }
+
+    Device::DeviceType device_type = lhs.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MatmulCPU(lhs, rhs, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MatmulCUDA(lhs, rhs, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Matmul: Unimplemented device");
+    }
+}
+
+void Solve(const Tensor& a, const Tensor& rhs, Tensor& dst) {
+    AssertLinearAlgebraOperands({a, rhs, dst});
+    const int64_t batch_size = a.GetShape(0);
+    const int64_t n = a.GetShape(1);
+    if (a.GetShape(2) != n || rhs.GetShape(1) != n ||
+        (rhs.GetShape(0) != batch_size && rhs.GetShape(0) != 1) ||
+        dst.GetShape() != SizeVector({batch_size, n, rhs.GetShape(2)})) {
+        utility::LogError("Solve: incompatible shapes {}, {} -> {}.",
+                          a.GetShape(), rhs.GetShape(), dst.GetShape());
+    }
+    if (dst.NumElements() == 0) {
+        return;
+    }
+
+    Device::DeviceType device_type = a.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SolveCPU(a, rhs, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SolveCUDA(a, rhs, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Solve: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Largest matrix dimension handled by the batched small-matrix solver.
+static constexpr int64_t MAX_SMALL_MATRIX_DIM = 6;
+
+/// Batched matrix multiplication dst[b] = lhs[b] @ rhs[b].
+///
+/// \param lhs Contiguous tensor of shape (B, M, K) or (1, M, K).
+/// \param rhs Contiguous tensor of shape (B, K, N) or (1, K, N).
+/// \param dst Contiguous tensor of shape (B, M, N). An operand with batch size
+/// 1 is broadcasted. Only Float32 and Float64 are supported.
+void Matmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void MatmulCUDA(const Tensor& lhs, const Tensor& rhs, Tensor& dst);
+#endif
+
+/// Batched linear system solve a[b] @ dst[b] = rhs[b] with partial pivoting.
+///
+/// \param a Contiguous tensor of shape (B, N, N).
+/// \param rhs Contiguous tensor of shape (B, N, K) or (1, N, K).
+/// \param dst Contiguous tensor of shape (B, N, K). Singular systems produce
+/// non-finite values. Only Float32 and Float64 are supported. On CUDA, N must
+/// not exceed MAX_SMALL_MATRIX_DIM.
+void Solve(const Tensor& a, const Tensor& rhs, Tensor& dst);
+
+void SolveCPU(const Tensor& a, const Tensor& rhs, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void SolveCUDA(const Tensor& a, const Tensor& rhs, Tensor& dst);
+#endif
+
+}  // namespace kernel
+}  // namespace open3d
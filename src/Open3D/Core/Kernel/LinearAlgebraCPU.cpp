@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+#include "Open3D/Core/Kernel/SmallMatrixSolver.h"
+
+namespace open3d {
+namespace kernel {
+
+template <typename scalar_t>
+using RowMajorMatrix = Eigen::
+        Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+template <typename scalar_t>
+static void CPUMatmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    const int64_t batch_size = dst.GetShape(0);
+    const int64_t m = lhs.GetShape(1);
+    const int64_t k = lhs.GetShape(2);
+    const int64_t n = rhs.GetShape(2);
+    const int64_t lhs_stride = lhs.GetShape(0) == 1 ? 0 : m * k;
+    const int64_t rhs_stride = rhs.GetShape(0) == 1 ? 0 : k * n;
+    const scalar_t* lhs_ptr = static_cast<const scalar_t*>(lhs.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // A single large product is parallelized by Eigen itself, many small ones
+    // over the batch.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (batch_size > 1)
+#endif
+    for (int64_t b = 0; b < batch_size; ++b) {
+        Eigen::Map<const RowMajorMatrix<scalar_t>> lhs_mat(
+                lhs_ptr + b * lhs_stride, m, k);
+        Eigen::Map<const RowMajorMatrix<scalar_t>> rhs_mat(
+                rhs_ptr + b * rhs_stride, k, n);
+        Eigen::Map<RowMajorMatrix<scalar_t>> dst_mat(dst_ptr + b * m * n, m,
+                                                     n);
+        dst_mat.noalias() = lhs_mat * rhs_mat;
+    }
+}
+
+template <typename scalar_t>
+static void CPUSolve(const Tensor& a, const Tensor& rhs, Tensor& dst) {
+    const int64_t batch_size = a.GetShape(0);
+    const int64_t n = a.GetShape(1);
+    const int64_t k = rhs.GetShape(2);
+    const int64_t rhs_stride = rhs.GetShape(0) == 1 ? 0 : n * k;
+    const scalar_t* a_ptr = static_cast<const scalar_t*>(a.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (batch_size > 1)
+#endif
+    for (int64_t b = 0; b < batch_size; ++b) {
+        if (n <= MAX_SMALL_MATRIX_DIM) {
+            SolveSmallMatrix(a_ptr + b * n * n, rhs_ptr + b * rhs_stride,
+                             dst_ptr + b * n * k, n, k);
+        } else {
+            Eigen::Map<const RowMajorMatrix<scalar_t>> a_mat(a_ptr + b * n * n,
+                                                             n, n);
+            Eigen::Map<const RowMajorMatrix<scalar_t>> rhs_mat(
+                    rhs_ptr + b * rhs_stride, n, k);
+            Eigen::Map<RowMajorMatrix<scalar_t>> dst_mat(dst_ptr + b * n * k,
+                                                         n, k);
+            dst_mat = a_mat.partialPivLu().solve(rhs_mat);
+        }
+    }
+}
+
+// Only Float32 and Float64 reach the kernels, see AssertLinearAlgebraOperands.
+void MatmulCPU(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    if (dst.GetDtype() == Dtype::Float32) {
+        CPUMatmul<float>(lhs, rhs, dst);
+    } else {
+        CPUMatmul<double>(lhs, rhs, dst);
+    }
+}
+
+void SolveCPU(const Tensor& a, const Tensor& rhs, Tensor& dst) {
+    if (dst.GetDtype() == Dtype::Float32) {
+        CPUSolve<float>(a, rhs, dst);
+    } else {
+        CPUSolve<double>(a, rhs, dst);
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
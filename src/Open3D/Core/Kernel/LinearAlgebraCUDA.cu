@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cublas_v2.h>
+
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+#include "Open3D/Core/CUDAState.cuh"
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+#include "Open3D/Core/Kernel/SmallMatrixSolver.h"
+
+namespace open3d {
+namespace kernel {
+
+static void CuBLASCheck(cublasStatus_t status, const char* file, int line) {
+    if (status != CUBLAS_STATUS_SUCCESS) {
+        utility::LogError("{}:{} cuBLAS error: {}", file, line,
+                          static_cast<int>(status));
+    }
+}
+
+#define OPEN3D_CUBLAS_CHECK(status) CuBLASCheck(status, __FILE__, __LINE__)
+
+/// Returns the cuBLAS handle of the current device, bound to the current
+/// stream. Handles are created on first use and never destroyed, since
+/// destroying them at exit can race with the CUDA runtime teardown.
+static cublasHandle_t GetCuBLASHandle() {
+    static std::mutex mutex;
+    static std::unordered_map<int, cublasHandle_t> handles;
+
+    int device_id;
+    OPEN3D_CUDA_CHECK(cudaGetDevice(&device_id));
+    cublasHandle_t handle;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = handles.find(device_id);
+        if (it == handles.end()) {
+            OPEN3D_CUBLAS_CHECK(cublasCreate(&handle));
+            handles[device_id] = handle;
+        } else {
+            handle = it->second;
+        }
+    }
+    OPEN3D_CUBLAS_CHECK(cublasSetStream(handle, cuda::GetCurrentStream()));
+    return handle;
+}
+
+// cuBLAS is column-major. A row-major (m, k) matrix is a column-major (k, m)
+// matrix, so the row-major product C = A B is computed as C^T = B^T A^T.
+static void CuBLASGemmStridedBatched(cublasHandle_t handle,
+                                     int m,
+                                     int n,
+                                     int k,
+                                     const float* lhs,
+                                     long long lhs_stride,
+                                     const float* rhs,
+                                     long long rhs_stride,
+                                     float* dst,
+                                     int batch_size) {
+    const float alpha = 1;
+    const float beta = 0;
+    OPEN3D_CUBLAS_CHECK(cublasSgemmStridedBatched(
+            handle, CUBLAS_OP_N, CUBLAS_OP_N, n, m, k, &alpha, rhs, n,
+            rhs_stride, lhs, k, lhs_stride, &beta, dst, n,
+            static_cast<long long>(m) * n, batch_size));
+}
+
+static void CuBLASGemmStridedBatched(cublasHandle_t handle,
+                                     int m,
+                                     int n,
+                                     int k,
+                                     const double* lhs,
+                                     long long lhs_stride,
+                                     const double* rhs,
+                                     long long rhs_stride,
+                                     double* dst,
+                                     int batch_size) {
+    const double alpha = 1;
+    const double beta = 0;
+    OPEN3D_CUBLAS_CHECK(cublasDgemmStridedBatched(
+            handle, CUBLAS_OP_N, CUBLAS_OP_N, n, m, k, &alpha, rhs, n,
+            rhs_stride, lhs, k, lhs_stride, &beta, dst, n,
+            static_cast<long long>(m) * n, batch_size));
+}
+
+template <typename scalar_t>
+static void CUDAMatmul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    const int64_t batch_size = dst.GetShape(0);
+    const int64_t m = lhs.GetShape(1);
+    const int64_t k = lhs.GetShape(2);
+    const int64_t n = rhs.GetShape(2);
+    const int64_t max_dim = std::numeric_limits<int>::max();
+    if (batch_size > max_dim || m > max_dim || n > max_dim || k > max_dim) {
+        utility::LogError("MatmulCUDA: dimensions exceed cuBLAS limits.");
+    }
+    CuBLASGemmStridedBatched(
+            GetCuBLASHandle(), static_cast<int>(m), static_cast<int>(n),
+            static_cast<int>(k),
+            static_cast<const scalar_t*>(lhs.GetDataPtr()),
+            lhs.GetShape(0) == 1 ? 0 : m * k,
+            static_cast<const scalar_t*>(rhs.GetDataPtr()),
+            rhs.GetShape(0) == 1 ? 0 : k * n,
+            static_cast<scalar_t*>(dst.GetDataPtr()),
+            static_cast<int>(batch_size));
+}
+
+template <typename scalar_t>
+static void CUDASolve(const Tensor& a, const Tensor& rhs, Tensor& dst) {
+    const int64_t batch_size = a.GetShape(0);
+    const int64_t n = a.GetShape(1);
+    const int64_t k = rhs.GetShape(2);
+    const int64_t rhs_stride = rhs.GetShape(0) == 1 ? 0 : n * k;
+    const scalar_t* a_ptr = static_cast<const scalar_t*>(a.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // One thread per system.
+    auto f = [=] OPEN3D_HOST_DEVICE(int64_t b) {
+        SolveSmallMatrix(a_ptr + b * n * n, rhs_ptr + b * rhs_stride,
+                         dst_ptr + b * n * k, n, k);
+    };
+    int64_t items_per_block = default_block_size * default_thread_size;
+    int64_t grid_size = (batch_size + items_per_block - 1) / items_per_block;
+    ElementWiseKernel<default_block_size, default_thread_size>
+            <<<grid_size, default_block_size, 0, cuda::GetCurrentStream()>>>(
+                    batch_size, f);
+    OPEN3D_GET_LAST_CUDA_ERROR("SolveCUDA failed.");
+}
+
+void MatmulCUDA(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    if (dst.GetDtype() == Dtype::Float32) {
+        CUDAMatmul<float>(lhs, rhs, dst);
+    } else {
+        CUDAMatmul<double>(lhs, rhs, dst);
+    }
+}
+
+void SolveCUDA(const Tensor& a, const Tensor& rhs, Tensor& dst) {
+    if (a.GetShape(1) > MAX_SMALL_MATRIX_DIM) {
+        utility::LogError(
+                "SolveCUDA supports matrices up to {}x{}, but got {}x{}.",
+                MAX_SMALL_MATRIX_DIM, MAX_SMALL_MATRIX_DIM, a.GetShape(1),
+                a.GetShape(1));
+    }
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    if (dst.GetDtype() == Dtype::Float32) {
+        CUDASolve<float>(a, rhs, dst);
+    } else {
+        CUDASolve<double>(a, rhs, dst);
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
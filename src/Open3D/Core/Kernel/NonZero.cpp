@@ -26,6 +26,8 @@
 
 #include "Open3D/Core/Kernel/NonZero.h"
 
+#include <algorithm>
+
 #include "Open3D/Core/Device.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
@@ -48,5 +50,40 @@ Tensor NonZero(const Tensor& src) {
     }
 }
 
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask) {
+    if (mask.GetDtype() != Dtype::Bool) {
+        utility::LogError(
+                "MaskedSelect: mask must be of dtype Bool, but got {}.",
+                DtypeUtil::ToString(mask.GetDtype()));
+    }
+    if (mask.GetDevice() != src.GetDevice()) {
+        utility::LogError(
+                "MaskedSelect: mask device {} does not match src device {}.",
+                mask.GetDevice().ToString(), src.GetDevice().ToString());
+    }
+    const SizeVector src_shape = src.GetShape();
+    const SizeVector mask_shape = mask.GetShape();
+    if (mask_shape.size() > src_shape.size() ||
+        !std::equal(mask_shape.begin(), mask_shape.end(), src_shape.begin())) {
+        utility::LogError(
+                "MaskedSelect: mask shape {} does not match the leading "
+                "dimensions of src shape {}.",
+                mask_shape, src_shape);
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return MaskedSelectCPU(src, mask);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return MaskedSelectCUDA(src, mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("MaskedSelect: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace open3d
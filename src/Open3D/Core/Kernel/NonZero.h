@@ -40,5 +40,17 @@ Tensor NonZeroCPU(const Tensor& src);
 Tensor NonZeroCUDA(const Tensor& src);
 #endif
 
+/// Selects the elements of \p src where the boolean \p mask is true, in a
+/// single compaction pass without materializing index tensors. The shape of
+/// \p mask must match the leading dimensions of \p src; the output has shape
+/// {num_true} + src.GetShape()[mask.NumDims():], like src[mask] in numpy.
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask);
+
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor MaskedSelectCUDA(const Tensor& src, const Tensor& mask);
+#endif
+
 }  // namespace kernel
 }  // namespace open3d
@@ -26,54 +26,129 @@
 
 #include "Open3D/Core/Kernel/NonZero.h"
 
-#include "Open3D/Core/Indexer.h"
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/CPULauncher.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
 
-Tensor NonZeroCPU(const Tensor& src) {
-    // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
-    const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
-                });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
+/// Stream compaction of the indices [0, n) for which is_selected(i) is true.
+/// Each chunk of indices is counted in parallel, an exclusive scan of the
+/// counts gives the output offset of every chunk, and the chunks are then
+/// scattered in parallel: write(i, output_idx) is called for the k-th selected
+/// index with output_idx = k. allocate(num_selected) is called in between to
+/// create the output. Both passes are bandwidth-bound and no index buffer of
+/// size n is materialized.
+template <typename select_func_t, typename allocate_func_t, typename write_t>
+static void CPUSelectIndices(int64_t n,
+                             const select_func_t& is_selected,
+                             const allocate_func_t& allocate,
+                             const write_t& write) {
+    const int64_t num_chunks = utility::detail::GetNumChunks(
+            0, n, CPULauncher::GRAIN_SIZE);
+    const int64_t chunk_size =
+            num_chunks > 0 ? (n + num_chunks - 1) / num_chunks : 0;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, n);
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            count += is_selected(i) ? 1 : 0;
+        }
+        offsets[chunk_idx + 1] = count;
     });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        offsets[chunk_idx + 1] += offsets[chunk_idx];
+    }
 
-    // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
-    const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
+    allocate(offsets[num_chunks]);
 
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, n);
+        int64_t output_idx = offsets[chunk_idx];
+        for (int64_t i = begin; i < end; ++i) {
+            if (is_selected(i)) {
+                write(i, output_idx++);
+            }
+        }
+    });
+}
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
+Tensor NonZeroCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    const SizeVector shape = src.GetShape();
+    const int64_t num_dims = src.NumDims();
+
+    Tensor result;
+    int64_t* result_ptr = nullptr;
+    int64_t num_non_zeros = 0;
+    auto allocate = [&](int64_t num_selected) {
+        num_non_zeros = num_selected;
+        result = Tensor({num_dims, num_non_zeros}, Dtype::Int64,
+                        src.GetDevice());
+        result_ptr = static_cast<int64_t*>(result.GetDataPtr());
+    };
+    // Transform flattend indices to indices in each dimension.
+    auto write = [&](int64_t non_zero_index, int64_t output_idx) {
         for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
+            result_ptr[dim * num_non_zeros + output_idx] =
+                    non_zero_index % shape[dim];
             non_zero_index = non_zero_index / shape[dim];
         }
-    }
+    };
 
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        CPUSelectIndices(
+                src.NumElements(),
+                [src_ptr](int64_t i) {
+                    return static_cast<float>(src_ptr[i]) != 0;
+                },
+                allocate, write);
+    });
     return result;
 }
 
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+    const bool* mask_ptr =
+            static_cast<const bool*>(mask_contiguous.GetDataPtr());
+    const char* src_ptr =
+            static_cast<const char*>(src_contiguous.GetDataPtr());
+
+    // Each selected mask element selects a contiguous row of src.
+    const SizeVector src_shape = src.GetShape();
+    const SizeVector row_shape(src_shape.begin() + mask.NumDims(),
+                               src_shape.end());
+    const int64_t row_byte_size =
+            row_shape.NumElements() * DtypeUtil::ByteSize(src.GetDtype());
+
+    Tensor dst;
+    char* dst_ptr = nullptr;
+    CPUSelectIndices(
+            mask.NumElements(), [mask_ptr](int64_t i) { return mask_ptr[i]; },
+            [&](int64_t num_selected) {
+                SizeVector dst_shape{num_selected};
+                dst_shape.insert(dst_shape.end(), row_shape.begin(),
+                                 row_shape.end());
+                dst = Tensor(dst_shape, src.GetDtype(), src.GetDevice());
+                dst_ptr = static_cast<char*>(dst.GetDataPtr());
+            },
+            [&](int64_t i, int64_t output_idx) {
+                std::memcpy(dst_ptr + output_idx * row_byte_size,
+                            src_ptr + i * row_byte_size, row_byte_size);
+            });
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace open3d
@@ -26,12 +26,15 @@
 
 #include "Open3D/Core/Kernel/NonZero.h"
 
-#include <thrust/device_vector.h>
+#include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
-#include <thrust/for_each.h>
-#include <thrust/iterator/zip_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
 
-#include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/MemoryManager.h"
 
 namespace open3d {
 namespace kernel {
@@ -39,81 +42,127 @@ namespace kernel {
 template <typename T>
 struct NonZeroFunctor {
     NonZeroFunctor() {}
-    __host__ __device__ bool operator()(T value) const {
-        return static_cast<float>(value) != 0.0;
+    __host__ __device__ int64_t operator()(T value) const {
+        return static_cast<float>(value) != 0.0 ? 1 : 0;
     }
 };
 
-struct FlatIndexTransformFunctor {
-    FlatIndexTransformFunctor(const TensorIterator& iter,
-                              int64_t num_non_zeros,
-                              int64_t num_dims,
-                              const SizeVector& shape)
-        : iter_(iter), num_non_zeros_(num_non_zeros), num_dims_(num_dims) {
-        for (size_t i = 0; i < shape.size(); ++i) {
-            shape_[i] = shape[i];
-        }
+struct BoolToInt64Functor {
+    __host__ __device__ int64_t operator()(bool value) const {
+        return value ? 1 : 0;
     }
+};
 
-    template <typename Tuple>
-    __host__ __device__ void operator()(Tuple t) {
-        int64_t i = (int64_t)thrust::get<0>(t);
-        int64_t non_zero_index = (int64_t)thrust::get<1>(t);
-
-        for (int64_t dim = num_dims_ - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(iter_.GetPtr(dim * num_non_zeros_ + i)) =
-                    non_zero_index % shape_[dim];
-            non_zero_index = non_zero_index / shape_[dim];
-        }
+/// Inclusive scan of the 0/1 selection flags into \p scan, such that the i-th
+/// element, if selected, goes to output index scan[i] - 1. Returns the number
+/// of selected elements, which is the only value copied back to the host.
+template <typename flag_iterator_t>
+static int64_t ScanSelectionFlags(flag_iterator_t flags_first,
+                                  int64_t n,
+                                  const Device& device,
+                                  Tensor& scan) {
+    scan = Tensor({n}, Dtype::Int64, device);
+    if (n == 0) {
+        return 0;
     }
-
-protected:
-    TensorIterator iter_;
-    int64_t num_non_zeros_;
-    int64_t num_dims_;
-    int64_t shape_[MAX_DIMS];
-};
+    int64_t* scan_ptr = static_cast<int64_t*>(scan.GetDataPtr());
+    thrust::inclusive_scan(thrust::cuda::par.on(cuda::GetCurrentStream()),
+                           flags_first, flags_first + n,
+                           thrust::device_ptr<int64_t>(scan_ptr));
+    int64_t num_selected = 0;
+    MemoryManager::MemcpyToHost(&num_selected, scan_ptr + n - 1, device,
+                                sizeof(int64_t));
+    return num_selected;
+}
 
 Tensor NonZeroCUDA(const Tensor& src) {
     Tensor src_contiguous = src.Contiguous();
     const int64_t num_elements = src_contiguous.NumElements();
-    const int64_t num_bytes =
-            num_elements * DtypeUtil::ByteSize(src_contiguous.GetDtype());
-
-    thrust::counting_iterator<int64_t> index_first(0);
-    thrust::counting_iterator<int64_t> index_last = index_first + num_elements;
+    const int64_t num_dims = src.NumDims();
+    const SizeVector shape = src.GetShape();
 
-    // Get flattened non-zero indices.
-    thrust::device_vector<int64_t> non_zero_indices(num_elements);
+    // Compact the flattened non-zero indices with a scan over the non-zero
+    // flags.
+    Tensor scan;
+    int64_t num_non_zeros = 0;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
-                src_contiguous.GetBlob()->GetDataPtr()));
-
-        auto it = thrust::copy_if(index_first, index_last, src_ptr,
-                                  non_zero_indices.begin(),
-                                  NonZeroFunctor<scalar_t>());
-        non_zero_indices.resize(thrust::distance(non_zero_indices.begin(), it));
+        thrust::device_ptr<const scalar_t> src_ptr(
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr()));
+        num_non_zeros = ScanSelectionFlags(
+                thrust::make_transform_iterator(src_ptr,
+                                                NonZeroFunctor<scalar_t>()),
+                num_elements, src.GetDevice(), scan);
     });
 
-    // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
-    const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
+    Tensor result({num_dims, num_non_zeros}, Dtype::Int64, src.GetDevice());
+    if (num_non_zeros == 0) {
+        return result;
+    }
 
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    // Transform flattend indices to indices in each dimension.
+    int64_t shape_arr[MAX_DIMS];
+    for (int64_t dim = 0; dim < num_dims; ++dim) {
+        shape_arr[dim] = shape[dim];
+    }
+    const int64_t* scan_ptr = static_cast<const int64_t*>(scan.GetDataPtr());
+    int64_t* result_ptr = static_cast<int64_t*>(result.GetDataPtr());
+    CUDALauncher::LaunchGeneralKernel(
+            num_elements, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                const int64_t prev = i > 0 ? scan_ptr[i - 1] : 0;
+                if (scan_ptr[i] == prev) {
+                    return;
+                }
+                int64_t non_zero_index = i;
+                for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
+                    result_ptr[dim * num_non_zeros + prev] =
+                            non_zero_index % shape_arr[dim];
+                    non_zero_index = non_zero_index / shape_arr[dim];
+                }
+            });
+    return result;
+}
 
-    index_last = index_first + num_non_zeros;
-    thrust::for_each(thrust::device,
-                     thrust::make_zip_iterator(thrust::make_tuple(
-                             index_first, non_zero_indices.begin())),
-                     thrust::make_zip_iterator(thrust::make_tuple(
-                             index_last, non_zero_indices.end())),
-                     FlatIndexTransformFunctor(result_iter, num_non_zeros,
-                                               num_dims, shape));
+Tensor MaskedSelectCUDA(const Tensor& src, const Tensor& mask) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+    const int64_t num_rows = mask.NumElements();
+
+    thrust::device_ptr<const bool> mask_ptr(
+            static_cast<const bool*>(mask_contiguous.GetDataPtr()));
+    Tensor scan;
+    const int64_t num_selected = ScanSelectionFlags(
+            thrust::make_transform_iterator(mask_ptr, BoolToInt64Functor()),
+            num_rows, src.GetDevice(), scan);
+
+    const SizeVector src_shape = src.GetShape();
+    const SizeVector row_shape(src_shape.begin() + mask.NumDims(),
+                               src_shape.end());
+    SizeVector dst_shape{num_selected};
+    dst_shape.insert(dst_shape.end(), row_shape.begin(), row_shape.end());
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    if (num_selected == 0) {
+        return dst;
+    }
 
-    return result;
+    // One thread per source element, such that copies of consecutive
+    // elements are coalesced for short rows, e.g. points.
+    const int64_t row_size = row_shape.NumElements();
+    const int64_t* scan_ptr = static_cast<const int64_t*>(scan.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        CUDALauncher::LaunchGeneralKernel(
+                num_rows * row_size, [=] OPEN3D_HOST_DEVICE(int64_t idx) {
+                    const int64_t row = idx / row_size;
+                    const int64_t prev = row > 0 ? scan_ptr[row - 1] : 0;
+                    if (scan_ptr[row] != prev) {
+                        dst_ptr[prev * row_size + idx % row_size] =
+                                src_ptr[idx];
+                    }
+                });
+    });
+    return dst;
 }
 
 }  // namespace kernel
@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Side length of the square tiles of the permuted copy kernels, in elements.
+static constexpr int64_t PERMUTE_COPY_TILE_SIZE = 32;
+
+/// \struct PermuteCopyPlan
+///
+/// Layout of a copy between two tensors of the same shape whose innermost
+/// dimensions differ, e.g. Contiguous() after Permute() or T(), or HWC <-> CHW
+/// image conversions. Copying such tensors element by element in dst order
+/// reads src with a large stride and touches a new cache line per element.
+/// The permuted copy kernels instead copy square tiles, such that both src
+/// and dst are accessed along their innermost dimension.
+///
+/// The copy is described as dst[b, r, c] = src[b, r, c] for every batch b,
+/// row r and column c, where the rows are the innermost dimension of src and
+/// the columns the innermost dimension of dst. Strides are in elements.
+struct PermuteCopyPlan {
+    int64_t batch_size_ = 1;
+    int64_t num_rows_ = 1;
+    int64_t num_cols_ = 1;
+    int64_t src_batch_stride_ = 0;
+    int64_t src_row_stride_ = 0;
+    int64_t src_col_stride_ = 0;
+    int64_t dst_batch_stride_ = 0;
+    int64_t dst_row_stride_ = 0;
+    int64_t dst_col_stride_ = 0;
+
+    OPEN3D_HOST_DEVICE int64_t NumRowTiles() const {
+        return (num_rows_ + PERMUTE_COPY_TILE_SIZE - 1) /
+               PERMUTE_COPY_TILE_SIZE;
+    }
+
+    OPEN3D_HOST_DEVICE int64_t NumColTiles() const {
+        return (num_cols_ + PERMUTE_COPY_TILE_SIZE - 1) /
+               PERMUTE_COPY_TILE_SIZE;
+    }
+
+    OPEN3D_HOST_DEVICE int64_t NumTiles() const {
+        return batch_size_ * NumRowTiles() * NumColTiles();
+    }
+};
+
+/// Returns true and fills \p plan if copying \p src to \p dst is a 2D or 3D
+/// permutation that the permuted copy kernels handle, i.e. if src and dst
+/// have the same shape and positive strides and, once size-1 dimensions are
+/// dropped and the dimensions that are contiguous in both tensors are
+/// merged, 2 or 3 dimensions remain and the innermost dimensions of src and
+/// dst differ.
+inline bool GetPermuteCopyPlan(const Tensor& src,
+                               const Tensor& dst,
+                               PermuteCopyPlan& plan) {
+    const SizeVector& shape = src.GetShapeRef();
+    const SizeVector& src_tensor_strides = src.GetStridesRef();
+    const SizeVector& dst_tensor_strides = dst.GetStridesRef();
+    if (shape != dst.GetShapeRef() || shape.size() < 2) {
+        return false;
+    }
+
+    // Drop size-1 dimensions and merge dimension i into i + 1 if both
+    // tensors are contiguous across them.
+    int64_t sizes[MAX_DIMS];
+    int64_t src_strides[MAX_DIMS];
+    int64_t dst_strides[MAX_DIMS];
+    int64_t ndims = 0;
+    for (int64_t i = shape.size() - 1; i >= 0; --i) {
+        if (shape[i] == 0) {
+            return false;
+        }
+        if (shape[i] == 1) {
+            continue;
+        }
+        const int64_t src_stride = src_tensor_strides[i];
+        const int64_t dst_stride = dst_tensor_strides[i];
+        if (src_stride <= 0 || dst_stride <= 0) {
+            return false;
+        }
+        if (ndims > 0 &&
+            src_stride == src_strides[ndims - 1] * sizes[ndims - 1] &&
+            dst_stride == dst_strides[ndims - 1] * sizes[ndims - 1]) {
+            sizes[ndims - 1] *= shape[i];
+            continue;
+        }
+        if (ndims == 3) {
+            return false;
+        }
+        sizes[ndims] = shape[i];
+        src_strides[ndims] = src_stride;
+        dst_strides[ndims] = dst_stride;
+        ndims++;
+    }
+    if (ndims < 2) {
+        return false;
+    }
+
+    const int64_t row_dim =
+            std::min_element(src_strides, src_strides + ndims) - src_strides;
+    const int64_t col_dim =
+            std::min_element(dst_strides, dst_strides + ndims) - dst_strides;
+    if (row_dim == col_dim) {
+        return false;
+    }
+    plan.num_rows_ = sizes[row_dim];
+    plan.src_row_stride_ = src_strides[row_dim];
+    plan.dst_row_stride_ = dst_strides[row_dim];
+    plan.num_cols_ = sizes[col_dim];
+    plan.src_col_stride_ = src_strides[col_dim];
+    plan.dst_col_stride_ = dst_strides[col_dim];
+    if (ndims == 3) {
+        const int64_t batch_dim = 3 - row_dim - col_dim;
+        plan.batch_size_ = sizes[batch_dim];
+        plan.src_batch_stride_ = src_strides[batch_dim];
+        plan.dst_batch_stride_ = dst_strides[batch_dim];
+    } else {
+        plan.batch_size_ = 1;
+        plan.src_batch_stride_ = 0;
+        plan.dst_batch_stride_ = 0;
+    }
+    return true;
+}
+
+}  // namespace kernel
+}  // namespace open3d
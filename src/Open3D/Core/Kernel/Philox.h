@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Philox4x32-10 counter-based random number generator, see
+/// Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011.
+///
+/// The output is a bijective function of a 128 bit counter keyed by a 64 bit
+/// seed, so element i of a random tensor is generated from the counter i with
+/// no state shared between threads. This gives the same values on CPU and
+/// CUDA, for any number of threads.
+class Philox4x32 {
+public:
+    struct Result {
+        uint32_t x[4];
+    };
+
+    /// Returns the 4 random words for \p counter under \p seed.
+    static OPEN3D_HOST_DEVICE Result Generate(uint64_t seed,
+                                              uint64_t counter_lo,
+                                              uint64_t counter_hi = 0) {
+        uint32_t c[4] = {static_cast<uint32_t>(counter_lo),
+                         static_cast<uint32_t>(counter_lo >> 32),
+                         static_cast<uint32_t>(counter_hi),
+                         static_cast<uint32_t>(counter_hi >> 32)};
+        uint32_t k[2] = {static_cast<uint32_t>(seed),
+                         static_cast<uint32_t>(seed >> 32)};
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                k[0] += kWeyl0;
+                k[1] += kWeyl1;
+            }
+            const uint64_t p0 = static_cast<uint64_t>(kMul0) * c[0];
+            const uint64_t p1 = static_cast<uint64_t>(kMul1) * c[2];
+            const uint32_t c1 = c[1];
+            const uint32_t c3 = c[3];
+            c[0] = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k[0];
+            c[1] = static_cast<uint32_t>(p1);
+            c[2] = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k[1];
+            c[3] = static_cast<uint32_t>(p0);
+        }
+        Result result;
+        for (int i = 0; i < 4; ++i) {
+            result.x[i] = c[i];
+        }
+        return result;
+    }
+
+    /// Returns 64 random bits for element \p idx.
+    static OPEN3D_HOST_DEVICE uint64_t Uint64(uint64_t seed, uint64_t idx) {
+        const Result r = Generate(seed, idx);
+        return (static_cast<uint64_t>(r.x[1]) << 32) | r.x[0];
+    }
+
+    /// Returns a uniform double in [0, 1) with 53 random bits for element
+    /// \p idx.
+    static OPEN3D_HOST_DEVICE double UniformDouble(uint64_t seed,
+                                                   uint64_t idx) {
+        return static_cast<double>(Uint64(seed, idx) >> 11) *
+               (1.0 / 9007199254740992.0);
+    }
+
+    /// Returns a uniform float in [0, 1) with 24 random bits for element
+    /// \p idx.
+    static OPEN3D_HOST_DEVICE float UniformFloat(uint64_t seed, uint64_t idx) {
+        return static_cast<float>(Generate(seed, idx).x[0] >> 8) *
+               (1.0f / 16777216.0f);
+    }
+
+private:
+    static constexpr uint32_t kMul0 = 0xD2511F53;
+    static constexpr uint32_t kMul1 = 0xCD9E8D57;
+    static constexpr uint32_t kWeyl0 = 0x9E3779B9;
+    static constexpr uint32_t kWeyl1 = 0xBB67AE85;
+};
+
+}  // namespace kernel
+}  // namespace open3d
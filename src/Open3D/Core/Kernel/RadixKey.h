@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Half.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Maps the values of scalar_t to unsigned integers of type key_t, such that
+/// the unsigned order of the keys is the ascending order of the values. This
+/// lets the radix sorts of all dtypes work on the bits of the keys.
+///
+/// Signed integers flip their sign bit. Floats flip their sign bit if they are
+/// positive and all bits if they are negative, so -0.0 sorts before 0.0 and
+/// NaNs with the sign bit cleared sort last. Float16 is sorted on the keys of
+/// its float conversion.
+template <typename scalar_t, typename = void>
+struct RadixKey {
+    // Bool and unsigned integers.
+    using key_t = typename std::conditional<sizeof(scalar_t) <= 4,
+                                            uint32_t,
+                                            uint64_t>::type;
+    static OPEN3D_HOST_DEVICE key_t Get(scalar_t value) {
+        return static_cast<key_t>(value);
+    }
+};
+
+template <typename scalar_t>
+struct RadixKey<
+        scalar_t,
+        typename std::enable_if<std::is_integral<scalar_t>::value &&
+                                std::is_signed<scalar_t>::value>::type> {
+    using key_t = typename std::conditional<sizeof(scalar_t) <= 4,
+                                            uint32_t,
+                                            uint64_t>::type;
+    static OPEN3D_HOST_DEVICE key_t Get(scalar_t value) {
+        return static_cast<key_t>(value) ^
+               (static_cast<key_t>(1) << (sizeof(key_t) * 8 - 1));
+    }
+};
+
+template <typename scalar_t>
+struct RadixKey<scalar_t,
+                typename std::enable_if<
+                        std::is_floating_point<scalar_t>::value>::type> {
+    using key_t = typename std::conditional<sizeof(scalar_t) == 4,
+                                            uint32_t,
+                                            uint64_t>::type;
+    static OPEN3D_HOST_DEVICE key_t Get(scalar_t value) {
+        key_t bits;
+        memcpy(&bits, &value, sizeof(key_t));
+        const key_t sign_bit = static_cast<key_t>(1)
+                               << (sizeof(key_t) * 8 - 1);
+        return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    }
+};
+
+template <>
+struct RadixKey<Half> {
+    using key_t = uint32_t;
+    static OPEN3D_HOST_DEVICE key_t Get(Half value) {
+        return RadixKey<float>::Get(static_cast<float>(value));
+    }
+};
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Random.h"
+
+#include <cstdint>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void RandUniform(Tensor& dst, double low, double high, uint64_t seed) {
+    if (dst.GetDtype() != Dtype::Float32 && dst.GetDtype() != Dtype::Float64) {
+        utility::LogError(
+                "RandUniform: Only Float32 and Float64 are supported, but got "
+                "{}.",
+                DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (!dst.IsContiguous()) {
+        utility::LogError("RandUniform: dst must be contiguous.");
+    }
+    if (!(low < high)) {
+        utility::LogError("RandUniform: low ({}) must be less than high ({}).",
+                          low, high);
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        RandUniformCPU(dst, low, high, seed);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RandUniformCUDA(dst, low, high, seed);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("RandUniform: Unimplemented device");
+    }
+}
+
+void RandInt(Tensor& dst, int64_t low, int64_t high, uint64_t seed) {
+    const Dtype dtype = dst.GetDtype();
+    if (DtypeUtil::IsFloat(dtype) || dtype == Dtype::Bool) {
+        utility::LogError(
+                "RandInt: Only integer dtypes are supported, but got {}.",
+                DtypeUtil::ToString(dtype));
+    }
+    if (!dst.IsContiguous()) {
+        utility::LogError("RandInt: dst must be contiguous.");
+    }
+    if (low >= high) {
+        utility::LogError("RandInt: low ({}) must be less than high ({}).",
+                          low, high);
+    }
+    int64_t dtype_min = 0;
+    int64_t dtype_max = 0;
+    switch (dtype) {
+        case Dtype::Int32:
+            dtype_min = INT32_MIN;
+            dtype_max = INT32_MAX;
+            break;
+        case Dtype::UInt8:
+            dtype_max = UINT8_MAX;
+            break;
+        case Dtype::UInt16:
+            dtype_max = UINT16_MAX;
+            break;
+        default:
+            dtype_min = INT64_MIN;
+            dtype_max = INT64_MAX;
+    }
+    if (low < dtype_min || high - 1 > dtype_max) {
+        utility::LogError("RandInt: [{}, {}) does not fit in {}.", low, high,
+                          DtypeUtil::ToString(dtype));
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        RandIntCPU(dst, low, high, seed);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RandIntCUDA(dst, low, high, seed);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("RandInt: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Fills \p dst with uniform values in [low, high), generated with Philox4x32
+/// from \p seed and the linear index of each element. \p dst must be
+/// contiguous and of dtype Float32 or Float64.
+void RandUniform(Tensor& dst, double low, double high, uint64_t seed);
+
+void RandUniformCPU(Tensor& dst, double low, double high, uint64_t seed);
+
+#ifdef BUILD_CUDA_MODULE
+void RandUniformCUDA(Tensor& dst, double low, double high, uint64_t seed);
+#endif
+
+/// Fills \p dst with uniform integers in [low, high), generated with
+/// Philox4x32 from \p seed and the linear index of each element. \p dst must
+/// be contiguous and of an integer dtype that can hold [low, high).
+void RandInt(Tensor& dst, int64_t low, int64_t high, uint64_t seed);
+
+void RandIntCPU(Tensor& dst, int64_t low, int64_t high, uint64_t seed);
+
+#ifdef BUILD_CUDA_MODULE
+void RandIntCUDA(Tensor& dst, int64_t low, int64_t high, uint64_t seed);
+#endif
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Random.h"
+
+#include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/Kernel/Philox.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace kernel {
+
+void RandUniformCPU(Tensor& dst, double low, double high, uint64_t seed) {
+    const int64_t n = dst.NumElements();
+    const double scale = high - low;
+    if (dst.GetDtype() == Dtype::Float32) {
+        float* dst_ptr = static_cast<float*>(dst.GetDataPtr());
+        const float low_f = static_cast<float>(low);
+        const float scale_f = static_cast<float>(scale);
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t i) {
+                    dst_ptr[i] = low_f + scale_f * Philox4x32::UniformFloat(
+                                                           seed, i);
+                },
+                CPULauncher::GRAIN_SIZE);
+    } else {
+        double* dst_ptr = static_cast<double*>(dst.GetDataPtr());
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t i) {
+                    dst_ptr[i] =
+                            low + scale * Philox4x32::UniformDouble(seed, i);
+                },
+                CPULauncher::GRAIN_SIZE);
+    }
+}
+
+template <typename scalar_t>
+static void LaunchRandIntKernel(Tensor& dst,
+                                int64_t low,
+                                int64_t high,
+                                uint64_t seed) {
+    const int64_t n = dst.NumElements();
+    // The modulo bias is below range / 2^64, negligible for any practical
+    // range.
+    const uint64_t range =
+            static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    utility::ParallelFor(
+            0, n,
+            [&](int64_t i) {
+                dst_ptr[i] = static_cast<scalar_t>(static_cast<int64_t>(
+                        static_cast<uint64_t>(low) +
+                        Philox4x32::Uint64(seed, i) % range));
+            },
+            CPULauncher::GRAIN_SIZE);
+}
+
+void RandIntCPU(Tensor& dst, int64_t low, int64_t high, uint64_t seed) {
+    switch (dst.GetDtype()) {
+        case Dtype::Int32:
+            LaunchRandIntKernel<int32_t>(dst, low, high, seed);
+            break;
+        case Dtype::Int64:
+            LaunchRandIntKernel<int64_t>(dst, low, high, seed);
+            break;
+        case Dtype::UInt8:
+            LaunchRandIntKernel<uint8_t>(dst, low, high, seed);
+            break;
+        case Dtype::UInt16:
+            LaunchRandIntKernel<uint16_t>(dst, low, high, seed);
+            break;
+        default:
+            utility::LogError("RandIntCPU: Unsupported dtype {}.",
+                              DtypeUtil::ToString(dst.GetDtype()));
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
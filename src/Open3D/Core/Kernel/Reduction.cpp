@@ -25,11 +25,73 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Core/Kernel/Reduction.h"
+
+#include <limits>
+
 #include "Open3D/Core/SizeVector.h"
 
 namespace open3d {
 namespace kernel {
 
+static void ReductionOnDevice(const Tensor& src,
+                              Tensor& dst,
+                              const SizeVector& dims,
+                              bool keepdim,
+                              ReductionOpCode op_code) {
+    if (src.GetDevice() != dst.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ReductionCPU(src, dst, dims, keepdim, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ReductionCUDA(src, dst, dims, keepdim, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+/// Reduces into a dst of shape (*keepdim_shape, NUM_MULTI_REDUCTION_OUTPUTS),
+/// or the same shape without the reduced dims.
+static void ReductionMultiOutput(const Tensor& src,
+                                 Tensor& dst,
+                                 const SizeVector& dims,
+                                 const SizeVector& keepdim_shape,
+                                 ReductionOpCode op_code) {
+    if (src.NumElements() == 0) {
+        if (op_code == ReductionOpCode::MeanVar) {
+            dst.Fill(std::numeric_limits<double>::quiet_NaN());
+            return;
+        }
+        utility::LogError("Zero-size Tensor does not suport MinMax.");
+    }
+
+    SizeVector packed_shape = keepdim_shape;
+    packed_shape.push_back(NUM_MULTI_REDUCTION_OUTPUTS);
+    Tensor packed = dst.View(packed_shape);
+    Tensor first_values = packed.IndexExtract(packed.NumDims() - 1, 0);
+
+    // Non-reduction: every output element has exactly one input value.
+    if (dims.size() == 0) {
+        first_values.AsRvalue() = src;
+        Tensor second_values = packed.IndexExtract(packed.NumDims() - 1, 1);
+        if (op_code == ReductionOpCode::MinMax) {
+            second_values.AsRvalue() = src;
+        } else {
+            second_values.Fill(0);
+        }
+        return;
+    }
+    ReductionOnDevice(src, first_values, dims, true, op_code);
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
@@ -56,17 +118,39 @@ void Reduction(const Tensor& src,
         }
     }
 
+    // Multi-output reductions store their values along an extra last
+    // dimension, which is excluded from the shape checks.
+    bool is_multi_output = multi_output_reduce_ops.find(op_code) !=
+                           multi_output_reduce_ops.end();
+    SizeVector dst_shape = dst.GetShape();
+    if (is_multi_output) {
+        if (dst_shape.size() == 0 ||
+            dst_shape.back() != NUM_MULTI_REDUCTION_OUTPUTS ||
+            !dst.IsContiguous()) {
+            utility::LogError(
+                    "Multi-output reduction expects a contiguous output with "
+                    "last dimension {}, but got shape {}.",
+                    NUM_MULTI_REDUCTION_OUTPUTS, dst_shape);
+        }
+        dst_shape.pop_back();
+    }
+
     SizeVector keepdim_shape =
             shape_util::ReductionShape(src.GetShape(), dims, true);
     SizeVector non_keepdim_shape =
             shape_util::ReductionShape(src.GetShape(), dims, false);
-    if (keepdim && keepdim_shape != dst.GetShape()) {
+    if (keepdim && keepdim_shape != dst_shape) {
         utility::LogError("Expected output shape {} but got {}.",
-                          keepdim_shape.ToString(), dst.GetShape().ToString());
+                          keepdim_shape.ToString(), dst_shape.ToString());
     }
-    if (!keepdim && non_keepdim_shape != dst.GetShape()) {
+    if (!keepdim && non_keepdim_shape != dst_shape) {
         utility::LogError("Expected output shape {} but got {}.",
-                          keepdim_shape.ToString(), dst.GetShape().ToString());
+                          keepdim_shape.ToString(), dst_shape.ToString());
+    }
+
+    if (is_multi_output) {
+        ReductionMultiOutput(src, dst, dims, keepdim_shape, op_code);
+        return;
     }
 
     // Directly copy for non-reduction.
@@ -80,24 +164,7 @@ void Reduction(const Tensor& src,
         dst = dst.Reshape(keepdim_shape);
     }
 
-    if (src.GetDevice() != dst.GetDevice()) {
-        utility::LogError("Device mismatch {} != {}.",
-                          src.GetDevice().ToString(),
-                          dst.GetDevice().ToString());
-    }
-
-    Device::DeviceType device_type = src.GetDevice().GetType();
-    if (device_type == Device::DeviceType::CPU) {
-        ReductionCPU(src, dst, dims, keepdim, op_code);
-    } else if (device_type == Device::DeviceType::CUDA) {
-#ifdef BUILD_CUDA_MODULE
-        ReductionCUDA(src, dst, dims, keepdim, op_code);
-#else
-        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
-#endif
-    } else {
-        utility::LogError("Unimplemented device.");
-    }
+    ReductionOnDevice(src, dst, dims, keepdim, op_code);
 
     if (!keepdim) {
         dst = dst.Reshape(non_keepdim_shape);
@@ -36,20 +36,41 @@
 namespace open3d {
 namespace kernel {
 
-enum class ReductionOpCode { Sum, Prod, Min, Max, ArgMin, ArgMax };
+enum class ReductionOpCode {
+    Sum,
+    Prod,
+    Min,
+    Max,
+    ArgMin,
+    ArgMax,
+    MinMax,
+    MeanVar,
+};
 
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
         regular_reduce_ops = {ReductionOpCode::Sum, ReductionOpCode::Prod,
                               ReductionOpCode::Min, ReductionOpCode::Max};
 static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
         arg_reduce_ops = {ReductionOpCode::ArgMin, ReductionOpCode::ArgMax};
+/// Multi-output reductions compute NUM_MULTI_REDUCTION_OUTPUTS values per
+/// output element in a single pass over the input: (min, max) for MinMax and
+/// (mean, population variance) for MeanVar. The values are stored along an
+/// extra last dimension of dst.
+static const std::unordered_set<ReductionOpCode, utility::hash_enum_class::hash>
+        multi_output_reduce_ops = {ReductionOpCode::MinMax,
+                                   ReductionOpCode::MeanVar};
+static constexpr int64_t NUM_MULTI_REDUCTION_OUTPUTS = 2;
 
+/// For multi-output ops, dst has the reduction shape with an extra last
+/// dimension of size NUM_MULTI_REDUCTION_OUTPUTS and must be contiguous.
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code);
 
+/// For multi-output ops, dst is a view of the first value of each output
+/// element; the remaining values directly follow it in memory.
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
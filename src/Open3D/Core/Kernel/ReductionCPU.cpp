@@ -30,9 +30,11 @@
 
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Indexer.h"
+#include "Open3D/Core/Kernel/CPULauncher.h"
 #include "Open3D/Core/ParallelUtil.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
@@ -77,6 +79,73 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Fused (min, max) reduction.
+template <typename scalar_t>
+struct CPUMinMaxReductionOps {
+    using acc_t = std::pair<scalar_t, scalar_t>;
+
+    static acc_t Identity() {
+        return {std::numeric_limits<scalar_t>::max(),
+                std::numeric_limits<scalar_t>::lowest()};
+    }
+
+    static acc_t Reduce(const acc_t& acc, scalar_t val) {
+        return {std::min(acc.first, val), std::max(acc.second, val)};
+    }
+
+    static acc_t Combine(const acc_t& a, const acc_t& b) {
+        return {std::min(a.first, b.first), std::max(a.second, b.second)};
+    }
+
+    static void Project(const acc_t& acc, scalar_t* dst) {
+        dst[0] = acc.first;
+        dst[1] = acc.second;
+    }
+};
+
+/// Fused (mean, population variance) reduction with Welford's online
+/// algorithm, accumulated in double precision. Partial results are merged
+/// with Chan et al.'s pairwise update.
+template <typename scalar_t>
+struct CPUMeanVarReductionOps {
+    struct acc_t {
+        double mean = 0;
+        double m2 = 0;
+        int64_t count = 0;
+    };
+
+    static acc_t Identity() { return acc_t(); }
+
+    static acc_t Reduce(acc_t acc, scalar_t val) {
+        double delta = static_cast<double>(val) - acc.mean;
+        acc.count++;
+        acc.mean += delta / acc.count;
+        acc.m2 += delta * (static_cast<double>(val) - acc.mean);
+        return acc;
+    }
+
+    static acc_t Combine(const acc_t& a, const acc_t& b) {
+        if (a.count == 0) {
+            return b;
+        }
+        if (b.count == 0) {
+            return a;
+        }
+        acc_t acc;
+        acc.count = a.count + b.count;
+        double delta = b.mean - a.mean;
+        double b_ratio = static_cast<double>(b.count) / acc.count;
+        acc.mean = a.mean + delta * b_ratio;
+        acc.m2 = a.m2 + b.m2 + delta * delta * a.count * b_ratio;
+        return acc;
+    }
+
+    static void Project(const acc_t& acc, scalar_t* dst) {
+        dst[0] = static_cast<scalar_t>(acc.mean);
+        dst[1] = static_cast<scalar_t>(acc.m2 / acc.count);
+    }
+};
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -129,20 +198,20 @@ private:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
-            }
-        }
+        utility::ParallelFor(
+                0, num_threads,
+                [&](int64_t thread_idx) {
+                    int64_t start = thread_idx * workload_per_thread;
+                    int64_t end = std::min(start + workload_per_thread,
+                                           num_workloads);
+                    for (int64_t workload_idx = start; workload_idx < end;
+                         ++workload_idx) {
+                        scalar_t* src = reinterpret_cast<scalar_t*>(
+                                indexer.GetInputPtr(0, workload_idx));
+                        thread_results[thread_idx] = element_kernel(
+                                *src, thread_results[thread_idx]);
+                    }
+                });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             *dst = element_kernel(thread_results[thread_idx], *dst);
@@ -177,14 +246,14 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        utility::ParallelFor(
+                0, indexer_shape[best_dim],
+                [&](int64_t i) {
+                    Indexer sub_indexer(indexer);
+                    sub_indexer.ShrinkDim(best_dim, i, 1);
+                    LaunchReductionKernelSerial<scalar_t>(sub_indexer,
+                                                          element_kernel);
+                });
     }
 
 private:
@@ -208,24 +277,82 @@ public:
         int64_t ipo =
                 num_input_elements / num_output_elements;  // Inputs per output
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+        utility::ParallelFor(
+                0, num_output_elements,
+                [&](int64_t output_idx) {
+                    // sub_indexer.NumWorkloads() == ipo.
+                    // sub_indexer's workload_idx is indexer_'s ipo_idx.
+                    Indexer sub_indexer =
+                            indexer_.GetPerOutputIndexer(output_idx);
+                    scalar_t dst_val = identity;
+                    for (int64_t workload_idx = 0;
+                         workload_idx < sub_indexer.NumWorkloads();
+                         workload_idx++) {
+                        int64_t src_idx = workload_idx;
+                        scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                                sub_indexer.GetInputPtr(0, workload_idx));
+                        int64_t* dst_idx = reinterpret_cast<int64_t*>(
+                                sub_indexer.GetOutputPtr(0, workload_idx));
+                        std::tie(*dst_idx, dst_val) = reduce_func(
+                                src_idx, *src_val, *dst_idx, dst_val);
+                    }
+                });
+    }
+
+private:
+    Indexer indexer_;
+};
+
+/// Reduces each output element into an accumulator of ops_t::acc_t, which
+/// ops_t::Project writes as NUM_MULTI_REDUCTION_OUTPUTS consecutive values
+/// starting at the output element.
+class CPUMultiOutputReductionEngine {
+public:
+    CPUMultiOutputReductionEngine(const CPUMultiOutputReductionEngine&) =
+            delete;
+    CPUMultiOutputReductionEngine& operator=(
+            const CPUMultiOutputReductionEngine&) = delete;
+    CPUMultiOutputReductionEngine(const Indexer& indexer)
+        : indexer_(indexer) {}
+
+    template <typename scalar_t, typename ops_t>
+    void Run() {
+        using acc_t = typename ops_t::acc_t;
+        auto reduce_range = [](const Indexer& sub_indexer, int64_t begin,
+                               int64_t end, acc_t acc) {
+            for (int64_t workload_idx = begin; workload_idx < end;
+                 ++workload_idx) {
+                acc = ops_t::Reduce(acc, *reinterpret_cast<scalar_t*>(
+                                                 sub_indexer.GetInputPtr(
+                                                         0, workload_idx)));
+            }
+            return acc;
+        };
+
+        int64_t num_output_elements = indexer_.NumOutputElements();
+        if (num_output_elements >= parallel_util::GetMaxThreads()) {
+            // Enough outputs to keep all threads busy.
+            utility::ParallelFor(0, num_output_elements, [&](int64_t i) {
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(i);
+                acc_t acc = reduce_range(sub_indexer, 0,
+                                         sub_indexer.NumWorkloads(),
+                                         ops_t::Identity());
+                ops_t::Project(acc, reinterpret_cast<scalar_t*>(
+                                            sub_indexer.GetOutputPtr(0, 0)));
+            });
+        } else {
+            // Split the inputs of each output among the threads.
+            for (int64_t i = 0; i < num_output_elements; ++i) {
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(i);
+                acc_t acc = utility::ParallelReduce(
+                        0, sub_indexer.NumWorkloads(), ops_t::Identity(),
+                        [&](int64_t begin, int64_t end, acc_t partial) {
+                            return reduce_range(sub_indexer, begin, end,
+                                                partial);
+                        },
+                        ops_t::Combine, CPULauncher::GRAIN_SIZE);
+                ops_t::Project(acc, reinterpret_cast<scalar_t*>(
+                                            sub_indexer.GetOutputPtr(0, 0)));
             }
         }
     }
@@ -320,6 +447,23 @@ void ReductionCPU(const Tensor& src,
                     break;
             }
         });
+    } else if (multi_output_reduce_ops.find(op_code) !=
+               multi_output_reduce_ops.end()) {
+        Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
+        CPUMultiOutputReductionEngine re(indexer);
+        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            switch (op_code) {
+                case ReductionOpCode::MinMax:
+                    re.Run<scalar_t, CPUMinMaxReductionOps<scalar_t>>();
+                    break;
+                case ReductionOpCode::MeanVar:
+                    re.Run<scalar_t, CPUMeanVarReductionOps<scalar_t>>();
+                    break;
+                default:
+                    utility::LogError("Unsupported op code.");
+                    break;
+            }
+        });
     } else {
         utility::LogError("Unsupported op code.");
     }
@@ -38,6 +38,7 @@
 #include <type_traits>
 
 #include "Open3D/Core/CUDAState.cuh"
+#include "Open3D/Core/CUDAStream.h"
 #include "Open3D/Core/CUDAUtils.h"
 #include "Open3D/Core/Device.h"
 #include "Open3D/Core/Dispatch.h"
@@ -87,6 +88,17 @@ OPEN3D_DEVICE __forceinline__ T WARP_SHFL_DOWN(T value,
 #endif
 }
 
+// Half has no shuffle intrinsic of its own, so its bits are shuffled as int.
+OPEN3D_DEVICE __forceinline__ open3d::Half WARP_SHFL_DOWN(
+        open3d::Half value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    int bits = static_cast<int>(value.bits_);
+    return open3d::Half::FromBits(
+            static_cast<uint16_t>(WARP_SHFL_DOWN(bits, delta, width, mask)));
+}
+
 namespace open3d {
 namespace kernel {
 
@@ -485,6 +497,110 @@ ArgReduceOps<func_t> WrapArgReduceOps(const func_t& comp_func) {
     return ArgReduceOps<func_t>{comp_func};
 }
 
+/// Output of MinMaxReduceOps, stored as two consecutive values.
+template <typename scalar_t>
+struct MinMaxPair {
+    scalar_t min_;
+    scalar_t max_;
+};
+
+/// Fused (min, max) reduction. Combine() and Reduce() take the same packed
+/// accumulator, so it can also be accumulated in the output.
+template <typename scalar_t>
+class MinMaxReduceOps {
+    using arg_t = MinMaxPair<scalar_t>;
+
+public:
+    static OPEN3D_DEVICE arg_t Project(arg_t arg) { return arg; }
+
+    static OPEN3D_DEVICE arg_t WarpShflDown(arg_t arg, int offset) {
+        return {WARP_SHFL_DOWN(arg.min_, offset),
+                WARP_SHFL_DOWN(arg.max_, offset)};
+    }
+
+    OPEN3D_DEVICE inline arg_t Combine(arg_t a, arg_t b) const {
+        return {a.min_ < b.min_ ? a.min_ : b.min_,
+                a.max_ > b.max_ ? a.max_ : b.max_};
+    }
+
+    /// Idx is ignored for MinMaxReduceOps.
+    OPEN3D_DEVICE inline arg_t Reduce(arg_t acc,
+                                      scalar_t val,
+                                      int64_t idx) const {
+        return {acc.min_ < val ? acc.min_ : val,
+                acc.max_ > val ? acc.max_ : val};
+    }
+};
+
+/// Accumulator of MeanVarReduceOps.
+template <typename acc_t>
+struct WelfordData {
+    acc_t mean_;
+    acc_t m2_;
+    int64_t count_;
+};
+
+/// Output of MeanVarReduceOps, stored as two consecutive values.
+template <typename scalar_t>
+struct MeanVarPair {
+    scalar_t mean_;
+    scalar_t var_;
+};
+
+/// Float64 is accumulated in double precision, all other dtypes in float.
+template <typename scalar_t>
+using MeanVarAccType =
+        typename std::conditional<std::is_same<scalar_t, double>::value,
+                                  double,
+                                  float>::type;
+
+/// Fused (mean, population variance) reduction with Welford's online
+/// algorithm. Partial results are merged with Chan et al.'s pairwise update.
+template <typename scalar_t>
+class MeanVarReduceOps {
+    using acc_t = MeanVarAccType<scalar_t>;
+    using arg_t = WelfordData<acc_t>;
+    using out_t = MeanVarPair<scalar_t>;
+
+public:
+    static OPEN3D_DEVICE out_t Project(arg_t arg) {
+        return {static_cast<scalar_t>(arg.mean_),
+                static_cast<scalar_t>(arg.m2_ / arg.count_)};
+    }
+
+    static OPEN3D_DEVICE arg_t WarpShflDown(arg_t arg, int offset) {
+        return {WARP_SHFL_DOWN(arg.mean_, offset),
+                WARP_SHFL_DOWN(arg.m2_, offset),
+                WARP_SHFL_DOWN(arg.count_, offset)};
+    }
+
+    OPEN3D_DEVICE inline arg_t Combine(arg_t a, arg_t b) const {
+        if (a.count_ == 0) {
+            return b;
+        }
+        if (b.count_ == 0) {
+            return a;
+        }
+        int64_t count = a.count_ + b.count_;
+        acc_t delta = b.mean_ - a.mean_;
+        acc_t b_ratio = static_cast<acc_t>(b.count_) / count;
+        return {a.mean_ + delta * b_ratio,
+                a.m2_ + b.m2_ + delta * delta * a.count_ * b_ratio, count};
+    }
+
+    /// Idx is ignored for MeanVarReduceOps.
+    OPEN3D_DEVICE inline arg_t Reduce(arg_t acc,
+                                      scalar_t val,
+                                      int64_t idx) const {
+        acc_t x = static_cast<acc_t>(val);
+        acc_t delta = x - acc.mean_;
+        acc.count_++;
+        acc.mean_ += delta / acc.count_;
+        acc.m2_ += delta * (x - acc.mean_);
+        return acc;
+    }
+};
+
 template <typename scalar_t,
           typename ops_t,
           typename index_t,
@@ -914,6 +1030,27 @@ public:
         }
     }
 
+    /// Runs a multi-output reduction, where ops_t::Project returns an
+    /// out_scalar_t packing NUM_MULTI_REDUCTION_OUTPUTS values of scalar_t.
+    template <typename scalar_t,
+              typename out_scalar_t,
+              typename ops_t,
+              typename arg_t>
+    void RunMultiOutput(const ops_t& ops, arg_t identity) {
+        static_assert(sizeof(out_scalar_t) ==
+                              NUM_MULTI_REDUCTION_OUTPUTS * sizeof(scalar_t),
+                      "Output must pack NUM_MULTI_REDUCTION_OUTPUTS values.");
+        if (indexer_.NumWorkloads() == 0) {
+            utility::LogError(
+                    "0-sized input should be handled outside of the reudction "
+                    "engine.");
+        }
+        if (indexer_.NumInputs() != 1) {
+            utility::LogError("Reduction op must have exactly one input.");
+        }
+        RunReduce<scalar_t, out_scalar_t>(indexer_, ops, identity);
+    }
+
 private:
     /// If the index cannot be represented in 32 bits, RunReduce calls itself
     /// recursively.
@@ -975,8 +1112,9 @@ private:
 
             buffer = MemoryManager::Malloc(config.GlobalMemorySize(), device);
             semaphores = MemoryManager::Malloc(config.SemaphoreSize(), device);
-            OPEN3D_CUDA_CHECK(
-                    cudaMemset(semaphores, 0, config.SemaphoreSize()));
+            OPEN3D_CUDA_CHECK(cudaMemsetAsync(semaphores, 0,
+                                              config.SemaphoreSize(),
+                                              cuda::GetCurrentStream()));
         }
 
         assert(can_use_32bit_indexing);
@@ -993,10 +1131,11 @@ private:
 
         // Launch reduce kernel
         int shared_memory = config.SharedMemorySize();
+        cudaStream_t stream = cuda::GetCurrentStream();
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
-                <<<config.GridDim(), config.BlockDim(), shared_memory>>>(
-                        reduce_op);
-        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+                <<<config.GridDim(), config.BlockDim(), shared_memory,
+                   stream>>>(reduce_op);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -1017,6 +1156,10 @@ void ReductionCUDA(const Tensor& src,
             utility::LogError("Arg-reduction must have int64 output dtype.");
         }
         dtype_policy = DtypePolicy::INPUT_SAME;
+    } else if (multi_output_reduce_ops.find(op_code) !=
+               multi_output_reduce_ops.end()) {
+        // dst is a view of the first values of the packed outputs.
+        dtype_policy = DtypePolicy::ALL_SAME;
     } else {
         utility::LogError("Unsupported op code.");
     }
@@ -1091,6 +1234,20 @@ void ReductionCUDA(const Tensor& src,
                                    std::numeric_limits<scalar_t>::lowest()));
                 }
                 break;
+            case ReductionOpCode::MinMax:
+                re.RunMultiOutput<scalar_t, MinMaxPair<scalar_t>>(
+                        MinMaxReduceOps<scalar_t>(),
+                        MinMaxPair<scalar_t>{
+                                static_cast<scalar_t>(
+                                        std::numeric_limits<scalar_t>::max()),
+                                static_cast<scalar_t>(std::numeric_limits<
+                                                      scalar_t>::lowest())});
+                break;
+            case ReductionOpCode::MeanVar:
+                re.RunMultiOutput<scalar_t, MeanVarPair<scalar_t>>(
+                        MeanVarReduceOps<scalar_t>(),
+                        WelfordData<MeanVarAccType<scalar_t>>{0, 0, 0});
+                break;
             default:
                 utility::LogError("Unsupported op code.");
                 break;
@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Scan.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+void CumSum(const Tensor& src, Tensor& dst, int64_t dim, bool exclusive) {
+    if (src.GetShape() != dst.GetShape()) {
+        utility::LogError("CumSum: src shape {} does not match dst shape {}.",
+                          src.GetShape(), dst.GetShape());
+    }
+    if (src.GetDtype() != dst.GetDtype()) {
+        utility::LogError("CumSum: src dtype {} does not match dst dtype {}.",
+                          DtypeUtil::ToString(src.GetDtype()),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (src.GetDevice() != dst.GetDevice()) {
+        utility::LogError("CumSum: src device {} does not match dst device {}.",
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+    if (src.GetDtype() == Dtype::Bool) {
+        utility::LogError("CumSum: Bool is not supported.");
+    }
+    if (src.NumDims() == 0) {
+        Tensor dst_view = dst.View({1});
+        CumSum(src.View({1}), dst_view, 0, exclusive);
+        return;
+    }
+
+    // The kernels scan contiguous lines along the last dimension.
+    const int64_t last_dim = src.NumDims() - 1;
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    Tensor src_lines = src.Transpose(dim, last_dim).Contiguous();
+    const bool is_dst_direct = dim == last_dim && dst.IsContiguous();
+    Tensor dst_lines = is_dst_direct ? dst
+                                     : Tensor(src_lines.GetShape(),
+                                              src.GetDtype(), src.GetDevice());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        CumSumCPU(src_lines, dst_lines, exclusive);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CumSumCUDA(src_lines, dst_lines, exclusive);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CumSum: Unimplemented device");
+    }
+
+    if (!is_dst_direct) {
+        dst.Transpose(dim, last_dim).AsRvalue() = dst_lines;
+    }
+}
+
+void SegmentReduce(const Tensor& src,
+                   const Tensor& segment_offsets,
+                   Tensor& dst,
+                   ReductionOpCode op_code) {
+    if (regular_reduce_ops.find(op_code) == regular_reduce_ops.end()) {
+        utility::LogError("SegmentReduce: unsupported op code.");
+    }
+    if (src.NumDims() == 0) {
+        utility::LogError("SegmentReduce: src must have at least 1 dim.");
+    }
+    if (segment_offsets.NumDims() != 1 ||
+        segment_offsets.GetDtype() != Dtype::Int64) {
+        utility::LogError(
+                "SegmentReduce: segment_offsets must be a 1-D Int64 tensor.");
+    }
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = segment_offsets.GetShape()[0];
+    if (dst.GetShape() != dst_shape) {
+        utility::LogError("SegmentReduce: expected dst shape {}, but got {}.",
+                          dst_shape, dst.GetShape());
+    }
+    if (src.GetDtype() != dst.GetDtype()) {
+        utility::LogError(
+                "SegmentReduce: src dtype {} does not match dst dtype {}.",
+                DtypeUtil::ToString(src.GetDtype()),
+                DtypeUtil::ToString(dst.GetDtype()));
+    }
+    if (src.GetDevice() != segment_offsets.GetDevice() ||
+        src.GetDevice() != dst.GetDevice()) {
+        utility::LogError(
+                "SegmentReduce: src, segment_offsets and dst must be on the "
+                "same device.");
+    }
+
+    Tensor src_contiguous = src.Contiguous();
+    Tensor offsets_contiguous = segment_offsets.Contiguous();
+    const bool is_dst_direct = dst.IsContiguous();
+    Tensor dst_contiguous =
+            is_dst_direct ? dst
+                          : Tensor(dst_shape, dst.GetDtype(), dst.GetDevice());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReduceCPU(src_contiguous, offsets_contiguous, dst_contiguous,
+                         op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentReduceCUDA(src_contiguous, offsets_contiguous, dst_contiguous,
+                          op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduce: Unimplemented device");
+    }
+
+    if (!is_dst_direct) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Kernel/Reduction.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Prefix sum of \p src along \p dim, written to \p dst of the same shape and
+/// dtype. If \p exclusive, the i-th output is the sum of the inputs before the
+/// i-th one, i.e. the first output is 0. Bool is not supported.
+void CumSum(const Tensor& src, Tensor& dst, int64_t dim, bool exclusive);
+
+/// Prefix sum along the last dimension of the contiguous \p src and \p dst.
+void CumSumCPU(const Tensor& src, Tensor& dst, bool exclusive);
+
+#ifdef BUILD_CUDA_MODULE
+void CumSumCUDA(const Tensor& src, Tensor& dst, bool exclusive);
+#endif
+
+/// Reduces consecutive segments of rows of \p src, i.e. along dimension 0. The
+/// Int64 tensor \p segment_offsets of shape {num_segments} contains the first
+/// row of each segment in non-decreasing order, and the last segment ends at
+/// the last row, e.g. the offsets of runs of equal keys in a sorted array.
+/// \p dst has shape {num_segments} + src.GetShape()[1:]. \p op_code is one of
+/// Sum, Prod, Min and Max; empty segments are set to the identity of the op.
+void SegmentReduce(const Tensor& src,
+                   const Tensor& segment_offsets,
+                   Tensor& dst,
+                   ReductionOpCode op_code);
+
+/// SegmentReduce of contiguous \p src, \p segment_offsets and \p dst.
+void SegmentReduceCPU(const Tensor& src,
+                      const Tensor& segment_offsets,
+                      Tensor& dst,
+                      ReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentReduceCUDA(const Tensor& src,
+                       const Tensor& segment_offsets,
+                       Tensor& dst,
+                       ReductionOpCode op_code);
+#endif
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Scan.h"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Half.h"
+#include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Float16 is accumulated in float.
+template <typename scalar_t>
+using CPUScanAccType =
+        typename std::conditional<std::is_same<scalar_t, Half>::value,
+                                  float,
+                                  scalar_t>::type;
+
+/// Scans \p size elements starting from \p init, returns the sum of init and
+/// the elements. src and dst may alias.
+template <typename scalar_t, typename acc_t>
+static acc_t CPUScanRange(const scalar_t* src,
+                          scalar_t* dst,
+                          int64_t size,
+                          acc_t init,
+                          bool exclusive) {
+    acc_t acc = init;
+    if (exclusive) {
+        for (int64_t i = 0; i < size; ++i) {
+            const acc_t value = static_cast<acc_t>(src[i]);
+            dst[i] = static_cast<scalar_t>(acc);
+            acc += value;
+        }
+    } else {
+        for (int64_t i = 0; i < size; ++i) {
+            acc += static_cast<acc_t>(src[i]);
+            dst[i] = static_cast<scalar_t>(acc);
+        }
+    }
+    return acc;
+}
+
+void CumSumCPU(const Tensor& src, Tensor& dst, bool exclusive) {
+    const int64_t line_size = src.GetShape().back();
+    if (line_size == 0) {
+        return;
+    }
+    const int64_t num_lines = src.NumElements() / line_size;
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using acc_t = CPUScanAccType<scalar_t>;
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+        if (num_lines >= utility::GetNumThreads() ||
+            line_size < CPULauncher::GRAIN_SIZE) {
+            utility::ParallelFor(
+                    0, num_lines,
+                    [&](int64_t line_idx) {
+                        CPUScanRange(src_ptr + line_idx * line_size,
+                                     dst_ptr + line_idx * line_size, line_size,
+                                     acc_t(0), exclusive);
+                    },
+                    std::max<int64_t>(1, CPULauncher::GRAIN_SIZE / line_size));
+            return;
+        }
+
+        // Few long lines: sum the chunks of a line in parallel, scan the
+        // chunk sums, then scan the chunks in parallel from their offsets.
+        const int64_t num_chunks = utility::detail::GetNumChunks(
+                0, line_size, CPULauncher::GRAIN_SIZE);
+        const int64_t chunk_size = (line_size + num_chunks - 1) / num_chunks;
+        std::vector<acc_t> chunk_offsets(num_chunks);
+        for (int64_t line_idx = 0; line_idx < num_lines; ++line_idx) {
+            const scalar_t* line_src = src_ptr + line_idx * line_size;
+            scalar_t* line_dst = dst_ptr + line_idx * line_size;
+            utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+                const int64_t begin = chunk_idx * chunk_size;
+                const int64_t end = std::min(begin + chunk_size, line_size);
+                acc_t sum(0);
+                for (int64_t i = begin; i < end; ++i) {
+                    sum += static_cast<acc_t>(line_src[i]);
+                }
+                chunk_offsets[chunk_idx] = sum;
+            });
+            acc_t offset(0);
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                const acc_t sum = chunk_offsets[chunk_idx];
+                chunk_offsets[chunk_idx] = offset;
+                offset += sum;
+            }
+            utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+                const int64_t begin = chunk_idx * chunk_size;
+                const int64_t end = std::min(begin + chunk_size, line_size);
+                CPUScanRange(line_src + begin, line_dst + begin, end - begin,
+                             chunk_offsets[chunk_idx], exclusive);
+            });
+        }
+    });
+}
+
+template <typename scalar_t, typename acc_t, typename func_t>
+static void CPUSegmentReduceEngine(const Tensor& src,
+                                   const Tensor& segment_offsets,
+                                   Tensor& dst,
+                                   acc_t identity,
+                                   const func_t& reduce_func) {
+    const SizeVector src_shape = src.GetShape();
+    const int64_t num_rows = src_shape[0];
+    const int64_t row_size =
+            SizeVector(src_shape.begin() + 1, src_shape.end()).NumElements();
+    const int64_t num_segments = segment_offsets.NumElements();
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(segment_offsets.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    // About GRAIN_SIZE input elements per parallel chunk.
+    const int64_t grain_size = std::max<int64_t>(
+            1, CPULauncher::GRAIN_SIZE * num_segments /
+                       std::max<int64_t>(1, num_rows * row_size));
+    utility::ParallelFor(
+            0, num_segments,
+            [&](int64_t segment_idx) {
+                const int64_t begin = offsets_ptr[segment_idx];
+                const int64_t end = segment_idx + 1 < num_segments
+                                            ? offsets_ptr[segment_idx + 1]
+                                            : num_rows;
+                for (int64_t j = 0; j < row_size; ++j) {
+                    const scalar_t* src_col = src_ptr + j;
+                    acc_t acc = identity;
+                    for (int64_t row = begin; row < end; ++row) {
+                        const acc_t value =
+                                static_cast<acc_t>(src_col[row * row_size]);
+                        acc = reduce_func(acc, value);
+                    }
+                    dst_ptr[segment_idx * row_size + j] =
+                            static_cast<scalar_t>(acc);
+                }
+            },
+            grain_size);
+}
+
+void SegmentReduceCPU(const Tensor& src,
+                      const Tensor& segment_offsets,
+                      Tensor& dst,
+                      ReductionOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using acc_t = CPUScanAccType<scalar_t>;
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                CPUSegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst, acc_t(0),
+                        [](acc_t a, acc_t b) { return a + b; });
+                break;
+            case ReductionOpCode::Prod:
+                CPUSegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst, acc_t(1),
+                        [](acc_t a, acc_t b) { return a * b; });
+                break;
+            case ReductionOpCode::Min:
+                CPUSegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst,
+                        static_cast<acc_t>(
+                                std::numeric_limits<scalar_t>::max()),
+                        [](acc_t a, acc_t b) { return std::min(a, b); });
+                break;
+            case ReductionOpCode::Max:
+                CPUSegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst,
+                        static_cast<acc_t>(
+                                std::numeric_limits<scalar_t>::lowest()),
+                        [](acc_t a, acc_t b) { return std::max(a, b); });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Scan.h"
+
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <limits>
+#include <type_traits>
+
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Half.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+
+namespace open3d {
+namespace kernel {
+
+/// Float16 is accumulated in float.
+template <typename scalar_t>
+using CUDAScanAccType =
+        typename std::conditional<std::is_same<scalar_t, Half>::value,
+                                  float,
+                                  scalar_t>::type;
+
+/// Maps a flat index to the index of its line, the key of the segmented scan.
+struct LineIndexFunctor {
+    LineIndexFunctor(int64_t line_size) : line_size_(line_size) {}
+    __host__ __device__ int64_t operator()(int64_t idx) const {
+        return idx / line_size_;
+    }
+    int64_t line_size_;
+};
+
+template <typename scalar_t, typename acc_t>
+struct CastFunctor {
+    __host__ __device__ acc_t operator()(scalar_t value) const {
+        return static_cast<acc_t>(value);
+    }
+};
+
+void CumSumCUDA(const Tensor& src, Tensor& dst, bool exclusive) {
+    const int64_t line_size = src.GetShape().back();
+    const int64_t n = src.NumElements();
+    if (n == 0) {
+        return;
+    }
+    cudaStream_t stream = cuda::GetCurrentStream();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using acc_t = CUDAScanAccType<scalar_t>;
+        thrust::device_ptr<const scalar_t> src_ptr(
+                static_cast<const scalar_t*>(src.GetDataPtr()));
+        thrust::device_ptr<scalar_t> dst_ptr(
+                static_cast<scalar_t*>(dst.GetDataPtr()));
+        auto keys_first = thrust::make_transform_iterator(
+                thrust::counting_iterator<int64_t>(0),
+                LineIndexFunctor(line_size));
+        auto values_first = thrust::make_transform_iterator(
+                src_ptr, CastFunctor<scalar_t, acc_t>());
+        if (exclusive) {
+            thrust::exclusive_scan_by_key(thrust::cuda::par.on(stream),
+                                          keys_first, keys_first + n,
+                                          values_first, dst_ptr, acc_t(0));
+        } else {
+            thrust::inclusive_scan_by_key(thrust::cuda::par.on(stream),
+                                          keys_first, keys_first + n,
+                                          values_first, dst_ptr);
+        }
+    });
+}
+
+struct CUDASumOp {
+    template <typename T>
+    __host__ __device__ T operator()(T a, T b) const {
+        return a + b;
+    }
+};
+
+struct CUDAProdOp {
+    template <typename T>
+    __host__ __device__ T operator()(T a, T b) const {
+        return a * b;
+    }
+};
+
+struct CUDAMinOp {
+    template <typename T>
+    __host__ __device__ T operator()(T a, T b) const {
+        return a < b ? a : b;
+    }
+};
+
+struct CUDAMaxOp {
+    template <typename T>
+    __host__ __device__ T operator()(T a, T b) const {
+        return a > b ? a : b;
+    }
+};
+
+/// One thread per output element, i.e. per (segment, column) pair. Threads
+/// of a warp read adjacent columns of the same rows.
+template <typename scalar_t, typename acc_t, typename op_t>
+void CUDASegmentReduceEngine(const Tensor& src,
+                             const Tensor& segment_offsets,
+                             Tensor& dst,
+                             acc_t identity,
+                             op_t op) {
+    const SizeVector src_shape = src.GetShape();
+    const int64_t num_rows = src_shape[0];
+    const int64_t row_size =
+            SizeVector(src_shape.begin() + 1, src_shape.end()).NumElements();
+    const int64_t num_segments = segment_offsets.NumElements();
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    const int64_t* offsets_ptr =
+            static_cast<const int64_t*>(segment_offsets.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    CUDALauncher::LaunchGeneralKernel(
+            num_segments * row_size, [=] OPEN3D_HOST_DEVICE(int64_t idx) {
+                const int64_t segment_idx = idx / row_size;
+                const int64_t j = idx % row_size;
+                const int64_t begin = offsets_ptr[segment_idx];
+                const int64_t end = segment_idx + 1 < num_segments
+                                            ? offsets_ptr[segment_idx + 1]
+                                            : num_rows;
+                acc_t acc = identity;
+                for (int64_t row = begin; row < end; ++row) {
+                    acc = op(acc,
+                             static_cast<acc_t>(src_ptr[row * row_size + j]));
+                }
+                dst_ptr[idx] = static_cast<scalar_t>(acc);
+            });
+}
+
+void SegmentReduceCUDA(const Tensor& src,
+                       const Tensor& segment_offsets,
+                       Tensor& dst,
+                       ReductionOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        using acc_t = CUDAScanAccType<scalar_t>;
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                CUDASegmentReduceEngine<scalar_t>(src, segment_offsets, dst,
+                                                  acc_t(0), CUDASumOp());
+                break;
+            case ReductionOpCode::Prod:
+                CUDASegmentReduceEngine<scalar_t>(src, segment_offsets, dst,
+                                                  acc_t(1), CUDAProdOp());
+                break;
+            case ReductionOpCode::Min:
+                CUDASegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst,
+                        static_cast<acc_t>(
+                                std::numeric_limits<scalar_t>::max()),
+                        CUDAMinOp());
+                break;
+            case ReductionOpCode::Max:
+                CUDASegmentReduceEngine<scalar_t>(
+                        src, segment_offsets, dst,
+                        static_cast<acc_t>(
+                                std::numeric_limits<scalar_t>::lowest()),
+                        CUDAMaxOp());
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace open3d
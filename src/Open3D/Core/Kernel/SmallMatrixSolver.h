@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+
+namespace open3d {
+namespace kernel {
+
+/// Solves one n x n system A X = B with n <= MAX_SMALL_MATRIX_DIM by
+/// Gauss-Jordan elimination with partial pivoting. \p a is row-major n x n,
+/// \p b and \p x are row-major n x k. \p x must not alias \p a or \p b.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void SolveSmallMatrix(const scalar_t* a,
+                                         const scalar_t* b,
+                                         scalar_t* x,
+                                         int64_t n,
+                                         int64_t k) {
+    scalar_t m[MAX_SMALL_MATRIX_DIM][MAX_SMALL_MATRIX_DIM];
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            m[i][j] = a[i * n + j];
+        }
+        for (int64_t j = 0; j < k; ++j) {
+            x[i * k + j] = b[i * k + j];
+        }
+    }
+
+    for (int64_t col = 0; col < n; ++col) {
+        int64_t pivot = col;
+        scalar_t pivot_abs = m[col][col] < 0 ? -m[col][col] : m[col][col];
+        for (int64_t row = col + 1; row < n; ++row) {
+            scalar_t v = m[row][col] < 0 ? -m[row][col] : m[row][col];
+            if (v > pivot_abs) {
+                pivot = row;
+                pivot_abs = v;
+            }
+        }
+        if (pivot != col) {
+            for (int64_t j = col; j < n; ++j) {
+                scalar_t tmp = m[col][j];
+                m[col][j] = m[pivot][j];
+                m[pivot][j] = tmp;
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                scalar_t tmp = x[col * k + j];
+                x[col * k + j] = x[pivot * k + j];
+                x[pivot * k + j] = tmp;
+            }
+        }
+
+        const scalar_t inv_pivot = scalar_t(1) / m[col][col];
+        for (int64_t j = col; j < n; ++j) {
+            m[col][j] *= inv_pivot;
+        }
+        for (int64_t j = 0; j < k; ++j) {
+            x[col * k + j] *= inv_pivot;
+        }
+        for (int64_t row = 0; row < n; ++row) {
+            const scalar_t factor = m[row][col];
+            if (row == col || factor == scalar_t(0)) {
+                continue;
+            }
+            for (int64_t j = col; j < n; ++j) {
+                m[row][j] -= factor * m[col][j];
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                x[row * k + j] -= factor * x[col * k + j];
+            }
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace open3d
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Kernel/Sort.h"
+
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/Kernel/RadixKey.h"
+
+namespace open3d {
+namespace kernel {
+
+Tensor ArgSortCUDA(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t n = src.NumElements();
+    Tensor dst({n}, Dtype::Int64, src.GetDevice());
+    if (n == 0) {
+        return dst;
+    }
+    int64_t* dst_ptr = static_cast<int64_t*>(dst.GetDataPtr());
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using key_t = typename RadixKey<scalar_t>::key_t;
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        Tensor keys({n * static_cast<int64_t>(sizeof(key_t))}, Dtype::UInt8,
+                    src.GetDevice());
+        key_t* keys_ptr = static_cast<key_t*>(keys.GetDataPtr());
+        CUDALauncher::LaunchGeneralKernel(
+                n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                    keys_ptr[i] = RadixKey<scalar_t>::Get(src_ptr[i]);
+                    dst_ptr[i] = i;
+                });
+        // Unsigned integer keys with the default comparator are sorted by
+        // thrust's (CUB) radix sort.
+        thrust::stable_sort_by_key(
+                thrust::cuda::par.on(cuda::GetCurrentStream()),
+                thrust::device_ptr<key_t>(keys_ptr),
+                thrust::device_ptr<key_t>(keys_ptr + n),
+                thrust::device_ptr<int64_t>(dst_ptr));
+    });
+    return dst;
+}
+
+}  // namespace kernel
+}  // namespace open3d
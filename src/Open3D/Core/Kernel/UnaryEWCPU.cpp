@@ -31,10 +31,12 @@
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/CPULauncher.h"
+#include "Open3D/Core/Kernel/PermuteCopy.h"
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace kernel {
@@ -87,6 +89,44 @@ static void CPULogicalNotElementKernel(const void* src, void* dst) {
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+/// Copies the tiles of \p plan in parallel. Within a tile, dst is written
+/// along its innermost dimension (columns) and the src cache lines loaded for
+/// the first column are reused by the next ones.
+template <typename src_t, typename dst_t>
+static void CPUPermuteCopy(const PermuteCopyPlan& plan,
+                           const src_t* src,
+                           dst_t* dst) {
+    const int64_t num_row_tiles = plan.NumRowTiles();
+    const int64_t num_col_tiles = plan.NumColTiles();
+    utility::ParallelFor(
+            0, plan.NumTiles(),
+            [&](int64_t tile_idx) {
+                const int64_t col_tile = tile_idx % num_col_tiles;
+                const int64_t row_tile =
+                        tile_idx / num_col_tiles % num_row_tiles;
+                const int64_t batch = tile_idx / num_col_tiles / num_row_tiles;
+                const int64_t row_begin = row_tile * PERMUTE_COPY_TILE_SIZE;
+                const int64_t row_end = std::min(
+                        row_begin + PERMUTE_COPY_TILE_SIZE, plan.num_rows_);
+                const int64_t col_begin = col_tile * PERMUTE_COPY_TILE_SIZE;
+                const int64_t col_end = std::min(
+                        col_begin + PERMUTE_COPY_TILE_SIZE, plan.num_cols_);
+                const src_t* src_batch = src + batch * plan.src_batch_stride_;
+                dst_t* dst_batch = dst + batch * plan.dst_batch_stride_;
+                for (int64_t r = row_begin; r < row_end; ++r) {
+                    const src_t* src_row = src_batch + r * plan.src_row_stride_;
+                    dst_t* dst_row = dst_batch + r * plan.dst_row_stride_;
+                    for (int64_t c = col_begin; c < col_end; ++c) {
+                        dst_row[c * plan.dst_col_stride_] = static_cast<dst_t>(
+                                src_row[c * plan.src_col_stride_]);
+                    }
+                }
+            },
+            std::max<int64_t>(1, CPULauncher::GRAIN_SIZE /
+                                         (PERMUTE_COPY_TILE_SIZE *
+                                          PERMUTE_COPY_TILE_SIZE)));
+}
+
 void CopyCPU(const Tensor& src, Tensor& dst) {
     // src and dst have been checked to have the same shape, dtype, device
     SizeVector shape = src.GetShape();
@@ -98,17 +138,35 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                 dst.GetDataPtr(), dst.GetDevice(), src.GetDataPtr(),
                 src.GetDevice(),
                 DtypeUtil::ByteSize(src_dtype) * shape.NumElements());
-    } else {
-        Indexer indexer({src}, dst, DtypePolicy::NONE);
+        return;
+    }
+
+    // Layout changes, with the dtype conversion fused in the copy.
+    PermuteCopyPlan plan;
+    if (GetPermuteCopyPlan(src, dst, plan)) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             using src_t = scalar_t;
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                 using dst_t = scalar_t;
-                CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPUCopyElementKernel<src_t, dst_t>);
+                CPUPermuteCopy(plan,
+                               static_cast<const src_t*>(src.GetDataPtr()),
+                               static_cast<dst_t*>(dst.GetDataPtr()));
             });
         });
+        return;
     }
+
+    Indexer indexer({src}, dst, DtypePolicy::NONE);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        using src_t = scalar_t;
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+            using dst_t = scalar_t;
+            CPULauncher::LaunchUnaryEWKernel(
+                    indexer, [](const void* src, void* dst) {
+                        CPUCopyElementKernel<src_t, dst_t>(src, dst);
+                    });
+        });
+    });
 }
 
 void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
@@ -117,9 +175,10 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (!DtypeUtil::IsFloat(dtype)) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
@@ -129,13 +188,18 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 CPULauncher::LaunchUnaryEWKernel(
-                        indexer,
-                        CPULogicalNotElementKernel<scalar_t, scalar_t>);
+                        indexer, [](const void* src, void* dst) {
+                            CPULogicalNotElementKernel<scalar_t, scalar_t>(src,
+                                                                    dst);
+                        });
             } else if (dst_dtype == Dtype::Bool) {
                 Indexer indexer({src}, dst,
                                 DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
                 CPULauncher::LaunchUnaryEWKernel(
-                        indexer, CPULogicalNotElementKernel<scalar_t, bool>);
+                        indexer, [](const void* src, void* dst) {
+                            CPULogicalNotElementKernel<scalar_t, bool>(src,
+                                                                    dst);
+                        });
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -149,30 +213,42 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUSqrtElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUSinElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUCosElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Neg:
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUNegElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUExpElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 case UnaryEWOpCode::Abs:
                     CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                            indexer, [](const void* src, void* dst) {
+                                CPUAbsElementKernel<scalar_t>(src, dst);
+                            });
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
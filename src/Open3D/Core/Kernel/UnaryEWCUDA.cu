@@ -30,6 +30,7 @@
 #include "Open3D/Core/CUDAUtils.h"
 #include "Open3D/Core/Dispatch.h"
 #include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/Kernel/PermuteCopy.h"
 #include "Open3D/Core/Tensor.h"
 
 namespace open3d {
@@ -90,6 +91,77 @@ static OPEN3D_HOST_DEVICE void CUDALogicalNotElementKernel(const void* src,
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+/// Number of rows of threads of a permuted copy block, each thread copying
+/// PERMUTE_COPY_TILE_SIZE / PERMUTE_COPY_BLOCK_ROWS elements of a tile.
+static constexpr int PERMUTE_COPY_BLOCK_ROWS = 8;
+
+/// Copies the tiles of \p plan through shared memory: a tile is read with
+/// consecutive threads along the rows, which are contiguous in src, and
+/// written with consecutive threads along the columns, which are contiguous
+/// in dst. The tile rows are padded by one element to avoid shared memory
+/// bank conflicts.
+template <typename src_t, typename dst_t>
+__global__ void PermuteCopyKernel(PermuteCopyPlan plan,
+                                  const src_t* src,
+                                  dst_t* dst) {
+    constexpr int tile_size = PERMUTE_COPY_TILE_SIZE;
+    __shared__ __align__(8) char tile_storage[tile_size * (tile_size + 1) *
+                                               sizeof(dst_t)];
+    dst_t* tile = reinterpret_cast<dst_t*>(tile_storage);
+
+    const int64_t num_row_tiles = plan.NumRowTiles();
+    const int64_t num_col_tiles = plan.NumColTiles();
+    const int64_t num_tiles = plan.NumTiles();
+    for (int64_t tile_idx = blockIdx.x; tile_idx < num_tiles;
+         tile_idx += gridDim.x) {
+        const int64_t col_begin =
+                tile_idx % num_col_tiles * PERMUTE_COPY_TILE_SIZE;
+        const int64_t row_begin = tile_idx / num_col_tiles % num_row_tiles *
+                                  PERMUTE_COPY_TILE_SIZE;
+        const int64_t batch = tile_idx / num_col_tiles / num_row_tiles;
+        const src_t* src_batch = src + batch * plan.src_batch_stride_;
+        dst_t* dst_batch = dst + batch * plan.dst_batch_stride_;
+
+        // Read along the rows.
+        const int64_t src_row = row_begin + threadIdx.x;
+        for (int i = threadIdx.y; i < tile_size; i += PERMUTE_COPY_BLOCK_ROWS) {
+            const int64_t src_col = col_begin + i;
+            if (src_row < plan.num_rows_ && src_col < plan.num_cols_) {
+                tile[i * (tile_size + 1) + threadIdx.x] = static_cast<dst_t>(
+                        src_batch[src_row * plan.src_row_stride_ +
+                                  src_col * plan.src_col_stride_]);
+            }
+        }
+        __syncthreads();
+
+        // Write along the columns.
+        const int64_t dst_col = col_begin + threadIdx.x;
+        for (int i = threadIdx.y; i < tile_size; i += PERMUTE_COPY_BLOCK_ROWS) {
+            const int64_t dst_row = row_begin + i;
+            if (dst_row < plan.num_rows_ && dst_col < plan.num_cols_) {
+                dst_batch[dst_row * plan.dst_row_stride_ +
+                          dst_col * plan.dst_col_stride_] =
+                        tile[threadIdx.x * (tile_size + 1) + i];
+            }
+        }
+        __syncthreads();
+    }
+}
+
+template <typename src_t, typename dst_t>
+static void CUDAPermuteCopy(const PermuteCopyPlan& plan,
+                            const src_t* src,
+                            dst_t* dst) {
+    // Blocks loop over the tiles past the maximum grid size.
+    const int64_t grid_size =
+            std::min<int64_t>(plan.NumTiles(), (int64_t(1) << 31) - 1);
+    const dim3 block_size(PERMUTE_COPY_TILE_SIZE, PERMUTE_COPY_BLOCK_ROWS);
+    PermuteCopyKernel<src_t, dst_t>
+            <<<grid_size, block_size, 0, cuda::GetCurrentStream()>>>(plan, src,
+                                                                     dst);
+    OPEN3D_GET_LAST_CUDA_ERROR("PermuteCopyKernel failed.");
+}
+
 void CopyCUDA(const Tensor& src, Tensor& dst) {
     // It has been checked that
     // - src and dst have the same dtype
@@ -114,6 +186,21 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
             // dst is enabled, then put synchronization with streams on both
             // src and dst to wait for copy kernel to complete.
             CUDADeviceSwitcher switcher(src_device);
+            // Layout changes, with the dtype conversion fused in the copy.
+            PermuteCopyPlan plan;
+            if (GetPermuteCopyPlan(src, dst, plan)) {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                    using src_t = scalar_t;
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                        using dst_t = scalar_t;
+                        CUDAPermuteCopy(
+                                plan,
+                                static_cast<const src_t*>(src.GetDataPtr()),
+                                static_cast<dst_t*>(dst.GetDataPtr()));
+                    });
+                });
+                return;
+            }
             Indexer indexer({src}, dst, DtypePolicy::NONE);
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
                 using src_t = scalar_t;
@@ -156,9 +243,10 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (!DtypeUtil::IsFloat(dtype)) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
                     DtypeUtil::ToString(dtype));
         }
     };
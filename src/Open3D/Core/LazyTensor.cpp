@@ -0,0 +1,291 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/LazyTensor.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/ShapeUtil.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+struct LazyTensor::Node {
+    bool is_leaf_ = false;
+    bool is_binary_ = false;
+    Tensor tensor_;
+    kernel::UnaryEWOpCode unary_op_code_ = kernel::UnaryEWOpCode::Neg;
+    kernel::BinaryEWOpCode binary_op_code_ = kernel::BinaryEWOpCode::Add;
+    std::shared_ptr<Node> lhs_;
+    std::shared_ptr<Node> rhs_;
+
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Float32;
+    Device device_;
+
+    // Upper bounds of the ops and leaves in the fused region rooted at this
+    // node, filled by Partition().
+    bool partitioned_ = false;
+    int64_t region_ops_ = 0;
+    int64_t region_leaves_ = 0;
+
+    void MakeLeaf(const Tensor& tensor) {
+        is_leaf_ = true;
+        tensor_ = tensor;
+        lhs_.reset();
+        rhs_.reset();
+    }
+};
+
+LazyTensor Tensor::Lazy() const { return LazyTensor(*this); }
+
+LazyTensor::LazyTensor(const Tensor& tensor) : node_(std::make_shared<Node>()) {
+    node_->MakeLeaf(tensor);
+    node_->shape_ = tensor.GetShape();
+    node_->dtype_ = tensor.GetDtype();
+    node_->device_ = tensor.GetDevice();
+}
+
+LazyTensor LazyTensor::Unary(kernel::UnaryEWOpCode op_code) const {
+    if (op_code == kernel::UnaryEWOpCode::Sqrt ||
+        op_code == kernel::UnaryEWOpCode::Sin ||
+        op_code == kernel::UnaryEWOpCode::Cos ||
+        op_code == kernel::UnaryEWOpCode::Exp) {
+        if (!DtypeUtil::IsFloat(GetDtype())) {
+            utility::LogError(
+                    "Only supports Float16, Float32 and Float64, but {} is "
+                    "used.",
+                    DtypeUtil::ToString(GetDtype()));
+        }
+    }
+    if (GetDtype() == Dtype::Bool) {
+        utility::LogError("LazyTensor does not support Bool dtype.");
+    }
+    auto node = std::make_shared<Node>();
+    node->unary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->shape_ = node_->shape_;
+    node->dtype_ = node_->dtype_;
+    node->device_ = node_->device_;
+    return LazyTensor(node);
+}
+
+LazyTensor LazyTensor::Binary(const LazyTensor& value,
+                              kernel::BinaryEWOpCode op_code) const {
+    if (GetDevice() != value.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.", GetDevice().ToString(),
+                          value.GetDevice().ToString());
+    }
+    if (GetDtype() != value.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          DtypeUtil::ToString(GetDtype()),
+                          DtypeUtil::ToString(value.GetDtype()));
+    }
+    if (GetDtype() == Dtype::Bool) {
+        utility::LogError("LazyTensor does not support Bool dtype.");
+    }
+    auto node = std::make_shared<Node>();
+    node->is_binary_ = true;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    node->shape_ = shape_util::BroadcastedShape(GetShape(), value.GetShape());
+    node->dtype_ = node_->dtype_;
+    node->device_ = node_->device_;
+    return LazyTensor(node);
+}
+
+LazyTensor LazyTensor::Add(const LazyTensor& value) const {
+    return Binary(value, kernel::BinaryEWOpCode::Add);
+}
+
+LazyTensor LazyTensor::Sub(const LazyTensor& value) const {
+    return Binary(value, kernel::BinaryEWOpCode::Sub);
+}
+
+LazyTensor LazyTensor::Mul(const LazyTensor& value) const {
+    return Binary(value, kernel::BinaryEWOpCode::Mul);
+}
+
+LazyTensor LazyTensor::Div(const LazyTensor& value) const {
+    return Binary(value, kernel::BinaryEWOpCode::Div);
+}
+
+LazyTensor LazyTensor::Sqrt() const {
+    return Unary(kernel::UnaryEWOpCode::Sqrt);
+}
+
+LazyTensor LazyTensor::Sin() const { return Unary(kernel::UnaryEWOpCode::Sin); }
+
+LazyTensor LazyTensor::Cos() const { return Unary(kernel::UnaryEWOpCode::Cos); }
+
+LazyTensor LazyTensor::Neg() const { return Unary(kernel::UnaryEWOpCode::Neg); }
+
+LazyTensor LazyTensor::Exp() const { return Unary(kernel::UnaryEWOpCode::Exp); }
+
+LazyTensor LazyTensor::Abs() const { return Unary(kernel::UnaryEWOpCode::Abs); }
+
+bool LazyTensor::IsLeaf() const { return node_->is_leaf_; }
+
+int64_t LazyTensor::NumOps() const {
+    std::unordered_map<const Node*, bool> visited;
+    std::vector<const Node*> stack{node_.get()};
+    int64_t num_ops = 0;
+    while (!stack.empty()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+        if (node->is_leaf_ || visited.count(node)) {
+            continue;
+        }
+        visited[node] = true;
+        num_ops++;
+        stack.push_back(node->lhs_.get());
+        if (node->is_binary_) {
+            stack.push_back(node->rhs_.get());
+        }
+    }
+    return num_ops;
+}
+
+SizeVector LazyTensor::GetShape() const { return node_->shape_; }
+
+Dtype LazyTensor::GetDtype() const { return node_->dtype_; }
+
+Device LazyTensor::GetDevice() const { return node_->device_; }
+
+void LazyTensor::Partition(Node* node) {
+    if (node->partitioned_) {
+        return;
+    }
+    node->partitioned_ = true;
+    if (node->is_leaf_) {
+        node->region_leaves_ = 1;
+        return;
+    }
+
+    std::vector<Node*> children{node->lhs_.get()};
+    if (node->is_binary_) {
+        children.push_back(node->rhs_.get());
+    }
+    node->region_ops_ = 1;
+    node->region_leaves_ = 0;
+    for (Node* child : children) {
+        Partition(child);
+        node->region_ops_ += child->region_ops_;
+        node->region_leaves_ += child->region_leaves_;
+    }
+
+    // Every child region fits into one kernel, so cutting the graph right
+    // below this node always brings it back within the limits.
+    if (node->region_ops_ > kernel::MAX_FUSED_INSTRUCTIONS ||
+        node->region_leaves_ > kernel::MAX_FUSED_INPUTS) {
+        for (Node* child : children) {
+            if (!child->is_leaf_) {
+                child->MakeLeaf(EvaluateFused(child));
+                child->region_ops_ = 0;
+                child->region_leaves_ = 1;
+            }
+        }
+        node->region_ops_ = 1;
+        node->region_leaves_ = static_cast<int64_t>(children.size());
+    }
+}
+
+Tensor LazyTensor::EvaluateFused(const Node* root) {
+    // Number the distinct leaves first, since input registers precede
+    // instruction registers.
+    std::unordered_map<const Node*, int> node_to_reg;
+    std::vector<const Node*> leaves;
+    std::vector<const Node*> ops;
+    std::unordered_map<const Node*, bool> visited;
+    std::vector<std::pair<const Node*, bool>> stack{{root, false}};
+    while (!stack.empty()) {
+        const Node* node = stack.back().first;
+        bool children_done = stack.back().second;
+        stack.pop_back();
+        if (children_done) {
+            ops.push_back(node);
+            continue;
+        }
+        if (visited.count(node)) {
+            continue;
+        }
+        visited[node] = true;
+        if (node->is_leaf_) {
+            leaves.push_back(node);
+            continue;
+        }
+        stack.emplace_back(node, true);
+        if (node->is_binary_) {
+            stack.emplace_back(node->rhs_.get(), false);
+        }
+        stack.emplace_back(node->lhs_.get(), false);
+    }
+
+    const SizeVector& shape = root->shape_;
+    std::vector<Tensor> inputs;
+    for (const Node* leaf : leaves) {
+        node_to_reg[leaf] = static_cast<int>(inputs.size());
+        const Tensor& t = leaf->tensor_;
+        if (t.NumElements() == 1 ||
+            (t.GetShape() == shape && t.IsContiguous())) {
+            inputs.push_back(t);
+        } else {
+            inputs.push_back(t.Expand(shape).Contiguous());
+        }
+    }
+
+    std::vector<kernel::FusedEWInstruction> program;
+    for (const Node* node : ops) {
+        kernel::FusedEWInstruction inst;
+        inst.is_binary_ = node->is_binary_;
+        inst.unary_op_code_ = node->unary_op_code_;
+        inst.binary_op_code_ = node->binary_op_code_;
+        inst.lhs_ = node_to_reg.at(node->lhs_.get());
+        if (node->is_binary_) {
+            inst.rhs_ = node_to_reg.at(node->rhs_.get());
+        }
+        node_to_reg[node] =
+                static_cast<int>(inputs.size() + program.size());
+        program.push_back(inst);
+    }
+
+    Tensor dst(shape, root->dtype_, root->device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+Tensor LazyTensor::Materialize() const {
+    if (node_->is_leaf_) {
+        return node_->tensor_;
+    }
+    Partition(node_.get());
+    return EvaluateFused(node_.get());
+}
+
+}  // namespace open3d
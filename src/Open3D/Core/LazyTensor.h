@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Kernel/BinaryEW.h"
+#include "Open3D/Core/Kernel/UnaryEW.h"
+#include "Open3D/Core/SizeVector.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+
+/// A LazyTensor records elementwise arithmetic ops into an expression graph
+/// instead of evaluating them one at a time. Materialize() compiles the graph
+/// into a single fused kernel that reads every input once and writes only the
+/// final result, so no intermediate tensors are allocated.
+///
+/// Example:
+///     Tensor d = ((a.Lazy() - b) * c).Sqrt().Materialize();
+///
+/// Shapes are broadcasted like Tensor ops. All operands must have the same
+/// dtype and device. Sqrt, Sin, Cos and Exp require a floating point dtype.
+/// Sub-expressions used more than once are evaluated only once.
+class LazyTensor {
+public:
+    /// Wraps \p tensor as a leaf of an expression graph. The tensor is
+    /// referenced, not copied: it is read when the expression is
+    /// materialized.
+    LazyTensor(const Tensor& tensor);
+
+    LazyTensor Add(const LazyTensor& value) const;
+    LazyTensor Sub(const LazyTensor& value) const;
+    LazyTensor Mul(const LazyTensor& value) const;
+    LazyTensor Div(const LazyTensor& value) const;
+
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor Add(T scalar_value) const {
+        return Add(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor Sub(T scalar_value) const {
+        return Sub(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor Mul(T scalar_value) const {
+        return Mul(Scalar(scalar_value));
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor Div(T scalar_value) const {
+        return Div(Scalar(scalar_value));
+    }
+
+    LazyTensor operator+(const LazyTensor& value) const { return Add(value); }
+    LazyTensor operator-(const LazyTensor& value) const { return Sub(value); }
+    LazyTensor operator*(const LazyTensor& value) const { return Mul(value); }
+    LazyTensor operator/(const LazyTensor& value) const { return Div(value); }
+
+    // Tensor overloads, so that the scalar operator templates declared with
+    // Tensor are never selected for a LazyTensor.
+    LazyTensor operator+(const Tensor& value) const { return Add(value); }
+    LazyTensor operator-(const Tensor& value) const { return Sub(value); }
+    LazyTensor operator*(const Tensor& value) const { return Mul(value); }
+    LazyTensor operator/(const Tensor& value) const { return Div(value); }
+
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor operator+(T scalar_value) const {
+        return Add(scalar_value);
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor operator-(T scalar_value) const {
+        return Sub(scalar_value);
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor operator*(T scalar_value) const {
+        return Mul(scalar_value);
+    }
+    template <typename T,
+              typename = typename std::enable_if<
+                      std::is_arithmetic<T>::value>::type>
+    LazyTensor operator/(T scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    LazyTensor Sqrt() const;
+    LazyTensor Sin() const;
+    LazyTensor Cos() const;
+    LazyTensor Neg() const;
+    LazyTensor Exp() const;
+    LazyTensor Abs() const;
+    LazyTensor operator-() const { return Neg(); }
+
+    /// Evaluates the expression and returns a new contiguous Tensor. A
+    /// LazyTensor wrapping a plain Tensor returns that Tensor unchanged.
+    Tensor Materialize() const;
+
+    /// Returns true if this LazyTensor wraps a Tensor without pending ops.
+    bool IsLeaf() const;
+
+    /// Number of pending ops in the expression, counting shared
+    /// sub-expressions once.
+    int64_t NumOps() const;
+
+    SizeVector GetShape() const;
+    Dtype GetDtype() const;
+    Device GetDevice() const;
+
+protected:
+    struct Node;
+
+    LazyTensor(const std::shared_ptr<Node>& node) : node_(node) {}
+
+    template <typename T>
+    LazyTensor Scalar(T scalar_value) const {
+        return LazyTensor(
+                Tensor::Full({}, scalar_value, GetDtype(), GetDevice()));
+    }
+
+    LazyTensor Unary(kernel::UnaryEWOpCode op_code) const;
+    LazyTensor Binary(const LazyTensor& value,
+                      kernel::BinaryEWOpCode op_code) const;
+
+    /// Bounds the fused region rooted at every node by the kernel limits,
+    /// materializing sub-expressions that would exceed them.
+    static void Partition(Node* node);
+
+    /// Evaluates the partitioned expression rooted at \p root in one kernel.
+    static Tensor EvaluateFused(const Node* root);
+
+protected:
+    std::shared_ptr<Node> node_;
+};
+
+inline LazyTensor operator+(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Add(rhs);
+}
+
+inline LazyTensor operator-(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Sub(rhs);
+}
+
+inline LazyTensor operator*(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Mul(rhs);
+}
+
+inline LazyTensor operator/(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Div(rhs);
+}
+
+}  // namespace open3d
@@ -26,8 +26,13 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/Device.h"
@@ -36,11 +41,149 @@
 
 namespace open3d {
 
+/// Number of buckets of MemoryStatistics::size_histogram_, one per bit width
+/// of size_t plus one for 0 bytes.
+static constexpr int kNumSizeBuckets = 8 * sizeof(size_t) + 1;
+
+/// Records the usage statistics and live allocations of all devices.
+class MemoryUsageTracker {
+public:
+    static MemoryUsageTracker& GetInstance() {
+        // Never destroyed, such that Blobs can still be freed during static
+        // destruction.
+        static MemoryUsageTracker* tracker = new MemoryUsageTracker();
+        return *tracker;
+    }
+
+    void RecordMalloc(void* ptr, size_t byte_size, const Device& device) {
+        std::string site;
+        if (site_tracking_enabled_) {
+            site = GetCurrentSite();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceUsage& usage = GetDeviceUsage(device);
+        MemoryStatistics& stats = usage.stats_;
+        stats.num_allocations_++;
+        stats.size_histogram_[GetSizeBucket(byte_size)]++;
+        if (ptr == nullptr) {
+            return;
+        }
+        usage.allocations_[ptr] = Allocation{byte_size, std::move(site)};
+        stats.num_live_allocations_++;
+        stats.bytes_in_use_ += byte_size;
+        stats.peak_bytes_in_use_ =
+                std::max(stats.peak_bytes_in_use_, stats.bytes_in_use_);
+    }
+
+    void RecordFree(void* ptr, const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceUsage& usage = GetDeviceUsage(device);
+        usage.stats_.num_frees_++;
+        auto it = usage.allocations_.find(ptr);
+        if (it == usage.allocations_.end()) {
+            return;
+        }
+        usage.stats_.num_live_allocations_--;
+        usage.stats_.bytes_in_use_ -= it->second.byte_size_;
+        usage.allocations_.erase(it);
+    }
+
+    MemoryStatistics GetStatistics(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return GetDeviceUsage(device).stats_;
+    }
+
+    void ResetStatistics(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        MemoryStatistics& stats = GetDeviceUsage(device).stats_;
+        stats.peak_bytes_in_use_ = stats.bytes_in_use_;
+        stats.num_allocations_ = 0;
+        stats.num_frees_ = 0;
+        std::fill(stats.size_histogram_.begin(), stats.size_histogram_.end(),
+                  0);
+    }
+
+    std::vector<MemoryAllocationRecord> GetLiveAllocations(
+            const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<MemoryAllocationRecord> records;
+        for (const auto& kv : GetDeviceUsage(device).allocations_) {
+            MemoryAllocationRecord record;
+            record.ptr_ = kv.first;
+            record.byte_size_ = kv.second.byte_size_;
+            record.site_ = kv.second.site_;
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    void SetSiteTrackingEnabled(bool enabled) {
+        site_tracking_enabled_ = enabled;
+    }
+
+    bool IsSiteTrackingEnabled() const { return site_tracking_enabled_; }
+
+    /// Stack of the MemoryAllocationSite names of the calling thread.
+    static std::vector<std::string>& GetSiteStack() {
+        static thread_local std::vector<std::string> site_stack;
+        return site_stack;
+    }
+
+protected:
+    struct Allocation {
+        size_t byte_size_;
+        std::string site_;
+    };
+
+    struct DeviceUsage {
+        DeviceUsage() { stats_.size_histogram_.resize(kNumSizeBuckets, 0); }
+        MemoryStatistics stats_;
+        std::unordered_map<void*, Allocation> allocations_;
+    };
+
+    /// mutex_ must be held.
+    DeviceUsage& GetDeviceUsage(const Device& device) {
+        return usages_[std::make_pair(device.GetType(), device.GetID())];
+    }
+
+    static int GetSizeBucket(size_t byte_size) {
+        int bucket = 0;
+        while (byte_size > 0) {
+            byte_size >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    static std::string GetCurrentSite() {
+        std::string site;
+        for (const std::string& name : GetSiteStack()) {
+            site += site.empty() ? name : "/" + name;
+        }
+        return site;
+    }
+
+    std::mutex mutex_;
+    std::map<std::pair<Device::DeviceType, int>, DeviceUsage> usages_;
+    std::atomic<bool> site_tracking_enabled_{false};
+};
+
+MemoryAllocationSite::MemoryAllocationSite(const std::string& name) {
+    MemoryUsageTracker::GetSiteStack().push_back(name);
+}
+
+MemoryAllocationSite::~MemoryAllocationSite() {
+    MemoryUsageTracker::GetSiteStack().pop_back();
+}
+
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
-    return GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    void* ptr = GetDeviceMemoryManager(device)->Malloc(byte_size, device);
+    MemoryUsageTracker::GetInstance().RecordMalloc(ptr, byte_size, device);
+    return ptr;
 }
 
 void MemoryManager::Free(void* ptr, const Device& device) {
+    MemoryUsageTracker::GetInstance().RecordFree(ptr, device);
     return GetDeviceMemoryManager(device)->Free(ptr, device);
 }
 
@@ -92,17 +235,78 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::SetCacheEnabled(Device::DeviceType device_type,
+                                    bool enabled) {
+    GetCachedMemoryManager(Device(device_type, 0))->SetEnabled(enabled);
+}
+
+bool MemoryManager::IsCacheEnabled(Device::DeviceType device_type) {
+    return GetCachedMemoryManager(Device(device_type, 0))->IsEnabled();
+}
+
+void MemoryManager::EmptyCache(const Device& device) {
+    GetCachedMemoryManager(device)->EmptyCache(device);
+}
+
+MemoryCacheStatistics MemoryManager::GetCacheStatistics(const Device& device) {
+    return GetCachedMemoryManager(device)->GetStatistics(device);
+}
+
+MemoryStatistics MemoryManager::GetMemoryStatistics(const Device& device) {
+    return MemoryUsageTracker::GetInstance().GetStatistics(device);
+}
+
+void MemoryManager::ResetMemoryStatistics(const Device& device) {
+    MemoryUsageTracker::GetInstance().ResetStatistics(device);
+}
+
+void MemoryManager::SetSiteTrackingEnabled(bool enabled) {
+    MemoryUsageTracker::GetInstance().SetSiteTrackingEnabled(enabled);
+}
+
+bool MemoryManager::IsSiteTrackingEnabled() {
+    return MemoryUsageTracker::GetInstance().IsSiteTrackingEnabled();
+}
+
+std::vector<MemoryAllocationRecord> MemoryManager::GetLiveAllocations(
+        const Device& device) {
+    return MemoryUsageTracker::GetInstance().GetLiveAllocations(device);
+}
+
+void* MemoryManager::MallocPinned(size_t byte_size) {
+    return GetPinnedMemoryManager()->Malloc(byte_size, Device("CPU:0"));
+}
+
+void MemoryManager::FreePinned(void* ptr) {
+    GetPinnedMemoryManager()->Free(ptr, Device("CPU:0"));
+}
+
+bool MemoryManager::IsPinned(const void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    return CUDAMemoryManager::IsPinnedHostPointer(ptr);
+#else
+    return false;
+#endif
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
+    return GetCachedMemoryManager(device);
+}
+
+std::shared_ptr<CachedMemoryManager> MemoryManager::GetCachedMemoryManager(
+        const Device& device) {
     static std::unordered_map<Device::DeviceType,
-                              std::shared_ptr<DeviceMemoryManager>,
+                              std::shared_ptr<CachedMemoryManager>,
                               utility::hash_enum_class::hash>
             map_device_type_to_memory_manager = {
                     {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                     std::make_shared<CachedMemoryManager>(
+                             std::make_shared<CPUMemoryManager>(), false)},
 #ifdef BUILD_CUDA_MODULE
                     {Device::DeviceType::CUDA,
-                     std::make_shared<CUDAMemoryManager>()},
+                     std::make_shared<CachedMemoryManager>(
+                             std::make_shared<CUDAMemoryManager>(), true)},
 #endif
             };
     if (map_device_type_to_memory_manager.find(device.GetType()) ==
@@ -113,4 +317,16 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
     return map_device_type_to_memory_manager.at(device.GetType());
 }
 
+std::shared_ptr<CachedMemoryManager> MemoryManager::GetPinnedMemoryManager() {
+#ifdef BUILD_CUDA_MODULE
+    static std::shared_ptr<CachedMemoryManager> pinned_memory_manager =
+            std::make_shared<CachedMemoryManager>(
+                    std::make_shared<CUDAHostMemoryManager>(), true);
+    return pinned_memory_manager;
+#else
+    utility::LogError("Not compiled with CUDA, pinned memory is unavailable.");
+    return nullptr;
+#endif
+}
+
 }  // namespace open3d
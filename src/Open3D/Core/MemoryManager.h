@@ -26,17 +26,89 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Open3D/Core/Device.h"
 
 namespace open3d {
 
 class DeviceMemoryManager;
+class CachedMemoryManager;
+
+/// Statistics of the caching allocator of a single device. All sizes are in
+/// bytes.
+struct MemoryCacheStatistics {
+    /// Bytes currently handed out to callers (after rounding).
+    size_t bytes_in_use_ = 0;
+    /// Bytes currently held from the device, including cached free blocks.
+    size_t bytes_reserved_ = 0;
+    /// Maximum of bytes_in_use_ since the start of the program.
+    size_t peak_bytes_in_use_ = 0;
+    /// Number of Malloc calls served from cached blocks.
+    int64_t num_cache_hits_ = 0;
+    /// Number of Malloc calls that required a new device allocation.
+    int64_t num_cache_misses_ = 0;
+};
+
+/// Memory usage statistics of a single device, counted at MemoryManager::Malloc
+/// and MemoryManager::Free. Unlike MemoryCacheStatistics, sizes are the
+/// requested sizes in bytes, independent of the caching allocator.
+struct MemoryStatistics {
+    /// Bytes currently allocated.
+    size_t bytes_in_use_ = 0;
+    /// Maximum of bytes_in_use_ since the last reset.
+    size_t peak_bytes_in_use_ = 0;
+    /// Number of allocations currently alive.
+    int64_t num_live_allocations_ = 0;
+    /// Number of Malloc calls since the last reset.
+    int64_t num_allocations_ = 0;
+    /// Number of Free calls since the last reset.
+    int64_t num_frees_ = 0;
+    /// Histogram of the sizes of the Malloc calls since the last reset.
+    /// size_histogram_[0] counts 0-byte allocations and size_histogram_[i]
+    /// counts sizes in [2^(i - 1), 2^i).
+    std::vector<int64_t> size_histogram_;
+};
+
+/// A live allocation recorded by MemoryManager.
+struct MemoryAllocationRecord {
+    void* ptr_ = nullptr;
+    size_t byte_size_ = 0;
+    /// Allocation site, see MemoryAllocationSite. Empty if site tracking was
+    /// disabled at allocation time or no site was set.
+    std::string site_;
+};
+
+/// Names the allocations made by the calling thread while the object is in
+/// scope, if site tracking is enabled with
+/// MemoryManager::SetSiteTrackingEnabled(). Nested sites are joined with "/".
+///
+/// Example:
+/// ```cpp
+/// MemoryManager::SetSiteTrackingEnabled(true);
+/// {
+///     MemoryAllocationSite site("Integrate");
+///     volume.Integrate(depth, color);
+/// }
+/// for (const auto& record : MemoryManager::GetLiveAllocations(device)) {
+///     utility::LogInfo("{}: {} bytes", record.site_, record.byte_size_);
+/// }
+/// ```
+class MemoryAllocationSite {
+public:
+    MemoryAllocationSite(const std::string& name);
+    ~MemoryAllocationSite();
+
+    MemoryAllocationSite(const MemoryAllocationSite&) = delete;
+    MemoryAllocationSite& operator=(const MemoryAllocationSite&) = delete;
+};
 
 class MemoryManager {
 public:
@@ -58,9 +130,59 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Enable or disable the caching allocator for all devices of
+    /// \p device_type. By default, caching is enabled for CUDA and disabled
+    /// for CPU. Blocks allocated before disabling the cache can still be freed
+    /// safely.
+    static void SetCacheEnabled(Device::DeviceType device_type, bool enabled);
+
+    /// Returns true if the caching allocator is enabled for \p device_type.
+    static bool IsCacheEnabled(Device::DeviceType device_type);
+
+    /// Release all cached blocks of \p device that are currently not in use
+    /// back to the device.
+    static void EmptyCache(const Device& device);
+
+    /// Returns caching allocator statistics for \p device.
+    static MemoryCacheStatistics GetCacheStatistics(const Device& device);
+
+    /// Returns memory usage statistics of \p device.
+    static MemoryStatistics GetMemoryStatistics(const Device& device);
+
+    /// Resets the peak usage of \p device to its current usage and clears
+    /// the Malloc and Free counters and the size histogram. Live allocations
+    /// are still tracked.
+    static void ResetMemoryStatistics(const Device& device);
+
+    /// Enable or disable recording of allocation sites. Disabled by default.
+    static void SetSiteTrackingEnabled(bool enabled);
+
+    static bool IsSiteTrackingEnabled();
+
+    /// Returns all live allocations of \p device, e.g. to find leaks in
+    /// long-running jobs.
+    static std::vector<MemoryAllocationRecord> GetLiveAllocations(
+            const Device& device);
+
+    /// Allocates page-locked host memory. Copies between pinned host memory
+    /// and CUDA devices run at full PCIe bandwidth and can be asynchronous on
+    /// non-default streams. Pinned allocations are cached. Requires CUDA.
+    static void* MallocPinned(size_t byte_size);
+
+    /// Frees memory allocated by MallocPinned.
+    static void FreePinned(void* ptr);
+
+    /// Returns true if \p ptr points to page-locked host memory.
+    static bool IsPinned(const void* ptr);
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
+
+    static std::shared_ptr<CachedMemoryManager> GetCachedMemoryManager(
+            const Device& device);
+
+    static std::shared_ptr<CachedMemoryManager> GetPinnedMemoryManager();
 };
 
 class DeviceMemoryManager {
@@ -74,6 +196,33 @@ public:
                         size_t num_bytes) = 0;
 };
 
+/// Placement of the pages of large CPU allocations on the NUMA nodes of the
+/// machine, see CPUMemoryManager::SetAllocationPolicy(). Only used on Linux;
+/// elsewhere all blocks come from malloc.
+struct CPUAllocationPolicy {
+    enum class Placement {
+        /// Blocks come from malloc, and the pages end up on the node of the
+        /// thread that writes them first, usually the allocating thread.
+        Default,
+        /// The pages are written once in parallel with utility::ParallelFor
+        /// when the block is allocated, which spreads them over the nodes of
+        /// all threads like the parallel loops that later process the block.
+        FirstTouch,
+        /// The pages are interleaved over all nodes, which balances the
+        /// bandwidth when the access pattern is not known.
+        Interleaved,
+        /// The pages are placed on the node of the thread that writes them
+        /// first, even if the process has another memory policy.
+        Local,
+    };
+    Placement placement_ = Placement::Default;
+    /// Whether large blocks are aligned to and backed by transparent huge
+    /// pages, which saves TLB misses on large arrays.
+    bool huge_pages_ = false;
+    /// Blocks smaller than this size in bytes always come from malloc.
+    size_t large_block_size_ = size_t(1) << 21;
+};
+
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
     CPUMemoryManager();
@@ -84,6 +233,62 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+    /// Sets the policy of the CPU allocations made afterwards, including the
+    /// segments of the caching allocator. Blocks allocated before can still
+    /// be freed.
+    static void SetAllocationPolicy(const CPUAllocationPolicy& policy);
+
+    static CPUAllocationPolicy GetAllocationPolicy();
+};
+
+/// CachedMemoryManager wraps a DeviceMemoryManager and recycles freed blocks
+/// instead of returning them to the device immediately.
+///
+/// Requests are rounded up to multiples of 512 bytes. Small requests
+/// (<= 1MB) are carved out of 2MB segments, while large requests get their own
+/// segment rounded up to a multiple of 2MB. A cached block that is larger than
+/// the request is split and the remainder is kept in the cache. Adjacent free
+/// blocks of the same segment are merged when freed. Each device id has its
+/// own block pools.
+///
+/// Cached segments are only returned to the device by EmptyCache(), or when a
+/// new device allocation fails.
+class CachedMemoryManager : public DeviceMemoryManager {
+public:
+    CachedMemoryManager(const std::shared_ptr<DeviceMemoryManager>& device_mm,
+                        bool enabled);
+    ~CachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+    void SetEnabled(bool enabled) { enabled_ = enabled; }
+    bool IsEnabled() const { return enabled_; }
+
+    /// Release all free segments of \p device to the underlying manager.
+    void EmptyCache(const Device& device);
+
+    MemoryCacheStatistics GetStatistics(const Device& device);
+
+protected:
+    struct Block;
+    struct BlockPool;
+
+    /// Returns the block pool of \p device. mutex_ must be held.
+    BlockPool& GetBlockPool(const Device& device);
+
+    /// Release all free segments in \p pool. mutex_ must be held.
+    void ReleaseFreeSegments(BlockPool& pool, const Device& device);
+
+    std::shared_ptr<DeviceMemoryManager> device_mm_;
+    std::atomic<bool> enabled_;
+    std::mutex mutex_;
+    std::unordered_map<int, std::unique_ptr<BlockPool>> pools_;
 };
 
 #ifdef BUILD_CUDA_MODULE
@@ -98,9 +303,26 @@ public:
                 const Device& src_device,
                 size_t num_bytes) override;
 
+    /// Returns true if \p ptr points to page-locked host memory.
+    static bool IsPinnedHostPointer(const void* ptr);
+
 protected:
     bool IsCUDAPointer(const void* ptr);
 };
+
+/// CUDAHostMemoryManager allocates page-locked host memory that is accessible
+/// from all CUDA devices. The memory is addressed as CPU memory.
+class CUDAHostMemoryManager : public DeviceMemoryManager {
+public:
+    CUDAHostMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+};
 #endif
 
 }  // namespace open3d
@@ -26,14 +26,131 @@
 
 #include "Open3D/Core/MemoryManager.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
+namespace {
+
+/// The allocation policy, and the blocks that were mapped for it with their
+/// mapped sizes. Never destroyed, such that Blobs can still be freed during
+/// static destruction.
+struct CPUAllocationState {
+    static CPUAllocationState& GetInstance() {
+        static CPUAllocationState* state = new CPUAllocationState();
+        return *state;
+    }
+
+    std::mutex mutex_;
+    CPUAllocationPolicy policy_;
+    std::unordered_map<void*, size_t> mapped_sizes_;
+};
+
+#ifdef __linux__
+// Memory policies of mbind, from <linux/mempolicy.h>.
+constexpr int kMPolInterleave = 3;
+constexpr int kMPolLocal = 4;
+
+constexpr size_t kHugePageSize = size_t(1) << 21;
+
+size_t RoundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+/// Maps byte_size bytes with the placement and huge pages of policy. Returns
+/// nullptr if the mapping fails.
+void* MapBlock(size_t byte_size,
+               const CPUAllocationPolicy& policy,
+               size_t& mapped_size) {
+    const size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+    const size_t alignment =
+            policy.huge_pages_ ? std::max(kHugePageSize, page_size)
+                               : page_size;
+    mapped_size = RoundUp(byte_size, alignment);
+    // Over-allocate to align the block, then unmap the excess at both ends.
+    const size_t reserved_size = mapped_size + alignment - page_size;
+    void* reserved = mmap(nullptr, reserved_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        return nullptr;
+    }
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(reserved);
+    const uintptr_t aligned = RoundUp(begin, alignment);
+    const uintptr_t end = begin + reserved_size;
+    if (aligned > begin) {
+        munmap(reserved, aligned - begin);
+    }
+    if (end > aligned + mapped_size) {
+        munmap(reinterpret_cast<void*>(aligned + mapped_size),
+               end - aligned - mapped_size);
+    }
+    void* ptr = reinterpret_cast<void*>(aligned);
+
+#ifdef MADV_HUGEPAGE
+    if (policy.huge_pages_ && madvise(ptr, mapped_size, MADV_HUGEPAGE) != 0) {
+        utility::LogDebug(
+                "CPUMemoryManager: transparent huge pages are unavailable.");
+    }
+#endif
+    // The policy applies to the pages faulted in afterwards.
+    long rc = 0;
+    if (policy.placement_ == CPUAllocationPolicy::Placement::Interleaved) {
+        // Nodes that do not exist or are not allowed are ignored.
+        const unsigned long all_nodes = ~0ul;
+        rc = syscall(SYS_mbind, ptr, mapped_size, kMPolInterleave, &all_nodes,
+                     8 * sizeof(all_nodes) + 1, 0);
+    } else if (policy.placement_ == CPUAllocationPolicy::Placement::Local) {
+        rc = syscall(SYS_mbind, ptr, mapped_size, kMPolLocal, nullptr, 0, 0);
+    }
+    if (rc != 0) {
+        utility::LogDebug(
+                "CPUMemoryManager: mbind failed, the pages are placed by the "
+                "default policy.");
+    }
+    if (policy.placement_ == CPUAllocationPolicy::Placement::FirstTouch) {
+        char* bytes = static_cast<char*>(ptr);
+        utility::ParallelFor(
+                0, int64_t(mapped_size / alignment),
+                [&](int64_t page) { bytes[page * alignment] = 0; });
+    }
+    return ptr;
+}
+#endif
+
+}  // unnamed namespace
+
 CPUMemoryManager::CPUMemoryManager() {}
 
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
+    void* ptr = nullptr;
+#ifdef __linux__
+    CPUAllocationState& state = CPUAllocationState::GetInstance();
+    CPUAllocationPolicy policy = GetAllocationPolicy();
+    if ((policy.placement_ != CPUAllocationPolicy::Placement::Default ||
+         policy.huge_pages_) &&
+        byte_size > 0 && byte_size >= policy.large_block_size_) {
+        size_t mapped_size = 0;
+        ptr = MapBlock(byte_size, policy, mapped_size);
+        if (ptr) {
+            std::lock_guard<std::mutex> lock(state.mutex_);
+            state.mapped_sizes_[ptr] = mapped_size;
+            return ptr;
+        }
+    }
+#endif
     ptr = std::malloc(byte_size);
     if (byte_size != 0 && !ptr) {
         utility::LogError("CPU malloc failed");
@@ -43,6 +160,22 @@ void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
     if (ptr) {
+#ifdef __linux__
+        CPUAllocationState& state = CPUAllocationState::GetInstance();
+        size_t mapped_size = 0;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex_);
+            auto it = state.mapped_sizes_.find(ptr);
+            if (it != state.mapped_sizes_.end()) {
+                mapped_size = it->second;
+                state.mapped_sizes_.erase(it);
+            }
+        }
+        if (mapped_size > 0) {
+            munmap(ptr, mapped_size);
+            return;
+        }
+#endif
         std::free(ptr);
     }
 }
@@ -55,4 +188,16 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::SetAllocationPolicy(const CPUAllocationPolicy& policy) {
+    CPUAllocationState& state = CPUAllocationState::GetInstance();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    state.policy_ = policy;
+}
+
+CPUAllocationPolicy CPUMemoryManager::GetAllocationPolicy() {
+    CPUAllocationState& state = CPUAllocationState::GetInstance();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    return state.policy_;
+}
+
 }  // namespace open3d
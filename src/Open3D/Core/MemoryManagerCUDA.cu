@@ -29,11 +29,86 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "Open3D/Core/CUDAState.cuh"
+#include "Open3D/Core/CUDAStream.h"
 #include "Open3D/Core/CUDAUtils.h"
 
 namespace open3d {
 
+/// Pinned host buffers for asynchronous host-to-device copies from pageable
+/// memory. The source is copied into a pinned buffer on the host, so the
+/// caller may reuse its memory right away, and the DMA transfer overlaps with
+/// host work. A buffer is reused once the copy it staged has completed.
+class PinnedStagingPool {
+public:
+    static PinnedStagingPool& GetInstance() {
+        static PinnedStagingPool instance;
+        return instance;
+    }
+
+    void MemcpyHostToDeviceAsync(void* dst_ptr,
+                                 const void* src_ptr,
+                                 size_t num_bytes,
+                                 cudaStream_t stream) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReclaimCompleted();
+
+        void* staging_ptr = nullptr;
+        size_t staging_size = num_bytes;
+        auto it = free_buffers_.lower_bound(num_bytes);
+        if (it != free_buffers_.end()) {
+            staging_size = it->first;
+            staging_ptr = it->second;
+            free_buffers_.erase(it);
+        } else {
+            OPEN3D_CUDA_CHECK(cudaHostAlloc(&staging_ptr, num_bytes,
+                                            cudaHostAllocPortable));
+        }
+        std::memcpy(staging_ptr, src_ptr, num_bytes);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, staging_ptr, num_bytes,
+                                          cudaMemcpyHostToDevice, stream));
+
+        cudaEvent_t event;
+        OPEN3D_CUDA_CHECK(
+                cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        OPEN3D_CUDA_CHECK(cudaEventRecord(event, stream));
+        pending_buffers_.push_back({event, staging_size, staging_ptr});
+    }
+
+private:
+    struct PendingBuffer {
+        cudaEvent_t event_;
+        size_t size_;
+        void* ptr_;
+    };
+
+    PinnedStagingPool() {}
+
+    void ReclaimCompleted() {
+        std::vector<PendingBuffer> still_pending;
+        for (const PendingBuffer& buffer : pending_buffers_) {
+            cudaError_t err = cudaEventQuery(buffer.event_);
+            if (err == cudaErrorNotReady) {
+                still_pending.push_back(buffer);
+            } else {
+                OPEN3D_CUDA_CHECK(err);
+                OPEN3D_CUDA_CHECK(cudaEventDestroy(buffer.event_));
+                free_buffers_.emplace(buffer.size_, buffer.ptr_);
+            }
+        }
+        pending_buffers_ = still_pending;
+    }
+
+    std::mutex mutex_;
+    std::multimap<size_t, void*> free_buffers_;
+    std::vector<PendingBuffer> pending_buffers_;
+};
+
 CUDAMemoryManager::CUDAMemoryManager() {}
 
 void* CUDAMemoryManager::Malloc(size_t byte_size, const Device& device) {
@@ -69,16 +144,29 @@ void CUDAMemoryManager::Memcpy(void* dst_ptr,
         if (!IsCUDAPointer(dst_ptr)) {
             utility::LogError("dst_ptr is not a CUDA pointer");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyHostToDevice));
+        cudaStream_t stream = cuda::GetCurrentStream();
+        if (stream == nullptr) {
+            OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
+                                         cudaMemcpyHostToDevice));
+        } else if (IsPinnedHostPointer(src_ptr)) {
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyHostToDevice, stream));
+        } else {
+            PinnedStagingPool::GetInstance().MemcpyHostToDeviceAsync(
+                    dst_ptr, src_ptr, num_bytes, stream);
+        }
     } else if (dst_device.GetType() == Device::DeviceType::CPU &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(src_device);
         if (!IsCUDAPointer(src_ptr)) {
             utility::LogError("src_ptr is not a CUDA pointer");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyDeviceToHost));
+        // The host buffer is read right after returning, so only wait for
+        // the current stream instead of the whole device.
+        cudaStream_t stream = cuda::GetCurrentStream();
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost, stream));
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
     } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(dst_device);
@@ -92,28 +180,49 @@ void CUDAMemoryManager::Memcpy(void* dst_ptr,
 
         if (dst_device == src_device) {
             CUDADeviceSwitcher switcher(src_device);
-            OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                         cudaMemcpyDeviceToDevice));
-        } else if (CUDAState::GetInstance()->IsP2PEnabled(src_device.GetID(),
-                                                          dst_device.GetID())) {
-            OPEN3D_CUDA_CHECK(cudaMemcpyPeer(dst_ptr, dst_device.GetID(),
-                                             src_ptr, src_device.GetID(),
-                                             num_bytes));
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyDeviceToDevice,
+                                              cuda::GetCurrentStream()));
         } else {
-            void* cpu_buf = MemoryManager::Malloc(num_bytes, Device("CPU:0"));
-            CUDADeviceSwitcher switcher(src_device);
-            OPEN3D_CUDA_CHECK(cudaMemcpy(cpu_buf, src_ptr, num_bytes,
-                                         cudaMemcpyDeviceToHost));
+            // The copy runs on the destination's current stream, after the
+            // pending work of the source's current stream. The source stream
+            // in turn waits for the copy, so that later work on it cannot
+            // overwrite the source while it is being read. Neither side
+            // blocks the host. With peer access enabled by CUDAState the data
+            // moves directly between the devices, otherwise the driver stages
+            // it through host memory.
+            CUDAStream src_stream = CUDAStream::GetCurrent(src_device);
+            CUDAStream dst_stream = CUDAStream::GetCurrent(dst_device);
+            CUDAEvent src_ready(src_device);
+            src_ready.Record(src_stream);
+            dst_stream.WaitEvent(src_ready);
             switcher.SwitchTo(dst_device);
-            OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, cpu_buf, num_bytes,
-                                         cudaMemcpyHostToDevice));
-            MemoryManager::Free(cpu_buf, Device("CPU:0"));
+            OPEN3D_CUDA_CHECK(cudaMemcpyPeerAsync(
+                    dst_ptr, dst_device.GetID(), src_ptr, src_device.GetID(),
+                    num_bytes, cuda::GetCurrentStream()));
+            CUDAEvent copy_done(dst_device);
+            copy_done.Record(dst_stream);
+            src_stream.WaitEvent(copy_done);
         }
     } else {
         utility::LogError("Wrong cudaMemcpyKind");
     }
 }
 
+bool CUDAMemoryManager::IsPinnedHostPointer(const void* ptr) {
+    cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+        // Pageable memory is reported as an error by older CUDA versions.
+        cudaGetLastError();
+        return false;
+    }
+#if CUDART_VERSION >= 10000
+    return attributes.type == cudaMemoryTypeHost;
+#else
+    return attributes.memoryType == cudaMemoryTypeHost;
+#endif
+}
+
 bool CUDAMemoryManager::IsCUDAPointer(const void* ptr) {
     cudaPointerAttributes attributes;
     cudaPointerGetAttributes(&attributes, ptr);
@@ -123,4 +232,36 @@ bool CUDAMemoryManager::IsCUDAPointer(const void* ptr) {
     return false;
 }
 
+CUDAHostMemoryManager::CUDAHostMemoryManager() {}
+
+void* CUDAHostMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    void* ptr = nullptr;
+    if (device.GetType() == Device::DeviceType::CPU) {
+        OPEN3D_CUDA_CHECK(
+                cudaHostAlloc(&ptr, byte_size, cudaHostAllocPortable));
+    } else {
+        utility::LogError(
+                "CUDAHostMemoryManager::Malloc: Unimplemented device");
+    }
+    return ptr;
+}
+
+void CUDAHostMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() == Device::DeviceType::CPU) {
+        if (ptr) {
+            OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+        }
+    } else {
+        utility::LogError("CUDAHostMemoryManager::Free: Unimplemented device");
+    }
+}
+
+void CUDAHostMemoryManager::Memcpy(void* dst_ptr,
+                                   const Device& dst_device,
+                                   const void* src_ptr,
+                                   const Device& src_device,
+                                   size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
 }  // namespace open3d
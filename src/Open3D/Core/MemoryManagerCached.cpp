@@ -0,0 +1,247 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "Open3D/Core/MemoryManager.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+/// Requested sizes are rounded up to multiples of kMinBlockSize.
+static constexpr size_t kMinBlockSize = 512;
+/// Requests up to kSmallSize bytes are served from the small pool.
+static constexpr size_t kSmallSize = 1048576;
+/// Segment size of the small pool.
+static constexpr size_t kSmallSegmentSize = 2097152;
+/// Large segments are rounded up to multiples of kLargeRoundSize.
+static constexpr size_t kLargeRoundSize = 2097152;
+
+static size_t RoundUp(size_t byte_size, size_t multiple) {
+    return (byte_size + multiple - 1) / multiple * multiple;
+}
+
+struct CachedMemoryManager::Block {
+    Block(void* ptr, size_t byte_size, bool is_small)
+        : ptr_(ptr), byte_size_(byte_size), is_small_(is_small) {}
+
+    void* ptr_;
+    size_t byte_size_;
+    bool is_small_;
+    bool in_use_ = false;
+    /// Neighbouring blocks in the same segment, nullptr at segment borders.
+    Block* prev_ = nullptr;
+    Block* next_ = nullptr;
+};
+
+struct CachedMemoryManager::BlockPool {
+    struct BlockComparator {
+        bool operator()(const Block* lhs, const Block* rhs) const {
+            if (lhs->byte_size_ != rhs->byte_size_) {
+                return lhs->byte_size_ < rhs->byte_size_;
+            }
+            return lhs->ptr_ < rhs->ptr_;
+        }
+    };
+    typedef std::set<Block*, BlockComparator> FreeBlocks;
+
+    FreeBlocks& GetFreeBlocks(bool is_small) {
+        return is_small ? small_blocks_ : large_blocks_;
+    }
+
+    FreeBlocks small_blocks_;
+    FreeBlocks large_blocks_;
+    std::unordered_map<void*, Block*> allocated_blocks_;
+    MemoryCacheStatistics stats_;
+};
+
+CachedMemoryManager::CachedMemoryManager(
+        const std::shared_ptr<DeviceMemoryManager>& device_mm, bool enabled)
+    : device_mm_(device_mm), enabled_(enabled) {}
+
+// Cached segments are intentionally not released at destruction: this happens
+// at program exit, when the device runtime may already be shut down.
+CachedMemoryManager::~CachedMemoryManager() {}
+
+void* CachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (!enabled_ || byte_size == 0) {
+        return device_mm_->Malloc(byte_size, device);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    BlockPool& pool = GetBlockPool(device);
+    size_t alloc_size = RoundUp(byte_size, kMinBlockSize);
+    bool is_small = alloc_size <= kSmallSize;
+    BlockPool::FreeBlocks& free_blocks = pool.GetFreeBlocks(is_small);
+
+    // Best fit: the smallest cached block that is large enough.
+    Block key(nullptr, alloc_size, is_small);
+    auto it = free_blocks.lower_bound(&key);
+    Block* block = nullptr;
+    if (it != free_blocks.end()) {
+        block = *it;
+        free_blocks.erase(it);
+        pool.stats_.num_cache_hits_++;
+    } else {
+        size_t segment_size = is_small ? kSmallSegmentSize
+                                       : RoundUp(alloc_size, kLargeRoundSize);
+        void* ptr = nullptr;
+        try {
+            ptr = device_mm_->Malloc(segment_size, device);
+        } catch (const std::runtime_error&) {
+            // Return unused segments to the device and retry once.
+            ReleaseFreeSegments(pool, device);
+            ptr = device_mm_->Malloc(segment_size, device);
+        }
+        block = new Block(ptr, segment_size, is_small);
+        pool.stats_.bytes_reserved_ += segment_size;
+        pool.stats_.num_cache_misses_++;
+    }
+
+    // Split the block if the remainder is worth keeping in the cache.
+    size_t remaining = block->byte_size_ - alloc_size;
+    if ((is_small && remaining >= kMinBlockSize) ||
+        (!is_small && remaining > kSmallSize)) {
+        Block* remainder = new Block(static_cast<char*>(block->ptr_) +
+                                             alloc_size,
+                                     remaining, is_small);
+        remainder->prev_ = block;
+        remainder->next_ = block->next_;
+        if (block->next_) {
+            block->next_->prev_ = remainder;
+        }
+        block->next_ = remainder;
+        block->byte_size_ = alloc_size;
+        free_blocks.insert(remainder);
+    }
+
+    block->in_use_ = true;
+    pool.allocated_blocks_[block->ptr_] = block;
+    pool.stats_.bytes_in_use_ += block->byte_size_;
+    pool.stats_.peak_bytes_in_use_ = std::max(pool.stats_.peak_bytes_in_use_,
+                                              pool.stats_.bytes_in_use_);
+    return block->ptr_;
+}
+
+void CachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (!ptr) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        BlockPool& pool = GetBlockPool(device);
+        auto it = pool.allocated_blocks_.find(ptr);
+        if (it != pool.allocated_blocks_.end()) {
+            Block* block = it->second;
+            pool.allocated_blocks_.erase(it);
+            pool.stats_.bytes_in_use_ -= block->byte_size_;
+            block->in_use_ = false;
+
+            // Merge with free neighbours of the same segment.
+            BlockPool::FreeBlocks& free_blocks =
+                    pool.GetFreeBlocks(block->is_small_);
+            Block* prev = block->prev_;
+            if (prev && !prev->in_use_) {
+                free_blocks.erase(prev);
+                prev->byte_size_ += block->byte_size_;
+                prev->next_ = block->next_;
+                if (block->next_) {
+                    block->next_->prev_ = prev;
+                }
+                delete block;
+                block = prev;
+            }
+            Block* next = block->next_;
+            if (next && !next->in_use_) {
+                free_blocks.erase(next);
+                block->byte_size_ += next->byte_size_;
+                block->next_ = next->next_;
+                if (next->next_) {
+                    next->next_->prev_ = block;
+                }
+                delete next;
+            }
+            free_blocks.insert(block);
+            return;
+        }
+    }
+
+    // Not allocated by the cache, e.g. allocated while caching was disabled.
+    device_mm_->Free(ptr, device);
+}
+
+void CachedMemoryManager::Memcpy(void* dst_ptr,
+                                 const Device& dst_device,
+                                 const void* src_ptr,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    device_mm_->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+}
+
+void CachedMemoryManager::EmptyCache(const Device& device) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseFreeSegments(GetBlockPool(device), device);
+}
+
+MemoryCacheStatistics CachedMemoryManager::GetStatistics(
+        const Device& device) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return GetBlockPool(device).stats_;
+}
+
+CachedMemoryManager::BlockPool& CachedMemoryManager::GetBlockPool(
+        const Device& device) {
+    std::unique_ptr<BlockPool>& pool = pools_[device.GetID()];
+    if (!pool) {
+        pool.reset(new BlockPool());
+    }
+    return *pool;
+}
+
+void CachedMemoryManager::ReleaseFreeSegments(BlockPool& pool,
+                                              const Device& device) {
+    for (bool is_small : {true, false}) {
+        BlockPool::FreeBlocks& free_blocks = pool.GetFreeBlocks(is_small);
+        std::vector<Block*> segments;
+        for (Block* block : free_blocks) {
+            // A free block without neighbours spans its whole segment.
+            if (!block->prev_ && !block->next_) {
+                segments.push_back(block);
+            }
+        }
+        for (Block* block : segments) {
+            free_blocks.erase(block);
+            device_mm_->Free(block->ptr_, device);
+            pool.stats_.bytes_reserved_ -= block->byte_size_;
+            delete block;
+        }
+    }
+}
+
+}  // namespace open3d
@@ -0,0 +1,349 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NNS/NearestNeighborSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/Kernel/Scan.h"
+#include "Open3D/Core/Kernel/Sort.h"
+#include "Open3D/Core/NNS/NearestNeighborSearchKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace nns {
+
+/// Points per cell KnnIndex aims at.
+static constexpr double KNN_POINTS_PER_CELL = 4.0;
+
+/// Minimum number of buckets of a grid.
+static constexpr int64_t MIN_NUM_BUCKETS = 16;
+
+/// Calls the CPU or CUDA variant of a bulk kernel, depending on \p device.
+#ifdef BUILD_CUDA_MODULE
+#define NNS_KERNEL(DEVICE, NAME, ...)                                       \
+    do {                                                                    \
+        if ((DEVICE).GetType() == Device::DeviceType::CUDA) {               \
+            NAME##CUDA(__VA_ARGS__);                                        \
+        } else {                                                            \
+            NAME##CPU(__VA_ARGS__);                                         \
+        }                                                                   \
+    } while (0)
+#else
+#define NNS_KERNEL(DEVICE, NAME, ...)                                       \
+    do {                                                                    \
+        if ((DEVICE).GetType() == Device::DeviceType::CUDA) {               \
+            utility::LogError(                                              \
+                    "Not compiled with CUDA, but CUDA device is used.");    \
+        } else {                                                            \
+            NAME##CPU(__VA_ARGS__);                                         \
+        }                                                                   \
+    } while (0)
+#endif
+
+static void AssertPoints(const char* name, const Tensor& points) {
+    if (points.NumDims() != 2 || points.GetShape(1) != 3) {
+        utility::LogError("Expected {} of shape (N, 3), but got {}.", name,
+                          points.GetShape());
+    }
+    if (points.GetDtype() != Dtype::Float32 &&
+        points.GetDtype() != Dtype::Float64) {
+        utility::LogError(
+                "Expected {} of dtype Float32 or Float64, but got {}.", name,
+                DtypeUtil::ToString(points.GetDtype()));
+    }
+}
+
+template <typename scalar_t>
+static GridView<scalar_t> MakeView(const Tensor& sorted_points,
+                                   const Tensor& sorted_cells,
+                                   const Tensor& point_indices,
+                                   const Tensor& bucket_offsets,
+                                   int64_t num_buckets,
+                                   double cell_size,
+                                   const int64_t* min_cell,
+                                   const int64_t* max_cell) {
+    GridView<scalar_t> view;
+    view.points_ = static_cast<const scalar_t*>(sorted_points.GetDataPtr());
+    view.cells_ = static_cast<const int32_t*>(sorted_cells.GetDataPtr());
+    view.point_indices_ =
+            static_cast<const int64_t*>(point_indices.GetDataPtr());
+    view.bucket_offsets_ =
+            static_cast<const int64_t*>(bucket_offsets.GetDataPtr());
+    view.num_buckets_ = num_buckets;
+    view.cell_size_ = static_cast<scalar_t>(cell_size);
+    std::copy(min_cell, min_cell + 3, view.min_cell_);
+    std::copy(max_cell, max_cell + 3, view.max_cell_);
+    return view;
+}
+
+NearestNeighborSearch::NearestNeighborSearch(const Tensor& dataset_points) {
+    AssertPoints("dataset points", dataset_points);
+    dataset_points_ = dataset_points.Contiguous();
+}
+
+void NearestNeighborSearch::KnnIndex() {
+    const int64_t num_points = dataset_points_.GetShape(0);
+    if (num_points == 0) {
+        utility::LogError("Cannot build an index of 0 points.");
+    }
+    Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) = dataset_points_.MinMax({0});
+    const Tensor extent =
+            (max_bound - min_bound).To(Dtype::Float64).Copy(Device("CPU:0"));
+    std::vector<double> extents = extent.ToFlatVector<double>();
+    std::sort(extents.begin(), extents.end(), std::greater<double>());
+
+    // Fit the cell size to the number of dimensions the points span, so that
+    // flat or linear datasets do not end up with very large cells.
+    const double cells = num_points / KNN_POINTS_PER_CELL;
+    double cell_size = std::cbrt(extents[0] * extents[1] * extents[2] / cells);
+    if (cell_size > 0 && cell_size <= extents[2]) {
+        BuildIndex(cell_size);
+        return;
+    }
+    cell_size = std::sqrt(extents[0] * extents[1] / cells);
+    if (cell_size > 0 && cell_size <= extents[1]) {
+        BuildIndex(cell_size);
+        return;
+    }
+    cell_size = extents[0] / cells;
+    BuildIndex(cell_size > 0 && cell_size <= extents[0] ? cell_size : 1.0);
+}
+
+void NearestNeighborSearch::FixedRadiusIndex(double radius) {
+    if (radius <= 0) {
+        utility::LogError("Radius must be positive, but got {}.", radius);
+    }
+    BuildIndex(radius);
+}
+
+void NearestNeighborSearch::HybridIndex(double radius) {
+    FixedRadiusIndex(radius);
+}
+
+void NearestNeighborSearch::BuildIndex(double cell_size) {
+    const int64_t num_points = dataset_points_.GetShape(0);
+    if (num_points == 0) {
+        utility::LogError("Cannot build an index of 0 points.");
+    }
+    const Device device = dataset_points_.GetDevice();
+    const Dtype dtype = dataset_points_.GetDtype();
+
+    // Cell range, from the bounds of the points.
+    Tensor min_bound, max_bound;
+    std::tie(min_bound, max_bound) = dataset_points_.MinMax({0});
+    const Device host("CPU:0");
+    std::vector<double> min_vec =
+            min_bound.To(Dtype::Float64).Copy(host).ToFlatVector<double>();
+    std::vector<double> max_vec =
+            max_bound.To(Dtype::Float64).Copy(host).ToFlatVector<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        for (int d = 0; d < 3; ++d) {
+            min_cell_[d] = CellCoord(static_cast<scalar_t>(min_vec[d]),
+                                     static_cast<scalar_t>(cell_size));
+            max_cell_[d] = CellCoord(static_cast<scalar_t>(max_vec[d]),
+                                     static_cast<scalar_t>(cell_size));
+            if (min_cell_[d] < std::numeric_limits<int32_t>::min() ||
+                max_cell_[d] > std::numeric_limits<int32_t>::max()) {
+                utility::LogError(
+                        "Cell size {} is too small for points in [{}, {}].",
+                        cell_size, min_vec[d], max_vec[d]);
+            }
+        }
+    });
+
+    num_buckets_ = MIN_NUM_BUCKETS;
+    while (num_buckets_ < num_points) {
+        num_buckets_ *= 2;
+    }
+    Tensor cells({num_points, 3}, Dtype::Int32, device);
+    Tensor buckets({num_points}, Dtype::Int64, device);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        NNS_KERNEL(device, ComputeCells,
+                   static_cast<const scalar_t*>(dataset_points_.GetDataPtr()),
+                   num_points, static_cast<scalar_t>(cell_size), num_buckets_,
+                   static_cast<int32_t*>(cells.GetDataPtr()),
+                   static_cast<int64_t*>(buckets.GetDataPtr()));
+    });
+
+    // The sort is stable, so points of a cell keep their dataset order.
+    point_indices_ = kernel::ArgSort(buckets);
+    sorted_points_ = dataset_points_.IndexGet({point_indices_});
+    sorted_cells_ = cells.IndexGet({point_indices_});
+    Tensor sorted_buckets = buckets.IndexGet({point_indices_});
+    bucket_offsets_ = Tensor({num_buckets_ + 1}, Dtype::Int64, device);
+    NNS_KERNEL(device, ComputeBucketOffsets,
+               static_cast<const int64_t*>(sorted_buckets.GetDataPtr()),
+               num_points, num_buckets_,
+               static_cast<int64_t*>(bucket_offsets_.GetDataPtr()));
+    cell_size_ = cell_size;
+}
+
+void NearestNeighborSearch::AssertQueryPoints(
+        const Tensor& query_points) const {
+    if (cell_size_ == 0) {
+        utility::LogError(
+                "No index has been built, call KnnIndex, FixedRadiusIndex or "
+                "HybridIndex first.");
+    }
+    AssertPoints("query points", query_points);
+    if (query_points.GetDtype() != GetDtype()) {
+        utility::LogError("Query dtype {} does not match dataset dtype {}.",
+                          DtypeUtil::ToString(query_points.GetDtype()),
+                          DtypeUtil::ToString(GetDtype()));
+    }
+    if (query_points.GetDevice() != GetDevice()) {
+        utility::LogError("Query device {} does not match dataset device {}.",
+                          query_points.GetDevice().ToString(),
+                          GetDevice().ToString());
+    }
+}
+
+template <typename scalar_t>
+GridView<scalar_t> NearestNeighborSearch::GetGridView() const {
+    if (cell_size_ == 0) {
+        utility::LogError(
+                "No index has been built, call KnnIndex, FixedRadiusIndex or "
+                "HybridIndex first.");
+    }
+    if (DtypeUtil::FromType<scalar_t>() != GetDtype()) {
+        utility::LogError("Requested a grid view of dtype {}, but the dataset "
+                          "has dtype {}.",
+                          DtypeUtil::ToString(DtypeUtil::FromType<scalar_t>()),
+                          DtypeUtil::ToString(GetDtype()));
+    }
+    return MakeView<scalar_t>(sorted_points_, sorted_cells_, point_indices_,
+                              bucket_offsets_, num_buckets_, cell_size_,
+                              min_cell_, max_cell_);
+}
+
+template GridView<float> NearestNeighborSearch::GetGridView<float>() const;
+template GridView<double> NearestNeighborSearch::GetGridView<double>() const;
+
+std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
+        const Tensor& query_points, int knn) const {
+    AssertQueryPoints(query_points);
+    if (knn <= 0) {
+        utility::LogError("knn must be positive, but got {}.", knn);
+    }
+    const Device device = GetDevice();
+    const int64_t num_queries = query_points.GetShape(0);
+    const int64_t k = std::min<int64_t>(knn, dataset_points_.GetShape(0));
+    Tensor queries = query_points.Contiguous();
+    Tensor indices({num_queries, k}, Dtype::Int64, device);
+    Tensor distances2({num_queries, k}, GetDtype(), device);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        GridView<scalar_t> view = MakeView<scalar_t>(
+                sorted_points_, sorted_cells_, point_indices_,
+                bucket_offsets_, num_buckets_, cell_size_, min_cell_,
+                max_cell_);
+        NNS_KERNEL(device, KnnSearch, view,
+                   static_cast<const scalar_t*>(queries.GetDataPtr()),
+                   num_queries, k, static_cast<int64_t*>(indices.GetDataPtr()),
+                   static_cast<scalar_t*>(distances2.GetDataPtr()));
+    });
+    return std::make_pair(indices, distances2);
+}
+
+std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
+        const Tensor& query_points, double radius) const {
+    AssertQueryPoints(query_points);
+    if (radius <= 0) {
+        utility::LogError("Radius must be positive, but got {}.", radius);
+    }
+    const Device device = GetDevice();
+    const int64_t num_queries = query_points.GetShape(0);
+    Tensor queries = query_points.Contiguous();
+    Tensor indices, distances2;
+    // counts[i + 1] is the number of neighbors of query i, so that the
+    // inclusive prefix sum yields the splits.
+    Tensor counts = Tensor::Zeros({num_queries + 1}, Dtype::Int64, device);
+    Tensor splits({num_queries + 1}, Dtype::Int64, device);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        GridView<scalar_t> view = MakeView<scalar_t>(
+                sorted_points_, sorted_cells_, point_indices_,
+                bucket_offsets_, num_buckets_, cell_size_, min_cell_,
+                max_cell_);
+        const scalar_t* queries_ptr =
+                static_cast<const scalar_t*>(queries.GetDataPtr());
+        NNS_KERNEL(device, CountRadius, view, queries_ptr, num_queries,
+                   static_cast<scalar_t>(radius),
+                   static_cast<int64_t*>(counts.GetDataPtr()) + 1);
+        kernel::CumSum(counts, splits, 0, false);
+        const int64_t num_neighbors = splits[num_queries].Item<int64_t>();
+        indices = Tensor({num_neighbors}, Dtype::Int64, device);
+        distances2 = Tensor({num_neighbors}, GetDtype(), device);
+        NNS_KERNEL(device, RadiusSearch, view, queries_ptr, num_queries,
+                   static_cast<scalar_t>(radius),
+                   static_cast<const int64_t*>(splits.GetDataPtr()), 0,
+                   static_cast<int64_t*>(indices.GetDataPtr()),
+                   static_cast<scalar_t*>(distances2.GetDataPtr()), nullptr);
+    });
+    return std::make_tuple(indices, distances2, splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
+        const Tensor& query_points, double radius, int max_knn) const {
+    AssertQueryPoints(query_points);
+    if (radius <= 0) {
+        utility::LogError("Radius must be positive, but got {}.", radius);
+    }
+    if (max_knn <= 0) {
+        utility::LogError("max_knn must be positive, but got {}.", max_knn);
+    }
+    const Device device = GetDevice();
+    const int64_t num_queries = query_points.GetShape(0);
+    Tensor queries = query_points.Contiguous();
+    Tensor indices =
+            Tensor::Full({num_queries, max_knn}, -1, Dtype::Int64, device);
+    Tensor distances2 =
+            Tensor::Zeros({num_queries, max_knn}, GetDtype(), device);
+    Tensor counts({num_queries}, Dtype::Int64, device);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        GridView<scalar_t> view = MakeView<scalar_t>(
+                sorted_points_, sorted_cells_, point_indices_,
+                bucket_offsets_, num_buckets_, cell_size_, min_cell_,
+                max_cell_);
+        NNS_KERNEL(device, RadiusSearch, view,
+                   static_cast<const scalar_t*>(queries.GetDataPtr()),
+                   num_queries, static_cast<scalar_t>(radius), nullptr,
+                   static_cast<int64_t>(max_knn),
+                   static_cast<int64_t*>(indices.GetDataPtr()),
+                   static_cast<scalar_t*>(distances2.GetDataPtr()),
+                   static_cast<int64_t*>(counts.GetDataPtr()));
+    });
+    return std::make_tuple(indices, distances2, counts);
+}
+
+#undef NNS_KERNEL
+
+}  // namespace nns
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "Open3D/Core/NNS/NearestNeighborSearchKernel.h"
+#include "Open3D/Core/Tensor.h"
+
+namespace open3d {
+namespace nns {
+
+/// \class NearestNeighborSearch
+///
+/// Batched nearest neighbor search of 3D points stored in a Tensor on a CPU
+/// or CUDA device. Results are Tensors on the same device, so e.g.
+/// correspondence search of a tgeometry::PointCloud never leaves the GPU.
+///
+/// The dataset is indexed by a uniform grid whose cells are spatially hashed
+/// into buckets; points are sorted by bucket so that each bucket is a
+/// contiguous range. Every query is answered by one thread, which visits the
+/// cells around the query. Build the index with KnnIndex(),
+/// FixedRadiusIndex() or HybridIndex() before searching: the former picks
+/// the cell size from the point density, the latter two use the search
+/// radius. Any index answers any search, but is fastest for its own.
+///
+/// The dataset and queries are Float32 or Float64 tensors of shape (N, 3)
+/// and (M, 3). Returned indices are Int64 dataset indices; distances are
+/// squared and have the dtype of the dataset. Neighbors of a query are sorted
+/// by increasing distance.
+///
+/// Example:
+/// ```cpp
+/// nns::NearestNeighborSearch nns(target.GetPoints().AsTensor());
+/// nns.HybridIndex(max_correspondence_distance);
+/// Tensor indices, distances2, counts;
+/// std::tie(indices, distances2, counts) = nns.HybridSearch(
+///         source.GetPoints().AsTensor(), max_correspondence_distance, 1);
+/// ```
+class NearestNeighborSearch {
+public:
+    /// \param dataset_points Float32 or Float64 tensor of shape (N, 3).
+    NearestNeighborSearch(const Tensor& dataset_points);
+
+    /// Builds an index for KnnSearch, with about a few points per cell.
+    void KnnIndex();
+
+    /// Builds an index for FixedRadiusSearch with cells of size \p radius.
+    void FixedRadiusIndex(double radius);
+
+    /// Builds an index for HybridSearch with cells of size \p radius.
+    void HybridIndex(double radius);
+
+    /// Finds the \p knn nearest neighbors of every query.
+    ///
+    /// \return Indices and squared distances of shape (M, k), where
+    /// k = min(knn, N).
+    std::pair<Tensor, Tensor> KnnSearch(const Tensor& query_points,
+                                        int knn) const;
+
+    /// Finds all neighbors within \p radius of every query.
+    ///
+    /// \return Indices and squared distances of all neighbors, concatenated,
+    /// and Int64 splits of shape (M + 1,): the neighbors of query i are
+    /// elements splits[i] to splits[i + 1] - 1.
+    std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
+            const Tensor& query_points, double radius) const;
+
+    /// Finds the at most \p max_knn nearest neighbors within \p radius of
+    /// every query.
+    ///
+    /// \return Indices and squared distances of shape (M, max_knn), padded
+    /// with -1 and 0, and the Int64 number of neighbors of each query (M,).
+    std::tuple<Tensor, Tensor, Tensor> HybridSearch(const Tensor& query_points,
+                                                    double radius,
+                                                    int max_knn) const;
+
+    /// Returns the cell size of the index, or 0 if no index has been built.
+    double GetCellSize() const { return cell_size_; }
+
+    Device GetDevice() const { return dataset_points_.GetDevice(); }
+
+    Dtype GetDtype() const { return dataset_points_.GetDtype(); }
+
+    /// Returns the raw buffers of the index, for kernels that search from
+    /// their own threads, e.g. the fused correspondence search of ICP. The
+    /// view is valid as long as the index is, and \p scalar_t must match
+    /// the dtype of the dataset.
+    template <typename scalar_t>
+    GridView<scalar_t> GetGridView() const;
+
+protected:
+    /// Builds the grid with cells of size \p cell_size.
+    void BuildIndex(double cell_size);
+
+    void AssertQueryPoints(const Tensor& query_points) const;
+
+protected:
+    Tensor dataset_points_;
+
+    double cell_size_ = 0;
+    int64_t num_buckets_ = 0;
+    int64_t min_cell_[3] = {0, 0, 0};
+    int64_t max_cell_[3] = {0, 0, 0};
+
+    /// Dataset points sorted by bucket, (N, 3).
+    Tensor sorted_points_;
+    /// Int32 cell coordinates of the sorted points, (N, 3).
+    Tensor sorted_cells_;
+    /// Int64 dataset index of each sorted point, (N,).
+    Tensor point_indices_;
+    /// Int64 first sorted point of each bucket, (num_buckets + 1,).
+    Tensor bucket_offsets_;
+};
+
+}  // namespace nns
+}  // namespace open3d
@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/Core/NNS/NearestNeighborSearchKernel.h"
+
+namespace open3d {
+namespace nns {
+
+template <typename scalar_t>
+void ComputeCellsCUDA(const scalar_t* points,
+                      int64_t num_points,
+                      scalar_t cell_size,
+                      int64_t num_buckets,
+                      int32_t* cells,
+                      int64_t* buckets) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            num_points, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                int64_t cell[3];
+                for (int d = 0; d < 3; ++d) {
+                    cell[d] = CellCoord(points[3 * i + d], cell_size);
+                    cells[3 * i + d] = static_cast<int32_t>(cell[d]);
+                }
+                buckets[i] = BucketOf(cell[0], cell[1], cell[2], num_buckets);
+            });
+}
+
+void ComputeBucketOffsetsCUDA(const int64_t* sorted_buckets,
+                              int64_t num_points,
+                              int64_t num_buckets,
+                              int64_t* bucket_offsets) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            num_buckets + 1, [=] OPEN3D_HOST_DEVICE(int64_t bucket) {
+                // Lower bound of bucket in sorted_buckets.
+                int64_t lo = 0;
+                int64_t hi = num_points;
+                while (lo < hi) {
+                    const int64_t mid = lo + (hi - lo) / 2;
+                    if (sorted_buckets[mid] < bucket) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                bucket_offsets[bucket] = lo;
+            });
+}
+
+template <typename scalar_t>
+void KnnSearchCUDA(const GridView<scalar_t>& view,
+                   const scalar_t* queries,
+                   int64_t num_queries,
+                   int64_t knn,
+                   int64_t* indices,
+                   scalar_t* distances2) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            num_queries, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                KnnSearchOne(view, queries + 3 * i, knn, indices + i * knn,
+                             distances2 + i * knn);
+            });
+}
+
+template <typename scalar_t>
+void CountRadiusCUDA(const GridView<scalar_t>& view,
+                     const scalar_t* queries,
+                     int64_t num_queries,
+                     scalar_t radius,
+                     int64_t* counts) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            num_queries, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                counts[i] = CountRadiusOne(view, queries + 3 * i, radius);
+            });
+}
+
+template <typename scalar_t>
+void RadiusSearchCUDA(const GridView<scalar_t>& view,
+                      const scalar_t* queries,
+                      int64_t num_queries,
+                      scalar_t radius,
+                      const int64_t* offsets,
+                      int64_t capacity,
+                      int64_t* indices,
+                      scalar_t* distances2,
+                      int64_t* counts) {
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            num_queries, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                const int64_t begin = offsets ? offsets[i] : i * capacity;
+                const int64_t query_capacity =
+                        offsets ? offsets[i + 1] - offsets[i] : capacity;
+                const int64_t count = RadiusSearchOne(
+                        view, queries + 3 * i, radius, query_capacity,
+                        indices + begin, distances2 + begin);
+                if (counts) {
+                    counts[i] = count;
+                }
+            });
+}
+
+#define INSTANTIATE_NNS_CUDA(scalar_t)                                        \
+    template void ComputeCellsCUDA<scalar_t>(const scalar_t*, int64_t,        \
+                                             scalar_t, int64_t, int32_t*,     \
+                                             int64_t*);                       \
+    template void KnnSearchCUDA<scalar_t>(const GridView<scalar_t>&,          \
+                                          const scalar_t*, int64_t, int64_t,  \
+                                          int64_t*, scalar_t*);               \
+    template void CountRadiusCUDA<scalar_t>(const GridView<scalar_t>&,        \
+                                            const scalar_t*, int64_t,         \
+                                            scalar_t, int64_t*);              \
+    template void RadiusSearchCUDA<scalar_t>(                                 \
+            const GridView<scalar_t>&, const scalar_t*, int64_t, scalar_t,    \
+            const int64_t*, int64_t, int64_t*, scalar_t*, int64_t*);
+
+INSTANTIATE_NNS_CUDA(float)
+INSTANTIATE_NNS_CUDA(double)
+
+#undef INSTANTIATE_NNS_CUDA
+
+}  // namespace nns
+}  // namespace open3d
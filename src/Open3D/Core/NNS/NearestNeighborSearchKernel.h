@@ -0,0 +1,355 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file NearestNeighborSearchKernel.h
+///
+/// Spatially hashed uniform grid search shared by the CPU and CUDA backends.
+/// Every query is answered independently by one thread with the
+/// OPEN3D_HOST_DEVICE functions below.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace nns {
+
+/// Raw buffers of a uniform grid over N points. Cell (x, y, z) is hashed to
+/// one of num_buckets_ buckets, and the points are sorted by bucket, so the
+/// points of bucket b are points_[bucket_offsets_[b]] to
+/// points_[bucket_offsets_[b + 1] - 1]. Cells that collide in a bucket are
+/// told apart by the stored cell coordinates of each point.
+template <typename scalar_t>
+struct GridView {
+    /// Sorted points, (N, 3).
+    const scalar_t* points_;
+    /// Cell coordinates of the sorted points, (N, 3).
+    const int32_t* cells_;
+    /// Dataset index of each sorted point, (N,).
+    const int64_t* point_indices_;
+    /// First sorted point of each bucket, (num_buckets_ + 1,).
+    const int64_t* bucket_offsets_;
+    int64_t num_buckets_;
+    scalar_t cell_size_;
+    /// Inclusive range of the cells that contain points.
+    int64_t min_cell_[3];
+    int64_t max_cell_[3];
+};
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int64_t CellCoord(scalar_t x, scalar_t cell_size) {
+    return static_cast<int64_t>(floor(x / cell_size));
+}
+
+OPEN3D_HOST_DEVICE inline int64_t BucketOf(int64_t x,
+                                           int64_t y,
+                                           int64_t z,
+                                           int64_t num_buckets) {
+    uint64_t hash = (static_cast<uint64_t>(x) * 73856093ULL) ^
+                    (static_cast<uint64_t>(y) * 19349669ULL) ^
+                    (static_cast<uint64_t>(z) * 83492791ULL);
+    // Finalizer of MurmurHash3, spreads the entropy to the low bits.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return static_cast<int64_t>(hash % static_cast<uint64_t>(num_buckets));
+}
+
+/// Calls func(j, distance2) for every sorted point j in cell (x, y, z).
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE inline void VisitCell(const GridView<scalar_t>& view,
+                                         int64_t x,
+                                         int64_t y,
+                                         int64_t z,
+                                         const scalar_t* query,
+                                         func_t& func) {
+    const int64_t bucket = BucketOf(x, y, z, view.num_buckets_);
+    const int64_t end = view.bucket_offsets_[bucket + 1];
+    for (int64_t j = view.bucket_offsets_[bucket]; j < end; ++j) {
+        const int32_t* cell = view.cells_ + 3 * j;
+        if (cell[0] != x || cell[1] != y || cell[2] != z) {
+            continue;
+        }
+        const scalar_t* point = view.points_ + 3 * j;
+        const scalar_t dx = point[0] - query[0];
+        const scalar_t dy = point[1] - query[1];
+        const scalar_t dz = point[2] - query[2];
+        func(j, dx * dx + dy * dy + dz * dz);
+    }
+}
+
+/// Inserts (index, distance2) into \p indices and \p distances2, which hold
+/// \p size neighbors sorted by increasing distance and at most \p capacity.
+/// A neighbor at the same distance as present ones is inserted after them.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void InsertNeighbor(int64_t index,
+                                              scalar_t distance2,
+                                              int64_t capacity,
+                                              int64_t& size,
+                                              int64_t* indices,
+                                              scalar_t* distances2) {
+    if (size == capacity) {
+        if (capacity == 0 || distances2[size - 1] <= distance2) {
+            return;
+        }
+        --size;
+    }
+    int64_t pos = size;
+    while (pos > 0 && distances2[pos - 1] > distance2) {
+        indices[pos] = indices[pos - 1];
+        distances2[pos] = distances2[pos - 1];
+        --pos;
+    }
+    indices[pos] = index;
+    distances2[pos] = distance2;
+    ++size;
+}
+
+/// Calls func(j, distance2) for every sorted point j within \p radius of
+/// \p query.
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE inline void VisitRadius(const GridView<scalar_t>& view,
+                                           const scalar_t* query,
+                                           scalar_t radius,
+                                           func_t& func) {
+    const scalar_t radius2 = radius * radius;
+    // Clamped so that the cell range below cannot overflow.
+    const scalar_t max_cells = static_cast<scalar_t>(1 << 30);
+    scalar_t cell_radius = ceil(radius / view.cell_size_);
+    cell_radius = cell_radius < max_cells ? cell_radius : max_cells;
+    const int64_t r = static_cast<int64_t>(cell_radius);
+    int64_t lo[3], hi[3];
+    for (int d = 0; d < 3; ++d) {
+        const int64_t c = CellCoord(query[d], view.cell_size_);
+        lo[d] = c - r > view.min_cell_[d] ? c - r : view.min_cell_[d];
+        hi[d] = c + r < view.max_cell_[d] ? c + r : view.max_cell_[d];
+    }
+    auto visit = [&](int64_t j, scalar_t distance2) {
+        if (distance2 <= radius2) {
+            func(j, distance2);
+        }
+    };
+    for (int64_t x = lo[0]; x <= hi[0]; ++x) {
+        for (int64_t y = lo[1]; y <= hi[1]; ++y) {
+            for (int64_t z = lo[2]; z <= hi[2]; ++z) {
+                VisitCell(view, x, y, z, query, visit);
+            }
+        }
+    }
+}
+
+/// Replaces sorted point indices by dataset indices.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ToDatasetIndices(const GridView<scalar_t>& view,
+                                                int64_t size,
+                                                int64_t* indices) {
+    for (int64_t i = 0; i < size; ++i) {
+        indices[i] = view.point_indices_[indices[i]];
+    }
+}
+
+/// Finds the \p knn nearest neighbors of \p query, where knn must not exceed
+/// the number of points. The cells are visited in rings of growing Chebyshev
+/// distance around the cell of the query. After ring r, all unvisited points
+/// are farther than r * cell_size, which bounds the search.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void KnnSearchOne(const GridView<scalar_t>& view,
+                                            const scalar_t* query,
+                                            int64_t knn,
+                                            int64_t* indices,
+                                            scalar_t* distances2) {
+    int64_t c[3];
+    int64_t r_begin = 0;
+    int64_t r_end = 0;
+    for (int d = 0; d < 3; ++d) {
+        c[d] = CellCoord(query[d], view.cell_size_);
+        const int64_t to_min = c[d] - view.min_cell_[d];
+        const int64_t to_max = view.max_cell_[d] - c[d];
+        // Rings closer than r_begin do not reach the grid, rings farther
+        // than r_end lie outside of it.
+        const int64_t gap = -to_min > -to_max ? -to_min : -to_max;
+        const int64_t far = to_min > to_max ? to_min : to_max;
+        r_begin = gap > r_begin ? gap : r_begin;
+        r_end = far > r_end ? far : r_end;
+    }
+
+    int64_t size = 0;
+    auto visit = [&](int64_t j, scalar_t distance2) {
+        InsertNeighbor(j, distance2, knn, size, indices, distances2);
+    };
+    for (int64_t r = r_begin; r <= r_end; ++r) {
+        int64_t lo[3], hi[3];
+        for (int d = 0; d < 3; ++d) {
+            const int64_t lo_d = view.min_cell_[d] - c[d];
+            const int64_t hi_d = view.max_cell_[d] - c[d];
+            lo[d] = -r > lo_d ? -r : lo_d;
+            hi[d] = r < hi_d ? r : hi_d;
+        }
+        for (int64_t dx = lo[0]; dx <= hi[0]; ++dx) {
+            for (int64_t dy = lo[1]; dy <= hi[1]; ++dy) {
+                if (dx == -r || dx == r || dy == -r || dy == r) {
+                    for (int64_t dz = lo[2]; dz <= hi[2]; ++dz) {
+                        VisitCell(view, c[0] + dx, c[1] + dy, c[2] + dz,
+                                  query, visit);
+                    }
+                } else {
+                    // Only the two faces of the ring along z.
+                    if (lo[2] == -r) {
+                        VisitCell(view, c[0] + dx, c[1] + dy, c[2] - r, query,
+                                  visit);
+                    }
+                    if (hi[2] == r) {
+                        VisitCell(view, c[0] + dx, c[1] + dy, c[2] + r, query,
+                                  visit);
+                    }
+                }
+            }
+        }
+        if (size == knn) {
+            const scalar_t bound = static_cast<scalar_t>(r) * view.cell_size_;
+            if (distances2[knn - 1] <= bound * bound) {
+                break;
+            }
+        }
+    }
+    ToDatasetIndices(view, size, indices);
+}
+
+/// Returns the number of points within \p radius of \p query.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int64_t CountRadiusOne(const GridView<scalar_t>& view,
+                                                 const scalar_t* query,
+                                                 scalar_t radius) {
+    int64_t count = 0;
+    auto visit = [&](int64_t, scalar_t) { ++count; };
+    VisitRadius(view, query, radius, visit);
+    return count;
+}
+
+/// Finds the at most \p capacity nearest points within \p radius of
+/// \p query, sorted by distance. Returns the number of neighbors found.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int64_t RadiusSearchOne(
+        const GridView<scalar_t>& view,
+        const scalar_t* query,
+        scalar_t radius,
+        int64_t capacity,
+        int64_t* indices,
+        scalar_t* distances2) {
+    int64_t size = 0;
+    auto visit = [&](int64_t j, scalar_t distance2) {
+        InsertNeighbor(j, distance2, capacity, size, indices, distances2);
+    };
+    VisitRadius(view, query, radius, visit);
+    ToDatasetIndices(view, size, indices);
+    return size;
+}
+
+/// Bulk operations on contiguous (N, 3) \p points or \p queries.
+///
+/// ComputeCells writes the Int32 cell coordinates (N, 3) and the bucket (N,)
+/// of every point. ComputeBucketOffsets writes the first index of each bucket
+/// in \p sorted_buckets, plus \p num_points at the end. RadiusSearch writes
+/// the neighbors of query i starting at offsets[i] if \p offsets is given, or
+/// at i * capacity otherwise, and stores their number in counts[i] if
+/// \p counts is given. \p capacity is ignored if \p offsets is given.
+template <typename scalar_t>
+void ComputeCellsCPU(const scalar_t* points,
+                     int64_t num_points,
+                     scalar_t cell_size,
+                     int64_t num_buckets,
+                     int32_t* cells,
+                     int64_t* buckets);
+void ComputeBucketOffsetsCPU(const int64_t* sorted_buckets,
+                             int64_t num_points,
+                             int64_t num_buckets,
+                             int64_t* bucket_offsets);
+template <typename scalar_t>
+void KnnSearchCPU(const GridView<scalar_t>& view,
+                  const scalar_t* queries,
+                  int64_t num_queries,
+                  int64_t knn,
+                  int64_t* indices,
+                  scalar_t* distances2);
+template <typename scalar_t>
+void CountRadiusCPU(const GridView<scalar_t>& view,
+                    const scalar_t* queries,
+                    int64_t num_queries,
+                    scalar_t radius,
+                    int64_t* counts);
+template <typename scalar_t>
+void RadiusSearchCPU(const GridView<scalar_t>& view,
+                     const scalar_t* queries,
+                     int64_t num_queries,
+                     scalar_t radius,
+                     const int64_t* offsets,
+                     int64_t capacity,
+                     int64_t* indices,
+                     scalar_t* distances2,
+                     int64_t* counts);
+
+#ifdef BUILD_CUDA_MODULE
+template <typename scalar_t>
+void ComputeCellsCUDA(const scalar_t* points,
+                      int64_t num_points,
+                      scalar_t cell_size,
+                      int64_t num_buckets,
+                      int32_t* cells,
+                      int64_t* buckets);
+void ComputeBucketOffsetsCUDA(const int64_t* sorted_buckets,
+                              int64_t num_points,
+                              int64_t num_buckets,
+                              int64_t* bucket_offsets);
+template <typename scalar_t>
+void KnnSearchCUDA(const GridView<scalar_t>& view,
+                   const scalar_t* queries,
+                   int64_t num_queries,
+                   int64_t knn,
+                   int64_t* indices,
+                   scalar_t* distances2);
+template <typename scalar_t>
+void CountRadiusCUDA(const GridView<scalar_t>& view,
+                     const scalar_t* queries,
+                     int64_t num_queries,
+                     scalar_t radius,
+                     int64_t* counts);
+template <typename scalar_t>
+void RadiusSearchCUDA(const GridView<scalar_t>& view,
+                      const scalar_t* queries,
+                      int64_t num_queries,
+                      scalar_t radius,
+                      const int64_t* offsets,
+                      int64_t capacity,
+                      int64_t* indices,
+                      scalar_t* distances2,
+                      int64_t* counts);
+#endif
+
+}  // namespace nns
+}  // namespace open3d
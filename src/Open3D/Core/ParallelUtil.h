@@ -26,25 +26,17 @@
 
 #pragma once
 
+#include "Open3D/Utility/Parallel.h"
+
 namespace open3d {
 namespace kernel {
 namespace parallel_util {
 
-inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
-}
+/// Number of threads used by utility::ParallelFor, see
+/// utility::SetNumThreads.
+inline int GetMaxThreads() { return utility::GetNumThreads(); }
 
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
-}
+inline bool InParallel() { return utility::InParallel(); }
 
 }  // namespace parallel_util
 }  // namespace kernel
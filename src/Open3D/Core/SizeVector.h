@@ -26,55 +26,289 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 
+/// Maximum number of dimensions of the Tensors that kernels operate on.
+static constexpr int64_t MAX_DIMS = 10;
+
 /// SizeVector is a vector of int64_t, typically used in Tensor shape and
 /// strides. A signed int64_t type is chosen to allow negative strides.
-class SizeVector : public std::vector<int64_t> {
+///
+/// Up to MAX_DIMS elements are stored inline, such that the shape and strides
+/// of a Tensor are created and copied without heap allocations. Larger
+/// SizeVectors are stored on the heap. The interface is the subset of
+/// std::vector used for shapes, and iterators are pointers.
+class SizeVector {
 public:
-    SizeVector(const std::initializer_list<int64_t>& dim_sizes)
-        : std::vector<int64_t>(dim_sizes) {}
+    typedef int64_t value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int64_t& reference;
+    typedef const int64_t& const_reference;
+    typedef int64_t* pointer;
+    typedef const int64_t* const_pointer;
+    typedef int64_t* iterator;
+    typedef const int64_t* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SizeVector() {}
+
+    SizeVector(const std::initializer_list<int64_t>& dim_sizes) {
+        assign(dim_sizes.begin(), dim_sizes.end());
+    }
 
-    SizeVector(const std::vector<int64_t>& dim_sizes)
-        : std::vector<int64_t>(dim_sizes) {}
+    SizeVector(const std::vector<int64_t>& dim_sizes) {
+        assign(dim_sizes.begin(), dim_sizes.end());
+    }
 
-    SizeVector(const SizeVector& other) : std::vector<int64_t>(other) {}
+    SizeVector(const SizeVector& other) { assign(other.begin(), other.end()); }
 
-    explicit SizeVector(int64_t n, int64_t initial_value = 0)
-        : std::vector<int64_t>(n, initial_value) {}
+    SizeVector(SizeVector&& other) { MoveFrom(other); }
 
-    template <class InputIterator>
-    SizeVector(InputIterator first, InputIterator last)
-        : std::vector<int64_t>(first, last) {}
+    explicit SizeVector(int64_t n, int64_t initial_value = 0) {
+        resize(n, initial_value);
+    }
 
-    SizeVector() {}
+    template <class InputIterator,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIterator>::value>::type>
+    SizeVector(InputIterator first, InputIterator last) {
+        assign(first, last);
+    }
+
+    ~SizeVector() { FreeHeap(); }
 
     SizeVector& operator=(const SizeVector& v) {
-        static_cast<std::vector<int64_t>*>(this)->operator=(v);
+        if (this != &v) {
+            assign(v.begin(), v.end());
+        }
         return *this;
     }
 
     SizeVector& operator=(SizeVector&& v) {
-        static_cast<std::vector<int64_t>*>(this)->operator=(v);
+        if (this != &v) {
+            FreeHeap();
+            MoveFrom(v);
+        }
         return *this;
     }
 
+    SizeVector& operator=(const std::initializer_list<int64_t>& dim_sizes) {
+        assign(dim_sizes.begin(), dim_sizes.end());
+        return *this;
+    }
+
+    template <class InputIterator,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIterator>::value>::type>
+    void assign(InputIterator first, InputIterator last) {
+        const size_t n = static_cast<size_t>(std::distance(first, last));
+        size_ = 0;
+        reserve(n);
+        std::copy(first, last, data_);
+        size_ = n;
+    }
+
+    void assign(size_t n, int64_t value) {
+        size_ = 0;
+        resize(n, value);
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+
+    int64_t* data() { return data_; }
+    const int64_t* data() const { return data_; }
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    int64_t& operator[](size_t i) { return data_[i]; }
+    const int64_t& operator[](size_t i) const { return data_[i]; }
+
+    int64_t& at(size_t i) {
+        CheckIndex(i);
+        return data_[i];
+    }
+    const int64_t& at(size_t i) const {
+        CheckIndex(i);
+        return data_[i];
+    }
+
+    int64_t& front() { return data_[0]; }
+    const int64_t& front() const { return data_[0]; }
+    int64_t& back() { return data_[size_ - 1]; }
+    const int64_t& back() const { return data_[size_ - 1]; }
+
+    void reserve(size_t n) {
+        if (n <= capacity_) {
+            return;
+        }
+        const size_t capacity = std::max(n, 2 * capacity_);
+        int64_t* data = new int64_t[capacity];
+        std::copy(begin(), end(), data);
+        FreeHeap();
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    void resize(size_t n, int64_t value = 0) {
+        reserve(n);
+        if (n > size_) {
+            std::fill(data_ + size_, data_ + n, value);
+        }
+        size_ = n;
+    }
+
+    void clear() { size_ = 0; }
+
+    // The value is taken by copy as it may refer to an element of this vector.
+    void push_back(int64_t value) {
+        reserve(size_ + 1);
+        data_[size_++] = value;
+    }
+
+    void emplace_back(int64_t value) { push_back(value); }
+
+    void pop_back() { --size_; }
+
+    iterator insert(const_iterator pos, int64_t value) {
+        return insert(pos, 1, value);
+    }
+
+    iterator insert(const_iterator pos, size_t n, int64_t value) {
+        const size_t offset = pos - begin();
+        OpenGap(offset, n);
+        std::fill(data_ + offset, data_ + offset + n, value);
+        return data_ + offset;
+    }
+
+    template <class InputIterator,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIterator>::value>::type>
+    iterator insert(const_iterator pos,
+                    InputIterator first,
+                    InputIterator last) {
+        // The range may refer to this vector, which OpenGap() may reallocate.
+        const SizeVector values(first, last);
+        const size_t offset = pos - begin();
+        OpenGap(offset, values.size());
+        std::copy(values.begin(), values.end(), data_ + offset);
+        return data_ + offset;
+    }
+
+    iterator insert(const_iterator pos,
+                    const std::initializer_list<int64_t>& values) {
+        return insert(pos, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator dst = begin() + (first - begin());
+        std::copy(last, cend(), dst);
+        size_ -= last - first;
+        return dst;
+    }
+
+    void swap(SizeVector& other) {
+        SizeVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    bool operator==(const SizeVector& other) const {
+        return size_ == other.size_ &&
+               std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const SizeVector& other) const { return !(*this == other); }
+
+    bool operator<(const SizeVector& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(),
+                                            other.end());
+    }
+
     int64_t NumElements() const {
-        if (this->size() == 0) {
-            return 1;
+        int64_t num_elements = 1;
+        for (size_t i = 0; i < size_; ++i) {
+            num_elements *= data_[i];
         }
-        return std::accumulate(this->begin(), this->end(), 1LL,
-                               std::multiplies<int64_t>());
+        return num_elements;
     }
 
     std::string ToString() const { return fmt::format("{}", *this); }
+
+private:
+    bool IsInline() const { return data_ == inline_data_; }
+
+    void FreeHeap() {
+        if (!IsInline()) {
+            delete[] data_;
+            data_ = inline_data_;
+            capacity_ = MAX_DIMS;
+        }
+    }
+
+    /// Takes the heap buffer of \p other, or copies its inline elements.
+    /// \p other is left empty. The heap buffer of this must have been freed.
+    void MoveFrom(SizeVector& other) {
+        if (other.IsInline()) {
+            std::copy(other.begin(), other.end(), inline_data_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data_;
+            other.capacity_ = MAX_DIMS;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    /// Moves the elements from \p offset by \p n to the back.
+    void OpenGap(size_t offset, size_t n) {
+        reserve(size_ + n);
+        std::copy_backward(data_ + offset, data_ + size_, data_ + size_ + n);
+        size_ += n;
+    }
+
+    void CheckIndex(size_t i) const {
+        if (i >= size_) {
+            utility::LogError("SizeVector index {} out of range for size {}.",
+                              i, size_);
+        }
+    }
+
+    int64_t inline_data_[MAX_DIMS];
+    int64_t* data_ = inline_data_;
+    size_t size_ = 0;
+    size_t capacity_ = MAX_DIMS;
 };
 
 /// \brief Wrap around negative \p dim.
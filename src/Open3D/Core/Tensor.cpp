@@ -26,6 +26,8 @@
 
 #include "Open3D/Core/Tensor.h"
 
+#include <algorithm>
+#include <random>
 #include <sstream>
 
 #include "Open3D/Core/AdvancedIndexing.h"
@@ -41,6 +43,23 @@
 
 namespace open3d {
 
+/// Checks that the preallocated output \p dst of \p op_name has the expected
+/// shape and dtype. Devices are checked by the kernels.
+static void AssertOutputTensor(const std::string& op_name,
+                               const Tensor& dst,
+                               const SizeVector& shape,
+                               Dtype dtype) {
+    if (dst.GetShape() != shape) {
+        utility::LogError("{}: expected output shape {}, but got {}.", op_name,
+                          shape, dst.GetShape());
+    }
+    if (dst.GetDtype() != dtype) {
+        utility::LogError("{}: expected output dtype {}, but got {}.", op_name,
+                          DtypeUtil::ToString(dtype),
+                          DtypeUtil::ToString(dst.GetDtype()));
+    }
+}
+
 /// Tensor assignment lvalue = lvalue, e.g. `tensor_a = tensor_b`
 Tensor& Tensor::operator=(const Tensor& other) & {
     shape_ = other.shape_;
@@ -53,10 +72,10 @@ Tensor& Tensor::operator=(const Tensor& other) & {
 
 /// Tensor assignment lvalue = rvalue, e.g. `tensor_a = tensor_b[0]`
 Tensor& Tensor::operator=(Tensor&& other) & {
-    shape_ = other.shape_;
-    strides_ = other.strides_;
+    shape_ = std::move(other.shape_);
+    strides_ = std::move(other.strides_);
     dtype_ = other.dtype_;
-    blob_ = other.blob_;
+    blob_ = std::move(other.blob_);
     data_ptr_ = other.data_ptr_;
     return *this;
 }
@@ -79,12 +98,58 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype) {
+    Device device("CPU:0");
+    void* ptr = MemoryManager::MallocPinned(shape.NumElements() *
+                                            DtypeUtil::ByteSize(dtype));
+    auto blob = std::make_shared<Blob>(
+            device, ptr, [ptr](void*) { MemoryManager::FreePinned(ptr); });
+    return Tensor(shape, DefaultStrides(shape), ptr, dtype, blob);
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
     return Full(shape, 0, dtype, device);
 }
 
+Tensor Tensor::Eye(int64_t n, Dtype dtype, const Device& device) {
+    Tensor eye = Zeros({n, n}, dtype, device);
+    eye.AsStrided({n}, {n + 1}).Fill(1);
+    return eye;
+}
+
+/// Returns \p seed, or a random seed if it is negative.
+static uint64_t ResolveRandomSeed(int64_t seed) {
+    if (seed >= 0) {
+        return static_cast<uint64_t>(seed);
+    }
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) ^ static_cast<uint64_t>(rd());
+}
+
+Tensor Tensor::Rand(const SizeVector& shape,
+                    Dtype dtype,
+                    const Device& device,
+                    double low,
+                    double high,
+                    int64_t seed) {
+    Tensor dst(shape, dtype, device);
+    kernel::RandUniform(dst, low, high, ResolveRandomSeed(seed));
+    return dst;
+}
+
+Tensor Tensor::Randint(int64_t low,
+                       int64_t high,
+                       const SizeVector& shape,
+                       Dtype dtype,
+                       const Device& device,
+                       int64_t seed) {
+    Tensor dst(shape, dtype, device);
+    kernel::RandInt(dst, low, high, ResolveRandomSeed(seed));
+    return dst;
+}
+
 Tensor Tensor::Ones(const SizeVector& shape,
                     Dtype dtype,
                     const Device& device) {
@@ -333,6 +398,122 @@ Tensor Tensor::Copy(const Device& device) const {
     return dst_tensor;
 }
 
+Tensor Tensor::Copy(Tensor& dst) const {
+    AssertOutputTensor("Copy", dst, shape_, dtype_);
+    kernel::Copy(*this, dst);
+    return dst;
+}
+
+Tensor Tensor::PinMemory() const {
+    if (GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError("Only CPU tensors can be pinned, but {} is used.",
+                          GetDevice().ToString());
+    }
+    if (IsPinned() && IsContiguous()) {
+        return *this;
+    }
+    Tensor dst_tensor = EmptyPinned(shape_, dtype_);
+    kernel::Copy(*this, dst_tensor);
+    return dst_tensor;
+}
+
+bool Tensor::IsPinned() const {
+    return GetDevice().GetType() == Device::DeviceType::CPU &&
+           data_ptr_ != nullptr && MemoryManager::IsPinned(data_ptr_);
+}
+
+std::vector<Tensor> Tensor::Shard(const std::vector<Device>& devices,
+                                  const std::vector<int64_t>& sizes) const {
+    if (NumDims() == 0) {
+        utility::LogError("Shard cannot be applied to 0-dim Tensor.");
+    }
+    if (devices.empty()) {
+        utility::LogError("Shard expects at least one device.");
+    }
+    const int64_t num_shards = static_cast<int64_t>(devices.size());
+    const int64_t length = shape_[0];
+    std::vector<int64_t> shard_sizes = sizes;
+    if (shard_sizes.empty()) {
+        for (int64_t i = 0; i < num_shards; ++i) {
+            shard_sizes.push_back(length / num_shards +
+                                  (i < length % num_shards ? 1 : 0));
+        }
+    } else if (static_cast<int64_t>(shard_sizes.size()) != num_shards) {
+        utility::LogError("Shard got {} sizes for {} devices.",
+                          shard_sizes.size(), num_shards);
+    }
+    int64_t total_size = 0;
+    for (int64_t size : shard_sizes) {
+        if (size < 0) {
+            utility::LogError("Shard sizes must be non-negative, but got {}.",
+                              size);
+        }
+        total_size += size;
+    }
+    if (total_size != length) {
+        utility::LogError(
+                "Shard sizes add up to {}, but dimension 0 has size {}.",
+                total_size, length);
+    }
+
+    std::vector<Tensor> shards;
+    int64_t start = 0;
+    for (int64_t i = 0; i < num_shards; ++i) {
+        if (shard_sizes[i] == 0) {
+            SizeVector shard_shape = shape_;
+            shard_shape[0] = 0;
+            shards.push_back(Tensor(shard_shape, dtype_, devices[i]));
+        } else {
+            shards.push_back(Slice(0, start, start + shard_sizes[i])
+                                     .Copy(devices[i]));
+        }
+        start += shard_sizes[i];
+    }
+    return shards;
+}
+
+Tensor Tensor::FromShards(const std::vector<Tensor>& shards,
+                          const Device& device) {
+    if (shards.empty()) {
+        utility::LogError("FromShards expects at least one shard.");
+    }
+    SizeVector shape = shards[0].GetShape();
+    if (shape.size() == 0) {
+        utility::LogError("FromShards cannot concatenate 0-dim Tensors.");
+    }
+    Dtype dtype = shards[0].GetDtype();
+    int64_t length = 0;
+    for (const Tensor& shard : shards) {
+        SizeVector shard_shape = shard.GetShape();
+        if (shard_shape.size() != shape.size() ||
+            !std::equal(shape.begin() + 1, shape.end(),
+                        shard_shape.begin() + 1)) {
+            utility::LogError(
+                    "FromShards: shard shape {} does not match shape {} "
+                    "except for dimension 0.",
+                    shard_shape, shape);
+        }
+        if (shard.GetDtype() != dtype) {
+            utility::LogError("FromShards: shard dtype {} != {}.",
+                              DtypeUtil::ToString(shard.GetDtype()),
+                              DtypeUtil::ToString(dtype));
+        }
+        length += shard_shape[0];
+    }
+    shape[0] = length;
+
+    Tensor dst(shape, dtype, device);
+    int64_t start = 0;
+    for (const Tensor& shard : shards) {
+        int64_t shard_length = shard.GetShape(0);
+        if (shard_length > 0) {
+            dst.Slice(0, start, start + shard_length).AsRvalue() = shard;
+        }
+        start += shard_length;
+    }
+    return dst;
+}
+
 Tensor Tensor::To(Dtype dtype, bool copy) const {
     if (!copy && dtype_ == dtype) {
         return *this;
@@ -342,6 +523,12 @@ Tensor Tensor::To(Dtype dtype, bool copy) const {
     return dst_tensor;
 }
 
+Tensor Tensor::To(Dtype dtype, Tensor& dst) const {
+    AssertOutputTensor("To", dst, shape_, dtype);
+    kernel::Copy(*this, dst);
+    return dst;
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
 void Tensor::ShallowCopyFrom(const Tensor& other) {
@@ -546,6 +733,18 @@ Tensor Tensor::Slice(int64_t dim,
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // A single boolean mask over the leading dimensions is compacted directly,
+    // instead of being expanded to integer index tensors first.
+    if (index_tensors.size() == 1 &&
+        index_tensors[0].GetDtype() == Dtype::Bool &&
+        index_tensors[0].NumDims() > 0 &&
+        index_tensors[0].NumDims() <= NumDims() &&
+        index_tensors[0].GetDevice() == GetDevice()) {
+        const SizeVector mask_shape = index_tensors[0].GetShape();
+        if (std::equal(mask_shape.begin(), mask_shape.end(), shape_.begin())) {
+            return MaskedSelect(index_tensors[0]);
+        }
+    }
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -554,6 +753,17 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
     return dst;
 }
 
+Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors,
+                        Tensor& dst) const {
+    // The output shape of a boolean mask depends on its values, so the
+    // MaskedSelect shortcut is not taken here.
+    AdvancedIndexPreprocessor aip(*this, index_tensors);
+    AssertOutputTensor("IndexGet", dst, aip.GetOutputShape(), dtype_);
+    kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
+                     aip.GetIndexedShape(), aip.GetIndexedStrides());
+    return dst;
+}
+
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
     AdvancedIndexPreprocessor aip(*this, index_tensors);
@@ -626,6 +836,104 @@ Tensor Tensor::T() const {
     }
 }
 
+Tensor Tensor::Matmul(const Tensor& rhs) const {
+    if (NumDims() < 2 || rhs.NumDims() < 2) {
+        utility::LogError(
+                "Tensor::Matmul expects Tensors with >= 2 dimensions, but got "
+                "shapes {} and {}.",
+                shape_, rhs.shape_);
+    }
+    SizeVector lhs_batch_shape(shape_.begin(), shape_.end() - 2);
+    SizeVector rhs_batch_shape(rhs.shape_.begin(), rhs.shape_.end() - 2);
+    SizeVector dst_shape;
+    if (rhs_batch_shape.empty() || lhs_batch_shape == rhs_batch_shape) {
+        dst_shape = lhs_batch_shape;
+    } else if (lhs_batch_shape.empty()) {
+        dst_shape = rhs_batch_shape;
+    } else {
+        utility::LogError("Tensor::Matmul: batch shapes {} and {} mismatch.",
+                          lhs_batch_shape, rhs_batch_shape);
+    }
+    const int64_t m = shape_[NumDims() - 2];
+    const int64_t k = shape_[NumDims() - 1];
+    const int64_t n = rhs.shape_[rhs.NumDims() - 1];
+    if (rhs.shape_[rhs.NumDims() - 2] != k) {
+        utility::LogError("Tensor::Matmul: shapes {} and {} mismatch.", shape_,
+                          rhs.shape_);
+    }
+    const int64_t batch_size = dst_shape.NumElements();
+    dst_shape.push_back(m);
+    dst_shape.push_back(n);
+
+    Tensor dst_tensor(dst_shape, dtype_, GetDevice());
+    Tensor dst_3d = dst_tensor.View({batch_size, m, n});
+    kernel::Matmul(
+            Contiguous().View({lhs_batch_shape.NumElements(), m, k}),
+            rhs.Contiguous().View({rhs_batch_shape.NumElements(), k, n}),
+            dst_3d);
+    return dst_tensor;
+}
+
+Tensor Tensor::Solve(const Tensor& rhs) const {
+    const int64_t n_dims = NumDims();
+    if (n_dims < 2 || shape_[n_dims - 1] != shape_[n_dims - 2]) {
+        utility::LogError(
+                "Tensor::Solve expects square matrices, but got shape {}.",
+                shape_);
+    }
+    const int64_t n = shape_[n_dims - 1];
+    SizeVector batch_shape(shape_.begin(), shape_.end() - 2);
+    const int64_t batch_size = batch_shape.NumElements();
+
+    // A vector right hand side is a single column.
+    SizeVector vector_shape = batch_shape;
+    vector_shape.push_back(n);
+    const bool is_vector =
+            rhs.shape_ == vector_shape || (n_dims == 2 && rhs.NumDims() == 1);
+    Tensor rhs_3d;
+    if (is_vector) {
+        if (rhs.NumElements() != batch_size * n) {
+            utility::LogError("Tensor::Solve: shapes {} and {} mismatch.",
+                              shape_, rhs.shape_);
+        }
+        rhs_3d = rhs.Contiguous().View({batch_size, n, 1});
+    } else {
+        if (rhs.NumDims() < 2 || rhs.shape_[rhs.NumDims() - 2] != n) {
+            utility::LogError("Tensor::Solve: shapes {} and {} mismatch.",
+                              shape_, rhs.shape_);
+        }
+        SizeVector rhs_batch_shape(rhs.shape_.begin(), rhs.shape_.end() - 2);
+        if (!rhs_batch_shape.empty() && rhs_batch_shape != batch_shape) {
+            utility::LogError(
+                    "Tensor::Solve: batch shapes {} and {} mismatch.",
+                    batch_shape, rhs_batch_shape);
+        }
+        const int64_t k = rhs.shape_[rhs.NumDims() - 1];
+        rhs_3d = rhs.Contiguous().View({rhs_batch_shape.NumElements(), n, k});
+    }
+
+    const int64_t k = rhs_3d.GetShape(2);
+    Tensor dst_3d({batch_size, n, k}, dtype_, GetDevice());
+    kernel::Solve(Contiguous().View({batch_size, n, n}), rhs_3d, dst_3d);
+
+    SizeVector dst_shape = batch_shape;
+    dst_shape.push_back(n);
+    if (!is_vector) {
+        dst_shape.push_back(k);
+    }
+    return dst_3d.View(dst_shape);
+}
+
+Tensor Tensor::Inverse() const {
+    const int64_t n_dims = NumDims();
+    if (n_dims < 2 || shape_[n_dims - 1] != shape_[n_dims - 2]) {
+        utility::LogError(
+                "Tensor::Inverse expects square matrices, but got shape {}.",
+                shape_);
+    }
+    return Solve(Eye(shape_[n_dims - 1], dtype_, GetDevice()));
+}
+
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -638,6 +946,14 @@ Tensor Tensor::Add_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Add(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Add", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_);
+    kernel::Add(*this, value, dst);
+    return dst;
+}
+
 Tensor Tensor::Sub(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -650,6 +966,14 @@ Tensor Tensor::Sub_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Sub(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Sub", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_);
+    kernel::Sub(*this, value, dst);
+    return dst;
+}
+
 Tensor Tensor::Mul(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -662,6 +986,14 @@ Tensor Tensor::Mul_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Mul(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Mul", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_);
+    kernel::Mul(*this, value, dst);
+    return dst;
+}
+
 Tensor Tensor::Div(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -674,6 +1006,14 @@ Tensor Tensor::Div_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Div(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Div", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       dtype_);
+    kernel::Div(*this, value, dst);
+    return dst;
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -681,10 +1021,19 @@ Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+Tensor Tensor::Sum(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor("Sum", dst,
+                       shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_);
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Sum);
+    return dst;
+}
+
 Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
-    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+    if (!DtypeUtil::IsFloat(dtype_)) {
         utility::LogError(
-                "Can only compute mean for Float32 or Float64, got {} instead.",
+                "Can only compute mean for Float16, Float32 or Float64, got {} "
+                "instead.",
                 DtypeUtil::ToString(dtype_));
     }
 
@@ -699,6 +1048,22 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     return sum * factor;
 }
 
+Tensor Tensor::Mean(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    if (!DtypeUtil::IsFloat(dtype_)) {
+        utility::LogError(
+                "Can only compute mean for Float16, Float32 or Float64, got {} "
+                "instead.",
+                DtypeUtil::ToString(dtype_));
+    }
+    if (NumElements() == 0) {
+        utility::LogWarning("Computing mean of 0-sized Tensor.");
+    }
+    Sum(dims, keepdim, dst);
+    double factor = static_cast<double>(dst.NumElements()) / NumElements();
+    dst.Mul_(factor);
+    return dst;
+}
+
 Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -706,6 +1071,14 @@ Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+Tensor Tensor::Prod(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor("Prod", dst,
+                       shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_);
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Prod);
+    return dst;
+}
+
 Tensor Tensor::Min(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -713,6 +1086,14 @@ Tensor Tensor::Min(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+Tensor Tensor::Min(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor("Min", dst,
+                       shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_);
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Min);
+    return dst;
+}
+
 Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -720,6 +1101,50 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+Tensor Tensor::Max(const SizeVector& dims, bool keepdim, Tensor& dst) const {
+    AssertOutputTensor("Max", dst,
+                       shape_util::ReductionShape(shape_, dims, keepdim),
+                       dtype_);
+    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Max);
+    return dst;
+}
+
+/// Runs a multi-output reduction and splits its packed result.
+static std::pair<Tensor, Tensor> MultiOutputReduction(
+        const Tensor& src,
+        const SizeVector& dims,
+        bool keepdim,
+        kernel::ReductionOpCode op_code) {
+    SizeVector dst_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, keepdim);
+    dst_shape.push_back(kernel::NUM_MULTI_REDUCTION_OUTPUTS);
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    kernel::Reduction(src, dst, dims, keepdim, op_code);
+    int64_t last_dim = dst.NumDims() - 1;
+    return {dst.IndexExtract(last_dim, 0), dst.IndexExtract(last_dim, 1)};
+}
+
+std::pair<Tensor, Tensor> Tensor::MinMax(const SizeVector& dims,
+                                         bool keepdim) const {
+    return MultiOutputReduction(*this, dims, keepdim,
+                                kernel::ReductionOpCode::MinMax);
+}
+
+std::pair<Tensor, Tensor> Tensor::MeanVar(const SizeVector& dims,
+                                          bool keepdim) const {
+    if (!DtypeUtil::IsFloat(dtype_)) {
+        utility::LogError(
+                "Can only compute mean and variance for Float16, Float32 or "
+                "Float64, got {} instead.",
+                DtypeUtil::ToString(dtype_));
+    }
+    if (NumElements() == 0) {
+        utility::LogWarning("Computing mean and variance of 0-sized Tensor.");
+    }
+    return MultiOutputReduction(*this, dims, keepdim,
+                                kernel::ReductionOpCode::MeanVar);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -727,6 +1152,14 @@ Tensor Tensor::ArgMin(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::ArgMin(const SizeVector& dims, Tensor& dst) const {
+    AssertOutputTensor("ArgMin", dst,
+                       shape_util::ReductionShape(shape_, dims, false),
+                       Dtype::Int64);
+    kernel::Reduction(*this, dst, dims, false, kernel::ReductionOpCode::ArgMin);
+    return dst;
+}
+
 Tensor Tensor::ArgMax(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), Dtype::Int64,
                GetDevice());
@@ -734,6 +1167,80 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::ArgMax(const SizeVector& dims, Tensor& dst) const {
+    AssertOutputTensor("ArgMax", dst,
+                       shape_util::ReductionShape(shape_, dims, false),
+                       Dtype::Int64);
+    kernel::Reduction(*this, dst, dims, false, kernel::ReductionOpCode::ArgMax);
+    return dst;
+}
+
+Tensor Tensor::ArgSort() const { return kernel::ArgSort(*this); }
+
+Tensor Tensor::Sort() const { return IndexGet({ArgSort()}); }
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    if (NumDims() != 1) {
+        utility::LogError("Unique: expected a 1-D tensor, but got shape {}.",
+                          shape_);
+    }
+    const int64_t n = NumElements();
+    Tensor sorted_indices = ArgSort();
+    Tensor sorted = IndexGet({sorted_indices});
+
+    // Mark the first element of each run of equal values.
+    Tensor is_first(shape_, Dtype::Bool, GetDevice());
+    if (n > 0) {
+        is_first.Slice(0, 0, 1).Fill(true);
+        is_first.Slice(0, 1, n).AsRvalue() =
+                sorted.Slice(0, 1, n).Ne(sorted.Slice(0, 0, n - 1));
+    }
+    Tensor values = sorted.MaskedSelect(is_first);
+    Tensor offsets = is_first.NonZero()[0];
+
+    Tensor inverse_indices(shape_, Dtype::Int64, GetDevice());
+    inverse_indices.IndexSet({sorted_indices},
+                             is_first.To(Dtype::Int64).CumSum(0) - 1);
+    Tensor counts = Tensor::Ones(shape_, Dtype::Int64, GetDevice())
+                            .SegmentSum(offsets);
+    return std::make_tuple(values, inverse_indices, counts);
+}
+
+Tensor Tensor::CumSum(int64_t dim, bool exclusive) const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::CumSum(*this, dst, dim, exclusive);
+    return dst;
+}
+
+/// Shared by SegmentSum, SegmentMin and SegmentMax.
+static Tensor SegmentReduction(const Tensor& src,
+                               const Tensor& segment_offsets,
+                               kernel::ReductionOpCode op_code) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reduction of a scalar tensor.");
+    }
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = segment_offsets.NumElements();
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    kernel::SegmentReduce(src, segment_offsets, dst, op_code);
+    return dst;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& segment_offsets) const {
+    return SegmentReduction(*this, segment_offsets,
+                            kernel::ReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& segment_offsets) const {
+    return SegmentReduction(*this, segment_offsets,
+                            kernel::ReductionOpCode::Min);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& segment_offsets) const {
+    return SegmentReduction(*this, segment_offsets,
+                            kernel::ReductionOpCode::Max);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -745,6 +1252,12 @@ Tensor Tensor::Sqrt_() {
     return *this;
 }
 
+Tensor Tensor::Sqrt(Tensor& dst) const {
+    AssertOutputTensor("Sqrt", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sqrt);
+    return dst;
+}
+
 Tensor Tensor::Sin() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sin);
@@ -756,6 +1269,12 @@ Tensor Tensor::Sin_() {
     return *this;
 }
 
+Tensor Tensor::Sin(Tensor& dst) const {
+    AssertOutputTensor("Sin", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Sin);
+    return dst;
+}
+
 Tensor Tensor::Cos() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Cos);
@@ -767,6 +1286,12 @@ Tensor Tensor::Cos_() {
     return *this;
 }
 
+Tensor Tensor::Cos(Tensor& dst) const {
+    AssertOutputTensor("Cos", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Cos);
+    return dst;
+}
+
 Tensor Tensor::Neg() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Neg);
@@ -778,6 +1303,12 @@ Tensor Tensor::Neg_() {
     return *this;
 }
 
+Tensor Tensor::Neg(Tensor& dst) const {
+    AssertOutputTensor("Neg", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Neg);
+    return dst;
+}
+
 Tensor Tensor::Exp() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Exp);
@@ -789,6 +1320,12 @@ Tensor Tensor::Exp_() {
     return *this;
 }
 
+Tensor Tensor::Exp(Tensor& dst) const {
+    AssertOutputTensor("Exp", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Exp);
+    return dst;
+}
+
 Tensor Tensor::Abs() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Abs);
@@ -800,6 +1337,12 @@ Tensor Tensor::Abs_() {
     return *this;
 }
 
+Tensor Tensor::Abs(Tensor& dst) const {
+    AssertOutputTensor("Abs", dst, shape_, dtype_);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::Abs);
+    return dst;
+}
+
 Device Tensor::GetDevice() const {
     if (blob_ == nullptr) {
         utility::LogError("Blob is null, cannot get device");
@@ -818,6 +1361,12 @@ Tensor Tensor::LogicalNot_() {
     return *this;
 }
 
+Tensor Tensor::LogicalNot(Tensor& dst) const {
+    AssertOutputTensor("LogicalNot", dst, shape_, Dtype::Bool);
+    kernel::UnaryEW(*this, dst, kernel::UnaryEWOpCode::LogicalNot);
+    return dst;
+}
+
 Tensor Tensor::LogicalAnd(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -831,6 +1380,14 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::LogicalAnd(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("LogicalAnd", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalAnd);
+    return dst;
+}
+
 Tensor Tensor::LogicalOr(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -844,6 +1401,14 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::LogicalOr(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("LogicalOr", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalOr);
+    return dst;
+}
+
 Tensor Tensor::LogicalXor(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -857,6 +1422,14 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::LogicalXor(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("LogicalXor", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::LogicalXor);
+    return dst;
+}
+
 Tensor Tensor::Gt(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -869,6 +1442,14 @@ Tensor Tensor::Gt_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Gt(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Gt", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Gt);
+    return dst;
+}
+
 Tensor Tensor::Lt(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -881,6 +1462,14 @@ Tensor Tensor::Lt_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Lt(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Lt", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Lt);
+    return dst;
+}
+
 Tensor Tensor::Ge(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -893,6 +1482,14 @@ Tensor Tensor::Ge_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Ge(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Ge", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Ge);
+    return dst;
+}
+
 Tensor Tensor::Le(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -905,6 +1502,14 @@ Tensor Tensor::Le_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Le(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Le", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Le);
+    return dst;
+}
+
 Tensor Tensor::Eq(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -917,6 +1522,14 @@ Tensor Tensor::Eq_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Eq(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Eq", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Eq);
+    return dst;
+}
+
 Tensor Tensor::Ne(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       Dtype::Bool, GetDevice());
@@ -929,6 +1542,14 @@ Tensor Tensor::Ne_(const Tensor& value) {
     return *this;
 }
 
+Tensor Tensor::Ne(const Tensor& value, Tensor& dst) const {
+    AssertOutputTensor("Ne", dst,
+                       shape_util::BroadcastedShape(shape_, value.shape_),
+                       Dtype::Bool);
+    kernel::BinaryEW(*this, value, dst, kernel::BinaryEWOpCode::Ne);
+    return dst;
+}
+
 std::vector<Tensor> Tensor::NonZeroNumpy() const {
     Tensor result = kernel::NonZero(*this);
     std::vector<Tensor> results;
@@ -940,4 +1561,8 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::MaskedSelect(const Tensor& mask) const {
+    return kernel::MaskedSelect(*this, mask);
+}
+
 }  // namespace open3d
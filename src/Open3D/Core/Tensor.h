@@ -29,6 +29,8 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/DLPack/DLPackConverter.h"
@@ -41,6 +43,8 @@
 
 namespace open3d {
 
+class LazyTensor;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -97,19 +101,20 @@ public:
 
     /// Shallow copy constructor with lvalue input, e.g. `Tensor dst(src)`.
     Tensor(const Tensor& other)
-        : Tensor(other.GetShape(),
-                 other.GetStrides(),
-                 const_cast<void*>(other.GetDataPtr()),
-                 other.GetDtype(),
-                 other.GetBlob()) {}
+        : shape_(other.shape_),
+          strides_(other.strides_),
+          data_ptr_(other.data_ptr_),
+          dtype_(other.dtype_),
+          blob_(other.blob_) {}
 
     /// Shallow copy constructor with rvalue input, e.g. `Tensor dst(src[0])`.
+    /// The blob is moved, which saves the reference count updates.
     Tensor(Tensor&& other)
-        : Tensor(other.GetShape(),
-                 other.GetStrides(),
-                 other.GetDataPtr(),
-                 other.GetDtype(),
-                 other.GetBlob()) {}
+        : shape_(std::move(other.shape_)),
+          strides_(std::move(other.strides_)),
+          data_ptr_(other.data_ptr_),
+          dtype_(other.dtype_),
+          blob_(std::move(other.blob_)) {}
 
     /// Tensor assignment lvalue = lvalue, e.g. `tensor_a = tensor_b`, resulting
     /// in a "shallow" copy.
@@ -155,6 +160,10 @@ public:
                         Dtype dtype,
                         const Device& device = Device("CPU:0"));
 
+    /// Create a CPU tensor with uninitilized values in pinned (page-locked)
+    /// host memory. Requires CUDA.
+    static Tensor EmptyPinned(const SizeVector& shape, Dtype dtype);
+
     /// Create a tensor fill with specified value.
     template <typename T>
     static Tensor Full(const SizeVector& shape,
@@ -176,6 +185,37 @@ public:
                        Dtype dtype,
                        const Device& device = Device("CPU:0"));
 
+    /// Create an identity matrix of size n x n.
+    static Tensor Eye(int64_t n,
+                      Dtype dtype,
+                      const Device& device = Device("CPU:0"));
+
+    /// \brief Create a tensor of uniform random values in [\p low, \p high).
+    ///
+    /// Values are generated on \p device by the counter-based Philox4x32
+    /// generator, such that the same \p seed gives the same values on every
+    /// device and for any number of threads.
+    /// \param dtype Float32 or Float64.
+    /// \param seed Seed of the generator, -1 for a random seed.
+    static Tensor Rand(const SizeVector& shape,
+                       Dtype dtype = Dtype::Float32,
+                       const Device& device = Device("CPU:0"),
+                       double low = 0.0,
+                       double high = 1.0,
+                       int64_t seed = -1);
+
+    /// \brief Create a tensor of uniform random integers in [\p low,
+    /// \p high), see Rand().
+    ///
+    /// \param dtype An integer dtype that can hold [\p low, \p high).
+    /// \param seed Seed of the generator, -1 for a random seed.
+    static Tensor Randint(int64_t low,
+                          int64_t high,
+                          const SizeVector& shape,
+                          Dtype dtype = Dtype::Int64,
+                          const Device& device = Device("CPU:0"),
+                          int64_t seed = -1);
+
     /// Pythonic __getitem__ for tensor.
     ///
     /// Returns a view of the original tensor, if TensorKey is
@@ -309,6 +349,37 @@ public:
     /// The resulting Tensor will be compacted and contiguous
     Tensor Copy(const Device& device) const;
 
+    /// Copies the Tensor's values to the preallocated \p dst, which must have
+    /// the same shape and dtype but may be on another device. Returns \p dst.
+    Tensor Copy(Tensor& dst) const;
+
+    /// Returns a contiguous copy of a CPU Tensor in pinned host memory, or the
+    /// Tensor itself if it is already pinned. Copies from and to pinned
+    /// Tensors run at full PCIe bandwidth and, on a non-default CUDAStream,
+    /// host-to-device copies do not block.
+    Tensor PinMemory() const;
+
+    /// Returns true if the Tensor's memory is pinned host memory.
+    bool IsPinned() const;
+
+    /// Splits the Tensor along dimension 0 into one contiguous shard per
+    /// device of \p devices, e.g. to distribute a point set over several
+    /// GPUs. Copies between CUDA devices use peer-to-peer transfers when
+    /// available.
+    /// \param devices The device of each shard. A device may appear more than
+    /// once.
+    /// \param sizes The size of each shard along dimension 0. If empty, the
+    /// shards are of equal size, with the first shards holding one extra
+    /// element if the size is not divisible by the number of devices.
+    std::vector<Tensor> Shard(const std::vector<Device>& devices,
+                              const std::vector<int64_t>& sizes = {}) const;
+
+    /// Concatenates \p shards along dimension 0 into a new Tensor on
+    /// \p device. The shards may be on different devices, but must have the
+    /// same dtype and the same shape except for dimension 0.
+    static Tensor FromShards(const std::vector<Tensor>& shards,
+                             const Device& device);
+
     /// Copy Tensor values to current tensor for source tensor
     void CopyFrom(const Tensor& other);
 
@@ -321,6 +392,10 @@ public:
     /// is avoided when the original tensor already have the targeted dtype.
     Tensor To(Dtype dtype, bool copy = false) const;
 
+    /// Converts the Tensor to \p dtype, writing to the preallocated \p dst of
+    /// the same shape. Returns \p dst.
+    Tensor To(Dtype dtype, Tensor& dst) const;
+
     std::string ToString(bool with_suffix = true,
                          const std::string& indent = "") const;
 
@@ -352,6 +427,11 @@ public:
     /// https://docs.scipy.org/doc/numpy/reference/arrays.indexing.html
     Tensor IndexGet(const std::vector<Tensor>& index_tensors) const;
 
+    /// Advanced indexing getter writing to the preallocated \p dst, which
+    /// must have the indexed shape and the Tensor's dtype. Returns \p dst.
+    Tensor IndexGet(const std::vector<Tensor>& index_tensors,
+                    Tensor& dst) const;
+
     /// \brief Advanced indexing getter.
     ///
     /// We use the Numpy advanced indexing symnatics, see:
@@ -384,6 +464,21 @@ public:
     /// 0-D and 1-D Tensor remains the same.
     Tensor T() const;
 
+    /// Matrix multiplication of (..., M, K) and (..., K, N) Tensors. The
+    /// leading batch dimensions must match, or one operand must be 2-D and is
+    /// then broadcasted over the batch dimensions of the other. Only Float32
+    /// and Float64 are supported.
+    Tensor Matmul(const Tensor& rhs) const;
+
+    /// Solves A X = B, where A is this Tensor of shape (..., N, N) and B is
+    /// \p rhs of shape (..., N, K), or (N, K) to share B over the batch.
+    /// A vector \p rhs of shape (..., N) gives a result of shape (..., N).
+    /// Singular systems produce non-finite values. On CUDA, N <= 6.
+    Tensor Solve(const Tensor& rhs) const;
+
+    /// Inverts square matrices of shape (..., N, N). On CUDA, N <= 6.
+    Tensor Inverse() const;
+
     /// Helper function to return scalar value of a scalar Tensor, the Tensor
     /// mush have empty shape ()
     template <typename T>
@@ -422,6 +517,10 @@ public:
         return Add_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Adds a tensor and writes the result to the preallocated \p dst, which
+    /// must have the broadcasted shape and the same dtype. Returns \p dst.
+    Tensor Add(const Tensor& value, Tensor& dst) const;
+
     /// Substracts a tensor and returns the resulting tensor.
     Tensor Sub(const Tensor& value) const;
     template <typename T>
@@ -447,6 +546,11 @@ public:
         return Sub_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Substracts a tensor and writes the result to the preallocated \p dst,
+    /// which must have the broadcasted shape and the same dtype. Returns
+    /// \p dst.
+    Tensor Sub(const Tensor& value, Tensor& dst) const;
+
     /// Multiplies a tensor and returns the resulting tensor.
     Tensor Mul(const Tensor& value) const;
     template <typename T>
@@ -472,6 +576,11 @@ public:
         return Mul_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Multiplies a tensor and writes the result to the preallocated \p dst,
+    /// which must have the broadcasted shape and the same dtype. Returns
+    /// \p dst.
+    Tensor Mul(const Tensor& value, Tensor& dst) const;
+
     /// Divides a tensor and returns the resulting tensor.
     Tensor Div(const Tensor& value) const;
     template <typename T>
@@ -497,31 +606,71 @@ public:
         return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
     }
 
+    /// Divides a tensor and writes the result to the preallocated \p dst, which
+    /// must have the broadcasted shape and the same dtype. Returns \p dst.
+    Tensor Div(const Tensor& value, Tensor& dst) const;
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Sum(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Computes the sum along \p dims into the preallocated \p dst, which
+    /// must have the reduced shape and the same dtype. Returns \p dst.
+    Tensor Sum(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns the mean of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Mean(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Computes the mean along \p dims into the preallocated \p dst, which
+    /// must have the reduced shape and the same dtype. Returns \p dst.
+    Tensor Mean(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns the product of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Prod(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Computes the product along \p dims into the preallocated \p dst, which
+    /// must have the reduced shape and the same dtype. Returns \p dst.
+    Tensor Prod(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns min of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Min(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Computes the min along \p dims into the preallocated \p dst, which
+    /// must have the reduced shape and the same dtype. Returns \p dst.
+    Tensor Min(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
     /// Returns max of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Computes the max along \p dims into the preallocated \p dst, which
+    /// must have the reduced shape and the same dtype. Returns \p dst.
+    Tensor Max(const SizeVector& dims, bool keepdim, Tensor& dst) const;
+
+    /// Returns the min and max of the tensor along the given \p dims,
+    /// computed in a single pass. The results are views into one buffer and
+    /// have the same shapes as Min() and Max().
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::pair<Tensor, Tensor> MinMax(const SizeVector& dims,
+                                     bool keepdim = false) const;
+
+    /// Returns the mean and the population variance of the tensor along the
+    /// given \p dims, computed in a single pass with Welford's algorithm. The
+    /// results are views into one buffer. Only float dtypes are supported.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::pair<Tensor, Tensor> MeanVar(const SizeVector& dims,
+                                      bool keepdim = false) const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -532,6 +681,10 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMin(const SizeVector& dims) const;
 
+    /// Version of ArgMin() writing to the preallocated Int64 tensor \p dst.
+    /// Returns \p dst.
+    Tensor ArgMin(const SizeVector& dims, Tensor& dst) const;
+
     /// Returns maximum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -542,41 +695,101 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Version of ArgMax() writing to the preallocated Int64 tensor \p dst.
+    /// Returns \p dst.
+    Tensor ArgMax(const SizeVector& dims, Tensor& dst) const;
+
+    /// Returns the Int64 indices that sort the 1-D tensor in ascending order.
+    /// The sort is stable, i.e. equal values keep their relative order.
+    Tensor ArgSort() const;
+
+    /// Returns the 1-D tensor sorted in ascending order.
+    Tensor Sort() const;
+
+    /// Returns the tuple (values, inverse_indices, counts) of the 1-D tensor,
+    /// where values are the sorted unique values, values[inverse_indices] is
+    /// the original tensor and counts are the number of occurrences of each
+    /// value.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// Returns the cumulative sum along \p dim. If \p exclusive, the i-th
+    /// output is the sum of the elements before the i-th one, starting from 0.
+    Tensor CumSum(int64_t dim, bool exclusive = false) const;
+
+    /// Returns the sum of consecutive segments of rows, i.e. along dimension
+    /// 0. \p segment_offsets is a 1-D Int64 tensor of the first row of each
+    /// segment in non-decreasing order, the last segment ends at the last
+    /// row. E.g. with the counts of Unique() of sorted keys, the offsets are
+    /// counts.CumSum(0, true). Empty segments sum to 0.
+    Tensor SegmentSum(const Tensor& segment_offsets) const;
+
+    /// Returns the min of consecutive segments of rows, see SegmentSum().
+    /// Empty segments are set to the max value of the dtype.
+    Tensor SegmentMin(const Tensor& segment_offsets) const;
+
+    /// Returns the max of consecutive segments of rows, see SegmentSum().
+    /// Empty segments are set to the lowest value of the dtype.
+    Tensor SegmentMax(const Tensor& segment_offsets) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
     /// Element-wise square root of a tensor, in-place.
     Tensor Sqrt_();
 
+    /// Version of Sqrt() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Sqrt(Tensor& dst) const;
+
     /// Element-wise sine of a tensor, returning a new tensor.
     Tensor Sin() const;
 
     /// Element-wise sine of a tensor, in-place.
     Tensor Sin_();
 
+    /// Version of Sin() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Sin(Tensor& dst) const;
+
     /// Element-wise cosine of a tensor, returning a new tensor.
     Tensor Cos() const;
 
     /// Element-wise cosine of a tensor, in-place.
     Tensor Cos_();
 
+    /// Version of Cos() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Cos(Tensor& dst) const;
+
     /// Element-wise negation of a tensor, returning a new tensor.
     Tensor Neg() const;
 
     /// Element-wise negation of a tensor, in-place.
     Tensor Neg_();
 
+    /// Version of Neg() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Neg(Tensor& dst) const;
+
     /// Element-wise exponential of a tensor, returning a new tensor.
     Tensor Exp() const;
 
     /// Element-wise base-e exponential of a tensor, in-place.
     Tensor Exp_();
 
+    /// Version of Exp() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Exp(Tensor& dst) const;
+
     /// Element-wise absolute value of a tensor, returning a new tensor.
     Tensor Abs() const;
 
     /// Element-wise absolute value of a tensor, in-place.
     Tensor Abs_();
+
+    /// Version of Abs() writing to the preallocated \p dst of the same shape
+    /// and dtype. Returns \p dst.
+    Tensor Abs(Tensor& dst) const;
     /// Element-wise logical not of a tensor, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, 0 will be treated as False, while non-zero
@@ -591,6 +804,10 @@ public:
     /// the tensor's dtype.
     Tensor LogicalNot_();
 
+    /// Version of LogicalNot() writing to the preallocated boolean tensor
+    /// \p dst of the same shape. Returns \p dst.
+    Tensor LogicalNot(Tensor& dst) const;
+
     /// Element-wise logical and of a tensor, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, zero will be treated as False, while
@@ -606,6 +823,10 @@ public:
     /// the tensor's dtype.
     Tensor LogicalAnd_(const Tensor& value);
 
+    /// Version of LogicalAnd() writing to the preallocated boolean tensor
+    /// \p dst of the broadcasted shape. Returns \p dst.
+    Tensor LogicalAnd(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise logical or of tensors, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, zero will be treated as False, while
@@ -621,6 +842,10 @@ public:
     /// the tensor's dtype.
     Tensor LogicalOr_(const Tensor& value);
 
+    /// Version of LogicalOr() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor LogicalOr(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise logical exclusive-or of tensors, returning a new boolean
     /// tensor.
     ///
@@ -636,6 +861,10 @@ public:
     /// 0 or 1 casted to the tensor's dtype.
     Tensor LogicalXor_(const Tensor& value);
 
+    /// Version of LogicalXor() writing to the preallocated boolean tensor
+    /// \p dst of the broadcasted shape. Returns \p dst.
+    Tensor LogicalXor(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise greater-than of tensors, returning a new boolean tensor.
     Tensor Gt(const Tensor& value) const;
     Tensor operator>(const Tensor& value) const { return Gt(value); }
@@ -644,6 +873,10 @@ public:
     /// won't change the tensor's dtype.
     Tensor Gt_(const Tensor& value);
 
+    /// Version of Gt() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Gt(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise less-than of tensors, returning a new boolean tensor.
     Tensor Lt(const Tensor& value) const;
     Tensor operator<(const Tensor& value) const { return Lt(value); }
@@ -652,6 +885,10 @@ public:
     /// the tensor's dtype.
     Tensor Lt_(const Tensor& value);
 
+    /// Version of Lt() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Lt(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise greater-than-or-equals-to of tensors, returning a new
     /// boolean tensor.
     Tensor Ge(const Tensor& value) const;
@@ -661,6 +898,10 @@ public:
     /// operation won't change the tensor's dtype.
     Tensor Ge_(const Tensor& value);
 
+    /// Version of Ge() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Ge(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise less-than-or-equals-to of tensors, returning a new boolean
     /// tensor.
     Tensor Le(const Tensor& value) const;
@@ -670,6 +911,10 @@ public:
     /// won't change the tensor's dtype.
     Tensor Le_(const Tensor& value);
 
+    /// Version of Le() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Le(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise equals-to of tensors, returning a new boolean tensor.
     Tensor Eq(const Tensor& value) const;
     Tensor operator==(const Tensor& value) const { return Eq(value); }
@@ -678,6 +923,10 @@ public:
     /// operation won't change the tensor's dtype.
     Tensor Eq_(const Tensor& value);
 
+    /// Version of Eq() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Eq(const Tensor& value, Tensor& dst) const;
+
     /// Element-wise not-equals-to of tensors, returning a new boolean tensor.
     Tensor Ne(const Tensor& value) const;
     Tensor operator!=(const Tensor& value) const { return Ne(value); }
@@ -686,6 +935,10 @@ public:
     /// operation won't change the tensor's dtype.
     Tensor Ne_(const Tensor& value);
 
+    /// Version of Ne() writing to the preallocated boolean tensor \p dst
+    /// of the broadcasted shape. Returns \p dst.
+    Tensor Ne(const Tensor& value, Tensor& dst) const;
+
     /// Find the indices of the elements that are non-zero. Returns a vector of
     /// int64 Tensors, each containing the indices of the non-zero elements in
     /// each dimension.
@@ -697,6 +950,13 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Select the elements where the boolean \p mask is true, like
+    /// tensor[mask] in numpy. The shape of \p mask must match the leading
+    /// dimensions of the tensor. Returns a new tensor of shape
+    /// {num_true} + shape[mask.NumDims():], computed in a single compaction
+    /// pass without materializing index tensors.
+    Tensor MaskedSelect(const Tensor& mask) const;
+
     /// Retrive all values as an std::vector, for debugging and testing
     template <typename T>
     std::vector<T> ToFlatVector() const {
@@ -719,6 +979,11 @@ public:
     /// used.
     Tensor Contiguous() const;
 
+    /// Returns a LazyTensor wrapping this Tensor. Elementwise ops on the
+    /// LazyTensor are recorded and evaluated by a single fused kernel in
+    /// LazyTensor::Materialize(). Include "Open3D/Core/LazyTensor.h" to use.
+    LazyTensor Lazy() const;
+
     inline SizeVector GetShape() const { return shape_; }
 
     inline const SizeVector& GetShapeRef() const { return shape_; }
@@ -25,6 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Core/TensorList.h"
+
+#include <algorithm>
+#include <numeric>
+
 #include "Open3D/Core/SizeVector.h"
 
 namespace open3d {
@@ -85,6 +89,10 @@ TensorList TensorList::FromTensor(const Tensor& tensor, bool inplace) {
 TensorList::TensorList(const TensorList& other) { CopyFrom(other); }
 
 void TensorList::CopyFrom(const TensorList& other) {
+    other.Compact();
+    blocks_.clear();
+    block_sizes_.clear();
+    chunked_ = other.IsChunked();
     shape_ = other.GetShape();
     dtype_ = other.GetDtype();
     device_ = other.GetDevice();
@@ -99,6 +107,10 @@ TensorList& TensorList::operator=(const TensorList& other) & {
 }
 
 void TensorList::ShallowCopyFrom(const TensorList& other) {
+    other.Compact();
+    blocks_.clear();
+    block_sizes_.clear();
+    chunked_ = other.IsChunked();
     shape_ = other.GetShape();
     dtype_ = other.GetDtype();
     device_ = other.GetDevice();
@@ -108,10 +120,29 @@ void TensorList::ShallowCopyFrom(const TensorList& other) {
 }
 
 Tensor TensorList::AsTensor() const {
+    Compact();
     return internal_tensor_.Slice(0 /* dim */, 0, size_);
 }
 
+void TensorList::Reserve(int64_t n) {
+    // Follow the same growth policy as PushBack, so that appending up to n
+    // tensors never triggers another expansion.
+    int64_t new_reserved_size = ReserveSize(n);
+    if (new_reserved_size > reserved_size_) {
+        Compact();
+        ExpandTensor(new_reserved_size);
+    }
+}
+
+void TensorList::SetChunked(bool chunked) {
+    if (!chunked) {
+        Compact();
+    }
+    chunked_ = chunked;
+}
+
 void TensorList::Resize(int64_t n) {
+    Compact();
     // Increase internal tensor size
     int64_t new_reserved_size = ReserveSize(n);
     if (new_reserved_size > reserved_size_) {
@@ -131,6 +162,12 @@ void TensorList::PushBack(const Tensor& tensor) {
                           tensor.GetShape());
     }
 
+    if (chunked_) {
+        ChunkedAppendSlice(1)[0] = tensor;
+        ++size_;
+        return;
+    }
+
     int64_t new_reserved_size = ReserveSize(size_ + 1);
     if (new_reserved_size > reserved_size_) {
         ExpandTensor(new_reserved_size);
@@ -172,12 +209,19 @@ void TensorList::Extend(const TensorList& other) {  // Check consistency
     // Shallow copy by default
     TensorList extension = other;
 
-    // Make a deep copy to avoid corrupting duplicate data
-    if (GetInternalTensor().GetDataPtr() ==
-        other.GetInternalTensor().GetDataPtr()) {
+    // Make a deep copy to avoid corrupting duplicate data. The internal
+    // tensors are compared directly to not compact the blocks.
+    if (this == &other || internal_tensor_.GetDataPtr() ==
+                                  other.internal_tensor_.GetDataPtr()) {
         extension = TensorList(*this);
     }
 
+    if (chunked_) {
+        ChunkedAppendSlice(extension.GetSize()) = extension.AsTensor();
+        size_ = size_ + extension.GetSize();
+        return;
+    }
+
     int64_t new_reserved_size = ReserveSize(size_ + extension.GetSize());
     if (new_reserved_size > reserved_size_) {
         ExpandTensor(new_reserved_size);
@@ -189,10 +233,25 @@ void TensorList::Extend(const TensorList& other) {  // Check consistency
 
 Tensor TensorList::operator[](int64_t index) const {
     index = WrapDim(index, size_);  // WrapDim asserts index is within range.
-    return internal_tensor_[index];
+    // Chunked mode: look up the block instead of compacting.
+    index -= InternalSize();
+    if (index < 0) {
+        return internal_tensor_[index + InternalSize()];
+    }
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+        if (index < block_sizes_[i]) {
+            return blocks_[i][index];
+        }
+        index -= block_sizes_[i];
+    }
+    utility::LogError("Internal error: index out of range of the blocks.");
 }
 
-void TensorList::Clear() { *this = TensorList(shape_, dtype_, device_); }
+void TensorList::Clear() {
+    const bool chunked = chunked_;
+    *this = TensorList(shape_, dtype_, device_);
+    chunked_ = chunked;
+}
 
 // Protected
 void TensorList::ExpandTensor(int64_t new_reserved_size) {
@@ -210,6 +269,53 @@ void TensorList::ExpandTensor(int64_t new_reserved_size) {
     reserved_size_ = new_reserved_size;
 }
 
+Tensor TensorList::ChunkedAppendSlice(int64_t n) {
+    Tensor& last_block = blocks_.empty() ? internal_tensor_ : blocks_.back();
+    const int64_t last_block_size =
+            blocks_.empty() ? InternalSize() : block_sizes_.back();
+    if (last_block.GetShape()[0] - last_block_size >= n) {
+        if (!blocks_.empty()) {
+            block_sizes_.back() += n;
+        }
+        return last_block.Slice(0 /* dim */, last_block_size,
+                                last_block_size + n);
+    }
+
+    // Reserve as much as the current size, such that the total reserved size
+    // grows geometrically as in the default mode.
+    const int64_t block_reserved_size = std::max(n, size_);
+    blocks_.emplace_back(ExpandFrontDim(shape_, block_reserved_size), dtype_,
+                         device_);
+    block_sizes_.push_back(n);
+    reserved_size_ += block_reserved_size;
+    return blocks_.back().Slice(0 /* dim */, 0, n);
+}
+
+void TensorList::Compact() const {
+    if (blocks_.empty()) {
+        return;
+    }
+    Tensor compacted(ExpandFrontDim(shape_, reserved_size_), dtype_, device_);
+    int64_t offset = InternalSize();
+    if (offset > 0) {
+        compacted.Slice(0 /* dim */, 0, offset) =
+                internal_tensor_.Slice(0 /* dim */, 0, offset);
+    }
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+        compacted.Slice(0 /* dim */, offset, offset + block_sizes_[i]) =
+                blocks_[i].Slice(0 /* dim */, 0, block_sizes_[i]);
+        offset += block_sizes_[i];
+    }
+    internal_tensor_ = compacted;
+    blocks_.clear();
+    block_sizes_.clear();
+}
+
+int64_t TensorList::InternalSize() const {
+    return size_ - std::accumulate(block_sizes_.begin(), block_sizes_.end(),
+                                   int64_t(0));
+}
+
 SizeVector TensorList::ExpandFrontDim(const SizeVector& shape,
                                       int64_t new_dim_size /* = 1 */) {
     SizeVector expanded_shape = {new_dim_size};
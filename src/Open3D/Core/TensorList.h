@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Open3D/Core/Blob.h"
 #include "Open3D/Core/Device.h"
@@ -46,6 +47,14 @@ namespace open3d {
 /// Typical use cases:
 /// - Pointcloud: (N, 3)
 /// - Sparse Voxel Grid: (N, 8, 8, 8)
+///
+/// By default, the tensors are stored in one contiguous internal tensor whose
+/// reserved size doubles when it is exceeded, copying all existing data. In
+/// chunked mode (see SetChunked()), appending beyond the reserved size
+/// allocates a new block instead, so the cost of PushBack() and Extend() is
+/// proportional to the appended data. The blocks are compacted into one
+/// internal tensor on the first access that needs contiguous data, e.g.
+/// AsTensor().
 class TensorList {
 public:
     /// Constructor for creating an (empty by default) tensor list.
@@ -120,8 +129,19 @@ public:
     void ShallowCopyFrom(const TensorList& other);
 
     /// Return the reference of the contained valid tensors with shared memory.
+    /// In chunked mode, pending blocks are compacted first.
     Tensor AsTensor() const;
 
+    /// Reserve space for at least \p n tensors, such that appending up to
+    /// \p n tensors in total does not reallocate. Existing data is copied
+    /// once if the reserved size increases.
+    void Reserve(int64_t n);
+
+    /// Enable or disable chunked mode. Disabling it compacts pending blocks.
+    void SetChunked(bool chunked);
+
+    bool IsChunked() const { return chunked_; }
+
     /// Resize an existing tensor list.
     /// If the size increases, the increased part will be assigned 0.
     /// If the size decreases, the decreased part's value will be undefined.
@@ -171,7 +191,11 @@ public:
 
     int64_t GetReservedSize() const { return reserved_size_; }
 
-    const Tensor& GetInternalTensor() const { return internal_tensor_; }
+    /// In chunked mode, pending blocks are compacted first.
+    const Tensor& GetInternalTensor() const {
+        Compact();
+        return internal_tensor_;
+    }
 
 protected:
     // The shared internal constructor for iterators.
@@ -231,6 +255,17 @@ protected:
     /// with reserved_size_ = (1 << (ceil(log2(size_)) + 1)).
     int64_t ReserveSize(int64_t n);
 
+    /// Chunked mode: return the slice for the next \p n tensors, in the last
+    /// block if it has enough space left, or in a new block with a reserved
+    /// size of max(n, size_) otherwise. The caller increases size_.
+    Tensor ChunkedAppendSlice(int64_t n);
+
+    /// Copy the blocks into one internal tensor of reserved_size_.
+    void Compact() const;
+
+    /// Number of tensors in the internal tensor, the rest are in blocks_.
+    int64_t InternalSize() const;
+
 protected:
     /// The shape_ represents the shape for each element in the TensorList.
     /// The internal_tensor_'s shape is (reserved_size_, *shape_).
@@ -251,7 +286,15 @@ protected:
     /// front (size_, *shape_) is active.
     int64_t size_ = 0;
 
-    /// The internal tensor for data storage.
-    Tensor internal_tensor_;
+    /// The internal tensor for data storage. Mutable since the blocks are
+    /// compacted into it lazily.
+    mutable Tensor internal_tensor_;
+
+    /// Chunked mode: blocks with shape (block_reserved_size, *shape_) holding
+    /// the tensors appended after the internal tensor, and the number of valid
+    /// tensors in each block. reserved_size_ includes the blocks.
+    bool chunked_ = false;
+    mutable std::vector<Tensor> blocks_;
+    mutable std::vector<int64_t> block_sizes_;
 };
 }  // namespace open3d
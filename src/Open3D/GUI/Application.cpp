@@ -28,8 +28,8 @@
 
 #include <GLFW/glfw3.h>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <list>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -98,7 +98,8 @@ struct Application::Impl {
     std::string resource_path_;
     Theme theme_;
     double last_time_ = 0.0;
-    bool is_GLFW_initalized_ = false;
+    // Read by PostToMainThread() on other threads
+    std::atomic<bool> is_GLFW_initalized_{false};
     bool is_running_ = false;
     bool should_quit_ = false;
 
@@ -106,7 +107,7 @@ struct Application::Impl {
     std::unordered_set<std::shared_ptr<Window>> windows_;
     std::unordered_set<std::shared_ptr<Window>> windows_to_be_destroyed_;
 
-    std::list<Task> running_tasks_;  // always accessed from main thread
+    std::unique_ptr<TaskQueue> tasks_;  // always accessed from main thread
     // ----
     struct Posted {
         Window *window;
@@ -337,14 +338,9 @@ bool Application::RunOneTick() {
 
     // Cleanup if we are done
     if (status == RunStatus::DONE) {
-        // Clear all the running tasks. The destructor will wait for them to
-        // finish.
-        for (auto it = impl_->running_tasks_.begin();
-             it != impl_->running_tasks_.end(); ++it) {
-            auto current = it;
-            ++it;
-            impl_->running_tasks_.erase(current);  // calls join()
-        }
+        // Cancel the queued tasks; the destructor waits for the running
+        // ones to finish.
+        impl_->tasks_.reset();
 
         glfwTerminate();
         impl_->is_GLFW_initalized_ = false;
@@ -355,13 +351,27 @@ bool Application::RunOneTick() {
 }
 
 Application::RunStatus Application::ProcessQueuedEvents() {
-    glfwWaitEventsTimeout(RUNLOOP_DELAY_SEC);
+    // Only wake up for ticks if a window needs them, so that idle windows
+    // use no CPU or GPU. Input, expose events and PostToMainThread() wake
+    // up the loop otherwise.
+    bool needs_ticks = false;
+    for (auto w : impl_->windows_) {
+        if (w->NeedsTicks(Now())) {
+            needs_ticks = true;
+            break;
+        }
+    }
+    if (needs_ticks) {
+        glfwWaitEventsTimeout(RUNLOOP_DELAY_SEC);
+    } else {
+        glfwWaitEvents();
+    }
 
     // Handle tick messages.
     double now = Now();
     if (now - impl_->last_time_ >= 0.95 * RUNLOOP_DELAY_SEC) {
         for (auto w : impl_->windows_) {
-            if (w->OnTickEvent(TickEvent())) {
+            if (w->OnTickEvent(TickEvent()) || w->IsContinuousRedraw()) {
                 w->PostRedraw();
             }
         }
@@ -385,10 +395,6 @@ Application::RunStatus Application::ProcessQueuedEvents() {
         impl_->posted_.clear();
     }
 
-    // Clear any tasks that have finished
-    impl_->running_tasks_.remove_if(
-            [](const Task &t) { return t.IsFinished(); });
-
     // We can't destroy a GLFW window in a callback, so we need to do it here.
     // Since these are the only copy of the shared pointers, this will cause
     // the Window destructor to be called.
@@ -401,14 +407,35 @@ Application::RunStatus Application::ProcessQueuedEvents() {
 }
 
 void Application::RunInThread(std::function<void()> f) {
+    RunInThread([f](const CancellationToken &) { f(); }, TaskPriority::NORMAL);
+}
+
+CancellationToken Application::RunInThread(
+        std::function<void(const CancellationToken &)> f,
+        TaskPriority priority,
+        const char *group /*= nullptr*/) {
     // We need to be on the main thread here.
-    impl_->running_tasks_.emplace_back(f);
-    impl_->running_tasks_.back().Run();
+    if (!impl_->tasks_) {
+        impl_->tasks_ = std::make_unique<TaskQueue>();
+    }
+    return impl_->tasks_->Enqueue(f, priority, group ? group : "");
+}
+
+void Application::CancelTasks(const char *group) {
+    if (impl_->tasks_ && group) {
+        impl_->tasks_->CancelGroup(group);
+    }
 }
 
 void Application::PostToMainThread(Window *window, std::function<void()> f) {
-    std::lock_guard<std::mutex> lock(impl_->posted_lock_);
-    impl_->posted_.emplace_back(window, f);
+    {
+        std::lock_guard<std::mutex> lock(impl_->posted_lock_);
+        impl_->posted_.emplace_back(window, f);
+    }
+    // Wake up the run loop, which may be waiting for events
+    if (impl_->is_GLFW_initalized_) {
+        glfwPostEmptyEvent();
+    }
 }
 
 const char *Application::GetResourcePath() const {
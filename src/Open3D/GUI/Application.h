@@ -30,6 +30,7 @@
 #include <memory>
 
 #include "Open3D/GUI/Menu.h"
+#include "Open3D/GUI/Task.h"
 
 namespace open3d {
 namespace gui {
@@ -65,8 +66,21 @@ public:
     /// PostToMainThread() with code that will do the UI (note: your function
     /// may finish before the code given to PostToMainThread will run, so if
     /// using lambdas, capture by copy and make sure whatever you use will
-    /// still be alive).
+    /// still be alive). The functions run on a bounded pool of worker
+    /// threads, so they may wait in a queue before they start.
     void RunInThread(std::function<void()> f);
+    /// Like RunInThread(f), but \p f is queued with \p priority and gets a
+    /// token that is cancelled when the application quits. If \p group is
+    /// not null, tasks previously started with the same group are cancelled,
+    /// which is useful for work superseded by newer requests (e.g. loading
+    /// a file while another one is still loading). \p f should check the
+    /// token and skip posting its results if cancelled.
+    CancellationToken RunInThread(
+            std::function<void(const CancellationToken &)> f,
+            TaskPriority priority,
+            const char *group = nullptr);
+    /// Cancels the queued and running tasks started with \p group.
+    void CancelTasks(const char *group);
     /// Runs \param f on the main thread at some point in the near future.
     /// Proper context will be setup for \param window. \p f will block the
     /// UI, so it should run quickly. If you need to do something slow
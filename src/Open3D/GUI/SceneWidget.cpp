@@ -27,6 +27,8 @@
 #include "Open3D/GUI/SceneWidget.h"
 
 #include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 #include "Open3D/GUI/Application.h"
@@ -48,6 +50,14 @@ static const double NEAR_PLANE = 0.1;
 static const double MIN_FAR_PLANE = 1.0;
 
 static const double DELAY_FOR_BEST_RENDERING_SECS = 0.2;  // seconds
+// Longer intervals between two draws are pauses of the interaction rather
+// than frame times, and are not used to adapt the resolution.
+static const double MAX_FRAME_SECS = 0.5;
+// Weight of the newest frame time in its running average.
+static const double FRAME_SECS_SMOOTHING = 0.25;
+// Largest relative change of the resolution scale per frame.
+static const float MAX_SCALE_DECREASE = 0.85f;
+static const float MAX_SCALE_INCREASE = 1.05f;
 // ----------------------------------------------------------------------------
 class MouseInteractor {
 public:
@@ -605,7 +615,43 @@ struct SceneWidget::Impl {
     double last_fast_time_ = 0.0;
     bool frame_rect_changed_ = false;
 
+    // Resolution scale while rendering FAST. It is kept between interactions
+    // so that the next one starts with the last scale that met the target.
+    bool adaptive_resolution_ = true;
+    double target_frame_secs_ = 1.0 / 30.0;
+    float min_render_scale_ = 0.5f;
+    float render_scale_ = 1.0f;
+    double last_draw_time_ = 0.0;
+    double frame_secs_ = 0.0;
+    bool ssao_enabled_ = false;
+
     explicit Impl(visualization::Scene& scene) : scene_(scene) {}
+
+    // Measures the time since the previous draw and, while rendering FAST,
+    // scales the resolution towards the target frame time. The rendering
+    // cost is roughly proportional to the number of pixels, i.e. to the
+    // square of the scale.
+    void AdaptRenderScale(visualization::View* view, bool is_fast) {
+        double now = Application::GetInstance().Now();
+        double dt = now - last_draw_time_;
+        last_draw_time_ = now;
+        if (!is_fast || !adaptive_resolution_ || dt > MAX_FRAME_SECS) {
+            return;
+        }
+        frame_secs_ = frame_secs_ > 0.0
+                              ? (1.0 - FRAME_SECS_SMOOTHING) * frame_secs_ +
+                                        FRAME_SECS_SMOOTHING * dt
+                              : dt;
+        float factor = float(std::sqrt(target_frame_secs_ / frame_secs_));
+        factor = std::min(std::max(factor, MAX_SCALE_DECREASE),
+                          MAX_SCALE_INCREASE);
+        float scale = std::min(
+                std::max(render_scale_ * factor, min_render_scale_), 1.0f);
+        if (scale != render_scale_) {
+            render_scale_ = scale;
+            view->SetRenderScale(scale);
+        }
+    }
 };
 
 SceneWidget::SceneWidget(visualization::Scene& scene) : impl_(new Impl(scene)) {
@@ -739,10 +785,19 @@ void SceneWidget::SetRenderQuality(Quality quality) {
         bool is_fast = false;
         auto view = impl_->scene_.GetView(impl_->view_id_);
         if (quality == Quality::FAST) {
+            // Reduce the effects and the resolution while the camera moves.
             view->SetSampleCount(1);
+            impl_->ssao_enabled_ = view->IsSSAOEnabled();
+            view->SetSSAOEnabled(false);
+            if (impl_->adaptive_resolution_) {
+                view->SetRenderScale(impl_->render_scale_);
+            }
+            impl_->frame_secs_ = 0.0;
             is_fast = true;
         } else {
             view->SetSampleCount(4);
+            view->SetSSAOEnabled(impl_->ssao_enabled_);
+            view->SetRenderScale(1.0f);
             is_fast = false;
         }
         if (!impl_->model_.fast_point_clouds.empty()) {
@@ -756,6 +811,18 @@ void SceneWidget::SetRenderQuality(Quality quality) {
     }
 }
 
+void SceneWidget::SetAdaptiveResolution(bool enable,
+                                        double target_frame_secs /*= 1/30*/,
+                                        float min_scale /*= 0.5f*/) {
+    impl_->adaptive_resolution_ = enable;
+    impl_->target_frame_secs_ = std::max(target_frame_secs, 1e-3);
+    impl_->min_render_scale_ = std::min(std::max(min_scale, 0.1f), 1.0f);
+    impl_->render_scale_ = 1.0f;
+    if (GetRenderQuality() == Quality::FAST) {
+        GetView()->SetRenderScale(enable ? impl_->render_scale_ : 1.0f);
+    }
+}
+
 SceneWidget::Quality SceneWidget::GetRenderQuality() const {
     int n = impl_->scene_.GetView(impl_->view_id_)->GetSampleCount();
     if (n == 1) {
@@ -833,6 +900,8 @@ Widget::DrawResult SceneWidget::Draw(const DrawContext& context) {
                                    camera->GetFieldOfViewType());
     }
 
+    impl_->AdaptRenderScale(GetView(), GetRenderQuality() == Quality::FAST);
+
     // The actual drawing is done later, at the end of drawing in
     // Window::OnDraw(), in FilamentRenderer::Draw(). We can always
     // return NONE because any changes this frame will automatically
@@ -92,6 +92,15 @@ public:
     void SetRenderQuality(Quality level);
     Quality GetRenderQuality() const;
 
+    /// Enables rendering at a lower resolution while the camera moves. The
+    /// resolution scale is adapted to the measured frame time so that frames
+    /// take about target_frame_secs, but it does not go below min_scale.
+    /// Full resolution is restored once the camera stops. Enabled by default
+    /// with a target of 30 frames per second.
+    void SetAdaptiveResolution(bool enable,
+                               double target_frame_secs = 1.0 / 30.0,
+                               float min_scale = 0.5f);
+
     enum class CameraPreset {
         PLUS_X,  // at (X, 0, 0), looking (-1, 0, 0)
         PLUS_Y,  // at (0, Y, 0), looking (0, -1, 0)
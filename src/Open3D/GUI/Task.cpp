@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+
 #include "Open3D/GUI/Task.h"
 
-#include <atomic>
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "Open3D/Utility/Console.h"
 
@@ -35,58 +40,160 @@ namespace open3d {
 namespace gui {
 
 namespace {
-enum class ThreadState { NOT_STARTED, RUNNING, FINISHED };
-}
+const int MAX_DEFAULT_WORKERS = 4;
+
+struct QueuedTask {
+    TaskQueue::TaskFunction func;
+    CancellationToken token;
+    std::string group;
+};
+
+// Sorts by descending priority, then by ascending submission order
+using QueueKey = std::pair<int, uint64_t>;
+}  // namespace
+
+struct TaskQueue::Impl {
+    std::vector<std::thread> workers_;
+    // The task each worker is running, if any (empty func otherwise)
+    std::vector<QueuedTask> running_;
 
-struct Task::Impl {
-    std::function<void()> func_;
-    std::thread thread_;
-    ThreadState state_;
-    std::atomic<bool> is_finished_running_;
+    mutable std::mutex lock_;
+    std::condition_variable work_available_;
+    std::condition_variable idle_;
+    std::map<QueueKey, QueuedTask> queue_;
+    uint64_t next_id_ = 0;
+    int n_busy_ = 0;
+    bool should_quit_ = false;
+
+    void WorkerMain(size_t worker_idx) {
+        for (;;) {
+            QueuedTask task;
+            {
+                std::unique_lock<std::mutex> lock(lock_);
+                work_available_.wait(lock, [this]() {
+                    return should_quit_ || !queue_.empty();
+                });
+                if (queue_.empty()) {
+                    return;  // should_quit_
+                }
+                task = std::move(queue_.begin()->second);
+                queue_.erase(queue_.begin());
+                running_[worker_idx] = {nullptr, task.token, task.group};
+                n_busy_++;
+            }
+
+            if (!task.token.IsCancelled()) {
+                try {
+                    task.func(task.token);
+                } catch (const std::exception& e) {
+                    utility::LogWarning("Task threw an exception: {}",
+                                        e.what());
+                } catch (...) {
+                    utility::LogWarning("Task threw an unknown exception");
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(lock_);
+                running_[worker_idx] = QueuedTask();
+                n_busy_--;
+                if (n_busy_ == 0 && queue_.empty()) {
+                    idle_.notify_all();
+                }
+            }
+        }
+    }
+
+    // Requires lock_
+    void CancelMatching(const std::function<bool(const QueuedTask&)>& match) {
+        for (auto it = queue_.begin(); it != queue_.end();) {
+            if (match(it->second)) {
+                it->second.token.Cancel();
+                it = queue_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto& task : running_) {
+            if (match(task)) {
+                task.token.Cancel();
+            }
+        }
+        if (n_busy_ == 0 && queue_.empty()) {
+            idle_.notify_all();
+        }
+    }
 };
 
-Task::Task(std::function<void()> f) : impl_(new Task::Impl) {
-    impl_->func_ = f;
-    impl_->state_ = ThreadState::NOT_STARTED;
-    impl_->is_finished_running_ = false;
+TaskQueue::TaskQueue(int n_workers /*= 0*/) : impl_(new TaskQueue::Impl) {
+    if (n_workers <= 0) {
+        n_workers = int(std::thread::hardware_concurrency()) - 1;
+        n_workers = std::max(1, std::min(n_workers, MAX_DEFAULT_WORKERS));
+    }
+    impl_->running_.resize(n_workers);
+    impl_->workers_.reserve(n_workers);
+    for (int i = 0; i < n_workers; ++i) {
+        impl_->workers_.emplace_back(
+                [this, i]() { impl_->WorkerMain(size_t(i)); });
+    }
 }
 
-Task::~Task() {
-    // TODO: if able to cancel, do so here
-    WaitToFinish();
+TaskQueue::~TaskQueue() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->lock_);
+        impl_->CancelMatching([](const QueuedTask&) { return true; });
+        impl_->should_quit_ = true;
+    }
+    impl_->work_available_.notify_all();
+    for (auto& worker : impl_->workers_) {
+        worker.join();
+    }
 }
 
-void Task::Run() {
-    if (impl_->state_ != ThreadState::NOT_STARTED) {
-        utility::LogWarning("Attempting to Run() already-started Task");
+CancellationToken TaskQueue::Enqueue(TaskFunction f,
+                                     TaskPriority priority /*= NORMAL*/,
+                                     const std::string& group /*= ""*/) {
+    CancellationToken token;
+    {
+        std::lock_guard<std::mutex> lock(impl_->lock_);
+        if (!group.empty()) {
+            impl_->CancelMatching([&group](const QueuedTask& task) {
+                return task.group == group;
+            });
+        }
+        QueueKey key(-int(priority), impl_->next_id_++);
+        impl_->queue_[key] = {f, token, group};
+    }
+    impl_->work_available_.notify_one();
+    return token;
+}
+
+void TaskQueue::CancelGroup(const std::string& group) {
+    if (group.empty()) {
         return;
     }
+    std::lock_guard<std::mutex> lock(impl_->lock_);
+    impl_->CancelMatching(
+            [&group](const QueuedTask& task) { return task.group == group; });
+}
 
-    auto thread_main = [this]() {
-        impl_->func_();
-        impl_->is_finished_running_ = true;
-    };
-    impl_->thread_ = std::thread(thread_main);  // starts thread
-    impl_->state_ = ThreadState::RUNNING;
+void TaskQueue::CancelAll() {
+    std::lock_guard<std::mutex> lock(impl_->lock_);
+    impl_->CancelMatching([](const QueuedTask&) { return true; });
 }
 
-bool Task::IsFinished() const {
-    switch (impl_->state_) {
-        case ThreadState::NOT_STARTED:
-            return true;
-        case ThreadState::RUNNING:
-            return impl_->is_finished_running_;
-        case ThreadState::FINISHED:
-            return true;
-    }
-    utility::LogError("Unexpected thread state");
+void TaskQueue::WaitForAll() {
+    std::unique_lock<std::mutex> lock(impl_->lock_);
+    impl_->idle_.wait(lock, [this]() {
+        return impl_->n_busy_ == 0 && impl_->queue_.empty();
+    });
 }
 
-void Task::WaitToFinish() {
-    if (impl_->state_ == ThreadState::RUNNING) {
-        impl_->thread_.join();
-        impl_->state_ = ThreadState::FINISHED;
-    }
+int TaskQueue::GetNumWorkers() const { return int(impl_->workers_.size()); }
+
+size_t TaskQueue::GetNumQueued() const {
+    std::lock_guard<std::mutex> lock(impl_->lock_);
+    return impl_->queue_.size();
 }
 
 }  // namespace gui
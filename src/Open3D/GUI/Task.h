@@ -24,33 +24,71 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace open3d {
 namespace gui {
 
-class Task {
+/// Tells a queued or running task that its result is no longer wanted,
+/// either because a newer task of the same group superseded it or because the
+/// application is quitting. Copies share the same flag. Long running tasks
+/// should poll IsCancelled() and return early.
+class CancellationToken {
+public:
+    CancellationToken()
+        : is_cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void Cancel() { *is_cancelled_ = true; }
+    bool IsCancelled() const { return *is_cancelled_; }
+
+private:
+    std::shared_ptr<std::atomic<bool>> is_cancelled_;
+};
+
+enum class TaskPriority { LOW = 0, NORMAL = 1, HIGH = 2 };
+
+/// Runs tasks on a fixed number of worker threads. Queued tasks run highest
+/// priority first, and in the order they were queued within a priority.
+class TaskQueue {
 public:
-    /// Runs \param f in another thread. \p f may want to call
-    /// Application::PostToMainThread() to communicate the results.
-    Task(std::function<void()> f);
+    using TaskFunction = std::function<void(const CancellationToken&)>;
+
+    /// Starts \p n_workers threads; 0 uses one less than the number of
+    /// hardware threads (so that the UI stays responsive), but at most
+    /// four, since tasks usually parallelize internally.
+    explicit TaskQueue(int n_workers = 0);
+
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue& operator=(const TaskQueue& other) = delete;
 
-    Task(const Task&) = delete;
-    Task& operator=(const Task& other) = delete;
+    /// Cancels all tasks and waits for the running ones to return.
+    ~TaskQueue();
 
-    /// Will call WaitToFinish(), which may block.
-    ~Task();
+    /// Queues \p f, which is passed the returned token. If \p group is not
+    /// empty, the tasks queued earlier with the same group are cancelled:
+    /// those still waiting are dropped, those running see their token
+    /// cancelled.
+    CancellationToken Enqueue(TaskFunction f,
+                              TaskPriority priority = TaskPriority::NORMAL,
+                              const std::string& group = "");
 
-    void Run();
+    /// Cancels all queued and running tasks of \p group.
+    void CancelGroup(const std::string& group);
+    /// Cancels all queued and running tasks.
+    void CancelAll();
 
-    bool IsFinished() const;
+    /// Blocks until no task is queued or running.
+    void WaitForAll();
 
-    /// This must be called for all tasks eventually or the process will not
-    /// exit.
-    void WaitToFinish();
+    int GetNumWorkers() const;
+    /// Returns the number of tasks waiting for a worker.
+    size_t GetNumQueued() const;
 
 private:
     struct Impl;
@@ -63,6 +63,8 @@ static constexpr int CENTERED_X = -10000;
 static constexpr int CENTERED_Y = -10000;
 static constexpr int AUTOSIZE_WIDTH = 0;
 static constexpr int AUTOSIZE_HEIGHT = 0;
+// Longer than SceneWidget's delay for switching back to the best quality
+static constexpr double TICKS_AFTER_DRAW_SEC = 1.0;
 
 // Assumes the correct ImGuiContext is current
 void UpdateImGuiForScaling(float new_scaling) {
@@ -144,6 +146,7 @@ struct Window::Impl {
     // the time we monitor key up/down events.
     int mouse_mods_ = 0;  // ORed KeyModifiers
     double last_render_time_ = 0.0;
+    bool is_continuous_redraw_ = false;
 
     Theme theme_;  // so that the font size can be different based on scaling
     std::unique_ptr<visualization::FilamentRenderer> renderer_;
@@ -487,6 +490,17 @@ void Window::SetNeedsLayout() { impl_->needs_layout_ = true; }
 
 void Window::PostRedraw() { PostNativeExposeEvent(impl_->window_); }
 
+void Window::SetContinuousRedraw(bool continuous) {
+    impl_->is_continuous_redraw_ = continuous;
+    if (continuous) {
+        PostRedraw();
+    }
+}
+
+bool Window::IsContinuousRedraw() const {
+    return impl_->is_continuous_redraw_;
+}
+
 void Window::RaiseToTop() const { glfwFocusWindow(impl_->window_); }
 
 bool Window::IsActiveWindow() const {
@@ -764,7 +778,10 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     // draw, and if we are drawing for layout purposes, don't actually
     // draw, because we are just going to draw again after this returns.
     if (!is_layout_pass) {
-        impl_->renderer_->BeginFrame();
+        if (!impl_->renderer_->BeginFrame()) {
+            // The renderer dropped this frame, so draw it again
+            needs_redraw = true;
+        }
         impl_->renderer_->Draw();
         impl_->renderer_->EndFrame();
     }
@@ -1029,6 +1046,11 @@ bool Window::OnTickEvent(const TickEvent& e) {
     return redraw;
 }
 
+bool Window::NeedsTicks(double now) const {
+    return impl_->is_continuous_redraw_ ||
+           now - impl_->last_render_time_ < TICKS_AFTER_DRAW_SEC;
+}
+
 void Window::OnDragDropped(const char* path) {}
 
 // ----------------------------------------------------------------------------
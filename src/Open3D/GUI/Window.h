@@ -118,6 +118,11 @@ public:
     /// Sends a draw event to the window through the operating system's
     /// event queue.
     void PostRedraw();
+    /// The window is only redrawn when something changed, e.g. after input
+    /// or PostRedraw(). While \p continuous is true it is redrawn on every
+    /// tick instead, e.g. for an animation.
+    void SetContinuousRedraw(bool continuous);
+    bool IsContinuousRedraw() const;
 
     void SetTopmost(bool topmost);
     void RaiseToTop() const;
@@ -165,6 +170,11 @@ private:
     void OnKeyEvent(const KeyEvent& e);
     void OnTextInput(const TextInputEvent& e);
     bool OnTickEvent(const TickEvent& e);
+    /// Returns true if the window needs tick events at \p now: in continuous
+    /// redraw mode, or shortly after it was drawn, since widgets may need a
+    /// few ticks to finish what the last input started (e.g. a camera
+    /// motion or switching back to the best render quality).
+    bool NeedsTicks(double now) const;
     void* MakeDrawContextCurrent() const;
     void RestoreDrawContext(void* old_context) const;
     void* GetNativeDrawable() const;
@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AlphaComplex.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/TetraMesh.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int64_t kAlphaComplexGrainSize = 16384;
+
+/// Circumradius of the tetrahedron \p tetra, see Edelsbrunner and Muecke,
+/// "Three-Dimensional Alpha Shapes", 1994. \p vsqn holds the squared norms of
+/// the vertices.
+double ComputeCircumradius(const std::vector<Eigen::Vector3d> &verts,
+                           const std::vector<double> &vsqn,
+                           const Eigen::Vector4i &tetra) {
+    // clang-format off
+    Eigen::Matrix4d tmp;
+    tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
+            verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2), 1,
+            verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2), 1,
+            verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2), 1;
+    double a = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
+    double c = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](1), verts[tetra(0)](2), 1,
+            vsqn[tetra(1)], verts[tetra(1)](1), verts[tetra(1)](2), 1,
+            vsqn[tetra(2)], verts[tetra(2)](1), verts[tetra(2)](2), 1,
+            vsqn[tetra(3)], verts[tetra(3)](1), verts[tetra(3)](2), 1;
+    double dx = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](2), 1,
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](2), 1,
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](2), 1,
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](2), 1;
+    double dy = tmp.determinant();
+    tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), 1,
+            vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), 1,
+            vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), 1,
+            vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), 1;
+    double dz = tmp.determinant();
+    // clang-format on
+    if (a == 0) {
+        utility::LogError(
+                "[CreateFromPointCloudAlphaShape] invalid tetra in "
+                "TetraMesh");
+    }
+    return std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+           (2 * std::abs(a));
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<AlphaComplex> AlphaComplex::CreateFromPointCloud(
+        const PointCloud &pcd,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        const std::vector<size_t> *pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+
+    auto complex = std::make_shared<AlphaComplex>();
+    complex->vertices_ = tetra_mesh->vertices_;
+    const size_t num_mapped =
+            pt_map != nullptr ? pt_map->size() : complex->vertices_.size();
+    auto map_point = [&](size_t idx) {
+        return pt_map != nullptr ? (*pt_map)[idx] : idx;
+    };
+    if (pcd.HasNormals()) {
+        complex->vertex_normals_.resize(complex->vertices_.size());
+        for (size_t idx = 0; idx < num_mapped; ++idx) {
+            complex->vertex_normals_[idx] = pcd.normals_[map_point(idx)];
+        }
+    }
+    if (pcd.HasColors()) {
+        complex->vertex_colors_.resize(complex->vertices_.size());
+        for (size_t idx = 0; idx < num_mapped; ++idx) {
+            complex->vertex_colors_[idx] = pcd.colors_[map_point(idx)];
+        }
+    }
+
+    const auto &verts = tetra_mesh->vertices_;
+    const auto &tetras = tetra_mesh->tetras_;
+    const int64_t num_tetras = int64_t(tetras.size());
+    std::vector<double> vsqn(verts.size());
+    utility::ParallelFor(
+            0, int64_t(verts.size()),
+            [&](int64_t vidx) { vsqn[vidx] = verts[vidx].squaredNorm(); },
+            kAlphaComplexGrainSize);
+    complex->tetra_radii_.resize(num_tetras);
+    utility::ParallelFor(
+            0, num_tetras,
+            [&](int64_t tidx) {
+                complex->tetra_radii_[tidx] =
+                        ComputeCircumradius(verts, vsqn, tetras[tidx]);
+            },
+            kAlphaComplexGrainSize / 16);
+
+    // Face s = 4 * t + k is face k of tetra t, with sorted vertices.
+    const int64_t num_faces = 4 * num_tetras;
+    std::vector<Eigen::Vector3i> faces(num_faces);
+    utility::ParallelFor(
+            0, num_tetras,
+            [&](int64_t tidx) {
+                const Eigen::Vector4i &tetra = tetras[tidx];
+                faces[4 * tidx] = TriangleMesh::GetOrderedTriangle(
+                        tetra(0), tetra(1), tetra(2));
+                faces[4 * tidx + 1] = TriangleMesh::GetOrderedTriangle(
+                        tetra(0), tetra(1), tetra(3));
+                faces[4 * tidx + 2] = TriangleMesh::GetOrderedTriangle(
+                        tetra(0), tetra(2), tetra(3));
+                faces[4 * tidx + 3] = TriangleMesh::GetOrderedTriangle(
+                        tetra(1), tetra(2), tetra(3));
+            },
+            kAlphaComplexGrainSize);
+
+    // Sort the faces by their vertices, the last one first, so that the faces
+    // shared by several tetras are adjacent.
+    std::vector<int64_t> order(num_faces);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint32_t> keys(num_faces);
+    for (int c = 2; c >= 0; --c) {
+        utility::ParallelFor(
+                0, num_faces,
+                [&](int64_t i) { keys[i] = uint32_t(faces[order[i]](c)); },
+                kAlphaComplexGrainSize);
+        utility::ParallelRadixSortPairs(keys, order, kAlphaComplexGrainSize);
+    }
+    std::vector<int64_t> group_begins;
+    for (int64_t i = 0; i < num_faces; ++i) {
+        if (i == 0 || faces[order[i]] != faces[order[i - 1]]) {
+            group_begins.push_back(i);
+        }
+    }
+    group_begins.push_back(num_faces);
+
+    // A face is on the alpha shape if its tetra is in the alpha complex, i.e.
+    // its circumradius is at most alpha, and the other tetras of the face are
+    // not. Tetras whose circumradius is NaN are never in the complex.
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    auto radius_of_face = [&](int64_t face) {
+        const double r = complex->tetra_radii_[face / 4];
+        return std::isnan(r) ? inf : r;
+    };
+    std::vector<Eigen::Vector2d> face_alphas(num_faces);
+    utility::ParallelFor(
+            0, int64_t(group_begins.size()) - 1,
+            [&](int64_t group) {
+                const int64_t begin = group_begins[group];
+                const int64_t end = group_begins[group + 1];
+                // Smallest and second smallest radius of the group.
+                double min_radius = inf;
+                double second_radius = inf;
+                int64_t min_face = -1;
+                for (int64_t i = begin; i < end; ++i) {
+                    const double r = radius_of_face(order[i]);
+                    if (min_face == -1 || r < min_radius) {
+                        second_radius = min_radius;
+                        min_radius = r;
+                        min_face = order[i];
+                    } else if (r < second_radius) {
+                        second_radius = r;
+                    }
+                }
+                for (int64_t i = begin; i < end; ++i) {
+                    const int64_t face = order[i];
+                    face_alphas[face] = Eigen::Vector2d(
+                            complex->tetra_radii_[face / 4],
+                            face == min_face ? second_radius : min_radius);
+                }
+            },
+            kAlphaComplexGrainSize / 4);
+
+    // Keep the faces that are on the alpha shape of some alpha, in order.
+    for (int64_t face = 0; face < num_faces; ++face) {
+        if (face_alphas[face](0) < face_alphas[face](1)) {
+            complex->triangles_.push_back(faces[face]);
+            complex->triangle_alphas_.push_back(face_alphas[face]);
+        }
+    }
+    return complex;
+}
+
+std::shared_ptr<TriangleMesh> AlphaComplex::ExtractAlphaShape(
+        double alpha) const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
+        if (triangle_alphas_[tidx](0) <= alpha &&
+            alpha < triangle_alphas_[tidx](1)) {
+            mesh->triangles_.push_back(triangles_[tidx]);
+        }
+    }
+    mesh->RemoveUnreferencedVertices();
+    return mesh;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class TetraMesh;
+class TriangleMesh;
+
+/// \class AlphaComplex
+///
+/// \brief The faces of the Delaunay tetrahedralization of a point cloud,
+/// with the range of alpha values for which each face is on the alpha shape.
+///
+/// A tetrahedron is in the alpha complex if its circumradius is at most
+/// alpha, and the alpha shape is the boundary of these tetrahedra, i.e. the
+/// faces of a tetrahedron in the complex whose other tetrahedra are not in
+/// it. Face triangles_[i] is therefore on the alpha shape for alpha in
+/// [triangle_alphas_[i](0), triangle_alphas_[i](1)). The circumradii and
+/// the face adjacency are computed once, so extracting the alpha shape of
+/// any alpha is a single pass over the triangles, e.g. to sweep alpha.
+class AlphaComplex {
+public:
+    /// \brief Default Constructor.
+    AlphaComplex() {}
+    ~AlphaComplex() {}
+
+public:
+    /// Returns the number of tetrahedra.
+    size_t NumTetras() const { return tetra_radii_.size(); }
+    /// Returns the number of triangles that are on the alpha shape of some
+    /// alpha.
+    size_t NumTriangles() const { return triangles_.size(); }
+
+    /// \brief Returns the alpha shape, the same mesh as
+    /// TriangleMesh::CreateFromPointCloudAlphaShape.
+    ///
+    /// \param alpha Circumradius up to which tetrahedra are included.
+    std::shared_ptr<TriangleMesh> ExtractAlphaShape(double alpha) const;
+
+    /// \brief Factory function to build the alpha complex of a point cloud.
+    ///
+    /// \param pcd The input point cloud. Its normals and colors are copied to
+    /// the vertices.
+    /// \param tetra_mesh If not a nullptr, then uses this tetrahedralization.
+    /// Otherwise, Qhull::ComputeDelaunayTetrahedralization is called.
+    /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
+    /// points. The identity if it is a nullptr.
+    static std::shared_ptr<AlphaComplex> CreateFromPointCloud(
+            const PointCloud &pcd,
+            std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
+            const std::vector<size_t> *pt_map = nullptr);
+
+public:
+    /// Vertices of the tetrahedralization.
+    std::vector<Eigen::Vector3d> vertices_;
+    /// Vertex normals, copied from the point cloud if it has normals.
+    std::vector<Eigen::Vector3d> vertex_normals_;
+    /// Vertex colors, copied from the point cloud if it has colors.
+    std::vector<Eigen::Vector3d> vertex_colors_;
+    /// Circumradius of every tetrahedron.
+    std::vector<double> tetra_radii_;
+    /// Faces that are on the alpha shape of some alpha, with sorted vertex
+    /// indices, in the order they are output by ExtractAlphaShape.
+    std::vector<Eigen::Vector3i> triangles_;
+    /// Range [min, max) of the alpha values for which every triangle is on
+    /// the alpha shape. max is infinite on the convex hull.
+    std::vector<Eigen::Vector2d> triangle_alphas_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/MeshBase.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class AsRigidAsPossibleDeformer
+///
+/// \brief Deforms a triangle mesh with the method by Sorkine and Alexa,
+/// "As-Rigid-As-Possible Surface Modeling", 2007, for a fixed set of
+/// constrained vertices.
+///
+/// The cotangent weights, the neighborhoods and the Cholesky factorization of
+/// the system matrix of the free vertices only depend on the mesh and on
+/// which vertices are constrained, so they are computed once by the
+/// constructor. Each call of Deform then only fits the rotations in parallel
+/// and solves the three coordinates in parallel with the cached
+/// factorization, so the constraint positions can be changed interactively.
+class AsRigidAsPossibleDeformer {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The rest pose of the deformation.
+    /// \param constraint_vertex_indices Indices of the vertices whose
+    /// positions are given to Deform. If an index is repeated, the last of its
+    /// positions is used.
+    AsRigidAsPossibleDeformer(
+            const TriangleMesh &mesh,
+            const std::vector<int> &constraint_vertex_indices);
+    ~AsRigidAsPossibleDeformer();
+    AsRigidAsPossibleDeformer(const AsRigidAsPossibleDeformer &) = delete;
+    AsRigidAsPossibleDeformer &operator=(const AsRigidAsPossibleDeformer &) =
+            delete;
+
+public:
+    /// \brief Deforms the mesh in place of \p vertices.
+    ///
+    /// \param constraint_vertex_positions Positions of the constrained
+    /// vertices, in the order of the constraint indices of the constructor.
+    /// \param vertices Output vertex positions. If it has one position per
+    /// vertex, e.g. the result of the previous call, it is the initial guess
+    /// of the iterations, otherwise they start from the rest pose.
+    /// \param max_iter Maximum number of iterations to minimize the energy.
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    void Deform(const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+                std::vector<Eigen::Vector3d> &vertices,
+                size_t max_iter,
+                MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                        MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                double smoothed_alpha = 0.01) const;
+
+    /// \brief Returns a copy of the mesh deformed from the rest pose.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01) const;
+
+    /// Returns the number of constrained vertices.
+    size_t NumConstraints() const { return constraint_vertex_indices_.size(); }
+
+private:
+    class Solver;
+
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    double surface_area_ = 0;
+    /// The neighbors of vertex i are neighbors_[neighbor_offsets_[i]] to
+    /// neighbors_[neighbor_offsets_[i + 1] - 1], with the cotangent weights
+    /// in weights_.
+    std::vector<int64_t> neighbor_offsets_;
+    std::vector<int> neighbors_;
+    std::vector<double> weights_;
+    std::vector<int> constraint_vertex_indices_;
+    /// Last index of a vertex in constraint_vertex_indices_, or -1 for free
+    /// vertices.
+    std::vector<int> constraint_index_;
+    /// Row of a free vertex in the system matrix, or -1 for constrained ones.
+    std::vector<int> free_index_;
+    std::vector<int> free_vertices_;
+    std::unique_ptr<Solver> solver_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
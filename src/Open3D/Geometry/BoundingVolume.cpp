@@ -25,10 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/ConvexHull.h"
 #include "Open3D/Geometry/PointCloud.h"
-#include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 #include <numeric>
 
@@ -121,19 +122,18 @@ std::vector<Eigen::Vector3d> OrientedBoundingBox::GetBoxPoints() const {
 
 std::vector<size_t> OrientedBoundingBox::GetPointIndicesWithinBoundingBox(
         const std::vector<Eigen::Vector3d>& points) const {
-    std::vector<size_t> indices;
-    Eigen::Vector3d dx = R_ * Eigen::Vector3d(1, 0, 0);
-    Eigen::Vector3d dy = R_ * Eigen::Vector3d(0, 1, 0);
-    Eigen::Vector3d dz = R_ * Eigen::Vector3d(0, 0, 1);
-    for (size_t idx = 0; idx < points.size(); idx++) {
-        Eigen::Vector3d d = points[idx] - center_;
-        if (std::abs(d.dot(dx)) <= extent_(0) / 2 &&
-            std::abs(d.dot(dy)) <= extent_(1) / 2 &&
-            std::abs(d.dot(dz)) <= extent_(2) / 2) {
-            indices.push_back(idx);
-        }
-    }
-    return indices;
+    // Box coordinates are d^T R, compared against half the extent.
+    const Eigen::Matrix3d R = R_;
+    const Eigen::Vector3d center = center_;
+    const Eigen::Vector3d half_extent = extent_ / 2;
+    return utility::ParallelSelectIndices(
+            0, int64_t(points.size()), [&](int64_t idx) {
+                const Eigen::Vector3d d =
+                        R.transpose() * (points[idx] - center);
+                return (std::abs(d(0)) <= half_extent(0)) &
+                       (std::abs(d(1)) <= half_extent(1)) &
+                       (std::abs(d(2)) <= half_extent(2));
+            });
 }
 
 OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
@@ -148,7 +148,7 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
 OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
         const std::vector<Eigen::Vector3d>& points) {
     PointCloud hull_pcd;
-    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+    hull_pcd.points_ = std::get<0>(ConvexHull::ComputeConvexHull(points))->vertices_;
 
     Eigen::Vector3d mean;
     Eigen::Matrix3d cov;
@@ -315,15 +315,56 @@ std::vector<Eigen::Vector3d> AxisAlignedBoundingBox::GetBoxPoints() const {
 
 std::vector<size_t> AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBox(
         const std::vector<Eigen::Vector3d>& points) const {
-    std::vector<size_t> indices;
-    for (size_t idx = 0; idx < points.size(); idx++) {
-        const auto& point = points[idx];
-        if (point(0) >= min_bound_(0) && point(0) <= max_bound_(0) &&
-            point(1) >= min_bound_(1) && point(1) <= max_bound_(1) &&
-            point(2) >= min_bound_(2) && point(2) <= max_bound_(2)) {
-            indices.push_back(idx);
+    const Eigen::Vector3d min_bound = min_bound_;
+    const Eigen::Vector3d max_bound = max_bound_;
+    return utility::ParallelSelectIndices(
+            0, int64_t(points.size()), [&](int64_t idx) {
+                const Eigen::Vector3d& point = points[idx];
+                return (point(0) >= min_bound(0)) & (point(0) <= max_bound(0)) &
+                       (point(1) >= min_bound(1)) & (point(1) <= max_bound(1)) &
+                       (point(2) >= min_bound(2)) & (point(2) <= max_bound(2));
+            });
+}
+
+std::vector<std::vector<size_t>>
+AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBoxes(
+        const std::vector<AxisAlignedBoundingBox>& bboxes,
+        const std::vector<Eigen::Vector3d>& points) {
+    // Every chunk of points is tested against all boxes while it is in cache,
+    // and the per chunk indices are concatenated in chunk order.
+    const int64_t n = int64_t(points.size());
+    const int64_t num_chunks = utility::detail::GetNumChunks(0, n, 32768);
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<std::vector<std::vector<size_t>>> chunk_indices(
+            num_chunks, std::vector<std::vector<size_t>>(bboxes.size()));
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, n);
+        for (int64_t idx = begin; idx < end; idx++) {
+            const Eigen::Vector3d& point = points[idx];
+            for (size_t b = 0; b < bboxes.size(); b++) {
+                const Eigen::Vector3d& min_bound = bboxes[b].min_bound_;
+                const Eigen::Vector3d& max_bound = bboxes[b].max_bound_;
+                if ((point.array() >= min_bound.array()).all() &&
+                    (point.array() <= max_bound.array()).all()) {
+                    chunk_indices[chunk_idx][b].push_back(size_t(idx));
+                }
+            }
         }
-    }
+    });
+
+    std::vector<std::vector<size_t>> indices(bboxes.size());
+    utility::ParallelFor(0, int64_t(bboxes.size()), [&](int64_t b) {
+        size_t count = 0;
+        for (const auto& chunk : chunk_indices) {
+            count += chunk[b].size();
+        }
+        indices[b].reserve(count);
+        for (const auto& chunk : chunk_indices) {
+            indices[b].insert(indices[b].end(), chunk[b].begin(),
+                              chunk[b].end());
+        }
+    });
     return indices;
 }
 
@@ -248,6 +248,15 @@ public:
     std::vector<size_t> GetPointIndicesWithinBoundingBox(
             const std::vector<Eigen::Vector3d>& points) const;
 
+    /// Returns, for every box of \p bboxes, the indices of the points that are
+    /// within it. All boxes are tested in a single pass over \p points.
+    ///
+    /// \param bboxes A list of bounding boxes.
+    /// \param points A list of points.
+    static std::vector<std::vector<size_t>> GetPointIndicesWithinBoundingBoxes(
+            const std::vector<AxisAlignedBoundingBox>& bboxes,
+            const std::vector<Eigen::Vector3d>& points);
+
     /// Returns the 3D dimensions of the bounding box in string format.
     std::string GetPrintInfo() const;
 
@@ -0,0 +1,240 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGroups.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int64_t kCompactPointGrainSize = 32768;
+
+template <typename dst_t, typename src_t>
+void CastVectors(const std::vector<src_t> &src, std::vector<dst_t> &dst) {
+    typedef typename dst_t::Scalar scalar_t;
+    dst.resize(src.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(src.size()),
+            [&](int64_t i) { dst[i] = src[i].template cast<scalar_t>(); },
+            kCompactPointGrainSize);
+}
+
+/// Sums the normals of the points in voxel \p v, skipping NaN normals.
+Eigen::Vector3d SumNormals(const CompactPointCloud &cloud,
+                           const VoxelGroups &groups,
+                           int64_t v) {
+    Eigen::Vector3d normal_sum(0.0, 0.0, 0.0);
+    for (int64_t t = groups.voxel_offsets_[v]; t < groups.voxel_offsets_[v + 1];
+         t++) {
+        const Eigen::Vector3f &normal = cloud.normals_[groups.order_[t]];
+        if (!std::isnan(normal(0)) && !std::isnan(normal(1)) &&
+            !std::isnan(normal(2))) {
+            normal_sum += normal.cast<double>();
+        }
+    }
+    return normal_sum;
+}
+
+}  // unnamed namespace
+
+CompactPointCloud &CompactPointCloud::Clear() {
+    points_.clear();
+    normals_.clear();
+    colors_.clear();
+    return *this;
+}
+
+size_t CompactPointCloud::GetStorageBytes() const {
+    return (points_.capacity() + normals_.capacity() + colors_.capacity()) *
+           sizeof(Eigen::Vector3f);
+}
+
+Eigen::Vector3d CompactPointCloud::GetMinBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d::Zero();
+    }
+    return utility::ParallelReduce(
+                   0, static_cast<int64_t>(points_.size()), points_[0],
+                   [&](int64_t begin, int64_t end, Eigen::Vector3f bound) {
+                       for (int64_t i = begin; i < end; i++) {
+                           bound = bound.cwiseMin(points_[i]);
+                       }
+                       return bound;
+                   },
+                   [](const Eigen::Vector3f &lhs, const Eigen::Vector3f &rhs) {
+                       return Eigen::Vector3f(lhs.cwiseMin(rhs));
+                   },
+                   kCompactPointGrainSize)
+            .cast<double>();
+}
+
+Eigen::Vector3d CompactPointCloud::GetMaxBound() const {
+    if (points_.empty()) {
+        return Eigen::Vector3d::Zero();
+    }
+    return utility::ParallelReduce(
+                   0, static_cast<int64_t>(points_.size()), points_[0],
+                   [&](int64_t begin, int64_t end, Eigen::Vector3f bound) {
+                       for (int64_t i = begin; i < end; i++) {
+                           bound = bound.cwiseMax(points_[i]);
+                       }
+                       return bound;
+                   },
+                   [](const Eigen::Vector3f &lhs, const Eigen::Vector3f &rhs) {
+                       return Eigen::Vector3f(lhs.cwiseMax(rhs));
+                   },
+                   kCompactPointGrainSize)
+            .cast<double>();
+}
+
+CompactPointCloud &CompactPointCloud::Transform(
+        const Eigen::Matrix4d &transformation) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    const bool has_normals = HasNormals();
+    utility::ParallelFor(
+            0, static_cast<int64_t>(points_.size()),
+            [&](int64_t i) {
+                points_[i] = (rotation * points_[i].cast<double>() +
+                              translation)
+                                     .cast<float>();
+                if (has_normals) {
+                    normals_[i] = (rotation * normals_[i].cast<double>())
+                                          .cast<float>();
+                }
+            },
+            kCompactPointGrainSize);
+    return *this;
+}
+
+CompactPointCloud &CompactPointCloud::RemoveNonFinitePoints(
+        bool remove_nan, bool remove_infinite) {
+    bool has_normal = HasNormals();
+    bool has_color = HasColors();
+    size_t old_point_num = points_.size();
+    size_t k = 0;
+    for (size_t i = 0; i < old_point_num; i++) {
+        bool is_nan = remove_nan &&
+                      (std::isnan(points_[i](0)) || std::isnan(points_[i](1)) ||
+                       std::isnan(points_[i](2)));
+        bool is_infinite = remove_infinite && (std::isinf(points_[i](0)) ||
+                                               std::isinf(points_[i](1)) ||
+                                               std::isinf(points_[i](2)));
+        if (!is_nan && !is_infinite) {
+            points_[k] = points_[i];
+            if (has_normal) normals_[k] = normals_[i];
+            if (has_color) colors_[k] = colors_[i];
+            k++;
+        }
+    }
+    points_.resize(k);
+    if (has_normal) normals_.resize(k);
+    if (has_color) colors_.resize(k);
+    utility::LogDebug(
+            "[RemoveNonFinitePoints] {:d} nan points have been removed.",
+            (int)(old_point_num - k));
+    return *this;
+}
+
+std::shared_ptr<CompactPointCloud> CompactPointCloud::VoxelDownSample(
+        double voxel_size) const {
+    auto output = std::make_shared<CompactPointCloud>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
+    }
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSample] voxel_size is too small.");
+    }
+    const VoxelGroups groups =
+            GroupPointsByVoxel(points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t v) {
+                const double num_points = double(groups.NumPoints(v));
+                output->points_[v] = (SumAttribute(points_, groups, v) /
+                                      num_points)
+                                             .cast<float>();
+                if (has_normals) {
+                    output->normals_[v] = SumNormals(*this, groups, v)
+                                                  .normalized()
+                                                  .cast<float>();
+                }
+                if (has_colors) {
+                    output->colors_[v] = (SumAttribute(colors_, groups, v) /
+                                          num_points)
+                                                 .cast<float>();
+                }
+            },
+            kVoxelGrainSize);
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)output->points_.size());
+    return output;
+}
+
+std::shared_ptr<PointCloud> CompactPointCloud::ToPointCloud() const {
+    auto cloud = std::make_shared<PointCloud>();
+    CastVectors(points_, cloud->points_);
+    CastVectors(normals_, cloud->normals_);
+    CastVectors(colors_, cloud->colors_);
+    return cloud;
+}
+
+std::shared_ptr<CompactPointCloud> CompactPointCloud::CreateFromPointCloud(
+        const PointCloud &cloud) {
+    auto compact = std::make_shared<CompactPointCloud>();
+    CastVectors(cloud.points_, compact->points_);
+    CastVectors(cloud.normals_, compact->normals_);
+    CastVectors(cloud.colors_, compact->colors_);
+    return compact;
+}
+
+}  // namespace geometry
+}  // namespace open3d
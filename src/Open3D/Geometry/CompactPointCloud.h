@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class CompactPointCloud
+///
+/// \brief Point cloud with single precision storage, for keeping large scans
+/// resident.
+///
+/// PointCloud stores 72 bytes per point with normals and colors,
+/// CompactPointCloud 36. Sensor data rarely has more than float precision, so
+/// the clouds read by io::ReadCompactPointCloud are usually exact. The
+/// KDTree, normal estimation, voxel down sampling and
+/// registration::RegistrationICP work on the float points directly, and
+/// accumulate in double precision.
+class CompactPointCloud {
+public:
+    /// \brief Default Constructor.
+    CompactPointCloud() {}
+    ~CompactPointCloud() {}
+
+public:
+    /// Removes all points.
+    CompactPointCloud &Clear();
+    /// Returns true if the point cloud has no points.
+    bool IsEmpty() const { return !HasPoints(); }
+    /// Memory used by the points, normals and colors, in bytes.
+    size_t GetStorageBytes() const;
+
+    /// Returns 'true' if the point cloud contains points.
+    bool HasPoints() const { return points_.size() > 0; }
+    /// Returns `true` if the point cloud contains point normals.
+    bool HasNormals() const {
+        return points_.size() > 0 && normals_.size() == points_.size();
+    }
+    /// Returns `true` if the point cloud contains point colors.
+    bool HasColors() const {
+        return points_.size() > 0 && colors_.size() == points_.size();
+    }
+
+    /// Returns min bounds for geometry coordinates.
+    Eigen::Vector3d GetMinBound() const;
+    /// Returns max bounds for geometry coordinates.
+    Eigen::Vector3d GetMaxBound() const;
+    /// \brief Apply transformation (4x4 matrix) to the points and normals.
+    ///
+    /// The transformation is applied in double precision.
+    CompactPointCloud &Transform(const Eigen::Matrix4d &transformation);
+
+    /// \brief Remove all points from the point cloud that have a nan entry, or
+    /// infinite entries, as PointCloud::RemoveNonFinitePoints does.
+    ///
+    /// \param remove_nan Remove NaN values from the point cloud.
+    /// \param remove_infinite Remove infinite values from the point cloud.
+    CompactPointCloud &RemoveNonFinitePoints(bool remove_nan = true,
+                                             bool remove_infinite = true);
+
+    /// \brief Function to downsample the point cloud with a voxel, as
+    /// PointCloud::VoxelDownSample does.
+    ///
+    /// The averages are computed in double precision.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid, smaller
+    /// value leads to denser output point cloud.
+    std::shared_ptr<CompactPointCloud> VoxelDownSample(double voxel_size) const;
+
+    /// \brief Function to compute the normals of the point cloud, as
+    /// PointCloud::EstimateNormals does.
+    ///
+    /// The neighbors are searched in a KDTreeIndex built on the float points,
+    /// and the covariances are accumulated in double precision relative to
+    /// the query point.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    /// \param fast_normal_computation If true, the normal estiamtion uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix. This is faster, but is not as numerical stable.
+    void EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true);
+
+    /// Convert to a PointCloud.
+    std::shared_ptr<PointCloud> ToPointCloud() const;
+
+    /// Creates a compact point cloud from the points, normals and colors of a
+    /// PointCloud, rounded to single precision.
+    static std::shared_ptr<CompactPointCloud> CreateFromPointCloud(
+            const PointCloud &cloud);
+
+public:
+    /// Points coordinates.
+    std::vector<Eigen::Vector3f> points_;
+    /// Points normals.
+    std::vector<Eigen::Vector3f> normals_;
+    /// RGB colors of points.
+    std::vector<Eigen::Vector3f> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
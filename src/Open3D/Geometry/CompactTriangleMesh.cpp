@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactTriangleMesh.h"
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int64_t kCompactVertexGrainSize = 32768;
+
+template <typename dst_t, typename src_t>
+void CastVectors(const std::vector<src_t> &src, std::vector<dst_t> &dst) {
+    typedef typename dst_t::Scalar scalar_t;
+    dst.resize(src.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(src.size()),
+            [&](int64_t i) { dst[i] = src[i].template cast<scalar_t>(); },
+            kCompactVertexGrainSize);
+}
+
+}  // unnamed namespace
+
+CompactTriangleMesh &CompactTriangleMesh::Clear() {
+    vertices_.clear();
+    vertex_normals_.clear();
+    vertex_colors_.clear();
+    triangles_.clear();
+    return *this;
+}
+
+size_t CompactTriangleMesh::GetStorageBytes() const {
+    return (vertices_.capacity() + vertex_normals_.capacity() +
+            vertex_colors_.capacity()) *
+                   sizeof(Eigen::Vector3f) +
+           triangles_.capacity() * sizeof(Eigen::Vector3i);
+}
+
+CompactTriangleMesh &CompactTriangleMesh::Transform(
+        const Eigen::Matrix4d &transformation) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    const bool has_normals = HasVertexNormals();
+    utility::ParallelFor(
+            0, static_cast<int64_t>(vertices_.size()),
+            [&](int64_t i) {
+                vertices_[i] = (rotation * vertices_[i].cast<double>() +
+                                translation)
+                                       .cast<float>();
+                if (has_normals) {
+                    vertex_normals_[i] =
+                            (rotation * vertex_normals_[i].cast<double>())
+                                    .cast<float>();
+                }
+            },
+            kCompactVertexGrainSize);
+    return *this;
+}
+
+CompactTriangleMesh &CompactTriangleMesh::ComputeVertexNormals(
+        bool normalized /* = true*/) {
+    std::vector<Eigen::Vector3d> normals(vertices_.size(),
+                                         Eigen::Vector3d::Zero());
+    for (const Eigen::Vector3i &triangle : triangles_) {
+        const Eigen::Vector3d v0 = vertices_[triangle(0)].cast<double>();
+        const Eigen::Vector3d v1 = vertices_[triangle(1)].cast<double>();
+        const Eigen::Vector3d v2 = vertices_[triangle(2)].cast<double>();
+        const Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+        normals[triangle(0)] += normal;
+        normals[triangle(1)] += normal;
+        normals[triangle(2)] += normal;
+    }
+    vertex_normals_.resize(vertices_.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(vertices_.size()),
+            [&](int64_t i) {
+                if (normalized) {
+                    normals[i].normalize();
+                }
+                vertex_normals_[i] = normals[i].cast<float>();
+            },
+            kCompactVertexGrainSize);
+    return *this;
+}
+
+std::shared_ptr<CompactPointCloud> CompactTriangleMesh::ToCompactPointCloud()
+        const {
+    auto cloud = std::make_shared<CompactPointCloud>();
+    cloud->points_ = vertices_;
+    cloud->normals_ = vertex_normals_;
+    cloud->colors_ = vertex_colors_;
+    return cloud;
+}
+
+std::shared_ptr<TriangleMesh> CompactTriangleMesh::ToTriangleMesh() const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    CastVectors(vertices_, mesh->vertices_);
+    CastVectors(vertex_normals_, mesh->vertex_normals_);
+    CastVectors(vertex_colors_, mesh->vertex_colors_);
+    mesh->triangles_ = triangles_;
+    return mesh;
+}
+
+std::shared_ptr<CompactTriangleMesh>
+CompactTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
+    auto compact = std::make_shared<CompactTriangleMesh>();
+    CastVectors(mesh.vertices_, compact->vertices_);
+    CastVectors(mesh.vertex_normals_, compact->vertex_normals_);
+    CastVectors(mesh.vertex_colors_, compact->vertex_colors_);
+    compact->triangles_ = mesh.triangles_;
+    return compact;
+}
+
+}  // namespace geometry
+}  // namespace open3d
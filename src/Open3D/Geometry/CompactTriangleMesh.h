@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class CompactPointCloud;
+class TriangleMesh;
+
+/// \class CompactTriangleMesh
+///
+/// \brief Triangle mesh with single precision vertex attributes, for keeping
+/// large meshes resident.
+///
+/// The vertices, vertex normals and vertex colors take 36 bytes per vertex
+/// instead of the 72 of TriangleMesh. Triangles keep their 32-bit vertex
+/// indices.
+class CompactTriangleMesh {
+public:
+    /// \brief Default Constructor.
+    CompactTriangleMesh() {}
+    ~CompactTriangleMesh() {}
+
+public:
+    /// Removes all vertices and triangles.
+    CompactTriangleMesh &Clear();
+    /// Returns true if the mesh has no vertices.
+    bool IsEmpty() const { return !HasVertices(); }
+    /// Memory used by the vertex attributes and triangles, in bytes.
+    size_t GetStorageBytes() const;
+
+    /// Returns `True` if the mesh contains vertices.
+    bool HasVertices() const { return vertices_.size() > 0; }
+    /// Returns `true` if the mesh contains triangles.
+    bool HasTriangles() const {
+        return vertices_.size() > 0 && triangles_.size() > 0;
+    }
+    /// Returns `True` if the mesh contains vertex normals.
+    bool HasVertexNormals() const {
+        return vertices_.size() > 0 &&
+               vertex_normals_.size() == vertices_.size();
+    }
+    /// Returns `True` if the mesh contains vertex colors.
+    bool HasVertexColors() const {
+        return vertices_.size() > 0 &&
+               vertex_colors_.size() == vertices_.size();
+    }
+
+    /// \brief Apply transformation (4x4 matrix) to the vertices and vertex
+    /// normals.
+    ///
+    /// The transformation is applied in double precision.
+    CompactTriangleMesh &Transform(const Eigen::Matrix4d &transformation);
+
+    /// \brief Computes the vertex normals as the sum of the area weighted
+    /// normals of the adjacent triangles, as TriangleMesh::ComputeVertexNormals
+    /// does. The sums are accumulated in double precision.
+    ///
+    /// \param normalized If true, the normals are normalized to unit length.
+    CompactTriangleMesh &ComputeVertexNormals(bool normalized = true);
+
+    /// Returns the vertices, vertex normals and vertex colors as a compact
+    /// point cloud.
+    std::shared_ptr<CompactPointCloud> ToCompactPointCloud() const;
+
+    /// Convert to a TriangleMesh.
+    std::shared_ptr<TriangleMesh> ToTriangleMesh() const;
+
+    /// Creates a compact mesh from the vertices, vertex normals, vertex colors
+    /// and triangles of a TriangleMesh, rounded to single precision. Other
+    /// attributes are dropped.
+    static std::shared_ptr<CompactTriangleMesh> CreateFromTriangleMesh(
+            const TriangleMesh &mesh);
+
+public:
+    /// Vertex coordinates.
+    std::vector<Eigen::Vector3f> vertices_;
+    /// Vertex normals.
+    std::vector<Eigen::Vector3f> vertex_normals_;
+    /// RGB colors of vertices.
+    std::vector<Eigen::Vector3f> vertex_colors_;
+    /// List of triangles denoted by the index of points forming the triangle.
+    std::vector<Eigen::Vector3i> triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
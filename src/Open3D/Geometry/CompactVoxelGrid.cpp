@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactVoxelGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Geometry/VoxelProjection.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int64_t kCompactVoxelGrainSize = 4096;
+
+Eigen::Vector3uint8 QuantizeColor(const Eigen::Vector3d &color) {
+    return (color.array() * 255.0)
+            .round()
+            .max(0.0)
+            .min(255.0)
+            .cast<uint8_t>()
+            .matrix();
+}
+
+Eigen::Vector3d DequantizeColor(const Eigen::Vector3uint8 &color) {
+    return color.cast<double>() / 255.0;
+}
+
+}  // unnamed namespace
+
+size_t CompactVoxelGrid::NumVoxels() const {
+    return backend_ == Backend::Dense ? dense_voxels_.Size()
+                                      : hashed_voxels_.Size();
+}
+
+size_t CompactVoxelGrid::GetStorageBytes() const {
+    return hashed_voxels_.GetStorageBytes() + dense_voxels_.GetStorageBytes();
+}
+
+Eigen::Vector3i CompactVoxelGrid::GetVoxel(const Eigen::Vector3d &point) const {
+    Eigen::Vector3d voxel_f = (point - origin_) / voxel_size_;
+    return (Eigen::floor(voxel_f.array())).cast<int>();
+}
+
+Eigen::Vector3d CompactVoxelGrid::GetVoxelCenterCoordinate(
+        const Eigen::Vector3i &index) const {
+    return ((index.cast<double>() + Eigen::Vector3d(0.5, 0.5, 0.5)) *
+            voxel_size_) +
+           origin_;
+}
+
+bool CompactVoxelGrid::HasVoxel(const Eigen::Vector3i &index) const {
+    return backend_ == Backend::Dense ? dense_voxels_.Contains(index)
+                                      : hashed_voxels_.Contains(index);
+}
+
+bool CompactVoxelGrid::GetVoxelColor(const Eigen::Vector3i &index,
+                                     Eigen::Vector3d &color) const {
+    Eigen::Vector3uint8 color8;
+    bool found = backend_ == Backend::Dense
+                         ? dense_voxels_.GetColor(index, color8)
+                         : hashed_voxels_.GetColor(index, color8);
+    if (found) {
+        color = DequantizeColor(color8);
+    }
+    return found;
+}
+
+void CompactVoxelGrid::AddVoxel(const Eigen::Vector3i &index,
+                                const Eigen::Vector3d &color) {
+    if (backend_ == Backend::Dense) {
+        dense_voxels_.Insert(index, QuantizeColor(color));
+    } else {
+        hashed_voxels_.Insert(index, QuantizeColor(color));
+    }
+}
+
+bool CompactVoxelGrid::RemoveVoxel(const Eigen::Vector3i &index) {
+    return backend_ == Backend::Dense ? dense_voxels_.Erase(index)
+                                      : hashed_voxels_.Erase(index);
+}
+
+std::vector<bool> CompactVoxelGrid::CheckIfIncluded(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    // std::vector<bool> packs bits, so it cannot be written in parallel.
+    std::vector<uint8_t> included(queries.size());
+    utility::ParallelFor(
+            0, int64_t(queries.size()),
+            [&](int64_t i) { included[i] = HasVoxel(GetVoxel(queries[i])); },
+            kCompactVoxelGrainSize);
+    return std::vector<bool>(included.begin(), included.end());
+}
+
+template <typename func_t>
+void CompactVoxelGrid::RemoveVoxelsIf(func_t carve) {
+    if (backend_ == Backend::Dense) {
+        // Each word of occupancy bits is updated by a single iteration.
+        std::vector<uint64_t> words(dense_voxels_.NumWords());
+        utility::ParallelFor(0, int64_t(words.size()), [&](int64_t word) {
+            uint64_t kept = dense_voxels_.GetWord(word);
+            for (uint64_t bits = kept; bits != 0; bits &= bits - 1) {
+                int bit = DenseVoxelStorage::LowestBit(bits);
+                if (carve(dense_voxels_.GetLinearIndexVoxel(word * 64 + bit))) {
+                    kept &= ~(uint64_t(1) << bit);
+                }
+            }
+            words[word] = kept;
+        });
+        for (size_t word = 0; word < words.size(); ++word) {
+            dense_voxels_.SetWord(word, words[word]);
+        }
+    } else {
+        // Evaluate in parallel, then erase, as erasing moves entries.
+        std::vector<uint8_t> carved(hashed_voxels_.NumSlots(), 0);
+        utility::ParallelFor(
+                0, int64_t(carved.size()),
+                [&](int64_t slot) {
+                    carved[slot] = hashed_voxels_.IsSlotOccupied(slot) &&
+                                   carve(hashed_voxels_.GetSlotIndex(slot));
+                },
+                64);
+        std::vector<Eigen::Vector3i> removed;
+        for (size_t slot = 0; slot < carved.size(); ++slot) {
+            if (carved[slot]) {
+                removed.push_back(hashed_voxels_.GetSlotIndex(slot));
+            }
+        }
+        for (const Eigen::Vector3i &index : removed) {
+            hashed_voxels_.Erase(index);
+        }
+    }
+}
+
+CompactVoxelGrid &CompactVoxelGrid::CarveDepthMap(
+        const Image &depth_map,
+        const camera::PinholeCameraParameters &camera_parameter,
+        bool keep_voxels_outside_image) {
+    if (depth_map.height_ != camera_parameter.intrinsic_.height_ ||
+        depth_map.width_ != camera_parameter.intrinsic_.width_) {
+        utility::LogError(
+                "[CompactVoxelGrid] provided depth_map dimensions are not "
+                "compatible with the provided camera_parameters");
+    }
+    const VoxelProjection projection(voxel_size_, origin_, camera_parameter);
+    auto keep = [keep_voxels_outside_image](bool within_boundary, double z,
+                                            double d) {
+        return (!within_boundary && keep_voxels_outside_image) ||
+               (within_boundary && d > 0 && z >= d);
+    };
+    RemoveVoxelsIf([&](const Eigen::Vector3i &index) {
+        return projection.IsCarved(index, depth_map, keep);
+    });
+    return *this;
+}
+
+CompactVoxelGrid &CompactVoxelGrid::CarveSilhouette(
+        const Image &silhouette_mask,
+        const camera::PinholeCameraParameters &camera_parameter,
+        bool keep_voxels_outside_image) {
+    if (silhouette_mask.height_ != camera_parameter.intrinsic_.height_ ||
+        silhouette_mask.width_ != camera_parameter.intrinsic_.width_) {
+        utility::LogError(
+                "[CompactVoxelGrid] provided silhouette_mask dimensions are "
+                "not compatible with the provided camera_parameters");
+    }
+    const VoxelProjection projection(voxel_size_, origin_, camera_parameter);
+    auto keep = [keep_voxels_outside_image](bool within_boundary, double z,
+                                            double d) {
+        return (!within_boundary && keep_voxels_outside_image) ||
+               (within_boundary && d > 0);
+    };
+    RemoveVoxelsIf([&](const Eigen::Vector3i &index) {
+        return projection.IsCarved(index, silhouette_mask, keep);
+    });
+    return *this;
+}
+
+std::shared_ptr<VoxelGrid> CompactVoxelGrid::ToVoxelGrid() const {
+    auto output = std::make_shared<VoxelGrid>();
+    output->voxel_size_ = voxel_size_;
+    output->origin_ = origin_;
+    output->voxels_.reserve(NumVoxels());
+    ForEachVoxel([&output](const Eigen::Vector3i &index,
+                           const Eigen::Vector3uint8 &color) {
+        output->AddVoxel(Voxel(index, DequantizeColor(color)));
+    });
+    return output;
+}
+
+std::shared_ptr<CompactVoxelGrid> CompactVoxelGrid::CreateFromVoxelGrid(
+        const VoxelGrid &voxel_grid) {
+    auto output = std::make_shared<CompactVoxelGrid>();
+    output->voxel_size_ = voxel_grid.voxel_size_;
+    output->origin_ = voxel_grid.origin_;
+    output->hashed_voxels_.Reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        output->AddVoxel(it.second.grid_index_, it.second.color_);
+    }
+    return output;
+}
+
+std::shared_ptr<CompactVoxelGrid> CompactVoxelGrid::CreateDense(
+        const Eigen::Vector3d &origin,
+        double voxel_size,
+        double width,
+        double height,
+        double depth) {
+    auto output = std::make_shared<CompactVoxelGrid>();
+    int num_w = int(std::round(width / voxel_size));
+    int num_h = int(std::round(height / voxel_size));
+    int num_d = int(std::round(depth / voxel_size));
+    output->origin_ = origin;
+    output->voxel_size_ = voxel_size;
+    output->backend_ = Backend::Dense;
+    output->dense_voxels_ = DenseVoxelStorage(Eigen::Vector3i(0, 0, 0),
+                                              Eigen::Vector3i(num_w, num_h,
+                                                              num_d));
+    output->dense_voxels_.Fill();
+    return output;
+}
+
+std::shared_ptr<CompactVoxelGrid>
+CompactVoxelGrid::CreateFromPointCloudWithinBounds(
+        const PointCloud &input,
+        double voxel_size,
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound) {
+    auto output = std::make_shared<CompactVoxelGrid>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[CompactVoxelGridFromPointCloud] voxel_size <= 0.");
+    }
+    if (voxel_size * double(1 << 20) < (max_bound - min_bound).maxCoeff()) {
+        utility::LogError(
+                "[CompactVoxelGridFromPointCloud] voxel_size is too small.");
+    }
+    output->voxel_size_ = voxel_size;
+    output->origin_ = min_bound;
+
+    // Sort the points by voxel, so that the points of a voxel are contiguous
+    // and their colors can be averaged without a map of accumulators.
+    const int64_t num_points = int64_t(input.points_.size());
+    std::vector<uint64_t> keys(num_points);
+    std::vector<int64_t> order(num_points);
+    utility::ParallelFor(
+            0, num_points,
+            [&](int64_t i) {
+                Eigen::Vector3d ref_coord =
+                        (input.points_[i] - min_bound) / voxel_size;
+                Eigen::Vector3i voxel_index(int(floor(ref_coord(0))),
+                                            int(floor(ref_coord(1))),
+                                            int(floor(ref_coord(2))));
+                if (!HashedVoxelStorage::IsIndexValid(voxel_index)) {
+                    utility::LogError(
+                            "[CompactVoxelGridFromPointCloud] point {} is too "
+                            "far from the bounds.",
+                            i);
+                }
+                keys[i] = HashedVoxelStorage::PackKey(voxel_index);
+                order[i] = i;
+            },
+            kCompactVoxelGrainSize);
+    utility::ParallelRadixSortPairs(keys, order, kCompactVoxelGrainSize);
+
+    const bool has_colors = input.HasColors();
+    std::vector<int64_t> voxel_begins;
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (i == 0 || keys[i] != keys[i - 1]) {
+            voxel_begins.push_back(i);
+        }
+    }
+    const int64_t num_voxels = int64_t(voxel_begins.size());
+    voxel_begins.push_back(num_points);
+    std::vector<Eigen::Vector3uint8> colors(num_voxels,
+                                            Eigen::Vector3uint8(0, 0, 0));
+    if (has_colors) {
+        utility::ParallelFor(
+                0, num_voxels,
+                [&](int64_t v) {
+                    Eigen::Vector3d color(0, 0, 0);
+                    for (int64_t i = voxel_begins[v]; i < voxel_begins[v + 1];
+                         ++i) {
+                        color += input.colors_[order[i]];
+                    }
+                    colors[v] = QuantizeColor(
+                            color /
+                            double(voxel_begins[v + 1] - voxel_begins[v]));
+                },
+                kCompactVoxelGrainSize / 8);
+    }
+    output->hashed_voxels_.Reserve(size_t(num_voxels));
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        output->hashed_voxels_.Insert(
+                HashedVoxelStorage::UnpackKey(keys[voxel_begins[v]]),
+                colors[v]);
+    }
+    utility::LogDebug(
+            "Pointcloud is voxelized from {:d} points to {:d} voxels.",
+            (int)input.points_.size(), (int)output->NumVoxels());
+    return output;
+}
+
+std::shared_ptr<CompactVoxelGrid> CompactVoxelGrid::CreateFromPointCloud(
+        const PointCloud &input, double voxel_size) {
+    Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    return CreateFromPointCloudWithinBounds(input, voxel_size, min_bound,
+                                            max_bound);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,203 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/VoxelStorage.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+class Image;
+class PointCloud;
+class VoxelGrid;
+
+/// \class CompactVoxelGrid
+///
+/// \brief Voxel grid with compact storage, for keeping millions of voxels
+/// resident.
+///
+/// VoxelGrid keeps an std::unordered_map node with a Voxel of 36 bytes per
+/// voxel, around 80 bytes in total. CompactVoxelGrid stores 8-bit RGB colors
+/// either in a HashedVoxelStorage, 11 bytes per slot, or for bounded volumes
+/// such as carving grids in a DenseVoxelStorage, one bit per voxel of the box
+/// plus 3 bytes once colors are set.
+class CompactVoxelGrid {
+public:
+    /// Storage of the voxels.
+    enum class Backend {
+        /// Open addressing hash table on packed 64-bit keys.
+        Hashed = 0,
+        /// Occupancy bits of a bounded box.
+        Dense = 1,
+    };
+
+    /// \brief Default Constructor. Creates an empty grid with hashed storage.
+    CompactVoxelGrid() {}
+    ~CompactVoxelGrid() {}
+
+public:
+    /// Returns true if the grid has no voxels.
+    bool IsEmpty() const { return NumVoxels() == 0; }
+    /// Number of voxels.
+    size_t NumVoxels() const;
+    /// Memory used by the storage, in bytes.
+    size_t GetStorageBytes() const;
+
+    /// Returns voxel index given query point.
+    Eigen::Vector3i GetVoxel(const Eigen::Vector3d &point) const;
+    /// Returns the 3d coordinates of the center of a voxel.
+    Eigen::Vector3d GetVoxelCenterCoordinate(
+            const Eigen::Vector3i &index) const;
+    /// Returns true if the voxel exists.
+    bool HasVoxel(const Eigen::Vector3i &index) const;
+    /// Returns true and sets \p color if the voxel exists.
+    bool GetVoxelColor(const Eigen::Vector3i &index,
+                       Eigen::Vector3d &color) const;
+    /// \brief Add a voxel or overwrite its color.
+    ///
+    /// \param index Grid coordinate index of the voxel. With dense storage, it
+    /// must be within the box.
+    /// \param color Color of the voxel, stored with 8 bits per channel.
+    void AddVoxel(const Eigen::Vector3i &index,
+                  const Eigen::Vector3d &color = Eigen::Vector3d::Zero());
+    /// Removes a voxel. Returns true if it existed.
+    bool RemoveVoxel(const Eigen::Vector3i &index);
+
+    /// Element-wise check if a query in the list is included in the grid.
+    /// Queries are double precision and are mapped to the closest voxel.
+    std::vector<bool> CheckIfIncluded(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Remove all voxels where none of the boundary points of the voxel
+    /// projects to depth value that is smaller, or equal than the projected
+    /// depth of the boundary point, as VoxelGrid::CarveDepthMap does.
+    ///
+    /// \param depth_map Depth map (Image) used for carving.
+    /// \param camera_parameter Input Camera Parameters.
+    /// \param keep_voxels_outside_image Project all voxels to a valid location.
+    CompactVoxelGrid &CarveDepthMap(
+            const Image &depth_map,
+            const camera::PinholeCameraParameters &camera_parameter,
+            bool keep_voxels_outside_image);
+
+    /// Remove all voxels where none of the boundary points of the voxel
+    /// projects to a valid mask pixel (pixel value > 0), as
+    /// VoxelGrid::CarveSilhouette does.
+    ///
+    /// \param silhouette_mask Silhouette mask (Image) used for carving.
+    /// \param camera_parameter Input Camera Parameters.
+    /// \param keep_voxels_outside_image Project all voxels to a valid location.
+    CompactVoxelGrid &CarveSilhouette(
+            const Image &silhouette_mask,
+            const camera::PinholeCameraParameters &camera_parameter,
+            bool keep_voxels_outside_image);
+
+    /// Calls f(index, color) for every voxel. Colors are 8-bit RGB.
+    template <typename func_t>
+    void ForEachVoxel(func_t f) const {
+        if (backend_ == Backend::Dense) {
+            dense_voxels_.ForEach(f);
+        } else {
+            hashed_voxels_.ForEach(f);
+        }
+    }
+
+    /// Convert to a VoxelGrid.
+    std::shared_ptr<VoxelGrid> ToVoxelGrid() const;
+
+    /// Creates a grid with hashed storage from a VoxelGrid. Colors are
+    /// rounded to 8 bits per channel.
+    static std::shared_ptr<CompactVoxelGrid> CreateFromVoxelGrid(
+            const VoxelGrid &voxel_grid);
+
+    /// Creates a grid with dense storage where every voxel is set, with the
+    /// same dimensions as VoxelGrid::CreateDense. This is a useful starting
+    /// point for voxel carving.
+    ///
+    /// \param origin Coordinate center of the grid.
+    /// \param voxel_size Voxel size of of the grid construction.
+    /// \param width Spatial width extend of the grid.
+    /// \param height Spatial height extend of the grid.
+    /// \param depth Spatial depth extend of the grid.
+    static std::shared_ptr<CompactVoxelGrid> CreateDense(
+            const Eigen::Vector3d &origin,
+            double voxel_size,
+            double width,
+            double height,
+            double depth);
+
+    /// Creates a grid with hashed storage from a PointCloud, as
+    /// VoxelGrid::CreateFromPointCloud does. The color of a voxel is the
+    /// average color of its points, rounded to 8 bits per channel.
+    ///
+    /// \param input The input PointCloud.
+    /// \param voxel_size Voxel size of of the grid construction.
+    static std::shared_ptr<CompactVoxelGrid> CreateFromPointCloud(
+            const PointCloud &input, double voxel_size);
+
+    /// Creates a grid with hashed storage from a PointCloud, as
+    /// VoxelGrid::CreateFromPointCloudWithinBounds does.
+    ///
+    /// \param input The input PointCloud.
+    /// \param voxel_size Voxel size of of the grid construction.
+    /// \param min_bound Minimum boundary point for the grid to create.
+    /// \param max_bound Maximum boundary point for the grid to create.
+    static std::shared_ptr<CompactVoxelGrid> CreateFromPointCloudWithinBounds(
+            const PointCloud &input,
+            double voxel_size,
+            const Eigen::Vector3d &min_bound,
+            const Eigen::Vector3d &max_bound);
+
+public:
+    /// Size of the voxel.
+    double voxel_size_ = 0.0;
+    /// Coorindate of the origin point.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Storage in use.
+    Backend backend_ = Backend::Hashed;
+    /// Voxels if backend_ is Backend::Hashed.
+    HashedVoxelStorage hashed_voxels_;
+    /// Voxels if backend_ is Backend::Dense.
+    DenseVoxelStorage dense_voxels_;
+
+private:
+    /// Removes, in parallel, the voxels for which carve(index) is true.
+    template <typename func_t>
+    void RemoveVoxelsIf(func_t carve);
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+namespace detail {
+
+/// \class ConcurrentDisjointSet
+///
+/// \brief Lock-free union-find. Roots are always linked to the smaller root,
+/// so concurrent unions cannot create cycles.
+class ConcurrentDisjointSet {
+public:
+    ConcurrentDisjointSet(int64_t size) : parent_(size) {
+        utility::ParallelFor(
+                0, size, [&](int64_t i) { parent_[i].store(int(i)); }, 32768);
+    }
+
+    int Find(int x) {
+        while (true) {
+            int parent = parent_[x].load();
+            if (parent == x) {
+                return x;
+            }
+            // Path halving. A failed exchange only skips the compression.
+            int grandparent = parent_[parent].load();
+            if (parent != grandparent) {
+                parent_[x].compare_exchange_weak(parent, grandparent);
+            }
+            x = grandparent;
+        }
+    }
+
+    void Union(int x, int y) {
+        while (true) {
+            x = Find(x);
+            y = Find(y);
+            if (x == y) {
+                return;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            // Link the larger root x to y, unless x stopped being a root.
+            int expected = x;
+            if (parent_[x].compare_exchange_strong(expected, y)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+}  // namespace detail
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,608 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ConvexHull.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of points whose hull is computed serially. Larger inputs are split
+/// into chunks of this size.
+constexpr int64_t kHullChunkSize = 32768;
+constexpr int64_t kHullGrainSize = 8192;
+
+/// Directions along which the extreme points are found, see
+/// FilterInteriorPoints().
+constexpr int kNumExtremeDirections = 7;
+const double kExtremeDirections[kNumExtremeDirections][3] = {
+        {1, 0, 0}, {0, 1, 0},  {0, 0, 1}, {1, 1, 1},
+        {1, 1, -1}, {1, -1, 1}, {-1, 1, 1}};
+
+/// Serial quickhull, see Barber et al., "The Quickhull Algorithm for Convex
+/// Hulls", 1996. Every facet holds the points above it, and the farthest of
+/// them is added to the hull until no point is left.
+class QuickHull {
+public:
+    QuickHull(std::vector<Eigen::Vector3d> points, double eps)
+        : points_(std::move(points)), eps_(eps) {}
+
+    /// Computes the hull. Returns false if the points do not span a volume.
+    bool Compute() {
+        if (!CreateSimplex()) {
+            return false;
+        }
+        std::vector<int> pending;
+        for (int fidx = 0; fidx < 4; ++fidx) {
+            if (!faces_[fidx].outside.empty()) {
+                pending.push_back(fidx);
+            }
+        }
+        horizon_start_.assign(points_.size(), -1);
+        horizon_end_.assign(points_.size(), -1);
+        while (!pending.empty()) {
+            const int fidx = pending.back();
+            pending.pop_back();
+            if (faces_[fidx].alive && !faces_[fidx].outside.empty()) {
+                AddFarthestPoint(fidx, pending);
+            }
+        }
+        return true;
+    }
+
+    const std::vector<Eigen::Vector3d> &GetPoints() const { return points_; }
+
+    /// Returns the facets of the hull, indexing GetPoints().
+    std::vector<Eigen::Vector3i> GetTriangles() const {
+        std::vector<Eigen::Vector3i> triangles;
+        for (const Face &face : faces_) {
+            if (face.alive) {
+                triangles.push_back(face.vertices);
+            }
+        }
+        return triangles;
+    }
+
+    /// Returns the planes of the facets of the hull as (normal, offset),
+    /// with unit outward normals.
+    std::vector<std::array<double, 4>> GetPlanes() const {
+        std::vector<std::array<double, 4>> planes;
+        for (const Face &face : faces_) {
+            if (face.alive) {
+                planes.push_back({face.normal(0), face.normal(1),
+                                  face.normal(2), -face.offset});
+            }
+        }
+        return planes;
+    }
+
+private:
+    struct Face {
+        /// Counter-clockwise seen from outside.
+        Eigen::Vector3i vertices;
+        /// neighbors(k) is the face across edge (vertices(k),
+        /// vertices((k + 1) % 3)).
+        Eigen::Vector3i neighbors;
+        Eigen::Vector3d normal;
+        double offset;
+        /// Points above the face that are above no other face of the hull
+        /// at the time they were assigned.
+        std::vector<int> outside;
+        int farthest = -1;
+        double farthest_distance = 0;
+        bool alive = true;
+        bool visible = false;
+    };
+
+    struct HorizonEdge {
+        int vidx0;
+        int vidx1;
+        /// Face across the edge that is not visible.
+        int fidx;
+    };
+
+    double Distance(const Face &face, const Eigen::Vector3d &point) const {
+        return face.normal.dot(point) - face.offset;
+    }
+
+    int AddFace(int vidx0, int vidx1, int vidx2) {
+        Face face;
+        face.vertices = Eigen::Vector3i(vidx0, vidx1, vidx2);
+        face.neighbors = Eigen::Vector3i(-1, -1, -1);
+        const Eigen::Vector3d &p0 = points_[vidx0];
+        face.normal = (points_[vidx1] - p0).cross(points_[vidx2] - p0);
+        const double norm = face.normal.norm();
+        if (norm > 0) {
+            face.normal /= norm;
+        }
+        face.offset = face.normal.dot(p0);
+        faces_.push_back(std::move(face));
+        return int(faces_.size()) - 1;
+    }
+
+    /// Adds \p pidx to the outside set of the first face of [fidx_begin,
+    /// fidx_end) it is above. Returns false if it is above none.
+    bool AssignPoint(int pidx, int fidx_begin, int fidx_end) {
+        for (int fidx = fidx_begin; fidx < fidx_end; ++fidx) {
+            Face &face = faces_[fidx];
+            const double dist = Distance(face, points_[pidx]);
+            if (dist > eps_) {
+                face.outside.push_back(pidx);
+                if (dist > face.farthest_distance) {
+                    face.farthest = pidx;
+                    face.farthest_distance = dist;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool CreateSimplex() {
+        const int num_points = int(points_.size());
+        if (num_points < 4) {
+            return false;
+        }
+        // The two farthest of the extreme points along the axes.
+        int extremes[6] = {0, 0, 0, 0, 0, 0};
+        for (int pidx = 1; pidx < num_points; ++pidx) {
+            for (int axis = 0; axis < 3; ++axis) {
+                if (points_[pidx](axis) < points_[extremes[2 * axis]](axis)) {
+                    extremes[2 * axis] = pidx;
+                }
+                if (points_[pidx](axis) >
+                    points_[extremes[2 * axis + 1]](axis)) {
+                    extremes[2 * axis + 1] = pidx;
+                }
+            }
+        }
+        int vidx0 = extremes[0], vidx1 = extremes[1];
+        double max_dist = 0;
+        for (int i = 0; i < 6; ++i) {
+            for (int j = i + 1; j < 6; ++j) {
+                const double dist =
+                        (points_[extremes[i]] - points_[extremes[j]]).norm();
+                if (dist > max_dist) {
+                    vidx0 = extremes[i];
+                    vidx1 = extremes[j];
+                    max_dist = dist;
+                }
+            }
+        }
+        if (max_dist <= eps_) {
+            return false;
+        }
+        // The point farthest from their line.
+        const Eigen::Vector3d &p0 = points_[vidx0];
+        const Eigen::Vector3d dir = (points_[vidx1] - p0).normalized();
+        int vidx2 = -1;
+        max_dist = eps_;
+        for (int pidx = 0; pidx < num_points; ++pidx) {
+            const double dist = (points_[pidx] - p0).cross(dir).norm();
+            if (dist > max_dist) {
+                vidx2 = pidx;
+                max_dist = dist;
+            }
+        }
+        if (vidx2 < 0) {
+            return false;
+        }
+        // The point farthest from their plane.
+        const Eigen::Vector3d normal =
+                (points_[vidx1] - p0).cross(points_[vidx2] - p0).normalized();
+        int vidx3 = -1;
+        max_dist = eps_;
+        for (int pidx = 0; pidx < num_points; ++pidx) {
+            const double dist = std::abs(normal.dot(points_[pidx] - p0));
+            if (dist > max_dist) {
+                vidx3 = pidx;
+                max_dist = dist;
+            }
+        }
+        if (vidx3 < 0) {
+            return false;
+        }
+        if (normal.dot(points_[vidx3] - p0) > 0) {
+            std::swap(vidx1, vidx2);
+        }
+
+        AddFace(vidx0, vidx1, vidx2);
+        AddFace(vidx0, vidx3, vidx1);
+        AddFace(vidx1, vidx3, vidx2);
+        AddFace(vidx2, vidx3, vidx0);
+        for (int fidx = 0; fidx < 4; ++fidx) {
+            for (int k = 0; k < 3; ++k) {
+                const int a = faces_[fidx].vertices(k);
+                const int b = faces_[fidx].vertices((k + 1) % 3);
+                for (int other = 0; other < 4; ++other) {
+                    const Eigen::Vector3i &v = faces_[other].vertices;
+                    if ((v(0) == b && v(1) == a) || (v(1) == b && v(2) == a) ||
+                        (v(2) == b && v(0) == a)) {
+                        faces_[fidx].neighbors(k) = other;
+                    }
+                }
+            }
+        }
+        for (int pidx = 0; pidx < num_points; ++pidx) {
+            if (pidx != vidx0 && pidx != vidx1 && pidx != vidx2 &&
+                pidx != vidx3) {
+                AssignPoint(pidx, 0, 4);
+            }
+        }
+        return true;
+    }
+
+    /// Replaces the faces visible from the farthest point above \p fidx by
+    /// a cone of faces from their horizon to the point.
+    void AddFarthestPoint(int fidx, std::vector<int> &pending) {
+        const int eye = faces_[fidx].farthest;
+        const Eigen::Vector3d eye_point = points_[eye];
+
+        visible_.clear();
+        horizon_.clear();
+        faces_[fidx].visible = true;
+        std::vector<int> stack = {fidx};
+        while (!stack.empty()) {
+            const int gidx = stack.back();
+            stack.pop_back();
+            visible_.push_back(gidx);
+            for (int k = 0; k < 3; ++k) {
+                const int nidx = faces_[gidx].neighbors(k);
+                if (faces_[nidx].visible) {
+                    continue;
+                }
+                if (Distance(faces_[nidx], eye_point) > eps_) {
+                    faces_[nidx].visible = true;
+                    stack.push_back(nidx);
+                } else {
+                    horizon_.push_back({faces_[gidx].vertices(k),
+                                        faces_[gidx].vertices((k + 1) % 3),
+                                        nidx});
+                }
+            }
+        }
+
+        // The horizon must be a single loop. Rounding can break this for
+        // nearly coplanar faces, and the point is then dropped.
+        bool is_loop = true;
+        for (int hidx = 0; hidx < int(horizon_.size()); ++hidx) {
+            int &start = horizon_start_[horizon_[hidx].vidx0];
+            if (start != -1) {
+                is_loop = false;
+            }
+            start = hidx;
+        }
+        if (is_loop) {
+            int hidx = 0;
+            size_t length = 0;
+            do {
+                hidx = horizon_start_[horizon_[hidx].vidx1];
+                length++;
+            } while (hidx > 0 && length < horizon_.size());
+            is_loop = hidx == 0 && length == horizon_.size();
+        }
+        if (!is_loop) {
+            for (const HorizonEdge &edge : horizon_) {
+                horizon_start_[edge.vidx0] = -1;
+            }
+            for (int gidx : visible_) {
+                faces_[gidx].visible = false;
+            }
+            Face &face = faces_[fidx];
+            face.outside.erase(std::find(face.outside.begin(),
+                                         face.outside.end(), eye));
+            face.farthest = -1;
+            face.farthest_distance = 0;
+            for (int pidx : face.outside) {
+                const double dist = Distance(face, points_[pidx]);
+                if (dist > face.farthest_distance) {
+                    face.farthest = pidx;
+                    face.farthest_distance = dist;
+                }
+            }
+            if (!face.outside.empty()) {
+                pending.push_back(fidx);
+            }
+            return;
+        }
+
+        // Cone of new faces, new face first_new + hidx on horizon edge hidx.
+        const int first_new = int(faces_.size());
+        for (const HorizonEdge &edge : horizon_) {
+            const int nidx = AddFace(edge.vidx0, edge.vidx1, eye);
+            horizon_end_[edge.vidx1] = nidx - first_new;
+            Face &across = faces_[edge.fidx];
+            for (int k = 0; k < 3; ++k) {
+                if (across.vertices(k) == edge.vidx1 &&
+                    across.vertices((k + 1) % 3) == edge.vidx0) {
+                    across.neighbors(k) = nidx;
+                }
+            }
+            faces_[nidx].neighbors(0) = edge.fidx;
+        }
+        for (int hidx = 0; hidx < int(horizon_.size()); ++hidx) {
+            const HorizonEdge &edge = horizon_[hidx];
+            Face &face = faces_[first_new + hidx];
+            face.neighbors(1) = first_new + horizon_start_[edge.vidx1];
+            face.neighbors(2) = first_new + horizon_end_[edge.vidx0];
+        }
+        for (const HorizonEdge &edge : horizon_) {
+            horizon_start_[edge.vidx0] = -1;
+            horizon_end_[edge.vidx1] = -1;
+        }
+
+        const int end_new = int(faces_.size());
+        for (int gidx : visible_) {
+            Face &face = faces_[gidx];
+            face.alive = false;
+            std::vector<int> outside;
+            outside.swap(face.outside);
+            for (int pidx : outside) {
+                if (pidx != eye) {
+                    AssignPoint(pidx, first_new, end_new);
+                }
+            }
+        }
+        for (int nidx = first_new; nidx < end_new; ++nidx) {
+            if (!faces_[nidx].outside.empty()) {
+                pending.push_back(nidx);
+            }
+        }
+    }
+
+    std::vector<Eigen::Vector3d> points_;
+    double eps_;
+    std::vector<Face> faces_;
+    std::vector<int> visible_;
+    std::vector<HorizonEdge> horizon_;
+    /// Index in horizon_ of the edge starting and ending at every point.
+    std::vector<int> horizon_start_;
+    std::vector<int> horizon_end_;
+};
+
+/// Returns the points of \p indices in \p points.
+std::vector<Eigen::Vector3d> GatherPoints(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<int64_t> &indices) {
+    std::vector<Eigen::Vector3d> gathered(indices.size());
+    utility::ParallelFor(
+            0, int64_t(indices.size()),
+            [&](int64_t i) { gathered[i] = points[indices[i]]; },
+            kHullGrainSize);
+    return gathered;
+}
+
+/// Returns the indices of the points that are not inside the hull of the
+/// extreme points along kExtremeDirections, in increasing order. These
+/// include all vertices of the hull.
+std::vector<int64_t> FilterInteriorPoints(
+        const std::vector<Eigen::Vector3d> &points, double eps) {
+    const int64_t num_points = int64_t(points.size());
+    // Index of the minimum and maximum point along every direction, the
+    // lowest index among equal ones.
+    typedef std::array<int64_t, 2 * kNumExtremeDirections> Extremes;
+    auto project = [&](int64_t pidx, int dir) {
+        const double *d = kExtremeDirections[dir];
+        return d[0] * points[pidx](0) + d[1] * points[pidx](1) +
+               d[2] * points[pidx](2);
+    };
+    auto update = [&](Extremes &extremes, int64_t pidx) {
+        for (int dir = 0; dir < kNumExtremeDirections; ++dir) {
+            const double value = project(pidx, dir);
+            int64_t &min_idx = extremes[2 * dir];
+            int64_t &max_idx = extremes[2 * dir + 1];
+            if (min_idx < 0 || value < project(min_idx, dir) ||
+                (value == project(min_idx, dir) && pidx < min_idx)) {
+                min_idx = pidx;
+            }
+            if (max_idx < 0 || value > project(max_idx, dir) ||
+                (value == project(max_idx, dir) && pidx < max_idx)) {
+                max_idx = pidx;
+            }
+        }
+    };
+    Extremes identity;
+    identity.fill(-1);
+    const Extremes extremes = utility::ParallelReduce(
+            0, num_points, identity,
+            [&](int64_t begin, int64_t end, Extremes extremes) {
+                for (int64_t pidx = begin; pidx < end; ++pidx) {
+                    update(extremes, pidx);
+                }
+                return extremes;
+            },
+            [&](Extremes lhs, const Extremes &rhs) {
+                for (int64_t pidx : rhs) {
+                    if (pidx >= 0) {
+                        update(lhs, pidx);
+                    }
+                }
+                return lhs;
+            },
+            kHullGrainSize);
+
+    std::vector<int64_t> extreme_indices(extremes.begin(), extremes.end());
+    std::sort(extreme_indices.begin(), extreme_indices.end());
+    extreme_indices.erase(
+            std::unique(extreme_indices.begin(), extreme_indices.end()),
+            extreme_indices.end());
+    QuickHull extreme_hull(GatherPoints(points, extreme_indices), eps);
+    std::vector<int64_t> indices;
+    if (!extreme_hull.Compute()) {
+        indices.resize(num_points);
+        std::iota(indices.begin(), indices.end(), 0);
+        return indices;
+    }
+
+    // Plane coefficients in separate arrays, so the distance loop is
+    // vectorized.
+    const std::vector<std::array<double, 4>> planes =
+            extreme_hull.GetPlanes();
+    const int num_planes = int(planes.size());
+    std::vector<double> nx(num_planes), ny(num_planes), nz(num_planes),
+            offsets(num_planes);
+    for (int i = 0; i < num_planes; ++i) {
+        nx[i] = planes[i][0];
+        ny[i] = planes[i][1];
+        nz[i] = planes[i][2];
+        offsets[i] = planes[i][3];
+    }
+    std::vector<uint8_t> is_candidate(num_points);
+    utility::ParallelFor(
+            0, num_points,
+            [&](int64_t pidx) {
+                const double x = points[pidx](0);
+                const double y = points[pidx](1);
+                const double z = points[pidx](2);
+                double max_dist = -DBL_MAX;
+                for (int i = 0; i < num_planes; ++i) {
+                    max_dist = std::max(
+                            max_dist,
+                            nx[i] * x + ny[i] * y + nz[i] * z + offsets[i]);
+                }
+                is_candidate[pidx] = max_dist > eps;
+            },
+            kHullGrainSize);
+    for (int64_t pidx : extreme_indices) {
+        is_candidate[pidx] = 1;
+    }
+    for (int64_t pidx = 0; pidx < num_points; ++pidx) {
+        if (is_candidate[pidx]) {
+            indices.push_back(pidx);
+        }
+    }
+    return indices;
+}
+
+/// Returns the indices in \p indices of the vertices of the hull of the
+/// points of \p indices, in increasing order, or all of them if they do
+/// not span a volume.
+std::vector<int64_t> ComputeHullVertices(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<int64_t> &indices,
+        double eps) {
+    QuickHull hull(GatherPoints(points, indices), eps);
+    if (!hull.Compute()) {
+        return indices;
+    }
+    std::vector<uint8_t> is_vertex(indices.size(), 0);
+    for (const Eigen::Vector3i &triangle : hull.GetTriangles()) {
+        for (int k = 0; k < 3; ++k) {
+            is_vertex[triangle(k)] = 1;
+        }
+    }
+    std::vector<int64_t> vertices;
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (is_vertex[i]) {
+            vertices.push_back(indices[i]);
+        }
+    }
+    return vertices;
+}
+
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+ConvexHull::ComputeConvexHull(const std::vector<Eigen::Vector3d> &points) {
+    if (points.size() < 4) {
+        utility::LogError(
+                "[ComputeConvexHull] not enough points to create a convex "
+                "hull.");
+    }
+    // Rounding errors of the point-plane distances grow with the magnitude
+    // of the coordinates.
+    const Eigen::Vector3d max_abs = utility::ParallelReduce(
+            0, int64_t(points.size()), Eigen::Vector3d(0, 0, 0),
+            [&](int64_t begin, int64_t end, Eigen::Vector3d max_abs) {
+                for (int64_t pidx = begin; pidx < end; ++pidx) {
+                    max_abs = max_abs.cwiseMax(points[pidx].cwiseAbs());
+                }
+                return max_abs;
+            },
+            [](const Eigen::Vector3d &lhs, const Eigen::Vector3d &rhs) {
+                return Eigen::Vector3d(lhs.cwiseMax(rhs));
+            },
+            kHullGrainSize);
+    const double eps = 3 * DBL_EPSILON * max_abs.sum();
+
+    std::vector<int64_t> indices = FilterInteriorPoints(points, eps);
+    const int64_t num_chunks =
+            (int64_t(indices.size()) + kHullChunkSize - 1) / kHullChunkSize;
+    if (num_chunks > 1) {
+        std::vector<std::vector<int64_t>> chunk_vertices(num_chunks);
+        utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            const auto begin = indices.begin() + chunk_idx * kHullChunkSize;
+            const auto end = chunk_idx + 1 < num_chunks
+                                     ? begin + kHullChunkSize
+                                     : indices.end();
+            chunk_vertices[chunk_idx] = ComputeHullVertices(
+                    points, std::vector<int64_t>(begin, end), eps);
+        });
+        indices.clear();
+        for (const std::vector<int64_t> &vertices : chunk_vertices) {
+            indices.insert(indices.end(), vertices.begin(), vertices.end());
+        }
+    }
+
+    QuickHull hull(GatherPoints(points, indices), eps);
+    if (!hull.Compute()) {
+        utility::LogError(
+                "[ComputeConvexHull] the points do not span a volume.");
+    }
+
+    // Vertices in the order the triangles reference them.
+    auto convex_hull = std::make_shared<TriangleMesh>();
+    std::vector<size_t> pt_map;
+    convex_hull->triangles_ = hull.GetTriangles();
+    std::vector<int> vertex_map(indices.size(), -1);
+    for (Eigen::Vector3i &triangle : convex_hull->triangles_) {
+        for (int k = 0; k < 3; ++k) {
+            int &vidx = vertex_map[triangle(k)];
+            if (vidx < 0) {
+                vidx = int(pt_map.size());
+                pt_map.push_back(size_t(indices[triangle(k)]));
+                convex_hull->vertices_.push_back(points[indices[triangle(k)]]);
+            }
+            triangle(k) = vidx;
+        }
+    }
+    return std::make_tuple(convex_hull, pt_map);
+}
+
+}  // namespace geometry
+}  // namespace open3d
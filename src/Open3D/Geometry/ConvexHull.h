@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class ConvexHull
+///
+/// \brief Parallel quickhull of 3D points.
+///
+/// Points inside the hull of the extreme points along 7 directions are
+/// discarded first (the Akl-Toussaint heuristic). The hulls of chunks of the
+/// remaining points are then computed in parallel, and the result is the
+/// hull of their vertices. The chunks do not depend on the number of
+/// threads, so neither does the result. Points within a tolerance, relative
+/// to the magnitude of the coordinates, of a hull facet are not vertices.
+class ConvexHull {
+public:
+    /// \brief Computes the convex hull of \p points.
+    ///
+    /// \return The hull as a triangle mesh, whose triangles are oriented
+    /// counter-clockwise seen from outside, and the index in \p points of
+    /// every vertex of the mesh. Fails if the points do not span a volume.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+    ComputeConvexHull(const std::vector<Eigen::Vector3d> &points);
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -24,20 +24,35 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <tuple>
 
 #include <Eigen/Eigenvalues>
 
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/ConcurrentDisjointSet.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeIndex.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TetraMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
 namespace {
 using namespace geometry;
 
+// Number of points whose neighborhoods CompactPointCloud::EstimateNormals
+// searches at once, which bounds the size of the neighbor graph.
+constexpr int64_t kNormalQueryBatchSize = 1 << 16;
+
 Eigen::Vector3d ComputeEigenvector0(const Eigen::Matrix3d &A, double eval0) {
     Eigen::Vector3d row0(A(0, 0) - eval0, A(0, 1), A(0, 2));
     Eigen::Vector3d row1(A(0, 1), A(1, 1) - eval0, A(1, 2));
@@ -220,6 +235,17 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
+Eigen::Vector3d ComputeNormalFromCovariance(Eigen::Matrix3d covariance,
+                                            bool fast_normal_computation) {
+    if (fast_normal_computation) {
+        return FastEigen3x3(covariance);
+    } else {
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+        solver.compute(covariance, Eigen::ComputeEigenvectors);
+        return solver.eigenvectors().col(0);
+    }
+}
+
 Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
                               const std::vector<int> &indices,
                               bool fast_normal_computation) {
@@ -251,81 +277,218 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     covariance(2, 0) = covariance(0, 2);
     covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
     covariance(2, 1) = covariance(1, 2);
-
-    if (fast_normal_computation) {
-        return FastEigen3x3(covariance);
-    } else {
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-        solver.compute(covariance, Eigen::ComputeEigenvectors);
-        return solver.eigenvectors().col(0);
-    }
+    return ComputeNormalFromCovariance(covariance, fast_normal_computation);
 }
 
-// Disjoint set data structure to find cycles in graphs
-class DisjointSet {
-public:
-    DisjointSet(size_t size) : parent_(size), size_(size) {
-        for (size_t idx = 0; idx < size; idx++) {
-            parent_[idx] = idx;
-            size_[idx] = 0;
-        }
-    }
-
-    // find representative element for given x
-    // using path compression
-    size_t Find(size_t x) {
-        if (x != parent_[x]) {
-            parent_[x] = Find(parent_[x]);
-        }
-        return parent_[x];
+// Covariance of neighborhood i of the graph, the neighborhood of query.
+// Coordinates are taken relative to the query point, so the moments do not
+// cancel out for points far away from the origin. Single precision points are
+// converted to double before the subtraction. The fixed size Eigen types let
+// the accumulation vectorize.
+template <typename vector_t>
+Eigen::Matrix3d ComputeNeighborhoodCovariance(
+        const std::vector<vector_t> &points,
+        const vector_t &query,
+        const NeighborGraph &graph,
+        size_t i) {
+    const Eigen::Vector3d origin = query.template cast<double>();
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d sum_outer = Eigen::Matrix3d::Zero();
+    for (int64_t k = graph.offsets_[i]; k < graph.offsets_[i + 1]; k++) {
+        const Eigen::Vector3d p =
+                points[graph.indices_[k]].template cast<double>() - origin;
+        sum += p;
+        sum_outer.noalias() += p * p.transpose();
     }
+    const double inv_n = 1.0 / double(graph.NumNeighbors(i));
+    const Eigen::Vector3d mean = sum * inv_n;
+    return sum_outer * inv_n - mean * mean.transpose();
+}
 
-    // combine two sets using size of sets
-    void Union(size_t x, size_t y) {
-        x = Find(x);
-        y = Find(y);
-        if (x != y) {
-            if (size_[x] < size_[y]) {
-                size_[y] += size_[x];
-                parent_[x] = y;
-            } else {
-                size_[x] += size_[y];
-                parent_[y] = x;
-            }
-        }
-    }
+// Grain size of the parallel loops over the points and edges of the graphs
+// of OrientNormalsConsistentTangentPlane.
+constexpr int64_t kOrientGrainSize = 32768;
 
-private:
-    std::vector<size_t> parent_;
-    std::vector<size_t> size_;
-};
+// Frontiers of the tree traversal smaller than this are expanded serially.
+constexpr int64_t kSerialFrontierSize = 1024;
 
 struct WeightedEdge {
-    WeightedEdge(size_t v0, size_t v1, double weight)
+    WeightedEdge() {}
+    WeightedEdge(int v0, int v1, double weight)
         : v0_(v0), v1_(v1), weight_(weight) {}
-    size_t v0_;
-    size_t v1_;
+    int v0_;
+    int v1_;
     double weight_;
 };
 
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
-                                  size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
-    DisjointSet disjoint_set(n_vertices);
-    std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
+// Removes the elements of values for which remove(value) is true, keeping the
+// order of the others. Chunks count their kept elements in parallel, and then
+// copy them to their offsets in parallel.
+template <typename T, typename func_t>
+void ParallelRemoveIf(std::vector<T> &values, func_t remove) {
+    const int64_t size = int64_t(values.size());
+    const int64_t num_chunks =
+            utility::detail::GetNumChunks(0, size, kOrientGrainSize);
+    if (num_chunks == 0) {
+        return;
+    }
+    const int64_t chunk_size = (size + num_chunks - 1) / num_chunks;
+    std::vector<uint8_t> keep(size);
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+        const int64_t end = std::min(size, (c + 1) * chunk_size);
+        int64_t count = 0;
+        for (int64_t i = c * chunk_size; i < end; i++) {
+            keep[i] = !remove(values[i]);
+            count += keep[i];
+        }
+        offsets[c + 1] = count;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<T> kept(offsets.back());
+    utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+        const int64_t end = std::min(size, (c + 1) * chunk_size);
+        int64_t j = offsets[c];
+        for (int64_t i = c * chunk_size; i < end; i++) {
+            if (keep[i]) {
+                kept[j++] = values[i];
+            }
         }
+    });
+    values.swap(kept);
+}
+
+// Minimum spanning forest of a graph, by Boruvka's algorithm. Every round,
+// each component finds its lightest edge to another component with atomic
+// updates over the remaining edges in parallel, and the components are merged
+// along these edges with a concurrent union-find. Edges of equal weights are
+// ordered by index, and NaN weights are the largest, so that the order is
+// total and the lightest edges cannot form cycles. Returns the edges of the
+// forest, in the order of edges.
+std::vector<WeightedEdge> MinimumSpanningForest(
+        const std::vector<WeightedEdge> &edges, int num_vertices) {
+    const int64_t num_edges = int64_t(edges.size());
+    std::vector<double> weights(num_edges);
+    utility::ParallelFor(
+            0, num_edges,
+            [&](int64_t e) {
+                weights[e] = std::isnan(edges[e].weight_)
+                                     ? std::numeric_limits<double>::infinity()
+                                     : edges[e].weight_;
+            },
+            kOrientGrainSize);
+    auto precedes = [&](int64_t e0, int64_t e1) {
+        return weights[e0] < weights[e1] ||
+               (weights[e0] == weights[e1] && e0 < e1);
+    };
+
+    detail::ConcurrentDisjointSet components(num_vertices);
+    std::vector<std::atomic<int64_t>> lightest(num_vertices);
+    std::vector<uint8_t> in_forest(num_edges, 0);
+    // Edges that may still join two components.
+    std::vector<int64_t> candidates(num_edges);
+    std::iota(candidates.begin(), candidates.end(), int64_t(0));
+    while (true) {
+        ParallelRemoveIf(candidates, [&](int64_t e) {
+            return components.Find(edges[e].v0_) ==
+                   components.Find(edges[e].v1_);
+        });
+        if (candidates.empty()) {
+            break;
+        }
+        utility::ParallelFor(
+                0, int64_t(num_vertices),
+                [&](int64_t v) { lightest[v].store(-1); }, kOrientGrainSize);
+        utility::ParallelFor(
+                0, int64_t(candidates.size()),
+                [&](int64_t i) {
+                    const int64_t e = candidates[i];
+                    for (int v : {edges[e].v0_, edges[e].v1_}) {
+                        std::atomic<int64_t> &current =
+                                lightest[components.Find(v)];
+                        int64_t lightest_edge = current.load();
+                        while ((lightest_edge < 0 ||
+                                precedes(e, lightest_edge)) &&
+                               !current.compare_exchange_weak(lightest_edge,
+                                                              e)) {
+                        }
+                    }
+                },
+                kOrientGrainSize);
+        // An edge selected by both of its components is added by the smaller
+        // root, so that every flag has one writer.
+        utility::ParallelFor(
+                0, int64_t(num_vertices),
+                [&](int64_t v) {
+                    const int64_t e = lightest[v].load();
+                    if (e < 0) {
+                        return;
+                    }
+                    const int root0 = components.Find(edges[e].v0_);
+                    const int root1 = components.Find(edges[e].v1_);
+                    const int other = root0 == int(v) ? root1 : root0;
+                    if (lightest[other].load() != e || v < other) {
+                        in_forest[e] = 1;
+                    }
+                },
+                kOrientGrainSize);
+        utility::ParallelFor(
+                0, int64_t(num_vertices),
+                [&](int64_t v) {
+                    const int64_t e = lightest[v].load();
+                    if (e >= 0) {
+                        components.Union(edges[e].v0_, edges[e].v1_);
+                    }
+                },
+                kOrientGrainSize);
     }
-    return mst;
+
+    std::vector<int64_t> forest(num_edges);
+    std::iota(forest.begin(), forest.end(), int64_t(0));
+    ParallelRemoveIf(forest, [&](int64_t e) { return !in_forest[e]; });
+    std::vector<WeightedEdge> forest_edges(forest.size());
+    utility::ParallelFor(0, int64_t(forest.size()), [&](int64_t i) {
+        forest_edges[i] = edges[forest[i]];
+    });
+    return forest_edges;
+}
+
+// Keys v0 * num_points + v1 of the undirected edges between different points
+// of the tetrahedra, with v0 < v1, sorted and unique. The vertices of the
+// tetrahedra are mapped to points by pt_map.
+std::vector<uint64_t> GetTetraEdgeKeys(const TetraMesh &mesh,
+                                       const std::vector<size_t> &pt_map,
+                                       size_t num_points) {
+    static const int kTetraEdges[6][2] = {{0, 1}, {0, 2}, {0, 3},
+                                          {1, 2}, {1, 3}, {2, 3}};
+    const int64_t num_tetras = int64_t(mesh.tetras_.size());
+    std::vector<uint64_t> keys(6 * num_tetras);
+    utility::ParallelFor(
+            0, num_tetras,
+            [&](int64_t t) {
+                const Eigen::Vector4i &tetra = mesh.tetras_[t];
+                for (int i = 0; i < 6; i++) {
+                    const uint64_t v0 = pt_map[tetra(kTetraEdges[i][0])];
+                    const uint64_t v1 = pt_map[tetra(kTetraEdges[i][1])];
+                    keys[6 * t + i] = std::min(v0, v1) * num_points +
+                                      std::max(v0, v1);
+                }
+            },
+            kOrientGrainSize);
+    std::vector<int64_t> order(keys.size());
+    std::iota(order.begin(), order.end(), int64_t(0));
+    utility::ParallelRadixSortPairs(keys, order, kOrientGrainSize);
+    std::vector<int64_t> unique(keys.size());
+    std::iota(unique.begin(), unique.end(), int64_t(0));
+    ParallelRemoveIf(unique, [&](int64_t i) {
+        return (i > 0 && keys[i] == keys[i - 1]) ||
+               keys[i] / num_points == keys[i] % num_points;
+    });
+    std::vector<uint64_t> unique_keys(unique.size());
+    utility::ParallelFor(0, int64_t(unique.size()), [&](int64_t i) {
+        unique_keys[i] = keys[unique[i]];
+    });
+    return unique_keys;
 }
 
 }  // unnamed namespace
@@ -335,16 +498,15 @@ namespace geometry {
 void PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
+    utility::ProfilerScope profiler_scope("EstimateNormals");
+    profiler_scope.AddItems(int64_t(points_.size()));
     bool has_normal = HasNormals();
     if (!has_normal) {
         normals_.resize(points_.size());
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
         std::vector<int> indices;
         std::vector<double> distance2;
         Eigen::Vector3d normal;
@@ -364,7 +526,119 @@ void PointCloud::EstimateNormals(
         } else {
             normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
         }
+    });
+}
+
+void PointCloud::EstimateNormals(const NeighborGraph &graph,
+                                 bool fast_normal_computation /* = true */) {
+    utility::ProfilerScope profiler_scope("EstimateNormals");
+    profiler_scope.AddItems(int64_t(points_.size()));
+    if (graph.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[EstimateNormals] The neighbor graph has {} points, but the "
+                "point cloud has {}.",
+                graph.NumPoints(), points_.size());
+    }
+    bool has_normal = HasNormals();
+    if (!has_normal) {
+        normals_.resize(points_.size());
     }
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
+        Eigen::Vector3d normal;
+        if (graph.NumNeighbors(i) >= 3) {
+            normal = ComputeNormalFromCovariance(
+                    ComputeNeighborhoodCovariance(points_, points_[i], graph,
+                                                  i),
+                    fast_normal_computation);
+            if (normal.norm() == 0.0) {
+                if (has_normal) {
+                    normal = normals_[i];
+                } else {
+                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                }
+            }
+            if (has_normal && normal.dot(normals_[i]) < 0.0) {
+                normal *= -1.0;
+            }
+            normals_[i] = normal;
+        } else {
+            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+        }
+    });
+}
+
+void CompactPointCloud::EstimateNormals(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    utility::ProfilerScope profiler_scope("EstimateNormals");
+    profiler_scope.AddItems(int64_t(points_.size()));
+    if (points_.empty()) {
+        return;
+    }
+    bool has_normal = HasNormals();
+    if (!has_normal) {
+        normals_.resize(points_.size());
+    }
+    KDTreeIndex index;
+    index.SetPoints(points_);
+    const int64_t num_points = int64_t(points_.size());
+    std::vector<Eigen::Vector3f> queries;
+    for (int64_t begin = 0; begin < num_points;
+         begin += kNormalQueryBatchSize) {
+        const int64_t end =
+                std::min(num_points, begin + kNormalQueryBatchSize);
+        queries.assign(points_.begin() + begin, points_.begin() + end);
+        const auto graph =
+                NeighborGraph::CreateFromQueries(index, queries, search_param);
+        utility::ParallelFor(0, end - begin, [&](int64_t j) {
+            const int64_t i = begin + j;
+            Eigen::Vector3d normal;
+            if (graph->NumNeighbors(j) >= 3) {
+                normal = ComputeNormalFromCovariance(
+                        ComputeNeighborhoodCovariance(points_, queries[j],
+                                                      *graph, j),
+                        fast_normal_computation);
+                if (normal.norm() == 0.0) {
+                    if (has_normal) {
+                        normal = normals_[i].cast<double>();
+                    } else {
+                        normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                    }
+                }
+                if (has_normal &&
+                    normal.dot(normals_[i].cast<double>()) < 0.0) {
+                    normal *= -1.0;
+                }
+                normals_[i] = normal.cast<float>();
+            } else {
+                normals_[i] = Eigen::Vector3f(0.0f, 0.0f, 1.0f);
+            }
+        });
+    }
+}
+
+void PointCloud::EstimateCovariances(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/) {
+    auto graph = NeighborGraph::CreateFromPointCloud(*this, search_param);
+    EstimateCovariances(*graph);
+}
+
+void PointCloud::EstimateCovariances(const NeighborGraph &graph) {
+    if (graph.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[EstimateCovariances] The neighbor graph has {} points, but "
+                "the point cloud has {}.",
+                graph.NumPoints(), points_.size());
+    }
+    covariances_.resize(points_.size());
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
+        if (graph.NumNeighbors(i) >= 3) {
+            covariances_[i] =
+                ComputeNeighborhoodCovariance(points_, points_[i], graph, i);
+        } else {
+            covariances_[i] = Eigen::Matrix3d::Zero();
+        }
+    });
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -375,17 +649,14 @@ void PointCloud::OrientNormalsToAlignWithDirection(
                 "[OrientNormalsToAlignWithDirection] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
             normal = orientation_reference;
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsTowardsCameraLocation(
@@ -395,10 +666,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
                 "[OrientNormalsTowardsCameraLocation] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
         Eigen::Vector3d orientation_reference = camera_location - points_[i];
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
@@ -411,7 +679,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
@@ -420,110 +688,214 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
                 "[OrientNormalsConsistentTangentPlane] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
+    auto graph = NeighborGraph::CreateFromPointCloud(
+            *this, KDTreeSearchParamKNN(int(k)));
+    OrientNormalsConsistentTangentPlane(*graph);
+}
+
+void PointCloud::OrientNormalsConsistentTangentPlane(
+        const NeighborGraph &graph) {
+    if (!HasNormals()) {
+        utility::LogError(
+                "[OrientNormalsConsistentTangentPlane] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+    if (graph.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[OrientNormalsConsistentTangentPlane] The neighbor graph has "
+                "{} points, but the point cloud has {}.",
+                graph.NumPoints(), points_.size());
+    }
+
+    const int num_points = int(points_.size());
+    if (num_points == 0) {
+        return;
+    }
 
     // Create Riemannian graph (Euclidian MST + kNN)
     // Euclidian MST is subgraph of Delaunay triangulation
     std::shared_ptr<TetraMesh> delaunay_mesh;
     std::vector<size_t> pt_map;
     std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
-    auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
-    };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
-        }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
-    }
-
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
-
-    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
+    const std::vector<uint64_t> delaunay_keys =
+            GetTetraEdgeKeys(*delaunay_mesh, pt_map, points_.size());
+    std::vector<WeightedEdge> delaunay_graph(delaunay_keys.size());
+    utility::ParallelFor(
+            0, int64_t(delaunay_keys.size()),
+            [&](int64_t i) {
+                const int v0 = int(delaunay_keys[i] / points_.size());
+                const int v1 = int(delaunay_keys[i] % points_.size());
+                delaunay_graph[i] = WeightedEdge(
+                        v0, v1, (points_[v0] - points_[v1]).squaredNorm());
+            },
+            kOrientGrainSize);
+    std::vector<WeightedEdge> mst =
+            MinimumSpanningForest(delaunay_graph, num_points);
+
+    auto NormalWeight = [&](int v0, int v1) -> double {
         return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
     };
-    for (auto &edge : mst) {
-        edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
-    }
-
-    // Add k nearest neighbors to Riemannian graph
-    KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
-        std::vector<int> neighbors;
-        std::vector<double> dists2;
-        kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
-        for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
-            size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
-                continue;
-            }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
-            }
+    utility::ParallelFor(
+            0, int64_t(mst.size()),
+            [&](int64_t i) {
+                mst[i].weight_ = NormalWeight(mst[i].v0_, mst[i].v1_);
+            },
+            kOrientGrainSize);
+
+    // Add nearest neighbors to Riemannian graph, except the edges of the
+    // Delaunay graph. An edge found from both of its points is added by the
+    // smaller one.
+    auto IsNewNeighborEdge = [&](int v0, int64_t k) {
+        const int v1 = graph.indices_[k];
+        if (v0 == v1 ||
+            std::binary_search(
+                    delaunay_keys.begin(), delaunay_keys.end(),
+                    uint64_t(std::min(v0, v1)) * points_.size() +
+                            uint64_t(std::max(v0, v1)))) {
+            return false;
         }
-    }
+        if (v0 < v1) {
+            return true;
+        }
+        const auto begin = graph.indices_.begin() + graph.offsets_[v1];
+        const auto end = graph.indices_.begin() + graph.offsets_[v1 + 1];
+        return std::find(begin, end, v0) == end;
+    };
+    std::vector<int64_t> edge_offsets(num_points + 1, 0);
+    utility::ParallelFor(
+            0, int64_t(num_points),
+            [&](int64_t v0) {
+                for (int64_t k = graph.offsets_[v0];
+                     k < graph.offsets_[v0 + 1]; k++) {
+                    edge_offsets[v0 + 1] += IsNewNeighborEdge(int(v0), k);
+                }
+            },
+            kOrientGrainSize);
+    std::partial_sum(edge_offsets.begin(), edge_offsets.end(),
+                     edge_offsets.begin());
+    const size_t num_mst_edges = mst.size();
+    mst.resize(num_mst_edges + edge_offsets.back());
+    utility::ParallelFor(
+            0, int64_t(num_points),
+            [&](int64_t v0) {
+                int64_t e = int64_t(num_mst_edges) + edge_offsets[v0];
+                for (int64_t k = graph.offsets_[v0];
+                     k < graph.offsets_[v0 + 1]; k++) {
+                    if (IsNewNeighborEdge(int(v0), k)) {
+                        const int v1 = graph.indices_[k];
+                        mst[e++] = WeightedEdge(int(v0), v1,
+                                                NormalWeight(int(v0), v1));
+                    }
+                }
+            },
+            kOrientGrainSize);
 
     // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
-
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
-    for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
-    }
+    mst = MinimumSpanningForest(mst, num_points);
+
+    // convert list of edges to graph, the neighbors of point v are
+    // mst_neighbors[mst_offsets[v]] to mst_neighbors[mst_offsets[v + 1] - 1]
+    std::vector<uint64_t> mst_sources(2 * mst.size());
+    std::vector<int64_t> mst_neighbors(2 * mst.size());
+    utility::ParallelFor(
+            0, int64_t(mst.size()),
+            [&](int64_t i) {
+                mst_sources[2 * i] = uint64_t(mst[i].v0_);
+                mst_neighbors[2 * i] = mst[i].v1_;
+                mst_sources[2 * i + 1] = uint64_t(mst[i].v1_);
+                mst_neighbors[2 * i + 1] = mst[i].v0_;
+            },
+            kOrientGrainSize);
+    utility::ParallelRadixSortPairs(mst_sources, mst_neighbors,
+                                    kOrientGrainSize);
+    std::vector<int64_t> mst_offsets(num_points + 1, 0);
+    utility::ParallelFor(
+            0, int64_t(mst_sources.size()),
+            [&](int64_t i) {
+                const int64_t first =
+                        i == 0 ? 0 : int64_t(mst_sources[i - 1]) + 1;
+                for (int64_t v = first; v <= int64_t(mst_sources[i]); v++) {
+                    mst_offsets[v] = i;
+                }
+            },
+            kOrientGrainSize);
+    const int64_t first_unreached =
+            mst_sources.empty() ? 0 : int64_t(mst_sources.back()) + 1;
+    std::fill(mst_offsets.begin() + first_unreached, mst_offsets.end(),
+              int64_t(mst_sources.size()));
 
     // find start node for tree traversal
     // init with node that maximizes z
-    double max_z = std::numeric_limits<double>::lowest();
-    size_t v0;
-    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
-        const Eigen::Vector3d &v = points_[vidx];
-        if (v(2) > max_z) {
-            max_z = v(2);
-            v0 = vidx;
-        }
-    }
-
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
+    const int64_t root = utility::ParallelReduce(
+            int64_t(0), int64_t(num_points), int64_t(0),
+            [&](int64_t begin, int64_t end, int64_t max_index) {
+                max_index = begin;
+                for (int64_t i = begin + 1; i < end; i++) {
+                    if (points_[i](2) > points_[max_index](2)) {
+                        max_index = i;
+                    }
+                }
+                return max_index;
+            },
+            [&](int64_t lhs, int64_t rhs) {
+                return points_[rhs](2) > points_[lhs](2) ? rhs : lhs;
+            },
+            kOrientGrainSize);
+
+    // traverse MST and orient normals consistently, one frontier of the
+    // breadth-first traversal at a time. Every point is oriented by its
+    // parent in the tree, the only point of the frontier next to it, so
+    // points of a frontier are expanded in parallel.
     auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
                                    Eigen::Vector3d &n1) {
         if (n0.dot(n1) < 0) {
             n1 *= -1;
         }
     };
-    TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
+    TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[root]);
+    std::vector<uint8_t> visited(num_points, 0);
+    visited[root] = 1;
+    std::vector<int64_t> frontier(1, root), next_frontier;
+    std::vector<int64_t> child_offsets;
+    while (!frontier.empty()) {
+        const int64_t frontier_size = int64_t(frontier.size());
+        child_offsets.assign(frontier_size + 1, 0);
+        auto CountChildren = [&](int64_t i) {
+            const int64_t v0 = frontier[i];
+            for (int64_t k = mst_offsets[v0]; k < mst_offsets[v0 + 1]; k++) {
+                child_offsets[i + 1] += !visited[mst_neighbors[k]];
             }
+        };
+        auto OrientChildren = [&](int64_t i) {
+            const int64_t v0 = frontier[i];
+            int64_t child = child_offsets[i];
+            for (int64_t k = mst_offsets[v0]; k < mst_offsets[v0 + 1]; k++) {
+                const int64_t v1 = mst_neighbors[k];
+                if (!visited[v1]) {
+                    visited[v1] = 1;
+                    TestAndOrientNormal(normals_[v0], normals_[v1]);
+                    next_frontier[child++] = v1;
+                }
+            }
+        };
+        if (frontier_size < kSerialFrontierSize) {
+            for (int64_t i = 0; i < frontier_size; i++) {
+                CountChildren(i);
+            }
+        } else {
+            utility::ParallelFor(0, frontier_size, CountChildren);
+        }
+        std::partial_sum(child_offsets.begin(), child_offsets.end(),
+                         child_offsets.begin());
+        next_frontier.resize(child_offsets.back());
+        if (frontier_size < kSerialFrontierSize) {
+            for (int64_t i = 0; i < frontier_size; i++) {
+                OrientChildren(i);
+            }
+        } else {
+            utility::ParallelFor(0, frontier_size, OrientChildren);
         }
+        frontier.swap(next_frontier);
     }
 }
 
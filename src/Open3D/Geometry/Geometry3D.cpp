@@ -27,13 +27,55 @@
 #include "Open3D/Geometry/Geometry3D.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <numeric>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+// Number of points transformed by a task. The transforms are memory bound, so
+// small geometries are not worth splitting.
+constexpr int64_t kTransformGrainSize = 8192;
+
+/// Writes R * src[i] + t to dst[i], which is resized. src and dst may be the
+/// same vector. Each task copies the coefficients to local scalars, which stay
+/// in registers: the compiler would otherwise reload them after every store
+/// to dst, as they could alias.
+void AffineTransformVectors(const Eigen::Matrix3d& R,
+                            const Eigen::Vector3d& t,
+                            const std::vector<Eigen::Vector3d>& src,
+                            std::vector<Eigen::Vector3d>& dst) {
+    dst.resize(src.size());
+    const int64_t n = int64_t(src.size());
+    const int64_t num_blocks =
+            (n + kTransformGrainSize - 1) / kTransformGrainSize;
+    utility::ParallelFor(0, num_blocks, [&](int64_t block) {
+        const double r00 = R(0, 0), r01 = R(0, 1), r02 = R(0, 2);
+        const double r10 = R(1, 0), r11 = R(1, 1), r12 = R(1, 2);
+        const double r20 = R(2, 0), r21 = R(2, 1), r22 = R(2, 2);
+        const double t0 = t(0), t1 = t(1), t2 = t(2);
+        const int64_t begin = block * kTransformGrainSize;
+        const int64_t end = std::min(n, begin + kTransformGrainSize);
+        const double* src_ptr = src[begin].data();
+        double* dst_ptr = dst[begin].data();
+        for (int64_t i = 0; i < end - begin; ++i) {
+            const double x = src_ptr[3 * i];
+            const double y = src_ptr[3 * i + 1];
+            const double z = src_ptr[3 * i + 2];
+            dst_ptr[3 * i] = r00 * x + r01 * y + r02 * z + t0;
+            dst_ptr[3 * i + 1] = r10 * x + r11 * y + r12 * z + t1;
+            dst_ptr[3 * i + 2] = r20 * x + r21 * y + r22 * z + t2;
+        }
+    });
+}
+
+}  // unnamed namespace
+
 Eigen::Vector3d Geometry3D::ComputeMinBound(
         const std::vector<Eigen::Vector3d>& points) const {
     if (points.empty()) {
@@ -91,22 +133,39 @@ void Geometry3D::ResizeAndPaintUniformColor(
 
 void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
                                  std::vector<Eigen::Vector3d>& points) const {
-    for (auto& point : points) {
-        Eigen::Vector4d new_point =
-                transformation *
-                Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        point = new_point.head<3>() / new_point(3);
+    TransformPoints(transformation, points, points);
+}
+
+void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
+                                 const std::vector<Eigen::Vector3d>& src,
+                                 std::vector<Eigen::Vector3d>& dst) const {
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    if (transformation.row(3) == Eigen::RowVector4d(0.0, 0.0, 0.0, 1.0)) {
+        AffineTransformVectors(R, t, src, dst);
+    } else {
+        dst.resize(src.size());
+        const Eigen::RowVector3d w = transformation.block<1, 3>(3, 0);
+        const double w0 = transformation(3, 3);
+        utility::ParallelFor(
+                0, int64_t(src.size()),
+                [&](int64_t i) {
+                    const Eigen::Vector3d point = src[i];
+                    dst[i] = (R * point + t) / (w.dot(point) + w0);
+                },
+                kTransformGrainSize);
     }
 }
 
 void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
                                   std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
-        Eigen::Vector4d new_normal =
-                transformation *
-                Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0);
-        normal = new_normal.head<3>();
-    }
+    TransformNormals(transformation, normals, normals);
+}
+
+void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
+                                  const std::vector<Eigen::Vector3d>& src,
+                                  std::vector<Eigen::Vector3d>& dst) const {
+    RotateNormals(transformation.block<3, 3>(0, 0), src, dst);
 }
 
 void Geometry3D::TranslatePoints(const Eigen::Vector3d& translation,
@@ -116,32 +175,59 @@ void Geometry3D::TranslatePoints(const Eigen::Vector3d& translation,
     if (!relative) {
         transform -= ComputeCenter(points);
     }
-    for (auto& point : points) {
-        point += transform;
-    }
+    Eigen::Vector3d* points_ptr = points.data();
+    utility::ParallelFor(
+            0, int64_t(points.size()),
+            [=](int64_t i) { points_ptr[i] += transform; },
+            kTransformGrainSize);
 }
 
 void Geometry3D::ScalePoints(const double scale,
                              std::vector<Eigen::Vector3d>& points,
                              const Eigen::Vector3d& center) const {
-    for (auto& point : points) {
-        point = (point - center) * scale + center;
-    }
+    const Eigen::Vector3d offset = center - scale * center;
+    Eigen::Vector3d* points_ptr = points.data();
+    utility::ParallelFor(
+            0, int64_t(points.size()),
+            [=](int64_t i) { points_ptr[i] = points_ptr[i] * scale + offset; },
+            kTransformGrainSize);
 }
 
 void Geometry3D::RotatePoints(const Eigen::Matrix3d& R,
                               std::vector<Eigen::Vector3d>& points,
                               const Eigen::Vector3d& center) const {
-    for (auto& point : points) {
-        point = R * (point - center) + center;
-    }
+    AffineTransformVectors(R, center - R * center, points, points);
 }
 
 void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
                                std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
-        normal = R * normal;
-    }
+    RotateNormals(R, normals, normals);
+}
+
+void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
+                               const std::vector<Eigen::Vector3d>& src,
+                               std::vector<Eigen::Vector3d>& dst) const {
+    AffineTransformVectors(R, Eigen::Vector3d::Zero(), src, dst);
+}
+
+void Geometry3D::RotateCovariances(
+        const Eigen::Matrix3d& R,
+        std::vector<Eigen::Matrix3d>& covariances) const {
+    RotateCovariances(R, covariances, covariances);
+}
+
+void Geometry3D::RotateCovariances(const Eigen::Matrix3d& R,
+                                   const std::vector<Eigen::Matrix3d>& src,
+                                   std::vector<Eigen::Matrix3d>& dst) const {
+    dst.resize(src.size());
+    const Eigen::Matrix3d Rt = R.transpose();
+    utility::ParallelFor(
+            0, int64_t(src.size()),
+            [&](int64_t i) {
+                const Eigen::Matrix3d covariance = src[i];
+                dst[i] = R * covariance * Rt;
+            },
+            kTransformGrainSize / 4);
 }
 
 Eigen::Matrix3d Geometry3D::GetRotationMatrixFromXYZ(
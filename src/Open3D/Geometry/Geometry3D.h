@@ -147,12 +147,25 @@ protected:
     void TransformPoints(const Eigen::Matrix4d& transformation,
                          std::vector<Eigen::Vector3d>& points) const;
 
+    /// \brief Writes the points of \p src transformed with the transformation
+    /// matrix to \p dst, which is resized. \p src and \p dst may be the same.
+    void TransformPoints(const Eigen::Matrix4d& transformation,
+                         const std::vector<Eigen::Vector3d>& src,
+                         std::vector<Eigen::Vector3d>& dst) const;
+
     /// \brief Transforms the normals with the transformation matrix.
     ///
     /// \param transformation 4x4 matrix for transformation.
     /// \param normals A list of normals to be transformed.
     void TransformNormals(const Eigen::Matrix4d& transformation,
                           std::vector<Eigen::Vector3d>& normals) const;
+
+    /// \brief Writes the normals of \p src transformed with the
+    /// transformation matrix to \p dst, which is resized.
+    void TransformNormals(const Eigen::Matrix4d& transformation,
+                          const std::vector<Eigen::Vector3d>& src,
+                          std::vector<Eigen::Vector3d>& dst) const;
+
     /// \brief Apply translation to the geometry coordinates.
     ///
     /// \param translation A 3D vector to transform the geometry.
@@ -190,6 +203,25 @@ protected:
     /// \param normals A list of normals to be transformed.
     void RotateNormals(const Eigen::Matrix3d& R,
                        std::vector<Eigen::Vector3d>& normals) const;
+
+    /// \brief Writes the normals of \p src rotated with \p R to \p dst,
+    /// which is resized.
+    void RotateNormals(const Eigen::Matrix3d& R,
+                       const std::vector<Eigen::Vector3d>& src,
+                       std::vector<Eigen::Vector3d>& dst) const;
+
+    /// \brief Rotate all covariance matrices with the rotation matrix \p R.
+    ///
+    /// \param R A 3x3 rotation matrix
+    /// \param covariances A list of covariance matrices to be transformed.
+    void RotateCovariances(const Eigen::Matrix3d& R,
+                           std::vector<Eigen::Matrix3d>& covariances) const;
+
+    /// \brief Writes the covariance matrices of \p src rotated with \p R to
+    /// \p dst, which is resized.
+    void RotateCovariances(const Eigen::Matrix3d& R,
+                           const std::vector<Eigen::Matrix3d>& src,
+                           std::vector<Eigen::Matrix3d>& dst) const;
 };
 
 }  // namespace geometry
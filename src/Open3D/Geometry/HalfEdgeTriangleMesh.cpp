@@ -27,14 +27,27 @@
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+constexpr int64_t kHalfEdgeGrainSize = 16384;
+
+/// Sort key of the half-edge from \p source to \p target.
+inline uint64_t HalfEdgeKey(int source, int target) {
+    return (uint64_t(uint32_t(source)) << 32) | uint32_t(target);
+}
+
+}  // unnamed namespace
+
 HalfEdgeTriangleMesh::HalfEdge::HalfEdge(const Eigen::Vector2i &vertex_indices,
                                          int triangle_index,
                                          int next,
@@ -163,7 +176,6 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->vertex_colors_ = mesh.vertex_colors_;
     mesh_cpy->triangles_ = mesh.triangles_;
     mesh_cpy->triangle_normals_ = mesh.triangle_normals_;
-    mesh_cpy->adjacency_list_ = mesh.adjacency_list_;
 
     // Purge to remove duplications
     mesh_cpy->RemoveDuplicatedVertices();
@@ -171,115 +183,139 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
-        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
-        }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
-    }
-
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
-        }
-    }
-
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    // Half-edges 3 * t, 3 * t + 1 and 3 * t + 2 go around triangle t.
+    const int64_t num_triangles = int64_t(mesh_cpy->triangles_.size());
+    const int64_t num_half_edges = 3 * num_triangles;
+    const int64_t num_vertices = int64_t(mesh_cpy->vertices_.size());
+    het_mesh->half_edges_.resize(num_half_edges);
+    utility::ParallelFor(
+            0, num_triangles,
+            [&](int64_t triangle_index) {
+                const Eigen::Vector3i &triangle =
+                        mesh_cpy->triangles_[triangle_index];
+                for (int k = 0; k < 3; k++) {
+                    const int64_t he_index = 3 * triangle_index + k;
+                    het_mesh->half_edges_[he_index] = HalfEdge(
+                            Eigen::Vector2i(triangle(k), triangle((k + 1) % 3)),
+                            int(triangle_index),
+                            int(3 * triangle_index + (k + 1) % 3), -1);
+                }
+            },
+            kHalfEdgeGrainSize);
+
+    // Sort the half-edges by (source vertex, target vertex). The half-edges
+    // from a vertex are then contiguous, and the twin of a half-edge is found
+    // by binary search instead of through a hash map.
+    std::vector<uint64_t> keys(num_half_edges);
+    std::vector<int64_t> order(num_half_edges);
+    utility::ParallelFor(
+            0, num_half_edges,
+            [&](int64_t he_index) {
+                const Eigen::Vector2i &vertex_indices =
+                        het_mesh->half_edges_[he_index].vertex_indices_;
+                keys[he_index] =
+                        HalfEdgeKey(vertex_indices(0), vertex_indices(1));
+                order[he_index] = he_index;
+            },
+            kHalfEdgeGrainSize);
+    utility::ParallelRadixSortPairs(keys, order, kHalfEdgeGrainSize);
+
+    // Check: for valid manifolds, there mustn't be duplicated half-edges.
+    // Each half-edge can then have at most one twin.
+    utility::ParallelFor(
+            0, num_half_edges,
+            [&](int64_t i) {
+                if (i + 1 < num_half_edges && keys[i] == keys[i + 1]) {
+                    utility::LogError(
+                            "ComputeHalfEdges failed. Duplicated half-edges.");
+                }
+                HalfEdge &this_he = het_mesh->half_edges_[order[i]];
+                const uint64_t twin_key =
+                        HalfEdgeKey(this_he.vertex_indices_(1),
+                                    this_he.vertex_indices_(0));
+                auto it = std::lower_bound(keys.begin(), keys.end(), twin_key);
+                if (it != keys.end() && *it == twin_key) {
+                    this_he.twin_ = int(order[it - keys.begin()]);
+                }
+            },
+            kHalfEdgeGrainSize);
+
+    // Out-going half-edges of vertex v are order[vertex_begins[v]] to
+    // order[vertex_begins[v + 1] - 1].
+    std::vector<int64_t> vertex_begins(num_vertices + 1, num_half_edges);
+    utility::ParallelFor(
+            0, num_half_edges,
+            [&](int64_t i) {
+                const int64_t vertex_index = int64_t(keys[i] >> 32);
+                if (i == 0 || vertex_index != int64_t(keys[i - 1] >> 32)) {
+                    vertex_begins[vertex_index] = i;
+                }
+            },
+            kHalfEdgeGrainSize);
+    // After purging, every vertex has out-going half-edges, but keep the
+    // ranges valid if it had none.
+    for (int64_t vertex_index = num_vertices - 1; vertex_index >= 0;
+         vertex_index--) {
+        vertex_begins[vertex_index] = std::min(vertex_begins[vertex_index],
+                                               vertex_begins[vertex_index + 1]);
     }
 
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
-         vertex_index++) {
-        size_t num_boundaries = 0;
-        int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
-            if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
-                num_boundaries++;
-                init_half_edge_index = half_edge_index;
-            }
-        }
-        if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
-        }
-        // If there is a boundary edge, start from that; otherwise start
-        // with any half-edge (default 0) started from this vertex.
-        if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
-        }
-
-        // Push edges to ordered_half_edge_from_vertex_.
-        int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
-        int next_next_twin_he_index =
-                het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
-        while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index =
-                    het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
-        }
+    het_mesh->ordered_half_edge_from_vertex_.resize(num_vertices);
+    utility::ParallelFor(
+            0, num_vertices,
+            [&](int64_t vertex_index) {
+                const int64_t begin = vertex_begins[vertex_index];
+                const int64_t end = vertex_begins[vertex_index + 1];
+                if (begin == end) {
+                    return;
+                }
+                size_t num_boundaries = 0;
+                int init_half_edge_index = int(num_half_edges);
+                int first_half_edge_index = int(num_half_edges);
+                for (int64_t i = begin; i < end; i++) {
+                    const int half_edge_index = int(order[i]);
+                    first_half_edge_index =
+                            std::min(first_half_edge_index, half_edge_index);
+                    if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
+                        num_boundaries++;
+                        init_half_edge_index = half_edge_index;
+                    }
+                }
+                if (num_boundaries > 1) {
+                    utility::LogError(
+                            "ComputeHalfEdges failed. Invalid vertex.");
+                }
+                // If there is a boundary edge, start from that; otherwise
+                // start with the first half-edge from this vertex.
+                if (num_boundaries == 0) {
+                    init_half_edge_index = first_half_edge_index;
+                }
+
+                // Push edges to ordered_half_edge_from_vertex_.
+                std::vector<int> &ordered_half_edges =
+                        het_mesh->ordered_half_edge_from_vertex_[vertex_index];
+                ordered_half_edges.reserve(end - begin);
+                int curr_he_index = init_half_edge_index;
+                ordered_half_edges.push_back(curr_he_index);
+                curr_he_index = het_mesh->NextHalfEdgeFromVertex(curr_he_index);
+                while (curr_he_index != -1 &&
+                       curr_he_index != init_half_edge_index) {
+                    ordered_half_edges.push_back(curr_he_index);
+                    curr_he_index =
+                            het_mesh->NextHalfEdgeFromVertex(curr_he_index);
+                }
+            },
+            kHalfEdgeGrainSize / 4);
+
+    // The purge functions keep the normals in sync with the vertices, so
+    // only compute them if the mesh has none.
+    if (!mesh_cpy->HasVertexNormals()) {
+        mesh_cpy->ComputeVertexNormals();
+    } else if (!mesh_cpy->HasTriangleNormals()) {
+        mesh_cpy->ComputeTriangleNormals();
     }
-
-    mesh_cpy->ComputeVertexNormals();
     het_mesh->vertices_ = mesh_cpy->vertices_;
     het_mesh->vertex_normals_ = mesh_cpy->vertex_normals_;
     het_mesh->vertex_colors_ = mesh_cpy->vertex_colors_;
@@ -232,5 +232,39 @@ public:
     std::vector<uint8_t> data_;
 };
 
+/// \class ImagePyramidBuilder
+///
+/// \brief Builds and filters pyramids of float images with reused buffers.
+///
+/// The levels of the output pyramid are written in place when they already
+/// exist and are not shared, so building pyramids of the same size frame after
+/// frame does not allocate. The results are the same as those of
+/// Image::CreatePyramid and Image::FilterPyramid.
+class ImagePyramidBuilder {
+public:
+    ImagePyramidBuilder() {}
+    ~ImagePyramidBuilder() {}
+
+public:
+    /// Creates a pyramid of \p num_of_levels levels of \p image in
+    /// \p pyramid, see Image::CreatePyramid.
+    void CreatePyramid(const Image &image,
+                       size_t num_of_levels,
+                       bool with_gaussian_filter,
+                       ImagePyramid &pyramid);
+
+    /// Filters every level of \p input into \p output, see
+    /// Image::FilterPyramid.
+    void FilterPyramid(const ImagePyramid &input,
+                       Image::FilterType type,
+                       ImagePyramid &output);
+
+private:
+    /// Result of the horizontal pass of the separable filters.
+    Image temp_;
+    /// Filtered level before downsampling.
+    Image filtered_;
+};
+
 }  // namespace geometry
 }  // namespace open3d
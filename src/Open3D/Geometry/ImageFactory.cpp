@@ -144,30 +144,9 @@ template std::shared_ptr<Image> Image::CreateImageFromFloatImage<uint16_t>()
 
 ImagePyramid Image::CreatePyramid(size_t num_of_levels,
                                   bool with_gaussian_filter /*= true*/) const {
-    std::vector<std::shared_ptr<Image>> pyramid_image;
-    pyramid_image.clear();
-    if ((num_of_channels_ != 1) || (bytes_per_channel_ != 4)) {
-        utility::LogError("[CreateImagePyramid] Unsupported image format.");
-    }
-
-    for (size_t i = 0; i < num_of_levels; i++) {
-        if (i == 0) {
-            std::shared_ptr<Image> input_copy_ptr = std::make_shared<Image>();
-            *input_copy_ptr = *this;
-            pyramid_image.push_back(input_copy_ptr);
-        } else {
-            if (with_gaussian_filter) {
-                // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = pyramid_image[i - 1]->Filter(
-                        Image::FilterType::Gaussian3);
-                auto level_bd = level_b->Downsample();
-                pyramid_image.push_back(level_bd);
-            } else {
-                auto level_d = pyramid_image[i - 1]->Downsample();
-                pyramid_image.push_back(level_d);
-            }
-        }
-    }
+    ImagePyramid pyramid_image;
+    ImagePyramidBuilder().CreatePyramid(*this, num_of_levels,
+                                        with_gaussian_filter, pyramid_image);
     return pyramid_image;
 }
 
@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+InstancedTriangleMesh &InstancedTriangleMesh::Clear() {
+    mesh_.reset();
+    instance_transforms_.clear();
+    instance_colors_.clear();
+    return *this;
+}
+
+bool InstancedTriangleMesh::IsEmpty() const { return !HasInstances(); }
+
+Eigen::Vector3d InstancedTriangleMesh::GetMinBound() const {
+    return ComputeMinBound(GetInstanceBoxCorners());
+}
+
+Eigen::Vector3d InstancedTriangleMesh::GetMaxBound() const {
+    return ComputeMaxBound(GetInstanceBoxCorners());
+}
+
+Eigen::Vector3d InstancedTriangleMesh::GetCenter() const {
+    if (!HasInstances()) {
+        return Eigen::Vector3d::Zero();
+    }
+    const Eigen::Vector4d center = mesh_->GetCenter().homogeneous();
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    for (const auto &transform : instance_transforms_) {
+        sum += (transform * center).head<3>();
+    }
+    return sum / double(instance_transforms_.size());
+}
+
+AxisAlignedBoundingBox InstancedTriangleMesh::GetAxisAlignedBoundingBox()
+        const {
+    return AxisAlignedBoundingBox::CreateFromPoints(GetInstanceBoxCorners());
+}
+
+OrientedBoundingBox InstancedTriangleMesh::GetOrientedBoundingBox() const {
+    return OrientedBoundingBox::CreateFromPoints(GetInstanceBoxCorners());
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::Transform(
+        const Eigen::Matrix4d &transformation) {
+    for (auto &transform : instance_transforms_) {
+        transform = transformation * transform;
+    }
+    return *this;
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::Translate(
+        const Eigen::Vector3d &translation, bool relative) {
+    Eigen::Vector3d offset = translation;
+    if (!relative) {
+        offset -= GetCenter();
+    }
+    for (auto &transform : instance_transforms_) {
+        transform.block<3, 1>(0, 3) += offset;
+    }
+    return *this;
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::Scale(
+        const double scale, const Eigen::Vector3d &center) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) *= scale;
+    transformation.block<3, 1>(0, 3) = (1.0 - scale) * center;
+    return Transform(transformation);
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::Rotate(
+        const Eigen::Matrix3d &R, const Eigen::Vector3d &center) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) = R;
+    transformation.block<3, 1>(0, 3) = center - R * center;
+    return Transform(transformation);
+}
+
+bool InstancedTriangleMesh::HasMesh() const {
+    return mesh_ && mesh_->HasTriangles();
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::AddInstance(
+        const Eigen::Matrix4d &transformation) {
+    instance_transforms_.push_back(transformation);
+    return *this;
+}
+
+InstancedTriangleMesh &InstancedTriangleMesh::AddInstance(
+        const Eigen::Matrix4d &transformation, const Eigen::Vector3d &color) {
+    instance_colors_.resize(instance_transforms_.size(),
+                            Eigen::Vector3d::Ones());
+    instance_transforms_.push_back(transformation);
+    instance_colors_.push_back(color);
+    return *this;
+}
+
+std::shared_ptr<TriangleMesh> InstancedTriangleMesh::CreateMergedMesh() const {
+    auto merged = std::make_shared<TriangleMesh>();
+    if (!HasInstances()) {
+        return merged;
+    }
+    const TriangleMesh &mesh = *mesh_;
+    const size_t num_instances = instance_transforms_.size();
+    const size_t num_vertices = mesh.vertices_.size();
+    const size_t num_triangles = mesh.triangles_.size();
+    const bool has_vertex_normals = mesh.HasVertexNormals();
+    const bool has_triangle_normals = mesh.HasTriangleNormals();
+    const bool has_instance_colors = HasInstanceColors();
+    const bool has_vertex_colors =
+            has_instance_colors || mesh.HasVertexColors();
+    const bool has_uvs = mesh.HasTriangleUvs();
+
+    merged->vertices_.resize(num_instances * num_vertices);
+    merged->triangles_.resize(num_instances * num_triangles);
+    if (has_vertex_normals) {
+        merged->vertex_normals_.resize(merged->vertices_.size());
+    }
+    if (has_triangle_normals) {
+        merged->triangle_normals_.resize(merged->triangles_.size());
+    }
+    if (has_vertex_colors) {
+        merged->vertex_colors_.resize(merged->vertices_.size());
+    }
+    if (has_uvs) {
+        merged->triangle_uvs_.resize(3 * merged->triangles_.size());
+        merged->textures_ = mesh.textures_;
+    }
+
+    utility::ParallelFor(0, int64_t(num_instances), [&](int64_t i) {
+        const Eigen::Matrix4d &transform = instance_transforms_[i];
+        const Eigen::Matrix3d R = transform.block<3, 3>(0, 0);
+        const Eigen::Vector3d t = transform.block<3, 1>(0, 3);
+        const Eigen::Matrix3d normal_matrix = R.inverse().transpose();
+        const size_t vertex_offset = i * num_vertices;
+        const size_t triangle_offset = i * num_triangles;
+        for (size_t v = 0; v < num_vertices; v++) {
+            merged->vertices_[vertex_offset + v] = R * mesh.vertices_[v] + t;
+            if (has_vertex_normals) {
+                merged->vertex_normals_[vertex_offset + v] =
+                        (normal_matrix * mesh.vertex_normals_[v]).normalized();
+            }
+            if (has_vertex_colors) {
+                merged->vertex_colors_[vertex_offset + v] =
+                        has_instance_colors ? instance_colors_[i]
+                                            : mesh.vertex_colors_[v];
+            }
+        }
+        const Eigen::Vector3i index_offset = Eigen::Vector3i::Constant(
+                static_cast<int>(vertex_offset));
+        for (size_t f = 0; f < num_triangles; f++) {
+            merged->triangles_[triangle_offset + f] =
+                    mesh.triangles_[f] + index_offset;
+            if (has_triangle_normals) {
+                merged->triangle_normals_[triangle_offset + f] =
+                        (normal_matrix * mesh.triangle_normals_[f])
+                                .normalized();
+            }
+        }
+        if (has_uvs) {
+            std::copy(mesh.triangle_uvs_.begin(), mesh.triangle_uvs_.end(),
+                      merged->triangle_uvs_.begin() + 3 * triangle_offset);
+        }
+    });
+    return merged;
+}
+
+std::vector<Eigen::Vector3d> InstancedTriangleMesh::GetInstanceBoxCorners()
+        const {
+    std::vector<Eigen::Vector3d> corners;
+    if (!HasInstances()) {
+        return corners;
+    }
+    const auto box_points = mesh_->GetAxisAlignedBoundingBox().GetBoxPoints();
+    corners.reserve(instance_transforms_.size() * box_points.size());
+    for (const auto &transform : instance_transforms_) {
+        for (const auto &point : box_points) {
+            corners.push_back((transform * point.homogeneous()).head<3>());
+        }
+    }
+    return corners;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry3D.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class InstancedTriangleMesh
+///
+/// \brief A triangle mesh drawn many times with a transform and optionally a
+/// color per instance, e.g. the camera frustums or coordinate frames of a
+/// trajectory. Renderers upload the mesh once and draw all instances
+/// together instead of handling thousands of separate geometries.
+class InstancedTriangleMesh : public Geometry3D {
+public:
+    /// \brief Default Constructor.
+    InstancedTriangleMesh()
+        : Geometry3D(Geometry::GeometryType::InstancedTriangleMesh) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The mesh shared by all instances.
+    explicit InstancedTriangleMesh(std::shared_ptr<TriangleMesh> mesh)
+        : Geometry3D(Geometry::GeometryType::InstancedTriangleMesh),
+          mesh_(std::move(mesh)) {}
+    ~InstancedTriangleMesh() override {}
+
+public:
+    InstancedTriangleMesh &Clear() override;
+    bool IsEmpty() const override;
+    Eigen::Vector3d GetMinBound() const override;
+    Eigen::Vector3d GetMaxBound() const override;
+    Eigen::Vector3d GetCenter() const override;
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
+    OrientedBoundingBox GetOrientedBoundingBox() const override;
+    /// Transforms all instances, the shared mesh is left unchanged.
+    InstancedTriangleMesh &Transform(
+            const Eigen::Matrix4d &transformation) override;
+    InstancedTriangleMesh &Translate(const Eigen::Vector3d &translation,
+                                     bool relative = true) override;
+    InstancedTriangleMesh &Scale(const double scale,
+                                 const Eigen::Vector3d &center) override;
+    InstancedTriangleMesh &Rotate(const Eigen::Matrix3d &R,
+                                  const Eigen::Vector3d &center) override;
+
+    /// Returns `true` if there is a mesh with triangles.
+    bool HasMesh() const;
+
+    /// Returns `true` if the mesh has at least one instance.
+    bool HasInstances() const {
+        return HasMesh() && instance_transforms_.size() > 0;
+    }
+
+    /// Returns `true` if every instance has a color.
+    bool HasInstanceColors() const {
+        return HasInstances() &&
+               instance_colors_.size() == instance_transforms_.size();
+    }
+
+    /// \brief Adds an instance placed by \p transformation.
+    InstancedTriangleMesh &AddInstance(const Eigen::Matrix4d &transformation);
+
+    /// \brief Adds an instance placed by \p transformation and drawn with
+    /// \p color instead of the vertex colors of the mesh.
+    InstancedTriangleMesh &AddInstance(const Eigen::Matrix4d &transformation,
+                                       const Eigen::Vector3d &color);
+
+    /// \brief Returns a single mesh with a transformed copy of the mesh for
+    /// each instance. Instance colors become vertex colors. Used by renderers
+    /// that cannot draw instances directly.
+    std::shared_ptr<TriangleMesh> CreateMergedMesh() const;
+
+private:
+    /// Corners of the bounding box of the mesh, placed by every instance.
+    std::vector<Eigen::Vector3d> GetInstanceBoxCorners() const;
+
+public:
+    /// The mesh drawn by every instance.
+    std::shared_ptr<TriangleMesh> mesh_;
+    /// Transform of each instance.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+            instance_transforms_;
+    /// Optional RGB color of each instance.
+    std::vector<Eigen::Vector3d> instance_colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -81,6 +81,9 @@ bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
 }
 
 bool KDTreeFlann::SetFeature(const registration::Feature &feature) {
+    if (feature.IsFloat()) {
+        return SetMatrixData(feature.data_float_.cast<double>());
+    }
     return SetMatrixData(feature.data_);
 }
 
@@ -92,16 +95,16 @@ int KDTreeFlann::Search(const T &query,
     switch (param.GetSearchType()) {
         case KDTreeSearchParam::SearchType::Knn:
             return SearchKNN(query, ((const KDTreeSearchParamKNN &)param).knn_,
-                             indices, distance2);
+                             indices, distance2, param.eps_);
         case KDTreeSearchParam::SearchType::Radius:
             return SearchRadius(
                     query, ((const KDTreeSearchParamRadius &)param).radius_,
-                    indices, distance2);
+                    indices, distance2, param.eps_, param.sorted_);
         case KDTreeSearchParam::SearchType::Hybrid:
             return SearchHybrid(
                     query, ((const KDTreeSearchParamHybrid &)param).radius_,
                     ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
-                    distance2);
+                    distance2, param.eps_, param.sorted_);
         default:
             return -1;
     }
@@ -112,12 +115,13 @@ template <typename T>
 int KDTreeFlann::SearchKNN(const T &query,
                            int knn,
                            std::vector<int> &indices,
-                           std::vector<double> &distance2) const {
+                           std::vector<double> &distance2,
+                           double eps /* = 0.0 */) const {
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
     if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+        size_t(query.rows()) != dimension_ || knn < 0 || eps < 0.0) {
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
@@ -126,7 +130,7 @@ int KDTreeFlann::SearchKNN(const T &query,
     flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
     flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
     int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
+                                    knn, flann::SearchParams(-1, float(eps)));
     indices.resize(k);
     distance2.resize(k);
     return k;
@@ -136,17 +140,19 @@ template <typename T>
 int KDTreeFlann::SearchRadius(const T &query,
                               double radius,
                               std::vector<int> &indices,
-                              std::vector<double> &distance2) const {
+                              std::vector<double> &distance2,
+                              double eps /* = 0.0 */,
+                              bool sorted /* = true */) const {
     // This is optimized code for heavily repeated search.
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
     if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_) {
+        size_t(query.rows()) != dimension_ || eps < 0.0) {
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(-1, float(eps), sorted);
     param.max_neighbors = -1;
     std::vector<std::vector<int>> indices_vec(1);
     std::vector<std::vector<double>> dists_vec(1);
@@ -162,17 +168,19 @@ int KDTreeFlann::SearchHybrid(const T &query,
                               double radius,
                               int max_nn,
                               std::vector<int> &indices,
-                              std::vector<double> &distance2) const {
+                              std::vector<double> &distance2,
+                              double eps /* = 0.0 */,
+                              bool sorted /* = true */) const {
     // This is optimized code for heavily repeated search.
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
     if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || max_nn < 0) {
+        size_t(query.rows()) != dimension_ || max_nn < 0 || eps < 0.0) {
         return -1;
     }
     flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
+    flann::SearchParams param(-1, float(eps), sorted);
     param.max_neighbors = max_nn;
     indices.resize(max_nn);
     distance2.resize(max_nn);
@@ -213,18 +221,23 @@ template int KDTreeFlann::SearchKNN<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         double radius,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps,
+        bool sorted) const;
 template int KDTreeFlann::SearchHybrid<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         double radius,
         int max_nn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps,
+        bool sorted) const;
 
 template int KDTreeFlann::Search<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
@@ -235,18 +248,23 @@ template int KDTreeFlann::SearchKNN<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         double radius,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps,
+        bool sorted) const;
 template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         double radius,
         int max_nn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps,
+        bool sorted) const;
 
 }  // namespace geometry
 }  // namespace open3d
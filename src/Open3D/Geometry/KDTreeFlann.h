@@ -84,30 +84,49 @@ public:
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const registration::Feature &feature);
 
+    /// \brief Searches the neighbors of \p query as described by \p param,
+    /// including its approximation settings.
     template <typename T>
     int Search(const T &query,
                const KDTreeSearchParam &param,
                std::vector<int> &indices,
                std::vector<double> &distance2) const;
 
+    /// \brief Searches the \p knn nearest neighbors of \p query.
+    ///
+    /// \param eps Approximation factor, see KDTreeSearchParam::eps_.
     template <typename T>
     int SearchKNN(const T &query,
                   int knn,
                   std::vector<int> &indices,
-                  std::vector<double> &distance2) const;
+                  std::vector<double> &distance2,
+                  double eps = 0.0) const;
 
+    /// \brief Searches all neighbors within \p radius of \p query.
+    ///
+    /// \param eps Approximation factor, see KDTreeSearchParam::eps_.
+    /// \param sorted If true, neighbors are sorted by increasing distance.
     template <typename T>
     int SearchRadius(const T &query,
                      double radius,
                      std::vector<int> &indices,
-                     std::vector<double> &distance2) const;
+                     std::vector<double> &distance2,
+                     double eps = 0.0,
+                     bool sorted = true) const;
 
+    /// \brief Searches at most \p max_nn neighbors within \p radius of
+    /// \p query.
+    ///
+    /// \param eps Approximation factor, see KDTreeSearchParam::eps_.
+    /// \param sorted If true, neighbors are sorted by increasing distance.
     template <typename T>
     int SearchHybrid(const T &query,
                      double radius,
                      int max_nn,
                      std::vector<int> &indices,
-                     std::vector<double> &distance2) const;
+                     std::vector<double> &distance2,
+                     double eps = 0.0,
+                     bool sorted = true) const;
 
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
@@ -0,0 +1,437 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#endif
+
+#include "Open3D/Geometry/KDTreeIndex.h"
+
+#include <flann/flann.hpp>
+#include <numeric>
+
+#include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+typedef flann::KDTreeSingleIndex<flann::L2<float>> FlannIndex;
+
+/// Minimum number of queries searched by one task.
+constexpr int64_t kQueryGrainSize = 64;
+
+/// FLANN switches from a sorted array to a heap above this many neighbors.
+constexpr int kKNNHeapThreshold = 250;
+
+/// Neighbors of a contiguous range of queries, concatenated.
+struct NeighborChunk {
+    std::vector<int> indices_;
+    std::vector<float> distance2_;
+};
+
+template <typename query_t>
+inline void CopyQuery(const query_t &queries,
+                      int64_t i,
+                      std::vector<float> &query) {
+    for (size_t d = 0; d < query.size(); d++) {
+        query[d] = static_cast<float>(queries(d, i));
+    }
+}
+
+template <typename result_set_t, typename query_t>
+void SearchKNNChunks(const FlannIndex &index,
+                     const query_t &queries,
+                     int k,
+                     const flann::SearchParams &param,
+                     std::vector<int> &indices,
+                     std::vector<float> &distance2) {
+    utility::ParallelReduce(
+            0, queries.cols(), 0,
+            [&](int64_t begin, int64_t end, int) {
+                result_set_t result_set(k);
+                std::vector<float> query(queries.rows());
+                std::vector<size_t> query_indices(k);
+                for (int64_t i = begin; i < end; i++) {
+                    CopyQuery(queries, i, query);
+                    result_set.clear();
+                    index.findNeighbors(result_set, query.data(), param);
+                    result_set.copy(query_indices.data(),
+                                    distance2.data() + i * k, k,
+                                    param.sorted);
+                    std::copy(query_indices.begin(), query_indices.end(),
+                              indices.begin() + i * k);
+                }
+                return 0;
+            },
+            [](int lhs, int rhs) { return lhs + rhs; }, kQueryGrainSize);
+}
+
+template <typename make_result_set_t, typename query_t>
+int64_t SearchToCSR(const FlannIndex &index,
+                    const query_t &queries,
+                    const make_result_set_t &make_result_set,
+                    const flann::SearchParams &param,
+                    std::vector<int> &indices,
+                    std::vector<float> &distance2,
+                    std::vector<int64_t> &offsets) {
+    const int64_t num_queries = queries.cols();
+    offsets.assign(num_queries + 1, 0);
+    // Chunks are concatenated in index order, so the output does not depend
+    // on the number of threads.
+    NeighborChunk neighbors = utility::ParallelReduce(
+            0, num_queries, NeighborChunk(),
+            [&](int64_t begin, int64_t end, NeighborChunk chunk) {
+                auto result_set = make_result_set();
+                std::vector<float> query(queries.rows());
+                std::vector<size_t> query_indices;
+                for (int64_t i = begin; i < end; i++) {
+                    CopyQuery(queries, i, query);
+                    result_set.clear();
+                    index.findNeighbors(result_set, query.data(), param);
+                    const size_t num_neighbors = result_set.size();
+                    offsets[i + 1] = static_cast<int64_t>(num_neighbors);
+                    if (num_neighbors == 0) {
+                        continue;
+                    }
+                    const size_t old_size = chunk.distance2_.size();
+                    query_indices.resize(num_neighbors);
+                    chunk.distance2_.resize(old_size + num_neighbors);
+                    result_set.copy(query_indices.data(),
+                                    chunk.distance2_.data() + old_size,
+                                    num_neighbors, param.sorted);
+                    chunk.indices_.insert(chunk.indices_.end(),
+                                          query_indices.begin(),
+                                          query_indices.end());
+                }
+                return chunk;
+            },
+            [](NeighborChunk lhs, const NeighborChunk &rhs) {
+                lhs.indices_.insert(lhs.indices_.end(), rhs.indices_.begin(),
+                                    rhs.indices_.end());
+                lhs.distance2_.insert(lhs.distance2_.end(),
+                                      rhs.distance2_.begin(),
+                                      rhs.distance2_.end());
+                return lhs;
+            },
+            kQueryGrainSize);
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    indices = std::move(neighbors.indices_);
+    distance2 = std::move(neighbors.distance2_);
+    return offsets.back();
+}
+
+}  // unnamed namespace
+
+KDTreeIndex::KDTreeIndex() {}
+
+KDTreeIndex::KDTreeIndex(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+
+KDTreeIndex::KDTreeIndex(const Geometry &geometry) { SetGeometry(geometry); }
+
+KDTreeIndex::KDTreeIndex(const registration::Feature &feature) {
+    SetFeature(feature);
+}
+
+KDTreeIndex::~KDTreeIndex() {}
+
+bool KDTreeIndex::SetMatrixData(const Eigen::MatrixXd &data) {
+    return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+            data.data(), data.rows(), data.cols()));
+}
+
+bool KDTreeIndex::SetMatrixData(const Eigen::MatrixXf &data) {
+    return SetRawData(Eigen::Map<const Eigen::MatrixXf>(
+            data.data(), data.rows(), data.cols()));
+}
+
+bool KDTreeIndex::SetGeometry(const Geometry &geometry) {
+    switch (geometry.GetGeometryType()) {
+        case Geometry::GeometryType::PointCloud:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+                    (const double *)((const PointCloud &)geometry)
+                            .points_.data(),
+                    3, ((const PointCloud &)geometry).points_.size()));
+        case Geometry::GeometryType::TriangleMesh:
+        case Geometry::GeometryType::HalfEdgeTriangleMesh:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXd>(
+                    (const double *)((const TriangleMesh &)geometry)
+                            .vertices_.data(),
+                    3, ((const TriangleMesh &)geometry).vertices_.size()));
+        case Geometry::GeometryType::Image:
+        case Geometry::GeometryType::Unspecified:
+        default:
+            utility::LogWarning(
+                    "[KDTreeIndex::SetGeometry] Unsupported Geometry type.");
+            return false;
+    }
+}
+
+bool KDTreeIndex::SetFeature(const registration::Feature &feature) {
+    if (feature.IsFloat()) {
+        return SetMatrixData(feature.data_float_);
+    }
+    return SetMatrixData(feature.data_);
+}
+
+bool KDTreeIndex::SetPoints(const std::vector<Eigen::Vector3f> &points) {
+    return SetRawData(Eigen::Map<const Eigen::MatrixXf>(
+            (const float *)points.data(), 3, points.size()));
+}
+
+int KDTreeIndex::SearchKNN(const Eigen::MatrixXd &queries,
+                           int knn,
+                           std::vector<int> &indices,
+                           std::vector<float> &distance2,
+                           double eps /* = 0.0 */) const {
+    return SearchKNNRaw(Eigen::Map<const Eigen::MatrixXd>(
+                                queries.data(), queries.rows(), queries.cols()),
+                        knn, indices, distance2, eps);
+}
+
+int KDTreeIndex::SearchKNN(const Eigen::MatrixXf &queries,
+                           int knn,
+                           std::vector<int> &indices,
+                           std::vector<float> &distance2,
+                           double eps /* = 0.0 */) const {
+    return SearchKNNRaw(Eigen::Map<const Eigen::MatrixXf>(
+                                queries.data(), queries.rows(), queries.cols()),
+                        knn, indices, distance2, eps);
+}
+
+int KDTreeIndex::SearchKNN(const std::vector<Eigen::Vector3d> &queries,
+                           int knn,
+                           std::vector<int> &indices,
+                           std::vector<float> &distance2,
+                           double eps /* = 0.0 */) const {
+    return SearchKNNRaw(Eigen::Map<const Eigen::MatrixXd>(
+                                (const double *)queries.data(), 3,
+                                queries.size()),
+                        knn, indices, distance2, eps);
+}
+
+int KDTreeIndex::SearchKNN(const std::vector<Eigen::Vector3f> &queries,
+                           int knn,
+                           std::vector<int> &indices,
+                           std::vector<float> &distance2,
+                           double eps /* = 0.0 */) const {
+    return SearchKNNRaw(Eigen::Map<const Eigen::MatrixXf>(
+                                (const float *)queries.data(), 3,
+                                queries.size()),
+                        knn, indices, distance2, eps);
+}
+
+int64_t KDTreeIndex::SearchRadius(const Eigen::MatrixXd &queries,
+                                  double radius,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            radius, -1, indices, distance2, offsets, eps, sorted);
+}
+
+int64_t KDTreeIndex::SearchRadius(const std::vector<Eigen::Vector3d> &queries,
+                                  double radius,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            radius, -1, indices, distance2, offsets, eps, sorted);
+}
+
+int64_t KDTreeIndex::SearchRadius(const std::vector<Eigen::Vector3f> &queries,
+                                  double radius,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXf>((const float *)queries.data(), 3,
+                                              queries.size()),
+            radius, -1, indices, distance2, offsets, eps, sorted);
+}
+
+int64_t KDTreeIndex::SearchHybrid(const Eigen::MatrixXd &queries,
+                                  double radius,
+                                  int max_nn,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    if (max_nn < 0) {
+        return -1;
+    }
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXd>(queries.data(), queries.rows(),
+                                              queries.cols()),
+            radius, max_nn, indices, distance2, offsets, eps, sorted);
+}
+
+int64_t KDTreeIndex::SearchHybrid(const std::vector<Eigen::Vector3d> &queries,
+                                  double radius,
+                                  int max_nn,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    if (max_nn < 0) {
+        return -1;
+    }
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXd>((const double *)queries.data(),
+                                              3, queries.size()),
+            radius, max_nn, indices, distance2, offsets, eps, sorted);
+}
+
+int64_t KDTreeIndex::SearchHybrid(const std::vector<Eigen::Vector3f> &queries,
+                                  double radius,
+                                  int max_nn,
+                                  std::vector<int> &indices,
+                                  std::vector<float> &distance2,
+                                  std::vector<int64_t> &offsets,
+                                  double eps /* = 0.0 */,
+                                  bool sorted /* = true */) const {
+    if (max_nn < 0) {
+        return -1;
+    }
+    return SearchHybridRaw(
+            Eigen::Map<const Eigen::MatrixXf>((const float *)queries.data(), 3,
+                                              queries.size()),
+            radius, max_nn, indices, distance2, offsets, eps, sorted);
+}
+
+template <typename scalar_t>
+bool KDTreeIndex::SetRawData(
+        const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                             Eigen::Dynamic>> &data) {
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning("[KDTreeIndex::SetRawData] Failed due to no data.");
+        return false;
+    }
+    data_.resize(dataset_size_ * dimension_);
+    const scalar_t *src = data.data();
+    utility::ParallelFor(
+            0, static_cast<int64_t>(data_.size()),
+            [&](int64_t i) { data_[i] = static_cast<float>(src[i]); }, 4096);
+    flann_dataset_.reset(new flann::Matrix<float>(data_.data(), dataset_size_,
+                                                  dimension_));
+    flann_index_.reset(new FlannIndex(*flann_dataset_,
+                                      flann::KDTreeSingleIndexParams(15)));
+    flann_index_->buildIndex();
+    return true;
+}
+
+template <typename scalar_t>
+int KDTreeIndex::SearchKNNRaw(
+        const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                             Eigen::Dynamic>> &queries,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<float> &distance2,
+        double eps) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0 || eps < 0.0) {
+        return -1;
+    }
+    const int k = static_cast<int>(std::min(size_t(knn), dataset_size_));
+    indices.resize(queries.cols() * k);
+    distance2.resize(queries.cols() * k);
+    if (k == 0 || queries.cols() == 0) {
+        return k;
+    }
+    const flann::SearchParams param(-1, float(eps));
+    if (k <= kKNNHeapThreshold) {
+        SearchKNNChunks<flann::KNNSimpleResultSet<float>>(
+                *flann_index_, queries, k, param, indices, distance2);
+    } else {
+        SearchKNNChunks<flann::KNNResultSet2<float>>(
+                *flann_index_, queries, k, param, indices, distance2);
+    }
+    return k;
+}
+
+template <typename scalar_t>
+int64_t KDTreeIndex::SearchHybridRaw(
+        const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                             Eigen::Dynamic>> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<float> &distance2,
+        std::vector<int64_t> &offsets,
+        double eps,
+        bool sorted) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || radius <= 0.0 || eps < 0.0) {
+        return -1;
+    }
+    const float radius2 = static_cast<float>(radius * radius);
+    const flann::SearchParams param(-1, float(eps), sorted);
+    if (max_nn < 0) {
+        return SearchToCSR(
+                *flann_index_, queries,
+                [radius2]() { return flann::RadiusResultSet<float>(radius2); },
+                param, indices, distance2, offsets);
+    }
+    if (max_nn == 0) {
+        indices.clear();
+        distance2.clear();
+        offsets.assign(queries.cols() + 1, 0);
+        return 0;
+    }
+    return SearchToCSR(*flann_index_, queries,
+                       [radius2, max_nn]() {
+                           return flann::KNNRadiusResultSet<float>(radius2,
+                                                                   max_nn);
+                       },
+                       param, indices, distance2, offsets);
+}
+
+}  // namespace geometry
+}  // namespace open3d
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,241 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry.h"
+#include "Open3D/Registration/Feature.h"
+
+namespace flann {
+template <typename T>
+class Matrix;
+template <typename T>
+struct L2;
+template <typename Distance>
+class KDTreeSingleIndex;
+}  // namespace flann
+
+namespace open3d {
+namespace geometry {
+
+/// \class KDTreeIndex
+///
+/// \brief Single precision KDTree for batched nearest neighbor search.
+///
+/// Unlike KDTreeFlann, which answers one query per call, KDTreeIndex answers a
+/// whole batch of queries at once. Queries are split into chunks that are
+/// searched in parallel, and results are returned in flat arrays. The dataset
+/// is stored in float32, which halves the memory footprint of the tree and
+/// speeds up distance evaluation.
+class KDTreeIndex {
+public:
+    /// \brief Default Constructor.
+    KDTreeIndex();
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param data Provides set of data points for KDTree construction, one
+    /// point per column.
+    KDTreeIndex(const Eigen::MatrixXd &data);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param geometry Provides geometry from which KDTree is constructed.
+    KDTreeIndex(const Geometry &geometry);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param feature Provides a set of features from which the KDTree is
+    /// constructed.
+    KDTreeIndex(const registration::Feature &feature);
+    ~KDTreeIndex();
+    KDTreeIndex(const KDTreeIndex &) = delete;
+    KDTreeIndex &operator=(const KDTreeIndex &) = delete;
+
+public:
+    /// Sets the data for the KDTree from a matrix.
+    ///
+    /// \param data Data points for KDTree Construction.
+    bool SetMatrixData(const Eigen::MatrixXd &data);
+    bool SetMatrixData(const Eigen::MatrixXf &data);
+    /// Sets the data for the KDTree from geometry.
+    ///
+    /// \param geometry Geometry for KDTree Construction.
+    bool SetGeometry(const Geometry &geometry);
+    /// Sets the data for the KDTree from the feature data, in either
+    /// precision.
+    ///
+    /// \param feature Set of features for KDTree construction.
+    bool SetFeature(const registration::Feature &feature);
+    /// Sets the data for the KDTree from single precision points, e.g. the
+    /// points of a CompactPointCloud, which are copied without conversion.
+    ///
+    /// \param points Points for KDTree construction.
+    bool SetPoints(const std::vector<Eigen::Vector3f> &points);
+
+    /// \brief Searches the k nearest neighbors of every query.
+    ///
+    /// \param queries Query points, one point per column.
+    /// \param knn Number of neighbors to search.
+    /// \param indices Output indices, row-major of shape (num_queries, k).
+    /// \param distance2 Output squared distances, same layout as \p indices.
+    /// \param eps Approximation factor, see KDTreeSearchParam::eps_.
+    /// \return The number of neighbors k = min(knn, dataset size) found for
+    /// each query, or -1 on invalid input.
+    int SearchKNN(const Eigen::MatrixXd &queries,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2,
+                  double eps = 0.0) const;
+    int SearchKNN(const Eigen::MatrixXf &queries,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2,
+                  double eps = 0.0) const;
+    int SearchKNN(const std::vector<Eigen::Vector3d> &queries,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2,
+                  double eps = 0.0) const;
+    int SearchKNN(const std::vector<Eigen::Vector3f> &queries,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2,
+                  double eps = 0.0) const;
+
+    /// \brief Searches all neighbors within \p radius of every query.
+    ///
+    /// Results are returned in compressed sparse row layout: the neighbors of
+    /// query i are indices[offsets[i]] to indices[offsets[i + 1] - 1], sorted
+    /// by increasing distance unless \p sorted is false.
+    ///
+    /// \param queries Query points, one point per column.
+    /// \param radius Search radius.
+    /// \param indices Output indices of all queries, concatenated.
+    /// \param distance2 Output squared distances, same layout as \p indices.
+    /// \param offsets Output offsets of size num_queries + 1.
+    /// \param eps Approximation factor, see KDTreeSearchParam::eps_.
+    /// \param sorted If false, the neighbors of a query are left unordered.
+    /// \return The total number of neighbors found, or -1 on invalid input.
+    int64_t SearchRadius(const Eigen::MatrixXd &queries,
+                         double radius,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+    int64_t SearchRadius(const std::vector<Eigen::Vector3d> &queries,
+                         double radius,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+    int64_t SearchRadius(const std::vector<Eigen::Vector3f> &queries,
+                         double radius,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+
+    /// \brief Searches at most \p max_nn neighbors within \p radius of every
+    /// query.
+    ///
+    /// Results use the same layout as SearchRadius().
+    ///
+    /// \return The total number of neighbors found, or -1 on invalid input.
+    int64_t SearchHybrid(const Eigen::MatrixXd &queries,
+                         double radius,
+                         int max_nn,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+    int64_t SearchHybrid(const std::vector<Eigen::Vector3d> &queries,
+                         double radius,
+                         int max_nn,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+    int64_t SearchHybrid(const std::vector<Eigen::Vector3f> &queries,
+                         double radius,
+                         int max_nn,
+                         std::vector<int> &indices,
+                         std::vector<float> &distance2,
+                         std::vector<int64_t> &offsets,
+                         double eps = 0.0,
+                         bool sorted = true) const;
+
+    /// Returns the number of points in the KDTree.
+    size_t GetDatasetSize() const { return dataset_size_; }
+    /// Returns the dimension of the points in the KDTree.
+    size_t GetDimension() const { return dimension_; }
+
+private:
+    /// \brief Sets the KDTree data from the data provided by the other methods.
+    ///
+    /// The data is converted to float32 in parallel before the tree is built,
+    /// or copied if it already is float32.
+    template <typename scalar_t>
+    bool SetRawData(
+            const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                                 Eigen::Dynamic>> &data);
+
+    template <typename scalar_t>
+    int SearchKNNRaw(
+            const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                                 Eigen::Dynamic>> &queries,
+            int knn,
+            std::vector<int> &indices,
+            std::vector<float> &distance2,
+            double eps) const;
+    template <typename scalar_t>
+    int64_t SearchHybridRaw(
+            const Eigen::Map<const Eigen::Matrix<scalar_t, Eigen::Dynamic,
+                                                 Eigen::Dynamic>> &queries,
+            double radius,
+            int max_nn,
+            std::vector<int> &indices,
+            std::vector<float> &distance2,
+            std::vector<int64_t> &offsets,
+            double eps,
+            bool sorted) const;
+
+protected:
+    std::vector<float> data_;
+    std::unique_ptr<flann::Matrix<float>> flann_dataset_;
+    std::unique_ptr<flann::KDTreeSingleIndex<flann::L2<float>>> flann_index_;
+    size_t dimension_ = 0;
+    size_t dataset_size_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
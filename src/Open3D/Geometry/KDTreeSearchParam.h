@@ -53,6 +53,15 @@ public:
     /// Get the search type (KNN, Radius, Hybrid) for the search parameter.
     SearchType GetSearchType() const { return search_type_; }
 
+public:
+    /// Approximation factor of the search. A returned neighbor is at most
+    /// (1 + eps) times farther than the true neighbor of the same rank, and
+    /// subtrees are pruned more aggressively as eps grows. 0 is exact search.
+    double eps_ = 0.0;
+    /// If false, neighbors are returned in arbitrary order, which skips
+    /// sorting large radius and hybrid search results.
+    bool sorted_ = true;
+
 private:
     SearchType search_type_;
 };
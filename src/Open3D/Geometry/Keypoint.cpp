@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Keypoint.h"
+
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <numeric>
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+namespace keypoint {
+
+namespace {
+
+// Average distance of the points to their nearest neighbor.
+double ComputeResolution(const PointCloud &input) {
+    std::vector<double> distances = input.ComputeNearestNeighborDistance();
+    return std::accumulate(distances.begin(), distances.end(), 0.0) /
+           double(distances.size());
+}
+
+// End offset in graph.indices_ of the neighbors of point i whose squared
+// distance is at most radius2.
+int64_t NeighborsEnd(const NeighborGraph &graph, size_t i, float radius2) {
+    auto begin = graph.distance2_.begin() + graph.offsets_[i];
+    auto end = graph.distance2_.begin() + graph.offsets_[i + 1];
+    return graph.offsets_[i] + (std::upper_bound(begin, end, radius2) - begin);
+}
+
+}  // namespace
+
+std::vector<size_t> ComputeISSKeypointIndices(const PointCloud &input,
+                                              const NeighborGraph &graph,
+                                              double salient_radius,
+                                              double non_max_radius,
+                                              double gamma_21 /* = 0.975 */,
+                                              double gamma_32 /* = 0.975 */,
+                                              int min_neighbors /* = 5 */) {
+    if (graph.NumPoints() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeISSKeypoints] The neighbor graph has {} points, but "
+                "the point cloud has {}.",
+                graph.NumPoints(), input.points_.size());
+    }
+    if (salient_radius <= 0 || non_max_radius <= 0) {
+        utility::LogError(
+                "[ComputeISSKeypoints] salient_radius and non_max_radius must "
+                "be positive.");
+    }
+    const std::vector<Eigen::Vector3d> &points = input.points_;
+    const int64_t n = int64_t(points.size());
+
+    // Smallest eigenvalue of the scatter matrix of the salient points, 0 for
+    // the other points.
+    std::vector<double> saliency(n, 0.0);
+    const float salient_radius2 = float(salient_radius * salient_radius);
+    utility::ParallelFor(0, n, [&](int64_t i) {
+        const int64_t begin = graph.offsets_[i];
+        const int64_t end = NeighborsEnd(graph, i, salient_radius2);
+        if (end == begin || end - begin < min_neighbors) {
+            return;
+        }
+        Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d sum_outer = Eigen::Matrix3d::Zero();
+        for (int64_t k = begin; k < end; k++) {
+            const Eigen::Vector3d p = points[graph.indices_[k]] - points[i];
+            sum += p;
+            sum_outer.noalias() += p * p.transpose();
+        }
+        const double inv_n = 1.0 / double(end - begin);
+        const Eigen::Vector3d mean = sum * inv_n;
+        const Eigen::Matrix3d covariance =
+                sum_outer * inv_n - mean * mean.transpose();
+
+        // Eigenvalues in increasing order, i.e. e3, e2, e1.
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+        solver.computeDirect(covariance, Eigen::EigenvaluesOnly);
+        const Eigen::Vector3d &e = solver.eigenvalues();
+        // e3 of planar neighborhoods is only rounding noise.
+        if (e(1) < gamma_21 * e(2) && e(0) < gamma_32 * e(1) &&
+            e(0) > 1e-12 * e(2)) {
+            saliency[i] = e(0);
+        }
+    });
+
+    // Non-maximum suppression, ties are resolved towards the smaller index.
+    const float non_max_radius2 = float(non_max_radius * non_max_radius);
+    return utility::ParallelSelectIndices(0, n, [&](int64_t i) {
+        const double s = saliency[i];
+        if (s <= 0) {
+            return false;
+        }
+        const int64_t end = NeighborsEnd(graph, i, non_max_radius2);
+        for (int64_t k = graph.offsets_[i]; k < end; k++) {
+            const int64_t j = graph.indices_[k];
+            if (saliency[j] > s || (saliency[j] == s && j < i)) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+std::vector<size_t> ComputeISSKeypointIndices(
+        const PointCloud &input,
+        double salient_radius /* = 0.0 */,
+        double non_max_radius /* = 0.0 */,
+        double gamma_21 /* = 0.975 */,
+        double gamma_32 /* = 0.975 */,
+        int min_neighbors /* = 5 */) {
+    if (!input.HasPoints()) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return {};
+    }
+    if (salient_radius == 0.0 || non_max_radius == 0.0) {
+        const double resolution = ComputeResolution(input);
+        if (salient_radius == 0.0) {
+            salient_radius = 6 * resolution;
+        }
+        if (non_max_radius == 0.0) {
+            non_max_radius = 4 * resolution;
+        }
+        utility::LogDebug(
+                "[ComputeISSKeypoints] Computed salient_radius = {}, "
+                "non_max_radius = {} from input.",
+                salient_radius, non_max_radius);
+    }
+    auto graph = NeighborGraph::CreateFromPointCloud(
+            input, KDTreeSearchParamRadius(
+                           std::max(salient_radius, non_max_radius)));
+    return ComputeISSKeypointIndices(input, *graph, salient_radius,
+                                     non_max_radius, gamma_21, gamma_32,
+                                     min_neighbors);
+}
+
+std::shared_ptr<PointCloud> ComputeISSKeypoints(
+        const PointCloud &input,
+        double salient_radius /* = 0.0 */,
+        double non_max_radius /* = 0.0 */,
+        double gamma_21 /* = 0.975 */,
+        double gamma_32 /* = 0.975 */,
+        int min_neighbors /* = 5 */) {
+    return input.SelectByIndex(ComputeISSKeypointIndices(
+            input, salient_radius, non_max_radius, gamma_21, gamma_32,
+            min_neighbors));
+}
+
+}  // namespace keypoint
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class NeighborGraph;
+class PointCloud;
+
+namespace keypoint {
+
+/// \brief Function to detect Intrinsic Shape Signatures (ISS) keypoints, Yu
+/// Zhong, "Intrinsic shape signatures: A shape descriptor for 3D object
+/// recognition", 2009.
+///
+/// A point is salient if the eigenvalues e1 >= e2 >= e3 of the scatter matrix
+/// of its neighbors within \p salient_radius satisfy e2 / e1 < \p gamma_21 and
+/// e3 / e2 < \p gamma_32. Salient points whose e3 is the largest among the
+/// salient points within \p non_max_radius are keypoints. The indices can be
+/// passed to registration::ComputeFPFHFeature to only describe the keypoints,
+/// with neighborhoods from the whole point cloud.
+///
+/// \param input The input point cloud.
+/// \param salient_radius Radius of the neighborhoods of the scatter matrices.
+/// If 0, 6 times the average nearest neighbor distance is used.
+/// \param non_max_radius Radius of the non-maximum suppression. If 0, 4 times
+/// the average nearest neighbor distance is used.
+/// \param gamma_21 Upper bound of the ratio of the second to the first
+/// eigenvalue.
+/// \param gamma_32 Upper bound of the ratio of the third to the second
+/// eigenvalue.
+/// \param min_neighbors Minimum number of neighbors of a keypoint within
+/// \p salient_radius.
+/// \return Indices of the keypoints in \p input, in increasing order.
+std::vector<size_t> ComputeISSKeypointIndices(const PointCloud &input,
+                                              double salient_radius = 0.0,
+                                              double non_max_radius = 0.0,
+                                              double gamma_21 = 0.975,
+                                              double gamma_32 = 0.975,
+                                              int min_neighbors = 5);
+
+/// \brief Same as above, but takes the neighborhoods from a precomputed
+/// neighbor graph, e.g. the one also used for normals and FPFH features.
+///
+/// \param graph Neighbor graph of \p input. It must contain all neighbors
+/// within max(\p salient_radius, \p non_max_radius), e.g. by being built with
+/// a KDTreeSearchParamRadius of at least that radius.
+std::vector<size_t> ComputeISSKeypointIndices(const PointCloud &input,
+                                              const NeighborGraph &graph,
+                                              double salient_radius,
+                                              double non_max_radius,
+                                              double gamma_21 = 0.975,
+                                              double gamma_32 = 0.975,
+                                              int min_neighbors = 5);
+
+/// \brief Function to detect ISS keypoints, see ComputeISSKeypointIndices().
+///
+/// \return The keypoints, with the normals and colors of \p input.
+std::shared_ptr<PointCloud> ComputeISSKeypoints(const PointCloud &input,
+                                                double salient_radius = 0.0,
+                                                double non_max_radius = 0.0,
+                                                double gamma_21 = 0.975,
+                                                double gamma_32 = 0.975,
+                                                int min_neighbors = 5);
+
+}  // namespace keypoint
+}  // namespace geometry
+}  // namespace open3d
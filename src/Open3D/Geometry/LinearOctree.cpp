@@ -0,0 +1,362 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <bitset>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int64_t kLinearOctreeGrainSize = 4096;
+
+// Code of the points that are not within bound. Valid codes have at most
+// 3 * LinearOctree::kMaxDepth = 63 bits.
+constexpr uint64_t kInvalidCode = ~uint64_t(0);
+
+// Morton code of the leaf the point is inserted to by Octree::InsertPoint.
+// The child index and the bound of each level are computed with the same
+// floating point operations as in Octree, so that points on cell boundaries
+// end up in the same leaf. The loop is branchless, as the comparisons are
+// unpredictable for scattered points.
+uint64_t ComputeLeafCode(const Eigen::Vector3d& point,
+                         const Eigen::Vector3d& origin,
+                         double size,
+                         size_t max_depth) {
+    if (!Octree::IsPointInBound(point, origin, size)) {
+        return kInvalidCode;
+    }
+    const Eigen::Array3d point_array = point;
+    Eigen::Array3d node_origin = origin;
+    double node_size = size;
+    bool in_bound = true;
+    uint64_t code = 0;
+    for (size_t depth = 0; depth < max_depth; ++depth) {
+        double child_size = node_size / 2.0;
+        Eigen::Array3d index =
+                (point_array >= node_origin + child_size).cast<double>();
+        node_origin += index * child_size;
+        in_bound &= (point_array < node_origin + child_size).all();
+        code = (code << 3) | uint64_t(index(0) + index(1) * 2 + index(2) * 4);
+        node_size = child_size;
+    }
+    return in_bound ? code : kInvalidCode;
+}
+
+// Node info of a child, computed as in Octree::Traverse.
+OctreeNodeInfo GetChildNodeInfo(const OctreeNodeInfo& node_info,
+                                size_t child_index) {
+    double child_size = node_info.size_ / 2.0;
+    size_t x_index = child_index % 2;
+    size_t y_index = (child_index / 2) % 2;
+    size_t z_index = (child_index / 4) % 2;
+    Eigen::Vector3d child_origin =
+            node_info.origin_ + Eigen::Vector3d(double(x_index),
+                                                double(y_index),
+                                                double(z_index)) *
+                                        child_size;
+    return OctreeNodeInfo(child_origin, child_size, node_info.depth_ + 1,
+                          child_index);
+}
+
+std::shared_ptr<OctreeNode> ConvertToOctreeNode(
+        const LinearOctree& linear_octree,
+        int64_t node_index,
+        const PointCloud& point_cloud) {
+    const LinearOctreeNode& node = linear_octree.nodes_[node_index];
+    if (node.depth_ == linear_octree.max_depth_) {
+        // Points are stably sorted, so the last point of the leaf is the one
+        // inserted last by Octree::ConvertFromPointCloud.
+        size_t last_index =
+                size_t(linear_octree.point_indices_[node.point_end_ - 1]);
+        if (last_index >= point_cloud.points_.size()) {
+            utility::LogError(
+                    "Point cloud does not match the LinearOctree: point {} "
+                    "does not exist.",
+                    last_index);
+        }
+        auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+        if (point_cloud.HasColors()) {
+            leaf_node->color_ = point_cloud.colors_[last_index];
+        }
+        return leaf_node;
+    }
+    auto internal_node = std::make_shared<OctreeInternalNode>();
+    for (size_t child_index = 0; child_index < 8; ++child_index) {
+        int64_t child = linear_octree.GetChild(node_index, child_index);
+        if (child >= 0) {
+            internal_node->children_[child_index] =
+                    ConvertToOctreeNode(linear_octree, child, point_cloud);
+        }
+    }
+    return internal_node;
+}
+
+}  // unnamed namespace
+
+constexpr size_t LinearOctree::kMaxDepth;
+
+LinearOctree::LinearOctree(size_t max_depth)
+    : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {
+    if (max_depth > kMaxDepth) {
+        utility::LogError("LinearOctree max_depth {} exceeds {}.", max_depth,
+                          kMaxDepth);
+    }
+}
+
+void LinearOctree::Clear() {
+    origin_.setZero();
+    size_ = 0;
+    nodes_.clear();
+    point_indices_.clear();
+    points_.clear();
+}
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud& point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("LinearOctree max_depth {} exceeds {}.", max_depth_,
+                          kMaxDepth);
+    }
+
+    // Set bounds
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    // Sort points by leaf. Points out of bound get the largest code and are
+    // dropped after sorting.
+    const int64_t num_points = int64_t(point_cloud.points_.size());
+    std::vector<uint64_t> codes(num_points);
+    point_indices_.resize(num_points);
+    utility::ParallelFor(
+            0, num_points,
+            [&](int64_t i) {
+                codes[i] = ComputeLeafCode(point_cloud.points_[i], origin_,
+                                           size_, max_depth_);
+                point_indices_[i] = i;
+            },
+            kLinearOctreeGrainSize);
+    utility::ParallelRadixSortPairs(codes, point_indices_,
+                                    kLinearOctreeGrainSize);
+    const int64_t num_valid = int64_t(
+            std::lower_bound(codes.begin(), codes.end(), kInvalidCode) -
+            codes.begin());
+    codes.resize(num_valid);
+    point_indices_.resize(num_valid);
+    points_.resize(num_valid);
+    utility::ParallelFor(
+            0, num_valid,
+            [&](int64_t i) {
+                points_[i] = point_cloud.points_[point_indices_[i]];
+            },
+            kLinearOctreeGrainSize);
+
+    // A node of depth d exists for every distinct code prefix of d child
+    // indices. A point starts new nodes from the shallowest depth where its
+    // prefix differs from the previous point, down to the leaf. The first
+    // pass counts the nodes of each depth, the second one writes them to
+    // their level, where they are sorted by code as the points are.
+    if (num_valid == 0) {
+        return;
+    }
+    const size_t max_depth = max_depth_;
+    auto first_new_depth = [&codes, max_depth](int64_t i) -> size_t {
+        if (i == 0) {
+            return 0;
+        }
+        const uint64_t diff = codes[i] ^ codes[i - 1];
+        if (diff == 0) {
+            return max_depth + 1;
+        }
+        size_t depth = max_depth;
+        while (depth > 0 && (diff >> 3 * (max_depth - depth + 1)) != 0) {
+            --depth;
+        }
+        return depth;
+    };
+    std::vector<int64_t> level_offsets(max_depth + 2, 0);
+    for (int64_t i = 0; i < num_valid; ++i) {
+        for (size_t depth = first_new_depth(i); depth <= max_depth; ++depth) {
+            level_offsets[depth + 1]++;
+        }
+    }
+    for (size_t depth = 0; depth <= max_depth; ++depth) {
+        level_offsets[depth + 1] += level_offsets[depth];
+    }
+    nodes_.resize(level_offsets.back());
+    std::vector<int64_t> level_ends(level_offsets.begin(),
+                                    level_offsets.end() - 1);
+    for (int64_t i = 0; i < num_valid; ++i) {
+        for (size_t depth = first_new_depth(i); depth <= max_depth; ++depth) {
+            const int64_t node_index = level_ends[depth]++;
+            LinearOctreeNode& node = nodes_[node_index];
+            node.code_ = codes[i] >> 3 * (max_depth - depth);
+            node.point_begin_ = i;
+            node.depth_ = uint32_t(depth);
+            if (depth > 0) {
+                LinearOctreeNode& parent = nodes_[level_ends[depth - 1] - 1];
+                if (parent.first_child_ < 0) {
+                    parent.first_child_ = node_index;
+                }
+                parent.children_mask_ |= uint8_t(1 << (node.code_ & 7));
+            }
+        }
+    }
+    // A node ends where the next node of its depth begins.
+    for (size_t depth = 0; depth <= max_depth; ++depth) {
+        for (int64_t n = level_offsets[depth]; n < level_offsets[depth + 1];
+             ++n) {
+            nodes_[n].point_end_ = n + 1 < level_offsets[depth + 1]
+                                           ? nodes_[n + 1].point_begin_
+                                           : num_valid;
+        }
+    }
+}
+
+int64_t LinearOctree::GetChild(int64_t node, size_t child_index) const {
+    const uint8_t mask = nodes_[node].children_mask_;
+    if (child_index >= 8 || !((mask >> child_index) & 1)) {
+        return -1;
+    }
+    const std::bitset<8> preceding(mask & ((1u << child_index) - 1));
+    return nodes_[node].first_child_ + int64_t(preceding.count());
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(int64_t node) const {
+    const LinearOctreeNode& target = nodes_[node];
+    OctreeNodeInfo node_info(origin_, size_, 0, 0);
+    for (uint32_t depth = 0; depth < target.depth_; ++depth) {
+        size_t shift = 3 * (target.depth_ - depth - 1);
+        node_info = GetChildNodeInfo(node_info, (target.code_ >> shift) & 7);
+    }
+    return node_info;
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (IsEmpty()) {
+        return -1;
+    }
+    uint64_t code = ComputeLeafCode(point, origin_, size_, max_depth_);
+    if (code == kInvalidCode) {
+        return -1;
+    }
+    int64_t node = 0;
+    for (size_t depth = 0; depth < max_depth_ && node >= 0; ++depth) {
+        size_t shift = 3 * (max_depth_ - depth - 1);
+        node = GetChild(node, (code >> shift) & 7);
+    }
+    return node;
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(int64_t, const OctreeNodeInfo&)>& f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    // root node's child index is 0, though it isn't a child node
+    std::vector<std::pair<int64_t, OctreeNodeInfo>> stack;
+    stack.emplace_back(0, OctreeNodeInfo(origin_, size_, 0, 0));
+    while (!stack.empty()) {
+        const int64_t node = stack.back().first;
+        const OctreeNodeInfo node_info = stack.back().second;
+        stack.pop_back();
+        if (f(node, node_info) || nodes_[node].IsLeaf()) {
+            continue;
+        }
+        // Push in reverse, so that children are visited in increasing order.
+        for (size_t child_index = 8; child_index-- > 0;) {
+            int64_t child = GetChild(node, child_index);
+            if (child >= 0) {
+                stack.emplace_back(child,
+                                   GetChildNodeInfo(node_info, child_index));
+            }
+        }
+    }
+}
+
+std::vector<size_t> LinearOctree::GetPointIndicesWithinBoundingBox(
+        const AxisAlignedBoundingBox& bbox) const {
+    const Eigen::Array3d min_bound = bbox.min_bound_;
+    const Eigen::Array3d max_bound = bbox.max_bound_;
+    std::vector<size_t> indices;
+    auto f_collect = [&](int64_t node, const OctreeNodeInfo& node_info) {
+        const Eigen::Array3d node_min = node_info.origin_;
+        const Eigen::Array3d node_max = node_min + node_info.size_;
+        if ((node_min > max_bound).any() || (node_max <= min_bound).any()) {
+            return true;
+        }
+        const LinearOctreeNode& target = nodes_[node];
+        const bool inside =
+                (node_min >= min_bound).all() && (node_max <= max_bound).all();
+        if (inside || target.IsLeaf()) {
+            for (int64_t i = target.point_begin_; i < target.point_end_; ++i) {
+                const Eigen::Array3d point = points_[i];
+                if (inside || ((point >= min_bound).all() &&
+                               (point <= max_bound).all())) {
+                    indices.push_back(size_t(point_indices_[i]));
+                }
+            }
+            return true;
+        }
+        return false;
+    };
+    Traverse(f_collect);
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree(
+        const PointCloud& point_cloud) const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (!IsEmpty()) {
+        octree->root_node_ = ConvertToOctreeNode(*this, 0, point_cloud);
+    }
+    return octree;
+}
+
+}  // namespace geometry
+}  // namespace open3d
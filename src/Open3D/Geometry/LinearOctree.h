@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Open3D/Geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class AxisAlignedBoundingBox;
+class PointCloud;
+
+/// \class LinearOctreeNode
+///
+/// \brief Node of a LinearOctree.
+///
+/// Nodes do not hold pointers. The children of an internal node are stored
+/// next to each other in LinearOctree::nodes_, ordered by child index, and
+/// the points of a node are a contiguous range of
+/// LinearOctree::point_indices_.
+class LinearOctreeNode {
+public:
+    /// Returns true if the node has no children, i.e. it is at max depth.
+    bool IsLeaf() const { return children_mask_ == 0; }
+
+public:
+    /// Morton code of the node: the child indices from the root down to the
+    /// node, 3 bits per level. The root has code 0.
+    uint64_t code_ = 0;
+    /// Index of the first child in LinearOctree::nodes_, or -1 for leaves.
+    int64_t first_child_ = -1;
+    /// Points of the node are point_indices_[point_begin_] to
+    /// point_indices_[point_end_ - 1].
+    int64_t point_begin_ = 0;
+    int64_t point_end_ = 0;
+    /// Depth of the node to the root. The root is of depth 0.
+    uint32_t depth_ = 0;
+    /// Bit i is set iff child i (see OctreeInternalNode) exists.
+    uint8_t children_mask_ = 0;
+};
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree for large point clouds.
+///
+/// The points are sorted by the Morton code of their leaf, so that every
+/// node covers a contiguous range of them. The nodes are stored level by
+/// level in a single array, each level sorted by Morton code. Building sorts
+/// the codes in parallel instead of inserting the points one by one, and
+/// needs a few tens of bytes per node instead of a heap allocation with eight
+/// child pointers. Nodes are located with the same comparisons as Octree, so
+/// ToOctree returns the same tree as Octree::ConvertFromPointCloud.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree. At
+    /// most kMaxDepth.
+    LinearOctree(size_t max_depth);
+    ~LinearOctree() {}
+
+public:
+    /// Deepest supported max depth, limited by the 64-bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+
+    /// \brief Build the octree from a point cloud.
+    ///
+    /// The bounds are computed as in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// Removes all nodes and points, keeping the max depth.
+    void Clear();
+
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// Returns the index of the child \p child_index (0~7) of node \p node,
+    /// or -1 if it does not exist.
+    int64_t GetChild(int64_t node, size_t child_index) const;
+
+    /// Returns the origin, size, depth and child index of node \p node.
+    OctreeNodeInfo GetNodeInfo(int64_t node) const;
+
+    /// \brief Returns the index of the leaf node where the query point
+    /// resides, or -1 if there is none.
+    ///
+    /// \param point Coordinates of the point.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// \brief DFS traversal of the octree from the root in the order of
+    /// Octree::Traverse.
+    ///
+    /// \param f Callback called with the node index and the node info of each
+    /// node. The children of a node are skipped if it returns true.
+    void Traverse(const std::function<bool(int64_t, const OctreeNodeInfo&)>& f)
+            const;
+
+    /// \brief Returns the indices of the input points within the bounding
+    /// box, in increasing order.
+    ///
+    /// Nodes inside the box are taken as a whole, and only the points of
+    /// leaves crossing the box boundary are tested.
+    ///
+    /// \param bbox Query box. Points on its boundary are within.
+    std::vector<size_t> GetPointIndicesWithinBoundingBox(
+            const AxisAlignedBoundingBox& bbox) const;
+
+    /// \brief Convert to a pointer-based Octree.
+    ///
+    /// \param point_cloud The point cloud the octree was built from. Each leaf
+    /// gets the color of its last point, as with
+    /// Octree::ConvertFromPointCloud. Leaves are black if the point cloud has
+    /// no colors.
+    std::shared_ptr<Octree> ToOctree(const PointCloud& point_cloud) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Max depth of octree. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+    /// Nodes ordered by depth and, within a depth, by Morton code. The root
+    /// is nodes_[0].
+    std::vector<LinearOctreeNode> nodes_;
+
+    /// Indices of the input points within bound, sorted by leaf.
+    std::vector<int64_t> point_indices_;
+
+    /// Coordinates of the points, in the order of point_indices_.
+    std::vector<Eigen::Vector3d> points_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -26,10 +26,10 @@
 
 #include "Open3D/Geometry/MeshBase.h"
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/ConvexHull.h"
 #include "Open3D/Geometry/IntersectionTest.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
-#include "Open3D/Geometry/Qhull.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
@@ -125,7 +125,7 @@ MeshBase MeshBase::operator+(const MeshBase &mesh) const {
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 MeshBase::ComputeConvexHull() const {
-    return Qhull::ComputeConvexHull(vertices_);
+    return ConvexHull::ComputeConvexHull(vertices_);
 }
 
 }  // namespace geometry
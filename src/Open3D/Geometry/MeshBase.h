@@ -60,6 +60,28 @@ public:
     /// using Quadric Error Metrics" by Garland and Heckbert.
     enum class SimplificationContraction { Average, Quadric };
 
+    /// \brief Indicates the implementation of the quadric decimation.
+    ///
+    /// \param Sequential collapses one edge at a time in order of increasing
+    /// cost.
+    /// \param Parallel stores the mesh in flat arrays with an indexed heap of
+    /// the edge costs. It splits the mesh into spatial partitions that are
+    /// decimated in parallel, where the edges at the partition borders are
+    /// locked, and collapses the remaining edges sequentially. The cost order
+    /// is thus only followed within each partition.
+    enum class QuadricDecimationMethod { Sequential, Parallel };
+
+    /// \brief Indicates the implementation of the Poisson disk sampling.
+    ///
+    /// \param SampleElimination eliminates the initial samples with the
+    /// largest weights one at a time, cf. Yuksel, "Sample Elimination for
+    /// Generating Poisson Disk Sample Sets", 2015.
+    /// \param ParallelGrid accepts the initial samples that keep a minimum
+    /// distance to the accepted ones, in parallel over the voxels of a grid
+    /// that are 3 voxels apart. The distance is decreased until enough samples
+    /// are accepted.
+    enum class PoissonDiskSamplingMethod { SampleElimination, ParallelGrid };
+
     /// \brief Indicates the scope of filter operations.
     ///
     /// \param All indicates that all properties (color, normal,
@@ -75,6 +97,18 @@ public:
     /// \param Smoothed adds a rotation smoothing term to the rotations.
     enum class DeformAsRigidAsPossibleEnergy { Spokes, Smoothed };
 
+    /// \brief Indicates how the triangles around a vertex contribute to its
+    /// normal.
+    ///
+    /// \param TriangleNormals sums the stored triangle normals, which are
+    /// computed unnormalized, i.e. area weighted, if the mesh has none.
+    /// \param Uniform sums the unit normals of the triangles.
+    /// \param Area weights the triangle normals by the triangle areas.
+    /// \param Angle weights the unit triangle normals by the interior angles
+    /// of the triangles at the vertex, cf. Thurmer and Wuthrich, "Computing
+    /// Vertex Normals from Polygonal Facets", 1998.
+    enum class VertexNormalWeighting { TriangleNormals, Uniform, Area, Angle };
+
     /// \brief Default Constructor.
     MeshBase() : Geometry3D(Geometry::GeometryType::MeshBase) {}
     ~MeshBase() override {}
@@ -132,7 +166,8 @@ public:
         return *this;
     }
 
-    /// Function that computes the convex hull of the triangle mesh using qhull
+    /// Function that computes the convex hull of the triangle mesh, see
+    /// ConvexHull
     std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
     ComputeConvexHull() const;
 
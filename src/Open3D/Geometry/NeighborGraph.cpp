@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+
+#include "Open3D/Geometry/KDTreeIndex.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+template <typename vector_t>
+std::shared_ptr<NeighborGraph> SearchNeighbors(
+        const KDTreeIndex &index,
+        const std::vector<vector_t> &queries,
+        const KDTreeSearchParam &search_param) {
+    auto graph = std::make_shared<NeighborGraph>();
+    const int64_t num_queries = int64_t(queries.size());
+    if (num_queries == 0) {
+        graph->offsets_.assign(1, 0);
+        return graph;
+    }
+
+    int64_t num_edges = -1;
+    if (search_param.GetSearchType() == KDTreeSearchParam::SearchType::Knn) {
+        const auto &param = (const KDTreeSearchParamKNN &)search_param;
+        const int k = index.SearchKNN(queries, param.knn_, graph->indices_,
+                                      graph->distance2_, param.eps_);
+        if (k >= 0) {
+            graph->offsets_.resize(num_queries + 1);
+            utility::ParallelFor(0, num_queries + 1, [&](int64_t i) {
+                graph->offsets_[i] = i * k;
+            });
+            num_edges = num_queries * k;
+        }
+    } else if (search_param.GetSearchType() ==
+               KDTreeSearchParam::SearchType::Radius) {
+        const auto &param = (const KDTreeSearchParamRadius &)search_param;
+        num_edges = index.SearchRadius(queries, param.radius_, graph->indices_,
+                                       graph->distance2_, graph->offsets_,
+                                       param.eps_, param.sorted_);
+    } else if (search_param.GetSearchType() ==
+               KDTreeSearchParam::SearchType::Hybrid) {
+        const auto &param = (const KDTreeSearchParamHybrid &)search_param;
+        num_edges = index.SearchHybrid(queries, param.radius_, param.max_nn_,
+                                       graph->indices_, graph->distance2_,
+                                       graph->offsets_, param.eps_,
+                                       param.sorted_);
+    }
+    if (num_edges < 0) {
+        utility::LogError(
+                "[NeighborGraph::CreateFromQueries] Invalid search "
+                "parameters.");
+    }
+    return graph;
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<NeighborGraph> NeighborGraph::CreateFromPointCloud(
+        const PointCloud &cloud,
+        const KDTreeSearchParam
+                &search_param /* = KDTreeSearchParamKNN()*/) {
+    if (cloud.points_.empty()) {
+        auto graph = std::make_shared<NeighborGraph>();
+        graph->offsets_.assign(1, 0);
+        return graph;
+    }
+    KDTreeIndex index(cloud);
+    return CreateFromQueries(index, cloud.points_, search_param);
+}
+
+std::shared_ptr<NeighborGraph> NeighborGraph::CreateFromQueries(
+        const KDTreeIndex &index,
+        const std::vector<Eigen::Vector3d> &queries,
+        const KDTreeSearchParam
+                &search_param /* = KDTreeSearchParamKNN()*/) {
+    return SearchNeighbors(index, queries, search_param);
+}
+
+std::shared_ptr<NeighborGraph> NeighborGraph::CreateFromQueries(
+        const KDTreeIndex &index,
+        const std::vector<Eigen::Vector3f> &queries,
+        const KDTreeSearchParam
+                &search_param /* = KDTreeSearchParamKNN()*/) {
+    return SearchNeighbors(index, queries, search_param);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class KDTreeIndex;
+class PointCloud;
+
+/// \class NeighborGraph
+///
+/// \brief Neighborhoods of all points of a point cloud, stored in compressed
+/// sparse row layout.
+///
+/// The neighbors of point i are indices_[offsets_[i]] to
+/// indices_[offsets_[i + 1] - 1], sorted by increasing distance unless the
+/// search parameters disable sorting. As every point is part of its own
+/// neighborhood, the first neighbor of a sorted neighborhood is usually the
+/// point itself. A graph is built once with batched KDTree
+/// queries and can then be passed to PointCloud::EstimateNormals,
+/// PointCloud::OrientNormalsConsistentTangentPlane,
+/// PointCloud::RemoveRadiusOutliers, PointCloud::RemoveStatisticalOutliers and
+/// registration::ComputeFPFHFeature, which avoids searching the same
+/// neighborhoods again in each of them.
+class NeighborGraph {
+public:
+    /// \brief Default Constructor.
+    NeighborGraph() {}
+    ~NeighborGraph() {}
+
+public:
+    /// Returns number of points in the graph.
+    size_t NumPoints() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the total number of neighbors of all points.
+    size_t NumEdges() const { return indices_.size(); }
+    /// Returns the number of neighbors of point \p i.
+    int64_t NumNeighbors(size_t i) const {
+        return offsets_[i + 1] - offsets_[i];
+    }
+
+    /// \brief Factory function to build the neighbor graph of a point cloud.
+    ///
+    /// The neighbors are searched in a single precision KDTree, so points
+    /// whose distance is within float rounding of the search radius may be
+    /// classified differently than with KDTreeFlann.
+    ///
+    /// \param cloud The input point cloud.
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    static std::shared_ptr<NeighborGraph> CreateFromPointCloud(
+            const PointCloud &cloud,
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
+
+    /// \brief Factory function to build the neighborhoods of arbitrary query
+    /// points.
+    ///
+    /// Point i of the returned graph is \p queries[i], and its neighbors
+    /// index the dataset of \p index.
+    ///
+    /// \param index KDTreeIndex of the points to search.
+    /// \param queries The query points.
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    static std::shared_ptr<NeighborGraph> CreateFromQueries(
+            const KDTreeIndex &index,
+            const std::vector<Eigen::Vector3d> &queries,
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
+    static std::shared_ptr<NeighborGraph> CreateFromQueries(
+            const KDTreeIndex &index,
+            const std::vector<Eigen::Vector3f> &queries,
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
+
+public:
+    /// Neighbor indices of all points, concatenated.
+    std::vector<int> indices_;
+    /// Squared distances to the neighbors, same layout as indices_.
+    std::vector<float> distance2_;
+    /// Offsets of the neighborhoods in indices_, of size NumPoints() + 1.
+    std::vector<int64_t> offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
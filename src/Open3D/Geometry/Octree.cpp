@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <unordered_map>
 
+#include "Open3D/Geometry/LinearOctree.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Utility/Console.h"
@@ -396,6 +397,18 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
         utility::LogError("size_expand shall be between 0 and 1");
     }
 
+    // Build in bulk and convert, unless the Morton codes cannot hold the
+    // depth.
+    if (max_depth_ <= LinearOctree::kMaxDepth) {
+        LinearOctree linear_octree(max_depth_);
+        linear_octree.ConvertFromPointCloud(point_cloud, size_expand);
+        auto octree = linear_octree.ToOctree(point_cloud);
+        root_node_ = octree->root_node_;
+        origin_ = octree->origin_;
+        size_ = octree->size_;
+        return;
+    }
+
     // Set bounds
     Clear();
     Eigen::Array3d min_bound = point_cloud.GetMinBound();
@@ -411,11 +424,13 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
     }
 
     // Insert points
+    const Eigen::Vector3d black(0, 0, 0);
     for (size_t idx = 0; idx < point_cloud.points_.size(); idx++) {
         InsertPoint(point_cloud.points_[idx],
                     geometry::OctreeColorLeafNode::GetInitFunction(),
                     geometry::OctreeColorLeafNode::GetUpdateFunction(
-                            point_cloud.colors_[idx]));
+                            point_cloud.HasColors() ? point_cloud.colors_[idx]
+                                                    : black));
     }
 }
 
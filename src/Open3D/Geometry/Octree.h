@@ -229,6 +229,10 @@ public:
 public:
     /// \brief Convert octree from point cloud.
     ///
+    /// The points are sorted into a LinearOctree in bulk, which is then
+    /// converted, instead of being inserted one by one. Each leaf gets the
+    /// color of its last point.
+    ///
     /// \param point_cloud Input point cloud.
     /// \param size_expand A small expansion size such that the octree is
     /// slightly bigger than the original point cloud bounds to accomodate all
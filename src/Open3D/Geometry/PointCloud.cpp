@@ -29,11 +29,19 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
 #include <numeric>
+#include <tuple>
 
+#include "Open3D/Geometry/ConvexHull.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
-#include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/KDTreeIndex.h"
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/VoxelGroups.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -42,6 +50,7 @@ PointCloud &PointCloud::Clear() {
     points_.clear();
     normals_.clear();
     colors_.clear();
+    covariances_.clear();
     return *this;
 }
 
@@ -68,9 +77,23 @@ OrientedBoundingBox PointCloud::GetOrientedBoundingBox() const {
 PointCloud &PointCloud::Transform(const Eigen::Matrix4d &transformation) {
     TransformPoints(transformation, points_);
     TransformNormals(transformation, normals_);
+    RotateCovariances(transformation.block<3, 3>(0, 0), covariances_);
     return *this;
 }
 
+PointCloud &PointCloud::TransformInto(const Eigen::Matrix4d &transformation,
+                                      PointCloud &dst) const {
+    if (&dst == this) {
+        return dst.Transform(transformation);
+    }
+    TransformPoints(transformation, points_, dst.points_);
+    TransformNormals(transformation, normals_, dst.normals_);
+    RotateCovariances(transformation.block<3, 3>(0, 0), covariances_,
+                      dst.covariances_);
+    dst.colors_ = colors_;
+    return dst;
+}
+
 PointCloud &PointCloud::Translate(const Eigen::Vector3d &translation,
                                   bool relative) {
     TranslatePoints(translation, points_, relative);
@@ -87,6 +110,7 @@ PointCloud &PointCloud::Rotate(const Eigen::Matrix3d &R,
                                const Eigen::Vector3d &center) {
     RotatePoints(R, points_, center);
     RotateNormals(R, normals_);
+    RotateCovariances(R, covariances_);
     return *this;
 }
 
@@ -111,36 +135,130 @@ PointCloud &PointCloud::operator+=(const PointCloud &cloud) {
     } else {
         colors_.clear();
     }
+    if ((!HasPoints() || HasCovariances()) && cloud.HasCovariances()) {
+        covariances_.resize(new_vert_num);
+        for (size_t i = 0; i < add_vert_num; i++)
+            covariances_[old_vert_num + i] = cloud.covariances_[i];
+    } else {
+        covariances_.clear();
+    }
     points_.resize(new_vert_num);
     for (size_t i = 0; i < add_vert_num; i++)
         points_[old_vert_num + i] = cloud.points_[i];
     return (*this);
 }
 
+namespace {
+
+// Points per task when gathering the attributes of selected points.
+constexpr int64_t kSelectGrainSize = 8192;
+
+// Returns the first head_size elements of head followed by tail, allocated
+// once at their final size.
+template <typename T, typename A>
+std::vector<T, A> Concatenate(const std::vector<T, A> &head,
+                              size_t head_size,
+                              const std::vector<T, A> &tail) {
+    std::vector<T, A> result;
+    result.reserve(head_size + tail.size());
+    result.insert(result.end(), head.begin(), head.begin() + head_size);
+    result.insert(result.end(), tail.begin(), tail.end());
+    return result;
+}
+
+}  // namespace
+
 PointCloud PointCloud::operator+(const PointCloud &cloud) const {
-    return (PointCloud(*this) += cloud);
+    if (cloud.IsEmpty()) return *this;
+    // Same as PointCloud(*this) += cloud, but every attribute is copied once
+    // instead of being copied and then grown.
+    PointCloud sum;
+    const size_t num_points = points_.size();
+    sum.points_ = Concatenate(points_, num_points, cloud.points_);
+    if ((!HasPoints() || HasNormals()) && cloud.HasNormals()) {
+        sum.normals_ = Concatenate(normals_, num_points, cloud.normals_);
+    }
+    if ((!HasPoints() || HasColors()) && cloud.HasColors()) {
+        sum.colors_ = Concatenate(colors_, num_points, cloud.colors_);
+    }
+    if ((!HasPoints() || HasCovariances()) && cloud.HasCovariances()) {
+        sum.covariances_ =
+                Concatenate(covariances_, num_points, cloud.covariances_);
+    }
+    return sum;
 }
 
 std::vector<double> PointCloud::ComputePointCloudDistance(
-        const PointCloud &target) {
+        const PointCloud &target) const {
+    std::vector<double> distances(points_.size(), 0.0);
+    if (points_.empty()) {
+        return distances;
+    }
+    if (target.points_.empty()) {
+        utility::LogDebug(
+                "[ComputePointCloudToPointCloudDistance] Found a point "
+                "without neighbors.");
+        return distances;
+    }
+    KDTreeIndex index(target);
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    index.SearchKNN(points_, 1, indices, distance2);
+    // The tree is searched in single precision, the distances to the nearest
+    // neighbors are evaluated in double precision.
+    utility::ParallelFor(
+            0, int64_t(points_.size()),
+            [&](int64_t i) {
+                if (indices[i] >= 0) {
+                    distances[i] =
+                            (points_[i] - target.points_[indices[i]]).norm();
+                }
+            },
+            4096);
+    return distances;
+}
+
+double PointCloud::ComputeChamferDistance(const PointCloud &target) const {
+    if (points_.empty() || target.points_.empty()) {
+        return points_.empty() && target.points_.empty()
+                       ? 0.0
+                       : std::numeric_limits<double>::infinity();
+    }
+    auto Mean = [](const std::vector<double> &distances) {
+        return std::accumulate(distances.begin(), distances.end(), 0.0) /
+               double(distances.size());
+    };
+    return Mean(ComputePointCloudDistance(target)) +
+           Mean(target.ComputePointCloudDistance(*this));
+}
+
+double PointCloud::ComputeHausdorffDistance(const PointCloud &target) const {
+    if (points_.empty() || target.points_.empty()) {
+        return points_.empty() && target.points_.empty()
+                       ? 0.0
+                       : std::numeric_limits<double>::infinity();
+    }
+    auto Max = [](const std::vector<double> &distances) {
+        return *std::max_element(distances.begin(), distances.end());
+    };
+    return std::max(Max(ComputePointCloudDistance(target)),
+                    Max(target.ComputePointCloudDistance(*this)));
+}
+
+std::vector<double> PointCloud::ComputeDistanceToMesh(
+        const TriangleMesh &mesh) const {
+    return ComputeDistanceToMesh(TriangleMeshBVH(mesh));
+}
+
+std::vector<double> PointCloud::ComputeDistanceToMesh(
+        const TriangleMeshBVH &bvh) const {
+    std::vector<TriangleMeshBVH::ClosestPoint> closest =
+            bvh.ComputeClosestPoints(points_);
     std::vector<double> distances(points_.size());
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
-            utility::LogDebug(
-                    "[ComputePointCloudToPointCloudDistance] Found a point "
-                    "without neighbors.");
-            distances[i] = 0.0;
-        } else {
-            distances[i] = std::sqrt(dists[0]);
-        }
-    }
+    utility::ParallelFor(
+            0, int64_t(points_.size()),
+            [&](int64_t i) { distances[i] = std::sqrt(closest[i].distance2_); },
+            4096);
     return distances;
 }
 
@@ -148,6 +266,7 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
                                               bool remove_infinite) {
     bool has_normal = HasNormals();
     bool has_color = HasColors();
+    bool has_covariance = HasCovariances();
     size_t old_point_num = points_.size();
     size_t k = 0;                                 // new index
     for (size_t i = 0; i < old_point_num; i++) {  // old index
@@ -161,12 +280,14 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
             points_[k] = points_[i];
             if (has_normal) normals_[k] = normals_[i];
             if (has_color) colors_[k] = colors_[i];
+            if (has_covariance) covariances_[k] = covariances_[i];
             k++;
         }
     }
     points_.resize(k);
     if (has_normal) normals_.resize(k);
     if (has_color) colors_.resize(k);
+    if (has_covariance) covariances_.resize(k);
     utility::LogDebug(
             "[RemoveNonFinitePoints] {:d} nan points have been removed.",
             (int)(old_point_num - k));
@@ -178,168 +299,133 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
     auto output = std::make_shared<PointCloud>();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
+    bool has_covariances = HasCovariances();
 
     std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
     for (size_t i : indices) {
         mask[i] = !invert;
     }
 
+    // The attributes are allocated at their final size and gathered in
+    // parallel, instead of growing them point by point.
+    std::vector<size_t> selected;
+    selected.reserve(std::count(mask.begin(), mask.end(), true));
     for (size_t i = 0; i < points_.size(); i++) {
         if (mask[i]) {
-            output->points_.push_back(points_[i]);
-            if (has_normals) output->normals_.push_back(normals_[i]);
-            if (has_colors) output->colors_.push_back(colors_[i]);
+            selected.push_back(i);
         }
     }
+    output->points_.resize(selected.size());
+    if (has_normals) output->normals_.resize(selected.size());
+    if (has_colors) output->colors_.resize(selected.size());
+    if (has_covariances) output->covariances_.resize(selected.size());
+    utility::ParallelFor(
+            0, int64_t(selected.size()),
+            [&](int64_t i) {
+                const size_t pidx = selected[i];
+                output->points_[i] = points_[pidx];
+                if (has_normals) output->normals_[i] = normals_[pidx];
+                if (has_colors) output->colors_[i] = colors_[pidx];
+                if (has_covariances) {
+                    output->covariances_[i] = covariances_[pidx];
+                }
+            },
+            kSelectGrainSize);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
     return output;
 }
 
-// helper classes for VoxelDownSample and VoxelDownSampleAndTrace
+// helpers for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
-class AccumulatedPoint {
-public:
-    AccumulatedPoint()
-        : num_of_points_(0),
-          point_(0.0, 0.0, 0.0),
-          normal_(0.0, 0.0, 0.0),
-          color_(0.0, 0.0, 0.0) {}
-
-public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
-        }
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetAveragePoint() const {
-        return point_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageNormal() const { return normal_.normalized(); }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
-    }
 
-public:
-    int num_of_points_;
-    Eigen::Vector3d point_;
-    Eigen::Vector3d normal_;
-    Eigen::Vector3d color_;
-};
-
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
-            }
-        }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
-            }
+/// Sums the normals of the points in voxel \p v, skipping NaN normals.
+Eigen::Vector3d SumNormals(const PointCloud &cloud,
+                           const VoxelGroups &groups,
+                           int64_t v) {
+    Eigen::Vector3d normal_sum(0.0, 0.0, 0.0);
+    for (int64_t t = groups.voxel_offsets_[v]; t < groups.voxel_offsets_[v + 1];
+         t++) {
+        const Eigen::Vector3d &normal = cloud.normals_[groups.order_[t]];
+        if (!std::isnan(normal(0)) && !std::isnan(normal(1)) &&
+            !std::isnan(normal(2))) {
+            normal_sum += normal;
         }
-        return Eigen::Vector3d(max_class, max_class, max_class);
     }
+    return normal_sum;
+}
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
+/// Averages the points of \p cloud over the voxels of size \p voxel_size of
+/// the grid that starts at \p voxel_min_bound.
+std::shared_ptr<PointCloud> AverageVoxels(
+        const PointCloud &cloud,
+        const Eigen::Vector3d &voxel_min_bound,
+        double voxel_size) {
+    auto output = std::make_shared<PointCloud>();
+    Eigen::Vector3d voxel_max_bound =
+            cloud.GetMaxBound() + Eigen::Vector3d::Constant(voxel_size * 0.5);
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSample] voxel_size is too small.");
+    }
+    const VoxelGroups groups =
+            GroupPointsByVoxel(cloud.points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
+    bool has_normals = cloud.HasNormals();
+    bool has_colors = cloud.HasColors();
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t v) {
+                const double num_points = double(groups.voxel_offsets_[v + 1] -
+                                                 groups.voxel_offsets_[v]);
+                output->points_[v] =
+                        SumAttribute(cloud.points_, groups, v) / num_points;
+                if (has_normals) {
+                    output->normals_[v] =
+                            SumNormals(cloud, groups, v).normalized();
+                }
+                if (has_colors) {
+                    output->colors_[v] =
+                            SumAttribute(cloud.colors_, groups, v) /
+                            num_points;
+                }
+            },
+            kVoxelGrainSize);
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)cloud.points_.size(), (int)output->points_.size());
+    return output;
+}
 
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         double voxel_size) const {
-    auto output = std::make_shared<PointCloud>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
     }
-    Eigen::Vector3d voxel_size3 =
-            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
-    if (voxel_size * std::numeric_limits<int>::max() <
-        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
-        utility::LogError("[VoxelDownSample] voxel_size is too small.");
-    }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    return AverageVoxels(
+            *this, GetMinBound() - Eigen::Vector3d::Constant(voxel_size * 0.5),
+            voxel_size);
+}
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
-        }
+std::shared_ptr<PointCloud> PointCloud::VoxelDownSampleOnGrid(
+        double voxel_size, const Eigen::Vector3d &grid_origin) const {
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSampleOnGrid] voxel_size <= 0.");
     }
-    utility::LogDebug(
-            "Pointcloud down sampled from {:d} points to {:d} points.",
-            (int)points_.size(), (int)output->points_.size());
-    return output;
+    // The corner of the grid at or below the minimum bound of the points.
+    const Eigen::Vector3d cells =
+            ((GetMinBound() - grid_origin) / voxel_size).array().floor();
+    return AverageVoxels(*this, grid_origin + cells * voxel_size, voxel_size);
 }
 
 std::tuple<std::shared_ptr<PointCloud>,
@@ -362,52 +448,82 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    const VoxelGroups groups =
+            GroupPointsByVoxel(points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
-    cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
-            } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
-            }
-        }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
-        }
-        cnt++;
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
     }
+    cubic_id.resize(num_voxels, 8);
+    cubic_id.setConstant(-1);
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t v) {
+                const int64_t begin = groups.voxel_offsets_[v];
+                const int64_t end = groups.voxel_offsets_[v + 1];
+                const double num_points = double(end - begin);
+                output->points_[v] =
+                        SumAttribute(points_, groups, v) / num_points;
+                if (has_normals) {
+                    output->normals_[v] =
+                            SumNormals(*this, groups, v).normalized();
+                }
+                if (has_colors) {
+                    if (approximate_class) {
+                        // The most frequent class, the smallest one on ties.
+                        std::vector<int> classes;
+                        for (int64_t t = begin; t < end; t++) {
+                            classes.push_back(
+                                    int(colors_[groups.order_[t]][0]));
+                        }
+                        std::sort(classes.begin(), classes.end());
+                        int max_class = -1;
+                        size_t max_count = 0;
+                        for (size_t i = 0; i < classes.size();) {
+                            size_t j = i;
+                            while (j < classes.size() &&
+                                   classes[j] == classes[i]) {
+                                j++;
+                            }
+                            if (j - i > max_count) {
+                                max_count = j - i;
+                                max_class = classes[i];
+                            }
+                            i = j;
+                        }
+                        output->colors_[v] = Eigen::Vector3d::Constant(
+                                double(max_class));
+                    } else {
+                        output->colors_[v] =
+                                SumAttribute(colors_, groups, v) / num_points;
+                    }
+                }
+                int cid_temp[3] = {1, 2, 4};
+                original_indices[v].reserve(end - begin);
+                for (int64_t t = begin; t < end; t++) {
+                    const int64_t pid = groups.order_[t];
+                    auto ref_coord =
+                            (points_[pid] - voxel_min_bound) / voxel_size;
+                    auto voxel_index = ComputeVoxelIndex(
+                            points_[pid], voxel_min_bound, voxel_size);
+                    int cid = 0;
+                    for (int c = 0; c < 3; c++) {
+                        if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
+                            cid += cid_temp[c];
+                        }
+                    }
+                    cubic_id(v, cid) = int(pid);
+                    original_indices[v].push_back(int(pid));
+                }
+            },
+            kVoxelGrainSize);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -445,90 +561,251 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
     return SelectByIndex(bbox.GetPointIndicesWithinBoundingBox(points_));
 }
 
-std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
-    if (nb_points < 1 || search_radius <= 0) {
-        utility::LogError(
-                "[RemoveRadiusOutliers] Illegal input parameters,"
-                "number of points and radius must be positive");
+std::vector<std::shared_ptr<PointCloud>> PointCloud::Crop(
+        const std::vector<AxisAlignedBoundingBox> &bboxes) const {
+    for (const auto &bbox : bboxes) {
+        if (bbox.IsEmpty()) {
+            utility::LogError(
+                    "[CropPointCloud] AxisAlignedBoundingBox either has zeros "
+                    "size, or has wrong bounds.");
+        }
     }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
-                                                  tmp_indices, dist);
-        mask[i] = (nb_neighbors > nb_points);
+    std::vector<std::shared_ptr<PointCloud>> pointclouds;
+    pointclouds.reserve(bboxes.size());
+    for (const auto &indices :
+         AxisAlignedBoundingBox::GetPointIndicesWithinBoundingBoxes(bboxes,
+                                                                    points_)) {
+        pointclouds.push_back(SelectByIndex(indices));
     }
+    return pointclouds;
+}
+
+namespace {
+
+// Points per task when reducing the average neighbor distances.
+constexpr int64_t kOutlierReduceGrainSize = 4096;
+
+// Returns the mask of the points whose mean distance to their neighbors is
+// below the cloud mean plus std_ratio standard deviations. Points without
+// neighbors are marked by a negative mean distance and are always removed.
+std::vector<bool> SelectStatisticalInliers(
+        const std::vector<double> &avg_distances, double std_ratio) {
+    const int64_t n = int64_t(avg_distances.size());
+    std::vector<bool> mask(n, false);
+    // (number of valid distances, sum of the positive distances)
+    typedef std::pair<int64_t, double> CountSum;
+    const CountSum count_sum = utility::ParallelReduce(
+            int64_t(0), n, CountSum(0, 0.0),
+            [&](int64_t begin, int64_t end, CountSum result) {
+                for (int64_t i = begin; i < end; i++) {
+                    const double d = avg_distances[i];
+                    result.first += d >= 0.0 ? 1 : 0;
+                    result.second += d > 0 ? d : 0.0;
+                }
+                return result;
+            },
+            [](const CountSum &lhs, const CountSum &rhs) {
+                return CountSum(lhs.first + rhs.first, lhs.second + rhs.second);
+            },
+            kOutlierReduceGrainSize);
+    const int64_t valid_distances = count_sum.first;
+    if (valid_distances == 0) {
+        return mask;
+    }
+    const double cloud_mean = count_sum.second / valid_distances;
+    const double sq_sum = utility::ParallelReduce(
+            int64_t(0), n, 0.0,
+            [&](int64_t begin, int64_t end, double result) {
+                for (int64_t i = begin; i < end; i++) {
+                    const double d = avg_distances[i];
+                    result += d > 0 ? (d - cloud_mean) * (d - cloud_mean) : 0;
+                }
+                return result;
+            },
+            [](double lhs, double rhs) { return lhs + rhs; },
+            kOutlierReduceGrainSize);
+    // Bessel's correction
+    double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
+    double distance_threshold = cloud_mean + std_ratio * std_dev;
+    for (int64_t i = 0; i < n; i++) {
+        mask[i] = avg_distances[i] > 0 && avg_distances[i] < distance_threshold;
+    }
+    return mask;
+}
+
+std::vector<size_t> MaskToIndices(const std::vector<bool> &mask) {
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
         if (mask[i]) {
             indices.push_back(i);
         }
     }
-    return std::make_tuple(SelectByIndex(indices), indices);
+    return indices;
 }
 
-std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
-PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
-                                      double std_ratio) const {
+void CheckRadiusOutlierParameters(size_t nb_points, double search_radius) {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Illegal input parameters,"
+                "number of points and radius must be positive");
+    }
+}
+
+void CheckStatisticalOutlierParameters(size_t nb_neighbors, double std_ratio) {
     if (nb_neighbors < 1 || std_ratio <= 0) {
         utility::LogError(
                 "[RemoveStatisticalOutliers] Illegal input parameters, number "
                 "of neighbors and standard deviation ratio must be positive");
     }
+}
+
+}  // namespace
+
+std::vector<bool> PointCloud::ComputeRadiusInlierMask(
+        size_t nb_points, double search_radius) const {
+    CheckRadiusOutlierParameters(nb_points, search_radius);
+    std::vector<bool> mask(points_.size(), false);
+    if (points_.empty()) {
+        return mask;
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(*this);
+    // Stopping at nb_points + 1 neighbors keeps the search of dense regions
+    // short. The threads write bytes, as std::vector<bool> shares words
+    // between neighboring points.
+    std::vector<uint8_t> is_inlier(points_.size());
+    utility::ParallelFor(
+            0, int64_t(points_.size()),
+            [&](int64_t i) {
+                std::vector<int> tmp_indices;
+                std::vector<double> dist;
+                int nb_neighbors = kdtree.SearchHybrid(
+                        points_[i], search_radius, int(nb_points + 1),
+                        tmp_indices, dist);
+                is_inlier[i] = nb_neighbors > int(nb_points);
+            },
+            256);
+    for (size_t i = 0; i < points_.size(); i++) {
+        mask[i] = is_inlier[i] != 0;
+    }
+    return mask;
+}
+
+std::vector<bool> PointCloud::ComputeRadiusInlierMask(
+        size_t nb_points,
+        double search_radius,
+        const NeighborGraph &graph) const {
+    CheckRadiusOutlierParameters(nb_points, search_radius);
+    if (graph.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] The neighbor graph has {} points, but "
+                "the point cloud has {}.",
+                graph.NumPoints(), points_.size());
+    }
+    const float radius2 = float(search_radius * search_radius);
+    std::vector<int64_t> nb_neighbors(points_.size());
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
+        // Neighbors are sorted by distance, so the count is the position of
+        // the first neighbor outside of the radius.
+        auto begin = graph.distance2_.begin() + graph.offsets_[i];
+        auto end = graph.distance2_.begin() + graph.offsets_[i + 1];
+        nb_neighbors[i] = std::upper_bound(begin, end, radius2) - begin;
+    });
+    std::vector<bool> mask(points_.size());
+    for (size_t i = 0; i < nb_neighbors.size(); i++) {
+        mask[i] = size_t(nb_neighbors[i]) > nb_points;
+    }
+    return mask;
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
+    std::vector<size_t> indices =
+            MaskToIndices(ComputeRadiusInlierMask(nb_points, search_radius));
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points,
+                                 double search_radius,
+                                 const NeighborGraph &graph) const {
+    std::vector<size_t> indices = MaskToIndices(
+            ComputeRadiusInlierMask(nb_points, search_radius, graph));
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
+std::vector<bool> PointCloud::ComputeStatisticalInlierMask(
+        size_t nb_neighbors, double std_ratio) const {
+    CheckStatisticalOutlierParameters(nb_neighbors, std_ratio);
     if (points_.size() == 0) {
-        return std::make_tuple(std::make_shared<PointCloud>(),
-                               std::vector<size_t>());
+        return std::vector<bool>();
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
     std::vector<double> avg_distances = std::vector<double>(points_.size());
-    std::vector<size_t> indices;
-    size_t valid_distances = 0;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < int(points_.size()); i++) {
-        std::vector<int> tmp_indices;
-        std::vector<double> dist;
-        kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
+    utility::ParallelFor(
+            0, int64_t(points_.size()),
+            [&](int64_t i) {
+                std::vector<int> tmp_indices;
+                std::vector<double> dist;
+                kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices,
+                                 dist);
+                double mean = -1.0;
+                if (dist.size() > 0u) {
+                    std::for_each(dist.begin(), dist.end(),
+                                  [](double &d) { d = std::sqrt(d); });
+                    mean = std::accumulate(dist.begin(), dist.end(), 0.0) /
+                           dist.size();
+                }
+                avg_distances[i] = mean;
+            },
+            256);
+    return SelectStatisticalInliers(avg_distances, std_ratio);
+}
+
+std::vector<bool> PointCloud::ComputeStatisticalInlierMask(
+        size_t nb_neighbors,
+        double std_ratio,
+        const NeighborGraph &graph) const {
+    CheckStatisticalOutlierParameters(nb_neighbors, std_ratio);
+    if (graph.NumPoints() != points_.size()) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] The neighbor graph has {} "
+                "points, but the point cloud has {}.",
+                graph.NumPoints(), points_.size());
+    }
+    std::vector<double> avg_distances(points_.size());
+    utility::ParallelFor(0, int64_t(points_.size()), [&](int64_t i) {
+        const int64_t begin = graph.offsets_[i];
+        const int64_t end = std::min(graph.offsets_[i + 1],
+                                     begin + int64_t(nb_neighbors));
         double mean = -1.0;
-        if (dist.size() > 0u) {
-            valid_distances++;
-            std::for_each(dist.begin(), dist.end(),
-                          [](double &d) { d = std::sqrt(d); });
-            mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
+        if (end > begin) {
+            double sum = 0.0;
+            for (int64_t k = begin; k < end; k++) {
+                sum += std::sqrt(double(graph.distance2_[k]));
+            }
+            mean = sum / double(end - begin);
         }
         avg_distances[i] = mean;
-    }
-    if (valid_distances == 0) {
-        return std::make_tuple(std::make_shared<PointCloud>(),
-                               std::vector<size_t>());
-    }
-    double cloud_mean = std::accumulate(
-            avg_distances.begin(), avg_distances.end(), 0.0,
-            [](double const &x, double const &y) { return y > 0 ? x + y : x; });
-    cloud_mean /= valid_distances;
-    double sq_sum = std::inner_product(
-            avg_distances.begin(), avg_distances.end(), avg_distances.begin(),
-            0.0, [](double const &x, double const &y) { return x + y; },
-            [cloud_mean](double const &x, double const &y) {
-                return x > 0 ? (x - cloud_mean) * (y - cloud_mean) : 0;
-            });
-    // Bessel's correction
-    double std_dev = std::sqrt(sq_sum / (valid_distances - 1));
-    double distance_threshold = cloud_mean + std_ratio * std_dev;
-    for (size_t i = 0; i < avg_distances.size(); i++) {
-        if (avg_distances[i] > 0 && avg_distances[i] < distance_threshold) {
-            indices.push_back(i);
-        }
-    }
+    });
+    return SelectStatisticalInliers(avg_distances, std_ratio);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
+                                      double std_ratio) const {
+    std::vector<size_t> indices = MaskToIndices(
+            ComputeStatisticalInlierMask(nb_neighbors, std_ratio));
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
+                                      double std_ratio,
+                                      const NeighborGraph &graph) const {
+    std::vector<size_t> indices = MaskToIndices(
+            ComputeStatisticalInlierMask(nb_neighbors, std_ratio, graph));
     return std::make_tuple(SelectByIndex(indices), indices);
 }
 
@@ -608,70 +885,96 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 PointCloud::ComputeConvexHull() const {
-    return Qhull::ComputeConvexHull(points_);
+    return ConvexHull::ComputeConvexHull(points_);
 }
 
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
-PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
-                               const double radius) const {
-    if (radius <= 0) {
-        utility::LogError(
-                "[HiddenPointRemoval] radius must be larger than zero.");
-    }
+namespace {
 
-    // perform spherical projection
-    std::vector<Eigen::Vector3d> spherical_projection;
-    for (size_t pidx = 0; pidx < points_.size(); ++pidx) {
-        Eigen::Vector3d projected_point = points_[pidx] - camera_location;
-        double norm = projected_point.norm();
-        spherical_projection.push_back(
-                projected_point + 2 * (radius - norm) * projected_point / norm);
-    }
+// Points per task of the spherical flipping.
+constexpr int64_t kHiddenPointRemovalGrainSize = 8192;
 
-    // add origin
-    size_t origin_pidx = spherical_projection.size();
-    spherical_projection.push_back(Eigen::Vector3d(0, 0, 0));
+// Returns the mesh of the points visible from camera_location and their
+// indices, see PointCloud::HiddenPointRemoval.
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+ComputeHiddenPointRemoval(const std::vector<Eigen::Vector3d> &points,
+                          const Eigen::Vector3d &camera_location,
+                          double radius) {
+    // perform spherical projection, and add the origin
+    const int64_t num_points = int64_t(points.size());
+    std::vector<Eigen::Vector3d> spherical_projection(num_points + 1);
+    utility::ParallelFor(
+            0, num_points,
+            [&](int64_t pidx) {
+                Eigen::Vector3d projected_point =
+                        points[pidx] - camera_location;
+                double norm = projected_point.norm();
+                spherical_projection[pidx] =
+                        projected_point +
+                        2 * (radius - norm) * projected_point / norm;
+            },
+            kHiddenPointRemovalGrainSize);
+    const size_t origin_pidx = size_t(num_points);
+    spherical_projection[origin_pidx] = Eigen::Vector3d(0, 0, 0);
 
     // calculate convex hull of spherical projection
-    std::shared_ptr<TriangleMesh> visible_mesh;
+    std::shared_ptr<TriangleMesh> hull;
+    std::vector<size_t> hull_pt_map;
+    std::tie(hull, hull_pt_map) =
+            ConvexHull::ComputeConvexHull(spherical_projection);
+
+    // The visible points are the hull vertices except the origin, whose
+    // triangles are dropped.
+    auto visible_mesh = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
-    std::tie(visible_mesh, pt_map) =
-            Qhull::ComputeConvexHull(spherical_projection);
-
-    // reassign original points to mesh
-    size_t origin_vidx = pt_map.size();
-    for (size_t vidx = 0; vidx < pt_map.size(); vidx++) {
-        size_t pidx = pt_map[vidx];
-        visible_mesh->vertices_[vidx] = points_[pidx];
-        if (pidx == origin_pidx) {
-            origin_vidx = vidx;
-            visible_mesh->vertices_[vidx] = camera_location;
+    std::vector<int> vertex_map(hull_pt_map.size(), -1);
+    for (size_t vidx = 0; vidx < hull_pt_map.size(); vidx++) {
+        const size_t pidx = hull_pt_map[vidx];
+        if (pidx != origin_pidx) {
+            vertex_map[vidx] = int(pt_map.size());
+            pt_map.push_back(pidx);
+            visible_mesh->vertices_.push_back(points[pidx]);
         }
     }
-
-    // erase origin if part of mesh
-    if (origin_vidx < visible_mesh->vertices_.size()) {
-        visible_mesh->vertices_.erase(visible_mesh->vertices_.begin() +
-                                      origin_vidx);
-        pt_map.erase(pt_map.begin() + origin_vidx);
-        for (size_t tidx = visible_mesh->triangles_.size(); tidx-- > 0;) {
-            if (visible_mesh->triangles_[tidx](0) == (int)origin_vidx ||
-                visible_mesh->triangles_[tidx](1) == (int)origin_vidx ||
-                visible_mesh->triangles_[tidx](2) == (int)origin_vidx) {
-                visible_mesh->triangles_.erase(
-                        visible_mesh->triangles_.begin() + tidx);
-            } else {
-                if (visible_mesh->triangles_[tidx](0) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](0) -= 1;
-                if (visible_mesh->triangles_[tidx](1) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](1) -= 1;
-                if (visible_mesh->triangles_[tidx](2) > (int)origin_vidx)
-                    visible_mesh->triangles_[tidx](2) -= 1;
-            }
+    for (const Eigen::Vector3i &triangle : hull->triangles_) {
+        const Eigen::Vector3i visible_triangle(vertex_map[triangle(0)],
+                                               vertex_map[triangle(1)],
+                                               vertex_map[triangle(2)]);
+        if (visible_triangle.minCoeff() >= 0) {
+            visible_mesh->triangles_.push_back(visible_triangle);
         }
     }
     return std::make_tuple(visible_mesh, pt_map);
 }
 
+}  // unnamed namespace
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
+                               const double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+    return ComputeHiddenPointRemoval(points_, camera_location, radius);
+}
+
+std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+PointCloud::HiddenPointRemoval(
+        const std::vector<Eigen::Vector3d> &camera_locations,
+        const double radius) const {
+    if (radius <= 0) {
+        utility::LogError(
+                "[HiddenPointRemoval] radius must be larger than zero.");
+    }
+    std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+            results(camera_locations.size());
+    utility::ParallelFor(0, int64_t(camera_locations.size()),
+                         [&](int64_t cidx) {
+                             results[cidx] = ComputeHiddenPointRemoval(
+                                     points_, camera_locations[cidx], radius);
+                         });
+    return results;
+}
+
 }  // namespace geometry
 }  // namespace open3d
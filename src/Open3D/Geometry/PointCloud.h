@@ -43,10 +43,39 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class NeighborGraph;
 class RGBDImage;
 class TriangleMesh;
+class TriangleMeshBVH;
 class VoxelGrid;
 
+/// \struct PointCloudTiles
+///
+/// \brief Partition of the points of a PointCloud into a regular grid of axis
+/// aligned tiles, see PointCloud::ComputeTiles().
+///
+/// Tile (i, j, k) has index t = i + num_tiles_(0) * (j + num_tiles_(1) * k).
+/// Its points are indices_[offsets_[t]] to indices_[offsets_[t + 1] - 1], in
+/// increasing order.
+struct PointCloudTiles {
+    /// Returns the number of tiles.
+    size_t NumTiles() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+    /// Returns the indices of the points in tile \p t.
+    std::vector<size_t> GetTileIndices(size_t t) const;
+    /// Returns the bounds of tile \p t, including the overlap.
+    AxisAlignedBoundingBox GetTileBoundingBox(size_t t) const;
+
+    /// Minimum bound of tile (0, 0, 0), without the overlap.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d tile_size_ = Eigen::Vector3d::Zero();
+    double overlap_ = 0.0;
+    Eigen::Vector3i num_tiles_ = Eigen::Vector3i::Zero();
+    std::vector<size_t> offsets_;
+    std::vector<size_t> indices_;
+};
+
 /// \class PointCloud
 ///
 /// \brief A point cloud consists of point coordinates, and optionally point
@@ -78,6 +107,16 @@ public:
     PointCloud &Rotate(const Eigen::Matrix3d &R,
                        const Eigen::Vector3d &center) override;
 
+    /// \brief Writes this point cloud transformed with \p transformation to
+    /// \p dst, as dst = *this; dst.Transform(transformation) would, but in a
+    /// single pass and reusing the memory of \p dst.
+    ///
+    /// \param transformation 4x4 matrix for transformation.
+    /// \param dst The output point cloud, may be this point cloud.
+    /// \return A reference to \p dst.
+    PointCloud &TransformInto(const Eigen::Matrix4d &transformation,
+                              PointCloud &dst) const;
+
     PointCloud &operator+=(const PointCloud &cloud);
     PointCloud operator+(const PointCloud &cloud) const;
 
@@ -94,6 +133,11 @@ public:
         return points_.size() > 0 && colors_.size() == points_.size();
     }
 
+    /// Returns `true` if the point cloud contains per point covariances.
+    bool HasCovariances() const {
+        return points_.size() > 0 && covariances_.size() == points_.size();
+    }
+
     /// Normalize point normals to length 1.
     PointCloud &NormalizeNormals() {
         for (size_t i = 0; i < normals_.size(); i++) {
@@ -139,6 +183,18 @@ public:
     /// smaller value leads to denser output point cloud.
     std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
 
+    /// \brief Function to downsample input pointcloud into output pointcloud
+    /// with a voxel grid that has a voxel corner at \p grid_origin.
+    ///
+    /// Unlike VoxelDownSample(), the voxels do not depend on the bounds of
+    /// the points, so parts of a point cloud are downsampled consistently,
+    /// e.g. tiles whose borders are on the grid.
+    ///
+    /// \param voxel_size Defines the resolution of the voxel grid.
+    /// \param grid_origin A corner of the voxel grid.
+    std::shared_ptr<PointCloud> VoxelDownSampleOnGrid(
+            double voxel_size, const Eigen::Vector3d &grid_origin) const;
+
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
     /// Also records point cloud index before downsampling.
@@ -181,6 +237,26 @@ public:
     /// \param bbox OrientedBoundingBox to crop points.
     std::shared_ptr<PointCloud> Crop(const OrientedBoundingBox &bbox) const;
 
+    /// \brief Function to crop pointcloud into one pointcloud per bounding
+    /// box, with a single pass over the points.
+    ///
+    /// \param bboxes AxisAlignedBoundingBoxes to crop points.
+    std::vector<std::shared_ptr<PointCloud>> Crop(
+            const std::vector<AxisAlignedBoundingBox> &bboxes) const;
+
+    /// \brief Function to partition the points into a regular grid of axis
+    /// aligned tiles.
+    ///
+    /// The grid starts at the minimum bound of the points. Tiles are extended
+    /// by \p overlap on every side, so points close to a tile border belong
+    /// to all tiles they are within. Use an infinite tile size along an axis
+    /// to not split the points along it, e.g. to tile along x and y only.
+    ///
+    /// \param tile_size Size of the tiles along every axis.
+    /// \param overlap Distance by which the tiles are extended on every side.
+    PointCloudTiles ComputeTiles(const Eigen::Vector3d &tile_size,
+                                 double overlap = 0.0) const;
+
     /// \brief Function to remove points that have less than \p nb_points in a
     /// sphere of a given radius.
     ///
@@ -189,6 +265,19 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
+    /// \brief Function to remove points that have less than \p nb_points in a
+    /// sphere of a given radius, using a precomputed neighbor graph.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \param graph Neighbor graph of the point cloud. It must contain all
+    /// neighbors within \p search_radius, e.g. by being built with a
+    /// KDTreeSearchParamRadius of at least \p search_radius.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveRadiusOutliers(size_t nb_points,
+                         double search_radius,
+                         const NeighborGraph &graph) const;
+
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
     ///
@@ -197,6 +286,70 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveStatisticalOutliers(size_t nb_neighbors, double std_ratio) const;
 
+    /// \brief Function to remove points that are further away from their
+    /// \p nb_neighbor neighbors in average, using a precomputed neighbor
+    /// graph.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point. Only
+    /// the \p nb_neighbors nearest neighbors in \p graph are used.
+    /// \param std_ratio Standard deviation ratio.
+    /// \param graph Neighbor graph of the point cloud.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveStatisticalOutliers(size_t nb_neighbors,
+                              double std_ratio,
+                              const NeighborGraph &graph) const;
+
+    /// \brief Function to compute which points have more than \p nb_points
+    /// points in a sphere of a given radius, without copying the inliers.
+    ///
+    /// The search of a point stops after nb_points + 1 neighbors.
+    /// mask[i] is true for the points RemoveRadiusOutliers() keeps.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    std::vector<bool> ComputeRadiusInlierMask(size_t nb_points,
+                                              double search_radius) const;
+
+    /// \brief Function to compute which points have more than \p nb_points
+    /// points in a sphere of a given radius, using a precomputed neighbor
+    /// graph.
+    ///
+    /// Masks computed on the same graph can be combined, e.g. to chain the
+    /// radius and the statistical filter without copying the point cloud.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \param graph Neighbor graph of the point cloud. It must contain all
+    /// neighbors within \p search_radius.
+    std::vector<bool> ComputeRadiusInlierMask(size_t nb_points,
+                                              double search_radius,
+                                              const NeighborGraph &graph) const;
+
+    /// \brief Function to compute which points are not further away from
+    /// their \p nb_neighbor neighbors in average, without copying the inliers.
+    ///
+    /// mask[i] is true for the points RemoveStatisticalOutliers() keeps. The
+    /// mean and the standard deviation of the average distances are computed
+    /// with parallel reductions.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    std::vector<bool> ComputeStatisticalInlierMask(size_t nb_neighbors,
+                                                   double std_ratio) const;
+
+    /// \brief Function to compute which points are not further away from
+    /// their \p nb_neighbor neighbors in average, using a precomputed
+    /// neighbor graph.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point. Only
+    /// the \p nb_neighbors nearest neighbors in \p graph are used.
+    /// \param std_ratio Standard deviation ratio.
+    /// \param graph Neighbor graph of the point cloud.
+    std::vector<bool> ComputeStatisticalInlierMask(
+            size_t nb_neighbors,
+            double std_ratio,
+            const NeighborGraph &graph) const;
+
     /// \brief Function to compute the normals of a point cloud.
     ///
     /// Normals are oriented with respect to the input point cloud if normals
@@ -210,6 +363,37 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of a point cloud from a
+    /// precomputed neighbor graph.
+    ///
+    /// Normals are oriented with respect to the input point cloud if normals
+    /// exist. The covariance of each neighborhood is accumulated relative to
+    /// its query point, which keeps it accurate for clouds far away from the
+    /// origin.
+    ///
+    /// \param graph Neighbor graph of the point cloud.
+    /// \param fast_normal_computation If true, the normal estiamtion uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix. This is faster, but is not as numerical stable.
+    void EstimateNormals(const NeighborGraph &graph,
+                         bool fast_normal_computation = true);
+
+    /// \brief Function to compute the covariance of the neighborhood of every
+    /// point.
+    ///
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search.
+    void EstimateCovariances(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
+
+    /// \brief Function to compute the covariance of the neighborhood of every
+    /// point from a precomputed neighbor graph.
+    ///
+    /// Points with less than three neighbors get a zero covariance.
+    ///
+    /// \param graph Neighbor graph of the point cloud.
+    void EstimateCovariances(const NeighborGraph &graph);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -233,14 +417,58 @@ public:
     /// propagation.
     void OrientNormalsConsistentTangentPlane(size_t k);
 
+    /// \brief Function to consistently orient estimated normals based on
+    /// consistent tangent planes, using a precomputed neighbor graph as the
+    /// nearest neighbour part of the Riemannian graph.
+    ///
+    /// \param graph Neighbor graph of the point cloud.
+    void OrientNormalsConsistentTangentPlane(const NeighborGraph &graph);
+
     /// \brief Function to compute the point to point distances between point
     /// clouds.
     ///
     /// For each point in the \p source point cloud, compute the distance to the
-    /// \p target point cloud.
+    /// \p target point cloud. The nearest neighbors of all points are searched
+    /// in one parallel batch, and the distances to them are evaluated in double
+    /// precision. The distances are 0 if \p target is empty.
+    ///
+    /// \param target The target point cloud.
+    std::vector<double> ComputePointCloudDistance(
+            const PointCloud &target) const;
+
+    /// \brief Function to compute the Chamfer distance between point clouds.
+    ///
+    /// This is the mean distance of the points to \p target plus the mean
+    /// distance of the points of \p target to this point cloud. It is 0 if
+    /// both point clouds are empty and infinite if only one of them is.
+    ///
+    /// \param target The target point cloud.
+    double ComputeChamferDistance(const PointCloud &target) const;
+
+    /// \brief Function to compute the Hausdorff distance between point clouds.
+    ///
+    /// This is the larger of the maximum distance of the points to \p target
+    /// and the maximum distance of the points of \p target to this point
+    /// cloud. It is 0 if both point clouds are empty and infinite if only one
+    /// of them is.
     ///
     /// \param target The target point cloud.
-    std::vector<double> ComputePointCloudDistance(const PointCloud &target);
+    double ComputeHausdorffDistance(const PointCloud &target) const;
+
+    /// \brief Function to compute the distances of the points to the surface
+    /// of a triangle mesh.
+    ///
+    /// The closest points are searched in parallel in a TriangleMeshBVH built
+    /// for \p mesh. The distances are infinite if the mesh has no triangles.
+    ///
+    /// \param mesh The target triangle mesh.
+    std::vector<double> ComputeDistanceToMesh(const TriangleMesh &mesh) const;
+
+    /// \brief Function to compute the distances of the points to the surface
+    /// of a triangle mesh, using the prebuilt hierarchy \p bvh of the mesh.
+    ///
+    /// \param bvh The bounding volume hierarchy of the target triangle mesh.
+    std::vector<double> ComputeDistanceToMesh(const TriangleMeshBVH &bvh) const;
 
     /// Function to compute the mean and covariance matrix
     /// of a point cloud.
@@ -257,7 +485,8 @@ public:
     /// the input point cloud
     std::vector<double> ComputeNearestNeighborDistance() const;
 
-    /// Function that computes the convex hull of the point cloud using qhull
+    /// Function that computes the convex hull of the point cloud, see
+    /// ConvexHull
     std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
     ComputeConvexHull() const;
 
@@ -274,14 +503,27 @@ public:
     HiddenPointRemoval(const Eigen::Vector3d &camera_location,
                        const double radius) const;
 
+    /// \brief Runs HiddenPointRemoval for every location of
+    /// \p camera_locations, in parallel, e.g. to compare candidate
+    /// viewpoints.
+    ///
+    /// \param camera_locations The locations the points are seen from.
+    /// \param radius The radius of the sperical projection.
+    std::vector<std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>>
+    HiddenPointRemoval(const std::vector<Eigen::Vector3d> &camera_locations,
+                       const double radius) const;
+
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
     ///
     /// Returns a list of point labels, -1 indicates noise according to
-    /// the algorithm.
+    /// the algorithm. Neighbors are found in a uniform grid with cell size
+    /// \p eps and core points are merged with a concurrent union-find, so no
+    /// neighbor lists are stored.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
+    /// Must be positive.
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
@@ -291,17 +533,25 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are scored in parallel, and are first scored on a random
+    /// subset of the points to reject poor models early. The search stops
+    /// before \p num_iterations once an all-inlier sample has been drawn
+    /// with the given \p probability.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane,
+    /// in (0, 1]. A probability of 1 always runs \p num_iterations.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -369,6 +619,8 @@ public:
     std::vector<Eigen::Vector3d> normals_;
     /// Points coordinates.
     std::vector<Eigen::Vector3d> colors_;
+    /// Covariances of the point neighborhoods.
+    std::vector<Eigen::Matrix3d> covariances_;
 };
 
 }  // namespace geometry
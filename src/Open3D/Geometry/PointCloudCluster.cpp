@@ -27,92 +27,255 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <algorithm>
+#include <climits>
+#include <cmath>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/ConcurrentDisjointSet.h"
 #include "Open3D/Utility/Console.h"
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { ++progress_bar; }
-    }
-    utility::LogDebug("Done Precompute Neighbours");
-
-    // set all labels to undefined (-2)
-    utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        if (labels[idx] != -2) {  // label is not undefined
-            continue;
-        }
+namespace {
 
-        // check density
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+typedef Eigen::Matrix<int64_t, 3, 1> Cell;
+
+/// Buckets of the up to 27 cells around a cell, without duplicates.
+struct NeighborBuckets {
+    uint32_t buckets_[27];
+    int size_ = 0;
+};
+
+/// \class DBSCANGrid
+///
+/// \brief Points hashed into the buckets of a uniform grid with cell size eps.
+///
+/// All neighbors within eps of a point lie in the 27 cells around its cell.
+/// Cells are not stored: a bucket may hold the points of several cells, which
+/// only costs extra distance tests. Points are stored sorted by bucket, so the
+/// points of a bucket are contiguous.
+class DBSCANGrid {
+public:
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points,
+               const Eigen::Vector3d &min_bound,
+               double eps)
+        : inv_eps_(1.0 / eps), eps2_(eps * eps), min_bound_(min_bound) {
+        const int64_t num_points = int64_t(points.size());
+        num_buckets_ = 16;
+        while (num_buckets_ < uint64_t(num_points)) {
+            num_buckets_ <<= 1;
         }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
+        std::vector<uint32_t> keys(num_points);
+        order_.resize(num_points);
+        utility::ParallelFor(
+                0, num_points,
+                [&](int64_t i) {
+                    keys[i] = GetBucket(GetCell(points[i]));
+                    order_[i] = i;
+                },
+                32768);
+        utility::ParallelRadixSortPairs(keys, order_);
 
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
+        offsets_.resize(num_buckets_ + 1);
+        utility::ParallelFor(
+                0, int64_t(num_buckets_) + 1,
+                [&](int64_t b) {
+                    offsets_[b] = std::lower_bound(keys.begin(), keys.end(),
+                                                   uint64_t(b)) -
+                                  keys.begin();
+                },
+                4096);
+        points_.resize(num_points);
+        utility::ParallelFor(
+                0, num_points,
+                [&](int64_t i) { points_[i] = points[order_[i]]; }, 32768);
+    }
 
-            if (labels[nb] == -1) {  // noise label
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            if (labels[nb] != -2) {  // not undefined label
-                continue;
+    Cell GetCell(const Eigen::Vector3d &point) const {
+        Eigen::Vector3d coord =
+                ((point - min_bound_) * inv_eps_).array().floor();
+        return coord.cast<int64_t>();
+    }
+
+    uint32_t GetBucket(const Cell &cell) const {
+        // MurmurHash3 finalizer of the combined cell coordinates.
+        uint64_t h = uint64_t(cell(0)) * 73856093ULL ^
+                     uint64_t(cell(1)) * 19349663ULL ^
+                     uint64_t(cell(2)) * 83492791ULL;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return uint32_t(h & (num_buckets_ - 1));
+    }
+
+    NeighborBuckets GetNeighborBuckets(const Cell &cell) const {
+        NeighborBuckets neighbors;
+        for (int64_t dx = -1; dx <= 1; dx++) {
+            for (int64_t dy = -1; dy <= 1; dy++) {
+                for (int64_t dz = -1; dz <= 1; dz++) {
+                    uint32_t bucket = GetBucket(cell + Cell(dx, dy, dz));
+                    if (std::find(neighbors.buckets_,
+                                  neighbors.buckets_ + neighbors.size_,
+                                  bucket) ==
+                        neighbors.buckets_ + neighbors.size_) {
+                        neighbors.buckets_[neighbors.size_++] = bucket;
+                    }
+                }
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+        }
+        return neighbors;
+    }
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    /// Calls func(i, neighbors) for every point i in parallel, where neighbors
+    /// are the buckets around the cell of point i.
+    template <typename func_t>
+    void ForEachPoint(const func_t &func) const {
+        utility::ParallelFor(
+                0, int64_t(num_buckets_),
+                [&](int64_t b) {
+                    Cell last_cell = Cell::Zero();
+                    NeighborBuckets neighbors;
+                    for (int64_t i = offsets_[b]; i < offsets_[b + 1]; i++) {
+                        Cell cell = GetCell(points_[i]);
+                        if (i == offsets_[b] || cell != last_cell) {
+                            neighbors = GetNeighborBuckets(cell);
+                            last_cell = cell;
+                        }
+                        func(i, neighbors);
                     }
+                },
+                256);
+    }
+
+    /// Calls func(j) for the points j within eps of point i, including i
+    /// itself, until func returns false.
+    template <typename func_t>
+    void VisitNeighbors(int64_t i,
+                        const NeighborBuckets &neighbors,
+                        const func_t &func) const {
+        const Eigen::Vector3d &point = points_[i];
+        for (int k = 0; k < neighbors.size_; k++) {
+            const uint32_t bucket = neighbors.buckets_[k];
+            for (int64_t j = offsets_[bucket]; j < offsets_[bucket + 1]; j++) {
+                if ((points_[j] - point).squaredNorm() < eps2_ && !func(j)) {
+                    return;
                 }
             }
         }
+    }
+
+public:
+    /// Original index of every sorted point.
+    std::vector<int64_t> order_;
 
-        cluster_label++;
+private:
+    double inv_eps_;
+    double eps2_;
+    Eigen::Vector3d min_bound_;
+    uint64_t num_buckets_;
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<int64_t> offsets_;
+};
+
+}  // unnamed namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps must be positive.");
+    }
+    if (points_.empty()) {
+        return std::vector<int>();
     }
+    const int64_t num_points = int64_t(points_.size());
+    utility::ConsoleProgressBar progress_bar(4, "Clustering", print_progress);
+
+    utility::LogDebug("Build Grid");
+    DBSCANGrid grid(points_, GetMinBound(), eps);
+    ++progress_bar;
+
+    // A point is a core point if it has at least min_points neighbors,
+    // including itself. The search stops as soon as enough are found.
+    utility::LogDebug("Find Core Points");
+    std::vector<uint8_t> is_core(num_points, 0);
+    grid.ForEachPoint([&](int64_t i, const NeighborBuckets &neighbors) {
+        size_t count = 0;
+        if (min_points > 0) {
+            grid.VisitNeighbors(i, neighbors, [&](int64_t) {
+                return ++count < min_points;
+            });
+        }
+        is_core[i] = count >= min_points;
+    });
+    ++progress_bar;
+
+    // Core points within eps of each other are in the same cluster.
+    utility::LogDebug("Merge Core Points");
+    detail::ConcurrentDisjointSet disjoint_set(num_points);
+    grid.ForEachPoint([&](int64_t i, const NeighborBuckets &neighbors) {
+        if (!is_core[i]) {
+            return;
+        }
+        grid.VisitNeighbors(i, neighbors, [&](int64_t j) {
+            if (j < i && is_core[j]) {
+                disjoint_set.Union(int(i), int(j));
+            }
+            return true;
+        });
+    });
+    ++progress_bar;
+
+    // Clusters are labeled in the order of their first core point.
+    utility::LogDebug("Label Clusters");
+    const int unlabeled = INT_MAX;
+    std::vector<int> first_point(num_points, unlabeled);
+    for (int64_t i = 0; i < num_points; i++) {
+        if (is_core[i]) {
+            int &first = first_point[disjoint_set.Find(int(i))];
+            first = std::min(first, int(grid.order_[i]));
+        }
+    }
+    std::vector<int> roots;
+    for (int64_t i = 0; i < num_points; i++) {
+        if (first_point[i] != unlabeled) {
+            roots.push_back(int(i));
+        }
+    }
+    std::sort(roots.begin(), roots.end(), [&](int lhs, int rhs) {
+        return first_point[lhs] < first_point[rhs];
+    });
+    std::vector<int> root_labels(num_points, -1);
+    for (size_t k = 0; k < roots.size(); k++) {
+        root_labels[roots[k]] = int(k);
+    }
+
+    // Border points join the cluster with the smallest label among their core
+    // neighbors. Points without core neighbors are noise (-1).
+    std::vector<int> labels(num_points, -1);
+    grid.ForEachPoint([&](int64_t i, const NeighborBuckets &neighbors) {
+        int label = unlabeled;
+        if (is_core[i]) {
+            label = root_labels[disjoint_set.Find(int(i))];
+        } else {
+            grid.VisitNeighbors(i, neighbors, [&](int64_t j) {
+                if (is_core[j]) {
+                    label = std::min(label,
+                                     root_labels[disjoint_set.Find(int(j))]);
+                }
+                return true;
+            });
+        }
+        labels[grid.order_[i]] = label == unlabeled ? -1 : label;
+    });
+    ++progress_bar;
 
-    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    utility::LogDebug("Done Compute Clusters: {:d}", roots.size());
     return labels;
 }
 
@@ -35,6 +35,7 @@
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -58,10 +59,10 @@ public:
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
+    size_t inlier_num = 0;
+    double error = 0;
 
     for (size_t idx = 0; idx < points.size(); ++idx) {
         Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
@@ -70,11 +71,10 @@ RANSACResult EvaluateRANSACBasedOnDistance(
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            inlier_num++;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
@@ -85,6 +85,49 @@ RANSACResult EvaluateRANSACBasedOnDistance(
     return result;
 }
 
+namespace {
+
+// Number of hypotheses that are scored in parallel between two checks of the
+// termination criterion.
+const int kRANSACBatchSize = 64;
+// Number of points on which hypotheses are scored before the whole cloud.
+const size_t kRANSACPreviewSize = 1024;
+
+// Counts the inliers of a plane model among the points selected by indices.
+size_t CountRANSACInliers(const std::vector<Eigen::Vector3d> &points,
+                          const std::vector<size_t> &indices,
+                          const Eigen::Vector4d &plane_model,
+                          double distance_threshold) {
+    size_t inlier_num = 0;
+    for (size_t idx : indices) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
+                              1);
+        if (std::abs(plane_model.dot(point)) < distance_threshold) {
+            inlier_num++;
+        }
+    }
+    return inlier_num;
+}
+
+// Draws n distinct indices in [0, num_points). Rejection sampling is cheap for
+// the small sample sizes of RANSAC.
+std::vector<size_t> SampleDistinctIndices(size_t n,
+                                          size_t num_points,
+                                          std::mt19937 &rng) {
+    std::uniform_int_distribution<size_t> distribution(0, num_points - 1);
+    std::vector<size_t> samples;
+    samples.reserve(n);
+    while (samples.size() < n) {
+        size_t idx = distribution(rng);
+        if (std::find(samples.begin(), samples.end(), idx) == samples.end()) {
+            samples.push_back(idx);
+        }
+    }
+    return samples;
+}
+
+}  // namespace
+
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
@@ -136,12 +179,10 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
 std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         const double distance_threshold /* = 0.01 */,
         const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
     RANSACResult result;
-    double error = 0;
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
     // Initialize the best plane model.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
@@ -149,11 +190,6 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     std::vector<size_t> inliers;
 
     size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
 
     // Return if ransac_n is less than the required plane model parameters.
     if (ransac_n < 3) {
@@ -165,33 +201,92 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
         utility::LogError("There must be at least 'ransac_n' points.");
         return std::make_tuple(best_plane_model, inliers);
     }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability should be in the range (0, 1].");
+        return std::make_tuple(best_plane_model, inliers);
+    }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
+    // Every hypothesis seeds its own generator from the iteration index, so
+    // the result does not depend on the number of threads.
+    std::random_device rd;
+    const std::mt19937::result_type seed = rd();
+
+    // Hypotheses are first scored on a random subset of the points, and only
+    // those that may beat the best model so far are scored on all points.
+    std::vector<size_t> preview;
+    if (num_points > 4 * kRANSACPreviewSize) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> distribution(0, num_points - 1);
+        preview.resize(kRANSACPreviewSize);
+        for (size_t &idx : preview) {
+            idx = distribution(rng);
         }
+        std::sort(preview.begin(), preview.end());
+    }
+
+    std::vector<RANSACResult> batch_results(kRANSACBatchSize);
+    std::vector<Eigen::Vector4d> batch_models(kRANSACBatchSize);
+    int max_iterations = num_iterations;
+    for (int itr = 0; itr < max_iterations; itr += kRANSACBatchSize) {
+        const int batch_size = std::min(kRANSACBatchSize, max_iterations - itr);
+        const RANSACResult best_result = result;
+        utility::ParallelFor(0, batch_size, [&](int64_t i) {
+            std::seed_seq seed_sequence{seed,
+                                        std::mt19937::result_type(itr + i)};
+            std::mt19937 rng(seed_sequence);
+            std::vector<size_t> samples =
+                    SampleDistinctIndices(size_t(ransac_n), num_points, rng);
+
+            // Fit model to num_model_parameters randomly selected points
+            // among the inliers.
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points_[samples[0]], points_[samples[1]],
+                    points_[samples[2]]);
+            batch_results[i] = RANSACResult();
+            batch_models[i] = plane_model;
+            if (plane_model.isZero(0)) {
+                return;
+            }
+
+            // Reject the model if its fitness on the preview is more than
+            // three standard deviations below the best fitness.
+            if (!preview.empty()) {
+                const double m = double(preview.size());
+                const double preview_fitness =
+                        CountRANSACInliers(points_, preview, plane_model,
+                                           distance_threshold) /
+                        m;
+                const double sigma = std::sqrt(best_result.fitness_ *
+                                               (1 - best_result.fitness_) / m);
+                if (preview_fitness + 3 * sigma + 1 / m <
+                    best_result.fitness_) {
+                    return;
+                }
+            }
+            batch_results[i] = EvaluateRANSACBasedOnDistance(
+                    points_, plane_model, distance_threshold);
+        });
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+        for (int i = 0; i < batch_size; i++) {
+            const RANSACResult &this_result = batch_results[i];
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = batch_models[i];
+            }
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        // Stop once an all-inlier sample has been drawn with the requested
+        // probability, given the inlier ratio of the best model.
+        const double sample_probability = std::pow(result.fitness_, ransac_n);
+        if (sample_probability > 0 && probability < 1) {
+            const double required_iterations = std::log(1 - probability) /
+                                               std::log1p(-sample_probability);
+            if (required_iterations < max_iterations) {
+                max_iterations = std::max(
+                        itr + batch_size, int(std::ceil(required_iterations)));
+            }
         }
     }
 
@@ -210,8 +305,11 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     // Improve best_plane_model using the final inliers.
     best_plane_model = GetPlaneFromPoints(points_, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iterations: "
+            "{:d}",
+            inliers.size(), result.fitness_, result.inlier_rmse_,
+            max_iterations);
     return std::make_tuple(best_plane_model, inliers);
 }
 
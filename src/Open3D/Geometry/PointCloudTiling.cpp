@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Points per task when assigning points to tiles.
+constexpr int64_t kTileGrainSize = 32768;
+
+}  // namespace
+
+std::vector<size_t> PointCloudTiles::GetTileIndices(size_t t) const {
+    if (t >= NumTiles()) {
+        utility::LogError("Tile index {} out of range [0, {}).", t,
+                          NumTiles());
+    }
+    return std::vector<size_t>(indices_.begin() + offsets_[t],
+                               indices_.begin() + offsets_[t + 1]);
+}
+
+AxisAlignedBoundingBox PointCloudTiles::GetTileBoundingBox(size_t t) const {
+    if (t >= NumTiles()) {
+        utility::LogError("Tile index {} out of range [0, {}).", t,
+                          NumTiles());
+    }
+    const Eigen::Vector3i tile(
+            int(t % num_tiles_(0)), int(t / num_tiles_(0) % num_tiles_(1)),
+            int(t / (size_t(num_tiles_(0)) * num_tiles_(1))));
+    Eigen::Vector3d min_bound, max_bound;
+    for (int a = 0; a < 3; a++) {
+        if (std::isinf(tile_size_(a))) {
+            min_bound(a) = -std::numeric_limits<double>::infinity();
+            max_bound(a) = std::numeric_limits<double>::infinity();
+        } else {
+            min_bound(a) = origin_(a) + tile(a) * tile_size_(a) - overlap_;
+            max_bound(a) = min_bound(a) + tile_size_(a) + 2 * overlap_;
+        }
+    }
+    return AxisAlignedBoundingBox(min_bound, max_bound);
+}
+
+PointCloudTiles PointCloud::ComputeTiles(const Eigen::Vector3d &tile_size,
+                                         double overlap /* = 0.0 */) const {
+    if (!(tile_size.array() > 0).all()) {
+        utility::LogError("[ComputeTiles] tile_size must be positive.");
+    }
+    if (!(overlap >= 0)) {
+        utility::LogError("[ComputeTiles] overlap must not be negative.");
+    }
+    PointCloudTiles tiles;
+    tiles.tile_size_ = tile_size;
+    tiles.overlap_ = overlap;
+    if (points_.empty()) {
+        return tiles;
+    }
+
+    tiles.origin_ = GetMinBound();
+    const Eigen::Vector3d extent = GetMaxBound() - tiles.origin_;
+    double num_tiles = 1;
+    for (int a = 0; a < 3; a++) {
+        const double n = std::max(1.0, std::ceil(extent(a) / tile_size(a)));
+        num_tiles *= n;
+        tiles.num_tiles_(a) =
+                int(std::min(n, double(std::numeric_limits<int>::max())));
+    }
+    if (num_tiles > double(std::numeric_limits<int>::max())) {
+        utility::LogError("[ComputeTiles] Too many tiles ({}), use a larger "
+                          "tile_size.",
+                          num_tiles);
+    }
+
+    // Range of tiles [lo, hi] of a point along every axis. Tiles are
+    // half-open, except that the last tile includes the maximum bound.
+    const Eigen::Vector3d origin = tiles.origin_;
+    const Eigen::Vector3i dims = tiles.num_tiles_;
+    auto get_range = [&](const Eigen::Vector3d &point, Eigen::Vector3i &lo,
+                         Eigen::Vector3i &hi) {
+        for (int a = 0; a < 3; a++) {
+            const double x = point(a) - origin(a);
+            lo(a) = int(std::floor((x - overlap) / tile_size(a)));
+            hi(a) = int(std::floor((x + overlap) / tile_size(a)));
+            lo(a) = std::max(0, std::min(lo(a), dims(a) - 1));
+            hi(a) = std::max(0, std::min(hi(a), dims(a) - 1));
+        }
+    };
+
+    // Count the tiles of the points of every chunk, then write the
+    // (tile, point) pairs of every chunk at its offset.
+    const int64_t n = int64_t(points_.size());
+    const int64_t num_chunks =
+            utility::detail::GetNumChunks(0, n, kTileGrainSize);
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, n);
+        Eigen::Vector3i lo, hi;
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; i++) {
+            if (points_[i].allFinite()) {
+                get_range(points_[i], lo, hi);
+                count += int64_t(hi(0) - lo(0) + 1) * (hi(1) - lo(1) + 1) *
+                         (hi(2) - lo(2) + 1);
+            }
+        }
+        chunk_offsets[chunk_idx + 1] = count;
+    });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; chunk_idx++) {
+        chunk_offsets[chunk_idx + 1] += chunk_offsets[chunk_idx];
+    }
+
+    std::vector<uint32_t> keys(chunk_offsets[num_chunks]);
+    std::vector<int64_t> indices(chunk_offsets[num_chunks]);
+    utility::ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t begin = chunk_idx * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, n);
+        Eigen::Vector3i lo, hi;
+        int64_t dst_idx = chunk_offsets[chunk_idx];
+        for (int64_t idx = begin; idx < end; idx++) {
+            if (!points_[idx].allFinite()) {
+                continue;
+            }
+            get_range(points_[idx], lo, hi);
+            for (int k = lo(2); k <= hi(2); k++) {
+                for (int j = lo(1); j <= hi(1); j++) {
+                    for (int i = lo(0); i <= hi(0); i++) {
+                        keys[dst_idx] = uint32_t(
+                                i + size_t(dims(0)) * (j + dims(1) * k));
+                        indices[dst_idx] = idx;
+                        dst_idx++;
+                    }
+                }
+            }
+        }
+    });
+
+    // The sort is stable, so the points of every tile stay in increasing
+    // order.
+    utility::ParallelRadixSortPairs(keys, indices);
+
+    const int64_t num_tiles_total = int64_t(num_tiles);
+    tiles.offsets_.resize(num_tiles_total + 1);
+    utility::ParallelFor(0, num_tiles_total + 1, [&](int64_t t) {
+        tiles.offsets_[t] = size_t(
+                std::lower_bound(keys.begin(), keys.end(), uint32_t(t)) -
+                keys.begin());
+    });
+    tiles.indices_.assign(indices.begin(), indices.end());
+    return tiles;
+}
+
+}  // namespace geometry
+}  // namespace open3d
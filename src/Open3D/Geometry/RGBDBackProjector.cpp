@@ -0,0 +1,285 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RGBDBackProjector.h"
+
+#include <Eigen/Dense>
+#include <limits>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Rows per task of the parallel loops, a VGA row has 640 pixels.
+constexpr int64_t kRowGrainSize = 8;
+
+/// Reads uint16_t depth, scaled as Image::ConvertDepthToFloatImage does.
+class UInt16DepthReader {
+public:
+    UInt16DepthReader(const Image &depth, double depth_scale)
+        : data_((const uint16_t *)depth.data_.data()),
+          width_(depth.width_),
+          scale_((float)depth_scale) {}
+    double operator()(int u, int v) const {
+        return (double)((float)data_[size_t(v) * width_ + u] / scale_);
+    }
+
+private:
+    const uint16_t *data_;
+    int width_;
+    float scale_;
+};
+
+class FloatDepthReader {
+public:
+    FloatDepthReader(const Image &depth)
+        : data_((const float *)depth.data_.data()), width_(depth.width_) {}
+    double operator()(int u, int v) const {
+        return (double)data_[size_t(v) * width_ + u];
+    }
+
+private:
+    const float *data_;
+    int width_;
+};
+
+/// Reads the color of a pixel of an image with NC channels of type TC.
+template <typename TC, int NC>
+class ColorReader {
+public:
+    ColorReader(const Image &color)
+        : data_((const TC *)color.data_.data()), width_(color.width_) {}
+    Eigen::Vector3d operator()(int u, int v) const {
+        const double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
+        const TC *pc = data_ + (size_t(v) * width_ + u) * NC;
+        return Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) / scale;
+    }
+    Eigen::Vector3d Invalid() const {
+        return Eigen::Vector3d::Constant(std::numeric_limits<TC>::quiet_NaN());
+    }
+
+private:
+    const TC *data_;
+    int width_;
+};
+
+/// Without colors.
+class NoColorReader {
+public:
+    Eigen::Vector3d operator()(int u, int v) const {
+        return Eigen::Vector3d::Zero();
+    }
+    Eigen::Vector3d Invalid() const { return Eigen::Vector3d::Zero(); }
+};
+
+}  // unnamed namespace
+
+void RGBDBackProjector::UpdateRays(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        int width,
+        int height) {
+    const auto focal_length = intrinsic.GetFocalLength();
+    const auto principal_point = intrinsic.GetPrincipalPoint();
+    const Eigen::Vector4d key(focal_length.first, focal_length.second,
+                              principal_point.first, principal_point.second);
+    if (key == rays_intrinsic_ && width == rays_width_ &&
+        height == rays_height_ && stride_ == rays_stride_) {
+        return;
+    }
+    ray_x_.clear();
+    for (int u = 0; u < width; u += stride_) {
+        ray_x_.push_back((u - principal_point.first) / focal_length.first);
+    }
+    ray_y_.clear();
+    for (int v = 0; v < height; v += stride_) {
+        ray_y_.push_back((v - principal_point.second) / focal_length.second);
+    }
+    rays_intrinsic_ = key;
+    rays_width_ = width;
+    rays_height_ = height;
+    rays_stride_ = stride_;
+}
+
+/// Projects the sampled pixels in two parallel passes. The first counts the
+/// output points of every row, the second writes them at the row offsets.
+/// The output is in row-major pixel order, as a serial loop would produce.
+template <typename DepthReader, typename ColorReader>
+static void BackProject(const DepthReader &depth,
+                        const ColorReader &color,
+                        bool with_colors,
+                        const std::vector<double> &ray_x,
+                        const std::vector<double> &ray_y,
+                        int stride,
+                        double depth_min,
+                        double depth_max,
+                        bool project_valid_depth_only,
+                        const Eigen::Matrix4d &extrinsic,
+                        std::vector<int> &row_offsets,
+                        PointCloud &pointcloud) {
+    const int num_rows = int(ray_y.size());
+    const int num_cols = int(ray_x.size());
+    row_offsets.resize(num_rows + 1);
+    row_offsets[0] = 0;
+    if (project_valid_depth_only) {
+        utility::ParallelFor(
+                0, num_rows,
+                [&](int64_t r) {
+                    const int v = int(r) * stride;
+                    int count = 0;
+                    for (int c = 0; c < num_cols; c++) {
+                        const double z = depth(c * stride, v);
+                        count += (z > depth_min && z < depth_max) ? 1 : 0;
+                    }
+                    row_offsets[r + 1] = count;
+                },
+                kRowGrainSize);
+        for (int r = 0; r < num_rows; r++) {
+            row_offsets[r + 1] += row_offsets[r];
+        }
+    } else {
+        for (int r = 0; r < num_rows; r++) {
+            row_offsets[r + 1] = row_offsets[r] + num_cols;
+        }
+    }
+
+    const size_t num_points = size_t(row_offsets[num_rows]);
+    pointcloud.points_.resize(num_points);
+    pointcloud.normals_.clear();
+    if (with_colors) {
+        pointcloud.colors_.resize(num_points);
+    } else {
+        pointcloud.colors_.clear();
+    }
+
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const Eigen::Vector3d nan_point = Eigen::Vector3d::Constant(
+            std::numeric_limits<float>::quiet_NaN());
+    utility::ParallelFor(
+            0, num_rows,
+            [&](int64_t r) {
+                // Local copies, the stores to the points may not alias them.
+                const Eigen::Vector3d rotation_x =
+                        camera_pose.block<3, 1>(0, 0);
+                const Eigen::Vector3d translation =
+                        camera_pose.block<3, 1>(0, 3);
+                // The ray of pixel (u, v) in the world frame is
+                // rotation_x * ray_x[c] + ray_row.
+                const Eigen::Vector3d ray_row =
+                        camera_pose.block<3, 1>(0, 1) * ray_y[r] +
+                        camera_pose.block<3, 1>(0, 2);
+                const int v = int(r) * stride;
+                Eigen::Vector3d *points =
+                        pointcloud.points_.data() + row_offsets[r];
+                Eigen::Vector3d *colors =
+                        with_colors ? pointcloud.colors_.data() + row_offsets[r]
+                                    : nullptr;
+                for (int c = 0; c < num_cols; c++) {
+                    const int u = c * stride;
+                    const double z = depth(u, v);
+                    if (z > depth_min && z < depth_max) {
+                        *points++ = (rotation_x * ray_x[c] + ray_row) * z +
+                                    translation;
+                        if (with_colors) {
+                            *colors++ = color(u, v);
+                        }
+                    } else if (!project_valid_depth_only) {
+                        *points++ = nan_point;
+                        if (with_colors) {
+                            *colors++ = color.Invalid();
+                        }
+                    }
+                }
+            },
+            kRowGrainSize);
+}
+
+void RGBDBackProjector::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        PointCloud &pointcloud) {
+    if (stride_ < 1) {
+        utility::LogError("[CreatePointCloudFromDepthImage] Invalid stride.");
+    }
+    UpdateRays(intrinsic, depth.width_, depth.height_);
+    if (depth.num_of_channels_ == 1 && depth.bytes_per_channel_ == 2) {
+        BackProject(UInt16DepthReader(depth, depth_scale_), NoColorReader(),
+                    false, ray_x_, ray_y_, stride_, depth_min_, depth_max_,
+                    project_valid_depth_only_, extrinsic, row_offsets_,
+                    pointcloud);
+    } else if (depth.num_of_channels_ == 1 && depth.bytes_per_channel_ == 4) {
+        BackProject(FloatDepthReader(depth), NoColorReader(), false, ray_x_,
+                    ray_y_, stride_, depth_min_, depth_max_,
+                    project_valid_depth_only_, extrinsic, row_offsets_,
+                    pointcloud);
+    } else {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+    }
+}
+
+void RGBDBackProjector::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        PointCloud &pointcloud) {
+    if (stride_ < 1) {
+        utility::LogError("[CreatePointCloudFromRGBDImage] Invalid stride.");
+    }
+    const Image &depth = image.depth_;
+    const Image &color = image.color_;
+    if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4 ||
+        color.width_ != depth.width_ || color.height_ != depth.height_) {
+        utility::LogError(
+                "[CreatePointCloudFromRGBDImage] Unsupported image format.");
+    }
+    UpdateRays(intrinsic, depth.width_, depth.height_);
+    if (color.bytes_per_channel_ == 1 && color.num_of_channels_ == 3) {
+        BackProject(FloatDepthReader(depth), ColorReader<uint8_t, 3>(color),
+                    true, ray_x_, ray_y_, stride_, depth_min_, depth_max_,
+                    project_valid_depth_only_, extrinsic, row_offsets_,
+                    pointcloud);
+    } else if (color.bytes_per_channel_ == 4 && color.num_of_channels_ == 1) {
+        BackProject(FloatDepthReader(depth), ColorReader<float, 1>(color),
+                    true, ray_x_, ray_y_, stride_, depth_min_, depth_max_,
+                    project_valid_depth_only_, extrinsic, row_offsets_,
+                    pointcloud);
+    } else {
+        utility::LogError(
+                "[CreatePointCloudFromRGBDImage] Unsupported image format.");
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraIntrinsic;
+}
+
+namespace geometry {
+
+class Image;
+class PointCloud;
+class RGBDImage;
+
+/// \class RGBDBackProjector
+///
+/// \brief Back-projects the depth or RGB-D images of a camera into point
+/// clouds, frame after frame.
+///
+/// The rays of the sampled pixel columns and rows are cached until the
+/// intrinsic, the image size or the stride change. The output point cloud is
+/// overwritten in place, so its capacity is reused across frames. The rows of
+/// an image are projected in parallel.
+class RGBDBackProjector {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param depth_scale The depth of uint16_t images is scaled by
+    /// 1 / \p depth_scale.
+    /// \param depth_min Pixels with a depth of at most \p depth_min are
+    /// invalid.
+    /// \param depth_max Pixels with a depth of at least \p depth_max are
+    /// invalid.
+    /// \param stride Only every stride-th row and column is projected.
+    /// \param project_valid_depth_only If false, invalid pixels result in NaN
+    /// points.
+    RGBDBackProjector(double depth_scale = 1000.0,
+                      double depth_min = 0.0,
+                      double depth_max = 1000.0,
+                      int stride = 1,
+                      bool project_valid_depth_only = true)
+        : depth_scale_(depth_scale),
+          depth_min_(depth_min),
+          depth_max_(depth_max),
+          stride_(stride),
+          project_valid_depth_only_(project_valid_depth_only) {}
+    ~RGBDBackProjector() {}
+
+public:
+    /// \brief Back-projects a float or uint16_t depth image into \p pointcloud.
+    ///
+    /// Given depth value d at (u, v) image coordinate, the corresponding 3d
+    /// point is: z = d / depth_scale\n x = (u - cx) * z / fx\n
+    /// y = (v - cy) * z / fy\n. Float depth is not scaled.
+    void CreateFromDepthImage(const Image &depth,
+                              const camera::PinholeCameraIntrinsic &intrinsic,
+                              const Eigen::Matrix4d &extrinsic,
+                              PointCloud &pointcloud);
+
+    /// \brief Back-projects an RGB-D image with float depth and either uint8_t
+    /// RGB or float intensity color into \p pointcloud, with colors.
+    void CreateFromRGBDImage(const RGBDImage &image,
+                             const camera::PinholeCameraIntrinsic &intrinsic,
+                             const Eigen::Matrix4d &extrinsic,
+                             PointCloud &pointcloud);
+
+private:
+    void UpdateRays(const camera::PinholeCameraIntrinsic &intrinsic,
+                    int width,
+                    int height);
+
+public:
+    /// The depth of uint16_t images is scaled by 1 / depth_scale_.
+    double depth_scale_;
+    /// Pixels with a depth of at most depth_min_ are invalid.
+    double depth_min_;
+    /// Pixels with a depth of at least depth_max_ are invalid.
+    double depth_max_;
+    /// Only every stride_-th row and column is projected.
+    int stride_;
+    /// If false, invalid pixels result in NaN points.
+    bool project_valid_depth_only_;
+
+private:
+    /// Key of the cached rays.
+    Eigen::Vector4d rays_intrinsic_ = Eigen::Vector4d::Zero();
+    int rays_width_ = 0;
+    int rays_height_ = 0;
+    int rays_stride_ = 0;
+    /// (u - cx) / fx of the sampled columns.
+    std::vector<double> ray_x_;
+    /// (v - cy) / fy of the sampled rows.
+    std::vector<double> ray_y_;
+    /// Number of output points of each sampled row.
+    std::vector<int> row_offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,317 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RGBDImageUndistorter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Rows per task of the parallel loops, a VGA row has 640 pixels.
+constexpr int64_t kRowGrainSize = 8;
+
+/// Cached remap tables of RGBDImageUndistorter.
+struct UndistortionMap {
+    const int *index_;
+    const float *weight_x_;
+    const float *weight_y_;
+    const int *nearest_;
+    int width_;
+};
+
+/// Bilinear interpolation of value(i) around the top left pixel \p i.
+template <typename Value>
+inline float Interpolate(const Value &value,
+                         int i,
+                         int width,
+                         float weight_x,
+                         float weight_y) {
+    const float top = (1.0f - weight_x) * value(i) + weight_x * value(i + 1);
+    const float bottom = (1.0f - weight_x) * value(i + width) +
+                         weight_x * value(i + width + 1);
+    return (1.0f - weight_y) * top + weight_y * bottom;
+}
+
+/// Intensity of a pixel of an image with NC channels of type TC, as
+/// Image::CreateFloatImage computes it with the weighted conversion.
+template <typename TC, int NC>
+class IntensityReader {
+public:
+    IntensityReader(const Image &color)
+        : data_((const TC *)color.data_.data()) {}
+    float operator()(int i) const {
+        const TC *pc = data_ + size_t(i) * NC;
+        const float intensity =
+                (NC == 1) ? (float)pc[0]
+                          : 0.2990f * (float)pc[0] + 0.5870f * (float)pc[1] +
+                                    0.1140f * (float)pc[2];
+        return (sizeof(TC) == 1) ? intensity / 255.0f : intensity;
+    }
+
+private:
+    const TC *data_;
+};
+
+/// Reads channel \p ch of a pixel of an image with NC channels of type TC.
+template <typename TC, int NC>
+class ChannelReader {
+public:
+    ChannelReader(const Image &color, int ch)
+        : data_((const TC *)color.data_.data()), ch_(ch) {}
+    float operator()(int i) const {
+        return (float)data_[size_t(i) * NC + ch_];
+    }
+
+private:
+    const TC *data_;
+    int ch_;
+};
+
+template <typename TC>
+inline TC RoundChannel(float value) {
+    return TC(value + 0.5f);
+}
+
+template <>
+inline float RoundChannel<float>(float value) {
+    return value;
+}
+
+template <typename TC, int NC>
+void UndistortIntensity(const Image &color,
+                        const UndistortionMap &map,
+                        Image &output) {
+    output.Prepare(color.width_, color.height_, 1, 4);
+    const IntensityReader<TC, NC> intensity(color);
+    float *out = (float *)output.data_.data();
+    utility::ParallelFor(
+            0, color.height_,
+            [&](int64_t v) {
+                const int begin = int(v) * map.width_;
+                for (int i = begin; i < begin + map.width_; i++) {
+                    const int index = map.index_[i];
+                    out[i] = index < 0 ? 0.0f
+                                       : Interpolate(intensity, index,
+                                                     map.width_,
+                                                     map.weight_x_[i],
+                                                     map.weight_y_[i]);
+                }
+            },
+            kRowGrainSize);
+}
+
+template <typename TC, int NC>
+void UndistortColor(const Image &color,
+                    const UndistortionMap &map,
+                    Image &output) {
+    output.Prepare(color.width_, color.height_, NC, sizeof(TC));
+    TC *out = (TC *)output.data_.data();
+    utility::ParallelFor(
+            0, color.height_,
+            [&](int64_t v) {
+                const int begin = int(v) * map.width_;
+                for (int i = begin; i < begin + map.width_; i++) {
+                    const int index = map.index_[i];
+                    for (int ch = 0; ch < NC; ch++) {
+                        out[size_t(i) * NC + ch] =
+                                index < 0 ? TC(0)
+                                          : RoundChannel<TC>(Interpolate(
+                                                    ChannelReader<TC, NC>(
+                                                            color, ch),
+                                                    index, map.width_,
+                                                    map.weight_x_[i],
+                                                    map.weight_y_[i]));
+                    }
+                }
+            },
+            kRowGrainSize);
+}
+
+template <typename TD>
+void UndistortDepth(const Image &depth,
+                    const UndistortionMap &map,
+                    double depth_scale,
+                    double depth_trunc,
+                    Image &output) {
+    output.Prepare(depth.width_, depth.height_, 1, 4);
+    const TD *in = (const TD *)depth.data_.data();
+    float *out = (float *)output.data_.data();
+    // Scaled in float as in Image::ConvertDepthToFloatImage.
+    const float scale = (float)depth_scale;
+    utility::ParallelFor(
+            0, depth.height_,
+            [&](int64_t v) {
+                const int begin = int(v) * map.width_;
+                for (int i = begin; i < begin + map.width_; i++) {
+                    const int nearest = map.nearest_[i];
+                    const float d =
+                            nearest < 0 ? 0.0f : (float)in[nearest] / scale;
+                    out[i] = d >= depth_trunc ? 0.0f : d;
+                }
+            },
+            kRowGrainSize);
+}
+
+template <int NC>
+void UndistortColorImage(const Image &color,
+                         const UndistortionMap &map,
+                         bool convert_rgb_to_intensity,
+                         Image &output) {
+    if (convert_rgb_to_intensity) {
+        if (color.bytes_per_channel_ == 1) {
+            UndistortIntensity<uint8_t, NC>(color, map, output);
+        } else if (color.bytes_per_channel_ == 2) {
+            UndistortIntensity<uint16_t, NC>(color, map, output);
+        } else {
+            UndistortIntensity<float, NC>(color, map, output);
+        }
+    } else {
+        if (color.bytes_per_channel_ == 1) {
+            UndistortColor<uint8_t, NC>(color, map, output);
+        } else if (color.bytes_per_channel_ == 2) {
+            UndistortColor<uint16_t, NC>(color, map, output);
+        } else {
+            UndistortColor<float, NC>(color, map, output);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+void RGBDImageUndistorter::UpdateMap(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        int width,
+        int height) {
+    const Eigen::Matrix3d &K = intrinsic.intrinsic_matrix_;
+    const Eigen::Matrix<double, 5, 1> &coeffs = intrinsic.distortion_coeffs_;
+    const std::vector<double> key = {K(0, 0),   K(1, 1),   K(0, 2),
+                                     K(1, 2),   K(0, 1),   coeffs(0),
+                                     coeffs(1), coeffs(2), coeffs(3),
+                                     coeffs(4)};
+    if (key == map_intrinsic_ && width == map_width_ &&
+        height == map_height_) {
+        return;
+    }
+    const size_t num_pixels = size_t(width) * height;
+    const bool has_distortion = intrinsic.HasDistortion();
+    map_index_.resize(num_pixels);
+    map_weight_x_.resize(num_pixels);
+    map_weight_y_.resize(num_pixels);
+    map_nearest_.resize(num_pixels);
+    utility::ParallelFor(
+            0, height,
+            [&](int64_t v) {
+                for (int u = 0; u < width; u++) {
+                    // Undistorted pixel to normalized coordinates, distorted
+                    // and back to pixel coordinates. Without distortion, the
+                    // map is the identity, without round-off at the borders.
+                    double u_d = u;
+                    double v_d = double(v);
+                    if (has_distortion) {
+                        const double y = (v - K(1, 2)) / K(1, 1);
+                        const double x =
+                                (u - K(0, 2) - K(0, 1) * y) / K(0, 0);
+                        const Eigen::Vector2d xy_d =
+                                intrinsic.DistortNormalizedPoint(
+                                        Eigen::Vector2d(x, y));
+                        u_d = K(0, 0) * xy_d(0) + K(0, 1) * xy_d(1) + K(0, 2);
+                        v_d = K(1, 1) * xy_d(1) + K(1, 2);
+                    }
+                    const size_t i = size_t(v) * width + u;
+                    if (!(u_d >= 0.0 && u_d <= width - 1 && v_d >= 0.0 &&
+                          v_d <= height - 1)) {
+                        map_index_[i] = -1;
+                        map_weight_x_[i] = 0.0f;
+                        map_weight_y_[i] = 0.0f;
+                        map_nearest_[i] = -1;
+                        continue;
+                    }
+                    // The top left pixel is at most at (width - 2,
+                    // height - 2), the weights are in [0, 1].
+                    const int u0 = std::min(int(u_d), width - 2);
+                    const int v0 = std::min(int(v_d), height - 2);
+                    map_index_[i] = v0 * width + u0;
+                    map_weight_x_[i] = float(u_d - u0);
+                    map_weight_y_[i] = float(v_d - v0);
+                    map_nearest_[i] = int(std::round(v_d)) * width +
+                                      int(std::round(u_d));
+                }
+            },
+            kRowGrainSize);
+    map_intrinsic_ = key;
+    map_width_ = width;
+    map_height_ = height;
+}
+
+void RGBDImageUndistorter::CreateFromColorAndDepth(
+        const Image &color,
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        RGBDImage &image) {
+    if (color.height_ != depth.height_ || color.width_ != depth.width_ ||
+        depth.width_ < 2 || depth.height_ < 2 ||
+        depth.num_of_channels_ != 1 ||
+        (depth.bytes_per_channel_ != 2 && depth.bytes_per_channel_ != 4) ||
+        (color.num_of_channels_ != 1 && color.num_of_channels_ != 3) ||
+        (color.bytes_per_channel_ != 1 && color.bytes_per_channel_ != 2 &&
+         color.bytes_per_channel_ != 4)) {
+        utility::LogError(
+                "[CreateFromColorAndDepth] Unsupported image format.");
+    }
+    UpdateMap(intrinsic, depth.width_, depth.height_);
+    const UndistortionMap map = {map_index_.data(), map_weight_x_.data(),
+                                 map_weight_y_.data(), map_nearest_.data(),
+                                 map_width_};
+
+    if (depth.bytes_per_channel_ == 2) {
+        UndistortDepth<uint16_t>(depth, map, depth_scale_, depth_trunc_,
+                                 image.depth_);
+    } else {
+        UndistortDepth<float>(depth, map, depth_scale_, depth_trunc_,
+                              image.depth_);
+    }
+
+    if (color.num_of_channels_ == 1) {
+        UndistortColorImage<1>(color, map, convert_rgb_to_intensity_,
+                               image.color_);
+    } else {
+        UndistortColorImage<3>(color, map, convert_rgb_to_intensity_,
+                               image.color_);
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraIntrinsic;
+}
+
+namespace geometry {
+
+class Image;
+class RGBDImage;
+
+/// \class RGBDImageUndistorter
+///
+/// \brief Removes the lens distortion of the color and depth images of a
+/// camera while converting them into RGB-D images, frame after frame.
+///
+/// The undistorted image has the intrinsic matrix of the camera. For every
+/// undistorted pixel, the position of its distorted pixel is cached until the
+/// intrinsic, the distortion coefficients or the image size change. Color is
+/// interpolated bilinearly and depth is sampled at the nearest pixel, so that
+/// depth is not blended across surfaces. Pixels outside of the distorted
+/// image are 0. The conversion and the undistortion of an image are a single
+/// pass over its rows in parallel, and the output RGB-D image is overwritten
+/// in place, so its buffers are reused across frames.
+class RGBDImageUndistorter {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_trunc Depth values at least \p depth_trunc are 0.
+    /// \param convert_rgb_to_intensity Whether to convert the color into a
+    /// float intensity image.
+    RGBDImageUndistorter(double depth_scale = 1000.0,
+                         double depth_trunc = 3.0,
+                         bool convert_rgb_to_intensity = true)
+        : depth_scale_(depth_scale),
+          depth_trunc_(depth_trunc),
+          convert_rgb_to_intensity_(convert_rgb_to_intensity) {}
+    ~RGBDImageUndistorter() {}
+
+public:
+    /// \brief Undistorts \p color and \p depth into \p image, converted as
+    /// RGBDImage::CreateFromColorAndDepth does.
+    ///
+    /// \param color Color image of 1 or 3 channels of uint8_t, uint16_t or
+    /// float.
+    /// \param depth Depth image of 1 channel of uint16_t or float.
+    /// \param intrinsic Intrinsic and distortion of the camera.
+    /// \param image Output RGB-D image.
+    void CreateFromColorAndDepth(
+            const Image &color,
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            RGBDImage &image);
+
+private:
+    void UpdateMap(const camera::PinholeCameraIntrinsic &intrinsic,
+                   int width,
+                   int height);
+
+public:
+    /// The depth is scaled by 1 / depth_scale_.
+    double depth_scale_;
+    /// Depth values at least depth_trunc_ are 0.
+    double depth_trunc_;
+    /// Whether to convert the color into a float intensity image.
+    bool convert_rgb_to_intensity_;
+
+private:
+    /// Key of the cached map: fx, fy, cx, cy, skew and the distortion.
+    std::vector<double> map_intrinsic_;
+    int map_width_ = 0;
+    int map_height_ = 0;
+    /// Index of the top left of the 2x2 distorted pixels around the distorted
+    /// position of every undistorted pixel, -1 outside of the image.
+    std::vector<int> map_index_;
+    /// Bilinear weights of the right and bottom distorted pixels.
+    std::vector<float> map_weight_x_;
+    std::vector<float> map_weight_y_;
+    /// Index of the distorted pixel nearest to the distorted position, -1
+    /// outside of the image.
+    std::vector<int> map_nearest_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -29,11 +29,14 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 #include <Eigen/Dense>
 
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <numeric>
 
 namespace open3d {
 namespace geometry {
@@ -43,8 +46,39 @@ class BallPivotingEdge;
 class BallPivotingTriangle;
 
 typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+typedef BallPivotingEdge* BallPivotingEdgePtr;
+typedef BallPivotingTriangle* BallPivotingTrianglePtr;
+
+/// Allocates objects in blocks that are never reallocated, so pointers to them
+/// stay valid for the lifetime of the pool. All objects are released together.
+template <class T>
+class BallPivotingPool {
+public:
+    template <class... Args>
+    T* New(Args&&... args) {
+        if (blocks_.empty() ||
+            blocks_.back().size() == blocks_.back().capacity()) {
+            blocks_.emplace_back();
+            blocks_.back().reserve(kBlockSize);
+        }
+        blocks_.back().emplace_back(std::forward<Args>(args)...);
+        return &blocks_.back().back();
+    }
+
+    /// Calls func on every object in the order of allocation.
+    template <class Func>
+    void ForEach(Func func) {
+        for (std::vector<T>& block : blocks_) {
+            for (T& object : block) {
+                func(object);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kBlockSize = 4096;
+    std::vector<std::vector<T>> blocks_;
+};
 
 class BallPivotingVertex {
 public:
@@ -55,13 +89,14 @@ public:
                        const Eigen::Vector3d& normal)
         : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
 
+    void AddEdge(BallPivotingEdgePtr edge);
     void UpdateType();
 
 public:
     int idx_;
     const Eigen::Vector3d& point_;
     const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    std::vector<BallPivotingEdgePtr> edges_;
     Type type_;
 };
 
@@ -70,7 +105,11 @@ public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
     BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+        : source_(source),
+          target_(target),
+          triangle0_(nullptr),
+          triangle1_(nullptr),
+          type_(Type::Front) {}
 
     void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
     BallPivotingVertexPtr GetOppositeVertex();
@@ -101,6 +140,13 @@ public:
     Eigen::Vector3d ball_center_;
 };
 
+void BallPivotingVertex::AddEdge(BallPivotingEdgePtr edge) {
+    // A vertex has only a handful of edges, a linear search beats hashing.
+    if (std::find(edges_.begin(), edges_.end(), edge) == edges_.end()) {
+        edges_.push_back(edge);
+    }
+}
+
 void BallPivotingVertex::UpdateType() {
     if (edges_.empty()) {
         type_ = Type::Orphan;
@@ -136,7 +182,7 @@ void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
             triangle1_ = triangle;
             type_ = Type::Inner;
         } else {
-            utility::LogDebug("!!! This case should not happen");
+            OPEN3D_LOG_DEBUG("!!! This case should not happen");
         }
     }
 }
@@ -159,33 +205,29 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
 
 class BallPivoting {
 public:
+    /// The triangles of the returned mesh index the points of \p pcd, but it
+    /// has no vertices, see SetVertices. \p pcd has to outlive the object.
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+        : kdtree_(pcd), seed_vertices_(pcd.points_.size()) {
         mesh_ = std::make_shared<TriangleMesh>();
-        mesh_->vertices_ = pcd.points_;
-        mesh_->vertex_normals_ = pcd.normals_;
-        mesh_->vertex_colors_ = pcd.colors_;
+        vertices.reserve(pcd.points_.size());
         for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+            vertices.emplace_back(static_cast<int>(vidx), pcd.points_[vidx],
+                                  pcd.normals_[vidx]);
         }
+        std::iota(seed_vertices_.begin(), seed_vertices_.end(), 0);
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
-    }
+    virtual ~BallPivoting() {}
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
                            Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+        const Eigen::Vector3d& v1 = vertices[vidx1].point_;
+        const Eigen::Vector3d& v2 = vertices[vidx2].point_;
+        const Eigen::Vector3d& v3 = vertices[vidx3].point_;
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -216,9 +258,9 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm = vertices[vidx1].normal_ +
+                                      vertices[vidx2].normal_ +
+                                      vertices[vidx3].normal_;
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -233,12 +275,9 @@ public:
 
     BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
                                        const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+        for (BallPivotingEdgePtr edge : v0->edges_) {
+            if (edge->source_ == v1 || edge->target_ == v1) {
+                return edge;
             }
         }
         return nullptr;
@@ -248,35 +287,35 @@ public:
                         const BallPivotingVertexPtr& v1,
                         const BallPivotingVertexPtr& v2,
                         const Eigen::Vector3d& center) {
-        utility::LogDebug(
+        OPEN3D_LOG_DEBUG(
                 "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
                 v0->idx_, v1->idx_, v2->idx_);
         BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
+                triangles_.New(v0, v1, v2, center);
 
         BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
         if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+            e0 = edges_.New(v0, v1);
         }
         e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+        v0->AddEdge(e0);
+        v1->AddEdge(e0);
 
         BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
         if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+            e1 = edges_.New(v1, v2);
         }
         e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+        v1->AddEdge(e1);
+        v2->AddEdge(e1);
 
         BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
         if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+            e2 = edges_.New(v2, v0);
         }
         e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
+        v2->AddEdge(e2);
+        v0->AddEdge(e2);
 
         v0->UpdateType();
         v1->UpdateType();
@@ -308,8 +347,8 @@ public:
     bool IsCompatible(const BallPivotingVertexPtr& v0,
                       const BallPivotingVertexPtr& v1,
                       const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+        OPEN3D_LOG_DEBUG("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
+                         v0->idx_, v1->idx_, v2->idx_);
         Eigen::Vector3d normal =
                 ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
         if (normal.dot(v0->normal_) < -1e-16) {
@@ -318,7 +357,7 @@ public:
         bool ret = normal.dot(v0->normal_) > -1e-16 &&
                    normal.dot(v1->normal_) > -1e-16 &&
                    normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
+        OPEN3D_LOG_DEBUG("[IsCompatible] returns = {}", ret);
         return ret;
     }
 
@@ -326,31 +365,31 @@ public:
             const BallPivotingEdgePtr& edge,
             double radius,
             Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] edge=({}, {}), radius={}",
+                         edge->source_->idx_, edge->target_->idx_, radius);
         BallPivotingVertexPtr src = edge->source_;
         BallPivotingVertexPtr tgt = edge->target_;
 
         const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] edge=({}, {}), opp={}",
+                         src->idx_, tgt->idx_, opp->idx_);
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] src={} => {}", src->idx_,
+                         src->point_.transpose());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
+                         tgt->point_.transpose());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] src={} => {}", opp->idx_,
+                         opp->point_.transpose());
 
         Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] edge=({}, {}), mp={}",
+                         edge->source_->idx_, edge->target_->idx_,
+                         mp.transpose());
 
         BallPivotingTrianglePtr triangle = edge->triangle0_;
         const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] edge=({}, {}), center={}",
+                         edge->source_->idx_, edge->target_->idx_,
+                         center.transpose());
 
         Eigen::Vector3d v = tgt->point_ - src->point_;
         v /= v.norm();
@@ -361,24 +400,24 @@ public:
         std::vector<int> indices;
         std::vector<double> dists2;
         kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
+        OPEN3D_LOG_DEBUG("[FindCandidateVertex] found {} potential candidates",
+                         indices.size());
 
         BallPivotingVertexPtr min_candidate = nullptr;
         double min_angle = 2 * M_PI;
         for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
+            OPEN3D_LOG_DEBUG("[FindCandidateVertex] nbidx {:d}", nbidx);
+            const BallPivotingVertexPtr candidate = &vertices[nbidx];
             if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
                 candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
+                OPEN3D_LOG_DEBUG(
                         "[FindCandidateVertex] candidate {:d} is a triangle "
                         "vertex of the edge",
                         candidate->idx_);
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
+            OPEN3D_LOG_DEBUG("[FindCandidateVertex] candidate={:d} => {}",
+                             candidate->idx_, candidate->point_.transpose());
 
             bool coplanar = IntersectionTest::PointsCoplanar(
                     src->point_, tgt->point_, opp->point_, candidate->point_);
@@ -388,7 +427,7 @@ public:
                              IntersectionTest::LineSegmentsMinimumDistance(
                                      mp, candidate->point_, tgt->point_,
                                      opp->point_) < 1e-12)) {
-                utility::LogDebug(
+                OPEN3D_LOG_DEBUG(
                         "[FindCandidateVertex] candidate {:d} is intersecting "
                         "the existing triangle",
                         candidate->idx_);
@@ -398,18 +437,18 @@ public:
             Eigen::Vector3d new_center;
             if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
                                    radius, new_center)) {
-                utility::LogDebug(
+                OPEN3D_LOG_DEBUG(
                         "[FindCandidateVertex] candidate {:d} can not compute "
                         "ball",
                         candidate->idx_);
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
+            OPEN3D_LOG_DEBUG("[FindCandidateVertex] candidate {:d} center={}",
+                             candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
+            OPEN3D_LOG_DEBUG(
                     "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
                     candidate->idx_, v.transpose(), a.transpose(),
                     b.transpose());
@@ -417,7 +456,7 @@ public:
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
+            OPEN3D_LOG_DEBUG(
                     "[FindCandidateVertex] candidate {:d} cosinus={:f}",
                     candidate->idx_, cosinus);
 
@@ -429,7 +468,7 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
+                OPEN3D_LOG_DEBUG(
                         "[FindCandidateVertex] candidate {:d} angle {:f} > "
                         "min_angle {:f}",
                         candidate->idx_, angle, min_angle);
@@ -438,13 +477,13 @@ public:
 
             bool empty_ball = true;
             for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
+                const BallPivotingVertexPtr nb = &vertices[nbidx2];
                 if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
                     nb->idx_ == candidate->idx_) {
                     continue;
                 }
                 if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
+                    OPEN3D_LOG_DEBUG(
                             "[FindCandidateVertex] candidate {:d} not an empty "
                             "ball",
                             candidate->idx_);
@@ -454,25 +493,25 @@ public:
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
+                OPEN3D_LOG_DEBUG("[FindCandidateVertex] candidate {:d} works",
+                                 candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
 
         if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
+            OPEN3D_LOG_DEBUG("[FindCandidateVertex] returns nullptr");
         } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
+            OPEN3D_LOG_DEBUG("[FindCandidateVertex] returns {:d}",
+                             min_candidate->idx_);
         }
         return min_candidate;
     }
 
     void ExpandTriangulation(double radius) {
-        utility::LogDebug("[ExpandTriangulation] radius={}", radius);
+        OPEN3D_LOG_DEBUG("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
             BallPivotingEdgePtr edge = edge_front_.front();
             edge_front_.pop_front();
@@ -519,7 +558,7 @@ public:
                          const std::vector<int>& nb_indices,
                          double radius,
                          Eigen::Vector3d& center) {
-        utility::LogDebug(
+        OPEN3D_LOG_DEBUG(
                 "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
                 "radius={}",
                 v0->idx_, v1->idx_, v2->idx_, radius);
@@ -531,20 +570,20 @@ public:
         BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
         BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
         if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
+            OPEN3D_LOG_DEBUG(
                     "[TryTriangleSeed] returns {} because e0 is inner edge",
                     false);
             return false;
         }
         if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
+            OPEN3D_LOG_DEBUG(
                     "[TryTriangleSeed] returns {} because e1 is inner edge",
                     false);
             return false;
         }
 
         if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
+            OPEN3D_LOG_DEBUG(
                     "[TryTriangleSeed] returns {} could not compute ball "
                     "center",
                     false);
@@ -553,13 +592,13 @@ public:
 
         // test if no other point is within the ball
         for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
+            const BallPivotingVertexPtr v = &vertices[nbidx];
             if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
                 v->idx_ == v2->idx_) {
                 continue;
             }
             if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
+                OPEN3D_LOG_DEBUG(
                         "[TryTriangleSeed] returns {} computed ball is not "
                         "empty",
                         false);
@@ -567,13 +606,13 @@ public:
             }
         }
 
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
+        OPEN3D_LOG_DEBUG("[TryTriangleSeed] returns {}", true);
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool TrySeed(BallPivotingVertexPtr v, double radius) {
+        OPEN3D_LOG_DEBUG("[TrySeed] with v.idx={}, radius={}", v->idx_,
+                         radius);
         std::vector<int> indices;
         std::vector<double> dists2;
         kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
@@ -582,7 +621,7 @@ public:
         }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
+            const BallPivotingVertexPtr nb0 = &vertices[indices[nbidx0]];
             if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
             }
@@ -594,7 +633,8 @@ public:
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
+                const BallPivotingVertexPtr nb1 =
+                        &vertices[indices[nbidx1]];
                 if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
@@ -608,7 +648,7 @@ public:
             }
 
             if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
+                const BallPivotingVertexPtr nb1 = &vertices[candidate_vidx2];
 
                 BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
                 if (e0 != nullptr &&
@@ -642,7 +682,7 @@ public:
                 }
 
                 if (edge_front_.size() > 0) {
-                    utility::LogDebug(
+                    OPEN3D_LOG_DEBUG(
                             "[TrySeed] edge_front_.size() > 0 => return "
                             "true");
                     return true;
@@ -650,79 +690,79 @@ public:
             }
         }
 
-        utility::LogDebug("[TrySeed] return false");
+        OPEN3D_LOG_DEBUG("[TrySeed] return false");
         return false;
     }
 
     void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
+        for (int vidx : seed_vertices_) {
+            OPEN3D_LOG_DEBUG("[FindSeedTriangle] with radius={}, vidx={}",
+                             radius, vidx);
+            if (vertices[vidx].type_ == BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(&vertices[vidx], radius)) {
                     ExpandTriangulation(radius);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
-        }
+    /// Puts the border edges of the previous radius whose triangle admits an
+    /// empty ball of \p radius back to the front.
+    void ReactivateBorderEdges(double radius) {
+        size_t num_border_edges = 0;
+        for (BallPivotingEdgePtr edge : border_edges_) {
+            BallPivotingTrianglePtr triangle = edge->triangle0_;
+            OPEN3D_LOG_DEBUG(
+                    "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                    edge->source_->idx_, edge->target_->idx_,
+                    triangle->vert0_->idx_, triangle->vert1_->idx_,
+                    triangle->vert2_->idx_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle->vert0_->idx_,
+                                  triangle->vert1_->idx_,
+                                  triangle->vert2_->idx_, radius, center)) {
+                OPEN3D_LOG_DEBUG("[Run]   yes, we can work on this");
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle->vert0_->idx_ &&
+                        idx != triangle->vert1_->idx_ &&
+                        idx != triangle->vert2_->idx_) {
+                        OPEN3D_LOG_DEBUG(
+                                "[Run]   but no, the ball is not empty");
+                        empty_ball = false;
+                        break;
+                    }
+                }
 
-        mesh_->triangles_.clear();
+                if (empty_ball) {
+                    OPEN3D_LOG_DEBUG(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    edge->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(edge);
+                    continue;
+                }
+            }
+            border_edges_[num_border_edges++] = edge;
+        }
+        border_edges_.resize(num_border_edges);
+    }
 
+    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
-            utility::LogDebug("[Run] change to radius {:.4f}", radius);
+            OPEN3D_LOG_DEBUG("[Run] ################################");
+            OPEN3D_LOG_DEBUG("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
                 utility::LogError(
                         "got an invalid, negative radius as parameter");
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            ReactivateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -731,26 +771,256 @@ public:
                 ExpandTriangulation(radius);
             }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+            OPEN3D_LOG_DEBUG("[Run] mesh_ has {:d} triangles",
+                             mesh_->triangles_.size());
+            OPEN3D_LOG_DEBUG("[Run] ################################");
+        }
+        return mesh_;
+    }
+
+    /// Restricts FindSeedTriangle to \p seed_vertices.
+    void SetSeedVertices(std::vector<int> seed_vertices) {
+        seed_vertices_ = std::move(seed_vertices);
+    }
+
+    /// Creates a triangle found by another BallPivoting object, which updates
+    /// the front as if it had been found by this one.
+    void AddTriangle(int vidx0,
+                     int vidx1,
+                     int vidx2,
+                     const Eigen::Vector3d& center) {
+        CreateTriangle(&vertices[vidx0], &vertices[vidx1], &vertices[vidx2],
+                       center);
+    }
+
+    /// Calls func(vidx0, vidx1, vidx2, ball_center) for every created
+    /// triangle, in the order of creation.
+    template <class Func>
+    void ForEachTriangle(Func func) {
+        triangles_.ForEach([&](const BallPivotingTriangle& triangle) {
+            func(triangle.vert0_->idx_, triangle.vert1_->idx_,
+                 triangle.vert2_->idx_, triangle.ball_center_);
+        });
+    }
+
+    /// Continues the reconstruction from the added triangles. Only the front
+    /// edges with a vertex in \p is_seam are pivoted, the others are final
+    /// border edges. Unlike Run, every radius both expands the front and
+    /// looks for new seeds.
+    std::shared_ptr<TriangleMesh> Stitch(const std::vector<double>& radii,
+                                         const std::vector<bool>& is_seam) {
+        edges_.ForEach([&](BallPivotingEdge& edge) {
+            if (edge.type_ != BallPivotingEdge::Type::Front) {
+                return;
+            }
+            if (is_seam[edge.source_->idx_] || is_seam[edge.target_->idx_]) {
+                edge_front_.push_back(&edge);
+            } else {
+                edge.type_ = BallPivotingEdge::Type::Border;
+            }
+        });
+        for (double radius : radii) {
+            ReactivateBorderEdges(radius);
+            ExpandTriangulation(radius);
+            FindSeedTriangle(radius);
         }
         return mesh_;
     }
 
 private:
-    bool has_normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
+    std::deque<BallPivotingEdgePtr> edge_front_;
+    std::vector<BallPivotingEdgePtr> border_edges_;
+    std::vector<BallPivotingVertex> vertices;
+    BallPivotingPool<BallPivotingEdge> edges_;
+    BallPivotingPool<BallPivotingTriangle> triangles_;
+    /// Vertices FindSeedTriangle starts new fronts from, all by default.
+    std::vector<int> seed_vertices_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
+
+/// A box of the tiled reconstruction and the points assigned to it. The
+/// bounds of the box that are on the bounding box of the whole point cloud
+/// are infinite.
+class BallPivotingTile {
+public:
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+    std::vector<int> indices_;
+};
+
+/// Splits the box [min_bound, max_bound] with the points \p indices at the
+/// median of its longest axis until each tile has at most \p max_points.
+static void SplitIntoBallPivotingTiles(const PointCloud& pcd,
+                                       std::vector<int> indices,
+                                       const Eigen::Vector3d& min_bound,
+                                       const Eigen::Vector3d& max_bound,
+                                       size_t max_points,
+                                       std::vector<BallPivotingTile>& tiles) {
+    Eigen::Vector3d lo = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d hi = -lo;
+    for (int idx : indices) {
+        lo = lo.cwiseMin(pcd.points_[idx]);
+        hi = hi.cwiseMax(pcd.points_[idx]);
+    }
+    int axis = 0;
+    const double extent = (hi - lo).maxCoeff(&axis);
+    if (indices.size() <= max_points || !(extent > 0)) {
+        BallPivotingTile tile;
+        tile.min_bound_ = min_bound;
+        tile.max_bound_ = max_bound;
+        tile.indices_ = std::move(indices);
+        tiles.push_back(std::move(tile));
+        return;
+    }
+    auto median = indices.begin() + indices.size() / 2;
+    std::nth_element(indices.begin(), median, indices.end(),
+                     [&](int lhs, int rhs) {
+                         return pcd.points_[lhs](axis) <
+                                pcd.points_[rhs](axis);
+                     });
+    const double split = pcd.points_[*median](axis);
+    Eigen::Vector3d left_max_bound = max_bound;
+    Eigen::Vector3d right_min_bound = min_bound;
+    left_max_bound(axis) = split;
+    right_min_bound(axis) = split;
+    std::vector<int> right_indices(median, indices.end());
+    indices.erase(median, indices.end());
+    SplitIntoBallPivotingTiles(pcd, std::move(indices), min_bound,
+                               left_max_bound, max_points, tiles);
+    SplitIntoBallPivotingTiles(pcd, std::move(right_indices), right_min_bound,
+                               max_bound, max_points, tiles);
+}
+
+/// Reconstructs the tiles in parallel, each with the points within the ball
+/// diameter of the tile, and keeps the triangles whose vertices are all
+/// assigned to the tile. The empty ball tests of these triangles see all
+/// points of the whole point cloud that matter, and triangles of different
+/// tiles share no vertices. The gaps along the tile boundaries are then closed
+/// by pivoting the front of the merged triangles over the seams.
+static std::shared_ptr<TriangleMesh> ReconstructBallPivotingTiled(
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        size_t max_points_per_tile) {
+    const Eigen::Vector3d inf =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+    std::vector<int> indices(pcd.points_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<BallPivotingTile> tiles;
+    SplitIntoBallPivotingTiles(pcd, std::move(indices), -inf, inf,
+                               max_points_per_tile, tiles);
+    const int num_tiles = int(tiles.size());
+    OPEN3D_LOG_DEBUG("[ReconstructBallPivotingTiled] {:d} tiles", num_tiles);
+
+    std::vector<int> point_tile(pcd.points_.size());
+    for (int t = 0; t < num_tiles; ++t) {
+        for (int idx : tiles[t].indices_) {
+            point_tile[idx] = t;
+        }
+    }
+
+    // Every point within a ball through a vertex is within the diameter of
+    // the largest ball of the vertex.
+    const double margin = 2 * *std::max_element(radii.begin(), radii.end());
+    std::vector<std::vector<Eigen::Vector3i>> tile_triangles(num_tiles);
+    std::vector<std::vector<Eigen::Vector3d>> tile_centers(num_tiles);
+    utility::ParallelFor(0, num_tiles, [&](int64_t t) {
+        const BallPivotingTile& tile = tiles[t];
+        const Eigen::Vector3d min_bound =
+                tile.min_bound_ - Eigen::Vector3d::Constant(margin);
+        const Eigen::Vector3d max_bound =
+                tile.max_bound_ + Eigen::Vector3d::Constant(margin);
+        PointCloud tile_pcd;
+        std::vector<int> tile_indices;
+        std::vector<int> seed_vertices;
+        for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+            const Eigen::Vector3d& point = pcd.points_[idx];
+            if ((point.array() >= min_bound.array()).all() &&
+                (point.array() <= max_bound.array()).all()) {
+                if (point_tile[idx] == t) {
+                    seed_vertices.push_back(int(tile_indices.size()));
+                }
+                tile_indices.push_back(int(idx));
+                tile_pcd.points_.push_back(point);
+                tile_pcd.normals_.push_back(pcd.normals_[idx]);
+            }
+        }
+
+        BallPivoting bp(tile_pcd);
+        bp.SetSeedVertices(std::move(seed_vertices));
+        bp.Run(radii);
+        bp.ForEachTriangle(
+                [&](int vidx0, int vidx1, int vidx2,
+                    const Eigen::Vector3d& center) {
+                    Eigen::Vector3i triangle(tile_indices[vidx0],
+                                             tile_indices[vidx1],
+                                             tile_indices[vidx2]);
+                    if (point_tile[triangle(0)] == t &&
+                        point_tile[triangle(1)] == t &&
+                        point_tile[triangle(2)] == t) {
+                        tile_triangles[t].push_back(triangle);
+                        tile_centers[t].push_back(center);
+                    }
+                });
+    });
+
+    // A vertex is on a seam if it is within the ball diameter of a boundary
+    // of its tile that is shared with another tile.
+    std::vector<bool> is_seam(pcd.points_.size());
+    std::vector<int> seam_vertices;
+    for (size_t idx = 0; idx < pcd.points_.size(); ++idx) {
+        const BallPivotingTile& tile = tiles[point_tile[idx]];
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        const double distance =
+                std::min((point - tile.min_bound_).minCoeff(),
+                         (tile.max_bound_ - point).minCoeff());
+        if (distance <= margin) {
+            is_seam[idx] = true;
+            seam_vertices.push_back(int(idx));
+        }
+    }
+
     BallPivoting bp(pcd);
-    return bp.Run(radii);
+    for (int t = 0; t < num_tiles; ++t) {
+        for (size_t tidx = 0; tidx < tile_triangles[t].size(); ++tidx) {
+            const Eigen::Vector3i& triangle = tile_triangles[t][tidx];
+            bp.AddTriangle(triangle(0), triangle(1), triangle(2),
+                           tile_centers[t][tidx]);
+        }
+        std::vector<Eigen::Vector3i>().swap(tile_triangles[t]);
+        std::vector<Eigen::Vector3d>().swap(tile_centers[t]);
+    }
+    bp.SetSeedVertices(std::move(seam_vertices));
+    return bp.Stitch(radii, is_seam);
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        size_t max_points_per_tile) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
+
+    std::shared_ptr<TriangleMesh> mesh;
+    if (max_points_per_tile > 0 && pcd.points_.size() > max_points_per_tile &&
+        !radii.empty()) {
+        mesh = ReconstructBallPivotingTiled(pcd, radii, max_points_per_tile);
+    } else {
+        BallPivoting bp(pcd);
+        mesh = bp.Run(radii);
+    }
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+    return mesh;
 }
 
 }  // namespace geometry
@@ -24,9 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/SurfaceReconstructionPoisson.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Timer.h"
 
 #include <Eigen/Dense>
 #include <cfloat>
@@ -34,7 +37,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <numeric>
 
 // clang-format off
 #include "PoissonRecon/Src/PreProcessor.h"
@@ -95,29 +100,35 @@ template <typename Real>
 class Open3DPointStream
     : public InputPointStreamWithData<Real, DIMENSION, Open3DData> {
 public:
-    Open3DPointStream(const open3d::geometry::PointCloud* pcd)
-        : pcd_(pcd), xform_(nullptr), current_(0) {}
+    /// Streams the points of \p pcd, or only the points \p indices if it is
+    /// not a nullptr.
+    Open3DPointStream(const open3d::geometry::PointCloud* pcd,
+                      const std::vector<size_t>* indices = nullptr)
+        : pcd_(pcd), indices_(indices), xform_(nullptr), current_(0) {}
     void reset(void) { current_ = 0; }
     bool nextPoint(Point<Real, 3>& p, Open3DData& d) {
-        if (current_ >= pcd_->points_.size()) {
+        const size_t num_points =
+                indices_ ? indices_->size() : pcd_->points_.size();
+        if (current_ >= num_points) {
             return false;
         }
-        p.coords[0] = static_cast<Real>(pcd_->points_[current_](0));
-        p.coords[1] = static_cast<Real>(pcd_->points_[current_](1));
-        p.coords[2] = static_cast<Real>(pcd_->points_[current_](2));
+        const size_t idx = indices_ ? (*indices_)[current_] : current_;
+        p.coords[0] = static_cast<Real>(pcd_->points_[idx](0));
+        p.coords[1] = static_cast<Real>(pcd_->points_[idx](1));
+        p.coords[2] = static_cast<Real>(pcd_->points_[idx](2));
 
         if (xform_ != nullptr) {
             p = (*xform_) * p;
         }
 
         if (pcd_->HasNormals()) {
-            d.normal_ = pcd_->normals_[current_];
+            d.normal_ = pcd_->normals_[idx];
         } else {
             d.normal_ = Eigen::Vector3d(0, 0, 0);
         }
 
         if (pcd_->HasColors()) {
-            d.color_ = pcd_->colors_[current_];
+            d.color_ = pcd_->colors_[idx];
         } else {
             d.color_ = Eigen::Vector3d(0, 0, 0);
         }
@@ -128,6 +139,7 @@ public:
 
 public:
     const open3d::geometry::PointCloud* pcd_;
+    const std::vector<size_t>* indices_;
     XForm<Real, 4>* xform_;
     size_t current_;
 };
@@ -402,12 +414,14 @@ void ExtractMesh(
 
 template <class Real, typename... SampleData, unsigned int... FEMSigs>
 void Execute(const open3d::geometry::PointCloud& pcd,
+             const std::vector<size_t>* indices,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
              int depth,
              size_t width,
              float scale,
              bool linear_fit,
+             PoissonReconstructionStatistics& statistics,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -452,9 +466,12 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
     Real targetValue = (Real)0.5;
 
+    utility::Timer stage_timer;
+    stage_timer.Start();
+
     // Read in the samples (and color data)
     {
-        Open3DPointStream<Real> pointStream(&pcd);
+        Open3DPointStream<Real> pointStream(&pcd, indices);
 
         if (width > 0) {
             xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
@@ -501,6 +518,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
         utility::LogDebug("Input Points / Samples: {} / {}", pointCount,
                           samples.size());
+        statistics.num_samples_ += samples.size();
     }
 
     int kernelDepth = depth - 2;
@@ -592,6 +610,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     normalInfo, density);
             profiler.dumpOutput("#       Finalized tree:");
         }
+        stage_timer.Stop();
+        statistics.octree_time_ += stage_timer.GetDuration();
+        stage_timer.Start();
 
         // Add the FEM constraints
         {
@@ -678,6 +699,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             if (iInfo) delete iInfo, iInfo = NULL;
         }
     }
+    stage_timer.Stop();
+    statistics.solve_time_ += stage_timer.GetDuration();
+    stage_timer.Start();
 
     {
         profiler.start();
@@ -719,18 +743,194 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
 
     if (density) delete density, density = NULL;
+    stage_timer.Stop();
+    statistics.iso_surface_time_ += stage_timer.GetDuration();
+    statistics.peak_memory_mb_ = std::max(
+            statistics.peak_memory_mb_,
+            double(FEMTree<Dim, Real>::MaxMemoryUsage()));
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+/// A box of the tiled reconstruction and the points in it. The bounds of the
+/// box that are on the bounding box of the whole point cloud are infinite,
+/// so that every triangle centroid is in exactly one tile.
+class Tile {
+public:
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+    std::vector<size_t> indices_;
+};
+
+/// Splits the box [min_bound, max_bound] with the points \p indices at the
+/// median of its longest axis until each tile has at most \p max_points.
+void SplitIntoTiles(const open3d::geometry::PointCloud& pcd,
+                    std::vector<size_t> indices,
+                    const Eigen::Vector3d& min_bound,
+                    const Eigen::Vector3d& max_bound,
+                    size_t max_points,
+                    std::vector<Tile>& tiles) {
+    Eigen::Vector3d extent = max_bound - min_bound;
+    // Infinite bounds are clamped to the points for choosing the axis.
+    for (int d = 0; d < 3; d++) {
+        if (!std::isfinite(extent(d))) {
+            double lo = std::numeric_limits<double>::infinity();
+            double hi = -lo;
+            for (size_t idx : indices) {
+                lo = std::min(lo, pcd.points_[idx](d));
+                hi = std::max(hi, pcd.points_[idx](d));
+            }
+            extent(d) = hi - lo;
+        }
+    }
+    int axis = 0;
+    extent.maxCoeff(&axis);
+    if (indices.size() <= max_points || extent(axis) <= 0) {
+        Tile tile;
+        tile.min_bound_ = min_bound;
+        tile.max_bound_ = max_bound;
+        tile.indices_ = std::move(indices);
+        tiles.push_back(std::move(tile));
+        return;
+    }
+    auto median = indices.begin() + indices.size() / 2;
+    std::nth_element(indices.begin(), median, indices.end(),
+                     [&](size_t lhs, size_t rhs) {
+                         return pcd.points_[lhs](axis) <
+                                pcd.points_[rhs](axis);
+                     });
+    const double split = pcd.points_[*median](axis);
+    Eigen::Vector3d left_max_bound = max_bound;
+    Eigen::Vector3d right_min_bound = min_bound;
+    left_max_bound(axis) = split;
+    right_min_bound(axis) = split;
+    std::vector<size_t> right_indices(median, indices.end());
+    indices.erase(median, indices.end());
+    SplitIntoTiles(pcd, std::move(indices), min_bound, left_max_bound,
+                   max_points, tiles);
+    SplitIntoTiles(pcd, std::move(right_indices), right_min_bound, max_bound,
+                   max_points, tiles);
+}
+
+/// Reconstructs \p pcd tile by tile, see PoissonReconstructionOption::
+/// max_points_per_tile_.
+template <class Real, unsigned int... FEMSigs>
+void ExecuteTiled(const open3d::geometry::PointCloud& pcd,
+                  const PoissonReconstructionOption& option,
+                  std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
+                  std::vector<double>& out_densities,
+                  PoissonReconstructionStatistics& statistics,
+                  UIntPack<FEMSigs...> sigs) {
+    const Eigen::Vector3d inf =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+    std::vector<size_t> indices(pcd.points_.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<Tile> tiles;
+    SplitIntoTiles(pcd, std::move(indices), -inf, inf,
+                   option.max_points_per_tile_, tiles);
+    statistics.num_tiles_ = tiles.size();
+    utility::LogDebug("[CreateFromPointCloudPoisson] {:d} tiles.",
+                      tiles.size());
+    const double cloud_extent =
+            (pcd.GetMaxBound() - pcd.GetMinBound()).maxCoeff();
+
+    for (Tile& tile : tiles) {
+        // The tile and its overlap, with the infinite bounds clamped to the
+        // points of the tile.
+        Eigen::Vector3d points_min_bound = inf;
+        Eigen::Vector3d points_max_bound = -inf;
+        for (size_t idx : tile.indices_) {
+            points_min_bound = points_min_bound.cwiseMin(pcd.points_[idx]);
+            points_max_bound = points_max_bound.cwiseMax(pcd.points_[idx]);
+        }
+        Eigen::Vector3d min_bound = tile.min_bound_;
+        Eigen::Vector3d max_bound = tile.max_bound_;
+        for (int d = 0; d < 3; d++) {
+            if (!std::isfinite(min_bound(d))) {
+                min_bound(d) = points_min_bound(d);
+            }
+            if (!std::isfinite(max_bound(d))) {
+                max_bound(d) = points_max_bound(d);
+            }
+        }
+        const double margin =
+                option.tile_overlap_ * (max_bound - min_bound).maxCoeff();
+        min_bound -= Eigen::Vector3d::Constant(margin);
+        max_bound += Eigen::Vector3d::Constant(margin);
+        std::vector<uint8_t> in_overlap(pcd.points_.size());
+        utility::ParallelFor(
+                0, int64_t(pcd.points_.size()),
+                [&](int64_t i) {
+                    const Eigen::Vector3d& point = pcd.points_[i];
+                    in_overlap[i] = (point.array() >= min_bound.array() &&
+                                     point.array() <= max_bound.array())
+                                            .all();
+                },
+                32768);
+        std::vector<size_t> tile_indices;
+        for (size_t i = 0; i < pcd.points_.size(); i++) {
+            if (in_overlap[i]) {
+                tile_indices.push_back(i);
+            }
+        }
+        tile.indices_.clear();
+        tile.indices_.shrink_to_fit();
+
+        // The depth at which the tile has the resolution of a reconstruction
+        // of the whole cloud at depth_.
+        const double tile_extent = (max_bound - min_bound).maxCoeff();
+        int depth = int(option.depth_);
+        if (option.width_ == 0 && tile_extent > 0 && cloud_extent > 0) {
+            depth = std::max(
+                    2, int(std::ceil(double(option.depth_) +
+                                     std::log2(tile_extent / cloud_extent))));
+        }
+
+        auto tile_mesh = std::make_shared<TriangleMesh>();
+        std::vector<double> tile_densities;
+        Execute<Real>(pcd, &tile_indices, tile_mesh, tile_densities, depth,
+                      option.width_, option.scale_, option.linear_fit_,
+                      statistics, sigs);
+
+        // Keep the triangles whose centroid is in the tile.
+        std::vector<int> vertex_map(tile_mesh->vertices_.size(), -1);
+        for (const Eigen::Vector3i& triangle : tile_mesh->triangles_) {
+            const Eigen::Vector3d centroid =
+                    (tile_mesh->vertices_[triangle(0)] +
+                     tile_mesh->vertices_[triangle(1)] +
+                     tile_mesh->vertices_[triangle(2)]) /
+                    3.0;
+            if (!((centroid.array() >= tile.min_bound_.array()).all() &&
+                  (centroid.array() < tile.max_bound_.array()).all())) {
+                continue;
+            }
+            Eigen::Vector3i out_triangle;
+            for (int k = 0; k < 3; k++) {
+                int& vidx = vertex_map[triangle(k)];
+                if (vidx < 0) {
+                    vidx = int(out_mesh->vertices_.size());
+                    out_mesh->vertices_.push_back(
+                            tile_mesh->vertices_[triangle(k)]);
+                    out_mesh->vertex_normals_.push_back(
+                            tile_mesh->vertex_normals_[triangle(k)]);
+                    out_mesh->vertex_colors_.push_back(
+                            tile_mesh->vertex_colors_[triangle(k)]);
+                    out_densities.push_back(tile_densities[triangle(k)]);
+                }
+                out_triangle(k) = vidx;
+            }
+            out_mesh->triangles_.push_back(out_triangle);
+        }
+    }
+}
+
 }  // namespace poisson
 
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
-TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
-                                          size_t depth,
-                                          size_t width,
-                                          float scale,
-                                          bool linear_fit) {
+std::tuple<std::shared_ptr<TriangleMesh>,
+           std::vector<double>,
+           PoissonReconstructionStatistics>
+TriangleMesh::CreateFromPointCloudPoisson(
+        const PointCloud& pcd, const PoissonReconstructionOption& option) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -741,21 +941,58 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
 
+    utility::Timer total_timer;
+    total_timer.Start();
+    const int num_threads = option.num_threads_ > 0
+                                    ? option.num_threads_
+                                    : utility::GetNumThreads();
 #ifdef _OPENMP
     ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
-                     std::thread::hardware_concurrency());
+                     num_threads);
 #else
     ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
-                     std::thread::hardware_concurrency());
+                     num_threads);
 #endif
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+    PoissonReconstructionStatistics statistics;
+    statistics.num_points_ = pcd.points_.size();
+    if (option.max_points_per_tile_ > 0 &&
+        pcd.points_.size() > option.max_points_per_tile_) {
+        poisson::ExecuteTiled<float>(pcd, option, mesh, densities, statistics,
+                                     FEMSigs());
+    } else {
+        statistics.num_tiles_ = 1;
+        poisson::Execute<float>(pcd, nullptr, mesh, densities,
+                                static_cast<int>(option.depth_), option.width_,
+                                option.scale_, option.linear_fit_, statistics,
+                                FEMSigs());
+    }
 
     ThreadPool::Terminate();
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    utility::LogDebug(
+            "[CreateFromPointCloudPoisson] octree {:.1f} ms, solve {:.1f} ms, "
+            "iso-surface {:.1f} ms, peak memory {:.1f} MB.",
+            statistics.octree_time_, statistics.solve_time_,
+            statistics.iso_surface_time_, statistics.peak_memory_mb_);
+
+    return std::make_tuple(mesh, densities, statistics);
+}
 
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
+                                          size_t depth,
+                                          size_t width,
+                                          float scale,
+                                          bool linear_fit) {
+    std::shared_ptr<TriangleMesh> mesh;
+    std::vector<double> densities;
+    PoissonReconstructionStatistics statistics;
+    std::tie(mesh, densities, statistics) = CreateFromPointCloudPoisson(
+            pcd, PoissonReconstructionOption(depth, width, scale, linear_fit));
     return std::make_tuple(mesh, densities);
 }
 
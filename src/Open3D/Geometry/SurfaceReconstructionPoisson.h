@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+namespace open3d {
+namespace geometry {
+
+/// \class PoissonReconstructionOption
+///
+/// \brief Options of TriangleMesh::CreateFromPointCloudPoisson.
+class PoissonReconstructionOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param depth Maximum depth of the tree that will be used for surface
+    /// reconstruction.
+    /// \param width Target width of the finest level octree cells, overrides
+    /// \p depth if larger than 0.
+    /// \param scale Ratio between the diameter of the cube used for
+    /// reconstruction and the diameter of the samples' bounding cube.
+    /// \param linear_fit If true, iso-vertices are placed by linear
+    /// interpolation.
+    /// \param num_threads Number of threads of the reconstruction. 0 uses
+    /// utility::GetNumThreads().
+    /// \param max_points_per_tile If larger than 0, point clouds with more
+    /// points are reconstructed tile by tile, see max_points_per_tile_.
+    /// \param tile_overlap Overlap of neighboring tiles, relative to the
+    /// extent of a tile.
+    PoissonReconstructionOption(size_t depth = 8,
+                                size_t width = 0,
+                                float scale = 1.1f,
+                                bool linear_fit = false,
+                                int num_threads = 0,
+                                size_t max_points_per_tile = 0,
+                                double tile_overlap = 0.1)
+        : depth_(depth),
+          width_(width),
+          scale_(scale),
+          linear_fit_(linear_fit),
+          num_threads_(num_threads),
+          max_points_per_tile_(max_points_per_tile),
+          tile_overlap_(tile_overlap) {}
+    ~PoissonReconstructionOption() {}
+
+public:
+    /// Maximum depth of the tree that will be used for surface
+    /// reconstruction. In tiled mode this is the depth a single tile over the
+    /// whole point cloud would have, so all tiles have the same resolution.
+    size_t depth_;
+    /// Target width of the finest level octree cells. Overrides depth_ if
+    /// larger than 0.
+    size_t width_;
+    /// Ratio between the diameter of the cube used for reconstruction and the
+    /// diameter of the samples' bounding cube.
+    float scale_;
+    /// If true, iso-vertices are placed by linear interpolation.
+    bool linear_fit_;
+    /// Number of threads of the reconstruction. 0 uses
+    /// utility::GetNumThreads().
+    int num_threads_;
+    /// \brief Memory bound of the tiled (streaming) mode.
+    ///
+    /// If larger than 0 and the point cloud has more points, its bounding box
+    /// is split at the median of its longest axis until every tile has at
+    /// most this many points. The tiles are reconstructed one after the
+    /// other with the points of the tile and its overlap, and each keeps the
+    /// triangles whose centroid lies in the tile. Only a single octree is in
+    /// memory at any time. The meshes of neighboring tiles are not stitched.
+    size_t max_points_per_tile_;
+    /// Overlap of neighboring tiles, relative to the extent of a tile.
+    double tile_overlap_;
+};
+
+/// \class PoissonReconstructionStatistics
+///
+/// \brief Per-stage timing and memory of TriangleMesh::
+/// CreateFromPointCloudPoisson. Times are in milliseconds and summed over the
+/// tiles in tiled mode.
+class PoissonReconstructionStatistics {
+public:
+    PoissonReconstructionStatistics() {}
+    ~PoissonReconstructionStatistics() {}
+
+public:
+    /// Number of input points.
+    size_t num_points_ = 0;
+    /// Number of octree samples the points were splatted into.
+    size_t num_samples_ = 0;
+    /// Number of reconstructed tiles, 1 unless in tiled mode.
+    size_t num_tiles_ = 0;
+    /// Reading the samples, density estimation, normal field and finalizing
+    /// the octree.
+    double octree_time_ = 0;
+    /// Setting up the constraints and solving the linear system.
+    double solve_time_ = 0;
+    /// Computing the iso-value and extracting the iso-surface.
+    double iso_surface_time_ = 0;
+    /// Total time, including tiling.
+    double total_time_ = 0;
+    /// Peak memory of the octree in MB, the maximum over the tiles.
+    double peak_memory_mb_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -30,8 +30,15 @@
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Geometry/VoxelGroups.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -42,6 +49,7 @@
 #endif
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -109,49 +117,179 @@ TriangleMesh TriangleMesh::operator+(const TriangleMesh &mesh) const {
     return (TriangleMesh(*this) += mesh);
 }
 
+namespace {
+
+/// Minimum number of triangles or vertices processed by one normal task.
+constexpr int64_t kNormalGrainSize = 1024;
+
+/// Normalizes \p normal as TriangleMesh::NormalizeNormals does.
+inline void NormalizeNormal(Eigen::Vector3d &normal) {
+    normal.normalize();
+    if (std::isnan(normal(0))) {
+        normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+    }
+}
+
+/// Buckets the triangle corners 3 * t + k by their vertex triangles[t](k) in
+/// compressed sparse row layout. The corners of a bucket are sorted, so
+/// gathers over them visit the triangles in index order.
+void BucketCornersByVertex(const std::vector<Eigen::Vector3i> &triangles,
+                           int64_t num_vertices,
+                           std::vector<int64_t> &offsets,
+                           std::vector<int> &corners) {
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size());
+    if (3 * num_triangles > std::numeric_limits<int>::max()) {
+        utility::LogError("[ComputeVertexNormals] Too many triangles: {}.",
+                          num_triangles);
+    }
+    // counts[v] is first the size of bucket v, then the next free slot in it.
+    std::vector<std::atomic<int64_t>> counts(num_vertices);
+    utility::ParallelFor(
+            0, num_triangles,
+            [&](int64_t tidx) {
+                for (int k = 0; k < 3; ++k) {
+                    counts[triangles[tidx](k)].fetch_add(
+                            1, std::memory_order_relaxed);
+                }
+            },
+            kNormalGrainSize);
+    offsets.resize(num_vertices + 1);
+    offsets[0] = 0;
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        offsets[vidx + 1] =
+                offsets[vidx] + counts[vidx].load(std::memory_order_relaxed);
+        counts[vidx].store(offsets[vidx], std::memory_order_relaxed);
+    }
+    corners.resize(offsets[num_vertices]);
+    utility::ParallelFor(
+            0, num_triangles,
+            [&](int64_t tidx) {
+                for (int k = 0; k < 3; ++k) {
+                    const int64_t slot = counts[triangles[tidx](k)].fetch_add(
+                            1, std::memory_order_relaxed);
+                    corners[slot] = static_cast<int>(3 * tidx + k);
+                }
+            },
+            kNormalGrainSize);
+    utility::ParallelFor(
+            0, num_vertices,
+            [&](int64_t vidx) {
+                std::sort(corners.begin() + offsets[vidx],
+                          corners.begin() + offsets[vidx + 1]);
+            },
+            kNormalGrainSize);
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::ComputeTriangleNormals(
         bool normalized /* = true*/) {
     triangle_normals_.resize(triangles_.size());
-    for (size_t i = 0; i < triangles_.size(); i++) {
-        auto &triangle = triangles_[i];
-        Eigen::Vector3d v01 = vertices_[triangle(1)] - vertices_[triangle(0)];
-        Eigen::Vector3d v02 = vertices_[triangle(2)] - vertices_[triangle(0)];
-        triangle_normals_[i] = v01.cross(v02);
-    }
-    if (normalized) {
-        NormalizeNormals();
-    }
+    utility::ParallelFor(
+            0, static_cast<int64_t>(triangles_.size()),
+            [&](int64_t i) {
+                const Eigen::Vector3i &triangle = triangles_[i];
+                const Eigen::Vector3d v01 =
+                        vertices_[triangle(1)] - vertices_[triangle(0)];
+                const Eigen::Vector3d v02 =
+                        vertices_[triangle(2)] - vertices_[triangle(0)];
+                triangle_normals_[i] = v01.cross(v02);
+                if (normalized) {
+                    NormalizeNormal(triangle_normals_[i]);
+                }
+            },
+            kNormalGrainSize);
     return *this;
 }
 
-TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
-    if (!HasTriangleNormals()) {
-        ComputeTriangleNormals(false);
-    }
-    vertex_normals_.resize(vertices_.size(), Eigen::Vector3d::Zero());
-    for (size_t i = 0; i < triangles_.size(); i++) {
-        auto &triangle = triangles_[i];
-        vertex_normals_[triangle(0)] += triangle_normals_[i];
-        vertex_normals_[triangle(1)] += triangle_normals_[i];
-        vertex_normals_[triangle(2)] += triangle_normals_[i];
-    }
-    if (normalized) {
-        NormalizeNormals();
+TriangleMesh &TriangleMesh::ComputeVertexNormals(
+        bool normalized /* = true*/,
+        VertexNormalWeighting weighting /* = TriangleNormals */) {
+    const int64_t num_vertices = static_cast<int64_t>(vertices_.size());
+    const int64_t num_triangles = static_cast<int64_t>(triangles_.size());
+
+    // The normals summed per triangle corner: the stored triangle normals,
+    // or the unnormalized normals whose length is twice the triangle area.
+    std::vector<Eigen::Vector3d> area_normals;
+    if (weighting == VertexNormalWeighting::TriangleNormals) {
+        if (!HasTriangleNormals()) {
+            ComputeTriangleNormals(false);
+        }
+    } else {
+        area_normals.resize(num_triangles);
+        utility::ParallelFor(
+                0, num_triangles,
+                [&](int64_t tidx) {
+                    const Eigen::Vector3i &triangle = triangles_[tidx];
+                    area_normals[tidx] =
+                            (vertices_[triangle(1)] - vertices_[triangle(0)])
+                                    .cross(vertices_[triangle(2)] -
+                                           vertices_[triangle(0)]);
+                    if (weighting != VertexNormalWeighting::Area) {
+                        const double norm = area_normals[tidx].norm();
+                        if (norm > 0.0) {
+                            area_normals[tidx] /= norm;
+                        }
+                    }
+                },
+                kNormalGrainSize);
+    }
+    const std::vector<Eigen::Vector3d> &face_normals =
+            weighting == VertexNormalWeighting::TriangleNormals
+                    ? triangle_normals_
+                    : area_normals;
+
+    std::vector<int64_t> offsets;
+    std::vector<int> corners;
+    BucketCornersByVertex(triangles_, num_vertices, offsets, corners);
+    vertex_normals_.resize(num_vertices);
+    utility::ParallelFor(
+            0, num_vertices,
+            [&](int64_t vidx) {
+                Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+                for (int64_t i = offsets[vidx]; i < offsets[vidx + 1]; ++i) {
+                    const int tidx = corners[i] / 3;
+                    if (weighting != VertexNormalWeighting::Angle) {
+                        normal += face_normals[tidx];
+                        continue;
+                    }
+                    const int k = corners[i] % 3;
+                    const Eigen::Vector3i &triangle = triangles_[tidx];
+                    const Eigen::Vector3d e1 =
+                            vertices_[triangle((k + 1) % 3)] - vertices_[vidx];
+                    const Eigen::Vector3d e2 =
+                            vertices_[triangle((k + 2) % 3)] - vertices_[vidx];
+                    const double angle =
+                            std::atan2(e1.cross(e2).norm(), e1.dot(e2));
+                    normal += angle * face_normals[tidx];
+                }
+                if (normalized) {
+                    NormalizeNormal(normal);
+                }
+                vertex_normals_[vidx] = normal;
+            },
+            kNormalGrainSize);
+    if (normalized && weighting == VertexNormalWeighting::TriangleNormals) {
+        utility::ParallelFor(
+                0, num_triangles,
+                [&](int64_t tidx) { NormalizeNormal(triangle_normals_[tidx]); },
+                kNormalGrainSize);
     }
     return *this;
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
-    }
+    utility::ParallelFor(
+            0, static_cast<int64_t>(vertices_.size()), [&](int64_t vidx) {
+                adjacency_list_[vidx].insert(
+                        adjacency->vertex_neighbors_.begin() +
+                                adjacency->vertex_offsets_[vidx],
+                        adjacency->vertex_neighbors_.begin() +
+                                adjacency->vertex_offsets_[vidx + 1]);
+            });
     return *this;
 }
 
@@ -169,6 +307,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     std::vector<Eigen::Vector3d> prev_vertices = vertices_;
     std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+    const int64_t num_vertices = static_cast<int64_t>(vertices_.size());
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
     mesh->vertices_.resize(vertices_.size());
@@ -176,16 +315,16 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+        utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int64_t i = adjacency->vertex_offsets_[vidx];
+                 i < adjacency->vertex_offsets_[vidx + 1]; ++i) {
+                const int nbidx = adjacency->vertex_neighbors_[i];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -197,7 +336,8 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const double nb_size =
+                    static_cast<double>(adjacency->NumVertexNeighbors(vidx));
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -215,7 +355,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                         strength * (prev_vertex_colors[vidx] * nb_size -
                                     color_sum);
             }
-        }
+        });
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -240,6 +380,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     std::vector<Eigen::Vector3d> prev_vertices = vertices_;
     std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
     std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+    const int64_t num_vertices = static_cast<int64_t>(vertices_.size());
 
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
     mesh->vertices_.resize(vertices_.size());
@@ -247,16 +388,16 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+        utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int64_t i = adjacency->vertex_offsets_[vidx];
+                 i < adjacency->vertex_offsets_[vidx + 1]; ++i) {
+                const int nbidx = adjacency->vertex_neighbors_[i];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -268,7 +409,8 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            const double nb_size =
+                    static_cast<double>(adjacency->NumVertexNeighbors(vidx));
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -282,7 +424,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 mesh->vertex_colors_[vidx] =
                         (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
             }
-        }
+        });
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -297,17 +439,20 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const TriangleMeshAdjacency &adjacency,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+    const int64_t num_vertices = static_cast<int64_t>(mesh->vertices_.size());
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
+        for (int64_t i = adjacency.vertex_offsets_[vidx];
+             i < adjacency.vertex_offsets_[vidx + 1]; ++i) {
+            const int nbidx = adjacency.vertex_neighbors_[i];
             auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
             double dist = diff.norm();
             double weight = 1. / (dist + 1e-12);
@@ -339,7 +484,7 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
                                          lambda * (color_sum / total_weight -
                                                    prev_vertex_colors[vidx]);
         }
-    }
+    });
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
@@ -363,15 +508,12 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *adjacency, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -405,21 +547,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *adjacency, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *adjacency, mu,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -429,6 +567,150 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     return mesh;
 }
 
+namespace {
+
+/// Points drawn from one random number stream in SamplePointsUniformlyImpl.
+constexpr int64_t kSamplesPerStream = 4096;
+
+/// Voxels per task in the phases of SamplePoissonDiskOnGrid.
+constexpr int64_t kPoissonDiskVoxelGrainSize = 64;
+
+/// Factor the distance of SamplePoissonDiskOnGrid is decreased by in every
+/// pass that accepts too few samples. After kPoissonDiskMaxPasses passes all
+/// remaining samples are accepted, which terminates on duplicated samples.
+constexpr double kPoissonDiskRadiusDecay = 0.9;
+constexpr int kPoissonDiskMaxPasses = 64;
+
+uint64_t HashSampleIndex(int64_t idx, uint32_t seed) {
+    uint64_t h = uint64_t(idx) * 0x9E3779B97F4A7C15ull ^ uint64_t(seed);
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return h ^ (h >> 31);
+}
+
+/// Marks the points that are not selected by a parallel dart throwing over
+/// \p points as deleted. The points are grouped on a grid of voxel size
+/// \p radius and visited in a random order within each voxel. A point is
+/// accepted if no accepted point is closer than the current distance, which
+/// only needs the 27 voxels around its voxel. The voxels are processed in 27
+/// phases by their indices modulo 3, and voxels of the same phase are
+/// processed in parallel, as they never read the accepted points of each
+/// other. The distance starts at \p radius and decays until at least
+/// \p number_of_points points are accepted, and the excess points of the last
+/// pass are deleted at random. The result does not depend on the number of
+/// threads.
+std::vector<bool> SamplePoissonDiskOnGrid(
+        const std::vector<Eigen::Vector3d> &points,
+        size_t number_of_points,
+        double radius,
+        uint32_t seed) {
+    Eigen::Vector3d min_bound = points[0];
+    for (const Eigen::Vector3d &point : points) {
+        min_bound = min_bound.cwiseMin(point);
+    }
+    VoxelGroups groups = GroupPointsByVoxel(points, min_bound, radius);
+    const int64_t num_voxels = groups.NumVoxels();
+
+    std::vector<int64_t> neighbor_voxels(num_voxels * 27);
+    std::vector<std::vector<int64_t>> phase_voxels(27);
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t v) {
+                int64_t *neighbors = neighbor_voxels.data() + v * 27;
+                for (int dz = -1, n = 0; dz <= 1; dz++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        for (int dx = -1; dx <= 1; dx++) {
+                            neighbors[n++] = groups.FindVoxel(
+                                    groups.voxels_[v] +
+                                    Eigen::Vector3i(dx, dy, dz));
+                        }
+                    }
+                }
+                // Visit the points of a voxel in random order.
+                std::sort(groups.order_.begin() + groups.voxel_offsets_[v],
+                          groups.order_.begin() + groups.voxel_offsets_[v + 1],
+                          [seed](int64_t lhs, int64_t rhs) {
+                              return HashSampleIndex(lhs, seed) <
+                                     HashSampleIndex(rhs, seed);
+                          });
+            },
+            kPoissonDiskVoxelGrainSize);
+    for (int64_t v = 0; v < num_voxels; v++) {
+        const Eigen::Vector3i &voxel = groups.voxels_[v];
+        phase_voxels[voxel(0) % 3 + 3 * (voxel(1) % 3) + 9 * (voxel(2) % 3)]
+                .push_back(v);
+    }
+
+    // The accepted points of voxel v are moved to the front of its group,
+    // order_[voxel_offsets_[v]] to
+    // order_[voxel_offsets_[v] + num_accepted[v] - 1].
+    std::vector<int64_t> num_accepted(num_voxels, 0);
+    std::vector<int> accept_pass(points.size(), -1);
+    size_t total_accepted = 0;
+    int pass = 0;
+    for (double r = radius; total_accepted < number_of_points; pass++) {
+        const double r2 = pass < kPoissonDiskMaxPasses ? r * r : 0;
+        r *= kPoissonDiskRadiusDecay;
+        for (const std::vector<int64_t> &voxels : phase_voxels) {
+            utility::ParallelFor(
+                    0, static_cast<int64_t>(voxels.size()),
+                    [&](int64_t i) {
+                        const int64_t v = voxels[i];
+                        const int64_t *neighbors =
+                                neighbor_voxels.data() + v * 27;
+                        auto IsFree = [&](const Eigen::Vector3d &point) {
+                            for (int n = 0; n < 27; n++) {
+                                const int64_t u = neighbors[n];
+                                if (u < 0) {
+                                    continue;
+                                }
+                                const int64_t *accepted =
+                                        groups.order_.data() +
+                                        groups.voxel_offsets_[u];
+                                for (int64_t k = 0; k < num_accepted[u]; k++) {
+                                    if ((points[accepted[k]] - point)
+                                                .squaredNorm() < r2) {
+                                        return false;
+                                    }
+                                }
+                            }
+                            return true;
+                        };
+                        int64_t *group = groups.order_.data() +
+                                         groups.voxel_offsets_[v];
+                        for (int64_t k = num_accepted[v];
+                             k < groups.NumPoints(v); k++) {
+                            if (IsFree(points[group[k]])) {
+                                accept_pass[group[k]] = pass;
+                                std::swap(group[k], group[num_accepted[v]]);
+                                num_accepted[v]++;
+                            }
+                        }
+                    },
+                    kPoissonDiskVoxelGrainSize);
+        }
+        total_accepted = std::accumulate(num_accepted.begin(),
+                                         num_accepted.end(), size_t(0));
+    }
+
+    std::vector<bool> deleted(points.size());
+    std::vector<int64_t> last_pass;
+    for (size_t idx = 0; idx < points.size(); idx++) {
+        deleted[idx] = accept_pass[idx] < 0;
+        if (accept_pass[idx] == pass - 1) {
+            last_pass.push_back(int64_t(idx));
+        }
+    }
+    std::mt19937 mt(seed);
+    std::shuffle(last_pass.begin(), last_pass.end(), mt);
+    for (size_t i = 0; i < total_accepted - number_of_points; i++) {
+        deleted[last_pass[i]] = true;
+    }
+    return deleted;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         size_t number_of_points,
         std::vector<double> &triangle_areas,
@@ -442,6 +724,17 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
                 triangle_areas[tidx] / surface_area + triangle_areas[tidx - 1];
     }
 
+    // The points of triangle tidx are sample_offsets[tidx] to
+    // sample_offsets[tidx + 1] - 1.
+    const int64_t num_samples = static_cast<int64_t>(number_of_points);
+    std::vector<int64_t> sample_offsets(triangles_.size() + 1, 0);
+    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
+        sample_offsets[tidx + 1] = std::min(
+                num_samples,
+                int64_t(std::round(triangle_areas[tidx] * number_of_points)));
+    }
+    sample_offsets.back() = num_samples;
+
     // sample point cloud
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
@@ -449,8 +742,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         std::random_device rd;
         seed = rd();
     }
-    std::mt19937 mt(seed);
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal || use_triangle_normal) {
@@ -462,10 +753,22 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        size_t n = size_t(std::round(triangle_areas[tidx] * number_of_points));
-        while (point_idx < n) {
+    const int64_t num_streams =
+            (num_samples + kSamplesPerStream - 1) / kSamplesPerStream;
+    utility::ParallelFor(0, num_streams, [&](int64_t stream_idx) {
+        std::seed_seq seq{uint32_t(seed), uint32_t(stream_idx),
+                          uint32_t(stream_idx >> 32)};
+        std::mt19937 mt(seq);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        const int64_t begin = stream_idx * kSamplesPerStream;
+        const int64_t end = std::min(begin + kSamplesPerStream, num_samples);
+        size_t tidx = std::upper_bound(sample_offsets.begin(),
+                                       sample_offsets.end(), begin) -
+                      sample_offsets.begin() - 1;
+        for (int64_t point_idx = begin; point_idx < end; ++point_idx) {
+            while (sample_offsets[tidx + 1] <= point_idx) {
+                tidx++;
+            }
             double r1 = dist(mt);
             double r2 = dist(mt);
             double a = (1 - std::sqrt(r1));
@@ -489,10 +792,8 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
                                           b * vertex_colors_[triangle(1)] +
                                           c * vertex_colors_[triangle(2)];
             }
-
-            point_idx++;
         }
-    }
+    });
 
     return pcd;
 }
@@ -522,7 +823,9 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         double init_factor /* = 5 */,
         const std::shared_ptr<PointCloud> pcl_init /* = nullptr */,
         bool use_triangle_normal /* = false */,
-        int seed /* = -1 */) {
+        int seed /* = -1 */,
+        PoissonDiskSamplingMethod
+                method /* = PoissonDiskSamplingMethod::SampleElimination */) {
     if (number_of_points <= 0) {
         utility::LogError("[SamplePointsPoissonDisk] number_of_points <= 0");
     }
@@ -545,6 +848,11 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     std::vector<double> triangle_areas;
     double surface_area = GetSurfaceArea(triangle_areas);
 
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+
     // Compute init points using uniform sampling
     std::shared_ptr<PointCloud> pcl;
     if (pcl_init == nullptr) {
@@ -567,72 +875,82 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                                  (2 * std::sqrt(3.)));
     double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
 
-    std::vector<double> weights(pcl->points_.size());
     std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
+    // The grid of the parallel method needs voxel indices in int range.
+    const double extent = (pcl->GetMaxBound() - pcl->GetMinBound()).maxCoeff();
+    if (method == PoissonDiskSamplingMethod::ParallelGrid &&
+        r_max * (std::numeric_limits<int>::max() / 2) >= extent) {
+        deleted = SamplePoissonDiskOnGrid(pcl->points_, number_of_points, r_max,
+                                          uint32_t(seed));
+    } else {
+        std::vector<double> weights(pcl->points_.size());
+        KDTreeFlann kdtree(*pcl);
 
-    auto WeightFcn = [&](double d2) {
-        double d = std::sqrt(d2);
-        if (d < r_min) {
-            d = r_min;
-        }
-        return std::pow(1 - d / r_max, alpha);
-    };
+        auto WeightFcn = [&](double d2) {
+            double d = std::sqrt(d2);
+            if (d < r_min) {
+                d = r_min;
+            }
+            return std::pow(1 - d / r_max, alpha);
+        };
+
+        auto ComputePointWeight = [&](int pidx0) {
+            std::vector<int> nbs;
+            std::vector<double> dists2;
+            kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
+            double weight = 0;
+            for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
+                int pidx1 = nbs[nbidx];
+                // only count weights if not the same point if not deleted
+                if (pidx0 == pidx1 || deleted[pidx1]) {
+                    continue;
+                }
+                weight += WeightFcn(dists2[nbidx]);
+            }
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
-        double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
+            weights[pidx0] = weight;
+        };
+
+        // init weights and priority queue
+        typedef std::tuple<int, double> QueueEntry;
+        auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
+            return std::get<1>(a) < std::get<1>(b);
+        };
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                            decltype(WeightCmp)>
+                queue(WeightCmp);
+        utility::ParallelFor(
+                0, static_cast<int64_t>(pcl->points_.size()),
+                [&](int64_t pidx0) { ComputePointWeight(int(pidx0)); }, 256);
+        for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
+            queue.push(QueueEntry(int(pidx0), weights[pidx0]));
+        };
+
+        // sample elimination
+        size_t current_number_of_points = pcl->points_.size();
+        while (current_number_of_points > number_of_points) {
+            int pidx;
+            double weight;
+            std::tie(pidx, weight) = queue.top();
+            queue.pop();
+
+            // test if the entry is up to date (because of reinsert)
+            if (deleted[pidx] || weight != weights[pidx]) {
                 continue;
             }
-            weight += WeightFcn(dists2[nbidx]);
-        }
-
-        weights[pidx0] = weight;
-    };
-
-    // init weights and priority queue
-    typedef std::tuple<int, double> QueueEntry;
-    auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
-        return std::get<1>(a) < std::get<1>(b);
-    };
-    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
-                        decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
-    };
-
-    // sample elimination
-    size_t current_number_of_points = pcl->points_.size();
-    while (current_number_of_points > number_of_points) {
-        int pidx;
-        double weight;
-        std::tie(pidx, weight) = queue.top();
-        queue.pop();
-
-        // test if the entry is up to date (because of reinsert)
-        if (deleted[pidx] || weight != weights[pidx]) {
-            continue;
-        }
 
-        // delete current sample
-        deleted[pidx] = true;
-        current_number_of_points--;
-
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
+            // delete current sample
+            deleted[pidx] = true;
+            current_number_of_points--;
+
+            // update weights
+            std::vector<int> nbs;
+            std::vector<double> dists2;
+            kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
+            for (int nb : nbs) {
+                ComputePointWeight(nb);
+                queue.push(QueueEntry(nb, weights[nb]));
+            }
         }
     }
 
@@ -664,38 +982,38 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
 }
 
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t,
-                       utility::hash_tuple::hash<Coordinate3>>
-            point_to_old_index;
+    const std::vector<int> index_old_to_representative =
+            FindDuplicatedPoints(vertices_);
     std::vector<int> index_old_to_new(vertices_.size());
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
     size_t old_vertex_num = vertices_.size();
     size_t k = 0;                                  // new index
     for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
+        if (index_old_to_representative[i] == int(i)) {
             vertices_[k] = vertices_[i];
             if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
             if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
             index_old_to_new[i] = (int)k;
             k++;
         } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+            index_old_to_new[i] =
+                    index_old_to_new[index_old_to_representative[i]];
         }
     }
     vertices_.resize(k);
     if (has_vert_normal) vertex_normals_.resize(k);
     if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
-        }
+        utility::ParallelFor(
+                0, int64_t(triangles_.size()),
+                [&](int64_t tidx) {
+                    Eigen::Vector3i &triangle = triangles_[tidx];
+                    triangle(0) = index_old_to_new[triangle(0)];
+                    triangle(1) = index_old_to_new[triangle(1)];
+                    triangle(2) = index_old_to_new[triangle(2)];
+                },
+                kVoxelPointGrainSize);
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -713,35 +1031,49 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
                 "[RemoveDuplicatedTriangles] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    typedef std::tuple<int, int, int> Index3;
-    std::unordered_map<Index3, size_t, utility::hash_tuple::hash<Index3>>
-            triangle_to_old_index;
     bool has_tri_normal = HasTriangleNormals();
-    size_t old_triangle_num = triangles_.size();
-    size_t k = 0;
-    for (size_t i = 0; i < old_triangle_num; i++) {
-        Index3 index;
-        // We first need to find the minimum index. Because triangle (0-1-2)
-        // and triangle (2-0-1) are the same.
-        if (triangles_[i](0) <= triangles_[i](1)) {
-            if (triangles_[i](0) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](0), triangles_[i](1),
-                                        triangles_[i](2));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        } else {
-            if (triangles_[i](1) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](1), triangles_[i](2),
-                                        triangles_[i](0));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        }
-        if (triangle_to_old_index.find(index) == triangle_to_old_index.end()) {
-            triangle_to_old_index[index] = i;
+    const int64_t old_triangle_num = int64_t(triangles_.size());
+    // Rotate every triangle so that its minimum index comes first, because
+    // triangle (0-1-2) and triangle (2-0-1) are the same.
+    std::vector<Eigen::Vector3i> rotated(old_triangle_num);
+    utility::ParallelFor(
+            0, old_triangle_num,
+            [&](int64_t tidx) {
+                const Eigen::Vector3i &t = triangles_[tidx];
+                if (t(0) <= t(1) && t(0) <= t(2)) {
+                    rotated[tidx] = t;
+                } else if (t(1) < t(0) && t(1) <= t(2)) {
+                    rotated[tidx] = Eigen::Vector3i(t(1), t(2), t(0));
+                } else {
+                    rotated[tidx] = Eigen::Vector3i(t(2), t(0), t(1));
+                }
+            },
+            kVoxelPointGrainSize);
+    // Stable sort by the rotated indices, the last one first, so that equal
+    // triangles are adjacent and in their original order.
+    std::vector<int64_t> order(old_triangle_num);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint32_t> keys(old_triangle_num);
+    for (int c = 2; c >= 0; --c) {
+        utility::ParallelFor(
+                0, old_triangle_num,
+                [&](int64_t i) { keys[i] = uint32_t(rotated[order[i]](c)); },
+                kVoxelPointGrainSize);
+        utility::ParallelRadixSortPairs(keys, order, kVoxelPointGrainSize);
+    }
+    std::vector<uint8_t> is_first(old_triangle_num);
+    utility::ParallelFor(
+            0, old_triangle_num,
+            [&](int64_t i) {
+                is_first[order[i]] =
+                        i == 0 || rotated[order[i]] != rotated[order[i - 1]];
+            },
+            kVoxelPointGrainSize);
+
+    // Keep the first occurrence of every triangle.
+    int64_t k = 0;
+    for (int64_t i = 0; i < old_triangle_num; i++) {
+        if (is_first[i]) {
             triangles_[k] = triangles_[i];
             if (has_tri_normal) triangle_normals_[k] = triangle_normals_[i];
             k++;
@@ -786,11 +1118,15 @@ TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
     if (has_vert_normal) vertex_normals_.resize(k);
     if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
-        }
+        utility::ParallelFor(
+                0, int64_t(triangles_.size()),
+                [&](int64_t tidx) {
+                    Eigen::Vector3i &triangle = triangles_[tidx];
+                    triangle(0) = index_old_to_new[triangle(0)];
+                    triangle(1) = index_old_to_new[triangle(1)];
+                    triangle(2) = index_old_to_new[triangle(2)];
+                },
+                kVoxelPointGrainSize);
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -913,65 +1249,67 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
 }
 
 TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
-    KDTreeFlann kdtree(*this);
-    // precompute all neighbours
+    // Neighbors within eps with a larger index than every vertex, in
+    // increasing index order.
     utility::LogDebug("Precompute Neighbours");
-    std::vector<std::vector<int>> nbs(vertices_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(vertices_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(vertices_[idx], eps, nbs[idx], dists2);
-    }
+    std::vector<int> nbs;
+    std::vector<int64_t> nb_offsets;
+    FindClosePointPairs(vertices_, eps, nbs, nb_offsets);
     utility::LogDebug("Done Precompute Neighbours");
 
-    bool has_vertex_normals = HasVertexNormals();
-    bool has_vertex_colors = HasVertexColors();
-    std::vector<Eigen::Vector3d> new_vertices;
-    std::vector<Eigen::Vector3d> new_vertex_normals;
-    std::vector<Eigen::Vector3d> new_vertex_colors;
-    std::unordered_map<int, int> new_vert_mapping;
-    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        if (new_vert_mapping.count(vidx) > 0) {
+    // Every vertex that is not merged yet takes all its neighbors that are not
+    // merged yet. Vertices with a smaller index are merged before, so only
+    // the neighbors with a larger index are candidates.
+    const int num_vertices = int(vertices_.size());
+    std::vector<int> new_vert_mapping(num_vertices, -1);
+    std::vector<int> clusters;
+    std::vector<int64_t> cluster_offsets = {0};
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        if (new_vert_mapping[vidx] >= 0) {
             continue;
         }
-
-        int new_vidx = int(new_vertices.size());
+        const int new_vidx = int(cluster_offsets.size()) - 1;
         new_vert_mapping[vidx] = new_vidx;
-
-        Eigen::Vector3d vertex = vertices_[vidx];
-        Eigen::Vector3d normal;
-        if (has_vertex_normals) {
-            normal = vertex_normals_[vidx];
-        }
-        Eigen::Vector3d color;
-        if (has_vertex_colors) {
-            color = vertex_colors_[vidx];
-        }
-        int n = 1;
-        for (int nb : nbs[vidx]) {
-            if (vidx == nb || new_vert_mapping.count(nb) > 0) {
-                continue;
+        clusters.push_back(vidx);
+        for (int64_t i = nb_offsets[vidx]; i < nb_offsets[vidx + 1]; ++i) {
+            const int nb = nbs[i];
+            if (new_vert_mapping[nb] < 0) {
+                new_vert_mapping[nb] = new_vidx;
+                clusters.push_back(nb);
             }
-            vertex += vertices_[nb];
-            if (has_vertex_normals) {
-                normal += vertex_normals_[nb];
-            }
-            if (has_vertex_colors) {
-                color += vertex_colors_[nb];
-            }
-            new_vert_mapping[nb] = new_vidx;
-            n += 1;
-        }
-        new_vertices.push_back(vertex / n);
-        if (has_vertex_normals) {
-            new_vertex_normals.push_back(normal / n);
-        }
-        if (has_vertex_colors) {
-            new_vertex_colors.push_back(color / n);
         }
+        cluster_offsets.push_back(int64_t(clusters.size()));
     }
+
+    bool has_vertex_normals = HasVertexNormals();
+    bool has_vertex_colors = HasVertexColors();
+    const int64_t num_new_vertices = int64_t(cluster_offsets.size()) - 1;
+    std::vector<Eigen::Vector3d> new_vertices(num_new_vertices);
+    std::vector<Eigen::Vector3d> new_vertex_normals(
+            has_vertex_normals ? num_new_vertices : 0);
+    std::vector<Eigen::Vector3d> new_vertex_colors(
+            has_vertex_colors ? num_new_vertices : 0);
+    auto Average = [&](const std::vector<Eigen::Vector3d> &attribute,
+                       int64_t c) {
+        Eigen::Vector3d sum(0, 0, 0);
+        for (int64_t i = cluster_offsets[c]; i < cluster_offsets[c + 1]; ++i) {
+            sum += attribute[clusters[i]];
+        }
+        return Eigen::Vector3d(
+                sum / double(cluster_offsets[c + 1] - cluster_offsets[c]));
+    };
+    utility::ParallelFor(
+            0, num_new_vertices,
+            [&](int64_t c) {
+                new_vertices[c] = Average(vertices_, c);
+                if (has_vertex_normals) {
+                    new_vertex_normals[c] = Average(vertex_normals_, c);
+                }
+                if (has_vertex_colors) {
+                    new_vertex_colors[c] = Average(vertex_colors_, c);
+                }
+            },
+            kVoxelGrainSize);
     utility::LogDebug("Merged {} vertices",
                       vertices_.size() - new_vertices.size());
 
@@ -979,11 +1317,15 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::swap(vertex_normals_, new_vertex_normals);
     std::swap(vertex_colors_, new_vertex_colors);
 
-    for (auto &triangle : triangles_) {
-        triangle(0) = new_vert_mapping[triangle(0)];
-        triangle(1) = new_vert_mapping[triangle(1)];
-        triangle(2) = new_vert_mapping[triangle(2)];
-    }
+    utility::ParallelFor(
+            0, int64_t(triangles_.size()),
+            [&](int64_t tidx) {
+                Eigen::Vector3i &triangle = triangles_[tidx];
+                triangle(0) = new_vert_mapping[triangle(0)];
+                triangle(1) = new_vert_mapping[triangle(1)];
+                triangle(2) = new_vert_mapping[triangle(2)];
+            },
+            kVoxelPointGrainSize);
 
     if (HasTriangleNormals()) {
         ComputeTriangleNormals();
@@ -994,112 +1336,99 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
 
 template <typename F>
 bool OrientTriangleHelper(const std::vector<Eigen::Vector3i> &triangles,
+                          const TriangleMeshAdjacency &adjacency,
                           F &swap) {
-    std::unordered_map<Eigen::Vector2i, Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            edge_to_orientation;
-    std::unordered_set<int> unvisited_triangles;
-    std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            adjacent_triangles;
+    // First vertex of every edge in the direction it was first added, or -1.
+    std::vector<int> edge_to_orientation(adjacency.NumEdges(), -1);
+    std::vector<bool> visited_triangles(triangles.size(), false);
+    size_t next_unvisited = 0;
     std::queue<int> triangle_queue;
 
-    auto VerifyAndAdd = [&](int vidx0, int vidx1) {
-        Eigen::Vector2i key = TriangleMesh::GetOrderedEdge(vidx0, vidx1);
-        if (edge_to_orientation.count(key) > 0) {
-            if (edge_to_orientation.at(key)(0) == vidx0) {
+    auto VerifyAndAdd = [&](int eidx, int vidx0) {
+        if (edge_to_orientation[eidx] >= 0) {
+            if (edge_to_orientation[eidx] == vidx0) {
                 return false;
             }
         } else {
-            edge_to_orientation[key] = Eigen::Vector2i(vidx0, vidx1);
+            edge_to_orientation[eidx] = vidx0;
         }
         return true;
     };
-    auto AddTriangleNbsToQueue = [&](const Eigen::Vector2i &edge) {
-        for (int nb_tidx : adjacent_triangles[edge]) {
-            triangle_queue.push(nb_tidx);
+    auto AddTriangleNbsToQueue = [&](int eidx) {
+        for (int64_t i = adjacency.edge_offsets_[eidx];
+             i < adjacency.edge_offsets_[eidx + 1]; ++i) {
+            triangle_queue.push(adjacency.edge_triangles_[i]);
         }
     };
 
-    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
-        unvisited_triangles.insert(int(tidx));
-        const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        adjacent_triangles[TriangleMesh::GetOrderedEdge(vidx0, vidx1)].insert(
-                int(tidx));
-        adjacent_triangles[TriangleMesh::GetOrderedEdge(vidx1, vidx2)].insert(
-                int(tidx));
-        adjacent_triangles[TriangleMesh::GetOrderedEdge(vidx2, vidx0)].insert(
-                int(tidx));
-    }
-
-    while (!unvisited_triangles.empty()) {
+    while (true) {
         int tidx;
         if (triangle_queue.empty()) {
-            tidx = *unvisited_triangles.begin();
+            while (next_unvisited < triangles.size() &&
+                   visited_triangles[next_unvisited]) {
+                next_unvisited++;
+            }
+            if (next_unvisited == triangles.size()) {
+                break;
+            }
+            tidx = int(next_unvisited);
         } else {
             tidx = triangle_queue.front();
             triangle_queue.pop();
         }
-        if (unvisited_triangles.count(tidx) > 0) {
-            unvisited_triangles.erase(tidx);
-        } else {
+        if (visited_triangles[tidx]) {
             continue;
         }
+        visited_triangles[tidx] = true;
 
+        // Edge k of the triangle goes from vertex k to vertex k + 1.
         const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        Eigen::Vector2i key01 = TriangleMesh::GetOrderedEdge(vidx0, vidx1);
-        Eigen::Vector2i key12 = TriangleMesh::GetOrderedEdge(vidx1, vidx2);
-        Eigen::Vector2i key20 = TriangleMesh::GetOrderedEdge(vidx2, vidx0);
-        bool exist01 = edge_to_orientation.count(key01) > 0;
-        bool exist12 = edge_to_orientation.count(key12) > 0;
-        bool exist20 = edge_to_orientation.count(key20) > 0;
-
-        if (!(exist01 || exist12 || exist20)) {
-            edge_to_orientation[key01] = Eigen::Vector2i(vidx0, vidx1);
-            edge_to_orientation[key12] = Eigen::Vector2i(vidx1, vidx2);
-            edge_to_orientation[key20] = Eigen::Vector2i(vidx2, vidx0);
+        int vidx[3] = {triangle(0), triangle(1), triangle(2)};
+        int eidx[3] = {adjacency.triangle_edges_[tidx](0),
+                       adjacency.triangle_edges_[tidx](1),
+                       adjacency.triangle_edges_[tidx](2)};
+        bool exist[3];
+        for (int k = 0; k < 3; ++k) {
+            exist[k] = edge_to_orientation[eidx[k]] >= 0;
+        }
+
+        if (!(exist[0] || exist[1] || exist[2])) {
+            for (int k = 0; k < 3; ++k) {
+                edge_to_orientation[eidx[k]] = vidx[k];
+            }
         } else {
             // one flip is allowed
-            if (exist01 && edge_to_orientation.at(key01)(0) == vidx0) {
-                std::swap(vidx0, vidx1);
-                swap(tidx, 0, 1);
-            } else if (exist12 && edge_to_orientation.at(key12)(0) == vidx1) {
-                std::swap(vidx1, vidx2);
-                swap(tidx, 1, 2);
-            } else if (exist20 && edge_to_orientation.at(key20)(0) == vidx2) {
-                std::swap(vidx2, vidx0);
-                swap(tidx, 2, 0);
+            for (int k = 0; k < 3; ++k) {
+                if (exist[k] && edge_to_orientation[eidx[k]] == vidx[k]) {
+                    // Swapping vertices k and k + 1 keeps edge k and swaps
+                    // the other two.
+                    std::swap(vidx[k], vidx[(k + 1) % 3]);
+                    std::swap(eidx[(k + 1) % 3], eidx[(k + 2) % 3]);
+                    swap(tidx, k, (k + 1) % 3);
+                    break;
+                }
             }
 
             // check if each edge looks in different direction compared to
             // existing ones if not existend, add the edge to map
-            if (!VerifyAndAdd(vidx0, vidx1)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx1, vidx2)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx2, vidx0)) {
-                return false;
+            for (int k = 0; k < 3; ++k) {
+                if (!VerifyAndAdd(eidx[k], vidx[k])) {
+                    return false;
+                }
             }
         }
 
-        AddTriangleNbsToQueue(key01);
-        AddTriangleNbsToQueue(key12);
-        AddTriangleNbsToQueue(key20);
+        for (int k = 0; k < 3; ++k) {
+            AddTriangleNbsToQueue(eidx[k]);
+        }
     }
     return true;
 }
 
 bool TriangleMesh::IsOrientable() const {
     auto NoOp = [](int, int, int) {};
-    return OrientTriangleHelper(triangles_, NoOp);
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
+    return OrientTriangleHelper(triangles_, *adjacency, NoOp);
 }
 
 bool TriangleMesh::IsWatertight() const {
@@ -1110,7 +1439,8 @@ bool TriangleMesh::OrientTriangles() {
     auto SwapTriangleOrder = [&](int tidx, int idx0, int idx1) {
         std::swap(triangles_[tidx](idx0), triangles_[tidx](idx1));
     };
-    return OrientTriangleHelper(triangles_, SwapTriangleOrder);
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
+    return OrientTriangleHelper(triangles_, *adjacency, SwapTriangleOrder);
 }
 
 std::unordered_map<Eigen::Vector2i,
@@ -1230,13 +1560,13 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (size_t eidx = 0; eidx < adjacency->NumEdges(); ++eidx) {
+        const int64_t n_triangles = adjacency->NumEdgeTriangles(eidx);
+        if ((allow_boundary_edges && n_triangles > 2) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
+            non_manifold_edges.push_back(adjacency->edges_[eidx]);
         }
     }
     return non_manifold_edges;
@@ -1244,11 +1574,11 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
+    for (size_t eidx = 0; eidx < adjacency->NumEdges(); ++eidx) {
+        const int64_t n_triangles = adjacency->NumEdgeTriangles(eidx);
+        if ((allow_boundary_edges && n_triangles > 2) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
             return false;
         }
     }
@@ -1317,31 +1647,54 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
+    // Only the triangles whose bounding boxes overlap, found with a BVH, are
+    // tested. The pairs are in the order of the brute-force pair loop.
+    const TriangleMeshBVH bvh(*this);
+    const int64_t num_triangles = static_cast<int64_t>(triangles_.size());
+    std::vector<std::vector<int>> intersecting(num_triangles);
+    utility::ParallelFor(
+            0, num_triangles,
+            [&](int64_t tidx0) {
+                const Eigen::Vector3i &tria_p = triangles_[tidx0];
+                const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+                const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+                const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+                std::vector<int> candidates;
+                bvh.GetTrianglesOverlappingBox(p0.cwiseMin(p1).cwiseMin(p2),
+                                               p0.cwiseMax(p1).cwiseMax(p2),
+                                               candidates);
+                for (int tidx1 : candidates) {
+                    if (tidx1 <= tidx0) {
+                        continue;
+                    }
+                    const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                    // check if neighbour triangle
+                    if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
+                        tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
+                        tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
+                        tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
+                        tria_p(2) == tria_q(2)) {
+                        continue;
+                    }
 
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
+                    // check for intersection
+                    const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                             q1, q2)) {
+                        intersecting[tidx0].push_back(tidx1);
+                    }
+                }
+                std::sort(intersecting[tidx0].begin(),
+                          intersecting[tidx0].end());
+            },
+            64);
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+    for (int64_t tidx0 = 0; tidx0 < num_triangles; ++tidx0) {
+        for (int tidx1 : intersecting[tidx0]) {
+            self_intersecting_triangles.push_back(
+                    Eigen::Vector2i(static_cast<int>(tidx0), tidx1));
         }
     }
     return self_intersecting_triangles;
@@ -1360,22 +1713,38 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    // Test the triangles of this mesh against the triangles of other whose
+    // bounding boxes overlap theirs.
+    const TriangleMeshBVH bvh(other);
+    std::atomic<bool> is_intersecting(false);
+    utility::ParallelFor(
+            0, static_cast<int64_t>(triangles_.size()),
+            [&](int64_t tidx0) {
+                if (is_intersecting.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                const Eigen::Vector3i &tria_p = triangles_[tidx0];
+                const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+                const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+                const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+                std::vector<int> candidates;
+                bvh.GetTrianglesOverlappingBox(p0.cwiseMin(p1).cwiseMin(p2),
+                                               p0.cwiseMax(p1).cwiseMax(p2),
+                                               candidates);
+                for (int tidx1 : candidates) {
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                             q1, q2)) {
+                        is_intersecting = true;
+                        return;
+                    }
+                }
+            },
+            64);
+    return is_intersecting;
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -1385,26 +1754,7 @@ TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<double> areas;
 
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
+    const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*this);
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
@@ -1427,10 +1777,16 @@ TriangleMesh::ClusterConnectedTriangles() const {
             cluster_n_triangles++;
             cluster_area += GetTriangleArea(cluster_tidx);
 
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
+            // The neighbors are the triangles sharing an edge.
+            for (int k = 0; k < 3; ++k) {
+                const int eidx = adjacency->triangle_edges_[cluster_tidx](k);
+                for (int64_t i = adjacency->edge_offsets_[eidx];
+                     i < adjacency->edge_offsets_[eidx + 1]; ++i) {
+                    const int tnb = adjacency->edge_triangles_[i];
+                    if (triangle_clusters[tnb] == -1) {
+                        triangle_queue.push(tnb);
+                        triangle_clusters[tnb] = cluster_idx;
+                    }
                 }
             }
         }
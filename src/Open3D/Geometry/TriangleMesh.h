@@ -36,13 +36,16 @@
 
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/MeshBase.h"
+#include "Open3D/Geometry/SurfaceReconstructionPoisson.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
 
+class AsRigidAsPossibleDeformer;
 class PointCloud;
 class TetraMesh;
+class TriangleMeshAdjacency;
 
 /// \class TriangleMesh
 ///
@@ -124,15 +127,26 @@ public:
     }
 
     /// \brief Function to compute triangle normals, usually called before
-    /// rendering.
+    /// rendering. The triangles are processed in parallel.
     TriangleMesh &ComputeTriangleNormals(bool normalized = true);
 
     /// \brief Function to compute vertex normals, usually called before
     /// rendering.
-    TriangleMesh &ComputeVertexNormals(bool normalized = true);
+    ///
+    /// The triangle corners are bucketed by vertex, and every vertex gathers
+    /// the contributions of its corners in parallel and in triangle order, so
+    /// the result does not depend on the number of threads.
+    ///
+    /// \param normalized If true, the normals are normalized to length 1.
+    /// \param weighting How the triangles around a vertex are weighted.
+    TriangleMesh &ComputeVertexNormals(
+            bool normalized = true,
+            VertexNormalWeighting weighting =
+                    VertexNormalWeighting::TriangleNormals);
 
     /// \brief Function to compute adjacency list, call before adjacency list is
-    /// needed.
+    /// needed. The filters and topology queries of TriangleMesh build a
+    /// TriangleMeshAdjacency instead and do not need it.
     TriangleMesh &ComputeAdjacencyList();
 
     /// \brief Function that removes duplicated verties, i.e., vertices that
@@ -254,11 +268,12 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Only triangle pairs with overlapping bounding boxes, found with a
+    /// TriangleMeshBVH, are tested.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
     /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// See GetSelfIntersectingTriangles.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +281,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests each triangle against the triangles of the other mesh
+    /// whose bounding boxes overlap its own, found with a TriangleMeshBVH.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -347,7 +363,9 @@ public:
     }
 
     /// Function to sample \param number_of_points points uniformly from the
-    /// mesh.
+    /// mesh. The points are drawn in parallel from random number streams of a
+    /// fixed number of points, so \param seed yields the same points with any
+    /// number of threads.
     std::shared_ptr<PointCloud> SamplePointsUniformlyImpl(
             size_t number_of_points,
             std::vector<double> &triangle_areas,
@@ -377,12 +395,16 @@ public:
     /// normals. The triangle normals will be computed and added to the mesh
     /// if necessary. \p seed Sets the seed value used in the random
     /// generator, set to -1 to use a random seed value with each function call.
+    /// \p method selects the sample elimination of the paper or a parallel
+    /// grid based dart throwing over the initial samples.
     std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
             size_t number_of_points,
             double init_factor = 5,
             const std::shared_ptr<PointCloud> pcl_init = nullptr,
             bool use_triangle_normal = false,
-            int seed = -1);
+            int seed = -1,
+            PoissonDiskSamplingMethod method =
+                    PoissonDiskSamplingMethod::SampleElimination);
 
     /// Function to subdivide triangle mesh using the simple midpoint algorithm.
     /// Each triangle is subdivided into four triangles per iteration and the
@@ -415,8 +437,12 @@ public:
     /// \param target_number_of_triangles defines the number of triangles that
     /// the simplified mesh should have. It is not guaranteed that this number
     /// will be reached.
+    /// \param method selects the sequential implementation or the parallel
+    /// one, which is faster and needs less memory on large meshes.
     std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
-            int target_number_of_triangles) const;
+            int target_number_of_triangles,
+            QuadricDecimationMethod method =
+                    QuadricDecimationMethod::Sequential) const;
 
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
@@ -516,6 +542,9 @@ public:
     /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
     /// points.
     /// \return TriangleMesh of the alpha shape.
+    ///
+    /// To compute the alpha shapes of several alpha values, build an
+    /// AlphaComplex once and call AlphaComplex::ExtractAlphaShape.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudAlphaShape(
             const PointCloud &pcd,
             double alpha,
@@ -535,8 +564,15 @@ public:
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
     /// the ball that are used for the surface reconstruction.
+    /// \param max_points_per_tile If larger than 0 and \p pcd has more
+    /// points, the bounding box is split at the median of its longest axis
+    /// until every tile has at most this many points. The tiles are
+    /// reconstructed in parallel and the gaps between them are closed by a
+    /// final pass that pivots the ball over the tile boundaries.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            size_t max_points_per_tile = 0);
 
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
@@ -566,6 +602,21 @@ public:
                                 float scale = 1.1f,
                                 bool linear_fit = false);
 
+    /// \brief Function that computes a triangle mesh from an oriented
+    /// PointCloud, with control over threading and memory.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param option Depth, width, scale and linear fit as above, the number
+    /// of threads and the tiled mode that bounds the peak memory for large
+    /// point clouds.
+    /// \return The estimated TriangleMesh, per vertex density values and the
+    /// timing of the reconstruction stages.
+    static std::tuple<std::shared_ptr<TriangleMesh>,
+                      std::vector<double>,
+                      PoissonReconstructionStatistics>
+    CreateFromPointCloudPoisson(const PointCloud &pcd,
+                                const PoissonReconstructionOption &option);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
     /// distance from the center to the mesh vertices.
@@ -708,12 +759,15 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
+    // Builds its system matrix from ComputeEdgeWeightsCot.
+    friend class AsRigidAsPossibleDeformer;
+
     void FilterSmoothLaplacianHelper(
             std::shared_ptr<TriangleMesh> &mesh,
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const TriangleMeshAdjacency &adjacency,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Half-edge k of triangle t, i.e. half_edge_ = 3 * t + k, stored in the
+/// bucket of its smaller vertex together with its larger vertex.
+class HalfEdge {
+public:
+    int other_;
+    int half_edge_;
+};
+
+/// Replaces counts[0, n) by their exclusive prefix sums and sets
+/// offsets[i] = counts[i] for i in [0, n], i.e. offsets[n] is the total.
+int64_t ScanCounts(std::vector<std::atomic<int64_t>> &counts,
+                   std::vector<int64_t> &offsets) {
+    const size_t n = counts.size();
+    offsets.resize(n + 1);
+    int64_t offset = 0;
+    for (size_t i = 0; i < n; ++i) {
+        offsets[i] = offset;
+        offset += counts[i].load(std::memory_order_relaxed);
+        counts[i].store(offsets[i], std::memory_order_relaxed);
+    }
+    offsets[n] = offset;
+    return offset;
+}
+
+}  // unnamed namespace
+
+int TriangleMeshAdjacency::GetEdgeIndex(int vertex0, int vertex1) const {
+    const Eigen::Vector2i edge = TriangleMesh::GetOrderedEdge(vertex0, vertex1);
+    auto it = std::lower_bound(edges_.begin(), edges_.end(), edge,
+                               [](const Eigen::Vector2i &lhs,
+                                  const Eigen::Vector2i &rhs) {
+                                   return lhs(0) < rhs(0) ||
+                                          (lhs(0) == rhs(0) && lhs(1) < rhs(1));
+                               });
+    if (it == edges_.end() || *it != edge) {
+        return -1;
+    }
+    return static_cast<int>(it - edges_.begin());
+}
+
+std::shared_ptr<TriangleMeshAdjacency>
+TriangleMeshAdjacency::CreateFromTriangleMesh(const TriangleMesh &mesh) {
+    auto adjacency = std::make_shared<TriangleMeshAdjacency>();
+    const std::vector<Eigen::Vector3i> &triangles = mesh.triangles_;
+    const int64_t num_vertices = static_cast<int64_t>(mesh.vertices_.size());
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size());
+    if (3 * num_triangles > std::numeric_limits<int>::max()) {
+        utility::LogError(
+                "[TriangleMeshAdjacency::CreateFromTriangleMesh] Too many "
+                "triangles: {}.",
+                num_triangles);
+    }
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        if (triangle.minCoeff() < 0 || triangle.maxCoeff() >= num_vertices) {
+            utility::LogError(
+                    "[TriangleMeshAdjacency::CreateFromTriangleMesh] Triangle "
+                    "{} references a vertex out of range.",
+                    tidx);
+        }
+    }
+
+    // Bucket the half-edges by their smaller vertex. counts[v] is first the
+    // size of bucket v, then the next free slot in it.
+    std::vector<std::atomic<int64_t>> counts(num_vertices);
+    utility::ParallelFor(0, num_triangles, [&](int64_t tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        for (int k = 0; k < 3; ++k) {
+            const int vidx = std::min(triangle(k), triangle((k + 1) % 3));
+            counts[vidx].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::vector<int64_t> bucket_offsets;
+    std::vector<HalfEdge> half_edges(ScanCounts(counts, bucket_offsets));
+    utility::ParallelFor(0, num_triangles, [&](int64_t tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        for (int k = 0; k < 3; ++k) {
+            const int vidx0 = triangle(k);
+            const int vidx1 = triangle((k + 1) % 3);
+            const int64_t slot = counts[std::min(vidx0, vidx1)].fetch_add(
+                    1, std::memory_order_relaxed);
+            half_edges[slot].other_ = std::max(vidx0, vidx1);
+            half_edges[slot].half_edge_ = static_cast<int>(3 * tidx + k);
+        }
+    });
+
+    // Sort the buckets by the larger vertex, then by half-edge, and number
+    // the distinct edges. The edges of bucket v start at edge_begin[v].
+    std::vector<int64_t> edge_begin(num_vertices + 1, 0);
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+        auto begin = half_edges.begin() + bucket_offsets[vidx];
+        auto end = half_edges.begin() + bucket_offsets[vidx + 1];
+        std::sort(begin, end, [](const HalfEdge &lhs, const HalfEdge &rhs) {
+            return lhs.other_ < rhs.other_ ||
+                   (lhs.other_ == rhs.other_ &&
+                    lhs.half_edge_ < rhs.half_edge_);
+        });
+        int64_t num_edges = 0;
+        for (auto it = begin; it != end; ++it) {
+            if (it == begin || it->other_ != (it - 1)->other_) {
+                num_edges++;
+            }
+        }
+        edge_begin[vidx + 1] = num_edges;
+    });
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        edge_begin[vidx + 1] += edge_begin[vidx];
+    }
+    const int64_t num_edges = edge_begin[num_vertices];
+
+    // The sorted half-edges are the concatenated edge triangles.
+    adjacency->edges_.resize(num_edges);
+    adjacency->edge_offsets_.resize(num_edges + 1);
+    adjacency->edge_triangles_.resize(half_edges.size());
+    adjacency->triangle_edges_.resize(num_triangles);
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+        int64_t eidx = edge_begin[vidx] - 1;
+        for (int64_t i = bucket_offsets[vidx]; i < bucket_offsets[vidx + 1];
+             ++i) {
+            const HalfEdge &half_edge = half_edges[i];
+            if (i == bucket_offsets[vidx] ||
+                half_edge.other_ != half_edges[i - 1].other_) {
+                eidx++;
+                adjacency->edges_[eidx] = Eigen::Vector2i(
+                        static_cast<int>(vidx), half_edge.other_);
+                adjacency->edge_offsets_[eidx] = i;
+            }
+            adjacency->edge_triangles_[i] = half_edge.half_edge_ / 3;
+            adjacency->triangle_edges_[half_edge.half_edge_ / 3](
+                    half_edge.half_edge_ % 3) = static_cast<int>(eidx);
+        }
+    });
+    adjacency->edge_offsets_[num_edges] =
+            static_cast<int64_t>(half_edges.size());
+    std::vector<HalfEdge>().swap(half_edges);
+
+    // Every edge (v0, v1) makes v0 and v1 neighbors of each other.
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+        counts[vidx].store(0, std::memory_order_relaxed);
+    });
+    const std::vector<Eigen::Vector2i> &edges = adjacency->edges_;
+    utility::ParallelFor(0, num_edges, [&](int64_t eidx) {
+        counts[edges[eidx](0)].fetch_add(1, std::memory_order_relaxed);
+        if (edges[eidx](1) != edges[eidx](0)) {
+            counts[edges[eidx](1)].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    adjacency->vertex_neighbors_.resize(
+            ScanCounts(counts, adjacency->vertex_offsets_));
+    utility::ParallelFor(0, num_edges, [&](int64_t eidx) {
+        const int vidx0 = edges[eidx](0);
+        const int vidx1 = edges[eidx](1);
+        adjacency->vertex_neighbors_[counts[vidx0].fetch_add(
+                1, std::memory_order_relaxed)] = vidx1;
+        if (vidx1 != vidx0) {
+            adjacency->vertex_neighbors_[counts[vidx1].fetch_add(
+                    1, std::memory_order_relaxed)] = vidx0;
+        }
+    });
+    utility::ParallelFor(0, num_vertices, [&](int64_t vidx) {
+        std::sort(adjacency->vertex_neighbors_.begin() +
+                          adjacency->vertex_offsets_[vidx],
+                  adjacency->vertex_neighbors_.begin() +
+                          adjacency->vertex_offsets_[vidx + 1]);
+    });
+    return adjacency;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshAdjacency
+///
+/// \brief Vertex and edge adjacency of a triangle mesh, stored in compressed
+/// sparse row layout.
+///
+/// The undirected edges of the triangles are numbered in lexicographic order
+/// of (vertex0, vertex1) with vertex0 <= vertex1. The triangles of edge e are
+/// edge_triangles_[edge_offsets_[e]] to edge_triangles_[edge_offsets_[e + 1]
+/// - 1] in increasing order, and triangle_edges_[t] holds the edges (0, 1),
+/// (1, 2) and (2, 0) of triangle t. The neighbors of vertex i are
+/// vertex_neighbors_[vertex_offsets_[i]] to
+/// vertex_neighbors_[vertex_offsets_[i + 1] - 1] in increasing order. This
+/// is the same adjacency as TriangleMesh::GetEdgeToTrianglesMap and
+/// TriangleMesh::ComputeAdjacencyList, in a few flat arrays instead of one
+/// hash table entry or set per edge and vertex.
+class TriangleMeshAdjacency {
+public:
+    /// \brief Default Constructor.
+    TriangleMeshAdjacency() {}
+    ~TriangleMeshAdjacency() {}
+
+public:
+    /// Returns the number of vertices.
+    size_t NumVertices() const {
+        return vertex_offsets_.empty() ? 0 : vertex_offsets_.size() - 1;
+    }
+    /// Returns the number of undirected edges.
+    size_t NumEdges() const { return edges_.size(); }
+    /// Returns the number of triangles.
+    size_t NumTriangles() const { return triangle_edges_.size(); }
+    /// Returns the number of neighbors of vertex \p i.
+    int64_t NumVertexNeighbors(size_t i) const {
+        return vertex_offsets_[i + 1] - vertex_offsets_[i];
+    }
+    /// Returns the number of triangle references of edge \p e. Degenerate
+    /// triangles may reference an edge twice.
+    int64_t NumEdgeTriangles(size_t e) const {
+        return edge_offsets_[e + 1] - edge_offsets_[e];
+    }
+    /// Returns the index of edge (vertex0, vertex1) in either order, or -1 if
+    /// it is not an edge of the mesh.
+    int GetEdgeIndex(int vertex0, int vertex1) const;
+
+    /// \brief Factory function to build the adjacency of a triangle mesh.
+    ///
+    /// The half-edges of the triangles are bucketed by their smaller vertex
+    /// and the buckets are sorted in parallel, so the build takes linear
+    /// memory and time in the number of triangles.
+    ///
+    /// \param mesh The input mesh.
+    static std::shared_ptr<TriangleMeshAdjacency> CreateFromTriangleMesh(
+            const TriangleMesh &mesh);
+
+public:
+    /// Undirected edges, sorted, with vertex0 <= vertex1.
+    std::vector<Eigen::Vector2i> edges_;
+    /// Triangles of all edges, concatenated.
+    std::vector<int> edge_triangles_;
+    /// Offsets of the edges in edge_triangles_, of size NumEdges() + 1.
+    std::vector<int64_t> edge_offsets_;
+    /// Edges (0, 1), (1, 2) and (2, 0) of every triangle.
+    std::vector<Eigen::Vector3i> triangle_edges_;
+    /// Neighbors of all vertices, concatenated.
+    std::vector<int> vertex_neighbors_;
+    /// Offsets of the vertices in vertex_neighbors_, of size NumVertices() +
+    /// 1.
+    std::vector<int64_t> vertex_offsets_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,904 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+constexpr int TriangleMeshBVH::kPacketSize;
+
+namespace {
+
+using Node = TriangleMeshBVH::Node;
+
+/// Number of SAH bins per axis.
+constexpr int kNumBins = 16;
+/// Ranges with more triangles are always split.
+constexpr int64_t kMaxLeafSize = 8;
+/// Cost of traversing a node, relative to intersecting a packet. The
+/// intersection cost of a range is its number of packets, as the triangles of
+/// a packet are tested at once.
+constexpr double kTraversalCost = 1.0;
+/// Deeper nodes are split at the median, which bounds the depth of the tree
+/// and hence the traversal stacks.
+constexpr int kMaxSAHDepth = 64;
+constexpr int kMaxStackSize = 128;
+/// Grain size of the parallel bounds and binning passes.
+constexpr int64_t kBinningGrainSize = 1 << 14;
+/// Minimum number of triangles of the subtrees built in parallel.
+constexpr int64_t kMinSubtreeSize = 1 << 12;
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+double PacketCost(int64_t num_triangles) {
+    constexpr int64_t packet_size = TriangleMeshBVH::kPacketSize;
+    return static_cast<double>((num_triangles + packet_size - 1) / packet_size);
+}
+
+class Bounds {
+public:
+    void Grow(const Eigen::Vector3d &point) {
+        min_ = min_.cwiseMin(point);
+        max_ = max_.cwiseMax(point);
+    }
+    void Grow(const Bounds &bounds) {
+        min_ = min_.cwiseMin(bounds.min_);
+        max_ = max_.cwiseMax(bounds.max_);
+    }
+    /// Half of the surface area of the box, 0 if the box is empty.
+    double HalfArea() const {
+        if ((max_.array() < min_.array()).any()) {
+            return 0.0;
+        }
+        const Eigen::Vector3d extent = max_ - min_;
+        return extent(0) * extent(1) + extent(1) * extent(2) +
+               extent(2) * extent(0);
+    }
+
+public:
+    Eigen::Vector3d min_ = Eigen::Vector3d::Constant(kInfinity);
+    Eigen::Vector3d max_ = Eigen::Vector3d::Constant(-kInfinity);
+};
+
+/// Bounding box of a triangle and its index in the mesh. The builder
+/// partitions these in place, so the triangles of a node are contiguous in
+/// memory.
+class TriangleRef {
+public:
+    Eigen::Vector3d Centroid() const {
+        return (bounds_.min_ + bounds_.max_) * 0.5;
+    }
+
+public:
+    Bounds bounds_;
+    int index_;
+};
+
+/// Bounds of the triangles of a range and of their centroids.
+class RangeBounds {
+public:
+    void Grow(const RangeBounds &other) {
+        bounds_.Grow(other.bounds_);
+        centroid_bounds_.Grow(other.centroid_bounds_);
+    }
+    void Grow(const TriangleRef &ref) {
+        bounds_.Grow(ref.bounds_);
+        centroid_bounds_.Grow(ref.Centroid());
+    }
+
+public:
+    Bounds bounds_;
+    Bounds centroid_bounds_;
+};
+
+class Bin {
+public:
+    Bounds bounds_;
+    int64_t count_ = 0;
+};
+
+using Bins = std::array<Bin, kNumBins>;
+
+/// Range of triangles to turn into the subtree rooted at node_.
+class BuildTask {
+public:
+    int64_t begin_;
+    int64_t end_;
+    int depth_;
+    int node_;
+    RangeBounds range_bounds_;
+};
+
+/// Top-down binned SAH builder. The bounds of the children of a node are
+/// computed while partitioning it, so every level of the tree takes one
+/// binning pass and one partition pass over the triangles.
+class BVHBuilder {
+public:
+    BVHBuilder(std::vector<TriangleRef> &refs) : refs_(refs) {}
+
+    /// Returns the bounds of refs_[begin, end).
+    RangeBounds ComputeBounds(int64_t begin, int64_t end) const {
+        return utility::ParallelReduce(
+                begin, end, RangeBounds(),
+                [&](int64_t chunk_begin, int64_t chunk_end,
+                    RangeBounds range_bounds) {
+                    for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+                        range_bounds.Grow(refs_[i]);
+                    }
+                    return range_bounds;
+                },
+                [](RangeBounds lhs, const RangeBounds &rhs) {
+                    lhs.Grow(rhs);
+                    return lhs;
+                },
+                kBinningGrainSize);
+    }
+
+    /// Builds the subtree of \p task into nodes[task.node_], appending the
+    /// descendant nodes to \p nodes. Leaves temporarily store the position of
+    /// their first triangle in refs_. If \p deferred is not null, the
+    /// subtrees of at most \p deferred_size triangles are not built but
+    /// appended to \p deferred.
+    void Build(const BuildTask &task,
+               std::vector<Node> &nodes,
+               int64_t deferred_size = 0,
+               std::vector<BuildTask> *deferred = nullptr) const {
+        std::vector<BuildTask> stack = {task};
+        while (!stack.empty()) {
+            const BuildTask current = stack.back();
+            stack.pop_back();
+            const int64_t num_triangles = current.end_ - current.begin_;
+            if (deferred != nullptr && current.node_ != task.node_ &&
+                num_triangles <= deferred_size) {
+                deferred->push_back(current);
+                continue;
+            }
+            nodes[current.node_].min_bound_ =
+                    current.range_bounds_.bounds_.min_;
+            nodes[current.node_].max_bound_ =
+                    current.range_bounds_.bounds_.max_;
+            int64_t mid;
+            RangeBounds left_bounds, right_bounds;
+            if (!Split(current, mid, left_bounds, right_bounds)) {
+                nodes[current.node_].index_ = static_cast<int>(current.begin_);
+                nodes[current.node_].num_triangles_ =
+                        static_cast<int>(num_triangles);
+                continue;
+            }
+            const int left = static_cast<int>(nodes.size());
+            nodes.emplace_back();
+            nodes.emplace_back();
+            nodes[current.node_].index_ = left;
+            nodes[current.node_].num_triangles_ = 0;
+            stack.push_back({mid, current.end_, current.depth_ + 1, left + 1,
+                             right_bounds});
+            stack.push_back({current.begin_, mid, current.depth_ + 1, left,
+                             left_bounds});
+        }
+    }
+
+private:
+    /// Partitions refs_[begin, end) of \p task at \p mid and sets the bounds
+    /// of the two halves. Returns false if the range becomes a leaf.
+    bool Split(const BuildTask &task,
+               int64_t &mid,
+               RangeBounds &left_bounds,
+               RangeBounds &right_bounds) const {
+        const int64_t begin = task.begin_;
+        const int64_t end = task.end_;
+        const int64_t num_triangles = end - begin;
+        if (num_triangles <= 1) {
+            return false;
+        }
+        const RangeBounds &range_bounds = task.range_bounds_;
+        const Eigen::Vector3d &centroid_min =
+                range_bounds.centroid_bounds_.min_;
+        const Eigen::Vector3d extent =
+                range_bounds.centroid_bounds_.max_ - centroid_min;
+        // Only the axis with the largest centroid extent is binned.
+        int axis;
+        extent.maxCoeff(&axis);
+        if (!(extent(axis) > 0)) {
+            // All centroids coincide, split in the middle of the range.
+            if (num_triangles <= kMaxLeafSize) {
+                return false;
+            }
+            mid = begin + num_triangles / 2;
+            left_bounds = ComputeBounds(begin, mid);
+            right_bounds = ComputeBounds(mid, end);
+            return true;
+        }
+        const double bin_scale = kNumBins / extent(axis);
+        auto get_bin = [&](const Eigen::Vector3d &centroid) {
+            const int bin = static_cast<int>(
+                    (centroid(axis) - centroid_min(axis)) * bin_scale);
+            return std::min(bin, kNumBins - 1);
+        };
+
+        int best_bin = -1;
+        if (task.depth_ < kMaxSAHDepth) {
+            const Bins bins = ComputeBins(begin, end, get_bin);
+            // right_costs[b] is the cost of bins b to kNumBins - 1.
+            std::array<double, kNumBins> right_costs;
+            Bounds right;
+            int64_t right_count = 0;
+            for (int b = kNumBins - 1; b > 0; --b) {
+                right.Grow(bins[b].bounds_);
+                right_count += bins[b].count_;
+                right_costs[b] = right.HalfArea() * PacketCost(right_count);
+            }
+            double best_cost = kInfinity;
+            Bounds left;
+            int64_t left_count = 0;
+            for (int b = 0; b < kNumBins - 1; ++b) {
+                left.Grow(bins[b].bounds_);
+                left_count += bins[b].count_;
+                const double cost = left.HalfArea() * PacketCost(left_count) +
+                                    right_costs[b + 1];
+                if (left_count > 0 && left_count < num_triangles &&
+                    cost < best_cost) {
+                    best_cost = cost;
+                    best_bin = b;
+                }
+            }
+            const double half_area = range_bounds.bounds_.HalfArea();
+            const double split_cost =
+                    half_area > 0 ? kTraversalCost + best_cost / half_area
+                                  : kInfinity;
+            if (num_triangles <= kMaxLeafSize &&
+                split_cost >= PacketCost(num_triangles)) {
+                return false;
+            }
+        } else if (num_triangles <= kMaxLeafSize) {
+            return false;
+        }
+
+        if (best_bin < 0) {
+            // Median split.
+            mid = begin + num_triangles / 2;
+            std::nth_element(refs_.begin() + begin, refs_.begin() + mid,
+                             refs_.begin() + end,
+                             [&](const TriangleRef &lhs,
+                                 const TriangleRef &rhs) {
+                                 return lhs.Centroid()(axis) <
+                                        rhs.Centroid()(axis);
+                             });
+            left_bounds = ComputeBounds(begin, mid);
+            right_bounds = ComputeBounds(mid, end);
+            return true;
+        }
+
+        // Partition at the best bin, growing the bounds of both sides.
+        left_bounds = RangeBounds();
+        right_bounds = RangeBounds();
+        auto goes_left = [&](const TriangleRef &ref) {
+            return get_bin(ref.Centroid()) <= best_bin;
+        };
+        int64_t i = begin;
+        int64_t j = end;
+        while (true) {
+            while (i < j && goes_left(refs_[i])) {
+                left_bounds.Grow(refs_[i]);
+                ++i;
+            }
+            while (i < j && !goes_left(refs_[j - 1])) {
+                right_bounds.Grow(refs_[j - 1]);
+                --j;
+            }
+            if (i >= j) {
+                break;
+            }
+            std::swap(refs_[i], refs_[j - 1]);
+        }
+        mid = i;
+        return true;
+    }
+
+    template <typename get_bin_t>
+    Bins ComputeBins(int64_t begin,
+                     int64_t end,
+                     const get_bin_t &get_bin) const {
+        auto bin_range = [&](int64_t chunk_begin, int64_t chunk_end,
+                             Bins bins) {
+            for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+                Bin &bin = bins[get_bin(refs_[i].Centroid())];
+                bin.bounds_.Grow(refs_[i].bounds_);
+                bin.count_++;
+            }
+            return bins;
+        };
+        if (end - begin < 2 * kBinningGrainSize) {
+            return bin_range(begin, end, Bins());
+        }
+        return utility::ParallelReduce(
+                begin, end, Bins(), bin_range,
+                [](Bins lhs, const Bins &rhs) {
+                    for (size_t b = 0; b < lhs.size(); ++b) {
+                        lhs[b].bounds_.Grow(rhs[b].bounds_);
+                        lhs[b].count_ += rhs[b].count_;
+                    }
+                    return lhs;
+                },
+                kBinningGrainSize);
+    }
+
+private:
+    std::vector<TriangleRef> &refs_;
+};
+
+/// Ray with the reciprocal direction used by the slab test. Zero direction
+/// components are replaced by the smallest positive double, which avoids
+/// 0 * inf = NaN for origins on the plane of a box face.
+class Ray {
+public:
+    Ray(const Eigen::Vector3d &origin, const Eigen::Vector3d &direction)
+        : origin_(origin), direction_(direction) {
+        for (int i = 0; i < 3; ++i) {
+            const double component =
+                    direction(i) == 0 ? std::numeric_limits<double>::min()
+                                      : direction(i);
+            inv_direction_(i) = 1.0 / component;
+        }
+    }
+
+public:
+    Eigen::Vector3d origin_;
+    Eigen::Vector3d direction_;
+    Eigen::Array3d inv_direction_;
+};
+
+/// Returns the ray parameter where the ray enters the box of \p node, or
+/// infinity if the ray does not intersect it within [0, t_max).
+double IntersectBox(const Ray &ray, const Node &node, double t_max) {
+    const Eigen::Array3d t0 =
+            (node.min_bound_ - ray.origin_).array() * ray.inv_direction_;
+    const Eigen::Array3d t1 =
+            (node.max_bound_ - ray.origin_).array() * ray.inv_direction_;
+    const double t_near = std::max(t0.min(t1).maxCoeff(), 0.0);
+    const double t_far = std::min(t0.max(t1).minCoeff(), t_max);
+    return t_near <= t_far && t_near < t_max ? t_near : kInfinity;
+}
+
+/// Read-only view of TriangleMeshBVH::triangle_data_.
+class TriangleBlocks {
+public:
+    static constexpr int kBlockSize = 9 * TriangleMeshBVH::kPacketSize;
+
+    TriangleBlocks(const double *data) : data_(data) {}
+
+    /// Returns the block of triangles [block * kPacketSize, (block + 1) *
+    /// kPacketSize).
+    const double *GetBlock(int64_t block) const {
+        return data_ + block * kBlockSize;
+    }
+    /// Returns vertex p0 (vector 0) or edge e1 (1) or e2 (2) of triangle i.
+    Eigen::Vector3d GetVector(int vector, int64_t i) const {
+        constexpr int n = TriangleMeshBVH::kPacketSize;
+        const double *x = GetBlock(i / n) + 3 * vector * n + i % n;
+        return Eigen::Vector3d(x[0], x[n], x[2 * n]);
+    }
+
+private:
+    const double *data_;
+};
+
+/// Moller-Trumbore test of a ray against a block of triangles, of which the
+/// lanes [lane_begin, lane_end) belong to the leaf. The loop over the lanes
+/// has no branches, so the compiler vectorizes it. Sets t[k] to the ray
+/// parameter of the hit with lane k, or infinity if there is no hit in
+/// [0, t_max).
+void IntersectPacket(const Ray &ray,
+                     const double *block,
+                     int lane_begin,
+                     int lane_end,
+                     double t_max,
+                     double *t,
+                     double *u,
+                     double *v) {
+    constexpr int n = TriangleMeshBVH::kPacketSize;
+    const double ox = ray.origin_(0);
+    const double oy = ray.origin_(1);
+    const double oz = ray.origin_(2);
+    const double dx = ray.direction_(0);
+    const double dy = ray.direction_(1);
+    const double dz = ray.direction_(2);
+    const double *p0x = block;
+    const double *p0y = block + n;
+    const double *p0z = block + 2 * n;
+    const double *e1x = block + 3 * n;
+    const double *e1y = block + 4 * n;
+    const double *e1z = block + 5 * n;
+    const double *e2x = block + 6 * n;
+    const double *e2y = block + 7 * n;
+    const double *e2z = block + 8 * n;
+    for (int k = 0; k < n; ++k) {
+        const double px = dy * e2z[k] - dz * e2y[k];
+        const double py = dz * e2x[k] - dx * e2z[k];
+        const double pz = dx * e2y[k] - dy * e2x[k];
+        const double det = e1x[k] * px + e1y[k] * py + e1z[k] * pz;
+        const double inv_det = 1.0 / det;
+        const double sx = ox - p0x[k];
+        const double sy = oy - p0y[k];
+        const double sz = oz - p0z[k];
+        const double uk = (sx * px + sy * py + sz * pz) * inv_det;
+        const double qx = sy * e1z[k] - sz * e1y[k];
+        const double qy = sz * e1x[k] - sx * e1z[k];
+        const double qz = sx * e1y[k] - sy * e1x[k];
+        const double vk = (dx * qx + dy * qy + dz * qz) * inv_det;
+        const double tk = (e2x[k] * qx + e2y[k] * qy + e2z[k] * qz) * inv_det;
+        const bool hit = (k >= lane_begin) & (k < lane_end) & (det != 0.0) &
+                         (uk >= 0.0) & (vk >= 0.0) & (uk + vk <= 1.0) &
+                         (tk >= 0.0) & (tk < t_max);
+        t[k] = hit ? tk : kInfinity;
+        u[k] = uk;
+        v[k] = vk;
+    }
+}
+
+/// Node to visit, with the ray parameter or distance where it is entered.
+/// Not std::pair, which would zero the whole stack for every query.
+class StackEntry {
+public:
+    int node_;
+    double key_;
+};
+
+/// Traverses the nodes hit by \p ray front to back. leaf_func(node) tests
+/// the triangles of a leaf, may decrease \p t_max, and returns true to stop.
+template <typename func_t>
+void TraverseRay(const std::vector<Node> &nodes,
+                 const Ray &ray,
+                 double &t_max,
+                 const func_t &leaf_func) {
+    if (nodes.empty()) {
+        return;
+    }
+    StackEntry stack[kMaxStackSize];
+    int stack_size = 0;
+    const double t_root = IntersectBox(ray, nodes[0], t_max);
+    if (t_root < kInfinity) {
+        stack[stack_size++] = {0, t_root};
+    }
+    while (stack_size > 0) {
+        const StackEntry entry = stack[--stack_size];
+        if (entry.key_ >= t_max) {
+            continue;
+        }
+        const Node &node = nodes[entry.node_];
+        if (node.IsLeaf()) {
+            if (leaf_func(node)) {
+                return;
+            }
+            continue;
+        }
+        int near = node.index_;
+        int far = node.index_ + 1;
+        double t_near = IntersectBox(ray, nodes[near], t_max);
+        double t_far = IntersectBox(ray, nodes[far], t_max);
+        if (t_far < t_near) {
+            std::swap(near, far);
+            std::swap(t_near, t_far);
+        }
+        if (t_far < kInfinity) {
+            stack[stack_size++] = {far, t_far};
+        }
+        if (t_near < kInfinity) {
+            stack[stack_size++] = {near, t_near};
+        }
+    }
+}
+
+double BoxDistance2(const Node &node, const Eigen::Vector3d &point) {
+    return (node.min_bound_ - point)
+            .cwiseMax(point - node.max_bound_)
+            .cwiseMax(0.0)
+            .squaredNorm();
+}
+
+Eigen::Vector3d ClosestPointOnSegment(const Eigen::Vector3d &point,
+                                      const Eigen::Vector3d &a,
+                                      const Eigen::Vector3d &b) {
+    const Eigen::Vector3d ab = b - a;
+    const double length2 = ab.squaredNorm();
+    if (length2 == 0) {
+        return a;
+    }
+    const double s = std::min(std::max((point - a).dot(ab) / length2, 0.0),
+                              1.0);
+    return a + s * ab;
+}
+
+/// Closest point to \p point on the triangle (a, a + ab, a + ac), from
+/// Ericson, Real-Time Collision Detection, section 5.1.5.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &point,
+                                       const Eigen::Vector3d &a,
+                                       const Eigen::Vector3d &ab,
+                                       const Eigen::Vector3d &ac) {
+    const Eigen::Vector3d ap = point - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return a;
+    }
+    const Eigen::Vector3d bp = ap - ab;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return a + ab;
+    }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    const Eigen::Vector3d cp = ap - ac;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return a + ac;
+    }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        return a + ab + (ac - ab) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+    const double sum = va + vb + vc;
+    if (!(sum > 0)) {
+        // Degenerate triangle, the closest point is on one of its edges.
+        Eigen::Vector3d closest = ClosestPointOnSegment(point, a, a + ab);
+        for (const Eigen::Vector3d &candidate :
+             {ClosestPointOnSegment(point, a, a + ac),
+              ClosestPointOnSegment(point, a + ab, a + ac)}) {
+            if ((candidate - point).squaredNorm() <
+                (closest - point).squaredNorm()) {
+                closest = candidate;
+            }
+        }
+        return closest;
+    }
+    return a + ab * (vb / sum) + ac * (vc / sum);
+}
+
+}  // unnamed namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh) {
+    SetTriangleMesh(mesh);
+}
+
+bool TriangleMeshBVH::SetTriangleMesh(const TriangleMesh &mesh) {
+    nodes_.clear();
+    triangle_indices_.clear();
+    triangle_data_.clear();
+    const std::vector<Eigen::Vector3d> &vertices = mesh.vertices_;
+    const std::vector<Eigen::Vector3i> &triangles = mesh.triangles_;
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size());
+    if (num_triangles == 0) {
+        return true;
+    }
+    if (num_triangles > std::numeric_limits<int>::max() - kPacketSize) {
+        utility::LogError("Too many triangles for TriangleMeshBVH: {}.",
+                          num_triangles);
+    }
+
+    std::vector<TriangleRef> refs(num_triangles);
+    utility::ParallelFor(0, num_triangles, [&](int64_t tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        for (int i = 0; i < 3; ++i) {
+            refs[tidx].bounds_.Grow(vertices[triangle(i)]);
+        }
+        refs[tidx].index_ = static_cast<int>(tidx);
+    });
+
+    // The top of the tree is built with parallel binning passes, then its
+    // subtrees are built in parallel and spliced into nodes_.
+    BVHBuilder builder(refs);
+    const int64_t subtree_size = std::max(
+            kMinSubtreeSize, num_triangles / (8 * utility::GetNumThreads()));
+    std::vector<BuildTask> subtree_tasks;
+    nodes_.emplace_back();
+    builder.Build({0, num_triangles, 0, 0,
+                   builder.ComputeBounds(0, num_triangles)},
+                  nodes_, subtree_size, &subtree_tasks);
+    std::vector<std::vector<Node>> subtrees(subtree_tasks.size());
+    utility::ParallelFor(0, static_cast<int64_t>(subtree_tasks.size()),
+                         [&](int64_t i) {
+                             BuildTask task = subtree_tasks[i];
+                             task.node_ = 0;
+                             subtrees[i].emplace_back();
+                             builder.Build(task, subtrees[i]);
+                         });
+    for (size_t i = 0; i < subtrees.size(); ++i) {
+        // Local node k > 0 of the subtree goes to offset + k.
+        const int offset = static_cast<int>(nodes_.size()) - 1;
+        for (Node &node : subtrees[i]) {
+            if (!node.IsLeaf()) {
+                node.index_ += offset;
+            }
+        }
+        nodes_[subtree_tasks[i].node_] = subtrees[i][0];
+        nodes_.insert(nodes_.end(), subtrees[i].begin() + 1,
+                      subtrees[i].end());
+    }
+
+    // The leaves index refs, copy the triangles in that order.
+    triangle_indices_.resize(num_triangles);
+    const int64_t num_blocks = (num_triangles + kPacketSize - 1) / kPacketSize;
+    triangle_data_.assign(num_blocks * 9 * kPacketSize, 0.0);
+    utility::ParallelFor(0, num_triangles, [&](int64_t i) {
+        const int tidx = refs[i].index_;
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        const Eigen::Vector3d &p0 = vertices[triangle(0)];
+        const Eigen::Vector3d e1 = vertices[triangle(1)] - p0;
+        const Eigen::Vector3d e2 = vertices[triangle(2)] - p0;
+        double *lane = triangle_data_.data() +
+                       i / kPacketSize * 9 * kPacketSize + i % kPacketSize;
+        for (int c = 0; c < 3; ++c) {
+            lane[c * kPacketSize] = p0(c);
+            lane[(3 + c) * kPacketSize] = e1(c);
+            lane[(6 + c) * kPacketSize] = e2(c);
+        }
+        triangle_indices_[i] = tidx;
+    });
+    return true;
+}
+
+TriangleMeshBVH::RayHit TriangleMeshBVH::CastRay(
+        const Eigen::Vector3d &origin,
+        const Eigen::Vector3d &direction,
+        double t_max) const {
+    RayHit hit;
+    const Ray ray(origin, direction);
+    const TriangleBlocks blocks(triangle_data_.data());
+    TraverseRay(nodes_, ray, t_max, [&](const Node &node) {
+        double t[kPacketSize], u[kPacketSize], v[kPacketSize];
+        const int begin = node.index_;
+        const int end = node.index_ + node.num_triangles_;
+        for (int first = begin - begin % kPacketSize; first < end;
+             first += kPacketSize) {
+            IntersectPacket(ray, blocks.GetBlock(first / kPacketSize),
+                            begin - first, end - first, t_max, t, u, v);
+            for (int k = 0; k < kPacketSize; ++k) {
+                if (t[k] < t_max) {
+                    t_max = t[k];
+                    hit.t_ = t[k];
+                    hit.triangle_index_ = triangle_indices_[first + k];
+                    hit.u_ = u[k];
+                    hit.v_ = v[k];
+                }
+            }
+        }
+        return false;
+    });
+    return hit;
+}
+
+std::vector<TriangleMeshBVH::RayHit> TriangleMeshBVH::CastRays(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions,
+        double t_max) const {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "Number of ray origins ({}) and directions ({}) differ.",
+                origins.size(), directions.size());
+    }
+    std::vector<RayHit> hits(origins.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(origins.size()),
+            [&](int64_t i) {
+                hits[i] = CastRay(origins[i], directions[i], t_max);
+            },
+            256);
+    return hits;
+}
+
+bool TriangleMeshBVH::IsOccluded(const Eigen::Vector3d &origin,
+                                 const Eigen::Vector3d &direction,
+                                 double t_max) const {
+    bool is_occluded = false;
+    const Ray ray(origin, direction);
+    const TriangleBlocks blocks(triangle_data_.data());
+    TraverseRay(nodes_, ray, t_max, [&](const Node &node) {
+        double t[kPacketSize], u[kPacketSize], v[kPacketSize];
+        const int begin = node.index_;
+        const int end = node.index_ + node.num_triangles_;
+        for (int first = begin - begin % kPacketSize; first < end;
+             first += kPacketSize) {
+            IntersectPacket(ray, blocks.GetBlock(first / kPacketSize),
+                            begin - first, end - first, t_max, t, u, v);
+            for (int k = 0; k < kPacketSize; ++k) {
+                if (t[k] < t_max) {
+                    is_occluded = true;
+                    return true;
+                }
+            }
+        }
+        return false;
+    });
+    return is_occluded;
+}
+
+std::vector<bool> TriangleMeshBVH::TestOcclusions(
+        const std::vector<Eigen::Vector3d> &origins,
+        const std::vector<Eigen::Vector3d> &directions,
+        double t_max) const {
+    if (origins.size() != directions.size()) {
+        utility::LogError(
+                "Number of ray origins ({}) and directions ({}) differ.",
+                origins.size(), directions.size());
+    }
+    // std::vector<bool> packs bits and cannot be written concurrently.
+    std::vector<uint8_t> is_occluded(origins.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(origins.size()),
+            [&](int64_t i) {
+                is_occluded[i] = IsOccluded(origins[i], directions[i], t_max);
+            },
+            256);
+    return std::vector<bool>(is_occluded.begin(), is_occluded.end());
+}
+
+TriangleMeshBVH::ClosestPoint TriangleMeshBVH::ComputeClosestPoint(
+        const Eigen::Vector3d &query) const {
+    ClosestPoint closest;
+    if (nodes_.empty()) {
+        return closest;
+    }
+    const TriangleBlocks blocks(triangle_data_.data());
+    StackEntry stack[kMaxStackSize];
+    int stack_size = 0;
+    stack[stack_size++] = {0, BoxDistance2(nodes_[0], query)};
+    while (stack_size > 0) {
+        const StackEntry entry = stack[--stack_size];
+        if (entry.key_ >= closest.distance2_) {
+            continue;
+        }
+        const Node &node = nodes_[entry.node_];
+        if (node.IsLeaf()) {
+            const int end = node.index_ + node.num_triangles_;
+            for (int i = node.index_; i < end; ++i) {
+                const Eigen::Vector3d point = ClosestPointOnTriangle(
+                        query, blocks.GetVector(0, i), blocks.GetVector(1, i),
+                        blocks.GetVector(2, i));
+                const double distance2 = (point - query).squaredNorm();
+                if (distance2 < closest.distance2_) {
+                    closest.point_ = point;
+                    closest.triangle_index_ = triangle_indices_[i];
+                    closest.distance2_ = distance2;
+                }
+            }
+            continue;
+        }
+        int near = node.index_;
+        int far = node.index_ + 1;
+        double d_near = BoxDistance2(nodes_[near], query);
+        double d_far = BoxDistance2(nodes_[far], query);
+        if (d_far < d_near) {
+            std::swap(near, far);
+            std::swap(d_near, d_far);
+        }
+        stack[stack_size++] = {far, d_far};
+        stack[stack_size++] = {near, d_near};
+    }
+    return closest;
+}
+
+std::vector<TriangleMeshBVH::ClosestPoint>
+TriangleMeshBVH::ComputeClosestPoints(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    std::vector<ClosestPoint> closest(queries.size());
+    utility::ParallelFor(
+            0, static_cast<int64_t>(queries.size()),
+            [&](int64_t i) { closest[i] = ComputeClosestPoint(queries[i]); },
+            256);
+    return closest;
+}
+
+void TriangleMeshBVH::GetTrianglesOverlappingBox(
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound,
+        std::vector<int> &indices) const {
+    indices.clear();
+    if (nodes_.empty()) {
+        return;
+    }
+    auto is_overlapping = [&](const Eigen::Vector3d &box_min,
+                              const Eigen::Vector3d &box_max) {
+        return (box_min.array() <= max_bound.array()).all() &&
+               (min_bound.array() <= box_max.array()).all();
+    };
+    const TriangleBlocks blocks(triangle_data_.data());
+    int stack[kMaxStackSize];
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+    while (stack_size > 0) {
+        const Node &node = nodes_[stack[--stack_size]];
+        if (!is_overlapping(node.min_bound_, node.max_bound_)) {
+            continue;
+        }
+        if (!node.IsLeaf()) {
+            stack[stack_size++] = node.index_ + 1;
+            stack[stack_size++] = node.index_;
+            continue;
+        }
+        const int end = node.index_ + node.num_triangles_;
+        for (int i = node.index_; i < end; ++i) {
+            const Eigen::Vector3d p0 = blocks.GetVector(0, i);
+            const Eigen::Vector3d p1 = p0 + blocks.GetVector(1, i);
+            const Eigen::Vector3d p2 = p0 + blocks.GetVector(2, i);
+            if (is_overlapping(p0.cwiseMin(p1).cwiseMin(p2),
+                               p0.cwiseMax(p1).cwiseMax(p2))) {
+                indices.push_back(triangle_indices_[i]);
+            }
+        }
+    }
+}
+
+std::shared_ptr<Image> TriangleMeshBVH::RenderDepthImage(
+        const camera::PinholeCameraParameters &camera_parameter) const {
+    const camera::PinholeCameraIntrinsic &intrinsic =
+            camera_parameter.intrinsic_;
+    auto image = std::make_shared<Image>();
+    image->Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    const Eigen::Matrix4d camera_pose = camera_parameter.extrinsic_.inverse();
+    const Eigen::Matrix3d rotation = camera_pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = camera_pose.block<3, 1>(0, 3);
+    const auto focal_length = intrinsic.GetFocalLength();
+    const auto principal_point = intrinsic.GetPrincipalPoint();
+    utility::ParallelFor(0, intrinsic.height_, [&](int64_t v) {
+        for (int u = 0; u < intrinsic.width_; ++u) {
+            // The camera z coordinate of the direction is 1, so the ray
+            // parameter is the depth.
+            const Eigen::Vector3d direction =
+                    rotation *
+                    Eigen::Vector3d((u - principal_point.first) /
+                                            focal_length.first,
+                                    (v - principal_point.second) /
+                                            focal_length.second,
+                                    1.0);
+            const RayHit hit = CastRay(origin, direction);
+            *image->PointerAt<float>(u, static_cast<int>(v)) =
+                    hit.IsHit() ? static_cast<float>(hit.t_) : 0.0f;
+        }
+    });
+    return image;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+class Image;
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy over the triangles of a TriangleMesh, for
+/// batched ray casting, closest point queries and intersection tests.
+///
+/// The hierarchy is built top-down with the binned surface area heuristic
+/// (SAH). The nodes are stored in one array, the two children of an internal
+/// node are next to each other. The triangles of a leaf are contiguous and
+/// stored in blocks of four in structure-of-arrays layout, so that a ray is
+/// tested against packets of four triangles at once. The triangle vertices
+/// are copied, the mesh may be modified or destroyed after the hierarchy is
+/// built.
+class TriangleMeshBVH {
+public:
+    /// Number of triangles in a packet.
+    static constexpr int kPacketSize = 4;
+
+    /// \class Node
+    ///
+    /// \brief Node of the hierarchy.
+    class Node {
+    public:
+        /// Returns true if the node holds triangles.
+        bool IsLeaf() const { return num_triangles_ > 0; }
+
+    public:
+        /// Lower corner of the bounding box of the node.
+        Eigen::Vector3d min_bound_;
+        /// Upper corner of the bounding box of the node.
+        Eigen::Vector3d max_bound_;
+        /// For a leaf, the position of its first triangle in
+        /// triangle_indices_. For an internal node, the index of its first
+        /// child; the second child follows it.
+        int index_ = 0;
+        /// Number of triangles of a leaf, 0 for internal nodes.
+        int num_triangles_ = 0;
+    };
+
+    /// \class RayHit
+    ///
+    /// \brief First intersection of a ray with the mesh.
+    class RayHit {
+    public:
+        /// Returns true if the ray hit a triangle.
+        bool IsHit() const { return triangle_index_ >= 0; }
+
+    public:
+        /// Ray parameter of the hit, i.e. the hit point is origin + t *
+        /// direction. Infinite if the ray does not hit the mesh.
+        double t_ = std::numeric_limits<double>::infinity();
+        /// Index of the hit triangle in the mesh, -1 if there is no hit.
+        int triangle_index_ = -1;
+        /// Barycentric coordinates of the hit point: the point is (1 - u - v)
+        /// * p0 + u * p1 + v * p2 for the triangle (p0, p1, p2).
+        double u_ = 0.0;
+        double v_ = 0.0;
+    };
+
+    /// \class ClosestPoint
+    ///
+    /// \brief Closest point on the mesh to a query point.
+    class ClosestPoint {
+    public:
+        /// The closest point.
+        Eigen::Vector3d point_ = Eigen::Vector3d::Zero();
+        /// Index of the triangle of the closest point, -1 for an empty mesh.
+        int triangle_index_ = -1;
+        /// Squared distance between the query point and the closest point.
+        double distance2_ = std::numeric_limits<double>::infinity();
+    };
+
+public:
+    /// \brief Default Constructor.
+    TriangleMeshBVH() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh The mesh whose triangles are indexed.
+    TriangleMeshBVH(const TriangleMesh &mesh);
+    ~TriangleMeshBVH() {}
+
+public:
+    /// Builds the hierarchy over the triangles of \p mesh, replacing the
+    /// current one. The build runs in parallel.
+    bool SetTriangleMesh(const TriangleMesh &mesh);
+
+    /// Returns true if the hierarchy has no triangles.
+    bool IsEmpty() const { return nodes_.empty(); }
+    /// Returns the number of triangles in the hierarchy.
+    size_t NumTriangles() const { return triangle_indices_.size(); }
+
+    /// \brief Returns the first intersection of a ray with the mesh.
+    ///
+    /// Hits with t in [0, t_max) are reported. Triangles are two-sided and
+    /// \p direction need not be normalized.
+    ///
+    /// \param origin Origin of the ray.
+    /// \param direction Direction of the ray.
+    /// \param t_max Maximum ray parameter.
+    RayHit CastRay(const Eigen::Vector3d &origin,
+                   const Eigen::Vector3d &direction,
+                   double t_max = std::numeric_limits<double>::infinity())
+            const;
+
+    /// Casts the rays (origins[i], directions[i]) in parallel, see CastRay.
+    std::vector<RayHit> CastRays(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions,
+            double t_max = std::numeric_limits<double>::infinity()) const;
+
+    /// Returns true if the ray hits any triangle with t in [0, t_max). This
+    /// stops at the first hit found and is faster than CastRay for visibility
+    /// checks.
+    bool IsOccluded(const Eigen::Vector3d &origin,
+                    const Eigen::Vector3d &direction,
+                    double t_max = std::numeric_limits<double>::infinity())
+            const;
+
+    /// Tests the rays (origins[i], directions[i]) in parallel, see
+    /// IsOccluded.
+    std::vector<bool> TestOcclusions(
+            const std::vector<Eigen::Vector3d> &origins,
+            const std::vector<Eigen::Vector3d> &directions,
+            double t_max = std::numeric_limits<double>::infinity()) const;
+
+    /// Returns the closest point on the mesh to \p query.
+    ClosestPoint ComputeClosestPoint(const Eigen::Vector3d &query) const;
+
+    /// Computes the closest points to \p queries in parallel.
+    std::vector<ClosestPoint> ComputeClosestPoints(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Sets \p indices to the triangles whose bounding box overlaps the box
+    /// [min_bound, max_bound], in no particular order.
+    void GetTrianglesOverlappingBox(const Eigen::Vector3d &min_bound,
+                                    const Eigen::Vector3d &max_bound,
+                                    std::vector<int> &indices) const;
+
+    /// \brief Renders the depth image of the mesh seen from a pinhole camera.
+    ///
+    /// One ray is cast per pixel, through the pixel coordinates used by
+    /// PointCloud::CreateFromDepthImage. The result is a float image with the
+    /// depth along the camera axis, and 0 where no triangle is visible.
+    ///
+    /// \param camera_parameter Intrinsic and extrinsic camera parameters.
+    std::shared_ptr<Image> RenderDepthImage(
+            const camera::PinholeCameraParameters &camera_parameter) const;
+
+public:
+    /// Nodes of the hierarchy, the root is the first node.
+    std::vector<Node> nodes_;
+    /// Mesh indices of the triangles, in leaf order.
+    std::vector<int> triangle_indices_;
+
+private:
+    /// Vertex p0 and edges p1 - p0 and p2 - p0 of the triangles in leaf
+    /// order, in blocks of kPacketSize triangles. A block holds the
+    /// coordinates p0.x, p0.y, p0.z, e1.x, ..., e2.z one after the other,
+    /// with kPacketSize values each. The last block is padded with zeros.
+    std::vector<double> triangle_data_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
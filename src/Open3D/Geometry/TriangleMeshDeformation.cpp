@@ -3,7 +3,7 @@
 // ----------------------------------------------------------------------------
 // The MIT License (MIT)
 //
-// Copyright (c) 2019 www.open3d.org
+// Copyright (c) 2018 www.open3d.org
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -24,190 +24,305 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "Open3D/Geometry/TriangleMesh.h"
+
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
 
+#include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
-        const std::vector<int> &constraint_vertex_indices,
-        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
-        size_t max_iter,
-        DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+/// Vertices per task when fitting rotations and assembling right-hand sides.
+constexpr int64_t kARAPVertexGrainSize = 1024;
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
-
-    std::unordered_map<int, Eigen::Vector3d> constraints;
-    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
-                         idx < constraint_vertex_positions.size();
-         ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+class AsRigidAsPossibleDeformer::Solver {
+public:
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt_;
+};
+
+AsRigidAsPossibleDeformer::AsRigidAsPossibleDeformer(
+        const TriangleMesh &mesh,
+        const std::vector<int> &constraint_vertex_indices)
+    : vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      constraint_vertex_indices_(constraint_vertex_indices),
+      solver_(new Solver()) {
+    const int num_vertices = int(vertices_.size());
+    constraint_index_.assign(num_vertices, -1);
+    for (size_t idx = 0; idx < constraint_vertex_indices_.size(); ++idx) {
+        const int vidx = constraint_vertex_indices_[idx];
+        if (vidx < 0 || vidx >= num_vertices) {
+            utility::LogError(
+                    "[AsRigidAsPossibleDeformer] Constraint vertex index {} is "
+                    "out of range [0, {}).",
+                    vidx, num_vertices);
+        }
+        constraint_index_[vidx] = int(idx);
+    }
+    free_index_.assign(num_vertices, -1);
+    for (int i = 0; i < num_vertices; ++i) {
+        if (constraint_index_[i] < 0) {
+            free_index_[i] = int(free_vertices_.size());
+            free_vertices_.push_back(i);
+        }
     }
 
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+    utility::LogDebug("[AsRigidAsPossibleDeformer] setting up S'");
+    TriangleMesh rest;
+    rest.vertices_ = vertices_;
+    rest.triangles_ = triangles_;
+    rest.ComputeAdjacencyList();
+    auto edges_to_vertices = rest.GetEdgeToVerticesMap();
+    auto edge_weights =
+            rest.ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+    surface_area_ = rest.GetSurfaceArea();
+    neighbor_offsets_.assign(num_vertices + 1, 0);
+    for (int i = 0; i < num_vertices; ++i) {
+        neighbor_offsets_[i + 1] =
+                neighbor_offsets_[i] + int64_t(rest.adjacency_list_[i].size());
     }
+    neighbors_.resize(neighbor_offsets_[num_vertices]);
+    weights_.resize(neighbor_offsets_[num_vertices]);
+    utility::ParallelFor(
+            0, num_vertices,
+            [&](int64_t i) {
+                int64_t k = neighbor_offsets_[i];
+                for (int j : rest.adjacency_list_[i]) {
+                    neighbors_[k] = j;
+                    weights_[k] = edge_weights.at(
+                            TriangleMesh::GetOrderedEdge(int(i), j));
+                    k++;
+                }
+            },
+            kARAPVertexGrainSize);
+    utility::LogDebug("[AsRigidAsPossibleDeformer] done setting up S'");
 
-    // Build system matrix L and its solver
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
+    // The rows of the constrained vertices are eliminated, which leaves the
+    // symmetric positive definite Laplacian of the free vertices.
+    utility::LogDebug(
+            "[AsRigidAsPossibleDeformer] setting up system matrix L");
     std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    triplets.reserve(neighbors_.size() + free_vertices_.size());
+    for (int row = 0; row < int(free_vertices_.size()); ++row) {
+        const int i = free_vertices_[row];
+        double W = 0;
+        for (int64_t k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1];
+             ++k) {
+            const int col = free_index_[neighbors_[k]];
+            if (col >= 0) {
+                triplets.push_back(
+                        Eigen::Triplet<double>(row, col, -weights_[k]));
             }
+            W += weights_[k];
         }
+        // Vertices without weighted edges keep their rest position.
+        triplets.push_back(Eigen::Triplet<double>(row, row, W > 0 ? W : 1));
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(free_vertices_.size(),
+                                  free_vertices_.size());
     L.setFromTriplets(triplets.begin(), triplets.end());
     utility::LogDebug(
-            "[DeformAsRigidAsPossible] done setting up system matrix L");
+            "[AsRigidAsPossibleDeformer] done setting up system matrix L");
+
+    utility::LogDebug("[AsRigidAsPossibleDeformer] setting up sparse solver");
+    if (L.rows() > 0) {
+        solver_->ldlt_.compute(L);
+        if (solver_->ldlt_.info() != Eigen::Success) {
+            utility::LogError(
+                    "[AsRigidAsPossibleDeformer] Failed to build solver "
+                    "(factorize)");
+        }
+    }
+    utility::LogDebug(
+            "[AsRigidAsPossibleDeformer] done setting up sparse solver");
+}
+
+AsRigidAsPossibleDeformer::~AsRigidAsPossibleDeformer() {}
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
+void AsRigidAsPossibleDeformer::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        std::vector<Eigen::Vector3d> &vertices,
+        size_t max_iter,
+        MeshBase::DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    if (constraint_vertex_positions.size() !=
+        constraint_vertex_indices_.size()) {
         utility::LogError(
-                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
-    } else {
-        utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
+                "[AsRigidAsPossibleDeformer] {} constraint positions given for "
+                "{} constraint vertices.",
+                constraint_vertex_positions.size(),
+                constraint_vertex_indices_.size());
     }
+    const int num_vertices = int(vertices_.size());
+    const int num_free = int(free_vertices_.size());
+    if (vertices.size() != vertices_.size()) {
+        vertices = vertices_;
+    }
+    const bool smoothed =
+            energy_model == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    auto ConstraintPosition = [&](int vidx) -> const Eigen::Vector3d & {
+        return constraint_vertex_positions[constraint_index_[vidx]];
+    };
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+    std::vector<Eigen::Matrix3d> Rs(num_vertices,
+                                    Eigen::Matrix3d::Identity());
+    std::vector<Eigen::Matrix3d> Rs_old;
+    if (smoothed) {
+        Rs_old.resize(num_vertices, Eigen::Matrix3d::Identity());
+    }
+    Eigen::Matrix<double, Eigen::Dynamic, 3> b(num_free, 3);
+    Eigen::Matrix<double, Eigen::Dynamic, 3> p_prime(num_free, 3);
     for (size_t iter = 0; iter < max_iter; ++iter) {
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
+        if (smoothed) {
             std::swap(Rs, Rs_old);
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update rotations
-            Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
-            Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
-            int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    R += Rs_old[j];
-                }
-                n_nbs++;
-            }
-            if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
-                iter > 0 && n_nbs > 0) {
-                S = 2 * S +
-                    (4 * smoothed_alpha * surface_area / n_nbs) * R.transpose();
-            }
-            Eigen::JacobiSVD<Eigen::Matrix3d> svd(
-                    S, Eigen::ComputeFullU | Eigen::ComputeFullV);
-            Eigen::Matrix3d U = svd.matrixU();
-            Eigen::Matrix3d V = svd.matrixV();
-            Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
-            // ensure rotation:
-            // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
-            Rs[i] = V * D.asDiagonal() * U.transpose();
-            if (Rs[i].determinant() <= 0) {
-                utility::LogError(
-                        "[DeformAsRigidAsPossible] something went wrong with "
-                        "updating R");
-            }
-        }
+        // Update rotations
+        utility::ParallelFor(
+                0, num_vertices,
+                [&](int64_t i) {
+                    Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+                    Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+                    const int64_t begin = neighbor_offsets_[i];
+                    const int64_t end = neighbor_offsets_[i + 1];
+                    for (int64_t k = begin; k < end; ++k) {
+                        const int j = neighbors_[k];
+                        Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+                        Eigen::Vector3d e1 = vertices[i] - vertices[j];
+                        S += weights_[k] * (e0 * e1.transpose());
+                        if (smoothed) {
+                            R += Rs_old[j];
+                        }
+                    }
+                    const int64_t n_nbs = end - begin;
+                    if (smoothed && iter > 0 && n_nbs > 0) {
+                        S = 2 * S + (4 * smoothed_alpha * surface_area_ /
+                                     n_nbs) * R.transpose();
+                    }
+                    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                            S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+                    Eigen::Matrix3d U = svd.matrixU();
+                    Eigen::Matrix3d V = svd.matrixV();
+                    Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+                    // ensure rotation:
+                    // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+                    Rs[i] = V * D.asDiagonal() * U.transpose();
+                    if (Rs[i].determinant() <= 0) {
+                        utility::LogError(
+                                "[DeformAsRigidAsPossible] something went "
+                                "wrong with updating R");
+                    }
+                },
+                kARAPVertexGrainSize);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update Positions
-            Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
-                }
-            }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
-        }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
+        // Update positions. The edges to constrained vertices move to the
+        // right-hand side.
+        utility::ParallelFor(
+                0, num_free,
+                [&](int64_t row) {
+                    const int i = free_vertices_[row];
+                    Eigen::Vector3d bi(0, 0, 0);
+                    double W = 0;
+                    for (int64_t k = neighbor_offsets_[i];
+                         k < neighbor_offsets_[i + 1]; ++k) {
+                        const int j = neighbors_[k];
+                        const double w = weights_[k];
+                        bi += w / 2 *
+                              ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
+                        if (free_index_[j] < 0) {
+                            bi += w * ConstraintPosition(j);
+                        }
+                        W += w;
+                    }
+                    if (!(W > 0)) {
+                        bi = vertices_[i];
+                    }
+                    b.row(row) = bi.transpose();
+                },
+                kARAPVertexGrainSize);
+        if (num_free > 0) {
+            utility::ParallelFor(0, 3, [&](int64_t comp) {
+                p_prime.col(comp) = solver_->ldlt_.solve(b.col(comp));
+            });
+            if (solver_->ldlt_.info() != Eigen::Success) {
                 utility::LogError(
                         "[DeformAsRigidAsPossible] Cholesky solve failed");
             }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
-            }
         }
+        utility::ParallelFor(
+                0, num_vertices,
+                [&](int64_t i) {
+                    vertices[i] = free_index_[i] >= 0
+                                          ? Eigen::Vector3d(p_prime.row(
+                                                    free_index_[i]))
+                                          : ConstraintPosition(int(i));
+                },
+                kARAPVertexGrainSize);
 
+        if (utility::GetVerbosityLevel() < utility::VerbosityLevel::Debug) {
+            continue;
+        }
         // Compute energy and log
         double energy = 0;
         double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
+        for (int i = 0; i < num_vertices; ++i) {
+            for (int64_t k = neighbor_offsets_[i]; k < neighbor_offsets_[i + 1];
+                 ++k) {
+                const int j = neighbors_[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
+                Eigen::Vector3d e1 = vertices[i] - vertices[j];
                 Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
+                energy += weights_[k] * diff.squaredNorm();
+                if (smoothed) {
                     reg += (Rs[i] - Rs[j]).squaredNorm();
                 }
             }
         }
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            energy = energy + smoothed_alpha * surface_area * reg;
+        if (smoothed) {
+            energy = energy + smoothed_alpha * surface_area_ * reg;
         }
         utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
                           iter, energy);
     }
+}
 
+std::shared_ptr<TriangleMesh> AsRigidAsPossibleDeformer::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        MeshBase::DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    auto prime = std::make_shared<TriangleMesh>();
+    prime->vertices_ = vertices_;
+    prime->triangles_ = triangles_;
+    Deform(constraint_vertex_positions, prime->vertices_, max_iter,
+           energy_model, smoothed_alpha);
     return prime;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    const size_t num_constraints = std::min(constraint_vertex_indices.size(),
+                                            constraint_vertex_positions.size());
+    AsRigidAsPossibleDeformer deformer(
+            *this, std::vector<int>(constraint_vertex_indices.begin(),
+                                    constraint_vertex_indices.begin() +
+                                            num_constraints));
+    return deformer.Deform(
+            std::vector<Eigen::Vector3d>(constraint_vertex_positions.begin(),
+                                         constraint_vertex_positions.begin() +
+                                                 num_constraints),
+            max_iter, energy_model, smoothed_alpha);
+}
+
 }  // namespace geometry
 }  // namespace open3d
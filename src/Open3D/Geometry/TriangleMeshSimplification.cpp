@@ -27,10 +27,14 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+#include "Open3D/Geometry/VoxelGroups.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -89,6 +93,617 @@ public:
     double c_;
 };
 
+namespace {
+
+/// Returns for every triangle whether it is valid and the first valid
+/// triangle with its indices, which are in [0, num_vertices). The triangles
+/// are grouped with a stable radix sort of their linearized indices.
+std::vector<uint8_t> FindFirstOccurrences(
+        const std::vector<Eigen::Vector3i>& triangles,
+        const std::vector<uint8_t>& is_valid,
+        int64_t num_vertices) {
+    const int64_t n = int64_t(triangles.size());
+    std::vector<int64_t> order(n);
+    std::vector<uint8_t> is_first(n, 0);
+    const double num_keys = double(num_vertices) * double(num_vertices) *
+                            double(num_vertices);
+    if (num_keys < double(std::numeric_limits<uint64_t>::max() / 2)) {
+        const uint64_t invalid_key = uint64_t(num_keys);
+        std::vector<uint64_t> keys(n);
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t tidx) {
+                    const Eigen::Vector3i& t = triangles[tidx];
+                    keys[tidx] = is_valid[tidx]
+                                         ? (uint64_t(t(0)) * num_vertices +
+                                            uint64_t(t(1))) * num_vertices +
+                                                   uint64_t(t(2))
+                                         : invalid_key;
+                    order[tidx] = tidx;
+                },
+                kVoxelPointGrainSize);
+        utility::ParallelRadixSortPairs(keys, order, kVoxelPointGrainSize);
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t i) {
+                    is_first[order[i]] = keys[i] != invalid_key &&
+                                         (i == 0 || keys[i] != keys[i - 1]);
+                },
+                kVoxelPointGrainSize);
+    } else {
+        std::iota(order.begin(), order.end(), 0);
+        auto less = [&](int64_t lhs, int64_t rhs) {
+            const Eigen::Vector3i& a = triangles[lhs];
+            const Eigen::Vector3i& b = triangles[rhs];
+            return std::make_tuple(!is_valid[lhs], a(0), a(1), a(2)) <
+                   std::make_tuple(!is_valid[rhs], b(0), b(1), b(2));
+        };
+        std::stable_sort(order.begin(), order.end(), less);
+        for (int64_t i = 0; i < n && is_valid[order[i]]; ++i) {
+            is_first[order[i]] = i == 0 || less(order[i - 1], order[i]);
+        }
+    }
+    return is_first;
+}
+
+/// The parallel decimation uses at most one partition per this many vertices.
+constexpr int kMinVerticesPerPartition = 1 << 14;
+/// Number of rounds of the parallel decimation, each of which removes half
+/// of the remaining triangles.
+constexpr int kNumParallelRounds = 4;
+
+/// Binary min-heap of integer items [0, n) keyed by a cost, in which every
+/// item is contained at most once. The heap position of every item is stored
+/// in an external array, so that the cost of an item can be changed and an
+/// item can be removed in O(log n). Heaps that contain disjoint items can
+/// share the array.
+class IndexedHeap {
+public:
+    /// \param positions has one entry per item that has to be -1 for all
+    /// items that are not in any heap.
+    explicit IndexedHeap(std::vector<int>& positions) : positions_(positions) {}
+    ~IndexedHeap() {
+        for (const Entry& entry : entries_) {
+            positions_[entry.item_] = -1;
+        }
+    }
+
+    bool IsEmpty() const { return entries_.empty(); }
+    int Top() const { return entries_[0].item_; }
+
+    /// Inserts \p item if it is not in the heap and sets its cost.
+    void Update(int item, double cost) {
+        int pos = positions_[item];
+        if (pos < 0) {
+            pos = int(entries_.size());
+            entries_.push_back({cost, item});
+            SiftUp(pos);
+        } else if (cost < entries_[pos].cost_) {
+            entries_[pos].cost_ = cost;
+            SiftUp(pos);
+        } else {
+            entries_[pos].cost_ = cost;
+            SiftDown(pos);
+        }
+    }
+
+    /// Removes \p item if it is in the heap.
+    void Remove(int item) {
+        const int pos = positions_[item];
+        if (pos < 0) {
+            return;
+        }
+        positions_[item] = -1;
+        const Entry last = entries_.back();
+        entries_.pop_back();
+        if (pos < int(entries_.size())) {
+            entries_[pos] = last;
+            SiftUp(pos);
+            SiftDown(positions_[last.item_]);
+        }
+    }
+
+private:
+    struct Entry {
+        double cost_;
+        int item_;
+    };
+
+    void SiftUp(int pos) {
+        const Entry entry = entries_[pos];
+        while (pos > 0) {
+            const int parent = (pos - 1) / 2;
+            if (!(entry.cost_ < entries_[parent].cost_)) {
+                break;
+            }
+            entries_[pos] = entries_[parent];
+            positions_[entries_[pos].item_] = pos;
+            pos = parent;
+        }
+        entries_[pos] = entry;
+        positions_[entry.item_] = pos;
+    }
+
+    void SiftDown(int pos) {
+        const Entry entry = entries_[pos];
+        const int size = int(entries_.size());
+        while (true) {
+            int child = 2 * pos + 1;
+            if (child >= size) {
+                break;
+            }
+            if (child + 1 < size &&
+                entries_[child + 1].cost_ < entries_[child].cost_) {
+                ++child;
+            }
+            if (!(entries_[child].cost_ < entry.cost_)) {
+                break;
+            }
+            entries_[pos] = entries_[child];
+            positions_[entries_[pos].item_] = pos;
+            pos = child;
+        }
+        entries_[pos] = entry;
+        positions_[entry.item_] = pos;
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<int>& positions_;
+};
+
+/// Edge collapse decimation of a mesh in flat arrays.
+///
+/// The edges are identified by the slots 3 * t + k of the triangles, where
+/// slot 3 * t + k is the edge from vertex k to vertex (k + 1) % 3 of triangle
+/// t. An edge that is shared by two triangles thus has two slots, which are
+/// both removed with the triangles when the edge is collapsed. The triangles
+/// of a vertex are the triangles of all vertices that have been collapsed
+/// into it, which are found by following a linked list of the collapsed
+/// vertices through the initial vertex to triangle lists.
+///
+/// Locked vertices are not collapsed. If all vertices that share a triangle
+/// with another partition are locked, the unlocked vertices of different
+/// partitions can be decimated concurrently.
+class QuadricDecimator {
+public:
+    QuadricDecimator(const TriangleMesh& input, TriangleMesh& mesh)
+        : mesh_(mesh) {
+        const int num_vertices = int(mesh_.vertices_.size());
+        const int num_triangles = int(mesh_.triangles_.size());
+
+        vertex_triangle_offsets_.resize(num_vertices + 1, 0);
+        for (const Eigen::Vector3i& triangle : mesh_.triangles_) {
+            for (int k = 0; k < 3; ++k) {
+                if (triangle(k) < 0 || triangle(k) >= num_vertices) {
+                    utility::LogError(
+                            "[SimplifyQuadricDecimation] Triangle references "
+                            "vertex {}, but the mesh has {} vertices.",
+                            triangle(k), num_vertices);
+                }
+                vertex_triangle_offsets_[triangle(k) + 1]++;
+            }
+        }
+        for (int v = 0; v < num_vertices; ++v) {
+            vertex_triangle_offsets_[v + 1] += vertex_triangle_offsets_[v];
+        }
+        vertex_triangles_.resize(3 * size_t(num_triangles));
+        std::vector<int64_t> next(vertex_triangle_offsets_.begin(),
+                                  vertex_triangle_offsets_.end() - 1);
+        for (int t = 0; t < num_triangles; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                vertex_triangles_[next[mesh_.triangles_[t](k)]++] = t;
+            }
+        }
+        next = std::vector<int64_t>();
+
+        std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+        std::vector<double> triangle_areas(num_triangles);
+        utility::ParallelFor(0, num_triangles, [&](int t) {
+            triangle_planes[t] = input.GetTrianglePlane(t);
+            triangle_areas[t] = input.GetTriangleArea(t);
+        });
+
+        // The boundary edges add a quadric of the plane that is
+        // perpendicular to the triangle.
+        const auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(
+                input);
+        quadrics_.resize(num_vertices);
+        utility::ParallelFor(0, num_vertices, [&](int v) {
+            Quadric& quadric = quadrics_[v];
+            for (int64_t i = vertex_triangle_offsets_[v];
+                 i < vertex_triangle_offsets_[v + 1]; ++i) {
+                const int t = vertex_triangles_[i];
+                quadric += Quadric(triangle_planes[t], triangle_areas[t]);
+                const Eigen::Vector3i& triangle = mesh_.triangles_[t];
+                for (int k = 0; k < 3; ++k) {
+                    const int v0 = triangle(k);
+                    const int v1 = triangle((k + 1) % 3);
+                    const int e = adjacency->triangle_edges_[t](k);
+                    if ((v0 != v && v1 != v) ||
+                        adjacency->NumEdgeTriangles(e) != 1) {
+                        continue;
+                    }
+                    const Eigen::Vector3d& vert0 = mesh_.vertices_[v0];
+                    const Eigen::Vector3d& vert1 = mesh_.vertices_[v1];
+                    const Eigen::Vector3d& vert2 =
+                            mesh_.vertices_[triangle((k + 2) % 3)];
+                    Eigen::Vector3d vert2p =
+                            (vert2 - vert0).cross(vert2 - vert1);
+                    quadric += Quadric(TriangleMesh::ComputeTrianglePlane(
+                                               vert0, vert1, vert2p),
+                                       triangle_areas[t]);
+                }
+            }
+        });
+
+        next_collapsed_.resize(num_vertices, -1);
+        last_collapsed_.resize(num_vertices);
+        std::iota(last_collapsed_.begin(), last_collapsed_.end(), 0);
+        vertices_deleted_.resize(num_vertices, 0);
+        vertices_locked_.resize(num_vertices, 0);
+        triangles_deleted_.resize(num_triangles, 0);
+        heap_positions_.resize(3 * size_t(num_triangles), -1);
+    }
+
+    /// Splits the remaining vertices into slabs with a similar number of
+    /// vertices along the longest axis of the bounding box and locks the
+    /// vertices at the slab borders. If \p shifted is true, the slab borders
+    /// are moved by half a slab, which gives \p num_slabs + 1 slabs.
+    std::vector<std::vector<int>> Partition(int num_slabs, bool shifted) {
+        const int num_vertices = int(mesh_.vertices_.size());
+        const Eigen::Vector3d min_bound = mesh_.GetMinBound();
+        const Eigen::Vector3d extent = mesh_.GetMaxBound() - min_bound;
+        int axis;
+        extent.maxCoeff(&axis);
+
+        const int num_bins = 64 * num_slabs;
+        const double scale = extent(axis) > 0 ? num_bins / extent(axis) : 0;
+        std::vector<int> vertex_bins(num_vertices);
+        std::vector<int64_t> bin_sizes(num_bins, 0);
+        int64_t num_remaining = 0;
+        for (int v = 0; v < num_vertices; ++v) {
+            if (!vertices_deleted_[v]) {
+                const double x = mesh_.vertices_[v](axis) - min_bound(axis);
+                vertex_bins[v] = std::min(int(x * scale), num_bins - 1);
+                bin_sizes[vertex_bins[v]]++;
+                num_remaining++;
+            }
+        }
+        const double offset = shifted ? 0.5 : 0;
+        std::vector<int> bin_slabs(num_bins);
+        int64_t num_binned = 0;
+        for (int bin = 0; bin < num_bins; ++bin) {
+            bin_slabs[bin] = int(double(num_binned) * num_slabs /
+                                         std::max(num_remaining, int64_t(1)) +
+                                 offset);
+            num_binned += bin_sizes[bin];
+        }
+
+        std::vector<std::vector<int>> slabs(num_slabs + 1);
+        std::vector<int> vertex_slabs(num_vertices, -1);
+        for (int v = 0; v < num_vertices; ++v) {
+            if (!vertices_deleted_[v]) {
+                vertex_slabs[v] = bin_slabs[vertex_bins[v]];
+                slabs[vertex_slabs[v]].push_back(v);
+            }
+        }
+        utility::ParallelFor(0, num_vertices, [&](int v) {
+            bool locked = false;
+            ForEachTriangle(v, [&](int t) {
+                const Eigen::Vector3i& triangle = mesh_.triangles_[t];
+                for (int k = 0; k < 3; ++k) {
+                    locked |= vertex_slabs[triangle(k)] != vertex_slabs[v];
+                }
+            });
+            vertices_locked_[v] = locked;
+        });
+        return slabs;
+    }
+
+    void UnlockVertices() {
+        std::fill(vertices_locked_.begin(), vertices_locked_.end(), 0);
+    }
+
+    /// Collapses the edges between the unlocked \p vertices in order of
+    /// increasing cost until \p max_num_removed triangles are removed or no
+    /// edge is left. Returns the number of removed triangles.
+    int64_t Decimate(const std::vector<int>& vertices,
+                     int64_t max_num_removed) {
+        IndexedHeap heap(heap_positions_);
+        for (int v : vertices) {
+            if (vertices_deleted_[v] || vertices_locked_[v]) {
+                continue;
+            }
+            ForEachTriangle(v, [&](int t) {
+                for (int k = 0; k < 3; ++k) {
+                    if (mesh_.triangles_[t](k) == v) {
+                        UpdateSlot(heap, 3 * t + k);
+                    }
+                }
+            });
+        }
+
+        int64_t num_removed = 0;
+        while (num_removed < max_num_removed && !heap.IsEmpty()) {
+            const int slot = heap.Top();
+            heap.Remove(slot);
+            const Eigen::Vector3i& triangle = mesh_.triangles_[slot / 3];
+            int vidx0 = triangle(slot % 3);
+            int vidx1 = triangle((slot % 3 + 1) % 3);
+            if (vidx0 > vidx1) {
+                std::swap(vidx0, vidx1);
+            }
+            Eigen::Vector3d vbar;
+            ComputeCost(vidx0, vidx1, vbar);
+            if (IsFlipped(vidx0, vidx1, vbar)) {
+                continue;
+            }
+            num_removed += Collapse(heap, vidx0, vidx1, vbar);
+        }
+        return num_removed;
+    }
+
+    /// Removes the deleted vertices and triangles from the mesh.
+    void Compact() {
+        const bool has_vert_normal = mesh_.HasVertexNormals();
+        const bool has_vert_color = mesh_.HasVertexColors();
+        std::vector<int> vert_remapping(mesh_.vertices_.size(), -1);
+        int next_free = 0;
+        for (size_t idx = 0; idx < mesh_.vertices_.size(); ++idx) {
+            if (!vertices_deleted_[idx]) {
+                vert_remapping[idx] = next_free;
+                mesh_.vertices_[next_free] = mesh_.vertices_[idx];
+                if (has_vert_normal) {
+                    mesh_.vertex_normals_[next_free] =
+                            mesh_.vertex_normals_[idx];
+                }
+                if (has_vert_color) {
+                    mesh_.vertex_colors_[next_free] = mesh_.vertex_colors_[idx];
+                }
+                next_free++;
+            }
+        }
+        mesh_.vertices_.resize(next_free);
+        if (has_vert_normal) {
+            mesh_.vertex_normals_.resize(next_free);
+        }
+        if (has_vert_color) {
+            mesh_.vertex_colors_.resize(next_free);
+        }
+
+        next_free = 0;
+        for (size_t idx = 0; idx < mesh_.triangles_.size(); ++idx) {
+            if (!triangles_deleted_[idx]) {
+                const Eigen::Vector3i& tria = mesh_.triangles_[idx];
+                mesh_.triangles_[next_free] =
+                        Eigen::Vector3i(vert_remapping[tria(0)],
+                                        vert_remapping[tria(1)],
+                                        vert_remapping[tria(2)]);
+                next_free++;
+            }
+        }
+        mesh_.triangles_.resize(next_free);
+    }
+
+private:
+    template <typename Func>
+    void ForEachTriangle(int vidx, Func f) const {
+        for (int v = vidx; v >= 0; v = next_collapsed_[v]) {
+            for (int64_t i = vertex_triangle_offsets_[v];
+                 i < vertex_triangle_offsets_[v + 1]; ++i) {
+                const int t = vertex_triangles_[i];
+                if (!triangles_deleted_[t]) {
+                    f(t);
+                }
+            }
+        }
+    }
+
+    double ComputeCost(int vidx0, int vidx1, Eigen::Vector3d& vbar) const {
+        const Quadric Qbar = quadrics_[vidx0] + quadrics_[vidx1];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
+        }
+        const Eigen::Vector3d& v0 = mesh_.vertices_[vidx0];
+        const Eigen::Vector3d& v1 = mesh_.vertices_[vidx1];
+        const Eigen::Vector3d vmid = (v0 + v1) / 2;
+        const double cost0 = Qbar.Eval(v0);
+        const double cost1 = Qbar.Eval(v1);
+        const double costmid = Qbar.Eval(vmid);
+        const double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
+    }
+
+    void UpdateSlot(IndexedHeap& heap, int slot) const {
+        const Eigen::Vector3i& triangle = mesh_.triangles_[slot / 3];
+        const int vidx0 = triangle(slot % 3);
+        const int vidx1 = triangle((slot % 3 + 1) % 3);
+        if (vidx0 == vidx1 || vertices_locked_[vidx0] ||
+            vertices_locked_[vidx1]) {
+            heap.Remove(slot);
+            return;
+        }
+        Eigen::Vector3d vbar;
+        heap.Update(slot, ComputeCost(vidx0, vidx1, vbar));
+    }
+
+    /// Tests if moving both vertices to \p vbar flips the normal of any
+    /// triangle that is not removed by the collapse.
+    bool IsFlipped(int vidx0, int vidx1, const Eigen::Vector3d& vbar) const {
+        bool flipped = false;
+        for (int vidx : {vidx0, vidx1}) {
+            ForEachTriangle(vidx, [&](int t) {
+                const Eigen::Vector3i& tria = mesh_.triangles_[t];
+                const int other = vidx == vidx0 ? vidx1 : vidx0;
+                if (flipped || tria(0) == other || tria(1) == other ||
+                    tria(2) == other) {
+                    return;
+                }
+                Eigen::Vector3d vert[3];
+                for (int k = 0; k < 3; ++k) {
+                    vert[k] = mesh_.vertices_[tria(k)];
+                }
+                Eigen::Vector3d norm_before =
+                        (vert[1] - vert[0]).cross(vert[2] - vert[0]);
+                norm_before /= norm_before.norm();
+                for (int k = 0; k < 3; ++k) {
+                    if (tria(k) == vidx) {
+                        vert[k] = vbar;
+                    }
+                }
+                Eigen::Vector3d norm_after =
+                        (vert[1] - vert[0]).cross(vert[2] - vert[0]);
+                norm_after /= norm_after.norm();
+                flipped = norm_before.dot(norm_after) < 0;
+            });
+        }
+        return flipped;
+    }
+
+    /// Collapses vertex \p vidx1 into \p vidx0 and returns the number of
+    /// removed triangles.
+    int64_t Collapse(IndexedHeap& heap,
+                     int vidx0,
+                     int vidx1,
+                     const Eigen::Vector3d& vbar) {
+        int64_t num_removed = 0;
+        ForEachTriangle(vidx1, [&](int t) {
+            Eigen::Vector3i& tria = mesh_.triangles_[t];
+            if (tria(0) == vidx0 || tria(1) == vidx0 || tria(2) == vidx0) {
+                triangles_deleted_[t] = 1;
+                for (int k = 0; k < 3; ++k) {
+                    heap.Remove(3 * t + k);
+                }
+                num_removed++;
+                return;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) == vidx1) {
+                    tria(k) = vidx0;
+                }
+            }
+        });
+        next_collapsed_[last_collapsed_[vidx0]] = vidx1;
+        last_collapsed_[vidx0] = last_collapsed_[vidx1];
+
+        mesh_.vertices_[vidx0] = vbar;
+        quadrics_[vidx0] += quadrics_[vidx1];
+        if (mesh_.HasVertexNormals()) {
+            mesh_.vertex_normals_[vidx0] = 0.5 * (mesh_.vertex_normals_[vidx0] +
+                                                  mesh_.vertex_normals_[vidx1]);
+        }
+        if (mesh_.HasVertexColors()) {
+            mesh_.vertex_colors_[vidx0] = 0.5 * (mesh_.vertex_colors_[vidx0] +
+                                                 mesh_.vertex_colors_[vidx1]);
+        }
+        vertices_deleted_[vidx1] = 1;
+
+        // Update the costs of all edges of vidx0
+        ForEachTriangle(vidx0, [&](int t) {
+            const Eigen::Vector3i& tria = mesh_.triangles_[t];
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) == vidx0 || tria((k + 1) % 3) == vidx0) {
+                    UpdateSlot(heap, 3 * t + k);
+                }
+            }
+        });
+        return num_removed;
+    }
+
+    TriangleMesh& mesh_;
+    std::vector<Quadric> quadrics_;
+    std::vector<int64_t> vertex_triangle_offsets_;
+    std::vector<int> vertex_triangles_;
+    std::vector<int> next_collapsed_;
+    std::vector<int> last_collapsed_;
+    // Flags are bytes, so that different threads can write neighbouring
+    // flags.
+    std::vector<uint8_t> vertices_deleted_;
+    std::vector<uint8_t> vertices_locked_;
+    std::vector<uint8_t> triangles_deleted_;
+    std::vector<int> heap_positions_;
+};
+
+std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+        const TriangleMesh& input, int target_number_of_triangles) {
+    if (3 * int64_t(input.triangles_.size()) >
+        std::numeric_limits<int>::max()) {
+        utility::LogError(
+                "[SimplifyQuadricDecimation] The mesh has too many triangles "
+                "({}).",
+                input.triangles_.size());
+    }
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = input.vertices_;
+    mesh->vertex_normals_ = input.vertex_normals_;
+    mesh->vertex_colors_ = input.vertex_colors_;
+    mesh->triangles_ = input.triangles_;
+    const int64_t num_triangles = int64_t(input.triangles_.size());
+    if (num_triangles <= target_number_of_triangles) {
+        if (input.HasTriangleNormals()) {
+            mesh->ComputeTriangleNormals();
+        }
+        return mesh;
+    }
+
+    QuadricDecimator decimator(input, *mesh);
+    int64_t num_removed = 0;
+
+    // Every round decimates the slabs in parallel until half of the
+    // remaining triangles are removed, where every slab removes its share.
+    // The slab borders are shifted between rounds, so that the locked
+    // vertices at the borders are decimated in the next round. The last
+    // collapses are done after unlocking all vertices.
+    const int num_vertices = int(input.vertices_.size());
+    const int num_slabs = std::min(4 * utility::GetNumThreads(),
+                                   num_vertices / kMinVerticesPerPartition);
+    if (utility::GetNumThreads() > 1 && num_slabs > 1) {
+        for (int round = 0; round < kNumParallelRounds; ++round) {
+            const std::vector<std::vector<int>> slabs =
+                    decimator.Partition(num_slabs, round % 2 == 1);
+            const int64_t num_slab_vertices = std::accumulate(
+                    slabs.begin(), slabs.end(), int64_t(0),
+                    [](int64_t sum, const std::vector<int>& slab) {
+                        return sum + int64_t(slab.size());
+                    });
+            const int64_t num_round_removed =
+                    (num_triangles - num_removed - target_number_of_triangles) /
+                    2;
+            std::vector<int64_t> slab_num_removed(slabs.size(), 0);
+            utility::ParallelFor(0, int(slabs.size()), [&](int slab) {
+                const int64_t share = num_round_removed *
+                                      int64_t(slabs[slab].size()) /
+                                      num_slab_vertices;
+                slab_num_removed[slab] = decimator.Decimate(slabs[slab], share);
+            });
+            num_removed += std::accumulate(slab_num_removed.begin(),
+                                           slab_num_removed.end(), int64_t(0));
+        }
+        decimator.UnlockVertices();
+    }
+
+    std::vector<int> vertices(num_vertices);
+    std::iota(vertices.begin(), vertices.end(), 0);
+    decimator.Decimate(vertices, num_triangles - num_removed -
+                                         target_number_of_triangles);
+    decimator.Compact();
+
+    if (input.HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -112,149 +727,164 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         utility::LogError("[VoxelGridFromPointCloud] voxel_size is too small.");
     }
 
-    auto GetVoxelIdx = [&](const Eigen::Vector3d& vert) {
-        Eigen::Vector3d ref_coord = (vert - voxel_min_bound) / voxel_size;
-        Eigen::Vector3i idx(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                            int(floor(ref_coord(2))));
-        return idx;
-    };
-
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vert_ind;
-    int new_vidx = 0;
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(int(vidx));
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
-        }
-    }
+    // Group the vertices by voxel. The new vertices are numbered in the order
+    // in which their voxels are first seen in the vertex list.
+    const int64_t num_vertices = int64_t(vertices_.size());
+    const VoxelGroups groups =
+            GroupPointsByVoxel(vertices_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = groups.NumVoxels();
+    std::vector<uint64_t> first_vertices(num_voxels);
+    std::vector<int64_t> new_to_group(num_voxels);
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t v) {
+                first_vertices[v] =
+                        uint64_t(groups.order_[groups.voxel_offsets_[v]]);
+                new_to_group[v] = v;
+            },
+            kVoxelGrainSize);
+    utility::ParallelRadixSortPairs(first_vertices, new_to_group,
+                                    kVoxelPointGrainSize);
+    std::vector<int> vertex_to_new(num_vertices);
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t new_vidx) {
+                const int64_t v = new_to_group[new_vidx];
+                for (int64_t t = groups.voxel_offsets_[v];
+                     t < groups.voxel_offsets_[v + 1]; t++) {
+                    vertex_to_new[groups.order_[t]] = int(new_vidx);
+                }
+            },
+            kVoxelGrainSize);
 
     // aggregate vertex info
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
+    mesh->vertices_.resize(num_voxels);
     if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
+        mesh->vertex_normals_.resize(num_voxels);
     }
     if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+        mesh->vertex_colors_.resize(num_voxels);
     }
 
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertices_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_normals_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_colors_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-
-    if (contraction == SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
-            }
-        }
-    } else if (contraction == SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-            vert_to_triangles[triangles_[tidx](0)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](1)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](2)].emplace(int(tidx));
-        }
-
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
+    // The triangles of every vertex, for the quadric contraction. A
+    // degenerate triangle is listed once per distinct vertex.
+    std::vector<int64_t> vertex_triangles;
+    std::vector<int64_t> vertex_triangle_offsets;
+    std::vector<Quadric> triangle_quadrics;
+    if (contraction == SimplificationContraction::Quadric) {
+        const int64_t num_triangles = int64_t(triangles_.size());
+        triangle_quadrics.resize(num_triangles);
+        std::vector<uint64_t> corner_vertices(3 * num_triangles);
+        vertex_triangles.resize(3 * num_triangles);
+        utility::ParallelFor(
+                0, num_triangles,
+                [&](int64_t tidx) {
+                    triangle_quadrics[tidx] = Quadric(GetTrianglePlane(tidx),
+                                                      GetTriangleArea(tidx));
+                    const Eigen::Vector3i& triangle = triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        const bool is_repeated =
+                                (k > 0 && triangle(k) == triangle(0)) ||
+                                (k > 1 && triangle(k) == triangle(1));
+                        // Repeated corners sort behind all vertices.
+                        corner_vertices[3 * tidx + k] =
+                                is_repeated ? uint64_t(num_vertices)
+                                            : uint64_t(triangle(k));
+                        vertex_triangles[3 * tidx + k] = tidx;
+                    }
+                },
+                kVoxelPointGrainSize);
+        utility::ParallelRadixSortPairs(corner_vertices, vertex_triangles,
+                                        kVoxelPointGrainSize);
+        vertex_triangle_offsets.resize(num_vertices + 1);
+        utility::ParallelFor(
+                0, num_vertices + 1,
+                [&](int64_t vidx) {
+                    vertex_triangle_offsets[vidx] =
+                            std::lower_bound(corner_vertices.begin(),
+                                             corner_vertices.end(),
+                                             uint64_t(vidx)) -
+                            corner_vertices.begin();
+                },
+                kVoxelPointGrainSize);
+    }
 
-            Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
-                    Eigen::Vector4d p = GetTrianglePlane(tidx);
-                    double area = GetTriangleArea(tidx);
-                    q += Quadric(p, area);
+    utility::ParallelFor(
+            0, num_voxels,
+            [&](int64_t new_vidx) {
+                const int64_t v = new_to_group[new_vidx];
+                const double num_points = double(groups.NumPoints(v));
+                mesh->vertices_[new_vidx] =
+                        SumAttribute(vertices_, groups, v) / num_points;
+                if (contraction == SimplificationContraction::Quadric) {
+                    Quadric q;
+                    for (int64_t t = groups.voxel_offsets_[v];
+                         t < groups.voxel_offsets_[v + 1]; t++) {
+                        const int64_t vidx = groups.order_[t];
+                        for (int64_t c = vertex_triangle_offsets[vidx];
+                             c < vertex_triangle_offsets[vidx + 1]; c++) {
+                            q += triangle_quadrics[vertex_triangles[c]];
+                        }
+                    }
+                    if (q.IsInvertible()) {
+                        mesh->vertices_[new_vidx] = q.Minimum();
+                    }
                 }
-            }
-            if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
-            } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            }
-
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
-            }
-        }
-    }
+                if (has_vert_normal) {
+                    mesh->vertex_normals_[new_vidx] =
+                            SumAttribute(vertex_normals_, groups, v) /
+                            num_points;
+                }
+                if (has_vert_color) {
+                    mesh->vertex_colors_[new_vidx] =
+                            SumAttribute(vertex_colors_, groups, v) /
+                            num_points;
+                }
+            },
+            kVoxelGrainSize);
 
     //  connect vertices
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(2)])];
+    const int64_t num_triangles = int64_t(triangles_.size());
+    std::vector<Eigen::Vector3i> triangles(num_triangles);
+    std::vector<uint8_t> is_valid(num_triangles);
+    utility::ParallelFor(
+            0, num_triangles,
+            [&](int64_t tidx) {
+                const Eigen::Vector3i& triangle = triangles_[tidx];
+                int vidx0 = vertex_to_new[triangle(0)];
+                int vidx1 = vertex_to_new[triangle(1)];
+                int vidx2 = vertex_to_new[triangle(2)];
 
-        // only connect if in different voxels
-        if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
-            continue;
-        }
+                // only connect if in different voxels
+                is_valid[tidx] =
+                        !(vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2);
 
-        // Note: there can be still double faces with different orientation
-        // The user has to clean up manually
-        if (vidx1 < vidx0 && vidx1 < vidx2) {
-            int tmp = vidx0;
-            vidx0 = vidx1;
-            vidx1 = vidx2;
-            vidx2 = tmp;
-        } else if (vidx2 < vidx0 && vidx2 < vidx1) {
-            int tmp = vidx1;
-            vidx1 = vidx0;
-            vidx0 = vidx2;
-            vidx2 = tmp;
+                // Note: there can be still double faces with different
+                // orientation. The user has to clean up manually
+                if (vidx1 < vidx0 && vidx1 < vidx2) {
+                    int tmp = vidx0;
+                    vidx0 = vidx1;
+                    vidx1 = vidx2;
+                    vidx2 = tmp;
+                } else if (vidx2 < vidx0 && vidx2 < vidx1) {
+                    int tmp = vidx1;
+                    vidx1 = vidx0;
+                    vidx0 = vidx2;
+                    vidx2 = tmp;
+                }
+                triangles[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
+            },
+            kVoxelPointGrainSize);
+    // Keep the first occurrence of every triangle, in triangle order.
+    const std::vector<uint8_t> is_first =
+            FindFirstOccurrences(triangles, is_valid, num_voxels);
+    mesh->triangles_.reserve(std::count(is_first.begin(), is_first.end(), 1));
+    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
+        if (is_first[tidx]) {
+            mesh->triangles_.push_back(triangles[tidx]);
         }
-
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
-    }
-
-    mesh->triangles_.resize(triangles.size());
-    int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
-        mesh->triangles_[tidx] = triangle;
-        tidx++;
     }
 
     if (HasTriangleNormals()) {
@@ -265,12 +895,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
-        int target_number_of_triangles) const {
+        int target_number_of_triangles,
+        QuadricDecimationMethod
+                method /* = QuadricDecimationMethod::Sequential */) const {
     if (HasTriangleUvs()) {
         utility::LogWarning(
                 "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
+    if (method == QuadricDecimationMethod::Parallel) {
+        return SimplifyQuadricDecimationParallel(*this,
+                                                 target_number_of_triangles);
+    }
     typedef std::tuple<double, int, int> CostEdge;
 
     auto mesh = std::make_shared<TriangleMesh>();
@@ -359,11 +995,11 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
                 cost = Qbar.Eval(vbar);
             } else {
                 const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx0];
+                const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
                 Eigen::Vector3d vmid = (v0 + v1) / 2;
                 double cost0 = Qbar.Eval(v0);
                 double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vbar);
+                double costmid = Qbar.Eval(vmid);
                 cost = std::min(cost0, std::min(cost1, costmid));
                 if (cost == costmid) {
                     vbar = vmid;
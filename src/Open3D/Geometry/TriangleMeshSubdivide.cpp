@@ -27,14 +27,102 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <atomic>
 
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+constexpr int64_t kSubdivideGrainSize = 4096;
+
+/// Returns the index of the vertex inserted on every edge of \p adjacency.
+/// They are numbered from \p num_vertices in the order the edges are first
+/// referenced by the triangles, and by edges (0, 1), (1, 2) and (2, 0) within
+/// a triangle, so the numbering does not depend on the number of threads.
+std::vector<int> NumberEdgeVertices(const TriangleMeshAdjacency &adjacency,
+                                    int64_t num_vertices) {
+    const int64_t num_triangles = int64_t(adjacency.NumTriangles());
+    const int64_t num_edges = int64_t(adjacency.NumEdges());
+    // is_first[3 * t + k] is 1 if edge k of triangle t is the first
+    // reference of its edge. The edge triangles are sorted, so the first
+    // one holds the first reference.
+    std::vector<uint8_t> is_first(3 * num_triangles, 0);
+    utility::ParallelFor(
+            0, num_edges,
+            [&](int64_t eidx) {
+                const int tidx = adjacency.edge_triangles_
+                                         [adjacency.edge_offsets_[eidx]];
+                for (int k = 0; k < 3; ++k) {
+                    if (adjacency.triangle_edges_[tidx](k) == int(eidx)) {
+                        is_first[3 * tidx + k] = 1;
+                        break;
+                    }
+                }
+            },
+            kSubdivideGrainSize);
+    std::vector<int> edge_vertices(num_edges);
+    int next_vertex = int(num_vertices);
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        if (is_first[i]) {
+            edge_vertices[adjacency.triangle_edges_[i / 3](i % 3)] =
+                    next_vertex++;
+        }
+    }
+    return edge_vertices;
+}
+
+/// Splits every triangle of \p triangles into 4, using the vertices inserted
+/// on its edges.
+void SplitTriangles(const std::vector<Eigen::Vector3i> &triangles,
+                    const TriangleMeshAdjacency &adjacency,
+                    const std::vector<int> &edge_vertices,
+                    std::vector<Eigen::Vector3i> &new_triangles) {
+    new_triangles.resize(4 * triangles.size());
+    utility::ParallelFor(
+            0, int64_t(triangles.size()),
+            [&](int64_t tidx) {
+                const Eigen::Vector3i &triangle = triangles[tidx];
+                const Eigen::Vector3i &edges = adjacency.triangle_edges_[tidx];
+                const int vidx0 = triangle(0);
+                const int vidx1 = triangle(1);
+                const int vidx2 = triangle(2);
+                const int vidx01 = edge_vertices[edges(0)];
+                const int vidx12 = edge_vertices[edges(1)];
+                const int vidx20 = edge_vertices[edges(2)];
+                new_triangles[tidx * 4 + 0] =
+                        Eigen::Vector3i(vidx0, vidx01, vidx20);
+                new_triangles[tidx * 4 + 1] =
+                        Eigen::Vector3i(vidx01, vidx1, vidx12);
+                new_triangles[tidx * 4 + 2] =
+                        Eigen::Vector3i(vidx12, vidx2, vidx20);
+                new_triangles[tidx * 4 + 3] =
+                        Eigen::Vector3i(vidx01, vidx12, vidx20);
+            },
+            kSubdivideGrainSize);
+}
+
+/// Number of distinct triangles of edge \p eidx. A degenerate triangle may
+/// reference an edge twice.
+int64_t NumDistinctEdgeTriangles(const TriangleMeshAdjacency &adjacency,
+                                 int64_t eidx) {
+    int64_t num_triangles = 0;
+    for (int64_t i = adjacency.edge_offsets_[eidx];
+         i < adjacency.edge_offsets_[eidx + 1]; ++i) {
+        if (i == adjacency.edge_offsets_[eidx] ||
+            adjacency.edge_triangles_[i] != adjacency.edge_triangles_[i - 1]) {
+            num_triangles++;
+        }
+    }
+    return num_triangles;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -51,59 +139,44 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen::hash<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*mesh);
+        const int64_t num_vertices = int64_t(mesh->vertices_.size());
+        const std::vector<int> edge_vertices =
+                NumberEdgeVertices(*adjacency, num_vertices);
+        const int64_t num_edges = int64_t(adjacency->NumEdges());
+        mesh->vertices_.resize(num_vertices + num_edges);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(num_vertices + num_edges);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(num_vertices + num_edges);
+        }
+        // Insert the midpoint of every edge (min, max).
+        utility::ParallelFor(
+                0, num_edges,
+                [&](int64_t eidx) {
+                    const int min = adjacency->edges_[eidx](0);
+                    const int max = adjacency->edges_[eidx](1);
+                    const int vidx01 = edge_vertices[eidx];
+                    mesh->vertices_[vidx01] = 0.5 * (mesh->vertices_[min] +
+                                                     mesh->vertices_[max]);
                     if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
+                        mesh->vertex_normals_[vidx01] =
                                 0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
+                                       mesh->vertex_normals_[max]);
                     }
                     if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
+                        mesh->vertex_colors_[vidx01] =
                                 0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
+                                       mesh->vertex_colors_[max]);
                     }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen::hash<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
-        }
-        mesh->triangles_ = new_triangles;
+                },
+                kSubdivideGrainSize);
+        std::vector<Eigen::Vector3i> new_triangles;
+        SplitTriangles(mesh->triangles_, *adjacency, edge_vertices,
+                       new_triangles);
+        mesh->triangles_ = std::move(new_triangles);
     }
 
     if (HasTriangleNormals()) {
@@ -120,208 +193,30 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
-
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
-        }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
-        }
-
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
-        }
-
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
-            }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
-            }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
-            }
-        }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
-                    old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal;
-            if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
-            }
-            Eigen::Vector3d new_color;
-            if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
-            }
-
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
-                }
-                if (has_vert_color) {
-                    new_color *= 0.5;
-                }
-            } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
-                                    ? tria(0)
-                                    : ((tria(1) != vidx0 && tria(1) != vidx1)
-                                               ? tria(1)
-                                               : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
-                    if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
-                    }
-                    if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
-                    }
-                }
-            }
-
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
-            }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
     auto old_mesh = std::make_shared<TriangleMesh>();
     old_mesh->vertices_ = vertices_;
     old_mesh->vertex_colors_ = vertex_colors_;
     old_mesh->vertex_normals_ = vertex_normals_;
     old_mesh->triangles_ = triangles_;
 
+    auto adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(*old_mesh);
+    for (size_t eidx = 0; eidx < adjacency->NumEdges(); ++eidx) {
+        if (NumDistinctEdgeTriangles(*adjacency, eidx) > 2) {
+            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+            break;
+        }
+    }
+
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
+        const int64_t num_vertices = int64_t(old_mesh->vertices_.size());
+        const int64_t num_edges = int64_t(adjacency->NumEdges());
+        const std::vector<int> edge_vertices =
+                NumberEdgeVertices(*adjacency, num_vertices);
+        size_t n_new_vertices = size_t(num_vertices + num_edges);
         auto new_mesh = std::make_shared<TriangleMesh>();
         new_mesh->vertices_.resize(n_new_vertices);
         if (has_vert_normal) {
@@ -330,43 +225,169 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
         if (has_vert_color) {
             new_mesh->vertex_colors_.resize(n_new_vertices);
         }
-        new_mesh->triangles_.resize(n_new_triangles);
 
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
+        // Update the old vertices from their neighbors, or only from their
+        // neighbors along the boundary if they are on it.
+        std::atomic<bool> many_boundary_nbs(false);
+        utility::ParallelFor(
+                0, num_vertices,
+                [&](int64_t vidx) {
+                    const int64_t nbs_begin = adjacency->vertex_offsets_[vidx];
+                    const int64_t nbs_end =
+                            adjacency->vertex_offsets_[vidx + 1];
+                    const size_t num_nbs = size_t(nbs_end - nbs_begin);
+                    size_t num_boundary_nbs = 0;
+                    for (int64_t i = nbs_begin; i < nbs_end; ++i) {
+                        const int eidx = adjacency->GetEdgeIndex(
+                                int(vidx), adjacency->vertex_neighbors_[i]);
+                        if (NumDistinctEdgeTriangles(*adjacency, eidx) == 1) {
+                            num_boundary_nbs++;
+                        }
+                    }
+                    // in manifold meshes this should not happen
+                    if (num_boundary_nbs > 2) {
+                        many_boundary_nbs = true;
+                    }
+                    const bool on_boundary = num_boundary_nbs >= 2;
+
+                    double beta, alpha;
+                    if (num_nbs == 0) {
+                        beta = 0;
+                        alpha = 1;
+                    } else if (on_boundary) {
+                        beta = 1. / 8.;
+                        alpha = 1. - num_boundary_nbs * beta;
+                    } else if (num_nbs == 3) {
+                        beta = 3. / 16.;
+                        alpha = 1. - num_nbs * beta;
+                    } else {
+                        beta = 3. / (8. * num_nbs);
+                        alpha = 1. - num_nbs * beta;
+                    }
 
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
+                    Eigen::Vector3d vertex = alpha * old_mesh->vertices_[vidx];
+                    Eigen::Vector3d normal, color;
+                    if (has_vert_normal) {
+                        normal = alpha * old_mesh->vertex_normals_[vidx];
+                    }
+                    if (has_vert_color) {
+                        color = alpha * old_mesh->vertex_colors_[vidx];
+                    }
+                    for (int64_t i = nbs_begin; i < nbs_end; ++i) {
+                        const int nb = adjacency->vertex_neighbors_[i];
+                        if (on_boundary &&
+                            NumDistinctEdgeTriangles(
+                                    *adjacency, adjacency->GetEdgeIndex(
+                                                        int(vidx), nb)) != 1) {
+                            continue;
+                        }
+                        vertex += beta * old_mesh->vertices_[nb];
+                        if (has_vert_normal) {
+                            normal += beta * old_mesh->vertex_normals_[nb];
+                        }
+                        if (has_vert_color) {
+                            color += beta * old_mesh->vertex_colors_[nb];
+                        }
+                    }
+                    new_mesh->vertices_[vidx] = vertex;
+                    if (has_vert_normal) {
+                        new_mesh->vertex_normals_[vidx] = normal;
+                    }
+                    if (has_vert_color) {
+                        new_mesh->vertex_colors_[vidx] = color;
+                    }
+                },
+                kSubdivideGrainSize);
+        if (many_boundary_nbs) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
+        // Insert a vertex on every edge, from its end points and the
+        // opposite vertices of its triangles.
+        utility::ParallelFor(
+                0, num_edges,
+                [&](int64_t eidx) {
+                    const int vidx0 = adjacency->edges_[eidx](0);
+                    const int vidx1 = adjacency->edges_[eidx](1);
+                    Eigen::Vector3d new_vert = old_mesh->vertices_[vidx0] +
+                                               old_mesh->vertices_[vidx1];
+                    Eigen::Vector3d new_normal;
+                    if (has_vert_normal) {
+                        new_normal = old_mesh->vertex_normals_[vidx0] +
+                                     old_mesh->vertex_normals_[vidx1];
+                    }
+                    Eigen::Vector3d new_color;
+                    if (has_vert_color) {
+                        new_color = old_mesh->vertex_colors_[vidx0] +
+                                    old_mesh->vertex_colors_[vidx1];
+                    }
 
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
+                    const int64_t n_adjacent_trias =
+                            NumDistinctEdgeTriangles(*adjacency, eidx);
+                    if (n_adjacent_trias < 2) {
+                        new_vert *= 0.5;
+                        if (has_vert_normal) {
+                            new_normal *= 0.5;
+                        }
+                        if (has_vert_color) {
+                            new_color *= 0.5;
+                        }
+                    } else {
+                        new_vert *= 3. / 8.;
+                        if (has_vert_normal) {
+                            new_normal *= 3. / 8.;
+                        }
+                        if (has_vert_color) {
+                            new_color *= 3. / 8.;
+                        }
+                        double scale = 1. / (4. * n_adjacent_trias);
+                        for (int64_t i = adjacency->edge_offsets_[eidx];
+                             i < adjacency->edge_offsets_[eidx + 1]; ++i) {
+                            const int tidx = adjacency->edge_triangles_[i];
+                            if (i > adjacency->edge_offsets_[eidx] &&
+                                tidx == adjacency->edge_triangles_[i - 1]) {
+                                continue;
+                            }
+                            const auto &tria = old_mesh->triangles_[tidx];
+                            int vidx2 = (tria(0) != vidx0 && tria(0) != vidx1)
+                                                ? tria(0)
+                                                : ((tria(1) != vidx0 &&
+                                                    tria(1) != vidx1)
+                                                           ? tria(1)
+                                                           : tria(2));
+                            new_vert += scale * old_mesh->vertices_[vidx2];
+                            if (has_vert_normal) {
+                                new_normal +=
+                                        scale *
+                                        old_mesh->vertex_normals_[vidx2];
+                            }
+                            if (has_vert_color) {
+                                new_color += scale *
+                                             old_mesh->vertex_colors_[vidx2];
+                            }
+                        }
+                    }
 
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-        }
+                    const int vidx01 = edge_vertices[eidx];
+                    new_mesh->vertices_[vidx01] = new_vert;
+                    if (has_vert_normal) {
+                        new_mesh->vertex_normals_[vidx01] = new_normal;
+                    }
+                    if (has_vert_color) {
+                        new_mesh->vertex_colors_[vidx01] = new_color;
+                    }
+                },
+                kSubdivideGrainSize);
 
+        SplitTriangles(old_mesh->triangles_, *adjacency, edge_vertices,
+                       new_mesh->triangles_);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
+        if (iter + 1 < number_of_iterations) {
+            adjacency = TriangleMeshAdjacency::CreateFromTriangleMesh(
+                    *old_mesh);
+        }
     }
 
     if (HasTriangleNormals()) {
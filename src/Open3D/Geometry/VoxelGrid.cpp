@@ -30,11 +30,14 @@
 #include <unordered_map>
 
 #include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/VoxelProjection.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -269,6 +272,77 @@ std::shared_ptr<geometry::Octree> VoxelGrid::ToOctree(
     return octree;
 }
 
+namespace {
+
+/// Minimum number of voxels carved by one task.
+constexpr int64_t kCarveGrainSize = 256;
+
+/// Removes the voxels that are carved in at least one view. The voxels are
+/// tested in parallel, and the views of a voxel are only tested until one of
+/// them carves it.
+template <typename keep_t>
+void CarveViews(VoxelGrid &grid,
+                const std::vector<const Image *> &images,
+                const std::vector<camera::PinholeCameraParameters> &cameras,
+                const keep_t &keep) {
+    std::vector<VoxelProjection> projections;
+    projections.reserve(cameras.size());
+    for (const camera::PinholeCameraParameters &camera : cameras) {
+        projections.emplace_back(grid.voxel_size_, grid.origin_, camera);
+    }
+    std::vector<Eigen::Vector3i> indices;
+    indices.reserve(grid.voxels_.size());
+    for (const auto &keyval : grid.voxels_) {
+        indices.push_back(keyval.first);
+    }
+    std::vector<uint8_t> carved(indices.size(), 0);
+    utility::ParallelFor(
+            0, static_cast<int64_t>(indices.size()),
+            [&](int64_t i) {
+                for (size_t view = 0; view < projections.size(); ++view) {
+                    if (projections[view].IsCarved(indices[i], *images[view],
+                                                   keep)) {
+                        carved[i] = 1;
+                        break;
+                    }
+                }
+            },
+            kCarveGrainSize);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        if (carved[i]) {
+            grid.voxels_.erase(indices[i]);
+        }
+    }
+}
+
+/// Checks that there is one image per camera, and that every image has the
+/// size of its camera.
+std::vector<const Image *> CheckViews(
+        const std::vector<std::shared_ptr<Image>> &images,
+        const std::vector<camera::PinholeCameraParameters> &cameras,
+        const std::string &image_name) {
+    if (images.size() != cameras.size()) {
+        utility::LogError(
+                "[VoxelGrid] {:d} {}s are provided for {:d} camera "
+                "parameters.",
+                images.size(), image_name, cameras.size());
+    }
+    std::vector<const Image *> views(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (!images[i] || images[i]->height_ != cameras[i].intrinsic_.height_ ||
+            images[i]->width_ != cameras[i].intrinsic_.width_) {
+            utility::LogError(
+                    "[VoxelGrid] provided {} {:d} dimensions are not "
+                    "compatible with the provided camera_parameters",
+                    image_name, i);
+        }
+        views[i] = images[i].get();
+    }
+    return views;
+}
+
+}  // unnamed namespace
+
 VoxelGrid &VoxelGrid::CarveDepthMap(
         const Image &depth_map,
         const camera::PinholeCameraParameters &camera_parameter,
@@ -279,37 +353,14 @@ VoxelGrid &VoxelGrid::CarveDepthMap(
                 "[VoxelGrid] provided depth_map dimensions are not compatible "
                 "with the provided camera_parameters");
     }
-
-    auto rot = camera_parameter.extrinsic_.block<3, 3>(0, 0);
-    auto trans = camera_parameter.extrinsic_.block<3, 1>(0, 3);
-    auto intrinsic = camera_parameter.intrinsic_.intrinsic_matrix_;
-
     // get for each voxel if it projects to a valid pixel and check if the voxel
     // depth is behind the depth of the depth map at the projected pixel.
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
-        auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
-        for (auto &x : pts) {
-            auto x_trans = rot * x + trans;
-            auto uvz = intrinsic * x_trans;
-            double z = uvz(2);
-            double u = uvz(0) / z;
-            double v = uvz(1) / z;
-            double d;
-            bool within_boundary;
-            std::tie(within_boundary, d) = depth_map.FloatValueAt(u, v);
-            if ((!within_boundary && keep_voxels_outside_image) ||
-                (within_boundary && d > 0 && z >= d)) {
-                carve = false;
-                break;
-            }
-        }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
+    CarveViews(*this, {&depth_map}, {camera_parameter},
+               [keep_voxels_outside_image](bool within_boundary, double z,
+                                           double d) {
+                   return (!within_boundary && keep_voxels_outside_image) ||
+                          (within_boundary && d > 0 && z >= d);
+               });
     return *this;
 }
 
@@ -323,37 +374,46 @@ VoxelGrid &VoxelGrid::CarveSilhouette(
                 "[VoxelGrid] provided silhouette_mask dimensions are not "
                 "compatible with the provided camera_parameters");
     }
-
-    auto rot = camera_parameter.extrinsic_.block<3, 3>(0, 0);
-    auto trans = camera_parameter.extrinsic_.block<3, 1>(0, 3);
-    auto intrinsic = camera_parameter.intrinsic_.intrinsic_matrix_;
-
     // get for each voxel if it projects to a valid pixel and check if the pixel
     // is set (>0).
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
-        auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
-        for (auto &x : pts) {
-            auto x_trans = rot * x + trans;
-            auto uvz = intrinsic * x_trans;
-            double z = uvz(2);
-            double u = uvz(0) / z;
-            double v = uvz(1) / z;
-            double d;
-            bool within_boundary;
-            std::tie(within_boundary, d) = silhouette_mask.FloatValueAt(u, v);
-            if ((!within_boundary && keep_voxels_outside_image) ||
-                (within_boundary && d > 0)) {
-                carve = false;
-                break;
-            }
-        }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
+    CarveViews(*this, {&silhouette_mask}, {camera_parameter},
+               [keep_voxels_outside_image](bool within_boundary, double z,
+                                           double d) {
+                   return (!within_boundary && keep_voxels_outside_image) ||
+                          (within_boundary && d > 0);
+               });
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMaps(
+        const std::vector<std::shared_ptr<Image>> &depth_maps,
+        const camera::PinholeCameraTrajectory &camera_trajectory,
+        bool keep_voxels_outside_image) {
+    CarveViews(*this,
+               CheckViews(depth_maps, camera_trajectory.parameters_,
+                          "depth_map"),
+               camera_trajectory.parameters_,
+               [keep_voxels_outside_image](bool within_boundary, double z,
+                                           double d) {
+                   return (!within_boundary && keep_voxels_outside_image) ||
+                          (within_boundary && d > 0 && z >= d);
+               });
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouettes(
+        const std::vector<std::shared_ptr<Image>> &silhouette_masks,
+        const camera::PinholeCameraTrajectory &camera_trajectory,
+        bool keep_voxels_outside_image) {
+    CarveViews(*this,
+               CheckViews(silhouette_masks, camera_trajectory.parameters_,
+                          "silhouette_mask"),
+               camera_trajectory.parameters_,
+               [keep_voxels_outside_image](bool within_boundary, double z,
+                                           double d) {
+                   return (!within_boundary && keep_voxels_outside_image) ||
+                          (within_boundary && d > 0);
+               });
     return *this;
 }
 
@@ -40,6 +40,7 @@ namespace open3d {
 
 namespace camera {
 class PinholeCameraParameters;
+class PinholeCameraTrajectory;
 }
 
 namespace geometry {
@@ -167,6 +168,33 @@ public:
             const camera::PinholeCameraParameters &camera_parameter,
             bool keep_voxels_outside_image);
 
+    /// Carves the VoxelGrid with many depth maps at once, as CarveDepthMap
+    /// does for each of them. Every voxel is only projected into the views
+    /// until one of them carves it.
+    ///
+    /// \param depth_maps Depth maps (Image) used for VoxelGrid carving.
+    /// \param camera_trajectory Camera parameters of the depth maps, one per
+    /// depth map.
+    /// \param keep_voxels_outside_image Project all voxels to a valid location.
+    VoxelGrid &CarveDepthMaps(
+            const std::vector<std::shared_ptr<Image>> &depth_maps,
+            const camera::PinholeCameraTrajectory &camera_trajectory,
+            bool keep_voxels_outside_image);
+
+    /// Carves the VoxelGrid with many silhouette masks at once, as
+    /// CarveSilhouette does for each of them. Every voxel is only projected
+    /// into the views until one of them carves it.
+    ///
+    /// \param silhouette_masks Silhouette masks (Image) used for VoxelGrid
+    /// carving.
+    /// \param camera_trajectory Camera parameters of the silhouette masks,
+    /// one per mask.
+    /// \param keep_voxels_outside_image Project all voxels to a valid location.
+    VoxelGrid &CarveSilhouettes(
+            const std::vector<std::shared_ptr<Image>> &silhouette_masks,
+            const camera::PinholeCameraTrajectory &camera_trajectory,
+            bool keep_voxels_outside_image);
+
     /// Create VoxelGrid from Octree
     ///
     /// \param octree The input Octree.
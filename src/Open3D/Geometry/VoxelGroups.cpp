@@ -0,0 +1,423 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VoxelGroups.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+int64_t VoxelGroups::FindVoxel(const Eigen::Vector3i &voxel_index) const {
+    auto less = [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+        return std::make_tuple(a(2), a(1), a(0)) <
+               std::make_tuple(b(2), b(1), b(0));
+    };
+    auto it = std::lower_bound(voxels_.begin(), voxels_.end(), voxel_index,
+                               less);
+    if (it == voxels_.end() || *it != voxel_index) {
+        return -1;
+    }
+    return static_cast<int64_t>(it - voxels_.begin());
+}
+
+Eigen::Vector3i ComputeVoxelIndex(const Eigen::Vector3d &point,
+                                  const Eigen::Vector3d &voxel_min_bound,
+                                  double voxel_size) {
+    Eigen::Vector3d ref_coord = (point - voxel_min_bound) / voxel_size;
+    return Eigen::Vector3i(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                           int(floor(ref_coord(2))));
+}
+
+VoxelGroups GroupByVoxelIndex(
+        const std::vector<Eigen::Vector3i> &voxel_indices) {
+    const int64_t n = static_cast<int64_t>(voxel_indices.size());
+    VoxelGroups groups;
+    if (n == 0) {
+        groups.voxel_offsets_ = {0};
+        return groups;
+    }
+
+    typedef std::pair<Eigen::Vector3i, Eigen::Vector3i> Range;
+    const Range range = utility::ParallelReduce(
+            0, n,
+            Range(Eigen::Vector3i::Constant(std::numeric_limits<int>::max()),
+                  Eigen::Vector3i::Constant(std::numeric_limits<int>::min())),
+            [&](int64_t begin, int64_t end, Range chunk_range) {
+                for (int64_t i = begin; i < end; i++) {
+                    chunk_range.first = chunk_range.first.cwiseMin(
+                            voxel_indices[i]);
+                    chunk_range.second = chunk_range.second.cwiseMax(
+                            voxel_indices[i]);
+                }
+                return chunk_range;
+            },
+            [](const Range &lhs, const Range &rhs) {
+                return Range(lhs.first.cwiseMin(rhs.first),
+                             lhs.second.cwiseMax(rhs.second));
+            },
+            kVoxelPointGrainSize);
+    const Eigen::Vector3i &min_index = range.first;
+    const Eigen::Matrix<int64_t, 3, 1> extent =
+            range.second.cast<int64_t>() - min_index.cast<int64_t>() +
+            Eigen::Matrix<int64_t, 3, 1>::Ones();
+
+    groups.order_.resize(n);
+    if (double(extent(0)) * double(extent(1)) * double(extent(2)) <
+        double(std::numeric_limits<int64_t>::max())) {
+        std::vector<uint64_t> keys(n);
+        utility::ParallelFor(
+                0, n,
+                [&](int64_t i) {
+                    Eigen::Matrix<int64_t, 3, 1> offset =
+                            voxel_indices[i].cast<int64_t>() -
+                            min_index.cast<int64_t>();
+                    keys[i] = uint64_t(offset(0) +
+                                       extent(0) * (offset(1) +
+                                                    extent(1) * offset(2)));
+                    groups.order_[i] = i;
+                },
+                kVoxelPointGrainSize);
+        utility::ParallelRadixSortPairs(keys, groups.order_,
+                                        kVoxelPointGrainSize);
+    } else {
+        // The voxel grid is too large to linearize its indices.
+        std::iota(groups.order_.begin(), groups.order_.end(), 0);
+        std::stable_sort(groups.order_.begin(), groups.order_.end(),
+                         [&](int64_t lhs, int64_t rhs) {
+                             const Eigen::Vector3i &a = voxel_indices[lhs];
+                             const Eigen::Vector3i &b = voxel_indices[rhs];
+                             return std::make_tuple(a(2), a(1), a(0)) <
+                                    std::make_tuple(b(2), b(1), b(0));
+                         });
+    }
+
+    // The first point of each voxel, collected per chunk and concatenated in
+    // index order.
+    groups.voxel_offsets_ = utility::ParallelReduce(
+            0, n, std::vector<int64_t>(),
+            [&](int64_t begin, int64_t end, std::vector<int64_t> offsets) {
+                for (int64_t i = begin; i < end; i++) {
+                    if (i == 0 || voxel_indices[groups.order_[i]] !=
+                                          voxel_indices[groups.order_[i - 1]]) {
+                        offsets.push_back(i);
+                    }
+                }
+                return offsets;
+            },
+            [](std::vector<int64_t> lhs, const std::vector<int64_t> &rhs) {
+                lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+                return lhs;
+            },
+            kVoxelPointGrainSize);
+    groups.voxel_offsets_.push_back(n);
+    groups.voxels_.resize(groups.NumVoxels());
+    utility::ParallelFor(
+            0, groups.NumVoxels(),
+            [&](int64_t v) {
+                groups.voxels_[v] =
+                        voxel_indices[groups.order_[groups.voxel_offsets_[v]]];
+            },
+            kVoxelGrainSize);
+    return groups;
+}
+
+
+
+VoxelGroups GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                               const Eigen::Vector3d &voxel_min_bound,
+                               double voxel_size) {
+    const int64_t n = static_cast<int64_t>(points.size());
+    std::vector<Eigen::Vector3i> voxel_indices(n);
+    utility::ParallelFor(
+            0, n,
+            [&](int64_t i) {
+                voxel_indices[i] = ComputeVoxelIndex(
+                        points[i], voxel_min_bound, voxel_size);
+            },
+            kVoxelPointGrainSize);
+    return GroupByVoxelIndex(voxel_indices);
+}
+
+VoxelGroups GroupPointsByVoxel(const std::vector<Eigen::Vector3f> &points,
+                               const Eigen::Vector3d &voxel_min_bound,
+                               double voxel_size) {
+    const int64_t n = static_cast<int64_t>(points.size());
+    std::vector<Eigen::Vector3i> voxel_indices(n);
+    utility::ParallelFor(
+            0, n,
+            [&](int64_t i) {
+                voxel_indices[i] =
+                        ComputeVoxelIndex(points[i].cast<double>(),
+                                          voxel_min_bound, voxel_size);
+            },
+            kVoxelPointGrainSize);
+    return GroupByVoxelIndex(voxel_indices);
+}
+
+Eigen::Vector3d SumAttribute(const std::vector<Eigen::Vector3d> &attribute,
+                             const VoxelGroups &groups,
+                             int64_t v) {
+    Eigen::Vector3d sum(0.0, 0.0, 0.0);
+    for (int64_t t = groups.voxel_offsets_[v]; t < groups.voxel_offsets_[v + 1];
+         t++) {
+        sum += attribute[groups.order_[t]];
+    }
+    return sum;
+}
+
+Eigen::Vector3d SumAttribute(const std::vector<Eigen::Vector3f> &attribute,
+                             const VoxelGroups &groups,
+                             int64_t v) {
+    Eigen::Vector3d sum(0.0, 0.0, 0.0);
+    for (int64_t t = groups.voxel_offsets_[v]; t < groups.voxel_offsets_[v + 1];
+         t++) {
+        sum += attribute[groups.order_[t]].cast<double>();
+    }
+    return sum;
+}
+
+std::vector<int> FindDuplicatedPoints(
+        const std::vector<Eigen::Vector3d> &points) {
+    const int64_t n = static_cast<int64_t>(points.size());
+    std::vector<int> representatives(n);
+    if (n == 0) {
+        return representatives;
+    }
+    auto IsFinite = [](const Eigen::Vector3d &point) {
+        return std::isfinite(point(0)) && std::isfinite(point(1)) &&
+               std::isfinite(point(2));
+    };
+    typedef std::pair<Eigen::Vector3d, Eigen::Vector3d> Bound;
+    const Bound bound = utility::ParallelReduce(
+            0, n,
+            Bound(Eigen::Vector3d::Constant(
+                          std::numeric_limits<double>::infinity()),
+                  Eigen::Vector3d::Constant(
+                          -std::numeric_limits<double>::infinity())),
+            [&](int64_t begin, int64_t end, Bound chunk_bound) {
+                for (int64_t i = begin; i < end; i++) {
+                    if (IsFinite(points[i])) {
+                        chunk_bound.first =
+                                chunk_bound.first.cwiseMin(points[i]);
+                        chunk_bound.second =
+                                chunk_bound.second.cwiseMax(points[i]);
+                    }
+                }
+                return chunk_bound;
+            },
+            [](const Bound &lhs, const Bound &rhs) {
+                return Bound(lhs.first.cwiseMin(rhs.first),
+                             lhs.second.cwiseMax(rhs.second));
+            },
+            kVoxelPointGrainSize);
+    // 2^20 voxels along the longest axis, so that the linearized voxel
+    // indices fit into 64 bits.
+    const double extent = (bound.second - bound.first).maxCoeff();
+    const double voxel_size =
+            extent > 0 && std::isfinite(extent) ? extent / (1 << 20) : 1.0;
+    // Points that are not finite are collected in voxel (-1, -1, -1).
+    std::vector<Eigen::Vector3i> voxel_indices(n);
+    utility::ParallelFor(
+            0, n,
+            [&](int64_t i) {
+                voxel_indices[i] = IsFinite(points[i])
+                                           ? ComputeVoxelIndex(points[i],
+                                                               bound.first,
+                                                               voxel_size)
+                                           : Eigen::Vector3i(-1, -1, -1);
+            },
+            kVoxelPointGrainSize);
+    const VoxelGroups groups = GroupByVoxelIndex(voxel_indices);
+
+    typedef std::tuple<double, double, double> Coordinate3;
+    auto GetCoordinate = [&](int64_t i) {
+        return std::make_tuple(points[i](0), points[i](1), points[i](2));
+    };
+    utility::ParallelFor(
+            0, groups.NumVoxels(),
+            [&](int64_t v) {
+                const int64_t begin = groups.voxel_offsets_[v];
+                const int64_t end = groups.voxel_offsets_[v + 1];
+                if (end - begin == 1) {
+                    representatives[groups.order_[begin]] =
+                            int(groups.order_[begin]);
+                    return;
+                }
+                if (groups.voxels_[v] == Eigen::Vector3i(-1, -1, -1)) {
+                    // NaN is never equal to any coordinate, so these points
+                    // are compared by hashing as the sequential pass did.
+                    std::unordered_map<Coordinate3, int,
+                                       utility::hash_tuple::hash<Coordinate3>>
+                            point_to_index;
+                    for (int64_t t = begin; t < end; t++) {
+                        const int i = int(groups.order_[t]);
+                        auto it = point_to_index.find(GetCoordinate(i));
+                        if (it == point_to_index.end()) {
+                            point_to_index[GetCoordinate(i)] = i;
+                            representatives[i] = i;
+                        } else {
+                            representatives[i] = it->second;
+                        }
+                    }
+                    return;
+                }
+                // Sort by coordinates and index, so that the first point of a
+                // run of the same coordinates has the smallest index.
+                std::vector<int64_t> members(groups.order_.begin() + begin,
+                                             groups.order_.begin() + end);
+                std::sort(members.begin(), members.end(),
+                          [&](int64_t lhs, int64_t rhs) {
+                              return std::make_tuple(GetCoordinate(lhs), lhs) <
+                                     std::make_tuple(GetCoordinate(rhs), rhs);
+                          });
+                int64_t first = members[0];
+                for (const int64_t i : members) {
+                    if (GetCoordinate(i) != GetCoordinate(first)) {
+                        first = i;
+                    }
+                    representatives[i] = int(first);
+                }
+            },
+            kVoxelGrainSize);
+    return representatives;
+}
+
+void FindClosePointPairs(const std::vector<Eigen::Vector3d> &points,
+                         double eps,
+                         std::vector<int> &neighbors,
+                         std::vector<int64_t> &offsets) {
+    const int64_t n = static_cast<int64_t>(points.size());
+    neighbors.clear();
+    offsets.assign(n + 1, 0);
+    if (n == 0 || !(eps > 0)) {
+        return;
+    }
+    Eigen::Vector3d min_bound = points[0];
+    Eigen::Vector3d max_bound = points[0];
+    for (const Eigen::Vector3d &point : points) {
+        min_bound = min_bound.cwiseMin(point);
+        max_bound = max_bound.cwiseMax(point);
+    }
+    const double eps2 = eps * eps;
+
+    if (eps * (std::numeric_limits<int>::max() / 2) <
+        (max_bound - min_bound).maxCoeff()) {
+        KDTreeFlann kdtree;
+        kdtree.SetMatrixData(Eigen::Map<const Eigen::MatrixXd>(
+                reinterpret_cast<const double *>(points.data()), 3, n));
+        std::vector<std::vector<int>> nbs(n);
+        utility::ParallelFor(0, n, [&](int64_t i) {
+            std::vector<double> dists2;
+            kdtree.SearchRadius(points[i], eps, nbs[i], dists2);
+            nbs[i].erase(std::remove_if(nbs[i].begin(), nbs[i].end(),
+                                        [i](int j) { return j <= i; }),
+                         nbs[i].end());
+            std::sort(nbs[i].begin(), nbs[i].end());
+        });
+        for (int64_t i = 0; i < n; i++) {
+            offsets[i + 1] = offsets[i] + int64_t(nbs[i].size());
+        }
+        neighbors.resize(offsets[n]);
+        utility::ParallelFor(0, n, [&](int64_t i) {
+            std::copy(nbs[i].begin(), nbs[i].end(),
+                      neighbors.begin() + offsets[i]);
+        });
+        return;
+    }
+
+    // Neighbors within eps are in the 27 voxels around the voxel of a point.
+    const VoxelGroups groups = GroupPointsByVoxel(points, min_bound, eps);
+    auto ForEachNeighbor = [&](int64_t v, const auto &func) {
+        int64_t neighbor_voxels[27];
+        int num_neighbor_voxels = 0;
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    const int64_t u = groups.FindVoxel(
+                            groups.voxels_[v] + Eigen::Vector3i(dx, dy, dz));
+                    if (u >= 0) {
+                        neighbor_voxels[num_neighbor_voxels++] = u;
+                    }
+                }
+            }
+        }
+        for (int64_t s = groups.voxel_offsets_[v];
+             s < groups.voxel_offsets_[v + 1]; s++) {
+            const int64_t i = groups.order_[s];
+            for (int k = 0; k < num_neighbor_voxels; k++) {
+                const int64_t u = neighbor_voxels[k];
+                for (int64_t t = groups.voxel_offsets_[u];
+                     t < groups.voxel_offsets_[u + 1]; t++) {
+                    const int64_t j = groups.order_[t];
+                    if (j > i && (points[i] - points[j]).squaredNorm() < eps2) {
+                        func(i, j);
+                    }
+                }
+            }
+        }
+    };
+    // Count, scan and fill, so that the neighbors are stored without
+    // per-point allocations.
+    utility::ParallelFor(
+            0, groups.NumVoxels(),
+            [&](int64_t v) {
+                ForEachNeighbor(v,
+                                [&](int64_t i, int64_t) { offsets[i + 1]++; });
+            },
+            kVoxelGrainSize);
+    for (int64_t i = 0; i < n; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    neighbors.resize(offsets[n]);
+    std::vector<int64_t> next(offsets.begin(), offsets.end() - 1);
+    utility::ParallelFor(
+            0, groups.NumVoxels(),
+            [&](int64_t v) {
+                ForEachNeighbor(v, [&](int64_t i, int64_t j) {
+                    neighbors[next[i]++] = int(j);
+                });
+            },
+            kVoxelGrainSize);
+    utility::ParallelFor(
+            0, n,
+            [&](int64_t i) {
+                std::sort(neighbors.begin() + offsets[i],
+                          neighbors.begin() + offsets[i + 1]);
+            },
+            kVoxelPointGrainSize);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// Points per task when computing voxel indices and sort keys.
+constexpr int64_t kVoxelPointGrainSize = 32768;
+
+/// Voxels per task when reducing the points of voxels.
+constexpr int64_t kVoxelGrainSize = 1024;
+
+/// \class VoxelGroups
+///
+/// \brief Points grouped by voxel, the group-by shared by the voxel based
+/// filters of PointCloud and TriangleMesh.
+///
+/// The points in voxel v are order_[voxel_offsets_[v]] to
+/// order_[voxel_offsets_[v + 1] - 1] in increasing index order, and voxels
+/// are sorted by their (z, y, x) index, which is voxels_[v].
+class VoxelGroups {
+public:
+    int64_t NumVoxels() const {
+        return static_cast<int64_t>(voxel_offsets_.size()) - 1;
+    }
+    int64_t NumPoints(int64_t v) const {
+        return voxel_offsets_[v + 1] - voxel_offsets_[v];
+    }
+    /// Returns the group of \p voxel_index, or -1 if no point is in that
+    /// voxel. This is a binary search over voxels_.
+    int64_t FindVoxel(const Eigen::Vector3i &voxel_index) const;
+
+public:
+    std::vector<int64_t> order_;
+    std::vector<int64_t> voxel_offsets_;
+    std::vector<Eigen::Vector3i> voxels_;
+};
+
+Eigen::Vector3i ComputeVoxelIndex(const Eigen::Vector3d &point,
+                                  const Eigen::Vector3d &voxel_min_bound,
+                                  double voxel_size);
+
+/// Groups points by their \p voxel_indices with a parallel radix sort of
+/// linearized voxel indices. The sort is stable, so accumulating the points
+/// of a voxel in group order adds them in the same order as a sequential
+/// pass would.
+VoxelGroups GroupByVoxelIndex(
+        const std::vector<Eigen::Vector3i> &voxel_indices);
+
+/// Groups \p points by the voxel of size \p voxel_size that contains them.
+VoxelGroups GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                               const Eigen::Vector3d &voxel_min_bound,
+                               double voxel_size);
+/// Same as above for single precision points. The voxel indices are computed
+/// in double precision, so both give the same groups for the same points.
+VoxelGroups GroupPointsByVoxel(const std::vector<Eigen::Vector3f> &points,
+                               const Eigen::Vector3d &voxel_min_bound,
+                               double voxel_size);
+
+/// Sums \p attribute over the points in voxel \p v, in group order.
+Eigen::Vector3d SumAttribute(const std::vector<Eigen::Vector3d> &attribute,
+                             const VoxelGroups &groups,
+                             int64_t v);
+/// Same as above for a single precision attribute, summed in double
+/// precision.
+Eigen::Vector3d SumAttribute(const std::vector<Eigen::Vector3f> &attribute,
+                             const VoxelGroups &groups,
+                             int64_t v);
+
+/// Returns for every point the smallest index of a point with the same
+/// coordinates. The points are grouped on a fine voxel grid, and the points
+/// of every voxel are compared by sorting them. Points with NaN coordinates
+/// are never duplicates.
+std::vector<int> FindDuplicatedPoints(
+        const std::vector<Eigen::Vector3d> &points);
+
+/// Finds for every point i the points j > i at a distance less than \p eps.
+/// The neighbors of point i are neighbors[offsets[i]] to
+/// neighbors[offsets[i + 1] - 1] in increasing order. The neighbors are
+/// searched on a grid of voxel size \p eps in parallel, or with a KDTreeFlann
+/// if \p eps is too small for the extent of the points.
+void FindClosePointPairs(const std::vector<Eigen::Vector3d> &points,
+                         double eps,
+                         std::vector<int> &neighbors,
+                         std::vector<int64_t> &offsets);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <tuple>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class VoxelProjection
+///
+/// \brief Projection of the voxel corners of a voxel grid into one view.
+///
+/// The homogeneous image coordinates (u z, v z, z) of a point are affine in
+/// its position, so corner c of the voxel with grid index i projects to
+/// base_ + index_to_uvz_ * i + corner_uvz_[c]. This replaces the rigid
+/// transform and camera projection of each corner by a vector addition, and
+/// is shared by the carving of VoxelGrid and CompactVoxelGrid.
+class VoxelProjection {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Size of the voxels.
+    /// \param origin Coordinate of the origin of the voxel grid.
+    /// \param camera_parameter Parameters of the camera of the view.
+    VoxelProjection(double voxel_size,
+                    const Eigen::Vector3d &origin,
+                    const camera::PinholeCameraParameters &camera_parameter) {
+        const Eigen::Matrix3d rot =
+                camera_parameter.extrinsic_.block<3, 3>(0, 0);
+        const Eigen::Vector3d trans =
+                camera_parameter.extrinsic_.block<3, 1>(0, 3);
+        const Eigen::Matrix3d &intrinsic =
+                camera_parameter.intrinsic_.intrinsic_matrix_;
+        index_to_uvz_ = intrinsic * rot * voxel_size;
+        base_ = intrinsic * (rot * origin + trans);
+        for (int corner = 0; corner < 8; ++corner) {
+            // Same order as VoxelGrid::GetVoxelBoundingPoints.
+            corner_uvz_[corner] =
+                    index_to_uvz_ * Eigen::Vector3d(corner & 2 ? 1.0 : 0.0,
+                                                    corner & 4 ? 1.0 : 0.0,
+                                                    corner & 1 ? 1.0 : 0.0);
+        }
+    }
+
+    /// Returns true if the voxel is to be carved, i.e. none of its corners is
+    /// kept by keep(within_boundary, z, d) with the image value d at the
+    /// projection of a corner of camera depth z.
+    template <typename keep_t>
+    bool IsCarved(const Eigen::Vector3i &index,
+                  const Image &image,
+                  const keep_t &keep) const {
+        const Eigen::Vector3d uvz0 =
+                base_ + index_to_uvz_ * index.cast<double>();
+        for (const Eigen::Vector3d &corner_uvz : corner_uvz_) {
+            const Eigen::Vector3d uvz = uvz0 + corner_uvz;
+            double z = uvz(2);
+            double d;
+            bool within_boundary;
+            std::tie(within_boundary, d) =
+                    image.FloatValueAt(uvz(0) / z, uvz(1) / z);
+            if (keep(within_boundary, z, d)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    Eigen::Matrix3d index_to_uvz_;
+    Eigen::Vector3d base_;
+    Eigen::Vector3d corner_uvz_[8];
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,328 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/VoxelStorage.h"
+
+#include <algorithm>
+#include <bitset>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr int kKeyBits = 21;
+constexpr int64_t kKeyOffset = int64_t(1) << (kKeyBits - 1);
+constexpr uint64_t kKeyMask = (uint64_t(1) << kKeyBits) - 1;
+
+// Smallest and largest table, and max load factor of kMaxLoadNum /
+// kMaxLoadDen. Tables are not rounded to powers of two, so that a reserved
+// table is close to the max load.
+constexpr size_t kMinNumSlots = 16;
+constexpr size_t kMaxNumSlots = size_t(1) << 32;
+constexpr size_t kMaxLoadNum = 3;
+constexpr size_t kMaxLoadDen = 4;
+
+}  // unnamed namespace
+
+constexpr uint64_t HashedVoxelStorage::kEmptyKey;
+
+bool HashedVoxelStorage::IsIndexValid(const Eigen::Vector3i &index) {
+    return (index.array() >= -kKeyOffset).all() &&
+           (index.array() < kKeyOffset).all();
+}
+
+uint64_t HashedVoxelStorage::PackKey(const Eigen::Vector3i &index) {
+    return uint64_t(index(0) + kKeyOffset) |
+           (uint64_t(index(1) + kKeyOffset) << kKeyBits) |
+           (uint64_t(index(2) + kKeyOffset) << (2 * kKeyBits));
+}
+
+Eigen::Vector3i HashedVoxelStorage::UnpackKey(uint64_t key) {
+    return Eigen::Vector3i(int(int64_t(key & kKeyMask) - kKeyOffset),
+                           int(int64_t((key >> kKeyBits) & kKeyMask) -
+                               kKeyOffset),
+                           int(int64_t((key >> (2 * kKeyBits)) & kKeyMask) -
+                               kKeyOffset));
+}
+
+size_t HashedVoxelStorage::HomeSlot(uint64_t key) const {
+    // Finalizer of MurmurHash3, spreads the entropy to the low bits.
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    // Maps the high 32 bits to [0, number of slots) without a division.
+    return size_t(((key >> 32) * uint64_t(keys_.size())) >> 32);
+}
+
+size_t HashedVoxelStorage::NextSlot(size_t slot) const {
+    return slot + 1 == keys_.size() ? 0 : slot + 1;
+}
+
+size_t HashedVoxelStorage::FindSlot(uint64_t key) const {
+    size_t slot = HomeSlot(key);
+    while (keys_[slot] != kEmptyKey && keys_[slot] != key) {
+        slot = NextSlot(slot);
+    }
+    return slot;
+}
+
+size_t HashedVoxelStorage::GetStorageBytes() const {
+    return keys_.capacity() * sizeof(uint64_t) +
+           colors_.capacity() * sizeof(Eigen::Vector3uint8);
+}
+
+void HashedVoxelStorage::Clear() {
+    std::vector<uint64_t>().swap(keys_);
+    std::vector<Eigen::Vector3uint8>().swap(colors_);
+    size_ = 0;
+}
+
+void HashedVoxelStorage::Reserve(size_t num_voxels) {
+    size_t num_slots = std::max(
+            kMinNumSlots,
+            (num_voxels * kMaxLoadDen + kMaxLoadNum - 1) / kMaxLoadNum);
+    if (num_slots > keys_.size()) {
+        Rehash(num_slots);
+    }
+}
+
+void HashedVoxelStorage::Rehash(size_t num_slots) {
+    if (num_slots > kMaxNumSlots) {
+        utility::LogError("[HashedVoxelStorage] Too many voxels: {}.", size_);
+    }
+    std::vector<uint64_t> old_keys(num_slots, kEmptyKey);
+    std::vector<Eigen::Vector3uint8> old_colors(num_slots);
+    old_keys.swap(keys_);
+    old_colors.swap(colors_);
+    for (size_t slot = 0; slot < old_keys.size(); ++slot) {
+        if (old_keys[slot] != kEmptyKey) {
+            size_t new_slot = FindSlot(old_keys[slot]);
+            keys_[new_slot] = old_keys[slot];
+            colors_[new_slot] = old_colors[slot];
+        }
+    }
+}
+
+bool HashedVoxelStorage::Contains(const Eigen::Vector3i &index) const {
+    if (size_ == 0 || !IsIndexValid(index)) {
+        return false;
+    }
+    return keys_[FindSlot(PackKey(index))] != kEmptyKey;
+}
+
+bool HashedVoxelStorage::GetColor(const Eigen::Vector3i &index,
+                                  Eigen::Vector3uint8 &color) const {
+    if (size_ == 0 || !IsIndexValid(index)) {
+        return false;
+    }
+    size_t slot = FindSlot(PackKey(index));
+    if (keys_[slot] == kEmptyKey) {
+        return false;
+    }
+    color = colors_[slot];
+    return true;
+}
+
+bool HashedVoxelStorage::Insert(const Eigen::Vector3i &index,
+                                const Eigen::Vector3uint8 &color) {
+    if (!IsIndexValid(index)) {
+        utility::LogError(
+                "[HashedVoxelStorage] Voxel index ({}, {}, {}) is out of "
+                "[-2^20, 2^20).",
+                index(0), index(1), index(2));
+    }
+    if ((size_ + 1) * kMaxLoadDen > keys_.size() * kMaxLoadNum) {
+        Rehash(std::max(kMinNumSlots, keys_.size() * 2));
+    }
+    const uint64_t key = PackKey(index);
+    size_t slot = FindSlot(key);
+    colors_[slot] = color;
+    if (keys_[slot] == key) {
+        return false;
+    }
+    keys_[slot] = key;
+    size_++;
+    return true;
+}
+
+bool HashedVoxelStorage::Erase(const Eigen::Vector3i &index) {
+    if (size_ == 0 || !IsIndexValid(index)) {
+        return false;
+    }
+    size_t hole = FindSlot(PackKey(index));
+    if (keys_[hole] == kEmptyKey) {
+        return false;
+    }
+    // Backward shift deletion: move up every following entry of the cluster
+    // whose home slot is not between the hole and its slot.
+    const size_t num_slots = keys_.size();
+    auto distance = [num_slots](size_t from, size_t to) {
+        return to >= from ? to - from : to + num_slots - from;
+    };
+    for (size_t slot = NextSlot(hole); keys_[slot] != kEmptyKey;
+         slot = NextSlot(slot)) {
+        size_t home = HomeSlot(keys_[slot]);
+        if (distance(home, slot) >= distance(hole, slot)) {
+            keys_[hole] = keys_[slot];
+            colors_[hole] = colors_[slot];
+            hole = slot;
+        }
+    }
+    keys_[hole] = kEmptyKey;
+    size_--;
+    return true;
+}
+
+DenseVoxelStorage::DenseVoxelStorage(const Eigen::Vector3i &min_index,
+                                     const Eigen::Vector3i &resolution)
+    : min_index_(min_index), resolution_(resolution) {
+    if ((resolution.array() < 0).any()) {
+        utility::LogError(
+                "[DenseVoxelStorage] Resolution ({}, {}, {}) is negative.",
+                resolution(0), resolution(1), resolution(2));
+    }
+    const int64_t num_voxels = int64_t(resolution(0)) * resolution(1) *
+                               int64_t(resolution(2));
+    bits_.assign(size_t((num_voxels + 63) / 64), 0);
+}
+
+size_t DenseVoxelStorage::GetStorageBytes() const {
+    return bits_.capacity() * sizeof(uint64_t) +
+           colors_.capacity() * sizeof(Eigen::Vector3uint8);
+}
+
+void DenseVoxelStorage::Clear() {
+    std::fill(bits_.begin(), bits_.end(), 0);
+    std::vector<Eigen::Vector3uint8>().swap(colors_);
+    size_ = 0;
+}
+
+void DenseVoxelStorage::Fill() {
+    const int64_t num_voxels = int64_t(resolution_(0)) * resolution_(1) *
+                               int64_t(resolution_(2));
+    std::fill(bits_.begin(), bits_.end(), ~uint64_t(0));
+    if (num_voxels % 64 != 0) {
+        bits_.back() = (uint64_t(1) << (num_voxels % 64)) - 1;
+    }
+    size_ = size_t(num_voxels);
+}
+
+int64_t DenseVoxelStorage::LinearIndex(const Eigen::Vector3i &index) const {
+    Eigen::Vector3i offset = index - min_index_;
+    return offset(0) +
+           int64_t(resolution_(0)) * (offset(1) + int64_t(resolution_(1)) *
+                                                          offset(2));
+}
+
+Eigen::Vector3i DenseVoxelStorage::GetLinearIndexVoxel(
+        int64_t linear_index) const {
+    const int64_t x = linear_index % resolution_(0);
+    const int64_t yz = linear_index / resolution_(0);
+    return min_index_ + Eigen::Vector3i(int(x), int(yz % resolution_(1)),
+                                        int(yz / resolution_(1)));
+}
+
+int DenseVoxelStorage::LowestBit(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    int bit = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+bool DenseVoxelStorage::Contains(const Eigen::Vector3i &index) const {
+    if (!IsIndexValid(index)) {
+        return false;
+    }
+    int64_t linear_index = LinearIndex(index);
+    return (bits_[linear_index / 64] >> (linear_index % 64)) & 1;
+}
+
+bool DenseVoxelStorage::GetColor(const Eigen::Vector3i &index,
+                                 Eigen::Vector3uint8 &color) const {
+    if (!Contains(index)) {
+        return false;
+    }
+    color = GetLinearIndexColor(LinearIndex(index));
+    return true;
+}
+
+bool DenseVoxelStorage::Insert(const Eigen::Vector3i &index,
+                               const Eigen::Vector3uint8 &color) {
+    if (!IsIndexValid(index)) {
+        utility::LogError(
+                "[DenseVoxelStorage] Voxel index ({}, {}, {}) is out of the "
+                "box.",
+                index(0), index(1), index(2));
+    }
+    int64_t linear_index = LinearIndex(index);
+    if (colors_.empty() && (color.array() != 0).any()) {
+        colors_.assign(bits_.size() * 64, Eigen::Vector3uint8(0, 0, 0));
+    }
+    if (!colors_.empty()) {
+        colors_[linear_index] = color;
+    }
+    uint64_t &word = bits_[linear_index / 64];
+    const uint64_t bit = uint64_t(1) << (linear_index % 64);
+    if (word & bit) {
+        return false;
+    }
+    word |= bit;
+    size_++;
+    return true;
+}
+
+bool DenseVoxelStorage::Erase(const Eigen::Vector3i &index) {
+    if (!Contains(index)) {
+        return false;
+    }
+    int64_t linear_index = LinearIndex(index);
+    bits_[linear_index / 64] &= ~(uint64_t(1) << (linear_index % 64));
+    if (!colors_.empty()) {
+        colors_[linear_index] = Eigen::Vector3uint8(0, 0, 0);
+    }
+    size_--;
+    return true;
+}
+
+void DenseVoxelStorage::SetWord(size_t word, uint64_t bits) {
+    size_ -= std::bitset<64>(bits_[word]).count();
+    size_ += std::bitset<64>(bits).count();
+    bits_[word] = bits;
+}
+
+}  // namespace geometry
+}  // namespace open3d
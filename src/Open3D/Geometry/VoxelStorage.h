@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class HashedVoxelStorage
+///
+/// \brief Set of voxels with 8-bit RGB colors in an open addressing hash
+/// table.
+///
+/// Voxel indices are packed into 64-bit keys with 21 bits per axis, so each
+/// coordinate must be in [-2^20, 2^20). A slot takes 11 bytes and the table
+/// is at most 3/4 full, so a reserved table takes about 15 bytes per voxel.
+/// Erasing shifts the following entries back instead of leaving tombstones,
+/// so lookups stay fast after carving.
+class HashedVoxelStorage {
+public:
+    HashedVoxelStorage() {}
+    ~HashedVoxelStorage() {}
+
+public:
+    /// Returns true if \p index can be packed into a key.
+    static bool IsIndexValid(const Eigen::Vector3i &index);
+    /// Packs a valid voxel index into a key. Keys are never ~0.
+    static uint64_t PackKey(const Eigen::Vector3i &index);
+    /// Inverse of PackKey.
+    static Eigen::Vector3i UnpackKey(uint64_t key);
+
+    /// Number of voxels.
+    size_t Size() const { return size_; }
+    /// Memory used by the table, in bytes.
+    size_t GetStorageBytes() const;
+    /// Removes all voxels and frees the table.
+    void Clear();
+    /// Grows the table such that \p num_voxels fit without rehashing. Inserting
+    /// into a full table doubles it.
+    void Reserve(size_t num_voxels);
+
+    /// Returns true if the voxel exists.
+    bool Contains(const Eigen::Vector3i &index) const;
+    /// Returns true and sets \p color if the voxel exists.
+    bool GetColor(const Eigen::Vector3i &index,
+                  Eigen::Vector3uint8 &color) const;
+    /// Adds the voxel or overwrites its color. Returns true if it was added.
+    bool Insert(const Eigen::Vector3i &index,
+                const Eigen::Vector3uint8 &color);
+    /// Removes the voxel. Returns true if it existed.
+    bool Erase(const Eigen::Vector3i &index);
+
+    /// Number of slots, used with IsSlotOccupied and GetSlot to visit voxels in
+    /// parallel.
+    size_t NumSlots() const { return keys_.size(); }
+    bool IsSlotOccupied(size_t slot) const { return keys_[slot] != kEmptyKey; }
+    /// Index and color of the voxel in an occupied slot.
+    Eigen::Vector3i GetSlotIndex(size_t slot) const {
+        return UnpackKey(keys_[slot]);
+    }
+    const Eigen::Vector3uint8 &GetSlotColor(size_t slot) const {
+        return colors_[slot];
+    }
+
+    /// Calls f(index, color) for every voxel, in no particular order.
+    template <typename func_t>
+    void ForEach(func_t f) const {
+        for (size_t slot = 0; slot < keys_.size(); ++slot) {
+            if (keys_[slot] != kEmptyKey) {
+                f(UnpackKey(keys_[slot]), colors_[slot]);
+            }
+        }
+    }
+
+private:
+    static constexpr uint64_t kEmptyKey = ~uint64_t(0);
+
+    size_t HomeSlot(uint64_t key) const;
+    size_t NextSlot(size_t slot) const;
+    /// Slot holding \p key, or the empty slot where it would be inserted.
+    size_t FindSlot(uint64_t key) const;
+    void Rehash(size_t num_slots);
+
+private:
+    std::vector<uint64_t> keys_;
+    std::vector<Eigen::Vector3uint8> colors_;
+    size_t size_ = 0;
+};
+
+/// \class DenseVoxelStorage
+///
+/// \brief Set of voxels with 8-bit RGB colors within a bounded box of voxel
+/// indices.
+///
+/// Occupancy takes one bit per voxel of the box. Colors take 3 bytes per
+/// voxel of the box and are only allocated once a voxel gets a color other
+/// than black, so occupancy grids for carving stay at one bit per voxel.
+class DenseVoxelStorage {
+public:
+    DenseVoxelStorage() : min_index_(0, 0, 0), resolution_(0, 0, 0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param min_index Smallest voxel index of the box.
+    /// \param resolution Number of voxels of the box along each axis.
+    DenseVoxelStorage(const Eigen::Vector3i &min_index,
+                      const Eigen::Vector3i &resolution);
+    ~DenseVoxelStorage() {}
+
+public:
+    /// Returns true if \p index is within the box.
+    bool IsIndexValid(const Eigen::Vector3i &index) const {
+        return (index.array() >= min_index_.array()).all() &&
+               (index.array() < (min_index_ + resolution_).array()).all();
+    }
+
+    /// Number of voxels.
+    size_t Size() const { return size_; }
+    /// Memory used by the occupancy bits and colors, in bytes.
+    size_t GetStorageBytes() const;
+    /// Removes all voxels, keeping the box.
+    void Clear();
+    /// Adds every voxel of the box.
+    void Fill();
+
+    bool Contains(const Eigen::Vector3i &index) const;
+    bool GetColor(const Eigen::Vector3i &index,
+                  Eigen::Vector3uint8 &color) const;
+    /// Adds the voxel or overwrites its color. Returns true if it was added.
+    /// The index must be within the box.
+    bool Insert(const Eigen::Vector3i &index,
+                const Eigen::Vector3uint8 &color);
+    bool Erase(const Eigen::Vector3i &index);
+
+    /// Number of 64-bit occupancy words, used with GetWord and SetWord to
+    /// visit voxels in parallel. Bit b of word w is voxel 64 * w + b in x, y,
+    /// z order.
+    size_t NumWords() const { return bits_.size(); }
+    uint64_t GetWord(size_t word) const { return bits_[word]; }
+    /// Replaces an occupancy word, updating the voxel count. Not thread-safe.
+    void SetWord(size_t word, uint64_t bits);
+    Eigen::Vector3i GetLinearIndexVoxel(int64_t linear_index) const;
+    Eigen::Vector3uint8 GetLinearIndexColor(int64_t linear_index) const {
+        return colors_.empty() ? Eigen::Vector3uint8(0, 0, 0)
+                               : colors_[linear_index];
+    }
+
+    /// Calls f(index, color) for every voxel, in x, y, z order.
+    template <typename func_t>
+    void ForEach(func_t f) const {
+        for (size_t word = 0; word < bits_.size(); ++word) {
+            for (uint64_t bits = bits_[word]; bits != 0; bits &= bits - 1) {
+                int64_t linear_index = int64_t(word * 64 + LowestBit(bits));
+                f(GetLinearIndexVoxel(linear_index),
+                  GetLinearIndexColor(linear_index));
+            }
+        }
+    }
+
+    /// Position of the lowest set bit of a non-zero word.
+    static int LowestBit(uint64_t bits);
+
+public:
+    /// Smallest voxel index of the box.
+    Eigen::Vector3i min_index_;
+    /// Number of voxels of the box along each axis.
+    Eigen::Vector3i resolution_;
+
+private:
+    int64_t LinearIndex(const Eigen::Vector3i &index) const;
+
+private:
+    std::vector<uint64_t> bits_;
+    std::vector<Eigen::Vector3uint8> colors_;
+    size_t size_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
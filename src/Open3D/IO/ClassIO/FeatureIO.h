@@ -42,9 +42,14 @@ bool ReadFeature(const std::string &filename, registration::Feature &feature);
 bool WriteFeature(const std::string &filename,
                   const registration::Feature &feature);
 
+/// Reads a Feature from a BIN file. The file is memory mapped. Features
+/// written in single precision are read back in single precision.
 bool ReadFeatureFromBIN(const std::string &filename,
                         registration::Feature &feature);
 
+/// Writes a Feature to a BIN file. Double precision features keep the
+/// original layout (rows, cols, data). Single precision features are written
+/// with a tagged header and float32 data.
 bool WriteFeatureToBIN(const std::string &filename,
                        const registration::Feature &feature);
 
@@ -36,8 +36,12 @@ namespace io {
 static std::map<std::string, FileGeometry (*)(const std::string&)> gExt2Func = {
         {"glb", ReadFileGeometryTypeGLTF},
         {"gltf", ReadFileGeometryTypeGLTF},
+        {"las", ReadFileGeometryTypeLAS},
+        {"laz", ReadFileGeometryTypeLAS},
         {"obj", ReadFileGeometryTypeOBJ},
+        {"o3dg", ReadFileGeometryTypeO3DG},
         {"off", ReadFileGeometryTypeOFF},
+        {"opc", ReadFileGeometryTypeOPC},
         {"pcd", ReadFileGeometryTypePCD},
         {"ply", ReadFileGeometryTypePLY},
         {"pts", ReadFileGeometryTypePTS},
@@ -31,6 +31,23 @@
 namespace open3d {
 namespace io {
 
+/// \struct FileAttributeInfo
+/// \brief An attribute as stored in a file, e.g. the "x" property of the
+/// vertices of a PLY file or the "normal_x" field of a PCD file.
+struct FileAttributeInfo {
+    /// Name of the attribute in the file.
+    std::string name;
+    /// Storage type of every value: "int8", "uint8", "int16", "uint16",
+    /// "int32", "uint32", "float32" or "float64", or "ascii" for values
+    /// stored as text.
+    std::string type;
+    /// Number of values per element.
+    int count = 1;
+    /// Whether every element holds a list of values, preceded by their
+    /// number, e.g. the vertex indices of the faces of a PLY file.
+    bool is_list = false;
+};
+
 enum FileGeometry {
     CONTENTS_UNKNOWN = 0,
     CONTAINS_POINTS = (1 << 0),
@@ -44,8 +61,11 @@ enum FileGeometry {
 FileGeometry ReadFileGeometryType(const std::string& path);
 
 FileGeometry ReadFileGeometryTypeGLTF(const std::string& path);
+FileGeometry ReadFileGeometryTypeLAS(const std::string& path);
+FileGeometry ReadFileGeometryTypeO3DG(const std::string& path);
 FileGeometry ReadFileGeometryTypeOBJ(const std::string& path);
 FileGeometry ReadFileGeometryTypeOFF(const std::string& path);
+FileGeometry ReadFileGeometryTypeOPC(const std::string& path);
 FileGeometry ReadFileGeometryTypePCD(const std::string& path);
 FileGeometry ReadFileGeometryTypePLY(const std::string& path);
 FileGeometry ReadFileGeometryTypePTS(const std::string& path);
@@ -30,6 +30,8 @@
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -38,11 +40,14 @@ using namespace io;
 
 static const std::unordered_map<
         std::string,
-        std::function<bool(const std::string &, geometry::Image &)>>
+        std::function<bool(const std::string &,
+                           geometry::Image &,
+                           const ImageReadOption &)>>
         file_extension_to_image_read_function{
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
                 {"jpeg", ReadImageFromJPG},
+                {"rvl", ReadImageFromRVL},
         };
 
 static const std::unordered_map<
@@ -52,8 +57,55 @@ static const std::unordered_map<
                 {"png", WriteImageToPNG},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
+                {"rvl", WriteImageToRVL},
         };
 
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const uint8_t *,
+                           size_t,
+                           geometry::Image &,
+                           const ImageReadOption &)>>
+        format_to_image_read_from_memory_function{
+                {"png", ReadImageInMemoryFromPNG},
+                {"jpg", ReadImageInMemoryFromJPG},
+                {"jpeg", ReadImageInMemoryFromJPG},
+                {"rvl", ReadImageInMemoryFromRVL},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                std::vector<uint8_t> &, const geometry::Image &, int)>>
+        format_to_image_write_to_memory_function{
+                {"png", WriteImageInMemoryToPNG},
+                {"jpg", WriteImageInMemoryToJPG},
+                {"jpeg", WriteImageInMemoryToJPG},
+                {"rvl", WriteImageInMemoryToRVL},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, ImageInfo &)>>
+        file_extension_to_image_info_read_function{
+                {"png", ReadImageInfoFromPNG},
+                {"jpg", ReadImageInfoFromJPG},
+                {"jpeg", ReadImageInfoFromJPG},
+                {"rvl", ReadImageInfoFromRVL},
+        };
+
+bool CheckImageReadOption(const ImageReadOption &option) {
+    const int scale = option.scale_denominator;
+    if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+        utility::LogWarning(
+                "Read geometry::Image failed: scale_denominator must be 1, 2, "
+                "4 or 8, got {:d}.",
+                scale);
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -66,6 +118,13 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    return ReadImage(filename, image, ImageReadOption());
+}
+
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               const ImageReadOption &option) {
+    utility::ProfilerScope profiler_scope("ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -79,7 +138,25 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
                 "Read geometry::Image failed: unknown file extension.");
         return false;
     }
-    return map_itr->second(filename, image);
+    if (!CheckImageReadOption(option)) {
+        return false;
+    }
+    bool success = map_itr->second(filename, image, option);
+    profiler_scope.AddBytes(int64_t(image.data_.size()));
+    return success;
+}
+
+bool ReadImageInfo(const std::string &filename, ImageInfo &info) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_image_info_read_function.find(
+            filename_ext);
+    if (map_itr == file_extension_to_image_info_read_function.end()) {
+        utility::LogWarning("Read image info failed: unknown file extension.");
+        return false;
+    }
+    info = ImageInfo();
+    return map_itr->second(filename, info);
 }
 
 bool WriteImage(const std::string &filename,
@@ -101,5 +178,48 @@ bool WriteImage(const std::string &filename,
     return map_itr->second(filename, image, quality);
 }
 
+bool ReadImageFromMemory(const uint8_t *buffer,
+                         size_t length,
+                         const std::string &format,
+                         geometry::Image &image) {
+    return ReadImageFromMemory(buffer, length, format, image,
+                               ImageReadOption());
+}
+
+bool ReadImageFromMemory(const uint8_t *buffer,
+                         size_t length,
+                         const std::string &format,
+                         geometry::Image &image,
+                         const ImageReadOption &option) {
+    utility::ProfilerScope profiler_scope("ReadImageFromMemory");
+    auto map_itr = format_to_image_read_from_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_image_read_from_memory_function.end()) {
+        utility::LogWarning("Read geometry::Image failed: unknown format {}.",
+                            format);
+        return false;
+    }
+    if (!CheckImageReadOption(option)) {
+        return false;
+    }
+    bool success = map_itr->second(buffer, length, image, option);
+    profiler_scope.AddBytes(int64_t(image.data_.size()));
+    return success;
+}
+
+bool WriteImageToMemory(std::vector<uint8_t> &buffer,
+                        const std::string &format,
+                        const geometry::Image &image,
+                        int quality /* = 90*/) {
+    auto map_itr = format_to_image_write_to_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_image_write_to_memory_function.end()) {
+        utility::LogWarning("Write geometry::Image failed: unknown format {}.",
+                            format);
+        return false;
+    }
+    return map_itr->second(buffer, image, quality);
+}
+
 }  // namespace io
 }  // namespace open3d
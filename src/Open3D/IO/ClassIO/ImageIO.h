@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Open3D/Geometry/Image.h"
 
@@ -38,11 +39,33 @@ namespace io {
 std::shared_ptr<geometry::Image> CreateImageFromFile(
         const std::string &filename);
 
+/// \struct ImageReadOption
+/// \brief Optional parameters to ReadImage().
+struct ImageReadOption {
+    /// Reduces the resolution of the image by this factor while decoding,
+    /// 1, 2, 4 or 8. The image is ceil(width / scale_denominator) by
+    /// ceil(height / scale_denominator). JPG files are decoded at the reduced
+    /// resolution with DCT scaling, which is several times faster than a full
+    /// decode. PNG files keep the top-left pixel of each block, so depth
+    /// values are not blended across edges.
+    int scale_denominator = 1;
+    /// Decodes JPG files with the fast integer DCT and without fancy
+    /// upsampling of the chroma channels, trading a little accuracy for speed.
+    bool fast_decode = false;
+};
+
 /// The general entrance for reading an Image from a file
 /// The function calls read functions based on the extension name of filename.
+/// \p image is overwritten; its buffer is reused when large enough, so
+/// reading a sequence of images into the same Image does not allocate.
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// ReadImage() with the decoding parameters of \p option.
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               const ImageReadOption &option);
+
 /// The general entrance for writing an Image to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports quality, the parameter will be used.
@@ -52,17 +75,111 @@ bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = 90);
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
+/// The general entrance for reading an Image from the \p length bytes at
+/// \p buffer, e.g. a file received over the network, without going through
+/// the filesystem. \p format is the file extension of the content, "png",
+/// "jpg", "jpeg" or "rvl".
+/// \return return true if the read function is successful, false otherwise.
+bool ReadImageFromMemory(const uint8_t *buffer,
+                         size_t length,
+                         const std::string &format,
+                         geometry::Image &image);
+
+/// ReadImageFromMemory() with the decoding parameters of \p option.
+bool ReadImageFromMemory(const uint8_t *buffer,
+                         size_t length,
+                         const std::string &format,
+                         geometry::Image &image,
+                         const ImageReadOption &option);
+
+/// The general entrance for writing an Image to memory in the format of the
+/// file extension \p format. \p buffer is replaced by the content that
+/// WriteImage would write to a file.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteImageToMemory(std::vector<uint8_t> &buffer,
+                        const std::string &format,
+                        const geometry::Image &image,
+                        int quality = 90);
+
+/// \struct ImageInfo
+/// \brief What the header of an image file tells about its content, see
+/// ReadImageInfo().
+struct ImageInfo {
+    int width = 0;
+    int height = 0;
+    /// Number of channels and bytes per channel of the Image ReadImage
+    /// returns.
+    int num_of_channels = 0;
+    int bytes_per_channel = 0;
+};
+
+/// The general entrance for reading the size and the pixel format of an
+/// image file without decoding its pixels. Only the header of the file is
+/// parsed. The function calls read functions based on the extension name of
+/// filename.
+/// \return return true if the header is read successfully, false otherwise.
+bool ReadImageInfo(const std::string &filename, ImageInfo &info);
+
+bool ReadImageInfoFromPNG(const std::string &filename, ImageInfo &info);
+
+bool ReadImageFromPNG(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option = {});
 
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality);
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image);
+bool ReadImageInMemoryFromPNG(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option = {});
+
+bool WriteImageInMemoryToPNG(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality);
+
+bool ReadImageInfoFromJPG(const std::string &filename, ImageInfo &info);
+
+bool ReadImageFromJPG(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option = {});
 
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = 90);
 
+bool ReadImageInMemoryFromJPG(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option = {});
+
+bool WriteImageInMemoryToJPG(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality = 90);
+
+/// RVL is a lossless codec for 16 bit depth images, see Wilson, "Fast
+/// Lossless Depth Image Compression", ISS 2017. It is several times faster
+/// to decode than PNG and compresses depth images about as well. Only
+/// single channel, 16 bit images can be written, and \p quality is ignored.
+bool ReadImageInfoFromRVL(const std::string &filename, ImageInfo &info);
+
+bool ReadImageFromRVL(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option = {});
+
+bool WriteImageToRVL(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality);
+
+bool ReadImageInMemoryFromRVL(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option = {});
+
+bool WriteImageInMemoryToRVL(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality);
+
 }  // namespace io
 }  // namespace open3d
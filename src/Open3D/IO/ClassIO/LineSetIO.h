@@ -69,5 +69,15 @@ bool WriteLineSetToPLY(const std::string &filename,
                        bool compressed = false,
                        bool print_progress = false);
 
+bool ReadLineSetFromO3DG(const std::string &filename,
+                         geometry::LineSet &lineset,
+                         bool print_progress = false);
+
+bool WriteLineSetToO3DG(const std::string &filename,
+                        const geometry::LineSet &lineset,
+                        bool write_ascii = false,
+                        bool compressed = false,
+                        bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
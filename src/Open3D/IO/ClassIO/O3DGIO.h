@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry.h"
+#include "Open3D/Geometry/LineSet.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct WriteO3DGOption
+/// \brief Optional parameters to WriteGeometryToO3DG.
+///
+/// O3DG is the native binary geometry format. It stores each attribute, e.g.
+/// the points or the triangles, as a contiguous column split into chunks of
+/// rows, followed by an index of the chunks. Chunks can be read at random and
+/// decoded in parallel, and uncompressed chunks are decoded straight from the
+/// memory mapped file.
+struct WriteO3DGOption {
+    /// Encodings of the points and vertices.
+    enum class PositionEncoding {
+        /// 64 bit floats, lossless.
+        Float64,
+        /// 32 bit floats.
+        Float32,
+        /// 16 bit integers quantized over the bounding box of each chunk.
+        Quantized16,
+    };
+    /// Encoding of the points and vertices.
+    PositionEncoding position_encoding = PositionEncoding::Float32;
+    /// Whether to store normals as two 16 bit integers with the octahedral
+    /// encoding instead of three 32 bit floats. Zero normals do not survive
+    /// the encoding.
+    bool oct_encode_normals = false;
+    /// Whether to compress every chunk with LZF.
+    bool compressed = false;
+    /// Number of rows per chunk, 0 picks about a hundredth of the rows,
+    /// between 1000 and 65536.
+    int64_t chunk_size = 0;
+    /// Callback to invoke as writing is progressing, parameter is percentage
+    /// completion (0.-100.) return true indicates to continue writing, false
+    /// means to try to stop writing and cleanup
+    std::function<bool(double)> update_progress;
+};
+
+/// \brief Writes a PointCloud, TriangleMesh, LineSet, VoxelGrid or Octree to
+/// an O3DG file. Colors are stored as 8 bit integers, but for the lossless
+/// leaf colors of octrees, and the textures of meshes are not stored.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteGeometryToO3DG(const std::string &filename,
+                         const geometry::Geometry &geometry,
+                         const WriteO3DGOption &option = {});
+
+/// Writes \p geometry in the O3DG format to \p buffer, see
+/// WriteGeometryToO3DG().
+bool WriteGeometryInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                 const geometry::Geometry &geometry,
+                                 const WriteO3DGOption &option = {});
+
+/// \class O3DGFile
+///
+/// \brief Reads O3DG files, as a whole or one chunk of points at a time.
+class O3DGFile {
+public:
+    O3DGFile() {}
+    O3DGFile(const O3DGFile &) = delete;
+    O3DGFile &operator=(const O3DGFile &) = delete;
+
+public:
+    /// Maps \p filename and reads its index.
+    bool Open(const std::string &filename);
+    /// Reads the index of the O3DG content at \p buffer, which is not copied
+    /// and must outlive the reads.
+    bool Open(const uint8_t *buffer, size_t length);
+    /// Closes the file.
+    void Close();
+
+    /// Returns the type of the stored geometry, or Unspecified if no file is
+    /// open.
+    geometry::Geometry::GeometryType GetGeometryType() const {
+        return geometry_type_;
+    }
+    /// Returns the number of points of a point cloud, or of vertices of a
+    /// mesh or line set.
+    int64_t GetNumPoints() const;
+    /// Returns the number of chunks the points are split into.
+    int64_t GetNumChunks() const;
+
+    bool ReadPointCloud(geometry::PointCloud &pointcloud,
+                        std::function<bool(double)> update_progress = {});
+    /// Replaces \p chunk by the points of chunk \p chunk_index, in
+    /// [0, GetNumChunks()).
+    bool ReadPointCloudChunk(int64_t chunk_index, geometry::PointCloud &chunk);
+    bool ReadTriangleMesh(geometry::TriangleMesh &mesh,
+                          std::function<bool(double)> update_progress = {});
+    bool ReadLineSet(geometry::LineSet &lineset,
+                     std::function<bool(double)> update_progress = {});
+    bool ReadVoxelGrid(geometry::VoxelGrid &voxelgrid,
+                       std::function<bool(double)> update_progress = {});
+    /// Reads an octree with OctreeColorLeafNode leaves. The internal nodes
+    /// are stored in breadth-first order as one byte with the mask of their
+    /// children and one with the mask of the children that are leaves,
+    /// followed by the colors of the leaves.
+    bool ReadOctree(geometry::Octree &octree,
+                    std::function<bool(double)> update_progress = {});
+
+public:
+    /// Index entry of an attribute.
+    struct Column {
+        uint32_t attribute = 0;
+        uint32_t encoding = 0;
+        uint32_t components = 0;
+        uint32_t compression = 0;
+        int64_t num_rows = 0;
+        int64_t chunk_size = 0;
+        /// Offset and stored size of every chunk.
+        std::vector<uint64_t> chunk_offsets;
+        std::vector<uint64_t> chunk_sizes;
+    };
+
+    /// Returns the index entries of the attributes of the file.
+    const std::vector<Column> &GetColumns() const { return columns_; }
+    /// Reads the bounding box of the points or vertices, which files written
+    /// before it was added do not store. Returns false if there is none.
+    bool ReadBounds(Eigen::Vector3d &min_bound,
+                    Eigen::Vector3d &max_bound) const;
+
+private:
+    const Column *FindColumn(uint32_t attribute) const;
+    /// Checks that the file holds a geometry of type \p type.
+    bool CheckGeometryType(geometry::Geometry::GeometryType type) const;
+
+private:
+    utility::filesystem::MappedFile file_;
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+    geometry::Geometry::GeometryType geometry_type_ =
+            geometry::Geometry::GeometryType::Unspecified;
+    std::vector<Column> columns_;
+};
+
+}  // namespace io
+}  // namespace open3d
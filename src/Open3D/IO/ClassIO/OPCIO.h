@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct EncodeOPCOption
+/// \brief Optional parameters to EncodePointCloudToOPC.
+///
+/// OPC is a compressed point cloud format meant for streaming. The points are
+/// inserted into a geometry::Octree whose leaves have the size of the
+/// precision, and the occupancy of its nodes is entropy coded. Colors are
+/// coded as the difference to the color of the previous point in the octree
+/// order.
+struct EncodeOPCOption {
+    /// Size of the leaves of the octree. Points are moved to the center of
+    /// their leaf, so they move by at most half of it along every axis.
+    double precision = 0.001;
+    /// Whether to store the colors, as 8 bit integers.
+    bool write_colors = true;
+};
+
+/// \brief Encodes the points and colors of \p pointcloud to an OPC file.
+/// Normals are not stored, and the points are reordered along the octree.
+/// Points that are not finite are dropped.
+/// \return return true if the write function is successful, false otherwise.
+bool EncodePointCloudToOPC(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const EncodeOPCOption &option = {});
+
+/// Encodes \p pointcloud in the OPC format to \p buffer, see
+/// EncodePointCloudToOPC().
+bool EncodePointCloudInMemoryToOPC(std::vector<uint8_t> &buffer,
+                                   const geometry::PointCloud &pointcloud,
+                                   const EncodeOPCOption &option = {});
+
+/// Decodes the OPC content of the \p length bytes at \p buffer to
+/// \p pointcloud.
+/// \return return true if the content is valid, false otherwise.
+bool DecodePointCloudInMemoryFromOPC(const uint8_t *buffer,
+                                     size_t length,
+                                     geometry::PointCloud &pointcloud);
+
+}  // namespace io
+}  // namespace open3d
@@ -40,6 +40,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::Octree &)>>
         file_extension_to_octree_read_function{
                 {"json", ReadOctreeFromJson},
+                {"o3dg", ReadOctreeFromO3DG},
         };
 
 static const std::unordered_map<
@@ -47,12 +48,13 @@ static const std::unordered_map<
         std::function<bool(const std::string &, const geometry::Octree &)>>
         file_extension_to_octree_write_function{
                 {"json", WriteOctreeToJson},
+                {"o3dg", WriteOctreeToO3DG},
         };
 
 std::shared_ptr<geometry::Octree> CreateOctreeFromFile(
         const std::string &filename, const std::string &format) {
     auto octree = std::make_shared<geometry::Octree>();
-    WriteOctree(filename, *octree);
+    ReadOctree(filename, *octree, format);
     return octree;
 }
 
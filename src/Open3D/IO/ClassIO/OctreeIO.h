@@ -57,5 +57,12 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+bool ReadOctreeFromO3DG(const std::string &filename, geometry::Octree &octree);
+
+/// Writes the octree in the binary O3DG format, which is much faster to load
+/// than JSON. Only octrees with OctreeColorLeafNode leaves are supported.
+bool WriteOctreeToO3DG(const std::string &filename,
+                       const geometry::Octree &octree);
+
 }  // namespace io
 }  // namespace open3d
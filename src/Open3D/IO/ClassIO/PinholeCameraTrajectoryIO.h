@@ -68,5 +68,18 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+/// Reads a PinholeCameraTrajectory from the binary format written by
+/// WritePinholeCameraTrajectoryToBIN. The file is memory mapped.
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes a PinholeCameraTrajectory in a compact binary format, with the
+/// intrinsics and extrinsics of every camera stored as raw doubles in host
+/// byte order.
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Profiler.h"
 #include "Open3D/Utility/ProgressReporters.h"
 
 namespace open3d {
@@ -51,6 +52,10 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"o3dg", ReadPointCloudFromO3DG},
+                {"opc", ReadPointCloudFromOPC},
+                {"las", ReadPointCloudFromLAS},
+                {"laz", ReadPointCloudFromLAS},
         };
 
 static const std::unordered_map<
@@ -65,6 +70,57 @@ static const std::unordered_map<
                 {"ply", WritePointCloudToPLY},
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
+                {"o3dg", WritePointCloudToO3DG},
+                {"opc", WritePointCloudToOPC},
+                {"las", WritePointCloudToLAS},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const uint8_t *,
+                           size_t,
+                           geometry::PointCloud &,
+                           const ReadPointCloudOption &)>>
+        format_to_pointcloud_read_from_memory_function{
+                {"xyz", ReadPointCloudInMemoryFromXYZ},
+                {"xyzn", ReadPointCloudInMemoryFromXYZN},
+                {"xyzrgb", ReadPointCloudInMemoryFromXYZRGB},
+                {"ply", ReadPointCloudInMemoryFromPLY},
+                {"pcd", ReadPointCloudInMemoryFromPCD},
+                {"pts", ReadPointCloudInMemoryFromPTS},
+                {"o3dg", ReadPointCloudInMemoryFromO3DG},
+                {"opc", ReadPointCloudInMemoryFromOPC},
+                {"las", ReadPointCloudInMemoryFromLAS},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(std::vector<uint8_t> &,
+                           const geometry::PointCloud &,
+                           const WritePointCloudOption &)>>
+        format_to_pointcloud_write_to_memory_function{
+                {"xyz", WritePointCloudInMemoryToXYZ},
+                {"xyzn", WritePointCloudInMemoryToXYZN},
+                {"xyzrgb", WritePointCloudInMemoryToXYZRGB},
+                {"ply", WritePointCloudInMemoryToPLY},
+                {"pcd", WritePointCloudInMemoryToPCD},
+                {"pts", WritePointCloudInMemoryToPTS},
+                {"o3dg", WritePointCloudInMemoryToO3DG},
+                {"opc", WritePointCloudInMemoryToOPC},
+                {"las", WritePointCloudInMemoryToLAS},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, PointCloudInfo &)>>
+        file_extension_to_pointcloud_info_read_function{
+                {"ply", ReadPointCloudInfoFromPLY},
+                {"pcd", ReadPointCloudInfoFromPCD},
+                {"pts", ReadPointCloudInfoFromPTS},
+                {"o3dg", ReadPointCloudInfoFromO3DG},
+                {"opc", ReadPointCloudInfoFromOPC},
+                {"las", ReadPointCloudInfoFromLAS},
+                {"laz", ReadPointCloudInfoFromLAS},
         };
 }  // unnamed namespace
 
@@ -82,6 +138,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params) {
+    utility::ProfilerScope profiler_scope("ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -100,6 +157,7 @@ bool ReadPointCloud(const std::string &filename,
     bool success = map_itr->second(filename, pointcloud, params);
     utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                       (int)pointcloud.points_.size());
+    profiler_scope.AddItems(int64_t(pointcloud.points_.size()));
     if (params.remove_nan_points || params.remove_infinite_points) {
         pointcloud.RemoveNonFinitePoints(params.remove_nan_points,
                                          params.remove_infinite_points);
@@ -129,6 +187,32 @@ bool ReadPointCloud(const std::string &filename,
     return ReadPointCloud(filename, pointcloud, p);
 }
 
+bool ReadCompactPointCloud(const std::string &filename,
+                           geometry::CompactPointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    utility::ProfilerScope profiler_scope("ReadCompactPointCloud");
+    std::string format = params.format;
+    if (format == "auto") {
+        format = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    bool success;
+    if (format == "ply") {
+        success = ReadCompactPointCloudFromPLY(filename, pointcloud, params);
+        if (params.remove_nan_points || params.remove_infinite_points) {
+            pointcloud.RemoveNonFinitePoints(params.remove_nan_points,
+                                             params.remove_infinite_points);
+        }
+    } else {
+        geometry::PointCloud buffer;
+        success = ReadPointCloud(filename, buffer, params);
+        pointcloud = *geometry::CompactPointCloud::CreateFromPointCloud(buffer);
+    }
+    utility::LogDebug("Read geometry::CompactPointCloud: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    profiler_scope.AddItems(int64_t(pointcloud.points_.size()));
+    return success;
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params) {
@@ -166,5 +250,69 @@ bool WritePointCloud(const std::string &filename,
     return WritePointCloud(filename, pointcloud, p);
 }
 
+bool ReadPointCloudFromMemory(const uint8_t *buffer,
+                              size_t length,
+                              const std::string &format,
+                              geometry::PointCloud &pointcloud,
+                              const ReadPointCloudOption &params) {
+    utility::ProfilerScope profiler_scope("ReadPointCloudFromMemory");
+    auto map_itr = format_to_pointcloud_read_from_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_pointcloud_read_from_memory_function.end()) {
+        utility::LogWarning(
+                "Read geometry::PointCloud failed: unknown format {}.",
+                format);
+        return false;
+    }
+    bool success = map_itr->second(buffer, length, pointcloud, params);
+    utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    profiler_scope.AddItems(int64_t(pointcloud.points_.size()));
+    if (params.remove_nan_points || params.remove_infinite_points) {
+        pointcloud.RemoveNonFinitePoints(params.remove_nan_points,
+                                         params.remove_infinite_points);
+    }
+    return success;
+}
+
+bool WritePointCloudToMemory(std::vector<uint8_t> &buffer,
+                             const std::string &format,
+                             const geometry::PointCloud &pointcloud,
+                             const WritePointCloudOption &params) {
+    auto map_itr = format_to_pointcloud_write_to_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_pointcloud_write_to_memory_function.end()) {
+        utility::LogWarning(
+                "Write geometry::PointCloud failed: unknown format {}.",
+                format);
+        return false;
+    }
+    bool success = map_itr->second(buffer, pointcloud, params);
+    utility::LogDebug("Write geometry::PointCloud: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    return success;
+}
+
+bool ReadPointCloudInfo(const std::string &filename,
+                        PointCloudInfo &info,
+                        const std::string &format /* = "auto"*/) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    auto map_itr =
+            file_extension_to_pointcloud_info_read_function.find(file_format);
+    if (map_itr == file_extension_to_pointcloud_info_read_function.end()) {
+        utility::LogWarning(
+                "Read point cloud info failed: unsupported file extension for "
+                "{} (format: {}).",
+                filename, format);
+        return false;
+    }
+    info = PointCloudInfo();
+    return map_itr->second(filename, info);
+}
+
 }  // namespace io
 }  // namespace open3d
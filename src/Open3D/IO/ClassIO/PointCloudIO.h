@@ -27,8 +27,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "Open3D/Geometry/CompactPointCloud.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
 
 namespace open3d {
 namespace io {
@@ -85,6 +88,17 @@ bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const ReadPointCloudOption &params = {});
 
+/// \brief The general entrance for reading a CompactPointCloud from a file.
+///
+/// PLY files are decoded straight into single precision storage, so the
+/// points never take double precision memory. Other formats are read as a
+/// PointCloud and converted. See \p ReadPointCloudOption for additional
+/// options you can pass.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadCompactPointCloud(const std::string &filename,
+                           geometry::CompactPointCloud &pointcloud,
+                           const ReadPointCloudOption &params = {});
+
 /// \struct WritePointCloudOption
 /// \brief Optional parameters to WritePointCloud
 struct WritePointCloudOption {
@@ -139,6 +153,53 @@ bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params = {});
 
+/// The general entrance for reading a PointCloud from the \p length bytes at
+/// \p buffer, e.g. a file received over the network, without going through
+/// the filesystem. \p format is the file extension of the content, e.g.
+/// "ply" or "pcd"; \p params.format is ignored.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadPointCloudFromMemory(const uint8_t *buffer,
+                              size_t length,
+                              const std::string &format,
+                              geometry::PointCloud &pointcloud,
+                              const ReadPointCloudOption &params = {});
+
+/// The general entrance for writing a PointCloud to memory in the format of
+/// the file extension \p format, e.g. "ply" or "pcd". \p buffer is replaced
+/// by the content that WritePointCloud would write to a file.
+/// \return return true if the write function is successful, false otherwise.
+bool WritePointCloudToMemory(std::vector<uint8_t> &buffer,
+                             const std::string &format,
+                             const geometry::PointCloud &pointcloud,
+                             const WritePointCloudOption &params = {});
+
+/// \struct PointCloudInfo
+/// \brief What the header of a point cloud file tells about its content,
+/// see ReadPointCloudInfo().
+struct PointCloudInfo {
+    /// Number of points, -1 if the header does not store it.
+    int64_t num_points = -1;
+    /// Attributes of every point, in the order of the file.
+    std::vector<FileAttributeInfo> attributes;
+    /// Whether the points have normals and colors that ReadPointCloud reads.
+    bool has_normals = false;
+    bool has_colors = false;
+    /// Whether the file stores the bounding box of the points.
+    bool has_bounds = false;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+};
+
+/// The general entrance for reading the metadata of a point cloud file
+/// without reading its points. Only the header of the file is parsed, which
+/// makes it cheap on files of any size. At current "ply", "pcd", "pts",
+/// "o3dg", "opc" and "las" are supported, default \p format "auto" means to
+/// go off of file extension.
+/// \return return true if the header is read successfully, false otherwise.
+bool ReadPointCloudInfo(const std::string &filename,
+                        PointCloudInfo &info,
+                        const std::string &format = "auto");
+
 bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -147,6 +208,15 @@ bool WritePointCloudToXYZ(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromXYZ(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToXYZ(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
 bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params);
@@ -155,6 +225,15 @@ bool WritePointCloudToXYZN(const std::string &filename,
                            const geometry::PointCloud &pointcloud,
                            const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromXYZN(const uint8_t *buffer,
+                                    size_t length,
+                                    geometry::PointCloud &pointcloud,
+                                    const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToXYZN(std::vector<uint8_t> &buffer,
+                                   const geometry::PointCloud &pointcloud,
+                                   const WritePointCloudOption &params);
+
 bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               const ReadPointCloudOption &params);
@@ -163,14 +242,42 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
                              const geometry::PointCloud &pointcloud,
                              const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromXYZRGB(const uint8_t *buffer,
+                                      size_t length,
+                                      geometry::PointCloud &pointcloud,
+                                      const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToXYZRGB(std::vector<uint8_t> &buffer,
+                                     const geometry::PointCloud &pointcloud,
+                                     const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromPLY(const std::string &filename,
+                               PointCloudInfo &info);
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
 
+bool ReadCompactPointCloudFromPLY(const std::string &filename,
+                                  geometry::CompactPointCloud &pointcloud,
+                                  const ReadPointCloudOption &params);
+
 bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromPLY(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToPLY(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromPCD(const std::string &filename,
+                               PointCloudInfo &info);
+
 bool ReadPointCloudFromPCD(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -179,6 +286,18 @@ bool WritePointCloudToPCD(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromPCD(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToPCD(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromPTS(const std::string &filename,
+                               PointCloudInfo &info);
+
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -187,5 +306,80 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+bool ReadPointCloudInMemoryFromPTS(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToPTS(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromO3DG(const std::string &filename,
+                                PointCloudInfo &info);
+
+bool ReadPointCloudFromO3DG(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool WritePointCloudToO3DG(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
+bool ReadPointCloudInMemoryFromO3DG(const uint8_t *buffer,
+                                    size_t length,
+                                    geometry::PointCloud &pointcloud,
+                                    const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                   const geometry::PointCloud &pointcloud,
+                                   const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromOPC(const std::string &filename,
+                               PointCloudInfo &info);
+
+bool ReadPointCloudFromOPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes the OPC format with the default EncodeOPCOption, see
+/// EncodePointCloudToOPC() in OPCIO.h to choose the precision.
+bool WritePointCloudToOPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+bool ReadPointCloudInMemoryFromOPC(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToOPC(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
+bool ReadPointCloudInfoFromLAS(const std::string &filename,
+                               PointCloudInfo &info);
+
+/// Reads the points and colors of a LAS 1.0 to 1.4 file. LAZ compressed
+/// files are not supported. See ReadPointCloudFromLAS() in TPointCloudIO.h
+/// to keep intensities, classifications and the other LAS fields.
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes a LAS 1.2 file. Normals are not stored.
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+bool ReadPointCloudInMemoryFromLAS(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params);
+
+bool WritePointCloudInMemoryToLAS(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,574 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/PointCloudPipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+/// Regular grid of tiles over the bounds of the input points. Tile (i, j, k)
+/// has index i + num_tiles_(0) * (j + num_tiles_(1) * k). Points outside the
+/// grid belong to the nearest tile.
+struct TileGrid {
+    int64_t NumTiles() const {
+        return int64_t(num_tiles_(0)) * num_tiles_(1) * num_tiles_(2);
+    }
+    /// Returns the coordinate of the tile of \p x along \p axis.
+    int Coordinate(double x, int axis) const {
+        if (num_tiles_(axis) == 1) {
+            return 0;
+        }
+        const double c = std::floor((x - origin_(axis)) / tile_size_(axis));
+        if (!(c > 0.0)) {
+            return 0;
+        }
+        return int(std::min(c, double(num_tiles_(axis) - 1)));
+    }
+    int64_t Index(int i, int j, int k) const {
+        return i + int64_t(num_tiles_(0)) * (j + int64_t(num_tiles_(1)) * k);
+    }
+    int64_t IndexOf(const Eigen::Vector3d &p) const {
+        return Index(Coordinate(p(0), 0), Coordinate(p(1), 1),
+                     Coordinate(p(2), 2));
+    }
+    /// Returns the bounds of tile \p t. Along the axes that are not split,
+    /// they are the bounds of the points.
+    geometry::AxisAlignedBoundingBox Bounds(int64_t t) const {
+        const int64_t nx = num_tiles_(0), ny = num_tiles_(1);
+        const Eigen::Vector3i c(int(t % nx), int((t / nx) % ny),
+                                int(t / (nx * ny)));
+        Eigen::Vector3d min_bound, max_bound;
+        for (int axis = 0; axis < 3; axis++) {
+            if (num_tiles_(axis) == 1) {
+                min_bound(axis) = origin_(axis);
+                max_bound(axis) = max_bound_(axis);
+            } else {
+                min_bound(axis) = origin_(axis) + c(axis) * tile_size_(axis);
+                max_bound(axis) = min_bound(axis) + tile_size_(axis);
+            }
+        }
+        return geometry::AxisAlignedBoundingBox(min_bound, max_bound);
+    }
+
+    Eigen::Vector3d origin_;
+    Eigen::Vector3d max_bound_;
+    Eigen::Vector3d tile_size_;
+    Eigen::Vector3i num_tiles_;
+};
+
+/// Buffers the points of every tile and appends them to one file per tile
+/// when the buffers grow over a given size. The files and the directory are
+/// removed on destruction.
+class TileSpill {
+public:
+    TileSpill(const std::string &directory,
+              int64_t num_tiles,
+              bool has_normals,
+              bool has_colors,
+              int64_t max_buffered_bytes)
+        : directory_(utility::filesystem::GetRegularizedDirectoryName(
+                  directory)),
+          has_normals_(has_normals),
+          has_colors_(has_colors),
+          record_size_(3 + (has_normals ? 3 : 0) + (has_colors ? 3 : 0)),
+          max_buffered_bytes_(max_buffered_bytes),
+          buffers_(num_tiles),
+          num_points_(num_tiles, 0) {
+        if (!utility::filesystem::DirectoryExists(directory_)) {
+            if (!utility::filesystem::MakeDirectoryHierarchy(directory_)) {
+                utility::LogError("Unable to create directory {}.",
+                                  directory_);
+            }
+            created_directory_ = true;
+        }
+    }
+    ~TileSpill() {
+        for (size_t t = 0; t < num_points_.size(); t++) {
+            if (num_points_[t] > 0) {
+                utility::filesystem::RemoveFile(GetFileName(t));
+            }
+        }
+        if (created_directory_) {
+            utility::filesystem::DeleteDirectory(directory_);
+        }
+    }
+
+public:
+    /// Adds point \p i of \p chunk to tile \p t.
+    void Add(int64_t t, const geometry::PointCloud &chunk, size_t i) {
+        std::vector<double> &buffer = buffers_[t];
+        buffer.insert(buffer.end(), chunk.points_[i].data(),
+                      chunk.points_[i].data() + 3);
+        if (has_normals_) {
+            buffer.insert(buffer.end(), chunk.normals_[i].data(),
+                          chunk.normals_[i].data() + 3);
+        }
+        if (has_colors_) {
+            buffer.insert(buffer.end(), chunk.colors_[i].data(),
+                          chunk.colors_[i].data() + 3);
+        }
+        num_points_[t]++;
+        buffered_bytes_ += record_size_ * sizeof(double);
+        if (buffered_bytes_ > max_buffered_bytes_) {
+            Flush();
+        }
+    }
+    /// Appends the buffered points to the tile files and frees the buffers.
+    void Flush() {
+        for (size_t t = 0; t < buffers_.size(); t++) {
+            std::vector<double> &buffer = buffers_[t];
+            if (buffer.empty()) {
+                continue;
+            }
+            utility::filesystem::CFile file;
+            if (!file.Open(GetFileName(t), "ab") ||
+                std::fwrite(buffer.data(), sizeof(double), buffer.size(),
+                            file.GetFILE()) != buffer.size()) {
+                utility::LogError("Unable to write {}: {}", GetFileName(t),
+                                  file.GetError());
+            }
+            std::vector<double>().swap(buffer);
+        }
+        buffered_bytes_ = 0;
+    }
+    /// Reads the points of tile \p t from its file, after Flush().
+    std::shared_ptr<geometry::PointCloud> Load(int64_t t) const {
+        auto cloud = std::make_shared<geometry::PointCloud>();
+        const int64_t num_points = num_points_[t];
+        std::vector<double> records(num_points * record_size_);
+        utility::filesystem::CFile file;
+        if (!file.Open(GetFileName(t), "rb") ||
+            file.ReadData(records.data(), records.size()) != records.size()) {
+            utility::LogError("Unable to read {}: {}", GetFileName(t),
+                              file.GetError());
+        }
+        cloud->points_.resize(num_points);
+        if (has_normals_) {
+            cloud->normals_.resize(num_points);
+        }
+        if (has_colors_) {
+            cloud->colors_.resize(num_points);
+        }
+        const double *record = records.data();
+        for (int64_t i = 0; i < num_points; i++) {
+            cloud->points_[i] =
+                    Eigen::Vector3d(record[0], record[1], record[2]);
+            record += 3;
+            if (has_normals_) {
+                cloud->normals_[i] =
+                        Eigen::Vector3d(record[0], record[1], record[2]);
+                record += 3;
+            }
+            if (has_colors_) {
+                cloud->colors_[i] =
+                        Eigen::Vector3d(record[0], record[1], record[2]);
+                record += 3;
+            }
+        }
+        return cloud;
+    }
+    int64_t NumPoints(int64_t t) const { return num_points_[t]; }
+
+private:
+    std::string GetFileName(int64_t t) const {
+        return directory_ + "tile_" + std::to_string(t) + ".bin";
+    }
+
+private:
+    std::string directory_;
+    bool created_directory_ = false;
+    bool has_normals_;
+    bool has_colors_;
+    size_t record_size_;
+    int64_t max_buffered_bytes_;
+    std::vector<std::vector<double>> buffers_;
+    std::vector<int64_t> num_points_;
+    int64_t buffered_bytes_ = 0;
+};
+
+std::unique_ptr<PointCloudStreamReader> OpenReader(
+        const std::string &filename) {
+    auto reader = CreatePointCloudStreamReader(filename);
+    if (reader == nullptr) {
+        utility::LogError("Unable to read {}.", filename);
+    }
+    return reader;
+}
+
+bool IsFinite(const Eigen::Vector3d &p) {
+    return std::isfinite(p(0)) && std::isfinite(p(1)) && std::isfinite(p(2));
+}
+
+}  // namespace
+
+namespace io {
+
+PointCloudPipeline &PointCloudPipeline::AddStage(const Stage &stage,
+                                                 double halo) {
+    if (halo < 0.0) {
+        utility::LogError("[PointCloudPipeline::AddStage] halo < 0.");
+    }
+    stages_.push_back(stage);
+    halos_.push_back(halo);
+    return *this;
+}
+
+void PointCloudPipeline::Clear() {
+    stages_.clear();
+    halos_.clear();
+}
+
+bool PointCloudPipeline::Run(const std::string &input_filename,
+                             const std::string &output_filename,
+                             const PointCloudPipelineOption &option) const {
+    try {
+        const int64_t chunk_size = std::max<int64_t>(option.chunk_size, 1);
+        double halo = 0.0;
+        for (double h : halos_) {
+            halo += h;
+        }
+
+        // First pass: the bounds of the points define the grid of tiles.
+        std::unique_ptr<PointCloudStreamReader> reader =
+                OpenReader(input_filename);
+        const bool has_normals = reader->HasNormals();
+        const bool has_colors = reader->HasColors();
+        geometry::PointCloud chunk;
+        Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+                std::numeric_limits<double>::infinity());
+        Eigen::Vector3d max_bound = -min_bound;
+        int64_t num_read;
+        while ((num_read = reader->ReadChunk(chunk, chunk_size)) > 0) {
+            for (const Eigen::Vector3d &p : chunk.points_) {
+                if (IsFinite(p)) {
+                    min_bound = min_bound.cwiseMin(p);
+                    max_bound = max_bound.cwiseMax(p);
+                }
+            }
+        }
+        if (num_read < 0) {
+            utility::LogError("Unable to read {}.", input_filename);
+        }
+        TileGrid grid;
+        grid.origin_ = min_bound;
+        grid.max_bound_ = max_bound;
+        grid.tile_size_ = option.tile_size;
+        for (int axis = 0; axis < 3; axis++) {
+            const double size = option.tile_size(axis);
+            const double extent = max_bound(axis) - min_bound(axis);
+            double n = 1.0;
+            if (size > 0.0 && extent > 0.0) {
+                n = std::max(std::ceil(extent / size), 1.0);
+            }
+            if (n > double(1 << 20)) {
+                utility::LogError("tile_size is too small.");
+            }
+            grid.num_tiles_(axis) = int(n);
+        }
+        if (grid.NumTiles() > int64_t(1) << 24) {
+            utility::LogError("tile_size is too small.");
+        }
+
+        // Second pass: spill the points into the tiles they lie in, extended
+        // by the halo.
+        std::string temp_directory = option.temp_directory;
+        if (temp_directory.empty()) {
+            temp_directory = utility::filesystem::GetFileParentDirectory(
+                                     output_filename) +
+                             utility::filesystem::GetFileNameWithoutDirectory(
+                                     output_filename) +
+                             ".tiles";
+        }
+        TileSpill spill(temp_directory, grid.NumTiles(), has_normals,
+                        has_colors, option.max_buffered_bytes);
+        reader = OpenReader(input_filename);
+        while ((num_read = reader->ReadChunk(chunk, chunk_size)) > 0) {
+            for (size_t i = 0; i < chunk.points_.size(); i++) {
+                const Eigen::Vector3d &p = chunk.points_[i];
+                if (!IsFinite(p)) {
+                    continue;
+                }
+                Eigen::Vector3i lo, hi;
+                for (int axis = 0; axis < 3; axis++) {
+                    lo(axis) = grid.Coordinate(p(axis) - halo, axis);
+                    hi(axis) = grid.Coordinate(p(axis) + halo, axis);
+                }
+                for (int tk = lo(2); tk <= hi(2); tk++) {
+                    for (int tj = lo(1); tj <= hi(1); tj++) {
+                        for (int ti = lo(0); ti <= hi(0); ti++) {
+                            spill.Add(grid.Index(ti, tj, tk), chunk, i);
+                        }
+                    }
+                }
+            }
+        }
+        if (num_read < 0) {
+            utility::LogError("Unable to read {}.", input_filename);
+        }
+        reader.reset();
+        spill.Flush();
+
+        std::vector<int64_t> tiles;
+        for (int64_t t = 0; t < grid.NumTiles(); t++) {
+            if (spill.NumPoints(t) > 0) {
+                tiles.push_back(t);
+            }
+        }
+
+        // Worker threads run the stages on the tiles while this thread
+        // writes the results in the order of the tiles.
+        const size_t max_in_flight =
+                size_t(std::max(option.max_tiles_in_flight, 1));
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::map<size_t, std::shared_ptr<geometry::PointCloud>> results;
+        size_t next_tile = 0;
+        size_t num_written_tiles = 0;
+        std::exception_ptr error;
+        bool stop = false;
+        auto process_tile = [&](int64_t t) {
+            std::shared_ptr<geometry::PointCloud> cloud = spill.Load(t);
+            const geometry::AxisAlignedBoundingBox bounds = grid.Bounds(t);
+            for (const Stage &stage : stages_) {
+                if (cloud->IsEmpty()) {
+                    break;
+                }
+                cloud = stage(*cloud, bounds);
+                if (cloud == nullptr) {
+                    utility::LogError("A stage returned no point cloud.");
+                }
+            }
+            // Keep the points of the tile, the others belong to the tiles
+            // whose halo they are in.
+            std::vector<size_t> indices;
+            indices.reserve(cloud->points_.size());
+            for (size_t i = 0; i < cloud->points_.size(); i++) {
+                if (grid.IndexOf(cloud->points_[i]) == t) {
+                    indices.push_back(i);
+                }
+            }
+            if (indices.size() < cloud->points_.size()) {
+                cloud = cloud->SelectByIndex(indices);
+            }
+            return cloud;
+        };
+        auto worker = [&]() {
+            while (true) {
+                size_t n;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&]() {
+                        return stop || next_tile >= tiles.size() ||
+                               next_tile < num_written_tiles + max_in_flight;
+                    });
+                    if (stop || next_tile >= tiles.size()) {
+                        return;
+                    }
+                    n = next_tile++;
+                }
+                std::shared_ptr<geometry::PointCloud> result;
+                try {
+                    result = process_tile(tiles[n]);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    stop = true;
+                    cv.notify_all();
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                results[n] = result;
+                cv.notify_all();
+            }
+        };
+        int num_threads = option.num_worker_threads;
+        if (num_threads <= 0) {
+            num_threads = std::max(int(std::thread::hardware_concurrency()), 1);
+        }
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; i++) {
+            threads.emplace_back(worker);
+        }
+
+        std::unique_ptr<PointCloudStreamWriter> writer;
+        int64_t num_points_written = 0;
+        try {
+            for (size_t n = 0; n < tiles.size(); n++) {
+                std::shared_ptr<geometry::PointCloud> result;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock,
+                            [&]() { return stop || results.count(n) > 0; });
+                    if (stop) {
+                        break;
+                    }
+                    result = std::move(results[n]);
+                    results.erase(n);
+                    num_written_tiles = n + 1;
+                    cv.notify_all();
+                }
+                if (result->IsEmpty()) {
+                    continue;
+                }
+                if (writer == nullptr) {
+                    writer = CreatePointCloudStreamWriter(
+                            output_filename, result->HasNormals(),
+                            result->HasColors(), option.write_option);
+                    if (writer == nullptr) {
+                        utility::LogError("Unable to write {}.",
+                                          output_filename);
+                    }
+                }
+                if (!writer->WriteChunk(*result)) {
+                    utility::LogError("Unable to write {}.", output_filename);
+                }
+                num_points_written += int64_t(result->points_.size());
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            stop = true;
+            cv.notify_all();
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        if (writer == nullptr) {
+            // No point is left, write an empty point cloud.
+            writer = CreatePointCloudStreamWriter(output_filename, has_normals,
+                                                  has_colors,
+                                                  option.write_option);
+            if (writer == nullptr) {
+                utility::LogError("Unable to write {}.", output_filename);
+            }
+        }
+        if (!writer->Close()) {
+            utility::LogError("Unable to write {}.", output_filename);
+        }
+        utility::LogDebug(
+                "Point cloud pipeline wrote {:d} points in {:d} tiles.",
+                num_points_written, tiles.size());
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Point cloud pipeline failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+PointCloudPipeline::Stage PointCloudPipeline::Crop(
+        const geometry::AxisAlignedBoundingBox &bbox) {
+    return [bbox](const geometry::PointCloud &cloud,
+                  const geometry::AxisAlignedBoundingBox &) {
+        return cloud.Crop(bbox);
+    };
+}
+
+PointCloudPipeline::Stage PointCloudPipeline::VoxelDownSample(
+        double voxel_size) {
+    return [voxel_size](const geometry::PointCloud &cloud,
+                        const geometry::AxisAlignedBoundingBox &tile) {
+        return cloud.VoxelDownSampleOnGrid(voxel_size, tile.min_bound_);
+    };
+}
+
+PointCloudPipeline::Stage PointCloudPipeline::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) {
+    return [nb_neighbors, std_ratio](
+                   const geometry::PointCloud &cloud,
+                   const geometry::AxisAlignedBoundingBox &) {
+        return std::get<0>(
+                cloud.RemoveStatisticalOutliers(nb_neighbors, std_ratio));
+    };
+}
+
+PointCloudPipeline::Stage PointCloudPipeline::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) {
+    return [nb_points, search_radius](
+                   const geometry::PointCloud &cloud,
+                   const geometry::AxisAlignedBoundingBox &) {
+        return std::get<0>(
+                cloud.RemoveRadiusOutliers(nb_points, search_radius));
+    };
+}
+
+PointCloudPipeline::Stage PointCloudPipeline::EstimateNormals(
+        const geometry::KDTreeSearchParam &search_param,
+        bool fast_normal_computation) {
+    // Copies the parameters, whose type is only known at run time.
+    std::shared_ptr<const geometry::KDTreeSearchParam> param;
+    switch (search_param.GetSearchType()) {
+        case geometry::KDTreeSearchParam::SearchType::Knn:
+            param = std::make_shared<geometry::KDTreeSearchParamKNN>(
+                    static_cast<const geometry::KDTreeSearchParamKNN &>(
+                            search_param));
+            break;
+        case geometry::KDTreeSearchParam::SearchType::Radius:
+            param = std::make_shared<geometry::KDTreeSearchParamRadius>(
+                    static_cast<const geometry::KDTreeSearchParamRadius &>(
+                            search_param));
+            break;
+        case geometry::KDTreeSearchParam::SearchType::Hybrid:
+            param = std::make_shared<geometry::KDTreeSearchParamHybrid>(
+                    static_cast<const geometry::KDTreeSearchParamHybrid &>(
+                            search_param));
+            break;
+    }
+    return [param, fast_normal_computation](
+                   const geometry::PointCloud &cloud,
+                   const geometry::AxisAlignedBoundingBox &) {
+        auto output = std::make_shared<geometry::PointCloud>(cloud);
+        output->EstimateNormals(*param, fast_normal_computation);
+        return output;
+    };
+}
+
+}  // namespace io
+}  // namespace open3d
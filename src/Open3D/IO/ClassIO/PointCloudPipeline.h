@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct PointCloudPipelineOption
+/// \brief Optional parameters to PointCloudPipeline::Run.
+struct PointCloudPipelineOption {
+    /// Size of the tiles along every axis. The points are not split along
+    /// the axes whose size is not positive.
+    Eigen::Vector3d tile_size = Eigen::Vector3d::Zero();
+    /// Number of points read from the input file at once.
+    int64_t chunk_size = 1 << 20;
+    /// Bytes of points buffered in memory before they are spilled to the tile
+    /// files.
+    int64_t max_buffered_bytes = int64_t(256) << 20;
+    /// Maximum number of tiles processed but not yet written. Together with
+    /// the tile size, it bounds the memory of the processing.
+    int max_tiles_in_flight = 8;
+    /// Number of threads processing tiles, 0 uses one per core.
+    int num_worker_threads = 0;
+    /// Directory of the tile files, created and removed by Run. An empty
+    /// string uses a directory next to the output file.
+    std::string temp_directory;
+    /// Options of the output file. Only write_ascii and compressed are used.
+    WritePointCloudOption write_option;
+};
+
+/// \class PointCloudPipeline
+///
+/// \brief Chains point cloud operations over the spatial tiles of a file that
+/// may not fit in memory, and writes the result in chunks.
+///
+/// Run() reads the input file twice. The first pass computes the bounds of
+/// the points, which define a grid of tiles of size
+/// PointCloudPipelineOption::tile_size. The second pass spills every point
+/// into the files of the tiles it lies in, extended by the sum of the halos
+/// of the stages. Worker threads then load the tiles, pass them through the
+/// stages in turn, and keep the points that lie in the tile itself, so
+/// operations that look at the neighbors of a point, e.g. outlier removal or
+/// normal estimation, see the points of the adjacent tiles within the halo.
+/// The results are written in the order of the tiles.
+///
+/// The result matches running the stages on the whole point cloud if each
+/// stage only needs the points within its halo, and does not move points
+/// across tiles. VoxelDownSample() requires tile sizes that are multiples of
+/// the voxel size, so that the voxels do not straddle tiles.
+///
+/// Example:
+/// ```cpp
+/// PointCloudPipeline pipeline;
+/// pipeline.AddStage(PointCloudPipeline::Crop(bbox));
+/// pipeline.AddStage(PointCloudPipeline::VoxelDownSample(0.05));
+/// pipeline.AddStage(PointCloudPipeline::RemoveStatisticalOutliers(20, 2.0),
+///                   0.5);
+/// pipeline.AddStage(PointCloudPipeline::EstimateNormals(
+///                           geometry::KDTreeSearchParamKNN(30)),
+///                   0.5);
+/// PointCloudPipelineOption option;
+/// option.tile_size = Eigen::Vector3d(50, 50, 0);
+/// pipeline.Run("scan.ply", "processed.ply", option);
+/// ```
+class PointCloudPipeline {
+public:
+    /// \brief Processes the points of a tile. Called by worker threads.
+    ///
+    /// The first argument holds the points of the tile and of its halo, the
+    /// second one is the tile itself, without the halo.
+    typedef std::function<std::shared_ptr<geometry::PointCloud>(
+            const geometry::PointCloud &,
+            const geometry::AxisAlignedBoundingBox &)>
+            Stage;
+
+    PointCloudPipeline() {}
+    ~PointCloudPipeline() {}
+
+public:
+    /// \brief Appends a stage to the pipeline.
+    ///
+    /// \param stage The operation to run on every tile.
+    /// \param halo Distance around a tile within which the stage needs the
+    /// points to compute the points of the tile.
+    PointCloudPipeline &AddStage(const Stage &stage, double halo = 0.0);
+    /// Removes all stages.
+    void Clear();
+    /// Returns the number of stages.
+    size_t NumStages() const { return stages_.size(); }
+
+    /// \brief Runs the stages over \p input_filename and writes the result to
+    /// \p output_filename, in the formats given by their extensions.
+    ///
+    /// \return Returns false if a file cannot be read or written, or a stage
+    /// threw. The error is logged as a warning.
+    bool Run(const std::string &input_filename,
+             const std::string &output_filename,
+             const PointCloudPipelineOption &option = {}) const;
+
+    /// Stage keeping the points within \p bbox.
+    static Stage Crop(const geometry::AxisAlignedBoundingBox &bbox);
+    /// \brief Stage averaging the points within the voxels of size
+    /// \p voxel_size.
+    ///
+    /// The voxel grid has a corner at the corner of every tile, see
+    /// geometry::PointCloud::VoxelDownSampleOnGrid.
+    static Stage VoxelDownSample(double voxel_size);
+    /// \brief Stage removing the points further away from their neighbors
+    /// than the others.
+    ///
+    /// The mean and the deviation of the distances are computed over the
+    /// points of a tile and its halo, not over the whole point cloud.
+    static Stage RemoveStatisticalOutliers(size_t nb_neighbors,
+                                           double std_ratio);
+    /// \brief Stage removing the points that have less than \p nb_points
+    /// neighbors within \p search_radius. Add it with a halo of at least
+    /// \p search_radius.
+    static Stage RemoveRadiusOutliers(size_t nb_points, double search_radius);
+    /// \brief Stage estimating the normals of the points. Add it with a halo
+    /// covering the neighborhoods of \p search_param.
+    static Stage EstimateNormals(
+            const geometry::KDTreeSearchParam &search_param =
+                    geometry::KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true);
+
+private:
+    std::vector<Stage> stages_;
+    std::vector<double> halos_;
+};
+
+}  // namespace io
+}  // namespace open3d
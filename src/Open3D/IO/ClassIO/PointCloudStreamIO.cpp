@@ -0,0 +1,481 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/TextParser.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// Streams the line-based text formats: XYZ, XYZN, XYZRGB and PTS.
+class TextPointCloudStreamReader : public PointCloudStreamReader {
+public:
+    explicit TextPointCloudStreamReader(const std::string &format)
+        : format_(format) {}
+    ~TextPointCloudStreamReader() override { Close(); }
+
+public:
+    bool Open(const std::string &filename) override {
+        Close();
+        try {
+            if (!file_.Open(filename, "r")) {
+                utility::LogWarning("Read {} failed: unable to open file: {}",
+                                    utility::ToUpper(format_), filename);
+                return false;
+            }
+            has_normals_ = format_ == "xyzn";
+            has_colors_ = format_ == "xyzrgb";
+            if (format_ == "pts" && !ReadPTSHeader()) {
+                Close();
+                return false;
+            }
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read {} failed with exception: {}",
+                                utility::ToUpper(format_), e.what());
+            Close();
+            return false;
+        }
+    }
+
+    void Close() override {
+        file_.Close();
+        num_points_ = -1;
+        num_points_read_ = 0;
+        has_normals_ = false;
+        has_colors_ = false;
+        has_pending_line_ = false;
+    }
+
+    int64_t ReadChunk(geometry::PointCloud &chunk,
+                      int64_t max_points) override {
+        chunk.points_.clear();
+        chunk.normals_.clear();
+        chunk.colors_.clear();
+        if (file_.GetFILE() == nullptr) {
+            return -1;
+        }
+        try {
+            while (int64_t(chunk.points_.size()) < max_points &&
+                   (num_points_ < 0 || num_points_read_ < num_points_)) {
+                const char *line = nullptr;
+                if (has_pending_line_) {
+                    line = pending_line_.c_str();
+                    has_pending_line_ = false;
+                } else {
+                    line = file_.ReadLine();
+                }
+                if (line == nullptr) {
+                    break;
+                }
+                if (ParseLine(line, line + strlen(line), chunk)) {
+                    num_points_read_++;
+                }
+            }
+            return int64_t(chunk.points_.size());
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read {} failed with exception: {}",
+                                utility::ToUpper(format_), e.what());
+            return -1;
+        }
+    }
+
+private:
+    // Reads the number of points and decides the layout of all points from
+    // the fields of the first one, like ReadPointCloudFromPTS().
+    bool ReadPTSHeader() {
+        const char *line = file_.ReadLine();
+        int64_t num_of_pts = 0;
+        if (line == nullptr ||
+            !utility::ParseInt(line, line + strlen(line), num_of_pts) ||
+            num_of_pts <= 0) {
+            utility::LogWarning("Read PTS failed: unable to read header.");
+            return false;
+        }
+        line = file_.ReadLine();
+        if (line == nullptr) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+        pending_line_ = line;
+        has_pending_line_ = true;
+        int num_of_fields = 0;
+        double field;
+        for (const char *end = line + strlen(line);
+             utility::ParseDouble(line, end, field);) {
+            num_of_fields++;
+        }
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+        num_points_ = num_of_pts;
+        has_colors_ = num_of_fields >= 7;
+        return true;
+    }
+
+    // Appends the point of line to chunk. Returns false if the line is not a
+    // point.
+    bool ParseLine(const char *line,
+                   const char *end,
+                   geometry::PointCloud &chunk) const {
+        Eigen::Vector3d point, normal, color;
+        if (!utility::ParseDouble(line, end, point(0)) ||
+            !utility::ParseDouble(line, end, point(1)) ||
+            !utility::ParseDouble(line, end, point(2))) {
+            if (format_ != "pts") {
+                return false;
+            }
+            // Every line of a PTS file is a point, invalid ones are zero.
+            point.setZero();
+            line = end;
+        }
+        if (format_ == "xyzn") {
+            if (!utility::ParseDouble(line, end, normal(0)) ||
+                !utility::ParseDouble(line, end, normal(1)) ||
+                !utility::ParseDouble(line, end, normal(2))) {
+                return false;
+            }
+            chunk.normals_.push_back(normal);
+        } else if (format_ == "xyzrgb") {
+            if (!utility::ParseDouble(line, end, color(0)) ||
+                !utility::ParseDouble(line, end, color(1)) ||
+                !utility::ParseDouble(line, end, color(2))) {
+                return false;
+            }
+            chunk.colors_.push_back(color);
+        } else if (format_ == "pts" && has_colors_) {
+            // X Y Z I R G B
+            int64_t i, r, g, b;
+            if (utility::ParseInt(line, end, i) &&
+                utility::ParseInt(line, end, r) &&
+                utility::ParseInt(line, end, g) &&
+                utility::ParseInt(line, end, b)) {
+                color = utility::ColorToDouble(uint8_t(r), uint8_t(g),
+                                               uint8_t(b));
+            } else {
+                point.setZero();
+                color.setZero();
+            }
+            chunk.colors_.push_back(color);
+        }
+        chunk.points_.push_back(point);
+        return true;
+    }
+
+private:
+    std::string format_;
+    utility::filesystem::CFile file_;
+    int64_t num_points_read_ = 0;
+    // The first point of a PTS file, read by ReadPTSHeader().
+    std::string pending_line_;
+    bool has_pending_line_ = false;
+};
+
+class TextPointCloudStreamWriter : public PointCloudStreamWriter {
+public:
+    explicit TextPointCloudStreamWriter(const std::string &format)
+        : format_(format) {}
+    ~TextPointCloudStreamWriter() override { Close(); }
+
+public:
+    bool Open(const std::string &filename,
+              bool has_normals,
+              bool has_colors,
+              const WritePointCloudOption &params) override {
+        Close();
+        if ((format_ == "xyzn" && !has_normals) ||
+            (format_ == "xyzrgb" && !has_colors)) {
+            utility::LogWarning(
+                    "Write {} failed: point cloud has no {}.",
+                    utility::ToUpper(format_),
+                    format_ == "xyzn" ? "normals" : "colors");
+            return false;
+        }
+        try {
+            if (!file_.Open(filename, "w")) {
+                utility::LogWarning("Write {} failed: unable to open file: {}",
+                                    utility::ToUpper(format_), filename);
+                return false;
+            }
+            filename_ = filename;
+            has_normals_ = has_normals;
+            has_colors_ = has_colors;
+            num_points_written_ = 0;
+            if (format_ == "pts") {
+                // Room for the number of points, written on Close().
+                count_position_ = file_.CurPos();
+                if (fprintf(file_.GetFILE(), "%-20d\r\n", 0) < 0) {
+                    return Fail();
+                }
+            }
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write {} failed with exception: {}",
+                                utility::ToUpper(format_), e.what());
+            file_.Close();
+            return false;
+        }
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_.GetFILE() == nullptr || !CheckChunk(chunk)) {
+            return false;
+        }
+        FILE *file = file_.GetFILE();
+        for (size_t i = 0; i < chunk.points_.size(); i++) {
+            const Eigen::Vector3d &point = chunk.points_[i];
+            int result;
+            if (format_ == "xyzn") {
+                const Eigen::Vector3d &normal = chunk.normals_[i];
+                result = fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n",
+                                 point(0), point(1), point(2), normal(0),
+                                 normal(1), normal(2));
+            } else if (format_ == "xyzrgb") {
+                const Eigen::Vector3d &color = chunk.colors_[i];
+                result = fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n",
+                                 point(0), point(1), point(2), color(0),
+                                 color(1), color(2));
+            } else if (format_ == "pts" && has_colors_) {
+                auto color = utility::ColorToUint8(chunk.colors_[i]);
+                result = fprintf(file, "%.10f %.10f %.10f %d %d %d %d\r\n",
+                                 point(0), point(1), point(2), 0,
+                                 (int)color(0), (int)color(1), (int)color(2));
+            } else {
+                result = fprintf(file,
+                                 format_ == "pts" ? "%.10f %.10f %.10f\r\n"
+                                                  : "%.10f %.10f %.10f\n",
+                                 point(0), point(1), point(2));
+            }
+            if (result < 0) {
+                return Fail();
+            }
+        }
+        num_points_written_ += int64_t(chunk.points_.size());
+        return true;
+    }
+
+    bool Close() override {
+        if (file_.GetFILE() == nullptr) {
+            return true;
+        }
+        try {
+            if (format_ == "pts" &&
+                (fseek(file_.GetFILE(), long(count_position_), SEEK_SET) != 0 ||
+                 fprintf(file_.GetFILE(), "%-20lld",
+                         (long long)num_points_written_) < 0)) {
+                return Fail();
+            }
+            file_.Close();
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write {} failed with exception: {}",
+                                utility::ToUpper(format_), e.what());
+            return false;
+        }
+    }
+
+private:
+    bool Fail() {
+        utility::LogWarning("Write {} failed: unable to write file: {}",
+                            utility::ToUpper(format_), filename_);
+        file_.Close();
+        return false;
+    }
+
+private:
+    std::string format_;
+    std::string filename_;
+    utility::filesystem::CFile file_;
+    int64_t count_position_ = 0;
+};
+
+template <class T>
+std::unique_ptr<T> MakeTextStream(const std::string &format) {
+    return std::unique_ptr<T>(new T(format));
+}
+
+static const std::unordered_map<
+        std::string,
+        std::function<std::unique_ptr<PointCloudStreamReader>()>>
+        file_extension_to_pointcloud_stream_reader{
+                {"xyz",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamReader>("xyz");
+                 }},
+                {"xyzn",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamReader>("xyzn");
+                 }},
+                {"xyzrgb",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamReader>(
+                             "xyzrgb");
+                 }},
+                {"pts",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamReader>("pts");
+                 }},
+                {"ply", CreatePointCloudStreamReaderPLY},
+                {"pcd", CreatePointCloudStreamReaderPCD},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<std::unique_ptr<PointCloudStreamWriter>()>>
+        file_extension_to_pointcloud_stream_writer{
+                {"xyz",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamWriter>("xyz");
+                 }},
+                {"xyzn",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamWriter>("xyzn");
+                 }},
+                {"xyzrgb",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamWriter>(
+                             "xyzrgb");
+                 }},
+                {"pts",
+                 [] {
+                     return MakeTextStream<TextPointCloudStreamWriter>("pts");
+                 }},
+                {"ply", CreatePointCloudStreamWriterPLY},
+                {"pcd", CreatePointCloudStreamWriterPCD},
+        };
+}  // unnamed namespace
+
+namespace io {
+
+void PointCloudStreamReader::ResizeChunk(geometry::PointCloud &chunk,
+                                         int64_t num_points) const {
+    chunk.points_.resize(num_points);
+    chunk.normals_.resize(has_normals_ ? num_points : 0);
+    chunk.colors_.resize(has_colors_ ? num_points : 0);
+}
+
+void PointCloudStreamReader::SetInMemoryPointCloud(
+        geometry::PointCloud &&pointcloud) {
+    in_memory_pointcloud_ = std::move(pointcloud);
+    in_memory_ = true;
+    in_memory_position_ = 0;
+    num_points_ = int64_t(in_memory_pointcloud_.points_.size());
+    has_normals_ = in_memory_pointcloud_.HasNormals();
+    has_colors_ = in_memory_pointcloud_.HasColors();
+}
+
+int64_t PointCloudStreamReader::ReadChunkInMemory(geometry::PointCloud &chunk,
+                                                  int64_t max_points) {
+    const int64_t begin = in_memory_position_;
+    const int64_t count = std::max<int64_t>(
+            0, std::min(max_points, num_points_ - in_memory_position_));
+    ResizeChunk(chunk, count);
+    std::copy_n(in_memory_pointcloud_.points_.begin() + begin, count,
+                chunk.points_.begin());
+    if (has_normals_) {
+        std::copy_n(in_memory_pointcloud_.normals_.begin() + begin, count,
+                    chunk.normals_.begin());
+    }
+    if (has_colors_) {
+        std::copy_n(in_memory_pointcloud_.colors_.begin() + begin, count,
+                    chunk.colors_.begin());
+    }
+    in_memory_position_ += count;
+    return count;
+}
+
+bool PointCloudStreamWriter::CheckChunk(
+        const geometry::PointCloud &chunk) const {
+    if (has_normals_ && chunk.normals_.size() != chunk.points_.size()) {
+        utility::LogWarning("Write chunk failed: the chunk has no normals.");
+        return false;
+    }
+    if (has_colors_ && chunk.colors_.size() != chunk.points_.size()) {
+        utility::LogWarning("Write chunk failed: the chunk has no colors.");
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReader(
+        const std::string &filename, const std::string &format) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    auto map_itr = file_extension_to_pointcloud_stream_reader.find(file_format);
+    if (map_itr == file_extension_to_pointcloud_stream_reader.end()) {
+        utility::LogWarning(
+                "Read geometry::PointCloud failed: unknown file extension for "
+                "{} (format: {}).",
+                filename, format);
+        return nullptr;
+    }
+    std::unique_ptr<PointCloudStreamReader> reader = map_itr->second();
+    if (!reader->Open(filename)) {
+        return nullptr;
+    }
+    return reader;
+}
+
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriter(
+        const std::string &filename,
+        bool has_normals,
+        bool has_colors,
+        const WritePointCloudOption &params) {
+    std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_pointcloud_stream_writer.find(format);
+    if (map_itr == file_extension_to_pointcloud_stream_writer.end()) {
+        utility::LogWarning(
+                "Write geometry::PointCloud failed: unknown file extension {} "
+                "for file {}.",
+                format, filename);
+        return nullptr;
+    }
+    std::unique_ptr<PointCloudStreamWriter> writer = map_itr->second();
+    if (!writer->Open(filename, has_normals, has_colors, params)) {
+        return nullptr;
+    }
+    return writer;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+
+namespace open3d {
+namespace io {
+
+/// \class PointCloudStreamReader
+///
+/// \brief Reads a point cloud file in chunks, so that files larger than the
+/// memory can be processed in a single pass.
+///
+/// Readers are created by CreatePointCloudStreamReader(). Layouts that cannot
+/// be streamed, e.g. compressed PCD files or PLY files whose vertices follow
+/// list elements, are loaded at once and then returned in chunks.
+class PointCloudStreamReader {
+public:
+    virtual ~PointCloudStreamReader() {}
+
+public:
+    /// Opens the file and reads its header.
+    virtual bool Open(const std::string &filename) = 0;
+    /// Closes the file.
+    virtual void Close() = 0;
+    /// \brief Reads the next points of the file into \p chunk.
+    ///
+    /// The points, normals and colors of \p chunk are replaced by at most
+    /// \p max_points new ones. Their memory is reused, so passing the same
+    /// chunk to every call bounds the memory used by the whole read.
+    /// \return Returns the number of points read, 0 at the end of the file,
+    /// or -1 on error.
+    virtual int64_t ReadChunk(geometry::PointCloud &chunk,
+                              int64_t max_points) = 0;
+
+    /// Returns the number of points announced by the header, or -1 if the
+    /// format does not store it, e.g. XYZ files.
+    int64_t GetNumPoints() const { return num_points_; }
+    /// Returns true if the points have normals.
+    bool HasNormals() const { return has_normals_; }
+    /// Returns true if the points have colors.
+    bool HasColors() const { return has_colors_; }
+
+protected:
+    /// Resizes the attributes of \p chunk to \p num_points points.
+    void ResizeChunk(geometry::PointCloud &chunk, int64_t num_points) const;
+    /// Loads \p pointcloud at once, for layouts that cannot be streamed.
+    void SetInMemoryPointCloud(geometry::PointCloud &&pointcloud);
+    /// Reads the next chunk of the point cloud given to
+    /// SetInMemoryPointCloud().
+    int64_t ReadChunkInMemory(geometry::PointCloud &chunk, int64_t max_points);
+
+protected:
+    int64_t num_points_ = -1;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    bool in_memory_ = false;
+    geometry::PointCloud in_memory_pointcloud_;
+    int64_t in_memory_position_ = 0;
+};
+
+/// \class PointCloudStreamWriter
+///
+/// \brief Writes a point cloud file in chunks. The number of points does not
+/// need to be known in advance: formats with a header reserve room for it and
+/// fill it in on Close().
+///
+/// Writers are created by CreatePointCloudStreamWriter().
+class PointCloudStreamWriter {
+public:
+    virtual ~PointCloudStreamWriter() {}
+
+public:
+    /// \brief Creates the file and writes its header.
+    ///
+    /// Every chunk must have normals if \p has_normals is true and colors if
+    /// \p has_colors is true. Only the \p write_ascii and \p compressed
+    /// options of \p params are used.
+    virtual bool Open(const std::string &filename,
+                      bool has_normals,
+                      bool has_colors,
+                      const WritePointCloudOption &params) = 0;
+    /// Appends the points of \p chunk to the file.
+    virtual bool WriteChunk(const geometry::PointCloud &chunk) = 0;
+    /// Completes the header with the number of points written and closes the
+    /// file.
+    virtual bool Close() = 0;
+
+    /// Returns the number of points written so far.
+    int64_t GetNumPointsWritten() const { return num_points_written_; }
+
+protected:
+    /// Checks that \p chunk has the attributes given to Open().
+    bool CheckChunk(const geometry::PointCloud &chunk) const;
+
+protected:
+    int64_t num_points_written_ = 0;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+};
+
+/// \brief Opens a point cloud file for reading in chunks.
+///
+/// \param format The format of the file, "auto" means to go off of the file
+/// extension.
+/// \return Returns nullptr if the format is unknown or the file cannot be
+/// opened.
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReader(
+        const std::string &filename, const std::string &format = "auto");
+
+/// \brief Creates a point cloud file for writing in chunks, in the format
+/// given by its extension.
+///
+/// \return Returns nullptr if the format is unknown or the file cannot be
+/// created.
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriter(
+        const std::string &filename,
+        bool has_normals,
+        bool has_colors,
+        const WritePointCloudOption &params = {});
+
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReaderPLY();
+
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriterPLY();
+
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReaderPCD();
+
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriterPCD();
+
+}  // namespace io
+}  // namespace open3d
@@ -51,5 +51,15 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const registration::PoseGraph &pose_graph);
 
+/// Reads a PoseGraph from the binary format written by WritePoseGraphToBIN.
+/// The file is memory mapped.
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph);
+
+/// Writes a PoseGraph in a compact binary format. Poses, transformations and
+/// information matrices are stored as raw doubles in host byte order.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
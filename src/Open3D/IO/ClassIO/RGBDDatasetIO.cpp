@@ -0,0 +1,322 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDDatasetIO.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// Reads the (timestamp, path) lines of a TUM image list, e.g. rgb.txt, with
+// the paths relative to the dataset directory.
+bool ReadTUMImageList(const std::string &directory,
+                      const std::string &filename,
+                      std::vector<std::pair<double, std::string>> &images) {
+    std::ifstream file(directory + filename);
+    if (!file) {
+        return false;
+    }
+    images.clear();
+    for (std::string line; std::getline(file, line);) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream iss(line);
+        iss.imbue(std::locale::classic());
+        double timestamp;
+        std::string path;
+        if (!(iss >> timestamp >> path)) {
+            utility::LogWarning("Read TUM image list {} failed: bad line {}.",
+                                filename, line);
+            return false;
+        }
+        images.emplace_back(timestamp, directory + path);
+    }
+    std::sort(images.begin(), images.end());
+    return true;
+}
+
+// Pairs every color image with the unused depth image closest in time.
+void AssociateByTimestamp(
+        const std::vector<std::pair<double, std::string>> &color_images,
+        const std::vector<std::pair<double, std::string>> &depth_images,
+        double max_time_difference,
+        std::vector<std::string> &color_files,
+        std::vector<std::string> &depth_files) {
+    std::vector<bool> depth_used(depth_images.size(), false);
+    for (const auto &color : color_images) {
+        // The closest depth image is the first one not before the color
+        // image, or the one preceding it.
+        const auto first_not_before = std::lower_bound(
+                depth_images.begin(), depth_images.end(),
+                std::make_pair(color.first, std::string()));
+        const int64_t next = first_not_before - depth_images.begin();
+        int64_t best = -1;
+        double best_difference = max_time_difference;
+        for (int64_t i = std::max<int64_t>(0, next - 1);
+             i < std::min<int64_t>(next + 1, depth_images.size()); i++) {
+            const double difference =
+                    std::abs(depth_images[i].first - color.first);
+            if (difference <= best_difference) {
+                best = i;
+                best_difference = difference;
+            }
+        }
+        if (best >= 0 && !depth_used[best]) {
+            depth_used[best] = true;
+            color_files.push_back(color.second);
+            depth_files.push_back(depth_images[best].second);
+        }
+    }
+}
+
+// Returns the sorted files of directory with one of extensions.
+std::vector<std::string> ListSortedFiles(
+        const std::string &directory,
+        std::initializer_list<const char *> extensions) {
+    std::vector<std::string> files, all_files;
+    utility::filesystem::ListFilesInDirectory(directory, all_files);
+    for (const std::string &file : all_files) {
+        const std::string extension =
+                utility::filesystem::GetFileExtensionInLowerCase(file);
+        if (std::find(extensions.begin(), extensions.end(), extension) !=
+            extensions.end()) {
+            files.push_back(file);
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadRGBDDatasetFileLists(const std::string &path,
+                              std::vector<std::string> &color_files,
+                              std::vector<std::string> &depth_files,
+                              double max_time_difference /* = 0.02*/) {
+    const std::string directory =
+            utility::filesystem::GetRegularizedDirectoryName(path);
+    color_files.clear();
+    depth_files.clear();
+    std::vector<std::pair<double, std::string>> color_images, depth_images;
+    if (utility::filesystem::FileExists(directory + "rgb.txt") &&
+        utility::filesystem::FileExists(directory + "depth.txt")) {
+        if (!ReadTUMImageList(directory, "rgb.txt", color_images) ||
+            !ReadTUMImageList(directory, "depth.txt", depth_images)) {
+            return false;
+        }
+        AssociateByTimestamp(color_images, depth_images, max_time_difference,
+                             color_files, depth_files);
+        return true;
+    }
+
+    for (const char *color_directory : {"image/", "rgb/", "color/"}) {
+        if (utility::filesystem::DirectoryExists(directory +
+                                                 color_directory)) {
+            color_files = ListSortedFiles(directory + color_directory,
+                                          {"jpg", "jpeg", "png"});
+            break;
+        }
+    }
+    depth_files = ListSortedFiles(directory + "depth/", {"png"});
+    if (color_files.empty() || color_files.size() != depth_files.size()) {
+        utility::LogWarning(
+                "Read RGBD dataset {} failed: {:d} color and {:d} depth "
+                "images found.",
+                path, color_files.size(), depth_files.size());
+        color_files.clear();
+        depth_files.clear();
+        return false;
+    }
+    return true;
+}
+
+bool RGBDDatasetReader::Open(const std::vector<std::string> &color_files,
+                             const std::vector<std::string> &depth_files,
+                             const RGBDDatasetReaderOption &option /* = {}*/) {
+    Close();
+    if (color_files.size() != depth_files.size()) {
+        utility::LogWarning(
+                "Read RGBD dataset failed: {:d} color and {:d} depth images.",
+                color_files.size(), depth_files.size());
+        return false;
+    }
+    color_files_ = color_files;
+    depth_files_ = depth_files;
+    num_frames_ = int64_t(color_files.size());
+    StartWorkers(option);
+    return true;
+}
+
+bool RGBDDatasetReader::Open(const std::string &path,
+                             const RGBDDatasetReaderOption &option /* = {}*/) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(path) == "o3drgbd") {
+        Close();
+        if (!sequence_.Open(path)) {
+            return false;
+        }
+        num_frames_ = sequence_.GetNumFrames();
+        StartWorkers(option);
+        return true;
+    }
+    std::vector<std::string> color_files, depth_files;
+    if (!ReadRGBDDatasetFileLists(path, color_files, depth_files)) {
+        Close();
+        return false;
+    }
+    return Open(color_files, depth_files, option);
+}
+
+void RGBDDatasetReader::StartWorkers(const RGBDDatasetReaderOption &option) {
+    option_ = option;
+    option_.max_prefetched_frames = std::max(1, option.max_prefetched_frames);
+    const int num_threads = std::min<int64_t>(
+            std::min(option_.num_threads > 0 ? option_.num_threads
+                                             : utility::GetNumThreads(),
+                     option_.max_prefetched_frames),
+            GetNumFrames());
+    for (int i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&RGBDDatasetReader::WorkerLoop, this);
+    }
+}
+
+void RGBDDatasetReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_returned_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    color_files_.clear();
+    depth_files_.clear();
+    sequence_.Close();
+    num_frames_ = 0;
+    decoded_frames_.clear();
+    next_frame_to_decode_ = 0;
+    next_frame_to_return_ = 0;
+    stop_ = false;
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDDatasetReader::ReadNext() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (next_frame_to_return_ >= GetNumFrames()) {
+        return nullptr;
+    }
+    const int64_t index = next_frame_to_return_;
+    frame_decoded_.wait(lock, [this, index]() {
+        return decoded_frames_.count(index) > 0;
+    });
+    auto it = decoded_frames_.find(index);
+    std::shared_ptr<geometry::RGBDImage> frame = std::move(it->second);
+    decoded_frames_.erase(it);
+    next_frame_to_return_++;
+    lock.unlock();
+    frame_returned_.notify_all();
+    return frame;
+}
+
+bool RGBDDatasetReader::HasNext() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_frame_to_return_ < GetNumFrames();
+}
+
+void RGBDDatasetReader::WorkerLoop() {
+    geometry::Image color, depth;
+    while (true) {
+        int64_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_returned_.wait(lock, [this]() {
+                return stop_ || next_frame_to_decode_ >= GetNumFrames() ||
+                       next_frame_to_decode_ - next_frame_to_return_ <
+                               option_.max_prefetched_frames;
+            });
+            if (stop_ || next_frame_to_decode_ >= GetNumFrames()) {
+                return;
+            }
+            index = next_frame_to_decode_++;
+        }
+        std::shared_ptr<geometry::RGBDImage> frame =
+                ReadFrame(index, color, depth);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            decoded_frames_[index] = std::move(frame);
+        }
+        frame_decoded_.notify_all();
+    }
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDDatasetReader::ReadFrame(
+        int64_t index, geometry::Image &color, geometry::Image &depth) const {
+    try {
+        if (sequence_.GetNumFrames() > 0) {
+            if (!sequence_.ReadFrame(index, color, depth,
+                                     option_.image_read_option)) {
+                utility::LogWarning(
+                        "Read RGBD dataset failed: unable to read frame {:d}.",
+                        index);
+                return nullptr;
+            }
+        } else if (!ReadImage(color_files_[index], color,
+                              option_.image_read_option) ||
+                   !ReadImage(depth_files_[index], depth,
+                              option_.image_read_option)) {
+            utility::LogWarning(
+                    "Read RGBD dataset failed: unable to read frame {:d} ({}, "
+                    "{}).",
+                    index, color_files_[index], depth_files_[index]);
+            return nullptr;
+        }
+        return geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, option_.depth_scale, option_.depth_trunc,
+                option_.convert_rgb_to_intensity);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read RGBD dataset failed with exception: {}",
+                            e.what());
+        return nullptr;
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Lists the color and depth images of an RGB-D dataset directory.
+///
+/// TUM datasets, with rgb.txt and depth.txt listing the timestamped images,
+/// are associated by timestamp: every color image is paired with the depth
+/// image closest in time, if less than \p max_time_difference seconds apart.
+/// Otherwise the directory follows the Redwood layout: the color images are
+/// the sorted .jpg and .png files of the image/, rgb/ or color/
+/// subdirectory, and the depth images the sorted .png files of depth/.
+/// \return return true if the directory is a dataset with as many color as
+/// depth images, false otherwise.
+bool ReadRGBDDatasetFileLists(const std::string &path,
+                              std::vector<std::string> &color_files,
+                              std::vector<std::string> &depth_files,
+                              double max_time_difference = 0.02);
+
+/// \struct RGBDDatasetReaderOption
+/// \brief Optional parameters to RGBDDatasetReader.
+struct RGBDDatasetReaderOption {
+    /// Parameters of RGBDImage::CreateFromColorAndDepth.
+    double depth_scale = 1000.0;
+    double depth_trunc = 3.0;
+    bool convert_rgb_to_intensity = true;
+    /// Decoding parameters of both the color and the depth images, e.g. to
+    /// load frames at half resolution. The camera intrinsics must be scaled
+    /// accordingly.
+    ImageReadOption image_read_option;
+    /// Number of threads decoding frames, 0 means utility::GetNumThreads().
+    int num_threads = 0;
+    /// Maximum number of frames decoded ahead of the one returned, which
+    /// bounds the memory of the reader. At least 1.
+    int max_prefetched_frames = 8;
+};
+
+/// \class RGBDDatasetReader
+///
+/// \brief Reads the frames of an RGB-D dataset in order, decoding the next
+/// frames on worker threads while the caller processes the current one.
+///
+/// Workers read the color and depth images of a frame and create its
+/// RGBDImage. At most max_prefetched_frames frames are decoded but not yet
+/// returned, so disk and decoding overlap with e.g. odometry or integration
+/// without loading the whole dataset. The frames come from image files, or
+/// from an .o3drgbd sequence file (see RGBDSequenceWriter) whose depth
+/// images decode much faster.
+///
+/// Example:
+/// ```cpp
+/// RGBDDatasetReader reader;
+/// reader.Open("dataset/");
+/// for (int64_t i = 0; reader.HasNext(); i++) {
+///     auto rgbd = reader.ReadNext();
+///     volume.Integrate(*rgbd, intrinsic,
+///                      trajectory.parameters_[i].extrinsic_);
+/// }
+/// ```
+class RGBDDatasetReader {
+public:
+    RGBDDatasetReader() {}
+    ~RGBDDatasetReader() { Close(); }
+    RGBDDatasetReader(const RGBDDatasetReader &) = delete;
+    RGBDDatasetReader &operator=(const RGBDDatasetReader &) = delete;
+
+public:
+    /// Starts reading the frames made of \p color_files and \p depth_files,
+    /// which must have the same size.
+    bool Open(const std::vector<std::string> &color_files,
+              const std::vector<std::string> &depth_files,
+              const RGBDDatasetReaderOption &option = {});
+    /// Starts reading the frames of the dataset directory \p path, listed by
+    /// ReadRGBDDatasetFileLists(), or of the .o3drgbd sequence file \p path.
+    bool Open(const std::string &path,
+              const RGBDDatasetReaderOption &option = {});
+    /// Stops the workers. Frames being decoded are finished first.
+    void Close();
+
+    /// \brief Returns the next frame, waiting until it is decoded.
+    ///
+    /// \return Returns nullptr after the last frame, or if the images of
+    /// the frame cannot be read, which is logged as a warning. HasNext()
+    /// tells the two apart.
+    std::shared_ptr<geometry::RGBDImage> ReadNext();
+    /// Returns true if ReadNext() has frames left to return.
+    bool HasNext() const;
+    /// Returns the number of frames of the dataset.
+    int64_t GetNumFrames() const { return num_frames_; }
+
+private:
+    void StartWorkers(const RGBDDatasetReaderOption &option);
+    void WorkerLoop();
+    /// Reads frame \p index, or returns nullptr on failure. \p color and
+    /// \p depth are decode buffers reused across the frames of a worker.
+    std::shared_ptr<geometry::RGBDImage> ReadFrame(
+            int64_t index,
+            geometry::Image &color,
+            geometry::Image &depth) const;
+
+private:
+    std::vector<std::string> color_files_;
+    std::vector<std::string> depth_files_;
+    /// The sequence file the frames come from, if open.
+    RGBDSequenceFile sequence_;
+    int64_t num_frames_ = 0;
+    RGBDDatasetReaderOption option_;
+
+    mutable std::mutex mutex_;
+    /// Signals workers: a frame was returned, or stop.
+    std::condition_variable frame_returned_;
+    /// Signals ReadNext(): a frame is decoded.
+    std::condition_variable frame_decoded_;
+    /// Decoded frames by index, null if they could not be read.
+    std::map<int64_t, std::shared_ptr<geometry::RGBDImage>> decoded_frames_;
+    /// Next frame to hand to a worker, and to return.
+    int64_t next_frame_to_decode_ = 0;
+    int64_t next_frame_to_return_ = 0;
+    bool stop_ = false;
+
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,292 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
+
+#include <cstring>
+#include <exception>
+
+#include "Open3D/IO/ClassIO/RGBDDatasetIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// An .o3drgbd file starts with a 16 byte header: an 8 byte magic, a uint32
+// version and a reserved uint32. The encoded color and depth images of the
+// frames follow. The index comes next, one RGBDSequenceWriter::Frame (four
+// uint64 and two uint32) per frame. The file ends with the uint64 offset of
+// the index, the uint64 number of frames and the magic again. Everything is
+// in host byte order.
+const char kSequenceMagic[8] = {'O', '3', 'D', 'R', 'G', 'B', 'D', 'S'};
+const uint32_t kSequenceVersion = 1;
+const size_t kSequenceHeaderSize = 16;
+const size_t kSequenceFooterSize = 24;
+static_assert(sizeof(RGBDSequenceWriter::Frame) == 40,
+              "Frame is written as is to the index.");
+
+const uint32_t kColorFormatPNG = 1;
+const uint32_t kColorFormatJPG = 2;
+
+uint32_t ColorFormatFromString(const std::string &format) {
+    if (format == "png") {
+        return kColorFormatPNG;
+    } else if (format == "jpg" || format == "jpeg") {
+        return kColorFormatJPG;
+    }
+    return 0;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool RGBDSequenceWriter::Open(const std::string &filename,
+                              const RGBDSequenceWriterOption &option
+                              /* = {}*/) {
+    Close();
+    if (ColorFormatFromString(option.color_format) == 0) {
+        utility::LogWarning(
+                "Write RGBD sequence failed: unsupported color format {}.",
+                option.color_format);
+        return false;
+    }
+    file_ = utility::filesystem::FOpen(filename, "wb");
+    if (file_ == nullptr) {
+        utility::LogWarning(
+                "Write RGBD sequence failed: unable to open file: {}",
+                filename);
+        return false;
+    }
+    filename_ = filename;
+    option_ = option;
+    frames_.clear();
+    offset_ = 0;
+    failed_ = false;
+    const uint32_t header[2] = {kSequenceVersion, 0};
+    return Write(kSequenceMagic, sizeof(kSequenceMagic)) &&
+           Write(header, sizeof(header));
+}
+
+bool RGBDSequenceWriter::Close() {
+    if (file_ == nullptr) {
+        return false;
+    }
+    const uint64_t footer[2] = {offset_, uint64_t(frames_.size())};
+    Write(frames_.data(), frames_.size() * sizeof(Frame));
+    Write(footer, sizeof(footer));
+    Write(kSequenceMagic, sizeof(kSequenceMagic));
+    if (fclose(file_) != 0 && !failed_) {
+        utility::LogWarning(
+                "Write RGBD sequence failed: unable to write file: {}",
+                filename_);
+        failed_ = true;
+    }
+    file_ = nullptr;
+    return !failed_;
+}
+
+bool RGBDSequenceWriter::WriteFrame(const geometry::Image &color,
+                                    const geometry::Image &depth) {
+    if (file_ == nullptr) {
+        return false;
+    }
+    if (!WriteImageToMemory(color_buffer_, option_.color_format, color,
+                            option_.color_quality)) {
+        return false;
+    }
+    return WriteFrame(color_buffer_.data(), color_buffer_.size(),
+                      option_.color_format, depth);
+}
+
+bool RGBDSequenceWriter::WriteFrame(const uint8_t *color,
+                                    size_t color_size,
+                                    const std::string &color_format,
+                                    const geometry::Image &depth) {
+    if (file_ == nullptr) {
+        return false;
+    }
+    Frame frame;
+    frame.color_format = ColorFormatFromString(color_format);
+    if (frame.color_format == 0) {
+        utility::LogWarning(
+                "Write RGBD sequence failed: unsupported color format {}.",
+                color_format);
+        return false;
+    }
+    if (!WriteImageInMemoryToRVL(depth_buffer_, depth, 0)) {
+        return false;
+    }
+    frame.color_offset = offset_;
+    frame.color_size = color_size;
+    frame.depth_offset = offset_ + color_size;
+    frame.depth_size = depth_buffer_.size();
+    if (!Write(color, color_size) ||
+        !Write(depth_buffer_.data(), depth_buffer_.size())) {
+        return false;
+    }
+    frames_.push_back(frame);
+    return true;
+}
+
+bool RGBDSequenceWriter::Write(const void *data, size_t size) {
+    if (failed_) {
+        return false;
+    }
+    if (size > 0 && fwrite(data, 1, size, file_) != size) {
+        utility::LogWarning(
+                "Write RGBD sequence failed: unable to write file: {}",
+                filename_);
+        failed_ = true;
+        return false;
+    }
+    offset_ += size;
+    return true;
+}
+
+bool RGBDSequenceFile::Open(const std::string &filename) {
+    Close();
+    if (!file_.Open(filename)) {
+        utility::LogWarning(
+                "Read RGBD sequence failed: unable to open file: {}",
+                filename);
+        return false;
+    }
+    const char *data = file_.GetData();
+    const uint64_t size = uint64_t(file_.GetSize());
+    uint64_t footer[2];
+    if (size < kSequenceHeaderSize + kSequenceFooterSize ||
+        memcmp(data, kSequenceMagic, 8) != 0 ||
+        memcmp(data + size - 8, kSequenceMagic, 8) != 0) {
+        utility::LogWarning("Read RGBD sequence failed: not a sequence file.");
+        Close();
+        return false;
+    }
+    uint32_t version;
+    memcpy(&version, data + 8, 4);
+    memcpy(footer, data + size - kSequenceFooterSize, sizeof(footer));
+    const uint64_t index_end = size - kSequenceFooterSize;
+    const uint64_t index_offset = footer[0];
+    const uint64_t num_frames = footer[1];
+    if (version != kSequenceVersion || index_offset > index_end ||
+        num_frames != (index_end - index_offset) / sizeof(Frame)) {
+        utility::LogWarning("Read RGBD sequence failed: invalid index.");
+        Close();
+        return false;
+    }
+    frames_.resize(num_frames);
+    memcpy(frames_.data(), data + index_offset, num_frames * sizeof(Frame));
+    for (const auto &frame : frames_) {
+        if (frame.color_offset > index_offset ||
+            frame.color_size > index_offset - frame.color_offset ||
+            frame.depth_offset > index_offset ||
+            frame.depth_size > index_offset - frame.depth_offset) {
+            utility::LogWarning("Read RGBD sequence failed: invalid index.");
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void RGBDSequenceFile::Close() {
+    file_.Close();
+    frames_.clear();
+}
+
+std::string RGBDSequenceFile::GetColorFormat(int64_t index) const {
+    if (index < 0 || index >= GetNumFrames()) {
+        return "";
+    }
+    return frames_[index].color_format == kColorFormatPNG ? "png" : "jpg";
+}
+
+bool RGBDSequenceFile::ReadFrame(int64_t index,
+                                 geometry::Image &color,
+                                 geometry::Image &depth,
+                                 const ImageReadOption &option
+                                 /* = {}*/) const {
+    if (index < 0 || index >= GetNumFrames()) {
+        utility::LogWarning("Read RGBD sequence failed: no frame {:d}.", index);
+        return false;
+    }
+    const Frame &frame = frames_[index];
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(file_.GetData());
+    return ReadImageFromMemory(data + frame.color_offset, frame.color_size,
+                               GetColorFormat(index), color, option) &&
+           ReadImageInMemoryFromRVL(data + frame.depth_offset,
+                                    frame.depth_size, depth, option);
+}
+
+bool WriteRGBDSequenceFromDataset(const std::string &path,
+                                  const std::string &filename,
+                                  const RGBDSequenceWriterOption &option
+                                  /* = {}*/) {
+    std::vector<std::string> color_files, depth_files;
+    if (!ReadRGBDDatasetFileLists(path, color_files, depth_files)) {
+        utility::LogWarning("Write RGBD sequence failed: {} is not a dataset.",
+                            path);
+        return false;
+    }
+    RGBDSequenceWriter writer;
+    if (!writer.Open(filename, option)) {
+        return false;
+    }
+    geometry::Image color, depth;
+    for (size_t i = 0; i < color_files.size(); i++) {
+        if (!ReadImage(depth_files[i], depth)) {
+            return false;
+        }
+        const std::string format =
+                utility::filesystem::GetFileExtensionInLowerCase(
+                        color_files[i]);
+        bool success;
+        utility::filesystem::MappedFile content;
+        if (ColorFormatFromString(format) != 0) {
+            success = content.Open(color_files[i]) &&
+                      writer.WriteFrame(reinterpret_cast<const uint8_t *>(
+                                                content.GetData()),
+                                        size_t(content.GetSize()), format,
+                                        depth);
+        } else {
+            success = ReadImage(color_files[i], color) &&
+                      writer.WriteFrame(color, depth);
+        }
+        if (!success) {
+            utility::LogWarning(
+                    "Write RGBD sequence failed: unable to write frame {:d} "
+                    "({}, {}).",
+                    i, color_files[i], depth_files[i]);
+            return false;
+        }
+    }
+    return writer.Close();
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct RGBDSequenceWriterOption
+/// \brief Optional parameters to RGBDSequenceWriter.
+struct RGBDSequenceWriterOption {
+    /// Format the color images are encoded to, "jpg" or "png".
+    std::string color_format = "jpg";
+    /// Quality of the JPG color images.
+    int color_quality = 90;
+};
+
+/// \class RGBDSequenceWriter
+///
+/// \brief Writes the frames of an RGB-D sequence to a single .o3drgbd file.
+///
+/// A sequence file stores every frame as its color image, encoded as JPG or
+/// PNG, and its depth image, losslessly compressed with RVL (see
+/// ReadImageFromRVL()). An index of the frames at the end of the file lets
+/// RGBDSequenceFile read them at random and in parallel. The file is only
+/// valid once Close() has written the index.
+class RGBDSequenceWriter {
+public:
+    RGBDSequenceWriter() {}
+    ~RGBDSequenceWriter() { Close(); }
+    RGBDSequenceWriter(const RGBDSequenceWriter &) = delete;
+    RGBDSequenceWriter &operator=(const RGBDSequenceWriter &) = delete;
+
+public:
+    /// Creates \p filename, closing any open file.
+    bool Open(const std::string &filename,
+              const RGBDSequenceWriterOption &option = {});
+    /// Writes the index of the frames and closes the file.
+    /// \return return true if the file is written successfully.
+    bool Close();
+
+    /// Appends a frame. \p depth must be a single channel, 16 bit image.
+    bool WriteFrame(const geometry::Image &color, const geometry::Image &depth);
+    /// Appends a frame whose color image is the \p color_size bytes at
+    /// \p color, already encoded as \p color_format, "jpg" or "png", e.g.
+    /// the content of an image file. They are stored as they are.
+    bool WriteFrame(const uint8_t *color,
+                    size_t color_size,
+                    const std::string &color_format,
+                    const geometry::Image &depth);
+    /// Returns the number of frames written.
+    int64_t GetNumFrames() const { return int64_t(frames_.size()); }
+
+public:
+    /// Location of the images of a frame in the file.
+    struct Frame {
+        uint64_t color_offset = 0;
+        uint64_t color_size = 0;
+        uint64_t depth_offset = 0;
+        uint64_t depth_size = 0;
+        /// Format of the color image, see RGBDSequenceFile::GetColorFormat().
+        uint32_t color_format = 0;
+        uint32_t reserved = 0;
+    };
+
+private:
+    bool Write(const void *data, size_t size);
+
+private:
+    FILE *file_ = nullptr;
+    std::string filename_;
+    RGBDSequenceWriterOption option_;
+    std::vector<Frame> frames_;
+    uint64_t offset_ = 0;
+    bool failed_ = false;
+    /// Encode buffers reused across frames.
+    std::vector<uint8_t> color_buffer_;
+    std::vector<uint8_t> depth_buffer_;
+};
+
+/// \class RGBDSequenceFile
+///
+/// \brief Reads the frames of an .o3drgbd file written by RGBDSequenceWriter.
+///
+/// The file is memory mapped, and ReadFrame() may be called concurrently, as
+/// RGBDDatasetReader does to decode frames in parallel.
+class RGBDSequenceFile {
+public:
+    RGBDSequenceFile() {}
+    RGBDSequenceFile(const RGBDSequenceFile &) = delete;
+    RGBDSequenceFile &operator=(const RGBDSequenceFile &) = delete;
+
+public:
+    /// Maps \p filename and reads its index.
+    bool Open(const std::string &filename);
+    /// Closes the file.
+    void Close();
+
+    /// Returns the number of frames.
+    int64_t GetNumFrames() const { return int64_t(frames_.size()); }
+    /// Returns the format of the color image of frame \p index, "jpg" or
+    /// "png".
+    std::string GetColorFormat(int64_t index) const;
+    /// Decodes the color and depth images of frame \p index. The buffers of
+    /// \p color and \p depth are reused.
+    bool ReadFrame(int64_t index,
+                   geometry::Image &color,
+                   geometry::Image &depth,
+                   const ImageReadOption &option = {}) const;
+
+private:
+    typedef RGBDSequenceWriter::Frame Frame;
+
+    utility::filesystem::MappedFile file_;
+    std::vector<Frame> frames_;
+};
+
+/// \brief Writes the RGB-D dataset directory \p path, see
+/// ReadRGBDDatasetFileLists(), to the sequence file \p filename. JPG and PNG
+/// color images are copied as they are, and the depth images are compressed
+/// with RVL.
+/// \return return true if all the frames are written, false otherwise.
+bool WriteRGBDSequenceFromDataset(const std::string &path,
+                                  const std::string &filename,
+                                  const RGBDSequenceWriterOption &option = {});
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/TPointCloudIO.h"
+
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+bool ReadPointCloud(const std::string &filename,
+                    tgeometry::PointCloud &pointcloud,
+                    const ReadPointCloudOption &params) {
+    std::string format = params.format;
+    if (format == "auto") {
+        format = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    // Only LAS has point attributes besides normals and colors.
+    if (format == "las" || format == "laz") {
+        return ReadPointCloudFromLAS(filename, pointcloud, params);
+    }
+
+    geometry::PointCloud legacy_pointcloud;
+    if (!ReadPointCloud(filename, legacy_pointcloud, params)) {
+        return false;
+    }
+    pointcloud = tgeometry::PointCloud::FromLegacyPointCloud(
+            legacy_pointcloud, pointcloud.GetDtype(), pointcloud.GetDevice());
+    return true;
+}
+
+bool WritePointCloud(const std::string &filename,
+                     const tgeometry::PointCloud &pointcloud,
+                     const WritePointCloudOption &params) {
+    std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (format == "las") {
+        return WritePointCloudToLAS(filename, pointcloud, params);
+    }
+    return WritePointCloud(filename, pointcloud.ToLegacyPointCloud(), params);
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/TGeometry/PointCloud.h"
+
+namespace open3d {
+namespace io {
+
+/// The general entrance for reading a tgeometry::PointCloud from a file.
+/// LAS files are read with all their common per-point fields as attributes,
+/// see ReadPointCloudFromLAS(). Other formats are read as a
+/// geometry::PointCloud and converted. The points keep the dtype and device
+/// of \p pointcloud.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadPointCloud(const std::string &filename,
+                    tgeometry::PointCloud &pointcloud,
+                    const ReadPointCloudOption &params = {});
+
+/// The general entrance for writing a tgeometry::PointCloud to a file. LAS
+/// files store the attributes that ReadPointCloudFromLAS() reads, other
+/// formats store the points, normals and colors.
+/// \return return true if the write function is successful, false otherwise.
+bool WritePointCloud(const std::string &filename,
+                     const tgeometry::PointCloud &pointcloud,
+                     const WritePointCloudOption &params = {});
+
+/// \brief Reads a LAS 1.0 to 1.4 file into a tgeometry::PointCloud.
+///
+/// Besides "points" and, for the point formats with RGB, "colors" in [0, 1],
+/// the point cloud gets the attributes "intensities" (UInt16),
+/// "classifications" (UInt8), "return_numbers" (UInt8), "number_of_returns"
+/// (UInt8), "point_source_ids" (UInt16) and, for the point formats with GPS
+/// time, "gps_times" (Float64). The scaled integer coordinates are decoded in
+/// parallel. Use a Float64 point cloud to keep the precision of
+/// georeferenced coordinates. LAZ compressed files are not supported.
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           tgeometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes a LAS 1.2 file with the attributes that ReadPointCloudFromLAS()
+/// reads. The scale of the coordinates is the power of 10 that fits the
+/// extent of the points in the 32 bit integers of LAS.
+bool WritePointCloudToLAS(const std::string &filename,
+                          const tgeometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+}  // namespace io
+}  // namespace open3d
@@ -30,6 +30,8 @@
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 
@@ -47,6 +49,7 @@ static const std::unordered_map<
                 {"off", ReadTriangleMeshFromOFF},
                 {"gltf", ReadTriangleMeshFromGLTF},
                 {"glb", ReadTriangleMeshFromGLTF},
+                {"o3dg", ReadTriangleMeshFromO3DG},
         };
 
 static const std::unordered_map<
@@ -66,6 +69,41 @@ static const std::unordered_map<
                 {"off", WriteTriangleMeshToOFF},
                 {"gltf", WriteTriangleMeshToGLTF},
                 {"glb", WriteTriangleMeshToGLTF},
+                {"o3dg", WriteTriangleMeshToO3DG},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                const uint8_t *, size_t, geometry::TriangleMesh &, bool)>>
+        format_to_trianglemesh_read_from_memory_function{
+                {"ply", ReadTriangleMeshInMemoryFromPLY},
+                {"o3dg", ReadTriangleMeshInMemoryFromO3DG},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(std::vector<uint8_t> &,
+                           const geometry::TriangleMesh &,
+                           const bool,
+                           const bool,
+                           const bool,
+                           const bool,
+                           const bool,
+                           const bool)>>
+        format_to_trianglemesh_write_to_memory_function{
+                {"ply", WriteTriangleMeshInMemoryToPLY},
+                {"o3dg", WriteTriangleMeshInMemoryToO3DG},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, TriangleMeshInfo &)>>
+        file_extension_to_trianglemesh_info_read_function{
+                {"ply", ReadTriangleMeshInfoFromPLY},
+                {"stl", ReadTriangleMeshInfoFromSTL},
+                {"off", ReadTriangleMeshInfoFromOFF},
+                {"o3dg", ReadTriangleMeshInfoFromO3DG},
         };
 
 }  // unnamed namespace
@@ -82,6 +120,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool print_progress /* = false */) {
+    utility::ProfilerScope profiler_scope("ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -102,6 +141,7 @@ bool ReadTriangleMesh(const std::string &filename,
     utility::LogDebug(
             "Read geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
             (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
+    profiler_scope.AddItems(int64_t(mesh.vertices_.size()));
     if (mesh.HasVertices() && !mesh.HasTriangles()) {
         utility::LogWarning(
                 "geometry::TriangleMesh appears to be a geometry::PointCloud "
@@ -110,6 +150,39 @@ bool ReadTriangleMesh(const std::string &filename,
     return success;
 }
 
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      const ReadTriangleMeshOption &option) {
+    if (!ReadTriangleMesh(filename, mesh, option.print_progress)) {
+        return false;
+    }
+    if (option.weld_vertices) {
+        mesh.RemoveDuplicatedVertices();
+    }
+    return true;
+}
+
+bool ReadCompactTriangleMesh(const std::string &filename,
+                             geometry::CompactTriangleMesh &mesh,
+                             bool print_progress /* = false */) {
+    utility::ProfilerScope profiler_scope("ReadCompactTriangleMesh");
+    bool success;
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "ply") {
+        success = ReadCompactTriangleMeshFromPLY(filename, mesh,
+                                                 print_progress);
+    } else {
+        geometry::TriangleMesh buffer;
+        success = ReadTriangleMesh(filename, buffer, print_progress);
+        mesh = *geometry::CompactTriangleMesh::CreateFromTriangleMesh(buffer);
+    }
+    utility::LogDebug(
+            "Read geometry::CompactTriangleMesh: {:d} triangles and {:d} "
+            "vertices.",
+            (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
+    profiler_scope.AddItems(int64_t(mesh.vertices_.size()));
+    return success;
+}
+
 bool WriteTriangleMesh(const std::string &filename,
                        const geometry::TriangleMesh &mesh,
                        bool write_ascii /* = false*/,
@@ -143,6 +216,75 @@ bool WriteTriangleMesh(const std::string &filename,
     return success;
 }
 
+bool ReadTriangleMeshFromMemory(const uint8_t *buffer,
+                                size_t length,
+                                const std::string &format,
+                                geometry::TriangleMesh &mesh,
+                                bool print_progress /* = false */) {
+    utility::ProfilerScope profiler_scope("ReadTriangleMeshFromMemory");
+    auto map_itr = format_to_trianglemesh_read_from_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_trianglemesh_read_from_memory_function.end()) {
+        utility::LogWarning(
+                "Read geometry::TriangleMesh failed: unknown format {}.",
+                format);
+        return false;
+    }
+    bool success = map_itr->second(buffer, length, mesh, print_progress);
+    utility::LogDebug(
+            "Read geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
+            (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
+    profiler_scope.AddItems(int64_t(mesh.vertices_.size()));
+    return success;
+}
+
+bool WriteTriangleMeshToMemory(std::vector<uint8_t> &buffer,
+                               const std::string &format,
+                               const geometry::TriangleMesh &mesh,
+                               bool write_ascii /* = false*/,
+                               bool compressed /* = false*/,
+                               bool write_vertex_normals /* = true*/,
+                               bool write_vertex_colors /* = true*/,
+                               bool write_triangle_uvs /* = true*/,
+                               bool print_progress /* = false*/) {
+    auto map_itr = format_to_trianglemesh_write_to_memory_function.find(
+            utility::ToLower(format));
+    if (map_itr == format_to_trianglemesh_write_to_memory_function.end()) {
+        utility::LogWarning(
+                "Write geometry::TriangleMesh failed: unknown format {}.",
+                format);
+        return false;
+    }
+    bool success = map_itr->second(buffer, mesh, write_ascii, compressed,
+                                   write_vertex_normals, write_vertex_colors,
+                                   write_triangle_uvs, print_progress);
+    utility::LogDebug(
+            "Write geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
+            (int)mesh.triangles_.size(), (int)mesh.vertices_.size());
+    return success;
+}
+
+bool ReadTriangleMeshInfo(const std::string &filename,
+                          TriangleMeshInfo &info,
+                          const std::string &format /* = "auto"*/) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    auto map_itr =
+            file_extension_to_trianglemesh_info_read_function.find(file_format);
+    if (map_itr == file_extension_to_trianglemesh_info_read_function.end()) {
+        utility::LogWarning(
+                "Read mesh info failed: unsupported file extension for {} "
+                "(format: {}).",
+                filename, format);
+        return false;
+    }
+    info = TriangleMeshInfo();
+    return map_itr->second(filename, info);
+}
+
 // Reference: https://stackoverflow.com/a/43896965
 bool IsPointInsidePolygon(const Eigen::MatrixX2d &polygon, double x, double y) {
     bool inside = false;
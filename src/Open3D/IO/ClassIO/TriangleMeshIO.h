@@ -27,8 +27,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "Open3D/Geometry/CompactTriangleMesh.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
 
 namespace open3d {
 namespace io {
@@ -45,6 +48,33 @@ bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       bool print_progress = false);
 
+/// \struct ReadTriangleMeshOption
+/// \brief Optional parameters to ReadTriangleMesh
+struct ReadTriangleMeshOption {
+    /// Merge the vertices that have identical positions after reading, e.g.
+    /// the three copies of every vertex that STL files store per triangle.
+    /// The attributes of the first copy are kept.
+    bool weld_vertices = false;
+    /// Print progress to stdout about loading progress.
+    bool print_progress = false;
+};
+
+/// The general entrance for reading a TriangleMesh from a file with
+/// ReadTriangleMeshOption.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      const ReadTriangleMeshOption &option);
+
+/// \brief The general entrance for reading a CompactTriangleMesh from a file.
+///
+/// PLY files are decoded straight into single precision storage. Other
+/// formats are read as a TriangleMesh and converted.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadCompactTriangleMesh(const std::string &filename,
+                             geometry::CompactTriangleMesh &mesh,
+                             bool print_progress = false);
+
 /// The general entrance for writing a TriangleMesh to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports binary encoding and compression, the later
@@ -61,10 +91,75 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// The general entrance for reading a TriangleMesh from the \p length bytes
+/// at \p buffer, e.g. a file received over the network, without going
+/// through the filesystem. \p format is the file extension of the content.
+/// At current "ply" and "o3dg" are supported.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTriangleMeshFromMemory(const uint8_t *buffer,
+                                size_t length,
+                                const std::string &format,
+                                geometry::TriangleMesh &mesh,
+                                bool print_progress = false);
+
+/// The general entrance for writing a TriangleMesh to memory in the format of
+/// the file extension \p format. \p buffer is replaced by the content that
+/// WriteTriangleMesh would write to a file. At current "ply" and "o3dg" are
+/// supported.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTriangleMeshToMemory(std::vector<uint8_t> &buffer,
+                               const std::string &format,
+                               const geometry::TriangleMesh &mesh,
+                               bool write_ascii = false,
+                               bool compressed = false,
+                               bool write_vertex_normals = true,
+                               bool write_vertex_colors = true,
+                               bool write_triangle_uvs = true,
+                               bool print_progress = false);
+
+/// \struct TriangleMeshInfo
+/// \brief What the header of a mesh file tells about its content, see
+/// ReadTriangleMeshInfo().
+struct TriangleMeshInfo {
+    /// Number of vertices and triangles, -1 if the header does not store
+    /// them.
+    int64_t num_vertices = -1;
+    int64_t num_triangles = -1;
+    /// Attributes of every vertex and every triangle, in the order of the
+    /// file.
+    std::vector<FileAttributeInfo> vertex_attributes;
+    std::vector<FileAttributeInfo> triangle_attributes;
+    /// Whether the mesh has the attributes that ReadTriangleMesh reads.
+    bool has_vertex_normals = false;
+    bool has_vertex_colors = false;
+    bool has_triangle_normals = false;
+    bool has_triangle_uvs = false;
+    /// Whether the file stores the bounding box of the vertices.
+    bool has_bounds = false;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+};
+
+/// The general entrance for reading the metadata of a mesh file without
+/// reading its vertices and triangles. Only the header of the file is
+/// parsed. At current "ply", "stl", "off" and "o3dg" are supported, default
+/// \p format "auto" means to go off of file extension.
+/// \return return true if the header is read successfully, false otherwise.
+bool ReadTriangleMeshInfo(const std::string &filename,
+                          TriangleMeshInfo &info,
+                          const std::string &format = "auto");
+
+bool ReadTriangleMeshInfoFromPLY(const std::string &filename,
+                                 TriangleMeshInfo &info);
+
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
 
+bool ReadCompactTriangleMeshFromPLY(const std::string &filename,
+                                    geometry::CompactTriangleMesh &mesh,
+                                    bool print_progress);
+
 bool WriteTriangleMeshToPLY(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -74,6 +169,23 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+bool ReadTriangleMeshInMemoryFromPLY(const uint8_t *buffer,
+                                     size_t length,
+                                     geometry::TriangleMesh &mesh,
+                                     bool print_progress);
+
+bool WriteTriangleMeshInMemoryToPLY(std::vector<uint8_t> &buffer,
+                                    const geometry::TriangleMesh &mesh,
+                                    bool write_ascii,
+                                    bool compressed,
+                                    bool write_vertex_normals,
+                                    bool write_vertex_colors,
+                                    bool write_triangle_uvs,
+                                    bool print_progress);
+
+bool ReadTriangleMeshInfoFromSTL(const std::string &filename,
+                                 TriangleMeshInfo &info);
+
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
@@ -100,6 +212,9 @@ bool WriteTriangleMeshToOBJ(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+bool ReadTriangleMeshInfoFromOFF(const std::string &filename,
+                                 TriangleMeshInfo &info);
+
 bool ReadTriangleMeshFromOFF(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
@@ -126,6 +241,36 @@ bool WriteTriangleMeshToGLTF(const std::string &filename,
                              bool write_triangle_uvs,
                              bool print_progress);
 
+bool ReadTriangleMeshInfoFromO3DG(const std::string &filename,
+                                  TriangleMeshInfo &info);
+
+bool ReadTriangleMeshFromO3DG(const std::string &filename,
+                              geometry::TriangleMesh &mesh,
+                              bool print_progress);
+
+bool WriteTriangleMeshToO3DG(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             bool write_ascii,
+                             bool compressed,
+                             bool write_vertex_normals,
+                             bool write_vertex_colors,
+                             bool write_triangle_uvs,
+                             bool print_progress);
+
+bool ReadTriangleMeshInMemoryFromO3DG(const uint8_t *buffer,
+                                      size_t length,
+                                      geometry::TriangleMesh &mesh,
+                                      bool print_progress);
+
+bool WriteTriangleMeshInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                     const geometry::TriangleMesh &mesh,
+                                     bool write_ascii,
+                                     bool compressed,
+                                     bool write_vertex_normals,
+                                     bool write_vertex_colors,
+                                     bool write_triangle_uvs,
+                                     bool print_progress);
+
 /// Function to convert a polygon into a collection of
 /// triangles whose vertices are only those of the polygon.
 /// Assume that the vertices are connected by edges based on their order, and
@@ -69,5 +69,15 @@ bool WriteVoxelGridToPLY(const std::string &filename,
                          bool compressed = false,
                          bool print_progress = false);
 
+bool ReadVoxelGridFromO3DG(const std::string &filename,
+                           geometry::VoxelGrid &voxelgrid,
+                           bool print_progress = false);
+
+bool WriteVoxelGridToO3DG(const std::string &filename,
+                          const geometry::VoxelGrid &voxelgrid,
+                          bool write_ascii = false,
+                          bool compressed = false,
+                          bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
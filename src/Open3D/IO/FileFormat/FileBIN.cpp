@@ -25,35 +25,129 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
 namespace {
 using namespace io;
 
-bool ReadMatrixXdFromBINFile(FILE *file, Eigen::MatrixXd &mat) {
-    uint32_t rows, cols;
-    if (fread(&rows, sizeof(uint32_t), 1, file) < 1) {
-        utility::LogWarning("Read BIN failed: unexpected EOF.");
+// The tagged BIN files start with an 8 byte magic, a uint32 version and a
+// uint32 that is zero or the scalar size, followed by uint64 counts and raw
+// arrays in host byte order. Legacy feature files have no header.
+const char kFeatureMagic[8] = {'O', '3', 'D', 'F', 'E', 'A', 'T', 'R'};
+const char kPoseGraphMagic[8] = {'O', '3', 'D', 'P', 'O', 'S', 'E', 'G'};
+const char kTrajectoryMagic[8] = {'O', '3', 'D', 'T', 'R', 'A', 'J', 'C'};
+const uint32_t kBINVersion = 1;
+
+// Sequential reader over a memory mapped BIN file.
+class BINReader {
+public:
+    bool Open(const std::string &filename) {
+        if (!file_.Open(filename)) {
+            utility::LogWarning("Read BIN failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool Read(T *data, uint64_t count) {
+        if (count > Remaining() / sizeof(T)) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        const size_t bytes = size_t(count * sizeof(T));
+        if (bytes > 0) {
+            memcpy(data, file_.GetData() + pos_, bytes);
+        }
+        pos_ += int64_t(bytes);
+        return true;
+    }
+
+    // Returns a pointer to the next count elements, which may be unaligned,
+    // and skips them. Returns nullptr at EOF.
+    template <typename T>
+    const char *Skip(uint64_t count) {
+        if (count > Remaining() / sizeof(T)) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return nullptr;
+        }
+        const char *data = file_.GetData() + pos_;
+        pos_ += int64_t(count * sizeof(T));
+        return data;
+    }
+
+    // Returns true and skips the header magic if the file starts with it.
+    bool ReadMagic(const char magic[8]) {
+        if (Remaining() < 8 ||
+            memcmp(file_.GetData() + pos_, magic, 8) != 0) {
+            return false;
+        }
+        pos_ += 8;
+        return true;
+    }
+
+    // Number of bytes left after the current position.
+    uint64_t Remaining() const { return uint64_t(file_.GetSize() - pos_); }
+
+private:
+    utility::filesystem::MappedFile file_;
+    int64_t pos_ = 0;
+};
+
+template <typename T>
+bool WriteBINArray(FILE *file, const T *data, size_t count) {
+    if (fwrite(data, sizeof(T), count, file) < count) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
         return false;
     }
-    if (fread(&cols, sizeof(uint32_t), 1, file) < 1) {
-        utility::LogWarning("Read BIN failed: unexpected EOF.");
+    return true;
+}
+
+bool WriteBINHeader(FILE *file,
+                    const char magic[8],
+                    uint32_t scalar_size,
+                    const std::vector<uint64_t> &counts) {
+    return WriteBINArray(file, magic, 8) &&
+           WriteBINArray(file, &kBINVersion, 1) &&
+           WriteBINArray(file, &scalar_size, 1) &&
+           WriteBINArray(file, counts.data(), counts.size());
+}
+
+// Reads the version and scalar size following the magic of a tagged file.
+bool ReadBINVersion(BINReader &reader, uint32_t &scalar_size) {
+    uint32_t version;
+    if (!reader.Read(&version, 1) || !reader.Read(&scalar_size, 1)) {
         return false;
     }
-    mat.resize(rows, cols);
-    if (fread(mat.data(), sizeof(double), rows * cols, file) < rows * cols) {
-        utility::LogWarning("Read BIN failed: unexpected EOF.");
+    if (version != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {:d}.",
+                            version);
         return false;
     }
     return true;
 }
 
+// Copies count fixed-size blocks of doubles from mapped memory into the
+// matrices returned by get(i).
+template <typename Func>
+void CopyBlocks(const char *src, int64_t count, size_t block, Func get) {
+    utility::ParallelFor(0, count, [&](int64_t i) {
+        memcpy(get(i), src + i * block * sizeof(double),
+               block * sizeof(double));
+    });
+}
+
 bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     uint32_t rows = (uint32_t)mat.rows();
     uint32_t cols = (uint32_t)mat.cols();
@@ -78,26 +172,242 @@ namespace io {
 
 bool ReadFeatureFromBIN(const std::string &filename,
                         registration::Feature &feature) {
-    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    BINReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    if (!reader.ReadMagic(kFeatureMagic)) {
+        // Legacy layout: uint32 rows, uint32 cols and double data.
+        uint32_t rows, cols;
+        if (!reader.Read(&rows, 1) || !reader.Read(&cols, 1)) {
+            return false;
+        }
+        if (uint64_t(rows) * cols > reader.Remaining() / sizeof(double)) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        feature.Resize(int(rows), int(cols));
+        return reader.Read(feature.data_.data(), size_t(rows) * cols);
+    }
+    uint32_t scalar_size;
+    uint64_t dim, num;
+    if (!ReadBINVersion(reader, scalar_size) || !reader.Read(&dim, 1) ||
+        !reader.Read(&num, 1)) {
+        return false;
+    }
+    if (dim > reader.Remaining() || num > reader.Remaining()) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (scalar_size == sizeof(float)) {
+        feature.Resize(int(dim), int(num), true);
+        return reader.Read(feature.data_float_.data(), dim * num);
+    } else if (scalar_size == sizeof(double)) {
+        feature.Resize(int(dim), int(num));
+        return reader.Read(feature.data_.data(), dim * num);
+    }
+    utility::LogWarning("Read BIN failed: unsupported scalar size {:d}.",
+                        scalar_size);
+    return false;
+}
+
+bool WriteFeatureToBIN(const std::string &filename,
+                       const registration::Feature &feature) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
     if (fid == NULL) {
-        utility::LogWarning("Read BIN failed: unable to open file: {}",
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
                             filename);
         return false;
     }
-    bool success = ReadMatrixXdFromBINFile(fid, feature.data_);
+    bool success;
+    if (feature.IsFloat()) {
+        const auto &data = feature.data_float_;
+        success = WriteBINHeader(fid, kFeatureMagic, sizeof(float),
+                                 {uint64_t(data.rows()),
+                                  uint64_t(data.cols())}) &&
+                  WriteBINArray(fid, data.data(), size_t(data.size()));
+    } else {
+        success = WriteMatrixXdToBINFile(fid, feature.data_);
+    }
     fclose(fid);
     return success;
 }
 
-bool WriteFeatureToBIN(const std::string &filename,
-                       const registration::Feature &feature) {
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    BINReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    uint32_t scalar_size;
+    uint64_t num_nodes, num_edges;
+    if (!reader.ReadMagic(kPoseGraphMagic)) {
+        utility::LogWarning("Read BIN failed: not a pose graph file.");
+        return false;
+    }
+    if (!ReadBINVersion(reader, scalar_size) || !reader.Read(&num_nodes, 1) ||
+        !reader.Read(&num_edges, 1)) {
+        return false;
+    }
+    if (num_nodes > reader.Remaining() || num_edges > reader.Remaining()) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    const char *poses = reader.Skip<double>(num_nodes * 16);
+    const char *transformations = reader.Skip<double>(num_edges * 16);
+    const char *informations = reader.Skip<double>(num_edges * 36);
+    const char *confidences = reader.Skip<double>(num_edges);
+    const char *node_ids = reader.Skip<int32_t>(num_edges * 2);
+    const char *uncertain = reader.Skip<uint8_t>(num_edges);
+    if (poses == nullptr || transformations == nullptr ||
+        informations == nullptr || confidences == nullptr ||
+        node_ids == nullptr || uncertain == nullptr) {
+        return false;
+    }
+
+    pose_graph.nodes_.resize(num_nodes);
+    pose_graph.edges_.resize(num_edges);
+    auto &nodes = pose_graph.nodes_;
+    auto &edges = pose_graph.edges_;
+    CopyBlocks(poses, int64_t(num_nodes), 16,
+               [&](int64_t i) { return nodes[i].pose_.data(); });
+    CopyBlocks(transformations, int64_t(num_edges), 16,
+               [&](int64_t i) { return edges[i].transformation_.data(); });
+    CopyBlocks(informations, int64_t(num_edges), 36,
+               [&](int64_t i) { return edges[i].information_.data(); });
+    utility::ParallelFor(0, int64_t(num_edges), [&](int64_t i) {
+        int32_t ids[2];
+        memcpy(ids, node_ids + i * sizeof(ids), sizeof(ids));
+        memcpy(&edges[i].confidence_, confidences + i * sizeof(double),
+               sizeof(double));
+        edges[i].source_node_id_ = ids[0];
+        edges[i].target_node_id_ = ids[1];
+        edges[i].uncertain_ = uncertain[i] != 0;
+    });
+    return true;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph) {
+    const auto &nodes = pose_graph.nodes_;
+    const auto &edges = pose_graph.edges_;
+    const int64_t num_nodes = int64_t(nodes.size());
+    const int64_t num_edges = int64_t(edges.size());
+
+    // Gather the fields into contiguous arrays, written one at a time.
+    std::vector<double> poses(num_nodes * 16);
+    std::vector<double> transformations(num_edges * 16);
+    std::vector<double> informations(num_edges * 36);
+    std::vector<double> confidences(num_edges);
+    std::vector<int32_t> node_ids(num_edges * 2);
+    std::vector<uint8_t> uncertain(num_edges);
+    utility::ParallelFor(0, num_nodes, [&](int64_t i) {
+        memcpy(&poses[i * 16], nodes[i].pose_.data(), 16 * sizeof(double));
+    });
+    utility::ParallelFor(0, num_edges, [&](int64_t i) {
+        const auto &edge = edges[i];
+        memcpy(&transformations[i * 16], edge.transformation_.data(),
+               16 * sizeof(double));
+        memcpy(&informations[i * 36], edge.information_.data(),
+               36 * sizeof(double));
+        confidences[i] = edge.confidence_;
+        node_ids[i * 2] = edge.source_node_id_;
+        node_ids[i * 2 + 1] = edge.target_node_id_;
+        uncertain[i] = edge.uncertain_ ? 1 : 0;
+    });
+
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            WriteBINHeader(fid, kPoseGraphMagic, 0,
+                           {uint64_t(num_nodes), uint64_t(num_edges)}) &&
+            WriteBINArray(fid, poses.data(), poses.size()) &&
+            WriteBINArray(fid, transformations.data(),
+                          transformations.size()) &&
+            WriteBINArray(fid, informations.data(), informations.size()) &&
+            WriteBINArray(fid, confidences.data(), confidences.size()) &&
+            WriteBINArray(fid, node_ids.data(), node_ids.size()) &&
+            WriteBINArray(fid, uncertain.data(), uncertain.size());
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    BINReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+    uint32_t scalar_size;
+    uint64_t num;
+    if (!reader.ReadMagic(kTrajectoryMagic)) {
+        utility::LogWarning("Read BIN failed: not a camera trajectory file.");
+        return false;
+    }
+    if (!ReadBINVersion(reader, scalar_size) || !reader.Read(&num, 1)) {
+        return false;
+    }
+    if (num > reader.Remaining()) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    const char *extrinsics = reader.Skip<double>(num * 16);
+    const char *intrinsics = reader.Skip<double>(num * 9);
+    const char *sizes = reader.Skip<int32_t>(num * 2);
+    if (extrinsics == nullptr || intrinsics == nullptr || sizes == nullptr) {
+        return false;
+    }
+
+    auto &parameters = trajectory.parameters_;
+    parameters.resize(num);
+    CopyBlocks(extrinsics, int64_t(num), 16,
+               [&](int64_t i) { return parameters[i].extrinsic_.data(); });
+    CopyBlocks(intrinsics, int64_t(num), 9, [&](int64_t i) {
+        return parameters[i].intrinsic_.intrinsic_matrix_.data();
+    });
+    utility::ParallelFor(0, int64_t(num), [&](int64_t i) {
+        int32_t size[2];
+        memcpy(size, sizes + i * sizeof(size), sizeof(size));
+        parameters[i].intrinsic_.width_ = size[0];
+        parameters[i].intrinsic_.height_ = size[1];
+    });
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    const auto &parameters = trajectory.parameters_;
+    const int64_t num = int64_t(parameters.size());
+    std::vector<double> extrinsics(num * 16);
+    std::vector<double> intrinsics(num * 9);
+    std::vector<int32_t> sizes(num * 2);
+    utility::ParallelFor(0, num, [&](int64_t i) {
+        memcpy(&extrinsics[i * 16], parameters[i].extrinsic_.data(),
+               16 * sizeof(double));
+        memcpy(&intrinsics[i * 9],
+               parameters[i].intrinsic_.intrinsic_matrix_.data(),
+               9 * sizeof(double));
+        sizes[i * 2] = parameters[i].intrinsic_.width_;
+        sizes[i * 2 + 1] = parameters[i].intrinsic_.height_;
+    });
+
     FILE *fid = utility::filesystem::FOpen(filename, "wb");
     if (fid == NULL) {
         utility::LogWarning("Write BIN failed: unable to open file: {}",
                             filename);
         return false;
     }
-    bool success = WriteMatrixXdToBINFile(fid, feature.data_);
+    bool success =
+            WriteBINHeader(fid, kTrajectoryMagic, 0, {uint64_t(num)}) &&
+            WriteBINArray(fid, extrinsics.data(), extrinsics.size()) &&
+            WriteBINArray(fid, intrinsics.data(), intrinsics.size()) &&
+            WriteBINArray(fid, sizes.data(), sizes.size());
     fclose(fid);
     return success;
 }
@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 
 #include <jpeglib.h>  // Include after cstddef to define size_t
 
@@ -34,69 +35,70 @@
 #include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
-namespace io {
-
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
-    struct jpeg_decompress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE *file_in;
-    JSAMPARRAY buffer;
-
-    if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
-        utility::LogWarning("Read JPG failed: unable to open file: {}",
-                            filename);
-        return false;
-    }
 
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_decompress(&cinfo);
-    jpeg_stdio_src(&cinfo, file_in);
-    jpeg_read_header(&cinfo, TRUE);
+namespace {
+using namespace io;
 
+// Returns the number of channels of the decoded image for the color space
+// of a JPG file, or 0 if it is not supported.
+int GetNumOfChannels(J_COLOR_SPACE color_space) {
     // We only support two channel types: gray, and RGB.
-    int num_of_channels = 3;
-    int bytes_per_channel = 1;
-    switch (cinfo.jpeg_color_space) {
+    switch (color_space) {
         case JCS_RGB:
         case JCS_YCbCr:
-            cinfo.out_color_space = JCS_RGB;
-            cinfo.out_color_components = 3;
-            num_of_channels = 3;
-            break;
+            return 3;
         case JCS_GRAYSCALE:
-            cinfo.jpeg_color_space = JCS_GRAYSCALE;
-            cinfo.out_color_components = 1;
-            num_of_channels = 1;
-            break;
+            return 1;
         case JCS_CMYK:
         case JCS_YCCK:
         default:
-            utility::LogWarning("Read JPG failed: color space not supported.");
-            jpeg_destroy_decompress(&cinfo);
-            fclose(file_in);
-            return false;
+            return 0;
+    }
+}
+
+// Decodes the image of cinfo, whose source has been set. Scanlines are
+// decoded directly into the buffer of image, which is reused.
+bool DecodeJPG(jpeg_decompress_struct &cinfo,
+               geometry::Image &image,
+               const ImageReadOption &option) {
+    jpeg_read_header(&cinfo, TRUE);
+
+    const int num_of_channels = GetNumOfChannels(cinfo.jpeg_color_space);
+    const int bytes_per_channel = 1;
+    if (num_of_channels == 3) {
+        cinfo.out_color_space = JCS_RGB;
+        cinfo.out_color_components = 3;
+    } else if (num_of_channels == 1) {
+        cinfo.jpeg_color_space = JCS_GRAYSCALE;
+        cinfo.out_color_components = 1;
+    } else {
+        utility::LogWarning("Read JPG failed: color space not supported.");
+        return false;
+    }
+    // The inverse DCT outputs the reduced resolution directly.
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = (unsigned int)option.scale_denominator;
+    if (option.fast_decode) {
+        cinfo.dct_method = JDCT_IFAST;
+        cinfo.do_fancy_upsampling = FALSE;
     }
     jpeg_start_decompress(&cinfo);
     image.Prepare(cinfo.output_width, cinfo.output_height, num_of_channels,
                   bytes_per_channel);
-    int row_stride = cinfo.output_width * cinfo.output_components;
-    buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
-                                        row_stride, 1);
-    uint8_t *pdata = image.data_.data();
+    const size_t row_stride = size_t(image.BytesPerLine());
+    std::vector<JSAMPROW> rows(cinfo.output_height);
+    for (JDIMENSION v = 0; v < cinfo.output_height; v++) {
+        rows[v] = image.data_.data() + v * row_stride;
+    }
     while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);
-        memcpy(pdata, buffer[0], row_stride);
-        pdata += row_stride;
+        jpeg_read_scanlines(&cinfo, rows.data() + cinfo.output_scanline,
+                            cinfo.output_height - cinfo.output_scanline);
     }
     jpeg_finish_decompress(&cinfo);
-    jpeg_destroy_decompress(&cinfo);
-    fclose(file_in);
     return true;
 }
 
-bool WriteImageToJPG(const std::string &filename,
-                     const geometry::Image &image,
-                     int quality /* = 90*/) {
+bool CheckJPGImage(const geometry::Image &image) {
     if (!image.HasData()) {
         utility::LogWarning("Write JPG failed: image has no data.");
         return false;
@@ -106,20 +108,14 @@ bool WriteImageToJPG(const std::string &filename,
         utility::LogWarning("Write JPG failed: unsupported image data.");
         return false;
     }
-    struct jpeg_compress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    FILE *file_out;
-    JSAMPROW row_pointer[1];
-
-    if ((file_out = utility::filesystem::FOpen(filename, "wb")) == NULL) {
-        utility::LogWarning("Write JPG failed: unable to open file: {}",
-                            filename);
-        return false;
-    }
+    return true;
+}
 
-    cinfo.err = jpeg_std_error(&jerr);
-    jpeg_create_compress(&cinfo);
-    jpeg_stdio_dest(&cinfo, file_out);
+// Encodes image with cinfo, whose destination has been set.
+void EncodeJPG(jpeg_compress_struct &cinfo,
+               const geometry::Image &image,
+               int quality) {
+    JSAMPROW row_pointer[1];
     cinfo.image_width = image.width_;
     cinfo.image_height = image.height_;
     cinfo.input_components = image.num_of_channels_;
@@ -138,10 +134,124 @@ bool WriteImageToJPG(const std::string &filename,
         pdata += row_stride;
     }
     jpeg_finish_compress(&cinfo);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadImageFromJPG(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option /* = {}*/) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_in;
+
+    if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file_in);
+    const bool success = DecodeJPG(cinfo, image, option);
+    jpeg_destroy_decompress(&cinfo);
+    fclose(file_in);
+    return success;
+}
+
+bool ReadImageInfoFromJPG(const std::string &filename, ImageInfo &info) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_in;
+
+    if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
+        utility::LogWarning("Read JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file_in);
+    jpeg_read_header(&cinfo, TRUE);
+    info.width = int(cinfo.image_width);
+    info.height = int(cinfo.image_height);
+    info.num_of_channels = GetNumOfChannels(cinfo.jpeg_color_space);
+    info.bytes_per_channel = 1;
+    jpeg_destroy_decompress(&cinfo);
+    fclose(file_in);
+    if (info.num_of_channels == 0) {
+        utility::LogWarning("Read JPG failed: color space not supported.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadImageInMemoryFromJPG(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option /* = {}*/) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, const_cast<unsigned char *>(buffer),
+                 (unsigned long)length);
+    const bool success = DecodeJPG(cinfo, image, option);
+    jpeg_destroy_decompress(&cinfo);
+    return success;
+}
+
+bool WriteImageToJPG(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality /* = 90*/) {
+    if (!CheckJPGImage(image)) {
+        return false;
+    }
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    FILE *file_out;
+
+    if ((file_out = utility::filesystem::FOpen(filename, "wb")) == NULL) {
+        utility::LogWarning("Write JPG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_stdio_dest(&cinfo, file_out);
+    EncodeJPG(cinfo, image, quality);
     fclose(file_out);
     jpeg_destroy_compress(&cinfo);
     return true;
 }
 
+bool WriteImageInMemoryToJPG(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality /* = 90*/) {
+    if (!CheckJPGImage(image)) {
+        return false;
+    }
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char *data = NULL;
+    unsigned long size = 0;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &data, &size);
+    EncodeJPG(cinfo, image, quality);
+    jpeg_destroy_compress(&cinfo);
+    // The destination buffer is allocated by libjpeg with malloc.
+    buffer.assign(data, data + size);
+    free(data);
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
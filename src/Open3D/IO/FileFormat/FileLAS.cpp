@@ -0,0 +1,663 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TPointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/ProgressReporters.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// LAS files start with a public header block, followed by variable length
+// records and the point records. The point records have a fixed size, so they
+// are decoded in parallel straight from the mapped file. All values are
+// little-endian.
+const int64_t kLAS12HeaderSize = 227;
+const int64_t kLAS14HeaderSize = 375;
+// Points are encoded and decoded in batches, between which progress is
+// reported.
+const int64_t kLASBatchSize = 1 << 20;
+
+/// Layout of the point data record formats 0 to 10. Offsets are -1 if the
+/// format does not store the field.
+struct LASPointFormat {
+    int64_t min_record_length;
+    int64_t gps_time_offset;
+    int64_t rgb_offset;
+    /// Formats 6 to 10 of LAS 1.4 store 4 bit return numbers and a full byte
+    /// for the classification.
+    bool extended;
+};
+
+const LASPointFormat kLASPointFormats[] = {
+        {20, -1, -1, false}, {28, 20, -1, false}, {26, -1, 20, false},
+        {34, 20, 28, false}, {57, 20, -1, false}, {63, 20, 28, false},
+        {30, 22, -1, true},  {36, 22, 30, true},  {38, 22, 30, true},
+        {59, 22, -1, true},  {67, 22, 30, true},
+};
+
+struct LASHeader {
+    int version_major = 1;
+    int version_minor = 2;
+    int64_t point_data_offset = 0;
+    int point_format = 0;
+    int64_t record_length = 0;
+    int64_t num_points = 0;
+    double scale[3] = {1, 1, 1};
+    double offset[3] = {0, 0, 0};
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+};
+
+/// Per-point arrays to decode to or encode from, nullptr to skip a field.
+/// Colors are in [0, 1].
+struct LASPointFields {
+    double *points = nullptr;
+    double *colors = nullptr;
+    uint16_t *intensities = nullptr;
+    uint8_t *classifications = nullptr;
+    uint8_t *return_numbers = nullptr;
+    uint8_t *number_of_returns = nullptr;
+    uint16_t *point_source_ids = nullptr;
+    double *gps_times = nullptr;
+};
+
+template <typename T>
+T Load(const char *data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void Store(char *data, T value) {
+    memcpy(data, &value, sizeof(T));
+}
+
+bool ParseLASHeader(const char *data, int64_t size, LASHeader &header) {
+    if (size < kLAS12HeaderSize || memcmp(data, "LASF", 4) != 0) {
+        utility::LogWarning("Read LAS failed: not a LAS file.");
+        return false;
+    }
+    header.version_major = Load<uint8_t>(data + 24);
+    header.version_minor = Load<uint8_t>(data + 25);
+    if (header.version_major != 1) {
+        utility::LogWarning("Read LAS failed: unsupported version {:d}.{:d}.",
+                            header.version_major, header.version_minor);
+        return false;
+    }
+    const int64_t header_size = Load<uint16_t>(data + 94);
+    header.point_data_offset = Load<uint32_t>(data + 96);
+    const int point_format_id = Load<uint8_t>(data + 104);
+    header.record_length = Load<uint16_t>(data + 105);
+    header.num_points = Load<uint32_t>(data + 107);
+    for (int i = 0; i < 3; i++) {
+        header.scale[i] = Load<double>(data + 131 + 8 * i);
+        header.offset[i] = Load<double>(data + 155 + 8 * i);
+        header.max_bound(i) = Load<double>(data + 179 + 16 * i);
+        header.min_bound(i) = Load<double>(data + 187 + 16 * i);
+    }
+    // LAS 1.4 stores a 64 bit point count, the legacy count is 0 for the
+    // formats it introduced.
+    if (header.version_minor >= 4 && header_size >= kLAS14HeaderSize &&
+        size >= kLAS14HeaderSize) {
+        const uint64_t num_points = Load<uint64_t>(data + 247);
+        if (num_points > 0) {
+            header.num_points = int64_t(num_points);
+        }
+    }
+
+    // LASzip sets one of the two high bits of the format id.
+    if ((point_format_id & 0xC0) != 0) {
+        utility::LogWarning(
+                "Read LAS failed: LAZ compressed points are not supported, "
+                "decompress the file with laszip first.");
+        return false;
+    }
+    header.point_format = point_format_id;
+    if (header.point_format > 10) {
+        utility::LogWarning(
+                "Read LAS failed: unsupported point data format {:d}.",
+                header.point_format);
+        return false;
+    }
+    if (header_size < kLAS12HeaderSize ||
+        header.record_length <
+                kLASPointFormats[header.point_format].min_record_length) {
+        utility::LogWarning("Read LAS failed: invalid header.");
+        return false;
+    }
+    if (size < header.point_data_offset +
+                       header.num_points * header.record_length) {
+        utility::LogWarning("Read LAS failed: not enough points.");
+        return false;
+    }
+    return true;
+}
+
+void DecodeLASPoints(const char *data,
+                     const LASHeader &header,
+                     const LASPointFields &fields,
+                     const ReadPointCloudOption &params) {
+    const LASPointFormat &format = kLASPointFormats[header.point_format];
+    const char *records = data + header.point_data_offset;
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.num_points);
+    for (int64_t begin = 0; begin < header.num_points;
+         begin += kLASBatchSize) {
+        const int64_t end = std::min(begin + kLASBatchSize, header.num_points);
+        utility::ParallelFor(begin, end, [&](int64_t i) {
+            const char *record = records + i * header.record_length;
+            if (fields.points) {
+                for (int k = 0; k < 3; k++) {
+                    fields.points[i * 3 + k] =
+                            Load<int32_t>(record + 4 * k) * header.scale[k] +
+                            header.offset[k];
+                }
+            }
+            if (fields.colors && format.rgb_offset >= 0) {
+                for (int k = 0; k < 3; k++) {
+                    fields.colors[i * 3 + k] = Load<uint16_t>(
+                            record + format.rgb_offset + 2 * k);
+                }
+            }
+            if (fields.intensities) {
+                fields.intensities[i] = Load<uint16_t>(record + 12);
+            }
+            const uint8_t returns = Load<uint8_t>(record + 14);
+            if (fields.return_numbers) {
+                fields.return_numbers[i] =
+                        format.extended ? returns & 0x0F : returns & 0x07;
+            }
+            if (fields.number_of_returns) {
+                fields.number_of_returns[i] = format.extended
+                                                      ? returns >> 4
+                                                      : (returns >> 3) & 0x07;
+            }
+            if (fields.classifications) {
+                fields.classifications[i] =
+                        format.extended ? Load<uint8_t>(record + 16)
+                                        : Load<uint8_t>(record + 15) & 0x1F;
+            }
+            if (fields.point_source_ids) {
+                fields.point_source_ids[i] =
+                        Load<uint16_t>(record + (format.extended ? 20 : 18));
+            }
+            if (fields.gps_times && format.gps_time_offset >= 0) {
+                fields.gps_times[i] =
+                        Load<double>(record + format.gps_time_offset);
+            }
+        });
+        reporter.Update(end);
+    }
+
+    // The specification asks for 16 bit colors, but many writers store 8 bit
+    // values.
+    if (fields.colors && format.rgb_offset >= 0) {
+        const int64_t num_values = header.num_points * 3;
+        const double max_value = utility::ParallelReduce(
+                int64_t(0), num_values, 0.0,
+                [&](int64_t begin, int64_t end, double value) {
+                    for (int64_t i = begin; i < end; i++) {
+                        value = std::max(value, fields.colors[i]);
+                    }
+                    return value;
+                },
+                [](double a, double b) { return std::max(a, b); });
+        const double color_scale = max_value > 255 ? 1.0 / 65535 : 1.0 / 255;
+        utility::ParallelFor(int64_t(0), num_values, [&](int64_t i) {
+            fields.colors[i] *= color_scale;
+        });
+    }
+    reporter.Finish();
+}
+
+/// Chooses a power of 10 scale per axis so that the coordinates relative to
+/// the minimum fit in an int32 with the best precision.
+void ComputeLASScaleAndOffset(int64_t num_points,
+                              const double *points,
+                              LASHeader &header) {
+    struct Bounds {
+        Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(INFINITY);
+        Eigen::Vector3d max_bound = Eigen::Vector3d::Constant(-INFINITY);
+    };
+    const Bounds bounds = utility::ParallelReduce(
+            int64_t(0), num_points, Bounds(),
+            [&](int64_t begin, int64_t end, Bounds value) {
+                for (int64_t i = begin; i < end; i++) {
+                    const Eigen::Map<const Eigen::Vector3d> point(points +
+                                                                  i * 3);
+                    value.min_bound = value.min_bound.cwiseMin(point);
+                    value.max_bound = value.max_bound.cwiseMax(point);
+                }
+                return value;
+            },
+            [](const Bounds &a, const Bounds &b) {
+                Bounds value;
+                value.min_bound = a.min_bound.cwiseMin(b.min_bound);
+                value.max_bound = a.max_bound.cwiseMax(b.max_bound);
+                return value;
+            });
+    header.min_bound = num_points > 0 ? bounds.min_bound
+                                      : Eigen::Vector3d::Zero();
+    header.max_bound = num_points > 0 ? bounds.max_bound
+                                      : Eigen::Vector3d::Zero();
+    for (int k = 0; k < 3; k++) {
+        const double extent =
+                std::max(header.max_bound(k) - header.min_bound(k), 1.0);
+        header.scale[k] = std::pow(10.0, std::ceil(std::log10(extent / 2e9)));
+        header.offset[k] = header.min_bound(k);
+    }
+}
+
+bool WriteLASBuffer(FILE *file, const std::vector<char> &buffer) {
+    if (fwrite(buffer.data(), 1, buffer.size(), file) < buffer.size()) {
+        utility::LogWarning("Write LAS failed: unable to write file.");
+        return false;
+    }
+    return true;
+}
+
+/// Writes a LAS 1.2 file with point data format 0 to 3, depending on whether
+/// there are colors and GPS times.
+bool WriteLAS(FILE *file,
+              int64_t num_points,
+              const LASPointFields &fields,
+              const WritePointCloudOption &params) {
+    if (num_points > int64_t(UINT32_MAX)) {
+        utility::LogWarning("Write LAS failed: too many points.");
+        return false;
+    }
+    LASHeader header;
+    if (fields.gps_times) {
+        header.point_format = fields.colors ? 3 : 1;
+    } else {
+        header.point_format = fields.colors ? 2 : 0;
+    }
+    const LASPointFormat &format = kLASPointFormats[header.point_format];
+    header.record_length = format.min_record_length;
+    header.num_points = num_points;
+    ComputeLASScaleAndOffset(num_points, fields.points, header);
+
+    uint32_t points_by_return[5] = {0, 0, 0, 0, 0};
+    if (fields.return_numbers) {
+        for (int64_t i = 0; i < num_points; i++) {
+            const int return_number = fields.return_numbers[i];
+            if (return_number >= 1 && return_number <= 5) {
+                points_by_return[return_number - 1]++;
+            }
+        }
+    } else {
+        points_by_return[0] = uint32_t(num_points);
+    }
+
+    std::vector<char> buffer(kLAS12HeaderSize, 0);
+    char *data = buffer.data();
+    memcpy(data, "LASF", 4);
+    Store<uint8_t>(data + 24, 1);
+    Store<uint8_t>(data + 25, 2);
+    strncpy(data + 26, "OTHER", 32);
+    strncpy(data + 58, "Open3D", 32);
+    Store<uint16_t>(data + 94, uint16_t(kLAS12HeaderSize));
+    Store<uint32_t>(data + 96, uint32_t(kLAS12HeaderSize));
+    Store<uint32_t>(data + 100, 0);
+    Store<uint8_t>(data + 104, uint8_t(header.point_format));
+    Store<uint16_t>(data + 105, uint16_t(header.record_length));
+    Store<uint32_t>(data + 107, uint32_t(num_points));
+    for (int i = 0; i < 5; i++) {
+        Store<uint32_t>(data + 111 + 4 * i, points_by_return[i]);
+    }
+    for (int k = 0; k < 3; k++) {
+        Store<double>(data + 131 + 8 * k, header.scale[k]);
+        Store<double>(data + 155 + 8 * k, header.offset[k]);
+        Store<double>(data + 179 + 16 * k, header.max_bound(k));
+        Store<double>(data + 187 + 16 * k, header.min_bound(k));
+    }
+    if (!WriteLASBuffer(file, buffer)) {
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+    for (int64_t begin = 0; begin < num_points; begin += kLASBatchSize) {
+        const int64_t end = std::min(begin + kLASBatchSize, num_points);
+        buffer.assign(size_t((end - begin) * header.record_length), 0);
+        utility::ParallelFor(begin, end, [&](int64_t i) {
+            char *record =
+                    buffer.data() + (i - begin) * header.record_length;
+            for (int k = 0; k < 3; k++) {
+                Store<int32_t>(record + 4 * k,
+                               int32_t(std::llround(
+                                       (fields.points[i * 3 + k] -
+                                        header.offset[k]) /
+                                       header.scale[k])));
+            }
+            if (fields.intensities) {
+                Store<uint16_t>(record + 12, fields.intensities[i]);
+            }
+            const int return_number =
+                    fields.return_numbers ? fields.return_numbers[i] : 1;
+            const int number_of_returns =
+                    fields.number_of_returns ? fields.number_of_returns[i] : 1;
+            Store<uint8_t>(record + 14,
+                           uint8_t((return_number & 0x07) |
+                                   ((number_of_returns & 0x07) << 3)));
+            if (fields.classifications) {
+                Store<uint8_t>(record + 15, fields.classifications[i] & 0x1F);
+            }
+            if (fields.point_source_ids) {
+                Store<uint16_t>(record + 18, fields.point_source_ids[i]);
+            }
+            if (fields.gps_times) {
+                Store<double>(record + format.gps_time_offset,
+                              fields.gps_times[i]);
+            }
+            if (fields.colors) {
+                for (int k = 0; k < 3; k++) {
+                    const double color = std::min(
+                            std::max(fields.colors[i * 3 + k], 0.0), 1.0);
+                    Store<uint16_t>(record + format.rgb_offset + 2 * k,
+                                    uint16_t(std::lround(color * 65535)));
+                }
+            }
+        });
+        if (!WriteLASBuffer(file, buffer)) {
+            return false;
+        }
+        reporter.Update(end);
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool ReadLAS(const char *data,
+             int64_t size,
+             geometry::PointCloud &pointcloud,
+             const ReadPointCloudOption &params) {
+    LASHeader header;
+    if (!ParseLASHeader(data, size, header)) {
+        return false;
+    }
+    pointcloud.Clear();
+    pointcloud.points_.resize(header.num_points);
+    LASPointFields fields;
+    fields.points = reinterpret_cast<double *>(pointcloud.points_.data());
+    if (kLASPointFormats[header.point_format].rgb_offset >= 0) {
+        pointcloud.colors_.resize(header.num_points);
+        fields.colors = reinterpret_cast<double *>(pointcloud.colors_.data());
+    }
+    DecodeLASPoints(data, header, fields, params);
+    return true;
+}
+
+bool WriteLAS(FILE *file,
+              const geometry::PointCloud &pointcloud,
+              const WritePointCloudOption &params) {
+    if (pointcloud.HasNormals()) {
+        utility::LogWarning("Write LAS can not include normals.");
+    }
+    LASPointFields fields;
+    fields.points = const_cast<double *>(
+            reinterpret_cast<const double *>(pointcloud.points_.data()));
+    if (pointcloud.HasColors()) {
+        fields.colors = const_cast<double *>(
+                reinterpret_cast<const double *>(pointcloud.colors_.data()));
+    }
+    return WriteLAS(file, int64_t(pointcloud.points_.size()), fields, params);
+}
+
+/// Returns a host copy of the attribute \p key of \p pointcloud in \p dtype,
+/// or an empty Tensor if the point cloud has no such attribute with elements
+/// of \p shape.
+Tensor GetHostPointAttr(const tgeometry::PointCloud &pointcloud,
+                        const std::string &key,
+                        const SizeVector &shape,
+                        Dtype dtype) {
+    if (!pointcloud.HasPointAttr(key) ||
+        pointcloud[key].GetShape() != shape) {
+        return Tensor();
+    }
+    return pointcloud[key].AsTensor().To(dtype).Copy(Device("CPU:0"));
+}
+
+template <typename T>
+T *GetHostDataPtr(Tensor &tensor) {
+    return tensor.NumElements() > 0 ? static_cast<T *>(tensor.GetDataPtr())
+                                    : nullptr;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+FileGeometry ReadFileGeometryTypeLAS(const std::string &path) {
+    return CONTAINS_POINTS;
+}
+
+bool ReadPointCloudInfoFromLAS(const std::string &filename,
+                               PointCloudInfo &info) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read LAS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    LASHeader header;
+    if (!ParseLASHeader(file.GetData(), file.GetSize(), header)) {
+        return false;
+    }
+    const LASPointFormat &format = kLASPointFormats[header.point_format];
+    info.num_points = header.num_points;
+    info.has_colors = format.rgb_offset >= 0;
+    info.has_normals = false;
+    info.has_bounds = true;
+    info.min_bound = header.min_bound;
+    info.max_bound = header.max_bound;
+    info.attributes.clear();
+    auto add_attribute = [&](const std::string &name, const std::string &type,
+                             int count) {
+        FileAttributeInfo attribute;
+        attribute.name = name;
+        attribute.type = type;
+        attribute.count = count;
+        info.attributes.push_back(attribute);
+    };
+    add_attribute("xyz", "int32", 3);
+    add_attribute("intensity", "uint16", 1);
+    add_attribute("returns", "uint8", format.extended ? 2 : 1);
+    add_attribute("classification", "uint8", 1);
+    if (format.extended) {
+        add_attribute("user_data", "uint8", 1);
+        add_attribute("scan_angle", "int16", 1);
+    } else {
+        add_attribute("scan_angle_rank", "int8", 1);
+        add_attribute("user_data", "uint8", 1);
+    }
+    add_attribute("point_source_id", "uint16", 1);
+    if (format.gps_time_offset >= 0) {
+        add_attribute("gps_time", "float64", 1);
+    }
+    if (format.rgb_offset >= 0) {
+        add_attribute("rgb", "uint16", 3);
+    }
+    return true;
+}
+
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read LAS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    return ReadLAS(file.GetData(), file.GetSize(), pointcloud, params);
+}
+
+bool ReadPointCloudInMemoryFromLAS(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    return ReadLAS(reinterpret_cast<const char *>(buffer), int64_t(length),
+                   pointcloud, params);
+}
+
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogWarning("Write LAS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    return WriteLAS(file.GetFILE(), pointcloud, params);
+}
+
+bool WritePointCloudInMemoryToLAS(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        !WriteLAS(file.GetFILE(), pointcloud, params) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write LAS failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           tgeometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read LAS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    LASHeader header;
+    if (!ParseLASHeader(file.GetData(), file.GetSize(), header)) {
+        return false;
+    }
+    const LASPointFormat &format = kLASPointFormats[header.point_format];
+    const int64_t n = header.num_points;
+    const Device host("CPU:0");
+    Tensor points({n, 3}, Dtype::Float64, host);
+    Tensor colors({format.rgb_offset >= 0 ? n : 0, 3}, Dtype::Float64, host);
+    Tensor intensities({n}, Dtype::UInt16, host);
+    Tensor classifications({n}, Dtype::UInt8, host);
+    Tensor return_numbers({n}, Dtype::UInt8, host);
+    Tensor number_of_returns({n}, Dtype::UInt8, host);
+    Tensor point_source_ids({n}, Dtype::UInt16, host);
+    Tensor gps_times({format.gps_time_offset >= 0 ? n : 0}, Dtype::Float64,
+                     host);
+    LASPointFields fields;
+    fields.points = GetHostDataPtr<double>(points);
+    fields.colors = GetHostDataPtr<double>(colors);
+    fields.intensities = GetHostDataPtr<uint16_t>(intensities);
+    fields.classifications = GetHostDataPtr<uint8_t>(classifications);
+    fields.return_numbers = GetHostDataPtr<uint8_t>(return_numbers);
+    fields.number_of_returns = GetHostDataPtr<uint8_t>(number_of_returns);
+    fields.point_source_ids = GetHostDataPtr<uint16_t>(point_source_ids);
+    fields.gps_times = GetHostDataPtr<double>(gps_times);
+    DecodeLASPoints(file.GetData(), header, fields, params);
+
+    // Points and colors take the dtype of the point cloud. Float64 keeps the
+    // precision of georeferenced coordinates.
+    const Dtype dtype = pointcloud.GetDtype();
+    const Device device = pointcloud.GetDevice();
+    auto to_device = [&](const Tensor &tensor) {
+        return TensorList(tensor.GetDevice() == device ? tensor
+                                                       : tensor.Copy(device));
+    };
+    pointcloud.Clear();
+    pointcloud.SetPointAttr("points", to_device(points.To(dtype)));
+    if (format.rgb_offset >= 0) {
+        pointcloud.SetPointAttr("colors", to_device(colors.To(dtype)));
+    }
+    pointcloud.SetPointAttr("intensities", to_device(intensities));
+    pointcloud.SetPointAttr("classifications", to_device(classifications));
+    pointcloud.SetPointAttr("return_numbers", to_device(return_numbers));
+    pointcloud.SetPointAttr("number_of_returns", to_device(number_of_returns));
+    pointcloud.SetPointAttr("point_source_ids", to_device(point_source_ids));
+    if (format.gps_time_offset >= 0) {
+        pointcloud.SetPointAttr("gps_times", to_device(gps_times));
+    }
+    return true;
+}
+
+bool WritePointCloudToLAS(const std::string &filename,
+                          const tgeometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    Tensor points = GetHostPointAttr(pointcloud, "points", {3}, Dtype::Float64);
+    Tensor colors = GetHostPointAttr(pointcloud, "colors", {3}, Dtype::Float64);
+    Tensor intensities =
+            GetHostPointAttr(pointcloud, "intensities", {}, Dtype::UInt16);
+    Tensor classifications =
+            GetHostPointAttr(pointcloud, "classifications", {}, Dtype::UInt8);
+    Tensor return_numbers =
+            GetHostPointAttr(pointcloud, "return_numbers", {}, Dtype::UInt8);
+    Tensor number_of_returns =
+            GetHostPointAttr(pointcloud, "number_of_returns", {}, Dtype::UInt8);
+    Tensor point_source_ids =
+            GetHostPointAttr(pointcloud, "point_source_ids", {}, Dtype::UInt16);
+    Tensor gps_times =
+            GetHostPointAttr(pointcloud, "gps_times", {}, Dtype::Float64);
+    LASPointFields fields;
+    fields.points = GetHostDataPtr<double>(points);
+    fields.colors = GetHostDataPtr<double>(colors);
+    fields.intensities = GetHostDataPtr<uint16_t>(intensities);
+    fields.classifications = GetHostDataPtr<uint8_t>(classifications);
+    fields.return_numbers = GetHostDataPtr<uint8_t>(return_numbers);
+    fields.number_of_returns = GetHostDataPtr<uint8_t>(number_of_returns);
+    fields.point_source_ids = GetHostDataPtr<uint16_t>(point_source_ids);
+    fields.gps_times = GetHostDataPtr<double>(gps_times);
+
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogWarning("Write LAS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    return WriteLAS(file.GetFILE(), pointcloud.NumPoints(), fields, params);
+}
+
+}  // namespace io
+}  // namespace open3d
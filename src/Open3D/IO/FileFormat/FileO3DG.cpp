@@ -0,0 +1,1606 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/LineSetIO.h"
+#include "Open3D/IO/ClassIO/O3DGIO.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/IO/ClassIO/VoxelGridIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/ProgressReporters.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// An O3DG file starts with a 24 byte header: an 8 byte magic, a uint32
+// version, a uint32 geometry type, a uint32 number of columns and a reserved
+// uint32. The chunks of the columns follow, each at a multiple of 8 bytes.
+// The index comes next, with for every column four uint32 (attribute,
+// encoding, components, compression) and three uint64 (number of rows, chunk
+// size, number of chunks) followed by the uint64 offset and stored size of
+// every chunk. The file ends with the uint64 offset of the index and the
+// magic again. Everything is in host byte order.
+const char kO3DGMagic[8] = {'O', '3', 'D', 'G', 'E', 'O', 'M', 'F'};
+const uint32_t kO3DGVersion = 1;
+const int64_t kO3DGHeaderSize = 24;
+const int64_t kO3DGFooterSize = 16;
+
+enum class O3DGAttribute : uint32_t {
+    Points = 1,
+    Normals = 2,
+    Colors = 3,
+    Triangles = 4,
+    TriangleNormals = 5,
+    TriangleUVs = 6,
+    TriangleMaterialIds = 7,
+    Lines = 8,
+    LineColors = 9,
+    Voxels = 10,
+    VoxelColors = 11,
+    // Origin and voxel size of a voxel grid, one row of four Float64.
+    VoxelGridInfo = 12,
+    // Minimum and maximum bound of the points, two rows of three Float64,
+    // read by ReadPointCloudInfo() and ReadTriangleMeshInfo().
+    PointBounds = 13,
+    // Origin and size of an octree, then its maximum depth, two rows of four
+    // Float64.
+    OctreeInfo = 14,
+    // The internal nodes of an octree in breadth-first order, two UInt8 per
+    // node: the mask of its children and the mask of the children that are
+    // leaves. Bit i stands for children_[i].
+    OctreeNodes = 15,
+    // Colors of the leaves of an octree, in the breadth-first order of their
+    // parents and then of children_.
+    OctreeLeafColors = 16,
+};
+
+enum class O3DGEncoding : uint32_t {
+    Float64 = 1,
+    Float32 = 2,
+    // uint16 over [offset, offset + 65535 * scale], with the offset and
+    // scale of every component stored as doubles at the start of the chunk.
+    Quantized16 = 3,
+    // Unit vectors as two int16 with the octahedral encoding.
+    Oct16 = 4,
+    // Colors in [0, 1] as uint8.
+    Color8 = 5,
+    Int32 = 6,
+    // Integers in [0, 255] as uint8.
+    UInt8 = 7,
+};
+
+enum class O3DGCompression : uint32_t { None = 0, LZF = 1 };
+
+int64_t GetRowSize(O3DGEncoding encoding, int64_t components) {
+    switch (encoding) {
+        case O3DGEncoding::Float64:
+            return 8 * components;
+        case O3DGEncoding::Float32:
+        case O3DGEncoding::Int32:
+            return 4 * components;
+        case O3DGEncoding::Quantized16:
+            return 2 * components;
+        case O3DGEncoding::Oct16:
+            return 4;
+        case O3DGEncoding::Color8:
+        case O3DGEncoding::UInt8:
+            return components;
+    }
+    return 0;
+}
+
+int64_t GetChunkPrefixSize(O3DGEncoding encoding, int64_t components) {
+    return encoding == O3DGEncoding::Quantized16 ? 16 * components : 0;
+}
+
+int64_t GetNumChunkRows(const O3DGFile::Column &column, int64_t chunk) {
+    return std::min(column.chunk_size,
+                    column.num_rows - chunk * column.chunk_size);
+}
+
+int64_t GetRawChunkSize(const O3DGFile::Column &column, int64_t rows) {
+    const O3DGEncoding encoding = O3DGEncoding(column.encoding);
+    return GetChunkPrefixSize(encoding, column.components) +
+           rows * GetRowSize(encoding, column.components);
+}
+
+// Number of rows per chunk when not given, which makes about a hundred
+// chunks to decode in parallel and to report progress on.
+int64_t GetChunkSize(int64_t num_rows, int64_t chunk_size) {
+    if (chunk_size > 0) {
+        return chunk_size;
+    }
+    return std::max<int64_t>(1000,
+                             std::min<int64_t>(1 << 16, num_rows / 100));
+}
+
+// Number of chunks processed in parallel between two progress updates: one
+// per thread, but small enough for about ten updates per column.
+int64_t GetBatchSize(int64_t num_chunks) {
+    return std::max<int64_t>(
+            1, std::min<int64_t>(utility::GetNumThreads(), num_chunks / 10));
+}
+
+void OctEncode(const double *n, int16_t *out) {
+    const double l1 = std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]);
+    if (l1 == 0) {
+        out[0] = out[1] = 0;
+        return;
+    }
+    double u = n[0] / l1, v = n[1] / l1;
+    if (n[2] < 0) {
+        const double folded_u = (1 - std::abs(v)) * (u >= 0 ? 1 : -1);
+        v = (1 - std::abs(u)) * (v >= 0 ? 1 : -1);
+        u = folded_u;
+    }
+    out[0] = int16_t(std::round(std::min(1., std::max(-1., u)) * 32767));
+    out[1] = int16_t(std::round(std::min(1., std::max(-1., v)) * 32767));
+}
+
+void OctDecode(const int16_t *in, double *n) {
+    double u = in[0] / 32767.0, v = in[1] / 32767.0;
+    const double w = 1 - std::abs(u) - std::abs(v);
+    if (w < 0) {
+        const double unfolded_u = (1 - std::abs(v)) * (u >= 0 ? 1 : -1);
+        v = (1 - std::abs(u)) * (v >= 0 ? 1 : -1);
+        u = unfolded_u;
+    }
+    const double norm = std::sqrt(u * u + v * v + w * w);
+    n[0] = u / norm;
+    n[1] = v / norm;
+    n[2] = w / norm;
+}
+
+// An attribute to write: num_rows rows of components doubles or ints,
+// contiguous in memory like std::vector<Eigen::Vector3d>.
+struct O3DGColumnSource {
+    O3DGAttribute attribute;
+    O3DGEncoding encoding;
+    int64_t components;
+    int64_t num_rows;
+    const double *doubles;
+    const int *ints;
+};
+
+template <typename T, typename A>
+O3DGColumnSource MakeColumnSource(O3DGAttribute attribute,
+                                  O3DGEncoding encoding,
+                                  const std::vector<T, A> &rows) {
+    static_assert(sizeof(T) % sizeof(typename T::Scalar) == 0,
+                  "Rows must be contiguous.");
+    const int64_t components = int64_t(sizeof(T) / sizeof(typename T::Scalar));
+    O3DGColumnSource source{attribute, encoding,   components,
+                            int64_t(rows.size()), nullptr, nullptr};
+    if (encoding == O3DGEncoding::Int32 || encoding == O3DGEncoding::UInt8) {
+        source.ints = reinterpret_cast<const int *>(rows.data());
+    } else {
+        source.doubles = reinterpret_cast<const double *>(rows.data());
+    }
+    return source;
+}
+
+// Encodes rows [begin, end) of source into dst, which has room for the raw
+// chunk.
+void EncodeChunk(const O3DGColumnSource &source,
+                 int64_t begin,
+                 int64_t end,
+                 uint8_t *dst) {
+    const int64_t c = source.components;
+    const int64_t count = (end - begin) * c;
+    const double *src = source.doubles + begin * c;
+    switch (source.encoding) {
+        case O3DGEncoding::Float64:
+            memcpy(dst, src, count * sizeof(double));
+            break;
+        case O3DGEncoding::Float32:
+            for (int64_t i = 0; i < count; ++i) {
+                const float value = float(src[i]);
+                memcpy(dst + i * sizeof(float), &value, sizeof(float));
+            }
+            break;
+        case O3DGEncoding::Quantized16: {
+            std::vector<double> offset(c, 0.0), scale(c, 0.0);
+            for (int64_t k = 0; k < c && end > begin; ++k) {
+                double min_value = src[k], max_value = src[k];
+                for (int64_t i = k; i < count; i += c) {
+                    min_value = std::min(min_value, src[i]);
+                    max_value = std::max(max_value, src[i]);
+                }
+                offset[k] = min_value;
+                scale[k] = (max_value - min_value) / 65535.0;
+            }
+            memcpy(dst, offset.data(), c * sizeof(double));
+            memcpy(dst + c * sizeof(double), scale.data(), c * sizeof(double));
+            dst += 2 * c * sizeof(double);
+            for (int64_t i = 0; i < count; ++i) {
+                const int64_t k = i % c;
+                const uint16_t value =
+                        scale[k] > 0 ? uint16_t(std::round(
+                                               (src[i] - offset[k]) / scale[k]))
+                                     : 0;
+                memcpy(dst + i * sizeof(uint16_t), &value, sizeof(uint16_t));
+            }
+            break;
+        }
+        case O3DGEncoding::Oct16:
+            for (int64_t i = 0; i < end - begin; ++i) {
+                int16_t value[2];
+                OctEncode(src + i * 3, value);
+                memcpy(dst + i * sizeof(value), value, sizeof(value));
+            }
+            break;
+        case O3DGEncoding::Color8:
+            for (int64_t i = 0; i < count; ++i) {
+                dst[i] = uint8_t(
+                        std::round(std::min(1., std::max(0., src[i])) * 255.));
+            }
+            break;
+        case O3DGEncoding::Int32:
+            memcpy(dst, source.ints + begin * c, count * sizeof(int));
+            break;
+        case O3DGEncoding::UInt8:
+            for (int64_t i = 0; i < count; ++i) {
+                dst[i] = uint8_t(source.ints[begin * c + i]);
+            }
+            break;
+    }
+}
+
+// Decodes the rows of a raw chunk into dst, num_rows * components doubles.
+void DecodeChunk(const O3DGFile::Column &column,
+                 const char *src,
+                 int64_t num_rows,
+                 double *dst) {
+    const int64_t c = column.components;
+    const int64_t count = num_rows * c;
+    switch (O3DGEncoding(column.encoding)) {
+        case O3DGEncoding::Float64:
+            memcpy(dst, src, count * sizeof(double));
+            break;
+        case O3DGEncoding::Float32:
+            for (int64_t i = 0; i < count; ++i) {
+                float value;
+                memcpy(&value, src + i * sizeof(float), sizeof(float));
+                dst[i] = value;
+            }
+            break;
+        case O3DGEncoding::Quantized16: {
+            std::vector<double> offset(c), scale(c);
+            memcpy(offset.data(), src, c * sizeof(double));
+            memcpy(scale.data(), src + c * sizeof(double), c * sizeof(double));
+            src += 2 * c * sizeof(double);
+            for (int64_t i = 0; i < count; ++i) {
+                uint16_t value;
+                memcpy(&value, src + i * sizeof(uint16_t), sizeof(uint16_t));
+                dst[i] = offset[i % c] + value * scale[i % c];
+            }
+            break;
+        }
+        case O3DGEncoding::Oct16:
+            for (int64_t i = 0; i < num_rows; ++i) {
+                int16_t value[2];
+                memcpy(value, src + i * sizeof(value), sizeof(value));
+                OctDecode(value, dst + i * 3);
+            }
+            break;
+        case O3DGEncoding::Color8:
+            for (int64_t i = 0; i < count; ++i) {
+                dst[i] = uint8_t(src[i]) / 255.0;
+            }
+            break;
+        case O3DGEncoding::Int32:
+        case O3DGEncoding::UInt8:
+            break;
+    }
+}
+
+void DecodeChunk(const O3DGFile::Column &column,
+                 const char *src,
+                 int64_t num_rows,
+                 int *dst) {
+    const int64_t count = num_rows * column.components;
+    if (O3DGEncoding(column.encoding) == O3DGEncoding::UInt8) {
+        for (int64_t i = 0; i < count; ++i) {
+            dst[i] = uint8_t(src[i]);
+        }
+    } else {
+        memcpy(dst, src, count * sizeof(int));
+    }
+}
+
+// Returns the raw content of a chunk, decompressed into scratch if needed, or
+// nullptr if the chunk is corrupted. Chunks that LZF could not shrink are
+// stored as is.
+const char *GetRawChunk(const char *data,
+                        const O3DGFile::Column &column,
+                        int64_t chunk,
+                        std::vector<char> &scratch) {
+    const int64_t raw_size =
+            GetRawChunkSize(column, GetNumChunkRows(column, chunk));
+    const char *stored = data + column.chunk_offsets[chunk];
+    const uint64_t stored_size = column.chunk_sizes[chunk];
+    if (stored_size == uint64_t(raw_size)) {
+        return stored;
+    }
+    scratch.resize(raw_size);
+    if (O3DGCompression(column.compression) != O3DGCompression::LZF ||
+        lzf_decompress(stored, (unsigned int)stored_size, scratch.data(),
+                       (unsigned int)raw_size) != (unsigned int)raw_size) {
+        return nullptr;
+    }
+    return scratch.data();
+}
+
+// Checks that column can be decoded into rows of components values, of
+// doubles or ints.
+bool CheckColumn(const O3DGFile::Column &column,
+                 int64_t components,
+                 bool is_int) {
+    const O3DGEncoding encoding = O3DGEncoding(column.encoding);
+    const bool valid =
+            column.components == components &&
+            column.encoding >= uint32_t(O3DGEncoding::Float64) &&
+            column.encoding <= uint32_t(O3DGEncoding::UInt8) &&
+            (is_int ? encoding == O3DGEncoding::Int32 ||
+                              encoding == O3DGEncoding::UInt8
+                    : encoding != O3DGEncoding::Int32 &&
+                              encoding != O3DGEncoding::UInt8 &&
+                              (encoding != O3DGEncoding::Oct16 ||
+                               components == 3));
+    if (!valid) {
+        utility::LogWarning(
+                "Read O3DG failed: unsupported encoding {:d} of attribute "
+                "{:d}.",
+                column.encoding, column.attribute);
+    }
+    return valid;
+}
+
+// Decodes all chunks of column into dst, which has room for all rows, a batch
+// of chunks in parallel at a time. rows_read counts the rows for reporter.
+template <typename T>
+bool DecodeColumn(const char *data,
+                  const O3DGFile::Column &column,
+                  T *dst,
+                  utility::CountingProgressReporter &reporter,
+                  int64_t &rows_read) {
+    const int64_t num_chunks = int64_t(column.chunk_offsets.size());
+    const int64_t batch_size = GetBatchSize(num_chunks);
+    for (int64_t batch = 0; batch < num_chunks; batch += batch_size) {
+        const int64_t batch_end = std::min(num_chunks, batch + batch_size);
+        std::vector<uint8_t> chunk_ok(batch_end - batch, 1);
+        utility::ParallelFor(batch, batch_end, [&](int64_t chunk) {
+            std::vector<char> scratch;
+            const char *raw = GetRawChunk(data, column, chunk, scratch);
+            if (raw == nullptr) {
+                chunk_ok[chunk - batch] = 0;
+                return;
+            }
+            DecodeChunk(column, raw, GetNumChunkRows(column, chunk),
+                        dst + chunk * column.chunk_size * column.components);
+        });
+        if (std::find(chunk_ok.begin(), chunk_ok.end(), 0) != chunk_ok.end()) {
+            utility::LogWarning("Read O3DG failed: corrupted chunk.");
+            return false;
+        }
+        rows_read += std::min(column.num_rows, batch_end * column.chunk_size) -
+                     batch * column.chunk_size;
+        reporter.Update(rows_read);
+    }
+    return true;
+}
+
+// Reads column into rows, or clears rows if there is no column.
+template <typename T, typename A>
+bool ReadColumn(const char *data,
+                const O3DGFile::Column *column,
+                std::vector<T, A> &rows,
+                utility::CountingProgressReporter &reporter,
+                int64_t &rows_read) {
+    using Scalar = typename T::Scalar;
+    if (column == nullptr) {
+        rows.clear();
+        return true;
+    }
+    if (!CheckColumn(*column, int64_t(sizeof(T) / sizeof(Scalar)),
+                     std::is_same<Scalar, int>::value)) {
+        return false;
+    }
+    rows.resize(column->num_rows);
+    return DecodeColumn(data, *column, reinterpret_cast<Scalar *>(rows.data()),
+                        reporter, rows_read);
+}
+
+// Sums the rows of columns for the progress reporter.
+int64_t CountRows(std::initializer_list<const O3DGFile::Column *> columns) {
+    int64_t total = 0;
+    for (const auto *column : columns) {
+        total += column != nullptr ? column->num_rows : 0;
+    }
+    return total;
+}
+
+class O3DGWriter {
+public:
+    explicit O3DGWriter(FILE *file) : file_(file) {}
+
+    bool Write(const void *data, size_t size) {
+        if (size > 0 && fwrite(data, 1, size, file_) < size) {
+            utility::LogWarning("Write O3DG failed: unexpected error.");
+            return false;
+        }
+        position_ += size;
+        return true;
+    }
+
+    // Pads the file with zeros to a multiple of 8 bytes.
+    bool Align() {
+        const uint64_t zeros = 0;
+        return Write(&zeros, size_t((8 - position_ % 8) % 8));
+    }
+
+    uint64_t GetPosition() const { return position_; }
+
+private:
+    FILE *file_;
+    uint64_t position_ = 0;
+};
+
+bool WriteO3DG(FILE *file,
+               geometry::Geometry::GeometryType type,
+               const std::vector<O3DGColumnSource> &sources,
+               const WriteO3DGOption &option) {
+    O3DGWriter writer(file);
+    const uint32_t header[4] = {kO3DGVersion, uint32_t(type),
+                                uint32_t(sources.size()), 0};
+    if (!writer.Write(kO3DGMagic, 8) || !writer.Write(header, 16)) {
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(option.update_progress);
+    int64_t total_rows = 0, rows_written = 0;
+    for (const auto &source : sources) {
+        total_rows += source.num_rows;
+    }
+    reporter.SetTotal(total_rows);
+    std::vector<O3DGFile::Column> columns(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        const O3DGColumnSource &source = sources[i];
+        O3DGFile::Column &column = columns[i];
+        column.attribute = uint32_t(source.attribute);
+        column.encoding = uint32_t(source.encoding);
+        column.components = uint32_t(source.components);
+        column.compression = uint32_t(option.compressed
+                                              ? O3DGCompression::LZF
+                                              : O3DGCompression::None);
+        column.num_rows = source.num_rows;
+        column.chunk_size = GetChunkSize(source.num_rows, option.chunk_size);
+        const int64_t num_chunks =
+                (column.num_rows + column.chunk_size - 1) / column.chunk_size;
+
+        // Encode and compress a few chunks in parallel, then write them in
+        // order.
+        const int64_t batch_size = GetBatchSize(num_chunks);
+        for (int64_t batch = 0; batch < num_chunks; batch += batch_size) {
+            const int64_t batch_end = std::min(num_chunks, batch + batch_size);
+            std::vector<std::vector<uint8_t>> stored(batch_end - batch);
+            utility::ParallelFor(batch, batch_end, [&](int64_t chunk) {
+                const int64_t begin = chunk * column.chunk_size;
+                const int64_t rows = GetNumChunkRows(column, chunk);
+                const int64_t raw_size = GetRawChunkSize(column, rows);
+                std::vector<uint8_t> &buffer = stored[chunk - batch];
+                buffer.resize(raw_size);
+                EncodeChunk(source, begin, begin + rows, buffer.data());
+                if (option.compressed && raw_size > 1) {
+                    std::vector<uint8_t> compressed(raw_size - 1);
+                    const unsigned int compressed_size = lzf_compress(
+                            buffer.data(), (unsigned int)raw_size,
+                            compressed.data(), (unsigned int)(raw_size - 1));
+                    if (compressed_size > 0) {
+                        compressed.resize(compressed_size);
+                        buffer.swap(compressed);
+                    }
+                }
+            });
+            for (const auto &buffer : stored) {
+                if (!writer.Align()) {
+                    return false;
+                }
+                column.chunk_offsets.push_back(writer.GetPosition());
+                column.chunk_sizes.push_back(buffer.size());
+                if (!writer.Write(buffer.data(), buffer.size())) {
+                    return false;
+                }
+            }
+            rows_written += std::min(column.num_rows,
+                                     batch_end * column.chunk_size) -
+                            batch * column.chunk_size;
+            reporter.Update(rows_written);
+        }
+    }
+
+    if (!writer.Align()) {
+        return false;
+    }
+    const uint64_t index_offset = writer.GetPosition();
+    for (const auto &column : columns) {
+        const uint32_t info[4] = {column.attribute, column.encoding,
+                                  column.components, column.compression};
+        const uint64_t sizes[3] = {uint64_t(column.num_rows),
+                                   uint64_t(column.chunk_size),
+                                   uint64_t(column.chunk_offsets.size())};
+        if (!writer.Write(info, sizeof(info)) ||
+            !writer.Write(sizes, sizeof(sizes))) {
+            return false;
+        }
+        for (size_t chunk = 0; chunk < column.chunk_offsets.size(); ++chunk) {
+            const uint64_t entry[2] = {column.chunk_offsets[chunk],
+                                       column.chunk_sizes[chunk]};
+            if (!writer.Write(entry, sizeof(entry))) {
+                return false;
+            }
+        }
+    }
+    if (!writer.Write(&index_offset, sizeof(index_offset)) ||
+        !writer.Write(kO3DGMagic, 8)) {
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+O3DGEncoding GetPositionEncoding(const WriteO3DGOption &option) {
+    switch (option.position_encoding) {
+        case WriteO3DGOption::PositionEncoding::Float64:
+            return O3DGEncoding::Float64;
+        case WriteO3DGOption::PositionEncoding::Quantized16:
+            return O3DGEncoding::Quantized16;
+        default:
+            return O3DGEncoding::Float32;
+    }
+}
+
+O3DGEncoding GetNormalEncoding(const WriteO3DGOption &option) {
+    return option.oct_encode_normals ? O3DGEncoding::Oct16
+                                     : O3DGEncoding::Float32;
+}
+
+// Gathers the data of a geometry that is not stored contiguously, i.e. the
+// bounds of the points, the voxels of a voxel grid and the nodes of an
+// octree.
+struct O3DGDerivedData {
+    std::vector<Eigen::Vector3d> bounds;
+    std::vector<Eigen::Vector3i> indices;
+    std::vector<Eigen::Vector3d> colors;
+    std::vector<Eigen::Vector4d> info;
+    std::vector<Eigen::Vector2i> masks;
+};
+
+// Lists the internal nodes of octree in breadth-first order with the masks
+// of their children, and the colors of the leaves. Returns false if the
+// octree has leaves other than OctreeColorLeafNode.
+bool EncodeOctree(const geometry::Octree &octree,
+                  std::vector<Eigen::Vector2i> &masks,
+                  std::vector<Eigen::Vector3d> &colors) {
+    auto add_leaf = [&colors](const geometry::OctreeNode &node) {
+        auto leaf = dynamic_cast<const geometry::OctreeColorLeafNode *>(&node);
+        if (leaf == nullptr) {
+            utility::LogWarning(
+                    "Write O3DG failed: unsupported octree leaf node.");
+            return false;
+        }
+        colors.push_back(leaf->color_);
+        return true;
+    };
+    if (octree.root_node_ == nullptr) {
+        return true;
+    }
+    auto root = dynamic_cast<const geometry::OctreeInternalNode *>(
+            octree.root_node_.get());
+    if (root == nullptr) {
+        return add_leaf(*octree.root_node_);
+    }
+    std::vector<const geometry::OctreeInternalNode *> nodes = {root};
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        Eigen::Vector2i mask(0, 0);
+        for (size_t c = 0; c < 8; ++c) {
+            const geometry::OctreeNode *child = nodes[i]->children_[c].get();
+            if (child == nullptr) {
+                continue;
+            }
+            mask(0) |= 1 << c;
+            auto internal =
+                    dynamic_cast<const geometry::OctreeInternalNode *>(child);
+            if (internal != nullptr) {
+                nodes.push_back(internal);
+            } else if (add_leaf(*child)) {
+                mask(1) |= 1 << c;
+            } else {
+                return false;
+            }
+        }
+        masks.push_back(mask);
+    }
+    return true;
+}
+
+// Rebuilds the nodes of octree from the output of EncodeOctree(). Returns
+// false if they do not form a tree.
+bool DecodeOctree(const std::vector<Eigen::Vector2i> &masks,
+                  const std::vector<Eigen::Vector3d> &colors,
+                  geometry::Octree &octree) {
+    size_t num_leaves = 0;
+    auto make_leaf = [&]() {
+        auto leaf = std::make_shared<geometry::OctreeColorLeafNode>();
+        leaf->color_ = colors[num_leaves++];
+        return leaf;
+    };
+    if (masks.empty()) {
+        if (colors.size() > 1) {
+            return false;
+        }
+        octree.root_node_ = colors.empty() ? nullptr : make_leaf();
+        return true;
+    }
+    std::vector<std::shared_ptr<geometry::OctreeInternalNode>> nodes;
+    nodes.reserve(masks.size());
+    nodes.push_back(std::make_shared<geometry::OctreeInternalNode>());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const int children = masks[i](0);
+        const int leaves = masks[i](1);
+        if ((leaves & ~children) != 0) {
+            return false;
+        }
+        for (size_t c = 0; c < 8; ++c) {
+            if ((children & (1 << c)) == 0) {
+                continue;
+            }
+            if ((leaves & (1 << c)) != 0) {
+                if (num_leaves == colors.size()) {
+                    return false;
+                }
+                nodes[i]->children_[c] = make_leaf();
+            } else {
+                if (nodes.size() == masks.size()) {
+                    return false;
+                }
+                nodes.push_back(
+                        std::make_shared<geometry::OctreeInternalNode>());
+                nodes[i]->children_[c] = nodes.back();
+            }
+        }
+    }
+    if (nodes.size() != masks.size() || num_leaves != colors.size()) {
+        return false;
+    }
+    octree.root_node_ = nodes[0];
+    return true;
+}
+
+// Adds the bounds of the points of geometry to sources, unless it is empty.
+void AddBoundsSource(const geometry::Geometry3D &geometry,
+                     O3DGDerivedData &derived_data,
+                     std::vector<O3DGColumnSource> &sources) {
+    if (geometry.IsEmpty()) {
+        return;
+    }
+    derived_data.bounds = {geometry.GetMinBound(), geometry.GetMaxBound()};
+    sources.push_back(MakeColumnSource(O3DGAttribute::PointBounds,
+                                       O3DGEncoding::Float64,
+                                       derived_data.bounds));
+}
+
+// Lists the columns of geometry. Returns false if the geometry type is not
+// supported.
+bool GetColumnSources(const geometry::Geometry &geometry,
+                      const WriteO3DGOption &option,
+                      bool write_normals,
+                      bool write_colors,
+                      bool write_uvs,
+                      O3DGDerivedData &derived_data,
+                      std::vector<O3DGColumnSource> &sources) {
+    switch (geometry.GetGeometryType()) {
+        case geometry::Geometry::GeometryType::PointCloud: {
+            const auto &pointcloud =
+                    static_cast<const geometry::PointCloud &>(geometry);
+            sources.push_back(MakeColumnSource(O3DGAttribute::Points,
+                                               GetPositionEncoding(option),
+                                               pointcloud.points_));
+            AddBoundsSource(pointcloud, derived_data, sources);
+            if (pointcloud.HasNormals()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::Normals,
+                                                   GetNormalEncoding(option),
+                                                   pointcloud.normals_));
+            }
+            if (pointcloud.HasColors()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::Colors,
+                                                   O3DGEncoding::Color8,
+                                                   pointcloud.colors_));
+            }
+            return true;
+        }
+        case geometry::Geometry::GeometryType::TriangleMesh: {
+            const auto &mesh =
+                    static_cast<const geometry::TriangleMesh &>(geometry);
+            sources.push_back(MakeColumnSource(O3DGAttribute::Points,
+                                               GetPositionEncoding(option),
+                                               mesh.vertices_));
+            AddBoundsSource(mesh, derived_data, sources);
+            if (write_normals && mesh.HasVertexNormals()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::Normals,
+                                                   GetNormalEncoding(option),
+                                                   mesh.vertex_normals_));
+            }
+            if (write_colors && mesh.HasVertexColors()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::Colors,
+                                                   O3DGEncoding::Color8,
+                                                   mesh.vertex_colors_));
+            }
+            sources.push_back(MakeColumnSource(O3DGAttribute::Triangles,
+                                               O3DGEncoding::Int32,
+                                               mesh.triangles_));
+            if (write_normals && mesh.HasTriangleNormals()) {
+                sources.push_back(MakeColumnSource(
+                        O3DGAttribute::TriangleNormals,
+                        GetNormalEncoding(option), mesh.triangle_normals_));
+            }
+            if (write_uvs && mesh.HasTriangleUvs()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::TriangleUVs,
+                                                   O3DGEncoding::Float32,
+                                                   mesh.triangle_uvs_));
+            }
+            if (mesh.triangle_material_ids_.size() == mesh.triangles_.size() &&
+                mesh.HasTriangles()) {
+                O3DGColumnSource source{O3DGAttribute::TriangleMaterialIds,
+                                        O3DGEncoding::Int32,
+                                        1,
+                                        int64_t(mesh.triangles_.size()),
+                                        nullptr,
+                                        mesh.triangle_material_ids_.data()};
+                sources.push_back(source);
+            }
+            return true;
+        }
+        case geometry::Geometry::GeometryType::LineSet: {
+            const auto &lineset =
+                    static_cast<const geometry::LineSet &>(geometry);
+            sources.push_back(MakeColumnSource(O3DGAttribute::Points,
+                                               GetPositionEncoding(option),
+                                               lineset.points_));
+            AddBoundsSource(lineset, derived_data, sources);
+            sources.push_back(MakeColumnSource(
+                    O3DGAttribute::Lines, O3DGEncoding::Int32, lineset.lines_));
+            if (lineset.HasColors()) {
+                sources.push_back(MakeColumnSource(O3DGAttribute::LineColors,
+                                                   O3DGEncoding::Color8,
+                                                   lineset.colors_));
+            }
+            return true;
+        }
+        case geometry::Geometry::GeometryType::VoxelGrid: {
+            const auto &voxelgrid =
+                    static_cast<const geometry::VoxelGrid &>(geometry);
+            derived_data.indices.reserve(voxelgrid.voxels_.size());
+            derived_data.colors.reserve(voxelgrid.voxels_.size());
+            for (const auto &it : voxelgrid.voxels_) {
+                derived_data.indices.push_back(it.second.grid_index_);
+                derived_data.colors.push_back(it.second.color_);
+            }
+            derived_data.info.push_back(Eigen::Vector4d(
+                    voxelgrid.origin_(0), voxelgrid.origin_(1),
+                    voxelgrid.origin_(2), voxelgrid.voxel_size_));
+            sources.push_back(MakeColumnSource(O3DGAttribute::VoxelGridInfo,
+                                               O3DGEncoding::Float64,
+                                               derived_data.info));
+            sources.push_back(MakeColumnSource(O3DGAttribute::Voxels,
+                                               O3DGEncoding::Int32,
+                                               derived_data.indices));
+            sources.push_back(MakeColumnSource(O3DGAttribute::VoxelColors,
+                                               O3DGEncoding::Color8,
+                                               derived_data.colors));
+            return true;
+        }
+        case geometry::Geometry::GeometryType::Octree: {
+            const auto &octree =
+                    static_cast<const geometry::Octree &>(geometry);
+            if (!EncodeOctree(octree, derived_data.masks,
+                              derived_data.colors)) {
+                return false;
+            }
+            derived_data.info.push_back(
+                    Eigen::Vector4d(octree.origin_(0), octree.origin_(1),
+                                    octree.origin_(2), octree.size_));
+            derived_data.info.push_back(
+                    Eigen::Vector4d(double(octree.max_depth_), 0, 0, 0));
+            sources.push_back(MakeColumnSource(O3DGAttribute::OctreeInfo,
+                                               O3DGEncoding::Float64,
+                                               derived_data.info));
+            sources.push_back(MakeColumnSource(O3DGAttribute::OctreeNodes,
+                                               O3DGEncoding::UInt8,
+                                               derived_data.masks));
+            sources.push_back(MakeColumnSource(O3DGAttribute::OctreeLeafColors,
+                                               O3DGEncoding::Float64,
+                                               derived_data.colors));
+            return true;
+        }
+        default:
+            utility::LogWarning(
+                    "Write O3DG failed: unsupported geometry type {:d}.",
+                    int(geometry.GetGeometryType()));
+            return false;
+    }
+}
+
+bool WriteO3DGToFile(const std::string &filename,
+                     const geometry::Geometry &geometry,
+                     const WriteO3DGOption &option,
+                     bool write_normals = true,
+                     bool write_colors = true,
+                     bool write_uvs = true) {
+    O3DGDerivedData derived_data;
+    std::vector<O3DGColumnSource> sources;
+    if (!GetColumnSources(geometry, option, write_normals, write_colors,
+                          write_uvs, derived_data, sources)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write O3DG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteO3DG(file, geometry.GetGeometryType(), sources, option);
+    if (fclose(file) != 0 && success) {
+        utility::LogWarning("Write O3DG failed: unable to write file: {}",
+                            filename);
+        success = false;
+    }
+    return success;
+}
+
+bool WriteO3DGToMemory(std::vector<uint8_t> &buffer,
+                       const geometry::Geometry &geometry,
+                       const WriteO3DGOption &option,
+                       bool write_normals = true,
+                       bool write_colors = true,
+                       bool write_uvs = true) {
+    O3DGDerivedData derived_data;
+    std::vector<O3DGColumnSource> sources;
+    if (!GetColumnSources(geometry, option, write_normals, write_colors,
+                          write_uvs, derived_data, sources)) {
+        return false;
+    }
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        !WriteO3DG(file.GetFILE(), geometry.GetGeometryType(), sources,
+                   option) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write O3DG failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
+// Describes column for ReadPointCloudInfo() and ReadTriangleMeshInfo().
+FileAttributeInfo GetAttributeInfo(const O3DGFile::Column &column) {
+    // Indexed by O3DGAttribute and O3DGEncoding.
+    static const char *const kAttributeNames[] = {
+            "",
+            "points",
+            "normals",
+            "colors",
+            "triangles",
+            "triangle_normals",
+            "triangle_uvs",
+            "triangle_material_ids",
+            "lines",
+            "line_colors",
+            "voxels",
+            "voxel_colors",
+            "voxel_grid_info",
+            "point_bounds",
+    };
+    static const char *const kEncodingTypes[] = {
+            "", "float64", "float32", "uint16", "int16", "uint8", "int32"};
+    FileAttributeInfo attribute;
+    attribute.name = column.attribute < 14 ? kAttributeNames[column.attribute]
+                                           : "";
+    attribute.type =
+            column.encoding < 7 ? kEncodingTypes[column.encoding] : "";
+    attribute.count =
+            O3DGEncoding(column.encoding) == O3DGEncoding::Oct16
+                    ? 2
+                    : int(column.components);
+    return attribute;
+}
+
+// Lists the columns of file whose attribute is in attributes.
+std::vector<FileAttributeInfo> GetAttributeInfos(
+        const O3DGFile &file,
+        std::initializer_list<O3DGAttribute> attributes) {
+    std::vector<FileAttributeInfo> infos;
+    for (const auto &column : file.GetColumns()) {
+        if (std::find(attributes.begin(), attributes.end(),
+                      O3DGAttribute(column.attribute)) != attributes.end()) {
+            infos.push_back(GetAttributeInfo(column));
+        }
+    }
+    return infos;
+}
+
+// Opens filename and checks that it holds a geometry of type type.
+bool OpenInfo(const std::string &filename,
+              geometry::Geometry::GeometryType type,
+              O3DGFile &file) {
+    if (!file.Open(filename)) {
+        return false;
+    }
+    if (file.GetGeometryType() != type) {
+        utility::LogWarning(
+                "Read O3DG failed: the file holds geometry type {:d} instead "
+                "of {:d}.",
+                int(file.GetGeometryType()), int(type));
+        return false;
+    }
+    return true;
+}
+
+WriteO3DGOption MakeWriteO3DGOption(bool compressed,
+                                    std::function<bool(double)> update) {
+    WriteO3DGOption option;
+    option.compressed = compressed;
+    option.update_progress = update;
+    return option;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool WriteGeometryToO3DG(const std::string &filename,
+                         const geometry::Geometry &geometry,
+                         const WriteO3DGOption &option /* = {}*/) {
+    return WriteO3DGToFile(filename, geometry, option);
+}
+
+bool WriteGeometryInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                 const geometry::Geometry &geometry,
+                                 const WriteO3DGOption &option /* = {}*/) {
+    return WriteO3DGToMemory(buffer, geometry, option);
+}
+
+bool O3DGFile::Open(const std::string &filename) {
+    Close();
+    if (!file_.Open(filename)) {
+        utility::LogWarning("Read O3DG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (!Open(reinterpret_cast<const uint8_t *>(file_.GetData()),
+              size_t(file_.GetSize()))) {
+        file_.Close();
+        return false;
+    }
+    return true;
+}
+
+bool O3DGFile::Open(const uint8_t *buffer, size_t length) {
+    columns_.clear();
+    geometry_type_ = geometry::Geometry::GeometryType::Unspecified;
+    data_ = reinterpret_cast<const char *>(buffer);
+    size_ = int64_t(length);
+    uint32_t header[4];
+    uint64_t index_offset;
+    if (size_ < kO3DGHeaderSize + kO3DGFooterSize ||
+        memcmp(data_, kO3DGMagic, 8) != 0 ||
+        memcmp(data_ + size_ - 8, kO3DGMagic, 8) != 0) {
+        utility::LogWarning("Read O3DG failed: not an O3DG file.");
+        return false;
+    }
+    memcpy(header, data_ + 8, sizeof(header));
+    memcpy(&index_offset, data_ + size_ - kO3DGFooterSize,
+           sizeof(index_offset));
+    if (header[0] != kO3DGVersion) {
+        utility::LogWarning("Read O3DG failed: unsupported version {:d}.",
+                            header[0]);
+        return false;
+    }
+
+    const int64_t index_end = size_ - kO3DGFooterSize;
+    int64_t position = int64_t(index_offset);
+    auto read = [&](void *dst, int64_t size) {
+        if (position < kO3DGHeaderSize || position + size > index_end) {
+            return false;
+        }
+        memcpy(dst, data_ + position, size);
+        position += size;
+        return true;
+    };
+    columns_.resize(header[2]);
+    for (auto &column : columns_) {
+        uint32_t info[4];
+        uint64_t sizes[3];
+        if (!read(info, sizeof(info)) || !read(sizes, sizeof(sizes)) ||
+            sizes[2] > uint64_t(index_end - position) / 16) {
+            utility::LogWarning("Read O3DG failed: corrupted index.");
+            columns_.clear();
+            return false;
+        }
+        column.attribute = info[0];
+        column.encoding = info[1];
+        column.components = info[2];
+        column.compression = info[3];
+        column.num_rows = int64_t(sizes[0]);
+        column.chunk_size = int64_t(sizes[1]);
+        const int64_t num_chunks = int64_t(sizes[2]);
+        const int64_t row_size = GetRowSize(O3DGEncoding(column.encoding),
+                                            column.components);
+        // LZF shrinks data at most about a hundredfold, which bounds the
+        // number of rows by the size of the file.
+        bool valid = column.num_rows >= 0 &&
+                     column.num_rows / 128 <= int64_t(index_offset) &&
+                     column.chunk_size > 0 && column.components > 0 &&
+                     column.components <= 4 &&
+                     num_chunks == (column.num_rows + column.chunk_size - 1) /
+                                           column.chunk_size;
+        column.chunk_offsets.resize(valid ? num_chunks : 0);
+        column.chunk_sizes.resize(valid ? num_chunks : 0);
+        for (int64_t chunk = 0; valid && chunk < num_chunks; ++chunk) {
+            uint64_t entry[2];
+            valid = read(entry, sizeof(entry)) &&
+                    entry[0] >= uint64_t(kO3DGHeaderSize) &&
+                    entry[0] <= index_offset &&
+                    entry[1] <= index_offset - entry[0];
+            column.chunk_offsets[chunk] = entry[0];
+            column.chunk_sizes[chunk] = entry[1];
+            // Columns of unknown encodings are skipped by the readers.
+            if (valid && row_size > 0) {
+                const int64_t rows = GetNumChunkRows(column, chunk);
+                const uint64_t raw_size =
+                        uint64_t(GetRawChunkSize(column, rows));
+                valid = O3DGCompression(column.compression) ==
+                                        O3DGCompression::None
+                                ? entry[1] == raw_size
+                                : raw_size <= 128 * entry[1] + 64;
+            }
+        }
+        if (!valid) {
+            utility::LogWarning("Read O3DG failed: corrupted index.");
+            columns_.clear();
+            return false;
+        }
+    }
+    geometry_type_ = geometry::Geometry::GeometryType(header[1]);
+    return true;
+}
+
+void O3DGFile::Close() {
+    file_.Close();
+    data_ = nullptr;
+    size_ = 0;
+    geometry_type_ = geometry::Geometry::GeometryType::Unspecified;
+    columns_.clear();
+}
+
+int64_t O3DGFile::GetNumPoints() const {
+    const Column *points = FindColumn(uint32_t(O3DGAttribute::Points));
+    return points != nullptr ? points->num_rows : 0;
+}
+
+int64_t O3DGFile::GetNumChunks() const {
+    const Column *points = FindColumn(uint32_t(O3DGAttribute::Points));
+    return points != nullptr ? int64_t(points->chunk_offsets.size()) : 0;
+}
+
+const O3DGFile::Column *O3DGFile::FindColumn(uint32_t attribute) const {
+    for (const auto &column : columns_) {
+        if (column.attribute == attribute) {
+            return &column;
+        }
+    }
+    return nullptr;
+}
+
+bool O3DGFile::CheckGeometryType(geometry::Geometry::GeometryType type) const {
+    if (data_ == nullptr) {
+        utility::LogWarning("Read O3DG failed: no file is open.");
+        return false;
+    }
+    if (geometry_type_ != type) {
+        utility::LogWarning(
+                "Read O3DG failed: the file holds geometry type {:d} instead "
+                "of {:d}.",
+                int(geometry_type_), int(type));
+        return false;
+    }
+    return true;
+}
+
+bool O3DGFile::ReadBounds(Eigen::Vector3d &min_bound,
+                          Eigen::Vector3d &max_bound) const {
+    const Column *column = FindColumn(uint32_t(O3DGAttribute::PointBounds));
+    if (data_ == nullptr || column == nullptr || column->num_rows != 2) {
+        return false;
+    }
+    utility::CountingProgressReporter reporter({});
+    int64_t rows_read = 0;
+    std::vector<Eigen::Vector3d> bounds;
+    if (!ReadColumn(data_, column, bounds, reporter, rows_read)) {
+        return false;
+    }
+    min_bound = bounds[0];
+    max_bound = bounds[1];
+    return true;
+}
+
+bool O3DGFile::ReadPointCloud(
+        geometry::PointCloud &pointcloud,
+        std::function<bool(double)> update_progress /* = {}*/) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::PointCloud)) {
+        return false;
+    }
+    const Column *points = FindColumn(uint32_t(O3DGAttribute::Points));
+    const Column *normals = FindColumn(uint32_t(O3DGAttribute::Normals));
+    const Column *colors = FindColumn(uint32_t(O3DGAttribute::Colors));
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(CountRows({points, normals, colors}));
+    int64_t rows_read = 0;
+    pointcloud.Clear();
+    if (!ReadColumn(data_, points, pointcloud.points_, reporter, rows_read) ||
+        !ReadColumn(data_, normals, pointcloud.normals_, reporter,
+                    rows_read) ||
+        !ReadColumn(data_, colors, pointcloud.colors_, reporter, rows_read)) {
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool O3DGFile::ReadPointCloudChunk(int64_t chunk_index,
+                                   geometry::PointCloud &chunk) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::PointCloud)) {
+        return false;
+    }
+    if (chunk_index < 0 || chunk_index >= GetNumChunks()) {
+        utility::LogWarning("Read O3DG failed: chunk {:d} out of range.",
+                            chunk_index);
+        return false;
+    }
+    const Column *points = FindColumn(uint32_t(O3DGAttribute::Points));
+    const int64_t num_rows = GetNumChunkRows(*points, chunk_index);
+    auto read_chunk = [&](const Column *column,
+                          std::vector<Eigen::Vector3d> &rows) {
+        if (column == nullptr) {
+            rows.clear();
+            return true;
+        }
+        if (!CheckColumn(*column, 3, false)) {
+            return false;
+        }
+        if (column->chunk_size != points->chunk_size ||
+            column->num_rows != points->num_rows) {
+            utility::LogWarning(
+                    "Read O3DG failed: attributes have different chunks.");
+            return false;
+        }
+        std::vector<char> scratch;
+        const char *raw = GetRawChunk(data_, *column, chunk_index, scratch);
+        if (raw == nullptr) {
+            utility::LogWarning("Read O3DG failed: corrupted chunk.");
+            return false;
+        }
+        rows.resize(num_rows);
+        DecodeChunk(*column, raw, num_rows, rows.data()->data());
+        return true;
+    };
+    return read_chunk(points, chunk.points_) &&
+           read_chunk(FindColumn(uint32_t(O3DGAttribute::Normals)),
+                      chunk.normals_) &&
+           read_chunk(FindColumn(uint32_t(O3DGAttribute::Colors)),
+                      chunk.colors_);
+}
+
+bool O3DGFile::ReadTriangleMesh(
+        geometry::TriangleMesh &mesh,
+        std::function<bool(double)> update_progress /* = {}*/) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::TriangleMesh)) {
+        return false;
+    }
+    const Column *vertices = FindColumn(uint32_t(O3DGAttribute::Points));
+    const Column *normals = FindColumn(uint32_t(O3DGAttribute::Normals));
+    const Column *colors = FindColumn(uint32_t(O3DGAttribute::Colors));
+    const Column *triangles = FindColumn(uint32_t(O3DGAttribute::Triangles));
+    const Column *triangle_normals =
+            FindColumn(uint32_t(O3DGAttribute::TriangleNormals));
+    const Column *uvs = FindColumn(uint32_t(O3DGAttribute::TriangleUVs));
+    const Column *material_ids =
+            FindColumn(uint32_t(O3DGAttribute::TriangleMaterialIds));
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(CountRows({vertices, normals, colors, triangles,
+                                 triangle_normals, uvs, material_ids}));
+    int64_t rows_read = 0;
+    mesh.Clear();
+    if (!ReadColumn(data_, vertices, mesh.vertices_, reporter, rows_read) ||
+        !ReadColumn(data_, normals, mesh.vertex_normals_, reporter,
+                    rows_read) ||
+        !ReadColumn(data_, colors, mesh.vertex_colors_, reporter,
+                    rows_read) ||
+        !ReadColumn(data_, triangles, mesh.triangles_, reporter, rows_read) ||
+        !ReadColumn(data_, triangle_normals, mesh.triangle_normals_, reporter,
+                    rows_read) ||
+        !ReadColumn(data_, uvs, mesh.triangle_uvs_, reporter, rows_read)) {
+        return false;
+    }
+    if (material_ids != nullptr) {
+        if (!CheckColumn(*material_ids, 1, true)) {
+            return false;
+        }
+        mesh.triangle_material_ids_.resize(material_ids->num_rows);
+        if (!DecodeColumn(data_, *material_ids,
+                          mesh.triangle_material_ids_.data(), reporter,
+                          rows_read)) {
+            return false;
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool O3DGFile::ReadLineSet(
+        geometry::LineSet &lineset,
+        std::function<bool(double)> update_progress /* = {}*/) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::LineSet)) {
+        return false;
+    }
+    const Column *points = FindColumn(uint32_t(O3DGAttribute::Points));
+    const Column *lines = FindColumn(uint32_t(O3DGAttribute::Lines));
+    const Column *colors = FindColumn(uint32_t(O3DGAttribute::LineColors));
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(CountRows({points, lines, colors}));
+    int64_t rows_read = 0;
+    lineset.Clear();
+    if (!ReadColumn(data_, points, lineset.points_, reporter, rows_read) ||
+        !ReadColumn(data_, lines, lineset.lines_, reporter, rows_read) ||
+        !ReadColumn(data_, colors, lineset.colors_, reporter, rows_read)) {
+        return false;
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool O3DGFile::ReadVoxelGrid(
+        geometry::VoxelGrid &voxelgrid,
+        std::function<bool(double)> update_progress /* = {}*/) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::VoxelGrid)) {
+        return false;
+    }
+    const Column *info = FindColumn(uint32_t(O3DGAttribute::VoxelGridInfo));
+    const Column *voxels = FindColumn(uint32_t(O3DGAttribute::Voxels));
+    const Column *colors = FindColumn(uint32_t(O3DGAttribute::VoxelColors));
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(CountRows({info, voxels, colors}));
+    int64_t rows_read = 0;
+    std::vector<Eigen::Vector4d> origin_and_size;
+    std::vector<Eigen::Vector3i> indices;
+    std::vector<Eigen::Vector3d> voxel_colors;
+    if (!ReadColumn(data_, info, origin_and_size, reporter, rows_read) ||
+        !ReadColumn(data_, voxels, indices, reporter, rows_read) ||
+        !ReadColumn(data_, colors, voxel_colors, reporter, rows_read)) {
+        return false;
+    }
+    if (origin_and_size.size() != 1 ||
+        (!voxel_colors.empty() && voxel_colors.size() != indices.size())) {
+        utility::LogWarning("Read O3DG failed: corrupted voxel grid.");
+        return false;
+    }
+    voxelgrid.Clear();
+    voxelgrid.origin_ = origin_and_size[0].head<3>();
+    voxelgrid.voxel_size_ = origin_and_size[0](3);
+    voxelgrid.voxels_.reserve(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        voxelgrid.AddVoxel(geometry::Voxel(
+                indices[i], voxel_colors.empty() ? Eigen::Vector3d::Zero()
+                                                 : voxel_colors[i]));
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool O3DGFile::ReadOctree(
+        geometry::Octree &octree,
+        std::function<bool(double)> update_progress /* = {}*/) {
+    if (!CheckGeometryType(geometry::Geometry::GeometryType::Octree)) {
+        return false;
+    }
+    const Column *info = FindColumn(uint32_t(O3DGAttribute::OctreeInfo));
+    const Column *nodes = FindColumn(uint32_t(O3DGAttribute::OctreeNodes));
+    const Column *colors =
+            FindColumn(uint32_t(O3DGAttribute::OctreeLeafColors));
+    utility::CountingProgressReporter reporter(update_progress);
+    reporter.SetTotal(CountRows({info, nodes, colors}));
+    int64_t rows_read = 0;
+    std::vector<Eigen::Vector4d> origin_size_and_depth;
+    std::vector<Eigen::Vector2i> masks;
+    std::vector<Eigen::Vector3d> leaf_colors;
+    if (!ReadColumn(data_, info, origin_size_and_depth, reporter,
+                    rows_read) ||
+        !ReadColumn(data_, nodes, masks, reporter, rows_read) ||
+        !ReadColumn(data_, colors, leaf_colors, reporter, rows_read)) {
+        return false;
+    }
+    octree.Clear();
+    if (origin_size_and_depth.size() != 2 ||
+        !(origin_size_and_depth[1](0) >= 0) ||
+        !DecodeOctree(masks, leaf_colors, octree)) {
+        octree.Clear();
+        utility::LogWarning("Read O3DG failed: corrupted octree.");
+        return false;
+    }
+    octree.origin_ = origin_size_and_depth[0].head<3>();
+    octree.size_ = origin_size_and_depth[0](3);
+    octree.max_depth_ = size_t(origin_size_and_depth[1](0));
+    reporter.Finish();
+    return true;
+}
+
+FileGeometry ReadFileGeometryTypeO3DG(const std::string &path) {
+    O3DGFile file;
+    if (!file.Open(path)) {
+        return CONTENTS_UNKNOWN;
+    }
+    switch (file.GetGeometryType()) {
+        case geometry::Geometry::GeometryType::PointCloud:
+            return CONTAINS_POINTS;
+        case geometry::Geometry::GeometryType::TriangleMesh:
+            return CONTAINS_TRIANGLES;
+        case geometry::Geometry::GeometryType::LineSet:
+            return CONTAINS_LINES;
+        default:
+            return CONTENTS_UNKNOWN;
+    }
+}
+
+bool ReadPointCloudFromO3DG(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params) {
+    O3DGFile file;
+    return file.Open(filename) &&
+           file.ReadPointCloud(pointcloud, params.update_progress);
+}
+
+bool ReadPointCloudInfoFromO3DG(const std::string &filename,
+                                PointCloudInfo &info) {
+    O3DGFile file;
+    if (!OpenInfo(filename, geometry::Geometry::GeometryType::PointCloud,
+                  file)) {
+        return false;
+    }
+    info.num_points = file.GetNumPoints();
+    info.attributes = GetAttributeInfos(
+            file, {O3DGAttribute::Points, O3DGAttribute::Normals,
+                   O3DGAttribute::Colors});
+    for (const auto &column : file.GetColumns()) {
+        info.has_normals |= O3DGAttribute(column.attribute) ==
+                            O3DGAttribute::Normals;
+        info.has_colors |=
+                O3DGAttribute(column.attribute) == O3DGAttribute::Colors;
+    }
+    info.has_bounds = file.ReadBounds(info.min_bound, info.max_bound);
+    return true;
+}
+
+bool WritePointCloudToO3DG(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params) {
+    return WriteO3DGToFile(
+            filename, pointcloud,
+            MakeWriteO3DGOption(bool(params.compressed),
+                                params.update_progress));
+}
+
+bool ReadPointCloudInMemoryFromO3DG(const uint8_t *buffer,
+                                    size_t length,
+                                    geometry::PointCloud &pointcloud,
+                                    const ReadPointCloudOption &params) {
+    O3DGFile file;
+    return file.Open(buffer, length) &&
+           file.ReadPointCloud(pointcloud, params.update_progress);
+}
+
+bool WritePointCloudInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                   const geometry::PointCloud &pointcloud,
+                                   const WritePointCloudOption &params) {
+    return WriteO3DGToMemory(
+            buffer, pointcloud,
+            MakeWriteO3DGOption(bool(params.compressed),
+                                params.update_progress));
+}
+
+bool ReadTriangleMeshFromO3DG(const std::string &filename,
+                              geometry::TriangleMesh &mesh,
+                              bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Reading O3DG: ",
+                                                     print_progress);
+    O3DGFile file;
+    return file.Open(filename) &&
+           file.ReadTriangleMesh(mesh, std::ref(progress_updater));
+}
+
+bool ReadTriangleMeshInfoFromO3DG(const std::string &filename,
+                                  TriangleMeshInfo &info) {
+    O3DGFile file;
+    if (!OpenInfo(filename, geometry::Geometry::GeometryType::TriangleMesh,
+                  file)) {
+        return false;
+    }
+    info.num_vertices = file.GetNumPoints();
+    info.num_triangles = 0;
+    info.vertex_attributes = GetAttributeInfos(
+            file, {O3DGAttribute::Points, O3DGAttribute::Normals,
+                   O3DGAttribute::Colors});
+    info.triangle_attributes = GetAttributeInfos(
+            file, {O3DGAttribute::Triangles, O3DGAttribute::TriangleNormals,
+                   O3DGAttribute::TriangleUVs,
+                   O3DGAttribute::TriangleMaterialIds});
+    for (const auto &column : file.GetColumns()) {
+        switch (O3DGAttribute(column.attribute)) {
+            case O3DGAttribute::Normals:
+                info.has_vertex_normals = true;
+                break;
+            case O3DGAttribute::Colors:
+                info.has_vertex_colors = true;
+                break;
+            case O3DGAttribute::Triangles:
+                info.num_triangles = column.num_rows;
+                break;
+            case O3DGAttribute::TriangleNormals:
+                info.has_triangle_normals = true;
+                break;
+            case O3DGAttribute::TriangleUVs:
+                info.has_triangle_uvs = true;
+                break;
+            default:
+                break;
+        }
+    }
+    info.has_bounds = file.ReadBounds(info.min_bound, info.max_bound);
+    return true;
+}
+
+bool WriteTriangleMeshToO3DG(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             bool write_ascii,
+                             bool compressed,
+                             bool write_vertex_normals,
+                             bool write_vertex_colors,
+                             bool write_triangle_uvs,
+                             bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Writing O3DG: ",
+                                                     print_progress);
+    return WriteO3DGToFile(
+            filename, mesh,
+            MakeWriteO3DGOption(compressed, std::ref(progress_updater)),
+            write_vertex_normals, write_vertex_colors, write_triangle_uvs);
+}
+
+bool ReadTriangleMeshInMemoryFromO3DG(const uint8_t *buffer,
+                                      size_t length,
+                                      geometry::TriangleMesh &mesh,
+                                      bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Reading O3DG: ",
+                                                     print_progress);
+    O3DGFile file;
+    return file.Open(buffer, length) &&
+           file.ReadTriangleMesh(mesh, std::ref(progress_updater));
+}
+
+bool WriteTriangleMeshInMemoryToO3DG(std::vector<uint8_t> &buffer,
+                                     const geometry::TriangleMesh &mesh,
+                                     bool write_ascii,
+                                     bool compressed,
+                                     bool write_vertex_normals,
+                                     bool write_vertex_colors,
+                                     bool write_triangle_uvs,
+                                     bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Writing O3DG: ",
+                                                     print_progress);
+    return WriteO3DGToMemory(
+            buffer, mesh,
+            MakeWriteO3DGOption(compressed, std::ref(progress_updater)),
+            write_vertex_normals, write_vertex_colors, write_triangle_uvs);
+}
+
+bool ReadLineSetFromO3DG(const std::string &filename,
+                         geometry::LineSet &lineset,
+                         bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Reading O3DG: ",
+                                                     print_progress);
+    O3DGFile file;
+    return file.Open(filename) &&
+           file.ReadLineSet(lineset, std::ref(progress_updater));
+}
+
+bool WriteLineSetToO3DG(const std::string &filename,
+                        const geometry::LineSet &lineset,
+                        bool write_ascii,
+                        bool compressed,
+                        bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Writing O3DG: ",
+                                                     print_progress);
+    return WriteO3DGToFile(
+            filename, lineset,
+            MakeWriteO3DGOption(compressed, std::ref(progress_updater)));
+}
+
+bool ReadVoxelGridFromO3DG(const std::string &filename,
+                           geometry::VoxelGrid &voxelgrid,
+                           bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Reading O3DG: ",
+                                                     print_progress);
+    O3DGFile file;
+    return file.Open(filename) &&
+           file.ReadVoxelGrid(voxelgrid, std::ref(progress_updater));
+}
+
+bool WriteVoxelGridToO3DG(const std::string &filename,
+                          const geometry::VoxelGrid &voxelgrid,
+                          bool write_ascii,
+                          bool compressed,
+                          bool print_progress) {
+    utility::ConsoleProgressUpdater progress_updater("Writing O3DG: ",
+                                                     print_progress);
+    return WriteO3DGToFile(
+            filename, voxelgrid,
+            MakeWriteO3DGOption(compressed, std::ref(progress_updater)));
+}
+
+bool ReadOctreeFromO3DG(const std::string &filename,
+                        geometry::Octree &octree) {
+    O3DGFile file;
+    return file.Open(filename) && file.ReadOctree(octree);
+}
+
+bool WriteOctreeToO3DG(const std::string &filename,
+                       const geometry::Octree &octree) {
+    return WriteO3DGToFile(filename, octree, WriteO3DGOption());
+}
+
+}  // namespace io
+}  // namespace open3d
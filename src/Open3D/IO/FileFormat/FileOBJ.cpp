@@ -24,8 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
-#include <numeric>
+#include <map>
+#include <sstream>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
@@ -33,10 +37,198 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/TextParser.h"
 
 #include <tiny_obj_loader.h>
 
 namespace open3d {
+
+namespace {
+using namespace io;
+
+/// Whether the line [ptr, end) starts with the statement \p keyword followed
+/// by a blank, in which case \p ptr is advanced past the keyword.
+bool ParseKeyword(const char*& ptr, const char* end, const char* keyword) {
+    const size_t length = strlen(keyword);
+    if (size_t(end - ptr) <= length || strncmp(ptr, keyword, length) != 0 ||
+        (ptr[length] != ' ' && ptr[length] != '\t')) {
+        return false;
+    }
+    ptr += length;
+    return true;
+}
+
+/// Returns the names following a statement, without surrounding blanks.
+std::string ParseName(const char* ptr, const char* end) {
+    while (ptr < end && (*ptr == ' ' || *ptr == '\t')) ptr++;
+    while (end > ptr && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    return std::string(ptr, end);
+}
+
+/// Content of a chunk of OBJ text, parsed independently of the other chunks.
+struct OBJChunk {
+    std::vector<Eigen::Vector3d> vertices;
+    std::vector<Eigen::Vector3d> vertex_colors;
+    std::vector<Eigen::Vector3d> normals;
+    std::vector<Eigen::Vector2d> texcoords;
+    /// Vertex, texture coordinate and normal indices of each triangle
+    /// corner, -1 if absent. Polygons are triangulated as fans.
+    std::vector<Eigen::Vector3i> corners;
+    /// Positions (3 * corner + component) of the relative indices in
+    /// corners. They are stored relative to the start of the chunk and
+    /// offset once the number of elements of the previous chunks is known.
+    std::vector<int64_t> relative_indices;
+    /// usemtl statements as (first triangle of the chunk, material name).
+    std::vector<std::pair<int64_t, std::string>> material_switches;
+    std::vector<std::string> material_libraries;
+    bool all_vertices_have_colors = true;
+    std::string error;
+};
+
+/// Parses a face corner "v", "v/vt", "v//vn" or "v/vt/vn" at \p ptr.
+bool ParseCorner(const char*& ptr,
+                 const char* end,
+                 OBJChunk& chunk,
+                 Eigen::Vector3i& corner,
+                 std::vector<int64_t>& relative_components) {
+    const int64_t counts[3] = {int64_t(chunk.vertices.size()),
+                               int64_t(chunk.texcoords.size()),
+                               int64_t(chunk.normals.size())};
+    relative_components.clear();
+    corner = Eigen::Vector3i(-1, -1, -1);
+    for (int k = 0; k < 3; k++) {
+        if (k > 0) {
+            if (ptr >= end || *ptr != '/') break;
+            ptr++;
+            if (ptr < end && *ptr == '/' && k == 1) continue;
+            if (ptr >= end || *ptr == ' ' || *ptr == '\t') break;
+        }
+        int64_t index;
+        // Indices are 1-based, negative indices count back from the last
+        // element defined so far.
+        if (!utility::ParseInt(ptr, end, index) || index == 0) {
+            return false;
+        }
+        if (index > 0) {
+            corner(k) = int(index - 1);
+        } else {
+            corner(k) = int(counts[k] + index);
+            relative_components.push_back(k);
+        }
+    }
+    return true;
+}
+
+void ParseOBJChunk(const char* begin, const char* end, OBJChunk& chunk) {
+    std::vector<Eigen::Vector3i> polygon;
+    std::vector<std::vector<int64_t>> polygon_relative;
+    std::vector<int64_t> relative_components;
+    utility::ForEachLine(begin, end, [&](const char* line,
+                                         const char* line_end) {
+        if (!chunk.error.empty()) return;
+        const char* ptr = line;
+        while (ptr < line_end && (*ptr == ' ' || *ptr == '\t')) ptr++;
+        if (ParseKeyword(ptr, line_end, "v")) {
+            // Missing coordinates default to 0 like in other OBJ readers.
+            Eigen::Vector3d vertex = Eigen::Vector3d::Zero();
+            utility::ParseDouble(ptr, line_end, vertex(0));
+            utility::ParseDouble(ptr, line_end, vertex(1));
+            utility::ParseDouble(ptr, line_end, vertex(2));
+            chunk.vertices.push_back(vertex);
+            Eigen::Vector3d color;
+            if (utility::ParseDouble(ptr, line_end, color(0)) &&
+                utility::ParseDouble(ptr, line_end, color(1)) &&
+                utility::ParseDouble(ptr, line_end, color(2))) {
+                chunk.vertex_colors.push_back(color);
+            } else {
+                chunk.vertex_colors.push_back(Eigen::Vector3d::Ones());
+                chunk.all_vertices_have_colors = false;
+            }
+        } else if (ParseKeyword(ptr, line_end, "vn")) {
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            utility::ParseDouble(ptr, line_end, normal(0));
+            utility::ParseDouble(ptr, line_end, normal(1));
+            utility::ParseDouble(ptr, line_end, normal(2));
+            chunk.normals.push_back(normal);
+        } else if (ParseKeyword(ptr, line_end, "vt")) {
+            Eigen::Vector2d texcoord = Eigen::Vector2d::Zero();
+            utility::ParseDouble(ptr, line_end, texcoord(0));
+            utility::ParseDouble(ptr, line_end, texcoord(1));
+            chunk.texcoords.push_back(texcoord);
+        } else if (ParseKeyword(ptr, line_end, "f")) {
+            polygon.clear();
+            polygon_relative.clear();
+            Eigen::Vector3i corner;
+            while (true) {
+                while (ptr < line_end && (*ptr == ' ' || *ptr == '\t')) ptr++;
+                if (ptr >= line_end) break;
+                if (!ParseCorner(ptr, line_end, chunk, corner,
+                                 relative_components)) {
+                    chunk.error = fmt::format("invalid face: {}",
+                                              std::string(line, line_end));
+                    return;
+                }
+                polygon.push_back(corner);
+                polygon_relative.push_back(relative_components);
+            }
+            for (size_t i = 1; i + 1 < polygon.size(); i++) {
+                for (size_t j : {size_t(0), i, i + 1}) {
+                    for (int64_t k : polygon_relative[j]) {
+                        chunk.relative_indices.push_back(
+                                int64_t(chunk.corners.size()) * 3 + k);
+                    }
+                    chunk.corners.push_back(polygon[j]);
+                }
+            }
+        } else if (ParseKeyword(ptr, line_end, "usemtl")) {
+            chunk.material_switches.emplace_back(
+                    int64_t(chunk.corners.size()) / 3,
+                    ParseName(ptr, line_end));
+        } else if (ParseKeyword(ptr, line_end, "mtllib")) {
+            chunk.material_libraries.push_back(ParseName(ptr, line_end));
+        }
+        // Comments, groups, smoothing groups, lines and free-form
+        // geometry are ignored.
+    });
+}
+
+template <typename T>
+void AppendAndClear(std::vector<T>& dst, std::vector<T>& src) {
+    dst.insert(dst.end(), src.begin(), src.end());
+    std::vector<T>().swap(src);
+}
+
+/// Loads the materials of the first of the space separated .mtl files in
+/// \p libraries that can be read, like tinyobjloader does.
+void LoadMaterials(const std::string& mtl_base_path,
+                   const std::string& libraries,
+                   std::vector<tinyobj::material_t>& materials,
+                   std::map<std::string, int>& material_map) {
+    std::istringstream names(libraries);
+    std::string name;
+    while (names >> name) {
+        std::ifstream stream(mtl_base_path + name);
+        if (!stream) {
+            continue;
+        }
+        std::string warn;
+        std::string err;
+        tinyobj::LoadMtl(&material_map, &materials, &stream, &warn, &err);
+        if (!warn.empty()) {
+            utility::LogWarning("Read OBJ failed: {}", warn);
+        }
+        if (!err.empty()) {
+            utility::LogWarning("Read OBJ failed: {}", err);
+        }
+        return;
+    }
+    utility::LogWarning("Read OBJ failed: unable to open material file {}",
+                        libraries);
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeOBJ(const std::string& path) {
@@ -46,108 +238,156 @@ FileGeometry ReadFileGeometryTypeOBJ(const std::string& path) {
 bool ReadTriangleMeshFromOBJ(const std::string& filename,
                              geometry::TriangleMesh& mesh,
                              bool print_progress) {
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn;
-    std::string err;
-
-    std::string mtl_base_path =
-            utility::filesystem::GetFileParentDirectory(filename);
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                                filename.c_str(), mtl_base_path.c_str());
-    if (!warn.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", warn);
-    }
-    if (!err.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", err);
-    }
-
-    if (!ret) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
         return false;
     }
+    std::string mtl_base_path =
+            utility::filesystem::GetFileParentDirectory(filename);
 
+    // The file is parsed in parallel chunks, whose elements are appended in
+    // file order. Relative indices and material names are resolved once the
+    // elements of the previous chunks are known.
     mesh.Clear();
-
-    // copy vertex and data
-    for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
-        tinyobj::real_t vx = attrib.vertices[vidx + 0];
-        tinyobj::real_t vy = attrib.vertices[vidx + 1];
-        tinyobj::real_t vz = attrib.vertices[vidx + 2];
-        mesh.vertices_.push_back(Eigen::Vector3d(vx, vy, vz));
+    std::vector<Eigen::Vector3i> corners;
+    std::vector<Eigen::Vector3d> normals;
+    std::vector<Eigen::Vector2d> texcoords;
+    std::vector<std::pair<int64_t, std::string>> material_switches;
+    std::vector<std::string> material_libraries;
+    bool all_vertices_have_colors = true;
+    std::string error;
+    const char* begin = file.GetData();
+    const char* end = begin + file.GetSize();
+    utility::ConsoleProgressBar progress_bar(100, "Reading OBJ: ",
+                                             print_progress);
+    int progress = 0;
+    utility::ForEachTextBatch(
+            begin, end, [&](const std::vector<const char*>& bounds) {
+                const int64_t num_chunks = int64_t(bounds.size()) - 1;
+                std::vector<OBJChunk> chunks(num_chunks);
+                utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+                    ParseOBJChunk(bounds[c], bounds[c + 1], chunks[c]);
+                });
+                for (OBJChunk& chunk : chunks) {
+                    if (!chunk.error.empty()) {
+                        error = chunk.error;
+                        return false;
+                    }
+                    const int64_t offsets[3] = {
+                            int64_t(mesh.vertices_.size()),
+                            int64_t(texcoords.size()), int64_t(normals.size())};
+                    for (int64_t position : chunk.relative_indices) {
+                        int& index = chunk.corners[position / 3](position % 3);
+                        index += int(offsets[position % 3]);
+                        if (index < 0) {
+                            error = "relative face index out of range.";
+                            return false;
+                        }
+                    }
+                    for (auto& material_switch : chunk.material_switches) {
+                        material_switches.emplace_back(
+                                material_switch.first +
+                                        int64_t(corners.size()) / 3,
+                                std::move(material_switch.second));
+                    }
+                    AppendAndClear(material_libraries,
+                                   chunk.material_libraries);
+                    all_vertices_have_colors &= chunk.all_vertices_have_colors;
+                    AppendAndClear(mesh.vertices_, chunk.vertices);
+                    AppendAndClear(mesh.vertex_colors_, chunk.vertex_colors);
+                    AppendAndClear(normals, chunk.normals);
+                    AppendAndClear(texcoords, chunk.texcoords);
+                    AppendAndClear(corners, chunk.corners);
+                }
+                const int new_progress = int((bounds.back() - begin) * 100 /
+                                             std::max<int64_t>(end - begin, 1));
+                for (; progress < new_progress; progress++) {
+                    ++progress_bar;
+                }
+                return true;
+            });
+    if (!error.empty()) {
+        utility::LogWarning("Read OBJ failed: {}", error);
+        mesh.Clear();
+        return false;
     }
-
-    for (size_t vidx = 0; vidx < attrib.colors.size(); vidx += 3) {
-        tinyobj::real_t r = attrib.colors[vidx + 0];
-        tinyobj::real_t g = attrib.colors[vidx + 1];
-        tinyobj::real_t b = attrib.colors[vidx + 2];
-        mesh.vertex_colors_.push_back(Eigen::Vector3d(r, g, b));
+    if (!all_vertices_have_colors) {
+        mesh.vertex_colors_.clear();
     }
 
-    // resize normal data and create bool indicator vector
-    mesh.vertex_normals_.resize(mesh.vertices_.size());
-    std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
-
-    // copy face data and copy normals data
-    // append face-wise uv data
-    for (size_t s = 0; s < shapes.size(); s++) {
-        size_t index_offset = 0;
-        for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-            int fv = shapes[s].mesh.num_face_vertices[f];
-            if (fv != 3) {
-                utility::LogWarning(
-                        "Read OBJ failed: facet with number of vertices not "
-                        "equal to 3");
-                return false;
+    const int64_t num_triangles = int64_t(corners.size()) / 3;
+    const int64_t counts[3] = {int64_t(mesh.vertices_.size()),
+                               int64_t(texcoords.size()),
+                               int64_t(normals.size())};
+    std::atomic<bool> valid_indices(true);
+    std::atomic<bool> all_uvs_set(true);
+    mesh.triangles_.resize(num_triangles);
+    utility::ParallelFor(0, num_triangles, [&](int64_t t) {
+        for (int j = 0; j < 3; j++) {
+            const Eigen::Vector3i& corner = corners[t * 3 + j];
+            if (corner(0) < 0 || corner(0) >= counts[0] ||
+                corner(1) >= counts[1] || corner(2) >= counts[2]) {
+                valid_indices = false;
             }
+            if (corner(1) < 0) {
+                all_uvs_set = false;
+            }
+            mesh.triangles_[t](j) = corner(0);
+        }
+    });
+    if (!valid_indices) {
+        utility::LogWarning("Read OBJ failed: face index out of range.");
+        mesh.Clear();
+        return false;
+    }
 
-            Eigen::Vector3i facet;
-            for (int v = 0; v < fv; v++) {
-                tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-                int vidx = idx.vertex_index;
-                facet(v) = vidx;
-
-                if (!attrib.normals.empty() && !normals_indicator[vidx] &&
-                    (3 * idx.normal_index + 2) < int(attrib.normals.size())) {
-                    tinyobj::real_t nx =
-                            attrib.normals[3 * idx.normal_index + 0];
-                    tinyobj::real_t ny =
-                            attrib.normals[3 * idx.normal_index + 1];
-                    tinyobj::real_t nz =
-                            attrib.normals[3 * idx.normal_index + 2];
-                    mesh.vertex_normals_[vidx](0) = nx;
-                    mesh.vertex_normals_[vidx](1) = ny;
-                    mesh.vertex_normals_[vidx](2) = nz;
-                    normals_indicator[vidx] = true;
-                }
-
-                if (!attrib.texcoords.empty() &&
-                    2 * idx.texcoord_index + 1 < int(attrib.texcoords.size())) {
-                    tinyobj::real_t tx =
-                            attrib.texcoords[2 * idx.texcoord_index + 0];
-                    tinyobj::real_t ty =
-                            attrib.texcoords[2 * idx.texcoord_index + 1];
-                    mesh.triangle_uvs_.push_back(Eigen::Vector2d(tx, ty));
-                }
+    // A vertex takes the normal of the first corner that refers to it. If
+    // not all vertices have a normal, then the vertex normals are removed.
+    if (!normals.empty()) {
+        mesh.vertex_normals_.resize(mesh.vertices_.size());
+        std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+        for (const Eigen::Vector3i& corner : corners) {
+            if (corner(2) >= 0 && !normals_indicator[corner(0)]) {
+                mesh.vertex_normals_[corner(0)] = normals[corner(2)];
+                normals_indicator[corner(0)] = true;
             }
-            mesh.triangles_.push_back(facet);
-            mesh.triangle_material_ids_.push_back(
-                    shapes[s].mesh.material_ids[f]);
-            index_offset += fv;
+        }
+        if (std::find(normals_indicator.begin(), normals_indicator.end(),
+                      false) != normals_indicator.end()) {
+            mesh.vertex_normals_.clear();
         }
     }
 
-    // if not all normals have been set, then remove the vertex normals
-    bool all_normals_set =
-            std::accumulate(normals_indicator.begin(), normals_indicator.end(),
-                            true, [](bool a, bool b) { return a && b; });
-    if (!all_normals_set) {
-        mesh.vertex_normals_.clear();
+    // If not all triangles have corresponding uvs, then remove uvs.
+    if (!texcoords.empty() && all_uvs_set) {
+        mesh.triangle_uvs_.resize(corners.size());
+        utility::ParallelFor(0, int64_t(corners.size()), [&](int64_t i) {
+            mesh.triangle_uvs_[i] = texcoords[corners[i](1)];
+        });
     }
 
-    // if not all triangles have corresponding uvs, then remove uvs
-    if (3 * mesh.triangles_.size() != mesh.triangle_uvs_.size()) {
-        mesh.triangle_uvs_.clear();
+    std::vector<tinyobj::material_t> materials;
+    std::map<std::string, int> material_map;
+    for (const std::string& libraries : material_libraries) {
+        LoadMaterials(mtl_base_path, libraries, materials, material_map);
+    }
+    mesh.triangle_material_ids_.assign(num_triangles, -1);
+    for (size_t i = 0; i < material_switches.size(); i++) {
+        const int64_t first = material_switches[i].first;
+        const int64_t last = i + 1 < material_switches.size()
+                                     ? material_switches[i + 1].first
+                                     : num_triangles;
+        auto material = material_map.find(material_switches[i].second);
+        if (material == material_map.end()) {
+            utility::LogWarning("Read OBJ failed: material {} not found.",
+                                material_switches[i].second);
+            continue;
+        }
+        std::fill(mesh.triangle_material_ids_.begin() + first,
+                  mesh.triangle_material_ids_.begin() + last,
+                  material->second);
     }
 
     auto textureLoader = [&mtl_base_path](std::string& relativePath) {
@@ -163,6 +163,61 @@ bool ReadTriangleMeshFromOFF(const std::string &filename,
     return true;
 }
 
+bool ReadTriangleMeshInfoFromOFF(const std::string &filename,
+                                 TriangleMeshInfo &info) {
+    std::ifstream file(filename.c_str(), std::ios::in);
+    if (!file) {
+        utility::LogWarning("Read OFF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    std::string header, line;
+    while (std::getline(file, line)) {
+        line = utility::StripString(line);
+        if (!line.empty() && line[0] != '#') {
+            if (header.empty()) {
+                header = line;
+            } else {
+                break;
+            }
+        }
+    }
+    if (header != "OFF" && header != "COFF" && header != "NOFF" &&
+        header != "CNOFF") {
+        utility::LogWarning(
+                "Read OFF failed: header keyword '{}' not supported.", header);
+        return false;
+    }
+    std::istringstream iss(line);
+    if (!(iss >> info.num_vertices >> info.num_triangles)) {
+        utility::LogWarning("Read OFF failed: could not read file info.");
+        return false;
+    }
+
+    info.has_vertex_normals = header == "NOFF" || header == "CNOFF";
+    info.has_vertex_colors = header == "COFF" || header == "CNOFF";
+    std::vector<std::string> names = {"x", "y", "z"};
+    if (info.has_vertex_normals) {
+        names.insert(names.end(), {"nx", "ny", "nz"});
+    }
+    if (info.has_vertex_colors) {
+        names.insert(names.end(), {"red", "green", "blue", "alpha"});
+    }
+    for (const std::string &name : names) {
+        FileAttributeInfo attribute;
+        attribute.name = name;
+        attribute.type = "ascii";
+        info.vertex_attributes.push_back(attribute);
+    }
+    FileAttributeInfo indices;
+    indices.name = "vertex_indices";
+    indices.type = "ascii";
+    indices.is_list = true;
+    info.triangle_attributes.push_back(indices);
+    return true;
+}
+
 bool WriteTriangleMeshToOFF(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
@@ -0,0 +1,656 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/OPCIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// An OPC file starts with an 88 byte header: an 8 byte magic, a uint32
+// version, a uint32 of flags, a uint32 octree depth, a reserved uint32, the
+// uint64 number of points, the float64 leaf size and the float64 minimum and
+// maximum bound of the points. The range coded octree follows. Everything
+// is in host byte order.
+//
+// The octree is coded in DFS order, children in the order of
+// geometry::OctreeInternalNode. Every internal node is coded as the byte of
+// its occupied children, every leaf as its number of points followed by the
+// color differences of its points.
+const char kOPCMagic[8] = {'O', '3', 'D', 'O', 'C', 'T', 'P', 'C'};
+const uint32_t kOPCVersion = 1;
+const uint32_t kOPCHasColors = 1;
+const size_t kOPCHeaderSize = 88;
+// Leaves are addressed with 32 bit integer coordinates.
+const uint32_t kOPCMaxDepth = 30;
+
+struct OPCHeader {
+    uint32_t flags = 0;
+    uint32_t depth = 0;
+    uint64_t num_points = 0;
+    double precision = 0;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+};
+
+void WriteOPCHeader(const OPCHeader &header, std::vector<uint8_t> &buffer) {
+    buffer.resize(kOPCHeaderSize);
+    uint8_t *dst = buffer.data();
+    const uint32_t fields[4] = {kOPCVersion, header.flags, header.depth, 0};
+    memcpy(dst, kOPCMagic, 8);
+    memcpy(dst + 8, fields, 16);
+    memcpy(dst + 24, &header.num_points, 8);
+    memcpy(dst + 32, &header.precision, 8);
+    memcpy(dst + 40, header.min_bound.data(), 24);
+    memcpy(dst + 64, header.max_bound.data(), 24);
+}
+
+bool ReadOPCHeader(const uint8_t *buffer, size_t length, OPCHeader &header) {
+    uint32_t fields[4];
+    if (length < kOPCHeaderSize || memcmp(buffer, kOPCMagic, 8) != 0) {
+        utility::LogWarning("Read OPC failed: not an OPC file.");
+        return false;
+    }
+    memcpy(fields, buffer + 8, 16);
+    if (fields[0] != kOPCVersion) {
+        utility::LogWarning("Read OPC failed: unsupported version {:d}.",
+                            fields[0]);
+        return false;
+    }
+    header.flags = fields[1];
+    header.depth = fields[2];
+    memcpy(&header.num_points, buffer + 24, 8);
+    memcpy(&header.precision, buffer + 32, 8);
+    memcpy(header.min_bound.data(), buffer + 40, 24);
+    memcpy(header.max_bound.data(), buffer + 64, 24);
+    if (header.depth > kOPCMaxDepth || !(header.precision > 0)) {
+        utility::LogWarning("Read OPC failed: invalid header.");
+        return false;
+    }
+    return true;
+}
+
+// Adaptive binary range coder, as in LZMA. Every decision is coded with an
+// 11 bit probability that adapts to the decisions coded with it.
+const int kProbabilityBits = 11;
+const uint16_t kProbabilityInit = 1 << (kProbabilityBits - 1);
+const int kAdaptationShift = 5;
+const uint32_t kTopValue = 1 << 24;
+
+class RangeEncoder {
+public:
+    explicit RangeEncoder(std::vector<uint8_t> &output) : output_(output) {}
+
+    void EncodeBit(uint16_t &probability, int bit) {
+        const uint32_t bound = (range_ >> kProbabilityBits) * probability;
+        if (bit == 0) {
+            range_ = bound;
+            probability += ((1 << kProbabilityBits) - probability) >>
+                           kAdaptationShift;
+        } else {
+            low_ += bound;
+            range_ -= bound;
+            probability -= probability >> kAdaptationShift;
+        }
+        Normalize();
+    }
+
+    // Codes the lowest \p num_bits of \p value with probability 1/2 each.
+    void EncodeDirectBits(uint32_t value, int num_bits) {
+        for (int i = num_bits - 1; i >= 0; --i) {
+            range_ >>= 1;
+            if ((value >> i) & 1) {
+                low_ += range_;
+            }
+            Normalize();
+        }
+    }
+
+    void Flush() {
+        for (int i = 0; i < 5; ++i) {
+            ShiftLow();
+        }
+    }
+
+private:
+    void Normalize() {
+        while (range_ < kTopValue) {
+            range_ <<= 8;
+            ShiftLow();
+        }
+    }
+
+    void ShiftLow() {
+        if (uint32_t(low_) < 0xff000000u || (low_ >> 32) != 0) {
+            const uint8_t carry = uint8_t(low_ >> 32);
+            uint8_t byte = cache_;
+            do {
+                output_.push_back(uint8_t(byte + carry));
+                byte = 0xff;
+            } while (--cache_size_ != 0);
+            cache_ = uint8_t(low_ >> 24);
+        }
+        ++cache_size_;
+        low_ = (low_ & 0x00ffffffu) << 8;
+    }
+
+    std::vector<uint8_t> &output_;
+    uint64_t low_ = 0;
+    uint32_t range_ = 0xffffffffu;
+    uint8_t cache_ = 0;
+    uint64_t cache_size_ = 1;
+};
+
+class RangeDecoder {
+public:
+    RangeDecoder(const uint8_t *begin, const uint8_t *end)
+        : current_(begin), end_(end) {
+        for (int i = 0; i < 5; ++i) {
+            code_ = (code_ << 8) | NextByte();
+        }
+    }
+
+    int DecodeBit(uint16_t &probability) {
+        const uint32_t bound = (range_ >> kProbabilityBits) * probability;
+        int bit;
+        if (code_ < bound) {
+            range_ = bound;
+            probability += ((1 << kProbabilityBits) - probability) >>
+                           kAdaptationShift;
+            bit = 0;
+        } else {
+            code_ -= bound;
+            range_ -= bound;
+            probability -= probability >> kAdaptationShift;
+            bit = 1;
+        }
+        Normalize();
+        return bit;
+    }
+
+    uint32_t DecodeDirectBits(int num_bits) {
+        uint32_t value = 0;
+        for (int i = 0; i < num_bits; ++i) {
+            range_ >>= 1;
+            int bit = 0;
+            if (code_ >= range_) {
+                code_ -= range_;
+                bit = 1;
+            }
+            value = (value << 1) | uint32_t(bit);
+            Normalize();
+        }
+        return value;
+    }
+
+    /// Returns true if the decoder read past the end of the content, i.e.
+    /// the content is truncated or corrupted.
+    bool IsOverrun() const { return overrun_; }
+
+private:
+    uint8_t NextByte() {
+        if (current_ == end_) {
+            overrun_ = true;
+            return 0;
+        }
+        return *current_++;
+    }
+
+    void Normalize() {
+        while (range_ < kTopValue) {
+            range_ <<= 8;
+            code_ = (code_ << 8) | NextByte();
+        }
+    }
+
+    const uint8_t *current_;
+    const uint8_t *end_;
+    uint32_t code_ = 0;
+    uint32_t range_ = 0xffffffffu;
+    bool overrun_ = false;
+};
+
+// Adaptive model of a byte, coded as 8 binary decisions from the most
+// significant bit, each in the context of the bits before it.
+class ByteModel {
+public:
+    ByteModel() { std::fill_n(probabilities_, 256, kProbabilityInit); }
+
+    void Encode(RangeEncoder &encoder, uint8_t symbol) {
+        uint32_t context = 1;
+        for (int i = 7; i >= 0; --i) {
+            const int bit = (symbol >> i) & 1;
+            encoder.EncodeBit(probabilities_[context], bit);
+            context = (context << 1) | uint32_t(bit);
+        }
+    }
+
+    uint8_t Decode(RangeDecoder &decoder) {
+        uint32_t context = 1;
+        for (int i = 0; i < 8; ++i) {
+            context = (context << 1) |
+                      uint32_t(decoder.DecodeBit(probabilities_[context]));
+        }
+        return uint8_t(context - 256);
+    }
+
+private:
+    uint16_t probabilities_[256];
+};
+
+// The models of all the symbols of an OPC file. Occupancy bytes are coded in
+// the context of the depth of their node, and color differences in the
+// context of their channel.
+struct OPCModels {
+    explicit OPCModels(uint32_t depth) : occupancy(depth) {}
+
+    // Numbers of points of leaves from 256 on are coded as 255 followed by
+    // the remainder in 32 direct bits.
+    void EncodeCount(RangeEncoder &encoder, uint64_t count) {
+        const uint64_t symbol = std::min<uint64_t>(count - 1, 255);
+        count_model.Encode(encoder, uint8_t(symbol));
+        if (symbol == 255) {
+            encoder.EncodeDirectBits(uint32_t(count - 256), 32);
+        }
+    }
+
+    uint64_t DecodeCount(RangeDecoder &decoder) {
+        const uint64_t symbol = count_model.Decode(decoder);
+        if (symbol == 255) {
+            return 256 + uint64_t(decoder.DecodeDirectBits(32));
+        }
+        return symbol + 1;
+    }
+
+    // Colors are predicted by the previous color. The difference of green
+    // is coded first, and red and blue as their difference to it, since the
+    // channels mostly change together.
+    void EncodeColor(RangeEncoder &encoder,
+                     const uint8_t color[3],
+                     uint8_t previous[3]) {
+        const uint8_t green = uint8_t(color[1] - previous[1]);
+        color_models[1].Encode(encoder, green);
+        color_models[0].Encode(encoder,
+                               uint8_t(color[0] - previous[0] - green));
+        color_models[2].Encode(encoder,
+                               uint8_t(color[2] - previous[2] - green));
+        std::copy_n(color, 3, previous);
+    }
+
+    void DecodeColor(RangeDecoder &decoder, uint8_t previous[3]) {
+        const uint8_t green = color_models[1].Decode(decoder);
+        previous[1] = uint8_t(previous[1] + green);
+        previous[0] = uint8_t(previous[0] + green +
+                              color_models[0].Decode(decoder));
+        previous[2] = uint8_t(previous[2] + green +
+                              color_models[2].Decode(decoder));
+    }
+
+    std::vector<ByteModel> occupancy;
+    ByteModel count_model;
+    ByteModel color_models[3];
+};
+
+uint8_t ColorToByte(double value) {
+    return uint8_t(std::round(std::min(std::max(value, 0.0), 1.0) * 255.0));
+}
+
+// Leaf of the encoded octree, holding the indices of its points.
+class OPCLeafNode : public geometry::OctreeLeafNode {
+public:
+    bool operator==(const geometry::OctreeLeafNode &other) const override {
+        auto other_ptr = dynamic_cast<const OPCLeafNode *>(&other);
+        return other_ptr != nullptr && other_ptr->indices_ == indices_;
+    }
+    std::shared_ptr<geometry::OctreeLeafNode> Clone() const override {
+        return std::make_shared<OPCLeafNode>(*this);
+    }
+    bool ConvertToJsonValue(Json::Value &value) const override {
+        return false;
+    }
+    bool ConvertFromJsonValue(const Json::Value &value) override {
+        return false;
+    }
+
+    std::vector<size_t> indices_;
+};
+
+bool EncodeOPC(std::vector<uint8_t> &buffer,
+               const geometry::PointCloud &pointcloud,
+               const EncodeOPCOption &option) {
+    if (!(option.precision > 0)) {
+        utility::LogWarning("Write OPC failed: precision must be positive.");
+        return false;
+    }
+    OPCHeader header;
+    header.precision = option.precision;
+    if (option.write_colors && pointcloud.HasColors()) {
+        header.flags |= kOPCHasColors;
+    }
+
+    std::vector<size_t> valid;
+    valid.reserve(pointcloud.points_.size());
+    for (size_t i = 0; i < pointcloud.points_.size(); ++i) {
+        if (pointcloud.points_[i].allFinite()) {
+            valid.push_back(i);
+        }
+    }
+    if (!valid.empty()) {
+        header.min_bound = header.max_bound = pointcloud.points_[valid[0]];
+        for (size_t i : valid) {
+            header.min_bound = header.min_bound.cwiseMin(pointcloud.points_[i]);
+            header.max_bound = header.max_bound.cwiseMax(pointcloud.points_[i]);
+        }
+    }
+    const double extent = (header.max_bound - header.min_bound).maxCoeff();
+    while (std::ldexp(option.precision, int(header.depth)) <= extent) {
+        if (++header.depth > kOPCMaxDepth) {
+            utility::LogWarning(
+                    "Write OPC failed: precision {} is too fine for an "
+                    "extent of {}.",
+                    option.precision, extent);
+            return false;
+        }
+    }
+    header.num_points = valid.size();
+    WriteOPCHeader(header, buffer);
+    if (valid.empty()) {
+        return true;
+    }
+
+    // The octree works in units of leaves, so that the bounds of its nodes
+    // are exact and every point lands in the leaf it is quantized to.
+    const double num_leaves = std::ldexp(1.0, int(header.depth));
+    geometry::Octree octree(header.depth, Eigen::Vector3d::Zero(), num_leaves);
+    auto f_init = []() { return std::make_shared<OPCLeafNode>(); };
+    for (size_t i : valid) {
+        const Eigen::Vector3d leaf =
+                ((pointcloud.points_[i] - header.min_bound) / option.precision)
+                        .array()
+                        .floor()
+                        .min(num_leaves - 1);
+        octree.InsertPoint(
+                leaf + Eigen::Vector3d::Constant(0.5), f_init,
+                [i](std::shared_ptr<geometry::OctreeLeafNode> node) {
+                    static_cast<OPCLeafNode &>(*node).indices_.push_back(i);
+                });
+    }
+
+    RangeEncoder encoder(buffer);
+    OPCModels models(header.depth);
+    const bool has_colors = (header.flags & kOPCHasColors) != 0;
+    uint8_t previous_color[3] = {0, 0, 0};
+    uint64_t num_encoded = 0;
+    octree.Traverse([&](const std::shared_ptr<geometry::OctreeNode> &node,
+                        const std::shared_ptr<geometry::OctreeNodeInfo>
+                                &node_info) {
+        if (auto internal_node =
+                    std::dynamic_pointer_cast<geometry::OctreeInternalNode>(
+                            node)) {
+            uint8_t occupancy = 0;
+            for (int i = 0; i < 8; ++i) {
+                if (internal_node->children_[i]) {
+                    occupancy |= uint8_t(1 << i);
+                }
+            }
+            models.occupancy[node_info->depth_].Encode(encoder, occupancy);
+        } else if (auto leaf_node =
+                           std::dynamic_pointer_cast<OPCLeafNode>(node)) {
+            models.EncodeCount(encoder, leaf_node->indices_.size());
+            num_encoded += leaf_node->indices_.size();
+            if (!has_colors) {
+                return;
+            }
+            for (size_t i : leaf_node->indices_) {
+                const Eigen::Vector3d &color = pointcloud.colors_[i];
+                const uint8_t bytes[3] = {ColorToByte(color(0)),
+                                          ColorToByte(color(1)),
+                                          ColorToByte(color(2))};
+                models.EncodeColor(encoder, bytes, previous_color);
+            }
+        }
+    });
+    encoder.Flush();
+    if (num_encoded != header.num_points) {
+        utility::LogWarning("Write OPC failed: {} of {} points were encoded.",
+                            num_encoded, header.num_points);
+        return false;
+    }
+    return true;
+}
+
+class OPCDecoder {
+public:
+    typedef Eigen::Matrix<uint32_t, 3, 1> LeafIndex;
+
+
+    OPCDecoder(const OPCHeader &header,
+               const uint8_t *begin,
+               const uint8_t *end,
+               geometry::PointCloud &pointcloud)
+        : header_(header),
+          decoder_(begin, end),
+          models_(header.depth),
+          has_colors_((header.flags & kOPCHasColors) != 0),
+          pointcloud_(pointcloud) {}
+
+    bool Decode() {
+        return DecodeNode(0, LeafIndex::Zero()) &&
+               !decoder_.IsOverrun() &&
+               pointcloud_.points_.size() == header_.num_points;
+    }
+
+private:
+    // Decodes the subtree of the node at \p depth whose first leaf has the
+    // integer coordinates \p index.
+    bool DecodeNode(uint32_t depth, const LeafIndex &index) {
+        if (decoder_.IsOverrun()) {
+            return false;
+        }
+        if (depth == header_.depth) {
+            return DecodeLeaf(index);
+        }
+        const uint8_t occupancy = models_.occupancy[depth].Decode(decoder_);
+        if (occupancy == 0) {
+            return false;
+        }
+        const uint32_t child_size = 1u << (header_.depth - depth - 1);
+        for (uint32_t i = 0; i < 8; ++i) {
+            if ((occupancy >> i) & 1) {
+                const LeafIndex child_index(
+                        index(0) + (i & 1) * child_size,
+                        index(1) + ((i >> 1) & 1) * child_size,
+                        index(2) + ((i >> 2) & 1) * child_size);
+                if (!DecodeNode(depth + 1, child_index)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool DecodeLeaf(const LeafIndex &index) {
+        const uint64_t count = models_.DecodeCount(decoder_);
+        if (count > header_.num_points - pointcloud_.points_.size()) {
+            return false;
+        }
+        const Eigen::Vector3d point =
+                header_.min_bound +
+                (index.cast<double>() + Eigen::Vector3d::Constant(0.5)) *
+                        header_.precision;
+        pointcloud_.points_.insert(pointcloud_.points_.end(), count, point);
+        if (!has_colors_) {
+            return true;
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            models_.DecodeColor(decoder_, previous_color_);
+            pointcloud_.colors_.push_back(
+                    Eigen::Vector3d(previous_color_[0], previous_color_[1],
+                                    previous_color_[2]) /
+                    255.0);
+        }
+        return true;
+    }
+
+    const OPCHeader &header_;
+    RangeDecoder decoder_;
+    OPCModels models_;
+    const bool has_colors_;
+    uint8_t previous_color_[3] = {0, 0, 0};
+    geometry::PointCloud &pointcloud_;
+};
+
+}  // unnamed namespace
+
+namespace io {
+
+FileGeometry ReadFileGeometryTypeOPC(const std::string &path) {
+    return CONTAINS_POINTS;
+}
+
+bool EncodePointCloudToOPC(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const EncodeOPCOption &option /* = {}*/) {
+    std::vector<uint8_t> buffer;
+    if (!EncodeOPC(buffer, pointcloud, option)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    if (fclose(file) != 0) {
+        success = false;
+    }
+    if (!success) {
+        utility::LogWarning("Write OPC failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+bool EncodePointCloudInMemoryToOPC(std::vector<uint8_t> &buffer,
+                                   const geometry::PointCloud &pointcloud,
+                                   const EncodeOPCOption &option /* = {}*/) {
+    buffer.clear();
+    return EncodeOPC(buffer, pointcloud, option);
+}
+
+bool DecodePointCloudInMemoryFromOPC(const uint8_t *buffer,
+                                     size_t length,
+                                     geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+    OPCHeader header;
+    if (!ReadOPCHeader(buffer, length, header)) {
+        return false;
+    }
+    if (header.num_points == 0) {
+        return true;
+    }
+    OPCDecoder decoder(header, buffer + kOPCHeaderSize, buffer + length,
+                       pointcloud);
+    if (!decoder.Decode()) {
+        utility::LogWarning("Read OPC failed: the content is corrupted.");
+        pointcloud.Clear();
+        return false;
+    }
+    return true;
+}
+
+bool ReadPointCloudInfoFromOPC(const std::string &filename,
+                               PointCloudInfo &info) {
+    uint8_t buffer[kOPCHeaderSize];
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const size_t length = fread(buffer, 1, kOPCHeaderSize, file);
+    fclose(file);
+    OPCHeader header;
+    if (!ReadOPCHeader(buffer, length, header)) {
+        return false;
+    }
+    info.num_points = int64_t(header.num_points);
+    info.has_colors = (header.flags & kOPCHasColors) != 0;
+    info.has_bounds = header.num_points > 0;
+    info.min_bound = header.min_bound;
+    info.max_bound = header.max_bound;
+    return true;
+}
+
+bool ReadPointCloudFromOPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    return DecodePointCloudInMemoryFromOPC(
+            reinterpret_cast<const uint8_t *>(file.GetData()),
+            size_t(file.GetSize()), pointcloud);
+}
+
+bool WritePointCloudToOPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    return EncodePointCloudToOPC(filename, pointcloud);
+}
+
+bool ReadPointCloudInMemoryFromOPC(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    return DecodePointCloudInMemoryFromOPC(buffer, length, pointcloud);
+}
+
+bool WritePointCloudInMemoryToOPC(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    return EncodePointCloudInMemoryToOPC(buffer, pointcloud);
+}
+
+}  // namespace io
+}  // namespace open3d
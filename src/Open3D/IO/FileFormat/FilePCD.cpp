@@ -25,15 +25,19 @@
 // ----------------------------------------------------------------------------
 
 #include <liblzf/lzf.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <sstream>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Utility/ProgressReporters.h"
 
 // References for PCD file IO
@@ -78,8 +82,29 @@ public:
     bool has_points;
     bool has_normals;
     bool has_colors;
+    // Open3D extension: binary_compressed data made of independently
+    // compressed chunks of lzf_chunk_size bytes, which can be decompressed in
+    // parallel. The compressed size of every chunk is stored in header
+    // comments, so that the data remains a single LZF stream for other
+    // readers. Empty for files written by other programs.
+    std::uint32_t lzf_chunk_size = 0;
+    std::vector<std::uint32_t> lzf_chunk_sizes;
 };
 
+// Keyword of the header comments listing the LZF chunks.
+const char *const kLZFChunksComment = "OPEN3D_LZF_CHUNKS";
+// Uncompressed bytes per independently compressed chunk.
+const std::uint32_t kLZFChunkSize = 1 << 22;
+// Chunk sizes per comment line, which keeps the lines shorter than
+// DEFAULT_IO_BUFFER_SIZE.
+const size_t kLZFChunksPerComment = 64;
+
+// Number of points decoded or encoded between two progress updates, which
+// makes about a hundred updates.
+int64_t GetProgressBlockSize(int64_t count) {
+    return std::max<int64_t>(1000, std::min<int64_t>(1 << 16, count / 100));
+}
+
 bool CheckHeader(PCDHeader &header) {
     if (header.points <= 0 || header.pointsize <= 0) {
         utility::LogWarning("[CheckHeader] PCD has no data.");
@@ -146,6 +171,15 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
         std::string line_type;
         sstream >> line_type;
         if (line_type.substr(0, 1) == "#") {
+            // # OPEN3D_LZF_CHUNKS <chunk size> <compressed sizes>...
+            if (st.size() >= 3 && st[0] == "#" && st[1] == kLZFChunksComment) {
+                header.lzf_chunk_size =
+                        std::uint32_t(std::strtoul(st[2].c_str(), NULL, 10));
+                for (size_t i = 3; i < st.size(); i++) {
+                    header.lzf_chunk_sizes.push_back(std::uint32_t(
+                            std::strtoul(st[i].c_str(), NULL, 10)));
+                }
+            }
         } else if (line_type.substr(0, 7) == "VERSION") {
             if (st.size() >= 2) {
                 header.version = st[1];
@@ -236,6 +270,19 @@ bool ReadPCDHeader(FILE *file, PCDHeader &header) {
     return true;
 }
 
+// Returns the FileAttributeInfo type of field, e.g. "float32" for F 4.
+std::string GetTypeName(const PCLPointField &field) {
+    const std::string bits = std::to_string(field.size * 8);
+    switch (field.type) {
+        case 'I':
+            return "int" + bits;
+        case 'U':
+            return "uint" + bits;
+        default:
+            return "float" + bits;
+    }
+}
+
 double UnpackBinaryPCDElement(const char *data_ptr,
                               const char type,
                               const int size) {
@@ -276,6 +323,10 @@ double UnpackBinaryPCDElement(const char *data_ptr,
             std::float_t data;
             memcpy(&data, data_ptr, sizeof(data));
             return (double)data;
+        } else if (size == 8) {
+            double data;
+            memcpy(&data, data_ptr, sizeof(data));
+            return data;
         } else {
             return 0.0;
         }
@@ -332,7 +383,194 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+// Unpacks the fields of an ASCII record into point idx of pointcloud.
+void UnpackASCIIPCDRecord(const std::vector<std::string> &strs,
+                          const PCDHeader &header,
+                          geometry::PointCloud &pointcloud,
+                          size_t idx) {
+    for (size_t i = 0; i < header.fields.size(); i++) {
+        const auto &field = header.fields[i];
+        if (field.name == "x") {
+            pointcloud.points_[idx](0) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "y") {
+            pointcloud.points_[idx](1) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "z") {
+            pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "normal_x") {
+            pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "normal_y") {
+            pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "normal_z") {
+            pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        } else if (field.name == "rgb" || field.name == "rgba") {
+            pointcloud.colors_[idx] = UnpackASCIIPCDColor(
+                    strs[field.count_offset].c_str(), field.type, field.size);
+        }
+    }
+}
+
+// Where the binary fields of a PCD file go in a point cloud, resolved once
+// instead of comparing the field names for every point.
+struct PCDFieldLayout {
+    struct VectorFields {
+        std::vector<Eigen::Vector3d> *values = nullptr;
+        const PCLPointField *fields[3] = {nullptr, nullptr, nullptr};
+        // The components are consecutive floats or doubles, which are loaded
+        // at once.
+        bool packed_floats = false;
+        bool packed_doubles = false;
+    };
+    VectorFields points;
+    VectorFields normals;
+    std::vector<Eigen::Vector3d> *colors = nullptr;
+    const PCLPointField *color = nullptr;
+};
+
+PCDFieldLayout GetPCDFieldLayout(const PCDHeader &header,
+                                 geometry::PointCloud &pointcloud) {
+    static const char *const kNames[2][3] = {
+            {"x", "y", "z"}, {"normal_x", "normal_y", "normal_z"}};
+    PCDFieldLayout layout;
+    PCDFieldLayout::VectorFields *vectors[2] = {&layout.points,
+                                                &layout.normals};
+    for (const auto &field : header.fields) {
+        for (int v = 0; v < 2; v++) {
+            for (int k = 0; k < 3; k++) {
+                if (field.name == kNames[v][k]) {
+                    vectors[v]->fields[k] = &field;
+                }
+            }
+        }
+        if (field.name == "rgb" || field.name == "rgba") {
+            layout.color = &field;
+        }
+    }
+    layout.points.values = &pointcloud.points_;
+    if (header.has_normals) {
+        layout.normals.values = &pointcloud.normals_;
+    }
+    if (header.has_colors) {
+        layout.colors = &pointcloud.colors_;
+    }
+    for (PCDFieldLayout::VectorFields *vector : vectors) {
+        const PCLPointField *const *f = vector->fields;
+        if (vector->values == nullptr || f[0]->type != 'F' ||
+            f[1]->type != 'F' || f[2]->type != 'F' ||
+            f[1]->size != f[0]->size || f[2]->size != f[0]->size ||
+            f[1]->offset != f[0]->offset + f[0]->size ||
+            f[2]->offset != f[1]->offset + f[0]->size) {
+            continue;
+        }
+        vector->packed_floats = f[0]->size == 4;
+        vector->packed_doubles = f[0]->size == 8;
+    }
+    return layout;
+}
+
+void DecodePCDVector(const char *record,
+                     const PCDFieldLayout::VectorFields &vector,
+                     int64_t i) {
+    Eigen::Vector3d &value = (*vector.values)[i];
+    const char *src = record + vector.fields[0]->offset;
+    if (vector.packed_doubles) {
+        memcpy(value.data(), src, 3 * sizeof(double));
+    } else if (vector.packed_floats) {
+        float data[3];
+        memcpy(data, src, sizeof(data));
+        value = Eigen::Vector3d(data[0], data[1], data[2]);
+    } else {
+        for (int k = 0; k < 3; k++) {
+            const PCLPointField &field = *vector.fields[k];
+            value(k) = UnpackBinaryPCDElement(record + field.offset,
+                                              field.type, field.size);
+        }
+    }
+}
+
+// Decodes the binary record of point i.
+void DecodePCDRecord(const char *record,
+                     const PCDFieldLayout &layout,
+                     int64_t i) {
+    DecodePCDVector(record, layout.points, i);
+    if (layout.normals.values != nullptr) {
+        DecodePCDVector(record, layout.normals, i);
+    }
+    if (layout.colors != nullptr) {
+        (*layout.colors)[i] =
+                UnpackBinaryPCDColor(record + layout.color->offset,
+                                     layout.color->type, layout.color->size);
+    }
+}
+
+// Decodes point i from the column-major data of binary_compressed files.
+void DecodePCDColumns(const char *data,
+                      const PCDHeader &header,
+                      const PCDFieldLayout &layout,
+                      int64_t i) {
+    auto element = [&](const PCLPointField &field) {
+        return data + int64_t(field.offset) * header.points +
+               i * field.size * field.count;
+    };
+    for (const PCDFieldLayout::VectorFields *vector :
+         {&layout.points, &layout.normals}) {
+        if (vector->values == nullptr) {
+            continue;
+        }
+        for (int k = 0; k < 3; k++) {
+            const PCLPointField &field = *vector->fields[k];
+            (*vector->values)[i](k) = UnpackBinaryPCDElement(
+                    element(field), field.type, field.size);
+        }
+    }
+    if (layout.colors != nullptr) {
+        (*layout.colors)[i] = UnpackBinaryPCDColor(
+                element(*layout.color), layout.color->type,
+                layout.color->size);
+    }
+}
+
+// Decompresses binary_compressed data, in parallel if it is made of
+// independently compressed chunks.
+bool DecompressPCDData(const char *compressed,
+                       std::uint32_t compressed_size,
+                       char *data,
+                       std::uint32_t size,
+                       const PCDHeader &header) {
+    const std::vector<std::uint32_t> &chunk_sizes = header.lzf_chunk_sizes;
+    const int64_t num_chunks = int64_t(chunk_sizes.size());
+    const int64_t chunk_size = header.lzf_chunk_size;
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    for (int64_t c = 0; c < num_chunks; c++) {
+        chunk_offsets[c + 1] = chunk_offsets[c] + chunk_sizes[c];
+    }
+    if (num_chunks == 0 || chunk_size == 0 ||
+        chunk_offsets.back() != compressed_size ||
+        (size + chunk_size - 1) / chunk_size != num_chunks) {
+        return lzf_decompress(compressed, (unsigned int)compressed_size, data,
+                              (unsigned int)size) == size;
+    }
+    std::vector<char> chunk_ok(num_chunks);
+    utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+        const int64_t begin = c * chunk_size;
+        const unsigned int length =
+                (unsigned int)std::min<int64_t>(chunk_size, size - begin);
+        chunk_ok[c] = lzf_decompress(compressed + chunk_offsets[c],
+                                     chunk_sizes[c], data + begin,
+                                     length) == length;
+    });
+    return std::all_of(chunk_ok.begin(), chunk_ok.end(),
+                       [](char ok) { return ok != 0; });
+}
+
 bool ReadPCDData(FILE *file,
+                 const char *content,
+                 int64_t content_size,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
                  const ReadPointCloudOption &params) {
@@ -364,86 +602,35 @@ bool ReadPCDData(FILE *file,
             if ((int)strs.size() < header.elementnum) {
                 continue;
             }
-            for (size_t i = 0; i < header.fields.size(); i++) {
-                const auto &field = header.fields[i];
-                if (field.name == "x") {
-                    pointcloud.points_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[idx] = UnpackASCIIPCDColor(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                }
-            }
+            UnpackASCIIPCDRecord(strs, header, pointcloud, idx);
             idx++;
             if (idx % 1000 == 0) {
                 reporter.Update(idx);
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; i++) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "x") {
-                    pointcloud.points_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[i](0) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[i](1) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[i](2) =
-                            UnpackBinaryPCDElement(buffer.get() + field.offset,
-                                                   field.type, field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[i] =
-                            UnpackBinaryPCDColor(buffer.get() + field.offset,
-                                                 field.type, field.size);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        // The records are decoded in parallel straight from the content.
+        const int64_t data_offset = ftell(file);
+        if (data_offset < 0 || data_offset > content_size ||
+            (content_size - data_offset) / header.pointsize < header.points) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            pointcloud.Clear();
+            return false;
+        }
+        const char *data = content + data_offset;
+        const PCDFieldLayout layout = GetPCDFieldLayout(header, pointcloud);
+        const int64_t block_size = GetProgressBlockSize(header.points);
+        for (int64_t begin = 0; begin < header.points; begin += block_size) {
+            const int64_t end =
+                    std::min<int64_t>(header.points, begin + block_size);
+            utility::ParallelFor(
+                    begin, end,
+                    [&](int64_t i) {
+                        DecodePCDRecord(data + i * header.pointsize, layout,
+                                        i);
+                    },
+                    4096);
+            reporter.Update(end);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         double reporter_total = 100.0;
@@ -474,79 +661,49 @@ bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
+        if (uncompressed_size / header.pointsize <
+            std::uint32_t(header.points)) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            pointcloud.Clear();
+            return false;
+        }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
         reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!DecompressPCDData(buffer_compressed.get(), compressed_size,
+                               buffer.get(), uncompressed_size, header)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
         }
-        for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            }
+        buffer_compressed.reset();
+        reporter.Update(int(reporter_total * .5));
+        const PCDFieldLayout layout = GetPCDFieldLayout(header, pointcloud);
+        const int64_t block_size = GetProgressBlockSize(header.points);
+        for (int64_t begin = 0; begin < header.points; begin += block_size) {
+            const int64_t end =
+                    std::min<int64_t>(header.points, begin + block_size);
+            utility::ParallelFor(
+                    begin, end,
+                    [&](int64_t i) {
+                        DecodePCDColumns(buffer.get(), header, layout, i);
+                    },
+                    4096);
+            reporter.Update(int(reporter_total *
+                                (.5 + .5 * double(end) / header.points)));
         }
     }
     reporter.Finish();
     return true;
 }
 
-bool GenerateHeader(const geometry::PointCloud &pointcloud,
+void GenerateHeader(const bool has_normals,
+                    const bool has_colors,
+                    const int points,
                     const bool write_ascii,
                     const bool compressed,
                     PCDHeader &header) {
-    if (!pointcloud.HasPoints()) {
-        return false;
-    }
     header.version = "0.7";
-    header.width = (int)pointcloud.points_.size();
+    header.width = points;
     header.height = 1;
     header.points = header.width;
     header.fields.clear();
@@ -562,7 +719,7 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
     header.fields.push_back(field);
     header.elementnum = 3;
     header.pointsize = 12;
-    if (pointcloud.HasNormals()) {
+    if (has_normals) {
         field.name = "normal_x";
         header.fields.push_back(field);
         field.name = "normal_y";
@@ -572,7 +729,7 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
         header.elementnum += 3;
         header.pointsize += 12;
     }
-    if (pointcloud.HasColors()) {
+    if (has_colors) {
         field.name = "rgb";
         header.fields.push_back(field);
         header.elementnum++;
@@ -587,12 +744,46 @@ bool GenerateHeader(const geometry::PointCloud &pointcloud,
             header.datatype = PCD_DATA_BINARY;
         }
     }
+}
+
+bool GenerateHeader(const geometry::PointCloud &pointcloud,
+                    const bool write_ascii,
+                    const bool compressed,
+                    PCDHeader &header) {
+    if (!pointcloud.HasPoints()) {
+        return false;
+    }
+    GenerateHeader(pointcloud.HasNormals(), pointcloud.HasColors(),
+                   (int)pointcloud.points_.size(), write_ascii, compressed,
+                   header);
     return true;
 }
 
-bool WritePCDHeader(FILE *file, const PCDHeader &header) {
+// Writes count, or if count_positions is not null reserves room for a larger
+// count and records its position.
+void WritePCDCount(FILE *file, int count, std::vector<long> *count_positions) {
+    if (count_positions != nullptr) {
+        count_positions->push_back(ftell(file));
+        fprintf(file, "%-20d\n", count);
+    } else {
+        fprintf(file, "%d\n", count);
+    }
+}
+
+bool WritePCDHeader(FILE *file,
+                    const PCDHeader &header,
+                    std::vector<long> *count_positions = nullptr) {
     fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
             header.version.c_str());
+    const std::vector<std::uint32_t> &chunk_sizes = header.lzf_chunk_sizes;
+    for (size_t c = 0; c < chunk_sizes.size(); c += kLZFChunksPerComment) {
+        fprintf(file, "# %s %u", kLZFChunksComment, header.lzf_chunk_size);
+        for (size_t i = c;
+             i < std::min(chunk_sizes.size(), c + kLZFChunksPerComment); i++) {
+            fprintf(file, " %u", chunk_sizes[i]);
+        }
+        fprintf(file, "\n");
+    }
     fprintf(file, "VERSION %s\n", header.version.c_str());
     fprintf(file, "FIELDS");
     for (const auto &field : header.fields) {
@@ -614,10 +805,12 @@ bool WritePCDHeader(FILE *file, const PCDHeader &header) {
         fprintf(file, " %d", field.count);
     }
     fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
+    fprintf(file, "WIDTH ");
+    WritePCDCount(file, header.width, count_positions);
     fprintf(file, "HEIGHT %d\n", header.height);
     fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
+    fprintf(file, "POINTS ");
+    WritePCDCount(file, header.points, count_positions);
 
     switch (header.datatype) {
         case PCD_DATA_BINARY:
@@ -642,107 +835,455 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+void WriteASCIIPCDRecord(FILE *file,
+                         const geometry::PointCloud &pointcloud,
+                         size_t i,
+                         bool has_normal,
+                         bool has_color) {
+    const auto &point = pointcloud.points_[i];
+    fprintf(file, "%.10g %.10g %.10g", point(0), point(1), point(2));
+    if (has_normal) {
+        const auto &normal = pointcloud.normals_[i];
+        fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1), normal(2));
+    }
+    if (has_color) {
+        const auto &color = pointcloud.colors_[i];
+        fprintf(file, " %.10g", ConvertRGBToFloat(color));
+    }
+    fprintf(file, "\n");
+}
+
+void PackBinaryPCDRecord(const geometry::PointCloud &pointcloud,
+                         size_t i,
+                         bool has_normal,
+                         bool has_color,
+                         float *data) {
+    const auto &point = pointcloud.points_[i];
+    data[0] = (float)point(0);
+    data[1] = (float)point(1);
+    data[2] = (float)point(2);
+    int idx = 3;
+    if (has_normal) {
+        const auto &normal = pointcloud.normals_[i];
+        data[idx + 0] = (float)normal(0);
+        data[idx + 1] = (float)normal(1);
+        data[idx + 2] = (float)normal(2);
+        idx += 3;
+    }
+    if (has_color) {
+        const auto &color = pointcloud.colors_[i];
+        data[idx] = ConvertRGBToFloat(color);
+    }
+}
+
+// Packs the points column by column, as PCL does, and compresses chunks of
+// kLZFChunkSize bytes in parallel. The chunks form a single LZF stream, since
+// LZF back references never reach before the start of a chunk. Reports
+// progress up to 75% of 2 * points.
+bool CompressPCDData(const geometry::PointCloud &pointcloud,
+                     PCDHeader &header,
+                     std::vector<std::vector<char>> &compressed_chunks,
+                     utility::CountingProgressReporter &reporter) {
+    const bool has_normal = pointcloud.HasNormals();
+    const bool has_color = pointcloud.HasColors();
+    const int64_t num_points = header.points;
+    const int64_t size = int64_t(header.elementnum) * num_points;
+    if (size * int64_t(sizeof(float)) > int64_t(UINT32_MAX)) {
+        utility::LogWarning(
+                "[WritePCDData] Too many points for binary_compressed data.");
+        return false;
+    }
+    std::vector<float> buffer(size);
+    const int64_t block_size = GetProgressBlockSize(num_points);
+    for (int64_t begin = 0; begin < num_points; begin += block_size) {
+        const int64_t end = std::min(num_points, begin + block_size);
+        utility::ParallelFor(
+                begin, end,
+                [&](int64_t i) {
+                    // x y z, normal_x normal_y normal_z, rgb
+                    float record[7];
+                    PackBinaryPCDRecord(pointcloud, i, has_normal, has_color,
+                                        record);
+                    for (int e = 0; e < header.elementnum; e++) {
+                        buffer[e * num_points + i] = record[e];
+                    }
+                },
+                4096);
+        reporter.Update(end);
+    }
+
+    const char *data = reinterpret_cast<const char *>(buffer.data());
+    const int64_t size_in_bytes = size * int64_t(sizeof(float));
+    const int64_t num_chunks =
+            (size_in_bytes + kLZFChunkSize - 1) / kLZFChunkSize;
+    compressed_chunks.assign(num_chunks, std::vector<char>());
+    header.lzf_chunk_size = kLZFChunkSize;
+    header.lzf_chunk_sizes.assign(num_chunks, 0);
+    utility::ParallelFor(0, num_chunks, [&](int64_t c) {
+        const int64_t begin = c * kLZFChunkSize;
+        const unsigned int length = (unsigned int)std::min<int64_t>(
+                kLZFChunkSize, size_in_bytes - begin);
+        std::vector<char> &chunk = compressed_chunks[c];
+        chunk.resize(length + length / 16 + 64);
+        chunk.resize(lzf_compress(data + begin, length, chunk.data(),
+                                  (unsigned int)chunk.size()));
+        header.lzf_chunk_sizes[c] = std::uint32_t(chunk.size());
+    });
+    for (const std::vector<char> &chunk : compressed_chunks) {
+        if (chunk.empty()) {
+            utility::LogWarning("[WritePCDData] Failed to compress data.");
+            return false;
+        }
+    }
+    utility::LogDebug(
+            "[WritePCDData] {:d} bytes data compressed into {:d} chunks.",
+            size_in_bytes, num_chunks);
+    reporter.Update(int64_t(num_points * 2 * 0.75));
+    return true;
+}
+
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
                   const geometry::PointCloud &pointcloud,
-                  const WritePointCloudOption &params) {
+                  const std::vector<std::vector<char>> &compressed_chunks,
+                  utility::CountingProgressReporter &reporter) {
     bool has_normal = pointcloud.HasNormals();
     bool has_color = pointcloud.HasColors();
-    utility::CountingProgressReporter reporter(params.update_progress);
-    reporter.SetTotal(pointcloud.points_.size());
     if (header.datatype == PCD_DATA_ASCII) {
         for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            fprintf(file, "%.10g %.10g %.10g", point(0), point(1), point(2));
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1),
-                        normal(2));
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                fprintf(file, " %.10g", ConvertRGBToFloat(color));
-            }
-            fprintf(file, "\n");
+            WriteASCIIPCDRecord(file, pointcloud, i, has_normal, has_color);
             if (i % 1000 == 0) {
                 reporter.Update(i);
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
-        std::unique_ptr<float[]> data(new float[header.elementnum]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            data[0] = (float)point(0);
-            data[1] = (float)point(1);
-            data[2] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                data[idx + 0] = (float)normal(0);
-                data[idx + 1] = (float)normal(1);
-                data[idx + 2] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                data[idx] = ConvertRGBToFloat(color);
-            }
-            fwrite(data.get(), sizeof(float), header.elementnum, file);
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        // Blocks of records are packed in parallel and written at once.
+        const int64_t num_points = int64_t(pointcloud.points_.size());
+        const int64_t block_size = GetProgressBlockSize(num_points);
+        std::vector<float> data(block_size * header.elementnum);
+        for (int64_t begin = 0; begin < num_points; begin += block_size) {
+            const int64_t end = std::min(num_points, begin + block_size);
+            utility::ParallelFor(
+                    begin, end,
+                    [&](int64_t i) {
+                        PackBinaryPCDRecord(
+                                pointcloud, i, has_normal, has_color,
+                                data.data() + (i - begin) * header.elementnum);
+                    },
+                    4096);
+            const size_t count = size_t((end - begin) * header.elementnum);
+            if (fwrite(data.data(), sizeof(float), count, file) != count) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
             }
+            reporter.Update(end);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double report_total = double(pointcloud.points_.size() * 2);
+        std::uint32_t size_compressed = 0;
+        for (const std::vector<char> &chunk : compressed_chunks) {
+            size_compressed += std::uint32_t(chunk.size());
+        }
+        std::uint32_t buffer_size_in_bytes = std::uint32_t(
+                header.elementnum * header.points * sizeof(float));
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+        for (const std::vector<char> &chunk : compressed_chunks) {
+            if (fwrite(chunk.data(), 1, chunk.size(), file) != chunk.size()) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
+            }
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+// Streams the records of uncompressed PCD files. Compressed files store the
+// fields one after the other, so they are read at once.
+// Reads the PCD file at the current position of file, whose whole content is
+// also at [content, content + content_size) to decode binary data in place.
+bool ReadPCD(FILE *file,
+             const char *content,
+             int64_t content_size,
+             geometry::PointCloud &pointcloud,
+             const ReadPointCloudOption &params) {
+    PCDHeader header;
+    if (!ReadPCDHeader(file, header)) {
+        utility::LogWarning("Read PCD failed: unable to parse header.");
+        return false;
+    }
+    utility::LogDebug(
+            "PCD header indicates {:d} fields, {:d} bytes per point, and {:d} "
+            "points in total.",
+            (int)header.fields.size(), header.pointsize, header.points);
+    for (const auto &field : header.fields) {
+        utility::LogDebug("{}, {}, {:d}, {:d}, {:d}", field.name.c_str(),
+                          field.type, field.size, field.count, field.offset);
+    }
+    utility::LogDebug("Compression method is {:d}.", (int)header.datatype);
+    utility::LogDebug("Points: {};  normals: {};  colors: {}",
+                      header.has_points ? "yes" : "no",
+                      header.has_normals ? "yes" : "no",
+                      header.has_colors ? "yes" : "no");
+    if (!ReadPCDData(file, content, content_size, header, pointcloud,
+                     params)) {
+        utility::LogWarning("Read PCD failed: unable to read data.");
+        return false;
+    }
+    return true;
+}
+
+// Writes pointcloud, described by header, to file.
+bool WritePCD(FILE *file,
+              PCDHeader &header,
+              const geometry::PointCloud &pointcloud,
+              const WritePointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    std::vector<std::vector<char>> compressed_chunks;
+    if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
         // 0%-50% packing into buffer
         // 50%-75% compressing buffer
         // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
+        reporter.SetTotal(int64_t(header.points) * 2);
+        if (!CompressPCDData(pointcloud, header, compressed_chunks,
+                             reporter)) {
+            utility::LogWarning("Write PCD failed: unable to compress data.");
+            return false;
+        }
+    } else {
+        reporter.SetTotal(header.points);
+    }
+    if (!WritePCDHeader(file, header)) {
+        utility::LogWarning("Write PCD failed: unable to write header.");
+        return false;
+    }
+    if (!WritePCDData(file, header, pointcloud, compressed_chunks,
+                      reporter)) {
+        utility::LogWarning("Write PCD failed: unable to write data.");
+        return false;
+    }
+    return true;
+}
+
+class PCDPointCloudStreamReader : public PointCloudStreamReader {
+public:
+    ~PCDPointCloudStreamReader() override { Close(); }
+
+public:
+    bool Open(const std::string &filename) override {
+        Close();
+        try {
+            if (!file_.Open(filename, "rb")) {
+                utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                    filename);
+                return false;
             }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
+            if (!ReadPCDHeader(file_.GetFILE(), header_)) {
+                utility::LogWarning("Read PCD failed: unable to parse header.");
+                Close();
+                return false;
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read PCD failed with exception: {}",
+                                e.what());
+            Close();
+            return false;
+        }
+        if (header_.datatype == PCD_DATA_BINARY_COMPRESSED) {
+            Close();
+            geometry::PointCloud pointcloud;
+            if (!ReadPointCloudFromPCD(filename, pointcloud, {})) {
+                return false;
             }
+            utility::LogDebug("PCD file {} is compressed, read it at once.",
+                              filename);
+            SetInMemoryPointCloud(std::move(pointcloud));
+            return true;
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
+        num_points_ = header_.points;
+        has_normals_ = header_.has_normals;
+        has_colors_ = header_.has_colors;
+        return true;
+    }
+
+    void Close() override {
+        try {
+            file_.Close();
+        } catch (const std::exception &) {
+        }
+        header_ = PCDHeader();
+        position_ = 0;
+        num_points_ = -1;
+        has_normals_ = false;
+        has_colors_ = false;
+        in_memory_ = false;
+        in_memory_pointcloud_.Clear();
+    }
+
+    int64_t ReadChunk(geometry::PointCloud &chunk,
+                      int64_t max_points) override {
+        if (in_memory_) {
+            return ReadChunkInMemory(chunk, max_points);
+        }
+        if (file_.GetFILE() == nullptr) {
+            return -1;
+        }
+        const int64_t count = std::max<int64_t>(
+                0, std::min(max_points, num_points_ - position_));
+        ResizeChunk(chunk, count);
+        int64_t num_read = 0;
+        try {
+            if (header_.datatype == PCD_DATA_ASCII) {
+                std::vector<std::string> strs;
+                const char *line;
+                while (num_read < count && (line = file_.ReadLine())) {
+                    strs.clear();
+                    utility::SplitString(strs, line, "\t\r\n ");
+                    if ((int)strs.size() < header_.elementnum) {
+                        continue;
+                    }
+                    UnpackASCIIPCDRecord(strs, header_, chunk, num_read++);
+                }
+            } else {
+                buffer_.resize(count * header_.pointsize);
+                num_read = int64_t(file_.ReadData(buffer_.data(),
+                                                  header_.pointsize, count));
+                if (num_read < count) {
+                    utility::LogWarning(
+                            "Read PCD failed: unable to read data record.");
+                    return -1;
+                }
+                const PCDFieldLayout layout =
+                        GetPCDFieldLayout(header_, chunk);
+                utility::ParallelFor(
+                        0, num_read,
+                        [&](int64_t i) {
+                            DecodePCDRecord(
+                                    buffer_.data() + i * header_.pointsize,
+                                    layout, i);
+                        },
+                        4096);
+            }
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read PCD failed with exception: {}",
+                                e.what());
+            return -1;
+        }
+        ResizeChunk(chunk, num_read);
+        position_ += num_read;
+        return num_read;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    PCDHeader header_;
+    int64_t position_ = 0;
+    std::vector<char> buffer_;
+};
+
+// Writes PCD files like WritePointCloudToPCD(), with the number of points
+// filled in on Close(). Compression needs all the points, so compressed
+// files are written uncompressed.
+class PCDPointCloudStreamWriter : public PointCloudStreamWriter {
+public:
+    ~PCDPointCloudStreamWriter() override { Close(); }
+
+public:
+    bool Open(const std::string &filename,
+              bool has_normals,
+              bool has_colors,
+              const WritePointCloudOption &params) override {
+        Close();
+        if (!bool(params.write_ascii) && bool(params.compressed)) {
+            utility::LogWarning(
+                    "Write PCD: compression is not supported when writing in "
+                    "chunks, the data is written uncompressed.");
+        }
+        GenerateHeader(has_normals, has_colors, 0, bool(params.write_ascii),
+                       false, header_);
+        try {
+            if (!file_.Open(filename, "wb")) {
+                utility::LogWarning("Write PCD failed: unable to open file.");
+                return false;
+            }
+            has_normals_ = has_normals;
+            has_colors_ = has_colors;
+            num_points_written_ = 0;
+            count_positions_.clear();
+            if (!WritePCDHeader(file_.GetFILE(), header_, &count_positions_)) {
+                utility::LogWarning(
+                        "Write PCD failed: unable to write header.");
+                file_.Close();
+                return false;
+            }
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write PCD failed with exception: {}",
+                                e.what());
             return false;
         }
-        utility::LogDebug(
-                "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
     }
-    reporter.Finish();
-    return true;
-}
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_.GetFILE() == nullptr || !CheckChunk(chunk)) {
+            return false;
+        }
+        const int64_t count = int64_t(chunk.points_.size());
+        if (header_.datatype == PCD_DATA_ASCII) {
+            for (int64_t i = 0; i < count; i++) {
+                WriteASCIIPCDRecord(file_.GetFILE(), chunk, i, has_normals_,
+                                    has_colors_);
+            }
+        } else {
+            buffer_.resize(count * header_.elementnum);
+            utility::ParallelFor(
+                    0, count,
+                    [&](int64_t i) {
+                        PackBinaryPCDRecord(
+                                chunk, i, has_normals_, has_colors_,
+                                buffer_.data() + i * header_.elementnum);
+                    },
+                    4096);
+            if (fwrite(buffer_.data(), sizeof(float), buffer_.size(),
+                       file_.GetFILE()) != buffer_.size()) {
+                utility::LogWarning("Write PCD failed: unable to write data.");
+                return false;
+            }
+        }
+        num_points_written_ += count;
+        return true;
+    }
+
+    bool Close() override {
+        if (file_.GetFILE() == nullptr) {
+            return true;
+        }
+        try {
+            for (long position : count_positions_) {
+                if (fseek(file_.GetFILE(), position, SEEK_SET) != 0 ||
+                    fprintf(file_.GetFILE(), "%-20d",
+                            (int)num_points_written_) < 0) {
+                    utility::LogWarning(
+                            "Write PCD failed: unable to write header.");
+                    file_.Close();
+                    return false;
+                }
+            }
+            file_.Close();
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write PCD failed with exception: {}",
+                                e.what());
+            return false;
+        }
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    PCDHeader header_;
+    std::vector<long> count_positions_;
+    std::vector<float> buffer_;
+};
 
 }  // unnamed namespace
 
@@ -754,38 +1295,63 @@ FileGeometry ReadFileGeometryTypePCD(const std::string &path) {
 bool ReadPointCloudFromPCD(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
-    PCDHeader header;
+    utility::filesystem::MappedFile content;
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL || !content.Open(filename)) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        if (file != NULL) {
+            fclose(file);
+        }
+        return false;
+    }
+    const bool success = ReadPCD(file, content.GetData(), content.GetSize(),
+                                 pointcloud, params);
+    fclose(file);
+    return success;
+}
+
+bool ReadPointCloudInfoFromPCD(const std::string &filename,
+                               PointCloudInfo &info) {
     FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
     if (file == NULL) {
         utility::LogWarning("Read PCD failed: unable to open file: {}",
                             filename);
         return false;
     }
-    if (!ReadPCDHeader(file, header)) {
+    PCDHeader header;
+    const bool success = ReadPCDHeader(file, header);
+    fclose(file);
+    if (!success) {
         utility::LogWarning("Read PCD failed: unable to parse header.");
-        fclose(file);
         return false;
     }
-    utility::LogDebug(
-            "PCD header indicates {:d} fields, {:d} bytes per point, and {:d} "
-            "points in total.",
-            (int)header.fields.size(), header.pointsize, header.points);
+    info.num_points = header.points;
     for (const auto &field : header.fields) {
-        utility::LogDebug("{}, {}, {:d}, {:d}, {:d}", field.name.c_str(),
-                          field.type, field.size, field.count, field.offset);
+        FileAttributeInfo attribute;
+        attribute.name = field.name;
+        attribute.type = header.datatype == PCD_DATA_ASCII
+                                 ? "ascii"
+                                 : GetTypeName(field);
+        attribute.count = field.count;
+        info.attributes.push_back(attribute);
     }
-    utility::LogDebug("Compression method is {:d}.", (int)header.datatype);
-    utility::LogDebug("Points: {};  normals: {};  colors: {}",
-                      header.has_points ? "yes" : "no",
-                      header.has_normals ? "yes" : "no",
-                      header.has_colors ? "yes" : "no");
-    if (!ReadPCDData(file, header, pointcloud, params)) {
-        utility::LogWarning("Read PCD failed: unable to read data.");
-        fclose(file);
+    info.has_normals = header.has_normals;
+    info.has_colors = header.has_colors;
+    return true;
+}
+
+bool ReadPointCloudInMemoryFromPCD(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForReading(buffer, length)) {
+        utility::LogWarning("Read PCD failed: unable to open memory.");
         return false;
     }
-    fclose(file);
-    return true;
+    return ReadPCD(file.GetFILE(), reinterpret_cast<const char *>(buffer),
+                   int64_t(length), pointcloud, params);
 }
 
 bool WritePointCloudToPCD(const std::string &filename,
@@ -802,19 +1368,44 @@ bool WritePointCloudToPCD(const std::string &filename,
         utility::LogWarning("Write PCD failed: unable to open file.");
         return false;
     }
-    if (!WritePCDHeader(file, header)) {
-        utility::LogWarning("Write PCD failed: unable to write header.");
-        fclose(file);
+    const bool success = WritePCD(file, header, pointcloud, params);
+    fclose(file);
+    return success;
+}
+
+bool WritePointCloudInMemoryToPCD(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    PCDHeader header;
+    if (!GenerateHeader(pointcloud, bool(params.write_ascii),
+                        bool(params.compressed), header)) {
+        utility::LogWarning("Write PCD failed: unable to generate header.");
         return false;
     }
-    if (!WritePCDData(file, header, pointcloud, params)) {
-        utility::LogWarning("Write PCD failed: unable to write data.");
-        fclose(file);
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting()) {
+        utility::LogWarning("Write PCD failed: unable to open memory.");
+        return false;
+    }
+    if (!WritePCD(file.GetFILE(), header, pointcloud, params)) {
+        return false;
+    }
+    if (!file.TakeContent(buffer)) {
+        utility::LogWarning("Write PCD failed: unable to write to memory.");
         return false;
     }
-    fclose(file);
     return true;
 }
 
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReaderPCD() {
+    return std::unique_ptr<PointCloudStreamReader>(
+            new PCDPointCloudStreamReader());
+}
+
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriterPCD() {
+    return std::unique_ptr<PointCloudStreamWriter>(
+            new PCDPointCloudStreamWriter());
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -26,13 +26,21 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/LineSetIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Utility/ProgressReporters.h"
+#include "Open3D/Utility/TextParser.h"
 
 namespace open3d {
 
@@ -107,6 +115,63 @@ int ReadColorCallback(p_ply_argument argument) {
     return 1;
 }
 
+// Reads the point cloud of ply_file with rply and closes it.
+bool ReadPointCloud(p_ply ply_file,
+                    geometry::PointCloud &pointcloud,
+                    const ReadPointCloudOption &params) {
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYReaderState state;
+    state.pointcloud_ptr = &pointcloud;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
+                                       ReadNormalCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+
+    state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
+                                      ReadColorCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+
+    if (state.vertex_num <= 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.vertex_index = 0;
+    state.normal_index = 0;
+    state.color_index = 0;
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(state.vertex_num);
+    pointcloud.normals_.resize(state.normal_num);
+    pointcloud.colors_.resize(state.color_num);
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(state.vertex_num);
+    state.progress_bar = &reporter;
+
+    if (!ply_read(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to read data.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    ply_close(ply_file);
+    reporter.Finish();
+    return true;
+}
+
 }  // namespace ply_pointcloud_reader
 
 namespace ply_trianglemesh_reader {
@@ -208,6 +273,70 @@ int ReadFaceCallBack(p_ply_argument argument) {
     return 1;
 }
 
+// Reads the mesh of ply_file with rply and closes it.
+bool ReadTriangleMesh(p_ply ply_file,
+                      geometry::TriangleMesh &mesh,
+                      bool print_progress) {
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYReaderState state;
+    state.mesh_ptr = &mesh;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
+                                       ReadNormalCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+
+    state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
+                                      ReadColorCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+
+    if (state.vertex_num <= 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.face_num = ply_set_read_cb(ply_file, "face", "vertex_indices",
+                                     ReadFaceCallBack, &state, 0);
+    if (state.face_num == 0) {
+        state.face_num = ply_set_read_cb(ply_file, "face", "vertex_index",
+                                         ReadFaceCallBack, &state, 0);
+    }
+
+    state.vertex_index = 0;
+    state.normal_index = 0;
+    state.color_index = 0;
+    state.face_index = 0;
+
+    mesh.Clear();
+    mesh.vertices_.resize(state.vertex_num);
+    mesh.vertex_normals_.resize(state.normal_num);
+    mesh.vertex_colors_.resize(state.color_num);
+
+    utility::ConsoleProgressBar progress_bar(state.vertex_num + state.face_num,
+                                             "Reading PLY: ", print_progress);
+    state.progress_bar = &progress_bar;
+
+    if (!ply_read(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to read data.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    ply_close(ply_file);
+    return true;
+}
+
 }  // namespace ply_trianglemesh_reader
 
 namespace ply_lineset_reader {
@@ -355,6 +484,1140 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_binary_reader {
+
+// Fast path for binary PLY files: the header is parsed by hand, the file is
+// memory mapped, and fixed-size vertex and triangle blocks are decoded in
+// parallel straight into the geometry. Layouts it does not handle, e.g.
+// ASCII files, polygons or list properties before the decoded elements, are
+// left to rply. ASCII headers are parsed as well for the stream reader.
+
+enum class PLYType { Int8, UInt8, Int16, UInt16, Int32, UInt32, Float, Double };
+
+struct PLYProperty {
+    std::string name;
+    PLYType type;
+    bool is_list;
+    PLYType count_type;
+    // Byte offset in the element, for scalar properties of fixed-size
+    // elements.
+    int64_t offset;
+};
+
+struct PLYElement {
+    std::string name;
+    int64_t count;
+    std::vector<PLYProperty> properties;
+    // Byte size of one element without list properties, 0 otherwise.
+    int64_t stride;
+
+    const PLYProperty *Find(const std::string &property_name) const {
+        for (const PLYProperty &property : properties) {
+            if (property.name == property_name) {
+                return &property;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Number of points or triangles decoded between two progress updates, which
+// makes about a hundred updates.
+int64_t GetChunkSize(int64_t count) {
+    return std::max<int64_t>(1000, std::min<int64_t>(1 << 16, count / 100));
+}
+
+int64_t TypeSize(PLYType type) {
+    switch (type) {
+        case PLYType::Int8:
+        case PLYType::UInt8:
+            return 1;
+        case PLYType::Int16:
+        case PLYType::UInt16:
+            return 2;
+        case PLYType::Int32:
+        case PLYType::UInt32:
+        case PLYType::Float:
+            return 4;
+        case PLYType::Double:
+            return 8;
+    }
+    return 0;
+}
+
+bool ParseType(const std::string &name, PLYType &type) {
+    static const std::pair<const char *, PLYType> kTypes[] = {
+            {"char", PLYType::Int8},     {"int8", PLYType::Int8},
+            {"uchar", PLYType::UInt8},   {"uint8", PLYType::UInt8},
+            {"short", PLYType::Int16},   {"int16", PLYType::Int16},
+            {"ushort", PLYType::UInt16}, {"uint16", PLYType::UInt16},
+            {"int", PLYType::Int32},     {"int32", PLYType::Int32},
+            {"uint", PLYType::UInt32},   {"uint32", PLYType::UInt32},
+            {"float", PLYType::Float},   {"float32", PLYType::Float},
+            {"double", PLYType::Double}, {"float64", PLYType::Double}};
+    for (const auto &entry : kTypes) {
+        if (name == entry.first) {
+            type = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *TypeName(PLYType type) {
+    switch (type) {
+        case PLYType::Int8:
+            return "int8";
+        case PLYType::UInt8:
+            return "uint8";
+        case PLYType::Int16:
+            return "int16";
+        case PLYType::UInt16:
+            return "uint16";
+        case PLYType::Int32:
+            return "int32";
+        case PLYType::UInt32:
+            return "uint32";
+        case PLYType::Float:
+            return "float32";
+        case PLYType::Double:
+            return "float64";
+    }
+    return "";
+}
+
+bool IsHostBigEndian() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    memcpy(&first_byte, &one, 1);
+    return first_byte == 0;
+}
+
+template <typename T>
+T LoadScalar(const char *src, bool swap) {
+    char bytes[sizeof(T)];
+    if (swap) {
+        std::reverse_copy(src, src + sizeof(T), bytes);
+    } else {
+        memcpy(bytes, src, sizeof(T));
+    }
+    T value;
+    memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+double LoadValue(const char *src, PLYType type, bool swap) {
+    switch (type) {
+        case PLYType::Int8:
+            return LoadScalar<int8_t>(src, swap);
+        case PLYType::UInt8:
+            return LoadScalar<uint8_t>(src, swap);
+        case PLYType::Int16:
+            return LoadScalar<int16_t>(src, swap);
+        case PLYType::UInt16:
+            return LoadScalar<uint16_t>(src, swap);
+        case PLYType::Int32:
+            return LoadScalar<int32_t>(src, swap);
+        case PLYType::UInt32:
+            return LoadScalar<uint32_t>(src, swap);
+        case PLYType::Float:
+            return LoadScalar<float>(src, swap);
+        case PLYType::Double:
+            return LoadScalar<double>(src, swap);
+    }
+    return 0.0;
+}
+
+// Decodes vectors[i] = scale * (p0, p1, p2) of the elements [begin, end) of
+// a fixed-size block, where the three properties share type T. The vectors
+// are single or double precision; the product is computed in double and
+// rounded once.
+template <typename T, typename vector_t>
+void DecodeVectors(const char *block,
+                   int64_t stride,
+                   const int64_t offsets[3],
+                   bool swap,
+                   double scale,
+                   int64_t begin,
+                   int64_t end,
+                   std::vector<vector_t> &vectors) {
+    typedef typename vector_t::Scalar scalar_t;
+    utility::ParallelFor(
+            begin, end,
+            [&](int64_t i) {
+                const char *src = block + i * stride;
+                vectors[i] = (Eigen::Vector3d(
+                                      double(LoadScalar<T>(src + offsets[0],
+                                                           swap)),
+                                      double(LoadScalar<T>(src + offsets[1],
+                                                           swap)),
+                                      double(LoadScalar<T>(src + offsets[2],
+                                                           swap))) *
+                              scale)
+                                     .template cast<scalar_t>();
+            },
+            4096);
+}
+
+class PLYBinaryFile {
+public:
+    // Maps filename and parses its header. Returns false if the file is not
+    // a binary PLY file this reader handles, or an ASCII one if allow_ascii
+    // is true.
+    bool Open(const std::string &filename, bool allow_ascii = false) {
+        return file_.Open(filename) &&
+               Open(file_.GetData(), file_.GetSize(), allow_ascii);
+    }
+
+    // Same as above for the size bytes at data, which must outlive this
+    // object.
+    bool Open(const char *data, int64_t size, bool allow_ascii = false) {
+        data_ = data;
+        size_ = size;
+        if (!ParseHeader() || (ascii_ && !allow_ascii)) {
+            return false;
+        }
+        swap_ = big_endian_ != IsHostBigEndian();
+        return true;
+    }
+
+    bool IsAscii() const { return ascii_; }
+
+    const std::vector<PLYElement> &GetElements() const { return elements_; }
+
+    // Returns the data following the header, and its end.
+    const char *GetBody() const { return data_ + data_offset_; }
+    const char *GetEnd() const { return data_ + size_; }
+
+    // Returns the element called name, or nullptr.
+    const PLYElement *FindElement(const std::string &name) const {
+        for (const PLYElement &element : elements_) {
+            if (element.name == name) {
+                return &element;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns the start of the data of element, provided that all elements
+    // before it have a fixed size, or the triangle face layout checked by
+    // GetTriangleBlock(). Returns nullptr otherwise or if the file is too
+    // short.
+    const char *GetElementData(const PLYElement &element) {
+        int64_t offset = data_offset_;
+        for (const PLYElement &other : elements_) {
+            if (&other == &element) {
+                break;
+            }
+            if (other.count == 0) {
+                continue;
+            }
+            const int64_t stride = &other == triangle_element_
+                                           ? triangle_stride_
+                                           : other.stride;
+            if (stride == 0 ||
+                other.count > (size_ - offset) / stride) {
+                return nullptr;
+            }
+            offset += other.count * stride;
+        }
+        if (offset > size_) {
+            return nullptr;
+        }
+        if (element.stride > 0 &&
+            element.count > (size_ - offset) / element.stride) {
+            return nullptr;
+        }
+        return data_ + offset;
+    }
+
+    // Finds the three properties names of vertex. Returns false if one is
+    // missing.
+    bool FindVectorProperties(const PLYElement &vertex,
+                              const char *const names[3],
+                              const PLYProperty *properties[3]) const {
+        for (int k = 0; k < 3; k++) {
+            properties[k] = vertex.Find(names[k]);
+            if (properties[k] == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Decodes the three properties of the vertices [begin, end) of block
+    // into vectors, multiplied by scale.
+    template <typename vector_t>
+    void DecodeVectorProperties(const PLYElement &vertex,
+                                const char *block,
+                                const PLYProperty *properties[3],
+                                double scale,
+                                int64_t begin,
+                                int64_t end,
+                                std::vector<vector_t> &vectors) const {
+        typedef typename vector_t::Scalar scalar_t;
+        const int64_t offsets[3] = {properties[0]->offset,
+                                    properties[1]->offset,
+                                    properties[2]->offset};
+        const PLYType type = properties[0]->type;
+        if (properties[1]->type != type || properties[2]->type != type) {
+            utility::ParallelFor(
+                    begin, end,
+                    [&](int64_t i) {
+                        const char *src = block + i * vertex.stride;
+                        for (int k = 0; k < 3; k++) {
+                            vectors[i](k) = scalar_t(
+                                    LoadValue(src + offsets[k],
+                                              properties[k]->type, swap_) *
+                                    scale);
+                        }
+                    },
+                    4096);
+            return;
+        }
+        switch (type) {
+            case PLYType::Int8:
+                DecodeVectors<int8_t>(block, vertex.stride, offsets, swap_,
+                                      scale, begin, end, vectors);
+                break;
+            case PLYType::UInt8:
+                DecodeVectors<uint8_t>(block, vertex.stride, offsets, swap_,
+                                       scale, begin, end, vectors);
+                break;
+            case PLYType::Int16:
+                DecodeVectors<int16_t>(block, vertex.stride, offsets, swap_,
+                                       scale, begin, end, vectors);
+                break;
+            case PLYType::UInt16:
+                DecodeVectors<uint16_t>(block, vertex.stride, offsets, swap_,
+                                        scale, begin, end, vectors);
+                break;
+            case PLYType::Int32:
+                DecodeVectors<int32_t>(block, vertex.stride, offsets, swap_,
+                                       scale, begin, end, vectors);
+                break;
+            case PLYType::UInt32:
+                DecodeVectors<uint32_t>(block, vertex.stride, offsets, swap_,
+                                        scale, begin, end, vectors);
+                break;
+            case PLYType::Float:
+                DecodeVectors<float>(block, vertex.stride, offsets, swap_,
+                                     scale, begin, end, vectors);
+                break;
+            case PLYType::Double:
+                DecodeVectors<double>(block, vertex.stride, offsets, swap_,
+                                      scale, begin, end, vectors);
+                break;
+        }
+    }
+
+    // Checks that face holds only the list of vertex indices and that every
+    // face is a triangle, so the faces form a fixed-size block. Returns the
+    // block, or nullptr otherwise.
+    const char *GetTriangleBlock(const PLYElement &face,
+                                 const PLYProperty *&indices) {
+        triangle_element_ = nullptr;
+        triangle_stride_ = 0;
+        if (face.properties.size() != 1 || !face.properties[0].is_list ||
+            (face.properties[0].name != "vertex_indices" &&
+             face.properties[0].name != "vertex_index")) {
+            return nullptr;
+        }
+        indices = &face.properties[0];
+        const PLYType index_type = indices->type;
+        if (index_type == PLYType::Float || index_type == PLYType::Double) {
+            return nullptr;
+        }
+        const char *block = GetElementData(face);
+        if (block == nullptr) {
+            return nullptr;
+        }
+        const int64_t count_size = TypeSize(indices->count_type);
+        const int64_t stride = count_size + 3 * TypeSize(index_type);
+        const char *end = data_ + size_;
+        if (face.count > (end - block) / stride) {
+            return nullptr;
+        }
+        const int64_t num_polygons = utility::ParallelReduce<int64_t>(
+                0, face.count, 0,
+                [&](int64_t chunk_begin, int64_t chunk_end, int64_t sum) {
+                    for (int64_t i = chunk_begin; i < chunk_end; i++) {
+                        if (LoadValue(block + i * stride, indices->count_type,
+                                      swap_) != 3.0) {
+                            sum++;
+                        }
+                    }
+                    return sum;
+                },
+                [](int64_t a, int64_t b) { return a + b; });
+        if (num_polygons > 0) {
+            return nullptr;
+        }
+        triangle_element_ = &face;
+        triangle_stride_ = stride;
+        return block;
+    }
+
+    // Decodes the triangles [begin, end) of the block of GetTriangleBlock().
+    void DecodeTriangles(const char *block,
+                         const PLYProperty &indices,
+                         int64_t begin,
+                         int64_t end,
+                         std::vector<Eigen::Vector3i> &triangles) const {
+        const int64_t count_size = TypeSize(indices.count_type);
+        const int64_t index_size = TypeSize(indices.type);
+        utility::ParallelFor(
+                begin, end,
+                [&](int64_t i) {
+                    const char *src = block + i * triangle_stride_ + count_size;
+                    for (int k = 0; k < 3; k++) {
+                        triangles[i](k) = int(LoadValue(
+                                src + k * index_size, indices.type, swap_));
+                    }
+                },
+                4096);
+    }
+
+private:
+    bool ParseHeader() {
+        const char *data = data_;
+        const int64_t size = size_;
+        int64_t pos = 0;
+        auto next_line = [&](std::string &line) {
+            if (pos >= size) {
+                return false;
+            }
+            const char *begin = data + pos;
+            const char *newline = static_cast<const char *>(
+                    memchr(begin, '\n', size_t(size - pos)));
+            if (newline == nullptr) {
+                return false;
+            }
+            line.assign(begin, newline);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            pos = newline - data + 1;
+            return true;
+        };
+
+        std::string line;
+        if (!next_line(line) || line != "ply") {
+            return false;
+        }
+        while (next_line(line)) {
+            std::istringstream tokens(line);
+            std::string keyword;
+            tokens >> keyword;
+            if (keyword == "format") {
+                std::string format;
+                tokens >> format;
+                if (format == "ascii") {
+                    ascii_ = true;
+                } else if (format == "binary_little_endian") {
+                    big_endian_ = false;
+                } else if (format == "binary_big_endian") {
+                    big_endian_ = true;
+                } else {
+                    return false;
+                }
+                has_format_ = true;
+            } else if (keyword == "element") {
+                PLYElement element;
+                if (!(tokens >> element.name >> element.count) ||
+                    element.count < 0) {
+                    return false;
+                }
+                element.stride = 0;
+                elements_.push_back(element);
+            } else if (keyword == "property") {
+                if (elements_.empty()) {
+                    return false;
+                }
+                PLYProperty property;
+                std::string type;
+                tokens >> type;
+                property.is_list = type == "list";
+                property.count_type = PLYType::UInt8;
+                if (property.is_list) {
+                    std::string count_type;
+                    tokens >> count_type >> type;
+                    if (!ParseType(count_type, property.count_type)) {
+                        return false;
+                    }
+                }
+                if (!ParseType(type, property.type) ||
+                    !(tokens >> property.name)) {
+                    return false;
+                }
+                property.offset = 0;
+                elements_.back().properties.push_back(property);
+            } else if (keyword == "end_header") {
+                if (!has_format_) {
+                    return false;
+                }
+                data_offset_ = pos;
+                ComputeStrides();
+                return true;
+            } else if (keyword != "comment" && keyword != "obj_info") {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void ComputeStrides() {
+        for (PLYElement &element : elements_) {
+            int64_t offset = 0;
+            for (PLYProperty &property : element.properties) {
+                if (property.is_list) {
+                    offset = 0;
+                    break;
+                }
+                property.offset = offset;
+                offset += TypeSize(property.type);
+            }
+            element.stride = offset;
+        }
+    }
+
+private:
+    utility::filesystem::MappedFile file_;
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+    std::vector<PLYElement> elements_;
+    bool has_format_ = false;
+    bool ascii_ = false;
+    bool big_endian_ = false;
+    bool swap_ = false;
+    int64_t data_offset_ = 0;
+    // Face element validated by GetTriangleBlock(), and its stride.
+    const PLYElement *triangle_element_ = nullptr;
+    int64_t triangle_stride_ = 0;
+};
+
+const char *const kPositionNames[3] = {"x", "y", "z"};
+const char *const kNormalNames[3] = {"nx", "ny", "nz"};
+const char *const kColorNames[3] = {"red", "green", "blue"};
+
+// Lists the properties of element for ReadPointCloudInfo() and
+// ReadTriangleMeshInfo().
+std::vector<FileAttributeInfo> GetAttributes(const PLYElement &element) {
+    std::vector<FileAttributeInfo> attributes;
+    for (const PLYProperty &property : element.properties) {
+        FileAttributeInfo attribute;
+        attribute.name = property.name;
+        attribute.type = TypeName(property.type);
+        attribute.is_list = property.is_list;
+        attributes.push_back(attribute);
+    }
+    return attributes;
+}
+
+// Opens the header of filename, binary or ASCII.
+bool OpenHeader(const std::string &filename, PLYBinaryFile &file) {
+    if (!file.Open(filename, true)) {
+        utility::LogWarning("Read PLY failed: unable to read header of {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+// Finds the x, y, z properties and the optional normals and colors of vertex.
+// Returns false if a vector is only partially present, which rply reads
+// differently.
+bool FindVertexProperties(const PLYBinaryFile &file,
+                          const PLYElement &vertex,
+                          const PLYProperty *positions[3],
+                          const PLYProperty *normals[3],
+                          const PLYProperty *colors[3],
+                          bool &has_normals,
+                          bool &has_colors) {
+    if (vertex.stride == 0 || vertex.count == 0 ||
+        !file.FindVectorProperties(vertex, kPositionNames, positions)) {
+        return false;
+    }
+    has_normals = file.FindVectorProperties(vertex, kNormalNames, normals);
+    has_colors = file.FindVectorProperties(vertex, kColorNames, colors);
+    if ((!has_normals && (vertex.Find("nx") || vertex.Find("ny") ||
+                          vertex.Find("nz"))) ||
+        (!has_colors && (vertex.Find("red") || vertex.Find("green") ||
+                         vertex.Find("blue")))) {
+        return false;
+    }
+    return true;
+}
+
+// Returns true and fills pointcloud if file is a binary PLY file with a
+// fixed-size vertex element that can be decoded in bulk. pointcloud is a
+// PointCloud or a CompactPointCloud, which is filled without going through
+// double precision storage.
+template <typename pointcloud_t>
+bool ReadPointCloud(PLYBinaryFile &file,
+                    pointcloud_t &pointcloud,
+                    const ReadPointCloudOption &params) {
+    const PLYElement *vertex = file.FindElement("vertex");
+    const PLYProperty *positions[3], *normals[3], *colors[3];
+    bool has_normals, has_colors;
+    if (vertex == nullptr ||
+        !FindVertexProperties(file, *vertex, positions, normals, colors,
+                              has_normals, has_colors)) {
+        return false;
+    }
+    const char *block = file.GetElementData(*vertex);
+    if (block == nullptr) {
+        return false;
+    }
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(vertex->count);
+    pointcloud.normals_.resize(has_normals ? vertex->count : 0);
+    pointcloud.colors_.resize(has_colors ? vertex->count : 0);
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(vertex->count);
+    const int64_t vertex_chunk_size = GetChunkSize(vertex->count);
+    for (int64_t begin = 0; begin < vertex->count;
+         begin += vertex_chunk_size) {
+        const int64_t end = std::min(vertex->count, begin + vertex_chunk_size);
+        file.DecodeVectorProperties(*vertex, block, positions, 1.0, begin,
+                                    end, pointcloud.points_);
+        if (has_normals) {
+            file.DecodeVectorProperties(*vertex, block, normals, 1.0, begin,
+                                        end, pointcloud.normals_);
+        }
+        if (has_colors) {
+            file.DecodeVectorProperties(*vertex, block, colors, 1.0 / 255.0,
+                                        begin, end, pointcloud.colors_);
+        }
+        reporter.Update(end);
+    }
+    reporter.Finish();
+    return true;
+}
+
+// Returns true and fills mesh if file is a binary PLY file with a fixed-size
+// vertex element and only triangles, which can be decoded in bulk. mesh is a
+// TriangleMesh or a CompactTriangleMesh.
+template <typename mesh_t>
+bool ReadTriangleMesh(PLYBinaryFile &file,
+                      mesh_t &mesh,
+                      bool print_progress) {
+    const PLYElement *vertex = file.FindElement("vertex");
+    const PLYProperty *positions[3], *normals[3], *colors[3];
+    bool has_normals, has_colors;
+    if (vertex == nullptr ||
+        !FindVertexProperties(file, *vertex, positions, normals, colors,
+                              has_normals, has_colors)) {
+        return false;
+    }
+    const PLYElement *face = file.FindElement("face");
+    const PLYProperty *indices = nullptr;
+    const char *face_block = nullptr;
+    if (face != nullptr && face->count > 0) {
+        face_block = file.GetTriangleBlock(*face, indices);
+        if (face_block == nullptr) {
+            return false;
+        }
+    }
+    // Computed after the face layout is known, as the faces may come first.
+    const char *vertex_block = file.GetElementData(*vertex);
+    if (vertex_block == nullptr) {
+        return false;
+    }
+    const int64_t num_triangles = face_block ? face->count : 0;
+
+    mesh.Clear();
+    mesh.vertices_.resize(vertex->count);
+    mesh.vertex_normals_.resize(has_normals ? vertex->count : 0);
+    mesh.vertex_colors_.resize(has_colors ? vertex->count : 0);
+    mesh.triangles_.resize(num_triangles);
+
+    utility::ConsoleProgressBar progress_bar(
+            size_t(vertex->count + num_triangles), "Reading PLY: ",
+            print_progress);
+    auto advance = [&](int64_t count) {
+        if (print_progress) {
+            for (int64_t i = 0; i < count; i++) {
+                ++progress_bar;
+            }
+        }
+    };
+    const int64_t vertex_chunk_size = GetChunkSize(vertex->count);
+    for (int64_t begin = 0; begin < vertex->count;
+         begin += vertex_chunk_size) {
+        const int64_t end = std::min(vertex->count, begin + vertex_chunk_size);
+        file.DecodeVectorProperties(*vertex, vertex_block, positions, 1.0,
+                                    begin, end, mesh.vertices_);
+        if (has_normals) {
+            file.DecodeVectorProperties(*vertex, vertex_block, normals, 1.0,
+                                        begin, end, mesh.vertex_normals_);
+        }
+        if (has_colors) {
+            file.DecodeVectorProperties(*vertex, vertex_block, colors,
+                                        1.0 / 255.0, begin, end,
+                                        mesh.vertex_colors_);
+        }
+        advance(end - begin);
+    }
+    const int64_t triangle_chunk_size = GetChunkSize(num_triangles);
+    for (int64_t begin = 0; begin < num_triangles;
+         begin += triangle_chunk_size) {
+        const int64_t end =
+                std::min(num_triangles, begin + triangle_chunk_size);
+        file.DecodeTriangles(face_block, *indices, begin, end,
+                             mesh.triangles_);
+        advance(end - begin);
+    }
+    return true;
+}
+
+}  // namespace ply_binary_reader
+
+namespace ply_pointcloud_stream {
+
+using ply_binary_reader::PLYBinaryFile;
+using ply_binary_reader::PLYElement;
+using ply_binary_reader::PLYProperty;
+
+// Streams the vertices of PLY files with a fixed-size vertex element: binary
+// ones are decoded from the mapped file, ASCII ones are parsed line by line
+// if the vertices come first. Other layouts are read at once.
+class PLYPointCloudStreamReader : public PointCloudStreamReader {
+public:
+    ~PLYPointCloudStreamReader() override { Close(); }
+
+public:
+    bool Open(const std::string &filename) override {
+        Close();
+        file_.reset(new PLYBinaryFile());
+        if (file_->Open(filename, true)) {
+            vertex_ = file_->FindElement("vertex");
+            if (vertex_ != nullptr &&
+                ply_binary_reader::FindVertexProperties(
+                        *file_, *vertex_, positions_, normals_, colors_,
+                        has_normals_, has_colors_)) {
+                data_ = file_->IsAscii() ? FindAsciiVertices()
+                                         : file_->GetElementData(*vertex_);
+            }
+        }
+        if (data_ != nullptr) {
+            num_points_ = vertex_->count;
+            return true;
+        }
+
+        Close();
+        geometry::PointCloud pointcloud;
+        if (!ReadPointCloudFromPLY(filename, pointcloud, {})) {
+            return false;
+        }
+        utility::LogDebug("PLY file {} cannot be streamed, read it at once.",
+                          filename);
+        SetInMemoryPointCloud(std::move(pointcloud));
+        return true;
+    }
+
+    void Close() override {
+        file_.reset();
+        vertex_ = nullptr;
+        data_ = nullptr;
+        position_ = 0;
+        num_points_ = -1;
+        has_normals_ = false;
+        has_colors_ = false;
+        in_memory_ = false;
+        in_memory_pointcloud_.Clear();
+    }
+
+    int64_t ReadChunk(geometry::PointCloud &chunk,
+                      int64_t max_points) override {
+        if (in_memory_) {
+            return ReadChunkInMemory(chunk, max_points);
+        }
+        if (data_ == nullptr) {
+            return -1;
+        }
+        const int64_t count = std::max<int64_t>(
+                0, std::min(max_points, num_points_ - position_));
+        ResizeChunk(chunk, count);
+        if (file_->IsAscii()) {
+            if (!ParseAsciiVertices(chunk, count)) {
+                utility::LogWarning("Read PLY failed: invalid vertex {:d}.",
+                                    position_);
+                data_ = nullptr;
+                return -1;
+            }
+        } else {
+            const char *block = data_ + position_ * vertex_->stride;
+            file_->DecodeVectorProperties(*vertex_, block, positions_, 1.0, 0,
+                                          count, chunk.points_);
+            if (has_normals_) {
+                file_->DecodeVectorProperties(*vertex_, block, normals_, 1.0,
+                                              0, count, chunk.normals_);
+            }
+            if (has_colors_) {
+                file_->DecodeVectorProperties(*vertex_, block, colors_,
+                                              1.0 / 255.0, 0, count,
+                                              chunk.colors_);
+            }
+        }
+        position_ += count;
+        return count;
+    }
+
+private:
+    // Returns the first vertex line, provided that no element with
+    // instances comes before the vertices, or nullptr.
+    const char *FindAsciiVertices() const {
+        for (const PLYElement &element : file_->GetElements()) {
+            if (&element == vertex_) {
+                return file_->GetBody();
+            }
+            if (element.count > 0) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    // Parses count vertex lines at data_ into chunk, and advances data_.
+    bool ParseAsciiVertices(geometry::PointCloud &chunk, int64_t count) {
+        const char *end = file_->GetEnd();
+        const PLYProperty *first = vertex_->properties.data();
+        std::vector<double> values(vertex_->properties.size());
+        for (int64_t i = 0; i < count; i++) {
+            const char *newline = static_cast<const char *>(
+                    memchr(data_, '\n', size_t(end - data_)));
+            const char *line_end = newline ? newline : end;
+            for (double &value : values) {
+                if (!utility::ParseDouble(data_, line_end, value)) {
+                    return false;
+                }
+            }
+            for (int k = 0; k < 3; k++) {
+                chunk.points_[i](k) = values[positions_[k] - first];
+                if (has_normals_) {
+                    chunk.normals_[i](k) = values[normals_[k] - first];
+                }
+                if (has_colors_) {
+                    chunk.colors_[i](k) = values[colors_[k] - first] / 255.0;
+                }
+            }
+            data_ = newline ? newline + 1 : end;
+        }
+        return true;
+    }
+
+private:
+    std::unique_ptr<PLYBinaryFile> file_;
+    const PLYElement *vertex_ = nullptr;
+    const PLYProperty *positions_[3], *normals_[3], *colors_[3];
+    // The vertex data, or with ASCII files the next vertex line.
+    const char *data_ = nullptr;
+    int64_t position_ = 0;
+};
+
+// Writes the vertices of PLY files like WritePointCloudToPLY(), with the
+// number of vertices filled in on Close().
+class PLYPointCloudStreamWriter : public PointCloudStreamWriter {
+public:
+    ~PLYPointCloudStreamWriter() override { Close(); }
+
+public:
+    bool Open(const std::string &filename,
+              bool has_normals,
+              bool has_colors,
+              const WritePointCloudOption &params) override {
+        Close();
+        try {
+            if (!file_.Open(filename, "wb")) {
+                utility::LogWarning("Write PLY failed: unable to open file: {}",
+                                    filename);
+                return false;
+            }
+            filename_ = filename;
+            ascii_ = bool(params.write_ascii);
+            has_normals_ = has_normals;
+            has_colors_ = has_colors;
+            num_points_written_ = 0;
+            printed_color_warning_ = false;
+
+            FILE *file = file_.GetFILE();
+            fprintf(file, "ply\nformat %s 1.0\ncomment Created by Open3D\n",
+                    ascii_ ? "ascii"
+                           : ply_binary_reader::IsHostBigEndian()
+                                     ? "binary_big_endian"
+                                     : "binary_little_endian");
+            fprintf(file, "element vertex ");
+            // Room for the number of vertices, written on Close().
+            count_position_ = file_.CurPos();
+            fprintf(file, "%-20d\n", 0);
+            fprintf(file,
+                    "property double x\nproperty double y\n"
+                    "property double z\n");
+            if (has_normals_) {
+                fprintf(file,
+                        "property double nx\nproperty double ny\n"
+                        "property double nz\n");
+            }
+            if (has_colors_) {
+                fprintf(file,
+                        "property uchar red\nproperty uchar green\n"
+                        "property uchar blue\n");
+            }
+            if (fprintf(file, "end_header\n") < 0) {
+                return Fail();
+            }
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write PLY failed with exception: {}",
+                                e.what());
+            file_.Close();
+            return false;
+        }
+    }
+
+    bool WriteChunk(const geometry::PointCloud &chunk) override {
+        if (file_.GetFILE() == nullptr || !CheckChunk(chunk)) {
+            return false;
+        }
+        const size_t stride = (has_normals_ ? 48 : 24) + (has_colors_ ? 3 : 0);
+        if (!ascii_) {
+            buffer_.resize(chunk.points_.size() * stride);
+        }
+        for (size_t i = 0; i < chunk.points_.size(); i++) {
+            const Eigen::Vector3d &point = chunk.points_[i];
+            Eigen::Vector3uint8 rgb(0, 0, 0);
+            if (has_colors_) {
+                const Eigen::Vector3d &color = chunk.colors_[i];
+                if (!printed_color_warning_ &&
+                    (color(0) < 0 || color(0) > 1 || color(1) < 0 ||
+                     color(1) > 1 || color(2) < 0 || color(2) > 1)) {
+                    utility::LogWarning(
+                            "Write Ply clamped color value to valid range");
+                    printed_color_warning_ = true;
+                }
+                rgb = utility::ColorToUint8(color);
+            }
+            if (ascii_) {
+                FILE *file = file_.GetFILE();
+                fprintf(file, "%.10g %.10g %.10g", point(0), point(1),
+                        point(2));
+                if (has_normals_) {
+                    const Eigen::Vector3d &normal = chunk.normals_[i];
+                    fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1),
+                            normal(2));
+                }
+                if (has_colors_) {
+                    fprintf(file, " %d %d %d", (int)rgb(0), (int)rgb(1),
+                            (int)rgb(2));
+                }
+                if (fprintf(file, "\n") < 0) {
+                    return Fail();
+                }
+            } else {
+                char *record = buffer_.data() + i * stride;
+                memcpy(record, point.data(), 24);
+                if (has_normals_) {
+                    memcpy(record + 24, chunk.normals_[i].data(), 24);
+                }
+                if (has_colors_) {
+                    memcpy(record + stride - 3, rgb.data(), 3);
+                }
+            }
+        }
+        if (!ascii_ && fwrite(buffer_.data(), 1, buffer_.size(),
+                              file_.GetFILE()) != buffer_.size()) {
+            return Fail();
+        }
+        num_points_written_ += int64_t(chunk.points_.size());
+        return true;
+    }
+
+    bool Close() override {
+        if (file_.GetFILE() == nullptr) {
+            return true;
+        }
+        try {
+            if (fseek(file_.GetFILE(), long(count_position_), SEEK_SET) != 0 ||
+                fprintf(file_.GetFILE(), "%-20lld",
+                        (long long)num_points_written_) < 0) {
+                return Fail();
+            }
+            file_.Close();
+            return true;
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write PLY failed with exception: {}",
+                                e.what());
+            return false;
+        }
+    }
+
+private:
+    bool Fail() {
+        utility::LogWarning("Write PLY failed: unable to write file: {}",
+                            filename_);
+        file_.Close();
+        return false;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    std::string filename_;
+    bool ascii_ = false;
+    bool printed_color_warning_ = false;
+    int64_t count_position_ = 0;
+    std::vector<char> buffer_;
+};
+
+}  // namespace ply_pointcloud_stream
+
+namespace ply_writer {
+
+// Writes pointcloud with rply to the newly created ply_file and closes it.
+bool WritePointCloud(p_ply ply_file,
+                     const geometry::PointCloud &pointcloud,
+                     const WritePointCloudOption &params) {
+    ply_add_comment(ply_file, "Created by Open3D");
+    ply_add_element(ply_file, "vertex",
+                    static_cast<long>(pointcloud.points_.size()));
+    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    if (pointcloud.HasNormals()) {
+        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    }
+    if (pointcloud.HasColors()) {
+        ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+        ply_add_property(ply_file, "green", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+        ply_add_property(ply_file, "blue", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+    }
+    if (!ply_write_header(ply_file)) {
+        utility::LogWarning("Write PLY failed: unable to write header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.points_.size());
+
+    bool printed_color_warning = false;
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const Eigen::Vector3d &point = pointcloud.points_[i];
+        ply_write(ply_file, point(0));
+        ply_write(ply_file, point(1));
+        ply_write(ply_file, point(2));
+        if (pointcloud.HasNormals()) {
+            const Eigen::Vector3d &normal = pointcloud.normals_[i];
+            ply_write(ply_file, normal(0));
+            ply_write(ply_file, normal(1));
+            ply_write(ply_file, normal(2));
+        }
+        if (pointcloud.HasColors()) {
+            const Eigen::Vector3d &color = pointcloud.colors_[i];
+            if (!printed_color_warning &&
+                (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
+                 color(2) < 0 || color(2) > 1)) {
+                utility::LogWarning(
+                        "Write Ply clamped color value to valid range");
+                printed_color_warning = true;
+            }
+            auto rgb = utility::ColorToUint8(color);
+            ply_write(ply_file, rgb(0));
+            ply_write(ply_file, rgb(1));
+            ply_write(ply_file, rgb(2));
+        }
+        if (i % 1000 == 0) {
+            reporter.Update(i);
+        }
+    }
+
+    reporter.Finish();
+    return ply_close(ply_file) != 0;
+}
+
+// Writes mesh with rply to the newly created ply_file and closes it.
+bool WriteTriangleMesh(p_ply ply_file,
+                       const geometry::TriangleMesh &mesh,
+                       bool write_vertex_normals,
+                       bool write_vertex_colors,
+                       bool print_progress) {
+    write_vertex_normals = write_vertex_normals && mesh.HasVertexNormals();
+    write_vertex_colors = write_vertex_colors && mesh.HasVertexColors();
+
+    ply_add_comment(ply_file, "Created by Open3D");
+    ply_add_element(ply_file, "vertex",
+                    static_cast<long>(mesh.vertices_.size()));
+    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    if (write_vertex_normals) {
+        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    }
+    if (write_vertex_colors) {
+        ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+        ply_add_property(ply_file, "green", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+        ply_add_property(ply_file, "blue", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+    }
+    ply_add_element(ply_file, "face",
+                    static_cast<long>(mesh.triangles_.size()));
+    ply_add_property(ply_file, "vertex_indices", PLY_LIST, PLY_UCHAR, PLY_UINT);
+    if (!ply_write_header(ply_file)) {
+        utility::LogWarning("Write PLY failed: unable to write header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    utility::ConsoleProgressBar progress_bar(
+            static_cast<size_t>(mesh.vertices_.size() + mesh.triangles_.size()),
+            "Writing PLY: ", print_progress);
+    bool printed_color_warning = false;
+    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+        const auto &vertex = mesh.vertices_[i];
+        ply_write(ply_file, vertex(0));
+        ply_write(ply_file, vertex(1));
+        ply_write(ply_file, vertex(2));
+        if (write_vertex_normals) {
+            const auto &normal = mesh.vertex_normals_[i];
+            ply_write(ply_file, normal(0));
+            ply_write(ply_file, normal(1));
+            ply_write(ply_file, normal(2));
+        }
+        if (write_vertex_colors) {
+            const auto &color = mesh.vertex_colors_[i];
+            if (!printed_color_warning &&
+                (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
+                 color(2) < 0 || color(2) > 1)) {
+                utility::LogWarning(
+                        "Write Ply clamped color value to valid range");
+                printed_color_warning = true;
+            }
+            auto rgb = utility::ColorToUint8(color);
+            ply_write(ply_file, rgb(0));
+            ply_write(ply_file, rgb(1));
+            ply_write(ply_file, rgb(2));
+        }
+        ++progress_bar;
+    }
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const auto &triangle = mesh.triangles_[i];
+        ply_write(ply_file, 3);
+        ply_write(ply_file, triangle(0));
+        ply_write(ply_file, triangle(1));
+        ply_write(ply_file, triangle(2));
+        ++progress_bar;
+    }
+
+    return ply_close(ply_file) != 0;
+}
+
+}  // namespace ply_writer
+
 }  // unnamed namespace
 
 namespace io {
@@ -395,65 +1658,64 @@ FileGeometry ReadFileGeometryTypePLY(const std::string &path) {
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
-    using namespace ply_pointcloud_reader;
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(filename) &&
+        ply_binary_reader::ReadPointCloud(binary_file, pointcloud, params)) {
+        return true;
+    }
+
+    p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}",
+                            filename.c_str());
+        return false;
+    }
+    return ply_pointcloud_reader::ReadPointCloud(ply_file, pointcloud, params);
+}
 
+bool ReadCompactPointCloudFromPLY(const std::string &filename,
+                                  geometry::CompactPointCloud &pointcloud,
+                                  const ReadPointCloudOption &params) {
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(filename) &&
+        ply_binary_reader::ReadPointCloud(binary_file, pointcloud, params)) {
+        return true;
+    }
+
+    // rply reads the other layouts in double precision.
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
                             filename.c_str());
         return false;
     }
-    if (!ply_read_header(ply_file)) {
-        utility::LogWarning("Read PLY failed: unable to parse header.");
-        ply_close(ply_file);
+    geometry::PointCloud buffer;
+    if (!ply_pointcloud_reader::ReadPointCloud(ply_file, buffer, params)) {
         return false;
     }
+    pointcloud = *geometry::CompactPointCloud::CreateFromPointCloud(buffer);
+    return true;
+}
 
-    PLYReaderState state;
-    state.pointcloud_ptr = &pointcloud;
-    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
-                                       ReadVertexCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
-
-    state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
-                                       ReadNormalCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
-
-    state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
-                                      ReadColorCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
-
-    if (state.vertex_num <= 0) {
-        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
-        ply_close(ply_file);
+bool ReadPointCloudInfoFromPLY(const std::string &filename,
+                               PointCloudInfo &info) {
+    ply_binary_reader::PLYBinaryFile file;
+    if (!ply_binary_reader::OpenHeader(filename, file)) {
         return false;
     }
-
-    state.vertex_index = 0;
-    state.normal_index = 0;
-    state.color_index = 0;
-
-    pointcloud.Clear();
-    pointcloud.points_.resize(state.vertex_num);
-    pointcloud.normals_.resize(state.normal_num);
-    pointcloud.colors_.resize(state.color_num);
-
-    utility::CountingProgressReporter reporter(params.update_progress);
-    reporter.SetTotal(state.vertex_num);
-    state.progress_bar = &reporter;
-
-    if (!ply_read(ply_file)) {
-        utility::LogWarning("Read PLY failed: unable to read file: {}",
+    const ply_binary_reader::PLYElement *vertex = file.FindElement("vertex");
+    if (vertex == nullptr) {
+        utility::LogWarning("Read PLY failed: no vertex element in {}",
                             filename);
-        ply_close(ply_file);
         return false;
     }
-
-    ply_close(ply_file);
-    reporter.Finish();
+    const ply_binary_reader::PLYProperty *properties[3];
+    info.num_points = vertex->count;
+    info.attributes = ply_binary_reader::GetAttributes(*vertex);
+    info.has_normals = file.FindVectorProperties(
+            *vertex, ply_binary_reader::kNormalNames, properties);
+    info.has_colors = file.FindVectorProperties(
+            *vertex, ply_binary_reader::kColorNames, properties);
     return true;
 }
 
@@ -474,71 +1736,69 @@ bool WritePointCloudToPLY(const std::string &filename,
                             filename);
         return false;
     }
-    ply_add_comment(ply_file, "Created by Open3D");
-    ply_add_element(ply_file, "vertex",
-                    static_cast<long>(pointcloud.points_.size()));
-    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    if (pointcloud.HasNormals()) {
-        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    return ply_writer::WritePointCloud(ply_file, pointcloud, params);
+}
+
+bool ReadPointCloudInMemoryFromPLY(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(reinterpret_cast<const char *>(buffer),
+                         int64_t(length)) &&
+        ply_binary_reader::ReadPointCloud(binary_file, pointcloud, params)) {
+        return true;
     }
-    if (pointcloud.HasColors()) {
-        ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
-        ply_add_property(ply_file, "green", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
-        ply_add_property(ply_file, "blue", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+
+    utility::filesystem::MemoryFile file;
+    p_ply ply_file = NULL;
+    if (file.OpenForReading(buffer, length)) {
+        ply_file = ply_open_from_file(file.GetFILE(), NULL, 0, NULL);
     }
-    if (!ply_write_header(ply_file)) {
-        utility::LogWarning("Write PLY failed: unable to write header.");
-        ply_close(ply_file);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open memory.");
         return false;
     }
+    return ply_pointcloud_reader::ReadPointCloud(ply_file, pointcloud, params);
+}
 
-    utility::CountingProgressReporter reporter(params.update_progress);
-    reporter.SetTotal(pointcloud.points_.size());
-
-    bool printed_color_warning = false;
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
-        ply_write(ply_file, point(0));
-        ply_write(ply_file, point(1));
-        ply_write(ply_file, point(2));
-        if (pointcloud.HasNormals()) {
-            const Eigen::Vector3d &normal = pointcloud.normals_[i];
-            ply_write(ply_file, normal(0));
-            ply_write(ply_file, normal(1));
-            ply_write(ply_file, normal(2));
-        }
-        if (pointcloud.HasColors()) {
-            const Eigen::Vector3d &color = pointcloud.colors_[i];
-            if (!printed_color_warning &&
-                (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
-                 color(2) < 0 || color(2) > 1)) {
-                utility::LogWarning(
-                        "Write Ply clamped color value to valid range");
-                printed_color_warning = true;
-            }
-            auto rgb = utility::ColorToUint8(color);
-            ply_write(ply_file, rgb(0));
-            ply_write(ply_file, rgb(1));
-            ply_write(ply_file, rgb(2));
-        }
-        if (i % 1000 == 0) {
-            reporter.Update(i);
-        }
+bool WritePointCloudInMemoryToPLY(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write PLY failed: point cloud has 0 points.");
+        return false;
     }
 
-    reporter.Finish();
-    ply_close(ply_file);
+    utility::filesystem::MemoryFile file;
+    p_ply ply_file = NULL;
+    if (file.OpenForWriting()) {
+        ply_file = ply_create_to_file(
+                file.GetFILE(),
+                bool(params.write_ascii) ? PLY_ASCII : PLY_LITTLE_ENDIAN, NULL,
+                0, NULL);
+    }
+    if (!ply_file) {
+        utility::LogWarning("Write PLY failed: unable to open memory.");
+        return false;
+    }
+    if (!ply_writer::WritePointCloud(ply_file, pointcloud, params) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write PLY failed: unable to write to memory.");
+        return false;
+    }
     return true;
 }
 
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
-    using namespace ply_trianglemesh_reader;
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(filename) &&
+        ply_binary_reader::ReadTriangleMesh(binary_file, mesh,
+                                            print_progress)) {
+        return true;
+    }
 
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
@@ -546,64 +1806,62 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                             filename);
         return false;
     }
-    if (!ply_read_header(ply_file)) {
-        utility::LogWarning("Read PLY failed: unable to parse header.");
-        ply_close(ply_file);
-        return false;
-    }
-
-    PLYReaderState state;
-    state.mesh_ptr = &mesh;
-    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
-                                       ReadVertexCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
-
-    state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
-                                       ReadNormalCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+    return ply_trianglemesh_reader::ReadTriangleMesh(ply_file, mesh,
+                                                    print_progress);
+}
 
-    state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
-                                      ReadColorCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+bool ReadCompactTriangleMeshFromPLY(const std::string &filename,
+                                    geometry::CompactTriangleMesh &mesh,
+                                    bool print_progress) {
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(filename) &&
+        ply_binary_reader::ReadTriangleMesh(binary_file, mesh,
+                                            print_progress)) {
+        return true;
+    }
 
-    if (state.vertex_num <= 0) {
-        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
-        ply_close(ply_file);
+    // rply reads the other layouts in double precision.
+    p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}",
+                            filename);
         return false;
     }
-
-    state.face_num = ply_set_read_cb(ply_file, "face", "vertex_indices",
-                                     ReadFaceCallBack, &state, 0);
-    if (state.face_num == 0) {
-        state.face_num = ply_set_read_cb(ply_file, "face", "vertex_index",
-                                         ReadFaceCallBack, &state, 0);
+    geometry::TriangleMesh buffer;
+    if (!ply_trianglemesh_reader::ReadTriangleMesh(ply_file, buffer,
+                                                   print_progress)) {
+        return false;
     }
+    mesh = *geometry::CompactTriangleMesh::CreateFromTriangleMesh(buffer);
+    return true;
+}
 
-    state.vertex_index = 0;
-    state.normal_index = 0;
-    state.color_index = 0;
-    state.face_index = 0;
-
-    mesh.Clear();
-    mesh.vertices_.resize(state.vertex_num);
-    mesh.vertex_normals_.resize(state.normal_num);
-    mesh.vertex_colors_.resize(state.color_num);
-
-    utility::ConsoleProgressBar progress_bar(state.vertex_num + state.face_num,
-                                             "Reading PLY: ", print_progress);
-    state.progress_bar = &progress_bar;
-
-    if (!ply_read(ply_file)) {
-        utility::LogWarning("Read PLY failed: unable to read file: {}",
+bool ReadTriangleMeshInfoFromPLY(const std::string &filename,
+                                 TriangleMeshInfo &info) {
+    ply_binary_reader::PLYBinaryFile file;
+    if (!ply_binary_reader::OpenHeader(filename, file)) {
+        return false;
+    }
+    const ply_binary_reader::PLYElement *vertex = file.FindElement("vertex");
+    if (vertex == nullptr) {
+        utility::LogWarning("Read PLY failed: no vertex element in {}",
                             filename);
-        ply_close(ply_file);
         return false;
     }
-
-    ply_close(ply_file);
+    const ply_binary_reader::PLYProperty *properties[3];
+    info.num_vertices = vertex->count;
+    info.vertex_attributes = ply_binary_reader::GetAttributes(*vertex);
+    info.has_vertex_normals = file.FindVectorProperties(
+            *vertex, ply_binary_reader::kNormalNames, properties);
+    info.has_vertex_colors = file.FindVectorProperties(
+            *vertex, ply_binary_reader::kColorNames, properties);
+    // Faces with more than three vertices are counted once, although
+    // ReadTriangleMesh splits them into several triangles.
+    const ply_binary_reader::PLYElement *face = file.FindElement("face");
+    info.num_triangles = face != nullptr ? face->count : 0;
+    if (face != nullptr) {
+        info.triangle_attributes = ply_binary_reader::GetAttributes(*face);
+    }
     return true;
 }
 
@@ -635,75 +1893,71 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
         return false;
     }
 
-    write_vertex_normals = write_vertex_normals && mesh.HasVertexNormals();
-    write_vertex_colors = write_vertex_colors && mesh.HasVertexColors();
+    return ply_writer::WriteTriangleMesh(ply_file, mesh, write_vertex_normals,
+                                         write_vertex_colors, print_progress);
+}
 
-    ply_add_comment(ply_file, "Created by Open3D");
-    ply_add_element(ply_file, "vertex",
-                    static_cast<long>(mesh.vertices_.size()));
-    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    if (write_vertex_normals) {
-        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+bool ReadTriangleMeshInMemoryFromPLY(const uint8_t *buffer,
+                                     size_t length,
+                                     geometry::TriangleMesh &mesh,
+                                     bool print_progress) {
+    ply_binary_reader::PLYBinaryFile binary_file;
+    if (binary_file.Open(reinterpret_cast<const char *>(buffer),
+                         int64_t(length)) &&
+        ply_binary_reader::ReadTriangleMesh(binary_file, mesh,
+                                            print_progress)) {
+        return true;
     }
-    if (write_vertex_colors) {
-        ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
-        ply_add_property(ply_file, "green", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
-        ply_add_property(ply_file, "blue", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
+
+    utility::filesystem::MemoryFile file;
+    p_ply ply_file = NULL;
+    if (file.OpenForReading(buffer, length)) {
+        ply_file = ply_open_from_file(file.GetFILE(), NULL, 0, NULL);
     }
-    ply_add_element(ply_file, "face",
-                    static_cast<long>(mesh.triangles_.size()));
-    ply_add_property(ply_file, "vertex_indices", PLY_LIST, PLY_UCHAR, PLY_UINT);
-    if (!ply_write_header(ply_file)) {
-        utility::LogWarning("Write PLY failed: unable to write header.");
-        ply_close(ply_file);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open memory.");
         return false;
     }
+    return ply_trianglemesh_reader::ReadTriangleMesh(ply_file, mesh,
+                                                    print_progress);
+}
 
-    utility::ConsoleProgressBar progress_bar(
-            static_cast<size_t>(mesh.vertices_.size() + mesh.triangles_.size()),
-            "Writing PLY: ", print_progress);
-    bool printed_color_warning = false;
-    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
-        const auto &vertex = mesh.vertices_[i];
-        ply_write(ply_file, vertex(0));
-        ply_write(ply_file, vertex(1));
-        ply_write(ply_file, vertex(2));
-        if (write_vertex_normals) {
-            const auto &normal = mesh.vertex_normals_[i];
-            ply_write(ply_file, normal(0));
-            ply_write(ply_file, normal(1));
-            ply_write(ply_file, normal(2));
-        }
-        if (write_vertex_colors) {
-            const auto &color = mesh.vertex_colors_[i];
-            if (!printed_color_warning &&
-                (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
-                 color(2) < 0 || color(2) > 1)) {
-                utility::LogWarning(
-                        "Write Ply clamped color value to valid range");
-                printed_color_warning = true;
-            }
-            auto rgb = utility::ColorToUint8(color);
-            ply_write(ply_file, rgb(0));
-            ply_write(ply_file, rgb(1));
-            ply_write(ply_file, rgb(2));
-        }
-        ++progress_bar;
+bool WriteTriangleMeshInMemoryToPLY(std::vector<uint8_t> &buffer,
+                                    const geometry::TriangleMesh &mesh,
+                                    bool write_ascii,
+                                    bool compressed,
+                                    bool write_vertex_normals,
+                                    bool write_vertex_colors,
+                                    bool write_triangle_uvs,
+                                    bool print_progress) {
+    if (write_triangle_uvs && mesh.HasTriangleUvs()) {
+        utility::LogWarning(
+                "This file format currently does not support writing textures "
+                "and uv coordinates. Consider using .obj");
     }
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        ply_write(ply_file, 3);
-        ply_write(ply_file, triangle(0));
-        ply_write(ply_file, triangle(1));
-        ply_write(ply_file, triangle(2));
-        ++progress_bar;
+
+    if (mesh.IsEmpty()) {
+        utility::LogWarning("Write PLY failed: mesh has 0 vertices.");
+        return false;
     }
 
-    ply_close(ply_file);
+    utility::filesystem::MemoryFile file;
+    p_ply ply_file = NULL;
+    if (file.OpenForWriting()) {
+        ply_file = ply_create_to_file(
+                file.GetFILE(), write_ascii ? PLY_ASCII : PLY_LITTLE_ENDIAN,
+                NULL, 0, NULL);
+    }
+    if (!ply_file) {
+        utility::LogWarning("Write PLY failed: unable to open memory.");
+        return false;
+    }
+    if (!ply_writer::WriteTriangleMesh(ply_file, mesh, write_vertex_normals,
+                                       write_vertex_colors, print_progress) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write PLY failed: unable to write to memory.");
+        return false;
+    }
     return true;
 }
 
@@ -1000,5 +2254,15 @@ bool WriteVoxelGridToPLY(const std::string &filename,
     return true;
 }
 
+std::unique_ptr<PointCloudStreamReader> CreatePointCloudStreamReaderPLY() {
+    return std::unique_ptr<PointCloudStreamReader>(
+            new ply_pointcloud_stream::PLYPointCloudStreamReader());
+}
+
+std::unique_ptr<PointCloudStreamWriter> CreatePointCloudStreamWriterPLY() {
+    return std::unique_ptr<PointCloudStreamWriter>(
+            new ply_pointcloud_stream::PLYPointCloudStreamWriter());
+}
+
 }  // namespace io
 }  // namespace open3d
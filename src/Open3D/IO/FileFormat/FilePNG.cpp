@@ -28,6 +28,7 @@
 
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
 
@@ -46,11 +47,54 @@ void SetPNGImageFromImage(const geometry::Image &image, png_image &pngimage) {
     }
 }
 
+// Keeps the top-left pixel of each scale x scale block of image, in place.
+// Destination pixels never come after their source, so rows are compacted
+// front to back without a second buffer.
+void SubsampleImage(geometry::Image &image, int scale) {
+    const int width = (image.width_ + scale - 1) / scale;
+    const int height = (image.height_ + scale - 1) / scale;
+    const size_t pixel_bytes =
+            size_t(image.num_of_channels_ * image.bytes_per_channel_);
+    const size_t src_stride = image.BytesPerLine();
+    uint8_t *data = image.data_.data();
+    uint8_t *dst = data;
+    for (int v = 0; v < height; v++) {
+        const uint8_t *src_row = data + size_t(v) * scale * src_stride;
+        for (int u = 0; u < width; u++) {
+            memmove(dst, src_row + size_t(u) * scale * pixel_bytes,
+                    pixel_bytes);
+            dst += pixel_bytes;
+        }
+    }
+    image.Prepare(width, height, image.num_of_channels_,
+                  image.bytes_per_channel_);
+}
+
+// Decodes the image whose header has been read into pngimage. The buffer of
+// image is reused.
+bool FinishReadPNG(png_image &pngimage,
+                   geometry::Image &image,
+                   const ImageReadOption &option) {
+    image.Prepare(pngimage.width, pngimage.height,
+                  PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
+                  PNG_IMAGE_SAMPLE_COMPONENT_SIZE(pngimage.format));
+    if (png_image_finish_read(&pngimage, NULL, image.data_.data(), 0, NULL) ==
+        0) {
+        return false;
+    }
+    if (option.scale_denominator > 1) {
+        SubsampleImage(image, option.scale_denominator);
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+bool ReadImageFromPNG(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option /* = {}*/) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
     pngimage.version = PNG_IMAGE_VERSION;
@@ -59,12 +103,7 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
         return false;
     }
 
-    image.Prepare(pngimage.width, pngimage.height,
-                  PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
-                  PNG_IMAGE_SAMPLE_COMPONENT_SIZE(pngimage.format));
-
-    if (png_image_finish_read(&pngimage, NULL, image.data_.data(), 0, NULL) ==
-        0) {
+    if (!FinishReadPNG(pngimage, image, option)) {
         utility::LogWarning("Read PNG failed: unable to read file: {}",
                             filename);
         return false;
@@ -72,6 +111,40 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool ReadImageInfoFromPNG(const std::string &filename, ImageInfo &info) {
+    png_image pngimage;
+    memset(&pngimage, 0, sizeof(pngimage));
+    pngimage.version = PNG_IMAGE_VERSION;
+    if (png_image_begin_read_from_file(&pngimage, filename.c_str()) == 0) {
+        utility::LogWarning("Read PNG failed: unable to parse header.");
+        return false;
+    }
+    info.width = int(pngimage.width);
+    info.height = int(pngimage.height);
+    info.num_of_channels = PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format);
+    info.bytes_per_channel = PNG_IMAGE_SAMPLE_COMPONENT_SIZE(pngimage.format);
+    png_image_free(&pngimage);
+    return true;
+}
+
+bool ReadImageInMemoryFromPNG(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option /* = {}*/) {
+    png_image pngimage;
+    memset(&pngimage, 0, sizeof(pngimage));
+    pngimage.version = PNG_IMAGE_VERSION;
+    if (png_image_begin_read_from_memory(&pngimage, buffer, length) == 0) {
+        utility::LogWarning("Read PNG failed: unable to parse header.");
+        return false;
+    }
+    if (!FinishReadPNG(pngimage, image, option)) {
+        utility::LogWarning("Read PNG failed: unable to read memory.");
+        return false;
+    }
+    return true;
+}
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality) {
@@ -92,5 +165,28 @@ bool WriteImageToPNG(const std::string &filename,
     return true;
 }
 
+bool WriteImageInMemoryToPNG(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality) {
+    if (!image.HasData()) {
+        utility::LogWarning("Write PNG failed: image has no data.");
+        return false;
+    }
+    png_image pngimage;
+    memset(&pngimage, 0, sizeof(pngimage));
+    pngimage.version = PNG_IMAGE_VERSION;
+    SetPNGImageFromImage(image, pngimage);
+    // The bundled libpng predates png_image_write_to_memory.
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        png_image_write_to_stdio(&pngimage, file.GetFILE(), 0,
+                                 image.data_.data(), 0, NULL) == 0 ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write PNG failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
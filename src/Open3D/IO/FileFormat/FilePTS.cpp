@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
@@ -32,8 +33,157 @@
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
 #include "Open3D/Utility/ProgressReporters.h"
+#include "Open3D/Utility/TextParser.h"
 
 namespace open3d {
+
+namespace {
+using namespace io;
+
+struct PointAndColor {
+    Eigen::Vector3d point;
+    Eigen::Vector3d color;
+};
+
+// Reads the number of points of the PTS text [begin, end) and the number of
+// fields of its first point, which decide the layout of all points. data is
+// set to the first point.
+bool ParsePTSHeader(const char *begin,
+                    const char *end,
+                    int64_t &num_of_pts,
+                    int &num_of_fields,
+                    const char *&data) {
+    auto next_line = [end](const char *line) {
+        const char *newline = static_cast<const char *>(
+                memchr(line, '\n', size_t(end - line)));
+        return newline ? newline + 1 : end;
+    };
+    const char *header = begin;
+    if (begin == end || !utility::ParseInt(header, end, num_of_pts) ||
+        num_of_pts <= 0) {
+        utility::LogWarning("Read PTS failed: unable to read header.");
+        return false;
+    }
+    data = next_line(begin);
+    if (data == end) {
+        utility::LogWarning("Read PTS failed: insufficient data fields.");
+        return false;
+    }
+
+    num_of_fields = 0;
+    double field;
+    for (const char *p = data, *line_end = next_line(data);
+         utility::ParseDouble(p, line_end, field);) {
+        num_of_fields++;
+    }
+    if (num_of_fields < 3) {
+        utility::LogWarning("Read PTS failed: insufficient data fields.");
+        return false;
+    }
+    return true;
+}
+
+bool ParsePTS(const char *begin,
+              const char *end,
+              geometry::PointCloud &pointcloud,
+              const ReadPointCloudOption &params) {
+    int64_t num_of_pts;
+    int num_of_fields;
+    const char *data;
+    if (!ParsePTSHeader(begin, end, num_of_pts, num_of_fields, data)) {
+        return false;
+    }
+    const bool has_colors = num_of_fields >= 7;
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_of_pts);
+
+    pointcloud.Clear();
+    pointcloud.points_.reserve(num_of_pts);
+    if (has_colors) {
+        pointcloud.colors_.reserve(num_of_pts);
+    }
+    utility::ParseLinesInParallel<PointAndColor>(
+            data, end,
+            [has_colors](const char *line, const char *line_end,
+                         PointAndColor &entry) {
+                // Every line is a point, invalid ones are zero.
+                Eigen::Vector3d point;
+                int64_t i, r, g, b;
+                entry.point.setZero();
+                entry.color.setZero();
+                if (utility::ParseDouble(line, line_end, point(0)) &&
+                    utility::ParseDouble(line, line_end, point(1)) &&
+                    utility::ParseDouble(line, line_end, point(2))) {
+                    if (!has_colors) {
+                        entry.point = point;
+                    } else if (utility::ParseInt(line, line_end, i) &&
+                               utility::ParseInt(line, line_end, r) &&
+                               utility::ParseInt(line, line_end, g) &&
+                               utility::ParseInt(line, line_end, b)) {
+                        // X Y Z I R G B
+                        entry.point = point;
+                        entry.color = utility::ColorToDouble(
+                                uint8_t(r), uint8_t(g), uint8_t(b));
+                    }
+                }
+                return true;
+            },
+            [&](const std::vector<PointAndColor> &entries,
+                const char *parsed_end) {
+                for (const PointAndColor &entry : entries) {
+                    pointcloud.points_.push_back(entry.point);
+                    if (has_colors) {
+                        pointcloud.colors_.push_back(entry.color);
+                    }
+                }
+                reporter.Update(int64_t(pointcloud.points_.size()));
+            },
+            num_of_pts);
+    if (int64_t(pointcloud.points_.size()) < num_of_pts) {
+        utility::LogWarning(
+                "Read PTS: the header announces {} points, but the file "
+                "has {}.",
+                num_of_pts, pointcloud.points_.size());
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool WritePTS(FILE *file,
+              const geometry::PointCloud &pointcloud,
+              const WritePointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.points_.size());
+
+    if (fprintf(file, "%zu\r\n", (size_t)pointcloud.points_.size()) < 0) {
+        return false;
+    }
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const auto &point = pointcloud.points_[i];
+        if (!pointcloud.HasColors()) {
+            if (fprintf(file, "%.10f %.10f %.10f\r\n", point(0), point(1),
+                        point(2)) < 0) {
+                return false;
+            }
+        } else {
+            auto color = utility::ColorToUint8(pointcloud.colors_[i]);
+            if (fprintf(file, "%.10f %.10f %.10f %d %d %d %d\r\n", point(0),
+                        point(1), point(2), 0, (int)color(0), (int)color(1),
+                        (int)(color(2))) < 0) {
+                return false;
+            }
+        }
+        if (i % 1000 == 0) {
+            reporter.Update(i);
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypePTS(const std::string &path) {
@@ -44,64 +194,59 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
-        if (num_of_pts <= 0) {
-            utility::LogWarning("Read PTS failed: unable to read header.");
-            return false;
-        }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
-
-        pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st;
-                utility::SplitString(st, line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z;
-            int i, r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
-        }
-        reporter.Finish();
+        return ParsePTS(file.GetData(), file.GetData() + file.GetSize(),
+                        pointcloud, params);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PTS failed with exception: {}", e.what());
+        return false;
+    }
+}
 
-        return true;
+bool ReadPointCloudInfoFromPTS(const std::string &filename,
+                               PointCloudInfo &info) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read PTS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    int num_of_fields;
+    const char *data;
+    if (!ParsePTSHeader(file.GetData(), file.GetData() + file.GetSize(),
+                        info.num_points, num_of_fields, data)) {
+        return false;
+    }
+    // X Y Z [I [R G B]]
+    std::vector<std::string> names = {"x", "y", "z"};
+    if (num_of_fields >= 4) {
+        names.push_back("intensity");
+    }
+    if (num_of_fields >= 7) {
+        names.insert(names.end(), {"red", "green", "blue"});
+    }
+    for (const std::string &name : names) {
+        FileAttributeInfo attribute;
+        attribute.name = name;
+        attribute.type = "ascii";
+        info.attributes.push_back(attribute);
+    }
+    info.has_colors = num_of_fields >= 7;
+    return true;
+}
+
+bool ReadPointCloudInMemoryFromPTS(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    try {
+        const char *begin = reinterpret_cast<const char *>(buffer);
+        return ParsePTS(begin, begin + length, pointcloud, params);
     } catch (const std::exception &e) {
         utility::LogWarning("Read PTS failed with exception: {}", e.what());
         return false;
@@ -118,41 +263,11 @@ bool WritePointCloudToPTS(const std::string &filename,
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(pointcloud.points_.size());
-
-        if (fprintf(file.GetFILE(), "%zu\r\n",
-                    (size_t)pointcloud.points_.size()) < 0) {
+        if (!WritePTS(file.GetFILE(), pointcloud, params)) {
             utility::LogWarning("Write PTS failed: unable to write file: {}",
                                 filename);
             return false;
         }
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            if (!pointcloud.HasColors()) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\r\n", point(0),
-                            point(1), point(2)) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-            } else {
-                auto color = utility::ColorToUint8(pointcloud.colors_[i]);
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %d %d %d %d\r\n",
-                            point(0), point(1), point(2), 0, (int)color(0),
-                            (int)color(1), (int)(color(2))) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
-        }
-        reporter.Finish();
         return true;
     } catch (const std::exception &e) {
         utility::LogWarning("Write PTS failed with exception: {}", e.what());
@@ -160,5 +275,18 @@ bool WritePointCloudToPTS(const std::string &filename,
     }
 }
 
+bool WritePointCloudInMemoryToPTS(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        !WritePTS(file.GetFILE(), pointcloud, params) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write PTS failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+// An RVL file holds a 16 bit depth image compressed with the RVL codec of
+// Wilson, "Fast Lossless Depth Image Compression", ISS 2017. The 16 byte
+// header is a 4 byte magic and the uint32 width, height and number of
+// uint32 words of the compressed pixels, which follow. Everything is in host
+// byte order.
+//
+// The pixels are coded in row-major order as alternating runs of zeros and
+// of nonzeros. Every run starts with its length, and every nonzero pixel is
+// coded as its zigzag coded difference to the previous nonzero pixel. All
+// values are variable-length coded in 4 bit nibbles, 3 bits of value and a
+// continuation bit, packed from the most significant bits of the words.
+const char kRVLMagic[4] = {'O', 'R', 'V', 'L'};
+const size_t kRVLHeaderSize = 16;
+
+class RVLEncoder {
+public:
+    explicit RVLEncoder(std::vector<uint8_t> &output) : output_(output) {}
+
+    void Encode(uint32_t value) {
+        do {
+            uint32_t nibble = value & 7;
+            value >>= 3;
+            if (value != 0) {
+                nibble |= 8;
+            }
+            word_ = (word_ << 4) | nibble;
+            if (++num_nibbles_ == 8) {
+                FlushWord();
+            }
+        } while (value != 0);
+    }
+
+    void Finish() {
+        if (num_nibbles_ > 0) {
+            word_ <<= 4 * (8 - num_nibbles_);
+            FlushWord();
+        }
+    }
+
+    uint32_t GetNumWords() const { return num_words_; }
+
+private:
+    void FlushWord() {
+        const size_t size = output_.size();
+        output_.resize(size + 4);
+        memcpy(output_.data() + size, &word_, 4);
+        word_ = 0;
+        num_nibbles_ = 0;
+        num_words_++;
+    }
+
+    std::vector<uint8_t> &output_;
+    uint32_t word_ = 0;
+    int num_nibbles_ = 0;
+    uint32_t num_words_ = 0;
+};
+
+class RVLDecoder {
+public:
+    RVLDecoder(const uint8_t *begin, uint32_t num_words)
+        : current_(begin), end_(begin + size_t(num_words) * 4) {}
+
+    uint32_t Decode() {
+        uint32_t value = 0;
+        uint32_t nibble;
+        int shift = 0;
+        do {
+            if (shift > 30) {
+                overrun_ = true;
+                return 0;
+            }
+            if (num_nibbles_ == 0) {
+                if (current_ == end_) {
+                    overrun_ = true;
+                    return 0;
+                }
+                memcpy(&word_, current_, 4);
+                current_ += 4;
+                num_nibbles_ = 8;
+            }
+            nibble = word_ >> 28;
+            word_ <<= 4;
+            num_nibbles_--;
+            value |= (nibble & 7) << shift;
+            shift += 3;
+        } while ((nibble & 8) != 0);
+        return value;
+    }
+
+    /// Returns true if the content ended in the middle of a value, or a
+    /// value does not fit in 32 bits.
+    bool IsOverrun() const { return overrun_; }
+
+private:
+    const uint8_t *current_;
+    const uint8_t *end_;
+    uint32_t word_ = 0;
+    int num_nibbles_ = 0;
+    bool overrun_ = false;
+};
+
+bool EncodeRVL(const geometry::Image &image, std::vector<uint8_t> &buffer) {
+    if (!image.HasData() || image.num_of_channels_ != 1 ||
+        image.bytes_per_channel_ != 2) {
+        utility::LogWarning(
+                "Write RVL failed: only 16 bit depth images are supported.");
+        return false;
+    }
+    buffer.resize(kRVLHeaderSize);
+    // Compressed depth images are usually 2 to 4 times smaller.
+    buffer.reserve(kRVLHeaderSize + image.data_.size() / 2);
+    RVLEncoder encoder(buffer);
+    const uint16_t *pixel =
+            reinterpret_cast<const uint16_t *>(image.data_.data());
+    const uint16_t *end = pixel + size_t(image.width_) * image.height_;
+    int32_t previous = 0;
+    while (pixel != end) {
+        const uint16_t *zeros_end = pixel;
+        while (zeros_end != end && *zeros_end == 0) {
+            zeros_end++;
+        }
+        encoder.Encode(uint32_t(zeros_end - pixel));
+        pixel = zeros_end;
+        const uint16_t *nonzeros_end = pixel;
+        while (nonzeros_end != end && *nonzeros_end != 0) {
+            nonzeros_end++;
+        }
+        encoder.Encode(uint32_t(nonzeros_end - pixel));
+        for (; pixel != nonzeros_end; pixel++) {
+            const int32_t delta = int32_t(*pixel) - previous;
+            encoder.Encode((uint32_t(delta) << 1) ^ uint32_t(delta >> 31));
+            previous = *pixel;
+        }
+    }
+    encoder.Finish();
+    const uint32_t header[3] = {uint32_t(image.width_),
+                                uint32_t(image.height_),
+                                encoder.GetNumWords()};
+    memcpy(buffer.data(), kRVLMagic, 4);
+    memcpy(buffer.data() + 4, header, sizeof(header));
+    return true;
+}
+
+bool ReadRVLHeader(const uint8_t *buffer,
+                   size_t length,
+                   uint32_t &width,
+                   uint32_t &height,
+                   uint32_t &num_words) {
+    uint32_t header[3];
+    if (length < kRVLHeaderSize || memcmp(buffer, kRVLMagic, 4) != 0) {
+        utility::LogWarning("Read RVL failed: not an RVL file.");
+        return false;
+    }
+    memcpy(header, buffer + 4, sizeof(header));
+    width = header[0];
+    height = header[1];
+    num_words = header[2];
+    if ((length - kRVLHeaderSize) / 4 < num_words ||
+        uint64_t(width) * height > uint64_t(1) << 31) {
+        utility::LogWarning("Read RVL failed: invalid header.");
+        return false;
+    }
+    return true;
+}
+
+// Decodes the RVL content at buffer to image. With a scale_denominator, the
+// top-left pixel of every block is kept like ReadImageFromPNG() does.
+bool DecodeRVL(const uint8_t *buffer,
+               size_t length,
+               geometry::Image &image,
+               const ImageReadOption &option) {
+    uint32_t width, height, num_words;
+    if (!ReadRVLHeader(buffer, length, width, height, num_words)) {
+        return false;
+    }
+    const int scale = option.scale_denominator;
+    image.Prepare((int(width) + scale - 1) / scale,
+                  (int(height) + scale - 1) / scale, 1, 2);
+    std::vector<uint16_t> full;
+    uint16_t *dst = reinterpret_cast<uint16_t *>(image.data_.data());
+    if (scale > 1) {
+        full.resize(size_t(width) * height);
+        dst = full.data();
+    }
+
+    RVLDecoder decoder(buffer + kRVLHeaderSize, num_words);
+    const size_t num_pixels = size_t(width) * height;
+    size_t pixel = 0;
+    int32_t previous = 0;
+    while (pixel < num_pixels) {
+        const uint32_t num_zeros = decoder.Decode();
+        if (num_zeros > num_pixels - pixel) {
+            break;
+        }
+        memset(dst + pixel, 0, num_zeros * sizeof(uint16_t));
+        pixel += num_zeros;
+        const uint32_t num_nonzeros = decoder.Decode();
+        if (num_nonzeros > num_pixels - pixel) {
+            break;
+        }
+        for (const size_t end = pixel + num_nonzeros; pixel < end; pixel++) {
+            const uint32_t zigzag = decoder.Decode();
+            previous += int32_t(zigzag >> 1) ^ -int32_t(zigzag & 1);
+            dst[pixel] = uint16_t(previous);
+        }
+        if (decoder.IsOverrun()) {
+            break;
+        }
+    }
+    if (pixel != num_pixels || decoder.IsOverrun()) {
+        utility::LogWarning("Read RVL failed: the content is corrupted.");
+        return false;
+    }
+
+    if (scale > 1) {
+        uint16_t *out = reinterpret_cast<uint16_t *>(image.data_.data());
+        for (uint32_t v = 0; v < height; v += scale) {
+            for (uint32_t u = 0; u < width; u += scale) {
+                *out++ = full[size_t(v) * width + u];
+            }
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadImageFromRVL(const std::string &filename,
+                      geometry::Image &image,
+                      const ImageReadOption &option /* = {}*/) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read RVL failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    return DecodeRVL(reinterpret_cast<const uint8_t *>(file.GetData()),
+                     size_t(file.GetSize()), image, option);
+}
+
+bool ReadImageInfoFromRVL(const std::string &filename, ImageInfo &info) {
+    uint8_t buffer[kRVLHeaderSize];
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read RVL failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const size_t length = fread(buffer, 1, kRVLHeaderSize, file);
+    fclose(file);
+    uint32_t width, height;
+    if (length < kRVLHeaderSize || memcmp(buffer, kRVLMagic, 4) != 0) {
+        utility::LogWarning("Read RVL failed: not an RVL file.");
+        return false;
+    }
+    memcpy(&width, buffer + 4, 4);
+    memcpy(&height, buffer + 8, 4);
+    info.width = int(width);
+    info.height = int(height);
+    info.num_of_channels = 1;
+    info.bytes_per_channel = 2;
+    return true;
+}
+
+bool ReadImageInMemoryFromRVL(const uint8_t *buffer,
+                              size_t length,
+                              geometry::Image &image,
+                              const ImageReadOption &option /* = {}*/) {
+    return DecodeRVL(buffer, length, image, option);
+}
+
+bool WriteImageToRVL(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality) {
+    std::vector<uint8_t> buffer;
+    if (!EncodeRVL(image, buffer)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write RVL failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    if (fclose(file) != 0) {
+        success = false;
+    }
+    if (!success) {
+        utility::LogWarning("Write RVL failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+bool WriteImageInMemoryToRVL(std::vector<uint8_t> &buffer,
+                             const geometry::Image &image,
+                             int quality) {
+    return EncodeRVL(image, buffer);
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <vector>
 
@@ -31,8 +33,19 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
+
+namespace {
+
+/// Size of the 80 byte header and the uint32 triangle count.
+constexpr int64_t kSTLHeaderSize = 84;
+/// Size of a triangle record.
+constexpr int64_t kSTLTriangleSize = 50;
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
@@ -42,67 +55,104 @@ FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
-    FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
-
-    if (!myFile) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read STL failed: unable to open file.");
-        fclose(myFile);
         return false;
     }
-
-    int num_of_triangles;
-    if (myFile) {
-        char header[80] = "";
-        fread(header, sizeof(char), 80, myFile);
-        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile);
-    } else {
+    if (file.GetSize() < kSTLHeaderSize) {
         utility::LogWarning("Read STL failed: unable to read header.");
-        fclose(myFile);
         return false;
     }
 
+    const char *data = file.GetData();
+    uint32_t num_of_triangles;
+    memcpy(&num_of_triangles, data + 80, sizeof(num_of_triangles));
     if (num_of_triangles == 0) {
         utility::LogWarning("Read STL failed: empty file.");
-        fclose(myFile);
+        return false;
+    }
+    if (file.GetSize() <
+        kSTLHeaderSize + int64_t(num_of_triangles) * kSTLTriangleSize) {
+        if (strncmp(data, "solid", 5) == 0) {
+            utility::LogWarning(
+                    "Read STL failed: ASCII STL files are not supported.");
+        } else {
+            utility::LogWarning("Read STL failed: not enough triangles.");
+        }
         return false;
     }
 
-    mesh.vertices_.clear();
-    mesh.triangles_.clear();
-    mesh.triangle_normals_.clear();
-    mesh.vertices_.resize(num_of_triangles * 3);
+    mesh.Clear();
+    mesh.vertices_.resize(size_t(num_of_triangles) * 3);
     mesh.triangles_.resize(num_of_triangles);
     mesh.triangle_normals_.resize(num_of_triangles);
 
-    utility::ConsoleProgressBar progress_bar(num_of_triangles,
-                                             "Reading STL: ", print_progress);
-    for (int i = 0; i < num_of_triangles; i++) {
-        char buffer[50];
-        float *float_buffer;
-        if (myFile) {
-            fread(buffer, sizeof(char), 50, myFile);
-            float_buffer = reinterpret_cast<float *>(buffer);
+    // Triangles are decoded in parallel straight from the mapped file. Each
+    // record is a normal and three vertices as float32, followed by a uint16
+    // attribute byte count that is rarely used and ignored.
+    const int64_t batch_size = 1 << 20;
+    utility::ConsoleProgressBar progress_bar(
+            size_t((num_of_triangles + batch_size - 1) / batch_size),
+            "Reading STL: ", print_progress);
+    for (int64_t begin = 0; begin < int64_t(num_of_triangles);
+         begin += batch_size) {
+        const int64_t end =
+                std::min(begin + batch_size, int64_t(num_of_triangles));
+        utility::ParallelFor(begin, end, [&](int64_t i) {
+            const char *record = data + kSTLHeaderSize + i * kSTLTriangleSize;
+            float values[12];
+            memcpy(values, record, sizeof(values));
             mesh.triangle_normals_[i] =
-                    Eigen::Map<Eigen::Vector3f>(float_buffer).cast<double>();
+                    Eigen::Vector3d(values[0], values[1], values[2]);
             for (int j = 0; j < 3; j++) {
-                float_buffer = reinterpret_cast<float *>(buffer + 12 * (j + 1));
                 mesh.vertices_[i * 3 + j] =
-                        Eigen::Map<Eigen::Vector3f>(float_buffer)
-                                .cast<double>();
+                        Eigen::Vector3d(values[3 * j + 3], values[3 * j + 4],
+                                        values[3 * j + 5]);
             }
-            mesh.triangles_[i] =
-                    Eigen::Vector3i(i * 3 + 0, i * 3 + 1, i * 3 + 2);
-            // ignore buffer[48] and buffer [49] because it is rarely used.
-
-        } else {
-            utility::LogWarning("Read STL failed: not enough triangles.");
-            fclose(myFile);
-            return false;
-        }
+            mesh.triangles_[i] = Eigen::Vector3i(int(i * 3), int(i * 3 + 1),
+                                                 int(i * 3 + 2));
+        });
         ++progress_bar;
     }
+    return true;
+}
+
+bool ReadTriangleMeshInfoFromSTL(const std::string &filename,
+                                 TriangleMeshInfo &info) {
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read STL failed: unable to open file.");
+        return false;
+    }
+    char header[80];
+    uint32_t num_of_triangles;
+    const bool success = fread(header, sizeof(char), 80, file) == 80 &&
+                         fread(&num_of_triangles, sizeof(num_of_triangles), 1,
+                               file) == 1;
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read STL failed: unable to read header.");
+        return false;
+    }
 
-    fclose(myFile);
+    // STL has no shared vertices: every triangle stores a normal, its three
+    // vertices and a uint16 attribute byte count.
+    info.num_vertices = int64_t(num_of_triangles) * 3;
+    info.num_triangles = num_of_triangles;
+    info.has_triangle_normals = true;
+    FileAttributeInfo normal;
+    normal.name = "normal";
+    normal.type = "float32";
+    normal.count = 3;
+    FileAttributeInfo vertices;
+    vertices.name = "vertices";
+    vertices.type = "float32";
+    vertices.count = 9;
+    FileAttributeInfo attribute_byte_count;
+    attribute_byte_count.name = "attribute_byte_count";
+    attribute_byte_count.type = "uint16";
+    info.triangle_attributes = {normal, vertices, attribute_byte_count};
     return true;
 }
 
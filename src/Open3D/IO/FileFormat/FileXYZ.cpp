@@ -31,8 +31,60 @@
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/ProgressReporters.h"
+#include "Open3D/Utility/TextParser.h"
 
 namespace open3d {
+
+namespace {
+using namespace io;
+
+void ParseXYZ(const char *begin,
+              const char *end,
+              geometry::PointCloud &pointcloud,
+              const ReadPointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(end - begin);
+
+    pointcloud.Clear();
+    utility::ParseLinesInParallel<Eigen::Vector3d>(
+            begin, end,
+            [](const char *line, const char *line_end,
+               Eigen::Vector3d &point) {
+                return utility::ParseDouble(line, line_end, point(0)) &&
+                       utility::ParseDouble(line, line_end, point(1)) &&
+                       utility::ParseDouble(line, line_end, point(2));
+            },
+            [&](const std::vector<Eigen::Vector3d> &points,
+                const char *parsed_end) {
+                pointcloud.points_.insert(pointcloud.points_.end(),
+                                          points.begin(), points.end());
+                reporter.Update(parsed_end - begin);
+            });
+    reporter.Finish();
+}
+
+bool WriteXYZ(FILE *file,
+              const geometry::PointCloud &pointcloud,
+              const WritePointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.points_.size());
+
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const Eigen::Vector3d &point = pointcloud.points_[i];
+        if (fprintf(file, "%.10f %.10f %.10f\n", point(0), point(1),
+                    point(2)) < 0) {
+            return false;  // error happened during writing.
+        }
+        if (i % 1000 == 0) {
+            reporter.Update(i);
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeXYZ(const std::string &path) {
@@ -43,29 +95,28 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-
-        pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        reporter.Finish();
+        ParseXYZ(file.GetData(), file.GetData() + file.GetSize(), pointcloud,
+                 params);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read XYZ failed with exception: {}", e.what());
+        return false;
+    }
+}
 
+bool ReadPointCloudInMemoryFromXYZ(const uint8_t *buffer,
+                                   size_t length,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudOption &params) {
+    try {
+        const char *begin = reinterpret_cast<const char *>(buffer);
+        ParseXYZ(begin, begin + length, pointcloud, params);
         return true;
     } catch (const std::exception &e) {
         utility::LogWarning("Read XYZ failed with exception: {}", e.what());
@@ -83,22 +134,11 @@ bool WritePointCloudToXYZ(const std::string &filename,
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(pointcloud.points_.size());
-
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const Eigen::Vector3d &point = pointcloud.points_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\n", point(0),
-                        point(1), point(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZ failed: unable to write file: {}", filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        if (!WriteXYZ(file.GetFILE(), pointcloud, params)) {
+            utility::LogWarning("Write XYZ failed: unable to write file: {}",
+                                filename);
+            return false;
         }
-        reporter.Finish();
         return true;
     } catch (const std::exception &e) {
         utility::LogWarning("Write XYZ failed with exception: {}", e.what());
@@ -106,5 +146,18 @@ bool WritePointCloudToXYZ(const std::string &filename,
     }
 }
 
+bool WritePointCloudInMemoryToXYZ(std::vector<uint8_t> &buffer,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params) {
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        !WriteXYZ(file.GetFILE(), pointcloud, params) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write XYZ failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -31,8 +31,70 @@
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/ProgressReporters.h"
+#include "Open3D/Utility/TextParser.h"
 
 namespace open3d {
+
+namespace {
+using namespace io;
+
+struct PointAndColor {
+    Eigen::Vector3d point;
+    Eigen::Vector3d color;
+};
+
+void ParseXYZRGB(const char *begin,
+                 const char *end,
+                 geometry::PointCloud &pointcloud,
+                 const ReadPointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(end - begin);
+
+    pointcloud.Clear();
+    utility::ParseLinesInParallel<PointAndColor>(
+            begin, end,
+            [](const char *line, const char *line_end, PointAndColor &entry) {
+                return utility::ParseDouble(line, line_end, entry.point(0)) &&
+                       utility::ParseDouble(line, line_end, entry.point(1)) &&
+                       utility::ParseDouble(line, line_end, entry.point(2)) &&
+                       utility::ParseDouble(line, line_end, entry.color(0)) &&
+                       utility::ParseDouble(line, line_end, entry.color(1)) &&
+                       utility::ParseDouble(line, line_end, entry.color(2));
+            },
+            [&](const std::vector<PointAndColor> &entries,
+                const char *parsed_end) {
+                for (const PointAndColor &entry : entries) {
+                    pointcloud.points_.push_back(entry.point);
+                    pointcloud.colors_.push_back(entry.color);
+                }
+                reporter.Update(parsed_end - begin);
+            });
+    reporter.Finish();
+}
+
+bool WriteXYZRGB(FILE *file,
+                 const geometry::PointCloud &pointcloud,
+                 const WritePointCloudOption &params) {
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(pointcloud.points_.size());
+
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const Eigen::Vector3d &point = pointcloud.points_[i];
+        const Eigen::Vector3d &color = pointcloud.colors_[i];
+        if (fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
+                    point(1), point(2), color(0), color(1), color(2)) < 0) {
+            return false;  // error happened during writing.
+        }
+        if (i % 1000 == 0) {
+            reporter.Update(i);
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeXYZRGB(const std::string &path) {
@@ -43,34 +105,31 @@ bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZRGB failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-
-        pointcloud.Clear();
-        int i = 0;
-        double x, y, z, r, g, b;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r,
-                       &g, &b) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        reporter.Finish();
+        ParseXYZRGB(file.GetData(), file.GetData() + file.GetSize(), pointcloud,
+                    params);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read XYZRGB failed with exception: {}", e.what());
+        return false;
+    }
+}
 
+bool ReadPointCloudInMemoryFromXYZRGB(const uint8_t *buffer,
+                                      size_t length,
+                                      geometry::PointCloud &pointcloud,
+                                      const ReadPointCloudOption &params) {
+    try {
+        const char *begin = reinterpret_cast<const char *>(buffer);
+        ParseXYZRGB(begin, begin + length, pointcloud, params);
         return true;
     } catch (const std::exception &e) {
-        utility::LogWarning("Read XYZ failed with exception: {}", e.what());
+        utility::LogWarning("Read XYZRGB failed with exception: {}", e.what());
         return false;
     }
 }
@@ -89,25 +148,11 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
                                 filename);
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(pointcloud.points_.size());
-
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const Eigen::Vector3d &point = pointcloud.points_[i];
-            const Eigen::Vector3d &color = pointcloud.colors_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f %.10f %.10f\n",
-                        point(0), point(1), point(2), color(0), color(1),
-                        color(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZRGB failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        if (!WriteXYZRGB(file.GetFILE(), pointcloud, params)) {
+            utility::LogWarning("Write XYZRGB failed: unable to write file: {}",
+                                filename);
+            return false;
         }
-        reporter.Finish();
         return true;
     } catch (const std::exception &e) {
         utility::LogWarning("Write XYZRGB failed with exception: {}", e.what());
@@ -115,5 +160,22 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
     }
 }
 
+bool WritePointCloudInMemoryToXYZRGB(std::vector<uint8_t> &buffer,
+                                     const geometry::PointCloud &pointcloud,
+                                     const WritePointCloudOption &params) {
+    if (!pointcloud.HasColors()) {
+        return false;
+    }
+
+    utility::filesystem::MemoryFile file;
+    if (!file.OpenForWriting() ||
+        !WriteXYZRGB(file.GetFILE(), pointcloud, params) ||
+        !file.TakeContent(buffer)) {
+        utility::LogWarning("Write XYZRGB failed: unable to write to memory.");
+        return false;
+    }
+    return true;
+}
+
 }  // namespace io
 }  // namespace open3d
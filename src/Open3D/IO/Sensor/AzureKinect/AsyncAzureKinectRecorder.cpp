@@ -0,0 +1,332 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/AzureKinect/AsyncAzureKinectRecorder.h"
+
+#include <k4a/k4a.h>
+#include <k4arecord/record.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensor.h"
+#include "Open3D/IO/Sensor/AzureKinect/K4aPlugin.h"
+#include "Open3D/IO/Sensor/AzureKinect/MKVWriter.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+struct AsyncAzureKinectRecorder::Device {
+    explicit Device(const AzureKinectSensorConfig &config) : sensor(config) {}
+
+    AzureKinectSensor sensor;
+    MKVWriter writer;
+
+    std::mutex mutex;
+    /// Signals the writer thread: a capture was queued, or close.
+    std::condition_variable capture_queued;
+    /// Signals the preview thread: a capture arrived, or stop.
+    std::condition_variable preview_queued;
+    std::deque<k4a_capture_t> write_queue;
+    bool close_writer = false;
+    k4a_capture_t preview_capture = nullptr;
+    std::shared_ptr<geometry::RGBDImage> preview_frame;
+    int64_t num_written = 0;
+    int64_t num_dropped = 0;
+
+    std::thread capture_thread;
+    std::thread writer_thread;
+    std::thread preview_thread;
+};
+
+AsyncAzureKinectRecorder::AsyncAzureKinectRecorder(
+        const std::vector<AzureKinectSensorConfig> &sensor_configs,
+        const std::vector<size_t> &sensor_indices,
+        const AsyncAzureKinectRecorderOption &option /* = {}*/)
+    : sensor_configs_(sensor_configs),
+      sensor_indices_(sensor_indices),
+      option_(option) {
+    if (sensor_configs_.size() != sensor_indices_.size()) {
+        utility::LogError(
+                "{:d} sensor configs were given for {:d} sensor indices.",
+                sensor_configs_.size(), sensor_indices_.size());
+    }
+    if (option_.enable_hardware_sync && sensor_configs_.size() > 1) {
+        for (size_t i = 0; i < sensor_configs_.size(); i++) {
+            auto &config = sensor_configs_[i].config_;
+            config["wired_sync_mode"] =
+                    i == 0 ? "K4A_WIRED_SYNC_MODE_MASTER"
+                           : "K4A_WIRED_SYNC_MODE_SUBORDINATE";
+            config["subordinate_delay_off_master_usec"] =
+                    std::to_string(i * option_.subordinate_delay_usec);
+        }
+    }
+}
+
+AsyncAzureKinectRecorder::~AsyncAzureKinectRecorder() { Stop(); }
+
+bool AsyncAzureKinectRecorder::InitSensors() {
+    Stop();
+    for (const auto &config : sensor_configs_) {
+        devices_.emplace_back(new Device(config));
+    }
+
+    // Subordinates wait for the trigger of the master, so they start first.
+    std::vector<size_t> start_order;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < devices_.size(); i++) {
+            const bool is_master = sensor_configs_[i].config_.at(
+                                           "wired_sync_mode") ==
+                                   "K4A_WIRED_SYNC_MODE_MASTER";
+            if (is_master == (pass == 1)) {
+                start_order.push_back(i);
+            }
+        }
+    }
+    for (size_t i : start_order) {
+        if (!devices_[i]->sensor.Connect(sensor_indices_[i])) {
+            utility::LogWarning("Failed to connect to sensor {:d}.",
+                                sensor_indices_[i]);
+            devices_.clear();
+            return false;
+        }
+    }
+
+    stop_ = false;
+    for (auto &device : devices_) {
+        device->capture_thread = std::thread(
+                &AsyncAzureKinectRecorder::CaptureLoop, this,
+                std::ref(*device));
+        if (option_.enable_preview) {
+            device->preview_thread = std::thread(
+                    &AsyncAzureKinectRecorder::PreviewLoop, this,
+                    std::ref(*device));
+        }
+    }
+    return true;
+}
+
+void AsyncAzureKinectRecorder::Stop() {
+    stop_ = true;
+    for (auto &device : devices_) {
+        if (device->capture_thread.joinable()) {
+            device->capture_thread.join();
+        }
+        {
+            // Orders stop_ with the wait of the preview thread.
+            std::lock_guard<std::mutex> lock(device->mutex);
+        }
+        device->preview_queued.notify_all();
+        if (device->preview_thread.joinable()) {
+            device->preview_thread.join();
+        }
+        if (device->preview_capture != nullptr) {
+            k4a_plugin::k4a_capture_release(device->preview_capture);
+            device->preview_capture = nullptr;
+        }
+    }
+    // Captured frames are still written.
+    CloseRecord();
+    // The destructors of the sensors disconnect the devices.
+    devices_.clear();
+}
+
+bool AsyncAzureKinectRecorder::OpenRecord(
+        const std::vector<std::string> &filenames) {
+    if (is_record_created_) {
+        return true;
+    }
+    if (devices_.empty()) {
+        utility::LogWarning("Sensors are not initialized.");
+        return false;
+    }
+    if (filenames.size() != devices_.size()) {
+        utility::LogWarning("{:d} filenames were given for {:d} devices.",
+                            filenames.size(), devices_.size());
+        return false;
+    }
+    for (size_t i = 0; i < devices_.size(); i++) {
+        Device &device = *devices_[i];
+        if (!device.writer.Open(filenames[i],
+                                sensor_configs_[i].ConvertToNativeConfig(),
+                                device.sensor.device_) ||
+            !device.writer.SetMetadata(MKVMetadata())) {
+            utility::LogWarning("Unable to create recording file: {}",
+                                filenames[i]);
+            for (size_t j = 0; j <= i; j++) {
+                devices_[j]->writer.Close();
+            }
+            return false;
+        }
+    }
+    for (auto &device : devices_) {
+        std::lock_guard<std::mutex> lock(device->mutex);
+        device->close_writer = false;
+        device->num_written = 0;
+        device->num_dropped = 0;
+        device->writer_thread = std::thread(
+                &AsyncAzureKinectRecorder::WriteLoop, this, std::ref(*device));
+    }
+    is_record_created_ = true;
+    return true;
+}
+
+bool AsyncAzureKinectRecorder::CloseRecord() {
+    if (!is_record_created_) {
+        return true;
+    }
+    utility::LogInfo("Saving recording...");
+    for (auto &device : devices_) {
+        {
+            std::lock_guard<std::mutex> lock(device->mutex);
+            device->close_writer = true;
+        }
+        device->capture_queued.notify_all();
+    }
+    for (auto &device : devices_) {
+        // The writer thread returns once its queue is written.
+        device->writer_thread.join();
+        device->writer.Close();
+        if (device->num_dropped > 0) {
+            utility::LogWarning(
+                    "{:d} captures were dropped because the writes could not "
+                    "keep up.",
+                    device->num_dropped);
+        }
+    }
+    utility::LogInfo("Done");
+    is_record_created_ = false;
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> AsyncAzureKinectRecorder::GetPreviewFrame(
+        size_t device_index) {
+    Device &device = *devices_.at(device_index);
+    std::lock_guard<std::mutex> lock(device.mutex);
+    return device.preview_frame;
+}
+
+int64_t AsyncAzureKinectRecorder::GetNumWrittenCaptures(size_t device_index) {
+    Device &device = *devices_.at(device_index);
+    std::lock_guard<std::mutex> lock(device.mutex);
+    return device.num_written;
+}
+
+int64_t AsyncAzureKinectRecorder::GetNumDroppedCaptures(size_t device_index) {
+    Device &device = *devices_.at(device_index);
+    std::lock_guard<std::mutex> lock(device.mutex);
+    return device.num_dropped;
+}
+
+void AsyncAzureKinectRecorder::CaptureLoop(Device &device) {
+    while (!stop_) {
+        // Waits for at most a frame period.
+        k4a_capture_t capture = device.sensor.CaptureRawFrame();
+        if (capture == nullptr) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(device.mutex);
+            if (is_recording_ && device.writer.IsOpened() &&
+                !device.close_writer) {
+                if (int(device.write_queue.size()) <
+                    option_.max_queued_captures) {
+                    k4a_plugin::k4a_capture_reference(capture);
+                    device.write_queue.push_back(capture);
+                } else {
+                    device.num_dropped++;
+                }
+            }
+            if (option_.enable_preview) {
+                // The preview only decodes the latest capture.
+                if (device.preview_capture != nullptr) {
+                    k4a_plugin::k4a_capture_release(device.preview_capture);
+                }
+                k4a_plugin::k4a_capture_reference(capture);
+                device.preview_capture = capture;
+            }
+        }
+        device.capture_queued.notify_one();
+        device.preview_queued.notify_one();
+        k4a_plugin::k4a_capture_release(capture);
+    }
+}
+
+void AsyncAzureKinectRecorder::WriteLoop(Device &device) {
+    while (true) {
+        k4a_capture_t capture;
+        {
+            std::unique_lock<std::mutex> lock(device.mutex);
+            device.capture_queued.wait(lock, [&device]() {
+                return device.close_writer || !device.write_queue.empty();
+            });
+            if (device.write_queue.empty()) {
+                return;
+            }
+            capture = device.write_queue.front();
+            device.write_queue.pop_front();
+        }
+        const bool success = device.writer.NextFrame(capture);
+        k4a_plugin::k4a_capture_release(capture);
+        if (success) {
+            std::lock_guard<std::mutex> lock(device.mutex);
+            device.num_written++;
+        }
+    }
+}
+
+void AsyncAzureKinectRecorder::PreviewLoop(Device &device) {
+    while (true) {
+        k4a_capture_t capture;
+        {
+            std::unique_lock<std::mutex> lock(device.mutex);
+            device.preview_queued.wait(lock, [this, &device]() {
+                return stop_ || device.preview_capture != nullptr;
+            });
+            if (stop_) {
+                return;
+            }
+            capture = device.preview_capture;
+            device.preview_capture = nullptr;
+        }
+        auto frame = AzureKinectSensor::DecompressCapture(
+                capture,
+                option_.enable_align_depth_to_color
+                        ? device.sensor.transform_depth_to_color_
+                        : nullptr,
+                device.sensor.frame_pool_);
+        k4a_plugin::k4a_capture_release(capture);
+        if (frame != nullptr) {
+            std::lock_guard<std::mutex> lock(device.mutex);
+            device.preview_frame = frame;
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
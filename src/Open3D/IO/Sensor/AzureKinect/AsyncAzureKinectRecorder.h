@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensorConfig.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct AsyncAzureKinectRecorderOption
+/// \brief Optional parameters to AsyncAzureKinectRecorder.
+struct AsyncAzureKinectRecorderOption {
+    /// Decode the latest capture of each device for GetPreviewFrame().
+    bool enable_preview = true;
+    /// Warp the depth of preview frames to the color camera.
+    bool enable_align_depth_to_color = false;
+    /// Maximum number of captures per device waiting to be written, which
+    /// absorbs slow writes to disk or network storage. Captures arriving
+    /// while the queue is full are dropped and counted.
+    int max_queued_captures = 90;
+    /// With several devices, configure the first as the wired sync master
+    /// and the others as subordinates. Otherwise the wired_sync_mode of the
+    /// sensor configs is used as is.
+    bool enable_hardware_sync = true;
+    /// Delay of each subordinate after the previous device (in us), so the
+    /// depth cameras do not interfere. 160 us is the minimum Microsoft
+    /// recommends.
+    int subordinate_delay_usec = 160;
+};
+
+/// \class AsyncAzureKinectRecorder
+///
+/// \brief Records one or several Azure Kinect devices without blocking on
+/// disk writes.
+///
+/// Each device has a capture thread that enqueues the raw captures, a
+/// writer thread that appends them to the mkv file of the device with an
+/// MKVWriter, and optionally a preview thread that decodes the latest
+/// capture. A slow write only grows the queue of the device instead of
+/// delaying the next capture. Devices in hardware sync start subordinates
+/// first, as the master triggers their captures.
+class AsyncAzureKinectRecorder {
+public:
+    /// \param sensor_configs Configuration of each device.
+    /// \param sensor_indices Index of each device, see
+    /// AzureKinectSensor::ListDevices().
+    AsyncAzureKinectRecorder(
+            const std::vector<AzureKinectSensorConfig> &sensor_configs,
+            const std::vector<size_t> &sensor_indices,
+            const AsyncAzureKinectRecorderOption &option = {});
+    ~AsyncAzureKinectRecorder();
+    AsyncAzureKinectRecorder(const AsyncAzureKinectRecorder &) = delete;
+    AsyncAzureKinectRecorder &operator=(const AsyncAzureKinectRecorder &) =
+            delete;
+
+    /// Connect to the devices and start capturing.
+    bool InitSensors();
+    /// Stop capturing, close the record and disconnect from the devices.
+    void Stop();
+
+    /// Create and open an mkv file per device. Captures are written while
+    /// recording is enabled, see SetRecording().
+    ///
+    /// \param filenames Path to the mkv file of each device.
+    bool OpenRecord(const std::vector<std::string> &filenames);
+    /// Write the queued captures and close the mkv files.
+    bool CloseRecord();
+    /// Check if the mkv files are created.
+    bool IsRecordCreated() const { return is_record_created_; }
+    /// Enable or pause writing captures to the mkv files.
+    void SetRecording(bool recording) { is_recording_ = recording; }
+    bool IsRecording() const { return is_recording_; }
+
+    /// Returns the number of devices.
+    size_t GetNumDevices() const { return sensor_configs_.size(); }
+    /// Returns the latest decoded frame of \p device_index, or nullptr if
+    /// none is decoded yet or the preview is disabled.
+    std::shared_ptr<geometry::RGBDImage> GetPreviewFrame(size_t device_index);
+    /// Returns the number of captures of \p device_index written to its mkv
+    /// file since OpenRecord().
+    int64_t GetNumWrittenCaptures(size_t device_index);
+    /// Returns the number of captures of \p device_index dropped because its
+    /// write queue was full since OpenRecord().
+    int64_t GetNumDroppedCaptures(size_t device_index);
+
+private:
+    struct Device;
+
+    void CaptureLoop(Device &device);
+    void WriteLoop(Device &device);
+    void PreviewLoop(Device &device);
+
+private:
+    std::vector<AzureKinectSensorConfig> sensor_configs_;
+    std::vector<size_t> sensor_indices_;
+    AsyncAzureKinectRecorderOption option_;
+    std::vector<std::unique_ptr<Device>> devices_;
+
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> is_recording_{false};
+    bool is_record_created_ = false;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,237 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/AzureKinect/AsyncMKVReader.h"
+
+#include <k4a/k4a.h>
+#include <k4arecord/playback.h>
+#include <algorithm>
+
+#include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensor.h"
+#include "Open3D/IO/Sensor/AzureKinect/K4aPlugin.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+AsyncMKVReader::AsyncMKVReader() {}
+
+AsyncMKVReader::~AsyncMKVReader() { Close(); }
+
+bool AsyncMKVReader::IsOpened() { return reader_.IsOpened(); }
+
+bool AsyncMKVReader::Open(const std::string &filename,
+                          int queue_depth /* = 8*/,
+                          int num_decode_threads /* = 0*/) {
+    Close();
+    if (!reader_.Open(filename)) {
+        return false;
+    }
+
+    // Transformations keep intermediate buffers, so each decode thread uses
+    // its own.
+    k4a_calibration_t calibration;
+    if (K4A_RESULT_SUCCEEDED != k4a_plugin::k4a_playback_get_calibration(
+                                        reader_.handle_, &calibration)) {
+        utility::LogWarning("Failed to get calibration");
+        reader_.Close();
+        return false;
+    }
+    queue_depth_ = std::max(queue_depth, 1);
+    if (num_decode_threads <= 0) {
+        num_decode_threads = utility::GetNumThreads();
+    }
+    num_decode_threads =
+            std::max(std::min(num_decode_threads, queue_depth_), 1);
+    for (int i = 0; i < num_decode_threads; i++) {
+        transformations_.push_back(
+                k4a_plugin::k4a_transformation_create(&calibration));
+    }
+
+    // One frame more than the queue for the frame the caller holds.
+    const MKVMetadata &metadata = reader_.GetMetadata();
+    frame_pool_ = RGBDImagePool(queue_depth_ + 1, metadata.width_,
+                                metadata.height_);
+    is_eof_ = false;
+    StartThreads();
+    return true;
+}
+
+void AsyncMKVReader::Close() {
+    StopThreads();
+    for (auto transformation : transformations_) {
+        k4a_plugin::k4a_transformation_destroy(transformation);
+    }
+    transformations_.clear();
+    frame_pool_ = RGBDImagePool();
+    reader_.Close();
+}
+
+bool AsyncMKVReader::SeekTimestamp(size_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    // The playback is only read by the demux thread.
+    StopThreads();
+    const bool success = reader_.SeekTimestamp(timestamp);
+    is_eof_ = false;
+    StartThreads();
+    return success;
+}
+
+std::shared_ptr<geometry::RGBDImage> AsyncMKVReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    const int64_t index = next_frame_to_return_;
+    frame_decoded_.wait(lock, [this, index]() {
+        return decoded_frames_.count(index) > 0 ||
+               (num_frames_ >= 0 && index >= num_frames_);
+    });
+    auto it = decoded_frames_.find(index);
+    if (it == decoded_frames_.end()) {
+        lock.unlock();
+        utility::LogInfo("EOF reached");
+        is_eof_ = true;
+        return nullptr;
+    }
+    std::shared_ptr<geometry::RGBDImage> frame = std::move(it->second);
+    decoded_frames_.erase(it);
+    next_frame_to_return_++;
+    lock.unlock();
+    frame_returned_.notify_one();
+    return frame;
+}
+
+void AsyncMKVReader::StartThreads() {
+    demux_thread_ = std::thread(&AsyncMKVReader::DemuxLoop, this);
+    for (auto transformation : transformations_) {
+        decode_threads_.emplace_back(&AsyncMKVReader::DecodeLoop, this,
+                                     transformation);
+    }
+}
+
+void AsyncMKVReader::StopThreads() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_returned_.notify_all();
+    capture_demuxed_.notify_all();
+    if (demux_thread_.joinable()) {
+        demux_thread_.join();
+    }
+    for (auto &thread : decode_threads_) {
+        thread.join();
+    }
+    decode_threads_.clear();
+
+    for (auto &capture : captures_) {
+        k4a_plugin::k4a_capture_release(capture.second);
+    }
+    captures_.clear();
+    decoded_frames_.clear();
+    next_frame_to_demux_ = 0;
+    next_frame_to_return_ = 0;
+    num_frames_ = -1;
+    stop_ = false;
+}
+
+void AsyncMKVReader::DemuxLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_returned_.wait(lock, [this]() {
+                return stop_ || next_frame_to_demux_ - next_frame_to_return_ <
+                                        queue_depth_;
+            });
+            if (stop_) {
+                return;
+            }
+        }
+
+        k4a_capture_t k4a_capture;
+        k4a_stream_result_t res = k4a_plugin::k4a_playback_get_next_capture(
+                reader_.handle_, &k4a_capture);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (K4A_STREAM_RESULT_EOF == res) {
+                num_frames_ = next_frame_to_demux_;
+            } else if (K4A_STREAM_RESULT_FAILED == res) {
+                utility::LogInfo("Empty frame encountered, skip");
+                decoded_frames_[next_frame_to_demux_++] = nullptr;
+            } else {
+                captures_.emplace_back(next_frame_to_demux_++, k4a_capture);
+            }
+        }
+        if (K4A_STREAM_RESULT_EOF == res) {
+            capture_demuxed_.notify_all();
+            frame_decoded_.notify_all();
+            return;
+        } else if (K4A_STREAM_RESULT_FAILED == res) {
+            frame_decoded_.notify_all();
+        } else {
+            capture_demuxed_.notify_one();
+        }
+    }
+}
+
+void AsyncMKVReader::DecodeLoop(k4a_transformation_t transformation) {
+    while (true) {
+        int64_t index;
+        k4a_capture_t k4a_capture;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            capture_demuxed_.wait(lock, [this]() {
+                return stop_ || !captures_.empty() || num_frames_ >= 0;
+            });
+            if (stop_ || captures_.empty()) {
+                return;
+            }
+            index = captures_.front().first;
+            k4a_capture = captures_.front().second;
+            captures_.pop_front();
+        }
+
+        std::shared_ptr<geometry::RGBDImage> frame =
+                AzureKinectSensor::DecompressCapture(k4a_capture,
+                                                     transformation,
+                                                     frame_pool_);
+        k4a_plugin::k4a_capture_release(k4a_capture);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            decoded_frames_[index] = std::move(frame);
+        }
+        frame_decoded_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
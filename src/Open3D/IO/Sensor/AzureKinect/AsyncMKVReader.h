@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/Sensor/AzureKinect/MKVReader.h"
+#include "Open3D/IO/Sensor/RGBDImagePool.h"
+
+struct _k4a_capture_t;         // typedef _k4a_capture_t* k4a_capture_t;
+struct _k4a_transformation_t;  // typedef _k4a_transformation_t*
+                               // k4a_transformation_t;
+
+namespace open3d {
+namespace io {
+
+/// \class AsyncMKVReader
+///
+/// \brief AzureKinect mkv file reader that decodes frames ahead on worker
+/// threads.
+///
+/// A demux thread reads the captures of the playback in order while decode
+/// threads decompress the MJPG color and transform the depth to the color
+/// camera, as MKVReader::NextFrame() does on the calling thread. Up to
+/// queue_depth frames are demuxed or decoded ahead of the one returned.
+/// Frames are decoded into an RGBDImagePool of preallocated images, which a
+/// frame returns to once the caller releases it.
+class AsyncMKVReader {
+public:
+    /// \brief Default Constructor.
+    AsyncMKVReader();
+    ~AsyncMKVReader();
+    AsyncMKVReader(const AsyncMKVReader &) = delete;
+    AsyncMKVReader &operator=(const AsyncMKVReader &) = delete;
+
+    /// Check If the mkv file is opened.
+    bool IsOpened();
+    /// Check if the mkv file is all read.
+    bool IsEOF() { return is_eof_; }
+
+    /// Open an mkv playback and start decoding its first frames.
+    ///
+    /// \param filename Path to the mkv file.
+    /// \param queue_depth Maximum number of frames decoded ahead of the one
+    /// returned. At least 1.
+    /// \param num_decode_threads Number of threads decoding frames, 0 means
+    /// utility::GetNumThreads().
+    bool Open(const std::string &filename,
+              int queue_depth = 8,
+              int num_decode_threads = 0);
+    /// Stop the worker threads and close the opened mkv playback.
+    void Close();
+
+    /// Get metadata of the mkv playback.
+    MKVMetadata &GetMetadata() { return reader_.GetMetadata(); }
+    /// Seek to the timestamp (in us). Frames decoded ahead are discarded.
+    bool SeekTimestamp(size_t timestamp);
+    /// Get next frame from the mkv playback and returns the RGBD object,
+    /// waiting until it is decoded. Returns nullptr at the end of the
+    /// playback or for a frame that cannot be decoded, see IsEOF().
+    std::shared_ptr<geometry::RGBDImage> NextFrame();
+
+private:
+    void StartThreads();
+    void StopThreads();
+    void DemuxLoop();
+    void DecodeLoop(_k4a_transformation_t *transformation);
+
+private:
+    MKVReader reader_;
+    bool is_eof_ = false;
+    int queue_depth_ = 8;
+    std::vector<_k4a_transformation_t *> transformations_;
+    RGBDImagePool frame_pool_;
+
+    std::mutex mutex_;
+    /// Signals the demux thread: a frame was returned, or stop.
+    std::condition_variable frame_returned_;
+    /// Signals decode threads: a capture was demuxed, the end of the
+    /// playback was reached, or stop.
+    std::condition_variable capture_demuxed_;
+    /// Signals NextFrame(): a frame was decoded or the end was reached.
+    std::condition_variable frame_decoded_;
+    /// Demuxed captures waiting for a decode thread, by frame index.
+    std::deque<std::pair<int64_t, _k4a_capture_t *>> captures_;
+    /// Decoded frames by frame index, null if they could not be decoded.
+    std::map<int64_t, std::shared_ptr<geometry::RGBDImage>> decoded_frames_;
+    int64_t next_frame_to_demux_ = 0;
+    int64_t next_frame_to_return_ = 0;
+    /// Number of frames of the playback from the seek position, -1 until the
+    /// demux thread reaches the end.
+    int64_t num_frames_ = -1;
+    bool stop_ = false;
+
+    std::thread demux_thread_;
+    std::vector<std::thread> decode_threads_;
+};
+
+}  // namespace io
+}  // namespace open3d
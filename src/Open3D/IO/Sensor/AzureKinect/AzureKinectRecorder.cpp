@@ -107,14 +107,17 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
     }
 
     auto im_rgbd = AzureKinectSensor::DecompressCapture(
-            capture, enable_align_depth_to_color
-                             ? sensor_.transform_depth_to_color_
-                             : nullptr);
+            capture,
+            enable_align_depth_to_color ? sensor_.transform_depth_to_color_
+                                        : nullptr,
+            sensor_.frame_pool_);
+    if (capture != nullptr) {
+        k4a_plugin::k4a_capture_release(capture);
+    }
     if (im_rgbd == nullptr) {
         utility::LogInfo("Invalid capture, skipping this frame");
         return nullptr;
     }
-    k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
 }  // namespace io
@@ -42,8 +42,13 @@ AzureKinectSensor::AzureKinectSensor(
     : RGBDSensor(), sensor_config_(sensor_config) {}
 
 AzureKinectSensor::~AzureKinectSensor() {
-    k4a_plugin::k4a_device_stop_cameras(device_);
-    k4a_plugin::k4a_device_close(device_);
+    if (transform_depth_to_color_ != nullptr) {
+        k4a_plugin::k4a_transformation_destroy(transform_depth_to_color_);
+    }
+    if (device_ != nullptr) {
+        k4a_plugin::k4a_device_stop_cameras(device_);
+        k4a_plugin::k4a_device_close(device_);
+    }
 }
 
 bool AzureKinectSensor::Connect(size_t sensor_index) {
@@ -90,6 +95,7 @@ bool AzureKinectSensor::Connect(size_t sensor_index) {
                 static_cast<uint32_t>(sensor_index), &device_))) {
         utility::LogWarning(
                 "Runtime error: k4a_plugin::k4a_device_open() failed");
+        device_ = nullptr;
         return false;
     }
 
@@ -102,6 +108,7 @@ bool AzureKinectSensor::Connect(size_t sensor_index) {
                 "Runtime error: k4a_plugin::k4a_device_set_color_control() "
                 "failed");
         k4a_plugin::k4a_device_close(device_);
+        device_ = nullptr;
         return false;
     }
 
@@ -113,6 +120,7 @@ bool AzureKinectSensor::Connect(size_t sensor_index) {
                 "Runtime error: k4a_plugin::k4a_device_set_color_control() "
                 "failed");
         k4a_plugin::k4a_device_close(device_);
+        device_ = nullptr;
         return false;
     }
 
@@ -124,6 +132,13 @@ bool AzureKinectSensor::Connect(size_t sensor_index) {
     transform_depth_to_color_ =
             k4a_plugin::k4a_transformation_create(&calibration);
 
+    // Preallocate the frames at the color resolution, which aligned depth
+    // has too.
+    frame_pool_ = RGBDImagePool(
+            kFramePoolCapacity,
+            calibration.color_camera_calibration.resolution_width,
+            calibration.color_camera_calibration.resolution_height);
+
     return true;
 }
 
@@ -147,49 +162,17 @@ k4a_capture_t AzureKinectSensor::CaptureRawFrame() const {
 std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::CaptureFrame(
         bool enable_align_depth_to_color) const {
     k4a_capture_t capture = CaptureRawFrame();
+    if (capture == nullptr) {
+        return nullptr;
+    }
     auto im_rgbd = DecompressCapture(
             capture,
-            enable_align_depth_to_color ? transform_depth_to_color_ : nullptr);
+            enable_align_depth_to_color ? transform_depth_to_color_ : nullptr,
+            frame_pool_);
     k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
 
-void ConvertBGRAToRGB(geometry::Image &bgra, geometry::Image &rgb) {
-    if (bgra.bytes_per_channel_ != 1) {
-        utility::LogError("BGRA input image must have 1 byte per channel.");
-    }
-    if (rgb.bytes_per_channel_ != 1) {
-        utility::LogError("RGB output image must have 1 byte per channel.");
-    }
-    if (bgra.num_of_channels_ != 4) {
-        utility::LogError("BGRA input image must have 4 channels.");
-    }
-    if (rgb.num_of_channels_ != 3) {
-        utility::LogError("RGB output image must have 3 channels.");
-    }
-    if (bgra.width_ != rgb.width_ || bgra.height_ != rgb.height_) {
-        utility::LogError(
-                "BGRA input image and RGB output image have different "
-                "dimensions.");
-    }
-
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(3) schedule(static)
-#endif
-#endif
-    for (int v = 0; v < bgra.height_; ++v) {
-        for (int u = 0; u < bgra.width_; ++u) {
-            for (int c = 0; c < 3; ++c) {
-                *rgb.PointerAt<uint8_t>(u, v, c) =
-                        *bgra.PointerAt<uint8_t>(u, v, 2 - c);
-            }
-        }
-    }
-}
-
 bool AzureKinectSensor::PrintFirmware(k4a_device_t device) {
     char serial_number_buffer[256];
     size_t serial_number_buffer_size = sizeof(serial_number_buffer);
@@ -246,60 +229,67 @@ bool AzureKinectSensor::ListDevices() {
 
 std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
         k4a_capture_t capture, k4a_transformation_t transformation) {
-    static std::shared_ptr<geometry::Image> color_buffer = nullptr;
-    static std::shared_ptr<geometry::RGBDImage> rgbd_buffer = nullptr;
+    static RGBDImagePool frame_pool;
+    return DecompressCapture(capture, transformation, frame_pool);
+}
 
-    if (color_buffer == nullptr) {
-        color_buffer = std::make_shared<geometry::Image>();
-    }
-    if (rgbd_buffer == nullptr) {
-        rgbd_buffer = std::make_shared<geometry::RGBDImage>();
+std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
+        k4a_capture_t capture,
+        k4a_transformation_t transformation,
+        RGBDImagePool &frame_pool) {
+    if (capture == nullptr) {
+        return nullptr;
     }
-
-    k4a_image_t k4a_color = k4a_plugin::k4a_capture_get_color_image(capture);
-    k4a_image_t k4a_depth = k4a_plugin::k4a_capture_get_depth_image(capture);
-    if (k4a_color == nullptr || k4a_depth == nullptr) {
-        utility::LogDebug("Skipping empty captures.");
+    auto rgbd = frame_pool.Acquire();
+    if (!DecompressCapture(capture, transformation, *rgbd)) {
         return nullptr;
     }
+    return rgbd;
+}
 
+// Decodes k4a_color and k4a_depth into rgbd. k4a_transformed_depth is set to
+// the k4a image wrapping the depth of rgbd, which the caller releases.
+static bool DecompressImages(k4a_image_t k4a_color,
+                             k4a_image_t k4a_depth,
+                             k4a_transformation_t transformation,
+                             geometry::RGBDImage &rgbd,
+                             k4a_image_t &k4a_transformed_depth) {
     /* Process color */
     if (K4A_IMAGE_FORMAT_COLOR_MJPG !=
         k4a_plugin::k4a_image_get_format(k4a_color)) {
         utility::LogWarning(
                 "Unexpected image format. The stream may have "
                 "corrupted.");
-        return nullptr;
+        return false;
     }
 
     int width = k4a_plugin::k4a_image_get_width_pixels(k4a_color);
     int height = k4a_plugin::k4a_image_get_height_pixels(k4a_color);
 
-    /* resize */
-    rgbd_buffer->color_.Prepare(width, height, 3, sizeof(uint8_t));
-    color_buffer->Prepare(width, height, 4, sizeof(uint8_t));
+    /* resize, which keeps the buffers of a recycled image */
+    rgbd.color_.Prepare(width, height, 3, sizeof(uint8_t));
 
+    /* decode straight to RGB in the color image */
     tjhandle tjHandle;
     tjHandle = tjInitDecompress();
-    if (0 !=
-        tjDecompress2(tjHandle, k4a_plugin::k4a_image_get_buffer(k4a_color),
-                      static_cast<unsigned long>(
-                              k4a_plugin::k4a_image_get_size(k4a_color)),
-                      color_buffer->data_.data(), width, 0 /* pitch */, height,
-                      TJPF_BGRA, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
+    const int tj_result = tjDecompress2(
+            tjHandle, k4a_plugin::k4a_image_get_buffer(k4a_color),
+            static_cast<unsigned long>(
+                    k4a_plugin::k4a_image_get_size(k4a_color)),
+            rgbd.color_.data_.data(), width, 0 /* pitch */, height, TJPF_RGB,
+            TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE);
+    tjDestroy(tjHandle);
+    if (tj_result != 0) {
         utility::LogWarning("Failed to decompress color image.");
-        return nullptr;
+        return false;
     }
-    tjDestroy(tjHandle);
-    ConvertBGRAToRGB(*color_buffer, rgbd_buffer->color_);
 
-    /* transform depth to color plane */
-    k4a_image_t k4a_transformed_depth = nullptr;
+    /* transform depth to color plane, written in the depth image */
     if (transformation) {
-        rgbd_buffer->depth_.Prepare(width, height, 1, sizeof(uint16_t));
+        rgbd.depth_.Prepare(width, height, 1, sizeof(uint16_t));
         k4a_plugin::k4a_image_create_from_buffer(
                 K4A_IMAGE_FORMAT_DEPTH16, width, height,
-                width * sizeof(uint16_t), rgbd_buffer->depth_.data_.data(),
+                width * sizeof(uint16_t), rgbd.depth_.data_.data(),
                 width * height * sizeof(uint16_t), NULL, NULL,
                 &k4a_transformed_depth);
         if (K4A_RESULT_SUCCEEDED !=
@@ -307,26 +297,44 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectSensor::DecompressCapture(
                     transformation, k4a_depth, k4a_transformed_depth)) {
             utility::LogWarning(
                     "Failed to transform depth frame to color frame.");
-            return nullptr;
+            return false;
         }
     } else {
-        rgbd_buffer->depth_.Prepare(
-                k4a_plugin::k4a_image_get_width_pixels(k4a_depth),
-                k4a_plugin::k4a_image_get_height_pixels(k4a_depth), 1,
-                sizeof(uint16_t));
-        memcpy(rgbd_buffer->depth_.data_.data(),
+        rgbd.depth_.Prepare(k4a_plugin::k4a_image_get_width_pixels(k4a_depth),
+                            k4a_plugin::k4a_image_get_height_pixels(k4a_depth),
+                            1, sizeof(uint16_t));
+        memcpy(rgbd.depth_.data_.data(),
                k4a_plugin::k4a_image_get_buffer(k4a_depth),
                k4a_plugin::k4a_image_get_size(k4a_depth));
     }
+    return true;
+}
+
+bool AzureKinectSensor::DecompressCapture(k4a_capture_t capture,
+                                          k4a_transformation_t transformation,
+                                          geometry::RGBDImage &rgbd) {
+    k4a_image_t k4a_color = k4a_plugin::k4a_capture_get_color_image(capture);
+    k4a_image_t k4a_depth = k4a_plugin::k4a_capture_get_depth_image(capture);
+    k4a_image_t k4a_transformed_depth = nullptr;
+    bool success = false;
+    if (k4a_color == nullptr || k4a_depth == nullptr) {
+        utility::LogDebug("Skipping empty captures.");
+    } else {
+        success = DecompressImages(k4a_color, k4a_depth, transformation, rgbd,
+                                   k4a_transformed_depth);
+    }
 
-    /* process depth */
-    k4a_plugin::k4a_image_release(k4a_color);
-    k4a_plugin::k4a_image_release(k4a_depth);
-    if (transformation) {
+    /* release the images of the capture */
+    if (k4a_color != nullptr) {
+        k4a_plugin::k4a_image_release(k4a_color);
+    }
+    if (k4a_depth != nullptr) {
+        k4a_plugin::k4a_image_release(k4a_depth);
+    }
+    if (k4a_transformed_depth != nullptr) {
         k4a_plugin::k4a_image_release(k4a_transformed_depth);
     }
-
-    return rgbd_buffer;
+    return success;
 }
 
 }  // namespace io
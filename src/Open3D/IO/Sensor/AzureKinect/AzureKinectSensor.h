@@ -29,6 +29,7 @@
 #include <memory>
 
 #include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensorConfig.h"
+#include "Open3D/IO/Sensor/RGBDImagePool.h"
 #include "Open3D/IO/Sensor/RGBDSensor.h"
 
 struct _k4a_capture_t;         // typedef _k4a_capture_t* k4a_capture_t;
@@ -46,6 +47,7 @@ namespace io {
 
 // Avoid including AzureKinectRecorder.h
 class AzureKinectRecorder;
+class AsyncAzureKinectRecorder;
 
 /// \class AzureKinectSensor
 ///
@@ -63,18 +65,37 @@ public:
     static bool PrintFirmware(_k4a_device_t* device);
     /// List available Azure Kinect devices.
     static bool ListDevices();
+    /// Decodes a capture into an RGBDImage from a pool shared by the
+    /// callers of this overload, or returns nullptr on failure.
     static std::shared_ptr<geometry::RGBDImage> DecompressCapture(
             _k4a_capture_t* capture, _k4a_transformation_t* transformation);
+    /// Decodes a capture into an RGBDImage recycled from \p frame_pool, or
+    /// returns nullptr on failure.
+    static std::shared_ptr<geometry::RGBDImage> DecompressCapture(
+            _k4a_capture_t* capture,
+            _k4a_transformation_t* transformation,
+            RGBDImagePool& frame_pool);
+    /// Decodes a capture into \p rgbd, reusing its buffers. The color is
+    /// decoded and the depth transformed directly into the images of \p
+    /// rgbd. Calls with distinct images and transformations may run
+    /// concurrently.
+    static bool DecompressCapture(_k4a_capture_t* capture,
+                                  _k4a_transformation_t* transformation,
+                                  geometry::RGBDImage& rgbd);
 
 protected:
     _k4a_capture_t* CaptureRawFrame() const;
 
     AzureKinectSensorConfig sensor_config_;
-    _k4a_transformation_t* transform_depth_to_color_;
-    _k4a_device_t* device_;
+    _k4a_transformation_t* transform_depth_to_color_ = nullptr;
+    _k4a_device_t* device_ = nullptr;
     int timeout_;
+    /// Number of free frames kept for reuse by CaptureFrame().
+    static constexpr int kFramePoolCapacity = 4;
+    mutable RGBDImagePool frame_pool_;
 
     friend class AzureKinectRecorder;
+    friend class AsyncAzureKinectRecorder;
 };
 
 }  // namespace io
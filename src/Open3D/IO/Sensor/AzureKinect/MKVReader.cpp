@@ -75,7 +75,16 @@ bool MKVReader::Open(const std::string &filename) {
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    if (transformation_ != nullptr) {
+        k4a_plugin::k4a_transformation_destroy(transformation_);
+        transformation_ = nullptr;
+    }
+    if (handle_ != nullptr) {
+        k4a_plugin::k4a_playback_close(handle_);
+        handle_ = nullptr;
+    }
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -74,6 +74,8 @@ private:
 
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
+
+    friend class AsyncMKVReader;
 };
 }  // namespace io
 }  // namespace open3d
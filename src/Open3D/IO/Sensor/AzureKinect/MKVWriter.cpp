@@ -67,10 +67,14 @@ bool MKVWriter::SetMetadata(const MKVMetadata &metadata) {
 }
 
 void MKVWriter::Close() {
+    if (!IsOpened()) {
+        return;
+    }
     if (K4A_RESULT_SUCCEEDED != k4a_plugin::k4a_record_flush(handle_)) {
         utility::LogWarning("Unable to flush before writing");
     }
     k4a_plugin::k4a_record_close(handle_);
+    handle_ = nullptr;
 }
 
 bool MKVWriter::NextFrame(k4a_capture_t capture) {
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/RGBDImagePool.h"
+
+namespace open3d {
+namespace io {
+
+RGBDImagePool::RGBDImagePool(int capacity /* = 4*/,
+                             int width /* = 0*/,
+                             int height /* = 0*/)
+    : free_list_(std::make_shared<FreeList>()) {
+    free_list_->capacity = capacity;
+    if (width > 0 && height > 0) {
+        for (int i = 0; i < capacity; i++) {
+            std::unique_ptr<geometry::RGBDImage> image(
+                    new geometry::RGBDImage());
+            image->color_.Prepare(width, height, 3, sizeof(uint8_t));
+            image->depth_.Prepare(width, height, 1, sizeof(uint16_t));
+            free_list_->images.push_back(std::move(image));
+        }
+    }
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDImagePool::Acquire() {
+    std::unique_ptr<geometry::RGBDImage> image;
+    {
+        std::lock_guard<std::mutex> lock(free_list_->mutex);
+        if (!free_list_->images.empty()) {
+            image = std::move(free_list_->images.back());
+            free_list_->images.pop_back();
+        }
+    }
+    if (image == nullptr) {
+        image.reset(new geometry::RGBDImage());
+    }
+    std::shared_ptr<FreeList> free_list = free_list_;
+    return std::shared_ptr<geometry::RGBDImage>(
+            image.release(), [free_list](geometry::RGBDImage *image) {
+                std::lock_guard<std::mutex> lock(free_list->mutex);
+                if (int(free_list->images.size()) < free_list->capacity) {
+                    free_list->images.emplace_back(image);
+                } else {
+                    delete image;
+                }
+            });
+}
+
+int RGBDImagePool::GetNumFreeImages() const {
+    std::lock_guard<std::mutex> lock(free_list_->mutex);
+    return int(free_list_->images.size());
+}
+
+}  // namespace io
+}  // namespace open3d
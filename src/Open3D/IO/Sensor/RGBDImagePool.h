@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+
+namespace open3d {
+namespace io {
+
+/// \class RGBDImagePool
+///
+/// \brief Recycles the RGBDImages that sensor frames are decoded into.
+///
+/// An image handed out by Acquire() goes back to the pool when its last
+/// reference is released, so streaming frames reuses the same buffers
+/// instead of allocating and freeing them at the frame rate. Images the
+/// caller keeps stay valid; the pool allocates new ones meanwhile. Copies of
+/// a pool share its images, and Acquire() may be called concurrently.
+class RGBDImagePool {
+public:
+    /// \brief Creates a pool holding up to \p capacity free images.
+    ///
+    /// If \p width and \p height are given, the images are preallocated with
+    /// an RGB color and a 16 bit depth of that size.
+    explicit RGBDImagePool(int capacity = 4, int width = 0, int height = 0);
+
+    /// Returns a free image, whose content is that of the frame it last held.
+    std::shared_ptr<geometry::RGBDImage> Acquire();
+    /// Returns the number of images waiting in the pool.
+    int GetNumFreeImages() const;
+
+private:
+    struct FreeList {
+        int capacity;
+        std::mutex mutex;
+        std::vector<std::unique_ptr<geometry::RGBDImage>> images;
+    };
+    /// Shared with the deleters of acquired images, which outlive the pool.
+    std::shared_ptr<FreeList> free_list_;
+};
+
+}  // namespace io
+}  // namespace open3d
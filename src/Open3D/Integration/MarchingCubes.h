@@ -0,0 +1,456 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/TSDFVoxelArray.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace integration {
+namespace detail {
+
+/// \brief Parallel marching cubes over the voxels of a blocked grid.
+///
+/// Every block is processed by one task, in three passes: the cube indices of
+/// the cubes whose minimum corner is in the block, the vertices of the block
+/// and the triangles of the block. The vertex on the edge from voxel p to
+/// p + e_axis is owned by the block of p, so that no vertex is created twice,
+/// and a prefix sum over the vertex counts of the blocks gives the global
+/// vertex indices. The triangles are those of the sequential implementation,
+/// based on http://paulbourke.net/geometry/polygonise/, in block order.
+///
+/// Grid provides, in global voxel coordinates,
+///   int NumBlocks() const;
+///   Eigen::Vector3i BlockOrigin(int block) const;
+///   Eigen::Vector3i BlockSize(int block) const;
+///   int FindBlock(int block_hint, const Eigen::Vector3i &voxel) const;
+///   const TSDFVoxelArray &BlockVoxels(int block) const;
+///   int64_t BlockVoxelOffset(int block) const;
+/// where FindBlock() returns -1 outside of the blocks, for voxels at most one
+/// voxel away from the hinted block, and the voxel at (x, y, z) from the
+/// block origin is at BlockVoxelOffset() + (x * size_y + y) * size_z + z of
+/// BlockVoxels(). Voxel v is at origin + (v + 0.5) * voxel_length.
+template <typename Grid>
+class MarchingCubesExtractor {
+public:
+    MarchingCubesExtractor(const Grid &grid,
+                           double voxel_length,
+                           const Eigen::Vector3d &origin,
+                           TSDFVolumeColorType color_type)
+        : grid_(grid),
+          voxel_length_(voxel_length),
+          origin_(origin),
+          color_type_(color_type) {
+        // The cubes around the edge from voxel p along an axis have their
+        // minimum corner at p - d1 * e_(axis + 1) - d2 * e_(axis + 2).
+        for (int i = 0; i < 12; i++) {
+            const int axis = edge_shift[i](3);
+            const int d1 = edge_shift[i]((axis + 1) % 3);
+            const int d2 = edge_shift[i]((axis + 2) % 3);
+            cube_edges_[axis][d1][d2] = i;
+        }
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> Extract() const {
+        const int num_blocks = grid_.NumBlocks();
+        std::vector<BlockOutput> blocks(num_blocks);
+        utility::ParallelFor(0, int64_t(num_blocks), [&](int64_t b) {
+            ComputeCubeIndices(int(b), blocks[b]);
+        });
+        utility::ParallelFor(0, int64_t(num_blocks), [&](int64_t b) {
+            EmitVertices(int(b), blocks, blocks[b]);
+        });
+        std::vector<int> vertex_offsets(num_blocks + 1, 0);
+        for (int b = 0; b < num_blocks; b++) {
+            vertex_offsets[b + 1] =
+                    vertex_offsets[b] + int(blocks[b].edge_keys_.size());
+        }
+        utility::ParallelFor(0, int64_t(num_blocks), [&](int64_t b) {
+            EmitTriangles(int(b), blocks, vertex_offsets, blocks[b]);
+        });
+
+        auto mesh = std::make_shared<geometry::TriangleMesh>();
+        mesh->vertices_.resize(vertex_offsets[num_blocks]);
+        if (color_type_ != TSDFVolumeColorType::NoColor) {
+            mesh->vertex_colors_.resize(vertex_offsets[num_blocks]);
+        }
+        std::vector<size_t> triangle_offsets(num_blocks + 1, 0);
+        for (int b = 0; b < num_blocks; b++) {
+            triangle_offsets[b + 1] =
+                    triangle_offsets[b] + blocks[b].triangles_.size();
+        }
+        mesh->triangles_.resize(triangle_offsets[num_blocks]);
+        utility::ParallelFor(0, int64_t(num_blocks), [&](int64_t b) {
+            const BlockOutput &block = blocks[b];
+            std::copy(block.vertices_.begin(), block.vertices_.end(),
+                      mesh->vertices_.begin() + vertex_offsets[b]);
+            std::copy(block.colors_.begin(), block.colors_.end(),
+                      mesh->vertex_colors_.begin() + vertex_offsets[b]);
+            std::copy(block.triangles_.begin(), block.triangles_.end(),
+                      mesh->triangles_.begin() + triangle_offsets[b]);
+        });
+        return mesh;
+    }
+
+    /// Returns the mesh of the cubes of \p block alone. Its vertices on the
+    /// block boundary are not shared with the meshes of other blocks.
+    std::shared_ptr<geometry::TriangleMesh> ExtractBlock(int block) const {
+        BlockOutput output;
+        ComputeCubeIndices(block, output);
+        const Eigen::Vector3i origin = grid_.BlockOrigin(block);
+        const Eigen::Vector3i size = grid_.BlockSize(block);
+        // Vertex of every edge from the voxels of the block and of the next
+        // voxel along every axis, -1 if not created yet.
+        const int64_t edges_stride_y = size(2) + 1;
+        const int64_t edges_stride_x = (size(1) + 1) * edges_stride_y;
+        std::vector<int> edge_vertices((size(0) + 1) * edges_stride_x * 3, -1);
+        auto mesh = std::make_shared<geometry::TriangleMesh>();
+        int edge_to_index[12];
+        int64_t cube = 0;
+        for (int x = 0; x < size(0); x++) {
+            for (int y = 0; y < size(1); y++) {
+                for (int z = 0; z < size(2); z++) {
+                    const int cube_index = output.cube_indices_[cube++];
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (!(edge_table[cube_index] & (1 << i))) {
+                            continue;
+                        }
+                        const Eigen::Vector3i local =
+                                Eigen::Vector3i(x, y, z) +
+                                edge_shift[i].head<3>();
+                        const int axis = edge_shift[i](3);
+                        int &vertex = edge_vertices
+                                [(local(0) * edges_stride_x +
+                                  local(1) * edges_stride_y + local(2)) *
+                                         3 +
+                                 axis];
+                        if (vertex < 0) {
+                            vertex = int(mesh->vertices_.size());
+                            AppendVertex(block, origin + local, axis,
+                                         mesh->vertices_,
+                                         mesh->vertex_colors_);
+                        }
+                        edge_to_index[i] = vertex;
+                    }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        mesh->triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
+                }
+            }
+        }
+        return mesh;
+    }
+
+private:
+    struct BlockOutput {
+        /// Cube index of every cube of the block, 0 if a corner is unseen.
+        std::vector<uint8_t> cube_indices_;
+        /// Sorted keys of the edges owned by the block that carry a vertex.
+        std::vector<int64_t> edge_keys_;
+        std::vector<Eigen::Vector3d> vertices_;
+        std::vector<Eigen::Vector3d> colors_;
+        std::vector<Eigen::Vector3i> triangles_;
+    };
+
+    int64_t LocalIndex(int block, const Eigen::Vector3i &voxel) const {
+        const Eigen::Vector3i local = voxel - grid_.BlockOrigin(block);
+        const Eigen::Vector3i size = grid_.BlockSize(block);
+        return (int64_t(local(0)) * size(1) + local(1)) * size(2) + local(2);
+    }
+
+    /// Returns the voxel array and the index of \p voxel, or nullptr outside
+    /// of the blocks.
+    const TSDFVoxelArray *FindVoxel(int block,
+                                    const Eigen::Vector3i &voxel,
+                                    int64_t &index) const {
+        const int owner = grid_.FindBlock(block, voxel);
+        if (owner < 0) {
+            return nullptr;
+        }
+        index = grid_.BlockVoxelOffset(owner) + LocalIndex(owner, voxel);
+        return &grid_.BlockVoxels(owner);
+    }
+
+    /// Sign bits of a voxel, 0 if unseen, 1 if outside and 3 if inside the
+    /// surface.
+    static uint8_t SignBits(const TSDFVoxelArray &voxels, int64_t index) {
+        if (voxels.GetWeight(index) == 0.0f) {
+            return 0;
+        }
+        return voxels.GetTSDF(index) < 0.0f ? 3 : 1;
+    }
+
+    void ComputeCubeIndices(int block, BlockOutput &output) const {
+        const Eigen::Vector3i origin = grid_.BlockOrigin(block);
+        const Eigen::Vector3i size = grid_.BlockSize(block);
+        const TSDFVoxelArray &voxels = grid_.BlockVoxels(block);
+        const int64_t offset = grid_.BlockVoxelOffset(block);
+        // Sign bits of the voxels of the block and of the next voxel along
+        // every axis, so that every voxel is read once.
+        const Eigen::Vector3i signs_size = size + Eigen::Vector3i::Ones();
+        const int signs_stride_y = signs_size(2);
+        const int signs_stride_x = signs_size(1) * signs_size(2);
+        std::vector<uint8_t> signs(int64_t(signs_stride_x) * signs_size(0));
+        int64_t index = 0;
+        for (int x = 0; x < signs_size(0); x++) {
+            for (int y = 0; y < signs_size(1); y++) {
+                for (int z = 0; z < signs_size(2); z++, index++) {
+                    if (x < size(0) && y < size(1) && z < size(2)) {
+                        signs[index] = SignBits(
+                                voxels,
+                                offset + (int64_t(x) * size(1) + y) * size(2) +
+                                        z);
+                        continue;
+                    }
+                    int64_t voxel_index;
+                    const TSDFVoxelArray *neighbor = FindVoxel(
+                            block, origin + Eigen::Vector3i(x, y, z),
+                            voxel_index);
+                    if (neighbor) {
+                        signs[index] = SignBits(*neighbor, voxel_index);
+                    }
+                }
+            }
+        }
+        int corner_offsets[8];
+        for (int i = 0; i < 8; i++) {
+            corner_offsets[i] = shift[i](0) * signs_stride_x +
+                                shift[i](1) * signs_stride_y + shift[i](2);
+        }
+
+        output.cube_indices_.resize(int64_t(size(0)) * size(1) * size(2));
+        int64_t cube = 0;
+        for (int x = 0; x < size(0); x++) {
+            for (int y = 0; y < size(1); y++) {
+                for (int z = 0; z < size(2); z++) {
+                    const uint8_t *corner = signs.data() +
+                                            x * signs_stride_x +
+                                            y * signs_stride_y + z;
+                    int cube_index = 0;
+                    for (int i = 0; i < 8; i++) {
+                        const uint8_t bits = corner[corner_offsets[i]];
+                        if (bits == 0) {
+                            cube_index = 0;
+                            break;
+                        }
+                        cube_index |= (bits >> 1) << i;
+                    }
+                    output.cube_indices_[cube++] = uint8_t(cube_index);
+                }
+            }
+        }
+    }
+
+    int GetCubeIndex(int block,
+                     const std::vector<BlockOutput> &blocks,
+                     const Eigen::Vector3i &corner) const {
+        const int owner = grid_.FindBlock(block, corner);
+        if (owner < 0) {
+            return 0;
+        }
+        return blocks[owner].cube_indices_[LocalIndex(owner, corner)];
+    }
+
+    /// True if one of the cubes around the edge along \p axis, with cube
+    /// indices \p cubes as in EmitVertices(), crosses the surface on it.
+    /// Unseen cubes have cube index 0 and never do.
+    bool HasVertex(const int *cubes, int axis) const {
+        const int a1 = (axis + 1) % 3;
+        const int a2 = (axis + 2) % 3;
+        for (int d1 = 0; d1 < 2; d1++) {
+            for (int d2 = 0; d2 < 2; d2++) {
+                Eigen::Vector3i offset(0, 0, 0);
+                offset(a1) = d1;
+                offset(a2) = d2;
+                const int cube_index =
+                        cubes[offset(0) * 4 + offset(1) * 2 + offset(2)];
+                if (edge_table[cube_index] & (1 << cube_edges_[axis][d1][d2])) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    Eigen::Vector3d GetColor(const TSDFVoxelArray &voxels,
+                             int64_t index) const {
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            return voxels.GetColor(index) / 255.0;
+        }
+        return voxels.GetColor(index);
+    }
+
+    /// Appends the vertex on the edge from \p voxel along \p axis, whose
+    /// ends are both seen.
+    void AppendVertex(int block,
+                      const Eigen::Vector3i &voxel,
+                      int axis,
+                      std::vector<Eigen::Vector3d> &vertices,
+                      std::vector<Eigen::Vector3d> &colors) const {
+        Eigen::Vector3i next = voxel;
+        next(axis) += 1;
+        int64_t index0, index1;
+        const TSDFVoxelArray &voxels0 = *FindVoxel(block, voxel, index0);
+        const TSDFVoxelArray &voxels1 = *FindVoxel(block, next, index1);
+        const double half_voxel_length = voxel_length_ * 0.5;
+        Eigen::Vector3d pt(half_voxel_length + voxel_length_ * voxel(0),
+                           half_voxel_length + voxel_length_ * voxel(1),
+                           half_voxel_length + voxel_length_ * voxel(2));
+        const double f0 = std::abs((double)voxels0.GetTSDF(index0));
+        const double f1 = std::abs((double)voxels1.GetTSDF(index1));
+        pt(axis) += f0 * voxel_length_ / (f0 + f1);
+        vertices.push_back(pt + origin_);
+        if (color_type_ != TSDFVolumeColorType::NoColor) {
+            const Eigen::Vector3d c0 = GetColor(voxels0, index0);
+            const Eigen::Vector3d c1 = GetColor(voxels1, index1);
+            colors.push_back((f1 * c0 + f0 * c1) / (f0 + f1));
+        }
+    }
+
+    void EmitVertices(int block,
+                      const std::vector<BlockOutput> &blocks,
+                      BlockOutput &output) const {
+        const Eigen::Vector3i origin = grid_.BlockOrigin(block);
+        const Eigen::Vector3i size = grid_.BlockSize(block);
+        const std::vector<uint8_t> &cube_indices = output.cube_indices_;
+        const int64_t stride_x = int64_t(size(1)) * size(2);
+        const int64_t stride_y = size(2);
+        // Cube indices of the cubes with minimum corner p - (dx, dy, dz) at
+        // dx * 4 + dy * 2 + dz, the cubes around the edges from voxel p.
+        int cubes[8];
+        int64_t index = 0;
+        for (int x = 0; x < size(0); x++) {
+            for (int y = 0; y < size(1); y++) {
+                for (int z = 0; z < size(2); z++, index++) {
+                    const Eigen::Vector3i voxel =
+                            origin + Eigen::Vector3i(x, y, z);
+                    bool crossed = false;
+                    for (int n = 0; n < 8; n++) {
+                        const int dx = n >> 2, dy = (n >> 1) & 1, dz = n & 1;
+                        if (x >= dx && y >= dy && z >= dz) {
+                            cubes[n] = cube_indices[index - dx * stride_x -
+                                                    dy * stride_y - dz];
+                        } else {
+                            cubes[n] = GetCubeIndex(
+                                    block, blocks,
+                                    voxel - Eigen::Vector3i(dx, dy, dz));
+                        }
+                        crossed |= cubes[n] != 0 && cubes[n] != 255;
+                    }
+                    if (!crossed) {
+                        continue;
+                    }
+                    for (int axis = 0; axis < 3; axis++) {
+                        if (!HasVertex(cubes, axis)) {
+                            continue;
+                        }
+                        output.edge_keys_.push_back(index * 3 + axis);
+                        AppendVertex(block, voxel, axis, output.vertices_,
+                                     output.colors_);
+                    }
+                }
+            }
+        }
+    }
+
+    int FindVertex(int block,
+                   const std::vector<BlockOutput> &blocks,
+                   const std::vector<int> &vertex_offsets,
+                   const Eigen::Vector3i &voxel,
+                   int axis) const {
+        const int owner = grid_.FindBlock(block, voxel);
+        const std::vector<int64_t> &keys = blocks[owner].edge_keys_;
+        const auto it = std::lower_bound(keys.begin(), keys.end(),
+                                         LocalIndex(owner, voxel) * 3 + axis);
+        return vertex_offsets[owner] + int(it - keys.begin());
+    }
+
+    void EmitTriangles(int block,
+                       const std::vector<BlockOutput> &blocks,
+                       const std::vector<int> &vertex_offsets,
+                       BlockOutput &output) const {
+        const Eigen::Vector3i origin = grid_.BlockOrigin(block);
+        const Eigen::Vector3i size = grid_.BlockSize(block);
+        int edge_to_index[12];
+        int64_t cube = 0;
+        for (int x = 0; x < size(0); x++) {
+            for (int y = 0; y < size(1); y++) {
+                for (int z = 0; z < size(2); z++) {
+                    const int cube_index = output.cube_indices_[cube++];
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    const Eigen::Vector3i corner =
+                            origin + Eigen::Vector3i(x, y, z);
+                    for (int i = 0; i < 12; i++) {
+                        if (edge_table[cube_index] & (1 << i)) {
+                            edge_to_index[i] = FindVertex(
+                                    block, blocks, vertex_offsets,
+                                    corner + edge_shift[i].head<3>(),
+                                    edge_shift[i](3));
+                        }
+                    }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        output.triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    const Grid &grid_;
+    double voxel_length_;
+    Eigen::Vector3d origin_;
+    TSDFVolumeColorType color_type_;
+    /// Edge of cube (d1, d2) around an edge along an axis, see the
+    /// constructor.
+    int cube_edges_[3][2][2];
+};
+
+}  // namespace detail
+}  // namespace integration
+}  // namespace open3d
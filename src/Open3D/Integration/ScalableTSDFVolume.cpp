@@ -26,362 +26,837 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
-#include <unordered_set>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Integration/MarchingCubes.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/TSDFRaycast.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 namespace integration {
 
-ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
-                                       double sdf_trunc,
-                                       TSDFVolumeColorType color_type,
-                                       int volume_unit_resolution /* = 16*/,
-                                       int depth_sampling_stride /* = 4*/)
+namespace {
+
+const char kVolumeUnitsMagic[8] = {'O', '3', 'D', 'T', 'S', 'D', 'F', '1'};
+
+/// Header of the files of ScalableTSDFVolume::SaveVolumeUnits(), followed by
+/// the units as written by WriteVolumeUnit().
+struct VolumeUnitsHeader {
+    char magic_[8];
+    int32_t resolution_;
+    int32_t color_type_;
+    int32_t precision_;
+    int32_t padding_;
+    double voxel_length_;
+    double sdf_trunc_;
+    int64_t num_units_;
+};
+
+VolumeUnitsHeader MakeVolumeUnitsHeader(const ScalableTSDFVolume &volume,
+                                        int64_t num_units) {
+    VolumeUnitsHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic_, kVolumeUnitsMagic, sizeof(header.magic_));
+    header.resolution_ = volume.volume_unit_resolution_;
+    header.color_type_ = int32_t(volume.color_type_);
+    header.precision_ = int32_t(volume.precision_);
+    header.voxel_length_ = volume.voxel_length_;
+    header.sdf_trunc_ = volume.sdf_trunc_;
+    header.num_units_ = num_units;
+    return header;
+}
+
+bool WriteVolumeUnit(FILE *file,
+                     const Eigen::Vector3i &index,
+                     const UniformTSDFVolume &volume) {
+    const int32_t xyz[3] = {index(0), index(1), index(2)};
+    return fwrite(xyz, sizeof(int32_t), 3, file) == 3 &&
+           volume.voxels_.Write(file);
+}
+
+bool ReadVolumeUnit(FILE *file,
+                    Eigen::Vector3i &index,
+                    UniformTSDFVolume &volume) {
+    int32_t xyz[3];
+    if (fread(xyz, sizeof(int32_t), 3, file) != 3) {
+        return false;
+    }
+    index = Eigen::Vector3i(xyz[0], xyz[1], xyz[2]);
+    return volume.voxels_.Read(file);
+}
+
+bool LessIndex(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+void SortAndRemoveDuplicates(std::vector<Eigen::Vector3i> &indices) {
+    std::sort(indices.begin(), indices.end(), LessIndex);
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+/// Appends the cells of the unit grid crossed by the segment from \p a to
+/// \p b, in cell units, in order along the segment.
+void AppendCellsOnSegment(const Eigen::Vector3d &a,
+                          const Eigen::Vector3d &b,
+                          std::vector<Eigen::Vector3i> &cells) {
+    Eigen::Vector3i cell(int(std::floor(a(0))), int(std::floor(a(1))),
+                         int(std::floor(a(2))));
+    const Eigen::Vector3i last(int(std::floor(b(0))), int(std::floor(b(1))),
+                               int(std::floor(b(2))));
+    // Segment parameter of the next cell boundary along every axis, and
+    // between two boundaries.
+    const Eigen::Vector3d dir = b - a;
+    Eigen::Vector3i step;
+    Eigen::Vector3d t_next, t_delta;
+    for (int i = 0; i < 3; i++) {
+        step(i) = dir(i) > 0.0 ? 1 : -1;
+        if (dir(i) == 0.0) {
+            t_next(i) = t_delta(i) = std::numeric_limits<double>::infinity();
+            continue;
+        }
+        const double boundary = dir(i) > 0.0 ? cell(i) + 1 : cell(i);
+        t_next(i) = (boundary - a(i)) / dir(i);
+        t_delta(i) = 1.0 / std::abs(dir(i));
+    }
+    cells.push_back(cell);
+    const int num_steps = (last - cell).cwiseAbs().sum();
+    for (int n = 0; n < num_steps; n++) {
+        int axis;
+        t_next.minCoeff(&axis);
+        cell(axis) += step(axis);
+        t_next(axis) += t_delta(axis);
+        cells.push_back(cell);
+    }
+}
+
+/// Volume units of a ScalableTSDFVolume in index order, extracted in parallel
+/// by the marching cubes.
+class ScalableVoxelBlocks {
+public:
+    typedef std::unordered_map<Eigen::Vector3i,
+                               ScalableTSDFVolume::VolumeUnit,
+                               utility::hash_eigen::hash<Eigen::Vector3i>>
+            VolumeUnitMap;
+
+    /// \param indices Sorted indices of existing volume units.
+    ScalableVoxelBlocks(const VolumeUnitMap &volume_units,
+                        int resolution,
+                        const std::vector<Eigen::Vector3i> &indices)
+        : resolution_(resolution), indices_(indices) {
+        std::unordered_map<Eigen::Vector3i, int,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                block_of_unit;
+        for (const auto &index : indices_) {
+            block_of_unit[index] = int(volumes_.size());
+            volumes_.push_back(volume_units.at(index).volume_.get());
+        }
+        // The 27 units around every unit, so that lookups one voxel off a
+        // unit need no hashing. Units not in indices are treated as missing.
+        neighbors_.resize(indices_.size() * 27);
+        for (size_t b = 0; b < indices_.size(); b++) {
+            for (int n = 0; n < 27; n++) {
+                const Eigen::Vector3i neighbor =
+                        indices_[b] +
+                        Eigen::Vector3i(n / 9 - 1, n / 3 % 3 - 1, n % 3 - 1);
+                auto it = block_of_unit.find(neighbor);
+                neighbors_[b * 27 + n] =
+                        it == block_of_unit.end() ? -1 : it->second;
+            }
+        }
+    }
+
+    /// Block of the volume unit at \p index, which must be in the blocks.
+    int BlockOf(const Eigen::Vector3i &index) const {
+        return int(std::lower_bound(indices_.begin(), indices_.end(), index,
+                                    LessIndex) -
+                   indices_.begin());
+    }
+
+    int NumBlocks() const { return int(indices_.size()); }
+    Eigen::Vector3i BlockOrigin(int block) const {
+        return indices_[block] * resolution_;
+    }
+    Eigen::Vector3i BlockSize(int /*block*/) const {
+        return Eigen::Vector3i::Constant(resolution_);
+    }
+    int FindBlock(int block_hint, const Eigen::Vector3i &voxel) const {
+        const Eigen::Vector3i local = voxel - BlockOrigin(block_hint);
+        int n = 0;
+        for (int i = 0; i < 3; i++) {
+            n = n * 3 + (local(i) < 0 ? 0 : local(i) < resolution_ ? 1 : 2);
+        }
+        return n == 13 ? block_hint : neighbors_[block_hint * 27 + n];
+    }
+    const TSDFVoxelArray &BlockVoxels(int block) const {
+        return volumes_[block]->voxels_;
+    }
+    int64_t BlockVoxelOffset(int /*block*/) const { return 0; }
+
+private:
+    int resolution_;
+    std::vector<Eigen::Vector3i> indices_;
+    std::vector<const UniformTSDFVolume *> volumes_;
+    std::vector<int> neighbors_;
+};
+
+/// Volume units of a ScalableTSDFVolume, looked up by index while casting
+/// rays. Rays cross missing units in one step.
+class ScalableRaycastUnits {
+public:
+    explicit ScalableRaycastUnits(const ScalableTSDFVolume &volume)
+        : volume_(volume) {}
+
+    int BlockResolution() const { return volume_.volume_unit_resolution_; }
+    const TSDFVoxelArray *FindBlock(const Eigen::Vector3i &block) const {
+        auto it = volume_.volume_units_.find(block);
+        if (it == volume_.volume_units_.end() || !it->second.volume_) {
+            return nullptr;
+        }
+        return &it->second.volume_->voxels_;
+    }
+    int64_t VoxelIndex(const Eigen::Vector3i &block,
+                       const Eigen::Vector3i &voxel) const {
+        const int resolution = volume_.volume_unit_resolution_;
+        const Eigen::Vector3i local = voxel - block * resolution;
+        return (int64_t(local(0)) * resolution + local(1)) * resolution +
+               local(2);
+    }
+    bool ClipRay(const Eigen::Vector3d & /*q0*/,
+                 const Eigen::Vector3d & /*dir*/,
+                 double &d_min,
+                 double &d_max) const {
+        return d_min < d_max;
+    }
+
+private:
+    const ScalableTSDFVolume &volume_;
+};
+
+}  // unnamed namespace
+
+ScalableTSDFVolume::ScalableTSDFVolume(
+        double voxel_length,
+        double sdf_trunc,
+        TSDFVolumeColorType color_type,
+        int volume_unit_resolution /* = 16*/,
+        int depth_sampling_stride /* = 4*/,
+        TSDFVoxelPrecision precision /* = TSDFVoxelPrecision::Float32*/)
     : TSDFVolume(voxel_length, sdf_trunc, color_type),
       volume_unit_resolution_(volume_unit_resolution),
       volume_unit_length_(voxel_length * volume_unit_resolution),
-      depth_sampling_stride_(depth_sampling_stride) {}
+      depth_sampling_stride_(depth_sampling_stride),
+      precision_(precision),
+      max_weight_(std::numeric_limits<double>::infinity()),
+      remove_free_space_units_(false),
+      max_volume_units_in_memory_(0),
+      num_integrated_frames_(0) {}
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Reset() {
+    volume_units_.clear();
+    updated_units_.clear();
+    for (const auto &index : stored_units_) {
+        utility::filesystem::RemoveFile(GetStoredVolumeUnitPath(index));
+    }
+    stored_units_.clear();
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
-    if ((image.depth_.num_of_channels_ != 1) ||
-        (image.depth_.bytes_per_channel_ != 4) ||
-        (image.depth_.width_ != intrinsic.width_) ||
-        (image.depth_.height_ != intrinsic.height_) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.num_of_channels_ != 3) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.bytes_per_channel_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.num_of_channels_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.bytes_per_channel_ != 4) ||
-        (color_type_ != TSDFVolumeColorType::NoColor &&
-         image.color_.width_ != intrinsic.width_) ||
-        (color_type_ != TSDFVolumeColorType::NoColor &&
-         image.color_.height_ != intrinsic.height_)) {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::Integrate");
+    if (!IsSupportedImage(image, intrinsic)) {
         utility::LogError(
                 "[ScalableTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
-    auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
-            image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
-            depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
-                    }
-                }
+    auto depth2cameradistance = GetDepthToCameraDistanceMultiplier(intrinsic);
+    IntegrateWithDepthToCameraDistanceMultiplier(image, intrinsic, extrinsic,
+                                                 *depth2cameradistance);
+}
+
+void ScalableTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier) {
+    IntegrateVolumeUnits(
+            image, intrinsic, extrinsic, depth_to_camera_distance_multiplier,
+            LocateTouchedVolumeUnits(image.depth_, intrinsic, extrinsic));
+}
+
+void ScalableTSDFVolume::IntegrateMultiCamera(
+        const std::vector<TSDFCameraView> &views) {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::IntegrateMultiCamera");
+    const auto multipliers = GetDepthToCameraDistanceMultipliers(views);
+    std::vector<const geometry::Image *> multiplier_ptrs;
+    std::vector<std::vector<Eigen::Vector3i>> view_indices(views.size());
+    std::vector<Eigen::Vector3i> touched_indices;
+    for (size_t v = 0; v < views.size(); v++) {
+        multiplier_ptrs.push_back(multipliers[v].get());
+        view_indices[v] = LocateTouchedVolumeUnits(views[v].image_->depth_,
+                                                   views[v].intrinsic_,
+                                                   views[v].extrinsic_);
+        touched_indices.insert(touched_indices.end(), view_indices[v].begin(),
+                               view_indices[v].end());
+    }
+    SortAndRemoveDuplicates(touched_indices);
+    // Each unit is only integrated with the views that touch it, as by
+    // Integrate().
+    std::vector<std::vector<size_t>> touched_views(touched_indices.size());
+    for (size_t v = 0; v < views.size(); v++) {
+        for (const auto &index : view_indices[v]) {
+            touched_views[std::lower_bound(touched_indices.begin(),
+                                           touched_indices.end(), index,
+                                           LessIndex) -
+                          touched_indices.begin()]
+                    .push_back(v);
+        }
+    }
+    IntegrateVolumeUnits(views, multiplier_ptrs, touched_indices,
+                         touched_views);
+}
+
+void ScalableTSDFVolume::IntegrateVolumeUnits(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier,
+        const std::vector<Eigen::Vector3i> &touched_indices) {
+    IntegrateVolumeUnits({TSDFCameraView(image, intrinsic, extrinsic)},
+                         {&depth_to_camera_distance_multiplier},
+                         touched_indices, {});
+}
+
+void ScalableTSDFVolume::IntegrateVolumeUnits(
+        const std::vector<TSDFCameraView> &views,
+        const std::vector<const geometry::Image *>
+                &depth_to_camera_distance_multipliers,
+        const std::vector<Eigen::Vector3i> &touched_indices,
+        const std::vector<std::vector<size_t>> &touched_views) {
+    // New units are inserted serially; references to the elements of an
+    // unordered_map stay valid, so the units are then filled in parallel.
+    num_integrated_frames_++;
+    std::vector<VolumeUnit *> touched_units(touched_indices.size());
+    std::vector<uint8_t> stored(touched_indices.size());
+    for (size_t i = 0; i < touched_indices.size(); i++) {
+        VolumeUnit &unit = volume_units_[touched_indices[i]];
+        unit.index_ = touched_indices[i];
+        unit.last_integrated_frame_ = num_integrated_frames_;
+        touched_units[i] = &unit;
+        stored[i] = stored_units_.erase(unit.index_) > 0;
+        // The cubes of the units before it along any axis reach into it.
+        for (int n = 0; n < 8; n++) {
+            updated_units_.insert(touched_indices[i] -
+                                  Eigen::Vector3i(n >> 2, (n >> 1) & 1, n & 1));
+        }
+    }
+    utility::ParallelFor(0, int64_t(touched_units.size()), [&](int64_t i) {
+        VolumeUnit &unit = *touched_units[i];
+        if (!unit.volume_) {
+            unit.volume_ = CreateVolumeUnit(unit.index_);
+            if (stored[i]) {
+                LoadStoredVolumeUnit(unit.index_, *unit.volume_);
             }
         }
+        unit.volume_->max_weight_ = max_weight_;
+        if (touched_views.empty()) {
+            unit.volume_
+                    ->IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(
+                            views, depth_to_camera_distance_multipliers);
+            return;
+        }
+        std::vector<TSDFCameraView> unit_views;
+        std::vector<const geometry::Image *> unit_multipliers;
+        for (size_t v : touched_views[i]) {
+            unit_views.push_back(views[v]);
+            unit_multipliers.push_back(depth_to_camera_distance_multipliers[v]);
+        }
+        unit.volume_->IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(
+                unit_views, unit_multipliers);
+    });
+    if (remove_free_space_units_) {
+        RemoveFreeSpaceUnits(touched_indices);
     }
+    EvictVolumeUnits();
 }
 
-std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
-                                }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
-                                }
-                            }
-                        }
+std::vector<Eigen::Vector3i> ScalableTSDFVolume::LocateTouchedVolumeUnits(
+        const geometry::Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) {
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const int stride = depth_sampling_stride_;
+    const int64_t num_rows = (depth.height_ + stride - 1) / stride;
+    const Eigen::Vector3d origin =
+            camera_pose.block<3, 1>(0, 3) / volume_unit_length_;
+
+    // Units of every sampled row, deduplicated per row.
+    std::vector<std::vector<Eigen::Vector3i>> row_units(num_rows);
+    utility::ParallelFor(0, num_rows, [&](int64_t r) {
+        const int v = int(r) * stride;
+        const Eigen::Vector3d ray_row = camera_pose.block<3, 1>(0, 1) *
+                                                ((v - cy) / fy) +
+                                        camera_pose.block<3, 1>(0, 2);
+        std::vector<Eigen::Vector3i> &units = row_units[r];
+        std::vector<Eigen::Vector3i> free_space;
+        for (int u = 0; u < depth.width_; u += stride) {
+            const double z = *depth.PointerAt<float>(u, v);
+            if (!(z > 0.0)) {
+                continue;
+            }
+            // The part of the ray within sdf_trunc_ of the surface, in front
+            // of the camera, in units of volume_unit_length_.
+            const Eigen::Vector3d ray =
+                    camera_pose.block<3, 1>(0, 0) * ((u - cx) / fx) + ray_row;
+            const double ray_length = ray.norm();
+            const double near =
+                    std::max(0.0, z - sdf_trunc_ / ray_length) /
+                    volume_unit_length_;
+            const double far = (z + sdf_trunc_ / ray_length) /
+                               volume_unit_length_;
+            AppendCellsOnSegment(origin + ray * near, origin + ray * far,
+                                 units);
+            if (remove_free_space_units_ && near > 0.0) {
+                free_space.clear();
+                AppendCellsOnSegment(origin, origin + ray * near, free_space);
+                for (const auto &index : free_space) {
+                    if (volume_units_.count(index) > 0 ||
+                        stored_units_.count(index) > 0) {
+                        units.push_back(index);
                     }
                 }
             }
         }
+        SortAndRemoveDuplicates(units);
+    });
+
+    std::vector<Eigen::Vector3i> touched_units;
+    for (const auto &units : row_units) {
+        touched_units.insert(touched_units.end(), units.begin(), units.end());
     }
-    return pointcloud;
+    SortAndRemoveDuplicates(touched_units);
+    return touched_units;
 }
 
-std::shared_ptr<geometry::TriangleMesh>
-ScalableTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
+std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::ExtractPointCloud");
+    const std::vector<Eigen::Vector3i> indices = GetSortedVolumeUnitIndices();
     double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
-                        }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
+    // The units are extracted in parallel, each into its own cloud.
+    std::vector<geometry::PointCloud> clouds(indices.size());
+    utility::ParallelFor(0, int64_t(indices.size()), [&](int64_t u) {
+        const auto &unit = volume_units_.at(indices[u]);
+        if (!unit.volume_) {
+            return;
+        }
+        geometry::PointCloud &pointcloud = clouds[u];
+        const auto &volume0 = *unit.volume_;
+        const auto &index0 = unit.index_;
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    const int v0 = volume0.IndexOf(idx0);
+                    w0 = volume0.voxels_.GetWeight(v0);
+                    f0 = volume0.voxels_.GetTSDF(v0);
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = volume0.voxels_.GetColor(v0).cast<float>();
+                    if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
+                        continue;
+                    }
+                    Eigen::Vector3d p0 =
+                            Eigen::Vector3d(half_voxel_length +
+                                                    voxel_length_ * x,
                                             half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
+                                                    voxel_length_ * y,
                                             half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
+                                                    voxel_length_ * z) +
+                            index0.cast<double>() * volume_unit_length_;
+                    for (int i = 0; i < 3; i++) {
+                        Eigen::Vector3d p1 = p0;
+                        Eigen::Vector3i idx1 = idx0;
+                        Eigen::Vector3i index1 = index0;
+                        p1(i) += voxel_length_;
+                        idx1(i) += 1;
+                        if (idx1(i) < volume0.resolution_) {
+                            const int v1 = volume0.IndexOf(idx1);
+                            w1 = volume0.voxels_.GetWeight(v1);
+                            f1 = volume0.voxels_.GetTSDF(v1);
+                            if (color_type_ != TSDFVolumeColorType::NoColor)
+                                c1 = volume0.voxels_.GetColor(v1)
+                                             .cast<float>();
+                        } else {
+                            idx1(i) -= volume0.resolution_;
+                            index1(i) += 1;
+                            auto unit_itr = volume_units_.find(index1);
+                            if (unit_itr == volume_units_.end()) {
+                                w1 = 0.0f;
+                                f1 = 0.0f;
+                            } else {
+                                const auto &volume1 = *unit_itr->second.volume_;
+                                const int v1 = volume1.IndexOf(idx1);
+                                w1 = volume1.voxels_.GetWeight(v1);
+                                f1 = volume1.voxels_.GetTSDF(v1);
+                                if (color_type_ !=
+                                    TSDFVolumeColorType::NoColor)
+                                    c1 = volume1.voxels_.GetColor(v1)
+                                                 .cast<float>();
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                        if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                            f0 * f1 < 0) {
+                            float r0 = std::fabs(f0);
+                            float r1 = std::fabs(f1);
+                            Eigen::Vector3d p = p0;
+                            p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                            pointcloud.points_.push_back(p);
+                            if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                pointcloud.colors_.push_back(
+                                        ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                         255.0f)
+                                                .cast<double>());
+                            } else if (color_type_ ==
+                                       TSDFVolumeColorType::Gray32) {
+                                pointcloud.colors_.push_back(
+                                        ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                .cast<double>());
+                            }
+                            // has_normal
+                            pointcloud.normals_.push_back(GetNormalAt(p));
                         }
                     }
                 }
             }
         }
+    });
+    return ConcatenatePointClouds(clouds);
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+ScalableTSDFVolume::ExtractTriangleMesh() {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::ExtractTriangleMesh");
+    const std::vector<Eigen::Vector3i> indices = GetSortedVolumeUnitIndices();
+    const ScalableVoxelBlocks blocks(volume_units_, volume_unit_resolution_,
+                                     indices);
+    return detail::MarchingCubesExtractor<ScalableVoxelBlocks>(
+                   blocks, voxel_length_, Eigen::Vector3d::Zero(), color_type_)
+            .Extract();
+}
+
+TSDFRaycastResult ScalableTSDFVolume::Raycast(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_max /* = 3.0*/) {
+    const ScalableRaycastUnits units(*this);
+    return detail::TSDFRaycaster<ScalableRaycastUnits>(
+                   units, voxel_length_, sdf_trunc_, Eigen::Vector3d::Zero(),
+                   color_type_)
+            .Raycast(intrinsic, extrinsic, depth_max);
+}
+
+std::vector<std::pair<Eigen::Vector3i, std::shared_ptr<geometry::TriangleMesh>>>
+ScalableTSDFVolume::ExtractUpdatedVolumeUnitMeshes() {
+    std::vector<Eigen::Vector3i> updated;
+    for (const auto &index : updated_units_) {
+        if (volume_units_.count(index) > 0) {
+            updated.push_back(index);
+        }
+    }
+    updated_units_.clear();
+    SortAndRemoveDuplicates(updated);
+
+    // The cubes of a unit reach into the units after it along every axis.
+    std::vector<Eigen::Vector3i> indices;
+    for (const auto &index : updated) {
+        for (int n = 0; n < 8; n++) {
+            const Eigen::Vector3i neighbor =
+                    index + Eigen::Vector3i(n >> 2, (n >> 1) & 1, n & 1);
+            if (volume_units_.count(neighbor) > 0) {
+                indices.push_back(neighbor);
+            }
+        }
     }
-    return mesh;
+    SortAndRemoveDuplicates(indices);
+    const ScalableVoxelBlocks blocks(volume_units_, volume_unit_resolution_,
+                                     indices);
+    const detail::MarchingCubesExtractor<ScalableVoxelBlocks> extractor(
+            blocks, voxel_length_, Eigen::Vector3d::Zero(), color_type_);
+
+    std::vector<
+            std::pair<Eigen::Vector3i, std::shared_ptr<geometry::TriangleMesh>>>
+            meshes(updated.size());
+    utility::ParallelFor(0, int64_t(updated.size()), [&](int64_t i) {
+        meshes[i].first = updated[i];
+        meshes[i].second = extractor.ExtractBlock(blocks.BlockOf(updated[i]));
+    });
+    return meshes;
 }
 
 std::shared_ptr<geometry::PointCloud>
-ScalableTSDFVolume::ExtractVoxelPointCloud() {
-    auto voxel = std::make_shared<geometry::PointCloud>();
-    for (auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            auto v = unit.second.volume_->ExtractVoxelPointCloud();
-            *voxel += *v;
+ScalableTSDFVolume::ExtractVoxelPointCloud(float min_weight /* = 0.0f*/,
+                                           float max_tsdf /* = 0.98f*/) {
+    OPEN3D_PROFILE_SCOPE("ScalableTSDFVolume::ExtractVoxelPointCloud");
+    const std::vector<Eigen::Vector3i> indices = GetSortedVolumeUnitIndices();
+    // The units are extracted in parallel. The slabs of each unit are then
+    // extracted serially, since ParallelFor does not nest.
+    std::vector<geometry::PointCloud> clouds(indices.size());
+    utility::ParallelFor(0, int64_t(indices.size()), [&](int64_t u) {
+        const auto &volume = volume_units_.at(indices[u]).volume_;
+        if (volume) {
+            clouds[u] = std::move(
+                    *volume->ExtractVoxelPointCloud(min_weight, max_tsdf));
         }
+    });
+    return ConcatenatePointClouds(clouds);
+}
+
+void ScalableTSDFVolume::EnableOutOfCore(const std::string &directory,
+                                         size_t max_volume_units) {
+    if (max_volume_units > 0 &&
+        !utility::filesystem::DirectoryExists(directory) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogError(
+                "[ScalableTSDFVolume::EnableOutOfCore] Cannot create "
+                "directory {}.",
+                directory);
     }
-    return voxel;
+    out_of_core_directory_ = directory;
+    max_volume_units_in_memory_ = max_volume_units;
+    EvictVolumeUnits();
 }
 
-std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
-        const Eigen::Vector3i &index) {
-    auto &unit = volume_units_[index];
-    if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
-                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
-        unit.index_ = index;
+bool ScalableTSDFVolume::SaveVolumeUnits(const std::string &filename) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write TSDF volume units failed: unable to open "
+                            "file: {}",
+                            filename);
+        return false;
+    }
+    const VolumeUnitsHeader header = MakeVolumeUnitsHeader(
+            *this, volume_units_.size() + stored_units_.size());
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const auto &unit : volume_units_) {
+        if (!success) {
+            break;
+        }
+        success = WriteVolumeUnit(file, unit.first, *unit.second.volume_);
+    }
+    for (const auto &index : stored_units_) {
+        if (!success) {
+            break;
+        }
+        // Copied through memory one unit at a time.
+        auto volume = CreateVolumeUnit(index);
+        FILE *stored = utility::filesystem::FOpen(
+                GetStoredVolumeUnitPath(index), "rb");
+        Eigen::Vector3i stored_index;
+        success = stored != NULL &&
+                  ReadVolumeUnit(stored, stored_index, *volume) &&
+                  WriteVolumeUnit(file, index, *volume);
+        if (stored != NULL) {
+            fclose(stored);
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write TSDF volume units failed: {}", filename);
+    }
+    return success;
+}
+
+bool ScalableTSDFVolume::LoadVolumeUnits(const std::string &filename) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read TSDF volume units failed: unable to open "
+                            "file: {}",
+                            filename);
+        return false;
+    }
+    VolumeUnitsHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic_, kVolumeUnitsMagic, sizeof(header.magic_)) !=
+                0) {
+        utility::LogWarning("Read TSDF volume units failed: {} is not a "
+                            "volume unit file.",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    const VolumeUnitsHeader expected =
+            MakeVolumeUnitsHeader(*this, header.num_units_);
+    if (std::memcmp(&header, &expected, sizeof(header)) != 0) {
+        utility::LogWarning("Read TSDF volume units failed: {} was written by "
+                            "a volume with other parameters.",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    Reset();
+    bool success = true;
+    for (int64_t i = 0; i < header.num_units_ && success; i++) {
+        Eigen::Vector3i index;
+        auto volume = CreateVolumeUnit(Eigen::Vector3i::Zero());
+        success = ReadVolumeUnit(file, index, *volume);
+        if (!success) {
+            break;
+        }
+        volume->origin_ = index.cast<double>() * volume_unit_length_;
+        if (max_volume_units_in_memory_ > 0 &&
+            volume_units_.size() >= max_volume_units_in_memory_) {
+            FILE *stored = utility::filesystem::FOpen(
+                    GetStoredVolumeUnitPath(index), "wb");
+            success = stored != NULL && WriteVolumeUnit(stored, index, *volume);
+            if (stored != NULL) {
+                fclose(stored);
+            }
+            stored_units_.insert(index);
+        } else {
+            VolumeUnit &unit = volume_units_[index];
+            unit.index_ = index;
+            unit.volume_ = volume;
+        }
+    }
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Read TSDF volume units failed: {}", filename);
+    }
+    return success;
+}
+
+std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::CreateVolumeUnit(
+        const Eigen::Vector3i &index) const {
+    return std::make_shared<UniformTSDFVolume>(
+            volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
+            color_type_, index.cast<double>() * volume_unit_length_,
+            precision_);
+}
+
+std::string ScalableTSDFVolume::GetStoredVolumeUnitPath(
+        const Eigen::Vector3i &index) const {
+    return utility::filesystem::GetRegularizedDirectoryName(
+                   out_of_core_directory_) +
+           fmt::format("unit_{}_{}_{}.bin", index(0), index(1), index(2));
+}
+
+bool ScalableTSDFVolume::LoadStoredVolumeUnit(const Eigen::Vector3i &index,
+                                              UniformTSDFVolume &volume) {
+    const std::string path = GetStoredVolumeUnitPath(index);
+    FILE *file = utility::filesystem::FOpen(path, "rb");
+    Eigen::Vector3i stored_index;
+    const bool success =
+            file != NULL && ReadVolumeUnit(file, stored_index, volume);
+    if (file != NULL) {
+        fclose(file);
+    }
+    if (!success) {
+        utility::LogWarning("Read TSDF volume unit failed: {}", path);
+        volume.Reset();
+    }
+    utility::filesystem::RemoveFile(path);
+    return success;
+}
+
+void ScalableTSDFVolume::EvictVolumeUnits() {
+    if (max_volume_units_in_memory_ == 0 ||
+        volume_units_.size() <= max_volume_units_in_memory_) {
+        return;
+    }
+    std::vector<const VolumeUnit *> candidates;
+    for (const auto &unit : volume_units_) {
+        if (unit.second.last_integrated_frame_ < num_integrated_frames_ ||
+            num_integrated_frames_ == 0) {
+            candidates.push_back(&unit.second);
+        }
+    }
+    const size_t num_evicted = std::min(
+            candidates.size(),
+            volume_units_.size() - max_volume_units_in_memory_);
+    std::nth_element(candidates.begin(), candidates.begin() + num_evicted,
+                     candidates.end(),
+                     [](const VolumeUnit *a, const VolumeUnit *b) {
+                         return a->last_integrated_frame_ <
+                                b->last_integrated_frame_;
+                     });
+    candidates.resize(num_evicted);
+    std::vector<uint8_t> written(num_evicted);
+    utility::ParallelFor(0, int64_t(num_evicted), [&](int64_t i) {
+        const VolumeUnit &unit = *candidates[i];
+        FILE *file = utility::filesystem::FOpen(
+                GetStoredVolumeUnitPath(unit.index_), "wb");
+        written[i] = file != NULL &&
+                     WriteVolumeUnit(file, unit.index_, *unit.volume_);
+        if (file != NULL) {
+            fclose(file);
+        }
+    });
+    for (size_t i = 0; i < num_evicted; i++) {
+        const Eigen::Vector3i index = candidates[i]->index_;
+        if (!written[i]) {
+            utility::LogWarning("Write TSDF volume unit failed: {}",
+                                GetStoredVolumeUnitPath(index));
+            continue;
+        }
+        stored_units_.insert(index);
+        volume_units_.erase(index);
+    }
+}
+
+void ScalableTSDFVolume::RemoveFreeSpaceUnits(
+        const std::vector<Eigen::Vector3i> &indices) {
+    // Voxels more than two voxels in front of a surface take part in no zero
+    // crossing, not even in the cubes that neighbor units share with them.
+    const float free_tsdf =
+            float(std::min(1.0, 2.0 * voxel_length_ / sdf_trunc_));
+    std::vector<uint8_t> is_free(indices.size());
+    utility::ParallelFor(0, int64_t(indices.size()), [&](int64_t i) {
+        const TSDFVoxelArray &voxels =
+                volume_units_.at(indices[i]).volume_->voxels_;
+        is_free[i] = 1;
+        for (int64_t v = 0; v < voxels.Size(); v++) {
+            if (voxels.GetWeight(v) > 0.0f && voxels.GetTSDF(v) < free_tsdf) {
+                is_free[i] = 0;
+                return;
+            }
+        }
+    });
+    for (size_t i = 0; i < indices.size(); i++) {
+        if (is_free[i]) {
+            volume_units_.erase(indices[i]);
+        }
+    }
+}
+
+std::vector<Eigen::Vector3i> ScalableTSDFVolume::GetSortedVolumeUnitIndices()
+        const {
+    std::vector<Eigen::Vector3i> indices;
+    indices.reserve(volume_units_.size());
+    for (const auto &unit : volume_units_) {
+        indices.push_back(unit.first);
     }
-    return unit.volume_;
+    SortAndRemoveDuplicates(indices);
+    return indices;
 }
 
-Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
+Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(
+        const Eigen::Vector3d &p) const {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
     for (int i = 0; i < 3; i++) {
@@ -394,7 +869,7 @@ Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     return n.normalized();
 }
 
-double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
+double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) const {
     Eigen::Vector3d p_locate =
             p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
     Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
@@ -421,7 +896,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = volume0.voxels_.GetTSDF(volume0.IndexOf(idx1));
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -434,7 +909,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                 f[i] = 0.0f;
             } else {
                 const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
+                f[i] = volume1.voxels_.GetTSDF(volume1.IndexOf(idx1));
             }
         }
     }
@@ -27,9 +27,14 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/TSDFVoxelArray.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
@@ -64,6 +69,8 @@ public:
     public:
         std::shared_ptr<UniformTSDFVolume> volume_;
         Eigen::Vector3i index_;
+        /// Number of the last frame integrated into the unit.
+        int64_t last_integrated_frame_ = 0;
     };
 
 public:
@@ -71,7 +78,9 @@ public:
                        double sdf_trunc,
                        TSDFVolumeColorType color_type,
                        int volume_unit_resolution = 16,
-                       int depth_sampling_stride = 4);
+                       int depth_sampling_stride = 4,
+                       TSDFVoxelPrecision precision =
+                               TSDFVoxelPrecision::Float32);
     ~ScalableTSDFVolume() override;
 
 public:
@@ -79,15 +88,75 @@ public:
     void Integrate(const geometry::RGBDImage &image,
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
+    void IntegrateWithDepthToCameraDistanceMultiplier(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier)
+            override;
+    /// Integrates every view into the volume units it touches, as
+    /// Integrate() would, in one pass over the voxels of each unit. The views
+    /// count as one frame for EnableOutOfCore().
+    void IntegrateMultiCamera(
+            const std::vector<TSDFCameraView> &views) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
-    /// Debug function to extract the voxel data into a point cloud.
-    std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
+    /// Rays cross missing volume units in one step. Units moved out of memory
+    /// by EnableOutOfCore() are missing.
+    TSDFRaycastResult Raycast(const camera::PinholeCameraIntrinsic &intrinsic,
+                              const Eigen::Matrix4d &extrinsic,
+                              double depth_max = 3.0) override;
+    /// \brief Extracts the meshes of the volume units updated since the last
+    /// call.
+    ///
+    /// A unit is updated when a frame is integrated into it or into a unit
+    /// that its cubes reach. Every mesh holds the cubes of one unit, with its
+    /// own vertices, so that a renderer can replace the meshes of the
+    /// returned units only, keyed by unit index. The cost only depends on the
+    /// number of updated units. Units without surface have empty meshes.
+    std::vector<std::pair<Eigen::Vector3i,
+                          std::shared_ptr<geometry::TriangleMesh>>>
+    ExtractUpdatedVolumeUnitMeshes();
+    /// \brief Debug function to extract the voxel data into a point cloud.
+    ///
+    /// See UniformTSDFVolume::ExtractVoxelPointCloud() for \p min_weight and
+    /// \p max_tsdf. The volume units are extracted in parallel, in the order
+    /// of their indices.
+    std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud(
+            float min_weight = 0.0f, float max_tsdf = 0.98f);
+
+    /// \brief Bounds the number of volume units in memory.
+    ///
+    /// After every Integrate(), the units integrated into least recently are
+    /// moved to one file each in \p directory until at most
+    /// \p max_volume_units units are left in memory, and are loaded back
+    /// when a frame is integrated into them again. Units of the last frame
+    /// are always kept. The Extract functions only cover the units in
+    /// memory. A bound of 0 keeps all units in memory.
+    void EnableOutOfCore(const std::string &directory, size_t max_volume_units);
+    /// Writes all volume units, in memory and on disk, to a binary file.
+    bool SaveVolumeUnits(const std::string &filename);
+    /// Replaces the volume units with those written by SaveVolumeUnits() from
+    /// a volume with the same parameters, within the bound of
+    /// EnableOutOfCore().
+    bool LoadVolumeUnits(const std::string &filename);
 
 public:
     int volume_unit_resolution_;
     double volume_unit_length_;
     int depth_sampling_stride_;
+    /// Storage precision of the voxels of the volume units.
+    TSDFVoxelPrecision precision_;
+    /// Cap of the voxel weights, at least 1. At the cap, new observations
+    /// replace old ones at a rate of 1 / max_weight_, so that the volume
+    /// follows changes of dynamic scenes. Infinite by default.
+    double max_weight_;
+    /// If true, Integrate() carves free space: it also integrates the
+    /// existing units that the rays cross in front of the surface, and then
+    /// removes the units of the frame whose voxels are all unobserved or more
+    /// than two voxels in front of a surface, e.g. where a surface has moved
+    /// away. False by default.
+    bool remove_free_space_units_;
 
     /// Assume the index of the volume unit is (x, y, z), then the unit spans
     /// from (x, y, z) * volume_unit_length_
@@ -96,20 +165,77 @@ public:
                        VolumeUnit,
                        utility::hash_eigen::hash<Eigen::Vector3i>>
             volume_units_;
+    /// Indices of the volume units updated since the last call to
+    /// ExtractUpdatedVolumeUnitMeshes(), possibly of missing units.
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            updated_units_;
+    /// Directory of the volume units moved out of memory.
+    std::string out_of_core_directory_;
+    /// Maximum number of volume units in memory, 0 for no bound.
+    size_t max_volume_units_in_memory_;
+    /// Indices of the volume units moved out of memory.
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            stored_units_;
+    /// Number of frames integrated so far.
+    int64_t num_integrated_frames_;
 
 private:
-    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
+    // Locates the units of queued frames ahead of their integration.
+    friend class TSDFIntegrationPipeline;
+
+    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) const {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
     }
 
-    std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
-            const Eigen::Vector3i &index);
-
-    Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
-
-    double GetTSDFAt(const Eigen::Vector3d &p);
+    /// Returns the sorted indices of the volume units crossed by the rays of
+    /// every depth_sampling_stride_-th pixel within sdf_trunc_ of its depth,
+    /// and of the existing units in front of it if remove_free_space_units_.
+    std::vector<Eigen::Vector3i> LocateTouchedVolumeUnits(
+            const geometry::Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic);
+    /// Integrates a frame into the units of \p touched_indices, returned by
+    /// LocateTouchedVolumeUnits() for the frame, creating missing units.
+    void IntegrateVolumeUnits(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier,
+            const std::vector<Eigen::Vector3i> &touched_indices);
+    /// Integrates the views of a multi-camera frame into the units of
+    /// \p touched_indices, the union of the units of the views. The i-th
+    /// unit is integrated with the views of touched_views[i], or with all
+    /// views if \p touched_views is empty.
+    void IntegrateVolumeUnits(
+            const std::vector<TSDFCameraView> &views,
+            const std::vector<const geometry::Image *>
+                    &depth_to_camera_distance_multipliers,
+            const std::vector<Eigen::Vector3i> &touched_indices,
+            const std::vector<std::vector<size_t>> &touched_views);
+
+    std::shared_ptr<UniformTSDFVolume> CreateVolumeUnit(
+            const Eigen::Vector3i &index) const;
+    std::string GetStoredVolumeUnitPath(const Eigen::Vector3i &index) const;
+    /// Reads the voxels of a unit moved out of memory and deletes its file.
+    bool LoadStoredVolumeUnit(const Eigen::Vector3i &index,
+                              UniformTSDFVolume &volume);
+    /// Moves the units integrated into least recently out of memory, down to
+    /// max_volume_units_in_memory_ units.
+    void EvictVolumeUnits();
+    /// Removes the units of \p indices without surface, see
+    /// remove_free_space_units_.
+    void RemoveFreeSpaceUnits(const std::vector<Eigen::Vector3i> &indices);
+
+    /// Returns the indices of the volume units in memory, sorted.
+    std::vector<Eigen::Vector3i> GetSortedVolumeUnitIndices() const;
+
+    Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p) const;
+
+    double GetTSDFAt(const Eigen::Vector3d &p) const;
 };
 
 }  // namespace integration
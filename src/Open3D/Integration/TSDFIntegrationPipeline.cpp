@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFIntegrationPipeline.h"
+
+#include <algorithm>
+
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+TSDFIntegrationPipeline::TSDFIntegrationPipeline(
+        TSDFVolume &volume,
+        int max_queued_frames /* = 8*/,
+        int num_loader_threads /* = 2*/)
+    : volume_(volume), max_queued_frames_(max_queued_frames) {
+    if (max_queued_frames < 1 || num_loader_threads < 1) {
+        utility::LogError(
+                "[TSDFIntegrationPipeline] max_queued_frames and "
+                "num_loader_threads must be positive, but got {} and {}.",
+                max_queued_frames, num_loader_threads);
+    }
+    for (int i = 0; i < num_loader_threads; i++) {
+        loader_threads_.emplace_back([this]() { LoaderLoop(); });
+    }
+    integration_thread_ = std::thread([this]() { IntegrationLoop(); });
+}
+
+TSDFIntegrationPipeline::~TSDFIntegrationPipeline() {
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        frame_done_.wait(lock, [this]() {
+            return num_done_frames_ == num_pushed_frames_;
+        });
+        stop_ = true;
+        error = error_;
+    }
+    frame_pushed_.notify_all();
+    frame_prepared_.notify_all();
+    for (std::thread &thread : loader_threads_) {
+        thread.join();
+    }
+    integration_thread_.join();
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception &e) {
+            utility::LogWarning(
+                    "[TSDFIntegrationPipeline] Frames were skipped: {}",
+                    e.what());
+        } catch (...) {
+            utility::LogWarning(
+                    "[TSDFIntegrationPipeline] Frames were skipped.");
+        }
+    }
+}
+
+void TSDFIntegrationPipeline::Push(
+        const FrameLoader &loader,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) {
+    auto frame = std::make_shared<Frame>();
+    frame->loader_ = loader;
+    frame->intrinsic_ = intrinsic;
+    frame->extrinsic_ = extrinsic;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        frame_done_.wait(lock, [this]() {
+            return num_pushed_frames_ - num_done_frames_ < max_queued_frames_;
+        });
+        pushed_frames_.emplace_back(num_pushed_frames_++, frame);
+    }
+    frame_pushed_.notify_one();
+}
+
+void TSDFIntegrationPipeline::Push(
+        const std::shared_ptr<geometry::RGBDImage> &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) {
+    Push([image]() { return image; }, intrinsic, extrinsic);
+}
+
+void TSDFIntegrationPipeline::Finish() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_done_.wait(lock, [this]() {
+        return num_done_frames_ == num_pushed_frames_;
+    });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+int64_t TSDFIntegrationPipeline::GetNumIntegratedFrames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_integrated_frames_;
+}
+
+void TSDFIntegrationPipeline::LoaderLoop() {
+    while (true) {
+        int64_t index;
+        std::shared_ptr<Frame> frame;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_pushed_.wait(lock, [this]() {
+                return stop_ || !pushed_frames_.empty();
+            });
+            if (stop_) {
+                return;
+            }
+            index = pushed_frames_.front().first;
+            frame = pushed_frames_.front().second;
+            pushed_frames_.pop_front();
+            if (error_) {
+                frame.reset();
+            }
+        }
+        if (frame) {
+            try {
+                PrepareFrame(*frame);
+            } catch (...) {
+                SetError(std::current_exception());
+                frame.reset();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            prepared_frames_[index] = frame;
+        }
+        frame_prepared_.notify_one();
+    }
+}
+
+void TSDFIntegrationPipeline::IntegrationLoop() {
+    int64_t next_index = 0;
+    while (true) {
+        std::shared_ptr<Frame> frame;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_prepared_.wait(lock, [&]() {
+                return stop_ || prepared_frames_.count(next_index) > 0;
+            });
+            if (stop_) {
+                return;
+            }
+            auto it = prepared_frames_.find(next_index);
+            frame = it->second;
+            prepared_frames_.erase(it);
+            if (error_) {
+                frame.reset();
+            }
+        }
+        next_index++;
+        bool integrated = false;
+        if (frame) {
+            try {
+                if (frame->units_located_) {
+                    static_cast<ScalableTSDFVolume &>(volume_)
+                            .IntegrateVolumeUnits(
+                                    *frame->image_, frame->intrinsic_,
+                                    frame->extrinsic_,
+                                    *frame->depth_to_camera_distance_,
+                                    frame->touched_units_);
+                } else {
+                    volume_.IntegrateWithDepthToCameraDistanceMultiplier(
+                            *frame->image_, frame->intrinsic_,
+                            frame->extrinsic_,
+                            *frame->depth_to_camera_distance_);
+                }
+                integrated = true;
+            } catch (...) {
+                SetError(std::current_exception());
+            }
+            // Frees the images before the frame leaves the pipeline.
+            frame.reset();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_done_frames_++;
+            num_integrated_frames_ += integrated ? 1 : 0;
+        }
+        frame_done_.notify_all();
+    }
+}
+
+void TSDFIntegrationPipeline::PrepareFrame(Frame &frame) {
+    frame.image_ = frame.loader_();
+    frame.loader_ = nullptr;
+    if (!frame.image_ ||
+        !volume_.IsSupportedImage(*frame.image_, frame.intrinsic_)) {
+        utility::LogError(
+                "[TSDFIntegrationPipeline] Unsupported image format.");
+    }
+    frame.depth_to_camera_distance_ =
+            GetDepthToCameraDistance(frame.intrinsic_);
+    // Without carving, the units of a frame do not depend on the volume.
+    auto scalable = dynamic_cast<ScalableTSDFVolume *>(&volume_);
+    if (scalable && !scalable->remove_free_space_units_) {
+        frame.touched_units_ = scalable->LocateTouchedVolumeUnits(
+                frame.image_->depth_, frame.intrinsic_, frame.extrinsic_);
+        frame.units_located_ = true;
+    }
+}
+
+std::shared_ptr<const geometry::Image>
+TSDFIntegrationPipeline::GetDepthToCameraDistance(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    // The integration thread does not use the cache of the volume.
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return volume_.GetDepthToCameraDistanceMultiplier(intrinsic);
+}
+
+void TSDFIntegrationPipeline::SetError(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!error_) {
+        error_ = error;
+    }
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Integration/TSDFVolume.h"
+
+namespace open3d {
+namespace integration {
+
+/// \class TSDFIntegrationPipeline
+///
+/// \brief Integrates a sequence of frames into a TSDFVolume, overlapping the
+/// loading and preprocessing of the next frames with the integration of the
+/// current one.
+///
+/// Frames pass through two stages. Loader threads call the loader of a
+/// frame, e.g. reading and converting its images, and prepare the frame:
+/// they check its format, look up the multipliers from depth to camera
+/// distance cached by the volume, and for a ScalableTSDFVolume locate the
+/// volume units of the frame. One integration
+/// thread then integrates the frames in the order they were pushed. At most
+/// max_queued_frames frames are in the pipeline at once; Push() blocks until
+/// there is room, which bounds the memory of loaded frames.
+///
+/// The volume must not be used otherwise until Finish() returns. The result
+/// is the same as integrating the frames one after the other, except that
+/// with remove_free_space_units_ the units are located by the integration
+/// thread, since they depend on the volume.
+///
+/// Example:
+/// ```cpp
+/// TSDFIntegrationPipeline pipeline(volume);
+/// for (size_t i = 0; i < color_files.size(); i++) {
+///     pipeline.Push([&, i]() { return ReadRGBDImage(i); }, intrinsic,
+///                   trajectory.parameters_[i].extrinsic_);
+/// }
+/// pipeline.Finish();
+/// ```
+class TSDFIntegrationPipeline {
+public:
+    /// Returns the RGB-D image of a frame. Called by a loader thread.
+    typedef std::function<std::shared_ptr<geometry::RGBDImage>()> FrameLoader;
+
+    /// \brief Parameterized Constructor. Starts the threads.
+    ///
+    /// \param volume Volume the frames are integrated into.
+    /// \param max_queued_frames Maximum number of frames pushed but not yet
+    /// integrated, at least 1.
+    /// \param num_loader_threads Number of threads loading and preparing
+    /// frames, at least 1.
+    TSDFIntegrationPipeline(TSDFVolume &volume,
+                            int max_queued_frames = 8,
+                            int num_loader_threads = 2);
+    /// Waits for the frames in the pipeline and stops the threads. Errors
+    /// not yet reported by Finish() are logged as warnings.
+    ~TSDFIntegrationPipeline();
+
+public:
+    /// Queues a frame whose image is returned by \p loader, blocking while
+    /// max_queued_frames frames are in the pipeline.
+    void Push(const FrameLoader &loader,
+              const camera::PinholeCameraIntrinsic &intrinsic,
+              const Eigen::Matrix4d &extrinsic);
+    /// Queues a frame whose image is already loaded.
+    void Push(const std::shared_ptr<geometry::RGBDImage> &image,
+              const camera::PinholeCameraIntrinsic &intrinsic,
+              const Eigen::Matrix4d &extrinsic);
+    /// \brief Waits until all pushed frames are integrated.
+    ///
+    /// If a loader or the integration of a frame threw, the frames not yet
+    /// integrated are skipped and the first exception is rethrown here. The
+    /// pipeline can then be used for more frames.
+    void Finish();
+    /// Number of frames integrated so far.
+    int64_t GetNumIntegratedFrames() const;
+
+private:
+    struct Frame {
+        FrameLoader loader_;
+        camera::PinholeCameraIntrinsic intrinsic_;
+        Eigen::Matrix4d extrinsic_;
+        std::shared_ptr<geometry::RGBDImage> image_;
+        std::shared_ptr<const geometry::Image> depth_to_camera_distance_;
+        /// Volume units of the frame, if located by a loader thread.
+        std::vector<Eigen::Vector3i> touched_units_;
+        bool units_located_ = false;
+    };
+
+    void LoaderLoop();
+    void IntegrationLoop();
+    /// Loads a frame and prepares it for integration.
+    void PrepareFrame(Frame &frame);
+    /// Returns the multipliers of an intrinsic, cached by the volume.
+    std::shared_ptr<const geometry::Image> GetDepthToCameraDistance(
+            const camera::PinholeCameraIntrinsic &intrinsic);
+    /// Records the first error and skips the frames not yet integrated.
+    void SetError(std::exception_ptr error);
+
+private:
+    TSDFVolume &volume_;
+    const int64_t max_queued_frames_;
+
+    mutable std::mutex mutex_;
+    /// Signals loader threads: frames to load, or stop.
+    std::condition_variable frame_pushed_;
+    /// Signals the integration thread: a frame is prepared, or stop.
+    std::condition_variable frame_prepared_;
+    /// Signals Push() and Finish(): a frame left the pipeline.
+    std::condition_variable frame_done_;
+    /// Frames to load, with their sequence numbers.
+    std::deque<std::pair<int64_t, std::shared_ptr<Frame>>> pushed_frames_;
+    /// Prepared frames by sequence number; null if skipped.
+    std::map<int64_t, std::shared_ptr<Frame>> prepared_frames_;
+    int64_t num_pushed_frames_ = 0;
+    /// Frames that left the pipeline, integrated or skipped.
+    int64_t num_done_frames_ = 0;
+    int64_t num_integrated_frames_ = 0;
+    std::exception_ptr error_;
+    bool stop_ = false;
+
+    std::mutex cache_mutex_;
+
+    std::vector<std::thread> loader_threads_;
+    std::thread integration_thread_;
+};
+
+}  // namespace integration
+}  // namespace open3d
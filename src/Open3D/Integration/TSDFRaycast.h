@@ -0,0 +1,352 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/TSDFVoxelArray.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace integration {
+namespace detail {
+
+/// Clips the ray q0 + d * dir, d in [d_min, d_max], to the box [lo, hi].
+/// Returns false if the clipped ray is empty.
+inline bool ClipRayToBox(const Eigen::Vector3d &q0,
+                         const Eigen::Vector3d &dir,
+                         const Eigen::Vector3d &lo,
+                         const Eigen::Vector3d &hi,
+                         double &d_min,
+                         double &d_max) {
+    for (int i = 0; i < 3; i++) {
+        if (dir(i) == 0.0) {
+            if (q0(i) < lo(i) || q0(i) >= hi(i)) {
+                return false;
+            }
+            continue;
+        }
+        double d0 = (lo(i) - q0(i)) / dir(i);
+        double d1 = (hi(i) - q0(i)) / dir(i);
+        if (d0 > d1) {
+            std::swap(d0, d1);
+        }
+        d_min = std::max(d_min, d0);
+        d_max = std::min(d_max, d1);
+    }
+    return d_min < d_max;
+}
+
+/// \brief Parallel ray casting of a blocked TSDF grid.
+///
+/// Every pixel marches along its ray in voxel coordinates, crossing missing
+/// or empty blocks in one step and otherwise stepping by the distance that
+/// the TSDF guarantees to be free, at least one voxel. The first crossing
+/// from positive to negative trilinearly interpolated TSDF is the hit; the
+/// TSDF is only interpolated between observed voxels. Rows of pixels are
+/// cast in parallel.
+///
+/// Grid provides, in global voxel coordinates,
+///   int BlockResolution() const;
+///   const TSDFVoxelArray *FindBlock(const Eigen::Vector3i &block) const;
+///   int64_t VoxelIndex(const Eigen::Vector3i &block,
+///                      const Eigen::Vector3i &voxel) const;
+///   bool ClipRay(const Eigen::Vector3d &q0, const Eigen::Vector3d &dir,
+///                double &d_min, double &d_max) const;
+/// where block b holds the voxels b * resolution to (b + 1) * resolution - 1,
+/// FindBlock() returns nullptr for blocks without observed voxels,
+/// VoxelIndex() returns the index of a voxel of the block in its array or -1
+/// if it does not exist, and ClipRay() clips a ray to the grid. Voxel v is at
+/// origin + (v + 0.5) * voxel_length.
+template <typename Grid>
+class TSDFRaycaster {
+public:
+    TSDFRaycaster(const Grid &grid,
+                  double voxel_length,
+                  double sdf_trunc,
+                  const Eigen::Vector3d &origin,
+                  TSDFVolumeColorType color_type)
+        : grid_(grid),
+          voxel_length_(voxel_length),
+          sdf_trunc_(sdf_trunc),
+          origin_(origin),
+          color_type_(color_type) {}
+
+    TSDFRaycastResult Raycast(const camera::PinholeCameraIntrinsic &intrinsic,
+                              const Eigen::Matrix4d &extrinsic,
+                              double depth_max) const {
+        const int width = intrinsic.width_;
+        const int height = intrinsic.height_;
+        TSDFRaycastResult result;
+        result.depth_.Prepare(width, height, 1, 4);
+        result.normal_.Prepare(width, height, 3, 4);
+        std::fill(result.depth_.data_.begin(), result.depth_.data_.end(), 0);
+        std::fill(result.normal_.data_.begin(), result.normal_.data_.end(),
+                  0);
+        if (color_type_ != TSDFVolumeColorType::NoColor) {
+            result.color_.Prepare(width, height, 3, 4);
+            std::fill(result.color_.data_.begin(), result.color_.data_.end(),
+                      0);
+        }
+
+        const double fx = intrinsic.GetFocalLength().first;
+        const double fy = intrinsic.GetFocalLength().second;
+        const double cx = intrinsic.GetPrincipalPoint().first;
+        const double cy = intrinsic.GetPrincipalPoint().second;
+        const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+        const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+        // Rays in voxel units, parameterized by the depth of the pixel.
+        const Eigen::Vector3d q0 =
+                (camera_to_world.block<3, 1>(0, 3) - origin_) / voxel_length_;
+        utility::ParallelFor(0, int64_t(height), [&](int64_t v) {
+            BlockCache cache;
+            for (int u = 0; u < width; u++) {
+                const Eigen::Vector3d dir =
+                        rotation * Eigen::Vector3d((u - cx) / fx,
+                                                   (v - cy) / fy, 1.0) /
+                        voxel_length_;
+                double depth;
+                Eigen::Vector3d q;
+                if (!CastRay(q0, dir, depth_max, cache, depth, q)) {
+                    continue;
+                }
+                *result.depth_.PointerAt<float>(u, int(v)) = float(depth);
+                const Eigen::Vector3d normal =
+                        extrinsic.block<3, 3>(0, 0) * GetNormal(q, cache);
+                for (int c = 0; c < 3; c++) {
+                    *result.normal_.PointerAt<float>(u, int(v), c) =
+                            float(normal(c));
+                }
+                if (color_type_ != TSDFVolumeColorType::NoColor) {
+                    const Eigen::Vector3d color = GetColor(q, cache);
+                    for (int c = 0; c < 3; c++) {
+                        *result.color_.PointerAt<float>(u, int(v), c) =
+                                float(color(c));
+                    }
+                }
+            }
+        });
+        return result;
+    }
+
+private:
+    /// Last block looked up by a ray, which is usually the next one too.
+    struct BlockCache {
+        Eigen::Vector3i block_ = Eigen::Vector3i::Constant(
+                std::numeric_limits<int>::min());
+        const TSDFVoxelArray *voxels_ = nullptr;
+    };
+
+    static int FloorDiv(int a, int b) {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+
+    const TSDFVoxelArray *FindBlock(const Eigen::Vector3i &block,
+                                    BlockCache &cache) const {
+        if (block != cache.block_) {
+            cache.block_ = block;
+            cache.voxels_ = grid_.FindBlock(block);
+        }
+        return cache.voxels_;
+    }
+
+    /// Finds an observed voxel.
+    bool FindVoxel(const Eigen::Vector3i &voxel,
+                   BlockCache &cache,
+                   const TSDFVoxelArray *&voxels,
+                   int64_t &index) const {
+        const int r = grid_.BlockResolution();
+        const Eigen::Vector3i block(FloorDiv(voxel(0), r),
+                                    FloorDiv(voxel(1), r),
+                                    FloorDiv(voxel(2), r));
+        voxels = FindBlock(block, cache);
+        if (voxels == nullptr) {
+            return false;
+        }
+        index = grid_.VoxelIndex(block, voxel);
+        return index >= 0 && voxels->GetWeight(index) > 0.0f;
+    }
+
+    /// Trilinear TSDF at q, in voxel units. Returns false unless all eight
+    /// voxels around q are observed.
+    bool GetTSDF(const Eigen::Vector3d &q,
+                 BlockCache &cache,
+                 float &tsdf) const {
+        const Eigen::Vector3d p = q - Eigen::Vector3d::Constant(0.5);
+        const Eigen::Vector3i v0(int(std::floor(p(0))), int(std::floor(p(1))),
+                                 int(std::floor(p(2))));
+        const Eigen::Vector3d r = p - v0.cast<double>();
+        double sum = 0.0;
+        for (int c = 0; c < 8; c++) {
+            const Eigen::Vector3i offset(c >> 2, (c >> 1) & 1, c & 1);
+            const TSDFVoxelArray *voxels;
+            int64_t index;
+            if (!FindVoxel(v0 + offset, cache, voxels, index)) {
+                return false;
+            }
+            sum += CornerWeight(r, offset) * voxels->GetTSDF(index);
+        }
+        tsdf = float(sum);
+        return true;
+    }
+
+    static double CornerWeight(const Eigen::Vector3d &r,
+                               const Eigen::Vector3i &offset) {
+        return (offset(0) ? r(0) : 1.0 - r(0)) *
+               (offset(1) ? r(1) : 1.0 - r(1)) *
+               (offset(2) ? r(2) : 1.0 - r(2));
+    }
+
+    /// Marches the ray q0 + d * dir. Returns the depth d and the point q of
+    /// its first hit, or false if it does not hit the surface.
+    bool CastRay(const Eigen::Vector3d &q0,
+                 const Eigen::Vector3d &dir,
+                 double depth_max,
+                 BlockCache &cache,
+                 double &depth,
+                 Eigen::Vector3d &q) const {
+        double d = 0.0;
+        double d_max = depth_max;
+        if (!grid_.ClipRay(q0, dir, d, d_max)) {
+            return false;
+        }
+        // Depth per voxel of distance and per sdf_trunc_ of distance.
+        const double voxel_step = 1.0 / dir.norm();
+        const double trunc_step = sdf_trunc_ / voxel_length_ * voxel_step;
+        const int r = grid_.BlockResolution();
+        bool has_prev = false;
+        float prev_tsdf = 0.0f;
+        double prev_d = 0.0;
+        while (d < d_max) {
+            q = q0 + d * dir;
+            const Eigen::Vector3i block(int(std::floor(q(0) / r)),
+                                        int(std::floor(q(1) / r)),
+                                        int(std::floor(q(2) / r)));
+            if (FindBlock(block, cache) == nullptr) {
+                // Cross the block at once; it has no observed voxels.
+                double d_enter = d, d_exit = d_max;
+                if (!ClipRayToBox(
+                            q0, dir, (block * r).cast<double>(),
+                            ((block.array() + 1) * r).matrix().cast<double>(),
+                            d_enter, d_exit)) {
+                    d_exit = d;
+                }
+                d = std::max(d_exit, d) + 0.01 * voxel_step;
+                has_prev = false;
+                continue;
+            }
+            float tsdf;
+            if (!GetTSDF(q, cache, tsdf)) {
+                d += voxel_step;
+                has_prev = false;
+                continue;
+            }
+            if (has_prev && prev_tsdf > 0.0f && tsdf <= 0.0f) {
+                depth = prev_d + (d - prev_d) * prev_tsdf / (prev_tsdf - tsdf);
+                q = q0 + depth * dir;
+                return true;
+            }
+            has_prev = true;
+            prev_tsdf = tsdf;
+            prev_d = d;
+            d += std::max(voxel_step, tsdf * trunc_step);
+        }
+        return false;
+    }
+
+    /// Unit TSDF gradient at q, by central differences where both sides are
+    /// observed and one-sided differences otherwise.
+    Eigen::Vector3d GetNormal(const Eigen::Vector3d &q,
+                              BlockCache &cache) const {
+        float center = 0.0f;
+        GetTSDF(q, cache, center);
+        Eigen::Vector3d gradient;
+        for (int i = 0; i < 3; i++) {
+            const Eigen::Vector3d e = Eigen::Vector3d::Unit(i);
+            float next, prev;
+            const bool has_next = GetTSDF(q + e, cache, next);
+            const bool has_prev = GetTSDF(q - e, cache, prev);
+            if (has_next && has_prev) {
+                gradient(i) = 0.5 * (next - prev);
+            } else if (has_next) {
+                gradient(i) = next - center;
+            } else if (has_prev) {
+                gradient(i) = center - prev;
+            } else {
+                gradient(i) = 0.0;
+            }
+        }
+        const double norm = gradient.norm();
+        return norm > 0.0 ? Eigen::Vector3d(gradient / norm)
+                          : Eigen::Vector3d::Zero();
+    }
+
+    /// Color in [0, 1] at q, interpolated between the observed voxels around
+    /// q.
+    Eigen::Vector3d GetColor(const Eigen::Vector3d &q,
+                             BlockCache &cache) const {
+        const Eigen::Vector3d p = q - Eigen::Vector3d::Constant(0.5);
+        const Eigen::Vector3i v0(int(std::floor(p(0))), int(std::floor(p(1))),
+                                 int(std::floor(p(2))));
+        const Eigen::Vector3d r = p - v0.cast<double>();
+        Eigen::Vector3d color = Eigen::Vector3d::Zero();
+        double weight = 0.0;
+        for (int c = 0; c < 8; c++) {
+            const Eigen::Vector3i offset(c >> 2, (c >> 1) & 1, c & 1);
+            const TSDFVoxelArray *voxels;
+            int64_t index;
+            if (FindVoxel(v0 + offset, cache, voxels, index)) {
+                const double w = CornerWeight(r, offset);
+                color += w * voxels->GetColor(index);
+                weight += w;
+            }
+        }
+        if (weight == 0.0) {
+            return color;
+        }
+        color /= weight;
+        return color_type_ == TSDFVolumeColorType::RGB8 ? color / 255.0
+                                                        : color;
+    }
+
+    const Grid &grid_;
+    double voxel_length_;
+    double sdf_trunc_;
+    Eigen::Vector3d origin_;
+    TSDFVolumeColorType color_type_;
+};
+
+}  // namespace detail
+}  // namespace integration
+}  // namespace open3d
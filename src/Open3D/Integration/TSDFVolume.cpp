@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVolume.h"
+
+#include <algorithm>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace integration {
+
+void TSDFVolume::IntegrateMultiCamera(
+        const std::vector<TSDFCameraView> &views) {
+    for (const auto &view : views) {
+        Integrate(*view.image_, view.intrinsic_, view.extrinsic_);
+    }
+}
+
+bool TSDFVolume::IsSupportedImage(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic) const {
+    if (image.depth_.num_of_channels_ != 1 ||
+        image.depth_.bytes_per_channel_ != 4 ||
+        image.depth_.width_ != intrinsic.width_ ||
+        image.depth_.height_ != intrinsic.height_) {
+        return false;
+    }
+    if (color_type_ == TSDFVolumeColorType::NoColor) {
+        return true;
+    }
+    if (image.color_.width_ != intrinsic.width_ ||
+        image.color_.height_ != intrinsic.height_) {
+        return false;
+    }
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        return image.color_.num_of_channels_ == 3 &&
+               image.color_.bytes_per_channel_ == 1;
+    }
+    return image.color_.num_of_channels_ == 1 &&
+           image.color_.bytes_per_channel_ == 4;
+}
+
+std::shared_ptr<const geometry::Image>
+TSDFVolume::GetDepthToCameraDistanceMultiplier(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    const size_t max_cached_intrinsics = 8;
+    auto &cache = depth_to_camera_distance_multipliers_;
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (it->first.width_ == intrinsic.width_ &&
+            it->first.height_ == intrinsic.height_ &&
+            it->first.intrinsic_matrix_ == intrinsic.intrinsic_matrix_) {
+            std::rotate(it, it + 1, cache.end());
+            return cache.back().second;
+        }
+    }
+    if (cache.size() == max_cached_intrinsics) {
+        cache.erase(cache.begin());
+    }
+    cache.emplace_back(
+            intrinsic,
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic));
+    return cache.back().second;
+}
+
+std::vector<std::shared_ptr<const geometry::Image>>
+TSDFVolume::GetDepthToCameraDistanceMultipliers(
+        const std::vector<TSDFCameraView> &views) {
+    std::vector<std::shared_ptr<const geometry::Image>> multipliers;
+    multipliers.reserve(views.size());
+    for (const auto &view : views) {
+        if (!IsSupportedImage(*view.image_, view.intrinsic_)) {
+            utility::LogError(
+                    "[TSDFVolume::IntegrateMultiCamera] Unsupported image "
+                    "format.");
+        }
+        multipliers.push_back(
+                GetDepthToCameraDistanceMultiplier(view.intrinsic_));
+    }
+    return multipliers;
+}
+
+std::shared_ptr<geometry::PointCloud> TSDFVolume::ConcatenatePointClouds(
+        const std::vector<geometry::PointCloud> &clouds) {
+    std::vector<size_t> offsets(clouds.size() + 1, 0);
+    bool has_normals = false;
+    bool has_colors = false;
+    for (size_t i = 0; i < clouds.size(); i++) {
+        offsets[i + 1] = offsets[i] + clouds[i].points_.size();
+        has_normals = has_normals || clouds[i].HasNormals();
+        has_colors = has_colors || clouds[i].HasColors();
+    }
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    pointcloud->points_.resize(offsets.back());
+    if (has_normals) {
+        pointcloud->normals_.resize(offsets.back());
+    }
+    if (has_colors) {
+        pointcloud->colors_.resize(offsets.back());
+    }
+    utility::ParallelFor(0, int64_t(clouds.size()), [&](int64_t i) {
+        const geometry::PointCloud &cloud = clouds[i];
+        std::copy(cloud.points_.begin(), cloud.points_.end(),
+                  pointcloud->points_.begin() + offsets[i]);
+        std::copy(cloud.normals_.begin(), cloud.normals_.end(),
+                  pointcloud->normals_.begin() + offsets[i]);
+        std::copy(cloud.colors_.begin(), cloud.colors_.end(),
+                  pointcloud->colors_.begin() + offsets[i]);
+    });
+    return pointcloud;
+}
+
+}  // namespace integration
+}  // namespace open3d
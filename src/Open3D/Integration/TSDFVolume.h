@@ -26,7 +26,12 @@
 
 #pragma once
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -46,6 +51,41 @@ enum class TSDFVolumeColorType {
     Gray32 = 2,
 };
 
+/// \class TSDFRaycastResult
+///
+/// Images of a TSDFVolume rendered by TSDFVolume::Raycast(). Pixels whose
+/// rays do not hit the surface are zero in all images.
+class TSDFRaycastResult {
+public:
+    /// Float32 depth along the camera z axis in meters.
+    geometry::Image depth_;
+    /// 3-channel Float32 unit normals in camera coordinates, facing the
+    /// camera.
+    geometry::Image normal_;
+    /// 3-channel Float32 RGB in [0, 1], gray replicated for Gray32, and empty
+    /// without color.
+    geometry::Image color_;
+};
+
+/// \class TSDFCameraView
+///
+/// One camera of a multi-camera frame, see TSDFVolume::IntegrateMultiCamera().
+class TSDFCameraView {
+public:
+    /// \param image RGB-D image of the camera, which must outlive the view.
+    /// \param intrinsic Intrinsic parameters of the camera.
+    /// \param extrinsic World to camera transformation.
+    TSDFCameraView(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic)
+        : image_(&image), intrinsic_(intrinsic), extrinsic_(extrinsic) {}
+
+public:
+    const geometry::RGBDImage *image_;
+    camera::PinholeCameraIntrinsic intrinsic_;
+    Eigen::Matrix4d extrinsic_;
+};
+
 /// \class TSDFVolume
 ///
 /// \brief Base class of the Truncated Signed Distance Function (TSDF) volume.
@@ -81,6 +121,46 @@ public:
                            const camera::PinholeCameraIntrinsic &intrinsic,
                            const Eigen::Matrix4d &extrinsic) = 0;
 
+    /// \brief Function to integrate an RGB-D image with the per-pixel
+    /// multipliers from depth to camera distance precomputed from the
+    /// intrinsic, see
+    /// geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage().
+    ///
+    /// The default implementation ignores the multipliers and calls
+    /// Integrate().
+    virtual void IntegrateWithDepthToCameraDistanceMultiplier(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier) {
+        Integrate(image, intrinsic, extrinsic);
+    }
+
+    /// \brief Function to integrate the RGB-D images of synchronized cameras
+    /// into the volume.
+    ///
+    /// Every camera adds one observation to the voxels it sees, as if its
+    /// image were integrated by Integrate(). The volumes visit each voxel
+    /// once and project it into all cameras, instead of once per camera.
+    /// The default implementation calls Integrate() for every view.
+    virtual void IntegrateMultiCamera(const std::vector<TSDFCameraView> &views);
+
+    /// Returns true if Integrate() accepts the image: a 1-channel Float32
+    /// depth image of the size of the intrinsic, and a color image of the
+    /// same size with 3 UInt8 channels for RGB8 or 1 Float32 channel for
+    /// Gray32.
+    bool IsSupportedImage(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic) const;
+
+    /// Returns the per-pixel multipliers from depth to camera distance of
+    /// \p intrinsic, see
+    /// geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage().
+    /// They are cached for the last few intrinsics, so that a sequence of
+    /// frames of one or several cameras computes them once.
+    std::shared_ptr<const geometry::Image> GetDepthToCameraDistanceMultiplier(
+            const camera::PinholeCameraIntrinsic &intrinsic);
+
     /// Function to extract a point cloud with normals.
     virtual std::shared_ptr<geometry::PointCloud> ExtractPointCloud() = 0;
 
@@ -88,6 +168,21 @@ public:
     /// algorithm. (https://en.wikipedia.org/wiki/Marching_cubes)
     virtual std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() = 0;
 
+    /// \brief Function to render depth, normal and color images of the
+    /// surface by casting the ray of every pixel into the volume.
+    ///
+    /// The rays march over the TSDF, skipping unallocated blocks of voxels,
+    /// up to the first zero crossing from positive to negative TSDF. The
+    /// images are a model frame for frame-to-model odometry.
+    ///
+    /// \param intrinsic Intrinsic parameters and size of the images.
+    /// \param extrinsic World to camera transformation.
+    /// \param depth_max Depth in meters beyond which rays stop.
+    virtual TSDFRaycastResult Raycast(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max = 3.0) = 0;
+
 public:
     /// Length of the voxel in meters.
     double voxel_length_;
@@ -95,6 +190,26 @@ public:
     double sdf_trunc_;
     /// Color type of the TSDF volume.
     TSDFVolumeColorType color_type_;
+
+protected:
+    /// Returns the multipliers of the intrinsics of \p views, see
+    /// GetDepthToCameraDistanceMultiplier(), after checking their images
+    /// with IsSupportedImage().
+    std::vector<std::shared_ptr<const geometry::Image>>
+    GetDepthToCameraDistanceMultipliers(
+            const std::vector<TSDFCameraView> &views);
+
+    /// Concatenates the attributes of \p clouds in order, copying the clouds
+    /// in parallel. Used to merge the clouds extracted from parts of the
+    /// volume in parallel.
+    static std::shared_ptr<geometry::PointCloud> ConcatenatePointClouds(
+            const std::vector<geometry::PointCloud> &clouds);
+
+private:
+    /// Multipliers of the last intrinsics, most recently used last.
+    std::vector<std::pair<camera::PinholeCameraIntrinsic,
+                          std::shared_ptr<const geometry::Image>>>
+            depth_to_camera_distance_multipliers_;
 };
 
 }  // namespace integration
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVoxelArray.h"
+
+namespace open3d {
+namespace integration {
+
+TSDFVoxelArray::TSDFVoxelArray(
+        int64_t num_voxels,
+        TSDFVolumeColorType color_type,
+        TSDFVoxelPrecision precision /* = TSDFVoxelPrecision::Float32*/)
+    : num_voxels_(num_voxels),
+      color_channels_(color_type == TSDFVolumeColorType::RGB8
+                              ? 3
+                              : (color_type == TSDFVolumeColorType::Gray32
+                                         ? 1
+                                         : 0)),
+      precision_(precision) {
+    Reset();
+}
+
+void TSDFVoxelArray::Reset() {
+    const size_t n = size_t(num_voxels_);
+    const size_t num_colors = n * color_channels_;
+    if (precision_ == TSDFVoxelPrecision::Float32) {
+        tsdf_.assign(n, 0.0f);
+        weight_.assign(n, 0.0f);
+        color_.assign(num_colors, 0.0f);
+    } else {
+        tsdf_half_.assign(n, Half(0.0f));
+        weight_u16_.assign(n, 0);
+        if (color_channels_ == 3) {
+            color_u8_.assign(num_colors, 0);
+        } else {
+            color_half_.assign(num_colors, Half(0.0f));
+        }
+    }
+}
+
+size_t TSDFVoxelArray::GetStorageBytes() const {
+    return tsdf_.size() * sizeof(float) + weight_.size() * sizeof(float) +
+           color_.size() * sizeof(float) + tsdf_half_.size() * sizeof(Half) +
+           weight_u16_.size() * sizeof(uint16_t) +
+           color_u8_.size() * sizeof(uint8_t) +
+           color_half_.size() * sizeof(Half);
+}
+
+namespace {
+
+template <typename T>
+bool WriteArray(FILE *file, const std::vector<T> &array) {
+    return fwrite(array.data(), sizeof(T), array.size(), file) ==
+           array.size();
+}
+
+template <typename T>
+bool ReadArray(FILE *file, std::vector<T> &array) {
+    return fread(array.data(), sizeof(T), array.size(), file) ==
+           array.size();
+}
+
+}  // unnamed namespace
+
+bool TSDFVoxelArray::Write(FILE *file) const {
+    return WriteArray(file, tsdf_) && WriteArray(file, weight_) &&
+           WriteArray(file, color_) && WriteArray(file, tsdf_half_) &&
+           WriteArray(file, weight_u16_) && WriteArray(file, color_u8_) &&
+           WriteArray(file, color_half_);
+}
+
+bool TSDFVoxelArray::Read(FILE *file) {
+    return ReadArray(file, tsdf_) && ReadArray(file, weight_) &&
+           ReadArray(file, color_) && ReadArray(file, tsdf_half_) &&
+           ReadArray(file, weight_u16_) && ReadArray(file, color_u8_) &&
+           ReadArray(file, color_half_);
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "Open3D/Core/Half.h"
+#include "Open3D/Integration/TSDFVolume.h"
+
+namespace open3d {
+namespace integration {
+
+/// \enum TSDFVoxelPrecision
+///
+/// Storage precision of the voxels of a UniformTSDFVolume.
+enum class TSDFVoxelPrecision {
+    /// 32-bit float TSDF, weight and color channels, 12 to 20 bytes per
+    /// voxel.
+    Float32 = 0,
+    /// 16-bit float TSDF, 16-bit integer weight that saturates at 65535, and
+    /// 8-bit RGB or 16-bit float gray color, 4 to 7 bytes per voxel.
+    Compact = 1,
+};
+
+/// \class TSDFVoxelArray
+///
+/// Voxels of a TSDF volume as separate TSDF, weight and color arrays, so that
+/// integration and extraction only stream the fields they use. Voxels are
+/// addressed by their linear index; their grid coordinates are implied.
+class TSDFVoxelArray {
+public:
+    TSDFVoxelArray() {}
+    /// \brief Parameterized Constructor. All voxels start with zero TSDF,
+    /// weight and color.
+    ///
+    /// \param num_voxels Number of voxels.
+    /// \param color_type Color type of the volume. RGB8 stores three channels
+    /// in [0, 255], Gray32 one channel and NoColor none.
+    /// \param precision Storage precision.
+    TSDFVoxelArray(int64_t num_voxels,
+                   TSDFVolumeColorType color_type,
+                   TSDFVoxelPrecision precision = TSDFVoxelPrecision::Float32);
+
+public:
+    /// Sets all voxels to zero TSDF, weight and color.
+    void Reset();
+    /// Number of voxels.
+    int64_t Size() const { return num_voxels_; }
+    TSDFVoxelPrecision GetPrecision() const { return precision_; }
+    /// Memory used by the arrays, in bytes.
+    size_t GetStorageBytes() const;
+    /// Writes the arrays to a binary file, GetStorageBytes() bytes.
+    bool Write(FILE *file) const;
+    /// Reads the arrays written by Write() from an array of the same size,
+    /// color type and precision.
+    bool Read(FILE *file);
+
+    float GetTSDF(int64_t index) const {
+        return precision_ == TSDFVoxelPrecision::Float32
+                       ? tsdf_[index]
+                       : float(tsdf_half_[index]);
+    }
+
+    float GetWeight(int64_t index) const {
+        return precision_ == TSDFVoxelPrecision::Float32
+                       ? weight_[index]
+                       : float(weight_u16_[index]);
+    }
+
+    /// Color of a voxel, in [0, 255] for RGB8 and replicated for Gray32.
+    Eigen::Vector3d GetColor(int64_t index) const {
+        if (color_channels_ == 3) {
+            if (precision_ == TSDFVoxelPrecision::Float32) {
+                return Eigen::Vector3d(color_[3 * index],
+                                       color_[3 * index + 1],
+                                       color_[3 * index + 2]);
+            }
+            return Eigen::Vector3d(color_u8_[3 * index],
+                                   color_u8_[3 * index + 1],
+                                   color_u8_[3 * index + 2]);
+        }
+        if (color_channels_ == 1) {
+            return Eigen::Vector3d::Constant(
+                    precision_ == TSDFVoxelPrecision::Float32
+                            ? color_[index]
+                            : float(color_half_[index]));
+        }
+        return Eigen::Vector3d::Zero();
+    }
+
+    /// \brief Adds an observation to the running weighted averages of a
+    /// voxel and increments its weight.
+    ///
+    /// \param index Linear index of the voxel.
+    /// \param tsdf Truncated signed distance of the observation.
+    /// \param color Color of the observation, with color_channels values in
+    /// the range of GetColor(). Ignored without color.
+    /// \param max_weight Weight cap, at least 1. At the cap, the averages
+    /// become exponential moving averages with rate 1 / max_weight.
+    void Integrate(int64_t index,
+                   float tsdf,
+                   const float *color,
+                   float max_weight = std::numeric_limits<float>::infinity()) {
+        IntegrateObservations(index, tsdf, color, 1.0f, max_weight);
+    }
+
+    /// \brief Adds \p num_observations observations to the running weighted
+    /// averages of a voxel at once and adds \p num_observations to its
+    /// weight.
+    ///
+    /// The result is that of Integrate() for every observation, up to
+    /// rounding, unless the weight reaches \p max_weight. The voxel is then
+    /// weighted by max_weight - num_observations, at least 0, so that each
+    /// observation has a weight of 1. \p tsdf_sum and \p color_sum are the
+    /// sums over the observations.
+    void IntegrateObservations(
+            int64_t index,
+            float tsdf_sum,
+            const float *color_sum,
+            float num_observations,
+            float max_weight = std::numeric_limits<float>::infinity()) {
+        if (precision_ == TSDFVoxelPrecision::Float32) {
+            const float weight =
+                    std::max(0.0f, std::min(weight_[index],
+                                            max_weight - num_observations));
+            const float inv_weight = 1.0f / (weight + num_observations);
+            tsdf_[index] = (tsdf_[index] * weight + tsdf_sum) * inv_weight;
+            float *voxel_color = color_.data() + color_channels_ * index;
+            for (int c = 0; c < color_channels_; ++c) {
+                voxel_color[c] =
+                        (voxel_color[c] * weight + color_sum[c]) * inv_weight;
+            }
+            weight_[index] = weight + num_observations;
+            return;
+        }
+        const float weight =
+                std::max(0.0f, std::min(float(weight_u16_[index]),
+                                        max_weight - num_observations));
+        const float inv_weight = 1.0f / (weight + num_observations);
+        tsdf_half_[index] =
+                (float(tsdf_half_[index]) * weight + tsdf_sum) * inv_weight;
+        if (color_channels_ == 3) {
+            uint8_t *voxel_color = color_u8_.data() + 3 * index;
+            for (int c = 0; c < 3; ++c) {
+                const float value =
+                        (voxel_color[c] * weight + color_sum[c]) * inv_weight;
+                voxel_color[c] = uint8_t(
+                        std::min(255.0f, std::max(0.0f, value + 0.5f)));
+            }
+        } else if (color_channels_ == 1) {
+            color_half_[index] =
+                    (float(color_half_[index]) * weight + color_sum[0]) *
+                    inv_weight;
+        }
+        weight_u16_[index] = uint16_t(
+                std::min(weight + num_observations, float(UINT16_MAX)));
+    }
+
+private:
+    int64_t num_voxels_ = 0;
+    int color_channels_ = 0;
+    TSDFVoxelPrecision precision_ = TSDFVoxelPrecision::Float32;
+    /// Arrays of the Float32 precision.
+    std::vector<float> tsdf_;
+    std::vector<float> weight_;
+    std::vector<float> color_;
+    /// Arrays of the Compact precision.
+    std::vector<Half> tsdf_half_;
+    std::vector<uint16_t> weight_u16_;
+    std::vector<uint8_t> color_u8_;
+    std::vector<Half> color_half_;
+};
+
+}  // namespace integration
+}  // namespace open3d
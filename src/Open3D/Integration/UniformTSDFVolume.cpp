@@ -26,34 +26,157 @@
 
 #include "Open3D/Integration/UniformTSDFVolume.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <thread>
-#include <unordered_map>
 
 #include "Open3D/Geometry/VoxelGrid.h"
-#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/MarchingCubes.h"
+#include "Open3D/Integration/TSDFRaycast.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Profiler.h"
 
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// The slabs of constant x of a UniformTSDFVolume, extracted in parallel by
+/// the marching cubes.
+class UniformVoxelSlabs {
+public:
+    explicit UniformVoxelSlabs(const UniformTSDFVolume &volume)
+        : volume_(volume) {}
+
+    int NumBlocks() const { return volume_.resolution_; }
+    Eigen::Vector3i BlockOrigin(int block) const {
+        return Eigen::Vector3i(block, 0, 0);
+    }
+    Eigen::Vector3i BlockSize(int /*block*/) const {
+        return Eigen::Vector3i(1, volume_.resolution_, volume_.resolution_);
+    }
+    int FindBlock(int /*block_hint*/, const Eigen::Vector3i &voxel) const {
+        if ((voxel.array() < 0).any() ||
+            (voxel.array() >= volume_.resolution_).any()) {
+            return -1;
+        }
+        return voxel(0);
+    }
+    const TSDFVoxelArray &BlockVoxels(int /*block*/) const {
+        return volume_.voxels_;
+    }
+    int64_t BlockVoxelOffset(int block) const {
+        return volume_.IndexOf(block, 0, 0);
+    }
+
+private:
+    const UniformTSDFVolume &volume_;
+};
+
+/// Blocks of 8^3 voxels of a UniformTSDFVolume, marked when they contain an
+/// observed voxel, so that rays cross the empty space in few steps.
+class UniformVoxelBlocks {
+public:
+    static constexpr int kBlockResolution = 8;
+
+    explicit UniformVoxelBlocks(const UniformTSDFVolume &volume)
+        : volume_(volume),
+          num_blocks_((volume.resolution_ + kBlockResolution - 1) /
+                      kBlockResolution),
+          observed_(size_t(num_blocks_) * num_blocks_ * num_blocks_, 0) {
+        const int resolution = volume.resolution_;
+        utility::ParallelFor(0, int64_t(observed_.size()), [&](int64_t b) {
+            const Eigen::Vector3i block(int(b / num_blocks_ / num_blocks_),
+                                        int(b / num_blocks_ % num_blocks_),
+                                        int(b % num_blocks_));
+            const Eigen::Vector3i begin = block * kBlockResolution;
+            const Eigen::Vector3i end =
+                    (begin.array() + kBlockResolution).min(resolution);
+            for (int x = begin(0); x < end(0); x++) {
+                for (int y = begin(1); y < end(1); y++) {
+                    for (int z = begin(2); z < end(2); z++) {
+                        if (volume.voxels_.GetWeight(volume.IndexOf(x, y, z)) >
+                            0.0f) {
+                            observed_[b] = 1;
+                            return;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    int BlockResolution() const { return kBlockResolution; }
+    const TSDFVoxelArray *FindBlock(const Eigen::Vector3i &block) const {
+        if ((block.array() < 0).any() || (block.array() >= num_blocks_).any() ||
+            !observed_[(size_t(block(0)) * num_blocks_ + block(1)) *
+                               num_blocks_ +
+                       block(2)]) {
+            return nullptr;
+        }
+        return &volume_.voxels_;
+    }
+    int64_t VoxelIndex(const Eigen::Vector3i & /*block*/,
+                       const Eigen::Vector3i &voxel) const {
+        if ((voxel.array() >= volume_.resolution_).any()) {
+            return -1;
+        }
+        return volume_.IndexOf(voxel);
+    }
+    bool ClipRay(const Eigen::Vector3d &q0,
+                 const Eigen::Vector3d &dir,
+                 double &d_min,
+                 double &d_max) const {
+        return detail::ClipRayToBox(
+                q0, dir, Eigen::Vector3d::Zero(),
+                Eigen::Vector3d::Constant(volume_.resolution_), d_min, d_max);
+    }
+
+private:
+    const UniformTSDFVolume &volume_;
+    int num_blocks_;
+    std::vector<uint8_t> observed_;
+};
+
+/// Projection of a TSDFCameraView, in floats.
+struct CameraProjection {
+    float fx_;
+    float fy_;
+    float cx_;
+    float cy_;
+    float safe_width_;
+    float safe_height_;
+    Eigen::Matrix4f extrinsic_;
+    /// Step of the camera coordinates along the z axis of the volume.
+    Eigen::Vector3f z_step_;
+    const geometry::RGBDImage *image_;
+    const geometry::Image *depth_to_camera_distance_multiplier_;
+};
+
+}  // unnamed namespace
+
 UniformTSDFVolume::UniformTSDFVolume(
         double length,
         int resolution,
         double sdf_trunc,
         TSDFVolumeColorType color_type,
-        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/)
+        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/,
+        TSDFVoxelPrecision precision /* = TSDFVoxelPrecision::Float32*/)
     : TSDFVolume(length / (double)resolution, sdf_trunc, color_type),
+      voxels_(int64_t(resolution) * resolution * resolution,
+              color_type,
+              precision),
       origin_(origin),
       length_(length),
       resolution_(resolution),
-      voxel_num_(resolution * resolution * resolution) {
-    voxels_.resize(voxel_num_);
-}
+      voxel_num_(resolution * resolution * resolution),
+      max_weight_(std::numeric_limits<double>::infinity()) {}
 
 UniformTSDFVolume::~UniformTSDFVolume() {}
 
-void UniformTSDFVolume::Reset() { voxels_.clear(); }
+void UniformTSDFVolume::Reset() { voxels_.Reset(); }
 
 void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -62,42 +185,43 @@ void UniformTSDFVolume::Integrate(
     // This function goes through the voxels, and scan convert the relative
     // depth/color value into the voxel.
     // The following implementation is a highly optimized version.
-    if ((image.depth_.num_of_channels_ != 1) ||
-        (image.depth_.bytes_per_channel_ != 4) ||
-        (image.depth_.width_ != intrinsic.width_) ||
-        (image.depth_.height_ != intrinsic.height_) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.num_of_channels_ != 3) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.bytes_per_channel_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.num_of_channels_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.bytes_per_channel_ != 4) ||
-        (color_type_ != TSDFVolumeColorType::NoColor &&
-         image.color_.width_ != intrinsic.width_) ||
-        (color_type_ != TSDFVolumeColorType::NoColor &&
-         image.color_.height_ != intrinsic.height_)) {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::Integrate");
+    if (!IsSupportedImage(image, intrinsic)) {
         utility::LogError(
                 "[UniformTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
+    auto depth2cameradistance = GetDepthToCameraDistanceMultiplier(intrinsic);
     IntegrateWithDepthToCameraDistanceMultiplier(image, intrinsic, extrinsic,
                                                  *depth2cameradistance);
 }
 
+void UniformTSDFVolume::IntegrateMultiCamera(
+        const std::vector<TSDFCameraView> &views) {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::IntegrateMultiCamera");
+    const auto multipliers = GetDepthToCameraDistanceMultipliers(views);
+    std::vector<const geometry::Image *> multiplier_ptrs;
+    for (const auto &multiplier : multipliers) {
+        multiplier_ptrs.push_back(multiplier.get());
+    }
+    IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(views,
+                                                            multiplier_ptrs);
+}
+
 std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::ExtractPointCloud");
     double half_voxel_length = voxel_length_ * 0.5;
-    for (int x = 1; x < resolution_ - 1; x++) {
+    // The slabs of constant x are extracted in parallel, each into its own
+    // cloud.
+    std::vector<geometry::PointCloud> slabs(std::max(resolution_, 0));
+    utility::ParallelFor(1, int64_t(resolution_) - 1, [&](int64_t slab) {
+        geometry::PointCloud &pointcloud = slabs[slab];
+        const int x = int(slab);
         for (int y = 1; y < resolution_ - 1; y++) {
             for (int z = 1; z < resolution_ - 1; z++) {
                 Eigen::Vector3i idx0(x, y, z);
-                float w0 = voxels_[IndexOf(idx0)].weight_;
-                float f0 = voxels_[IndexOf(idx0)].tsdf_;
-                const Eigen::Vector3d &c0 = voxels_[IndexOf(idx0)].color_;
+                float w0 = voxels_.GetWeight(IndexOf(idx0));
+                float f0 = voxels_.GetTSDF(IndexOf(idx0));
+                const Eigen::Vector3d c0 = voxels_.GetColor(IndexOf(idx0));
 
                 if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
                     continue;
@@ -111,150 +235,83 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                     Eigen::Vector3i idx1 = idx0;
                     idx1(i) += 1;
                     if (idx1(i) < resolution_ - 1) {
-                        float w1 = voxels_[IndexOf(idx1)].weight_;
-                        float f1 = voxels_[IndexOf(idx1)].tsdf_;
-                        const Eigen::Vector3d &c1 =
-                                voxels_[IndexOf(idx1)].color_;
+                        float w1 = voxels_.GetWeight(IndexOf(idx1));
+                        float f1 = voxels_.GetTSDF(IndexOf(idx1));
+                        const Eigen::Vector3d c1 =
+                                voxels_.GetColor(IndexOf(idx1));
                         if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
                             f0 * f1 < 0) {
                             float r0 = std::fabs(f0);
                             float r1 = std::fabs(f1);
                             Eigen::Vector3d p = p0;
                             p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
-                            pointcloud->points_.push_back(p + origin_);
+                            pointcloud.points_.push_back(p + origin_);
                             if (color_type_ == TSDFVolumeColorType::RGB8) {
-                                pointcloud->colors_.push_back(
+                                pointcloud.colors_.push_back(
                                         ((c0 * r1 + c1 * r0) / (r0 + r1) /
                                          255.0f)
                                                 .cast<double>());
                             } else if (color_type_ ==
                                        TSDFVolumeColorType::Gray32) {
-                                pointcloud->colors_.push_back(
+                                pointcloud.colors_.push_back(
                                         ((c0 * r1 + c1 * r0) / (r0 + r1))
                                                 .cast<double>());
                             }
                             // has_normal
-                            pointcloud->normals_.push_back(GetNormalAt(p));
+                            pointcloud.normals_.push_back(GetNormalAt(p));
                         }
                     }
                 }
             }
         }
-    }
-    return pointcloud;
+    });
+    return ConcatenatePointClouds(slabs);
 }
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    // Map of "edge_index = (x, y, z, 0) + edge_shift" to "global vertex index"
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (int x = 0; x < resolution_ - 1; x++) {
-        for (int y = 0; y < resolution_ - 1; y++) {
-            for (int z = 0; z < resolution_ - 1; z++) {
-                int cube_index = 0;
-                float f[8];
-                Eigen::Vector3d c[8];
-                for (int i = 0; i < 8; i++) {
-                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
-
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
-                        cube_index = 0;
-                        break;
-                    } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
-                        if (f[i] < 0.0f) {
-                            cube_index |= (1 << i);
-                        }
-                        if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
-                        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
-                        }
-                    }
-                }
-                if (cube_index == 0 || cube_index == 255) {
-                    continue;
-                }
-                for (int i = 0; i < 12; i++) {
-                    if (edge_table[cube_index] & (1 << i)) {
-                        Eigen::Vector4i edge_index =
-                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
-                        if (edgeindex_to_vertexindex.find(edge_index) ==
-                            edgeindex_to_vertexindex.end()) {
-                            edge_to_index[i] = (int)mesh->vertices_.size();
-                            edgeindex_to_vertexindex[edge_index] =
-                                    (int)mesh->vertices_.size();
-                            Eigen::Vector3d pt(
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(0),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(1),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(2));
-                            double f0 = std::abs((double)f[edge_to_vert[i][0]]);
-                            double f1 = std::abs((double)f[edge_to_vert[i][1]]);
-                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
-                            mesh->vertices_.push_back(pt + origin_);
-                            if (color_type_ != TSDFVolumeColorType::NoColor) {
-                                const auto &c0 = c[edge_to_vert[i][0]];
-                                const auto &c1 = c[edge_to_vert[i][1]];
-                                mesh->vertex_colors_.push_back(
-                                        (f1 * c0 + f0 * c1) / (f0 + f1));
-                            }
-                        } else {
-                            edge_to_index[i] =
-                                    edgeindex_to_vertexindex.find(edge_index)
-                                            ->second;
-                        }
-                    }
-                }
-                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
-                    mesh->triangles_.push_back(Eigen::Vector3i(
-                            edge_to_index[tri_table[cube_index][i]],
-                            edge_to_index[tri_table[cube_index][i + 2]],
-                            edge_to_index[tri_table[cube_index][i + 1]]));
-                }
-            }
-        }
-    }
-    return mesh;
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::ExtractTriangleMesh");
+    const UniformVoxelSlabs slabs(*this);
+    return detail::MarchingCubesExtractor<UniformVoxelSlabs>(
+                   slabs, voxel_length_, origin_, color_type_)
+            .Extract();
 }
 
-std::shared_ptr<geometry::PointCloud>
-UniformTSDFVolume::ExtractVoxelPointCloud() const {
-    auto voxel = std::make_shared<geometry::PointCloud>();
+TSDFRaycastResult UniformTSDFVolume::Raycast(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_max /* = 3.0*/) {
+    const UniformVoxelBlocks blocks(*this);
+    return detail::TSDFRaycaster<UniformVoxelBlocks>(
+                   blocks, voxel_length_, sdf_trunc_, origin_, color_type_)
+            .Raycast(intrinsic, extrinsic, depth_max);
+}
+
+std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractVoxelPointCloud(
+        float min_weight /* = 0.0f*/, float max_tsdf /* = 0.98f*/) const {
+    OPEN3D_PROFILE_SCOPE("UniformTSDFVolume::ExtractVoxelPointCloud");
     double half_voxel_length = voxel_length_ * 0.5;
-    // const float *p_tsdf = (const float *)tsdf_.data();
-    // const float *p_weight = (const float *)weight_.data();
-    // const float *p_color = (const float *)color_.data();
-    for (int x = 0; x < resolution_; x++) {
+    std::vector<geometry::PointCloud> slabs(std::max(resolution_, 0));
+    utility::ParallelFor(0, int64_t(resolution_), [&](int64_t slab) {
+        geometry::PointCloud &voxel = slabs[slab];
+        const int x = int(slab);
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
-                Eigen::Vector3d pt(half_voxel_length + voxel_length_ * x,
-                                   half_voxel_length + voxel_length_ * y,
-                                   half_voxel_length + voxel_length_ * z);
-                int ind = IndexOf(x, y, z);
-                if (voxels_[ind].weight_ != 0.0f &&
-                    voxels_[ind].tsdf_ < 0.98f &&
-                    voxels_[ind].tsdf_ >= -0.98f) {
-                    voxel->points_.push_back(pt + origin_);
-                    double c = (voxels_[ind].tsdf_ + 1.0) * 0.5;
-                    voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
+                const int ind = IndexOf(x, y, z);
+                const float f = voxels_.GetTSDF(ind);
+                if (voxels_.GetWeight(ind) > min_weight && f < max_tsdf &&
+                    f >= -max_tsdf) {
+                    Eigen::Vector3d pt(half_voxel_length + voxel_length_ * x,
+                                       half_voxel_length + voxel_length_ * y,
+                                       half_voxel_length + voxel_length_ * z);
+                    voxel.points_.push_back(pt + origin_);
+                    double c = (f + 1.0) * 0.5;
+                    voxel.colors_.push_back(Eigen::Vector3d(c, c, c));
                 }
             }
         }
-    }
-    return voxel;
+    });
+    return ConcatenatePointClouds(slabs);
 }
 
 std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
@@ -267,8 +324,8 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
+                const float w = voxels_.GetWeight(ind);
+                const float f = voxels_.GetTSDF(ind);
                 if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     double c = (f + 1.0) * 0.5;
                     Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
@@ -286,96 +343,113 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
-    const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
-    const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
-    const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
-    const float cy = static_cast<float>(intrinsic.GetPrincipalPoint().second);
-    const Eigen::Matrix4f extrinsic_f = extrinsic.cast<float>();
+    IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(
+            {TSDFCameraView(image, intrinsic, extrinsic)},
+            {&depth_to_camera_distance_multiplier});
+}
+
+void UniformTSDFVolume::
+        IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(
+                const std::vector<TSDFCameraView> &views,
+                const std::vector<const geometry::Image *>
+                        &depth_to_camera_distance_multipliers) {
     const float voxel_length_f = static_cast<float>(voxel_length_);
     const float half_voxel_length_f = voxel_length_f * 0.5f;
     const float sdf_trunc_f = static_cast<float>(sdf_trunc_);
     const float sdf_trunc_inv_f = 1.0f / sdf_trunc_f;
-    const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
-    const float safe_width_f = intrinsic.width_ - 0.0001f;
-    const float safe_height_f = intrinsic.height_ - 0.0001f;
-
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
-                                       float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
-                                       1.f);
-            Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
-                     pt_camera(0) += extrinsic_scaled_f(0, 2),
-                     pt_camera(1) += extrinsic_scaled_f(1, 2),
-                     pt_camera(2) += extrinsic_scaled_f(2, 2)) {
-                // Skip if negative depth after projection
-                if (pt_camera(2) <= 0) {
-                    continue;
-                }
-                // Skip if x-y coordinate not in range
-                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
-                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
-                if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
-                      v_f < safe_height_f)) {
-                    continue;
-                }
-                // Skip if negative depth in depth image
-                int u = (int)u_f;
-                int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
-                }
+    const float max_weight_f = static_cast<float>(max_weight_);
+    std::vector<CameraProjection> cameras(views.size());
+    for (size_t c = 0; c < views.size(); c++) {
+        const camera::PinholeCameraIntrinsic &intrinsic = views[c].intrinsic_;
+        CameraProjection &camera = cameras[c];
+        camera.fx_ = static_cast<float>(intrinsic.GetFocalLength().first);
+        camera.fy_ = static_cast<float>(intrinsic.GetFocalLength().second);
+        camera.cx_ = static_cast<float>(intrinsic.GetPrincipalPoint().first);
+        camera.cy_ = static_cast<float>(intrinsic.GetPrincipalPoint().second);
+        camera.safe_width_ = intrinsic.width_ - 0.0001f;
+        camera.safe_height_ = intrinsic.height_ - 0.0001f;
+        camera.extrinsic_ = views[c].extrinsic_.cast<float>();
+        camera.z_step_ = (camera.extrinsic_ * voxel_length_f).block<3, 1>(0, 2);
+        camera.image_ = views[c].image_;
+        camera.depth_to_camera_distance_multiplier_ =
+                depth_to_camera_distance_multipliers[c];
+    }
 
-                int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
-                if (sdf > -sdf_trunc_f) {
-                    // integrate
-                    float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
+    // One task per slab of constant x. Each voxel is visited once, the
+    // observations of all cameras are summed and integrated together, and
+    // the camera coordinates are iterated incrementally along z.
+    utility::ParallelFor(0, int64_t(resolution_), [&](int64_t slab) {
+        const int x = int(slab);
+        std::vector<Eigen::Vector4f> pt_camera(cameras.size());
+        for (int y = 0; y < resolution_; y++) {
+            const Eigen::Vector4f pt_3d_homo(
+                    float(half_voxel_length_f + voxel_length_f * x +
+                          origin_(0)),
+                    float(half_voxel_length_f + voxel_length_f * y +
+                          origin_(1)),
+                    float(half_voxel_length_f + origin_(2)), 1.f);
+            for (size_t c = 0; c < cameras.size(); c++) {
+                pt_camera[c] = cameras[c].extrinsic_ * pt_3d_homo;
+            }
+            for (int z = 0; z < resolution_; z++) {
+                float tsdf_sum = 0.0f;
+                float color_sum[3] = {0.0f, 0.0f, 0.0f};
+                int num_observations = 0;
+                for (size_t c = 0; c < cameras.size(); c++) {
+                    const CameraProjection &camera = cameras[c];
+                    const Eigen::Vector4f &pt = pt_camera[c];
+                    // Skip if negative depth after projection
+                    if (pt(2) <= 0) {
+                        continue;
+                    }
+                    // Skip if x-y coordinate not in range
+                    float u_f = pt(0) * camera.fx_ / pt(2) + camera.cx_ + 0.5f;
+                    float v_f = pt(1) * camera.fy_ / pt(2) + camera.cy_ + 0.5f;
+                    if (!(u_f >= 0.0001f && u_f < camera.safe_width_ &&
+                          v_f >= 0.0001f && v_f < camera.safe_height_)) {
+                        continue;
+                    }
+                    // Skip if negative depth in depth image
+                    int u = (int)u_f;
+                    int v = (int)v_f;
+                    const geometry::RGBDImage &image = *camera.image_;
+                    float d = *image.depth_.PointerAt<float>(u, v);
+                    if (d <= 0.0f) {
+                        continue;
+                    }
+                    float sdf = (d - pt(2)) *
+                                (*camera.depth_to_camera_distance_multiplier_
+                                          ->PointerAt<float>(u, v));
+                    if (!(sdf > -sdf_trunc_f)) {
+                        continue;
+                    }
+                    tsdf_sum += std::min(1.0f, sdf * sdf_trunc_inv_f);
                     if (color_type_ == TSDFVolumeColorType::RGB8) {
                         const uint8_t *rgb =
                                 image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        color_sum[0] += rgb[0];
+                        color_sum[1] += rgb[1];
+                        color_sum[2] += rgb[2];
                     } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        color_sum[0] += *image.color_.PointerAt<float>(u, v, 0);
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
+                    num_observations++;
+                }
+                if (num_observations > 0) {
+                    voxels_.IntegrateObservations(
+                            IndexOf(x, y, z), tsdf_sum, color_sum,
+                            float(num_observations), max_weight_f);
+                }
+                for (size_t c = 0; c < cameras.size(); c++) {
+                    pt_camera[c].head<3>() += cameras[c].z_step_;
                 }
             }
         }
-    }
+    });
 }
 
-Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
+Eigen::Vector3d UniformTSDFVolume::GetNormalAt(
+        const Eigen::Vector3d &p) const {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
     for (int i = 0; i < 3; i++) {
@@ -388,7 +462,7 @@ Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     return n.normalized();
 }
 
-double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
+double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) const {
     Eigen::Vector3i idx;
     Eigen::Vector3d p_grid = p / voxel_length_ - Eigen::Vector3d(0.5, 0.5, 0.5);
     for (int i = 0; i < 3; i++) {
@@ -398,21 +472,21 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
 
     double tsdf = 0;
     tsdf += (1 - r(0)) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 0)));
     tsdf += (1 - r(0)) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 1)));
     tsdf += (1 - r(0)) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 0)));
     tsdf += (1 - r(0)) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 1)));
     tsdf += r(0) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 0)));
     tsdf += r(0) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 1)));
     tsdf += r(0) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 0)));
     tsdf += r(0) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))].tsdf_;
+            voxels_.GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 1)));
     return tsdf;
 }
 
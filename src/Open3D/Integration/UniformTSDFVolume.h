@@ -28,39 +28,27 @@
 
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/TSDFVoxelArray.h"
 
 namespace open3d {
-
-namespace geometry {
-
-class TSDFVoxel : public Voxel {
-public:
-    TSDFVoxel() : Voxel() {}
-    TSDFVoxel(const Eigen::Vector3i &grid_index) : Voxel(grid_index) {}
-    TSDFVoxel(const Eigen::Vector3i &grid_index, const Eigen::Vector3d &color)
-        : Voxel(grid_index, color) {}
-    ~TSDFVoxel() {}
-
-public:
-    float tsdf_ = 0;
-    float weight_ = 0;
-};
-
-}  // namespace geometry
-
 namespace integration {
 
 /// \class UniformTSDFVolume
 ///
 /// \brief UniformTSDFVolume implements the classic TSDF volume with uniform
 /// voxel grid (Curless and Levoy 1996).
+///
+/// The voxels are stored as separate TSDF, weight and color arrays, in 32-bit
+/// floats or, with TSDFVoxelPrecision::Compact, in 4 to 7 bytes per voxel.
 class UniformTSDFVolume : public TSDFVolume {
 public:
     UniformTSDFVolume(double length,
                       int resolution,
                       double sdf_trunc,
                       TSDFVolumeColorType color_type,
-                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero());
+                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero(),
+                      TSDFVoxelPrecision precision =
+                              TSDFVoxelPrecision::Float32);
     ~UniformTSDFVolume() override;
 
 public:
@@ -68,11 +56,25 @@ public:
     void Integrate(const geometry::RGBDImage &image,
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
+    /// One parallel pass over the voxels projects every voxel into all
+    /// views.
+    void IntegrateMultiCamera(
+            const std::vector<TSDFCameraView> &views) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
-
-    /// Debug function to extract the voxel data into a VoxelGrid
-    std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud() const;
+    /// Rays skip blocks of 8^3 voxels without observations, which are found
+    /// by one pass over the voxels.
+    TSDFRaycastResult Raycast(const camera::PinholeCameraIntrinsic &intrinsic,
+                              const Eigen::Matrix4d &extrinsic,
+                              double depth_max = 3.0) override;
+
+    /// \brief Debug function to extract the voxel data into a point cloud.
+    ///
+    /// Every voxel whose weight is above \p min_weight and whose TSDF is in
+    /// [-max_tsdf, max_tsdf) becomes a point at its center, with a gray color
+    /// of (tsdf + 1) / 2. The slabs of the volume are extracted in parallel.
+    std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud(
+            float min_weight = 0.0f, float max_tsdf = 0.98f) const;
     /// Debug function to extract the voxel data VoxelGrid
     std::shared_ptr<geometry::VoxelGrid> ExtractVoxelGrid() const;
 
@@ -82,7 +84,16 @@ public:
             const geometry::RGBDImage &image,
             const camera::PinholeCameraIntrinsic &intrinsic,
             const Eigen::Matrix4d &extrinsic,
-            const geometry::Image &depth_to_camera_distance_multiplier);
+            const geometry::Image &depth_to_camera_distance_multiplier)
+            override;
+
+    /// Faster IntegrateMultiCamera function that uses the
+    /// depth_to_camera_distance_multiplier of every view, precomputed from
+    /// its intrinsic.
+    void IntegrateMultiCameraWithDepthToCameraDistanceMultipliers(
+            const std::vector<TSDFCameraView> &views,
+            const std::vector<const geometry::Image *>
+                    &depth_to_camera_distance_multipliers);
 
     inline int IndexOf(int x, int y, int z) const {
         return x * resolution_ * resolution_ + y * resolution_ + z;
@@ -93,7 +104,7 @@ public:
     }
 
 public:
-    std::vector<geometry::TSDFVoxel> voxels_;
+    TSDFVoxelArray voxels_;
     Eigen::Vector3d origin_;
     /// Total length, where voxel_length = length / resolution.
     double length_;
@@ -102,11 +113,14 @@ public:
     int resolution_;
     /// Number of voxels present.
     int voxel_num_;
+    /// Cap of the voxel weights, at least 1, so that the voxels follow changes
+    /// of dynamic scenes. Infinite by default.
+    double max_weight_;
 
 private:
-    Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
+    Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p) const;
 
-    double GetTSDFAt(const Eigen::Vector3d &p);
+    double GetTSDFAt(const Eigen::Vector3d &p) const;
 };
 
 }  // namespace integration
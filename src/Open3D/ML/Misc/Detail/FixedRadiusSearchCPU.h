@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/ML/Misc/Detail/PointGrid.h"
+#include "tbb/parallel_for.h"
+
+namespace open3d {
+namespace ml {
+namespace detail {
+
+/// Finds all points within a fixed radius of each query point. The points
+/// are binned into a PointGrid with a cell size equal to the radius, so only
+/// the 27 cells around a query point are searched.
+///
+/// The neighbors are returned as a ragged array: the indices of the neighbors
+/// of query i are neighbors_index[row_splits[i]:row_splits[i+1]], in a
+/// deterministic order.
+///
+/// \param query_neighbors_row_splits The preallocated output array with size
+///                        \p num_queries + 1 for the start and end of the
+///                        neighbors of each query point
+/// \param num_points      The number of points
+/// \param points          The array of 3D points with shape [num_points, 3]
+/// \param num_queries     The number of query points
+/// \param queries         The array of 3D query points with shape
+///                        [num_queries, 3]
+/// \param radius          The search radius
+/// \param return_distances If true, the squared distances to the neighbors
+///                        are returned
+/// \param output_allocator An object implementing
+///                        AllocIndices(int32_t** ptr, size_t num) and
+///                        AllocDistances(T** ptr, size_t num), which
+///                        allocate the outputs once their size is known.
+///                        AllocDistances() is called with num 0 if
+///                        \p return_distances is false.
+template <class T, class OUTPUT_ALLOCATOR>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          const size_t num_points,
+                          const T* const points,
+                          const size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const bool return_distances,
+                          OUTPUT_ALLOCATOR& output_allocator) {
+    const PointGrid<T> grid(points, num_points, radius);
+    const T radius_squared = radius * radius;
+
+    // The search runs twice, the first pass counts the neighbors.
+    auto search = [&](const size_t query_idx, int32_t* indices,
+                      T* distances) {
+        const T* const query = queries + 3 * query_idx;
+        int cell[3];
+        grid.ComputeCell(query, cell);
+        int64_t count = 0;
+        grid.ForEachPointInCells(cell, 1, [&](int64_t point_idx) {
+            const T dist = SquaredDistance(query, points + 3 * point_idx);
+            if (dist <= radius_squared) {
+                if (indices) {
+                    indices[count] = int32_t(point_idx);
+                }
+                if (distances) {
+                    distances[count] = dist;
+                }
+                ++count;
+            }
+        });
+        return count;
+    };
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_queries),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              query_neighbors_row_splits[i + 1] =
+                                      search(i, nullptr, nullptr);
+                          }
+                      });
+    query_neighbors_row_splits[0] = 0;
+    for (size_t i = 0; i < num_queries; ++i) {
+        query_neighbors_row_splits[i + 1] += query_neighbors_row_splits[i];
+    }
+
+    const size_t num_neighbors = query_neighbors_row_splits[num_queries];
+    int32_t* neighbors_index = nullptr;
+    T* neighbors_distance = nullptr;
+    output_allocator.AllocIndices(&neighbors_index, num_neighbors);
+    output_allocator.AllocDistances(&neighbors_distance,
+                                    return_distances ? num_neighbors : 0);
+
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const int64_t offset = query_neighbors_row_splits[i];
+                    search(i, neighbors_index + offset,
+                           return_distances ? neighbors_distance + offset
+                                            : nullptr);
+                }
+            });
+}
+
+}  // namespace detail
+}  // namespace ml
+}  // namespace open3d
@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Open3D/ML/Misc/Detail/PointGrid.h"
+#include "tbb/parallel_for.h"
+
+namespace open3d {
+namespace ml {
+namespace detail {
+
+/// Finds the k nearest points of each query point. The points are binned into
+/// a PointGrid and the cells around a query point are visited in growing
+/// shells until the k-th nearest point found so far is closer than the
+/// searched region extends.
+///
+/// Each query point gets min(k, num_points) neighbors, sorted by distance.
+/// The indices of the neighbors of query i are
+/// neighbors_index[row_splits[i]:row_splits[i+1]].
+///
+/// \param query_neighbors_row_splits The preallocated output array with size
+///                        \p num_queries + 1 for the start and end of the
+///                        neighbors of each query point
+/// \param num_points      The number of points
+/// \param points          The array of 3D points with shape [num_points, 3]
+/// \param num_queries     The number of query points
+/// \param queries         The array of 3D query points with shape
+///                        [num_queries, 3]
+/// \param k               The number of neighbors to search
+/// \param return_distances If true, the squared distances to the neighbors
+///                        are returned
+/// \param output_allocator An object implementing
+///                        AllocIndices(int32_t** ptr, size_t num) and
+///                        AllocDistances(T** ptr, size_t num), see
+///                        FixedRadiusSearchCPU().
+template <class T, class OUTPUT_ALLOCATOR>
+void KnnSearchCPU(int64_t* query_neighbors_row_splits,
+                  const size_t num_points,
+                  const T* const points,
+                  const size_t num_queries,
+                  const T* const queries,
+                  const int k,
+                  const bool return_distances,
+                  OUTPUT_ALLOCATOR& output_allocator) {
+    const size_t num_neighbors_per_query =
+            std::min(size_t(std::max(k, 0)), num_points);
+    for (size_t i = 0; i <= num_queries; ++i) {
+        query_neighbors_row_splits[i] = i * num_neighbors_per_query;
+    }
+    const size_t num_neighbors = num_queries * num_neighbors_per_query;
+    int32_t* neighbors_index = nullptr;
+    T* neighbors_distance = nullptr;
+    output_allocator.AllocIndices(&neighbors_index, num_neighbors);
+    output_allocator.AllocDistances(&neighbors_distance,
+                                    return_distances ? num_neighbors : 0);
+    if (num_neighbors == 0) {
+        return;
+    }
+
+    // Choose cells that hold about k points if the points fill their
+    // bounding box. Cells are larger for flat point clouds.
+    T min_bound[3], max_bound[3];
+    for (int dim = 0; dim < 3; ++dim) {
+        min_bound[dim] = std::numeric_limits<T>::max();
+        max_bound[dim] = std::numeric_limits<T>::lowest();
+    }
+    for (size_t i = 0; i < num_points; ++i) {
+        for (int dim = 0; dim < 3; ++dim) {
+            min_bound[dim] = std::min(min_bound[dim], points[3 * i + dim]);
+            max_bound[dim] = std::max(max_bound[dim], points[3 * i + dim]);
+        }
+    }
+    T max_extent = 0;
+    for (int dim = 0; dim < 3; ++dim) {
+        max_extent = std::max(max_extent, max_bound[dim] - min_bound[dim]);
+    }
+    T cell_size = max_extent * std::cbrt(T(num_neighbors_per_query) /
+                                         T(num_points));
+    if (!(cell_size > 0)) {
+        cell_size = 1;
+    }
+    const PointGrid<T> grid(points, num_points, cell_size);
+    int min_cell[3], max_cell[3];
+    grid.ComputeCell(min_bound, min_cell);
+    grid.ComputeCell(max_bound, max_cell);
+
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t>& r) {
+                // Max-heap of the nearest (distance, index) pairs.
+                std::vector<std::pair<T, int32_t>> heap;
+                heap.reserve(num_neighbors_per_query + 1);
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const T* const query = queries + 3 * i;
+                    int cell[3];
+                    grid.ComputeCell(query, cell);
+                    int max_ring = 0;
+                    for (int dim = 0; dim < 3; ++dim) {
+                        max_ring = std::max(
+                                max_ring, std::max(cell[dim] - min_cell[dim],
+                                                   max_cell[dim] - cell[dim]));
+                    }
+
+                    heap.clear();
+                    for (int ring = 0; ring <= max_ring; ++ring) {
+                        grid.ForEachPointInShell(cell, ring, [&](int64_t idx) {
+                            const T dist =
+                                    SquaredDistance(query, points + 3 * idx);
+                            if (heap.size() < num_neighbors_per_query) {
+                                heap.emplace_back(dist, int32_t(idx));
+                                std::push_heap(heap.begin(), heap.end());
+                            } else if (dist < heap.front().first) {
+                                std::pop_heap(heap.begin(), heap.end());
+                                heap.back() = {dist, int32_t(idx)};
+                                std::push_heap(heap.begin(), heap.end());
+                            }
+                        });
+                        // All points within ring * cell_size of the query
+                        // have been visited.
+                        const T covered = ring * cell_size;
+                        if (heap.size() == num_neighbors_per_query &&
+                            heap.front().first <= covered * covered) {
+                            break;
+                        }
+                    }
+
+                    std::sort_heap(heap.begin(), heap.end());
+                    const size_t offset = i * num_neighbors_per_query;
+                    for (size_t j = 0; j < heap.size(); ++j) {
+                        neighbors_index[offset + j] = heap[j].second;
+                        if (return_distances) {
+                            neighbors_distance[offset + j] = heap[j].first;
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace detail
+}  // namespace ml
+}  // namespace open3d
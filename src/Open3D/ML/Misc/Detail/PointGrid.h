@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_sort.h"
+
+namespace open3d {
+namespace ml {
+namespace detail {
+
+/// Regular grid of cubic cells over a 3D point set. This is the core of the
+/// CPU neighbor search and pooling ops. The point indices are sorted by cell
+/// and only the occupied cells are stored, so the memory is linear in the
+/// number of points.
+///
+/// Cell coordinates are packed into 21 bits each, i.e. the points must lie
+/// within +-2^20 cells of the origin.
+template <class T>
+class PointGrid {
+public:
+    /// Builds the grid.
+    ///
+    /// \param points      The array of 3D points with shape [num_points, 3]
+    /// \param num_points  The number of points
+    /// \param cell_size   The edge length of the cells
+    PointGrid(const T* const points, const size_t num_points, const T cell_size)
+        : inv_cell_size_(T(1) / cell_size) {
+        // Sorting (key, index) pairs keeps the points of a cell in index
+        // order.
+        std::vector<std::pair<uint64_t, int64_t>> entries(num_points);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                          [&](const tbb::blocked_range<size_t>& r) {
+                              for (size_t i = r.begin(); i != r.end(); ++i) {
+                                  int cell[3];
+                                  ComputeCell(points + 3 * i, cell);
+                                  entries[i] = {ComputeKey(cell), i};
+                              }
+                          });
+        tbb::parallel_sort(entries.begin(), entries.end());
+
+        sorted_indices_.resize(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            sorted_indices_[i] = entries[i].second;
+            if (cell_keys_.empty() || cell_keys_.back() != entries[i].first) {
+                cell_keys_.push_back(entries[i].first);
+                cell_splits_.push_back(i);
+            }
+        }
+        cell_splits_.push_back(num_points);
+    }
+
+    /// Computes the cell coordinates of \p point.
+    void ComputeCell(const T* const point, int* cell) const {
+        for (int dim = 0; dim < 3; ++dim) {
+            cell[dim] = int(std::floor(point[dim] * inv_cell_size_));
+        }
+    }
+
+    /// Returns the index of the cell with coordinates \p cell, or -1 if the
+    /// cell contains no points.
+    int64_t FindCell(const int* const cell) const {
+        const uint64_t key = ComputeKey(cell);
+        auto it = std::lower_bound(cell_keys_.begin(), cell_keys_.end(), key);
+        if (it == cell_keys_.end() || *it != key) {
+            return -1;
+        }
+        return it - cell_keys_.begin();
+    }
+
+    /// Calls func(point_idx) for every point in the cells within
+    /// \p ring cells of \p center in each dimension.
+    template <class Func>
+    void ForEachPointInCells(const int* const center,
+                             const int ring,
+                             const Func& func) const {
+        int cell[3];
+        for (cell[0] = center[0] - ring; cell[0] <= center[0] + ring;
+             ++cell[0]) {
+            for (cell[1] = center[1] - ring; cell[1] <= center[1] + ring;
+                 ++cell[1]) {
+                for (cell[2] = center[2] - ring; cell[2] <= center[2] + ring;
+                     ++cell[2]) {
+                    ForEachPointInCell(cell, func);
+                }
+            }
+        }
+    }
+
+    /// Calls func(point_idx) for every point in the cells at a distance of
+    /// exactly \p ring cells from \p center, i.e. on the surface of the cube
+    /// visited by ForEachPointInCells().
+    template <class Func>
+    void ForEachPointInShell(const int* const center,
+                             const int ring,
+                             const Func& func) const {
+        int cell[3];
+        for (cell[0] = center[0] - ring; cell[0] <= center[0] + ring;
+             ++cell[0]) {
+            const bool x_inside = std::abs(cell[0] - center[0]) < ring;
+            for (cell[1] = center[1] - ring; cell[1] <= center[1] + ring;
+                 ++cell[1]) {
+                const bool y_inside = std::abs(cell[1] - center[1]) < ring;
+                // Inside the cube only the top and bottom cells are on the
+                // surface.
+                const int z_step = x_inside && y_inside ? std::max(2 * ring, 1)
+                                                        : 1;
+                for (cell[2] = center[2] - ring; cell[2] <= center[2] + ring;
+                     cell[2] += z_step) {
+                    ForEachPointInCell(cell, func);
+                }
+            }
+        }
+    }
+
+    /// Calls func(point_idx) for every point in the cell \p cell.
+    template <class Func>
+    void ForEachPointInCell(const int* const cell, const Func& func) const {
+        const int64_t cell_idx = FindCell(cell);
+        if (cell_idx < 0) {
+            return;
+        }
+        for (int64_t i = cell_splits_[cell_idx]; i < cell_splits_[cell_idx + 1];
+             ++i) {
+            func(sorted_indices_[i]);
+        }
+    }
+
+    size_t NumCells() const { return cell_keys_.size(); }
+
+    /// The point indices sorted by cell.
+    const std::vector<int64_t>& SortedIndices() const {
+        return sorted_indices_;
+    }
+
+    /// The exclusive prefix sum of the number of points per cell with an
+    /// additional last element, the number of points. The points of cell i
+    /// are SortedIndices()[CellSplits()[i]:CellSplits()[i+1]].
+    const std::vector<int64_t>& CellSplits() const { return cell_splits_; }
+
+private:
+    static constexpr int kOffset = 1 << 20;
+    static constexpr uint64_t kCoordMask = (uint64_t(1) << 21) - 1;
+
+    static uint64_t ComputeKey(const int* const cell) {
+        return ((uint64_t(cell[0] + kOffset) & kCoordMask) << 42) |
+               ((uint64_t(cell[1] + kOffset) & kCoordMask) << 21) |
+               (uint64_t(cell[2] + kOffset) & kCoordMask);
+    }
+
+    T inv_cell_size_;
+    std::vector<int64_t> sorted_indices_;
+    std::vector<uint64_t> cell_keys_;
+    std::vector<int64_t> cell_splits_;
+};
+
+/// Returns the squared Euclidean distance of two 3D points.
+template <class T>
+inline T SquaredDistance(const T* const a, const T* const b) {
+    const T dx = a[0] - b[0];
+    const T dy = a[1] - b[1];
+    const T dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+}  // namespace detail
+}  // namespace ml
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cub/cub.cuh>
+
+namespace open3d {
+namespace ml {
+namespace detail {
+
+/// Returns the end index of subarray i, which is the start of the next
+/// subarray or values_size for the last subarray.
+struct SubarrayEndOp {
+    const int64_t* prefix_sum;
+    int64_t prefix_sum_size;
+    int64_t values_size;
+
+    __host__ __device__ int64_t operator()(const int64_t& i) const {
+        return i + 1 < prefix_sum_size ? prefix_sum[i + 1] : values_size;
+    }
+};
+
+/// CUDA version of ReduceSubarraysSumCPU(), implemented as a segmented
+/// reduction. All arrays are in device memory.
+///
+/// This function must be called twice. The first call with \p temp set to
+/// nullptr returns the required size of the temporary memory in
+/// \p temp_size. The second call with a temporary buffer of that size
+/// computes the sums.
+///
+/// \param stream          The CUDA stream to run on
+/// \param temp            Temporary memory, or nullptr to query temp_size
+/// \param temp_size       The size of \p temp in bytes
+/// \param values          The linear array with all values
+/// \param values_size     Number of elements of \p values
+/// \param prefix_sum      The exclusive prefix sum of the number of elements
+///                        for each array
+/// \param prefix_sum_size The number of subarrays
+/// \param out_sums        The preallocated output array with size
+///                        \p prefix_sum_size
+template <class T>
+void ReduceSubarraysSumCUDA(const cudaStream_t& stream,
+                            void* temp,
+                            size_t& temp_size,
+                            const T* const values,
+                            const size_t values_size,
+                            const int64_t* const prefix_sum,
+                            const size_t prefix_sum_size,
+                            T* out_sums) {
+    // The end offsets are computed on the fly from the prefix sum.
+    cub::CountingInputIterator<int64_t> subarray_ids(0);
+    cub::TransformInputIterator<int64_t, SubarrayEndOp,
+                                cub::CountingInputIterator<int64_t>>
+            end_offsets(subarray_ids,
+                        SubarrayEndOp{prefix_sum, int64_t(prefix_sum_size),
+                                      int64_t(values_size)});
+    cub::DeviceSegmentedReduce::Sum(temp, temp_size, values, out_sums,
+                                    int(prefix_sum_size), prefix_sum,
+                                    end_offsets, stream);
+}
+
+}  // namespace detail
+}  // namespace ml
+}  // namespace open3d
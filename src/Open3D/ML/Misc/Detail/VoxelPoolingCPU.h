@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "Open3D/ML/Misc/Detail/PointGrid.h"
+#include "tbb/parallel_for.h"
+
+namespace open3d {
+namespace ml {
+namespace detail {
+
+/// Functions for combining the positions or features of the points in a
+/// voxel.
+enum class AccumulationFn {
+    /// The mean of the points.
+    AVERAGE = 0,
+    /// The point closest to the voxel center.
+    NEAREST_NEIGHBOR,
+    /// The per channel maximum, only for features.
+    MAX,
+    /// The voxel center, only for positions.
+    CENTER
+};
+
+/// Pools the points with the given indices, which lie in the voxel with
+/// center \p center. See VoxelPoolingCPU().
+template <class TReal, class TFeat>
+void PoolVoxel(const int64_t* const indices,
+               const int64_t num_indices,
+               const TReal* const inp_positions,
+               const int in_channels,
+               const TFeat* const inp_features,
+               const TReal* const center,
+               const AccumulationFn position_fn,
+               const AccumulationFn feature_fn,
+               TReal* out_position,
+               TFeat* out_feature) {
+    int64_t nearest_idx = indices[0];
+    TReal nearest_dist = std::numeric_limits<TReal>::max();
+    for (int64_t i = 0; i < num_indices; ++i) {
+        const TReal dist =
+                SquaredDistance(center, inp_positions + 3 * indices[i]);
+        if (dist < nearest_dist) {
+            nearest_dist = dist;
+            nearest_idx = indices[i];
+        }
+    }
+
+    if (position_fn == AccumulationFn::AVERAGE) {
+        std::fill(out_position, out_position + 3, TReal(0));
+        for (int64_t i = 0; i < num_indices; ++i) {
+            for (int dim = 0; dim < 3; ++dim) {
+                out_position[dim] += inp_positions[3 * indices[i] + dim];
+            }
+        }
+        for (int dim = 0; dim < 3; ++dim) {
+            out_position[dim] /= TReal(num_indices);
+        }
+    } else if (position_fn == AccumulationFn::NEAREST_NEIGHBOR) {
+        std::copy(inp_positions + 3 * nearest_idx,
+                  inp_positions + 3 * (nearest_idx + 1), out_position);
+    } else {
+        std::copy(center, center + 3, out_position);
+    }
+
+    if (feature_fn == AccumulationFn::AVERAGE) {
+        for (int c = 0; c < in_channels; ++c) {
+            TReal sum = 0;
+            for (int64_t i = 0; i < num_indices; ++i) {
+                sum += TReal(inp_features[in_channels * indices[i] + c]);
+            }
+            out_feature[c] = TFeat(sum / TReal(num_indices));
+        }
+    } else if (feature_fn == AccumulationFn::NEAREST_NEIGHBOR) {
+        std::copy(inp_features + in_channels * nearest_idx,
+                  inp_features + in_channels * (nearest_idx + 1), out_feature);
+    } else {
+        std::copy(inp_features + in_channels * indices[0],
+                  inp_features + in_channels * (indices[0] + 1), out_feature);
+        for (int64_t i = 1; i < num_indices; ++i) {
+            const TFeat* const feature =
+                    inp_features + in_channels * indices[i];
+            for (int c = 0; c < in_channels; ++c) {
+                out_feature[c] = std::max(out_feature[c], feature[c]);
+            }
+        }
+    }
+}
+
+/// Pools the points and their features into voxels. There is one output
+/// point per occupied voxel. The voxels are ordered by their grid
+/// coordinates.
+///
+/// \param num_inp         The number of input points
+/// \param inp_positions   The array of 3D positions with shape [num_inp, 3]
+/// \param in_channels     The number of feature channels
+/// \param inp_features    The array of features with shape
+///                        [num_inp, in_channels]
+/// \param voxel_size      The edge length of the voxels
+/// \param output_allocator An object implementing
+///                        AllocPooledPositions(TReal** ptr, size_t num) and
+///                        AllocPooledFeatures(TFeat** ptr, size_t num,
+///                        int channels), which allocate the outputs for num
+///                        voxels.
+/// \param position_fn     AVERAGE, NEAREST_NEIGHBOR or CENTER
+/// \param feature_fn      AVERAGE, NEAREST_NEIGHBOR or MAX
+template <class TReal, class TFeat, class OUTPUT_ALLOCATOR>
+void VoxelPoolingCPU(const size_t num_inp,
+                     const TReal* const inp_positions,
+                     const int in_channels,
+                     const TFeat* const inp_features,
+                     const TReal voxel_size,
+                     OUTPUT_ALLOCATOR& output_allocator,
+                     const AccumulationFn position_fn,
+                     const AccumulationFn feature_fn) {
+    const PointGrid<TReal> grid(inp_positions, num_inp, voxel_size);
+    const size_t num_voxels = grid.NumCells();
+    TReal* out_positions = nullptr;
+    TFeat* out_features = nullptr;
+    output_allocator.AllocPooledPositions(&out_positions, num_voxels);
+    output_allocator.AllocPooledFeatures(&out_features, num_voxels,
+                                         in_channels);
+
+    const std::vector<int64_t>& sorted_indices = grid.SortedIndices();
+    const std::vector<int64_t>& cell_splits = grid.CellSplits();
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_voxels),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t v = r.begin(); v != r.end(); ++v) {
+                    const int64_t* const indices =
+                            sorted_indices.data() + cell_splits[v];
+                    int cell[3];
+                    grid.ComputeCell(inp_positions + 3 * indices[0], cell);
+                    TReal center[3];
+                    for (int dim = 0; dim < 3; ++dim) {
+                        center[dim] = (cell[dim] + TReal(0.5)) * voxel_size;
+                    }
+                    PoolVoxel(indices, cell_splits[v + 1] - cell_splits[v],
+                              inp_positions, in_channels, inp_features,
+                              center, position_fn, feature_fn,
+                              out_positions + 3 * v,
+                              out_features + in_channels * v);
+                }
+            });
+}
+
+}  // namespace detail
+}  // namespace ml
+}  // namespace open3d
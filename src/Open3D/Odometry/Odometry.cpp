@@ -27,12 +27,14 @@
 #include "Open3D/Odometry/Odometry.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <memory>
 
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Profiler.h"
 #include "Open3D/Utility/Timer.h"
 
 namespace open3d {
@@ -247,14 +249,12 @@ Eigen::Matrix6d CreateInformationMatrix(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
                                   extrinsic, depth_s, depth_t, option);
 
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
-
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
@@ -271,9 +271,9 @@ Eigen::Matrix6d CreateInformationMatrix(
         for (int row = 0; row < int(correspondence->size()); row++) {
             int u_t = (*correspondence)[row](2);
             int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -300,9 +300,24 @@ Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-void NormalizeIntensity(geometry::Image &image_s,
-                        geometry::Image &image_t,
-                        CorrespondenceSetPixelWise &correspondence) {
+Eigen::Matrix6d CreateInformationMatrix(
+        const Eigen::Matrix4d &extrinsic,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const geometry::Image &depth_s,
+        const geometry::Image &depth_t,
+        const OdometryOption &option) {
+    auto xyz_t = ConvertDepthImageToXYZImage(
+            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    return CreateInformationMatrix(extrinsic, pinhole_camera_intrinsic,
+                                   depth_s, depth_t, *xyz_t, option);
+}
+
+/// Returns the scales of the intensities of both images that bring their
+/// means over the correspondences to 0.5.
+std::tuple<double, double> ComputeIntensityNormalization(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
@@ -320,8 +335,120 @@ void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
+}
+
+void NormalizeIntensity(geometry::Image &image_s,
+                        geometry::Image &image_t,
+                        CorrespondenceSetPixelWise &correspondence) {
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) =
+            ComputeIntensityNormalization(image_s, image_t, correspondence);
+    image_s.LinearTransform(scale_s, 0.0);
+    image_t.LinearTransform(scale_t, 0.0);
+}
+
+/// Copies a pyramid with the intensities scaled, see NormalizeIntensity().
+/// The pyramids and gradients are linear in the intensities.
+geometry::RGBDImagePyramid ScalePyramidIntensity(
+        const geometry::RGBDImagePyramid &pyramid, double scale) {
+    geometry::RGBDImagePyramid scaled_pyramid;
+    scaled_pyramid.reserve(pyramid.size());
+    for (const auto &level : pyramid) {
+        auto scaled_level = std::make_shared<geometry::RGBDImage>(*level);
+        scaled_level->color_.LinearTransform(scale, 0.0);
+        scaled_pyramid.push_back(scaled_level);
+    }
+    return scaled_pyramid;
+}
+
+/// Returns the source level with the depth of the pixels that are not
+/// selected set to NaN, so that the correspondence and Jacobian passes skip
+/// them. Returns \p source itself if it has at most
+/// option.max_pixels_per_level_ pixels with a depth.
+std::shared_ptr<geometry::RGBDImage> SelectSourcePixels(
+        const std::shared_ptr<geometry::RGBDImage> &source,
+        const OdometryOption &option) {
+    const int max_pixels = option.max_pixels_per_level_;
+    const geometry::Image &depth = source->depth_;
+    const int width = depth.width_;
+    const int height = depth.height_;
+    if (max_pixels <= 0) {
+        return source;
+    }
+    int num_valid = 0;
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            if (!std::isnan(*depth.PointerAt<float>(u, v))) {
+                num_valid++;
+            }
+        }
+    }
+    if (num_valid <= max_pixels) {
+        return source;
+    }
+
+    auto selected = std::make_shared<geometry::RGBDImage>(*source);
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    if (option.pixel_selection_ == OdometryOption::PixelSelection::Uniform) {
+        const int stride = std::max(
+                1, (int)std::sqrt(double(num_valid) / double(max_pixels)));
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                if (u % stride != 0 || v % stride != 0) {
+                    *selected->depth_.PointerAt<float>(u, v) = nan;
+                }
+            }
+        }
+        return selected;
+    }
+
+    // Squared intensity gradients by central differences, -1 for the pixels
+    // without a depth.
+    const geometry::Image &intensity = source->color_;
+    std::vector<float> scores((size_t)width * height, -1.0f);
+    std::vector<float> valid_scores;
+    valid_scores.reserve(num_valid);
+    for (int v = 0; v < height; v++) {
+        const int v0 = std::max(v - 1, 0);
+        const int v1 = std::min(v + 1, height - 1);
+        for (int u = 0; u < width; u++) {
+            if (std::isnan(*depth.PointerAt<float>(u, v))) {
+                continue;
+            }
+            const int u0 = std::max(u - 1, 0);
+            const int u1 = std::min(u + 1, width - 1);
+            float dx = *intensity.PointerAt<float>(u1, v) -
+                       *intensity.PointerAt<float>(u0, v);
+            float dy = *intensity.PointerAt<float>(u, v1) -
+                       *intensity.PointerAt<float>(u, v0);
+            float score = dx * dx + dy * dy;
+            scores[(size_t)v * width + u] = score;
+            valid_scores.push_back(score);
+        }
+    }
+    // Keeps the pixels above the max_pixels-th largest score, and as many of
+    // the pixels at that score as fit, in scan order.
+    auto nth = valid_scores.begin() + (num_valid - max_pixels);
+    std::nth_element(valid_scores.begin(), nth, valid_scores.end());
+    const float threshold = *nth;
+    int num_at_threshold = max_pixels - (int)std::count_if(
+            nth, valid_scores.end(),
+            [threshold](float score) { return score > threshold; });
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            float score = scores[(size_t)v * width + u];
+            if (score > threshold) {
+                continue;
+            }
+            if (score == threshold && num_at_threshold > 0) {
+                num_at_threshold--;
+                continue;
+            }
+            *selected->depth_.PointerAt<float>(u, v) = nan;
+        }
+    }
+    return selected;
 }
 
 inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
@@ -439,32 +566,36 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix3d intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    auto correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
-    int corresps_count = (int)correspondence->size();
-
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        *correspondence);
-            };
+        const OdometryOption &option,
+        OdometryStatistics &statistics) {
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
+    utility::Timer timer;
+    timer.Start();
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    if (option.direct_projection_) {
+        std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTrDirect(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic_initial, option.max_depth_diff_);
+    } else {
+        auto correspondence =
+                ComputeCorrespondence(intrinsic, extrinsic_initial,
+                                      source.depth_, target.depth_, option);
+        std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic_initial, *correspondence);
+    }
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
 
+    timer.Start();
     bool is_success;
     Eigen::Matrix4d extrinsic;
     std::tie(is_success, extrinsic) =
             utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    timer.Stop();
+    statistics.solve_time_ += timer.GetDuration();
     if (!is_success) {
         utility::LogWarning("[ComputeOdometry] no solution!");
         return std::make_tuple(false, Eigen::Matrix4d::Identity());
@@ -474,53 +605,46 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const geometry::RGBDImagePyramid &source_pyramid,
+        const geometry::ImagePyramid &source_pyramid_xyz,
+        const geometry::RGBDImagePyramid &target_pyramid,
+        const geometry::RGBDImagePyramid &target_pyramid_dx,
+        const geometry::RGBDImagePyramid &target_pyramid_dy,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        OdometryStatistics &statistics) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
-
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
+    statistics.num_iterations_per_level_.assign(num_levels, 0);
 
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
+        OPEN3D_PROFILE_SCOPE("OdometryPyramidLevel");
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
-
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
+        utility::Timer timer;
+        timer.Start();
+        const auto source_level =
+                SelectSourcePixels(source_pyramid[level], option);
+        timer.Stop();
+        statistics.preprocessing_time_ += timer.GetDuration();
 
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *source_level, *target_pyramid[level],
+                    *source_pyramid_xyz[level], *target_pyramid_dx[level],
+                    *target_pyramid_dy[level], level_camera_matrix, result_odo,
+                    jacobian_method, option, statistics);
             result_odo = curr_odo * result_odo;
+            statistics.num_iterations_++;
+            statistics.num_iterations_per_level_[num_levels - level - 1]++;
 
             if (!is_success) {
                 utility::LogWarning("[ComputeOdometry] no solution!");
@@ -531,6 +655,42 @@ std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
+std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix4d &extrinsic_initial,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option,
+        OdometryStatistics &statistics) {
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+
+    utility::Timer timer;
+    timer.Start();
+    auto source_pyramid = source.CreatePyramid(num_levels);
+    auto target_pyramid = target.CreatePyramid(num_levels);
+    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
+            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
+    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
+            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
+
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+    geometry::ImagePyramid source_pyramid_xyz;
+    for (int level = 0; level < num_levels; level++) {
+        source_pyramid_xyz.push_back(ConvertDepthImageToXYZImage(
+                source_pyramid[level]->depth_, pyramid_camera_matrix[level]));
+    }
+    timer.Stop();
+    statistics.preprocessing_time_ += timer.GetDuration();
+
+    return ComputeMultiscale(source_pyramid, source_pyramid_xyz,
+                             target_pyramid, target_pyramid_dx,
+                             target_pyramid_dy, pyramid_camera_matrix,
+                             extrinsic_initial, jacobian_method, option,
+                             statistics);
+}
+
 }  // unnamed namespace
 
 namespace odometry {
@@ -544,33 +704,185 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
         const OdometryOption &option /*= OdometryOption()*/) {
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    Eigen::Matrix6d information;
+    OdometryStatistics statistics;
+    std::tie(is_success, extrinsic, information, statistics) =
+            ComputeRGBDOdometryWithStatistics(
+                    source, target, pinhole_camera_intrinsic, odo_init,
+                    jacobian_method, option);
+    return std::make_tuple(is_success, extrinsic, information);
+}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d, OdometryStatistics>
+ComputeRGBDOdometryWithStatistics(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    OdometryStatistics statistics;
     if (!CheckRGBDImagePair(source, target)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
-                               Eigen::Matrix6d::Zero());
+                               Eigen::Matrix6d::Zero(), statistics);
     }
+    utility::Timer total_timer, timer;
+    total_timer.Start();
 
+    timer.Start();
     std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
     std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
             source, target, pinhole_camera_intrinsic, odo_init, option);
+    timer.Stop();
+    statistics.preprocessing_time_ += timer.GetDuration();
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
     std::tie(is_success, extrinsic) = ComputeMultiscale(
             *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+            odo_init, jacobian_method, option, statistics);
 
+    Eigen::Matrix6d info_output = Eigen::Matrix6d::Identity();
     if (is_success) {
-        Eigen::Matrix4d trans_output = extrinsic;
-        Eigen::MatrixXd info_output = CreateInformationMatrix(
+        timer.Start();
+        info_output = CreateInformationMatrix(
                 extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
                 target_processed->depth_, option);
-        return std::make_tuple(true, trans_output, info_output);
+        timer.Stop();
+        statistics.information_time_ = timer.GetDuration();
     } else {
+        extrinsic = Eigen::Matrix4d::Identity();
+    }
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    return std::make_tuple(is_success, extrinsic, info_output, statistics);
+}
+
+RGBDOdometryTracker::RGBDOdometryTracker(
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const OdometryOption &option /*= OdometryOption()*/)
+    : pinhole_camera_intrinsic_(pinhole_camera_intrinsic),
+      option_(option),
+      pyramid_camera_matrix_(CreateCameraMatrixPyramid(
+              pinhole_camera_intrinsic,
+              (int)option.iteration_number_per_pyramid_level_.size())) {}
+
+RGBDOdometryTracker::~RGBDOdometryTracker() {}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &frame,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    statistics_ = OdometryStatistics();
+    if (!CheckRGBDImagePair(frame, frame)) {
+        utility::LogWarning("[RGBDOdometryTracker] Unsupported image format.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    if (previous_frame_ &&
+        (previous_frame_->pyramid_[0]->depth_.width_ != frame.depth_.width_ ||
+         previous_frame_->pyramid_[0]->depth_.height_ !=
+                 frame.depth_.height_ ||
+         previous_frame_->is_rgb_ != IsColorImageRGB(frame.color_))) {
+        utility::LogWarning(
+                "[RGBDOdometryTracker] Frames should be same in size and "
+                "format.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    utility::Timer total_timer, timer;
+    total_timer.Start();
+    timer.Start();
+    std::shared_ptr<Frame> source = previous_frame_;
+    std::shared_ptr<Frame> target = CreateFrame(frame);
+    previous_frame_ = target;
+    if (!source) {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
-                               Eigen::Matrix6d::Identity());
+                               Eigen::Matrix6d::Zero());
+    }
+
+    const geometry::RGBDImage &source_full = *source->pyramid_[0];
+    const geometry::RGBDImage &target_full = *target->pyramid_[0];
+    auto correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic_.intrinsic_matrix_, odo_init,
+            source_full.depth_, target_full.depth_, option_);
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) = ComputeIntensityNormalization(
+            source_full.color_, target_full.color_, *correspondence);
+    const auto source_pyramid =
+            ScalePyramidIntensity(source->pyramid_, scale_s);
+    const auto target_pyramid =
+            ScalePyramidIntensity(target->pyramid_, scale_t);
+    const auto target_pyramid_dx =
+            ScalePyramidIntensity(target->pyramid_dx_, scale_t);
+    const auto target_pyramid_dy =
+            ScalePyramidIntensity(target->pyramid_dy_, scale_t);
+    timer.Stop();
+    statistics_.preprocessing_time_ = timer.GetDuration();
+
+    Eigen::Matrix4d extrinsic;
+    bool is_success;
+    std::tie(is_success, extrinsic) = ComputeMultiscale(
+            source_pyramid, source->pyramid_xyz_, target_pyramid,
+            target_pyramid_dx, target_pyramid_dy, pyramid_camera_matrix_,
+            odo_init, jacobian_method, option_, statistics_);
+
+    Eigen::Matrix6d info_output = Eigen::Matrix6d::Identity();
+    if (is_success) {
+        timer.Start();
+        info_output = CreateInformationMatrix(
+                extrinsic, pinhole_camera_intrinsic_, source_full.depth_,
+                target_full.depth_, *target->pyramid_xyz_[0], option_);
+        timer.Stop();
+        statistics_.information_time_ = timer.GetDuration();
+    } else {
+        extrinsic = Eigen::Matrix4d::Identity();
+    }
+    total_timer.Stop();
+    statistics_.total_time_ = total_timer.GetDuration();
+    return std::make_tuple(is_success, extrinsic, info_output);
+}
+
+void RGBDOdometryTracker::Reset() { previous_frame_.reset(); }
+
+std::shared_ptr<RGBDOdometryTracker::Frame> RGBDOdometryTracker::CreateFrame(
+        const geometry::RGBDImage &frame) const {
+    // The preprocessing of InitializeRGBDOdometry(), but for the intensity
+    // normalization, which depends on both frames.
+    std::shared_ptr<geometry::Image> color;
+    auto output = std::make_shared<Frame>();
+    output->is_rgb_ = IsColorImageRGB(frame.color_);
+    if (output->is_rgb_) {
+        color = frame.color_.CreateFloatImage();
+    } else {
+        color = std::make_shared<geometry::Image>(frame.color_);
+    }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth = PreprocessDepth(frame.depth_, option_)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+
+    const int num_levels = (int)pyramid_camera_matrix_.size();
+    output->pyramid_ =
+            geometry::RGBDImage(*gray, *depth).CreatePyramid(num_levels);
+    output->pyramid_dx_ = geometry::RGBDImage::FilterPyramid(
+            output->pyramid_, geometry::Image::FilterType::Sobel3Dx);
+    output->pyramid_dy_ = geometry::RGBDImage::FilterPyramid(
+            output->pyramid_, geometry::Image::FilterType::Sobel3Dy);
+    for (int level = 0; level < num_levels; level++) {
+        output->pyramid_xyz_.push_back(ConvertDepthImageToXYZImage(
+                output->pyramid_[level]->depth_,
+                pyramid_camera_matrix_[level]));
     }
+    return output;
 }
 
 }  // namespace odometry
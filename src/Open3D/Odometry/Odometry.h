@@ -28,10 +28,12 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/OdometryOption.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Console.h"
@@ -39,12 +41,37 @@
 
 namespace open3d {
 
-namespace geometry {
-class RGBDImage;
-}
-
 namespace odometry {
 
+/// \class OdometryStatistics
+///
+/// \brief Counters and timing of an odometry estimation. Times are in
+/// milliseconds.
+class OdometryStatistics {
+public:
+    OdometryStatistics() {}
+    ~OdometryStatistics() {}
+
+public:
+    /// Number of Gauss-Newton iterations run over all pyramid levels.
+    int num_iterations_ = 0;
+    /// Iterations run per pyramid level, in the order of
+    /// OdometryOption::iteration_number_per_pyramid_level_. Fewer than the
+    /// option if an iteration found no solution.
+    std::vector<int> num_iterations_per_level_;
+    /// Preprocessing of the depth images, building the pyramids and
+    /// normalizing the intensities.
+    double preprocessing_time_ = 0;
+    /// Correspondence search and accumulation of the normal equations.
+    double correspondence_time_ = 0;
+    /// Solving the normal equations.
+    double solve_time_ = 0;
+    /// Computing the information matrix.
+    double information_time_ = 0;
+    /// Duration of the whole call.
+    double total_time_ = 0;
+};
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -64,5 +91,89 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Function to estimate 6D rigid motion from two RGBD image pairs, as
+/// ComputeRGBDOdometry(), that also reports how the estimation went.
+///
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix and the
+/// iterations and timing of the estimation.
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d, OdometryStatistics>
+ComputeRGBDOdometryWithStatistics(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic =
+                camera::PinholeCameraIntrinsic(),
+        const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
+/// \class RGBDOdometryTracker
+///
+/// \brief Estimates the motion between consecutive frames of an RGBD
+/// sequence.
+///
+/// ComputeRGBDOdometry preprocesses both images and builds their pyramids on
+/// every call, so a sequential tracker processes every frame twice. The
+/// tracker processes every frame once and keeps the pyramids, gradients and
+/// points of the previous frame. The intensities of both frames are still
+/// normalized over their correspondences, by scaling the kept pyramids, so
+/// the results are those of ComputeRGBDOdometry up to float rounding.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(const camera::PinholeCameraIntrinsic
+                                &pinhole_camera_intrinsic =
+                                        camera::PinholeCameraIntrinsic(),
+                        const OdometryOption &option = OdometryOption());
+    ~RGBDOdometryTracker();
+
+public:
+    /// \brief Estimates the motion from the previous frame to \p frame, as
+    /// ComputeRGBDOdometry(previous, frame), and makes \p frame the previous
+    /// frame.
+    ///
+    /// The first frame only initializes the tracker and returns false. Frames
+    /// of another size or format than the previous frame are rejected.
+    ///
+    /// \param frame New RGBD image.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &frame,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+    /// Forgets the previous frame.
+    void Reset();
+    /// Returns the statistics of the last call of Track().
+    const OdometryStatistics &GetStatistics() const { return statistics_; }
+    /// Returns true if a frame has been tracked since the last Reset().
+    bool HasPreviousFrame() const { return bool(previous_frame_); }
+
+private:
+    /// Preprocessed frame with intensities not normalized yet.
+    struct Frame {
+        geometry::RGBDImagePyramid pyramid_;
+        geometry::RGBDImagePyramid pyramid_dx_;
+        geometry::RGBDImagePyramid pyramid_dy_;
+        /// Points of the depth pyramid in camera coordinates.
+        geometry::ImagePyramid pyramid_xyz_;
+        bool is_rgb_;
+    };
+
+    std::shared_ptr<Frame> CreateFrame(const geometry::RGBDImage &frame) const;
+
+private:
+    camera::PinholeCameraIntrinsic pinhole_camera_intrinsic_;
+    OdometryOption option_;
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix_;
+    std::shared_ptr<Frame> previous_frame_;
+    OdometryStatistics statistics_;
+};
+
 }  // namespace odometry
 }  // namespace open3d
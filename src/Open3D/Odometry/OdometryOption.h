@@ -36,6 +36,18 @@ namespace odometry {
 /// Class that defines Odometry options.
 class OdometryOption {
 public:
+    /// \enum PixelSelection
+    ///
+    /// \brief How the source pixels are chosen when a pyramid level has more
+    /// than max_pixels_per_level_ pixels with a depth.
+    enum class PixelSelection {
+        /// Pixels on a regular grid with the same stride in both directions.
+        Uniform,
+        /// The pixels with the largest intensity gradients, as in semi-dense
+        /// direct odometry. Flat regions contribute little to the color term.
+        Gradient,
+    };
+
     /// \brief Parameterized Constructor.
     ///
     /// \param iteration_number_per_pyramid_level Number of iterations per level
@@ -46,18 +58,29 @@ public:
     /// are ignored.
     /// \param max_depth Maximum depth above which pixel values are
     /// ignored.
+    /// \param direct_projection Evaluate the residuals of the projected
+    /// pixels in one pass, without a correspondence set.
+    /// \param max_pixels_per_level Maximum number of source pixels used per
+    /// pyramid level, 0 for all.
+    /// \param pixel_selection How the source pixels are chosen.
     OdometryOption(
             const std::vector<int> &iteration_number_per_pyramid_level =
                     {20, 10,
                      5} /* {smaller image size to original image size} */,
             double max_depth_diff = 0.03,
             double min_depth = 0.0,
-            double max_depth = 4.0)
+            double max_depth = 4.0,
+            bool direct_projection = false,
+            int max_pixels_per_level = 0,
+            PixelSelection pixel_selection = PixelSelection::Gradient)
         : iteration_number_per_pyramid_level_(
                   iteration_number_per_pyramid_level),
           max_depth_diff_(max_depth_diff),
           min_depth_(min_depth),
-          max_depth_(max_depth) {}
+          max_depth_(max_depth),
+          direct_projection_(direct_projection),
+          max_pixels_per_level_(max_pixels_per_level),
+          pixel_selection_(pixel_selection) {}
     ~OdometryOption() {}
 
 public:
@@ -73,6 +96,20 @@ public:
     double min_depth_;
     /// Pixels that has larger than specified depth values are ignored.
     double max_depth_;
+    /// If true, every iteration projects the source pixels into the target
+    /// and accumulates the residuals of the pixels within max_depth_diff_ in
+    /// the same pass, see RGBDOdometryJacobian::ComputeJTJandJTrDirect. The
+    /// correspondences are the same as with a correspondence set.
+    bool direct_projection_;
+    /// Maximum number of source pixels with a depth that are used at each
+    /// pyramid level. Levels with more pixels are subsampled with
+    /// pixel_selection_ before the correspondences are computed, which
+    /// reduces the cost of every iteration on the finer levels. 0 or less
+    /// uses all pixels. The information matrix always uses all pixels.
+    int max_pixels_per_level_;
+    /// How the source pixels are chosen on levels with more than
+    /// max_pixels_per_level_ pixels.
+    PixelSelection pixel_selection_;
 };
 
 }  // namespace odometry
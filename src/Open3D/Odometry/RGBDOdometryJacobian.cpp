@@ -26,9 +26,14 @@
 
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 
+#include <Eigen/Dense>
+#include <array>
+#include <cmath>
+
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/Odometry.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
@@ -37,9 +42,429 @@ namespace {
 const double SOBEL_SCALE = 0.125;
 const double LAMBDA_HYBRID_DEPTH = 0.968;
 
+/// Correspondences per task of the fused accumulation.
+const int64_t CORRESPONDENCE_GRAIN_SIZE = 1024;
+
+/// Source image rows per task of the direct accumulation.
+const int64_t ROW_GRAIN_SIZE = 4;
+
+/// Upper triangle of JTJ in row-major order, then JTr, the sum of the
+/// squared residuals and the number of correspondences.
+typedef std::array<double, 29> NormalEquationSums;
+
+inline void AddRow(const double *J, double r, NormalEquationSums &sums) {
+    int k = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = i; j < 6; j++) {
+            sums[k++] += J[i] * J[j];
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        sums[21 + i] += J[i] * r;
+    }
+    sums[27] += r * r;
+}
+
+/// Raw pixels and pose of one iteration, read by the fused terms instead of
+/// going through Image::PointerAt for every value.
+struct OdometryTermInput {
+    OdometryTermInput(const geometry::RGBDImage &source,
+                      const geometry::RGBDImage &target,
+                      const geometry::Image &source_xyz,
+                      const geometry::RGBDImage &target_dx,
+                      const geometry::RGBDImage &target_dy,
+                      const Eigen::Matrix3d &intrinsic,
+                      const Eigen::Matrix4d &extrinsic)
+        : source_color_((const float *)source.color_.data_.data()),
+          source_xyz_((const float *)source_xyz.data_.data()),
+          target_color_((const float *)target.color_.data_.data()),
+          target_depth_((const float *)target.depth_.data_.data()),
+          target_dx_color_((const float *)target_dx.color_.data_.data()),
+          target_dy_color_((const float *)target_dy.color_.data_.data()),
+          target_dx_depth_((const float *)target_dx.depth_.data_.data()),
+          target_dy_depth_((const float *)target_dy.depth_.data_.data()),
+          source_width_(source.color_.width_),
+          target_width_(target.color_.width_),
+          fx_(intrinsic(0, 0)),
+          fy_(intrinsic(1, 1)),
+          cx_(intrinsic(0, 2)),
+          cy_(intrinsic(1, 2)),
+          R_(extrinsic.block<3, 3>(0, 0)),
+          t_(extrinsic.block<3, 1>(0, 3)) {}
+
+    const float *source_color_;
+    const float *source_xyz_;
+    const float *target_color_;
+    const float *target_depth_;
+    const float *target_dx_color_;
+    const float *target_dy_color_;
+    const float *target_dx_depth_;
+    const float *target_dy_depth_;
+    int source_width_;
+    int target_width_;
+    double fx_;
+    double fy_;
+    double cx_;
+    double cy_;
+    Eigen::Matrix3d R_;
+    Eigen::Vector3d t_;
+};
+
+/// Source vertex of pixel \p s transformed into the target camera.
+inline Eigen::Vector3d TransformSourceVertex(const OdometryTermInput &in,
+                                             int s) {
+    return in.R_ * Eigen::Vector3d(in.source_xyz_[3 * s],
+                                   in.source_xyz_[3 * s + 1],
+                                   in.source_xyz_[3 * s + 2]) +
+           in.t_;
+}
+
+/// Jacobian and residual of the color term between source pixel \p s and
+/// target pixel \p t.
+inline void ComputeColorRow(const OdometryTermInput &in,
+                            int s,
+                            int t,
+                            const Eigen::Vector3d &p3d_trans,
+                            double *J,
+                            double &r) {
+    const double dIdx = SOBEL_SCALE * in.target_dx_color_[t];
+    const double dIdy = SOBEL_SCALE * in.target_dy_color_[t];
+    const double invz = 1. / p3d_trans(2);
+    const double c0 = dIdx * in.fx_ * invz;
+    const double c1 = dIdy * in.fy_ * invz;
+    const double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+    J[0] = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
+    J[1] = p3d_trans(2) * c0 - p3d_trans(0) * c2;
+    J[2] = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
+    J[3] = c0;
+    J[4] = c1;
+    J[5] = c2;
+    r = in.target_color_[t] - in.source_color_[s];
+}
+
+/// Rows of RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual.
+struct ColorTerm {
+    void operator()(const OdometryTermInput &in,
+                    const Eigen::Vector4i &corresp,
+                    NormalEquationSums &sums) const {
+        const int s = corresp(1) * in.source_width_ + corresp(0);
+        const int t = corresp(3) * in.target_width_ + corresp(2);
+        double J[6], r;
+        ComputeColorRow(in, s, t, TransformSourceVertex(in, s), J, r);
+        AddRow(J, r, sums);
+    }
+};
+
+/// Rows of RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual.
+struct HybridTerm {
+    void operator()(const OdometryTermInput &in,
+                    const Eigen::Vector4i &corresp,
+                    NormalEquationSums &sums) const {
+        const double sqrt_lambda_dep = std::sqrt(LAMBDA_HYBRID_DEPTH);
+        const double sqrt_lambda_img = std::sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
+        const int s = corresp(1) * in.source_width_ + corresp(0);
+        const int t = corresp(3) * in.target_width_ + corresp(2);
+        const double diff_photo = in.target_color_[t] - in.source_color_[s];
+        const double dIdx = SOBEL_SCALE * in.target_dx_color_[t];
+        const double dIdy = SOBEL_SCALE * in.target_dy_color_[t];
+        double dDdx = SOBEL_SCALE * in.target_dx_depth_[t];
+        double dDdy = SOBEL_SCALE * in.target_dy_depth_[t];
+        if (std::isnan(dDdx)) dDdx = 0;
+        if (std::isnan(dDdy)) dDdy = 0;
+        const Eigen::Vector3d p3d_trans =
+                in.R_ * Eigen::Vector3d(in.source_xyz_[3 * s],
+                                        in.source_xyz_[3 * s + 1],
+                                        in.source_xyz_[3 * s + 2]) +
+                in.t_;
+
+        const double diff_geo = in.target_depth_[t] - p3d_trans(2);
+        const double invz = 1. / p3d_trans(2);
+        const double c0 = dIdx * in.fx_ * invz;
+        const double c1 = dIdy * in.fy_ * invz;
+        const double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+        const double d0 = dDdx * in.fx_ * invz;
+        const double d1 = dDdy * in.fy_ * invz;
+        const double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
+
+        const double J_photo[6] = {
+                sqrt_lambda_img * (-p3d_trans(2) * c1 + p3d_trans(1) * c2),
+                sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2),
+                sqrt_lambda_img * (-p3d_trans(1) * c0 + p3d_trans(0) * c1),
+                sqrt_lambda_img * c0,
+                sqrt_lambda_img * c1,
+                sqrt_lambda_img * c2};
+        AddRow(J_photo, sqrt_lambda_img * diff_photo, sums);
+
+        const double J_geo[6] = {
+                sqrt_lambda_dep * ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) -
+                                   p3d_trans(1)),
+                sqrt_lambda_dep * ((p3d_trans(2) * d0 - p3d_trans(0) * d2) +
+                                   p3d_trans(0)),
+                sqrt_lambda_dep * (-p3d_trans(1) * d0 + p3d_trans(0) * d1),
+                sqrt_lambda_dep * d0,
+                sqrt_lambda_dep * d1,
+                sqrt_lambda_dep * (d2 - 1.0f)};
+        AddRow(J_geo, sqrt_lambda_dep * diff_geo, sums);
+    }
+};
+
+/// Target vertex \p q of pixel (u_t, v_t) and the normal \p n of the target
+/// depth image there, facing the camera. The normal is the cross product of
+/// the derivatives of the back-projection along the image axes, from the
+/// depth and its Sobel gradients. Returns false where a gradient is missing.
+inline bool ComputeTargetPlane(const OdometryTermInput &in,
+                               int u_t,
+                               int v_t,
+                               Eigen::Vector3d &q,
+                               Eigen::Vector3d &n) {
+    const int t = v_t * in.target_width_ + u_t;
+    const double d = in.target_depth_[t];
+    const double dDdu = SOBEL_SCALE * in.target_dx_depth_[t];
+    const double dDdv = SOBEL_SCALE * in.target_dy_depth_[t];
+    if (std::isnan(dDdu) || std::isnan(dDdv)) {
+        return false;
+    }
+    const Eigen::Vector3d ray((u_t - in.cx_) / in.fx_,
+                              (v_t - in.cy_) / in.fy_, 1.0);
+    q = d * ray;
+    const Eigen::Vector3d tangent_u =
+            dDdu * ray + Eigen::Vector3d(d / in.fx_, 0.0, 0.0);
+    const Eigen::Vector3d tangent_v =
+            dDdv * ray + Eigen::Vector3d(0.0, d / in.fy_, 0.0);
+    n = tangent_u.cross(tangent_v);
+    const double norm = n.norm();
+    if (norm == 0.0) {
+        return false;
+    }
+    n /= q.dot(n) > 0.0 ? -norm : norm;
+    return true;
+}
+
+/// Rows of RGBDOdometryJacobianFromPointToPlaneTerm: the point-to-plane row,
+/// and the weighted color row if \p sqrt_lambda_color is positive. Returns
+/// the number of rows.
+inline int ComputePointToPlaneRows(const OdometryTermInput &in,
+                                   const Eigen::Vector4i &corresp,
+                                   double sqrt_lambda_color,
+                                   double (&J)[2][6],
+                                   double (&r)[2]) {
+    Eigen::Vector3d q, n;
+    if (!ComputeTargetPlane(in, corresp(2), corresp(3), q, n)) {
+        return 0;
+    }
+    const int s = corresp(1) * in.source_width_ + corresp(0);
+    const Eigen::Vector3d p3d_trans = TransformSourceVertex(in, s);
+    const Eigen::Vector3d pxn = p3d_trans.cross(n);
+    for (int i = 0; i < 3; i++) {
+        J[0][i] = pxn(i);
+        J[0][3 + i] = n(i);
+    }
+    r[0] = (p3d_trans - q).dot(n);
+    if (sqrt_lambda_color <= 0.0) {
+        return 1;
+    }
+    const int t = corresp(3) * in.target_width_ + corresp(2);
+    ComputeColorRow(in, s, t, p3d_trans, J[1], r[1]);
+    for (int i = 0; i < 6; i++) {
+        J[1][i] *= sqrt_lambda_color;
+    }
+    r[1] *= sqrt_lambda_color;
+    return 2;
+}
+
+struct PointToPlaneTerm {
+    void operator()(const OdometryTermInput &in,
+                    const Eigen::Vector4i &corresp,
+                    NormalEquationSums &sums) const {
+        double J[2][6], r[2];
+        const int num_rows =
+                ComputePointToPlaneRows(in, corresp, sqrt_lambda_color_, J, r);
+        for (int i = 0; i < num_rows; i++) {
+            AddRow(J[i], r[i], sums);
+        }
+    }
+
+    double sqrt_lambda_color_;
+};
+
+/// Projection of the source pixels into the target, as in the
+/// ComputeCorrespondence() of Odometry.cpp.
+struct PixelProjection {
+    PixelProjection(const Eigen::Matrix3d &intrinsic,
+                    const Eigen::Matrix4d &extrinsic,
+                    const geometry::Image &depth_s,
+                    const geometry::Image &depth_t,
+                    double max_depth_diff)
+        : KRK_inv_(intrinsic * extrinsic.block<3, 3>(0, 0) *
+                   intrinsic.inverse()),
+          Kt_(intrinsic * extrinsic.block<3, 1>(0, 3)),
+          depth_s_((const float *)depth_s.data_.data()),
+          depth_t_((const float *)depth_t.data_.data()),
+          width_s_(depth_s.width_),
+          width_t_(depth_t.width_),
+          height_t_(depth_t.height_),
+          max_depth_diff_(max_depth_diff) {}
+
+    /// Returns true and the correspondence of source pixel (u_s, v_s) if it
+    /// has one.
+    bool operator()(int u_s, int v_s, Eigen::Vector4i &corresp) const {
+        double d_s = depth_s_[v_s * width_s_ + u_s];
+        if (std::isnan(d_s)) {
+            return false;
+        }
+        Eigen::Vector3d uv_in_s =
+                d_s * KRK_inv_ * Eigen::Vector3d(u_s, v_s, 1.0) + Kt_;
+        double transformed_d_s = uv_in_s(2);
+        int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+        int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+        if (u_t < 0 || u_t >= width_t_ || v_t < 0 || v_t >= height_t_) {
+            return false;
+        }
+        double d_t = depth_t_[v_t * width_t_ + u_t];
+        if (std::isnan(d_t) ||
+            std::abs(transformed_d_s - d_t) > max_depth_diff_) {
+            return false;
+        }
+        corresp = Eigen::Vector4i(u_s, v_s, u_t, v_t);
+        return true;
+    }
+
+    Eigen::Matrix3d KRK_inv_;
+    Eigen::Vector3d Kt_;
+    const float *depth_s_;
+    const float *depth_t_;
+    int width_s_;
+    int width_t_;
+    int height_t_;
+    double max_depth_diff_;
+};
+
+NormalEquationSums AddSums(NormalEquationSums lhs,
+                           const NormalEquationSums &rhs) {
+    for (size_t k = 0; k < lhs.size(); k++) {
+        lhs[k] += rhs[k];
+    }
+    return lhs;
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> UnpackSums(
+        const NormalEquationSums &sums) {
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int k = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = i; j < 6; j++) {
+            JTJ(i, j) = JTJ(j, i) = sums[k++];
+        }
+        JTr(i) = sums[21 + i];
+    }
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      sums[27] / sums[28], int64_t(sums[28]));
+    return std::make_tuple(JTJ, JTr, sums[27]);
+}
+
+/// Computes and accumulates the rows of \p term for all correspondences in
+/// one pass, with the term selected at compile time.
+template <typename Term>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTrFused(
+        const Term &term,
+        const OdometryTermInput &input,
+        const odometry::CorrespondenceSetPixelWise &corresps) {
+    NormalEquationSums identity;
+    identity.fill(0.0);
+    NormalEquationSums sums = utility::ParallelReduce(
+            int64_t(0), int64_t(corresps.size()), identity,
+            [&](int64_t begin, int64_t end, NormalEquationSums partial) {
+                for (int64_t row = begin; row < end; row++) {
+                    term(input, corresps[row], partial);
+                }
+                return partial;
+            },
+            AddSums, CORRESPONDENCE_GRAIN_SIZE);
+    sums[28] = double(corresps.size());
+    return UnpackSums(sums);
+}
+
+/// Projects the pixels of rows of the source image and accumulates the rows
+/// of \p term for the correspondences in the same pass.
+template <typename Term>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+ComputeJTJandJTrDirectFused(const Term &term,
+                            const OdometryTermInput &input,
+                            const PixelProjection &projection,
+                            int width,
+                            int height) {
+    NormalEquationSums identity;
+    identity.fill(0.0);
+    const NormalEquationSums sums = utility::ParallelReduce(
+            int64_t(0), int64_t(height), identity,
+            [&](int64_t begin, int64_t end, NormalEquationSums partial) {
+                Eigen::Vector4i corresp;
+                for (int v_s = int(begin); v_s < int(end); v_s++) {
+                    for (int u_s = 0; u_s < width; u_s++) {
+                        if (projection(u_s, v_s, corresp)) {
+                            term(input, corresp, partial);
+                            partial[28] += 1.0;
+                        }
+                    }
+                }
+                return partial;
+            },
+            AddSums, ROW_GRAIN_SIZE);
+    return UnpackSums(sums);
+}
+
 }  // unnamed namespace
 
 namespace odometry {
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    auto f_lambda =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r) {
+                ComputeJacobianAndResidual(i, J_r, r, source, target,
+                                           source_xyz, target_dx, target_dy,
+                                           intrinsic, extrinsic, corresps);
+            };
+    return utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+            f_lambda, (int)corresps.size());
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTrDirect(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double max_depth_diff) const {
+    const PixelProjection projection(intrinsic, extrinsic, source.depth_,
+                                     target.depth_, max_depth_diff);
+    CorrespondenceSetPixelWise corresps;
+    Eigen::Vector4i corresp;
+    for (int v_s = 0; v_s < source.depth_.height_; v_s++) {
+        for (int u_s = 0; u_s < source.depth_.width_; u_s++) {
+            if (projection(u_s, v_s, corresp)) {
+                corresps.push_back(corresp);
+            }
+        }
+    }
+    return ComputeJTJandJTr(source, target, source_xyz, target_dx, target_dy,
+                            intrinsic, extrinsic, corresps);
+}
+
 void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -83,6 +508,42 @@ void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
     r[0] = diff;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromColorTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    return ComputeJTJandJTrFused(
+            ColorTerm(),
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            corresps);
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromColorTerm::ComputeJTJandJTrDirect(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double max_depth_diff) const {
+    return ComputeJTJandJTrDirectFused(
+            ColorTerm(),
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            PixelProjection(intrinsic, extrinsic, source.depth_,
+                            target.depth_, max_depth_diff),
+            source.depth_.width_, source.depth_.height_);
+}
+
 void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -153,5 +614,102 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
     r[1] = r_geo;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    return ComputeJTJandJTrFused(
+            HybridTerm(),
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            corresps);
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTrDirect(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double max_depth_diff) const {
+    return ComputeJTJandJTrDirectFused(
+            HybridTerm(),
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            PixelProjection(intrinsic, extrinsic, source.depth_,
+                            target.depth_, max_depth_diff),
+            source.depth_.width_, source.depth_.height_);
+}
+
+void RGBDOdometryJacobianFromPointToPlaneTerm::ComputeJacobianAndResidual(
+        int row,
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+        std::vector<double> &r,
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    double J_rows[2][6], r_rows[2];
+    const int num_rows = ComputePointToPlaneRows(
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            corresps[row], std::sqrt(lambda_color_), J_rows, r_rows);
+    J_r.resize(num_rows);
+    r.resize(num_rows);
+    for (int i = 0; i < num_rows; i++) {
+        J_r[i] = Eigen::Map<const Eigen::Vector6d>(J_rows[i]);
+        r[i] = r_rows[i];
+    }
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromPointToPlaneTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    return ComputeJTJandJTrFused(
+            PointToPlaneTerm{std::sqrt(lambda_color_)},
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            corresps);
+}
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromPointToPlaneTerm::ComputeJTJandJTrDirect(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double max_depth_diff) const {
+    return ComputeJTJandJTrDirectFused(
+            PointToPlaneTerm{std::sqrt(lambda_color_)},
+            OdometryTermInput(source, target, source_xyz, target_dx,
+                              target_dy, intrinsic, extrinsic),
+            PixelProjection(intrinsic, extrinsic, source.depth_,
+                            target.depth_, max_depth_diff),
+            source.depth_.width_, source.depth_.height_);
+}
+
 }  // namespace odometry
 }  // namespace open3d
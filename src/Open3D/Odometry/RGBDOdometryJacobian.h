@@ -75,6 +75,43 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const = 0;
+
+    /// \brief Function to compute JTJ, JTr and the sum of the squared
+    /// residuals over all correspondences.
+    ///
+    /// The default implementation accumulates the rows of
+    /// ComputeJacobianAndResidual(). The built-in terms override it with
+    /// loops that compute and accumulate the rows in place.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const;
+
+    /// \brief Function to compute JTJ, JTr and the sum of the squared
+    /// residuals without a correspondence set.
+    ///
+    /// Every source pixel with a depth is projected into the target with
+    /// \p extrinsic. It corresponds to the target pixel it lands on if their
+    /// depths differ by at most \p max_depth_diff, which rejects occluded
+    /// pixels. These are the correspondences of ComputeRGBDOdometry. The
+    /// default implementation collects them and calls ComputeJTJandJTr(). The
+    /// built-in terms accumulate the rows while projecting the pixels.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTrDirect(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double max_depth_diff) const;
 };
 
 /// \class RGBDOdometryJacobianFromColorTerm
@@ -106,6 +143,25 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTrDirect(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double max_depth_diff) const override;
 };
 
 /// \class RGBDOdometryJacobianFromHybridTerm
@@ -136,6 +192,80 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTrDirect(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double max_depth_diff) const override;
+};
+
+/// \class RGBDOdometryJacobianFromPointToPlaneTerm
+///
+/// \brief Class to compute Jacobian using projective point-to-plane term.
+///
+/// Energy: (n_q.(p'-q))^2 + lambda_color(I_p-I_q)^2, where p' is the source
+/// vertex in the target camera, and q and n_q are the target vertex and
+/// normal at its projection. The target normals are computed from the depth
+/// gradients cached per pyramid level. Pixels without normal are skipped.
+class RGBDOdometryJacobianFromPointToPlaneTerm : public RGBDOdometryJacobian {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param lambda_color Weight of the color term, 0 for depth only.
+    RGBDOdometryJacobianFromPointToPlaneTerm(double lambda_color = 0.0)
+        : lambda_color_(lambda_color) {}
+    ~RGBDOdometryJacobianFromPointToPlaneTerm() override {}
+
+public:
+    void ComputeJacobianAndResidual(
+            int row,
+            std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+            std::vector<double> &r,
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTrDirect(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double max_depth_diff) const override;
+
+public:
+    /// Weight of the color term relative to the point-to-plane term.
+    double lambda_color_;
 };
 
 }  // namespace odometry
@@ -29,30 +29,30 @@
 #include <Eigen/Dense>
 #include <iostream>
 
-#include "Open3D/Geometry/KDTreeFlann.h"
-#include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/RegistrationTarget.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
-class PointCloudForColoredICP : public geometry::PointCloud {
-public:
-    std::vector<Eigen::Vector3d> color_gradient_;
-};
-
 class TransformationEstimationForColoredICP : public TransformationEstimation {
 public:
     TransformationEstimationType GetTransformationEstimationType()
             const override {
         return type_;
     };
-    TransformationEstimationForColoredICP(double lambda_geometric = 0.968)
-        : lambda_geometric_(lambda_geometric) {
+    TransformationEstimationForColoredICP(
+            const std::vector<Eigen::Vector3d> &target_color_gradients,
+            double lambda_geometric,
+            std::shared_ptr<RobustKernel> kernel)
+        : lambda_geometric_(lambda_geometric),
+          kernel_(std::move(kernel)),
+          target_color_gradients_(target_color_gradients) {
         if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0)
             lambda_geometric_ = 0.968;
     }
@@ -69,75 +69,56 @@ public:
 
 public:
     double lambda_geometric_;
+    std::shared_ptr<RobustKernel> kernel_;
 
 private:
+    const std::vector<Eigen::Vector3d> &target_color_gradients_;
     const TransformationEstimationType type_ =
             TransformationEstimationType::ColoredICP;
 };
 
-std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
-        const geometry::PointCloud &target,
-        const geometry::KDTreeSearchParamHybrid &search_param) {
-    utility::LogDebug("InitializePointCloudForColoredICP");
-
-    geometry::KDTreeFlann tree;
-    tree.SetGeometry(target);
-
-    auto output = std::make_shared<PointCloudForColoredICP>();
-    output->colors_ = target.colors_;
-    output->normals_ = target.normals_;
-    output->points_ = target.points_;
-
-    size_t n_points = output->points_.size();
-    output->color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
-
-    for (size_t k = 0; k < n_points; k++) {
-        const Eigen::Vector3d &vt = output->points_[k];
-        const Eigen::Vector3d &nt = output->normals_[k];
-        double it = (output->colors_[k](0) + output->colors_[k](1) +
-                     output->colors_[k](2)) /
-                    3.0;
-
-        std::vector<int> point_idx;
-        std::vector<double> point_squared_distance;
+// Sums of the Colored ICP normal equations.
+struct ColoredICPSums {
+    Eigen::Matrix<double, 6, 6, Eigen::DontAlign> JTJ =
+            Eigen::Matrix6d::Zero();
+    Eigen::Matrix<double, 6, 1, Eigen::DontAlign> JTr =
+            Eigen::Vector6d::Zero();
+};
 
-        if (tree.SearchHybrid(vt, search_param.radius_, search_param.max_nn_,
-                              point_idx, point_squared_distance) >= 4) {
-            // approximate image gradient of vt's tangential plane
-            size_t nn = point_idx.size();
-            Eigen::MatrixXd A(nn, 3);
-            Eigen::MatrixXd b(nn, 1);
-            A.setZero();
-            b.setZero();
-            for (size_t i = 1; i < nn; i++) {
-                int P_adj_idx = point_idx[i];
-                Eigen::Vector3d vt_adj = output->points_[P_adj_idx];
-                Eigen::Vector3d vt_proj = vt_adj - (vt_adj - vt).dot(nt) * nt;
-                double it_adj = (output->colors_[P_adj_idx](0) +
-                                 output->colors_[P_adj_idx](1) +
-                                 output->colors_[P_adj_idx](2)) /
-                                3.0;
-                A(i - 1, 0) = (vt_proj(0) - vt(0));
-                A(i - 1, 1) = (vt_proj(1) - vt(1));
-                A(i - 1, 2) = (vt_proj(2) - vt(2));
-                b(i - 1, 0) = (it_adj - it);
-            }
-            // adds orthogonal constraint
-            A(nn - 1, 0) = (nn - 1) * nt(0);
-            A(nn - 1, 1) = (nn - 1) * nt(1);
-            A(nn - 1, 2) = (nn - 1) * nt(2);
-            b(nn - 1, 0) = 0;
-            // solving linear equation
-            bool is_success;
-            Eigen::MatrixXd x;
-            std::tie(is_success, x) = utility::SolveLinearSystemPSD(
-                    A.transpose() * A, A.transpose() * b);
-            if (is_success) {
-                output->color_gradient_[k] = x;
-            }
-        }
+// Geometric and photometric residuals of a correspondence and, if J is not
+// null, their Jacobians, both unweighted.
+inline Eigen::Vector2d ComputeColoredICPResidual(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<Eigen::Vector3d> &target_color_gradients,
+        const Eigen::Vector2i &c,
+        double sqrt_lambda_geometric,
+        double sqrt_lambda_photometric,
+        Eigen::Matrix<double, 6, 2> *J) {
+    const int cs = c(0);
+    const int ct = c(1);
+    const Eigen::Vector3d &vs = source.points_[cs];
+    const Eigen::Vector3d &vt = target.points_[ct];
+    const Eigen::Vector3d &nt = target.normals_[ct];
+    const Eigen::Vector3d &dit = target_color_gradients[ct];
+    const double d = (vs - vt).dot(nt);
+
+    // project vs into vt's tangential plane
+    Eigen::Vector3d vs_proj = vs - d * nt;
+    double is = source.colors_[cs].sum() / 3.0;
+    double it = target.colors_[ct].sum() / 3.0;
+    double is0_proj = (dit.dot(vs_proj - vt)) + it;
+
+    if (J != nullptr) {
+        // -dit^T (I - nt nt^T)
+        const Eigen::Vector3d ditM = -dit + dit.dot(nt) * nt;
+        J->block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
+        J->block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
+        J->block<3, 1>(0, 1) = sqrt_lambda_photometric * vs.cross(ditM);
+        J->block<3, 1>(3, 1) = sqrt_lambda_photometric * ditM;
     }
-    return output;
+    return Eigen::Vector2d(sqrt_lambda_geometric * d,
+                           sqrt_lambda_photometric * (is - is0_proj));
 }
 
 Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
@@ -152,61 +133,39 @@ Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
     double lambda_photometric = 1.0 - lambda_geometric_;
     double sqrt_lambda_photometric = sqrt(lambda_photometric);
 
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                size_t cs = corres[i][0];
-                size_t ct = corres[i][1];
-                const Eigen::Vector3d &vs = source.points_[cs];
-                const Eigen::Vector3d &vt = target.points_[ct];
-                const Eigen::Vector3d &nt = target.normals_[ct];
-
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
-
-                // project vs into vt's tangential plane
-                Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-                double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                             source.colors_[cs](2)) /
-                            3.0;
-                double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                             target.colors_[ct](2)) /
-                            3.0;
-                const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-                double is0_proj = (dit.dot(vs_proj - vt)) + it;
-
-                const Eigen::Matrix3d M =
-                        (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
-                         -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
-                         1.0 - nt(1) * nt(1), -nt(1) * nt(2), -nt(0) * nt(2),
-                         -nt(1) * nt(2), 1.0 - nt(2) * nt(2))
-                                .finished();
-
-                const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
-                        sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
-
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+    // Residuals and Jacobians are accumulated into per-thread sums, both
+    // weighted by the robust kernel.
+    const ColoredICPSums sums = utility::ParallelReduce(
+            0, int64_t(corres.size()), ColoredICPSums(),
+            [&](int64_t begin, int64_t end, ColoredICPSums partial) {
+                Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+                Eigen::Matrix<double, 6, 2> J;
+                for (int64_t i = begin; i < end; i++) {
+                    const Eigen::Vector2d r = ComputeColoredICPResidual(
+                            source, target, target_color_gradients_,
+                            corres[i], sqrt_lambda_geometric,
+                            sqrt_lambda_photometric, &J);
+                    const Eigen::Vector2d w(kernel_->Weight(r(0)),
+                                            kernel_->Weight(r(1)));
+                    JTJ.noalias() += J * w.asDiagonal() * J.transpose();
+                    JTr.noalias() += J * w.cwiseProduct(r);
+                }
+                partial.JTJ += JTJ;
+                partial.JTr += JTr;
+                return partial;
+            },
+            [](ColoredICPSums lhs, const ColoredICPSums &rhs) {
+                lhs.JTJ += rhs.JTJ;
+                lhs.JTr += rhs.JTr;
+                return lhs;
+            });
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
     std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(sums.JTJ,
+                                                                 sums.JTr);
 
     return is_success ? extrinsic : Eigen::Matrix4d::Identity();
 }
@@ -218,30 +177,20 @@ double TransformationEstimationForColoredICP::ComputeRMSE(
     double sqrt_lambda_geometric = sqrt(lambda_geometric_);
     double lambda_photometric = 1.0 - lambda_geometric_;
     double sqrt_lambda_photometric = sqrt(lambda_photometric);
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    double residual = 0.0;
-    for (size_t i = 0; i < corres.size(); i++) {
-        size_t cs = corres[i][0];
-        size_t ct = corres[i][1];
-        const Eigen::Vector3d &vs = source.points_[cs];
-        const Eigen::Vector3d &vt = target.points_[ct];
-        const Eigen::Vector3d &nt = target.normals_[ct];
-        Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-        double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                     source.colors_[cs](2)) /
-                    3.0;
-        double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                     target.colors_[ct](2)) /
-                    3.0;
-        const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-        double is0_proj = (dit.dot(vs_proj - vt)) + it;
-        double residual_geometric = sqrt_lambda_geometric * (vs - vt).dot(nt);
-        double residual_photometric = sqrt_lambda_photometric * (is - is0_proj);
-        residual += residual_geometric * residual_geometric +
-                    residual_photometric * residual_photometric;
-    }
-    return residual;
+    return utility::ParallelReduce(
+            0, int64_t(corres.size()), 0.0,
+            [&](int64_t begin, int64_t end, double residual) {
+                for (int64_t i = begin; i < end; i++) {
+                    residual += ComputeColoredICPResidual(
+                                        source, target,
+                                        target_color_gradients_, corres[i],
+                                        sqrt_lambda_geometric,
+                                        sqrt_lambda_photometric, nullptr)
+                                        .squaredNorm();
+                }
+                return residual;
+            },
+            [](double lhs, double rhs) { return lhs + rhs; });
 };
 
 }  // unnamed namespace
@@ -254,12 +203,31 @@ RegistrationResult RegistrationColoredICP(
         double max_distance,
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
-        double lambda_geometric /* = 0.968*/) {
-    auto target_c = InitializePointCloudForColoredICP(
-            target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(
-            source, *target_c, max_distance, init,
-            TransformationEstimationForColoredICP(lambda_geometric), criteria);
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel /* = L2Loss*/) {
+    const RegistrationTarget registration_target(target, max_distance * 2.0);
+    return RegistrationColoredICP(source, registration_target, max_distance,
+                                  init, criteria, lambda_geometric,
+                                  std::move(kernel));
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel /* = L2Loss*/) {
+    if (!target.HasColorGradients()) {
+        utility::LogError(
+                "[RegistrationColoredICP] The target has no color gradients.");
+    }
+    return RegistrationICP(source, target, max_distance, init,
+                           TransformationEstimationForColoredICP(
+                                   target.GetColorGradients(),
+                                   lambda_geometric, std::move(kernel)),
+                           criteria);
 }
 
 }  // namespace registration
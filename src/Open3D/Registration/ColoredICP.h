@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 
 #include "Open3D/Registration/Registration.h"
 
@@ -38,6 +39,7 @@ class PointCloud;
 
 namespace registration {
 class RegistrationResult;
+class RegistrationTarget;
 
 /// \brief Function for Colored ICP registration.
 ///
@@ -52,13 +54,35 @@ class RegistrationResult;
 /// Default value: array([[1., 0., 0., 0.], [0., 1., 0., 0.], [0., 0., 1., 0.],
 /// [0., 0., 0., 1.]]). \param criteria  Convergence criteria. \param
 /// lambda_geometric  lambda_geometric value.
+/// \param kernel Robust kernel that weights the geometric and photometric
+/// residuals.
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_distance,
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
-        double lambda_geometric = 0.968);
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>());
+
+/// \brief Function for Colored ICP registration against a prebuilt target.
+///
+/// \param source The source point cloud.
+/// \param target The target, with its color gradients computed.
+/// \param max_distance Maximum correspondence points-pair distance.
+/// \param init Initial transformation estimation.
+/// \param criteria Convergence criteria.
+/// \param lambda_geometric lambda_geometric value.
+/// \param kernel Robust kernel that weights the geometric and photometric
+/// residuals.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>());
 
 }  // namespace registration
 }  // namespace open3d
@@ -27,29 +27,36 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace registration {
 
-bool CorrespondenceCheckerBasedOnEdgeLength::Check(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres,
-        const Eigen::Matrix4d & /*transformation*/) const {
+namespace {
+
+// The checks compare squared lengths, which is equivalent for non-negative
+// thresholds. With negative thresholds, every edge length check passes and
+// every distance check fails.
+
+bool HasSimilarEdgeLengths(const geometry::PointCloud &source,
+                           const geometry::PointCloud &target,
+                           const CorrespondenceSet &corres,
+                           double similarity_threshold2) {
     for (size_t i = 0; i < corres.size(); i++) {
         for (size_t j = i + 1; j < corres.size(); j++) {
             // check edge ij
-            double dis_source = (source.points_[corres[i](0)] -
-                                 source.points_[corres[j](0)])
-                                        .norm();
-            double dis_target = (target.points_[corres[i](1)] -
-                                 target.points_[corres[j](1)])
-                                        .norm();
-            if (dis_source < dis_target * similarity_threshold_ ||
-                dis_target < dis_source * similarity_threshold_) {
+            const double dis2_source = (source.points_[corres[i](0)] -
+                                        source.points_[corres[j](0)])
+                                               .squaredNorm();
+            const double dis2_target = (target.points_[corres[i](1)] -
+                                        target.points_[corres[j](1)])
+                                               .squaredNorm();
+            if (dis2_source < dis2_target * similarity_threshold2 ||
+                dis2_target < dis2_source * similarity_threshold2) {
                 return false;
             }
         }
@@ -57,21 +64,115 @@ bool CorrespondenceCheckerBasedOnEdgeLength::Check(
     return true;
 }
 
+bool HasCloseDistances(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres,
+                       const Eigen::Matrix4d &transformation,
+                       double distance_threshold2) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    for (const auto &c : corres) {
+        if ((target.points_[c(1)] -
+             (rotation * source.points_[c(0)] + translation))
+                    .squaredNorm() > distance_threshold2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HasSimilarNormals(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres,
+                       const Eigen::Matrix4d &transformation,
+                       double cos_normal_angle_threshold) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    for (const auto &c : corres) {
+        if (target.normals_[c(1)].dot(rotation * source.normals_[c(0)]) <
+            cos_normal_angle_threshold) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+void CorrespondenceChecker::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d_u> &transformations,
+        std::vector<uint8_t> &valid) const {
+    utility::ParallelFor(0, int64_t(corres.size()), [&](int64_t i) {
+        if (valid[i] &&
+            !Check(source, target, corres[i], transformations[i])) {
+            valid[i] = 0;
+        }
+    });
+}
+
+bool CorrespondenceCheckerBasedOnEdgeLength::Check(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        const Eigen::Matrix4d & /*transformation*/) const {
+    return similarity_threshold_ <= 0.0 ||
+           HasSimilarEdgeLengths(source, target, corres,
+                                 similarity_threshold_ * similarity_threshold_);
+}
+
+void CorrespondenceCheckerBasedOnEdgeLength::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d_u> & /*transformations*/,
+        std::vector<uint8_t> &valid) const {
+    if (similarity_threshold_ <= 0.0) {
+        return;
+    }
+    const double similarity_threshold2 =
+            similarity_threshold_ * similarity_threshold_;
+    utility::ParallelFor(0, int64_t(corres.size()), [&](int64_t i) {
+        if (valid[i] && !HasSimilarEdgeLengths(source, target, corres[i],
+                                               similarity_threshold2)) {
+            valid[i] = 0;
+        }
+    });
+}
+
 bool CorrespondenceCheckerBasedOnDistance::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres,
         const Eigen::Matrix4d &transformation) const {
-    for (const auto &c : corres) {
-        const auto &pt = source.points_[c(0)];
-        Eigen::Vector3d pt_trans =
-                (transformation * Eigen::Vector4d(pt(0), pt(1), pt(2), 1.0))
-                        .block<3, 1>(0, 0);
-        if ((target.points_[c(1)] - pt_trans).norm() > distance_threshold_) {
-            return false;
-        }
+    if (distance_threshold_ < 0.0) {
+        return corres.empty();
     }
-    return true;
+    return HasCloseDistances(source, target, corres, transformation,
+                             distance_threshold_ * distance_threshold_);
+}
+
+void CorrespondenceCheckerBasedOnDistance::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d_u> &transformations,
+        std::vector<uint8_t> &valid) const {
+    const double distance_threshold2 =
+            distance_threshold_ * distance_threshold_;
+    utility::ParallelFor(0, int64_t(corres.size()), [&](int64_t i) {
+        if (!valid[i]) {
+            return;
+        }
+        if (distance_threshold_ < 0.0
+                    ? !corres[i].empty()
+                    : !HasCloseDistances(source, target, corres[i],
+                                         transformations[i],
+                                         distance_threshold2)) {
+            valid[i] = 0;
+        }
+    });
 }
 
 bool CorrespondenceCheckerBasedOnNormal::Check(
@@ -85,19 +186,91 @@ bool CorrespondenceCheckerBasedOnNormal::Check(
                 "normals.");
         return true;
     }
-    double cos_normal_angle_threshold = std::cos(normal_angle_threshold_);
-    for (const auto &c : corres) {
-        const auto &normal = source.normals_[c(0)];
-        Eigen::Vector3d normal_trans =
-                (transformation *
-                 Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0))
-                        .block<3, 1>(0, 0);
-        if (target.normals_[c(1)].dot(normal_trans) <
-            cos_normal_angle_threshold) {
-            return false;
+    return HasSimilarNormals(source, target, corres, transformation,
+                             std::cos(normal_angle_threshold_));
+}
+
+void CorrespondenceCheckerBasedOnNormal::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d_u> &transformations,
+        std::vector<uint8_t> &valid) const {
+    if (!source.HasNormals() || !target.HasNormals()) {
+        utility::LogWarning(
+                "[CorrespondenceCheckerBasedOnNormal::CheckBatch] Pointcloud "
+                "has no normals.");
+        return;
+    }
+    const double cos_normal_angle_threshold =
+            std::cos(normal_angle_threshold_);
+    utility::ParallelFor(0, int64_t(corres.size()), [&](int64_t i) {
+        if (valid[i] && !HasSimilarNormals(source, target, corres[i],
+                                           transformations[i],
+                                           cos_normal_angle_threshold)) {
+            valid[i] = 0;
         }
+    });
+}
+
+CorrespondenceCheckerSchedule::CorrespondenceCheckerSchedule(
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers,
+        int ransac_n) {
+    for (const auto &checker : checkers) {
+        entries_.push_back({&checker.get(), checker.get().GetCost(ransac_n),
+                            0, 0});
     }
-    return true;
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [](const Entry &lhs, const Entry &rhs) {
+                         return lhs.cost < rhs.cost;
+                     });
+}
+
+void CorrespondenceCheckerSchedule::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d_u> &transformations,
+        std::vector<uint8_t> &valid,
+        bool require_pointcloud_alignment) {
+    for (auto &entry : entries_) {
+        if (entry.checker->require_pointcloud_alignment_ !=
+            require_pointcloud_alignment) {
+            continue;
+        }
+        const int64_t num_valid = std::count_if(
+                valid.begin(), valid.end(), [](uint8_t v) { return v != 0; });
+        if (num_valid == 0) {
+            return;
+        }
+        entry.checker->CheckBatch(source, target, corres, transformations,
+                                  valid);
+        entry.num_checked += num_valid;
+        entry.num_rejected +=
+                num_valid - std::count_if(valid.begin(), valid.end(),
+                                          [](uint8_t v) { return v != 0; });
+    }
+
+    // Expected rejections per unit cost, with one pseudo rejection and one
+    // pseudo pass so that unseen checkers start at a rate of one half.
+    auto priority = [](const Entry &entry) {
+        return double(entry.num_rejected + 1) /
+               double(entry.num_checked + 2) / std::max(entry.cost, 1e-9);
+    };
+    std::stable_sort(entries_.begin(), entries_.end(),
+                     [&](const Entry &lhs, const Entry &rhs) {
+                         return priority(lhs) > priority(rhs);
+                     });
+}
+
+std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+CorrespondenceCheckerSchedule::GetCheckers() const {
+    std::vector<std::reference_wrapper<const CorrespondenceChecker>> checkers;
+    for (const auto &entry : entries_) {
+        checkers.push_back(*entry.checker);
+    }
+    return checkers;
 }
 
 }  // namespace registration
@@ -27,11 +27,14 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "Open3D/Registration/TransformationEstimation.h"
+#include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
 
@@ -47,7 +50,9 @@ namespace registration {
 ///
 /// This class is used in feature based matching algorithms (such as RANSAC and
 /// FastGlobalRegistration) to prune out outlier correspondences.
-/// The virtual function Check() must be implemented in subclasses.
+/// The virtual function Check() must be implemented in subclasses. Subclasses
+/// may override CheckBatch() to check many hypotheses without a virtual call
+/// per hypothesis, and GetCost() to tell how expensive a check is.
 class CorrespondenceChecker {
 public:
     /// \brief Default Constructor.
@@ -72,6 +77,31 @@ public:
                        const CorrespondenceSet &corres,
                        const Eigen::Matrix4d &transformation) const = 0;
 
+    /// \brief Function to check many hypotheses at once.
+    ///
+    /// Hypothesis i consists of \p corres[i] and \p transformations[i]. Only
+    /// the hypotheses with valid[i] != 0 are checked, and valid[i] is set to 0
+    /// if the check fails. The default implementation calls Check() on them in
+    /// parallel.
+    /// \param source Source point cloud.
+    /// \param target Target point cloud.
+    /// \param corres Correspondence sets of the hypotheses.
+    /// \param transformations Estimated transformations of the hypotheses.
+    /// \param valid Validity of the hypotheses, updated in place.
+    virtual void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres,
+            const std::vector<Eigen::Matrix4d_u> &transformations,
+            std::vector<uint8_t> &valid) const;
+
+    /// \brief Relative cost of checking one hypothesis.
+    ///
+    /// Used to run cheap checkers first. The default is linear in the number
+    /// of correspondences.
+    /// \param ransac_n Number of correspondences of a hypothesis.
+    virtual double GetCost(int ransac_n) const { return double(ransac_n); }
+
 public:
     /// Some checkers do not require point clouds to be aligned, e.g., the edge
     /// length checker. Some checkers do, e.g., the distance checker.
@@ -103,6 +133,15 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(const geometry::PointCloud &source,
+                    const geometry::PointCloud &target,
+                    const std::vector<CorrespondenceSet> &corres,
+                    const std::vector<Eigen::Matrix4d_u> &transformations,
+                    std::vector<uint8_t> &valid) const override;
+    /// Every pair of correspondences is compared.
+    double GetCost(int ransac_n) const override {
+        return 0.5 * ransac_n * (ransac_n - 1);
+    }
 
 public:
     /// For the check to be true,
@@ -130,6 +169,11 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(const geometry::PointCloud &source,
+                    const geometry::PointCloud &target,
+                    const std::vector<CorrespondenceSet> &corres,
+                    const std::vector<Eigen::Matrix4d_u> &transformations,
+                    std::vector<uint8_t> &valid) const override;
 
 public:
     /// Distance threashold for the check.
@@ -157,11 +201,64 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(const geometry::PointCloud &source,
+                    const geometry::PointCloud &target,
+                    const std::vector<CorrespondenceSet> &corres,
+                    const std::vector<Eigen::Matrix4d_u> &transformations,
+                    std::vector<uint8_t> &valid) const override;
 
 public:
     /// Radian value for angle threshold.
     double normal_angle_threshold_;
 };
 
+/// \class CorrespondenceCheckerSchedule
+///
+/// \brief Runs a list of checkers on batches of hypotheses.
+///
+/// A hypothesis is valid if it passes all checkers, so the order of the
+/// checkers does not change the result, only the time it takes. The schedule
+/// records how many hypotheses each checker rejects, and after every batch
+/// reorders the checkers by rejections per unit of GetCost(), so the cheapest
+/// and most selective checker runs first and the others only see the
+/// hypotheses it let through.
+class CorrespondenceCheckerSchedule {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param checkers Checkers to run.
+    /// \param ransac_n Number of correspondences of a hypothesis.
+    CorrespondenceCheckerSchedule(
+            const std::vector<std::reference_wrapper<
+                    const CorrespondenceChecker>> &checkers,
+            int ransac_n);
+
+public:
+    /// \brief Checks a batch of hypotheses, see
+    /// CorrespondenceChecker::CheckBatch().
+    ///
+    /// \param require_pointcloud_alignment Runs the checkers that require
+    /// aligned point clouds if true, and the other ones if false.
+    void CheckBatch(const geometry::PointCloud &source,
+                    const geometry::PointCloud &target,
+                    const std::vector<CorrespondenceSet> &corres,
+                    const std::vector<Eigen::Matrix4d_u> &transformations,
+                    std::vector<uint8_t> &valid,
+                    bool require_pointcloud_alignment);
+
+    /// Returns the checkers in the order in which they currently run.
+    std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+    GetCheckers() const;
+
+private:
+    struct Entry {
+        const CorrespondenceChecker *checker;
+        double cost;
+        int64_t num_checked;
+        int64_t num_rejected;
+    };
+    std::vector<Entry> entries_;
+};
+
 }  // namespace registration
 }  // namespace open3d
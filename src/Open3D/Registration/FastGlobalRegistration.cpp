@@ -26,21 +26,60 @@
 
 #include "Open3D/Registration/FastGlobalRegistration.h"
 
-#include "Open3D/Geometry/KDTreeFlann.h"
+#include <algorithm>
+
+#include "Open3D/Geometry/KDTreeIndex.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Registration/Registration.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Timer.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
+/// Number of tuple constraint trials tested in parallel before checking
+/// whether enough tuples were found.
+constexpr int kTupleTrialsPerRound = 1 << 16;
+
+template <typename matrix_t>
+std::vector<int> SearchNearestFeatures(const geometry::KDTreeIndex &index,
+                                       const matrix_t &data,
+                                       const std::vector<int> *columns) {
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    if (columns == nullptr) {
+        index.SearchKNN(data, 1, indices, distance2);
+    } else {
+        matrix_t queries(data.rows(), columns->size());
+        utility::ParallelFor(0, int64_t(columns->size()), [&](int64_t k) {
+            queries.col(k) = data.col((*columns)[k]);
+        });
+        index.SearchKNN(queries, 1, indices, distance2);
+    }
+    return indices;
+}
+
+/// Returns the nearest neighbor in \p index of every feature of \p feature,
+/// or of the features listed in \p columns.
+std::vector<int> SearchNearestFeatures(
+        const geometry::KDTreeIndex &index,
+        const Feature &feature,
+        const std::vector<int> *columns = nullptr) {
+    if (feature.IsFloat()) {
+        return SearchNearestFeatures(index, feature.data_float_, columns);
+    }
+    return SearchNearestFeatures(index, feature.data_, columns);
+}
+
 std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
-        const std::vector<Feature>& features_vec,
+        const std::vector<const Feature*>& features_vec,
+        const std::vector<const geometry::KDTreeIndex*>& feature_index_vec,
         const FastGlobalRegistrationOption& option) {
     // STEP 0) Swap source and target if necessary
     int fi = 0, fj = 1;
@@ -55,125 +94,117 @@ std::vector<std::pair<int, int>> AdvancedMatching(
     }
 
     // STEP 1) Initial matching
+    // The nearest feature of fi is searched for every feature of fj, and the
+    // nearest feature of fj for every matched feature of fi, each in one
+    // batch.
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
-    std::vector<int> i_to_j(nPti, -1);
-    for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
-        }
-        corres_ji.push_back(std::pair<int, int>(i, j));
+    std::vector<int> j_to_i = SearchNearestFeatures(*feature_index_vec[fi],
+                                                    *features_vec[fj]);
+    std::vector<char> matched(nPti, 0);
+    for (int i : j_to_i) {
+        matched[i] = 1;
     }
+    std::vector<int> matched_i;
     for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
+        if (matched[i]) matched_i.push_back(i);
     }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
+    std::vector<int> matched_i_to_j = SearchNearestFeatures(
+            *feature_index_vec[fj], *features_vec[fi], &matched_i);
+    utility::LogDebug("points are remained : {:d}",
+                      (int)(matched_i.size() + j_to_i.size()));
 
     // STEP 2) CROSS CHECK
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
-    for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
+    for (size_t k = 0; k < matched_i.size(); k++) {
+        const int i = matched_i[k];
+        const int j = matched_i_to_j[k];
+        if (j >= 0 && j < nPtj && j_to_i[j] == i) {
+            corres_cross.push_back(std::pair<int, int>(i, j));
         }
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
+    // Trials are tested in parallel rounds. Accepted tuples are kept in trial
+    // order, so the first maximum_tuple_count_ of them are used as in a
+    // sequential search.
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
-    double scale = option.tuple_scale_;
-    int ncorr = static_cast<int>(corres_cross.size());
-    int number_of_trial = ncorr * 100;
+    const double scale = option.tuple_scale_;
+    const int ncorr = static_cast<int>(corres_cross.size());
+    const int number_of_trial = ncorr * 100;
+    const auto &points_i = point_cloud_vec[fi].points_;
+    const auto &points_j = point_cloud_vec[fj].points_;
 
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
-        }
-        if (cnt >= option.maximum_tuple_count_) break;
+    int cnt = 0, trial = 0;
+    while (trial < number_of_trial && cnt < option.maximum_tuple_count_) {
+        const int round_end =
+                (std::min)(number_of_trial, trial + kTupleTrialsPerRound);
+        std::vector<std::pair<int, int>> round_tuples = utility::ParallelReduce(
+                trial, round_end, std::vector<std::pair<int, int>>(),
+                [&](int64_t begin, int64_t end,
+                    std::vector<std::pair<int, int>> tuples) {
+                    for (int64_t t = begin; t < end; t++) {
+                        const auto &c0 = corres_cross[utility::UniformRandInt(
+                                0, ncorr - 1)];
+                        const auto &c1 = corres_cross[utility::UniformRandInt(
+                                0, ncorr - 1)];
+                        const auto &c2 = corres_cross[utility::UniformRandInt(
+                                0, ncorr - 1)];
+
+                        // collect 3 points from i-th fragment
+                        double li0 = (points_i[c0.first] - points_i[c1.first])
+                                             .norm();
+                        double li1 = (points_i[c1.first] - points_i[c2.first])
+                                             .norm();
+                        double li2 = (points_i[c2.first] - points_i[c0.first])
+                                             .norm();
+
+                        // collect 3 points from j-th fragment
+                        double lj0 =
+                                (points_j[c0.second] - points_j[c1.second])
+                                        .norm();
+                        double lj1 =
+                                (points_j[c1.second] - points_j[c2.second])
+                                        .norm();
+                        double lj2 =
+                                (points_j[c2.second] - points_j[c0.second])
+                                        .norm();
+
+                        // check tuple constraint
+                        if ((li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                            (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                            (li2 * scale < lj2) && (lj2 < li2 / scale)) {
+                            tuples.push_back(c0);
+                            tuples.push_back(c1);
+                            tuples.push_back(c2);
+                        }
+                    }
+                    return tuples;
+                },
+                [](std::vector<std::pair<int, int>> lhs,
+                   const std::vector<std::pair<int, int>> &rhs) {
+                    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+                    return lhs;
+                },
+                1024);
+        const int num_tuples =
+                (std::min)(int(round_tuples.size() / 3),
+                           option.maximum_tuple_count_ - cnt);
+        corres_tuple.insert(corres_tuple.end(), round_tuples.begin(),
+                            round_tuples.begin() + num_tuples * 3);
+        cnt += num_tuples;
+        trial = round_end;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
-                      number_of_trial, i);
+                      number_of_trial, trial);
 
     if (swapped) {
-        std::vector<std::pair<int, int>> temp;
-        for (size_t i = 0; i < corres_tuple.size(); i++)
-            temp.push_back(std::pair<int, int>(corres_tuple[i].second,
-                                               corres_tuple[i].first));
-        corres_tuple.clear();
-        corres_tuple = temp;
+        for (auto &c : corres_tuple) {
+            std::swap(c.first, c.second);
+        }
     }
     utility::LogDebug("\t[final] matches {:d}.", (int)corres_tuple.size());
     return corres_tuple;
@@ -234,7 +265,8 @@ Eigen::Matrix4d OptimizePairwiseRegistration(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
         const std::vector<std::pair<int, int>>& corres,
         double scale_start,
-        const FastGlobalRegistrationOption& option) {
+        const FastGlobalRegistrationOption& option,
+        RegistrationStatistics& statistics) {
     utility::LogDebug("Pairwise rigid pose optimization");
     double par = scale_start;
     int numIter = option.iteration_number_;
@@ -243,6 +275,8 @@ Eigen::Matrix4d OptimizePairwiseRegistration(
     geometry::PointCloud point_cloud_copy_j = point_cloud_vec[j];
 
     if (corres.size() < 10) return Eigen::Matrix4d::Identity();
+    statistics.num_iterations_ = numIter;
+    statistics.stop_reason_ = RegistrationStopReason::MaxIteration;
 
     std::vector<double> s(corres.size(), 1.0);
     Eigen::Matrix4d trans;
@@ -330,43 +364,115 @@ Eigen::Matrix4d GetTransformationOriginalScale(
     return transtemp;
 }
 
-}  // unnamed namespace
-
-namespace registration {
-RegistrationResult FastGlobalRegistration(
+RegistrationResult FastGlobalRegistrationWithIndex(
         const geometry::PointCloud& source,
         const geometry::PointCloud& target,
         const Feature& source_feature,
         const Feature& target_feature,
-        const FastGlobalRegistrationOption& option /* =
-        FastGlobalRegistrationOption()*/) {
-    std::vector<geometry::PointCloud> point_cloud_vec;
-    geometry::PointCloud source_orig = source;
-    geometry::PointCloud target_orig = target;
-    point_cloud_vec.push_back(source);
-    point_cloud_vec.push_back(target);
-
-    std::vector<Feature> features_vec;
-    features_vec.push_back(source_feature);
-    features_vec.push_back(target_feature);
+        const geometry::KDTreeIndex& source_index,
+        const geometry::KDTreeIndex& target_index,
+        const FastGlobalRegistrationOption& option) {
+    utility::Timer total_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
+    // Only the points are used, so the other attributes are not copied.
+    std::vector<geometry::PointCloud> point_cloud_vec(2);
+    point_cloud_vec[0].points_ = source.points_;
+    point_cloud_vec[1].points_ = target.points_;
 
     double scale_global, scale_start;
     std::vector<Eigen::Vector3d> pcd_mean_vec;
     std::tie(pcd_mean_vec, scale_global, scale_start) =
             NormalizePointCloud(point_cloud_vec, option);
     std::vector<std::pair<int, int>> corres;
-    corres = AdvancedMatching(point_cloud_vec, features_vec, option);
+    timer.Start();
+    corres = AdvancedMatching(point_cloud_vec,
+                              {&source_feature, &target_feature},
+                              {&source_index, &target_index}, option);
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
     Eigen::Matrix4d transformation;
-    transformation = OptimizePairwiseRegistration(point_cloud_vec, corres,
-                                                  scale_global, option);
+    timer.Start();
+    transformation = OptimizePairwiseRegistration(
+            point_cloud_vec, corres, scale_global, option, statistics);
+    timer.Stop();
+    statistics.solve_time_ += timer.GetDuration();
 
     // as the original code T * point_cloud_vec[1] is aligned with
     // point_cloud_vec[0] matrix inverse is applied here.
-    return EvaluateRegistration(
-            source_orig, target_orig, option.maximum_correspondence_distance_,
+    timer.Start();
+    RegistrationResult result = EvaluateRegistration(
+            source, target, option.maximum_correspondence_distance_,
             GetTransformationOriginalScale(transformation, pcd_mean_vec,
                                            scale_global)
                     .inverse());
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
+    return result;
+}
+
+void CheckFeatures(const geometry::PointCloud& cloud, const Feature& feature) {
+    if (feature.Num() != cloud.points_.size() || feature.Num() == 0) {
+        utility::LogError(
+                "[FastGlobalRegistration] A point cloud has {:d} points but "
+                "{:d} features.",
+                cloud.points_.size(), feature.Num());
+    }
+}
+
+}  // unnamed namespace
+
+namespace registration {
+RegistrationResult FastGlobalRegistration(
+        const geometry::PointCloud& source,
+        const geometry::PointCloud& target,
+        const Feature& source_feature,
+        const Feature& target_feature,
+        const FastGlobalRegistrationOption& option /* =
+        FastGlobalRegistrationOption()*/) {
+    CheckFeatures(source, source_feature);
+    CheckFeatures(target, target_feature);
+    geometry::KDTreeIndex source_index(source_feature);
+    geometry::KDTreeIndex target_index(target_feature);
+    return FastGlobalRegistrationWithIndex(source, target, source_feature,
+                                           target_feature, source_index,
+                                           target_index, option);
+}
+
+std::vector<RegistrationResult> FastGlobalRegistration(
+        const geometry::PointCloud& source,
+        const std::vector<std::shared_ptr<geometry::PointCloud>>& targets,
+        const Feature& source_feature,
+        const std::vector<std::shared_ptr<Feature>>& target_features,
+        const FastGlobalRegistrationOption& option /* =
+        FastGlobalRegistrationOption()*/) {
+    if (targets.size() != target_features.size()) {
+        utility::LogError(
+                "[FastGlobalRegistration] {:d} targets but {:d} target "
+                "features.",
+                targets.size(), target_features.size());
+    }
+    CheckFeatures(source, source_feature);
+    for (size_t k = 0; k < targets.size(); k++) {
+        if (!targets[k] || !target_features[k]) {
+            utility::LogError(
+                    "[FastGlobalRegistration] Target {:d} is missing.", k);
+        }
+        CheckFeatures(*targets[k], *target_features[k]);
+    }
+
+    geometry::KDTreeIndex source_index(source_feature);
+    std::vector<RegistrationResult> results(targets.size());
+    utility::ParallelFor(0, int64_t(targets.size()), [&](int64_t k) {
+        geometry::KDTreeIndex target_index(*target_features[k]);
+        results[k] = FastGlobalRegistrationWithIndex(
+                source, *targets[k], source_feature, *target_features[k],
+                source_index, target_index, option);
+    });
+    return results;
 }
 
 }  // namespace registration
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -96,6 +97,17 @@ public:
     int maximum_tuple_count_;
 };
 
+/// \brief Function for fast global registration based on feature matching.
+///
+/// Mutual nearest neighbors of the features are searched in batches of a
+/// single precision KDTreeIndex, and the tuple constraint is tested in
+/// parallel.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param source_feature Source point cloud feature.
+/// \param target_feature Target point cloud feature.
+/// \param option FGR options.
 RegistrationResult FastGlobalRegistration(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -104,5 +116,25 @@ RegistrationResult FastGlobalRegistration(
         const FastGlobalRegistrationOption &option =
                 FastGlobalRegistrationOption());
 
+/// \brief Function to register one source point cloud against many targets
+/// with fast global registration.
+///
+/// The KDTreeIndex of the source features is built once and shared by all
+/// targets, which are registered in parallel.
+///
+/// \param source The source point cloud.
+/// \param targets The target point clouds.
+/// \param source_feature Source point cloud feature.
+/// \param target_features Features of the target point clouds.
+/// \param option FGR options.
+/// \return The result of every target.
+std::vector<RegistrationResult> FastGlobalRegistration(
+        const geometry::PointCloud &source,
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &targets,
+        const Feature &source_feature,
+        const std::vector<std::shared_ptr<Feature>> &target_features,
+        const FastGlobalRegistrationOption &option =
+                FastGlobalRegistrationOption());
+
 }  // namespace registration
 }  // namespace open3d
@@ -27,139 +27,385 @@
 #include "Open3D/Registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeIndex.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
-Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
-                                    const Eigen::Vector3d &n1,
-                                    const Eigen::Vector3d &p2,
-                                    const Eigen::Vector3d &n2) {
-    Eigen::Vector4d result;
+template <typename scalar_t>
+using FeatureMatrix = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+// Computes the angular features of a pair of oriented points. Returns false if
+// they are undefined.
+inline bool ComputePairFeatures(const Eigen::Vector3d &p1,
+                                const Eigen::Vector3d &n1,
+                                const Eigen::Vector3d &p2,
+                                const Eigen::Vector3d &n2,
+                                double &theta,
+                                double &alpha,
+                                double &phi) {
     Eigen::Vector3d dp2p1 = p2 - p1;
-    result(3) = dp2p1.norm();
-    if (result(3) == 0.0) {
-        return Eigen::Vector4d::Zero();
-    }
-    auto n1_copy = n1;
-    auto n2_copy = n2;
-    double angle1 = n1_copy.dot(dp2p1) / result(3);
-    double angle2 = n2_copy.dot(dp2p1) / result(3);
-    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
-        n1_copy = n2;
-        n2_copy = n1;
-        dp2p1 *= -1.0;
-        result(2) = -angle2;
+    const double dist = dp2p1.norm();
+    if (dist == 0.0) {
+        return false;
+    }
+    const double angle1 = n1.dot(dp2p1) / dist;
+    const double angle2 = n2.dot(dp2p1) / dist;
+    // acos is decreasing, so acos(|angle1|) > acos(|angle2|) is the same as
+    // |angle1| < |angle2|.
+    const bool swap = std::abs(angle1) < std::abs(angle2);
+    const Eigen::Vector3d &u = swap ? n2 : n1;
+    const Eigen::Vector3d &n = swap ? n1 : n2;
+    if (swap) {
+        dp2p1 = -dp2p1;
+        phi = -angle2;
     } else {
-        result(2) = angle1;
+        phi = angle1;
     }
-    auto v = dp2p1.cross(n1_copy);
-    double v_norm = v.norm();
+    Eigen::Vector3d v = dp2p1.cross(u);
+    const double v_norm = v.norm();
     if (v_norm == 0.0) {
-        return Eigen::Vector4d::Zero();
+        return false;
     }
     v /= v_norm;
-    auto w = n1_copy.cross(v);
-    result(1) = v.dot(n2_copy);
-    result(0) = atan2(w.dot(n2_copy), n1_copy.dot(n2_copy));
-    return result;
+    alpha = v.dot(n);
+    theta = std::atan2(u.cross(v).dot(n), u.dot(n));
+    return true;
+}
+
+inline int HistogramBin(double x) {
+    return std::min(std::max(int(std::floor(x)), 0), 10);
+}
+
+// Computes the SPFH histogram of point i into \p hist. The first neighbor is
+// skipped as it is the point itself.
+template <typename scalar_t>
+void ComputeSPFHHistogram(const geometry::PointCloud &input,
+                          int i,
+                          const int *indices,
+                          size_t num_neighbors,
+                          scalar_t *hist) {
+    if (num_neighbors <= 1) {
+        // only compute SPFH feature when a point has neighbors
+        return;
+    }
+    const auto &point = input.points_[i];
+    const auto &normal = input.normals_[i];
+    // Accumulate in a local histogram rather than in the strided feature
+    // matrix.
+    double sum[33] = {0.0};
+    const double hist_incr = 100.0 / (double)(num_neighbors - 1);
+    for (size_t k = 1; k < num_neighbors; k++) {
+        double theta = 0.0, alpha = 0.0, phi = 0.0;
+        if (!ComputePairFeatures(point, normal, input.points_[indices[k]],
+                                 input.normals_[indices[k]], theta, alpha,
+                                 phi)) {
+            // undefined pair features are binned as zero
+            theta = alpha = phi = 0.0;
+        }
+        sum[HistogramBin(11.0 * (theta + M_PI) / (2.0 * M_PI))] += hist_incr;
+        sum[11 + HistogramBin(5.5 * (alpha + 1.0))] += hist_incr;
+        sum[22 + HistogramBin(5.5 * (phi + 1.0))] += hist_incr;
+    }
+    for (int j = 0; j < 33; j++) {
+        hist[j] = scalar_t(sum[j]);
+    }
 }
 
-std::shared_ptr<Feature> ComputeSPFHFeature(
+// Computes the FPFH histogram of a point into \p hist, weighted from the SPFH
+// histograms of its neighbors. The SPFH of point i is column column_of[i] of
+// \p spfh, or column i if \p column_of is null.
+template <typename scalar_t, typename dist_t>
+void ComputeFPFHHistogram(const FeatureMatrix<scalar_t> &spfh,
+                          const int *column_of,
+                          const int *indices,
+                          const dist_t *distance2,
+                          size_t num_neighbors,
+                          int self_column,
+                          scalar_t *hist) {
+    if (num_neighbors <= 1) {
+        return;
+    }
+    double sum[3] = {0.0, 0.0, 0.0};
+    double fpfh[33] = {0.0};
+    for (size_t k = 1; k < num_neighbors; k++) {
+        // skip the point itself
+        double dist = distance2[k];
+        if (dist == 0.0) continue;
+        const int column = column_of ? column_of[indices[k]] : indices[k];
+        const scalar_t *neighbor = spfh.data() + int64_t(column) * 33;
+        const double inv_dist = 1.0 / dist;
+        for (int j = 0; j < 33; j++) {
+            fpfh[j] += neighbor[j] * inv_dist;
+        }
+    }
+    for (int j = 0; j < 33; j++) {
+        sum[j / 11] += fpfh[j];
+    }
+    for (int j = 0; j < 3; j++)
+        if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
+    const scalar_t *self = spfh.data() + int64_t(self_column) * 33;
+    for (int j = 0; j < 33; j++) {
+        // The commented line is the fpfh function in the paper.
+        // But according to PCL implementation, it is skipped.
+        // Our initial test shows that the full fpfh function in the
+        // paper seems to be better than PCL implementation. Further
+        // test required.
+        hist[j] = scalar_t(fpfh[j] * sum[j / 11] + self[j]);
+    }
+}
+
+// Computes the FPFH of the points of \p fpfh_graph into \p feature.
+//
+// Point c of \p spfh_graph is point \p spfh_points[c] of \p input, point c of
+// \p fpfh_graph is point \p fpfh_points[c]. Null point lists stand for all
+// points of \p input, in which case the graphs are the same.
+template <typename scalar_t>
+void ComputeFPFHFeature(const geometry::PointCloud &input,
+                        const std::vector<int> *spfh_points,
+                        const geometry::NeighborGraph &spfh_graph,
+                        const std::vector<size_t> *fpfh_points,
+                        const geometry::NeighborGraph &fpfh_graph,
+                        FeatureMatrix<scalar_t> &feature) {
+    const int64_t num_spfh = int64_t(spfh_graph.NumPoints());
+    FeatureMatrix<scalar_t> spfh = FeatureMatrix<scalar_t>::Zero(33, num_spfh);
+    utility::ParallelFor(0, num_spfh, [&](int64_t c) {
+        const int i = spfh_points ? (*spfh_points)[c] : int(c);
+        const int64_t offset = spfh_graph.offsets_[c];
+        ComputeSPFHHistogram(input, i, spfh_graph.indices_.data() + offset,
+                             size_t(spfh_graph.NumNeighbors(c)),
+                             spfh.data() + c * 33);
+    });
+
+    std::vector<int> column_of;
+    if (spfh_points) {
+        column_of.assign(input.points_.size(), -1);
+        for (int64_t c = 0; c < num_spfh; c++) {
+            column_of[(*spfh_points)[c]] = int(c);
+        }
+    }
+    const int64_t num_fpfh = int64_t(fpfh_graph.NumPoints());
+    utility::ParallelFor(0, num_fpfh, [&](int64_t c) {
+        const int i = fpfh_points ? int((*fpfh_points)[c]) : int(c);
+        const int64_t offset = fpfh_graph.offsets_[c];
+        ComputeFPFHHistogram(spfh, spfh_points ? column_of.data() : nullptr,
+                             fpfh_graph.indices_.data() + offset,
+                             fpfh_graph.distance2_.data() + offset,
+                             size_t(fpfh_graph.NumNeighbors(c)),
+                             spfh_points ? column_of[i] : i,
+                             feature.data() + c * 33);
+    });
+}
+
+// Same as above, but returns the features in the precision requested by
+// \p use_float.
+std::shared_ptr<Feature> ComputeFPFHFeatureFromGraph(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const std::vector<int> *spfh_points,
+        const geometry::NeighborGraph &spfh_graph,
+        const std::vector<size_t> *fpfh_points,
+        const geometry::NeighborGraph &fpfh_graph,
+        bool use_float) {
     auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
-            }
-        }
+    feature->Resize(33, int(fpfh_graph.NumPoints()), use_float);
+    if (use_float) {
+        ComputeFPFHFeature(input, spfh_points, spfh_graph, fpfh_points,
+                           fpfh_graph, feature->data_float_);
+    } else {
+        ComputeFPFHFeature(input, spfh_points, spfh_graph, fpfh_points,
+                           fpfh_graph, feature->data_);
     }
     return feature;
 }
 
+int SearchFeatureKNN(const geometry::KDTreeIndex &index,
+                     const Feature &queries,
+                     int knn,
+                     double eps,
+                     std::vector<int> &indices,
+                     std::vector<float> &distance2) {
+    if (queries.IsFloat()) {
+        return index.SearchKNN(queries.data_float_, knn, indices, distance2,
+                               eps);
+    }
+    return index.SearchKNN(queries.data_, knn, indices, distance2, eps);
+}
+
+void CheckNormals(const geometry::PointCloud &input) {
+    if (!input.HasNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+}
+
 }  // unnamed namespace
 
 namespace registration {
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
-                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
-    if (!input.HasNormals()) {
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/,
+        bool use_float /* = false */) {
+    CheckNormals(input);
+    auto graph =
+            geometry::NeighborGraph::CreateFromPointCloud(input, search_param);
+    return ComputeFPFHFeatureFromGraph(input, nullptr, *graph, nullptr, *graph,
+                                       use_float);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborGraph &graph,
+        bool use_float /* = false */) {
+    CheckNormals(input);
+    if (graph.NumPoints() != input.points_.size()) {
         utility::LogError(
-                "[ComputeFPFHFeature] Failed because input point cloud has no "
-                "normal.");
+                "[ComputeFPFHFeature] The neighbor graph has {} points, but "
+                "the point cloud has {}.",
+                graph.NumPoints(), input.points_.size());
+    }
+    return ComputeFPFHFeatureFromGraph(input, nullptr, graph, nullptr, graph,
+                                       use_float);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const std::vector<size_t> &indices,
+        bool use_float /* = false */) {
+    CheckNormals(input);
+    std::vector<Eigen::Vector3d> keypoints(indices.size());
+    for (size_t c = 0; c < indices.size(); c++) {
+        if (indices[c] >= input.points_.size()) {
+            utility::LogError(
+                    "[ComputeFPFHFeature] Keypoint index {} is out of range "
+                    "for a point cloud of {} points.",
+                    indices[c], input.points_.size());
+        }
+        keypoints[c] = input.points_[indices[c]];
+    }
+    if (indices.empty()) {
+        auto feature = std::make_shared<Feature>();
+        feature->Resize(33, 0, use_float);
+        return feature;
+    }
+
+    // The SPFH is needed at the keypoints and at all their neighbors.
+    geometry::KDTreeIndex index(input);
+    auto fpfh_graph = geometry::NeighborGraph::CreateFromQueries(
+            index, keypoints, search_param);
+    std::vector<char> is_spfh_point(input.points_.size(), 0);
+    for (size_t i : indices) {
+        is_spfh_point[i] = 1;
+    }
+    for (int i : fpfh_graph->indices_) {
+        is_spfh_point[i] = 1;
+    }
+    std::vector<int> spfh_points;
+    std::vector<Eigen::Vector3d> spfh_queries;
+    for (size_t i = 0; i < is_spfh_point.size(); i++) {
+        if (is_spfh_point[i]) {
+            spfh_points.push_back(int(i));
+            spfh_queries.push_back(input.points_[i]);
+        }
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
+    auto spfh_graph = geometry::NeighborGraph::CreateFromQueries(
+            index, spfh_queries, search_param);
+    return ComputeFPFHFeatureFromGraph(input, &spfh_points, *spfh_graph,
+                                       &indices, *fpfh_graph, use_float);
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_feature,
+                                              const Feature &target_feature,
+                                              bool mutual_filter /* = false */,
+                                              double max_ratio /* = 1.0 */,
+                                              double eps /* = 0.0 */) {
+    if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+        return CorrespondenceSet();
+    }
+    geometry::KDTreeIndex source_index;
+    if (mutual_filter) {
+        source_index.SetFeature(source_feature);
+    }
+    geometry::KDTreeIndex target_index(target_feature);
+    return CorrespondencesFromFeatures(source_feature, target_feature,
+                                       source_index, target_index,
+                                       mutual_filter, max_ratio, eps);
+}
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        const geometry::KDTreeIndex &source_index,
+        const geometry::KDTreeIndex &target_index,
+        bool mutual_filter /* = false */,
+        double max_ratio /* = 1.0 */,
+        double eps /* = 0.0 */) {
+    CorrespondenceSet corres;
+    const int num_source = int(source_feature.Num());
+    if (num_source == 0 || target_feature.Num() == 0) {
+        return corres;
+    }
+    if (source_feature.Dimension() != target_feature.Dimension()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dimensions {:d} and "
+                "{:d} do not match.",
+                source_feature.Dimension(), target_feature.Dimension());
+    }
+    if (!(max_ratio > 0.0 && max_ratio <= 1.0)) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] max_ratio must be in (0, 1].");
+    }
+    if (eps < 0.0) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] eps must be non-negative.");
+    }
+
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    const int knn = SearchFeatureKNN(target_index, source_feature,
+                                     max_ratio < 1.0 ? 2 : 1, eps, indices,
+                                     distance2);
+    const float max_ratio2 = float(max_ratio * max_ratio);
+    std::vector<int> source_to_target(num_source);
+    utility::ParallelFor(
+            0, num_source,
+            [&](int64_t i) {
+                const int64_t first = i * knn;
+                if (knn == 2 &&
+                    distance2[first] > max_ratio2 * distance2[first + 1]) {
+                    source_to_target[i] = -1;
+                } else {
+                    source_to_target[i] = indices[first];
                 }
-            }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
-            }
+            },
+            4096);
+
+    std::vector<int> target_to_source;
+    if (mutual_filter) {
+        SearchFeatureKNN(source_index, target_feature, 1, eps,
+                         target_to_source, distance2);
+    }
+
+    corres.reserve(num_source);
+    for (int i = 0; i < num_source; i++) {
+        const int j = source_to_target[i];
+        if (j >= 0 && (!mutual_filter || target_to_source[j] == i)) {
+            corres.push_back(Eigen::Vector2i(i, j));
         }
     }
-    return feature;
+    return corres;
 }
 
 }  // namespace registration
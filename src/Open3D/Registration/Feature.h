@@ -31,10 +31,13 @@
 #include <vector>
 
 #include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Registration/TransformationEstimation.h"
 
 namespace open3d {
 
 namespace geometry {
+class KDTreeIndex;
+class NeighborGraph;
 class PointCloud;
 }
 
@@ -43,34 +46,141 @@ namespace registration {
 /// \class Feature
 ///
 /// \brief Class to store featrues for registration.
+///
+/// Features are stored in double precision in data_ by default. For large
+/// point clouds they can instead be stored in single precision in
+/// data_float_, which halves their memory footprint. Only one of the two
+/// buffers is in use at a time, see IsFloat().
 class Feature {
 public:
     /// Resize feature data buffer to `dim x n`.
     ///
     /// \param dim Feature dimension per point.
     /// \param n Number of points.
-    void Resize(int dim, int n) {
-        data_.resize(dim, n);
-        data_.setZero();
+    /// \param use_float If true, the features are stored in data_float_ and
+    /// data_ is released, otherwise the other way around.
+    void Resize(int dim, int n, bool use_float = false) {
+        if (use_float) {
+            data_float_.resize(dim, n);
+            data_float_.setZero();
+            data_.resize(0, 0);
+        } else {
+            data_.resize(dim, n);
+            data_.setZero();
+            data_float_.resize(0, 0);
+        }
     }
+    /// Returns true if the features are stored in single precision.
+    bool IsFloat() const { return data_float_.rows() > 0; }
     /// Returns feature dimensions per point.
-    size_t Dimension() const { return data_.rows(); }
+    size_t Dimension() const {
+        return IsFloat() ? data_float_.rows() : data_.rows();
+    }
     /// Returns number of points.
-    size_t Num() const { return data_.cols(); }
+    size_t Num() const { return IsFloat() ? data_float_.cols() : data_.cols(); }
+    /// Moves the features to single precision storage.
+    void ConvertToFloat() {
+        if (!IsFloat()) {
+            data_float_ = data_.cast<float>();
+            data_.resize(0, 0);
+        }
+    }
+    /// Moves the features to double precision storage.
+    void ConvertToDouble() {
+        if (IsFloat()) {
+            data_ = data_float_.cast<double>();
+            data_float_.resize(0, 0);
+        }
+    }
 
 public:
     /// Data buffer storing features.
     Eigen::MatrixXd data_;
+    /// Single precision data buffer storing features, see IsFloat().
+    Eigen::MatrixXf data_float_;
 };
 
 /// Function to compute FPFH feature for a point cloud.
 ///
+/// The neighborhoods of all points are searched once in a batch, see
+/// geometry::NeighborGraph::CreateFromPointCloud.
+///
 /// \param input The Input point cloud.
 /// \param search_param KDTree KNN search parameter.
+/// \param use_float If true, the features are stored in single precision.
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam &search_param =
-                geometry::KDTreeSearchParamKNN());
+                geometry::KDTreeSearchParamKNN(),
+        bool use_float = false);
+
+/// Function to compute FPFH feature for a point cloud from a precomputed
+/// neighbor graph.
+///
+/// \param input The Input point cloud.
+/// \param graph Neighbor graph of the input point cloud.
+/// \param use_float If true, the features are stored in single precision.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborGraph &graph,
+        bool use_float = false);
+
+/// \brief Function to compute FPFH feature for a subset of the points of a
+/// point cloud, e.g. keypoints.
+///
+/// Only the keypoints and their neighbors are processed, so the cost scales
+/// with the number of keypoints rather than with the size of the point
+/// cloud. The features are identical to the corresponding columns of the
+/// features of the whole point cloud.
+///
+/// \param input The Input point cloud.
+/// \param search_param KDTree KNN search parameter.
+/// \param indices Indices of the keypoints in \p input. Column i of the
+/// result is the feature of point indices[i].
+/// \param use_float If true, the features are stored in single precision.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param,
+        const std::vector<size_t> &indices,
+        bool use_float = false);
+
+/// \brief Function to find correspondences between two sets of features.
+///
+/// The nearest neighbor in \p target_feature of every source feature is
+/// searched in one parallel batch of a single precision KDTreeIndex.
+/// Correspondences are sorted by source index, with at most one per source
+/// point.
+///
+/// \param source_feature Features of the source point cloud.
+/// \param target_feature Features of the target point cloud.
+/// \param mutual_filter If true, only keeps pairs whose source feature is
+/// also the nearest neighbor of the target feature among the source features.
+/// \param max_ratio Ratio test threshold in (0, 1]. A pair is only kept if the
+/// distance to the nearest target feature is at most \p max_ratio times the
+/// distance to the second nearest one. 1 disables the test.
+/// \param eps Approximation factor of the feature search, see
+/// geometry::KDTreeSearchParam::eps_. Exact search of high dimensional
+/// features rarely pays off, and a small eps prunes most of the tree.
+CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_feature,
+                                              const Feature &target_feature,
+                                              bool mutual_filter = false,
+                                              double max_ratio = 1.0,
+                                              double eps = 0.0);
+
+/// \brief Same as above, but searches prebuilt KDTreeIndex objects of the
+/// features, e.g. when every feature set is matched against many others.
+///
+/// \param source_index Index of \p source_feature, only searched with
+/// \p mutual_filter.
+/// \param target_index Index of \p target_feature.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_feature,
+        const Feature &target_feature,
+        const geometry::KDTreeIndex &source_index,
+        const geometry::KDTreeIndex &target_index,
+        bool mutual_filter = false,
+        double max_ratio = 1.0,
+        double eps = 0.0);
 
 }  // namespace registration
 }  // namespace open3d
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GeneralizedICP.h"
+
+#include <Eigen/Dense>
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+
+namespace {
+using namespace registration;
+
+// Sums of the Generalized ICP normal equations.
+struct GeneralizedICPSums {
+    Eigen::Matrix<double, 6, 6, Eigen::DontAlign> JTJ =
+            Eigen::Matrix6d::Zero();
+    Eigen::Matrix<double, 6, 1, Eigen::DontAlign> JTr =
+            Eigen::Vector6d::Zero();
+};
+
+// Copies the point cloud and prepares its covariances for Generalized ICP,
+// see RegistrationGeneralizedICP.
+std::shared_ptr<geometry::PointCloud> InitializePointCloudForGeneralizedICP(
+        const geometry::PointCloud &pcd, double epsilon) {
+    auto output = std::make_shared<geometry::PointCloud>(pcd);
+    const int64_t num_points = int64_t(output->points_.size());
+    if (!output->HasCovariances() && output->HasNormals()) {
+        utility::LogDebug("[GeneralizedICP] Covariances from normals.");
+        output->covariances_.resize(num_points);
+        utility::ParallelFor(0, num_points, [&](int64_t i) {
+            const Eigen::Vector3d n = output->normals_[i].normalized();
+            output->covariances_[i] = Eigen::Matrix3d::Identity() -
+                                      (1.0 - epsilon) * n * n.transpose();
+        });
+        return output;
+    }
+    if (!output->HasCovariances()) {
+        utility::LogDebug("[GeneralizedICP] Covariances from points.");
+        auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+                *output, geometry::KDTreeSearchParamKNN(20));
+        output->EstimateCovariances(*graph);
+    }
+    // Keep the directions of the covariances, but replace their eigenvalues
+    // by (epsilon, 1, 1), so every point is a small planar patch.
+    const Eigen::Vector3d eigenvalues(epsilon, 1.0, 1.0);
+    utility::ParallelFor(0, num_points, [&](int64_t i) {
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(
+                output->covariances_[i]);
+        const Eigen::Matrix3d &V = solver.eigenvectors();
+        output->covariances_[i] = V * eigenvalues.asDiagonal() * V.transpose();
+    });
+    return output;
+}
+
+}  // unnamed namespace
+
+namespace registration {
+
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasCovariances() ||
+        !target.HasCovariances()) {
+        return 0.0;
+    }
+    double err = 0.0;
+    for (const auto &c : corres) {
+        const Eigen::Vector3d r = source.points_[c[0]] - target.points_[c[1]];
+        const Eigen::Matrix3d W =
+                (source.covariances_[c[0]] + target.covariances_[c[1]])
+                        .inverse();
+        err += r.dot(W * r);
+    }
+    return std::sqrt(err / (double)corres.size());
+}
+
+Eigen::Matrix4d
+TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasCovariances() ||
+        !target.HasCovariances()) {
+        return Eigen::Matrix4d::Identity();
+    }
+
+    // The residual r = vs - vt is weighted by W = (Cs + Ct)^-1. Its Jacobian
+    // with respect to (rotation, translation) is J = [-[vs]x, I].
+    const GeneralizedICPSums sums = utility::ParallelReduce(
+            0, int64_t(corres.size()), GeneralizedICPSums(),
+            [&](int64_t begin, int64_t end, GeneralizedICPSums partial) {
+                Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+                Eigen::Matrix<double, 3, 6> J;
+                J.block<3, 3>(0, 3) = Eigen::Matrix3d::Identity();
+                for (int64_t i = begin; i < end; i++) {
+                    const int cs = corres[i][0];
+                    const int ct = corres[i][1];
+                    const Eigen::Vector3d &vs = source.points_[cs];
+                    const Eigen::Vector3d r = vs - target.points_[ct];
+                    const Eigen::Matrix3d W =
+                            (source.covariances_[cs] + target.covariances_[ct])
+                                    .inverse();
+                    J.block<3, 3>(0, 0) << 0.0, vs(2), -vs(1), -vs(2), 0.0,
+                            vs(0), vs(1), -vs(0), 0.0;
+                    const Eigen::Matrix<double, 6, 3> JTW =
+                            J.transpose() * W;
+                    const double w =
+                            kernel_->Weight(std::sqrt(r.dot(W * r)));
+                    JTJ.noalias() += w * JTW * J;
+                    JTr.noalias() += w * JTW * r;
+                }
+                partial.JTJ += JTJ;
+                partial.JTr += JTr;
+                return partial;
+            },
+            [](GeneralizedICPSums lhs, const GeneralizedICPSums &rhs) {
+                lhs.JTJ += rhs.JTJ;
+                lhs.JTr += rhs.JTr;
+                return lhs;
+            });
+
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    std::tie(is_success, extrinsic) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(sums.JTJ,
+                                                                 sums.JTr);
+
+    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+}
+
+RegistrationResult RegistrationGeneralizedICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimationForGeneralizedICP
+                &estimation /* = TransformationEstimationForGeneralizedICP()*/,
+        const ICPConvergenceCriteria &criteria
+        /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICP(
+            *InitializePointCloudForGeneralizedICP(source, estimation.epsilon_),
+            *InitializePointCloudForGeneralizedICP(target, estimation.epsilon_),
+            max_correspondence_distance, init, estimation, criteria);
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/RobustKernel.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+class RegistrationResult;
+
+/// \class TransformationEstimationForGeneralizedICP
+///
+/// Class to estimate a transformation for Generalized ICP, which minimizes
+/// the distance between corresponding points under the sum of their
+/// covariances. This is implementation of following paper
+/// A. Segal, D. Haehnel, S. Thrun,
+/// Generalized-ICP, RSS 2009.
+///
+/// Both point clouds must have covariances. RegistrationGeneralizedICP
+/// prepares them.
+class TransformationEstimationForGeneralizedICP
+    : public TransformationEstimation {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param epsilon Variance of the points along their normal, relative to
+    /// the variance in the tangent plane.
+    /// \param kernel Robust kernel that weights the Mahalanobis distances of
+    /// the correspondences.
+    explicit TransformationEstimationForGeneralizedICP(
+            double epsilon = 1e-3,
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>())
+        : epsilon_(epsilon), kernel_(std::move(kernel)) {}
+    ~TransformationEstimationForGeneralizedICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres) const override;
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const override;
+
+public:
+    /// Variance of the points along their normal, relative to the variance in
+    /// the tangent plane.
+    double epsilon_ = 1e-3;
+    /// Robust kernel that weights the Mahalanobis distances of the
+    /// correspondences.
+    std::shared_ptr<RobustKernel> kernel_;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::GeneralizedICP;
+};
+
+/// \brief Function for Generalized ICP registration.
+///
+/// The covariances of both point clouds are prepared once. Existing
+/// covariances are used, otherwise they are built from the normals, otherwise
+/// estimated from the 20 nearest neighbors. They are then regularized to the
+/// plane-like eigenvalues (epsilon, 1, 1).
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationGeneralizedICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimationForGeneralizedICP &estimation =
+                TransformationEstimationForGeneralizedICP(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+}  // namespace registration
+}  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <limits>
 #include <tuple>
 #include <vector>
 
@@ -36,6 +38,8 @@
 #include "Open3D/Registration/PoseGraph.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/SparseLinearSolver.h"
 #include "Open3D/Utility/Timer.h"
 
 namespace open3d {
@@ -203,47 +207,276 @@ Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 /// https ://github.com/RainerKuemmerle/g2o/blob/master/doc/g2o.pdf
 /// Eq (20) and Eq (21). (There is a typo in the equation though. B should be J)
 ///
-/// This function focuses the case that every edge has two nodes (not hyper
-/// graph) so we have two Jacobian matrices from one constraint.
-std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
-
+/// This class focuses the case that every edge has two nodes (not hyper
+/// graph) so we have two Jacobian matrices from one constraint. H only has
+/// nonzero 6x6 blocks on the diagonal and for pairs of nodes connected by an
+/// edge, so it is stored as a sparse matrix. Its sparsity pattern only depends
+/// on the edges of the pose graph, so it is built once, and the symbolic
+/// analysis of the Cholesky factorization is reused by all iterations.
+///
+/// Nodes flagged in \p fixed keep their pose: their rows and columns of H
+/// are replaced by the identity and their entries of b by zero, so that
+/// their increment is zero.
+class PoseGraphLinearSystem {
+public:
+    explicit PoseGraphLinearSystem(
+            const PoseGraph &pose_graph,
+            const std::vector<bool> &fixed = std::vector<bool>());
+
+public:
+    /// Computes H and b from the misalignment vectors \p zeta.
+    void Compute(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta);
+    /// Solves (H + lambda * I) delta = b. Falls back to block Jacobi
+    /// preconditioned conjugate gradients if the Cholesky factorization fails.
+    std::tuple<bool, Eigen::VectorXd> Solve(double lambda = 0.0);
+
+public:
+    Eigen::SparseMatrix<double> H_;
+    Eigen::VectorXd b_;
+
+private:
+    /// Adds \p block to the block of H_ in the column of node \p col at
+    /// position \p pos of its neighbor list.
+    void AddBlock(int col, int pos, const Eigen::Matrix6d &block);
+    /// Position of node \p node in the neighbor list of node \p col.
+    int NeighborPosition(int col, int node) const;
+    bool SolvePCG(const Eigen::SparseMatrix<double> &A, Eigen::VectorXd &x);
+    bool IsFixed(int node) const { return !fixed_.empty() && fixed_[node]; }
+
+private:
+    std::vector<bool> fixed_;
+    /// Sorted neighbor nodes of every node, including the node itself, in
+    /// compressed sparse row layout. They are the row blocks of the column
+    /// block of the node in H_.
+    std::vector<int> neighbor_offsets_;
+    std::vector<int> neighbors_;
+    /// Edges incident to every node, in compressed sparse row layout.
+    std::vector<int> edge_offsets_;
+    std::vector<int> edges_;
+    /// Jacobians of every edge, see GetJacobian().
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> Js_;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> Jt_;
+    Eigen::SparseMatrix<double> H_LM_;
+    utility::SparseLinearSolverPSD solver_;
+};
+
+PoseGraphLinearSystem::PoseGraphLinearSystem(
+        const PoseGraph &pose_graph,
+        const std::vector<bool> &fixed /* = std::vector<bool>() */)
+    : fixed_(fixed) {
+    const int n_nodes = (int)pose_graph.nodes_.size();
+    const int n_edges = (int)pose_graph.edges_.size();
+    std::vector<std::vector<int>> neighbors(n_nodes);
+    std::vector<std::vector<int>> edges(n_nodes);
+    for (int i = 0; i < n_nodes; i++) {
+        neighbors[i].push_back(i);
+    }
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        const int s_id = t.source_node_id_;
+        const int t_id = t.target_node_id_;
+        neighbors[s_id].push_back(t_id);
+        neighbors[t_id].push_back(s_id);
+        edges[s_id].push_back(iter_edge);
+        if (t_id != s_id) {
+            edges[t_id].push_back(iter_edge);
+        }
+    }
+
+    neighbor_offsets_.assign(1, 0);
+    edge_offsets_.assign(1, 0);
+    Eigen::VectorXi nnz(n_nodes * 6);
+    for (int i = 0; i < n_nodes; i++) {
+        std::sort(neighbors[i].begin(), neighbors[i].end());
+        neighbors[i].erase(
+                std::unique(neighbors[i].begin(), neighbors[i].end()),
+                neighbors[i].end());
+        neighbors_.insert(neighbors_.end(), neighbors[i].begin(),
+                          neighbors[i].end());
+        neighbor_offsets_.push_back((int)neighbors_.size());
+        edges_.insert(edges_.end(), edges[i].begin(), edges[i].end());
+        edge_offsets_.push_back((int)edges_.size());
+        nnz.segment<6>(i * 6).setConstant((int)neighbors[i].size() * 6);
+    }
+
+    H_.resize(n_nodes * 6, n_nodes * 6);
+    H_.reserve(nnz);
+    for (int j = 0; j < n_nodes; j++) {
+        for (int c = 0; c < 6; c++) {
+            for (int k = neighbor_offsets_[j]; k < neighbor_offsets_[j + 1];
+                 k++) {
+                for (int r = 0; r < 6; r++) {
+                    H_.insert(neighbors_[k] * 6 + r, j * 6 + c) = 0.0;
+                }
+            }
+        }
+    }
+    H_.makeCompressed();
+    b_.setZero(n_nodes * 6);
+    Js_.resize(n_edges);
+    Jt_.resize(n_edges);
+}
+
+int PoseGraphLinearSystem::NeighborPosition(int col, int node) const {
+    const int *begin = neighbors_.data() + neighbor_offsets_[col];
+    const int *end = neighbors_.data() + neighbor_offsets_[col + 1];
+    return int(std::lower_bound(begin, end, node) - begin);
+}
+
+void PoseGraphLinearSystem::AddBlock(int col,
+                                     int pos,
+                                     const Eigen::Matrix6d &block) {
+    double *values = H_.valuePtr();
+    const int *outer = H_.outerIndexPtr();
+    for (int c = 0; c < 6; c++) {
+        double *dst = values + outer[col * 6 + c] + pos * 6;
+        for (int r = 0; r < 6; r++) {
+            dst[r] += block(r, c);
+        }
+    }
+}
 
+void PoseGraphLinearSystem::Compute(const PoseGraph &pose_graph,
+                                    const Eigen::VectorXd &zeta) {
+    const int n_nodes = (int)pose_graph.nodes_.size();
+    const int n_edges = (int)pose_graph.edges_.size();
+    utility::ParallelFor(0, n_edges, [&](int64_t iter_edge) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        std::tie(X_inv, Ts, Tt_inv) =
+                GetRelativePoses(pose_graph, int(iter_edge));
+        std::tie(Js_[iter_edge], Jt_[iter_edge]) =
+                GetJacobian(X_inv, Ts, Tt_inv);
+    });
+
+    // Every node only writes its own column block of H and its own block of
+    // b, so the nodes are assembled in parallel without synchronization.
+    std::fill(H_.valuePtr(), H_.valuePtr() + H_.nonZeros(), 0.0);
+    utility::ParallelFor(0, n_nodes, [&](int64_t node) {
+        const int j = int(node);
+        Eigen::Vector6d b_j = Eigen::Vector6d::Zero();
+        if (IsFixed(j)) {
+            AddBlock(j, NeighborPosition(j, j), Eigen::Matrix6d::Identity());
+            b_.block<6, 1>(j * 6, 0) = b_j;
+            return;
+        }
+        for (int k = edge_offsets_[j]; k < edge_offsets_[j + 1]; k++) {
+            const int iter_edge = edges_[k];
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            const Eigen::Matrix6d &Js = Js_[iter_edge];
+            const Eigen::Matrix6d &Jt = Jt_[iter_edge];
+            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+            Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+            Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+            double line_process_iter = t.confidence_;
+
+            const int pos_i = NeighborPosition(j, t.source_node_id_);
+            const int pos_j = NeighborPosition(j, t.target_node_id_);
+            const bool fixed_i = IsFixed(t.source_node_id_);
+            const bool fixed_j = IsFixed(t.target_node_id_);
+            if (t.source_node_id_ == j) {
+                AddBlock(j, pos_i, line_process_iter * JsT_Info * Js);
+                if (!fixed_j) {
+                    AddBlock(j, pos_j, line_process_iter * JtT_Info * Js);
+                }
+                b_j.noalias() -= line_process_iter * Js.transpose() * eT_Info;
+            }
+            if (t.target_node_id_ == j) {
+                if (!fixed_i) {
+                    AddBlock(j, pos_i, line_process_iter * JsT_Info * Jt);
+                }
+                AddBlock(j, pos_j, line_process_iter * JtT_Info * Jt);
+                b_j.noalias() -= line_process_iter * Jt.transpose() * eT_Info;
+            }
+        }
+        b_.block<6, 1>(j * 6, 0) = b_j;
+    });
+}
+
+std::tuple<bool, Eigen::VectorXd> PoseGraphLinearSystem::Solve(
+        double lambda /* = 0.0 */) {
+    const Eigen::SparseMatrix<double> *A = &H_;
+    if (lambda != 0.0) {
+        H_LM_ = H_;
+        const int *outer = H_LM_.outerIndexPtr();
+        double *values = H_LM_.valuePtr();
+        for (int j = 0; j < int(neighbor_offsets_.size()) - 1; j++) {
+            const int pos = NeighborPosition(j, j);
+            for (int c = 0; c < 6; c++) {
+                values[outer[j * 6 + c] + pos * 6 + c] += lambda;
+            }
+        }
+        A = &H_LM_;
+    }
+
+    Eigen::VectorXd delta = Eigen::VectorXd::Zero(b_.rows());
+    if (solver_.Compute(*A)) {
+        bool success;
+        std::tie(success, delta) = solver_.Solve(b_);
+        if (success) {
+            return std::make_tuple(true, std::move(delta));
+        }
+    }
+    utility::LogWarning(
+            "Cholesky factorization failed, switched to conjugate gradients");
+    const bool success = SolvePCG(*A, delta);
+    return std::make_tuple(success, std::move(delta));
+}
 
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
-    }
-    return std::make_tuple(std::move(H), std::move(b));
+bool PoseGraphLinearSystem::SolvePCG(const Eigen::SparseMatrix<double> &A,
+                                     Eigen::VectorXd &x) {
+    const int n_nodes = int(neighbor_offsets_.size()) - 1;
+    // Pseudo-inverses of the diagonal blocks, which stay defined for nodes
+    // that are not constrained.
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> preconditioner(
+            n_nodes);
+    utility::ParallelFor(0, n_nodes, [&](int64_t j) {
+        const int pos = NeighborPosition(int(j), int(j));
+        Eigen::Matrix6d block;
+        for (int c = 0; c < 6; c++) {
+            const double *src =
+                    A.valuePtr() + A.outerIndexPtr()[j * 6 + c] + pos * 6;
+            for (int r = 0; r < 6; r++) {
+                block(r, c) = src[r];
+            }
+        }
+        preconditioner[j] =
+                block.completeOrthogonalDecomposition().pseudoInverse();
+    });
+    auto apply_preconditioner = [&](const Eigen::VectorXd &r) {
+        Eigen::VectorXd z(r.rows());
+        utility::ParallelFor(0, n_nodes, [&](int64_t j) {
+            z.block<6, 1>(j * 6, 0) =
+                    preconditioner[j] * r.block<6, 1>(j * 6, 0);
+        });
+        return z;
+    };
+
+    const double tolerance2 = 1e-20 * b_.squaredNorm();
+    const int max_iteration = (std::max)(1000, n_nodes);
+    x.setZero(b_.rows());
+    Eigen::VectorXd r = b_;
+    Eigen::VectorXd z = apply_preconditioner(r);
+    Eigen::VectorXd p = z;
+    double rz = r.dot(z);
+    for (int iter = 0; iter < max_iteration; iter++) {
+        if (r.squaredNorm() <= tolerance2) {
+            return true;
+        }
+        Eigen::VectorXd Ap = A * p;
+        const double pAp = p.dot(Ap);
+        if (!(pAp > 0.0)) {
+            break;
+        }
+        const double alpha = rz / pAp;
+        x += alpha * p;
+        r -= alpha * Ap;
+        z = apply_preconditioner(r);
+        const double rz_new = r.dot(z);
+        p = z + (rz_new / rz) * p;
+        rz = rz_new;
+    }
+    return r.squaredNorm() <= tolerance2;
 }
 
 Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
@@ -511,16 +744,15 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph);
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph, zeta);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
     bool stop = false;
-    if (CheckRightTerm(b, criteria)) return;
+    if (CheckRightTerm(system.b_, criteria)) return;
 
     utility::Timer timer_overall;
     timer_overall.Start();
@@ -529,13 +761,11 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
+        Eigen::VectorXd delta;
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) = system.Solve();
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,9 +788,9 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            system.Compute(pose_graph, zeta);
 
-            stop = stop || CheckRightTerm(b, criteria);
+            stop = stop || CheckRightTerm(system.b_, criteria);
             if (stop) break;
         }
         timer_iter.Stop();
@@ -579,13 +809,18 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             timer_overall.GetDuration() / 1000.0);
 }
 
-void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+namespace {
+
+/// Levenberg-Marquardt optimization of \p pose_graph. Nodes flagged in
+/// \p fixed keep their pose.
+void OptimizePoseGraphLevenbergMarquardt(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
+        const GlobalOptimizationOption &option,
+        double line_process_weight,
+        const std::vector<bool> &fixed) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
 
     utility::LogDebug(
             "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
@@ -602,14 +837,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph, fixed);
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph, zeta);
 
-    Eigen::VectorXd H_diag = H.diagonal();
+    Eigen::VectorXd H_diag = system.H_.diagonal();
     double tau = 1e-5;
     double current_lambda = tau * H_diag.maxCoeff();
     double ni = 2.0;
@@ -619,7 +852,7 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       current_residual, current_lambda);
 
     bool stop = false;
-    stop = stop || CheckRightTerm(b, criteria);
+    stop = stop || CheckRightTerm(system.b_, criteria);
     if (stop) return;
 
     utility::Timer timer_overall;
@@ -629,14 +862,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
+            Eigen::VectorXd delta;
             bool solver_success = false;
 
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve H_LM @ delta == b using a sparse solver, where
+            // H_LM = H + current_lambda * I
+            std::tie(solver_success, delta) = system.Solve(current_lambda);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -648,7 +879,7 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                 new_residual = ComputeResidual(pose_graph, zeta_new,
                                                line_process_weight, option);
                 rho = (current_residual - new_residual) /
-                      (delta.dot(current_lambda * delta + b) + 1e-3);
+                      (delta.dot(current_lambda * delta + system.b_) + 1e-3);
                 if (rho > 0) {
                     stop = stop ||
                            CheckRelativeResidualIncrement(
@@ -667,9 +898,9 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    system.Compute(pose_graph, zeta);
 
-                    stop = stop || CheckRightTerm(b, criteria);
+                    stop = stop || CheckRightTerm(system.b_, criteria);
                     if (stop) break;
                 } else {
                     current_lambda *= ni;
@@ -696,6 +927,17 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       timer_overall.GetDuration() / 1000.0);
 }
 
+}  // unnamed namespace
+
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    OptimizePoseGraphLevenbergMarquardt(
+            pose_graph, criteria, option,
+            ComputeLineProcessWeight(pose_graph, option), std::vector<bool>());
+}
+
 void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationMethod &method
                         /* = GlobalOptimizationLevenbergMarquardt() */,
@@ -717,5 +959,103 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+IncrementalGlobalOptimization::IncrementalGlobalOptimization(
+        int window_size /* = 10 */,
+        const GlobalOptimizationConvergenceCriteria &criteria
+        /* = GlobalOptimizationConvergenceCriteria() */,
+        const GlobalOptimizationOption &option
+        /* = GlobalOptimizationOption() */)
+    : window_size_(window_size),
+      criteria_(criteria),
+      option_(option),
+      first_updated_node_(std::numeric_limits<int>::max()) {}
+
+int IncrementalGlobalOptimization::AddNode(const PoseGraphNode &node) {
+    pose_graph_.nodes_.push_back(node);
+    return (int)pose_graph_.nodes_.size() - 1;
+}
+
+void IncrementalGlobalOptimization::AddEdge(const PoseGraphEdge &edge) {
+    const int n_nodes = (int)pose_graph_.nodes_.size();
+    if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+        edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes) {
+        utility::LogError(
+                "[IncrementalGlobalOptimization] Edge ({:d}, {:d}) refers to "
+                "a node that does not exist.",
+                edge.source_node_id_, edge.target_node_id_);
+    }
+    pose_graph_.edges_.push_back(edge);
+    sum_number_of_correspondences_ += edge.information_(5, 5);
+    first_updated_node_ =
+            (std::min)({first_updated_node_, edge.source_node_id_,
+                        edge.target_node_id_});
+}
+
+void IncrementalGlobalOptimization::Optimize() {
+    const int n_nodes = (int)pose_graph_.nodes_.size();
+    const int n_edges = (int)pose_graph_.edges_.size();
+    // Nodes [first_free, n_nodes) are optimized, node 0 is the reference.
+    const int first_free = (std::max)(
+            1, (std::min)(first_updated_node_, n_nodes - window_size_));
+    first_updated_node_ = std::numeric_limits<int>::max();
+    if (first_free >= n_nodes || n_edges == 0) {
+        return;
+    }
+
+    // The local pose graph consists of the edges with a free node, and of
+    // their nodes. The free nodes come first, followed by the fixed nodes
+    // before first_free.
+    const int n_free = n_nodes - first_free;
+    std::vector<int> local_node_id(first_free, -1);
+    std::vector<int> global_node_id;
+    std::vector<int> global_edge_id;
+    PoseGraph local;
+    auto add_local_node = [&](int node) {
+        if (node >= first_free) {
+            return node - first_free;
+        }
+        if (local_node_id[node] < 0) {
+            local_node_id[node] = n_free + int(global_node_id.size());
+            global_node_id.push_back(node);
+        }
+        return local_node_id[node];
+    };
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &edge = pose_graph_.edges_[iter_edge];
+        if (edge.source_node_id_ < first_free &&
+            edge.target_node_id_ < first_free) {
+            continue;
+        }
+        PoseGraphEdge local_edge = edge;
+        local_edge.source_node_id_ = add_local_node(edge.source_node_id_);
+        local_edge.target_node_id_ = add_local_node(edge.target_node_id_);
+        local.edges_.push_back(local_edge);
+        global_edge_id.push_back(iter_edge);
+    }
+    local.nodes_.assign(pose_graph_.nodes_.begin() + first_free,
+                        pose_graph_.nodes_.end());
+    for (int node : global_node_id) {
+        local.nodes_.push_back(pose_graph_.nodes_[node]);
+    }
+    std::vector<bool> fixed(local.nodes_.size(), false);
+    std::fill(fixed.begin() + n_free, fixed.end(), true);
+
+    // The line process weight depends on all edges, not only local ones.
+    const double line_process_weight =
+            option_.preference_loop_closure_ *
+            pow(option_.max_correspondence_distance_, 2) *
+            sum_number_of_correspondences_ / n_edges;
+    OptimizePoseGraphLevenbergMarquardt(local, criteria_, option_,
+                                        line_process_weight, fixed);
+
+    for (int i = 0; i < n_free; i++) {
+        pose_graph_.nodes_[first_free + i] = local.nodes_[i];
+    }
+    for (size_t k = 0; k < global_edge_id.size(); k++) {
+        pose_graph_.edges_[global_edge_id[k]].confidence_ =
+                local.edges_[k].confidence_;
+    }
+}
+
 }  // namespace registration
 }  // namespace open3d
@@ -30,12 +30,11 @@
 
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
 
 namespace open3d {
 namespace registration {
 
-class PoseGraph;
-
 /// Function to optimize a PoseGraph
 /// Reference:
 /// [Kümmerle et al 2011]
@@ -61,5 +60,62 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class IncrementalGlobalOptimization
+///
+/// \brief Online pose graph optimization for nodes added one at a time, e.g.
+/// keyframes in SLAM.
+///
+/// Instead of re-solving the whole pose graph, Optimize() only optimizes the
+/// part affected by the nodes and edges added since its last call: the last
+/// window_size_ nodes, and all nodes between the endpoints of every new edge
+/// reaching further back, e.g. a loop closure. All other nodes are held fixed
+/// and anchor the optimized nodes through the edges connecting them. Node ids
+/// are assumed to follow the acquisition order, and node 0 is the fixed
+/// reference. The optimization uses the Levenberg-Marquardt method with the
+/// line process of [Choi et al 2015], without pruning edges.
+class IncrementalGlobalOptimization {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param window_size Number of most recent nodes optimized by every call
+    /// of Optimize().
+    /// \param criteria Convergence criteria.
+    /// \param option Global optimization options. reference_node_ is ignored.
+    IncrementalGlobalOptimization(
+            int window_size = 10,
+            const GlobalOptimizationConvergenceCriteria &criteria =
+                    GlobalOptimizationConvergenceCriteria(),
+            const GlobalOptimizationOption &option =
+                    GlobalOptimizationOption());
+    ~IncrementalGlobalOptimization() {}
+
+public:
+    /// Adds a node to the pose graph and returns its id.
+    int AddNode(const PoseGraphNode &node);
+    /// Adds an edge between two nodes of the pose graph.
+    void AddEdge(const PoseGraphEdge &edge);
+    /// Optimizes the nodes affected by the nodes and edges added since the
+    /// last call.
+    void Optimize();
+    /// Returns the pose graph.
+    const PoseGraph &GetPoseGraph() const { return pose_graph_; }
+
+public:
+    /// Number of most recent nodes optimized by every call of Optimize().
+    int window_size_;
+    /// Convergence criteria.
+    GlobalOptimizationConvergenceCriteria criteria_;
+    /// Global optimization options.
+    GlobalOptimizationOption option_;
+
+private:
+    PoseGraph pose_graph_;
+    /// Smallest node id connected by an edge added since the last
+    /// Optimize().
+    int first_updated_node_;
+    /// Sum of information_(5, 5) of all edges, see [Choi et al 2015].
+    double sum_number_of_correspondences_ = 0.0;
+};
+
 }  // namespace registration
 }  // namespace open3d
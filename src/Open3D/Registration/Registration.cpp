@@ -26,19 +26,39 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <typeinfo>
 
+#include <Eigen/SVD>
+
+#include "Open3D/Geometry/CompactPointCloud.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/KDTreeIndex.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/RegistrationTarget.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Profiler.h"
+#include "Open3D/Utility/Timer.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
+// Number of RANSAC hypotheses that are drawn and checked in parallel.
+constexpr int kRANSACBatchSize = 256;
+// Number of points or correspondences a RANSAC hypothesis is scored on before
+// it is fully validated.
+constexpr int kRANSACPreviewSize = 1000;
+
 RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -50,41 +70,35 @@ RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    double error2 = 0.0;
-
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
-        }
-#ifdef _OPENMP
-    }
-#endif
+    // Chunks are concatenated in index order, so the correspondences are
+    // sorted by source index.
+    using PartialResult = std::pair<double, CorrespondenceSet>;
+    PartialResult total = utility::ParallelReduce(
+            0, int64_t(source.points_.size()),
+            PartialResult(0.0, CorrespondenceSet()),
+            [&](int64_t begin, int64_t end, PartialResult partial) {
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                for (int64_t i = begin; i < end; i++) {
+                    const auto &point = source.points_[i];
+                    if (target_kdtree.SearchHybrid(
+                                point, max_correspondence_distance, 1,
+                                indices, dists) > 0) {
+                        partial.first += dists[0];
+                        partial.second.push_back(
+                                Eigen::Vector2i(int(i), indices[0]));
+                    }
+                }
+                return partial;
+            },
+            [](PartialResult lhs, const PartialResult &rhs) {
+                lhs.first += rhs.first;
+                lhs.second.insert(lhs.second.end(), rhs.second.begin(),
+                                  rhs.second.end());
+                return lhs;
+            });
+    const double error2 = total.first;
+    result.correspondence_set_ = std::move(total.second);
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
@@ -97,23 +111,87 @@ RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+// Returns source if transformation is the identity, and otherwise the points
+// of source transformed into buffer. The correspondences only depend on the
+// points, so the other attributes are not copied.
+const geometry::PointCloud &TransformSourcePoints(
+        const geometry::PointCloud &source,
+        const Eigen::Matrix4d &transformation,
+        geometry::PointCloud &buffer) {
+    if (transformation.isIdentity()) {
+        return source;
+    }
+    buffer.points_ = source.points_;
+    buffer.Transform(transformation);
+    return buffer;
+}
+
+// Scores a transformation like GetRegistrationResultAndCorrespondences, but
+// transforms the source points on the fly and does not store the
+// correspondences.
+RegistrationResult EvaluateTransformation(
+        const geometry::PointCloud &source,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
+    RegistrationResult result(transformation);
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    using PartialResult = std::pair<int64_t, double>;
+    PartialResult total = utility::ParallelReduce(
+            0, int64_t(source.points_.size()), PartialResult(0, 0.0),
+            [&](int64_t begin, int64_t end, PartialResult partial) {
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                for (int64_t i = begin; i < end; i++) {
+                    const Eigen::Vector3d point =
+                            rotation * source.points_[i] + translation;
+                    if (target_kdtree.SearchHybrid(
+                                point, max_correspondence_distance, 1,
+                                indices, dists) > 0) {
+                        partial.first++;
+                        partial.second += dists[0];
+                    }
+                }
+                return partial;
+            },
+            [](const PartialResult &lhs, const PartialResult &rhs) {
+                return PartialResult(lhs.first + rhs.first,
+                                     lhs.second + rhs.second);
+            });
+    if (total.first > 0) {
+        result.fitness_ = double(total.first) / double(source.points_.size());
+        result.inlier_rmse_ = std::sqrt(total.second / double(total.first));
+    }
+    return result;
+}
+
+// Scores a transformation on a set of correspondences, transforming the
+// source points on the fly. The inlier correspondences are only stored if
+// \p keep_correspondences is true.
 RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
+        const Eigen::Matrix4d &transformation,
+        bool keep_correspondences) {
     RegistrationResult result(transformation);
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (rotation * source.points_[c[0]] + translation -
+                       target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
-            result.correspondence_set_.push_back(c);
+            if (keep_correspondences) {
+                result.correspondence_set_.push_back(c);
+            }
         }
     }
     if (good == 0) {
@@ -126,6 +204,443 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+// Draws kRANSACPreviewSize distinct indices in [0, size), sorted. Returns an
+// empty vector if size is too small for a preview to save any work.
+std::vector<int> SampleRANSACPreview(int size, std::mt19937 &rng) {
+    if (size <= 2 * kRANSACPreviewSize) {
+        return std::vector<int>();
+    }
+    std::vector<int> indices(size);
+    std::iota(indices.begin(), indices.end(), 0);
+    for (int i = 0; i < kRANSACPreviewSize; i++) {
+        std::uniform_int_distribution<int> distribution(i, size - 1);
+        std::swap(indices[i], indices[distribution(rng)]);
+    }
+    indices.resize(kRANSACPreviewSize);
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+// Returns false if num_inliers out of the preview make it unlikely that the
+// fitness of the hypothesis reaches best_fitness. The preview fitness is
+// allowed to fall three standard deviations short of it.
+bool PassesRANSACPreview(int num_inliers,
+                         int num_preview,
+                         double best_fitness) {
+    const double fitness = double(num_inliers) / double(num_preview);
+    const double variance =
+            std::max(fitness * (1.0 - fitness), 1.0 / num_preview) /
+            num_preview;
+    return fitness + 3.0 * std::sqrt(variance) >= best_fitness;
+}
+
+// Number of iterations after which a sample without outliers has been drawn
+// with the given confidence.
+int RANSACRequiredIterations(double inlier_ratio,
+                             int ransac_n,
+                             double confidence) {
+    const double all_inliers = std::pow(inlier_ratio, ransac_n);
+    if (confidence >= 1.0 || all_inliers <= 0.0) {
+        return std::numeric_limits<int>::max();
+    }
+    if (all_inliers >= 1.0) {
+        return 1;
+    }
+    const double iterations =
+            std::ceil(std::log(1.0 - confidence) / std::log(1.0 - all_inliers));
+    return iterations < double(std::numeric_limits<int>::max())
+                   ? std::max(1, int(iterations))
+                   : std::numeric_limits<int>::max();
+}
+
+// Which of the RANSACConvergenceCriteria stopped a RANSAC loop that
+// considered num_iterations hypotheses and validated num_validations.
+RegistrationStopReason GetRANSACStopReason(
+        int num_iterations,
+        int num_validations,
+        const RANSACConvergenceCriteria &criteria) {
+    if (num_validations >= criteria.max_validation_) {
+        return RegistrationStopReason::MaxValidation;
+    }
+    if (num_iterations >= criteria.max_iteration_) {
+        return RegistrationStopReason::MaxIteration;
+    }
+    return RegistrationStopReason::Confidence;
+}
+
+void CheckICPArguments(const geometry::PointCloud &target,
+                       double max_correspondence_distance,
+                       const TransformationEstimation &estimation) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if ((estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::PointToPlane ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::ColoredICP) &&
+        !target.HasNormals()) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane and "
+                "TransformationEstimationColoredICP "
+                "require pre-computed normal vectors of the target.");
+    }
+}
+
+// Sums of one pass of point-to-plane ICP over the source points.
+struct PointToPlaneSums {
+    Eigen::Matrix<double, 6, 6, Eigen::DontAlign> JTJ =
+            Eigen::Matrix6d::Zero();
+    Eigen::Matrix<double, 6, 1, Eigen::DontAlign> JTr =
+            Eigen::Vector6d::Zero();
+    // Squared distances to the nearest neighbors.
+    double error2 = 0.0;
+    // Number of source points with a neighbor within the distance.
+    int64_t num_corres = 0;
+};
+
+// Finds the nearest neighbor of every transformed source point and
+// accumulates the point-to-plane normal equations in the same pass, without
+// building a CorrespondenceSet. Every equation is weighted by the robust
+// kernel. The neighbor of source point i is written to nearest[i], or -1 if
+// there is none within the distance.
+PointToPlaneSums ComputePointToPlaneSums(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation,
+        const RobustKernel &kernel,
+        std::vector<int> &nearest) {
+    nearest.resize(source.points_.size());
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    return utility::ParallelReduce(
+            0, int64_t(source.points_.size()), PointToPlaneSums(),
+            [&](int64_t begin, int64_t end, PointToPlaneSums partial) {
+                Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+                Eigen::Vector6d J_r;
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                for (int64_t i = begin; i < end; i++) {
+                    const Eigen::Vector3d vs =
+                            rotation * source.points_[i] + translation;
+                    if (target_kdtree.SearchHybrid(
+                                vs, max_correspondence_distance, 1, indices,
+                                dists) <= 0) {
+                        nearest[i] = -1;
+                        continue;
+                    }
+                    nearest[i] = indices[0];
+                    const Eigen::Vector3d &vt = target.points_[indices[0]];
+                    const Eigen::Vector3d &nt = target.normals_[indices[0]];
+                    const double r = (vs - vt).dot(nt);
+                    J_r.block<3, 1>(0, 0) = vs.cross(nt);
+                    J_r.block<3, 1>(3, 0) = nt;
+                    const double w = kernel.Weight(r);
+                    JTJ.noalias() += w * J_r * J_r.transpose();
+                    JTr.noalias() += w * r * J_r;
+                    partial.error2 += dists[0];
+                    partial.num_corres++;
+                }
+                partial.JTJ += JTJ;
+                partial.JTr += JTr;
+                return partial;
+            },
+            [](PointToPlaneSums lhs, const PointToPlaneSums &rhs) {
+                lhs.JTJ += rhs.JTJ;
+                lhs.JTr += rhs.JTr;
+                lhs.error2 += rhs.error2;
+                lhs.num_corres += rhs.num_corres;
+                return lhs;
+            });
+}
+
+// Point-to-plane ICP where every iteration is a single pass over the source
+// points, see ComputePointToPlaneSums. Only the result of the final
+// transformation gets its CorrespondenceSet.
+RegistrationResult RegistrationPointToPlaneICPWithKDTree(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const RobustKernel &kernel,
+        const ICPConvergenceCriteria &criteria) {
+    utility::Timer total_timer, iteration_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
+    statistics.stop_reason_ = RegistrationStopReason::MaxIteration;
+    auto fitness_and_rmse = [&](const PointToPlaneSums &sums) {
+        if (sums.num_corres == 0) {
+            return std::make_pair(0.0, 0.0);
+        }
+        return std::make_pair(
+                double(sums.num_corres) / double(source.points_.size()),
+                std::sqrt(sums.error2 / double(sums.num_corres)));
+    };
+
+    Eigen::Matrix4d transformation = init;
+    std::vector<int> nearest;
+    timer.Start();
+    PointToPlaneSums sums = ComputePointToPlaneSums(
+            source, target, kdtree, max_correspondence_distance,
+            transformation, kernel, nearest);
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::ProfilerScope profiler_scope("ICPIteration");
+        profiler_scope.AddItems(int64_t(source.points_.size()));
+        iteration_timer.Start();
+        const auto backup = fitness_and_rmse(sums);
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          backup.first, backup.second);
+        timer.Start();
+        if (sums.num_corres > 0) {
+            bool is_success;
+            Eigen::Matrix4d update;
+            std::tie(is_success, update) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(
+                            sums.JTJ, sums.JTr);
+            transformation = update * transformation;
+        }
+        timer.Stop();
+        statistics.solve_time_ += timer.GetDuration();
+        statistics.num_iterations_++;
+        timer.Start();
+        sums = ComputePointToPlaneSums(source, target, kdtree,
+                                       max_correspondence_distance,
+                                       transformation, kernel, nearest);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
+        iteration_timer.Stop();
+        statistics.iteration_times_.push_back(iteration_timer.GetDuration());
+        const auto current = fitness_and_rmse(sums);
+        if (std::abs(backup.first - current.first) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.second - current.second) <
+                    criteria.relative_rmse_) {
+            statistics.stop_reason_ = RegistrationStopReason::Converged;
+            break;
+        }
+    }
+
+    RegistrationResult result(transformation);
+    std::tie(result.fitness_, result.inlier_rmse_) = fitness_and_rmse(sums);
+    result.correspondence_set_.reserve(sums.num_corres);
+    for (int i = 0; i < int(nearest.size()); i++) {
+        if (nearest[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, nearest[i]));
+        }
+    }
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
+    return result;
+}
+
+// Runs ICP against a prebuilt KDTree of target.
+RegistrationResult RegistrationICPWithKDTree(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    // The built-in point-to-plane estimation is fused with the correspondence
+    // search. Subclasses, e.g. from Python, may override it and take the
+    // general path.
+    if (typeid(estimation) == typeid(TransformationEstimationPointToPlane)) {
+        const auto &point_to_plane =
+                static_cast<const TransformationEstimationPointToPlane &>(
+                        estimation);
+        return RegistrationPointToPlaneICPWithKDTree(
+                source, target, kdtree, max_correspondence_distance, init,
+                *point_to_plane.kernel_, criteria);
+    }
+    utility::Timer total_timer, iteration_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
+    statistics.stop_reason_ = RegistrationStopReason::MaxIteration;
+    Eigen::Matrix4d transformation = init;
+    geometry::PointCloud pcd;
+    if (init.isIdentity()) {
+        pcd = source;
+    } else {
+        source.TransformInto(init, pcd);
+    }
+    RegistrationResult result;
+    timer.Start();
+    result = GetRegistrationResultAndCorrespondences(
+            pcd, target, kdtree, max_correspondence_distance, transformation);
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::ProfilerScope profiler_scope("ICPIteration");
+        profiler_scope.AddItems(int64_t(source.points_.size()));
+        iteration_timer.Start();
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        timer.Start();
+        Eigen::Matrix4d update = estimation.ComputeTransformation(
+                pcd, target, result.correspondence_set_);
+        timer.Stop();
+        statistics.solve_time_ += timer.GetDuration();
+        transformation = update * transformation;
+        pcd.Transform(update);
+        statistics.num_iterations_++;
+        const double fitness = result.fitness_;
+        const double inlier_rmse = result.inlier_rmse_;
+        timer.Start();
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                transformation);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
+        iteration_timer.Stop();
+        statistics.iteration_times_.push_back(iteration_timer.GetDuration());
+        if (std::abs(fitness - result.fitness_) < criteria.relative_fitness_ &&
+            std::abs(inlier_rmse - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            statistics.stop_reason_ = RegistrationStopReason::Converged;
+            break;
+        }
+    }
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
+    return result;
+}
+
+// Sums of one pass of ICP over the points of a CompactPointCloud.
+struct CompactICPSums {
+    // Point-to-plane normal equations.
+    Eigen::Matrix<double, 6, 6, Eigen::DontAlign> JTJ =
+            Eigen::Matrix6d::Zero();
+    Eigen::Matrix<double, 6, 1, Eigen::DontAlign> JTr =
+            Eigen::Vector6d::Zero();
+    // Point-to-point moments: the sums of the transformed source points, of
+    // the target points and of target * source^T.
+    Eigen::Matrix<double, 3, 1, Eigen::DontAlign> source_sum =
+            Eigen::Vector3d::Zero();
+    Eigen::Matrix<double, 3, 1, Eigen::DontAlign> target_sum =
+            Eigen::Vector3d::Zero();
+    Eigen::Matrix<double, 3, 3, Eigen::DontAlign> cross_sum =
+            Eigen::Matrix3d::Zero();
+    double error2 = 0.0;
+    int64_t num_corres = 0;
+};
+
+// Finds the nearest neighbor of every transformed source point with one
+// batched search in index, and accumulates the sums of point-to-plane or
+// point-to-point ICP. The source points are transformed in double precision,
+// rounded to float for the search only. The neighbor of source point i is
+// written to nearest[i], or -1 if there is none within the distance.
+CompactICPSums ComputeCompactICPSums(
+        const geometry::CompactPointCloud &source,
+        const geometry::CompactPointCloud &target,
+        const geometry::KDTreeIndex &index,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation,
+        const RobustKernel *point_to_plane_kernel,
+        std::vector<Eigen::Vector3f> &queries,
+        std::vector<int> &nearest) {
+    const int64_t num_points = int64_t(source.points_.size());
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    queries.resize(num_points);
+    utility::ParallelFor(0, num_points, [&](int64_t i) {
+        queries[i] = (rotation * source.points_[i].cast<double>() + translation)
+                             .cast<float>();
+    });
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    std::vector<int64_t> offsets;
+    index.SearchHybrid(queries, max_correspondence_distance, 1, indices,
+                       distance2, offsets);
+    nearest.resize(num_points);
+    return utility::ParallelReduce(
+            0, num_points, CompactICPSums(),
+            [&](int64_t begin, int64_t end, CompactICPSums partial) {
+                Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+                Eigen::Vector3d source_sum = Eigen::Vector3d::Zero();
+                Eigen::Vector3d target_sum = Eigen::Vector3d::Zero();
+                Eigen::Matrix3d cross_sum = Eigen::Matrix3d::Zero();
+                Eigen::Vector6d J_r;
+                for (int64_t i = begin; i < end; i++) {
+                    if (offsets[i + 1] == offsets[i]) {
+                        nearest[i] = -1;
+                        continue;
+                    }
+                    const int j = indices[offsets[i]];
+                    nearest[i] = j;
+                    const Eigen::Vector3d vs =
+                            rotation * source.points_[i].cast<double>() +
+                            translation;
+                    const Eigen::Vector3d vt = target.points_[j].cast<double>();
+                    if (point_to_plane_kernel != nullptr) {
+                        const Eigen::Vector3d nt =
+                                target.normals_[j].cast<double>();
+                        const double r = (vs - vt).dot(nt);
+                        J_r.block<3, 1>(0, 0) = vs.cross(nt);
+                        J_r.block<3, 1>(3, 0) = nt;
+                        const double w = point_to_plane_kernel->Weight(r);
+                        JTJ.noalias() += w * J_r * J_r.transpose();
+                        JTr.noalias() += w * r * J_r;
+                    } else {
+                        source_sum += vs;
+                        target_sum += vt;
+                        cross_sum.noalias() += vt * vs.transpose();
+                    }
+                    partial.error2 += (vs - vt).squaredNorm();
+                    partial.num_corres++;
+                }
+                partial.JTJ += JTJ;
+                partial.JTr += JTr;
+                partial.source_sum += source_sum;
+                partial.target_sum += target_sum;
+                partial.cross_sum += cross_sum;
+                return partial;
+            },
+            [](CompactICPSums lhs, const CompactICPSums &rhs) {
+                lhs.JTJ += rhs.JTJ;
+                lhs.JTr += rhs.JTr;
+                lhs.source_sum += rhs.source_sum;
+                lhs.target_sum += rhs.target_sum;
+                lhs.cross_sum += rhs.cross_sum;
+                lhs.error2 += rhs.error2;
+                lhs.num_corres += rhs.num_corres;
+                return lhs;
+            });
+}
+
+// Rigid transformation that best aligns the transformed source points to
+// their correspondences in the least squares sense, from the moments of
+// CompactICPSums. This is the Umeyama method without scaling, as in
+// TransformationEstimationPointToPoint.
+Eigen::Matrix4d ComputePointToPointUpdate(const CompactICPSums &sums) {
+    const double n = double(sums.num_corres);
+    const Eigen::Vector3d source_mean = sums.source_sum / n;
+    const Eigen::Vector3d target_mean = sums.target_sum / n;
+    const Eigen::Matrix3d sigma =
+            sums.cross_sum / n - target_mean * source_mean.transpose();
+    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+            sigma, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    Eigen::Matrix3d s = Eigen::Matrix3d::Identity();
+    if (svd.matrixU().determinant() * svd.matrixV().determinant() < 0.0) {
+        s(2, 2) = -1.0;
+    }
+    Eigen::Matrix4d update = Eigen::Matrix4d::Identity();
+    update.block<3, 3>(0, 0) =
+            svd.matrixU() * s * svd.matrixV().transpose();
+    update.block<3, 1>(0, 3) =
+            target_mean - update.block<3, 3>(0, 0) * source_mean;
+    return update;
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -137,10 +652,9 @@ RegistrationResult EvaluateRegistration(
                 &transformation /* = Eigen::Matrix4d::Identity()*/) {
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
-    if (!transformation.isIdentity()) {
-        pcd.Transform(transformation);
-    }
+    geometry::PointCloud buffer;
+    const geometry::PointCloud &pcd =
+            TransformSourcePoints(source, transformation, buffer);
     return GetRegistrationResultAndCorrespondences(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
@@ -154,51 +668,234 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
+    CheckICPArguments(target, max_correspondence_distance, estimation);
+    utility::Timer timer;
+    timer.Start();
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    timer.Stop();
+    RegistrationResult result = RegistrationICPWithKDTree(
+            source, target, kdtree, max_correspondence_distance, init,
+            estimation, criteria);
+    result.statistics_.total_time_ += timer.GetDuration();
+    return result;
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    CheckICPArguments(target.GetPointCloud(), max_correspondence_distance,
+                      estimation);
+    return RegistrationICPWithKDTree(source, target.GetPointCloud(),
+                                     target.GetKDTree(),
+                                     max_correspondence_distance, init,
+                                     estimation, criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::CompactPointCloud &source,
+        const geometry::CompactPointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
-    if ((estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::PointToPlane ||
-         estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
-        (!source.HasNormals() || !target.HasNormals())) {
+    const RobustKernel *point_to_plane_kernel = nullptr;
+    if (typeid(estimation) == typeid(TransformationEstimationPointToPlane)) {
+        if (!target.HasNormals()) {
+            utility::LogError(
+                    "TransformationEstimationPointToPlane requires "
+                    "pre-computed normal vectors of the target.");
+        }
+        point_to_plane_kernel =
+                static_cast<const TransformationEstimationPointToPlane &>(
+                        estimation)
+                        .kernel_.get();
+    } else if (typeid(estimation) !=
+                       typeid(TransformationEstimationPointToPoint) ||
+               static_cast<const TransformationEstimationPointToPoint &>(
+                       estimation)
+                       .with_scaling_) {
         utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
-                "require pre-computed normal vectors.");
+                "ICP of CompactPointCloud supports "
+                "TransformationEstimationPointToPoint without scaling and "
+                "TransformationEstimationPointToPlane only.");
     }
+    RegistrationResult result(init);
+    if (!target.HasPoints()) {
+        return result;
+    }
+    utility::Timer total_timer, iteration_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
+    statistics.stop_reason_ = RegistrationStopReason::MaxIteration;
+    geometry::KDTreeIndex index;
+    index.SetPoints(target.points_);
+    auto fitness_and_rmse = [&](const CompactICPSums &sums) {
+        if (sums.num_corres == 0) {
+            return std::make_pair(0.0, 0.0);
+        }
+        return std::make_pair(
+                double(sums.num_corres) / double(source.points_.size()),
+                std::sqrt(sums.error2 / double(sums.num_corres)));
+    };
 
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
-    if (!init.isIdentity()) {
-        pcd.Transform(init);
-    }
-    RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+    std::vector<Eigen::Vector3f> queries;
+    std::vector<int> nearest;
+    timer.Start();
+    CompactICPSums sums = ComputeCompactICPSums(
+            source, target, index, max_correspondence_distance,
+            transformation, point_to_plane_kernel, queries, nearest);
+    timer.Stop();
+    statistics.correspondence_time_ += timer.GetDuration();
     for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::ProfilerScope profiler_scope("ICPIteration");
+        profiler_scope.AddItems(int64_t(source.points_.size()));
+        iteration_timer.Start();
+        const auto backup = fitness_and_rmse(sums);
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
-        transformation = update * transformation;
-        pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
-        if (std::abs(backup.fitness_ - result.fitness_) <
+                          backup.first, backup.second);
+        timer.Start();
+        if (sums.num_corres > 0) {
+            Eigen::Matrix4d update;
+            if (point_to_plane_kernel != nullptr) {
+                bool is_success;
+                std::tie(is_success, update) =
+                        utility::SolveJacobianSystemAndObtainExtrinsicMatrix(
+                                sums.JTJ, sums.JTr);
+            } else {
+                update = ComputePointToPointUpdate(sums);
+            }
+            transformation = update * transformation;
+        }
+        timer.Stop();
+        statistics.solve_time_ += timer.GetDuration();
+        statistics.num_iterations_++;
+        timer.Start();
+        sums = ComputeCompactICPSums(source, target, index,
+                                     max_correspondence_distance,
+                                     transformation, point_to_plane_kernel,
+                                     queries, nearest);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
+        iteration_timer.Stop();
+        statistics.iteration_times_.push_back(iteration_timer.GetDuration());
+        const auto current = fitness_and_rmse(sums);
+        if (std::abs(backup.first - current.first) <
                     criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+            std::abs(backup.second - current.second) <
                     criteria.relative_rmse_) {
+            statistics.stop_reason_ = RegistrationStopReason::Converged;
             break;
         }
     }
+
+    result.transformation_ = transformation;
+    std::tie(result.fitness_, result.inlier_rmse_) = fitness_and_rmse(sums);
+    result.correspondence_set_.reserve(sums.num_corres);
+    for (int i = 0; i < int(nearest.size()); i++) {
+        if (nearest[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, nearest[i]));
+        }
+    }
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
     return result;
 }
 
+std::tuple<RegistrationResult, std::vector<MultiScaleICPLevelStatistics>>
+RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criteria,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/) {
+    if (voxel_sizes.empty() ||
+        voxel_sizes.size() != max_correspondence_distances.size() ||
+        voxel_sizes.size() != criteria.size()) {
+        utility::LogError(
+                "[RegistrationMultiScaleICP] voxel_sizes, "
+                "max_correspondence_distances and criteria must have the "
+                "same, non-zero number of levels.");
+    }
+    const bool needs_normals = estimation.GetTransformationEstimationType() ==
+                               TransformationEstimationType::PointToPlane;
+
+    RegistrationResult result(init);
+    std::vector<MultiScaleICPLevelStatistics> statistics(voxel_sizes.size());
+    utility::Timer timer;
+    for (size_t level = 0; level < voxel_sizes.size(); level++) {
+        const double voxel_size = voxel_sizes[level];
+        auto &level_statistics = statistics[level];
+        timer.Start();
+        std::shared_ptr<geometry::PointCloud> source_down, target_down;
+        if (voxel_size > 0.0) {
+            source_down = source.VoxelDownSample(voxel_size);
+            target_down = target.VoxelDownSample(voxel_size);
+        }
+        const geometry::PointCloud &source_level =
+                source_down ? *source_down : source;
+        const geometry::PointCloud *target_level =
+                target_down ? target_down.get() : &target;
+        if (needs_normals && !target_level->HasNormals()) {
+            if (!target_down) {
+                target_down = std::make_shared<geometry::PointCloud>(target);
+                target_level = target_down.get();
+            }
+            if (voxel_size > 0.0) {
+                target_down->EstimateNormals(
+                        geometry::KDTreeSearchParamHybrid(2.0 * voxel_size,
+                                                          30));
+            } else {
+                target_down->EstimateNormals(
+                        geometry::KDTreeSearchParamKNN(30));
+            }
+        }
+        CheckICPArguments(*target_level, max_correspondence_distances[level],
+                          estimation);
+        geometry::KDTreeFlann kdtree;
+        kdtree.SetGeometry(*target_level);
+        timer.Stop();
+        level_statistics.preprocessing_time_ = timer.GetDuration();
+
+        timer.Start();
+        result = RegistrationICPWithKDTree(
+                source_level, *target_level, kdtree,
+                max_correspondence_distances[level], result.transformation_,
+                estimation, criteria[level]);
+        timer.Stop();
+        level_statistics.num_iterations_ = result.statistics_.num_iterations_;
+        level_statistics.registration_time_ = timer.GetDuration();
+
+        level_statistics.voxel_size_ = std::max(voxel_size, 0.0);
+        level_statistics.num_source_points_ = source_level.points_.size();
+        level_statistics.num_target_points_ = target_level->points_.size();
+        level_statistics.fitness_ = result.fitness_;
+        level_statistics.inlier_rmse_ = result.inlier_rmse_;
+        utility::LogDebug(
+                "Multi-scale ICP level {:d}: voxel size {:e}, fitness {:e}, "
+                "RMSE {:e}",
+                int(level), voxel_size, result.fitness_, result.inlier_rmse_);
+    }
+    return std::make_tuple(result, statistics);
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -213,217 +910,476 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
+    utility::Timer total_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    const std::vector<int> preview =
+            SampleRANSACPreview(int(corres.size()), rng);
+    const double max_dis2 =
+            max_correspondence_distance * max_correspondence_distance;
     Eigen::Matrix4d transformation;
     CorrespondenceSet ransac_corres(ransac_n);
     RegistrationResult result;
 
-    for (int itr = 0;
-         itr < criteria.max_iteration_ && itr < criteria.max_validation_;
+    int max_iteration = criteria.max_iteration_;
+    int total_validation = 0;
+    for (int itr = 0; itr < max_iteration &&
+                      total_validation < criteria.max_validation_;
          itr++) {
+        statistics.num_iterations_++;
+        timer.Start();
         for (int j = 0; j < ransac_n; j++) {
             ransac_corres[j] = corres[utility::UniformRandInt(
                     0, static_cast<int>(corres.size()) - 1)];
         }
         transformation =
                 estimation.ComputeTransformation(source, target, ransac_corres);
-        geometry::PointCloud pcd = source;
-        pcd.Transform(transformation);
+        timer.Stop();
+        statistics.solve_time_ += timer.GetDuration();
+        timer.Start();
+        if (!preview.empty()) {
+            const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+            const Eigen::Vector3d translation =
+                    transformation.block<3, 1>(0, 3);
+            int num_inliers = 0;
+            for (int k : preview) {
+                const auto &c = corres[k];
+                if ((rotation * source.points_[c[0]] + translation -
+                     target.points_[c[1]])
+                            .squaredNorm() < max_dis2) {
+                    num_inliers++;
+                }
+            }
+            if (!PassesRANSACPreview(num_inliers, int(preview.size()),
+                                     result.fitness_)) {
+                timer.Stop();
+                statistics.correspondence_time_ += timer.GetDuration();
+                statistics.num_rejected_by_preview_++;
+                continue;
+            }
+        }
+        total_validation++;
         auto this_result = EvaluateRANSACBasedOnCorrespondence(
-                pcd, target, corres, max_correspondence_distance,
-                transformation);
+                source, target, corres, max_correspondence_distance,
+                transformation, false);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
         if (this_result.fitness_ > result.fitness_ ||
             (this_result.fitness_ == result.fitness_ &&
              this_result.inlier_rmse_ < result.inlier_rmse_)) {
             result = this_result;
+            max_iteration = std::min(
+                    max_iteration,
+                    RANSACRequiredIterations(result.fitness_, ransac_n,
+                                             criteria.confidence_));
         }
     }
+
+    // Only the best hypothesis needs its correspondences.
+    if (result.fitness_ > 0.0) {
+        timer.Start();
+        result = EvaluateRANSACBasedOnCorrespondence(
+                source, target, corres, max_correspondence_distance,
+                result.transformation_, true);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
+    }
+    utility::LogDebug("total_validation : {:d}", total_validation);
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
+    statistics.num_validations_ = total_validation;
+    statistics.stop_reason_ = GetRANSACStopReason(
+            statistics.num_iterations_, total_validation, criteria);
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
     return result;
 }
 
-RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+namespace {
+
+// RANSAC over feature correspondences, validated against a prebuilt KDTree
+// of target.
+RegistrationResult RegistrationRANSACBasedOnFeatureCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
-        const Feature &source_feature,
-        const Feature &target_feature,
+        const geometry::KDTreeFlann &kdtree,
+        const CorrespondenceSet &corres,
         double max_correspondence_distance,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        int ransac_n /* = 4*/,
+        const TransformationEstimation &estimation,
+        int ransac_n,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
-                &checkers /* = {}*/,
-        const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
-    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+                &checkers,
+        const RANSACConvergenceCriteria &criteria) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0 ||
+        int(corres.size()) < ransac_n) {
         return RegistrationResult();
     }
+    utility::Timer total_timer, timer;
+    total_timer.Start();
+    RegistrationStatistics statistics;
 
+    // Every hypothesis seeds its own generator from the iteration index, so
+    // the result does not depend on the number of threads.
+    std::random_device rd;
+    const std::mt19937::result_type seed = rd();
+    std::mt19937 preview_rng(seed);
+    const std::vector<int> preview =
+            SampleRANSACPreview(int(source.points_.size()), preview_rng);
+
+    // Hypotheses are drawn, checked and previewed in parallel batches. The
+    // checkers run in bulk on the whole batch, cheapest and most selective
+    // first. The valid hypotheses are then validated in iteration order until
+    // max_validation_ is reached, unless their preview shows they cannot beat
+    // the best one.
+    CorrespondenceCheckerSchedule schedule(checkers, ransac_n);
+    std::vector<CorrespondenceSet> batch_corres(kRANSACBatchSize);
+    std::vector<Eigen::Matrix4d_u> batch_transformations(kRANSACBatchSize);
+    std::vector<uint8_t> batch_valid(kRANSACBatchSize);
+    std::vector<int> batch_preview_inliers(kRANSACBatchSize);
     RegistrationResult result;
+    int max_iteration = criteria.max_iteration_;
     int total_validation = 0;
-    bool finished_validation = false;
-    int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
-
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
-        RegistrationResult result_private;
-
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
-                Eigen::Matrix4d transformation;
-                for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id = utility::UniformRandInt(
-                            0, static_cast<int>(source.points_.size()) - 1);
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
-                    ransac_corres[j](0) = source_sample_id;
-                    if (num_similar_features == 1)
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
-                    else {
-                        ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
-                    }
-                }
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().require_pointcloud_alignment_ &&
-                        !checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-                transformation = estimation.ComputeTransformation(
-                        source, target, ransac_corres);
-                check = true;
-                for (const auto &checker : checkers) {
-                    if (checker.get().require_pointcloud_alignment_ &&
-                        !checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto this_result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-                if (this_result.fitness_ > result_private.fitness_ ||
-                    (this_result.fitness_ == result_private.fitness_ &&
-                     this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
-                    result_private = this_result;
-                }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                {
-                    total_validation = total_validation + 1;
-                    if (total_validation >= criteria.max_validation_)
-                        finished_validation = true;
+    for (int itr = 0;
+         itr < max_iteration && total_validation < criteria.max_validation_;
+         itr += kRANSACBatchSize) {
+        const int batch_size = std::min(kRANSACBatchSize, max_iteration - itr);
+        timer.Start();
+        batch_corres.resize(batch_size);
+        batch_transformations.resize(batch_size);
+        batch_valid.assign(batch_size, 1);
+        utility::ParallelFor(0, batch_size, [&](int64_t i) {
+            std::seed_seq seed_sequence{seed,
+                                        std::mt19937::result_type(itr + i)};
+            std::mt19937 rng(seed_sequence);
+            std::uniform_int_distribution<size_t> distribution(
+                    0, corres.size() - 1);
+            batch_corres[i].resize(ransac_n);
+            for (auto &c : batch_corres[i]) {
+                c = corres[distribution(rng)];
+            }
+            batch_transformations[i].setIdentity();
+        });
+        schedule.CheckBatch(source, target, batch_corres,
+                            batch_transformations, batch_valid, false);
+        utility::ParallelFor(0, batch_size, [&](int64_t i) {
+            if (batch_valid[i]) {
+                batch_transformations[i] = estimation.ComputeTransformation(
+                        source, target, batch_corres[i]);
+            }
+        });
+        schedule.CheckBatch(source, target, batch_corres,
+                            batch_transformations, batch_valid, true);
+        timer.Stop();
+        statistics.solve_time_ += timer.GetDuration();
+
+        timer.Start();
+        utility::ParallelFor(0, batch_size, [&](int64_t i) {
+            if (!batch_valid[i]) {
+                return;
+            }
+            const Eigen::Matrix3d rotation =
+                    batch_transformations[i].block<3, 3>(0, 0);
+            const Eigen::Vector3d translation =
+                    batch_transformations[i].block<3, 1>(0, 3);
+            std::vector<int> indices(1);
+            std::vector<double> dists(1);
+            int num_inliers = 0;
+            for (int k : preview) {
+                const Eigen::Vector3d point =
+                        rotation * source.points_[k] + translation;
+                if (kdtree.SearchHybrid(point, max_correspondence_distance, 1,
+                                        indices, dists) > 0) {
+                    num_inliers++;
                 }
-            }  // end of if statement
-        }      // end of for-loop
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (result_private.fitness_ > result.fitness_ ||
-                (result_private.fitness_ == result.fitness_ &&
-                 result_private.inlier_rmse_ < result.inlier_rmse_)) {
-                result = result_private;
+            }
+            batch_preview_inliers[i] = num_inliers;
+        });
+
+        for (int i = 0; i < batch_size && itr + i < max_iteration &&
+                        total_validation < criteria.max_validation_;
+             i++) {
+            statistics.num_iterations_++;
+            if (!batch_valid[i]) {
+                statistics.num_rejected_by_checkers_++;
+                continue;
+            }
+            if (!preview.empty() &&
+                !PassesRANSACPreview(batch_preview_inliers[i],
+                                     int(preview.size()), result.fitness_)) {
+                statistics.num_rejected_by_preview_++;
+                continue;
+            }
+            total_validation++;
+            auto this_result = EvaluateTransformation(
+                    source, kdtree, max_correspondence_distance,
+                    batch_transformations[i]);
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                max_iteration = std::min(
+                        max_iteration,
+                        RANSACRequiredIterations(result.fitness_, ransac_n,
+                                                 criteria.confidence_));
             }
         }
-#ifdef _OPENMP
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
+    }
+
+    // Only the best hypothesis needs its correspondences.
+    if (result.fitness_ > 0.0) {
+        timer.Start();
+        geometry::PointCloud buffer;
+        const geometry::PointCloud &pcd = TransformSourcePoints(
+                source, result.transformation_, buffer);
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, kdtree, max_correspondence_distance,
+                result.transformation_);
+        timer.Stop();
+        statistics.correspondence_time_ += timer.GetDuration();
     }
-#endif
     utility::LogDebug("total_validation : {:d}", total_validation);
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
+    statistics.num_validations_ = total_validation;
+    statistics.stop_reason_ = GetRANSACStopReason(
+            statistics.num_iterations_, total_validation, criteria);
+    total_timer.Stop();
+    statistics.total_time_ = total_timer.GetDuration();
+    result.statistics_ = std::move(statistics);
     return result;
 }
 
+}  // unnamed namespace
+
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const Feature &target_feature,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 4*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/,
+        bool mutual_filter /* = false*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+    const CorrespondenceSet corres = CorrespondencesFromFeatures(
+            source_feature, target_feature, mutual_filter);
+    if (int(corres.size()) < ransac_n) {
+        return RegistrationResult();
+    }
+    const geometry::KDTreeFlann kdtree(target);
+    return RegistrationRANSACBasedOnFeatureCorrespondences(
+            source, target, kdtree, corres, max_correspondence_distance,
+            estimation, ransac_n, checkers, criteria);
+}
+
 Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
-    geometry::PointCloud pcd = source;
-    if (!transformation.isIdentity()) {
-        pcd.Transform(transformation);
-    }
-    RegistrationResult result;
     geometry::KDTreeFlann target_kdtree(target);
+    geometry::PointCloud buffer;
+    const geometry::PointCloud &pcd =
+            TransformSourcePoints(source, transformation, buffer);
+    RegistrationResult result;
     result = GetRegistrationResultAndCorrespondences(
             pcd, target, target_kdtree, max_correspondence_distance,
             transformation);
+    return GetInformationMatrixFromCorrespondences(target,
+                                                   result.correspondence_set_);
+}
 
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target, const CorrespondenceSet &corres) {
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
-            double x = target.points_[t](0);
-            double y = target.points_[t](1);
-            double z = target.points_[t](2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { GTG += GTG_private; }
-#ifdef _OPENMP
-    }
-#endif
+    // Every correspondence with target point p adds G^T G, G = [[p]x^T, I].
+    // Summed up, this only depends on the number of points, the sum of p
+    // and the sum of p p^T.
+    struct InformationSums {
+        Eigen::Matrix<double, 3, 3, Eigen::DontAlign> ppT =
+                Eigen::Matrix3d::Zero();
+        Eigen::Matrix<double, 3, 1, Eigen::DontAlign> p =
+                Eigen::Vector3d::Zero();
+    };
+    const InformationSums sums = utility::ParallelReduce(
+            0, int64_t(corres.size()), InformationSums(),
+            [&](int64_t begin, int64_t end, InformationSums partial) {
+                Eigen::Matrix3d ppT = Eigen::Matrix3d::Zero();
+                Eigen::Vector3d p = Eigen::Vector3d::Zero();
+                for (int64_t c = begin; c < end; c++) {
+                    const Eigen::Vector3d &pt = target.points_[corres[c](1)];
+                    ppT.noalias() += pt * pt.transpose();
+                    p += pt;
+                }
+                partial.ppT += ppT;
+                partial.p += p;
+                return partial;
+            },
+            [](InformationSums lhs, const InformationSums &rhs) {
+                lhs.ppT += rhs.ppT;
+                lhs.p += rhs.p;
+                return lhs;
+            });
+
+    Eigen::Matrix3d p_cross;
+    p_cross << 0.0, -sums.p(2), sums.p(1), sums.p(2), 0.0, -sums.p(0),
+            -sums.p(1), sums.p(0), 0.0;
+    Eigen::Matrix6d GTG;
+    GTG.block<3, 3>(0, 0) =
+            sums.ppT.trace() * Eigen::Matrix3d::Identity() - sums.ppT;
+    GTG.block<3, 3>(0, 3) = p_cross;
+    GTG.block<3, 3>(3, 0) = p_cross.transpose();
+    GTG.block<3, 3>(3, 3) = double(corres.size()) * Eigen::Matrix3d::Identity();
     return GTG;
 }
 
+std::vector<PairwiseRegistrationResult> RegistrationPairwise(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<std::shared_ptr<Feature>> &features,
+        const std::vector<RegistrationPair> &pairs,
+        const PairwiseRegistrationOption &option
+        /* = PairwiseRegistrationOption()*/) {
+    const double max_correspondence_distance =
+            option.max_correspondence_distance_;
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError(
+                "[RegistrationPairwise] Invalid max_correspondence_distance.");
+    }
+    const int num_fragments = int(fragments.size());
+    for (const auto &fragment : fragments) {
+        if (!fragment) {
+            utility::LogError("[RegistrationPairwise] Fragment is null.");
+        }
+    }
+
+    // Only the KDTrees that some pair searches are built.
+    std::vector<uint8_t> needs_kdtree(num_fragments, 0);
+    std::vector<uint8_t> needs_feature_index(num_fragments, 0);
+    for (const auto &pair : pairs) {
+        if (pair.source_id_ < 0 || pair.source_id_ >= num_fragments ||
+            pair.target_id_ < 0 || pair.target_id_ >= num_fragments) {
+            utility::LogError(
+                    "[RegistrationPairwise] Pair ({:d}, {:d}) is out of range "
+                    "of {:d} fragments.",
+                    pair.source_id_, pair.target_id_, num_fragments);
+        }
+        if (option.point_to_plane_ &&
+            !fragments[pair.target_id_]->HasNormals()) {
+            utility::LogError(
+                    "[RegistrationPairwise] Point-to-plane ICP requires "
+                    "normals of the target fragments.");
+        }
+        needs_kdtree[pair.target_id_] = 1;
+        if (pair.has_init_) {
+            continue;
+        }
+        if (features.size() != fragments.size() ||
+            !features[pair.source_id_] || !features[pair.target_id_]) {
+            utility::LogError(
+                    "[RegistrationPairwise] Globally registered pairs require "
+                    "the features of both fragments.");
+        }
+        needs_feature_index[pair.target_id_] = 1;
+        if (option.mutual_filter_) {
+            needs_feature_index[pair.source_id_] = 1;
+        }
+    }
+    std::vector<std::unique_ptr<geometry::KDTreeFlann>> kdtrees(num_fragments);
+    std::vector<std::unique_ptr<geometry::KDTreeIndex>> feature_indices(
+            num_fragments);
+    utility::ParallelFor(0, num_fragments, [&](int64_t i) {
+        if (needs_kdtree[i]) {
+            kdtrees[i].reset(new geometry::KDTreeFlann(*fragments[i]));
+        }
+        if (needs_feature_index[i] && features[i]->Num() > 0) {
+            feature_indices[i].reset(new geometry::KDTreeIndex(*features[i]));
+        }
+    });
+
+    const TransformationEstimationPointToPoint point_to_point(false);
+    const TransformationEstimationPointToPlane point_to_plane;
+    const TransformationEstimation &icp_estimation =
+            option.point_to_plane_
+                    ? static_cast<const TransformationEstimation &>(
+                              point_to_plane)
+                    : point_to_point;
+    const CorrespondenceCheckerBasedOnEdgeLength edge_length_checker(
+            option.edge_length_threshold_);
+    const CorrespondenceCheckerBasedOnDistance distance_checker(
+            max_correspondence_distance);
+    std::vector<std::reference_wrapper<const CorrespondenceChecker>> checkers;
+    if (option.edge_length_threshold_ > 0.0) {
+        checkers.push_back(edge_length_checker);
+    }
+    checkers.push_back(distance_checker);
+    const geometry::KDTreeIndex no_index;
+
+    // Pairs differ widely in cost, so each one is a task of its own.
+    std::vector<PairwiseRegistrationResult> results(pairs.size());
+    utility::ParallelFor(0, int64_t(pairs.size()), [&](int64_t k) {
+        const RegistrationPair &pair = pairs[k];
+        const geometry::PointCloud &source = *fragments[pair.source_id_];
+        const geometry::PointCloud &target = *fragments[pair.target_id_];
+        const geometry::KDTreeFlann &kdtree = *kdtrees[pair.target_id_];
+        RegistrationResult registration;
+        if (pair.has_init_) {
+            registration = RegistrationICPWithKDTree(
+                    source, target, kdtree, max_correspondence_distance,
+                    pair.init_, icp_estimation, option.icp_criteria_);
+        } else {
+            const Feature &source_feature = *features[pair.source_id_];
+            const Feature &target_feature = *features[pair.target_id_];
+            if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+                return;
+            }
+            const CorrespondenceSet corres = CorrespondencesFromFeatures(
+                    source_feature, target_feature,
+                    option.mutual_filter_ ? *feature_indices[pair.source_id_]
+                                          : no_index,
+                    *feature_indices[pair.target_id_], option.mutual_filter_);
+            registration = RegistrationRANSACBasedOnFeatureCorrespondences(
+                    source, target, kdtree, corres,
+                    max_correspondence_distance, point_to_point,
+                    option.ransac_n_, checkers, option.ransac_criteria_);
+            if (registration.transformation_.isIdentity()) {
+                return;
+            }
+        }
+        // ICP and RANSAC both return the correspondences of their final
+        // transformation within max_correspondence_distance.
+        const Eigen::Matrix4d transformation = registration.transformation_;
+        const Eigen::Matrix6d information =
+                GetInformationMatrixFromCorrespondences(
+                        target, registration.correspondence_set_);
+        // information(5, 5) is the number of correspondences.
+        const size_t num_points =
+                std::min(source.points_.size(), target.points_.size());
+        if (!pair.has_init_ &&
+            information(5, 5) < option.min_overlap_ * double(num_points)) {
+            return;
+        }
+        PairwiseRegistrationResult &result = results[k];
+        result.success_ = true;
+        result.transformation_ = transformation;
+        result.information_ = information;
+        result.fitness_ = registration.fitness_;
+        result.inlier_rmse_ = registration.inlier_rmse_;
+    });
+    return results;
+}
 }  // namespace registration
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -37,11 +38,13 @@
 namespace open3d {
 
 namespace geometry {
+class CompactPointCloud;
 class PointCloud;
 }
 
 namespace registration {
 class Feature;
+class RegistrationTarget;
 
 /// \class ICPConvergenceCriteria
 ///
@@ -83,7 +86,8 @@ public:
 /// \brief Class that defines the convergence criteria of RANSAC.
 ///
 /// RANSAC algorithm stops if the iteration number hits max_iteration_, or the
-/// validation has been run for max_validation_ times.
+/// validation has been run for max_validation_ times, or enough iterations
+/// have been run to find an all-inlier sample with probability confidence_.
 /// Note that the validation is the most computational expensive operator in an
 /// iteration. Most iterations do not do full validation. It is crucial to
 /// control max_validation_ so that the computation time is acceptable.
@@ -94,9 +98,14 @@ public:
     /// \param max_iteration Maximum iteration before iteration stops.
     /// \param max_validation Maximum times the validation has been run before
     /// the iteration stops.
+    /// \param confidence Desired probability of drawing at least one sample
+    /// without outliers, in (0, 1]. 1 disables the early stopping.
     RANSACConvergenceCriteria(int max_iteration = 1000,
-                              int max_validation = 1000)
-        : max_iteration_(max_iteration), max_validation_(max_validation) {}
+                              int max_validation = 1000,
+                              double confidence = 1.0)
+        : max_iteration_(max_iteration),
+          max_validation_(max_validation),
+          confidence_(confidence) {}
     ~RANSACConvergenceCriteria() {}
 
 public:
@@ -104,6 +113,62 @@ public:
     int max_iteration_;
     /// Maximum times the validation has been run before the iteration stops.
     int max_validation_;
+    /// Desired probability of drawing at least one sample without outliers.
+    /// The number of iterations is reduced to what this requires, using the
+    /// fitness of the best result as the inlier ratio. 1 disables it.
+    double confidence_;
+};
+
+/// \enum RegistrationStopReason
+///
+/// \brief Why the iterations of a registration stopped.
+enum class RegistrationStopReason {
+    /// No iteration was run, e.g. for invalid arguments.
+    NotRun = 0,
+    /// The relative change of fitness and RMSE fell below the
+    /// ICPConvergenceCriteria.
+    Converged = 1,
+    /// The maximum number of iterations was reached.
+    MaxIteration = 2,
+    /// RANSAC reached RANSACConvergenceCriteria::max_validation_.
+    MaxValidation = 3,
+    /// RANSAC ran the iterations RANSACConvergenceCriteria::confidence_
+    /// requires for the fitness of the best result.
+    Confidence = 4,
+};
+
+/// \class RegistrationStatistics
+///
+/// \brief Counters and timing of a single registration call, filled by ICP,
+/// colored ICP, RANSAC and FastGlobalRegistration. Times are in milliseconds.
+class RegistrationStatistics {
+public:
+    RegistrationStatistics() {}
+    ~RegistrationStatistics() {}
+
+public:
+    /// Number of iterations run. For RANSAC, the number of hypotheses drawn.
+    int num_iterations_ = 0;
+    /// Why the iterations stopped.
+    RegistrationStopReason stop_reason_ = RegistrationStopReason::NotRun;
+    /// Correspondence search and evaluation of transformations. For RANSAC,
+    /// the preview and validation of the hypotheses, for
+    /// FastGlobalRegistration the feature matching.
+    double correspondence_time_ = 0;
+    /// Estimation of transformations. For RANSAC, this includes the
+    /// correspondence checkers.
+    double solve_time_ = 0;
+    /// Duration of the whole call.
+    double total_time_ = 0;
+    /// Duration of every ICP iteration.
+    std::vector<double> iteration_times_;
+    /// Number of RANSAC hypotheses rejected by the correspondence checkers.
+    int num_rejected_by_checkers_ = 0;
+    /// Number of RANSAC hypotheses rejected by the preview on a subset of the
+    /// points.
+    int num_rejected_by_preview_ = 0;
+    /// Number of RANSAC hypotheses validated on all points.
+    int num_validations_ = 0;
 };
 
 /// \class RegistrationResult
@@ -129,6 +194,143 @@ public:
     /// The overlapping area (# of inlier correspondences / # of points in
     /// target). Higher is better.
     double fitness_;
+    /// How the result was computed. Only set by the registration functions.
+    RegistrationStatistics statistics_;
+};
+
+/// \class PairwiseRegistrationOption
+///
+/// \brief Option for RegistrationPairwise. The defaults follow the fragment
+/// registration of the reconstruction system for a voxel size of 0.05.
+class PairwiseRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance of RANSAC, ICP and the information matrix.
+    /// \param point_to_plane Use point-to-plane ICP, which requires normals of
+    /// the target fragments. Otherwise point-to-point ICP is used.
+    /// \param min_overlap Globally registered pairs fail if fewer than this
+    /// ratio of the points of the smaller fragment have a correspondence.
+    PairwiseRegistrationOption(double max_correspondence_distance = 0.07,
+                               bool point_to_plane = true,
+                               double min_overlap = 0.3)
+        : max_correspondence_distance_(max_correspondence_distance),
+          point_to_plane_(point_to_plane),
+          min_overlap_(min_overlap) {}
+    ~PairwiseRegistrationOption() {}
+
+public:
+    /// Maximum correspondence points-pair distance of RANSAC, ICP and the
+    /// information matrix.
+    double max_correspondence_distance_;
+    /// Use point-to-plane ICP, otherwise point-to-point ICP.
+    bool point_to_plane_;
+    /// Minimum overlap of globally registered pairs.
+    double min_overlap_;
+    /// Number of feature correspondences a RANSAC hypothesis is fit to.
+    int ransac_n_ = 4;
+    /// Similarity threshold of CorrespondenceCheckerBasedOnEdgeLength, or 0
+    /// to skip the check.
+    double edge_length_threshold_ = 0.9;
+    /// Only sample from mutually nearest feature pairs.
+    bool mutual_filter_ = false;
+    /// Convergence criteria of RANSAC.
+    RANSACConvergenceCriteria ransac_criteria_ =
+            RANSACConvergenceCriteria(4000000, 500);
+    /// Convergence criteria of ICP.
+    ICPConvergenceCriteria icp_criteria_ =
+            ICPConvergenceCriteria(1e-6, 1e-6, 50);
+};
+
+/// \class RegistrationPair
+///
+/// \brief Pair of fragments registered by RegistrationPairwise.
+///
+/// A pair with an initial transformation, e.g. from odometry between
+/// consecutive fragments, is refined with ICP. A pair without one is
+/// registered globally with RANSAC on the features of the fragments.
+class RegistrationPair {
+public:
+    /// \brief Parameterized Constructor for global registration.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    RegistrationPair(int source_id = 0, int target_id = 0)
+        : source_id_(source_id), target_id_(target_id) {}
+    /// \brief Parameterized Constructor for ICP from \p init.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    /// \param init Initial transformation from source to target.
+    RegistrationPair(int source_id, int target_id, const Eigen::Matrix4d &init)
+        : source_id_(source_id),
+          target_id_(target_id),
+          has_init_(true),
+          init_(init) {}
+    ~RegistrationPair() {}
+
+public:
+    /// Index of the source fragment.
+    int source_id_;
+    /// Index of the target fragment.
+    int target_id_;
+    /// Whether the pair is refined from init_ instead of being registered
+    /// globally.
+    bool has_init_ = false;
+    /// Initial transformation from source to target.
+    Eigen::Matrix4d_u init_ = Eigen::Matrix4d_u::Identity();
+};
+
+/// \class PairwiseRegistrationResult
+///
+/// \brief Result of one pair of RegistrationPairwise.
+class PairwiseRegistrationResult {
+public:
+    PairwiseRegistrationResult() {}
+    ~PairwiseRegistrationResult() {}
+
+public:
+    /// Whether the registration succeeded. Failed pairs have an identity
+    /// transformation and a zero information matrix.
+    bool success_ = false;
+    /// The estimated transformation from source to target.
+    Eigen::Matrix4d_u transformation_ = Eigen::Matrix4d_u::Identity();
+    /// The information matrix of the transformation, see
+    /// GetInformationMatrixFromPointClouds().
+    Eigen::Matrix6d_u information_ = Eigen::Matrix6d_u::Zero();
+    /// Fitness of the transformation.
+    double fitness_ = 0.0;
+    /// Inlier RMSE of the transformation.
+    double inlier_rmse_ = 0.0;
+};
+
+/// \class MultiScaleICPLevelStatistics
+///
+/// \brief Per-level timing and result of RegistrationMultiScaleICP. Times are
+/// in milliseconds.
+class MultiScaleICPLevelStatistics {
+public:
+    MultiScaleICPLevelStatistics() {}
+    ~MultiScaleICPLevelStatistics() {}
+
+public:
+    /// Voxel size the level was downsampled with, 0 for full resolution.
+    double voxel_size_ = 0;
+    /// Number of source points at this level.
+    size_t num_source_points_ = 0;
+    /// Number of target points at this level.
+    size_t num_target_points_ = 0;
+    /// Number of ICP iterations run at this level.
+    int num_iterations_ = 0;
+    /// Fitness of the result of this level.
+    double fitness_ = 0;
+    /// Inlier RMSE of the result of this level.
+    double inlier_rmse_ = 0;
+    /// Downsampling, normal estimation and building the target KDTree.
+    double preprocessing_time_ = 0;
+    /// ICP iterations.
+    double registration_time_ = 0;
 };
 
 /// \brief Function for evaluating registration between point clouds.
@@ -164,9 +366,88 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Function for ICP registration against a prebuilt target.
+///
+/// The KDTree of \p target is reused instead of being built for every call.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its KDTree.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for ICP registration of single precision point clouds.
+///
+/// The correspondences are searched in a KDTreeIndex built on the float
+/// points of \p target, and the transformation is estimated in double
+/// precision without converting the point clouds.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method, either
+/// TransformationEstimationPointToPoint without scaling or
+/// TransformationEstimationPointToPlane.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::CompactPointCloud &source,
+        const geometry::CompactPointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Level i downsamples both point clouds with voxel_sizes[i] and runs ICP with
+/// max_correspondence_distances[i] and criteria[i], starting from the result
+/// of the previous level. All levels are prepared once and every level builds
+/// a single KDTree of its target. If \p estimation is point-to-plane and the
+/// target has no normals, they are estimated from at most 30 neighbors within
+/// twice the voxel size.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size of every level, usually decreasing. A voxel
+/// size <= 0 uses the full resolution point clouds.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of every level.
+/// \param criteria Convergence criteria of every level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \return The result of the last level and the statistics of every level.
+std::tuple<RegistrationResult, std::vector<MultiScaleICPLevelStatistics>>
+RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const std::vector<ICPConvergenceCriteria> &criteria,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false));
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
+/// Every hypothesis is first scored on a random subset of \p corres and is
+/// rejected early if it is unlikely to beat the best one. Only the remaining
+/// hypotheses are validated on all correspondences, which counts towards
+/// max_validation_.
+///
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param corres Checker class to check if two point clouds can be aligned.
@@ -188,6 +469,15 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 
 /// \brief Function for global RANSAC registration based on feature matching.
 ///
+/// The feature correspondences are computed once with
+/// CorrespondencesFromFeatures(), and hypotheses are sampled from them.
+/// Hypotheses are drawn in parallel batches, and all of them are validated
+/// against one KDTree of \p target. The \p checkers run on whole batches
+/// through a CorrespondenceCheckerSchedule, so their order does not matter.
+/// Every hypothesis is first scored on a
+/// random subset of \p source and is rejected early if it is unlikely to beat
+/// the best one.
+///
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param source_feature Source point cloud feature.
@@ -195,6 +485,7 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param max_correspondence_distance Maximum correspondence points-pair
 /// distance. \param ransac_n Fit ransac with `ransac_n` correspondences. \param
 /// checkers Correspondence checker. \param criteria Convergence criteria.
+/// \param mutual_filter Only sample from mutually nearest feature pairs.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -206,8 +497,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         int ransac_n = 4,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
-        const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        bool mutual_filter = false);
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -220,5 +511,38 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation);
 
+/// \brief Function for computing the information matrix from the
+/// correspondences of a transformation, e.g. the correspondence_set_ of the
+/// RegistrationResult of ICP, without searching them again.
+///
+/// Equal to GetInformationMatrixFromPointClouds() when \p corres are the
+/// correspondences of its transformation and max_correspondence_distance.
+///
+/// \param target The target point cloud.
+/// \param corres Correspondences between source and target points.
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target, const CorrespondenceSet &corres);
+
+/// \brief Function for registering many pairs of fragments, e.g. to build the
+/// pose graph of a scene.
+///
+/// KDTrees of the points and features of every fragment are built once, in
+/// parallel, and shared by all pairs. The pairs are then registered in
+/// parallel, see RegistrationPair, and get the information matrix of their
+/// transformation.
+///
+/// \param fragments The fragments, usually downsampled.
+/// \param features Features of the fragments, e.g. FPFH. Only required if a
+/// pair is registered globally.
+/// \param pairs Pairs of fragment indices to register.
+/// \param option Registration option.
+/// \return The result of every pair.
+std::vector<PairwiseRegistrationResult> RegistrationPairwise(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<std::shared_ptr<Feature>> &features,
+        const std::vector<RegistrationPair> &pairs,
+        const PairwiseRegistrationOption &option =
+                PairwiseRegistrationOption());
+
 }  // namespace registration
 }  // namespace open3d
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RegistrationTarget.h"
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace registration {
+
+RegistrationTarget::RegistrationTarget(
+        const geometry::PointCloud &target,
+        double color_gradient_radius /* = 0.0*/)
+    : point_cloud_(target) {
+    kdtree_.SetGeometry(point_cloud_);
+    if (color_gradient_radius <= 0.0) {
+        return;
+    }
+    if (!point_cloud_.HasNormals() || !point_cloud_.HasColors()) {
+        utility::LogError(
+                "[RegistrationTarget] Color gradients require normals and "
+                "colors.");
+    }
+    utility::LogDebug("[RegistrationTarget] Computing color gradients.");
+
+    // The neighborhoods of all points are searched in one batch.
+    const auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            point_cloud_,
+            geometry::KDTreeSearchParamHybrid(color_gradient_radius, 30));
+    const auto &points = point_cloud_.points_;
+    const auto &normals = point_cloud_.normals_;
+    const auto &colors = point_cloud_.colors_;
+    color_gradients_.resize(points.size(), Eigen::Vector3d::Zero());
+    utility::ParallelFor(0, int64_t(points.size()), [&](int64_t k) {
+        const int64_t nn = graph->NumNeighbors(k);
+        if (nn < 4) {
+            return;
+        }
+        const Eigen::Vector3d &vt = points[k];
+        const Eigen::Vector3d &nt = normals[k];
+        double it = (colors[k](0) + colors[k](1) + colors[k](2)) / 3.0;
+
+        // approximate image gradient of vt's tangential plane by least
+        // squares, accumulating the normal equations directly. The first
+        // neighbor is vt itself.
+        Eigen::Matrix3d ATA = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d ATb = Eigen::Vector3d::Zero();
+        const int *neighbors = graph->indices_.data() + graph->offsets_[k];
+        for (int64_t i = 1; i < nn; i++) {
+            int P_adj_idx = neighbors[i];
+            const Eigen::Vector3d &vt_adj = points[P_adj_idx];
+            Eigen::Vector3d a = (vt_adj - vt) - (vt_adj - vt).dot(nt) * nt;
+            double it_adj = (colors[P_adj_idx](0) + colors[P_adj_idx](1) +
+                             colors[P_adj_idx](2)) /
+                            3.0;
+            ATA.noalias() += a * a.transpose();
+            ATb.noalias() += a * (it_adj - it);
+        }
+        // adds orthogonal constraint
+        const Eigen::Vector3d a = double(nn - 1) * nt;
+        ATA.noalias() += a * a.transpose();
+        // solving linear equation
+        bool is_success;
+        Eigen::VectorXd x;
+        std::tie(is_success, x) = utility::SolveLinearSystemPSD(ATA, ATb);
+        if (is_success) {
+            color_gradients_[k] = x;
+        }
+    });
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+namespace open3d {
+namespace registration {
+
+/// \class RegistrationTarget
+///
+/// \brief Target point cloud that is registered against many times, e.g. a
+/// static map.
+///
+/// The KDTree of the target and, optionally, the color gradients needed by
+/// colored ICP are computed once by the constructor. The overloads of
+/// RegistrationICP and RegistrationColoredICP that take a RegistrationTarget
+/// reuse them, and may be called concurrently.
+class RegistrationTarget {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud. It is copied.
+    /// \param color_gradient_radius If positive, the color gradients for
+    /// colored ICP are computed from at most 30 neighbors within this radius.
+    /// This requires normals and colors.
+    explicit RegistrationTarget(const geometry::PointCloud &target,
+                                double color_gradient_radius = 0.0);
+    ~RegistrationTarget() {}
+    RegistrationTarget(const RegistrationTarget &) = delete;
+    RegistrationTarget &operator=(const RegistrationTarget &) = delete;
+
+public:
+    /// Returns the target point cloud.
+    const geometry::PointCloud &GetPointCloud() const { return point_cloud_; }
+    /// Returns the KDTree of the target point cloud.
+    const geometry::KDTreeFlann &GetKDTree() const { return kdtree_; }
+    /// Returns true if the color gradients have been computed.
+    bool HasColorGradients() const {
+        return !point_cloud_.IsEmpty() &&
+               color_gradients_.size() == point_cloud_.points_.size();
+    }
+    /// Returns the color gradient of every target point.
+    const std::vector<Eigen::Vector3d> &GetColorGradients() const {
+        return color_gradients_;
+    }
+
+private:
+    geometry::PointCloud point_cloud_;
+    geometry::KDTreeFlann kdtree_;
+    std::vector<Eigen::Vector3d> color_gradients_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+namespace open3d {
+namespace registration {
+
+/// \class RobustKernel
+///
+/// Base class of the robust loss functions (M-estimators) used by ICP.
+///
+/// The loss rho(r) of a residual r is minimized by iteratively reweighted
+/// least squares: every linearization weights the residual by
+/// w(r) = rho'(r) / r. The virtual function Weight() must be implemented in
+/// subclasses.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+
+public:
+    /// Returns the IRLS weight w(r) of a residual.
+    ///
+    /// \param residual Signed residual.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// Plain least squares, rho(r) = r^2 / 2. Every residual has weight 1.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double /*residual*/) const override { return 1.0; }
+};
+
+/// \class HuberLoss
+///
+/// Quadratic for |r| <= k and linear beyond.
+class HuberLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual at which the loss becomes linear.
+    explicit HuberLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        const double e = std::abs(residual);
+        return e <= k_ ? 1.0 : k_ / e;
+    }
+
+public:
+    /// Residual at which the loss becomes linear.
+    double k_;
+};
+
+/// \class CauchyLoss
+///
+/// rho(r) = k^2 / 2 * log(1 + (r / k)^2).
+class CauchyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the residuals.
+    explicit CauchyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        const double e = residual / k_;
+        return 1.0 / (1.0 + e * e);
+    }
+
+public:
+    /// Scale of the residuals.
+    double k_;
+};
+
+/// \class GMLoss
+///
+/// Geman-McClure loss, rho(r) = r^2 / 2 / (1 + (r / k)^2).
+class GMLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Scale of the residuals.
+    explicit GMLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        const double e = residual / k_;
+        const double d = 1.0 + e * e;
+        return 1.0 / (d * d);
+    }
+
+public:
+    /// Scale of the residuals.
+    double k_;
+};
+
+/// \class TukeyLoss
+///
+/// Tukey's biweight. Residuals larger than k are ignored entirely.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param k Residual beyond which the weight is zero.
+    explicit TukeyLoss(double k) : k_(k) {}
+
+public:
+    double Weight(double residual) const override {
+        const double e = residual / k_;
+        if (std::abs(e) > 1.0) {
+            return 0.0;
+        }
+        const double d = 1.0 - e * e;
+        return d * d;
+    }
+
+public:
+    /// Residual beyond which the weight is zero.
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
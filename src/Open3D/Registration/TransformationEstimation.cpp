@@ -89,6 +89,10 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
         r = (vs - vt).dot(nt);
         J_r.block<3, 1>(0, 0) = vs.cross(nt);
         J_r.block<3, 1>(3, 0) = nt;
+        // Scaling both by sqrt(w) weights the normal equations by w.
+        const double sqrt_w = std::sqrt(kernel_->Weight(r));
+        r *= sqrt_w;
+        J_r *= sqrt_w;
     };
 
     Eigen::Matrix6d JTJ;
@@ -31,6 +31,8 @@
 #include <string>
 #include <vector>
 
+#include "Open3D/Registration/RobustKernel.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -46,6 +48,7 @@ enum class TransformationEstimationType {
     PointToPoint = 1,
     PointToPlane = 2,
     ColoredICP = 3,
+    GeneralizedICP = 4,
 };
 
 /// \class TransformationEstimation
@@ -130,6 +133,12 @@ class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
     /// \brief Default Constructor.
     TransformationEstimationPointToPlane() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kernel Robust kernel that weights the point to plane residuals.
+    explicit TransformationEstimationPointToPlane(
+            std::shared_ptr<RobustKernel> kernel)
+        : kernel_(std::move(kernel)) {}
     ~TransformationEstimationPointToPlane() override {}
 
 public:
@@ -145,6 +154,11 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel that weights the point to plane residuals. L2Loss gives
+    /// plain least squares.
+    std::shared_ptr<RobustKernel> kernel_ = std::make_shared<L2Loss>();
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/Image.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Open3D/TGeometry/ImageKernel.h"
+#include "Open3D/TGeometry/KernelLauncher.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tgeometry {
+
+namespace {
+
+const std::vector<float> Gaussian3 = {0.25f, 0.5f, 0.25f};
+const std::vector<float> Gaussian5 = {0.0625f, 0.25f, 0.375f, 0.25f, 0.0625f};
+const std::vector<float> Gaussian7 = {0.03125f, 0.109375f, 0.21875f,
+                                      0.28125f, 0.21875f,  0.109375f,
+                                      0.03125f};
+const std::vector<float> Sobel31 = {-1.0f, 0.0f, 1.0f};
+const std::vector<float> Sobel32 = {1.0f, 2.0f, 1.0f};
+
+Dtype DtypeFromBytesPerChannel(int bytes_per_channel) {
+    switch (bytes_per_channel) {
+        case 1:
+            return Dtype::UInt8;
+        case 2:
+            return Dtype::UInt16;
+        case 4:
+            return Dtype::Float32;
+        default:
+            utility::LogError("Unsupported image with {} bytes per channel.",
+                              bytes_per_channel);
+    }
+    return Dtype::Undefined;
+}
+
+}  // namespace
+
+Image::Image(int64_t rows,
+             int64_t cols,
+             int64_t channels,
+             Dtype dtype,
+             const Device& device)
+    : Geometry(Geometry::GeometryType::Image, 2),
+      data_({rows, cols, channels}, dtype, device) {
+    if (rows < 0 || cols < 0 || channels <= 0) {
+        utility::LogError("Invalid image size {} x {} x {}.", rows, cols,
+                          channels);
+    }
+}
+
+Image::Image(const Tensor& tensor)
+    : Geometry(Geometry::GeometryType::Image, 2) {
+    const SizeVector shape = tensor.GetShape();
+    if (shape.size() == 2) {
+        data_ = tensor.Contiguous().Reshape({shape[0], shape[1], 1});
+    } else if (shape.size() == 3) {
+        data_ = tensor.Contiguous();
+    } else {
+        utility::LogError(
+                "Image tensors must have shape (rows, cols) or (rows, cols, "
+                "channels), but {} is used.",
+                shape.ToString());
+    }
+}
+
+Image& Image::Clear() {
+    data_ = Tensor({0, 0, GetChannels()}, GetDtype(), GetDevice());
+    return *this;
+}
+
+Image Image::Copy(const Device& device) const {
+    return Image(data_.Copy(device));
+}
+
+Image Image::ConvertDepthToFloat(double depth_scale, double depth_max) const {
+    if (GetChannels() != 1 ||
+        (GetDtype() != Dtype::UInt16 && GetDtype() != Dtype::Float32)) {
+        utility::LogError(
+                "[ConvertDepthToFloat] Only single channel UInt16 and Float32 "
+                "images are supported.");
+    }
+    Image output(GetRows(), GetCols(), 1, Dtype::Float32, GetDevice());
+    const ConvertDepthKernel kernel = {
+            data_.GetDataPtr(), GetDtype() == Dtype::UInt16,
+            float(depth_scale), float(depth_max),
+            static_cast<float*>(output.data_.GetDataPtr())};
+    Launch(GetDevice(), GetRows() * GetCols(), kernel);
+    return output;
+}
+
+Image Image::Filter(geometry::Image::FilterType type) const {
+    AssertFloatChannel("Filter");
+    switch (type) {
+        case geometry::Image::FilterType::Gaussian3:
+            return FilterSeparable(Gaussian3, Gaussian3);
+        case geometry::Image::FilterType::Gaussian5:
+            return FilterSeparable(Gaussian5, Gaussian5);
+        case geometry::Image::FilterType::Gaussian7:
+            return FilterSeparable(Gaussian7, Gaussian7);
+        case geometry::Image::FilterType::Sobel3Dx:
+            return FilterSeparable(Sobel31, Sobel32);
+        case geometry::Image::FilterType::Sobel3Dy:
+            return FilterSeparable(Sobel32, Sobel31);
+        default:
+            utility::LogError("[Filter] Unsupported filter type.");
+    }
+    return Image();
+}
+
+Image Image::FilterBilateral(int64_t kernel_size,
+                             double value_sigma,
+                             double distance_sigma) const {
+    AssertFloatChannel("FilterBilateral");
+    if (kernel_size <= 0 || kernel_size % 2 == 0) {
+        utility::LogError(
+                "[FilterBilateral] The kernel size must be odd, but {} is "
+                "used.",
+                kernel_size);
+    }
+    if (value_sigma <= 0 || distance_sigma <= 0) {
+        utility::LogError("[FilterBilateral] Sigmas must be positive.");
+    }
+    Image output(GetRows(), GetCols(), 1, Dtype::Float32, GetDevice());
+    const BilateralFilterKernel kernel = {
+            static_cast<const float*>(data_.GetDataPtr()),
+            static_cast<float*>(output.data_.GetDataPtr()),
+            GetCols(),
+            GetRows(),
+            kernel_size / 2,
+            float(-0.5 / (value_sigma * value_sigma)),
+            float(-0.5 / (distance_sigma * distance_sigma))};
+    Launch(GetDevice(), GetRows() * GetCols(), kernel);
+    return output;
+}
+
+Image Image::Downsample() const {
+    AssertFloatChannel("Downsample");
+    Image output(GetRows() / 2, GetCols() / 2, 1, Dtype::Float32, GetDevice());
+    const DownsampleKernel kernel = {
+            static_cast<const float*>(data_.GetDataPtr()),
+            static_cast<float*>(output.data_.GetDataPtr()), GetCols(),
+            output.GetCols()};
+    Launch(GetDevice(), output.GetRows() * output.GetCols(), kernel);
+    return output;
+}
+
+std::vector<Image> Image::CreatePyramid(size_t num_of_levels,
+                                        bool with_gaussian_filter) const {
+    AssertFloatChannel("CreatePyramid");
+    std::vector<Image> pyramid;
+    pyramid.reserve(num_of_levels);
+    for (size_t i = 0; i < num_of_levels; i++) {
+        if (i == 0) {
+            pyramid.push_back(Copy(GetDevice()));
+        } else if (with_gaussian_filter) {
+            pyramid.push_back(
+                    pyramid[i - 1]
+                            .Filter(geometry::Image::FilterType::Gaussian3)
+                            .Downsample());
+        } else {
+            pyramid.push_back(pyramid[i - 1].Downsample());
+        }
+    }
+    return pyramid;
+}
+
+Image Image::FromLegacyImage(const geometry::Image& image_legacy,
+                             const Device& device) {
+    if (image_legacy.IsEmpty()) {
+        return Image(0, 0, 1, Dtype::Float32, device);
+    }
+    Image image(image_legacy.height_, image_legacy.width_,
+                image_legacy.num_of_channels_,
+                DtypeFromBytesPerChannel(image_legacy.bytes_per_channel_),
+                Device("CPU:0"));
+    std::memcpy(image.data_.GetDataPtr(), image_legacy.data_.data(),
+                image_legacy.data_.size());
+    return device == Device("CPU:0") ? image : image.Copy(device);
+}
+
+geometry::Image Image::ToLegacyImage() const {
+    geometry::Image image_legacy;
+    if (IsEmpty()) {
+        return image_legacy;
+    }
+    const Tensor host = data_.Copy(Device("CPU:0"));
+    image_legacy.Prepare(int(GetCols()), int(GetRows()), int(GetChannels()),
+                         int(DtypeUtil::ByteSize(GetDtype())));
+    std::memcpy(image_legacy.data_.data(), host.GetDataPtr(),
+                image_legacy.data_.size());
+    return image_legacy;
+}
+
+void Image::AssertFloatChannel(const std::string& function) const {
+    if (GetChannels() != 1 || GetDtype() != Dtype::Float32) {
+        utility::LogError(
+                "[{}] Only single channel Float32 images are supported.",
+                function);
+    }
+}
+
+Image Image::FilterSeparable(const std::vector<float>& dx,
+                             const std::vector<float>& dy) const {
+    const int64_t n = GetRows() * GetCols();
+    Image temp(GetRows(), GetCols(), 1, Dtype::Float32, GetDevice());
+    Image output(GetRows(), GetCols(), 1, Dtype::Float32, GetDevice());
+    FilterKernel kernel;
+    kernel.input_ = static_cast<const float*>(data_.GetDataPtr());
+    kernel.output_ = static_cast<float*>(temp.data_.GetDataPtr());
+    kernel.width_ = GetCols();
+    kernel.height_ = GetRows();
+    kernel.num_taps_ = int64_t(dx.size());
+    kernel.horizontal_ = true;
+    std::copy(dx.begin(), dx.end(), kernel.taps_);
+    Launch(GetDevice(), n, kernel);
+
+    kernel.input_ = static_cast<const float*>(temp.data_.GetDataPtr());
+    kernel.output_ = static_cast<float*>(output.data_.GetDataPtr());
+    kernel.num_taps_ = int64_t(dy.size());
+    kernel.horizontal_ = false;
+    std::copy(dy.begin(), dy.end(), kernel.taps_);
+    Launch(GetDevice(), n, kernel);
+    return output;
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
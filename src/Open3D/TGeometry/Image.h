@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/TGeometry/Geometry.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// \class Image
+///
+/// \brief An image whose pixels are stored in a Tensor of shape
+/// (rows, cols, channels) on any Device.
+///
+/// UInt8, UInt16 and Float32 images correspond to the 1, 2 and 4 bytes per
+/// channel of geometry::Image. As in geometry::Image, filters and pyramids
+/// work on single channel Float32 images and depth is converted to Float32
+/// meters first. All operations run on the image's device and return new
+/// images on the same device.
+///
+/// Example:
+/// ```cpp
+/// tgeometry::Image depth = tgeometry::Image::FromLegacyImage(
+///         depth_legacy, Device("CUDA:0"));
+/// tgeometry::Image depth_m = depth.ConvertDepthToFloat(1000.0, 3.0);
+/// std::vector<tgeometry::Image> pyramid = depth_m.CreatePyramid(4);
+/// ```
+class Image : public Geometry {
+public:
+    /// \brief Constructs an image of \p rows x \p cols pixels with
+    /// \p channels values each. The pixels are uninitialized.
+    Image(int64_t rows = 0,
+          int64_t cols = 0,
+          int64_t channels = 1,
+          Dtype dtype = Dtype::Float32,
+          const Device& device = Device("CPU:0"));
+
+    /// \brief Constructs an image from \p tensor of shape (rows, cols) or
+    /// (rows, cols, channels). A contiguous tensor shares its memory with the
+    /// image.
+    Image(const Tensor& tensor);
+
+    ~Image() override {}
+
+public:
+    /// Removes all pixels; the dtype, channels and device are kept.
+    Image& Clear() override;
+
+    /// Returns `true` iff the image has no pixels.
+    bool IsEmpty() const override { return GetRows() * GetCols() == 0; }
+
+    int64_t GetRows() const { return data_.GetShape(0); }
+    int64_t GetCols() const { return data_.GetShape(1); }
+    int64_t GetChannels() const { return data_.GetShape(2); }
+    Dtype GetDtype() const { return data_.GetDtype(); }
+    Device GetDevice() const { return data_.GetDevice(); }
+
+    /// Returns the pixels as a Tensor of shape (rows, cols, channels), which
+    /// shares the memory of the image.
+    Tensor AsTensor() const { return data_; }
+
+    /// Returns a deep copy of the image on \p device.
+    Image Copy(const Device& device) const;
+
+    /// \brief Converts a single channel UInt16 or Float32 depth image to
+    /// Float32 meters, as geometry::Image::ConvertDepthToFloatImage.
+    ///
+    /// \param depth_scale Raw depth per meter.
+    /// \param depth_max Depth at and beyond \p depth_max becomes 0.
+    Image ConvertDepthToFloat(double depth_scale = 1000.0,
+                              double depth_max = 3.0) const;
+
+    /// Filters a single channel Float32 image with the separable filter
+    /// \p type, as geometry::Image::Filter.
+    Image Filter(geometry::Image::FilterType type) const;
+
+    /// \brief Bilateral filter of a single channel Float32 image, typically
+    /// depth in meters.
+    ///
+    /// Every pixel becomes the average of its \p kernel_size x \p kernel_size
+    /// window, weighted by the Gaussians of the difference of the values and
+    /// of the distance of the pixels. Zero pixels, i.e. missing depth, stay
+    /// zero and are ignored by their neighbors.
+    ///
+    /// \param kernel_size Odd window size.
+    /// \param value_sigma Standard deviation of the values.
+    /// \param distance_sigma Standard deviation of the distance, in pixels.
+    Image FilterBilateral(int64_t kernel_size = 5,
+                          double value_sigma = 0.05,
+                          double distance_sigma = 3.0) const;
+
+    /// Averages the 2x2 blocks of a single channel Float32 image, as
+    /// geometry::Image::Downsample.
+    Image Downsample() const;
+
+    /// \brief Returns \p num_of_levels images of halving size, starting with
+    /// a copy of this single channel Float32 image, as
+    /// geometry::Image::CreatePyramid.
+    ///
+    /// \param with_gaussian_filter Whether each level is filtered with
+    /// Gaussian3 before it is downsampled.
+    std::vector<Image> CreatePyramid(size_t num_of_levels,
+                                     bool with_gaussian_filter = true) const;
+
+    /// \brief Converts a geometry::Image with 1, 2 or 4 bytes per channel to
+    /// a UInt8, UInt16 or Float32 image on \p device.
+    static Image FromLegacyImage(const geometry::Image& image_legacy,
+                                 const Device& device = Device("CPU:0"));
+
+    /// Converts the image to a geometry::Image on the host.
+    geometry::Image ToLegacyImage() const;
+
+protected:
+    /// Throws unless the image is a single channel Float32 image.
+    void AssertFloatChannel(const std::string& function) const;
+
+    /// Runs a horizontal and a vertical pass of separable taps.
+    Image FilterSeparable(const std::vector<float>& dx,
+                          const std::vector<float>& dy) const;
+
+protected:
+    /// Pixels of shape (rows, cols, channels).
+    Tensor data_;
+};
+
+}  // namespace tgeometry
+}  // namespace open3d
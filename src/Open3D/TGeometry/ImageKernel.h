@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file ImageKernel.h
+///
+/// Image kernels shared by the CPU and CUDA backends of tgeometry::Image and
+/// of the back-projection of tgeometry::PointCloud. Images are contiguous
+/// buffers of width * height pixels. Filters and pyramids work on single
+/// channel Float32 images and reproduce geometry::Image value for value.
+///
+/// Kernels are functors whose operator()(i) handles output pixel i and are
+/// run over [0, n) by LaunchCPU or LaunchCUDA.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// Maximum number of taps of a separable filter.
+constexpr int64_t IMAGE_FILTER_MAX_TAPS = 7;
+
+/// Reads the raw value of pixel \p i of a UInt16 or Float32 depth image.
+OPEN3D_HOST_DEVICE inline float ReadRawDepth(const void* depth,
+                                             bool is_uint16,
+                                             int64_t i) {
+    return is_uint16 ? float(static_cast<const uint16_t*>(depth)[i])
+                     : static_cast<const float*>(depth)[i];
+}
+
+/// Converts a UInt16 or Float32 depth image to meters, with 0 at and beyond
+/// max_depth_, as geometry::Image::ConvertDepthToFloatImage.
+struct ConvertDepthKernel {
+    const void* depth_;
+    bool depth_is_uint16_;
+    /// Raw depth per meter.
+    float depth_scale_;
+    float max_depth_;
+    float* output_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const float depth =
+                ReadRawDepth(depth_, depth_is_uint16_, i) / depth_scale_;
+        output_[i] = depth >= max_depth_ ? 0.0f : depth;
+    }
+};
+
+/// Filters the rows or the columns of an image with num_taps_ taps centered
+/// on the pixel, the border pixels are repeated. Two passes apply the
+/// separable filters of geometry::Image::Filter.
+struct FilterKernel {
+    const float* input_;
+    float* output_;
+    int64_t width_;
+    int64_t height_;
+    float taps_[IMAGE_FILTER_MAX_TAPS];
+    int64_t num_taps_;
+    bool horizontal_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % width_;
+        const int64_t v = i / width_;
+        const int64_t half = num_taps_ / 2;
+        double sum = 0.0;
+        for (int64_t k = 0; k < num_taps_; ++k) {
+            int64_t j;
+            if (horizontal_) {
+                const int64_t x = u + k - half;
+                j = v * width_ + (x < 0 ? 0 : (x >= width_ ? width_ - 1 : x));
+            } else {
+                const int64_t y = v + k - half;
+                j = (y < 0 ? 0 : (y >= height_ ? height_ - 1 : y)) * width_ +
+                    u;
+            }
+            sum += input_[j] * taps_[k];
+        }
+        output_[i] = float(sum);
+    }
+};
+
+/// Averages the 2x2 blocks of an image of input_width_ columns into pixel i
+/// of an image of half the size.
+struct DownsampleKernel {
+    const float* input_;
+    float* output_;
+    int64_t input_width_;
+    int64_t output_width_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t x = 2 * (i % output_width_);
+        const int64_t y = 2 * (i / output_width_);
+        const float* p1 = input_ + y * input_width_ + x;
+        const float* p2 = p1 + input_width_;
+        output_[i] = (p1[0] + p1[1] + p2[0] + p2[1]) / 4.0f;
+    }
+};
+
+/// Bilateral filter over the (2 radius_ + 1)^2 window of every pixel. Zero
+/// pixels, i.e. missing depth, stay zero and are ignored by their neighbors.
+struct BilateralFilterKernel {
+    const float* input_;
+    float* output_;
+    int64_t width_;
+    int64_t height_;
+    int64_t radius_;
+    /// -1 / (2 sigma^2) of the value and of the pixel distance.
+    float value_coeff_;
+    float distance_coeff_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % width_;
+        const int64_t v = i / width_;
+        const float center = input_[i];
+        if (center == 0.0f) {
+            output_[i] = 0.0f;
+            return;
+        }
+        float sum = 0.0f;
+        float weight_sum = 0.0f;
+        for (int64_t y = v - radius_; y <= v + radius_; ++y) {
+            for (int64_t x = u - radius_; x <= u + radius_; ++x) {
+                if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+                    continue;
+                }
+                const float value = input_[y * width_ + x];
+                if (value == 0.0f) {
+                    continue;
+                }
+                const float dv = value - center;
+                const float d2 = float((x - u) * (x - u) + (y - v) * (y - v));
+                const float weight = expf(value_coeff_ * dv * dv +
+                                          distance_coeff_ * d2);
+                sum += weight * value;
+                weight_sum += weight;
+            }
+        }
+        output_[i] = sum / weight_sum;
+    }
+};
+
+/// Back-projects every stride_-th pixel of a depth image to a point in the
+/// world, as geometry::PointCloud::CreateFromDepthImage. valid_ is false
+/// where the depth is not in (0, max_depth_).
+struct UnprojectKernel {
+    const void* depth_;
+    bool depth_is_uint16_;
+    float depth_scale_;
+    float max_depth_;
+    /// Width of the depth image.
+    int64_t width_;
+    /// Number of sampled columns.
+    int64_t output_width_;
+    int64_t stride_;
+    double fx_, fy_, cx_, cy_;
+    /// Camera to world transformation [R | t], the inverse of the extrinsic.
+    double pose_[3][4];
+    float* points_;
+    bool* valid_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = stride_ * (i % output_width_);
+        const int64_t v = stride_ * (i / output_width_);
+        const float z =
+                ReadRawDepth(depth_, depth_is_uint16_, v * width_ + u) /
+                depth_scale_;
+        valid_[i] = z > 0.0f && z < max_depth_;
+        const double p[3] = {(double(u) - cx_) * z / fx_,
+                             (double(v) - cy_) * z / fy_, double(z)};
+        for (int r = 0; r < 3; ++r) {
+            points_[3 * i + r] =
+                    float(pose_[r][0] * p[0] + pose_[r][1] * p[1] +
+                          pose_[r][2] * p[2] + pose_[r][3]);
+        }
+    }
+};
+
+/// Colors in [0, 1] of every stride_-th pixel of a UInt8 image with 3
+/// channels, or of a Float32 image with 1 or 3 channels. Intensities are
+/// repeated in all three channels, as in
+/// geometry::PointCloud::CreateFromRGBDImage.
+struct UnprojectColorKernel {
+    const void* color_;
+    bool color_is_uint8_;
+    int64_t channels_;
+    int64_t width_;
+    int64_t output_width_;
+    int64_t stride_;
+    float* colors_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = stride_ * (i % output_width_);
+        const int64_t v = stride_ * (i / output_width_);
+        const int64_t j = (v * width_ + u) * channels_;
+        for (int64_t c = 0; c < 3; ++c) {
+            const int64_t k = j + (channels_ == 3 ? c : 0);
+            colors_[3 * i + c] =
+                    color_is_uint8_
+                            ? float(static_cast<const uint8_t*>(color_)[k]) /
+                                      255.0f
+                            : static_cast<const float*>(color_)[k];
+        }
+    }
+};
+
+/// Run kernel(i) for every i in [0, n).
+void LaunchCPU(int64_t n, const ConvertDepthKernel& kernel);
+void LaunchCPU(int64_t n, const FilterKernel& kernel);
+void LaunchCPU(int64_t n, const DownsampleKernel& kernel);
+void LaunchCPU(int64_t n, const BilateralFilterKernel& kernel);
+void LaunchCPU(int64_t n, const UnprojectKernel& kernel);
+void LaunchCPU(int64_t n, const UnprojectColorKernel& kernel);
+
+#ifdef BUILD_CUDA_MODULE
+void LaunchCUDA(int64_t n, const ConvertDepthKernel& kernel);
+void LaunchCUDA(int64_t n, const FilterKernel& kernel);
+void LaunchCUDA(int64_t n, const DownsampleKernel& kernel);
+void LaunchCUDA(int64_t n, const BilateralFilterKernel& kernel);
+void LaunchCUDA(int64_t n, const UnprojectKernel& kernel);
+void LaunchCUDA(int64_t n, const UnprojectColorKernel& kernel);
+#endif
+
+}  // namespace tgeometry
+}  // namespace open3d
@@ -0,0 +1,505 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/PointCloud.h"
+
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Core/Hashmap/Hashmap.h"
+#include "Open3D/TGeometry/ImageKernel.h"
+#include "Open3D/TGeometry/KernelLauncher.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tgeometry {
+
+namespace {
+
+void AssertFloatDtype(Dtype dtype) {
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "Only supports Float32 and Float64 points, but {} is used.",
+                DtypeUtil::ToString(dtype));
+    }
+}
+
+TensorList Vector3dToTensorList(const std::vector<Eigen::Vector3d>& values,
+                                Dtype dtype,
+                                const Device& device) {
+    int64_t num_values = static_cast<int64_t>(values.size());
+    Tensor host_tensor({num_values, 3}, Dtype::Float64, Device("CPU:0"));
+    if (num_values > 0) {
+        std::memcpy(host_tensor.GetDataPtr(), values.data(),
+                    num_values * 3 * sizeof(double));
+    }
+    Tensor tensor = host_tensor.To(dtype);
+    if (tensor.GetDevice() != device) {
+        tensor = tensor.Copy(device);
+    }
+    return TensorList(tensor);
+}
+
+std::vector<Eigen::Vector3d> TensorListToVector3d(const TensorList& values) {
+    Tensor host_tensor =
+            values.AsTensor().To(Dtype::Float64).Copy(Device("CPU:0"));
+    std::vector<Eigen::Vector3d> vector3d(values.GetSize());
+    if (!vector3d.empty()) {
+        std::memcpy(vector3d.data()->data(), host_tensor.GetDataPtr(),
+                    vector3d.size() * 3 * sizeof(double));
+    }
+    return vector3d;
+}
+
+// Maximum number of point-to-plane distances computed at once by SegmentPlane.
+/// Back-projects every stride-th pixel of \p depth into Float32 (N, 3)
+/// \p points, and \p colors if \p color is not nullptr. \p valid is true
+/// for the pixels of valid depth.
+void Unproject(const Image& depth,
+               const Image* color,
+               const Tensor& intrinsic,
+               const Tensor& extrinsic,
+               double depth_scale,
+               double depth_max,
+               int64_t stride,
+               Tensor& points,
+               Tensor& colors,
+               Tensor& valid) {
+    if (depth.GetChannels() != 1 || (depth.GetDtype() != Dtype::UInt16 &&
+                                     depth.GetDtype() != Dtype::Float32)) {
+        utility::LogError(
+                "Only single channel UInt16 and Float32 depth images are "
+                "supported.");
+    }
+    if (intrinsic.GetShape() != SizeVector({3, 3}) ||
+        extrinsic.GetShape() != SizeVector({4, 4})) {
+        utility::LogError(
+                "Intrinsic and extrinsic must have shapes {{3, 3}} and {{4, "
+                "4}}, but {} and {} are used.",
+                intrinsic.GetShape().ToString(),
+                extrinsic.GetShape().ToString());
+    }
+    if (stride <= 0) {
+        utility::LogError("Stride must be positive, but {} is used.", stride);
+    }
+    const Device device = depth.GetDevice();
+    const Device host("CPU:0");
+    const std::vector<double> K = intrinsic.To(Dtype::Float64)
+                                          .Copy(host)
+                                          .ToFlatVector<double>();
+    const std::vector<double> pose = extrinsic.To(Dtype::Float64)
+                                             .Copy(host)
+                                             .Inverse()
+                                             .ToFlatVector<double>();
+
+    const int64_t rows = (depth.GetRows() + stride - 1) / stride;
+    const int64_t cols = (depth.GetCols() + stride - 1) / stride;
+    points = Tensor({rows * cols, 3}, Dtype::Float32, device);
+    valid = Tensor({rows * cols}, Dtype::Bool, device);
+    UnprojectKernel kernel;
+    kernel.depth_ = depth.AsTensor().GetDataPtr();
+    kernel.depth_is_uint16_ = depth.GetDtype() == Dtype::UInt16;
+    kernel.depth_scale_ = float(depth_scale);
+    kernel.max_depth_ = float(depth_max);
+    kernel.width_ = depth.GetCols();
+    kernel.output_width_ = cols;
+    kernel.stride_ = stride;
+    kernel.fx_ = K[0];
+    kernel.fy_ = K[4];
+    kernel.cx_ = K[2];
+    kernel.cy_ = K[5];
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            kernel.pose_[r][c] = pose[r * 4 + c];
+        }
+    }
+    kernel.points_ = static_cast<float*>(points.GetDataPtr());
+    kernel.valid_ = static_cast<bool*>(valid.GetDataPtr());
+    Launch(device, rows * cols, kernel);
+
+    if (color == nullptr) {
+        return;
+    }
+    const bool color_is_uint8 =
+            color->GetDtype() == Dtype::UInt8 && color->GetChannels() == 3;
+    const bool color_is_float =
+            color->GetDtype() == Dtype::Float32 &&
+            (color->GetChannels() == 1 || color->GetChannels() == 3);
+    if (!color_is_uint8 && !color_is_float) {
+        utility::LogError(
+                "Only UInt8 color images with 3 channels and Float32 color "
+                "images with 1 or 3 channels are supported.");
+    }
+    colors = Tensor({rows * cols, 3}, Dtype::Float32, device);
+    const UnprojectColorKernel color_kernel = {
+            color->AsTensor().GetDataPtr(),
+            color_is_uint8,
+            color->GetChannels(),
+            color->GetCols(),
+            cols,
+            stride,
+            static_cast<float*>(colors.GetDataPtr())};
+    Launch(device, rows * cols, color_kernel);
+}
+
+const int64_t kSegmentPlaneBatchElements = int64_t(1) << 24;
+
+}  // namespace
+
+PointCloud::PointCloud(Dtype dtype, const Device& device)
+    : Geometry(Geometry::GeometryType::PointCloud, 3) {
+    AssertFloatDtype(dtype);
+    point_attr_.emplace("points", TensorList({3}, dtype, device));
+}
+
+PointCloud::PointCloud(const TensorList& points)
+    : Geometry(Geometry::GeometryType::PointCloud, 3) {
+    if (points.GetShape() != SizeVector({3})) {
+        utility::LogError("Points must have shape {{3}}, but got {}.",
+                          points.GetShape());
+    }
+    AssertFloatDtype(points.GetDtype());
+    point_attr_.emplace("points", points);
+}
+
+PointCloud& PointCloud::Clear() {
+    TensorList points({3}, GetDtype(), GetDevice());
+    point_attr_.clear();
+    point_attr_.emplace("points", points);
+    return *this;
+}
+
+TensorList& PointCloud::operator[](const std::string& key) {
+    auto it = point_attr_.find(key);
+    if (it == point_attr_.end()) {
+        utility::LogError("Point attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+const TensorList& PointCloud::operator[](const std::string& key) const {
+    auto it = point_attr_.find(key);
+    if (it == point_attr_.end()) {
+        utility::LogError("Point attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+void PointCloud::SetPointAttr(const std::string& key,
+                              const TensorList& value) {
+    if (value.GetDevice() != GetDevice()) {
+        utility::LogError("Point attribute \"{}\" is on {}, expected {}.", key,
+                          value.GetDevice().ToString(),
+                          GetDevice().ToString());
+    }
+    if (key == "points") {
+        if (value.GetShape() != SizeVector({3})) {
+            utility::LogError("Points must have shape {{3}}, but got {}.",
+                              value.GetShape());
+        }
+        AssertFloatDtype(value.GetDtype());
+    } else if (value.GetSize() != NumPoints()) {
+        utility::LogError(
+                "Point attribute \"{}\" has {} elements, but there are {} "
+                "points.",
+                key, value.GetSize(), NumPoints());
+    }
+    auto it = point_attr_.find(key);
+    if (it == point_attr_.end()) {
+        point_attr_.emplace(key, value);
+    } else {
+        it->second = value;
+    }
+}
+
+bool PointCloud::HasPointAttr(const std::string& key) const {
+    auto it = point_attr_.find(key);
+    return it != point_attr_.end() && it->second.GetSize() > 0 &&
+           it->second.GetSize() == NumPoints();
+}
+
+void PointCloud::RemovePointAttr(const std::string& key) {
+    if (key == "points") {
+        utility::LogError("Point attribute \"points\" cannot be removed.");
+    }
+    point_attr_.erase(key);
+}
+
+PointCloud PointCloud::Copy(const Device& device) const {
+    PointCloud pcd(GetDtype(), device);
+    for (const auto& kv : point_attr_) {
+        pcd.point_attr_.erase(kv.first);
+        pcd.point_attr_.emplace(kv.first,
+                                TensorList(kv.second.AsTensor().Copy(device)));
+    }
+    return pcd;
+}
+
+Tensor PointCloud::GetMinBound() const {
+    return GetPoints().AsTensor().Min({0});
+}
+
+Tensor PointCloud::GetMaxBound() const {
+    return GetPoints().AsTensor().Max({0});
+}
+
+Tensor PointCloud::GetCenter() const {
+    return GetPoints().AsTensor().Mean({0});
+}
+
+PointCloud& PointCloud::Transform(const Tensor& transformation) {
+    if (transformation.GetShape() != SizeVector({4, 4})) {
+        utility::LogError(
+                "Transformation must have shape {{4, 4}}, but got {}.",
+                transformation.GetShape());
+    }
+    if (!HasPoints()) {
+        return *this;
+    }
+    Tensor transform = transformation.To(GetDtype()).Copy(GetDevice());
+    Tensor R_t = transform.Slice(0, 0, 3).Slice(1, 0, 3).T();
+    Tensor t = transform.Slice(0, 0, 3).Slice(1, 3, 4).Reshape({3});
+
+    TensorList& points = GetPoints();
+    points.AsTensor() = points.AsTensor().Matmul(R_t) + t;
+    if (HasNormals()) {
+        Tensor normals = GetNormals().AsTensor();
+        normals.AsRvalue() = normals.Matmul(R_t.To(normals.GetDtype()));
+    }
+    return *this;
+}
+
+PointCloud PointCloud::Crop(const Tensor& min_bound,
+                            const Tensor& max_bound) const {
+    if (min_bound.GetShape() != SizeVector({3}) ||
+        max_bound.GetShape() != SizeVector({3})) {
+        utility::LogError("Bounds must have shape {{3}}, but got {} and {}.",
+                          min_bound.GetShape(), max_bound.GetShape());
+    }
+    Tensor points = GetPoints().AsTensor();
+    Tensor inside =
+            points.Ge(min_bound.To(GetDtype()).Copy(GetDevice()))
+                    .LogicalAnd(points.Le(
+                            max_bound.To(GetDtype()).Copy(GetDevice())));
+    Tensor mask = inside.IndexExtract(1, 0)
+                          .LogicalAnd(inside.IndexExtract(1, 1))
+                          .LogicalAnd(inside.IndexExtract(1, 2));
+    return SelectByMask(mask);
+}
+
+PointCloud PointCloud::VoxelDownSample(double voxel_size) const {
+    if (voxel_size <= 0.0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    if (!HasPoints()) {
+        return *this;
+    }
+    // Offsets from the minimum bound are non-negative, so the conversion to
+    // integers floors them.
+    Tensor points = GetPoints().AsTensor();
+    Tensor voxel_coords =
+            ((points - GetMinBound()) / voxel_size).To(Dtype::Int64);
+
+    Hashmap voxel_map(NumPoints(), Dtype::Int64, {3}, Dtype::UInt8, {1},
+                      GetDevice());
+    Tensor addrs, masks;
+    voxel_map.Activate(voxel_coords, addrs, masks);
+    return SelectByMask(masks);
+}
+
+PointCloud& PointCloud::EstimateNormals(
+        const geometry::KDTreeSearchParam& search_param) {
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = TensorListToVector3d(GetPoints());
+    if (HasNormals()) {
+        pcd_legacy.normals_ = TensorListToVector3d(GetNormals());
+    }
+    pcd_legacy.EstimateNormals(search_param);
+    SetPointAttr("normals", Vector3dToTensorList(pcd_legacy.normals_,
+                                                 GetDtype(), GetDevice()));
+    return *this;
+}
+
+std::tuple<Tensor, Tensor> PointCloud::SegmentPlane(double distance_threshold,
+                                                    int64_t num_iterations,
+                                                    int64_t seed) const {
+    if (distance_threshold <= 0.0) {
+        utility::LogError("distance_threshold must be positive, but got {}.",
+                          distance_threshold);
+    }
+    if (num_iterations <= 0) {
+        utility::LogError("num_iterations must be positive, but got {}.",
+                          num_iterations);
+    }
+    const int64_t num_points = NumPoints();
+    if (num_points < 3) {
+        utility::LogError("There must be at least 3 points, but got {}.",
+                          num_points);
+    }
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    const Tensor points = GetPoints().AsTensor();
+    const Tensor threshold =
+            Tensor::Full({}, distance_threshold, dtype, device);
+
+    // One plane through 3 random points per hypothesis. Degenerate samples
+    // have a zero normal, whose NaN distances never count as inliers.
+    Tensor samples = Tensor::Randint(0, num_points, {num_iterations, 3},
+                                     Dtype::Int64, device, seed);
+    Tensor p0 = points.IndexGet({samples.IndexExtract(1, 0).Contiguous()});
+    Tensor e1 =
+            points.IndexGet({samples.IndexExtract(1, 1).Contiguous()}) - p0;
+    Tensor e2 =
+            points.IndexGet({samples.IndexExtract(1, 2).Contiguous()}) - p0;
+    Tensor normals = Tensor::Empty({num_iterations, 3}, dtype, device);
+    for (int64_t i = 0; i < 3; ++i) {
+        const int64_t j = (i + 1) % 3;
+        const int64_t k = (i + 2) % 3;
+        normals.IndexExtract(1, i).AsRvalue() =
+                e1.IndexExtract(1, j) * e2.IndexExtract(1, k) -
+                e1.IndexExtract(1, k) * e2.IndexExtract(1, j);
+    }
+    normals = normals / (normals * normals).Sum({1}, true).Sqrt();
+    Tensor offsets = (normals * p0).Sum({1}).Neg();
+
+    // Hypotheses are scored in batches, such that the point-to-plane distances
+    // of a batch take at most kSegmentPlaneBatchElements elements.
+    const int64_t batch_size =
+            std::max<int64_t>(1, kSegmentPlaneBatchElements / num_points);
+    Tensor inlier_counts =
+            Tensor::Empty({num_iterations}, Dtype::Int64, device);
+    for (int64_t begin = 0; begin < num_iterations; begin += batch_size) {
+        const int64_t end = std::min(begin + batch_size, num_iterations);
+        Tensor distances = points.Matmul(normals.Slice(0, begin, end).T());
+        distances.Add_(offsets.Slice(0, begin, end)).Abs_();
+        inlier_counts.Slice(0, begin, end).AsRvalue() =
+                distances.Lt(threshold).To(Dtype::Int64).Sum({0});
+    }
+
+    Tensor plane_model = Tensor::Zeros({4}, Dtype::Float64);
+    const int64_t best = inlier_counts.ArgMax({0}).Item<int64_t>();
+    if (inlier_counts[best].Item<int64_t>() == 0) {
+        return std::make_tuple(plane_model, Tensor({0}, Dtype::Int64, device));
+    }
+    Tensor distances = points.Matmul(normals[best].Reshape({3, 1}))
+                               .Reshape({num_points});
+    distances.Add_(offsets[best]).Abs_();
+    Tensor inlier_mask = distances.Lt(threshold);
+    Tensor inliers = inlier_mask.NonZero()[0];
+
+    // Least-squares refinement: the normal is the direction of least variance
+    // of the inliers.
+    Tensor inlier_points = points.MaskedSelect(inlier_mask).To(Dtype::Float64);
+    Tensor centroid = inlier_points.Mean({0});
+    Tensor centered = inlier_points - centroid;
+    const std::vector<double> covariance =
+            centered.T().Matmul(centered).ToFlatVector<double>();
+    const std::vector<double> center = centroid.ToFlatVector<double>();
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(
+            Eigen::Map<const Eigen::Matrix3d>(covariance.data()));
+    const Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    const double d = -normal.dot(Eigen::Vector3d(center[0], center[1],
+                                                 center[2]));
+    plane_model = Tensor(
+            std::vector<double>{normal(0), normal(1), normal(2), d}, {4},
+            Dtype::Float64);
+    return std::make_tuple(plane_model, inliers);
+}
+
+PointCloud PointCloud::CreateFromDepthImage(const Image& depth,
+                                            const Tensor& intrinsic,
+                                            const Tensor& extrinsic,
+                                            double depth_scale,
+                                            double depth_max,
+                                            int64_t stride) {
+    Tensor points, colors, valid;
+    Unproject(depth, nullptr, intrinsic, extrinsic, depth_scale, depth_max,
+              stride, points, colors, valid);
+    return PointCloud(TensorList(points.IndexGet({valid})));
+}
+
+PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage& rgbd_image,
+                                           const Tensor& intrinsic,
+                                           const Tensor& extrinsic,
+                                           double depth_scale,
+                                           double depth_max,
+                                           int64_t stride) {
+    Tensor points, colors, valid;
+    Unproject(rgbd_image.depth_, &rgbd_image.color_, intrinsic, extrinsic,
+              depth_scale, depth_max, stride, points, colors, valid);
+    PointCloud pcd(TensorList(points.IndexGet({valid})));
+    pcd.SetPointAttr("colors", TensorList(colors.IndexGet({valid})));
+    return pcd;
+}
+
+PointCloud PointCloud::FromLegacyPointCloud(
+        const geometry::PointCloud& pcd_legacy,
+        Dtype dtype,
+        const Device& device) {
+    AssertFloatDtype(dtype);
+    PointCloud pcd(Vector3dToTensorList(pcd_legacy.points_, dtype, device));
+    if (pcd_legacy.HasNormals()) {
+        pcd.SetPointAttr("normals", Vector3dToTensorList(pcd_legacy.normals_,
+                                                         dtype, device));
+    }
+    if (pcd_legacy.HasColors()) {
+        pcd.SetPointAttr("colors", Vector3dToTensorList(pcd_legacy.colors_,
+                                                        dtype, device));
+    }
+    return pcd;
+}
+
+geometry::PointCloud PointCloud::ToLegacyPointCloud() const {
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = TensorListToVector3d(GetPoints());
+    if (HasNormals() && GetNormals().GetShape() == SizeVector({3})) {
+        pcd_legacy.normals_ = TensorListToVector3d(GetNormals());
+    }
+    if (HasColors() && GetColors().GetShape() == SizeVector({3})) {
+        pcd_legacy.colors_ = TensorListToVector3d(GetColors());
+    }
+    return pcd_legacy;
+}
+
+PointCloud PointCloud::SelectByMask(const Tensor& mask) const {
+    PointCloud pcd(GetDtype(), GetDevice());
+    for (const auto& kv : point_attr_) {
+        if (kv.second.GetSize() != NumPoints()) {
+            continue;
+        }
+        pcd.point_attr_.erase(kv.first);
+        pcd.point_attr_.emplace(
+                kv.first, TensorList(kv.second.AsTensor().IndexGet({mask})));
+    }
+    return pcd;
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
@@ -0,0 +1,246 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorList.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/TGeometry/Geometry.h"
+#include "Open3D/TGeometry/Image.h"
+#include "Open3D/TGeometry/RGBDImage.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// \class PointCloud
+///
+/// \brief A point cloud whose per-point attributes are stored as TensorLists
+/// on any Device.
+///
+/// Every attribute is a TensorList with one element per point, accessed by
+/// name. "points" of shape (3) always exists; "normals" and "colors" are the
+/// conventional names for normals and colors and are created on demand.
+/// Attributes default to Float32, so a point costs 12 bytes per attribute
+/// instead of the 24 bytes of geometry::PointCloud.
+///
+/// Example:
+/// ```cpp
+/// tgeometry::PointCloud pcd = tgeometry::PointCloud::FromLegacyPointCloud(
+///         legacy_pcd, Dtype::Float32, Device("CUDA:0"));
+/// pcd = pcd.VoxelDownSample(0.05);
+/// ```
+class PointCloud : public Geometry {
+public:
+    /// \brief Constructs an empty point cloud.
+    ///
+    /// \param dtype Dtype of the points, Float32 or Float64.
+    /// \param device Device on which all attributes are stored.
+    PointCloud(Dtype dtype = Dtype::Float32,
+               const Device& device = Device("CPU:0"));
+
+    /// \brief Constructs a point cloud from points of shape {3}.
+    PointCloud(const TensorList& points);
+
+    ~PointCloud() override {}
+
+public:
+    /// Removes all points and attributes; the dtype and device are kept.
+    PointCloud& Clear() override;
+
+    /// Returns `true` iff the point cloud contains no points.
+    bool IsEmpty() const override { return !HasPoints(); }
+
+    /// Returns the attribute \p key. Throws if it does not exist.
+    TensorList& operator[](const std::string& key);
+    const TensorList& operator[](const std::string& key) const;
+
+    /// Sets attribute \p key. Its size must match the number of points,
+    /// except for "points" itself.
+    void SetPointAttr(const std::string& key, const TensorList& value);
+
+    /// Returns `true` if attribute \p key exists and holds a value for every
+    /// point.
+    bool HasPointAttr(const std::string& key) const;
+
+    /// Removes attribute \p key. "points" cannot be removed.
+    void RemovePointAttr(const std::string& key);
+
+    bool HasPoints() const { return GetPoints().GetSize() > 0; }
+    bool HasNormals() const { return HasPointAttr("normals"); }
+    bool HasColors() const { return HasPointAttr("colors"); }
+
+    const TensorList& GetPoints() const { return point_attr_.at("points"); }
+    TensorList& GetPoints() { return point_attr_.at("points"); }
+    const TensorList& GetNormals() const { return (*this)["normals"]; }
+    TensorList& GetNormals() { return (*this)["normals"]; }
+    const TensorList& GetColors() const { return (*this)["colors"]; }
+    TensorList& GetColors() { return (*this)["colors"]; }
+
+    const std::unordered_map<std::string, TensorList>& GetPointAttrMap()
+            const {
+        return point_attr_;
+    }
+
+    /// Number of points.
+    int64_t NumPoints() const { return GetPoints().GetSize(); }
+
+    Dtype GetDtype() const { return GetPoints().GetDtype(); }
+
+    Device GetDevice() const { return GetPoints().GetDevice(); }
+
+    /// Returns a deep copy of the point cloud on \p device.
+    PointCloud Copy(const Device& device) const;
+
+    /// Returns the per-dimension minimum of the points, shape {3}.
+    Tensor GetMinBound() const;
+
+    /// Returns the per-dimension maximum of the points, shape {3}.
+    Tensor GetMaxBound() const;
+
+    /// Returns the mean of the points, shape {3}.
+    Tensor GetCenter() const;
+
+    /// \brief Applies a 4x4 rigid or affine \p transformation to the points
+    /// and the rotational part to the normals.
+    PointCloud& Transform(const Tensor& transformation);
+
+    /// \brief Returns the points, with all their attributes, that lie inside
+    /// the axis-aligned box [\p min_bound, \p max_bound].
+    ///
+    /// \param min_bound Lower corner of the box, shape {3}.
+    /// \param max_bound Upper corner of the box, shape {3}.
+    PointCloud Crop(const Tensor& min_bound, const Tensor& max_bound) const;
+
+    /// \brief Downsamples the point cloud with a voxel grid.
+    ///
+    /// One point per occupied voxel is kept together with all its attributes.
+    /// Unlike geometry::PointCloud::VoxelDownSample, attributes are not
+    /// averaged, and which point of a voxel survives is unspecified.
+    ///
+    /// \param voxel_size Edge length of a voxel.
+    PointCloud VoxelDownSample(double voxel_size) const;
+
+    /// \brief Computes the "normals" attribute from the covariance of the
+    /// neighborhood of each point.
+    ///
+    /// Existing normals are used to orient the result, as in
+    /// geometry::PointCloud::EstimateNormals. The neighbor search runs on the
+    /// host; the result is stored on the point cloud's device.
+    PointCloud& EstimateNormals(
+            const geometry::KDTreeSearchParam& search_param =
+                    geometry::KDTreeSearchParamKNN());
+
+    /// \brief Segments the dominant plane with RANSAC on the point cloud's
+    /// device.
+    ///
+    /// All \p num_iterations hypotheses are drawn at once with Tensor::Randint
+    /// and scored against all points in batches of tensor operations, so a
+    /// large number of hypotheses costs few kernel launches. The plane with
+    /// the most inliers is refined by a least-squares fit to its inliers, as
+    /// in geometry::PointCloud::SegmentPlane.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param num_iterations Number of plane hypotheses.
+    /// \param seed Seed of the hypothesis sampling, -1 for a random seed.
+    /// \return The plane model ax + by + cz + d = 0 of shape {4}, Float64 on
+    /// the host, and the Int64 indices of the inliers on the point cloud's
+    /// device.
+    std::tuple<Tensor, Tensor> SegmentPlane(double distance_threshold = 0.01,
+                                            int64_t num_iterations = 1000,
+                                            int64_t seed = -1) const;
+
+    /// \brief Back-projects a depth image into a Float32 point cloud on the
+    /// image's device, as geometry::PointCloud::CreateFromDepthImage.
+    ///
+    /// Pixels whose depth is not in (0, \p depth_max) are dropped.
+    ///
+    /// \param depth Single channel UInt16 or Float32 depth.
+    /// \param intrinsic (3, 3) camera intrinsic matrix.
+    /// \param extrinsic (4, 4) world to camera transformation.
+    /// \param depth_scale Depth values per meter, 1 for depth in meters.
+    /// \param depth_max Depth in meters beyond which pixels are dropped.
+    /// \param stride Only every stride-th row and column is back-projected.
+    static PointCloud CreateFromDepthImage(
+            const Image& depth,
+            const Tensor& intrinsic,
+            const Tensor& extrinsic = Tensor::Eye(4,
+                                                  Dtype::Float64,
+                                                  Device("CPU:0")),
+            double depth_scale = 1000.0,
+            double depth_max = 3.0,
+            int64_t stride = 1);
+
+    /// \brief Back-projects an RGB-D image into a Float32 point cloud with
+    /// "colors" in [0, 1], as geometry::PointCloud::CreateFromRGBDImage.
+    ///
+    /// The color image is UInt8 with 3 channels, or Float32 with 1 or 3
+    /// channels in [0, 1]; intensities become gray colors. The other
+    /// parameters are those of CreateFromDepthImage.
+    static PointCloud CreateFromRGBDImage(
+            const RGBDImage& rgbd_image,
+            const Tensor& intrinsic,
+            const Tensor& extrinsic = Tensor::Eye(4,
+                                                  Dtype::Float64,
+                                                  Device("CPU:0")),
+            double depth_scale = 1000.0,
+            double depth_max = 3.0,
+            int64_t stride = 1);
+
+    /// \brief Converts a geometry::PointCloud, including normals and colors
+    /// when present.
+    ///
+    /// \param pcd_legacy The legacy point cloud.
+    /// \param dtype Dtype of the attributes, Float32 or Float64.
+    /// \param device Device on which the attributes are stored.
+    static PointCloud FromLegacyPointCloud(
+            const geometry::PointCloud& pcd_legacy,
+            Dtype dtype = Dtype::Float32,
+            const Device& device = Device("CPU:0"));
+
+    /// Converts points, normals and colors to a geometry::PointCloud on the
+    /// host.
+    geometry::PointCloud ToLegacyPointCloud() const;
+
+protected:
+    /// Returns a point cloud with the points where the Bool \p mask of shape
+    /// {N} is true, keeping all attributes.
+    PointCloud SelectByMask(const Tensor& mask) const;
+
+protected:
+    std::unordered_map<std::string, TensorList> point_attr_;
+};
+
+}  // namespace tgeometry
+}  // namespace open3d
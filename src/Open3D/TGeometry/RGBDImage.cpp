@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/RGBDImage.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tgeometry {
+
+RGBDImage::RGBDImage(const Image& color, const Image& depth)
+    : Geometry(Geometry::GeometryType::RGBDImage, 2),
+      color_(color),
+      depth_(depth) {
+    if (color.GetRows() != depth.GetRows() ||
+        color.GetCols() != depth.GetCols()) {
+        utility::LogError(
+                "Color image of {} x {} pixels does not match depth image of "
+                "{} x {} pixels.",
+                color.GetRows(), color.GetCols(), depth.GetRows(),
+                depth.GetCols());
+    }
+    if (color.GetDevice() != depth.GetDevice()) {
+        utility::LogError("Color image on {} and depth image on {} differ.",
+                          color.GetDevice().ToString(),
+                          depth.GetDevice().ToString());
+    }
+    if (depth.GetChannels() != 1) {
+        utility::LogError("The depth image must have a single channel.");
+    }
+}
+
+RGBDImage& RGBDImage::Clear() {
+    color_.Clear();
+    depth_.Clear();
+    return *this;
+}
+
+bool RGBDImage::IsEmpty() const {
+    return color_.IsEmpty() || depth_.IsEmpty();
+}
+
+RGBDImage RGBDImage::Copy(const Device& device) const {
+    return RGBDImage(color_.Copy(device), depth_.Copy(device));
+}
+
+RGBDImage RGBDImage::FromLegacyRGBDImage(
+        const geometry::RGBDImage& rgbd_legacy, const Device& device) {
+    return RGBDImage(Image::FromLegacyImage(rgbd_legacy.color_, device),
+                     Image::FromLegacyImage(rgbd_legacy.depth_, device));
+}
+
+geometry::RGBDImage RGBDImage::ToLegacyRGBDImage() const {
+    return geometry::RGBDImage(color_.ToLegacyImage(), depth_.ToLegacyImage());
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
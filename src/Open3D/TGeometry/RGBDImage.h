@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/TGeometry/Geometry.h"
+#include "Open3D/TGeometry/Image.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// \class RGBDImage
+///
+/// \brief A pair of registered color and depth tgeometry::Image of the same
+/// resolution on the same Device.
+///
+/// The depth is either raw UInt16 or Float32 depth or Float32 meters; the
+/// depth scale is passed to the functions that consume it, such as
+/// PointCloud::CreateFromRGBDImage.
+class RGBDImage : public Geometry {
+public:
+    /// Constructs an empty RGB-D image.
+    RGBDImage() : Geometry(Geometry::GeometryType::RGBDImage, 2) {}
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param color The color image, with 1 or 3 channels.
+    /// \param depth The single channel depth image.
+    RGBDImage(const Image& color, const Image& depth);
+
+    ~RGBDImage() override {}
+
+public:
+    RGBDImage& Clear() override;
+
+    /// Returns `true` iff the color or the depth image is empty.
+    bool IsEmpty() const override;
+
+    Device GetDevice() const { return depth_.GetDevice(); }
+
+    /// Returns a deep copy of the RGB-D image on \p device.
+    RGBDImage Copy(const Device& device) const;
+
+    /// Converts a geometry::RGBDImage to \p device.
+    static RGBDImage FromLegacyRGBDImage(
+            const geometry::RGBDImage& rgbd_legacy,
+            const Device& device = Device("CPU:0"));
+
+    /// Converts the images to a geometry::RGBDImage on the host.
+    geometry::RGBDImage ToLegacyRGBDImage() const;
+
+public:
+    /// The color image.
+    Image color_;
+    /// The depth image.
+    Image depth_;
+};
+
+}  // namespace tgeometry
+}  // namespace open3d
@@ -0,0 +1,501 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/TriangleMesh.h"
+
+#include <Eigen/Core>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/TGeometry/KernelLauncher.h"
+#include "Open3D/TGeometry/TriangleMeshKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tgeometry {
+
+namespace {
+
+void AssertFloatDtype(Dtype dtype) {
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "Only supports Float32 and Float64 vertices, but {} is used.",
+                DtypeUtil::ToString(dtype));
+    }
+}
+
+void AssertTriangles(const TensorList& triangles) {
+    if (triangles.GetShape() != SizeVector({3}) ||
+        triangles.GetDtype() != Dtype::Int64) {
+        utility::LogError(
+                "Triangles must be Int64 with shape {{3}}, but got {} with "
+                "shape {}.",
+                DtypeUtil::ToString(triangles.GetDtype()),
+                triangles.GetShape());
+    }
+}
+
+/// Converts Eigen vectors of 3 \p scalar_t to a TensorList of \p dtype.
+template <typename scalar_t>
+TensorList EigenToTensorList(
+        const std::vector<Eigen::Matrix<scalar_t, 3, 1>>& values,
+        Dtype host_dtype,
+        Dtype dtype,
+        const Device& device) {
+    int64_t num_values = static_cast<int64_t>(values.size());
+    Tensor host_tensor({num_values, 3}, host_dtype, Device("CPU:0"));
+    if (num_values > 0) {
+        std::memcpy(host_tensor.GetDataPtr(), values.data(),
+                    num_values * 3 * sizeof(scalar_t));
+    }
+    Tensor tensor = host_tensor.To(dtype);
+    if (tensor.GetDevice() != device) {
+        tensor = tensor.Copy(device);
+    }
+    return TensorList(tensor);
+}
+
+/// Converts a TensorList of shape {3} to Eigen vectors of 3 \p scalar_t.
+template <typename scalar_t>
+std::vector<Eigen::Matrix<scalar_t, 3, 1>> TensorListToEigen(
+        const TensorList& values, Dtype host_dtype) {
+    Tensor host_tensor = values.AsTensor().To(host_dtype).Copy(Device("CPU:0"));
+    std::vector<Eigen::Matrix<scalar_t, 3, 1>> vectors(values.GetSize());
+    if (!vectors.empty()) {
+        std::memcpy(vectors.data()->data(), host_tensor.GetDataPtr(),
+                    vectors.size() * 3 * sizeof(scalar_t));
+    }
+    return vectors;
+}
+
+template <typename scalar_t>
+scalar_t* GetDataPtr(TensorList& values) {
+    return static_cast<scalar_t*>(values.AsTensor().GetDataPtr());
+}
+
+template <typename scalar_t>
+const scalar_t* GetDataPtr(const TensorList& values) {
+    return static_cast<const scalar_t*>(values.AsTensor().GetDataPtr());
+}
+
+template <typename scalar_t>
+void ComputeTriangleNormals(const Device& device,
+                            const TensorList& vertices,
+                            const TensorList& triangles,
+                            TensorList& normals) {
+    const TriangleNormalsKernel<scalar_t> kernel = {
+            GetDataPtr<scalar_t>(vertices), GetDataPtr<int64_t>(triangles),
+            GetDataPtr<scalar_t>(normals)};
+    Launch(device, triangles.GetSize(), kernel);
+}
+
+template <typename scalar_t>
+void AccumulateVertexNormals(const Device& device,
+                             const TensorList& triangles,
+                             const TensorList& triangle_normals,
+                             TensorList& vertex_normals) {
+    const AccumulateVertexNormalsKernel<scalar_t> kernel = {
+            GetDataPtr<int64_t>(triangles),
+            GetDataPtr<scalar_t>(triangle_normals),
+            GetDataPtr<scalar_t>(vertex_normals)};
+    Launch(device, triangles.GetSize(), kernel);
+}
+
+void NormalizeNormals(TensorList& normals) {
+    if (normals.GetDtype() == Dtype::Float32) {
+        const NormalizeNormalsKernel<float> kernel = {
+                GetDataPtr<float>(normals)};
+        Launch(normals.GetDevice(), normals.GetSize(), kernel);
+    } else {
+        const NormalizeNormalsKernel<double> kernel = {
+                GetDataPtr<double>(normals)};
+        Launch(normals.GetDevice(), normals.GetSize(), kernel);
+    }
+}
+
+/// Returns the elements of the attributes of \p attr_map whose size is
+/// \p size where the Bool \p mask is true. Other attributes are dropped.
+std::unordered_map<std::string, TensorList> SelectAttrs(
+        const std::unordered_map<std::string, TensorList>& attr_map,
+        int64_t size,
+        const Tensor& mask) {
+    std::unordered_map<std::string, TensorList> selected;
+    for (const auto& kv : attr_map) {
+        if (kv.second.GetSize() != size) {
+            continue;
+        }
+        selected.emplace(kv.first,
+                         TensorList(kv.second.AsTensor().IndexGet({mask})));
+    }
+    return selected;
+}
+
+}  // namespace
+
+TriangleMesh::TriangleMesh(Dtype dtype, const Device& device)
+    : Geometry(Geometry::GeometryType::TriangleMesh, 3) {
+    AssertFloatDtype(dtype);
+    vertex_attr_.emplace("vertices", TensorList({3}, dtype, device));
+    triangle_attr_.emplace("triangles",
+                           TensorList({3}, Dtype::Int64, device));
+}
+
+TriangleMesh::TriangleMesh(const TensorList& vertices,
+                           const TensorList& triangles)
+    : Geometry(Geometry::GeometryType::TriangleMesh, 3) {
+    if (vertices.GetShape() != SizeVector({3})) {
+        utility::LogError("Vertices must have shape {{3}}, but got {}.",
+                          vertices.GetShape());
+    }
+    AssertFloatDtype(vertices.GetDtype());
+    AssertTriangles(triangles);
+    if (vertices.GetDevice() != triangles.GetDevice()) {
+        utility::LogError("Vertices on {} and triangles on {} differ.",
+                          vertices.GetDevice().ToString(),
+                          triangles.GetDevice().ToString());
+    }
+    vertex_attr_.emplace("vertices", vertices);
+    triangle_attr_.emplace("triangles", triangles);
+}
+
+TriangleMesh& TriangleMesh::Clear() {
+    TensorList vertices({3}, GetDtype(), GetDevice());
+    TensorList triangles({3}, Dtype::Int64, GetDevice());
+    vertex_attr_.clear();
+    triangle_attr_.clear();
+    vertex_attr_.emplace("vertices", vertices);
+    triangle_attr_.emplace("triangles", triangles);
+    return *this;
+}
+
+TensorList& TriangleMesh::GetVertexAttr(const std::string& key) {
+    auto it = vertex_attr_.find(key);
+    if (it == vertex_attr_.end()) {
+        utility::LogError("Vertex attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+const TensorList& TriangleMesh::GetVertexAttr(const std::string& key) const {
+    auto it = vertex_attr_.find(key);
+    if (it == vertex_attr_.end()) {
+        utility::LogError("Vertex attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+TensorList& TriangleMesh::GetTriangleAttr(const std::string& key) {
+    auto it = triangle_attr_.find(key);
+    if (it == triangle_attr_.end()) {
+        utility::LogError("Triangle attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+const TensorList& TriangleMesh::GetTriangleAttr(const std::string& key) const {
+    auto it = triangle_attr_.find(key);
+    if (it == triangle_attr_.end()) {
+        utility::LogError("Triangle attribute \"{}\" does not exist.", key);
+    }
+    return it->second;
+}
+
+void TriangleMesh::SetVertexAttr(const std::string& key,
+                                 const TensorList& value) {
+    if (value.GetDevice() != GetDevice()) {
+        utility::LogError("Vertex attribute \"{}\" is on {}, expected {}.",
+                          key, value.GetDevice().ToString(),
+                          GetDevice().ToString());
+    }
+    if (key == "vertices") {
+        if (value.GetShape() != SizeVector({3})) {
+            utility::LogError("Vertices must have shape {{3}}, but got {}.",
+                              value.GetShape());
+        }
+        AssertFloatDtype(value.GetDtype());
+    } else if (value.GetSize() != NumVertices()) {
+        utility::LogError(
+                "Vertex attribute \"{}\" has {} elements, but there are {} "
+                "vertices.",
+                key, value.GetSize(), NumVertices());
+    }
+    vertex_attr_.erase(key);
+    vertex_attr_.emplace(key, value);
+}
+
+void TriangleMesh::SetTriangleAttr(const std::string& key,
+                                   const TensorList& value) {
+    if (value.GetDevice() != GetDevice()) {
+        utility::LogError("Triangle attribute \"{}\" is on {}, expected {}.",
+                          key, value.GetDevice().ToString(),
+                          GetDevice().ToString());
+    }
+    if (key == "triangles") {
+        AssertTriangles(value);
+    } else if (value.GetSize() != NumTriangles()) {
+        utility::LogError(
+                "Triangle attribute \"{}\" has {} elements, but there are {} "
+                "triangles.",
+                key, value.GetSize(), NumTriangles());
+    }
+    triangle_attr_.erase(key);
+    triangle_attr_.emplace(key, value);
+}
+
+bool TriangleMesh::HasVertexAttr(const std::string& key) const {
+    auto it = vertex_attr_.find(key);
+    return it != vertex_attr_.end() && it->second.GetSize() > 0 &&
+           it->second.GetSize() == NumVertices();
+}
+
+bool TriangleMesh::HasTriangleAttr(const std::string& key) const {
+    auto it = triangle_attr_.find(key);
+    return it != triangle_attr_.end() && it->second.GetSize() > 0 &&
+           it->second.GetSize() == NumTriangles();
+}
+
+void TriangleMesh::RemoveVertexAttr(const std::string& key) {
+    if (key == "vertices") {
+        utility::LogError("Vertex attribute \"vertices\" cannot be removed.");
+    }
+    vertex_attr_.erase(key);
+}
+
+void TriangleMesh::RemoveTriangleAttr(const std::string& key) {
+    if (key == "triangles") {
+        utility::LogError(
+                "Triangle attribute \"triangles\" cannot be removed.");
+    }
+    triangle_attr_.erase(key);
+}
+
+TriangleMesh TriangleMesh::Copy(const Device& device) const {
+    TriangleMesh mesh(GetDtype(), device);
+    for (const auto& kv : vertex_attr_) {
+        mesh.vertex_attr_.erase(kv.first);
+        mesh.vertex_attr_.emplace(
+                kv.first, TensorList(kv.second.AsTensor().Copy(device)));
+    }
+    for (const auto& kv : triangle_attr_) {
+        mesh.triangle_attr_.erase(kv.first);
+        mesh.triangle_attr_.emplace(
+                kv.first, TensorList(kv.second.AsTensor().Copy(device)));
+    }
+    return mesh;
+}
+
+Tensor TriangleMesh::GetMinBound() const {
+    return GetVertices().AsTensor().Min({0});
+}
+
+Tensor TriangleMesh::GetMaxBound() const {
+    return GetVertices().AsTensor().Max({0});
+}
+
+TriangleMesh& TriangleMesh::Transform(const Tensor& transformation) {
+    if (transformation.GetShape() != SizeVector({4, 4})) {
+        utility::LogError(
+                "Transformation must have shape {{4, 4}}, but got {}.",
+                transformation.GetShape());
+    }
+    if (!HasVertices()) {
+        return *this;
+    }
+    Tensor transform = transformation.To(GetDtype()).Copy(GetDevice());
+    Tensor R_t = transform.Slice(0, 0, 3).Slice(1, 0, 3).T();
+    Tensor t = transform.Slice(0, 0, 3).Slice(1, 3, 4).Reshape({3});
+
+    TensorList& vertices = GetVertices();
+    vertices.AsTensor() = vertices.AsTensor().Matmul(R_t) + t;
+    if (HasVertexNormals()) {
+        Tensor normals = GetVertexAttr("normals").AsTensor();
+        normals.AsRvalue() = normals.Matmul(R_t.To(normals.GetDtype()));
+    }
+    if (HasTriangleNormals()) {
+        Tensor normals = GetTriangleAttr("normals").AsTensor();
+        normals.AsRvalue() = normals.Matmul(R_t.To(normals.GetDtype()));
+    }
+    return *this;
+}
+
+TriangleMesh& TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    TensorList normals({3}, GetDtype(), GetDevice(), NumTriangles());
+    if (GetDtype() == Dtype::Float32) {
+        tgeometry::ComputeTriangleNormals<float>(GetDevice(), GetVertices(),
+                                                 GetTriangles(), normals);
+    } else {
+        tgeometry::ComputeTriangleNormals<double>(GetDevice(), GetVertices(),
+                                                  GetTriangles(), normals);
+    }
+    if (normalized) {
+        NormalizeNormals(normals);
+    }
+    SetTriangleAttr("normals", normals);
+    return *this;
+}
+
+TriangleMesh& TriangleMesh::ComputeVertexNormals(bool normalized) {
+    if (!HasTriangleNormals()) {
+        ComputeTriangleNormals(false);
+    }
+    TensorList& triangle_normals = GetTriangleAttr("normals");
+    TensorList vertex_normals(
+            Tensor::Zeros({NumVertices(), 3}, triangle_normals.GetDtype(),
+                          GetDevice()));
+    if (triangle_normals.GetDtype() == Dtype::Float32) {
+        AccumulateVertexNormals<float>(GetDevice(), GetTriangles(),
+                                       triangle_normals, vertex_normals);
+    } else {
+        AccumulateVertexNormals<double>(GetDevice(), GetTriangles(),
+                                        triangle_normals, vertex_normals);
+    }
+    if (normalized) {
+        NormalizeNormals(vertex_normals);
+        NormalizeNormals(triangle_normals);
+    }
+    SetVertexAttr("normals", vertex_normals);
+    return *this;
+}
+
+TriangleMesh TriangleMesh::SelectTriangles(const Tensor& mask) const {
+    if (mask.GetShape() != SizeVector({NumTriangles()}) ||
+        mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("The mask must be Bool with shape {{{}}}.",
+                          NumTriangles());
+    }
+    TriangleMesh mesh(*this);
+    mesh.triangle_attr_ =
+            SelectAttrs(triangle_attr_, NumTriangles(), mask.Copy(GetDevice()));
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::SelectVertices(const Tensor& mask) const {
+    if (mask.GetShape() != SizeVector({NumVertices()}) ||
+        mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("The mask must be Bool with shape {{{}}}.",
+                          NumVertices());
+    }
+    const Device device = GetDevice();
+    const Tensor vertex_mask = mask.Copy(device);
+    TriangleMesh mesh(GetDtype(), device);
+    mesh.vertex_attr_ = SelectAttrs(vertex_attr_, NumVertices(), vertex_mask);
+    if (!HasTriangles()) {
+        return mesh;
+    }
+
+    // Old to new vertex indices, -1 for the removed vertices.
+    const Tensor kept = vertex_mask.NonZero().Reshape({-1});
+    Tensor index_map = Tensor::Full({NumVertices()}, -1, Dtype::Int64, device);
+    const InvertIndicesKernel kernel = {
+            static_cast<const int64_t*>(kept.GetDataPtr()),
+            static_cast<int64_t*>(index_map.GetDataPtr())};
+    Launch(device, kept.GetShape(0), kernel);
+
+    const Tensor triangles =
+            index_map.IndexGet({GetTriangles().AsTensor().Reshape({-1})})
+                    .Reshape({NumTriangles(), 3});
+    const Tensor inside = triangles.Ge(Tensor::Zeros({}, Dtype::Int64, device));
+    const Tensor triangle_mask = inside.IndexExtract(1, 0)
+                                         .LogicalAnd(inside.IndexExtract(1, 1))
+                                         .LogicalAnd(inside.IndexExtract(1, 2));
+    mesh.triangle_attr_ =
+            SelectAttrs(triangle_attr_, NumTriangles(), triangle_mask);
+    mesh.triangle_attr_.erase("triangles");
+    mesh.triangle_attr_.emplace(
+            "triangles", TensorList(triangles.IndexGet({triangle_mask})));
+    return mesh;
+}
+
+TriangleMesh& TriangleMesh::RemoveUnreferencedVertices() {
+    if (!HasVertices()) {
+        return *this;
+    }
+    // IndexSet does not support Bool tensors.
+    Tensor referenced =
+            Tensor::Zeros({NumVertices()}, Dtype::UInt8, GetDevice());
+    if (HasTriangles()) {
+        referenced.IndexSet(
+                {GetTriangles().AsTensor().Reshape({-1})},
+                Tensor::Ones({3 * NumTriangles()}, Dtype::UInt8, GetDevice()));
+    }
+    *this = SelectVertices(referenced.To(Dtype::Bool));
+    return *this;
+}
+
+TriangleMesh TriangleMesh::FromLegacyTriangleMesh(
+        const geometry::TriangleMesh& mesh_legacy,
+        Dtype dtype,
+        const Device& device) {
+    AssertFloatDtype(dtype);
+    TriangleMesh mesh(
+            EigenToTensorList(mesh_legacy.vertices_, Dtype::Float64, dtype,
+                              device),
+            EigenToTensorList(mesh_legacy.triangles_, Dtype::Int32,
+                              Dtype::Int64, device));
+    if (mesh_legacy.HasVertexNormals()) {
+        mesh.SetVertexAttr("normals",
+                           EigenToTensorList(mesh_legacy.vertex_normals_,
+                                             Dtype::Float64, dtype, device));
+    }
+    if (mesh_legacy.HasVertexColors()) {
+        mesh.SetVertexAttr("colors",
+                           EigenToTensorList(mesh_legacy.vertex_colors_,
+                                             Dtype::Float64, dtype, device));
+    }
+    if (mesh_legacy.HasTriangleNormals()) {
+        mesh.SetTriangleAttr("normals",
+                             EigenToTensorList(mesh_legacy.triangle_normals_,
+                                               Dtype::Float64, dtype, device));
+    }
+    return mesh;
+}
+
+geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() const {
+    geometry::TriangleMesh mesh_legacy;
+    mesh_legacy.vertices_ =
+            TensorListToEigen<double>(GetVertices(), Dtype::Float64);
+    mesh_legacy.triangles_ =
+            TensorListToEigen<int>(GetTriangles(), Dtype::Int32);
+    if (HasVertexNormals() &&
+        GetVertexAttr("normals").GetShape() == SizeVector({3})) {
+        mesh_legacy.vertex_normals_ = TensorListToEigen<double>(
+                GetVertexAttr("normals"), Dtype::Float64);
+    }
+    if (HasVertexColors() &&
+        GetVertexAttr("colors").GetShape() == SizeVector({3})) {
+        mesh_legacy.vertex_colors_ = TensorListToEigen<double>(
+                GetVertexAttr("colors"), Dtype::Float64);
+    }
+    if (HasTriangleNormals() &&
+        GetTriangleAttr("normals").GetShape() == SizeVector({3})) {
+        mesh_legacy.triangle_normals_ = TensorListToEigen<double>(
+                GetTriangleAttr("normals"), Dtype::Float64);
+    }
+    return mesh_legacy;
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
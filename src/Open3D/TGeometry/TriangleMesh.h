@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Dtype.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorList.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/TGeometry/Geometry.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// \class TriangleMesh
+///
+/// \brief A triangle mesh whose per-vertex and per-triangle attributes are
+/// stored as TensorLists on any Device.
+///
+/// Vertex attributes have one element per vertex, triangle attributes one
+/// element per triangle, both accessed by name. "vertices" of shape (3) and
+/// "triangles", Int64 vertex indices of shape (3), always exist. "normals"
+/// and "colors" are the conventional names of the vertex normals and colors,
+/// "normals" that of the triangle normals. Vertex attributes default to
+/// Float32.
+///
+/// Example:
+/// ```cpp
+/// tgeometry::TriangleMesh mesh =
+///         tgeometry::TriangleMesh::FromLegacyTriangleMesh(
+///                 legacy_mesh, Dtype::Float32, Device("CUDA:0"));
+/// mesh.ComputeVertexNormals();
+/// ```
+class TriangleMesh : public Geometry {
+public:
+    /// \brief Constructs an empty mesh.
+    ///
+    /// \param dtype Dtype of the vertices, Float32 or Float64.
+    /// \param device Device on which all attributes are stored.
+    TriangleMesh(Dtype dtype = Dtype::Float32,
+                 const Device& device = Device("CPU:0"));
+
+    /// \brief Constructs a mesh from vertices of shape {3} and Int64
+    /// triangles of shape {3} on the same device.
+    TriangleMesh(const TensorList& vertices, const TensorList& triangles);
+
+    ~TriangleMesh() override {}
+
+public:
+    /// Removes all vertices, triangles and attributes; the dtype and device
+    /// are kept.
+    TriangleMesh& Clear() override;
+
+    /// Returns `true` iff the mesh has no vertices.
+    bool IsEmpty() const override { return !HasVertices(); }
+
+    /// Returns the vertex attribute \p key. Throws if it does not exist.
+    TensorList& GetVertexAttr(const std::string& key);
+    const TensorList& GetVertexAttr(const std::string& key) const;
+
+    /// Returns the triangle attribute \p key. Throws if it does not exist.
+    TensorList& GetTriangleAttr(const std::string& key);
+    const TensorList& GetTriangleAttr(const std::string& key) const;
+
+    /// Sets vertex attribute \p key. Its size must match the number of
+    /// vertices, except for "vertices" itself.
+    void SetVertexAttr(const std::string& key, const TensorList& value);
+
+    /// Sets triangle attribute \p key. Its size must match the number of
+    /// triangles, except for "triangles" itself.
+    void SetTriangleAttr(const std::string& key, const TensorList& value);
+
+    /// Returns `true` if vertex attribute \p key exists and holds a value for
+    /// every vertex.
+    bool HasVertexAttr(const std::string& key) const;
+
+    /// Returns `true` if triangle attribute \p key exists and holds a value
+    /// for every triangle.
+    bool HasTriangleAttr(const std::string& key) const;
+
+    /// Removes vertex attribute \p key. "vertices" cannot be removed.
+    void RemoveVertexAttr(const std::string& key);
+
+    /// Removes triangle attribute \p key. "triangles" cannot be removed.
+    void RemoveTriangleAttr(const std::string& key);
+
+    bool HasVertices() const { return GetVertices().GetSize() > 0; }
+    bool HasTriangles() const { return GetTriangles().GetSize() > 0; }
+    bool HasVertexNormals() const { return HasVertexAttr("normals"); }
+    bool HasVertexColors() const { return HasVertexAttr("colors"); }
+    bool HasTriangleNormals() const { return HasTriangleAttr("normals"); }
+
+    const TensorList& GetVertices() const {
+        return vertex_attr_.at("vertices");
+    }
+    TensorList& GetVertices() { return vertex_attr_.at("vertices"); }
+    const TensorList& GetTriangles() const {
+        return triangle_attr_.at("triangles");
+    }
+    TensorList& GetTriangles() { return triangle_attr_.at("triangles"); }
+
+    const std::unordered_map<std::string, TensorList>& GetVertexAttrMap()
+            const {
+        return vertex_attr_;
+    }
+    const std::unordered_map<std::string, TensorList>& GetTriangleAttrMap()
+            const {
+        return triangle_attr_;
+    }
+
+    int64_t NumVertices() const { return GetVertices().GetSize(); }
+    int64_t NumTriangles() const { return GetTriangles().GetSize(); }
+
+    Dtype GetDtype() const { return GetVertices().GetDtype(); }
+
+    Device GetDevice() const { return GetVertices().GetDevice(); }
+
+    /// Returns a deep copy of the mesh on \p device.
+    TriangleMesh Copy(const Device& device) const;
+
+    /// Returns the per-dimension minimum of the vertices, shape {3}.
+    Tensor GetMinBound() const;
+
+    /// Returns the per-dimension maximum of the vertices, shape {3}.
+    Tensor GetMaxBound() const;
+
+    /// \brief Applies a 4x4 rigid or affine \p transformation to the vertices
+    /// and the rotational part to the vertex and triangle normals.
+    TriangleMesh& Transform(const Tensor& transformation);
+
+    /// \brief Computes the triangle attribute "normals" from the vertices on
+    /// the mesh's device, as geometry::TriangleMesh::ComputeTriangleNormals.
+    TriangleMesh& ComputeTriangleNormals(bool normalized = true);
+
+    /// \brief Computes the vertex attribute "normals" on the mesh's device, as
+    /// geometry::TriangleMesh::ComputeVertexNormals.
+    ///
+    /// Each vertex sums the normals of its triangles. Missing triangle normals
+    /// are computed unnormalized first, which weights them by area. On CUDA
+    /// devices the sums are atomic, so the order of the additions is
+    /// unspecified.
+    TriangleMesh& ComputeVertexNormals(bool normalized = true);
+
+    /// \brief Returns the triangles where the Bool \p mask of shape {M} is
+    /// true, with all their attributes. Vertices are kept unchanged.
+    TriangleMesh SelectTriangles(const Tensor& mask) const;
+
+    /// \brief Returns the vertices where the Bool \p mask of shape {N} is
+    /// true, with all their attributes, and the triangles whose three
+    /// vertices are kept, reindexed.
+    TriangleMesh SelectVertices(const Tensor& mask) const;
+
+    /// Removes the vertices that no triangle references, with their
+    /// attributes, and reindexes the triangles.
+    TriangleMesh& RemoveUnreferencedVertices();
+
+    /// \brief Converts a geometry::TriangleMesh, including vertex normals,
+    /// vertex colors and triangle normals when present.
+    ///
+    /// \param mesh_legacy The legacy mesh.
+    /// \param dtype Dtype of the vertex and normal attributes, Float32 or
+    /// Float64.
+    /// \param device Device on which the attributes are stored.
+    static TriangleMesh FromLegacyTriangleMesh(
+            const geometry::TriangleMesh& mesh_legacy,
+            Dtype dtype = Dtype::Float32,
+            const Device& device = Device("CPU:0"));
+
+    /// Converts vertices, triangles, normals and colors to a
+    /// geometry::TriangleMesh on the host.
+    geometry::TriangleMesh ToLegacyTriangleMesh() const;
+
+protected:
+    std::unordered_map<std::string, TensorList> vertex_attr_;
+    std::unordered_map<std::string, TensorList> triangle_attr_;
+};
+
+}  // namespace tgeometry
+}  // namespace open3d
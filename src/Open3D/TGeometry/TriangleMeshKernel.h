@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file TriangleMeshKernel.h
+///
+/// Triangle mesh kernels shared by the CPU and CUDA backends of
+/// tgeometry::TriangleMesh. Vertices and normals are contiguous (N, 3)
+/// buffers of float or double, triangles are contiguous (M, 3) Int64
+/// buffers. The results match geometry::TriangleMesh up to the order of the
+/// floating point sums.
+///
+/// Kernels are functors whose operator()(i) handles element i and are run
+/// over [0, n) by LaunchCPU or LaunchCUDA.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// Adds \p value to *\p addr, atomically on CUDA devices. The CPU backend
+/// runs the kernels that use it serially.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicAddScalar(scalar_t* addr, scalar_t value);
+
+template <>
+OPEN3D_HOST_DEVICE inline void AtomicAddScalar(float* addr, float value) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(addr, value);
+#else
+    *addr += value;
+#endif
+}
+
+template <>
+OPEN3D_HOST_DEVICE inline void AtomicAddScalar(double* addr, double value) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 600
+    atomicAdd(addr, value);
+#elif defined(__CUDA_ARCH__)
+    unsigned long long* addr_ull = reinterpret_cast<unsigned long long*>(addr);
+    unsigned long long old = *addr_ull;
+    unsigned long long assumed;
+    do {
+        assumed = old;
+        old = atomicCAS(addr_ull, assumed,
+                        __double_as_longlong(value +
+                                             __longlong_as_double(assumed)));
+    } while (assumed != old);
+#else
+    *addr += value;
+#endif
+}
+
+/// Cross product of the edges (v1 - v0) and (v2 - v0) of triangle i, as
+/// geometry::TriangleMesh::ComputeTriangleNormals before normalization.
+template <typename scalar_t>
+struct TriangleNormalsKernel {
+    const scalar_t* vertices_;
+    const int64_t* triangles_;
+    scalar_t* normals_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const scalar_t* v0 = vertices_ + 3 * triangles_[3 * i];
+        const scalar_t* v1 = vertices_ + 3 * triangles_[3 * i + 1];
+        const scalar_t* v2 = vertices_ + 3 * triangles_[3 * i + 2];
+        const scalar_t e1[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+        const scalar_t e2[3] = {v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]};
+        scalar_t* n = normals_ + 3 * i;
+        n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+    }
+};
+
+/// Adds the normal of triangle i to its three vertices. vertex_normals_
+/// must be zero initialized.
+template <typename scalar_t>
+struct AccumulateVertexNormalsKernel {
+    const int64_t* triangles_;
+    const scalar_t* triangle_normals_;
+    scalar_t* vertex_normals_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const scalar_t* n = triangle_normals_ + 3 * i;
+        for (int k = 0; k < 3; ++k) {
+            scalar_t* vn = vertex_normals_ + 3 * triangles_[3 * i + k];
+            for (int a = 0; a < 3; ++a) {
+                AtomicAddScalar(vn + a, n[a]);
+            }
+        }
+    }
+};
+
+/// Normalizes normal i in place, as geometry::TriangleMesh::NormalizeNormals:
+/// zero normals stay zero and NaN normals become (0, 0, 1).
+template <typename scalar_t>
+struct NormalizeNormalsKernel {
+    scalar_t* normals_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        scalar_t* n = normals_ + 3 * i;
+        const scalar_t norm2 = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+        if (norm2 > 0) {
+            const scalar_t norm = sqrt(norm2);
+            n[0] /= norm;
+            n[1] /= norm;
+            n[2] /= norm;
+        } else if (norm2 != norm2) {
+            n[0] = 0;
+            n[1] = 0;
+            n[2] = 1;
+        }
+    }
+};
+
+/// Sets map_[indices_[i]] to i, which inverts a list of distinct indices.
+struct InvertIndicesKernel {
+    const int64_t* indices_;
+    int64_t* map_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        map_[indices_[i]] = i;
+    }
+};
+
+/// Run kernel(i) for every i in [0, n).
+void LaunchCPU(int64_t n, const TriangleNormalsKernel<float>& kernel);
+void LaunchCPU(int64_t n, const TriangleNormalsKernel<double>& kernel);
+void LaunchCPU(int64_t n, const AccumulateVertexNormalsKernel<float>& kernel);
+void LaunchCPU(int64_t n, const AccumulateVertexNormalsKernel<double>& kernel);
+void LaunchCPU(int64_t n, const NormalizeNormalsKernel<float>& kernel);
+void LaunchCPU(int64_t n, const NormalizeNormalsKernel<double>& kernel);
+void LaunchCPU(int64_t n, const InvertIndicesKernel& kernel);
+
+#ifdef BUILD_CUDA_MODULE
+void LaunchCUDA(int64_t n, const TriangleNormalsKernel<float>& kernel);
+void LaunchCUDA(int64_t n, const TriangleNormalsKernel<double>& kernel);
+void LaunchCUDA(int64_t n, const AccumulateVertexNormalsKernel<float>& kernel);
+void LaunchCUDA(int64_t n,
+                const AccumulateVertexNormalsKernel<double>& kernel);
+void LaunchCUDA(int64_t n, const NormalizeNormalsKernel<float>& kernel);
+void LaunchCUDA(int64_t n, const NormalizeNormalsKernel<double>& kernel);
+void LaunchCUDA(int64_t n, const InvertIndicesKernel& kernel);
+#endif
+
+}  // namespace tgeometry
+}  // namespace open3d
@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/TriangleMeshKernel.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace tgeometry {
+
+/// Elements per task.
+static constexpr int64_t ELEMENT_GRAIN_SIZE = 1024;
+
+template <typename Kernel>
+static void LaunchKernelCPU(int64_t n, const Kernel& kernel) {
+    utility::ParallelFor(0, n, kernel, ELEMENT_GRAIN_SIZE);
+}
+
+/// Triangles share vertices, so their normals are accumulated in order, as
+/// geometry::TriangleMesh::ComputeVertexNormals does.
+template <typename scalar_t>
+static void LaunchAccumulateCPU(
+        int64_t n, const AccumulateVertexNormalsKernel<scalar_t>& kernel) {
+    for (int64_t i = 0; i < n; ++i) {
+        kernel(i);
+    }
+}
+
+void LaunchCPU(int64_t n, const TriangleNormalsKernel<float>& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const TriangleNormalsKernel<double>& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const AccumulateVertexNormalsKernel<float>& kernel) {
+    LaunchAccumulateCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n,
+               const AccumulateVertexNormalsKernel<double>& kernel) {
+    LaunchAccumulateCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const NormalizeNormalsKernel<float>& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const NormalizeNormalsKernel<double>& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const InvertIndicesKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
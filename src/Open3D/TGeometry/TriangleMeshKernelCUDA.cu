@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/TGeometry/TriangleMeshKernel.h"
+
+namespace open3d {
+namespace tgeometry {
+
+template <typename Kernel>
+static void LaunchKernelCUDA(int64_t n, const Kernel& kernel) {
+    const Kernel functor = kernel;
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_HOST_DEVICE(int64_t i) { functor(i); });
+}
+
+void LaunchCUDA(int64_t n, const TriangleNormalsKernel<float>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const TriangleNormalsKernel<double>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const AccumulateVertexNormalsKernel<float>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n,
+                const AccumulateVertexNormalsKernel<double>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const NormalizeNormalsKernel<float>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const NormalizeNormalsKernel<double>& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const InvertIndicesKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+}  // namespace tgeometry
+}  // namespace open3d
@@ -0,0 +1,792 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file TSDFKernel.h
+///
+/// Voxel block TSDF kernels shared by the CPU and CUDA backends. The volume
+/// is a sparse set of blocks of resolution^3 voxels. A block is identified by
+/// its packed integer block coordinate and stored at a block index in
+/// structure-of-arrays buffers, with the voxels of a block in x-fastest
+/// order. Every kernel is a functor whose operator()(i) handles one work item
+/// and is run over [0, n) by LaunchCPU or LaunchCUDA.
+///
+/// Kernels that produce a variable number of outputs per work item run
+/// twice: first with null output pointers to count the outputs of every item
+/// into counts[i], then with the exclusive prefix sum of the counts in
+/// offsets[i] to write them.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Hashmap/HashmapKernel.h"
+
+namespace open3d {
+namespace tintegration {
+
+/// Bits of every block coordinate in a packed block key.
+constexpr int64_t BLOCK_KEY_BITS = 21;
+/// Offset that makes block coordinates non-negative in a packed key.
+constexpr int64_t BLOCK_KEY_OFFSET = int64_t(1) << (BLOCK_KEY_BITS - 1);
+
+/// Number of neighbors of a block, including itself, in the neighbor table.
+constexpr int64_t NUM_BLOCK_NEIGHBORS = 27;
+
+/// Returns true if the block and all its neighbors have packed keys.
+OPEN3D_HOST_DEVICE inline bool IsValidBlock(int64_t x, int64_t y, int64_t z) {
+    return x > -BLOCK_KEY_OFFSET && x < BLOCK_KEY_OFFSET - 1 &&
+           y > -BLOCK_KEY_OFFSET && y < BLOCK_KEY_OFFSET - 1 &&
+           z > -BLOCK_KEY_OFFSET && z < BLOCK_KEY_OFFSET - 1;
+}
+
+/// Packs a block coordinate into a non-negative Int64. The key of a
+/// neighbor is the key of the block plus PackBlockOffset(dx, dy, dz).
+OPEN3D_HOST_DEVICE inline int64_t PackBlockKey(int64_t x,
+                                               int64_t y,
+                                               int64_t z) {
+    return ((x + BLOCK_KEY_OFFSET) << (2 * BLOCK_KEY_BITS)) |
+           ((y + BLOCK_KEY_OFFSET) << BLOCK_KEY_BITS) | (z + BLOCK_KEY_OFFSET);
+}
+
+OPEN3D_HOST_DEVICE inline int64_t PackBlockOffset(int64_t dx,
+                                                  int64_t dy,
+                                                  int64_t dz) {
+    return dx * (int64_t(1) << (2 * BLOCK_KEY_BITS)) +
+           dy * (int64_t(1) << BLOCK_KEY_BITS) + dz;
+}
+
+OPEN3D_HOST_DEVICE inline void UnpackBlockKey(int64_t key,
+                                              int64_t& x,
+                                              int64_t& y,
+                                              int64_t& z) {
+    const int64_t mask = (int64_t(1) << BLOCK_KEY_BITS) - 1;
+    x = ((key >> (2 * BLOCK_KEY_BITS)) & mask) - BLOCK_KEY_OFFSET;
+    y = ((key >> BLOCK_KEY_BITS) & mask) - BLOCK_KEY_OFFSET;
+    z = (key & mask) - BLOCK_KEY_OFFSET;
+}
+
+/// One RGB-D frame and its camera, passed by value to the kernels.
+struct TSDFFrame {
+    float fx_, fy_, cx_, cy_;
+    float world_to_camera_[3][4];
+    float camera_to_world_[3][4];
+    int64_t width_, height_;
+    /// (height, width) Float32 or UInt16 depth.
+    const void* depth_;
+    bool depth_is_uint16_;
+    /// Raw depth per meter.
+    float depth_scale_;
+    /// Depth beyond which pixels are ignored, in meters.
+    float depth_max_;
+    /// (height, width, color_channels) Float32 or UInt8 color, or nullptr.
+    const void* color_;
+    bool color_is_uint8_;
+    int64_t color_channels_;
+};
+
+/// Returns the depth of pixel (u, v) in meters, or 0 if it is invalid.
+OPEN3D_HOST_DEVICE inline float ReadDepth(const TSDFFrame& frame,
+                                          int64_t u,
+                                          int64_t v) {
+    const int64_t i = v * frame.width_ + u;
+    const float raw =
+            frame.depth_is_uint16_
+                    ? float(static_cast<const uint16_t*>(frame.depth_)[i])
+                    : static_cast<const float*>(frame.depth_)[i];
+    const float depth = raw / frame.depth_scale_;
+    return depth > 0.0f && depth <= frame.depth_max_ ? depth : 0.0f;
+}
+
+/// Reads the color of pixel (u, v) as RGB in [0, 1]. A single channel is
+/// replicated.
+OPEN3D_HOST_DEVICE inline void ReadColor(const TSDFFrame& frame,
+                                         int64_t u,
+                                         int64_t v,
+                                         float* rgb) {
+    const int64_t i = (v * frame.width_ + u) * frame.color_channels_;
+    for (int64_t c = 0; c < 3; ++c) {
+        const int64_t k = i + (frame.color_channels_ == 3 ? c : 0);
+        rgb[c] = frame.color_is_uint8_
+                         ? static_cast<const uint8_t*>(frame.color_)[k] /
+                                   255.0f
+                         : static_cast<const float*>(frame.color_)[k];
+    }
+}
+
+OPEN3D_HOST_DEVICE inline void TransformPoint(const float (&m)[3][4],
+                                              const float* p,
+                                              float* q) {
+    for (int r = 0; r < 3; ++r) {
+        q[r] = m[r][0] * p[0] + m[r][1] * p[1] + m[r][2] * p[2] + m[r][3];
+    }
+}
+
+/// Voxel buffers of a volume. Voxel v of block b is at b * resolution^3 + v.
+struct VoxelBlockView {
+    int64_t resolution_;
+    float voxel_size_;
+    /// Packed key of every block.
+    const int64_t* block_keys_;
+    float* tsdf_;
+    float* weight_;
+    /// RGB in [0, 1], or nullptr if the volume has no color.
+    float* color_;
+    /// NUM_BLOCK_NEIGHBORS block indices per block, -1 where the neighbor
+    /// block does not exist. Only needed for extraction.
+    const int* neighbors_;
+};
+
+/// Returns the index of voxel (x, y, z) relative to block \p block, where
+/// each coordinate may step one voxel into a neighbor block, or -1 if that
+/// block does not exist.
+OPEN3D_HOST_DEVICE inline int64_t GetVoxelIndex(const VoxelBlockView& volume,
+                                                int64_t block,
+                                                int64_t x,
+                                                int64_t y,
+                                                int64_t z) {
+    const int64_t r = volume.resolution_;
+    const int64_t dx = x < 0 ? -1 : (x >= r ? 1 : 0);
+    const int64_t dy = y < 0 ? -1 : (y >= r ? 1 : 0);
+    const int64_t dz = z < 0 ? -1 : (z >= r ? 1 : 0);
+    const int64_t neighbor =
+            volume.neighbors_[block * NUM_BLOCK_NEIGHBORS +
+                              (dx + 1) * 9 + (dy + 1) * 3 + (dz + 1)];
+    if (neighbor < 0) {
+        return -1;
+    }
+    return ((neighbor * r + (z - dz * r)) * r + (y - dy * r)) * r +
+           (x - dx * r);
+}
+
+/// Same as above, but also returns -1 for voxels without observations.
+OPEN3D_HOST_DEVICE inline int64_t GetObservedVoxelIndex(
+        const VoxelBlockView& volume,
+        int64_t block,
+        int64_t x,
+        int64_t y,
+        int64_t z) {
+    const int64_t index = GetVoxelIndex(volume, block, x, y, z);
+    return index >= 0 && volume.weight_[index] > 0.0f ? index : -1;
+}
+
+/// Splits work item i over voxels into its block and voxel coordinates.
+OPEN3D_HOST_DEVICE inline void GetVoxelCoordinate(int64_t i,
+                                                  int64_t resolution,
+                                                  int64_t& block,
+                                                  int64_t& x,
+                                                  int64_t& y,
+                                                  int64_t& z) {
+    const int64_t r3 = resolution * resolution * resolution;
+    block = i / r3;
+    const int64_t v = i % r3;
+    x = v % resolution;
+    y = (v / resolution) % resolution;
+    z = v / (resolution * resolution);
+}
+
+/// World coordinate of the center of voxel (x, y, z) of the block with the
+/// block coordinate (bx, by, bz).
+OPEN3D_HOST_DEVICE inline void GetVoxelCenter(const VoxelBlockView& volume,
+                                              int64_t bx,
+                                              int64_t by,
+                                              int64_t bz,
+                                              int64_t x,
+                                              int64_t y,
+                                              int64_t z,
+                                              float* p) {
+    const int64_t r = volume.resolution_;
+    p[0] = (float(bx * r + x) + 0.5f) * volume.voxel_size_;
+    p[1] = (float(by * r + y) + 0.5f) * volume.voxel_size_;
+    p[2] = (float(bz * r + z) + 0.5f) * volume.voxel_size_;
+}
+
+/// Gradient of the TSDF at a voxel, by central differences where both
+/// neighbors are observed and one-sided differences otherwise.
+OPEN3D_HOST_DEVICE inline void GetTSDFGradient(const VoxelBlockView& volume,
+                                               int64_t block,
+                                               int64_t x,
+                                               int64_t y,
+                                               int64_t z,
+                                               float* gradient) {
+    const int64_t center = GetVoxelIndex(volume, block, x, y, z);
+    for (int a = 0; a < 3; ++a) {
+        const int64_t ex = a == 0, ey = a == 1, ez = a == 2;
+        const int64_t next = GetObservedVoxelIndex(volume, block, x + ex,
+                                                   y + ey, z + ez);
+        const int64_t prev = GetObservedVoxelIndex(volume, block, x - ex,
+                                                   y - ey, z - ez);
+        const float f_next = volume.tsdf_[next >= 0 ? next : center];
+        const float f_prev = volume.tsdf_[prev >= 0 ? prev : center];
+        const float steps = float(next >= 0) + float(prev >= 0);
+        gradient[a] = steps > 0.0f ? (f_next - f_prev) / steps : 0.0f;
+    }
+}
+
+/// Allocates the blocks along the ray of every sampled pixel within the
+/// truncation distance of its depth. Sample i writes max_steps_ packed keys
+/// to keys_[i * max_steps_], -1 where there is no block.
+struct TouchBlocksKernel {
+    TSDFFrame frame_;
+    int64_t stride_;
+    int64_t num_columns_;
+    int64_t max_steps_;
+    float sdf_trunc_;
+    float block_size_;
+    int64_t* keys_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        int64_t* keys = keys_ + i * max_steps_;
+        const int64_t u = (i % num_columns_) * stride_;
+        const int64_t v = (i / num_columns_) * stride_;
+        const float depth = ReadDepth(frame_, u, v);
+        const float ray[3] = {(float(u) - frame_.cx_) / frame_.fx_,
+                              (float(v) - frame_.cy_) / frame_.fy_, 1.0f};
+        const float length =
+                sqrtf(ray[0] * ray[0] + ray[1] * ray[1] + ray[2] * ray[2]);
+        const float step = 2.0f * sdf_trunc_ / float(max_steps_ - 1);
+        for (int64_t s = 0; s < max_steps_; ++s) {
+            keys[s] = -1;
+            const float t = depth * length - sdf_trunc_ + float(s) * step;
+            if (depth == 0.0f || t <= 0.0f) {
+                continue;
+            }
+            float p_camera[3], p[3];
+            for (int d = 0; d < 3; ++d) {
+                p_camera[d] = ray[d] * (t / length);
+            }
+            TransformPoint(frame_.camera_to_world_, p_camera, p);
+            const int64_t bx = int64_t(floorf(p[0] / block_size_));
+            const int64_t by = int64_t(floorf(p[1] / block_size_));
+            const int64_t bz = int64_t(floorf(p[2] / block_size_));
+            if (IsValidBlock(bx, by, bz)) {
+                keys[s] = PackBlockKey(bx, by, bz);
+            }
+        }
+    }
+};
+
+/// Integrates a frame into every voxel of the blocks block_indices_, in the
+/// same way as integration::UniformTSDFVolume.
+struct IntegrateKernel {
+    TSDFFrame frame_;
+    VoxelBlockView volume_;
+    const int* block_indices_;
+    float sdf_trunc_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        int64_t n, x, y, z, bx, by, bz;
+        GetVoxelCoordinate(i, volume_.resolution_, n, x, y, z);
+        const int64_t block = block_indices_[n];
+        UnpackBlockKey(volume_.block_keys_[block], bx, by, bz);
+        float p[3], q[3];
+        GetVoxelCenter(volume_, bx, by, bz, x, y, z, p);
+        TransformPoint(frame_.world_to_camera_, p, q);
+        if (q[2] <= 0.0f) {
+            return;
+        }
+        const float u_f = q[0] * frame_.fx_ / q[2] + frame_.cx_ + 0.5f;
+        const float v_f = q[1] * frame_.fy_ / q[2] + frame_.cy_ + 0.5f;
+        if (!(u_f >= 0.0001f && u_f < frame_.width_ - 0.0001f &&
+              v_f >= 0.0001f && v_f < frame_.height_ - 0.0001f)) {
+            return;
+        }
+        const int64_t u = int64_t(u_f);
+        const int64_t v = int64_t(v_f);
+        const float depth = ReadDepth(frame_, u, v);
+        if (depth == 0.0f) {
+            return;
+        }
+        // Distance along the ray of the pixel, as in
+        // geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage.
+        const float ray_x = (float(u) - frame_.cx_) / frame_.fx_;
+        const float ray_y = (float(v) - frame_.cy_) / frame_.fy_;
+        const float sdf =
+                (depth - q[2]) * sqrtf(1.0f + ray_x * ray_x + ray_y * ray_y);
+        if (sdf <= -sdf_trunc_) {
+            return;
+        }
+        const float tsdf = fminf(1.0f, sdf / sdf_trunc_);
+        const int64_t index =
+                ((block * volume_.resolution_ + z) * volume_.resolution_ + y) *
+                        volume_.resolution_ +
+                x;
+        const float weight = volume_.weight_[index];
+        volume_.tsdf_[index] =
+                (volume_.tsdf_[index] * weight + tsdf) / (weight + 1.0f);
+        if (volume_.color_ && frame_.color_) {
+            float rgb[3];
+            ReadColor(frame_, u, v, rgb);
+            float* color = volume_.color_ + 3 * index;
+            for (int c = 0; c < 3; ++c) {
+                color[c] = (color[c] * weight + rgb[c]) / (weight + 1.0f);
+            }
+        }
+        volume_.weight_[index] = weight + 1.0f;
+    }
+};
+
+/// Extracts the zero crossings of the TSDF between every voxel and its
+/// neighbors in +x, +y and +z as points with normals and colors, as
+/// integration::ScalableTSDFVolume::ExtractPointCloud does.
+struct ExtractPointsKernel {
+    VoxelBlockView volume_;
+    int64_t* counts_;
+    const int64_t* offsets_;
+    float* points_;
+    float* normals_;
+    float* colors_;
+
+    OPEN3D_HOST_DEVICE static bool IsNearSurface(const VoxelBlockView& volume,
+                                                 int64_t index) {
+        if (index < 0 || volume.weight_[index] == 0.0f) {
+            return false;
+        }
+        const float f = volume.tsdf_[index];
+        return f < 0.98f && f >= -0.98f;
+    }
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        int64_t block, x, y, z, bx, by, bz;
+        GetVoxelCoordinate(i, volume_.resolution_, block, x, y, z);
+        const int64_t index0 = GetVoxelIndex(volume_, block, x, y, z);
+        int64_t count = 0;
+        if (!IsNearSurface(volume_, index0)) {
+            if (!points_) {
+                counts_[i] = 0;
+            }
+            return;
+        }
+        UnpackBlockKey(volume_.block_keys_[block], bx, by, bz);
+        float p0[3];
+        GetVoxelCenter(volume_, bx, by, bz, x, y, z, p0);
+        const float f0 = volume_.tsdf_[index0];
+        for (int a = 0; a < 3; ++a) {
+            const int64_t ex = a == 0, ey = a == 1, ez = a == 2;
+            const int64_t index1 =
+                    GetVoxelIndex(volume_, block, x + ex, y + ey, z + ez);
+            if (!IsNearSurface(volume_, index1)) {
+                continue;
+            }
+            const float f1 = volume_.tsdf_[index1];
+            if (f0 * f1 >= 0.0f) {
+                continue;
+            }
+            if (points_) {
+                const int64_t k = offsets_[i] + count;
+                const float r0 = fabsf(f0), r1 = fabsf(f1);
+                const float t = r0 / (r0 + r1);
+                for (int d = 0; d < 3; ++d) {
+                    points_[3 * k + d] = p0[d];
+                }
+                points_[3 * k + a] += t * volume_.voxel_size_;
+                float g0[3], g1[3];
+                GetTSDFGradient(volume_, block, x, y, z, g0);
+                GetTSDFGradient(volume_, block, x + ex, y + ey, z + ez, g1);
+                float n[3];
+                float norm2 = 0.0f;
+                for (int d = 0; d < 3; ++d) {
+                    n[d] = g0[d] * (1.0f - t) + g1[d] * t;
+                    norm2 += n[d] * n[d];
+                }
+                const float inv_norm = norm2 > 0.0f ? 1.0f / sqrtf(norm2) : 0;
+                for (int d = 0; d < 3; ++d) {
+                    normals_[3 * k + d] = n[d] * inv_norm;
+                }
+                if (colors_ && volume_.color_) {
+                    for (int d = 0; d < 3; ++d) {
+                        colors_[3 * k + d] =
+                                volume_.color_[3 * index0 + d] * (1.0f - t) +
+                                volume_.color_[3 * index1 + d] * t;
+                    }
+                }
+            }
+            ++count;
+        }
+        if (!points_) {
+            counts_[i] = count;
+        }
+    }
+};
+
+/// Marching cubes tables, see Integration/MarchingCubesConst.h.
+struct MarchingCubesTables {
+    /// tri_table[256][16].
+    const int* tri_table_;
+    /// Corner offsets shift[8][3].
+    const int* corner_shift_;
+    /// edge_shift[12][4], the first corner of every edge and its axis.
+    const int* edge_shift_;
+};
+
+/// Creates the marching cubes vertices. Every voxel owns the edges from its
+/// center to its neighbors in +x, +y and +z, and creates a vertex on every
+/// owned edge where the TSDF changes sign. The vertex of edge a of voxel
+/// index v is stored at vertex_indices_[3 * v + a].
+struct ExtractVerticesKernel {
+    VoxelBlockView volume_;
+    int64_t* counts_;
+    const int64_t* offsets_;
+    float* vertices_;
+    float* colors_;
+    int* vertex_indices_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        int64_t block, x, y, z, bx, by, bz;
+        GetVoxelCoordinate(i, volume_.resolution_, block, x, y, z);
+        const int64_t index0 = GetObservedVoxelIndex(volume_, block, x, y, z);
+        int64_t count = 0;
+        if (index0 >= 0) {
+            UnpackBlockKey(volume_.block_keys_[block], bx, by, bz);
+            float p0[3];
+            GetVoxelCenter(volume_, bx, by, bz, x, y, z, p0);
+            const float f0 = volume_.tsdf_[index0];
+            for (int a = 0; a < 3; ++a) {
+                const int64_t ex = a == 0, ey = a == 1, ez = a == 2;
+                const int64_t index1 = GetObservedVoxelIndex(
+                        volume_, block, x + ex, y + ey, z + ez);
+                if (index1 < 0) {
+                    continue;
+                }
+                const float f1 = volume_.tsdf_[index1];
+                if ((f0 < 0.0f) == (f1 < 0.0f)) {
+                    continue;
+                }
+                if (vertices_) {
+                    const int64_t k = offsets_[i] + count;
+                    const float r0 = fabsf(f0), r1 = fabsf(f1);
+                    const float t = r0 / (r0 + r1);
+                    for (int d = 0; d < 3; ++d) {
+                        vertices_[3 * k + d] = p0[d];
+                    }
+                    vertices_[3 * k + a] += t * volume_.voxel_size_;
+                    if (colors_ && volume_.color_) {
+                        for (int d = 0; d < 3; ++d) {
+                            colors_[3 * k + d] =
+                                    volume_.color_[3 * index0 + d] *
+                                            (1.0f - t) +
+                                    volume_.color_[3 * index1 + d] * t;
+                        }
+                    }
+                    vertex_indices_[3 * index0 + a] = int(k);
+                }
+                ++count;
+            }
+        }
+        if (!vertices_) {
+            counts_[i] = count;
+        }
+    }
+};
+
+/// Creates the marching cubes triangles of the cube spanned by every voxel
+/// and its neighbors in +x, +y and +z, from the vertices of
+/// ExtractVerticesKernel.
+struct ExtractTrianglesKernel {
+    VoxelBlockView volume_;
+    MarchingCubesTables tables_;
+    const int* vertex_indices_;
+    int64_t* counts_;
+    const int64_t* offsets_;
+    int* triangles_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        int64_t block, x, y, z;
+        GetVoxelCoordinate(i, volume_.resolution_, block, x, y, z);
+        int cube_index = 0;
+        for (int c = 0; c < 8; ++c) {
+            const int* shift = tables_.corner_shift_ + 3 * c;
+            const int64_t index = GetObservedVoxelIndex(
+                    volume_, block, x + shift[0], y + shift[1], z + shift[2]);
+            if (index < 0) {
+                cube_index = 0;
+                break;
+            }
+            if (volume_.tsdf_[index] < 0.0f) {
+                cube_index |= 1 << c;
+            }
+        }
+        const int* tris = tables_.tri_table_ + 16 * cube_index;
+        int64_t count = 0;
+        if (cube_index != 0 && cube_index != 255) {
+            for (; tris[3 * count] != -1; ++count) {
+                if (!triangles_) {
+                    continue;
+                }
+                int* triangle = triangles_ + 3 * (offsets_[i] + count);
+                for (int j = 0; j < 3; ++j) {
+                    const int* edge =
+                            tables_.edge_shift_ + 4 * tris[3 * count + j];
+                    const int64_t owner =
+                            GetVoxelIndex(volume_, block, x + edge[0],
+                                          y + edge[1], z + edge[2]);
+                    // Same winding as integration::UniformTSDFVolume.
+                    triangle[j == 0 ? 0 : 3 - j] =
+                            vertex_indices_[3 * owner + edge[3]];
+                }
+            }
+        }
+        if (!triangles_) {
+            counts_[i] = count;
+        }
+    }
+};
+
+/// Casts the ray of every pixel into the volume, as
+/// integration::UniformTSDFVolume::Raycast does: rays cross missing blocks in
+/// one step and otherwise step by the distance that the TSDF guarantees to be
+/// free, at least one voxel, up to the first crossing from positive to
+/// negative TSDF interpolated between observed voxels. Pixel i writes
+/// depth_[i], normals_[3 * i] in camera coordinates and colors_[3 * i],
+/// zeros where its ray misses. Blocks are looked up in block_map_, from
+/// packed keys to Int32 block indices.
+struct RaycastKernel {
+    /// Camera of the images. The depth and color of the frame are unused.
+    TSDFFrame frame_;
+    VoxelBlockView volume_;
+    hashmap::HashmapView block_map_;
+    float sdf_trunc_;
+    float* depth_;
+    float* normals_;
+    /// nullptr if the volume has no color.
+    float* colors_;
+
+    /// Last block looked up by a ray, which is usually the next one too.
+    struct BlockCache {
+        int64_t key_;
+        int64_t block_;
+    };
+
+    OPEN3D_HOST_DEVICE static int64_t FloorDiv(int64_t a, int64_t b) {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+
+    OPEN3D_HOST_DEVICE int64_t FindBlock(int64_t bx,
+                                         int64_t by,
+                                         int64_t bz,
+                                         BlockCache& cache) const {
+        if (!IsValidBlock(bx, by, bz)) {
+            return -1;
+        }
+        const int64_t key = PackBlockKey(bx, by, bz);
+        if (key != cache.key_) {
+            const int64_t slot = hashmap::FindKey(
+                    block_map_, reinterpret_cast<const uint8_t*>(&key));
+            cache.key_ = key;
+            cache.block_ = slot < 0 ? -1
+                                    : *reinterpret_cast<const int*>(
+                                              block_map_.values_ +
+                                              slot * block_map_.value_bytes_);
+        }
+        return cache.block_;
+    }
+
+    /// Index of an observed voxel in global voxel coordinates, or -1.
+    OPEN3D_HOST_DEVICE int64_t FindVoxel(int64_t x,
+                                         int64_t y,
+                                         int64_t z,
+                                         BlockCache& cache) const {
+        const int64_t r = volume_.resolution_;
+        const int64_t bx = FloorDiv(x, r), by = FloorDiv(y, r),
+                      bz = FloorDiv(z, r);
+        const int64_t block = FindBlock(bx, by, bz, cache);
+        if (block < 0) {
+            return -1;
+        }
+        const int64_t index =
+                ((block * r + (z - bz * r)) * r + (y - by * r)) * r +
+                (x - bx * r);
+        return volume_.weight_[index] > 0.0f ? index : -1;
+    }
+
+    /// Trilinear TSDF, or color if \p color is not nullptr, at q in voxel
+    /// units. Returns false unless all eight voxels around q are observed.
+    OPEN3D_HOST_DEVICE bool Interpolate(const float* q,
+                                        BlockCache& cache,
+                                        float& tsdf,
+                                        float* color) const {
+        const float px = q[0] - 0.5f, py = q[1] - 0.5f, pz = q[2] - 0.5f;
+        const int64_t x0 = int64_t(floorf(px)), y0 = int64_t(floorf(py)),
+                      z0 = int64_t(floorf(pz));
+        const float rx = px - float(x0), ry = py - float(y0),
+                    rz = pz - float(z0);
+        tsdf = 0.0f;
+        if (color) {
+            color[0] = color[1] = color[2] = 0.0f;
+        }
+        for (int c = 0; c < 8; ++c) {
+            const int dx = c >> 2, dy = (c >> 1) & 1, dz = c & 1;
+            const int64_t index = FindVoxel(x0 + dx, y0 + dy, z0 + dz, cache);
+            if (index < 0) {
+                return false;
+            }
+            const float w = (dx ? rx : 1.0f - rx) * (dy ? ry : 1.0f - ry) *
+                            (dz ? rz : 1.0f - rz);
+            tsdf += w * volume_.tsdf_[index];
+            if (color) {
+                for (int d = 0; d < 3; ++d) {
+                    color[d] += w * volume_.color_[3 * index + d];
+                }
+            }
+        }
+        return true;
+    }
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % frame_.width_;
+        const int64_t v = i / frame_.width_;
+        depth_[i] = 0.0f;
+        for (int d = 0; d < 3; ++d) {
+            normals_[3 * i + d] = 0.0f;
+            if (colors_) {
+                colors_[3 * i + d] = 0.0f;
+            }
+        }
+
+        // Ray q0 + d * dir in voxel units, parameterized by the depth d.
+        const float ray[3] = {(float(u) - frame_.cx_) / frame_.fx_,
+                              (float(v) - frame_.cy_) / frame_.fy_, 1.0f};
+        float q0[3], dir[3];
+        for (int a = 0; a < 3; ++a) {
+            q0[a] = frame_.camera_to_world_[a][3] / volume_.voxel_size_;
+            dir[a] = (frame_.camera_to_world_[a][0] * ray[0] +
+                      frame_.camera_to_world_[a][1] * ray[1] +
+                      frame_.camera_to_world_[a][2] * ray[2]) /
+                     volume_.voxel_size_;
+        }
+        const float voxel_step = 1.0f / sqrtf(dir[0] * dir[0] +
+                                              dir[1] * dir[1] +
+                                              dir[2] * dir[2]);
+        const float trunc_step =
+                sdf_trunc_ / volume_.voxel_size_ * voxel_step;
+        const int64_t r = volume_.resolution_;
+        BlockCache cache = {-1, -1};
+        bool has_prev = false;
+        float prev_tsdf = 0.0f, prev_d = 0.0f, d = 0.0f, q[3];
+        bool hit = false;
+        while (d < frame_.depth_max_) {
+            for (int a = 0; a < 3; ++a) {
+                q[a] = q0[a] + d * dir[a];
+            }
+            const int64_t b[3] = {int64_t(floorf(q[0] / float(r))),
+                                  int64_t(floorf(q[1] / float(r))),
+                                  int64_t(floorf(q[2] / float(r)))};
+            if (FindBlock(b[0], b[1], b[2], cache) < 0) {
+                // Cross the missing block at once.
+                float d_exit = frame_.depth_max_;
+                for (int a = 0; a < 3; ++a) {
+                    if (dir[a] != 0.0f) {
+                        const float bound =
+                                float((b[a] + (dir[a] > 0.0f)) * r);
+                        d_exit = fminf(d_exit, (bound - q0[a]) / dir[a]);
+                    }
+                }
+                d = fmaxf(d_exit, d) + 0.01f * voxel_step;
+                has_prev = false;
+                continue;
+            }
+            float tsdf;
+            if (!Interpolate(q, cache, tsdf, nullptr)) {
+                d += voxel_step;
+                has_prev = false;
+                continue;
+            }
+            if (has_prev && prev_tsdf > 0.0f && tsdf <= 0.0f) {
+                d = prev_d + (d - prev_d) * prev_tsdf / (prev_tsdf - tsdf);
+                for (int a = 0; a < 3; ++a) {
+                    q[a] = q0[a] + d * dir[a];
+                }
+                hit = true;
+                break;
+            }
+            has_prev = true;
+            prev_tsdf = tsdf;
+            prev_d = d;
+            d += fmaxf(voxel_step, tsdf * trunc_step);
+        }
+        if (!hit) {
+            return;
+        }
+        depth_[i] = d;
+
+        // Central differences where both sides are observed, one-sided
+        // differences otherwise.
+        float center = 0.0f, gradient[3], norm2 = 0.0f;
+        Interpolate(q, cache, center, nullptr);
+        for (int a = 0; a < 3; ++a) {
+            float q_next[3] = {q[0], q[1], q[2]};
+            float q_prev[3] = {q[0], q[1], q[2]};
+            q_next[a] += 1.0f;
+            q_prev[a] -= 1.0f;
+            float next, prev;
+            const bool has_next = Interpolate(q_next, cache, next, nullptr);
+            const bool has_prev = Interpolate(q_prev, cache, prev, nullptr);
+            if (has_next && has_prev) {
+                gradient[a] = 0.5f * (next - prev);
+            } else if (has_next) {
+                gradient[a] = next - center;
+            } else if (has_prev) {
+                gradient[a] = center - prev;
+            } else {
+                gradient[a] = 0.0f;
+            }
+            norm2 += gradient[a] * gradient[a];
+        }
+        const float inv_norm = norm2 > 0.0f ? 1.0f / sqrtf(norm2) : 0.0f;
+        for (int a = 0; a < 3; ++a) {
+            const float* rotation = frame_.world_to_camera_[a];
+            normals_[3 * i + a] = (rotation[0] * gradient[0] +
+                                   rotation[1] * gradient[1] +
+                                   rotation[2] * gradient[2]) *
+                                  inv_norm;
+        }
+        if (colors_ && volume_.color_) {
+            float tsdf;
+            Interpolate(q, cache, tsdf, colors_ + 3 * i);
+        }
+    }
+};
+
+/// Run kernel(i) for every i in [0, n).
+void LaunchCPU(int64_t n, const TouchBlocksKernel& kernel);
+void LaunchCPU(int64_t n, const IntegrateKernel& kernel);
+void LaunchCPU(int64_t n, const ExtractPointsKernel& kernel);
+void LaunchCPU(int64_t n, const ExtractVerticesKernel& kernel);
+void LaunchCPU(int64_t n, const ExtractTrianglesKernel& kernel);
+void LaunchCPU(int64_t n, const RaycastKernel& kernel);
+
+#ifdef BUILD_CUDA_MODULE
+void LaunchCUDA(int64_t n, const TouchBlocksKernel& kernel);
+void LaunchCUDA(int64_t n, const IntegrateKernel& kernel);
+void LaunchCUDA(int64_t n, const ExtractPointsKernel& kernel);
+void LaunchCUDA(int64_t n, const ExtractVerticesKernel& kernel);
+void LaunchCUDA(int64_t n, const ExtractTrianglesKernel& kernel);
+void LaunchCUDA(int64_t n, const RaycastKernel& kernel);
+#endif
+
+}  // namespace tintegration
+}  // namespace open3d
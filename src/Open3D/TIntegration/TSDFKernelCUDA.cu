@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/TIntegration/TSDFKernel.h"
+
+namespace open3d {
+namespace tintegration {
+
+template <typename Kernel>
+static void LaunchKernelCUDA(int64_t n, const Kernel& kernel) {
+    const Kernel functor = kernel;
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_HOST_DEVICE(int64_t i) { functor(i); });
+}
+
+void LaunchCUDA(int64_t n, const TouchBlocksKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const IntegrateKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const ExtractPointsKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const ExtractVerticesKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const ExtractTrianglesKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const RaycastKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+}  // namespace tintegration
+}  // namespace open3d
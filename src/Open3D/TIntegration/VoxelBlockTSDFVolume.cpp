@@ -0,0 +1,606 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TIntegration/VoxelBlockTSDFVolume.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include "Open3D/Core/TensorList.h"
+#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/TGeometry/PointCloud.h"
+#include "Open3D/TIntegration/TSDFKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+template <typename Kernel>
+void Launch(const Device& device, int64_t n, const Kernel& kernel) {
+    if (n == 0) {
+        return;
+    }
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        tintegration::LaunchCUDA(n, kernel);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        tintegration::LaunchCPU(n, kernel);
+    }
+}
+
+/// Copies a legacy image to a (height, width, channels) Tensor on the CPU.
+Tensor ImageToTensor(const geometry::Image& image, Dtype dtype) {
+    Tensor tensor({image.height_, image.width_, image.num_of_channels_},
+                  dtype);
+    std::memcpy(tensor.GetDataPtr(), image.data_.data(), image.data_.size());
+    return tensor;
+}
+
+/// Sum of the Int64 counts of a counting pass, and their exclusive prefix
+/// sum, i.e. the first output of every work item.
+int64_t GetOffsets(const Tensor& counts, Tensor& offsets) {
+    offsets = counts.CumSum(0, true);
+    return counts.Sum({0}).Item<int64_t>();
+}
+
+/// Float32 tensor of shape (n, 3), or an empty tensor if n is 0, so that
+/// kernels may write to its data pointer.
+Tensor CreateVectors(int64_t n, const Device& device) {
+    return Tensor({n, 3}, Dtype::Float32, device);
+}
+
+float* GetFloatPtr(Tensor& tensor) {
+    return tensor.NumElements() > 0 ? static_cast<float*>(tensor.GetDataPtr())
+                                    : nullptr;
+}
+
+/// Copies a (height, width, channels) Float32 Tensor to a legacy image.
+void TensorToImage(const Tensor& tensor, geometry::Image& image) {
+    const Tensor host = tensor.Copy(Device("CPU:0"));
+    image.Prepare(int(tensor.GetShape(1)), int(tensor.GetShape(0)),
+                  int(tensor.GetShape(2)), 4);
+    std::memcpy(image.data_.data(), host.GetDataPtr(), image.data_.size());
+}
+
+}  // unnamed namespace
+
+namespace tintegration {
+
+VoxelBlockTSDFVolume::VoxelBlockTSDFVolume(
+        double voxel_length,
+        double sdf_trunc,
+        integration::TSDFVolumeColorType color_type,
+        int block_resolution /* = 8*/,
+        int64_t block_count /* = 1000*/,
+        const Device& device /* = Device("CPU:0")*/,
+        int depth_sampling_stride /* = 4*/)
+    : TSDFVolume(voxel_length, sdf_trunc, color_type),
+      block_resolution_(block_resolution),
+      block_count_(block_count),
+      depth_sampling_stride_(depth_sampling_stride),
+      device_(device),
+      block_map_(2 * block_count, Dtype::Int64, {1}, Dtype::Int32, {1},
+                 device) {
+    if (voxel_length <= 0.0 || sdf_trunc <= 0.0) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume] voxel_length and sdf_trunc must be "
+                "positive.");
+    }
+    if (block_resolution <= 0 || block_count <= 0 ||
+        depth_sampling_stride <= 0) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume] block_resolution, block_count and "
+                "depth_sampling_stride must be positive.");
+    }
+    Reset();
+}
+
+void VoxelBlockTSDFVolume::Reset() {
+    block_map_ = Hashmap(2 * block_count_, Dtype::Int64, {1}, Dtype::Int32,
+                         {1}, device_);
+    num_blocks_ = 0;
+    block_keys_ = Tensor({0}, Dtype::Int64, device_);
+    tsdf_ = Tensor({0, 0}, Dtype::Float32, device_);
+    weight_ = tsdf_;
+    color_ = Tensor({0, 0, 3}, Dtype::Float32, device_);
+    Reserve(block_count_);
+}
+
+void VoxelBlockTSDFVolume::Reserve(int64_t num_blocks) {
+    int64_t capacity = block_keys_.GetShape(0);
+    if (num_blocks <= capacity) {
+        return;
+    }
+    capacity = std::max(num_blocks, 2 * capacity);
+    const int64_t num_voxels =
+            int64_t(block_resolution_) * block_resolution_ * block_resolution_;
+    auto grow = [this, capacity](Tensor& buffer, const SizeVector& shape) {
+        Tensor grown = Tensor::Zeros(shape, buffer.GetDtype(), device_);
+        if (num_blocks_ > 0) {
+            grown.Slice(0, 0, num_blocks_) = buffer.Slice(0, 0, num_blocks_);
+        }
+        buffer = grown;
+    };
+    grow(block_keys_, {capacity});
+    grow(tsdf_, {capacity, num_voxels});
+    grow(weight_, {capacity, num_voxels});
+    if (color_type_ != integration::TSDFVolumeColorType::NoColor) {
+        grow(color_, {capacity, num_voxels, 3});
+    }
+}
+
+Tensor VoxelBlockTSDFVolume::ActivateBlocks(const Tensor& keys) {
+    const int64_t num_keys = keys.GetShape(0);
+    Tensor addrs, masks;
+    block_map_.Activate(keys.Reshape({num_keys, 1}), addrs, masks);
+
+    // New blocks take the next block indices, in the order of the keys.
+    const Tensor is_new = masks.To(Dtype::Int64);
+    const int64_t num_new = is_new.Sum({0}).Item<int64_t>();
+    if (num_new > 0) {
+        Reserve(num_blocks_ + num_new);
+        const std::vector<Tensor> new_rows = masks.NonZeroNumpy();
+        const Tensor new_indices =
+                (is_new.CumSum(0, true) + num_blocks_).IndexGet(new_rows);
+        Tensor values = block_map_.GetValueTensor();
+        values.IndexSet({addrs.IndexGet(new_rows)},
+                        new_indices.To(Dtype::Int32).Reshape({num_new, 1}));
+        block_keys_.IndexSet({new_indices}, keys.IndexGet(new_rows));
+        num_blocks_ += num_new;
+    }
+    return block_map_.GetValueTensor()
+            .IndexGet({addrs})
+            .Reshape({num_keys})
+            .Contiguous();
+}
+
+Tensor VoxelBlockTSDFVolume::GetBlockNeighbors() {
+    std::vector<int64_t> deltas;
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                deltas.push_back(PackBlockOffset(dx, dy, dz));
+            }
+        }
+    }
+    const int64_t num_queries = num_blocks_ * NUM_BLOCK_NEIGHBORS;
+    const Tensor queries =
+            block_keys_.Slice(0, 0, num_blocks_).Reshape({num_blocks_, 1}) +
+            Tensor(deltas, {1, NUM_BLOCK_NEIGHBORS}, Dtype::Int64, device_);
+    Tensor addrs, masks;
+    block_map_.Find(queries.Reshape({num_queries, 1}), addrs, masks);
+
+    Tensor neighbors = Tensor::Full({num_queries}, -1, Dtype::Int32, device_);
+    const std::vector<Tensor> found = masks.NonZeroNumpy();
+    const int64_t num_found = found[0].GetShape(0);
+    if (num_found > 0) {
+        neighbors.IndexSet(found, block_map_.GetValueTensor()
+                                          .IndexGet({addrs.IndexGet(found)})
+                                          .Reshape({num_found}));
+    }
+    return neighbors;
+}
+
+void VoxelBlockTSDFVolume::Integrate(
+        const geometry::RGBDImage& image,
+        const camera::PinholeCameraIntrinsic& intrinsic,
+        const Eigen::Matrix4d& extrinsic) {
+    using integration::TSDFVolumeColorType;
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 4) ||
+        (image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.width_ != intrinsic.width_) ||
+        (color_type_ != TSDFVolumeColorType::NoColor &&
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume::Integrate] Unsupported image format.");
+    }
+    const Tensor depth =
+            ImageToTensor(image.depth_, Dtype::Float32)
+                    .Reshape({image.depth_.height_, image.depth_.width_});
+    Tensor color;
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        color = ImageToTensor(image.color_, Dtype::UInt8);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color = ImageToTensor(image.color_, Dtype::Float32);
+    }
+    const Eigen::Matrix3d K = intrinsic.intrinsic_matrix_;
+    const Eigen::Matrix4d T = extrinsic;
+    Integrate(depth, color,
+              Tensor(std::vector<double>(K.data(), K.data() + 9), {3, 3},
+                     Dtype::Float64)
+                      .T(),
+              Tensor(std::vector<double>(T.data(), T.data() + 16), {4, 4},
+                     Dtype::Float64)
+                      .T(),
+              1.0, 1000.0);
+}
+
+void VoxelBlockTSDFVolume::Integrate(const Tensor& depth,
+                                     const Tensor& color,
+                                     const Tensor& intrinsic,
+                                     const Tensor& extrinsic,
+                                     double depth_scale /* = 1000.0*/,
+                                     double depth_max /* = 3.0*/) {
+    if (depth.NumDims() != 2 || (depth.GetDtype() != Dtype::Float32 &&
+                                 depth.GetDtype() != Dtype::UInt16)) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume::Integrate] depth must be a "
+                "(height, width) Float32 or UInt16 tensor.");
+    }
+    const int64_t height = depth.GetShape(0);
+    const int64_t width = depth.GetShape(1);
+    const bool has_color =
+            color_type_ != integration::TSDFVolumeColorType::NoColor &&
+            color.NumElements() > 0;
+    if (has_color &&
+        (color.NumDims() != 3 || color.GetShape(0) != height ||
+         color.GetShape(1) != width ||
+         (color.GetShape(2) != 1 && color.GetShape(2) != 3) ||
+         (color.GetDtype() != Dtype::UInt8 &&
+          color.GetDtype() != Dtype::Float32))) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume::Integrate] color must be a "
+                "(height, width, 1 or 3) UInt8 or Float32 tensor.");
+    }
+    if (intrinsic.GetShape() != SizeVector{3, 3} ||
+        extrinsic.GetShape() != SizeVector{4, 4}) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume::Integrate] intrinsic must have shape "
+                "{{3, 3}} and extrinsic shape {{4, 4}}.");
+    }
+    if (depth_scale <= 0.0) {
+        utility::LogError(
+                "[VoxelBlockTSDFVolume::Integrate] Invalid depth_scale.");
+    }
+
+    const Device host("CPU:0");
+    const std::vector<double> K = intrinsic.To(Dtype::Float64)
+                                          .Copy(host)
+                                          .ToFlatVector<double>();
+    const std::vector<double> T = extrinsic.To(Dtype::Float64)
+                                          .Copy(host)
+                                          .ToFlatVector<double>();
+    Eigen::Matrix4d world_to_camera;
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            world_to_camera(r, c) = T[r * 4 + c];
+        }
+    }
+    const Eigen::Matrix4d camera_to_world = world_to_camera.inverse();
+
+    const Tensor depth_frame = depth.Copy(device_);
+    const Tensor color_frame = has_color ? color.Copy(device_) : Tensor();
+    TSDFFrame frame;
+    frame.fx_ = float(K[0]);
+    frame.fy_ = float(K[4]);
+    frame.cx_ = float(K[2]);
+    frame.cy_ = float(K[5]);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            frame.world_to_camera_[r][c] = float(world_to_camera(r, c));
+            frame.camera_to_world_[r][c] = float(camera_to_world(r, c));
+        }
+    }
+    frame.width_ = width;
+    frame.height_ = height;
+    frame.depth_ = depth_frame.GetDataPtr();
+    frame.depth_is_uint16_ = depth.GetDtype() == Dtype::UInt16;
+    frame.depth_scale_ = float(depth_scale);
+    frame.depth_max_ = float(depth_max);
+    frame.color_ = has_color ? color_frame.GetDataPtr() : nullptr;
+    frame.color_is_uint8_ = has_color && color.GetDtype() == Dtype::UInt8;
+    frame.color_channels_ = has_color ? color.GetShape(2) : 0;
+
+    // Blocks within the truncation distance along the rays of the sampled
+    // pixels, with two samples per block.
+    const float block_size = float(voxel_length_ * block_resolution_);
+    TouchBlocksKernel touch;
+    touch.frame_ = frame;
+    touch.stride_ = depth_sampling_stride_;
+    touch.num_columns_ =
+            (width + depth_sampling_stride_ - 1) / depth_sampling_stride_;
+    touch.max_steps_ =
+            int64_t(std::ceil(2.0 * sdf_trunc_ / (0.5 * block_size))) + 1;
+    touch.sdf_trunc_ = float(sdf_trunc_);
+    touch.block_size_ = block_size;
+    const int64_t num_rows =
+            (height + depth_sampling_stride_ - 1) / depth_sampling_stride_;
+    const int64_t num_samples = num_rows * touch.num_columns_;
+    Tensor touched({num_samples * touch.max_steps_}, Dtype::Int64, device_);
+    touch.keys_ = static_cast<int64_t*>(touched.GetDataPtr());
+    Launch(device_, num_samples, touch);
+
+    // Unique() sorts the keys, so the -1 of missing blocks come first.
+    Tensor keys = std::get<0>(touched.Unique());
+    if (keys.GetShape(0) > 0 && keys[0].Item<int64_t>() < 0) {
+        keys = keys.Slice(0, 1, keys.GetShape(0));
+    }
+    const int64_t num_touched = keys.GetShape(0);
+    if (num_touched == 0) {
+        return;
+    }
+    const Tensor block_indices = ActivateBlocks(keys.Contiguous());
+
+    IntegrateKernel integrate;
+    integrate.frame_ = frame;
+    integrate.volume_.resolution_ = block_resolution_;
+    integrate.volume_.voxel_size_ = float(voxel_length_);
+    integrate.volume_.block_keys_ =
+            static_cast<const int64_t*>(block_keys_.GetDataPtr());
+    integrate.volume_.tsdf_ = static_cast<float*>(tsdf_.GetDataPtr());
+    integrate.volume_.weight_ = static_cast<float*>(weight_.GetDataPtr());
+    integrate.volume_.color_ = GetFloatPtr(color_);
+    integrate.volume_.neighbors_ = nullptr;
+    integrate.block_indices_ =
+            static_cast<const int*>(block_indices.GetDataPtr());
+    integrate.sdf_trunc_ = float(sdf_trunc_);
+    Launch(device_, num_touched * tsdf_.GetShape(1), integrate);
+}
+
+integration::TSDFRaycastResult VoxelBlockTSDFVolume::Raycast(
+        const camera::PinholeCameraIntrinsic& intrinsic,
+        const Eigen::Matrix4d& extrinsic,
+        double depth_max /* = 3.0*/) {
+    const bool has_color =
+            color_type_ != integration::TSDFVolumeColorType::NoColor;
+    const int64_t width = intrinsic.width_;
+    const int64_t height = intrinsic.height_;
+    const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+    RaycastKernel raycast;
+    raycast.frame_.fx_ = float(intrinsic.GetFocalLength().first);
+    raycast.frame_.fy_ = float(intrinsic.GetFocalLength().second);
+    raycast.frame_.cx_ = float(intrinsic.GetPrincipalPoint().first);
+    raycast.frame_.cy_ = float(intrinsic.GetPrincipalPoint().second);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            raycast.frame_.world_to_camera_[r][c] = float(extrinsic(r, c));
+            raycast.frame_.camera_to_world_[r][c] =
+                    float(camera_to_world(r, c));
+        }
+    }
+    raycast.frame_.width_ = width;
+    raycast.frame_.height_ = height;
+    raycast.frame_.depth_ = nullptr;
+    raycast.frame_.depth_is_uint16_ = false;
+    raycast.frame_.depth_scale_ = 1.0f;
+    raycast.frame_.depth_max_ = float(depth_max);
+    raycast.frame_.color_ = nullptr;
+    raycast.frame_.color_is_uint8_ = false;
+    raycast.frame_.color_channels_ = 0;
+    raycast.volume_.resolution_ = block_resolution_;
+    raycast.volume_.voxel_size_ = float(voxel_length_);
+    raycast.volume_.block_keys_ =
+            static_cast<const int64_t*>(block_keys_.GetDataPtr());
+    raycast.volume_.tsdf_ = static_cast<float*>(tsdf_.GetDataPtr());
+    raycast.volume_.weight_ = static_cast<float*>(weight_.GetDataPtr());
+    raycast.volume_.color_ = GetFloatPtr(color_);
+    raycast.volume_.neighbors_ = nullptr;
+    raycast.block_map_ = block_map_.GetView();
+    raycast.sdf_trunc_ = float(sdf_trunc_);
+
+    Tensor depth({height, width, 1}, Dtype::Float32, device_);
+    Tensor normals({height, width, 3}, Dtype::Float32, device_);
+    Tensor colors({has_color ? height : 0, width, 3}, Dtype::Float32, device_);
+    raycast.depth_ = GetFloatPtr(depth);
+    raycast.normals_ = GetFloatPtr(normals);
+    raycast.colors_ = GetFloatPtr(colors);
+    Launch(device_, width * height, raycast);
+
+    integration::TSDFRaycastResult result;
+    TensorToImage(depth, result.depth_);
+    TensorToImage(normals, result.normal_);
+    if (has_color) {
+        TensorToImage(colors, result.color_);
+    }
+    return result;
+}
+
+tgeometry::PointCloud VoxelBlockTSDFVolume::ExtractTensorPointCloud() {
+    const bool has_color =
+            color_type_ != integration::TSDFVolumeColorType::NoColor;
+    const Tensor neighbors = GetBlockNeighbors();
+    ExtractPointsKernel extract;
+    extract.volume_.resolution_ = block_resolution_;
+    extract.volume_.voxel_size_ = float(voxel_length_);
+    extract.volume_.block_keys_ =
+            static_cast<const int64_t*>(block_keys_.GetDataPtr());
+    extract.volume_.tsdf_ = static_cast<float*>(tsdf_.GetDataPtr());
+    extract.volume_.weight_ = static_cast<float*>(weight_.GetDataPtr());
+    extract.volume_.color_ = GetFloatPtr(color_);
+    extract.volume_.neighbors_ =
+            static_cast<const int*>(neighbors.GetDataPtr());
+
+    const int64_t num_voxels = num_blocks_ * tsdf_.GetShape(1);
+    Tensor counts({num_voxels}, Dtype::Int64, device_);
+    extract.counts_ = static_cast<int64_t*>(counts.GetDataPtr());
+    extract.offsets_ = nullptr;
+    extract.points_ = extract.normals_ = extract.colors_ = nullptr;
+    Launch(device_, num_voxels, extract);
+
+    Tensor offsets;
+    const int64_t num_points =
+            num_voxels > 0 ? GetOffsets(counts, offsets) : 0;
+    Tensor points = CreateVectors(num_points, device_);
+    Tensor normals = CreateVectors(num_points, device_);
+    Tensor colors = CreateVectors(has_color ? num_points : 0, device_);
+    if (num_points > 0) {
+        extract.offsets_ = static_cast<const int64_t*>(offsets.GetDataPtr());
+        extract.points_ = GetFloatPtr(points);
+        extract.normals_ = GetFloatPtr(normals);
+        extract.colors_ = GetFloatPtr(colors);
+        Launch(device_, num_voxels, extract);
+    }
+
+    tgeometry::PointCloud pcd(TensorList::FromTensor(points, true));
+    pcd.SetPointAttr("normals", TensorList::FromTensor(normals, true));
+    if (has_color) {
+        pcd.SetPointAttr("colors", TensorList::FromTensor(colors, true));
+    }
+    return pcd;
+}
+
+std::shared_ptr<geometry::PointCloud>
+VoxelBlockTSDFVolume::ExtractPointCloud() {
+    return std::make_shared<geometry::PointCloud>(
+            ExtractTensorPointCloud().ToLegacyPointCloud());
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+VoxelBlockTSDFVolume::ExtractTriangleMesh() {
+    const bool has_color =
+            color_type_ != integration::TSDFVolumeColorType::NoColor;
+    const Tensor neighbors = GetBlockNeighbors();
+    VoxelBlockView volume;
+    volume.resolution_ = block_resolution_;
+    volume.voxel_size_ = float(voxel_length_);
+    volume.block_keys_ = static_cast<const int64_t*>(block_keys_.GetDataPtr());
+    volume.tsdf_ = static_cast<float*>(tsdf_.GetDataPtr());
+    volume.weight_ = static_cast<float*>(weight_.GetDataPtr());
+    volume.color_ = GetFloatPtr(color_);
+    volume.neighbors_ = static_cast<const int*>(neighbors.GetDataPtr());
+    const int64_t num_voxels = num_blocks_ * tsdf_.GetShape(1);
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    if (num_voxels == 0) {
+        return mesh;
+    }
+
+    // Vertices on the edges owned by every voxel.
+    Tensor vertex_indices =
+            Tensor::Full({num_voxels * 3}, -1, Dtype::Int32, device_);
+    Tensor counts({num_voxels}, Dtype::Int64, device_);
+    Tensor offsets;
+    ExtractVerticesKernel extract_vertices;
+    extract_vertices.volume_ = volume;
+    extract_vertices.counts_ = static_cast<int64_t*>(counts.GetDataPtr());
+    extract_vertices.offsets_ = nullptr;
+    extract_vertices.vertices_ = extract_vertices.colors_ = nullptr;
+    extract_vertices.vertex_indices_ =
+            static_cast<int*>(vertex_indices.GetDataPtr());
+    Launch(device_, num_voxels, extract_vertices);
+    const int64_t num_vertices = GetOffsets(counts, offsets);
+    if (num_vertices == 0) {
+        return mesh;
+    }
+    Tensor vertices = CreateVectors(num_vertices, device_);
+    Tensor vertex_colors = CreateVectors(has_color ? num_vertices : 0, device_);
+    extract_vertices.offsets_ =
+            static_cast<const int64_t*>(offsets.GetDataPtr());
+    extract_vertices.vertices_ = GetFloatPtr(vertices);
+    extract_vertices.colors_ = GetFloatPtr(vertex_colors);
+    Launch(device_, num_voxels, extract_vertices);
+
+    // Triangles of the cubes spanned by every voxel, with the tables of
+    // integration::UniformTSDFVolume.
+    const std::vector<int> tri_table_data(&tri_table[0][0],
+                                          &tri_table[0][0] + 256 * 16);
+    std::vector<int> corner_shift_data, edge_shift_data;
+    for (int i = 0; i < 8; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            corner_shift_data.push_back(shift[i](d));
+        }
+    }
+    for (int i = 0; i < 12; ++i) {
+        for (int d = 0; d < 4; ++d) {
+            edge_shift_data.push_back(edge_shift[i](d));
+        }
+    }
+    const Tensor tri_table_tensor(tri_table_data, {256, 16}, Dtype::Int32,
+                                  device_);
+    const Tensor corner_shift_tensor(corner_shift_data, {8, 3}, Dtype::Int32,
+                                     device_);
+    const Tensor edge_shift_tensor(edge_shift_data, {12, 4}, Dtype::Int32,
+                                   device_);
+    ExtractTrianglesKernel extract_triangles;
+    extract_triangles.volume_ = volume;
+    extract_triangles.tables_.tri_table_ =
+            static_cast<const int*>(tri_table_tensor.GetDataPtr());
+    extract_triangles.tables_.corner_shift_ =
+            static_cast<const int*>(corner_shift_tensor.GetDataPtr());
+    extract_triangles.tables_.edge_shift_ =
+            static_cast<const int*>(edge_shift_tensor.GetDataPtr());
+    extract_triangles.vertex_indices_ =
+            static_cast<const int*>(vertex_indices.GetDataPtr());
+    extract_triangles.counts_ = static_cast<int64_t*>(counts.GetDataPtr());
+    extract_triangles.offsets_ = nullptr;
+    extract_triangles.triangles_ = nullptr;
+    Launch(device_, num_voxels, extract_triangles);
+    const int64_t num_triangles = GetOffsets(counts, offsets);
+    Tensor triangles({num_triangles, 3}, Dtype::Int32, device_);
+    if (num_triangles > 0) {
+        extract_triangles.offsets_ =
+                static_cast<const int64_t*>(offsets.GetDataPtr());
+        extract_triangles.triangles_ =
+                static_cast<int*>(triangles.GetDataPtr());
+        Launch(device_, num_voxels, extract_triangles);
+    }
+
+    const Device host("CPU:0");
+    const std::vector<float> vertex_data =
+            vertices.Copy(host).ToFlatVector<float>();
+    const std::vector<float> color_data =
+            vertex_colors.Copy(host).ToFlatVector<float>();
+    const std::vector<int> triangle_data =
+            triangles.Copy(host).ToFlatVector<int>();
+    mesh->vertices_.resize(num_vertices);
+    mesh->vertex_colors_.resize(has_color ? num_vertices : 0);
+    for (int64_t i = 0; i < num_vertices; ++i) {
+        mesh->vertices_[i] =
+                Eigen::Vector3f(&vertex_data[3 * i]).cast<double>();
+        if (has_color) {
+            mesh->vertex_colors_[i] =
+                    Eigen::Vector3f(&color_data[3 * i]).cast<double>();
+        }
+    }
+    mesh->triangles_.resize(num_triangles);
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        mesh->triangles_[i] = Eigen::Vector3i(&triangle_data[3 * i]);
+    }
+    // Vertices of edges whose cubes have unobserved corners have no
+    // triangles.
+    mesh->RemoveUnreferencedVertices();
+    return mesh;
+}
+
+}  // namespace tintegration
+}  // namespace open3d
@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/Hashmap/Hashmap.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Integration/TSDFVolume.h"
+
+namespace open3d {
+
+namespace tgeometry {
+class PointCloud;
+}
+
+namespace tintegration {
+
+/// \class VoxelBlockTSDFVolume
+///
+/// TSDF volume of spatially hashed voxel blocks on a CPU or CUDA device.
+///
+/// Like integration::ScalableTSDFVolume, only the space near observed
+/// surfaces is allocated, in blocks of block_resolution^3 voxels. The blocks
+/// are looked up by their integer coordinates in a Hashmap and their voxels
+/// are stored in contiguous Tensors on the device, so integration and
+/// extraction each run as a few parallel kernels without copying the volume.
+/// The blocks observed by a frame are found by marching along the rays of
+/// every depth_sampling_stride-th pixel within the truncation distance of the
+/// surface.
+///
+/// Integration and extraction match integration::UniformTSDFVolume, except
+/// that colors are stored as floats in [0, 1] and the points of
+/// ExtractPointCloud are not sorted.
+class VoxelBlockTSDFVolume : public integration::TSDFVolume {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_length Length of a voxel in meters.
+    /// \param sdf_trunc Truncation value for the signed distance function.
+    /// \param color_type Color type of the TSDF volume.
+    /// \param block_resolution Voxels per block edge.
+    /// \param block_count Initial number of blocks. The volume grows when
+    /// more blocks are observed.
+    /// \param device Device of the volume.
+    /// \param depth_sampling_stride Stride of the pixels whose rays allocate
+    /// blocks.
+    VoxelBlockTSDFVolume(double voxel_length,
+                         double sdf_trunc,
+                         integration::TSDFVolumeColorType color_type,
+                         int block_resolution = 8,
+                         int64_t block_count = 1000,
+                         const Device& device = Device("CPU:0"),
+                         int depth_sampling_stride = 4);
+    ~VoxelBlockTSDFVolume() override {}
+
+public:
+    void Reset() override;
+    /// Integrates a legacy RGB-D image, as ScalableTSDFVolume::Integrate.
+    /// The images are copied to the device of the volume.
+    void Integrate(const geometry::RGBDImage& image,
+                   const camera::PinholeCameraIntrinsic& intrinsic,
+                   const Eigen::Matrix4d& extrinsic) override;
+    std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    /// Casts the rays on the device of the volume, one work item per pixel,
+    /// looking blocks up in the hash map. Rays cross missing blocks in one
+    /// step.
+    integration::TSDFRaycastResult Raycast(
+            const camera::PinholeCameraIntrinsic& intrinsic,
+            const Eigen::Matrix4d& extrinsic,
+            double depth_max = 3.0) override;
+
+    /// \brief Integrates a depth frame and optionally its color.
+    ///
+    /// The frames are copied to the device of the volume if they are on
+    /// another device.
+    ///
+    /// \param depth (height, width) Float32 or UInt16 depth.
+    /// \param color (height, width, 3) or (height, width, 1) UInt8 or Float32
+    /// color in [0, 1] for Float32, or an empty Tensor. Ignored if the volume
+    /// has no color.
+    /// \param intrinsic (3, 3) camera intrinsic matrix.
+    /// \param extrinsic (4, 4) world to camera transformation.
+    /// \param depth_scale Depth values per meter.
+    /// \param depth_max Depth in meters beyond which pixels are ignored.
+    void Integrate(const Tensor& depth,
+                   const Tensor& color,
+                   const Tensor& intrinsic,
+                   const Tensor& extrinsic,
+                   double depth_scale = 1000.0,
+                   double depth_max = 3.0);
+
+    /// Extracts the surface as a point cloud with normals, and colors if the
+    /// volume has them, on the device of the volume.
+    tgeometry::PointCloud ExtractTensorPointCloud();
+
+    /// Number of allocated blocks.
+    int64_t GetNumBlocks() const { return num_blocks_; }
+    Device GetDevice() const { return device_; }
+
+protected:
+    /// Grows the voxel buffers to hold at least \p num_blocks blocks.
+    void Reserve(int64_t num_blocks);
+    /// Allocates the blocks of \p keys that are missing and returns the
+    /// Int32 block indices of all keys.
+    Tensor ActivateBlocks(const Tensor& keys);
+    /// Int32 (num_blocks, 27) block indices of the neighbors of every block,
+    /// -1 where they do not exist.
+    Tensor GetBlockNeighbors();
+
+public:
+    /// Voxels per block edge.
+    int block_resolution_;
+    /// Initial number of blocks.
+    int64_t block_count_;
+    /// Stride of the pixels whose rays allocate blocks.
+    int depth_sampling_stride_;
+
+protected:
+    Device device_;
+    /// Map from packed block coordinates (Int64) to block indices (Int32).
+    Hashmap block_map_;
+    int64_t num_blocks_ = 0;
+    /// Int64 (capacity,) packed coordinates of every block.
+    Tensor block_keys_;
+    /// Float32 (capacity, block_resolution^3) voxel values, in the x-fastest
+    /// order of each block.
+    Tensor tsdf_;
+    Tensor weight_;
+    /// Float32 (capacity, block_resolution^3, 3), empty without color.
+    Tensor color_;
+};
+
+}  // namespace tintegration
+}  // namespace open3d
@@ -0,0 +1,512 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file OdometryKernel.h
+///
+/// RGB-D odometry kernels shared by the CPU and CUDA backends. The images of
+/// a pyramid level are contiguous Float32 buffers of width * height pixels,
+/// or of 3 values per pixel for vertex and normal maps, with NaN where there
+/// is no valid depth. The filters reproduce geometry::Image::Filter and
+/// geometry::Image::Downsample value for value, so that the pyramids match
+/// those of odometry::ComputeRGBDOdometry.
+///
+/// Image kernels are functors whose operator()(i) handles pixel i and are
+/// run over [0, n) by LaunchCPU or LaunchCUDA. Reduction kernels add the
+/// terms of source pixel i to ODOMETRY_REDUCTION_SIZE sums in
+/// operator()(i, sums). The CPU variant of Reduce reduces the sums of all
+/// pixels into \p sums, the CUDA variant writes the sums of pixel i to
+/// rows[i * ODOMETRY_REDUCTION_SIZE], to be reduced on the device.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace todometry {
+
+/// Number of values reduced over the source pixels: the upper triangle of
+/// JTJ (21), JTr (6), the sum of the squared residuals and the number of
+/// correspondences. Other reductions use a subset of the values.
+constexpr int64_t ODOMETRY_REDUCTION_SIZE = 29;
+
+/// Scale of the 3x3 Sobel filters, as in odometry::RGBDOdometryJacobian.
+constexpr double ODOMETRY_SOBEL_SCALE = 0.125;
+/// Weight of the depth term of the hybrid odometry.
+constexpr double ODOMETRY_LAMBDA_HYBRID_DEPTH = 0.968;
+
+/// Returns true if \p x is NaN, on the host and on CUDA devices.
+OPEN3D_HOST_DEVICE inline bool IsNaN(float x) { return x != x; }
+
+/// Converts a Float32 or UInt16 depth image to meters, with NaN outside
+/// (0, max_depth_] or below min_depth_, as odometry::ComputeRGBDOdometry
+/// preprocesses depth.
+struct ConvertDepthKernel {
+    /// Float32 or UInt16 raw depth.
+    const void* depth_;
+    bool depth_is_uint16_;
+    /// Raw depth per meter.
+    float depth_scale_;
+    float min_depth_;
+    float max_depth_;
+    float* output_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const float raw =
+                depth_is_uint16_
+                        ? float(static_cast<const uint16_t*>(depth_)[i])
+                        : static_cast<const float*>(depth_)[i];
+        const float depth = raw / depth_scale_;
+        output_[i] = depth < min_depth_ || depth > max_depth_ || depth <= 0
+                             ? NAN
+                             : depth;
+    }
+};
+
+/// Converts a color image to intensities in [0, 1], as
+/// geometry::Image::CreateFloatImage with the weighted conversion. Single
+/// channel Float32 images are copied.
+struct ConvertIntensityKernel {
+    /// UInt8 or Float32 color with channels_ values per pixel.
+    const void* color_;
+    bool color_is_uint8_;
+    int64_t channels_;
+    float* output_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        if (color_is_uint8_) {
+            const uint8_t* p = static_cast<const uint8_t*>(color_) +
+                               i * channels_;
+            output_[i] = channels_ == 3
+                                 ? (0.2990f * float(p[0]) +
+                                    0.5870f * float(p[1]) +
+                                    0.1140f * float(p[2])) /
+                                           255.0f
+                                 : float(p[0]) / 255.0f;
+        } else {
+            const float* p = static_cast<const float*>(color_) + i * channels_;
+            output_[i] = channels_ == 3 ? 0.2990f * p[0] + 0.5870f * p[1] +
+                                                  0.1140f * p[2]
+                                        : p[0];
+        }
+    }
+};
+
+/// Filters the rows or the columns of an image with a 3-tap kernel, the
+/// border pixels are repeated. Two passes apply the separable Gaussian and
+/// Sobel filters of geometry::Image::Filter.
+struct FilterKernel {
+    const float* input_;
+    float* output_;
+    int64_t width_;
+    int64_t height_;
+    float taps_[3];
+    bool horizontal_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % width_;
+        const int64_t v = i / width_;
+        double sum = 0.0;
+        for (int64_t k = 0; k < 3; ++k) {
+            int64_t j;
+            if (horizontal_) {
+                const int64_t x = u + k - 1;
+                j = v * width_ + (x < 0 ? 0 : (x >= width_ ? width_ - 1 : x));
+            } else {
+                const int64_t y = v + k - 1;
+                j = (y < 0 ? 0 : (y >= height_ ? height_ - 1 : y)) * width_ +
+                    u;
+            }
+            sum += input_[j] * taps_[k];
+        }
+        output_[i] = float(sum);
+    }
+};
+
+/// Averages the 2x2 blocks of an image of input_width_ columns into pixel i
+/// of an image of half the size.
+struct DownsampleKernel {
+    const float* input_;
+    float* output_;
+    int64_t input_width_;
+    int64_t output_width_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t x = 2 * (i % output_width_);
+        const int64_t y = 2 * (i / output_width_);
+        const float* p1 = input_ + y * input_width_ + x;
+        const float* p2 = p1 + input_width_;
+        output_[i] = (p1[0] + p1[1] + p2[0] + p2[1]) / 4.0f;
+    }
+};
+
+/// Back-projects the depth of every pixel to a camera space vertex.
+struct CreateVertexMapKernel {
+    const float* depth_;
+    float* vertex_;
+    int64_t width_;
+    double inv_fx_, inv_fy_, cx_, cy_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % width_;
+        const int64_t v = i / width_;
+        const float z = depth_[i];
+        vertex_[3 * i] = float((double(u) - cx_) * z * inv_fx_);
+        vertex_[3 * i + 1] = float((double(v) - cy_) * z * inv_fy_);
+        vertex_[3 * i + 2] = z;
+    }
+};
+
+/// Normal of every vertex from its right and bottom neighbors, facing the
+/// camera, or NaN where a neighbor is missing.
+struct CreateNormalMapKernel {
+    const float* vertex_;
+    float* normal_;
+    int64_t width_;
+    int64_t height_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i) const {
+        const int64_t u = i % width_;
+        const int64_t v = i / width_;
+        float* n = normal_ + 3 * i;
+        n[0] = n[1] = n[2] = NAN;
+        if (u + 1 >= width_ || v + 1 >= height_) {
+            return;
+        }
+        const float* p = vertex_ + 3 * i;
+        const float* px = p + 3;
+        const float* py = p + 3 * width_;
+        if (IsNaN(p[2]) || IsNaN(px[2]) || IsNaN(py[2])) {
+            return;
+        }
+        const float dx[3] = {px[0] - p[0], px[1] - p[1], px[2] - p[2]};
+        const float dy[3] = {py[0] - p[0], py[1] - p[1], py[2] - p[2]};
+        float c[3] = {dx[1] * dy[2] - dx[2] * dy[1],
+                      dx[2] * dy[0] - dx[0] * dy[2],
+                      dx[0] * dy[1] - dx[1] * dy[0]};
+        const float norm = sqrtf(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+        if (norm == 0.0f) {
+            return;
+        }
+        const float sign =
+                c[0] * p[0] + c[1] * p[1] + c[2] * p[2] > 0.0f ? -1.0f : 1.0f;
+        for (int a = 0; a < 3; ++a) {
+            n[a] = sign * c[a] / norm;
+        }
+    }
+};
+
+/// Source and target frames of one pyramid level, and the transformation
+/// from the source to the target camera, passed by value to the reduction
+/// kernels. Pointers that a kernel does not read may be nullptr.
+struct OdometryPair {
+    int64_t width_;
+    int64_t height_;
+    double fx_, fy_;
+    /// Source to target transformation [R | t].
+    double R_[3][3];
+    double t_[3];
+    /// K * R * K^-1 and K * t, which project source pixels into the target.
+    double KRK_inv_[3][3];
+    double Kt_[3];
+    double max_depth_diff_;
+    /// Factors of the source and target intensities that bring their means
+    /// to 0.5. They are applied here rather than to the images, since the
+    /// pyramids and gradients are linear in the intensities.
+    double source_scale_;
+    double target_scale_;
+
+    const float* source_depth_;
+    const float* source_intensity_;
+    const float* source_vertex_;
+    const float* target_depth_;
+    const float* target_intensity_;
+    const float* target_vertex_;
+    const float* target_normal_;
+    const float* target_intensity_dx_;
+    const float* target_intensity_dy_;
+    const float* target_depth_dx_;
+    const float* target_depth_dy_;
+};
+
+/// Projects source pixel i into the target, as the correspondence search of
+/// odometry::ComputeRGBDOdometry. Returns the target pixel index, or -1 if
+/// it is outside the target, or either depth is missing or too different.
+OPEN3D_HOST_DEVICE inline int64_t ProjectPixel(const OdometryPair& pair,
+                                               int64_t i) {
+    const float d_s = pair.source_depth_[i];
+    if (IsNaN(d_s)) {
+        return -1;
+    }
+    const double uv1[3] = {double(i % pair.width_), double(i / pair.width_),
+                           1.0};
+    double q[3];
+    for (int r = 0; r < 3; ++r) {
+        q[r] = d_s * pair.KRK_inv_[r][0] * uv1[0] +
+               d_s * pair.KRK_inv_[r][1] * uv1[1] +
+               d_s * pair.KRK_inv_[r][2] * uv1[2] + pair.Kt_[r];
+    }
+    // Rounded by truncation, as the legacy search, which also accepts the
+    // coordinates in (-0.5, 0).
+    const double x = q[0] / q[2] + 0.5;
+    const double y = q[1] / q[2] + 0.5;
+    if (!(x > -1.0 && x < double(pair.width_) && y > -1.0 &&
+          y < double(pair.height_))) {
+        return -1;
+    }
+    const int64_t t = int64_t(y) * pair.width_ + int64_t(x);
+    const float d_t = pair.target_depth_[t];
+    if (IsNaN(d_t) || fabs(q[2] - d_t) > pair.max_depth_diff_) {
+        return -1;
+    }
+    return t;
+}
+
+/// Source vertex i in the target camera.
+OPEN3D_HOST_DEVICE inline void TransformSourceVertex(const OdometryPair& pair,
+                                                     int64_t i,
+                                                     double* p) {
+    const float* x = pair.source_vertex_ + 3 * i;
+    for (int r = 0; r < 3; ++r) {
+        p[r] = pair.R_[r][0] * x[0] + pair.R_[r][1] * x[1] +
+               pair.R_[r][2] * x[2] + pair.t_[r];
+    }
+}
+
+/// Adds the residual r with Jacobian J to \p sums.
+OPEN3D_HOST_DEVICE inline void AccumulateOdometryRow(const double* J,
+                                                     double r,
+                                                     double* sums) {
+    int64_t k = 0;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a; b < 6; ++b) {
+            sums[k++] += J[a] * J[b];
+        }
+    }
+    for (int a = 0; a < 6; ++a) {
+        sums[21 + a] += J[a] * r;
+    }
+    sums[27] += r * r;
+}
+
+/// Jacobian of a target image with gradient (dx, dy) at the projection of
+/// the transformed source vertex \p p, as in
+/// odometry::RGBDOdometryJacobianFromColorTerm.
+OPEN3D_HOST_DEVICE inline void ComputeImageJacobian(const OdometryPair& pair,
+                                                    const double* p,
+                                                    double dx,
+                                                    double dy,
+                                                    double* J) {
+    const double invz = 1. / p[2];
+    const double c0 = dx * pair.fx_ * invz;
+    const double c1 = dy * pair.fy_ * invz;
+    const double c2 = -(c0 * p[0] + c1 * p[1]) * invz;
+    J[0] = -p[2] * c1 + p[1] * c2;
+    J[1] = p[2] * c0 - p[0] * c2;
+    J[2] = -p[1] * c0 + p[0] * c1;
+    J[3] = c0;
+    J[4] = c1;
+    J[5] = c2;
+}
+
+/// Photometric odometry, as odometry::RGBDOdometryJacobianFromColorTerm.
+struct IntensityOdometryKernel {
+    OdometryPair pair_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i, double* sums) const {
+        const int64_t t = ProjectPixel(pair_, i);
+        if (t < 0) {
+            return;
+        }
+        double p[3], J[6];
+        TransformSourceVertex(pair_, i, p);
+        const double scale = ODOMETRY_SOBEL_SCALE * pair_.target_scale_;
+        ComputeImageJacobian(pair_, p, scale * pair_.target_intensity_dx_[t],
+                             scale * pair_.target_intensity_dy_[t], J);
+        const double r =
+                pair_.target_scale_ * pair_.target_intensity_[t] -
+                pair_.source_scale_ * pair_.source_intensity_[i];
+        AccumulateOdometryRow(J, r, sums);
+        sums[28] += 1;
+    }
+};
+
+/// Photometric and depth odometry, as
+/// odometry::RGBDOdometryJacobianFromHybridTerm.
+struct HybridOdometryKernel {
+    OdometryPair pair_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i, double* sums) const {
+        const int64_t t = ProjectPixel(pair_, i);
+        if (t < 0) {
+            return;
+        }
+        const double sqrt_lambda_dep = sqrt(ODOMETRY_LAMBDA_HYBRID_DEPTH);
+        const double sqrt_lambda_img = sqrt(1.0 - ODOMETRY_LAMBDA_HYBRID_DEPTH);
+        double p[3], J_photo[6], J_geo[6];
+        TransformSourceVertex(pair_, i, p);
+
+        const double scale = ODOMETRY_SOBEL_SCALE * pair_.target_scale_;
+        ComputeImageJacobian(pair_, p, scale * pair_.target_intensity_dx_[t],
+                             scale * pair_.target_intensity_dy_[t], J_photo);
+        for (int a = 0; a < 6; ++a) {
+            J_photo[a] *= sqrt_lambda_img;
+        }
+        const double r_photo =
+                pair_.target_scale_ * pair_.target_intensity_[t] -
+                pair_.source_scale_ * pair_.source_intensity_[i];
+        AccumulateOdometryRow(J_photo, sqrt_lambda_img * r_photo, sums);
+
+        const float dDdx = pair_.target_depth_dx_[t];
+        const float dDdy = pair_.target_depth_dy_[t];
+        ComputeImageJacobian(
+                pair_, p, IsNaN(dDdx) ? 0.0 : ODOMETRY_SOBEL_SCALE * dDdx,
+                IsNaN(dDdy) ? 0.0 : ODOMETRY_SOBEL_SCALE * dDdy, J_geo);
+        // The depth of the transformed vertex depends on the pose, too.
+        J_geo[0] -= p[1];
+        J_geo[1] += p[0];
+        J_geo[5] -= 1.0;
+        for (int a = 0; a < 6; ++a) {
+            J_geo[a] *= sqrt_lambda_dep;
+        }
+        const double r_geo = pair_.target_depth_[t] - p[2];
+        AccumulateOdometryRow(J_geo, sqrt_lambda_dep * r_geo, sums);
+        sums[28] += 1;
+    }
+};
+
+/// Point-to-plane distance of the transformed source vertex to the target
+/// vertex of its projection, as in registration::RegistrationICP with
+/// projective instead of nearest neighbor correspondences.
+struct PointToPlaneOdometryKernel {
+    OdometryPair pair_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i, double* sums) const {
+        const int64_t t = ProjectPixel(pair_, i);
+        if (t < 0) {
+            return;
+        }
+        const float* q = pair_.target_vertex_ + 3 * t;
+        const float* n = pair_.target_normal_ + 3 * t;
+        if (IsNaN(n[0])) {
+            return;
+        }
+        double p[3];
+        TransformSourceVertex(pair_, i, p);
+        const double r = (p[0] - q[0]) * n[0] + (p[1] - q[1]) * n[1] +
+                         (p[2] - q[2]) * n[2];
+        const double J[6] = {p[1] * n[2] - p[2] * n[1],
+                             p[2] * n[0] - p[0] * n[2],
+                             p[0] * n[1] - p[1] * n[0],
+                             n[0],
+                             n[1],
+                             n[2]};
+        AccumulateOdometryRow(J, r, sums);
+        sums[28] += 1;
+    }
+};
+
+/// Sums of the source (sums[0]) and target (sums[1]) intensities over the
+/// correspondences, and their number (sums[28]), for the intensity
+/// normalization.
+struct IntensitySumKernel {
+    OdometryPair pair_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i, double* sums) const {
+        const int64_t t = ProjectPixel(pair_, i);
+        if (t < 0) {
+            return;
+        }
+        sums[0] += pair_.source_intensity_[i];
+        sums[1] += pair_.target_intensity_[t];
+        sums[28] += 1;
+    }
+};
+
+/// Upper triangle of G^T G over the correspondences (sums[0, 21)), where G
+/// are the rows of the point-to-point Jacobian at the target vertices, as
+/// the information matrix of odometry::ComputeRGBDOdometry.
+struct InformationKernel {
+    OdometryPair pair_;
+
+    OPEN3D_HOST_DEVICE void operator()(int64_t i, double* sums) const {
+        const int64_t t = ProjectPixel(pair_, i);
+        if (t < 0) {
+            return;
+        }
+        const double x = pair_.target_vertex_[3 * t];
+        const double y = pair_.target_vertex_[3 * t + 1];
+        const double z = pair_.target_vertex_[3 * t + 2];
+        const double G[3][6] = {{0, z, -y, 1, 0, 0},
+                                {-z, 0, x, 0, 1, 0},
+                                {y, -x, 0, 0, 0, 1}};
+        for (int d = 0; d < 3; ++d) {
+            AccumulateOdometryRow(G[d], 0.0, sums);
+        }
+        sums[28] += 1;
+    }
+};
+
+/// Run kernel(i) for every i in [0, n).
+void LaunchCPU(int64_t n, const ConvertDepthKernel& kernel);
+void LaunchCPU(int64_t n, const ConvertIntensityKernel& kernel);
+void LaunchCPU(int64_t n, const FilterKernel& kernel);
+void LaunchCPU(int64_t n, const DownsampleKernel& kernel);
+void LaunchCPU(int64_t n, const CreateVertexMapKernel& kernel);
+void LaunchCPU(int64_t n, const CreateNormalMapKernel& kernel);
+
+/// Reduce kernel(i, sums) over [0, n) into ODOMETRY_REDUCTION_SIZE \p sums.
+void ReduceCPU(int64_t n, const IntensityOdometryKernel& kernel, double* sums);
+void ReduceCPU(int64_t n, const HybridOdometryKernel& kernel, double* sums);
+void ReduceCPU(int64_t n,
+               const PointToPlaneOdometryKernel& kernel,
+               double* sums);
+void ReduceCPU(int64_t n, const IntensitySumKernel& kernel, double* sums);
+void ReduceCPU(int64_t n, const InformationKernel& kernel, double* sums);
+
+#ifdef BUILD_CUDA_MODULE
+void LaunchCUDA(int64_t n, const ConvertDepthKernel& kernel);
+void LaunchCUDA(int64_t n, const ConvertIntensityKernel& kernel);
+void LaunchCUDA(int64_t n, const FilterKernel& kernel);
+void LaunchCUDA(int64_t n, const DownsampleKernel& kernel);
+void LaunchCUDA(int64_t n, const CreateVertexMapKernel& kernel);
+void LaunchCUDA(int64_t n, const CreateNormalMapKernel& kernel);
+
+/// Write the sums of kernel(i) to rows[i * ODOMETRY_REDUCTION_SIZE] for every
+/// i in [0, n).
+void ReduceCUDA(int64_t n, const IntensityOdometryKernel& kernel, double* rows);
+void ReduceCUDA(int64_t n, const HybridOdometryKernel& kernel, double* rows);
+void ReduceCUDA(int64_t n,
+                const PointToPlaneOdometryKernel& kernel,
+                double* rows);
+void ReduceCUDA(int64_t n, const IntensitySumKernel& kernel, double* rows);
+void ReduceCUDA(int64_t n, const InformationKernel& kernel, double* rows);
+#endif
+
+}  // namespace todometry
+}  // namespace open3d
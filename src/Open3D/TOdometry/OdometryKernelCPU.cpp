@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+
+#include "Open3D/TOdometry/OdometryKernel.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace todometry {
+
+/// Pixels per task. The pixels of a kernel have similar costs.
+static constexpr int64_t PIXEL_GRAIN_SIZE = 1024;
+
+template <typename Kernel>
+static void LaunchKernelCPU(int64_t n, const Kernel& kernel) {
+    utility::ParallelFor(0, n, kernel, PIXEL_GRAIN_SIZE);
+}
+
+template <typename Kernel>
+static void ReduceKernelCPU(int64_t n, const Kernel& kernel, double* sums) {
+    typedef std::array<double, ODOMETRY_REDUCTION_SIZE> Sums;
+    Sums identity;
+    identity.fill(0);
+    const Sums total = utility::ParallelReduce(
+            0, n, identity,
+            [&](int64_t begin, int64_t end, Sums partial) {
+                for (int64_t i = begin; i < end; ++i) {
+                    kernel(i, partial.data());
+                }
+                return partial;
+            },
+            [](Sums lhs, const Sums& rhs) {
+                for (int64_t k = 0; k < ODOMETRY_REDUCTION_SIZE; ++k) {
+                    lhs[k] += rhs[k];
+                }
+                return lhs;
+            },
+            PIXEL_GRAIN_SIZE);
+    std::copy(total.begin(), total.end(), sums);
+}
+
+void LaunchCPU(int64_t n, const ConvertDepthKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const ConvertIntensityKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const FilterKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const DownsampleKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const CreateVertexMapKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void LaunchCPU(int64_t n, const CreateNormalMapKernel& kernel) {
+    LaunchKernelCPU(n, kernel);
+}
+
+void ReduceCPU(int64_t n, const IntensityOdometryKernel& kernel, double* sums) {
+    ReduceKernelCPU(n, kernel, sums);
+}
+
+void ReduceCPU(int64_t n, const HybridOdometryKernel& kernel, double* sums) {
+    ReduceKernelCPU(n, kernel, sums);
+}
+
+void ReduceCPU(int64_t n,
+               const PointToPlaneOdometryKernel& kernel,
+               double* sums) {
+    ReduceKernelCPU(n, kernel, sums);
+}
+
+void ReduceCPU(int64_t n, const IntensitySumKernel& kernel, double* sums) {
+    ReduceKernelCPU(n, kernel, sums);
+}
+
+void ReduceCPU(int64_t n, const InformationKernel& kernel, double* sums) {
+    ReduceKernelCPU(n, kernel, sums);
+}
+
+}  // namespace todometry
+}  // namespace open3d
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/Kernel/CUDALauncher.cuh"
+#include "Open3D/TOdometry/OdometryKernel.h"
+
+namespace open3d {
+namespace todometry {
+
+template <typename Kernel>
+static void LaunchKernelCUDA(int64_t n, const Kernel& kernel) {
+    const Kernel functor = kernel;
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_HOST_DEVICE(int64_t i) { functor(i); });
+}
+
+template <typename Kernel>
+static void ReduceKernelCUDA(int64_t n, const Kernel& kernel, double* rows) {
+    const Kernel functor = kernel;
+    kernel::CUDALauncher::LaunchGeneralKernel(
+            n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+                double* row = rows + i * ODOMETRY_REDUCTION_SIZE;
+                for (int64_t k = 0; k < ODOMETRY_REDUCTION_SIZE; ++k) {
+                    row[k] = 0;
+                }
+                functor(i, row);
+            });
+}
+
+void LaunchCUDA(int64_t n, const ConvertDepthKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const ConvertIntensityKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const FilterKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const DownsampleKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const CreateVertexMapKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void LaunchCUDA(int64_t n, const CreateNormalMapKernel& kernel) {
+    LaunchKernelCUDA(n, kernel);
+}
+
+void ReduceCUDA(int64_t n,
+                const IntensityOdometryKernel& kernel,
+                double* rows) {
+    ReduceKernelCUDA(n, kernel, rows);
+}
+
+void ReduceCUDA(int64_t n, const HybridOdometryKernel& kernel, double* rows) {
+    ReduceKernelCUDA(n, kernel, rows);
+}
+
+void ReduceCUDA(int64_t n,
+                const PointToPlaneOdometryKernel& kernel,
+                double* rows) {
+    ReduceKernelCUDA(n, kernel, rows);
+}
+
+void ReduceCUDA(int64_t n, const IntensitySumKernel& kernel, double* rows) {
+    ReduceKernelCUDA(n, kernel, rows);
+}
+
+void ReduceCUDA(int64_t n, const InformationKernel& kernel, double* rows) {
+    ReduceKernelCUDA(n, kernel, rows);
+}
+
+}  // namespace todometry
+}  // namespace open3d
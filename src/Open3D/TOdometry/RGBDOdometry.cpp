@@ -0,0 +1,501 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TOdometry/RGBDOdometry.h"
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "Open3D/TOdometry/OdometryKernel.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+
+namespace {
+
+using todometry::RGBDOdometryMethod;
+
+const float GAUSSIAN3[3] = {0.25f, 0.5f, 0.25f};
+const float SOBEL31[3] = {-1.0f, 0.0f, 1.0f};
+const float SOBEL32[3] = {1.0f, 2.0f, 1.0f};
+
+template <typename Kernel>
+void Launch(const Device& device, int64_t n, const Kernel& kernel) {
+    if (n == 0) {
+        return;
+    }
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        todometry::LaunchCUDA(n, kernel);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        todometry::LaunchCPU(n, kernel);
+    }
+}
+
+/// Runs a reduction kernel over \p n source pixels and returns the
+/// ODOMETRY_REDUCTION_SIZE sums on the host. On CUDA devices, the sums of
+/// the pixels are reduced on the device.
+template <typename Kernel>
+std::vector<double> Reduce(const Device& device,
+                           int64_t n,
+                           const Kernel& kernel) {
+    std::vector<double> sums(todometry::ODOMETRY_REDUCTION_SIZE, 0.0);
+    if (n == 0) {
+        return sums;
+    }
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        Tensor rows({n, todometry::ODOMETRY_REDUCTION_SIZE}, Dtype::Float64,
+                    device);
+        todometry::ReduceCUDA(n, kernel,
+                              static_cast<double*>(rows.GetDataPtr()));
+        sums = rows.Sum({0}).Copy(Device("CPU:0")).ToFlatVector<double>();
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        todometry::ReduceCPU(n, kernel, sums.data());
+    }
+    return sums;
+}
+
+const float* GetFloatPtr(const Tensor& tensor) {
+    return static_cast<const float*>(tensor.GetDataPtr());
+}
+
+float* GetFloatPtr(Tensor& tensor) {
+    return static_cast<float*>(tensor.GetDataPtr());
+}
+
+/// Pinhole camera of a pyramid level.
+struct LevelCamera {
+    double fx_, fy_, cx_, cy_;
+};
+
+/// One pyramid level of a frame on its device. The intensities are left
+/// unnormalized, and the normals and gradients are only built for targets.
+struct FrameLevel {
+    /// Float32 (height, width) depth in meters, NaN where it is invalid.
+    Tensor depth_;
+    /// Float32 (height, width) intensity, empty without intensity terms.
+    Tensor intensity_;
+    /// Float32 (height, width, 3) vertices in the camera space.
+    Tensor vertex_;
+    Tensor normal_;
+    Tensor intensity_dx_;
+    Tensor intensity_dy_;
+    Tensor depth_dx_;
+    Tensor depth_dy_;
+};
+
+/// Filters an image with the separable kernels \p dx and \p dy, as
+/// geometry::Image::Filter.
+Tensor FilterImage(const Tensor& input,
+                   const float (&dx)[3],
+                   const float (&dy)[3]) {
+    const Device device = input.GetDevice();
+    const int64_t height = input.GetShape(0);
+    const int64_t width = input.GetShape(1);
+    Tensor temp({height, width}, Dtype::Float32, device);
+    Tensor output({height, width}, Dtype::Float32, device);
+    todometry::FilterKernel kernel = {GetFloatPtr(input),
+                                      GetFloatPtr(temp),
+                                      width,
+                                      height,
+                                      {dx[0], dx[1], dx[2]},
+                                      true};
+    Launch(device, height * width, kernel);
+    kernel.input_ = GetFloatPtr(temp);
+    kernel.output_ = GetFloatPtr(output);
+    kernel.taps_[0] = dy[0];
+    kernel.taps_[1] = dy[1];
+    kernel.taps_[2] = dy[2];
+    kernel.horizontal_ = false;
+    Launch(device, height * width, kernel);
+    return output;
+}
+
+Tensor DownsampleImage(const Tensor& input) {
+    const int64_t height = input.GetShape(0) / 2;
+    const int64_t width = input.GetShape(1) / 2;
+    Tensor output({height, width}, Dtype::Float32, input.GetDevice());
+    const todometry::DownsampleKernel kernel = {
+            GetFloatPtr(input), GetFloatPtr(output), input.GetShape(1), width};
+    Launch(input.GetDevice(), height * width, kernel);
+    return output;
+}
+
+Tensor CreateVertexMap(const Tensor& depth, const LevelCamera& camera) {
+    const int64_t height = depth.GetShape(0);
+    const int64_t width = depth.GetShape(1);
+    Tensor vertex({height, width, 3}, Dtype::Float32, depth.GetDevice());
+    const todometry::CreateVertexMapKernel kernel = {
+            GetFloatPtr(depth), GetFloatPtr(vertex), width,
+            1.0 / camera.fx_,   1.0 / camera.fy_,    camera.cx_,
+            camera.cy_};
+    Launch(depth.GetDevice(), height * width, kernel);
+    return vertex;
+}
+
+Tensor CreateNormalMap(const Tensor& vertex) {
+    const int64_t height = vertex.GetShape(0);
+    const int64_t width = vertex.GetShape(1);
+    Tensor normal({height, width, 3}, Dtype::Float32, vertex.GetDevice());
+    const todometry::CreateNormalMapKernel kernel = {
+            GetFloatPtr(vertex), GetFloatPtr(normal), width, height};
+    Launch(vertex.GetDevice(), height * width, kernel);
+    return normal;
+}
+
+/// Cameras of the pyramid levels, halved from level to level as in
+/// odometry::ComputeRGBDOdometry.
+std::vector<LevelCamera> CreateCameraPyramid(const Tensor& intrinsic,
+                                             size_t num_levels) {
+    const std::vector<double> K = intrinsic.To(Dtype::Float64)
+                                          .Copy(Device("CPU:0"))
+                                          .ToFlatVector<double>();
+    std::vector<LevelCamera> cameras;
+    LevelCamera camera = {K[0], K[4], K[2], K[5]};
+    for (size_t level = 0; level < num_levels; ++level) {
+        cameras.push_back(camera);
+        camera = {0.5 * camera.fx_, 0.5 * camera.fy_, 0.5 * camera.cx_,
+                  0.5 * camera.cy_};
+    }
+    return cameras;
+}
+
+/// Preprocesses a frame and builds its pyramid, as odometry::RGBDOdometry
+/// does before the intensity normalization. The depth and intensity are
+/// smoothed, the intensities of the coarser levels are smoothed again
+/// before they are downsampled, and the depths are only downsampled.
+std::vector<FrameLevel> CreateFramePyramid(
+        const Tensor& depth,
+        const Tensor& color,
+        const std::vector<LevelCamera>& cameras,
+        const odometry::OdometryOption& option,
+        double depth_scale,
+        bool with_intensity,
+        bool is_target,
+        RGBDOdometryMethod method) {
+    const Device device = depth.GetDevice();
+    const int64_t height = depth.GetShape(0);
+    const int64_t width = depth.GetShape(1);
+    const Tensor raw_depth = depth.Contiguous();
+    Tensor depth_meters({height, width}, Dtype::Float32, device);
+    const todometry::ConvertDepthKernel depth_kernel = {
+            raw_depth.GetDataPtr(),
+            depth.GetDtype() == Dtype::UInt16,
+            float(depth_scale),
+            float(option.min_depth_),
+            float(option.max_depth_),
+            GetFloatPtr(depth_meters)};
+    Launch(device, height * width, depth_kernel);
+
+    std::vector<FrameLevel> pyramid(cameras.size());
+    pyramid[0].depth_ = FilterImage(depth_meters, GAUSSIAN3, GAUSSIAN3);
+    if (with_intensity) {
+        const Tensor raw_color = color.Contiguous();
+        Tensor intensity({height, width}, Dtype::Float32, device);
+        const todometry::ConvertIntensityKernel color_kernel = {
+                raw_color.GetDataPtr(), color.GetDtype() == Dtype::UInt8,
+                color.NumDims() == 3 ? color.GetShape(2) : 1,
+                GetFloatPtr(intensity)};
+        Launch(device, height * width, color_kernel);
+        pyramid[0].intensity_ = FilterImage(intensity, GAUSSIAN3, GAUSSIAN3);
+    }
+    for (size_t level = 0; level < pyramid.size(); ++level) {
+        FrameLevel& frame = pyramid[level];
+        if (level > 0) {
+            frame.depth_ = DownsampleImage(pyramid[level - 1].depth_);
+            if (with_intensity) {
+                frame.intensity_ = DownsampleImage(FilterImage(
+                        pyramid[level - 1].intensity_, GAUSSIAN3, GAUSSIAN3));
+            }
+        }
+        frame.vertex_ = CreateVertexMap(frame.depth_, cameras[level]);
+        if (!is_target) {
+            continue;
+        }
+        if (method == RGBDOdometryMethod::PointToPlane) {
+            frame.normal_ = CreateNormalMap(frame.vertex_);
+        } else {
+            frame.intensity_dx_ =
+                    FilterImage(frame.intensity_, SOBEL31, SOBEL32);
+            frame.intensity_dy_ =
+                    FilterImage(frame.intensity_, SOBEL32, SOBEL31);
+        }
+        if (method == RGBDOdometryMethod::Hybrid) {
+            frame.depth_dx_ = FilterImage(frame.depth_, SOBEL31, SOBEL32);
+            frame.depth_dy_ = FilterImage(frame.depth_, SOBEL32, SOBEL31);
+        }
+    }
+    return pyramid;
+}
+
+/// Returns the data pointer of an image, or nullptr if it is empty.
+const float* GetImagePtr(const Tensor& image) {
+    return image.NumElements() > 0 ? GetFloatPtr(image) : nullptr;
+}
+
+todometry::OdometryPair CreateOdometryPair(const FrameLevel& source,
+                                           const FrameLevel& target,
+                                           const LevelCamera& camera,
+                                           const Eigen::Matrix4d& extrinsic,
+                                           double max_depth_diff,
+                                           double source_scale,
+                                           double target_scale) {
+    Eigen::Matrix3d K = Eigen::Matrix3d::Identity();
+    K(0, 0) = camera.fx_;
+    K(1, 1) = camera.fy_;
+    K(0, 2) = camera.cx_;
+    K(1, 2) = camera.cy_;
+    const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    const Eigen::Matrix3d KRK_inv = K * R * K.inverse();
+    const Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
+
+    todometry::OdometryPair pair;
+    pair.width_ = source.depth_.GetShape(1);
+    pair.height_ = source.depth_.GetShape(0);
+    pair.fx_ = camera.fx_;
+    pair.fy_ = camera.fy_;
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            pair.R_[r][c] = R(r, c);
+            pair.KRK_inv_[r][c] = KRK_inv(r, c);
+        }
+        pair.t_[r] = extrinsic(r, 3);
+        pair.Kt_[r] = Kt(r);
+    }
+    pair.max_depth_diff_ = max_depth_diff;
+    pair.source_scale_ = source_scale;
+    pair.target_scale_ = target_scale;
+    pair.source_depth_ = GetImagePtr(source.depth_);
+    pair.source_intensity_ = GetImagePtr(source.intensity_);
+    pair.source_vertex_ = GetImagePtr(source.vertex_);
+    pair.target_depth_ = GetImagePtr(target.depth_);
+    pair.target_intensity_ = GetImagePtr(target.intensity_);
+    pair.target_vertex_ = GetImagePtr(target.vertex_);
+    pair.target_normal_ = GetImagePtr(target.normal_);
+    pair.target_intensity_dx_ = GetImagePtr(target.intensity_dx_);
+    pair.target_intensity_dy_ = GetImagePtr(target.intensity_dy_);
+    pair.target_depth_dx_ = GetImagePtr(target.depth_dx_);
+    pair.target_depth_dy_ = GetImagePtr(target.depth_dy_);
+    return pair;
+}
+
+/// Runs the kernel of \p method and returns the normal equations.
+std::vector<double> ReduceOdometry(const Device& device,
+                                   int64_t n,
+                                   const todometry::OdometryPair& pair,
+                                   RGBDOdometryMethod method) {
+    switch (method) {
+        case RGBDOdometryMethod::PointToPlane:
+            return Reduce(device, n,
+                          todometry::PointToPlaneOdometryKernel{pair});
+        case RGBDOdometryMethod::Intensity:
+            return Reduce(device, n, todometry::IntensityOdometryKernel{pair});
+        default:
+            return Reduce(device, n, todometry::HybridOdometryKernel{pair});
+    }
+}
+
+void CheckColor(const Tensor& color, const Tensor& depth) {
+    if ((color.NumDims() != 2 && color.NumDims() != 3) ||
+        color.GetShape(0) != depth.GetShape(0) ||
+        color.GetShape(1) != depth.GetShape(1) ||
+        (color.NumDims() == 3 && color.GetShape(2) != 1 &&
+         color.GetShape(2) != 3) ||
+        (color.GetDtype() != Dtype::UInt8 &&
+         color.GetDtype() != Dtype::Float32) ||
+        color.GetDevice() != depth.GetDevice()) {
+        utility::LogError(
+                "[ComputeRGBDOdometry] color must be a UInt8 or Float32 "
+                "(height, width, 3) or (height, width) tensor on the device "
+                "and of the size of the depth.");
+    }
+}
+
+Tensor ToTensor(const Eigen::MatrixXd& matrix) {
+    std::vector<double> values(matrix.size());
+    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                             Eigen::RowMajor>>(values.data(), matrix.rows(),
+                                               matrix.cols()) = matrix;
+    return Tensor(values, {matrix.rows(), matrix.cols()}, Dtype::Float64,
+                  Device("CPU:0"));
+}
+
+std::tuple<bool, Tensor, Tensor> OdometryFailure() {
+    return std::make_tuple(false, ToTensor(Eigen::Matrix4d::Identity()),
+                           ToTensor(Eigen::Matrix6d::Identity()));
+}
+
+}  // unnamed namespace
+
+namespace todometry {
+
+std::tuple<bool, Tensor, Tensor> ComputeRGBDOdometry(
+        const Tensor& source_depth,
+        const Tensor& source_color,
+        const Tensor& target_depth,
+        const Tensor& target_color,
+        const Tensor& intrinsic,
+        const Tensor& init /* = Tensor::Eye(4)*/,
+        RGBDOdometryMethod method /* = RGBDOdometryMethod::Hybrid*/,
+        const odometry::OdometryOption& option /* = OdometryOption()*/,
+        double depth_scale /* = 1000.0*/) {
+    const Device device = source_depth.GetDevice();
+    for (const Tensor* depth : {&source_depth, &target_depth}) {
+        if (depth->NumDims() != 2 || (depth->GetDtype() != Dtype::Float32 &&
+                                      depth->GetDtype() != Dtype::UInt16)) {
+            utility::LogError(
+                    "[ComputeRGBDOdometry] depth must be a (height, width) "
+                    "Float32 or UInt16 tensor.");
+        }
+    }
+    if (target_depth.GetShape() != source_depth.GetShape() ||
+        target_depth.GetDevice() != device) {
+        utility::LogError(
+                "[ComputeRGBDOdometry] Source and target must have the same "
+                "size and device.");
+    }
+    const bool with_intensity = method != RGBDOdometryMethod::PointToPlane;
+    if (with_intensity) {
+        CheckColor(source_color, source_depth);
+        CheckColor(target_color, target_depth);
+    }
+    if (intrinsic.GetShape() != SizeVector({3, 3}) ||
+        init.GetShape() != SizeVector({4, 4})) {
+        utility::LogError(
+                "[ComputeRGBDOdometry] intrinsic and init must have shapes "
+                "{{3, 3}} and {{4, 4}}.");
+    }
+    if (option.iteration_number_per_pyramid_level_.empty()) {
+        utility::LogError("[ComputeRGBDOdometry] No pyramid levels.");
+    }
+
+    const std::vector<int>& iter_counts =
+            option.iteration_number_per_pyramid_level_;
+    const int num_levels = int(iter_counts.size());
+    const std::vector<LevelCamera> cameras =
+            CreateCameraPyramid(intrinsic, num_levels);
+    const std::vector<FrameLevel> source = CreateFramePyramid(
+            source_depth, source_color, cameras, option, depth_scale,
+            with_intensity, false, method);
+    const std::vector<FrameLevel> target = CreateFramePyramid(
+            target_depth, target_color, cameras, option, depth_scale,
+            with_intensity, true, method);
+
+    const std::vector<double> init_values = init.To(Dtype::Float64)
+                                                    .Copy(Device("CPU:0"))
+                                                    .ToFlatVector<double>();
+    const Eigen::Matrix4d odo_init =
+            Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                    init_values.data());
+
+    // Intensity normalization over the correspondences of the initial pose.
+    double source_scale = 1.0, target_scale = 1.0;
+    const int64_t num_pixels = source_depth.NumElements();
+    if (with_intensity) {
+        const std::vector<double> sums = Reduce(
+                device, num_pixels,
+                todometry::IntensitySumKernel{CreateOdometryPair(
+                        source[0], target[0], cameras[0], odo_init,
+                        option.max_depth_diff_, 1.0, 1.0)});
+        if (sums[28] == 0) {
+            utility::LogWarning(
+                    "[ComputeRGBDOdometry] No correspondences at the initial "
+                    "pose.");
+            return OdometryFailure();
+        }
+        source_scale = 0.5 * sums[28] / sums[0];
+        target_scale = 0.5 * sums[28] / sums[1];
+    }
+
+    Eigen::Matrix4d extrinsic =
+            odo_init.isZero() ? Eigen::Matrix4d::Identity() : odo_init;
+    for (int level = num_levels - 1; level >= 0; level--) {
+        const int64_t num_level_pixels = source[level].depth_.NumElements();
+        for (int iter = 0; iter < iter_counts[num_levels - level - 1];
+             iter++) {
+            utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
+            const std::vector<double> sums = ReduceOdometry(
+                    device, num_level_pixels,
+                    CreateOdometryPair(source[level], target[level],
+                                       cameras[level], extrinsic,
+                                       option.max_depth_diff_, source_scale,
+                                       target_scale),
+                    method);
+            Eigen::Matrix6d JTJ;
+            Eigen::Vector6d JTr;
+            int k = 0;
+            for (int a = 0; a < 6; ++a) {
+                for (int b = a; b < 6; ++b) {
+                    JTJ(a, b) = JTJ(b, a) = sums[k++];
+                }
+                JTr(a) = sums[21 + a];
+            }
+            utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                              sums[27] / sums[28], int64_t(sums[28]));
+
+            bool is_success;
+            Eigen::Matrix4d update;
+            std::tie(is_success, update) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            if (!is_success) {
+                utility::LogWarning("[ComputeRGBDOdometry] no solution!");
+                return OdometryFailure();
+            }
+            extrinsic = update * extrinsic;
+        }
+    }
+
+    const std::vector<double> sums = Reduce(
+            device, num_pixels,
+            todometry::InformationKernel{
+                    CreateOdometryPair(source[0], target[0], cameras[0],
+                                       extrinsic, option.max_depth_diff_,
+                                       source_scale, target_scale)});
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity();
+    int k = 0;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a; b < 6; ++b) {
+            information(a, b) += sums[k];
+            if (b != a) {
+                information(b, a) += sums[k];
+            }
+            k++;
+        }
+    }
+    return std::make_tuple(true, ToTensor(extrinsic), ToTensor(information));
+}
+
+}  // namespace todometry
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Odometry/OdometryOption.h"
+
+namespace open3d {
+namespace todometry {
+
+/// \enum RGBDOdometryMethod
+///
+/// Residuals minimized by ComputeRGBDOdometry.
+enum class RGBDOdometryMethod {
+    /// Distances of the source vertices to the tangent planes of the target
+    /// vertices they project to.
+    PointToPlane = 0,
+    /// Intensity differences, as odometry::RGBDOdometryJacobianFromColorTerm.
+    Intensity = 1,
+    /// Intensity and depth differences, as
+    /// odometry::RGBDOdometryJacobianFromHybridTerm.
+    Hybrid = 2,
+};
+
+/// \brief Function to estimate the 6D rigid motion between two RGB-D frames
+/// stored in Tensors on a CPU or CUDA device.
+///
+/// The frames are preprocessed, their pyramids, gradients and vertex and
+/// normal maps are built, and the correspondences are found and linearized
+/// on the device of the frames, by one fused kernel per iteration. Only the
+/// 6x6 normal equations are copied to the host, where they are solved. The
+/// Intensity and Hybrid results match odometry::ComputeRGBDOdometry with the
+/// same terms.
+///
+/// \param source_depth (height, width) Float32 or UInt16 depth of the source.
+/// \param source_color (height, width, 3) UInt8 or Float32 color in [0, 1]
+/// for Float32, or (height, width) or (height, width, 1) intensity of the
+/// source. Not read by PointToPlane.
+/// \param target_depth Depth of the target, of the size of the source depth.
+/// \param target_color Color of the target, as the source color.
+/// \param intrinsic (3, 3) camera intrinsic matrix.
+/// \param init Initial source to target transformation, (4, 4) on any device.
+/// \param method Residuals to minimize.
+/// \param option Iterations per pyramid level and depth limits.
+/// \param depth_scale Depth values per meter.
+/// \return Whether the estimation succeeded, the Float64 (4, 4) source to
+/// target transformation and the Float64 (6, 6) information matrix, on the
+/// CPU.
+std::tuple<bool, Tensor, Tensor> ComputeRGBDOdometry(
+        const Tensor& source_depth,
+        const Tensor& source_color,
+        const Tensor& target_depth,
+        const Tensor& target_color,
+        const Tensor& intrinsic,
+        const Tensor& init = Tensor::Eye(4, Dtype::Float64, Device("CPU:0")),
+        RGBDOdometryMethod method = RGBDOdometryMethod::Hybrid,
+        const odometry::OdometryOption& option = odometry::OdometryOption(),
+        double depth_scale = 1000.0);
+
+}  // namespace todometry
+}  // namespace open3d
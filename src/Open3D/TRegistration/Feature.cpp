@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TRegistration/Feature.h"
+
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/TRegistration/FeatureMatchingKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tregistration {
+
+namespace {
+
+/// Returns the index of the nearest row of \p dataset for every row of
+/// \p query, the squared distance to it and the squared distance to the
+/// second nearest row.
+std::tuple<Tensor, Tensor, Tensor> NearestFeatures(const Tensor& query,
+                                                   const Tensor& dataset) {
+    const Tensor query_contiguous = query.Contiguous();
+    const Tensor dataset_contiguous = dataset.Contiguous();
+    const int64_t num_query = query.GetShape()[0];
+    const int64_t num_dataset = dataset.GetShape()[0];
+    const int64_t dim = query.GetShape()[1];
+    const Device device = query.GetDevice();
+
+    Tensor indices({num_query}, Dtype::Int64, device);
+    Tensor best({num_query}, query.GetDtype(), device);
+    Tensor second({num_query}, query.GetDtype(), device);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(query.GetDtype(), [&]() {
+        const scalar_t* query_ptr =
+                static_cast<const scalar_t*>(query_contiguous.GetDataPtr());
+        const scalar_t* dataset_ptr =
+                static_cast<const scalar_t*>(dataset_contiguous.GetDataPtr());
+        int64_t* indices_ptr = static_cast<int64_t*>(indices.GetDataPtr());
+        scalar_t* best_ptr = static_cast<scalar_t*>(best.GetDataPtr());
+        scalar_t* second_ptr = static_cast<scalar_t*>(second.GetDataPtr());
+        const scalar_t max_value = std::numeric_limits<scalar_t>::max();
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            NearestFeaturesCUDA(query_ptr, num_query, dataset_ptr,
+                                num_dataset, dim, max_value, indices_ptr,
+                                best_ptr, second_ptr);
+#else
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else {
+            NearestFeaturesCPU(query_ptr, num_query, dataset_ptr, num_dataset,
+                               dim, max_value, indices_ptr, best_ptr,
+                               second_ptr);
+        }
+    });
+    return std::make_tuple(indices, best, second);
+}
+
+}  // namespace
+
+Tensor FeatureToTensor(const registration::Feature& feature,
+                       const Device& device) {
+    const int64_t num = static_cast<int64_t>(feature.Num());
+    const int64_t dim = static_cast<int64_t>(feature.Dimension());
+    // Eigen stores the (dim, N) matrix column-major, i.e. one point after the
+    // other, which is the row-major layout of (N, dim).
+    const Dtype dtype = feature.IsFloat() ? Dtype::Float32 : Dtype::Float64;
+    Tensor tensor({num, dim}, dtype, Device("CPU:0"));
+    if (num > 0 && dim > 0) {
+        if (feature.IsFloat()) {
+            std::memcpy(tensor.GetDataPtr(), feature.data_float_.data(),
+                        num * dim * sizeof(float));
+        } else {
+            std::memcpy(tensor.GetDataPtr(), feature.data_.data(),
+                        num * dim * sizeof(double));
+        }
+    }
+    return tensor.GetDevice() == device ? tensor : tensor.Copy(device);
+}
+
+Tensor CorrespondencesFromFeatures(const Tensor& source_features,
+                                   const Tensor& target_features,
+                                   bool mutual_filter,
+                                   double max_ratio) {
+    if (source_features.NumDims() != 2 || target_features.NumDims() != 2) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Features must have shape (N, "
+                "dim), but got {} and {}.",
+                source_features.GetShape(), target_features.GetShape());
+    }
+    if (source_features.GetShape()[1] != target_features.GetShape()[1]) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dimensions {} and {} "
+                "do not match.",
+                source_features.GetShape()[1], target_features.GetShape()[1]);
+    }
+    if (source_features.GetDtype() != target_features.GetDtype()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Feature dtypes {} and {} do "
+                "not match.",
+                DtypeUtil::ToString(source_features.GetDtype()),
+                DtypeUtil::ToString(target_features.GetDtype()));
+    }
+    if (source_features.GetDevice() != target_features.GetDevice()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Features are on {} and {}.",
+                source_features.GetDevice().ToString(),
+                target_features.GetDevice().ToString());
+    }
+    if (!(max_ratio > 0.0 && max_ratio <= 1.0)) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] max_ratio must be in (0, 1].");
+    }
+    const Device device = source_features.GetDevice();
+    if (source_features.GetShape()[0] == 0 ||
+        target_features.GetShape()[0] == 0) {
+        return Tensor({0, 2}, Dtype::Int64, device);
+    }
+
+    Tensor source_to_target, best, second;
+    std::tie(source_to_target, best, second) =
+            NearestFeatures(source_features, target_features);
+    Tensor source_indices =
+            best.Le(second.Mul(max_ratio * max_ratio)).NonZero()[0];
+    Tensor target_indices = source_to_target.IndexGet({source_indices});
+    if (mutual_filter && source_indices.NumElements() > 0) {
+        Tensor target_to_source =
+                std::get<0>(NearestFeatures(target_features, source_features));
+        Tensor mutual =
+                target_to_source.IndexGet({target_indices}).Eq(source_indices);
+        source_indices = source_indices.MaskedSelect(mutual);
+        target_indices = target_indices.MaskedSelect(mutual);
+    }
+
+    Tensor corres({source_indices.NumElements(), 2}, Dtype::Int64, device);
+    corres.IndexExtract(1, 0).AsRvalue() = source_indices;
+    corres.IndexExtract(1, 1).AsRvalue() = target_indices;
+    return corres;
+}
+
+registration::CorrespondenceSet CorrespondencesFromFeatures(
+        const registration::Feature& source_feature,
+        const registration::Feature& target_feature,
+        const Device& device,
+        bool mutual_filter,
+        double max_ratio) {
+    Tensor source_features = FeatureToTensor(source_feature, device);
+    Tensor target_features = FeatureToTensor(target_feature, device);
+    if (source_features.GetDtype() != target_features.GetDtype()) {
+        source_features = source_features.To(Dtype::Float32);
+        target_features = target_features.To(Dtype::Float32);
+    }
+    const Tensor corres =
+            CorrespondencesFromFeatures(source_features, target_features,
+                                        mutual_filter, max_ratio)
+                    .To(Dtype::Int32)
+                    .Copy(Device("CPU:0"));
+    registration::CorrespondenceSet corres_set(corres.GetShape()[0]);
+    if (!corres_set.empty()) {
+        std::memcpy(corres_set.data(), corres.GetDataPtr(),
+                    corres_set.size() * 2 * sizeof(int));
+    }
+    return corres_set;
+}
+
+}  // namespace tregistration
+}  // namespace open3d
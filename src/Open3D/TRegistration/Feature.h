@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Registration/Feature.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// \brief Converts \p feature to a (N, dim) Tensor on \p device, with one
+/// row per point. The dtype is Float32 if the features are stored in single
+/// precision, Float64 otherwise.
+Tensor FeatureToTensor(const registration::Feature& feature,
+                       const Device& device = Device("CPU:0"));
+
+/// \brief Finds correspondences between two sets of features by brute force.
+///
+/// Every source feature is compared to every target feature on the device
+/// of the features: on CUDA in tiles held in shared memory, on the CPU in
+/// transposed tiles that vectorize across target features. Unlike KD-trees,
+/// the cost does not degrade with the dimension of the features, and the
+/// nearest neighbors are exact.
+///
+/// \param source_features (N, dim) source features, Float32 or Float64.
+/// \param target_features (M, dim) target features, of the dtype and on the
+/// device of \p source_features.
+/// \param mutual_filter If true, only keeps pairs whose source feature is
+/// also the nearest neighbor of the target feature among the source features.
+/// \param max_ratio Ratio test threshold in (0, 1]. A pair is only kept if the
+/// distance to the nearest target feature is at most \p max_ratio times the
+/// distance to the second nearest one. 1 disables the test.
+/// \return Int64 (K, 2) pairs of source and target indices on the device of
+/// the features, sorted by source index, with at most one per source
+/// feature.
+Tensor CorrespondencesFromFeatures(const Tensor& source_features,
+                                   const Tensor& target_features,
+                                   bool mutual_filter = false,
+                                   double max_ratio = 1.0);
+
+/// \brief Same as above for registration::Feature, matched on \p device.
+/// The result can be passed to
+/// registration::RegistrationRANSACBasedOnCorrespondence.
+registration::CorrespondenceSet CorrespondencesFromFeatures(
+        const registration::Feature& source_feature,
+        const registration::Feature& target_feature,
+        const Device& device,
+        bool mutual_filter = false,
+        double max_ratio = 1.0);
+
+}  // namespace tregistration
+}  // namespace open3d
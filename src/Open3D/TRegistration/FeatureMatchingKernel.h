@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file FeatureMatchingKernel.h
+///
+/// Brute-force nearest neighbor search of feature descriptors, shared by the
+/// CPU and CUDA backends. Descriptors such as the 33-dimensional FPFH are too
+/// high dimensional for KD-trees to prune much, so every query is compared to
+/// every dataset feature. The dataset is processed in tiles that stay in the
+/// cache (CPU) or in shared memory (CUDA) while a block of queries is
+/// compared to them.
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// Squared Euclidean distance of the \p dim dimensional features \p a and
+/// \p b.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t FeatureDistance2(const scalar_t* a,
+                                                    const scalar_t* b,
+                                                    int64_t dim) {
+    scalar_t distance2 = 0;
+    for (int64_t k = 0; k < dim; ++k) {
+        const scalar_t diff = a[k] - b[k];
+        distance2 += diff * diff;
+    }
+    return distance2;
+}
+
+/// Updates the nearest (\p index, \p best) and the second nearest distance
+/// \p second with dataset feature \p j at squared distance \p distance2.
+/// Ties keep the lower index, as dataset features are visited in order.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void UpdateNearestTwo(scalar_t distance2,
+                                                int64_t j,
+                                                scalar_t& best,
+                                                scalar_t& second,
+                                                int64_t& index) {
+    if (distance2 < best) {
+        second = best;
+        best = distance2;
+        index = j;
+    } else if (distance2 < second) {
+        second = distance2;
+    }
+}
+
+/// For each of the \p num_query rows of the contiguous (num_query, dim)
+/// \p query, finds the nearest of the \p num_dataset rows of \p dataset.
+/// Writes its index to \p indices, the squared distance to it to \p best and
+/// the squared distance to the second nearest row to \p second, which is
+/// \p max_value if the dataset has a single row.
+template <typename scalar_t>
+void NearestFeaturesCPU(const scalar_t* query,
+                        int64_t num_query,
+                        const scalar_t* dataset,
+                        int64_t num_dataset,
+                        int64_t dim,
+                        scalar_t max_value,
+                        int64_t* indices,
+                        scalar_t* best,
+                        scalar_t* second);
+
+#ifdef BUILD_CUDA_MODULE
+template <typename scalar_t>
+void NearestFeaturesCUDA(const scalar_t* query,
+                         int64_t num_query,
+                         const scalar_t* dataset,
+                         int64_t num_dataset,
+                         int64_t dim,
+                         scalar_t max_value,
+                         int64_t* indices,
+                         scalar_t* best,
+                         scalar_t* second);
+#endif
+
+}  // namespace tregistration
+}  // namespace open3d
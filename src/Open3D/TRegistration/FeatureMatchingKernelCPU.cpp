@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/TRegistration/FeatureMatchingKernel.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// Queries per task, all compared to one dataset tile before the next.
+static constexpr int64_t QUERY_BLOCK_SIZE = 64;
+/// Dataset features per tile. A tile of FPFH features takes 33 KB in single
+/// precision.
+static constexpr int64_t DATASET_TILE_SIZE = 256;
+
+template <typename scalar_t>
+void NearestFeaturesCPU(const scalar_t* query,
+                        int64_t num_query,
+                        const scalar_t* dataset,
+                        int64_t num_dataset,
+                        int64_t dim,
+                        scalar_t max_value,
+                        int64_t* indices,
+                        scalar_t* best,
+                        scalar_t* second) {
+    // The tiles are transposed, such that the distances of a query to
+    // consecutive dataset features are accumulated in consecutive SIMD lanes
+    // rather than reduced across the lanes of one feature.
+    const int64_t num_tiles =
+            (num_dataset + DATASET_TILE_SIZE - 1) / DATASET_TILE_SIZE;
+    std::vector<scalar_t> tiles(num_tiles * dim * DATASET_TILE_SIZE, 0);
+    utility::ParallelFor(0, num_tiles, [&](int64_t t) {
+        const int64_t tile_begin = t * DATASET_TILE_SIZE;
+        const int64_t tile_rows =
+                std::min(DATASET_TILE_SIZE, num_dataset - tile_begin);
+        scalar_t* tile = tiles.data() + t * dim * DATASET_TILE_SIZE;
+        for (int64_t r = 0; r < tile_rows; ++r) {
+            const scalar_t* row = dataset + (tile_begin + r) * dim;
+            for (int64_t k = 0; k < dim; ++k) {
+                tile[k * DATASET_TILE_SIZE + r] = row[k];
+            }
+        }
+    });
+
+    const int64_t num_blocks =
+            (num_query + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE;
+    utility::ParallelFor(0, num_blocks, [&](int64_t b) {
+        const int64_t begin = b * QUERY_BLOCK_SIZE;
+        const int64_t end = std::min(begin + QUERY_BLOCK_SIZE, num_query);
+        std::fill(best + begin, best + end, max_value);
+        std::fill(second + begin, second + end, max_value);
+        std::fill(indices + begin, indices + end, -1);
+        scalar_t distances[DATASET_TILE_SIZE];
+        for (int64_t t = 0; t < num_tiles; ++t) {
+            const int64_t tile_begin = t * DATASET_TILE_SIZE;
+            const int64_t tile_rows =
+                    std::min(DATASET_TILE_SIZE, num_dataset - tile_begin);
+            const scalar_t* tile = tiles.data() + t * dim * DATASET_TILE_SIZE;
+            for (int64_t i = begin; i < end; ++i) {
+                const scalar_t* q = query + i * dim;
+                std::fill(distances, distances + DATASET_TILE_SIZE, 0);
+                for (int64_t k = 0; k < dim; ++k) {
+                    const scalar_t qk = q[k];
+                    const scalar_t* column = tile + k * DATASET_TILE_SIZE;
+                    for (int64_t r = 0; r < DATASET_TILE_SIZE; ++r) {
+                        const scalar_t diff = qk - column[r];
+                        distances[r] += diff * diff;
+                    }
+                }
+                scalar_t best_i = best[i];
+                scalar_t second_i = second[i];
+                int64_t index_i = indices[i];
+                for (int64_t r = 0; r < tile_rows; ++r) {
+                    UpdateNearestTwo(distances[r], tile_begin + r, best_i,
+                                     second_i, index_i);
+                }
+                best[i] = best_i;
+                second[i] = second_i;
+                indices[i] = index_i;
+            }
+        }
+    });
+}
+
+#define INSTANTIATE_FEATURE_MATCHING_CPU(scalar_t)                          \
+    template void NearestFeaturesCPU<scalar_t>(                             \
+            const scalar_t*, int64_t, const scalar_t*, int64_t, int64_t,    \
+            scalar_t, int64_t*, scalar_t*, scalar_t*);
+
+INSTANTIATE_FEATURE_MATCHING_CPU(float)
+INSTANTIATE_FEATURE_MATCHING_CPU(double)
+
+#undef INSTANTIATE_FEATURE_MATCHING_CPU
+
+}  // namespace tregistration
+}  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Core/CUDAStream.h"
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/TRegistration/FeatureMatchingKernel.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// Queries per block, one per thread.
+static constexpr int64_t QUERY_BLOCK_SIZE = 128;
+/// Maximum number of dataset features per tile in shared memory.
+static constexpr int64_t MAX_DATASET_TILE_SIZE = 128;
+/// Shared memory used by a tile, within the default limit of 48 KB.
+static constexpr int64_t MAX_TILE_BYTES = 32768;
+
+/// Each thread searches the nearest dataset features of one query. The block
+/// loads the dataset tile by tile into shared memory, such that every
+/// dataset feature is read once from global memory per block of queries.
+template <typename scalar_t>
+__global__ void NearestFeaturesKernel(const scalar_t* query,
+                                      int64_t num_query,
+                                      const scalar_t* dataset,
+                                      int64_t num_dataset,
+                                      int64_t dim,
+                                      int64_t tile_size,
+                                      scalar_t max_value,
+                                      int64_t* indices,
+                                      scalar_t* best,
+                                      scalar_t* second) {
+    extern __shared__ __align__(sizeof(double)) unsigned char tile_bytes[];
+    scalar_t* tile = reinterpret_cast<scalar_t*>(tile_bytes);
+    const int64_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    const scalar_t* q = query + i * dim;
+
+    scalar_t best_i = max_value;
+    scalar_t second_i = max_value;
+    int64_t index_i = -1;
+    for (int64_t tile_begin = 0; tile_begin < num_dataset;
+         tile_begin += tile_size) {
+        const int64_t tile_rows = num_dataset - tile_begin < tile_size
+                                          ? num_dataset - tile_begin
+                                          : tile_size;
+        __syncthreads();
+        for (int64_t k = threadIdx.x; k < tile_rows * dim; k += blockDim.x) {
+            tile[k] = dataset[tile_begin * dim + k];
+        }
+        __syncthreads();
+        if (i < num_query) {
+            for (int64_t r = 0; r < tile_rows; ++r) {
+                UpdateNearestTwo(FeatureDistance2(q, tile + r * dim, dim),
+                                 tile_begin + r, best_i, second_i, index_i);
+            }
+        }
+    }
+    if (i < num_query) {
+        indices[i] = index_i;
+        best[i] = best_i;
+        second[i] = second_i;
+    }
+}
+
+template <typename scalar_t>
+void NearestFeaturesCUDA(const scalar_t* query,
+                         int64_t num_query,
+                         const scalar_t* dataset,
+                         int64_t num_dataset,
+                         int64_t dim,
+                         scalar_t max_value,
+                         int64_t* indices,
+                         scalar_t* best,
+                         scalar_t* second) {
+    if (num_query == 0) {
+        return;
+    }
+    const int64_t tile_size =
+            std::min(MAX_DATASET_TILE_SIZE,
+                     MAX_TILE_BYTES / (dim * int64_t(sizeof(scalar_t))));
+    if (tile_size < 1) {
+        utility::LogError(
+                "NearestFeaturesCUDA: features of dimension {} are too "
+                "large.",
+                dim);
+    }
+    const int64_t grid_size =
+            (num_query + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE;
+    NearestFeaturesKernel<scalar_t>
+            <<<grid_size, QUERY_BLOCK_SIZE,
+               tile_size * dim * sizeof(scalar_t),
+               cuda::GetCurrentStream()>>>(query, num_query, dataset,
+                                           num_dataset, dim, tile_size,
+                                           max_value, indices, best, second);
+    OPEN3D_GET_LAST_CUDA_ERROR("NearestFeaturesKernel failed.");
+}
+
+#define INSTANTIATE_FEATURE_MATCHING_CUDA(scalar_t)                         \
+    template void NearestFeaturesCUDA<scalar_t>(                            \
+            const scalar_t*, int64_t, const scalar_t*, int64_t, int64_t,    \
+            scalar_t, int64_t*, scalar_t*, scalar_t*);
+
+INSTANTIATE_FEATURE_MATCHING_CUDA(float)
+INSTANTIATE_FEATURE_MATCHING_CUDA(double)
+
+#undef INSTANTIATE_FEATURE_MATCHING_CUDA
+
+}  // namespace tregistration
+}  // namespace open3d
@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file ICPKernel.h
+///
+/// Fused correspondence search and normal equations of ICP, shared by the CPU
+/// and CUDA backends. Every source point is handled independently by one
+/// thread, which transforms the point, finds its nearest target point in the
+/// grid of nns::NearestNeighborSearch and linearizes its residual.
+
+#pragma once
+
+#include <cstdint>
+
+#include "Open3D/Core/CUDAUtils.h"
+#include "Open3D/Core/NNS/NearestNeighborSearchKernel.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// Number of values reduced over the source points: the upper triangle of
+/// JTJ (21), JTr (6), the squared correspondence distance and the number of
+/// correspondences.
+constexpr int64_t ICP_REDUCTION_SIZE = 29;
+
+/// Rigid transformation [R | t], passed by value to the kernels.
+struct ICPPose {
+    double m_[3][4];
+};
+
+/// Adds the weighted residual r with Jacobian J to \p sums.
+OPEN3D_HOST_DEVICE inline void AccumulateJacobian(const double* J,
+                                                  double r,
+                                                  double* sums) {
+    int64_t k = 0;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a; b < 6; ++b) {
+            sums[k++] += J[a] * J[b];
+        }
+    }
+    for (int a = 0; a < 6; ++a) {
+        sums[21 + a] += J[a] * r;
+    }
+}
+
+/// Linearizes the residual of source point \p source under \p pose, and adds
+/// it to \p sums. The correspondence is the nearest target point within
+/// \p max_distance, its dataset index is stored in \p correspondence, or -1
+/// if there is none. With \p target_normals the point-to-plane distance is
+/// minimized, otherwise the point-to-point distance.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputeICPSumsOne(
+        const nns::GridView<scalar_t>& view,
+        const scalar_t* target_points,
+        const scalar_t* target_normals,
+        const scalar_t* source,
+        const ICPPose& pose,
+        scalar_t max_distance,
+        double* sums,
+        int64_t* correspondence) {
+    double p[3];
+    scalar_t query[3];
+    for (int d = 0; d < 3; ++d) {
+        p[d] = pose.m_[d][0] * source[0] + pose.m_[d][1] * source[1] +
+               pose.m_[d][2] * source[2] + pose.m_[d][3];
+        query[d] = static_cast<scalar_t>(p[d]);
+    }
+    int64_t index;
+    scalar_t distance2;
+    if (nns::RadiusSearchOne(view, query, max_distance, 1, &index,
+                             &distance2) == 0) {
+        *correspondence = -1;
+        return;
+    }
+    *correspondence = index;
+    const scalar_t* q = target_points + 3 * index;
+    if (target_normals) {
+        const scalar_t* n = target_normals + 3 * index;
+        const double r = (p[0] - q[0]) * n[0] + (p[1] - q[1]) * n[1] +
+                         (p[2] - q[2]) * n[2];
+        const double J[6] = {p[1] * n[2] - p[2] * n[1],
+                             p[2] * n[0] - p[0] * n[2],
+                             p[0] * n[1] - p[1] * n[0],
+                             n[0],
+                             n[1],
+                             n[2]};
+        AccumulateJacobian(J, r, sums);
+    } else {
+        // Rows of [-[p]x, I].
+        const double J[3][6] = {{0, p[2], -p[1], 1, 0, 0},
+                                {-p[2], 0, p[0], 0, 1, 0},
+                                {p[1], -p[0], 0, 0, 0, 1}};
+        for (int d = 0; d < 3; ++d) {
+            AccumulateJacobian(J[d], p[d] - q[d], sums);
+        }
+    }
+    sums[27] += distance2;
+    sums[28] += 1;
+}
+
+/// Bulk operations on contiguous (N, 3) \p source_points. \p target_normals
+/// may be nullptr for point-to-point ICP. The CPU variant reduces the sums
+/// of all points into \p sums (ICP_REDUCTION_SIZE,); the CUDA variant writes
+/// the sums of point i to rows[i * ICP_REDUCTION_SIZE], to be reduced on the
+/// device. Both write the Int64 correspondence of every point.
+template <typename scalar_t>
+void ComputeICPSumsCPU(const nns::GridView<scalar_t>& view,
+                       const scalar_t* target_points,
+                       const scalar_t* target_normals,
+                       const scalar_t* source_points,
+                       int64_t num_points,
+                       const ICPPose& pose,
+                       scalar_t max_distance,
+                       double* sums,
+                       int64_t* correspondences);
+
+#ifdef BUILD_CUDA_MODULE
+template <typename scalar_t>
+void ComputeICPRowsCUDA(const nns::GridView<scalar_t>& view,
+                        const scalar_t* target_points,
+                        const scalar_t* target_normals,
+                        const scalar_t* source_points,
+                        int64_t num_points,
+                        const ICPPose& pose,
+                        scalar_t max_distance,
+                        double* rows,
+                        int64_t* correspondences);
+#endif
+
+}  // namespace tregistration
+}  // namespace open3d
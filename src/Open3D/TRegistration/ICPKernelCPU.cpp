@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+
+#include "Open3D/TRegistration/ICPKernel.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace tregistration {
+
+/// Source points per task. Search costs vary between points, so the grain is
+/// small to balance the load.
+static constexpr int64_t POINT_GRAIN_SIZE = 256;
+
+template <typename scalar_t>
+void ComputeICPSumsCPU(const nns::GridView<scalar_t>& view,
+                       const scalar_t* target_points,
+                       const scalar_t* target_normals,
+                       const scalar_t* source_points,
+                       int64_t num_points,
+                       const ICPPose& pose,
+                       scalar_t max_distance,
+                       double* sums,
+                       int64_t* correspondences) {
+    typedef std::array<double, ICP_REDUCTION_SIZE> Sums;
+    Sums identity;
+    identity.fill(0);
+    const Sums total = utility::ParallelReduce(
+            0, num_points, identity,
+            [&](int64_t begin, int64_t end, Sums partial) {
+                for (int64_t i = begin; i < end; ++i) {
+                    ComputeICPSumsOne(view, target_points, target_normals,
+                                      source_points + 3 * i, pose,
+                                      max_distance, partial.data(),
+                                      correspondences + i);
+                }
+                return partial;
+            },
+            [](Sums lhs, const Sums& rhs) {
+                for (int64_t k = 0; k < ICP_REDUCTION_SIZE; ++k) {
+                    lhs[k] += rhs[k];
+                }
+                return lhs;
+            },
+            POINT_GRAIN_SIZE);
+    std::copy(total.begin(), total.end(), sums);
+}
+
+#define INSTANTIATE_ICP_CPU(scalar_t)                                      \
+    template void ComputeICPSumsCPU<scalar_t>(                             \
+            const nns::GridView<scalar_t>&, const scalar_t*,               \
+            const scalar_t*, const scalar_t*, int64_t, const ICPPose&,     \
+            scalar_t, double*, int64_t*);
+
+INSTANTIATE_ICP_CPU(float)
+INSTANTIATE_ICP_CPU(double)
+
+#undef INSTANTIATE_ICP_CPU
+
+}  // namespace tregistration
+}  // namespace open3d
@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TRegistration/Registration.h"
+
+#include <cmath>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Open3D/Core/Dispatch.h"
+#include "Open3D/Core/NNS/NearestNeighborSearch.h"
+#include "Open3D/TGeometry/PointCloud.h"
+#include "Open3D/TRegistration/ICPKernel.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+
+namespace {
+
+void CheckICPArguments(const tgeometry::PointCloud& source,
+                       const tgeometry::PointCloud& target,
+                       const nns::NearestNeighborSearch& target_index,
+                       double max_correspondence_distance,
+                       const Tensor& init,
+                       registration::TransformationEstimationType estimation) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if (init.GetShape() != SizeVector({4, 4})) {
+        utility::LogError("init must have shape {{4, 4}}, but got {}.",
+                          init.GetShape());
+    }
+    if (estimation !=
+                registration::TransformationEstimationType::PointToPoint &&
+        estimation !=
+                registration::TransformationEstimationType::PointToPlane) {
+        utility::LogError(
+                "Only PointToPoint and PointToPlane estimation are supported.");
+    }
+    if (estimation ==
+                registration::TransformationEstimationType::PointToPlane &&
+        !target.HasNormals()) {
+        utility::LogError(
+                "PointToPlane estimation requires pre-computed normal vectors "
+                "of the target.");
+    }
+    if (source.GetDtype() != target.GetDtype() ||
+        source.GetDevice() != target.GetDevice()) {
+        utility::LogError(
+                "Source and target must have the same dtype and device.");
+    }
+    if (target_index.GetDtype() != target.GetDtype() ||
+        target_index.GetDevice() != target.GetDevice()) {
+        utility::LogError(
+                "The target index must have the dtype and device of the "
+                "target.");
+    }
+}
+
+/// Runs the fused ICP kernel over the source points, see ICPKernel.h, and
+/// returns the ICP_REDUCTION_SIZE sums on the host.
+std::vector<double> ComputeICPSums(
+        const Tensor& source_points,
+        const Tensor& target_points,
+        const Tensor& target_normals,
+        const nns::NearestNeighborSearch& target_index,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d& transformation,
+        Tensor& correspondences) {
+    const Device device = source_points.GetDevice();
+    const int64_t num_points = source_points.GetShape(0);
+    tregistration::ICPPose pose;
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            pose.m_[r][c] = transformation(r, c);
+        }
+    }
+    std::vector<double> sums(tregistration::ICP_REDUCTION_SIZE, 0.0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const nns::GridView<scalar_t> view =
+                target_index.GetGridView<scalar_t>();
+        const scalar_t* target_points_ptr =
+                static_cast<const scalar_t*>(target_points.GetDataPtr());
+        const scalar_t* target_normals_ptr =
+                target_normals.NumElements() > 0
+                        ? static_cast<const scalar_t*>(
+                                  target_normals.GetDataPtr())
+                        : nullptr;
+        const scalar_t* source_points_ptr =
+                static_cast<const scalar_t*>(source_points.GetDataPtr());
+        int64_t* correspondences_ptr =
+                static_cast<int64_t*>(correspondences.GetDataPtr());
+        const scalar_t max_distance =
+                static_cast<scalar_t>(max_correspondence_distance);
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            Tensor rows({num_points, tregistration::ICP_REDUCTION_SIZE},
+                        Dtype::Float64, device);
+            tregistration::ComputeICPRowsCUDA(
+                    view, target_points_ptr, target_normals_ptr,
+                    source_points_ptr, num_points, pose, max_distance,
+                    static_cast<double*>(rows.GetDataPtr()),
+                    correspondences_ptr);
+            sums = rows.Sum({0}).Copy(Device("CPU:0")).ToFlatVector<double>();
+#else
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else {
+            tregistration::ComputeICPSumsCPU(
+                    view, target_points_ptr, target_normals_ptr,
+                    source_points_ptr, num_points, pose, max_distance,
+                    sums.data(), correspondences_ptr);
+        }
+    });
+    return sums;
+}
+
+/// Fitness and inlier RMSE of the sums of ComputeICPSums.
+std::pair<double, double> GetFitnessAndRMSE(const std::vector<double>& sums,
+                                            int64_t num_points) {
+    const double num_corres = sums[28];
+    if (num_corres == 0) {
+        return std::make_pair(0.0, 0.0);
+    }
+    return std::make_pair(num_corres / double(num_points),
+                          std::sqrt(sums[27] / num_corres));
+}
+
+/// Solves the normal equations of the sums of ComputeICPSums.
+Eigen::Matrix4d SolveICPSums(const std::vector<double>& sums) {
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int k = 0;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a; b < 6; ++b) {
+            JTJ(a, b) = JTJ(b, a) = sums[k++];
+        }
+    }
+    for (int a = 0; a < 6; ++a) {
+        JTr(a) = sums[21 + a];
+    }
+    bool is_success;
+    Eigen::Matrix4d update;
+    std::tie(is_success, update) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    return is_success ? update : Eigen::Matrix4d::Identity();
+}
+
+}  // unnamed namespace
+
+namespace tregistration {
+
+RegistrationResult RegistrationICP(
+        const tgeometry::PointCloud& source,
+        const tgeometry::PointCloud& target,
+        double max_correspondence_distance,
+        const Tensor& init /* = Tensor::Eye(4)*/,
+        registration::TransformationEstimationType estimation
+        /* = TransformationEstimationType::PointToPoint*/,
+        const registration::ICPConvergenceCriteria&
+                criteria /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    nns::NearestNeighborSearch target_index(target.GetPoints().AsTensor());
+    target_index.HybridIndex(max_correspondence_distance);
+    return RegistrationICP(source, target, target_index,
+                           max_correspondence_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const tgeometry::PointCloud& source,
+        const tgeometry::PointCloud& target,
+        const nns::NearestNeighborSearch& target_index,
+        double max_correspondence_distance,
+        const Tensor& init /* = Tensor::Eye(4)*/,
+        registration::TransformationEstimationType estimation
+        /* = TransformationEstimationType::PointToPoint*/,
+        const registration::ICPConvergenceCriteria&
+                criteria /* = ICPConvergenceCriteria()*/) {
+    CheckICPArguments(source, target, target_index,
+                      max_correspondence_distance, init, estimation);
+    const std::vector<double> init_values = init.To(Dtype::Float64)
+                                                    .Copy(Device("CPU:0"))
+                                                    .ToFlatVector<double>();
+    Eigen::Matrix4d transformation =
+            Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                    init_values.data());
+
+    const Tensor source_points = source.GetPoints().AsTensor().Contiguous();
+    const Tensor target_points = target.GetPoints().AsTensor().Contiguous();
+    Tensor target_normals;
+    if (estimation ==
+        registration::TransformationEstimationType::PointToPlane) {
+        target_normals = target.GetNormals().AsTensor().Contiguous();
+    }
+    const int64_t num_points = source_points.GetShape(0);
+    Tensor correspondences({num_points}, Dtype::Int64, source.GetDevice());
+
+    std::vector<double> sums = ComputeICPSums(
+            source_points, target_points, target_normals, target_index,
+            max_correspondence_distance, transformation, correspondences);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        const auto backup = GetFitnessAndRMSE(sums, num_points);
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          backup.first, backup.second);
+        if (sums[28] > 0) {
+            transformation = SolveICPSums(sums) * transformation;
+        }
+        sums = ComputeICPSums(source_points, target_points, target_normals,
+                              target_index, max_correspondence_distance,
+                              transformation, correspondences);
+        const auto current = GetFitnessAndRMSE(sums, num_points);
+        if (std::abs(backup.first - current.first) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.second - current.second) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+
+    std::vector<double> values(16);
+    Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(values.data()) =
+            transformation;
+    RegistrationResult result(
+            Tensor(values, {4, 4}, Dtype::Float64, Device("CPU:0")));
+    std::tie(result.fitness_, result.inlier_rmse_) =
+            GetFitnessAndRMSE(sums, num_points);
+    result.correspondences_ = correspondences;
+    return result;
+}
+
+}  // namespace tregistration
+}  // namespace open3d
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Registration/Registration.h"
+
+namespace open3d {
+
+namespace nns {
+class NearestNeighborSearch;
+}
+
+namespace tgeometry {
+class PointCloud;
+}
+
+namespace tregistration {
+
+/// \class RegistrationResult
+///
+/// Result of ICP on tgeometry::PointCloud.
+class RegistrationResult {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param transformation The estimated transformation matrix.
+    RegistrationResult(const Tensor& transformation =
+                               Tensor::Eye(4, Dtype::Float64, Device("CPU:0")))
+        : transformation_(transformation), inlier_rmse_(0.0), fitness_(0.0) {}
+    ~RegistrationResult() {}
+
+public:
+    /// The estimated transformation matrix, Float64 (4, 4) on the CPU.
+    Tensor transformation_;
+    /// Int64 (N,) index of the target point corresponding to each source
+    /// point, or -1. On the device of the point clouds.
+    Tensor correspondences_;
+    /// RMSE of all inlier correspondences. Lower is better.
+    double inlier_rmse_;
+    /// The overlapping area (# of inlier correspondences / # of points in
+    /// source). Higher is better.
+    double fitness_;
+};
+
+/// \brief Functions for ICP registration of tgeometry::PointCloud.
+///
+/// Correspondence search, linearization and reduction of the residuals run on
+/// the device of the point clouds, CPU or CUDA, in one fused kernel per
+/// iteration. Only the 6x6 normal equations are copied to the host, where
+/// they are solved; the source point cloud is never modified or copied.
+/// The results match registration::RegistrationICP, except that point-to-point
+/// ICP takes Gauss-Newton steps instead of the closed-form alignment.
+///
+/// \param source The source point cloud, Float32 or Float64.
+/// \param target The target point cloud, of the dtype and on the device of
+/// the source. Point-to-plane ICP requires normals.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation, (4, 4) on any device.
+/// \param estimation PointToPoint or PointToPlane.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const tgeometry::PointCloud& source,
+        const tgeometry::PointCloud& target,
+        double max_correspondence_distance,
+        const Tensor& init = Tensor::Eye(4, Dtype::Float64, Device("CPU:0")),
+        registration::TransformationEstimationType estimation =
+                registration::TransformationEstimationType::PointToPoint,
+        const registration::ICPConvergenceCriteria& criteria =
+                registration::ICPConvergenceCriteria());
+
+/// \brief Same as above, but searches correspondences in a prebuilt index of
+/// the target points, which is reused when the same target is registered
+/// repeatedly, e.g. by odometry. Build it with
+/// HybridIndex(max_correspondence_distance) for the fastest search.
+RegistrationResult RegistrationICP(
+        const tgeometry::PointCloud& source,
+        const tgeometry::PointCloud& target,
+        const nns::NearestNeighborSearch& target_index,
+        double max_correspondence_distance,
+        const Tensor& init = Tensor::Eye(4, Dtype::Float64, Device("CPU:0")),
+        registration::TransformationEstimationType estimation =
+                registration::TransformationEstimationType::PointToPoint,
+        const registration::ICPConvergenceCriteria& criteria =
+                registration::ICPConvergenceCriteria());
+
+}  // namespace tregistration
+}  // namespace open3d
@@ -30,13 +30,17 @@
 #include <cerrno>
 #include <climits>
 #include <cmath>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -50,6 +54,131 @@ namespace open3d {
 
 namespace utility {
 
+/// Queue of the asynchronous log messages and the thread that prints them.
+class Logger::AsyncSink {
+public:
+    explicit AsyncSink(const Logger &logger)
+        : logger_(logger), thread_([this]() { Run(); }) {}
+
+    ~AsyncSink() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        queued_.notify_all();
+        thread_.join();
+    }
+
+    void Push(VerbosityLevel level, std::function<std::string()> message) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Producers wait instead of growing the queue without bound when
+        // they log faster than print_fcn_ consumes.
+        printed_.wait(lock,
+                      [this]() { return queue_.size() < kMaxQueuedMessages; });
+        queue_.emplace_back(level, std::move(message));
+        lock.unlock();
+        queued_.notify_one();
+    }
+
+    void Flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        printed_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+    }
+
+private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            queued_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            auto entry = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+            lock.unlock();
+            try {
+                logger_.WriteMessage(entry.first, entry.second());
+            } catch (const std::exception &e) {
+                // A failing message must not terminate the thread.
+                fmt::print("[Open3D ERROR] Asynchronous logging: {}\n",
+                           e.what());
+            }
+            lock.lock();
+            busy_ = false;
+            printed_.notify_all();
+        }
+    }
+
+private:
+    static const size_t kMaxQueuedMessages = 65536;
+
+    const Logger &logger_;
+    std::mutex mutex_;
+    std::condition_variable queued_;
+    std::condition_variable printed_;
+    std::deque<std::pair<VerbosityLevel, std::function<std::string()>>> queue_;
+    bool stop_ = false;
+    bool busy_ = false;
+    std::thread thread_;
+};
+
+Logger::Logger() : async_(false), verbosity_level_(VerbosityLevel::Info) {}
+
+Logger::~Logger() {
+    // Prints the queued messages while print_fcn_ is still alive.
+    async_sink_.reset();
+}
+
+void Logger::SetAsync(bool async) {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (async && !async_sink_) {
+        async_sink_.reset(new AsyncSink(*this));
+    }
+    async_ = async;
+    if (!async) {
+        Flush();
+    }
+}
+
+void Logger::Flush() const {
+    if (async_sink_) {
+        async_sink_->Flush();
+    }
+}
+
+void Logger::PrintMessage(VerbosityLevel level, const std::string &msg) const {
+    if (IsAsync()) {
+        EnqueueMessage(level, [msg]() { return msg; });
+    } else {
+        WriteMessage(level, msg);
+    }
+}
+
+void Logger::WriteMessage(VerbosityLevel level, const std::string &msg) const {
+    switch (level) {
+        case VerbosityLevel::Warning:
+            print_fcn_(ColorString(fmt::format("[Open3D WARNING] {}", msg),
+                                   TextColor::Yellow, 1));
+            break;
+        case VerbosityLevel::Info:
+            print_fcn_(fmt::format("[Open3D INFO] {}", msg));
+            break;
+        case VerbosityLevel::Debug:
+            print_fcn_(fmt::format("[Open3D DEBUG] {}", msg));
+            break;
+        default:
+            print_fcn_(msg);
+            break;
+    }
+}
+
+void Logger::EnqueueMessage(VerbosityLevel level,
+                            std::function<std::string()> message) const {
+    async_sink_->Push(level, std::move(message));
+}
+
 void Logger::ChangeConsoleColor(TextColor text_color,
                                 int highlight_text) const {
 #ifdef _WIN32
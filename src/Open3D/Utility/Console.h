@@ -27,7 +27,13 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #ifndef FMT_HEADER_ONLY
@@ -65,6 +71,75 @@ enum class VerbosityLevel {
     Debug = 3,
 };
 
+namespace detail {
+
+/// Type in which an argument of an asynchronous log message is kept until the
+/// background thread formats it: C strings are copied and Eigen expressions
+/// are evaluated, so the message does not refer to the caller's objects.
+template <typename T, typename Enable = void>
+struct LogArgument {
+    typedef T type;
+};
+
+template <>
+struct LogArgument<const char *> {
+    typedef std::string type;
+};
+
+template <>
+struct LogArgument<char *> {
+    typedef std::string type;
+};
+
+template <typename T>
+struct LogArgument<T,
+                   typename std::enable_if<std::is_base_of<
+                           Eigen::DenseBase<T>, T>::value>::type> {
+    // Unaligned, as the message is heap-allocated by std::function.
+    typedef Eigen::Matrix<typename T::Scalar,
+                          T::RowsAtCompileTime,
+                          T::ColsAtCompileTime,
+                          Eigen::DontAlign | (T::RowsAtCompileTime == 1 &&
+                                                              T::ColsAtCompileTime !=
+                                                                      1
+                                                      ? Eigen::RowMajor
+                                                      : Eigen::ColMajor)>
+            type;
+};
+
+/// Log message whose formatting is deferred to the background thread.
+template <typename... Stored>
+class DeferredLogMessage {
+public:
+    template <typename... Args>
+    DeferredLogMessage(const char *format, const Args &... args)
+        : format_(format), args_(Stored(args)...) {}
+
+    std::string operator()() const {
+        return Format(std::index_sequence_for<Stored...>());
+    }
+
+private:
+    template <std::size_t... I>
+    std::string Format(std::index_sequence<I...>) const {
+        return fmt::vformat(format_.c_str(),
+                            fmt::make_format_args(std::get<I>(args_)...));
+    }
+
+private:
+    std::string format_;
+    std::tuple<Stored...> args_;
+};
+
+template <typename... Args>
+std::function<std::string()> MakeDeferredLogMessage(const char *format,
+                                                    const Args &... args) {
+    return DeferredLogMessage<typename LogArgument<
+            typename std::decay<Args>::type>::type...>(format, args...);
+}
+
+}  // namespace detail
+
 class Logger {
 public:
     enum class TextColor {
@@ -78,7 +153,8 @@ public:
         White = 7
     };
 
-    Logger() : verbosity_level_(VerbosityLevel::Info) {}
+    Logger();
+    ~Logger();
     Logger(Logger const &) = delete;
     void operator=(Logger const &) = delete;
 
@@ -94,28 +170,45 @@ public:
         throw std::runtime_error(err_msg);
     }
 
+    /// Returns whether messages of \p level are printed.
+    bool IsEnabled(VerbosityLevel level) const {
+        return verbosity_level_ >= level;
+    }
+
     void VWarning(const char *format, fmt::format_args args) const {
-        if (verbosity_level_ >= VerbosityLevel::Warning) {
-            std::string err_msg = fmt::vformat(format, args);
-            err_msg = fmt::format("[Open3D WARNING] {}", err_msg);
-            err_msg = ColorString(err_msg, TextColor::Yellow, 1);
-            print_fcn_(err_msg);
+        if (IsEnabled(VerbosityLevel::Warning)) {
+            PrintMessage(VerbosityLevel::Warning, fmt::vformat(format, args));
         }
     }
 
     void VInfo(const char *format, fmt::format_args args) const {
-        if (verbosity_level_ >= VerbosityLevel::Info) {
-            std::string err_msg = fmt::vformat(format, args);
-            err_msg = fmt::format("[Open3D INFO] {}", err_msg);
-            print_fcn_(err_msg);
+        if (IsEnabled(VerbosityLevel::Info)) {
+            PrintMessage(VerbosityLevel::Info, fmt::vformat(format, args));
         }
     }
 
     void VDebug(const char *format, fmt::format_args args) const {
-        if (verbosity_level_ >= VerbosityLevel::Debug) {
-            std::string err_msg = fmt::vformat(format, args);
-            err_msg = fmt::format("[Open3D DEBUG] {}", err_msg);
-            print_fcn_(err_msg);
+        if (IsEnabled(VerbosityLevel::Debug)) {
+            PrintMessage(VerbosityLevel::Debug, fmt::vformat(format, args));
+        }
+    }
+
+    /// \brief Formats and prints a message of \p level if the level is
+    /// enabled. In asynchronous mode, the arguments are copied and the
+    /// message is formatted and printed by the background thread.
+    template <typename... Args>
+    void Log(VerbosityLevel level,
+             const char *format,
+             const Args &... args) const {
+        if (!IsEnabled(level)) {
+            return;
+        }
+        if (IsAsync()) {
+            EnqueueMessage(level,
+                           detail::MakeDeferredLogMessage(format, args...));
+        } else {
+            WriteMessage(level,
+                         fmt::vformat(format, fmt::make_format_args(args...)));
         }
     }
 
@@ -126,19 +219,31 @@ public:
 
     template <typename... Args>
     void Warning(const char *format, const Args &... args) const {
-        VWarning(format, fmt::make_format_args(args...));
+        Log(VerbosityLevel::Warning, format, args...);
     }
 
     template <typename... Args>
     void Info(const char *format, const Args &... args) const {
-        VInfo(format, fmt::make_format_args(args...));
+        Log(VerbosityLevel::Info, format, args...);
     }
 
     template <typename... Args>
     void Debug(const char *format, const Args &... args) const {
-        VDebug(format, fmt::make_format_args(args...));
+        Log(VerbosityLevel::Debug, format, args...);
     }
 
+    /// \brief Enables or disables asynchronous logging. In asynchronous
+    /// mode, messages are formatted and passed to print_fcn_ by a background
+    /// thread in the order they were logged, and print_fcn_ must not be
+    /// changed. Disabling it waits for the queued messages.
+    void SetAsync(bool async);
+
+    /// Returns whether logging is asynchronous.
+    bool IsAsync() const { return async_; }
+
+    /// Waits until the background thread printed the queued messages.
+    void Flush() const;
+
 protected:
     /// Internal function to change text color for the console
     /// Note there is no safety check for parameters.
@@ -152,6 +257,20 @@ protected:
                             TextColor text_color,
                             int highlight_text) const;
 
+private:
+    /// Prints \p msg now, or queues it in asynchronous mode.
+    void PrintMessage(VerbosityLevel level, const std::string &msg) const;
+    /// Adds the prefix and color of \p level to \p msg and prints it.
+    void WriteMessage(VerbosityLevel level, const std::string &msg) const;
+    void EnqueueMessage(VerbosityLevel level,
+                        std::function<std::string()> message) const;
+
+    class AsyncSink;
+    std::atomic<bool> async_;
+    /// Created on the first SetAsync(true) and kept until destruction, so a
+    /// message queued while asynchronous mode is disabled is still printed.
+    std::unique_ptr<AsyncSink> async_sink_;
+
 public:
     VerbosityLevel verbosity_level_;
     std::function<void(const std::string &)> print_fcn_ =
@@ -181,19 +300,30 @@ inline void LogError[[noreturn]](const char *format, const Args &... args) {
 
 template <typename... Args>
 inline void LogWarning(const char *format, const Args &... args) {
-    Logger::i().VWarning(format, fmt::make_format_args(args...));
+    Logger::i().Log(VerbosityLevel::Warning, format, args...);
 }
 
 template <typename... Args>
 inline void LogInfo(const char *format, const Args &... args) {
-    Logger::i().VInfo(format, fmt::make_format_args(args...));
+    Logger::i().Log(VerbosityLevel::Info, format, args...);
 }
 
 template <typename... Args>
 inline void LogDebug(const char *format, const Args &... args) {
-    Logger::i().VDebug(format, fmt::make_format_args(args...));
+    Logger::i().Log(VerbosityLevel::Debug, format, args...);
 }
 
+/// \brief Enables or disables asynchronous logging, which moves formatting
+/// and printing to a background thread. Disabling it waits for the queued
+/// messages.
+inline void SetAsyncLogging(bool async) { Logger::i().SetAsync(async); }
+
+/// Returns whether logging is asynchronous.
+inline bool IsAsyncLogging() { return Logger::i().IsAsync(); }
+
+/// Waits until the queued asynchronous log messages are printed.
+inline void FlushLog() { Logger::i().Flush(); }
+
 class VerbosityContextManager {
 public:
     VerbosityContextManager(VerbosityLevel level) : level_(level) {}
@@ -293,3 +423,27 @@ bool ProgramOptionExistsAny(int argc,
 
 }  // namespace utility
 }  // namespace open3d
+
+/// \brief Like utility::LogWarning, LogInfo and LogDebug, but the arguments
+/// are not evaluated when the level is disabled. Use them in hot loops.
+#define OPEN3D_LOG_WARNING(...)                                     \
+    do {                                                            \
+        if (::open3d::utility::Logger::i().IsEnabled(               \
+                    ::open3d::utility::VerbosityLevel::Warning)) {  \
+            ::open3d::utility::LogWarning(__VA_ARGS__);             \
+        }                                                           \
+    } while (false)
+#define OPEN3D_LOG_INFO(...)                                        \
+    do {                                                            \
+        if (::open3d::utility::Logger::i().IsEnabled(               \
+                    ::open3d::utility::VerbosityLevel::Info)) {     \
+            ::open3d::utility::LogInfo(__VA_ARGS__);                \
+        }                                                           \
+    } while (false)
+#define OPEN3D_LOG_DEBUG(...)                                       \
+    do {                                                            \
+        if (::open3d::utility::Logger::i().IsEnabled(               \
+                    ::open3d::utility::VerbosityLevel::Debug)) {    \
+            ::open3d::utility::LogDebug(__VA_ARGS__);               \
+        }                                                           \
+    } while (false)
@@ -42,6 +42,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -505,6 +506,175 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename) {
+    Close();
+#ifdef _WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    file_handle_ = file;
+    size_ = int64_t(size.QuadPart);
+    if (size_ > 0) {
+        HANDLE mapping =
+                CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        const void *data =
+                mapping == NULL
+                        ? NULL
+                        : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL) {
+            error_code_ = EIO;
+            if (mapping != NULL) CloseHandle(mapping);
+            CloseHandle(file);
+            file_handle_ = nullptr;
+            size_ = 0;
+            return false;
+        }
+        mapping_handle_ = mapping;
+        data_ = static_cast<const char *>(data);
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    size_ = int64_t(info.st_size);
+    if (size_ > 0) {
+        void *data = mmap(nullptr, size_t(size_), PROT_READ, MAP_PRIVATE, fd,
+                          0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            close(fd);
+            size_ = 0;
+            return false;
+        }
+        data_ = static_cast<const char *>(data);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+#endif
+    is_open_ = true;
+    return true;
+}
+
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_handle_) CloseHandle(mapping_handle_);
+    if (file_handle_) CloseHandle(file_handle_);
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if (data_) munmap(const_cast<char *>(data_), size_t(size_));
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+}
+
+MemoryFile::~MemoryFile() { Close(); }
+
+bool MemoryFile::OpenForReading(const void *data, size_t size) {
+    Close();
+#ifdef _WIN32
+    file_ = tmpfile();
+    if (file_ == nullptr) {
+        return false;
+    }
+    if (fwrite(data, 1, size, file_) != size || fseek(file_, 0, SEEK_SET)) {
+        Close();
+        return false;
+    }
+#else
+    if (size == 0) {
+        // fmemopen may reject an empty buffer, so an empty file is a
+        // one-byte buffer positioned at its end.
+        static char empty = 0;
+        file_ = fmemopen(&empty, 1, "r");
+        if (file_ != nullptr && fseek(file_, 1, SEEK_SET)) {
+            Close();
+        }
+    } else {
+        file_ = fmemopen(const_cast<void *>(data), size, "r");
+    }
+#endif
+    return file_ != nullptr;
+}
+
+bool MemoryFile::OpenForWriting() {
+    Close();
+#ifdef _WIN32
+    file_ = tmpfile();
+#else
+    file_ = open_memstream(&written_data_, &written_size_);
+#endif
+    return file_ != nullptr;
+}
+
+bool MemoryFile::TakeContent(std::vector<uint8_t> &content) {
+    if (file_ == nullptr) {
+        return false;
+    }
+#ifdef _WIN32
+    bool success = fflush(file_) == 0 && fseek(file_, 0, SEEK_END) == 0;
+    const long size = success ? ftell(file_) : -1;
+    success = size >= 0 && fseek(file_, 0, SEEK_SET) == 0;
+    if (success) {
+        content.resize(size_t(size));
+        success = fread(content.data(), 1, content.size(), file_) ==
+                  content.size();
+    }
+    Close();
+    return success;
+#else
+    // The stream updates its buffer and size when it is closed.
+    const bool success = fclose(file_) == 0;
+    file_ = nullptr;
+    if (success) {
+        content.assign(written_data_, written_data_ + written_size_);
+    }
+    Close();
+    return success;
+#endif
+}
+
+void MemoryFile::Close() {
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+#ifndef _WIN32
+    free(written_data_);
+    written_data_ = nullptr;
+    written_size_ = 0;
+#endif
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
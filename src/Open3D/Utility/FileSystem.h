@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -117,6 +119,85 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// \class MappedFile
+///
+/// \brief RAII wrapper for a read-only memory mapping of a whole file.
+///
+/// The file content is paged in by the OS on access, so large binary files
+/// can be parsed without being copied into a buffer first.
+class MappedFile {
+public:
+    MappedFile() {}
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+    /// Maps \p filename, closing any previously mapped file.
+    /// \return true if successful, false otherwise.
+    bool Open(const std::string &filename);
+    /// Unmaps the file.
+    void Close();
+    /// return last encountered error for this file
+    std::string GetError() const { return GetIOErrorString(error_code_); }
+    /// Returns true if a file is mapped.
+    bool IsOpen() const { return is_open_; }
+    /// Returns the mapped content, or nullptr if the file is empty.
+    const char *GetData() const { return data_; }
+    /// Returns the size of the file in bytes.
+    int64_t GetSize() const { return size_; }
+
+private:
+    bool is_open_ = false;
+    const char *data_ = nullptr;
+    int64_t size_ = 0;
+    int error_code_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
+/// \class MemoryFile
+///
+/// \brief RAII wrapper for a C FILE* that reads from or writes to memory
+/// instead of the filesystem.
+///
+/// It lets the readers and writers that are built on FILE* work on buffers,
+/// e.g. files received over the network. The C runtime of Windows cannot
+/// open memory as a FILE*, so there the content goes through an anonymous
+/// temporary file instead.
+class MemoryFile {
+public:
+    MemoryFile() {}
+    ~MemoryFile();
+    MemoryFile(const MemoryFile &) = delete;
+    MemoryFile &operator=(const MemoryFile &) = delete;
+
+public:
+    /// Opens the \p size bytes at \p data for reading in binary mode. The
+    /// data must stay valid until the file is closed.
+    /// \return true if successful, false otherwise.
+    bool OpenForReading(const void *data, size_t size);
+    /// Opens an empty file for writing in binary mode.
+    /// \return true if successful, false otherwise.
+    bool OpenForWriting();
+    /// Closes a file opened for writing and moves what was written into
+    /// \p content.
+    /// \return true if successful, false otherwise.
+    bool TakeContent(std::vector<uint8_t> &content);
+    /// Closes the file, discarding what was written.
+    void Close();
+    FILE *GetFILE() { return file_; }
+
+private:
+    FILE *file_ = nullptr;
+#ifndef _WIN32
+    char *written_data_ = nullptr;
+    size_t written_size_ = 0;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
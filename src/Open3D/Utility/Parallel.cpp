@@ -0,0 +1,428 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Open3D/Utility/Console.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace detail {
+
+/// Threads granted by a ScopedNumThreads to the loops of its scope. The thread
+/// that opened the scope always holds one of them, pool workers reserve one
+/// while they run chunks of these loops.
+class ThreadBudget {
+public:
+    explicit ThreadBudget(int num_threads) : num_threads_(num_threads) {}
+
+    int GetNumThreads() const { return num_threads_; }
+
+    /// Reserves a thread for a worker, returns false if all are taken.
+    bool Acquire() {
+        int num_active = num_active_.load();
+        while (num_active < num_threads_) {
+            if (num_active_.compare_exchange_weak(num_active,
+                                                  num_active + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Release() { num_active_--; }
+
+private:
+    const int num_threads_;
+    std::atomic<int> num_active_{1};
+};
+
+}  // namespace detail
+
+namespace {
+
+/// Chunks per thread, so that threads finishing early can take more work.
+constexpr int64_t CHUNKS_PER_THREAD = 4;
+
+#ifdef _OPENMP
+std::atomic<ParallelBackend> g_backend(ParallelBackend::OpenMP);
+#else
+std::atomic<ParallelBackend> g_backend(ParallelBackend::ThreadPool);
+#endif
+
+/// 0 means default.
+std::atomic<int> g_num_threads(0);
+
+/// True while the thread runs a chunk of a ParallelFor.
+thread_local bool g_in_parallel_for = false;
+
+/// Budget of the innermost ScopedNumThreads of the thread, or of the loop a
+/// pool worker runs chunks of. Null if there is no limit.
+thread_local std::shared_ptr<detail::ThreadBudget> g_thread_budget;
+
+int GetDefaultNumThreads() {
+    static const int default_num_threads = []() {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return std::max(1,
+                        static_cast<int>(std::thread::hardware_concurrency()));
+#endif
+    }();
+    return default_num_threads;
+}
+
+/// The number of threads of SetNumThreads(), ignoring ScopedNumThreads.
+int GetGlobalNumThreads() {
+    const int num_threads = g_num_threads;
+    return num_threads > 0 ? num_threads : GetDefaultNumThreads();
+}
+
+/// Marks the thread as running a chunk of a loop started with \p budget, so
+/// that loops nested in the chunk share it.
+class InParallelForScope {
+public:
+    explicit InParallelForScope(
+            const std::shared_ptr<detail::ThreadBudget>& budget)
+        : was_in_parallel_for_(g_in_parallel_for),
+          previous_budget_(g_thread_budget) {
+        g_in_parallel_for = true;
+        g_thread_budget = budget;
+    }
+    ~InParallelForScope() {
+        g_in_parallel_for = was_in_parallel_for_;
+        g_thread_budget = std::move(previous_budget_);
+    }
+
+private:
+    bool was_in_parallel_for_;
+    std::shared_ptr<detail::ThreadBudget> previous_budget_;
+};
+
+/// One ParallelFor call. Chunks are claimed with an atomic counter by the
+/// calling thread and by any worker that picks up the job.
+class ParallelJob {
+public:
+    ParallelJob(int64_t begin,
+                int64_t end,
+                int64_t num_chunks,
+                const std::function<void(int64_t, int64_t)>& func)
+        : begin_(begin),
+          end_(end),
+          num_chunks_(num_chunks),
+          chunk_size_((end - begin + num_chunks - 1) / num_chunks),
+          func_(func),
+          budget_(g_thread_budget) {}
+
+    /// Runs chunks on a pool worker, unless the budget of the calling thread
+    /// is used up.
+    void RunChunksOnWorker() {
+        if (budget_ && !budget_->Acquire()) {
+            return;
+        }
+        RunChunks();
+        if (budget_) {
+            budget_->Release();
+        }
+    }
+
+    /// Runs chunks until all of them are claimed.
+    void RunChunks() {
+        InParallelForScope scope(budget_);
+        int64_t chunk_idx;
+        while ((chunk_idx = next_chunk_.fetch_add(1)) < num_chunks_) {
+            const int64_t chunk_begin = begin_ + chunk_idx * chunk_size_;
+            const int64_t chunk_end = std::min(chunk_begin + chunk_size_, end_);
+            try {
+                func_(chunk_begin, chunk_end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+            if (num_finished_chunks_.fetch_add(1) + 1 == num_chunks_) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                finished_.notify_all();
+            }
+        }
+    }
+
+    /// Waits until all chunks finished and rethrows the first exception.
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this]() {
+            return num_finished_chunks_.load() == num_chunks_;
+        });
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+private:
+    const int64_t begin_;
+    const int64_t end_;
+    const int64_t num_chunks_;
+    const int64_t chunk_size_;
+    const std::function<void(int64_t, int64_t)>& func_;
+    const std::shared_ptr<detail::ThreadBudget> budget_;
+
+    std::atomic<int64_t> next_chunk_{0};
+    std::atomic<int64_t> num_finished_chunks_{0};
+    std::mutex mutex_;
+    std::condition_variable finished_;
+    std::exception_ptr exception_;
+};
+
+class ThreadPool {
+public:
+    explicit ThreadPool(int num_workers) {
+        for (int i = 0; i < num_workers; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        job_available_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /// Runs \p job on the calling thread and the workers. The calling thread
+    /// takes part even if it is a worker itself, so nested loops cannot
+    /// deadlock.
+    void Run(const std::shared_ptr<ParallelJob>& job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(job);
+        }
+        job_available_.notify_all();
+        job->RunChunks();
+        RemoveJob(job);
+        job->Wait();
+    }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            std::shared_ptr<ParallelJob> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                job_available_.wait(
+                        lock, [this]() { return stop_ || !jobs_.empty(); });
+                if (stop_) {
+                    return;
+                }
+                job = jobs_.front();
+            }
+            job->RunChunksOnWorker();
+            RemoveJob(job);
+        }
+    }
+
+    /// Called once a job has no chunks left to claim.
+    void RemoveJob(const std::shared_ptr<ParallelJob>& job) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find(jobs_.begin(), jobs_.end(), job);
+        if (it != jobs_.end()) {
+            jobs_.erase(it);
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<ParallelJob>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable job_available_;
+    bool stop_ = false;
+};
+
+std::mutex g_thread_pool_mutex;
+std::shared_ptr<ThreadPool> g_thread_pool;
+
+/// The pool is created on first use and re-created after SetNumThreads.
+std::shared_ptr<ThreadPool> GetThreadPool() {
+    std::lock_guard<std::mutex> lock(g_thread_pool_mutex);
+    if (!g_thread_pool) {
+        g_thread_pool = std::make_shared<ThreadPool>(GetGlobalNumThreads() - 1);
+    }
+    return g_thread_pool;
+}
+
+}  // unnamed namespace
+
+void SetParallelBackend(ParallelBackend backend) {
+#ifndef _OPENMP
+    if (backend == ParallelBackend::OpenMP) {
+        LogWarning("Not compiled with OpenMP, using the thread pool instead.");
+        backend = ParallelBackend::ThreadPool;
+    }
+#endif
+    g_backend = backend;
+}
+
+ParallelBackend GetParallelBackend() { return g_backend; }
+
+void SetNumThreads(int num_threads) {
+    if (num_threads < 0) {
+        LogError("Number of threads must be non-negative, but got {}.",
+                 num_threads);
+    }
+    // The OpenMP default must be read before it is overridden.
+    GetDefaultNumThreads();
+    g_num_threads = num_threads;
+#ifdef _OPENMP
+    omp_set_num_threads(GetNumThreads());
+#endif
+    // Running loops keep their pool alive until they finish.
+    std::lock_guard<std::mutex> lock(g_thread_pool_mutex);
+    g_thread_pool.reset();
+}
+
+int GetNumThreads() {
+    return g_thread_budget ? g_thread_budget->GetNumThreads()
+                           : GetGlobalNumThreads();
+}
+
+ScopedNumThreads::ScopedNumThreads(int num_threads)
+    : previous_budget_(g_thread_budget) {
+    if (num_threads < 0) {
+        LogError("Number of threads must be non-negative, but got {}.",
+                 num_threads);
+    }
+    GetDefaultNumThreads();
+    if (num_threads > 0) {
+        g_thread_budget = std::make_shared<detail::ThreadBudget>(num_threads);
+    } else {
+        g_thread_budget.reset();
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(GetNumThreads());
+#endif
+}
+
+ScopedNumThreads::~ScopedNumThreads() {
+    g_thread_budget = previous_budget_;
+#ifdef _OPENMP
+    omp_set_num_threads(GetNumThreads());
+#endif
+}
+
+bool InParallel() {
+#ifdef _OPENMP
+    return g_in_parallel_for || omp_in_parallel();
+#else
+    return g_in_parallel_for;
+#endif
+}
+
+namespace detail {
+
+int64_t GetNumChunks(int64_t begin, int64_t end, int64_t grain_size) {
+    if (end <= begin) {
+        return 0;
+    }
+    const int64_t num_threads = GetNumThreads();
+    if (num_threads == 1 || (GetParallelBackend() == ParallelBackend::OpenMP &&
+                             InParallel())) {
+        return 1;
+    }
+    grain_size = std::max(grain_size, int64_t(1));
+    const int64_t n = end - begin;
+    const int64_t num_chunks =
+            std::min((n + grain_size - 1) / grain_size,
+                     num_threads * CHUNKS_PER_THREAD);
+    // Rounding up the chunk size may leave trailing chunks empty, drop them.
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    return (n + chunk_size - 1) / chunk_size;
+}
+
+void ParallelForChunks(int64_t begin,
+                       int64_t end,
+                       int64_t grain_size,
+                       const std::function<void(int64_t, int64_t)>& func) {
+    const int64_t num_chunks = GetNumChunks(begin, end, grain_size);
+    if (num_chunks == 0) {
+        return;
+    }
+    if (num_chunks == 1) {
+        InParallelForScope scope(g_thread_budget);
+        func(begin, end);
+        return;
+    }
+
+    if (GetParallelBackend() == ParallelBackend::ThreadPool) {
+        GetThreadPool()->Run(
+                std::make_shared<ParallelJob>(begin, end, num_chunks, func));
+        return;
+    }
+
+#ifdef _OPENMP
+    const int64_t chunk_size = (end - begin + num_chunks - 1) / num_chunks;
+    const std::shared_ptr<detail::ThreadBudget> budget = g_thread_budget;
+    std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic) num_threads(GetNumThreads())
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        InParallelForScope scope(budget);
+        const int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        const int64_t chunk_end = std::min(chunk_begin + chunk_size, end);
+        // Exceptions must not leave an OpenMP region.
+        try {
+            func(chunk_begin, chunk_end);
+        } catch (...) {
+#pragma omp critical
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+#endif
+}
+
+}  // namespace detail
+
+}  // namespace utility
+}  // namespace open3d
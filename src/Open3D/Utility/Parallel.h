@@ -0,0 +1,300 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// Runtime executing ParallelFor and ParallelReduce.
+enum class ParallelBackend {
+    /// OpenMP parallel regions. Loops nested in a parallel region run
+    /// serially. This is the default if Open3D is compiled with OpenMP.
+    OpenMP,
+    /// A process-wide pool of worker threads shared by all callers. Loops
+    /// started concurrently from several threads, or nested in other loops,
+    /// split their work among the same workers instead of oversubscribing the
+    /// CPU. Idle workers take chunks from any running loop.
+    ThreadPool,
+};
+
+void SetParallelBackend(ParallelBackend backend);
+
+ParallelBackend GetParallelBackend();
+
+/// Sets the number of threads, including the calling thread, used by
+/// ParallelFor and ParallelReduce, and by OpenMP regions started afterwards.
+/// 0 restores the default, i.e. the OpenMP default or the number of hardware
+/// threads.
+void SetNumThreads(int num_threads);
+
+/// Returns the number of threads of loops started from the calling thread,
+/// i.e. that of the innermost ScopedNumThreads or SetNumThreads().
+int GetNumThreads();
+
+namespace detail {
+class ThreadBudget;
+}  // namespace detail
+
+/// \class ScopedNumThreads
+///
+/// \brief Limits the parallel loops started from the calling thread to
+/// \p num_threads threads, including the calling thread, until it goes out of
+/// scope.
+///
+/// Unlike SetNumThreads(), the limit only applies to the calling thread, so
+/// concurrent jobs can run with different budgets. With the thread pool, all
+/// loops of the scope, including loops nested in them, share the budget. The
+/// pool is not grown, so the global number of threads stays the upper bound.
+/// OpenMP regions started from the calling thread, also outside of
+/// ParallelFor, use \p num_threads threads. 0 lifts an enclosing limit.
+///
+/// Example:
+/// ```cpp
+/// {
+///     utility::ScopedNumThreads scope(2);
+///     pcd.EstimateNormals();
+/// }
+/// ```
+class ScopedNumThreads {
+public:
+    explicit ScopedNumThreads(int num_threads);
+    ~ScopedNumThreads();
+    ScopedNumThreads(const ScopedNumThreads&) = delete;
+    ScopedNumThreads& operator=(const ScopedNumThreads&) = delete;
+
+private:
+    std::shared_ptr<detail::ThreadBudget> previous_budget_;
+};
+
+/// Returns true when called from a ParallelFor body or an OpenMP parallel
+/// region.
+bool InParallel();
+
+namespace detail {
+
+/// Number of chunks [begin, end) is split into. The chunks have at least
+/// \p grain_size indices, and there are a few chunks per thread for load
+/// balancing.
+int64_t GetNumChunks(int64_t begin, int64_t end, int64_t grain_size);
+
+/// Calls func(chunk_begin, chunk_end) for the chunks of [begin, end) in
+/// parallel.
+void ParallelForChunks(int64_t begin,
+                       int64_t end,
+                       int64_t grain_size,
+                       const std::function<void(int64_t, int64_t)>& func);
+
+}  // namespace detail
+
+/// Calls func(i) for every i in [begin, end) in parallel. Each call of the
+/// type-erased chunk function runs a tight loop over contiguous indices, so
+/// \p func is inlined and may be vectorized. Exceptions thrown by \p func are
+/// rethrown in the calling thread after all chunks finished.
+///
+/// Example:
+/// ```cpp
+/// utility::ParallelFor(0, n, [&](int64_t i) { dst[i] = src[i] * 2; });
+/// ```
+template <typename func_t>
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 const func_t& func,
+                 int64_t grain_size = 1) {
+    detail::ParallelForChunks(begin, end, grain_size,
+                              [&func](int64_t chunk_begin, int64_t chunk_end) {
+                                  for (int64_t i = chunk_begin; i < chunk_end;
+                                       ++i) {
+                                      func(i);
+                                  }
+                              });
+}
+
+/// Reduces [begin, end) in parallel. map_func(chunk_begin, chunk_end,
+/// identity) returns the partial result of a chunk, which reduce_func(lhs, rhs)
+/// then combines in index order. The result is therefore deterministic for a
+/// given number of threads, and reduce_func need not be commutative.
+template <typename T, typename map_func_t, typename reduce_func_t>
+T ParallelReduce(int64_t begin,
+                 int64_t end,
+                 const T& identity,
+                 const map_func_t& map_func,
+                 const reduce_func_t& reduce_func,
+                 int64_t grain_size = 1) {
+    const int64_t num_chunks = detail::GetNumChunks(begin, end, grain_size);
+    if (num_chunks <= 1) {
+        return map_func(begin, end, identity);
+    }
+    const int64_t chunk_size = (end - begin + num_chunks - 1) / num_chunks;
+    std::vector<T> partial_results(num_chunks, identity);
+    ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t chunk_begin = begin + chunk_idx * chunk_size;
+        const int64_t chunk_end = std::min(chunk_begin + chunk_size, end);
+        partial_results[chunk_idx] =
+                map_func(chunk_begin, chunk_end, partial_results[chunk_idx]);
+    });
+    T result = identity;
+    for (const T& partial_result : partial_results) {
+        result = reduce_func(std::move(result), partial_result);
+    }
+    return result;
+}
+
+/// Returns the indices i in [begin, end) for which pred(i) is true, in
+/// increasing order. Each chunk evaluates \p pred into a mask and counts its
+/// selected indices in a tight loop, which vectorizes for branch free
+/// predicates. The counts give the output offset of every chunk, so the
+/// indices are then written in parallel without reallocations.
+template <typename index_t = size_t, typename pred_t>
+std::vector<index_t> ParallelSelectIndices(int64_t begin,
+                                           int64_t end,
+                                           const pred_t& pred,
+                                           int64_t grain_size = 32768) {
+    if (end <= begin) {
+        return {};
+    }
+    const int64_t n = end - begin;
+    const int64_t num_chunks = detail::GetNumChunks(begin, end, grain_size);
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<uint8_t> mask(n);
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t chunk_begin = chunk_idx * chunk_size;
+        const int64_t chunk_end = std::min(chunk_begin + chunk_size, n);
+        int64_t count = 0;
+        for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+            mask[i] = static_cast<uint8_t>(pred(begin + i));
+            count += mask[i];
+        }
+        offsets[chunk_idx + 1] = count;
+    });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        offsets[chunk_idx + 1] += offsets[chunk_idx];
+    }
+
+    std::vector<index_t> indices(offsets[num_chunks]);
+    ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+        const int64_t chunk_begin = chunk_idx * chunk_size;
+        const int64_t chunk_end = std::min(chunk_begin + chunk_size, n);
+        int64_t dst_idx = offsets[chunk_idx];
+        for (int64_t i = chunk_begin; i < chunk_end; ++i) {
+            if (mask[i]) {
+                indices[dst_idx++] = static_cast<index_t>(begin + i);
+            }
+        }
+    });
+    return indices;
+}
+
+/// Stable LSD radix sort of \p keys, permuting \p indices along. Each pass
+/// histograms the digits of every chunk in parallel, computes the output
+/// offset of each (digit, chunk) pair and scatters the chunks in parallel.
+/// Passes where all keys have the same digit are skipped, so keys with a
+/// small range, e.g. voxel indices, only need a few passes. \p key_t must
+/// be an unsigned integer type.
+template <typename key_t>
+void ParallelRadixSortPairs(std::vector<key_t>& keys,
+                            std::vector<int64_t>& indices,
+                            int64_t grain_size = 32768) {
+    static_assert(std::is_unsigned<key_t>::value,
+                  "Radix sort keys must be unsigned integers.");
+    constexpr int RADIX_BITS = 8;
+    constexpr int64_t RADIX_NUM_BUCKETS = 1 << RADIX_BITS;
+    const int64_t n = static_cast<int64_t>(keys.size());
+    if (n <= 1) {
+        return;
+    }
+    const int64_t num_chunks = detail::GetNumChunks(0, n, grain_size);
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    std::vector<key_t> keys_alt(n);
+    std::vector<int64_t> indices_alt(n);
+    // offsets[chunk_idx * RADIX_NUM_BUCKETS + digit]
+    std::vector<int64_t> offsets(num_chunks * RADIX_NUM_BUCKETS);
+
+    for (int shift = 0; shift < static_cast<int>(sizeof(key_t) * 8);
+         shift += RADIX_BITS) {
+        auto get_digit = [shift](key_t key) {
+            return static_cast<int64_t>((key >> shift) &
+                                        (RADIX_NUM_BUCKETS - 1));
+        };
+
+        ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            int64_t* histogram = offsets.data() + chunk_idx * RADIX_NUM_BUCKETS;
+            std::fill(histogram, histogram + RADIX_NUM_BUCKETS, 0);
+            const int64_t begin = chunk_idx * chunk_size;
+            const int64_t end = std::min(begin + chunk_size, n);
+            for (int64_t i = begin; i < end; ++i) {
+                histogram[get_digit(keys[i])]++;
+            }
+        });
+
+        // Exclusive scan of the histograms in (digit, chunk) order.
+        int64_t offset = 0;
+        bool is_trivial_pass = false;
+        for (int64_t digit = 0; digit < RADIX_NUM_BUCKETS; ++digit) {
+            int64_t digit_count = 0;
+            for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                int64_t& slot = offsets[chunk_idx * RADIX_NUM_BUCKETS + digit];
+                const int64_t count = slot;
+                slot = offset;
+                offset += count;
+                digit_count += count;
+            }
+            if (digit_count == n) {
+                is_trivial_pass = true;
+                break;
+            }
+        }
+        if (is_trivial_pass) {
+            continue;
+        }
+
+        ParallelFor(0, num_chunks, [&](int64_t chunk_idx) {
+            int64_t* chunk_offsets =
+                    offsets.data() + chunk_idx * RADIX_NUM_BUCKETS;
+            const int64_t begin = chunk_idx * chunk_size;
+            const int64_t end = std::min(begin + chunk_size, n);
+            for (int64_t i = begin; i < end; ++i) {
+                const int64_t dst_idx = chunk_offsets[get_digit(keys[i])]++;
+                keys_alt[dst_idx] = keys[i];
+                indices_alt[dst_idx] = indices[i];
+            }
+        });
+        keys.swap(keys_alt);
+        indices.swap(indices_alt);
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,307 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace detail {
+std::atomic<bool> g_profiler_enabled(false);
+}  // namespace detail
+
+namespace {
+
+int64_t NowInNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+struct ProfilerEvent {
+    const char *name_;
+    int64_t start_ns_;
+    /// Duration of a scope, -1 for a counter.
+    int64_t duration_ns_;
+    int64_t items_;
+    int64_t bytes_;
+    /// Value of a counter.
+    double value_;
+};
+
+/// Ring buffer of the events of one thread. Only its thread writes to it.
+class ProfilerThreadBuffer {
+public:
+    ProfilerThreadBuffer(int thread_id, int64_t size)
+        : thread_id_(thread_id), events_(size) {}
+
+    void Push(const ProfilerEvent &event) {
+        const int64_t count = count_.load(std::memory_order_relaxed);
+        events_[count % int64_t(events_.size())] = event;
+        count_.store(count + 1, std::memory_order_release);
+    }
+
+    /// Returns the events kept in the buffer, oldest first.
+    std::vector<ProfilerEvent> GetEvents() const {
+        const int64_t count = count_.load(std::memory_order_acquire);
+        const int64_t size = int64_t(events_.size());
+        std::vector<ProfilerEvent> events;
+        events.reserve(std::min(count, size));
+        for (int64_t i = std::max(int64_t(0), count - size); i < count; i++) {
+            events.push_back(events_[i % size]);
+        }
+        return events;
+    }
+
+    void Reset(int64_t size) {
+        events_.assign(size, ProfilerEvent());
+        count_.store(0, std::memory_order_release);
+    }
+
+public:
+    const int thread_id_;
+
+private:
+    std::vector<ProfilerEvent> events_;
+    std::atomic<int64_t> count_{0};
+};
+
+/// Buffers of all threads that recorded events. The registry shares them
+/// with their threads, so the events of finished threads are kept.
+class ProfilerRegistry {
+public:
+    static ProfilerRegistry &i() {
+        static ProfilerRegistry instance;
+        return instance;
+    }
+
+    std::shared_ptr<ProfilerThreadBuffer> CreateThreadBuffer() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_.push_back(std::make_shared<ProfilerThreadBuffer>(
+                int(buffers_.size()), buffer_size_));
+        return buffers_.back();
+    }
+
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> GetThreadBuffers() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_;
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &buffer : buffers_) {
+            buffer->Reset(buffer_size_);
+        }
+    }
+
+    void SetBufferSize(int64_t size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer_size_ = std::max(int64_t(1), size);
+    }
+
+private:
+    ProfilerRegistry() {}
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> buffers_;
+    int64_t buffer_size_ = 65536;
+};
+
+ProfilerThreadBuffer &GetThreadBuffer() {
+    thread_local std::shared_ptr<ProfilerThreadBuffer> buffer =
+            ProfilerRegistry::i().CreateThreadBuffer();
+    return *buffer;
+}
+
+std::string EscapeJsonString(const char *str) {
+    std::string escaped;
+    for (const char *c = str; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+            escaped += *c;
+        } else if ((unsigned char)*c < 0x20) {
+            escaped += fmt::format("\\u{:04x}", int(*c));
+        } else {
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+}  // unnamed namespace
+
+void SetProfilerEnabled(bool enabled) {
+    detail::g_profiler_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsProfilerEnabled() {
+    return detail::g_profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void SetProfilerBufferSize(int64_t num_events_per_thread) {
+    ProfilerRegistry::i().SetBufferSize(num_events_per_thread);
+}
+
+void ResetProfiler() { ProfilerRegistry::i().Reset(); }
+
+void RecordProfilerCounter(const char *name, double value) {
+    if (!IsProfilerEnabled()) {
+        return;
+    }
+    GetThreadBuffer().Push({name, NowInNanoseconds(), -1, 0, 0, value});
+}
+
+int64_t ProfilerScope::Now() { return NowInNanoseconds(); }
+
+void ProfilerScope::Record() {
+    GetThreadBuffer().Push(
+            {name_, start_ns_, Now() - start_ns_, items_, bytes_, 0.0});
+}
+
+bool WriteProfilerChromeTrace(const std::string &filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        LogWarning("Write Chrome trace failed: unable to open file: {}",
+                   filename);
+        return false;
+    }
+    auto buffers = ProfilerRegistry::i().GetThreadBuffers();
+    std::vector<std::vector<ProfilerEvent>> thread_events;
+    int64_t origin_ns = std::numeric_limits<int64_t>::max();
+    for (const auto &buffer : buffers) {
+        thread_events.push_back(buffer->GetEvents());
+        for (const ProfilerEvent &event : thread_events.back()) {
+            origin_ns = std::min(origin_ns, event.start_ns_);
+        }
+    }
+    // Timestamps are in microseconds since the first event.
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (size_t t = 0; t < buffers.size(); t++) {
+        const int tid = buffers[t]->thread_id_;
+        for (const ProfilerEvent &event : thread_events[t]) {
+            file << (first ? "\n" : ",\n");
+            first = false;
+            const double ts = (event.start_ns_ - origin_ns) / 1000.0;
+            const std::string name = EscapeJsonString(event.name_);
+            if (event.duration_ns_ < 0) {
+                file << fmt::format(
+                        "{{\"name\":\"{}\",\"ph\":\"C\",\"ts\":{:.3f},"
+                        "\"pid\":0,\"tid\":{},\"args\":{{\"value\":{}}}}}",
+                        name, ts, tid, event.value_);
+            } else {
+                file << fmt::format(
+                        "{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+                        "\"dur\":{:.3f},\"pid\":0,\"tid\":{},\"args\":{{"
+                        "\"items\":{},\"bytes\":{}}}}}",
+                        name, ts, event.duration_ns_ / 1000.0, tid,
+                        event.items_, event.bytes_);
+            }
+        }
+    }
+    file << "\n]}\n";
+    return bool(file);
+}
+
+std::string GetProfilerSummary() {
+    struct ScopeSummary {
+        int64_t calls_ = 0;
+        int64_t total_ns_ = 0;
+        int64_t nested_ns_ = 0;
+        int64_t items_ = 0;
+        int64_t bytes_ = 0;
+    };
+    std::map<std::string, ScopeSummary> summaries;
+    for (const auto &buffer : ProfilerRegistry::i().GetThreadBuffers()) {
+        std::vector<ProfilerEvent> events = buffer->GetEvents();
+        events.erase(std::remove_if(events.begin(), events.end(),
+                                    [](const ProfilerEvent &event) {
+                                        return event.duration_ns_ < 0;
+                                    }),
+                     events.end());
+        // Parents start before their children, or last as long if they start
+        // at the same time.
+        std::sort(events.begin(), events.end(),
+                  [](const ProfilerEvent &a, const ProfilerEvent &b) {
+                      return a.start_ns_ < b.start_ns_ ||
+                             (a.start_ns_ == b.start_ns_ &&
+                              a.duration_ns_ > b.duration_ns_);
+                  });
+        std::vector<const ProfilerEvent *> stack;
+        for (const ProfilerEvent &event : events) {
+            while (!stack.empty() &&
+                   stack.back()->start_ns_ + stack.back()->duration_ns_ <=
+                           event.start_ns_) {
+                stack.pop_back();
+            }
+            if (!stack.empty()) {
+                summaries[stack.back()->name_].nested_ns_ +=
+                        event.duration_ns_;
+            }
+            ScopeSummary &summary = summaries[event.name_];
+            summary.calls_++;
+            summary.total_ns_ += event.duration_ns_;
+            summary.items_ += event.items_;
+            summary.bytes_ += event.bytes_;
+            stack.push_back(&event);
+        }
+    }
+
+    std::vector<std::pair<std::string, ScopeSummary>> sorted(summaries.begin(),
+                                                             summaries.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const std::pair<std::string, ScopeSummary> &a,
+                 const std::pair<std::string, ScopeSummary> &b) {
+                  return a.second.total_ns_ > b.second.total_ns_;
+              });
+    std::string table = fmt::format("{:<40} {:>10} {:>12} {:>12} {:>12} {:>14} "
+                                    "{:>14}\n",
+                                    "Scope", "Calls", "Total (ms)",
+                                    "Self (ms)", "Avg (ms)", "Items", "Bytes");
+    for (const auto &entry : sorted) {
+        const ScopeSummary &s = entry.second;
+        table += fmt::format(
+                "{:<40} {:>10} {:>12.3f} {:>12.3f} {:>12.3f} {:>14} {:>14}\n",
+                entry.first, s.calls_, s.total_ns_ / 1e6,
+                (s.total_ns_ - s.nested_ns_) / 1e6,
+                s.total_ns_ / 1e6 / s.calls_, s.items_, s.bytes_);
+    }
+    return table;
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \brief Enables or disables the profiler at runtime. It is disabled by
+/// default, and a disabled profiler scope costs one atomic load.
+void SetProfilerEnabled(bool enabled);
+
+/// Returns whether the profiler records events.
+bool IsProfilerEnabled();
+
+/// \brief Sets the number of events kept per thread. Every thread records
+/// into its own ring buffer, so the oldest events of a thread are overwritten
+/// once it is full. Applies to the buffers created or reset afterwards.
+void SetProfilerBufferSize(int64_t num_events_per_thread);
+
+/// \brief Discards the recorded events. Must not run concurrently with
+/// profiled code.
+void ResetProfiler();
+
+/// \brief Writes the recorded events in the Chrome trace event format, which
+/// chrome://tracing and Perfetto open. Must not run concurrently with
+/// profiled code.
+///
+/// \param filename Path of the JSON file.
+/// \return Returns `true` if the file was written.
+bool WriteProfilerChromeTrace(const std::string &filename);
+
+/// \brief Returns a table of the recorded scopes, aggregated by name: number
+/// of calls, total and self time, and the items and bytes they processed.
+/// Self time excludes the nested scopes of the same thread. Must not run
+/// concurrently with profiled code.
+std::string GetProfilerSummary();
+
+/// \brief Records the value of counter \p name, e.g. a memory usage, as a
+/// counter track of the trace.
+///
+/// \param name Name with static storage duration, e.g. a string literal.
+/// \param value Value of the counter.
+void RecordProfilerCounter(const char *name, double value);
+
+namespace detail {
+extern std::atomic<bool> g_profiler_enabled;
+}  // namespace detail
+
+/// \class ProfilerScope
+///
+/// \brief Records the time from its construction to its destruction as an
+/// event of the calling thread, with the number of items and bytes processed
+/// in the scope. Scopes nest per thread.
+class ProfilerScope {
+public:
+    /// \param name Name with static storage duration, e.g. a string literal.
+    explicit ProfilerScope(const char *name)
+        : name_(name),
+          start_ns_(detail::g_profiler_enabled.load(std::memory_order_relaxed)
+                            ? Now()
+                            : -1) {}
+    ~ProfilerScope() {
+        if (start_ns_ >= 0) {
+            Record();
+        }
+    }
+    ProfilerScope(const ProfilerScope &) = delete;
+    ProfilerScope &operator=(const ProfilerScope &) = delete;
+
+public:
+    /// Adds \p items to the number of items processed in the scope.
+    void AddItems(int64_t items) { items_ += items; }
+    /// Adds \p bytes to the number of bytes processed in the scope.
+    void AddBytes(int64_t bytes) { bytes_ += bytes; }
+
+private:
+    static int64_t Now();
+    void Record();
+
+private:
+    const char *name_;
+    int64_t start_ns_;
+    int64_t items_ = 0;
+    int64_t bytes_ = 0;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+#define OPEN3D_PROFILER_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_PROFILER_CONCAT(a, b) OPEN3D_PROFILER_CONCAT_IMPL(a, b)
+
+/// Profiles the enclosing scope under \p name, a string literal.
+#define OPEN3D_PROFILE_SCOPE(name)                                        \
+    ::open3d::utility::ProfilerScope OPEN3D_PROFILER_CONCAT(              \
+            open3d_profiler_scope_, __LINE__)(name)
+
+/// Profiles the enclosing function under its name.
+#define OPEN3D_PROFILE_FUNCTION() OPEN3D_PROFILE_SCOPE(__func__)
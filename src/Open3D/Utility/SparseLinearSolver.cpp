@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/SparseLinearSolver.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+bool SparseLinearSolverPSD::HasSamePattern(
+        const Eigen::SparseMatrix<double> &A) const {
+    if (A.cols() + 1 != int(outer_.size()) ||
+        A.nonZeros() != int(inner_.size())) {
+        return false;
+    }
+    return std::equal(outer_.begin(), outer_.end(), A.outerIndexPtr()) &&
+           std::equal(inner_.begin(), inner_.end(), A.innerIndexPtr());
+}
+
+bool SparseLinearSolverPSD::Compute(const Eigen::SparseMatrix<double> &A) {
+    if (!A.isCompressed()) {
+        Eigen::SparseMatrix<double> A_compressed = A;
+        A_compressed.makeCompressed();
+        return Compute(A_compressed);
+    }
+    if (!analyzed_ || !HasSamePattern(A)) {
+        ldlt_.analyzePattern(A);
+        outer_.assign(A.outerIndexPtr(), A.outerIndexPtr() + A.cols() + 1);
+        inner_.assign(A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros());
+        analyzed_ = true;
+    }
+    ldlt_.factorize(A);
+    success_ = ldlt_.info() == Eigen::Success;
+    return success_;
+}
+
+std::tuple<bool, Eigen::VectorXd> SparseLinearSolverPSD::Solve(
+        const Eigen::VectorXd &b) {
+    if (success_) {
+        Eigen::VectorXd x = ldlt_.solve(b);
+        if (ldlt_.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(x));
+        }
+    }
+    return std::make_tuple(false, Eigen::VectorXd::Zero(b.rows()));
+}
+
+std::tuple<bool, Eigen::VectorXd> SolveLinearSystemPSD(
+        const Eigen::SparseMatrix<double> &A, const Eigen::VectorXd &b) {
+    SparseLinearSolverPSD solver;
+    if (solver.Compute(A)) {
+        bool success;
+        Eigen::VectorXd x;
+        std::tie(success, x) = solver.Solve(b);
+        if (success) {
+            return std::make_tuple(true, std::move(x));
+        }
+        LogWarning("Cholesky solve failed, switched to dense solver");
+    } else {
+        LogWarning("Cholesky decompose failed, switched to dense solver");
+    }
+    Eigen::VectorXd x = Eigen::MatrixXd(A).ldlt().solve(b);
+    return std::make_tuple(true, std::move(x));
+}
+
+}  // namespace utility
+}  // namespace open3d
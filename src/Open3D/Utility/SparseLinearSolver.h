@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \class SparseLinearSolverPSD
+///
+/// \brief Solves Ax=b for sparse positive semi-definite matrices A.
+///
+/// The symbolic analysis of A is kept across calls to Compute() as long as
+/// the sparsity pattern of A does not change, so iterative optimizers only pay
+/// for the numerical factorization in every iteration.
+class SparseLinearSolverPSD {
+public:
+    /// Factorizes the symmetric matrix \p A.
+    /// \return true if the factorization succeeded.
+    bool Compute(const Eigen::SparseMatrix<double> &A);
+    /// Solves Ax=b with the last A passed to Compute().
+    /// \return false and a zero vector if the factorization or the solve
+    /// failed.
+    std::tuple<bool, Eigen::VectorXd> Solve(const Eigen::VectorXd &b);
+    /// Forgets the cached symbolic analysis.
+    void Reset() { analyzed_ = false; }
+
+private:
+    bool HasSamePattern(const Eigen::SparseMatrix<double> &A) const;
+
+private:
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt_;
+    bool analyzed_ = false;
+    bool success_ = false;
+    /// Sparsity pattern of the last analyzed matrix.
+    std::vector<int> outer_;
+    std::vector<int> inner_;
+};
+
+/// Function to solve Ax=b for a sparse A. Falls back to a dense solver if the
+/// sparse factorization fails.
+std::tuple<bool, Eigen::VectorXd> SolveLinearSystemPSD(
+        const Eigen::SparseMatrix<double> &A, const Eigen::VectorXd &b);
+
+}  // namespace utility
+}  // namespace open3d
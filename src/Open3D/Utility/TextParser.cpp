@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/TextParser.h"
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+const char *SkipBlanks(const char *ptr, const char *end) {
+    while (ptr < end && (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' ||
+                         *ptr == '\v' || *ptr == '\f')) {
+        ptr++;
+    }
+    return ptr;
+}
+
+bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Returns true and advances ptr if the text at ptr starts with word,
+// ignoring case.
+bool MatchWord(const char *&ptr, const char *end, const char *word) {
+    const size_t length = strlen(word);
+    if (size_t(end - ptr) < length) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if ((ptr[i] | 0x20) != word[i]) {
+            return false;
+        }
+    }
+    ptr += length;
+    return true;
+}
+
+}  // unnamed namespace
+
+bool ParseDouble(const char *&ptr, const char *end, double &value) {
+    // Powers of ten that are exact in double precision.
+    static const double kPowersOfTen[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *start = SkipBlanks(ptr, end);
+    const char *p = start;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    if (p < end && !IsDigit(*p) && *p != '.') {
+        if (MatchWord(p, end, "nan")) {
+            value = std::numeric_limits<double>::quiet_NaN();
+        } else if (MatchWord(p, end, "inf")) {
+            MatchWord(p, end, "inity");
+            value = std::numeric_limits<double>::infinity();
+        } else {
+            return false;
+        }
+        value = negative ? -value : value;
+        ptr = p;
+        return true;
+    }
+
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; p < end && IsDigit(*p); p++) {
+        has_digits = true;
+        if (mantissa == 0 && *p == '0') {
+            continue;
+        }
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            num_digits++;
+        } else {
+            exponent++;
+            num_digits++;
+        }
+    }
+    if (p < end && *p == '.') {
+        p++;
+        for (; p < end && IsDigit(*p); p++) {
+            has_digits = true;
+            if (mantissa == 0 && *p == '0') {
+                exponent--;
+                continue;
+            }
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                exponent--;
+            }
+            num_digits++;
+        }
+    }
+    if (!has_digits) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negative_exponent = *q == '-';
+            q++;
+        }
+        if (q < end && IsDigit(*q)) {
+            int explicit_exponent = 0;
+            for (; q < end && IsDigit(*q); q++) {
+                if (explicit_exponent < 100000) {
+                    explicit_exponent = explicit_exponent * 10 + (*q - '0');
+                }
+            }
+            exponent += negative_exponent ? -explicit_exponent
+                                          : explicit_exponent;
+            p = q;
+        }
+    }
+
+    if (mantissa == 0) {
+        value = negative ? -0.0 : 0.0;
+    } else if (num_digits <= 19 && mantissa <= (uint64_t(1) << 53) &&
+               exponent >= -22 && exponent <= 22) {
+        // Both operands are exact, so the result is correctly rounded.
+        value = exponent < 0 ? double(mantissa) / kPowersOfTen[-exponent]
+                             : double(mantissa) * kPowersOfTen[exponent];
+        value = negative ? -value : value;
+    } else {
+        // Rare inputs with many digits or large exponents.
+        std::istringstream stream(std::string(start, p));
+        stream.imbue(std::locale::classic());
+        stream >> value;
+        if (stream.fail()) {
+            value = exponent < 0 ? 0.0
+                                 : std::numeric_limits<double>::infinity();
+            value = negative ? -value : value;
+        }
+    }
+    ptr = p;
+    return true;
+}
+
+bool ParseInt(const char *&ptr, const char *end, int64_t &value) {
+    const char *p = SkipBlanks(ptr, end);
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    if (p >= end || !IsDigit(*p)) {
+        return false;
+    }
+    int64_t result = 0;
+    for (; p < end && IsDigit(*p); p++) {
+        result = result * 10 + (*p - '0');
+    }
+    value = negative ? -result : result;
+    ptr = p;
+    return true;
+}
+
+}  // namespace utility
+}  // namespace open3d
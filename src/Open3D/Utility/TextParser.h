@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace utility {
+
+/// \brief Parses a floating point number at \p ptr, after skipping spaces and
+/// tabs, and advances \p ptr past it.
+///
+/// Unlike sscanf and strtod, the parser ignores the locale: the decimal
+/// separator is always '.'. It accepts the decimal and scientific notations,
+/// "nan" and "inf". Numbers that are exactly representable with at most 19
+/// significant digits and a small exponent, i.e. almost all numbers written
+/// by point cloud exporters, are converted without a library call.
+///
+/// \return Returns false, leaving \p ptr unchanged, if there is no number.
+bool ParseDouble(const char *&ptr, const char *end, double &value);
+
+/// \brief Parses a decimal integer at \p ptr, after skipping spaces and tabs,
+/// and advances \p ptr past it.
+///
+/// \return Returns false, leaving \p ptr unchanged, if there is no integer.
+bool ParseInt(const char *&ptr, const char *end, int64_t &value);
+
+/// Number of bytes of text parsed by one task of ParseLinesInParallel.
+constexpr int64_t TEXT_CHUNK_SIZE = 4 << 20;
+
+/// \brief Calls func(line_begin, line_end) for every line of the text
+/// [begin, end). Lines exclude the line break and a trailing '\r'.
+template <typename LineFunc>
+void ForEachLine(const char *begin, const char *end, const LineFunc &func) {
+    const char *line = begin;
+    while (line < end) {
+        const char *newline = static_cast<const char *>(
+                memchr(line, '\n', size_t(end - line)));
+        const char *line_end = newline ? newline : end;
+        const char *content_end = line_end;
+        if (content_end > line && content_end[-1] == '\r') {
+            content_end--;
+        }
+        func(line, content_end);
+        line = newline ? newline + 1 : end;
+    }
+}
+
+/// \brief Splits the text [begin, end) into chunks for parallel parsing.
+///
+/// The chunks have at most about \p chunk_size bytes and end at a line
+/// break. They are grouped in about a hundred batches of a few chunks per
+/// thread, so that memory stays bounded for huge files. process_batch(bounds)
+/// is called for each batch in file order, where chunk c of the batch is
+/// [bounds[c], bounds[c + 1]). Splitting stops if process_batch returns
+/// false.
+template <typename BatchFunc>
+void ForEachTextBatch(const char *begin,
+                      const char *end,
+                      const BatchFunc &process_batch,
+                      int64_t chunk_size = TEXT_CHUNK_SIZE) {
+    const int64_t max_chunks = std::max(1, GetNumThreads()) * 4;
+    const int64_t batch_size =
+            std::min(max_chunks * chunk_size,
+                     std::max<int64_t>((end - begin) / 100, 1 << 16));
+    const int64_t piece_size = std::max<int64_t>(batch_size / max_chunks, 1);
+    const char *pos = begin;
+    while (pos < end) {
+        // Chunk boundaries are placed after the first line break following
+        // every piece_size bytes.
+        std::vector<const char *> bounds(1, pos);
+        while (bounds.back() < end && bounds.back() - pos < batch_size) {
+            const char *bound =
+                    bounds.back() +
+                    std::min<int64_t>(piece_size, end - bounds.back());
+            if (bound < end) {
+                const char *newline = static_cast<const char *>(
+                        memchr(bound, '\n', size_t(end - bound)));
+                bound = newline ? newline + 1 : end;
+            }
+            bounds.push_back(bound);
+        }
+        pos = bounds.back();
+        if (!process_batch(bounds)) {
+            break;
+        }
+    }
+}
+
+/// \brief Parses the lines of the text [begin, end) in parallel.
+///
+/// The text is split into chunks by ForEachTextBatch, which threads parse
+/// with parse_line(line_begin, line_end, entry). Lines exclude the line break
+/// and a trailing '\r'. A line produces an entry if parse_line returns true.
+/// consume(entries, parsed_end) receives the entries of each batch in file
+/// order, together with the end of the parsed text, e.g. to report progress.
+/// Parsing stops after \p max_entries entries if it is not negative.
+template <typename Entry, typename ParseLineFunc, typename ConsumeFunc>
+void ParseLinesInParallel(const char *begin,
+                          const char *end,
+                          const ParseLineFunc &parse_line,
+                          const ConsumeFunc &consume,
+                          int64_t max_entries = -1,
+                          int64_t chunk_size = TEXT_CHUNK_SIZE) {
+    int64_t num_entries = 0;
+    ForEachTextBatch(
+            begin, end,
+            [&](const std::vector<const char *> &bounds) {
+                const int64_t num_chunks = int64_t(bounds.size()) - 1;
+                std::vector<std::vector<Entry>> chunk_entries(num_chunks);
+                ParallelFor(0, num_chunks, [&](int64_t c) {
+                    Entry entry;
+                    ForEachLine(bounds[c], bounds[c + 1],
+                                [&](const char *line, const char *line_end) {
+                                    if (parse_line(line, line_end, entry)) {
+                                        chunk_entries[c].push_back(entry);
+                                    }
+                                });
+                });
+
+                std::vector<Entry> entries;
+                for (int64_t c = 0; c < num_chunks; c++) {
+                    entries.insert(entries.end(), chunk_entries[c].begin(),
+                                   chunk_entries[c].end());
+                    std::vector<Entry>().swap(chunk_entries[c]);
+                }
+                if (max_entries >= 0 &&
+                    num_entries + int64_t(entries.size()) > max_entries) {
+                    entries.resize(size_t(max_entries - num_entries));
+                }
+                num_entries += int64_t(entries.size());
+                consume(entries, bounds.back());
+                return max_entries < 0 || num_entries < max_entries;
+            },
+            chunk_size);
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,269 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Rendering/Filament/FilamentBatchRenderer.h"
+
+#include <filament/Camera.h>
+#include <filament/Engine.h>
+#include <filament/Renderer.h>
+#include <filament/SwapChain.h>
+#include <filament/View.h>
+#include <filament/Viewport.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Visualization/Rendering/Filament/FilamentCamera.h"
+#include "Open3D/Visualization/Rendering/Filament/FilamentScene.h"
+#include "Open3D/Visualization/Rendering/Filament/FilamentView.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+// Inverse of the packing in linearDepth.mat
+float UnpackDepth(const std::uint8_t* rgb, double near, double far) {
+    if (rgb[0] == 0 && rgb[1] == 0 && rgb[2] == 0) {
+        return 0.0f;
+    }
+    const double d = rgb[0] / 255.0 + rgb[1] / (255.0 * 255.0) +
+                     rgb[2] / (255.0 * 255.0 * 255.0);
+    return float(near + d * (far - near));
+}
+
+}  // namespace
+
+FilamentBatchRenderer::FilamentBatchRenderer(
+        filament::Engine& engine,
+        FilamentResourceManager& resource_mgr,
+        FilamentScene& scene)
+    : engine_(engine), resource_mgr_(resource_mgr), scene_(scene) {
+    renderer_ = engine_.createRenderer();
+    view_ = std::make_unique<FilamentView>(engine_, scene_, resource_mgr_);
+}
+
+FilamentBatchRenderer::~FilamentBatchRenderer() {
+    view_.reset();
+    if (swapchain_) {
+        engine_.destroy(swapchain_);
+    }
+    engine_.destroy(renderer_);
+}
+
+void FilamentBatchRenderer::SetDepthRange(double near, double far) {
+    if (near <= 0.0 || far <= near) {
+        utility::LogWarning("Invalid depth range [{}, {}]", near, far);
+        return;
+    }
+    near_ = near;
+    far_ = far;
+}
+
+void FilamentBatchRenderer::Render(
+        const std::vector<camera::PinholeCameraParameters>& cameras,
+        const FrameReadyCallback& callback) {
+    // Geometries that are still being uploaded would be missing from the
+    // first frames, and textures would only show their previews.
+    while (scene_.UpdatePendingGeometries() > 0 ||
+           resource_mgr_.UpdatePendingTextures() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Frames [oldest, i) are in flight.
+    std::size_t oldest = 0;
+    for (std::size_t i = 0; i < cameras.size(); ++i) {
+        const auto& intrinsic = cameras[i].intrinsic_;
+        if (std::size_t(intrinsic.width_) != width_ ||
+            std::size_t(intrinsic.height_) != height_) {
+            while (oldest < i) {
+                DeliverFrame(oldest++, callback);
+            }
+            SetDimensions(intrinsic.width_, intrinsic.height_);
+        }
+        if (i - oldest == kFramesInFlight) {
+            DeliverFrame(oldest++, callback);
+        }
+        RenderFrame(i, cameras[i]);
+    }
+    while (oldest < cameras.size()) {
+        DeliverFrame(oldest++, callback);
+    }
+}
+
+std::vector<FilamentBatchRenderer::Frame> FilamentBatchRenderer::Render(
+        const std::vector<camera::PinholeCameraParameters>& cameras) {
+    std::vector<Frame> frames(cameras.size());
+    Render(cameras, [&frames](std::size_t index, const Frame& frame) {
+        frames[index] = frame;
+    });
+    return frames;
+}
+
+void FilamentBatchRenderer::SetDimensions(std::size_t width,
+                                          std::size_t height) {
+    if (swapchain_) {
+        engine_.destroy(swapchain_);
+    }
+    swapchain_ = engine_.createSwapChain(width, height,
+                                         filament::SwapChain::CONFIG_READABLE);
+    view_->SetViewport(0, 0, width, height);
+
+    width_ = width;
+    height_ = height;
+}
+
+void FilamentBatchRenderer::SetCamera(
+        const camera::PinholeCameraParameters& parameters) {
+    const auto& intrinsic = parameters.intrinsic_;
+    const auto focal = intrinsic.GetFocalLength();
+    const auto principal = intrinsic.GetPrincipalPoint();
+
+    // Frustum of the pinhole camera at the near plane. Image rows grow
+    // downwards, so the principal point is measured from the top edge.
+    const double left = -principal.first * near_ / focal.first;
+    const double right =
+            (intrinsic.width_ - principal.first) * near_ / focal.first;
+    const double top = principal.second * near_ / focal.second;
+    const double bottom =
+            -(intrinsic.height_ - principal.second) * near_ / focal.second;
+
+    auto* camera = view_->GetCamera();
+    camera->SetProjection(Camera::Projection::Perspective, left, right,
+                          bottom, top, near_, far_);
+
+    // The extrinsic maps world to camera coordinates with y down and z
+    // forward. Filament cameras look along -z with y up.
+    Eigen::Matrix4d camera_to_world = parameters.extrinsic_.inverse();
+    camera_to_world.col(1) *= -1.0;
+    camera_to_world.col(2) *= -1.0;
+    camera->SetModelMatrix(Camera::Transform(camera_to_world.cast<float>()));
+}
+
+void FilamentBatchRenderer::RenderFrame(
+        std::size_t index, const camera::PinholeCameraParameters& parameters) {
+    auto& frame = frames_[index % kFramesInFlight];
+    frame.width = width_;
+    frame.height = height_;
+    frame.color.resize(width_ * height_ * 3);
+    frame.depth.resize(render_depth_ ? width_ * height_ * 3 : 0);
+    frame.pending_readbacks = render_depth_ ? 2 : 1;
+
+    SetCamera(parameters);
+
+    const auto mode = view_->GetMode();
+    RenderPass(frame.color, frame);
+
+    if (render_depth_) {
+        // Packed depth must reach the buffer unchanged: no tone mapping,
+        // dithering, SSAO or multisample resolve.
+        auto* native_view = view_->GetNativeView();
+        const auto post_processing = native_view->isPostProcessingEnabled();
+        const auto ambient_occlusion = native_view->getAmbientOcclusion();
+        const auto clear_color = native_view->getClearColor();
+        const int sample_count = view_->GetSampleCount();
+
+        native_view->setPostProcessingEnabled(false);
+        native_view->setAmbientOcclusion(
+                filament::View::AmbientOcclusion::NONE);
+        native_view->setClearColor({0.f, 0.f, 0.f, 1.f});
+        view_->SetSampleCount(1);
+        view_->SetMode(View::Mode::LinearDepth);
+
+        RenderPass(frame.depth, frame);
+
+        native_view->setPostProcessingEnabled(post_processing);
+        native_view->setAmbientOcclusion(ambient_occlusion);
+        native_view->setClearColor(clear_color);
+        view_->SetSampleCount(sample_count);
+    }
+    view_->SetMode(mode);
+}
+
+void FilamentBatchRenderer::RenderPass(std::vector<std::uint8_t>& pixels,
+                                       InFlightFrame& frame) {
+    using namespace filament;
+    using namespace backend;
+
+    view_->PreRender();
+    while (!renderer_->beginFrame(swapchain_)) {
+    }
+    renderer_->render(view_->GetNativeView());
+
+    PixelBufferDescriptor pd(pixels.data(), pixels.size(),
+                             PixelDataFormat::RGB, PixelDataType::UBYTE,
+                             ReadPixelsCallback, &frame);
+    renderer_->readPixels(0, 0, std::uint32_t(frame.width),
+                          std::uint32_t(frame.height), std::move(pd));
+    renderer_->endFrame();
+}
+
+void FilamentBatchRenderer::ReadPixelsCallback(void*, size_t, void* user) {
+    static_cast<InFlightFrame*>(user)->pending_readbacks--;
+}
+
+void FilamentBatchRenderer::DeliverFrame(std::size_t index,
+                                         const FrameReadyCallback& callback) {
+    auto& frame = frames_[index % kFramesInFlight];
+    while (frame.pending_readbacks > 0) {
+        engine_.flushAndWait();
+    }
+
+    const int width = int(frame.width);
+    const int height = int(frame.height);
+
+    // Read back pixels start at the bottom row.
+    Frame result;
+    result.color = std::make_shared<geometry::Image>();
+    result.color->Prepare(width, height, 3, 1);
+    const std::size_t row_bytes = frame.width * 3;
+    for (int v = 0; v < height; ++v) {
+        std::copy_n(frame.color.data() + (height - 1 - v) * row_bytes,
+                    row_bytes, result.color->data_.data() + v * row_bytes);
+    }
+
+    if (!frame.depth.empty()) {
+        result.depth = std::make_shared<geometry::Image>();
+        result.depth->Prepare(width, height, 1, 4);
+        for (int v = 0; v < height; ++v) {
+            const std::uint8_t* src =
+                    frame.depth.data() + (height - 1 - v) * row_bytes;
+            float* dst = result.depth->PointerAt<float>(0, v);
+            for (int u = 0; u < width; ++u) {
+                dst[u] = UnpackDepth(src + 3 * u, near_, far_);
+            }
+        }
+    }
+
+    callback(index, result);
+}
+
+}  // namespace visualization
+}  // namespace open3d
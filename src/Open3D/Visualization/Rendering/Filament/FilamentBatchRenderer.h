@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace filament {
+class Engine;
+class Renderer;
+class SwapChain;
+}  // namespace filament
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}  // namespace camera
+
+namespace geometry {
+class Image;
+}  // namespace geometry
+
+namespace visualization {
+
+class FilamentResourceManager;
+class FilamentScene;
+class FilamentView;
+
+// Renders a scene from many cameras without a window. Frames are drawn into
+// an offscreen swap chain and read back asynchronously. Up to
+// kFramesInFlight readbacks are outstanding at a time, so the GPU renders the
+// next cameras while the pixels of the previous ones are being copied.
+class FilamentBatchRenderer {
+public:
+    static constexpr std::size_t kFramesInFlight = 3;
+
+    struct Frame {
+        // 8 bit RGB
+        std::shared_ptr<geometry::Image> color;
+        // 32 bit float distance along the optical axis, in scene units.
+        // Zero where nothing was hit. Empty if depth rendering is disabled.
+        std::shared_ptr<geometry::Image> depth;
+    };
+
+    // Called in camera order with the index of the camera.
+    using FrameReadyCallback =
+            std::function<void(std::size_t index, const Frame& frame)>;
+
+    FilamentBatchRenderer(filament::Engine& engine,
+                          FilamentResourceManager& resource_mgr,
+                          FilamentScene& scene);
+    ~FilamentBatchRenderer();
+
+    // Near and far planes of all cameras. Depth is quantized to 24 bits
+    // over this range.
+    void SetDepthRange(double near, double far);
+    void SetRenderDepth(bool enabled) { render_depth_ = enabled; }
+
+    // View used for the color images. Its camera and viewport are set for
+    // every frame, everything else (clear color, SSAO, ...) may be changed.
+    FilamentView& GetView() { return *view_; }
+
+    // Renders a frame for each of the cameras. Blocks until all frames were
+    // passed to the callback.
+    void Render(const std::vector<camera::PinholeCameraParameters>& cameras,
+                const FrameReadyCallback& callback);
+    std::vector<Frame> Render(
+            const std::vector<camera::PinholeCameraParameters>& cameras);
+
+private:
+    struct InFlightFrame {
+        std::size_t width = 0;
+        std::size_t height = 0;
+        std::vector<std::uint8_t> color;
+        std::vector<std::uint8_t> depth;
+        std::atomic<int> pending_readbacks{0};
+    };
+
+    void SetDimensions(std::size_t width, std::size_t height);
+    void SetCamera(const camera::PinholeCameraParameters& parameters);
+    void RenderFrame(std::size_t index,
+                     const camera::PinholeCameraParameters& parameters);
+    void RenderPass(std::vector<std::uint8_t>& pixels, InFlightFrame& frame);
+    void DeliverFrame(std::size_t index, const FrameReadyCallback& callback);
+
+    static void ReadPixelsCallback(void* buffer, size_t size, void* user);
+
+    filament::Engine& engine_;
+    FilamentResourceManager& resource_mgr_;
+    FilamentScene& scene_;
+    filament::Renderer* renderer_ = nullptr;
+    filament::SwapChain* swapchain_ = nullptr;
+    std::unique_ptr<FilamentView> view_;
+
+    std::size_t width_ = 0;
+    std::size_t height_ = 0;
+    double near_ = 0.01;
+    double far_ = 100.0;
+    bool render_depth_ = true;
+
+    InFlightFrame frames_[kFramesInFlight];
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -188,19 +188,10 @@ MaterialModifier& FilamentMaterialModifier::SetTexture(
         const TextureHandle& texture_handle,
         const TextureSamplerParameters& sampler_config) {
     if (material_instance_) {
-        auto w_texture =
-                EngineInstance::GetResourceManager().GetTexture(texture_handle);
-
-        if (auto texture_ptr = w_texture.lock()) {
-            material_instance_->setParameter(
-                    parameter, texture_ptr.get(),
-                    SamplerFromSamplerParameters(sampler_config));
-        } else {
-            utility::LogWarning(
-                    "Failed to set texture for material.\n\tMaterial handle: "
-                    "{}\n\tTexture handle: {}\n\tParameter name: {}",
-                    current_handle_, texture_handle, parameter);
-        }
+        // Goes through the resource manager so that the parameter follows
+        // the texture when a streamed texture finishes loading.
+        EngineInstance::GetResourceManager().BindTexture(
+                current_handle_, parameter, texture_handle, sampler_config);
     }
 
     return *this;
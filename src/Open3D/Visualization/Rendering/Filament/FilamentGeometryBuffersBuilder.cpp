@@ -26,13 +26,30 @@
 
 #include "Open3D/Visualization/Rendering/Filament/FilamentGeometryBuffersBuilder.h"
 
+#include <geometry/SurfaceOrientation.h>
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/TGeometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
 
+namespace {
+// Geometries with more than twice this many primitives are split into
+// chunks of roughly this size.
+const size_t kPrimitivesPerChunk = 1 << 17;
+// Tangent frames are computed in blocks of this many vertices in parallel.
+const size_t kTangentBlockSize = 1 << 16;
+}  // namespace
+
 std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
         const geometry::Geometry3D& geometry) {
     using GT = geometry::Geometry::GeometryType;
@@ -49,6 +66,11 @@ std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
         case GT::LineSet:
             return std::make_unique<LineSetBuffersBuilder>(
                     static_cast<const geometry::LineSet&>(geometry));
+
+        case GT::InstancedTriangleMesh:
+            return std::make_unique<InstancedTriangleMeshBuffersBuilder>(
+                    static_cast<const geometry::InstancedTriangleMesh&>(
+                            geometry));
         default:
             break;
     }
@@ -56,11 +78,155 @@ std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
     return nullptr;
 }
 
+std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
+        const tgeometry::TriangleMesh& geometry) {
+    return std::make_unique<TMeshBuffersBuilder>(geometry);
+}
+
+GeometryBuffersBuilder::~GeometryBuffersBuilder() {
+    // Data that was prepared but never uploaded.
+    free(prepared_.vertices);
+    free(prepared_.indices);
+}
+
 void GeometryBuffersBuilder::DeallocateBuffer(void* buffer,
                                               size_t size,
                                               void* user_ptr) {
     free(buffer);
 }
 
+filament::math::quatf* GeometryBuffersBuilder::ComputeTangents(
+        const std::vector<Eigen::Vector3f>& normals) {
+    const size_t n_vertices = normals.size();
+    auto* tangents = static_cast<filament::math::quatf*>(
+            malloc(n_vertices * sizeof(filament::math::quatf)));
+
+    // Without tangents or uvs every vertex is oriented from its normal
+    // alone, so the blocks are independent.
+    const int64_t n_blocks =
+            int64_t((n_vertices + kTangentBlockSize - 1) / kTangentBlockSize);
+    utility::ParallelFor(0, n_blocks, [&](int64_t block) {
+        const size_t begin = size_t(block) * kTangentBlockSize;
+        const size_t count = std::min(kTangentBlockSize, n_vertices - begin);
+        auto orientation =
+                filament::geometry::SurfaceOrientation::Builder()
+                        .vertexCount(count)
+                        .normals(reinterpret_cast<
+                                 const filament::math::float3*>(
+                                normals.data() + begin))
+                        .build();
+        orientation.getQuats(tangents + begin, count);
+    });
+
+    return tangents;
+}
+
+void GeometryBuffersBuilder::SplitIntoChunks(IndexType* indices,
+                                             size_t num_primitives,
+                                             size_t indices_per_primitive,
+                                             const void* vertices,
+                                             size_t vertex_stride) {
+    chunks_.clear();
+    if (num_primitives <= 2 * kPrimitivesPerChunk) {
+        return;
+    }
+
+    const auto* vertex_bytes = static_cast<const std::uint8_t*>(vertices);
+    auto position = [vertex_bytes, vertex_stride](IndexType i) {
+        return Eigen::Map<const Eigen::Vector3f>(reinterpret_cast<const float*>(
+                vertex_bytes + size_t(i) * vertex_stride));
+    };
+    auto centroid = [&](size_t p) {
+        Eigen::Vector3f c = Eigen::Vector3f::Zero();
+        for (size_t k = 0; k < indices_per_primitive; ++k) {
+            c += position(indices[p * indices_per_primitive + k]);
+        }
+        return Eigen::Vector3f(c / float(indices_per_primitive));
+    };
+
+    Eigen::Vector3f min_bound =
+            Eigen::Vector3f::Constant(std::numeric_limits<float>::max());
+    Eigen::Vector3f max_bound = -min_bound;
+    for (size_t p = 0; p < num_primitives; ++p) {
+        const Eigen::Vector3f c = centroid(p);
+        min_bound = min_bound.cwiseMin(c);
+        max_bound = max_bound.cwiseMax(c);
+    }
+
+    // Grow a grid with cells as close to cubes as possible until it has
+    // about one cell per chunk.
+    const Eigen::Vector3f extent = max_bound - min_bound;
+    const float max_extent = extent.maxCoeff();
+    if (!(max_extent > 0.0f)) {
+        return;
+    }
+    const size_t target_cells = num_primitives / kPrimitivesPerChunk;
+    size_t dims[3] = {1, 1, 1};
+    size_t num_cells = 1;
+    for (int k = 1; num_cells < target_cells && k <= 1024; ++k) {
+        num_cells = 1;
+        for (int axis = 0; axis < 3; ++axis) {
+            dims[axis] = std::max<size_t>(
+                    1, size_t(std::ceil(k * extent(axis) / max_extent)));
+            num_cells *= dims[axis];
+        }
+    }
+    if (num_cells < 2) {
+        return;
+    }
+
+    // Counting sort of the primitives by cell.
+    std::vector<std::uint32_t> primitive_cells(num_primitives);
+    std::vector<size_t> cell_offsets(num_cells + 1, 0);
+    for (size_t p = 0; p < num_primitives; ++p) {
+        const Eigen::Vector3f c = centroid(p);
+        size_t cell = 0;
+        for (int axis = 2; axis >= 0; --axis) {
+            size_t i = 0;
+            if (extent(axis) > 0.0f) {
+                i = size_t(float(dims[axis]) * (c(axis) - min_bound(axis)) /
+                           extent(axis));
+                i = std::min(i, dims[axis] - 1);
+            }
+            cell = cell * dims[axis] + i;
+        }
+        primitive_cells[p] = std::uint32_t(cell);
+        cell_offsets[cell + 1]++;
+    }
+    for (size_t cell = 0; cell < num_cells; ++cell) {
+        cell_offsets[cell + 1] += cell_offsets[cell];
+    }
+    std::vector<IndexType> sorted(num_primitives * indices_per_primitive);
+    std::vector<size_t> cursor(cell_offsets.begin(), cell_offsets.end() - 1);
+    for (size_t p = 0; p < num_primitives; ++p) {
+        const size_t dst = cursor[primitive_cells[p]]++;
+        std::copy(indices + p * indices_per_primitive,
+                  indices + (p + 1) * indices_per_primitive,
+                  sorted.begin() + dst * indices_per_primitive);
+    }
+    std::copy(sorted.begin(), sorted.end(), indices);
+
+    for (size_t cell = 0; cell < num_cells; ++cell) {
+        const size_t begin = cell_offsets[cell] * indices_per_primitive;
+        const size_t end = cell_offsets[cell + 1] * indices_per_primitive;
+        if (begin == end) {
+            continue;
+        }
+        Eigen::Vector3f chunk_min =
+                Eigen::Vector3f::Constant(std::numeric_limits<float>::max());
+        Eigen::Vector3f chunk_max = -chunk_min;
+        for (size_t i = begin; i < end; ++i) {
+            chunk_min = chunk_min.cwiseMin(position(indices[i]));
+            chunk_max = chunk_max.cwiseMax(position(indices[i]));
+        }
+        Chunk chunk;
+        chunk.offset = begin;
+        chunk.count = end - begin;
+        chunk.aabb.set({chunk_min.x(), chunk_min.y(), chunk_min.z()},
+                       {chunk_max.x(), chunk_max.y(), chunk_max.z()});
+        chunks_.push_back(chunk);
+    }
+}
+
 }  // namespace visualization
 }  // namespace open3d
@@ -32,18 +32,26 @@
 
 #include <filament/Box.h>
 #include <filament/RenderableManager.h>
+#include <math/quat.h>
+#include <Eigen/Core>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace open3d {
 
 namespace geometry {
 class Geometry3D;
+class InstancedTriangleMesh;
 class LineSet;
 class PointCloud;
 class TriangleMesh;
 }  // namespace geometry
 
+namespace tgeometry {
+class TriangleMesh;
+}  // namespace tgeometry
+
 namespace visualization {
 
 class GeometryBuffersBuilder {
@@ -51,18 +59,71 @@ public:
     using Buffers = std::tuple<VertexBufferHandle, IndexBufferHandle>;
     using IndexType = std::uint32_t;
 
+    /// Range of the index buffer that is drawn as a renderable of its own,
+    /// so that Filament can cull it by its bounding box.
+    struct Chunk {
+        size_t offset;  // in indices
+        size_t count;   // in indices
+        filament::Box aabb;
+    };
+
     static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
             const geometry::Geometry3D& geometry);
-    virtual ~GeometryBuffersBuilder() = default;
+    static std::unique_ptr<GeometryBuffersBuilder> GetBuilder(
+            const tgeometry::TriangleMesh& geometry);
+    virtual ~GeometryBuffersBuilder();
 
     virtual filament::RenderableManager::PrimitiveType GetPrimitiveType()
             const = 0;
 
+    /// Builds the vertex and index data on the CPU. Does not use the engine,
+    /// so it may run on a worker thread while the geometry stays unchanged.
+    /// ConstructBuffers() calls it if needed and then only uploads the data.
+    virtual void PrepareData() {}
+
     virtual Buffers ConstructBuffers() = 0;
     virtual filament::Box ComputeAABB() = 0;
 
+    /// Spatial chunks of the index buffer built by ConstructBuffers(). Empty
+    /// if the geometry is small enough to be drawn as a single renderable.
+    const std::vector<Chunk>& GetChunks() const { return chunks_; }
+
 protected:
+    /// Vertex and index data built by PrepareData(). The builder owns the
+    /// malloc'ed arrays until ConstructBuffers() hands them to Filament.
+    struct PreparedData {
+        void* vertices = nullptr;
+        size_t vertex_count = 0;
+        size_t vertex_bytes = 0;
+        size_t vertex_stride = 0;
+        IndexType* indices = nullptr;
+        size_t index_count = 0;
+    };
+
     static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
+
+    /// Hands the prepared data of a triangle mesh over to new Filament
+    /// vertex and index buffers.
+    static Buffers UploadBuffers(PreparedData& prepared, bool has_uvs);
+
+    /// Converts \p normals to the tangent frames Filament shades with.
+    /// Returns a malloc'ed array of normals.size() quaternions.
+    static filament::math::quatf* ComputeTangents(
+            const std::vector<Eigen::Vector3f>& normals);
+
+    /// Sorts the primitives of \p indices into the tiles of a regular grid
+    /// and fills chunks_ with one chunk per non-empty tile. Does nothing for
+    /// geometries with few primitives. Vertex positions are read as float3
+    /// at the start of each \p vertex_stride sized element of \p vertices.
+    void SplitIntoChunks(IndexType* indices,
+                         size_t num_primitives,
+                         size_t indices_per_primitive,
+                         const void* vertices,
+                         size_t vertex_stride);
+
+    std::vector<Chunk> chunks_;
+    PreparedData prepared_;
+    bool is_prepared_ = false;
 };
 
 class TriangleMeshBuffersBuilder : public GeometryBuffersBuilder {
@@ -72,6 +133,7 @@ public:
     filament::RenderableManager::PrimitiveType GetPrimitiveType()
             const override;
 
+    void PrepareData() override;
     Buffers ConstructBuffers() override;
     filament::Box ComputeAABB() override;
 
@@ -79,6 +141,24 @@ private:
     const geometry::TriangleMesh& geometry_;
 };
 
+/// Builds the buffers of a tgeometry::TriangleMesh straight from its
+/// Float32 tensors, without converting it to a geometry::TriangleMesh. The
+/// attributes are copied to the host once and interleaved there.
+class TMeshBuffersBuilder : public GeometryBuffersBuilder {
+public:
+    explicit TMeshBuffersBuilder(const tgeometry::TriangleMesh& geometry);
+
+    filament::RenderableManager::PrimitiveType GetPrimitiveType()
+            const override;
+
+    void PrepareData() override;
+    Buffers ConstructBuffers() override;
+    filament::Box ComputeAABB() override;
+
+private:
+    const tgeometry::TriangleMesh& geometry_;
+};
+
 class PointCloudBuffersBuilder : public GeometryBuffersBuilder {
 public:
     explicit PointCloudBuffersBuilder(const geometry::PointCloud& geometry);
@@ -86,6 +166,7 @@ public:
     filament::RenderableManager::PrimitiveType GetPrimitiveType()
             const override;
 
+    void PrepareData() override;
     Buffers ConstructBuffers() override;
     filament::Box ComputeAABB() override;
 
@@ -107,5 +188,30 @@ private:
     const geometry::LineSet& geometry_;
 };
 
+/// Filament in this version has no per-instance transform buffers, so the
+/// instances are merged into one mesh with a transformed copy per instance.
+/// The merged mesh is drawn by a single renderable (or one per spatial chunk)
+/// instead of one renderable per instance.
+class InstancedTriangleMeshBuffersBuilder : public GeometryBuffersBuilder {
+public:
+    explicit InstancedTriangleMeshBuffersBuilder(
+            const geometry::InstancedTriangleMesh& geometry);
+    ~InstancedTriangleMeshBuffersBuilder() override;
+
+    filament::RenderableManager::PrimitiveType GetPrimitiveType()
+            const override;
+
+    void PrepareData() override;
+    Buffers ConstructBuffers() override;
+    filament::Box ComputeAABB() override;
+
+private:
+    TriangleMeshBuffersBuilder& GetMeshBuilder();
+
+    const geometry::InstancedTriangleMesh& geometry_;
+    std::shared_ptr<geometry::TriangleMesh> merged_mesh_;
+    std::unique_ptr<TriangleMeshBuffersBuilder> mesh_builder_;
+};
+
 }  // namespace visualization
 }  // namespace open3d
@@ -113,7 +113,7 @@ void FilamentRenderer::UpdateSwapChain() {
     swap_chain_ = engine_.createSwapChain(native_win);
 }
 
-void FilamentRenderer::BeginFrame() {
+bool FilamentRenderer::BeginFrame() {
     // We will complete render to buffer requests first
     for (auto& br : buffer_renderers_) {
         if (br->pending_) {
@@ -122,6 +122,7 @@ void FilamentRenderer::BeginFrame() {
     }
 
     frame_started_ = renderer_->beginFrame(swap_chain_);
+    return frame_started_;
 }
 
 void FilamentRenderer::Draw() {
@@ -63,7 +63,7 @@ public:
 
     void UpdateSwapChain() override;
 
-    void BeginFrame() override;
+    bool BeginFrame() override;
     void Draw() override;
     void EndFrame() override;
 
@@ -39,6 +39,9 @@
 #include <image/KtxBundle.h>
 #include <image/KtxUtility.h>
 
+#include <algorithm>
+#include <chrono>
+
 #include "Open3D/GUI/Application.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/Utility/Console.h"
@@ -195,6 +198,78 @@ TextureSettings GetSettingsFromImage(const geometry::Image& image) {
 
     return settings;
 }
+
+// Halves the size of an 8 bit image with a box filter.
+std::shared_ptr<geometry::Image> Downsample(const geometry::Image& image) {
+    auto result = std::make_shared<geometry::Image>();
+    const int width = std::max(1, image.width_ / 2);
+    const int height = std::max(1, image.height_ / 2);
+    const int channels = image.num_of_channels_;
+    result->Prepare(width, height, channels, 1);
+    const auto* src = image.data_.data();
+    auto* dst = result->data_.data();
+    for (int y = 0; y < height; ++y) {
+        const int y0 = std::min(2 * y, image.height_ - 1);
+        const int y1 = std::min(2 * y + 1, image.height_ - 1);
+        for (int x = 0; x < width; ++x) {
+            const int x0 = std::min(2 * x, image.width_ - 1);
+            const int x1 = std::min(2 * x + 1, image.width_ - 1);
+            for (int c = 0; c < channels; ++c) {
+                const int sum = src[(y0 * image.width_ + x0) * channels + c] +
+                                src[(y0 * image.width_ + x1) * channels + c] +
+                                src[(y1 * image.width_ + x0) * channels + c] +
+                                src[(y1 * image.width_ + x1) * channels + c];
+                dst[(y * width + x) * channels + c] = std::uint8_t(sum / 4);
+            }
+        }
+    }
+    return result;
+}
+
+// Point samples an 8 bit image so that its longest side is at most
+// 'max_size'. Unlike repeated Downsample() calls this only reads the pixels
+// it keeps, so it is fast even for very large images.
+std::shared_ptr<geometry::Image> Resample(const geometry::Image& image,
+                                          size_t max_size) {
+    const size_t longest = std::max(image.width_, image.height_);
+    const int width = std::max<int>(1, int(image.width_ * max_size / longest));
+    const int height =
+            std::max<int>(1, int(image.height_ * max_size / longest));
+    const int channels = image.num_of_channels_;
+    auto result = std::make_shared<geometry::Image>();
+    result->Prepare(width, height, channels, 1);
+    for (int y = 0; y < height; ++y) {
+        const size_t src_y = size_t(y) * image.height_ / height;
+        for (int x = 0; x < width; ++x) {
+            const size_t src_x = size_t(x) * image.width_ / width;
+            std::copy_n(&image.data_[(src_y * image.width_ + src_x) * channels],
+                        channels, &result->data_[(y * width + x) * channels]);
+        }
+    }
+    return result;
+}
+
+// Returns the mipmap chain of 'image', starting with the largest level whose
+// longest side is at most 'max_size' (no limit if 0).
+std::vector<std::shared_ptr<geometry::Image>> CreateMipmaps(
+        std::shared_ptr<geometry::Image> image, size_t max_size) {
+    std::vector<std::shared_ptr<geometry::Image>> levels;
+    if (image->bytes_per_channel_ != 1) {
+        // Rejected with a proper message by GetSettingsFromImage().
+        levels.push_back(image);
+        return levels;
+    }
+    while (max_size > 0 &&
+           size_t(std::max(image->width_, image->height_)) > max_size) {
+        image = Downsample(*image);
+    }
+    levels.push_back(image);
+    while (image->width_ > 1 || image->height_ > 1) {
+        image = Downsample(*image);
+        levels.push_back(image);
+    }
+    return levels;
+}
 }  // namespace texture_loading
 
 }  // namespace
@@ -205,6 +280,8 @@ const MaterialHandle FilamentResourceManager::kDefaultUnlit =
         MaterialHandle::Next();
 const MaterialInstanceHandle FilamentResourceManager::kDepthMaterial =
         MaterialInstanceHandle::Next();
+const MaterialInstanceHandle FilamentResourceManager::kLinearDepthMaterial =
+        MaterialInstanceHandle::Next();
 const MaterialInstanceHandle FilamentResourceManager::kNormalsMaterial =
         MaterialInstanceHandle::Next();
 const MaterialInstanceHandle FilamentResourceManager::kColorMapMaterial =
@@ -215,20 +292,22 @@ const TextureHandle FilamentResourceManager::kDefaultColorMap =
         TextureHandle::Next();
 const TextureHandle FilamentResourceManager::kDefaultNormalMap =
         TextureHandle::Next();
+const size_t FilamentResourceManager::kDefaultMaxTextureSize = 8192;
+const size_t FilamentResourceManager::kStreamingPreviewSize = 512;
 
 static const std::unordered_set<REHandle_abstract> kDefaultResources = {
         FilamentResourceManager::kDefaultLit,
         FilamentResourceManager::kDefaultUnlit,
         FilamentResourceManager::kDepthMaterial,
+        FilamentResourceManager::kLinearDepthMaterial,
         FilamentResourceManager::kNormalsMaterial,
+        FilamentResourceManager::kColorMapMaterial,
         FilamentResourceManager::kDefaultTexture,
         FilamentResourceManager::kDefaultColorMap,
         FilamentResourceManager::kDefaultNormalMap};
 
 FilamentResourceManager::FilamentResourceManager(filament::Engine& engine)
-    : engine_(engine) {
-    LoadDefaults();
-}
+    : engine_(engine) {}
 
 FilamentResourceManager::~FilamentResourceManager() { DestroyAll(); }
 
@@ -277,6 +356,7 @@ MaterialHandle FilamentResourceManager::CreateMaterial(
 
 MaterialInstanceHandle FilamentResourceManager::CreateMaterialInstance(
         const MaterialHandle& id) {
+    LoadDefault(id);
     auto found = materials_.find(id);
     if (found != materials_.end()) {
         auto material_instance = found->second->createInstance();
@@ -291,6 +371,7 @@ MaterialInstanceHandle FilamentResourceManager::CreateMaterialInstance(
 MaterialInstanceHandle FilamentResourceManager::CreateFromDescriptor(
         const geometry::TriangleMesh::Material& descriptor) {
     MaterialInstanceHandle handle;
+    LoadDefault(kDefaultLit);
     auto pbr_ref = materials_[kDefaultLit];
     auto material_instance = pbr_ref->createInstance();
     handle = RegisterResource<MaterialInstanceHandle>(
@@ -306,16 +387,16 @@ MaterialInstanceHandle FilamentResourceManager::CreateFromDescriptor(
     material_instance->setParameter("baseColor", filament::RgbType::sRGB,
                                     base_color);
 
-#define TRY_ASSIGN_MAP(map)                                       \
-    {                                                             \
-        if (descriptor.map && descriptor.map->HasData()) {        \
-            auto hmaptex = CreateTexture(descriptor.map);         \
-            if (hmaptex) {                                        \
-                material_instance->setParameter(                  \
-                        #map, textures_[hmaptex].get(), sampler); \
-                dependencies_[handle].insert(hmaptex);            \
-            }                                                     \
-        }                                                         \
+#define TRY_ASSIGN_MAP(map)                                        \
+    {                                                              \
+        if (descriptor.map && descriptor.map->HasData()) {         \
+            auto hmaptex = CreateTexture(descriptor.map);          \
+            if (hmaptex) {                                         \
+                BindTexture(handle, #map, hmaptex,                 \
+                            TextureSamplerParameters::Pretty());   \
+                dependencies_[handle].insert(hmaptex);             \
+            }                                                      \
+        }                                                          \
     }
 
     material_instance->setParameter("baseRoughness", descriptor.baseRoughness);
@@ -347,27 +428,40 @@ TextureHandle FilamentResourceManager::CreateTexture(const char* path) {
 TextureHandle FilamentResourceManager::CreateTexture(
         const std::shared_ptr<geometry::Image>& img) {
     TextureHandle handle;
-    if (img->HasData()) {
-        auto texture = LoadTextureFromImage(img);
+    if (!img || !img->HasData()) {
+        return handle;
+    }
 
+    const size_t longest = std::max(img->width_, img->height_);
+    if (longest <= kStreamingPreviewSize || img->bytes_per_channel_ != 1) {
+        auto texture = LoadTextureFromImage(img);
         handle = RegisterResource<TextureHandle>(engine_, texture, textures_);
+        return handle;
     }
 
+    // Large textures take long to filter and upload. Show a preview right
+    // away and build the real texture in the background.
+    auto preview = texture_loading::Resample(*img, kStreamingPreviewSize);
+    auto texture = LoadTextureFromImage(preview);
+    handle = RegisterResource<TextureHandle>(engine_, texture, textures_);
+
+    PendingTexture pending;
+    pending.handle = handle;
+    pending.levels = std::async(
+            std::launch::async, [img, max_size = max_texture_size_]() {
+                return texture_loading::CreateMipmaps(img, max_size);
+            });
+    pending_textures_.push_back(std::move(pending));
+
     return handle;
 }
 
 TextureHandle FilamentResourceManager::CreateTexture(
         const geometry::Image& image) {
-    TextureHandle handle;
-    if (image.HasData()) {
-        auto copy = std::make_shared<geometry::Image>(image);
-
-        auto texture = LoadTextureFromImage(copy);
-
-        handle = RegisterResource<TextureHandle>(engine_, texture, textures_);
+    if (!image.HasData()) {
+        return TextureHandle();
     }
-
-    return handle;
+    return CreateTexture(std::make_shared<geometry::Image>(image));
 }
 
 TextureHandle FilamentResourceManager::CreateTextureFilled(
@@ -379,6 +473,83 @@ TextureHandle FilamentResourceManager::CreateTextureFilled(
     return handle;
 }
 
+void FilamentResourceManager::BindTexture(
+        const MaterialInstanceHandle& material_id,
+        const char* parameter,
+        const TextureHandle& texture_id,
+        const TextureSamplerParameters& sampler) {
+    auto material_instance = material_instances_.find(material_id);
+    auto texture = textures_.find(texture_id);
+    if (material_instance == material_instances_.end() ||
+        texture == textures_.end()) {
+        utility::LogWarning(
+                "Failed to bind texture {} to parameter {} of material {}",
+                texture_id, parameter, material_id);
+        return;
+    }
+
+    material_instance->second->setParameter(
+            parameter, texture->second.get(),
+            FilamentMaterialModifier::SamplerFromSamplerParameters(sampler));
+
+    auto& bindings = texture_bindings_[texture_id];
+    auto found = std::find_if(bindings.begin(), bindings.end(),
+                              [&](const TextureBinding& binding) {
+                                  return binding.material == material_id &&
+                                         binding.parameter == parameter;
+                              });
+    if (found != bindings.end()) {
+        found->sampler = sampler;
+    } else {
+        bindings.push_back({material_id, parameter, sampler});
+    }
+}
+
+size_t FilamentResourceManager::UpdatePendingTextures() {
+    for (auto it = pending_textures_.begin(); it != pending_textures_.end();) {
+        if (it->levels.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        ImageLevels levels;
+        try {
+            levels = it->levels.get();
+        } catch (const std::exception& e) {
+            utility::LogWarning("Failed to build texture {}: {}", it->handle,
+                                e.what());
+        }
+
+        // The texture may have been destroyed while it was being built.
+        auto found = textures_.find(it->handle);
+        if (!levels.empty() && found != textures_.end()) {
+            auto texture = MakeShared(LoadTextureFromLevels(levels), engine_);
+            // Materials must stop using the preview before it is destroyed.
+            auto bindings = texture_bindings_.find(it->handle);
+            if (bindings != texture_bindings_.end()) {
+                for (const auto& binding : bindings->second) {
+                    auto material_instance =
+                            material_instances_.find(binding.material);
+                    if (material_instance == material_instances_.end()) {
+                        continue;
+                    }
+                    material_instance->second->setParameter(
+                            binding.parameter.c_str(), texture.get(),
+                            FilamentMaterialModifier::
+                                    SamplerFromSamplerParameters(
+                                            binding.sampler));
+                }
+            }
+            found->second = texture;
+        }
+
+        it = pending_textures_.erase(it);
+    }
+
+    return pending_textures_.size();
+}
+
 IndirectLightHandle FilamentResourceManager::CreateIndirectLight(
         const ResourceLoadRequest& request) {
     IndirectLightHandle handle;
@@ -508,16 +679,19 @@ IndexBufferHandle FilamentResourceManager::CreateIndexBuffer(
 
 std::weak_ptr<filament::Material> FilamentResourceManager::GetMaterial(
         const MaterialHandle& id) {
+    LoadDefault(id);
     return FindResource(id, materials_);
 }
 
 std::weak_ptr<filament::MaterialInstance>
 FilamentResourceManager::GetMaterialInstance(const MaterialInstanceHandle& id) {
+    LoadDefault(id);
     return FindResource(id, material_instances_);
 }
 
 std::weak_ptr<filament::Texture> FilamentResourceManager::GetTexture(
         const TextureHandle& id) {
+    LoadDefault(id);
     return FindResource(id, textures_);
 }
 
@@ -542,6 +716,9 @@ std::weak_ptr<filament::IndexBuffer> FilamentResourceManager::GetIndexBuffer(
 }
 
 void FilamentResourceManager::DestroyAll() {
+    // Waits for the textures that are still being built.
+    pending_textures_.clear();
+    texture_bindings_.clear();
     material_instances_.clear();
     materials_.clear();
     textures_.clear();
@@ -589,6 +766,19 @@ void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
             return;
     }
 
+    if (id.type == EntityType::Texture) {
+        texture_bindings_.erase(id);
+    } else if (id.type == EntityType::MaterialInstance) {
+        for (auto& pair : texture_bindings_) {
+            auto& bindings = pair.second;
+            bindings.erase(std::remove_if(bindings.begin(), bindings.end(),
+                                          [&id](const TextureBinding& b) {
+                                              return b.material == id;
+                                          }),
+                           bindings.end());
+        }
+    }
+
     auto found = dependencies_.find(id);
     if (found != dependencies_.end()) {
         for (const auto& dependent : found->second) {
@@ -601,24 +791,32 @@ void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
 
 filament::Texture* FilamentResourceManager::LoadTextureFromImage(
         const std::shared_ptr<geometry::Image>& image) {
-    using namespace filament;
+    return LoadTextureFromLevels(
+            texture_loading::CreateMipmaps(image, max_texture_size_));
+}
 
-    auto retained_img_id = RetainImageForLoading(image);
-    auto texture_settings = texture_loading::GetSettingsFromImage(*image);
+filament::Texture* FilamentResourceManager::LoadTextureFromLevels(
+        const ImageLevels& levels) {
+    using namespace filament;
 
-    Texture::PixelBufferDescriptor pb(
-            image->data_.data(), image->data_.size(),
-            texture_settings.image_format, texture_settings.image_type,
-            FreeRetainedImage, (void*)retained_img_id);
+    auto texture_settings = texture_loading::GetSettingsFromImage(*levels[0]);
     auto texture = Texture::Builder()
                            .width(texture_settings.texel_width)
                            .height(texture_settings.texel_height)
-                           .levels((uint8_t)1)
+                           .levels(std::uint8_t(levels.size()))
                            .format(texture_settings.format)
                            .sampler(Texture::Sampler::SAMPLER_2D)
                            .build(engine_);
 
-    texture->setImage(engine_, 0, std::move(pb));
+    for (size_t level = 0; level < levels.size(); ++level) {
+        const auto& image = levels[level];
+        auto retained_img_id = RetainImageForLoading(image);
+        Texture::PixelBufferDescriptor pb(
+                image->data_.data(), image->data_.size(),
+                texture_settings.image_format, texture_settings.image_type,
+                FreeRetainedImage, (void*)retained_img_id);
+        texture->setImage(engine_, level, std::move(pb));
+    }
 
     return texture;
 }
@@ -645,84 +843,107 @@ filament::Texture* FilamentResourceManager::LoadFilledTexture(
     return texture;
 }
 
-void FilamentResourceManager::LoadDefaults() {
+void FilamentResourceManager::LoadDefault(const REHandle_abstract& id) {
+    // The default resources are loaded on first use, so that programs which
+    // never render do not pay for reading and compiling the materials.
+    if (kDefaultResources.count(id) == 0 || textures_.count(id) > 0 ||
+        materials_.count(id) > 0 || material_instances_.count(id) > 0) {
+        return;
+    }
+
     // FIXME: Move to precompiled resource blobs
     const std::string resource_root =
             gui::Application::GetInstance().GetResourcePath();
-
-    const auto texture_path = resource_root + "/defaultTexture.png";
-    auto texture_img = io::CreateImageFromFile(texture_path);
-    auto texture = LoadTextureFromImage(texture_img);
-    textures_[kDefaultTexture] = MakeShared(texture, engine_);
-
-    const auto colormap_path = resource_root + "/defaultGradient.png";
-    auto colormap_img = io::CreateImageFromFile(colormap_path);
-    auto color_map = LoadTextureFromImage(colormap_img);
-    textures_[kDefaultColorMap] = MakeShared(color_map, engine_);
-
-    auto normal_map = LoadFilledTexture(Eigen::Vector3f(0.5, 0.5, 1.f), 1);
-    textures_[kDefaultNormalMap] = MakeShared(normal_map, engine_);
-
     const auto default_sampler =
             FilamentMaterialModifier::SamplerFromSamplerParameters(
                     TextureSamplerParameters::Pretty());
     const auto default_color = filament::math::float3{1.0f, 1.0f, 1.0f};
+    auto load_material = [this, &resource_root](const char* filename) {
+        const auto path = resource_root + filename;
+        const auto hmat = CreateMaterial(ResourceLoadRequest(path.data()));
+        return materials_[hmat];
+    };
 
-    const auto lit_path = resource_root + "/defaultLit.filamat";
-    auto lit_mat = LoadMaterialFromFile(lit_path, engine_);
-    lit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                 default_color);
-    lit_mat->setDefaultParameter("baseRoughness", 0.7f);
-    lit_mat->setDefaultParameter("reflectance", 0.5f);
-    lit_mat->setDefaultParameter("baseMetallic", 0.f);
-    lit_mat->setDefaultParameter("clearCoat", 0.f);
-    lit_mat->setDefaultParameter("clearCoatRoughness", 0.f);
-    lit_mat->setDefaultParameter("anisotropy", 0.f);
-    lit_mat->setDefaultParameter("pointSize", 3.f);
-    lit_mat->setDefaultParameter("albedo", texture, default_sampler);
-    lit_mat->setDefaultParameter("metallicMap", texture, default_sampler);
-    lit_mat->setDefaultParameter("roughnessMap", texture, default_sampler);
-    lit_mat->setDefaultParameter("normalMap", normal_map, default_sampler);
-    lit_mat->setDefaultParameter("ambientOcclusionMap", texture,
-                                 default_sampler);
-    lit_mat->setDefaultParameter("reflectanceMap", texture, default_sampler);
-    lit_mat->setDefaultParameter("clearCoatMap", texture, default_sampler);
-    lit_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
-                                 default_sampler);
-    lit_mat->setDefaultParameter("anisotropyMap", texture, default_sampler);
-    materials_[kDefaultLit] = MakeShared(lit_mat, engine_);
-
-    const auto unlit_path = resource_root + "/defaultUnlit.filamat";
-    auto unlit_mat = LoadMaterialFromFile(unlit_path, engine_);
-    unlit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
-                                   default_color);
-    unlit_mat->setDefaultParameter("pointSize", 3.f);
-    unlit_mat->setDefaultParameter("albedo", texture, default_sampler);
-    materials_[kDefaultUnlit] = MakeShared(unlit_mat, engine_);
-
-    const auto depth_path = resource_root + "/depth.filamat";
-    const auto hdepth = CreateMaterial(ResourceLoadRequest(depth_path.data()));
-    auto depth_mat = materials_[hdepth];
-    depth_mat->setDefaultParameter("pointSize", 3.f);
-    material_instances_[kDepthMaterial] =
-            MakeShared(depth_mat->createInstance(), engine_);
-
-    const auto normals_path = resource_root + "/normals.filamat";
-    const auto hnormals =
-            CreateMaterial(ResourceLoadRequest(normals_path.data()));
-    auto normals_mat = materials_[hnormals];
-    normals_mat->setDefaultParameter("pointSize", 3.f);
-    material_instances_[kNormalsMaterial] =
-            MakeShared(normals_mat->createInstance(), engine_);
-
-    const auto colormap_map_path = resource_root + "/colorMap.filamat";
-    const auto hcolormap_mat =
-            CreateMaterial(ResourceLoadRequest(colormap_map_path.data()));
-    auto colormap_mat = materials_[hcolormap_mat];
-    auto colormap_mat_inst = colormap_mat->createInstance();
-    colormap_mat_inst->setParameter("colorMap", color_map, default_sampler);
-    material_instances_[kColorMapMaterial] =
-            MakeShared(colormap_mat_inst, engine_);
+    if (id == kDefaultTexture) {
+        const auto texture_path = resource_root + "/defaultTexture.png";
+        auto texture_img = io::CreateImageFromFile(texture_path);
+        auto texture = LoadTextureFromImage(texture_img);
+        textures_[kDefaultTexture] = MakeShared(texture, engine_);
+    } else if (id == kDefaultColorMap) {
+        const auto colormap_path = resource_root + "/defaultGradient.png";
+        auto colormap_img = io::CreateImageFromFile(colormap_path);
+        auto color_map = LoadTextureFromImage(colormap_img);
+        textures_[kDefaultColorMap] = MakeShared(color_map, engine_);
+    } else if (id == kDefaultNormalMap) {
+        auto normal_map = LoadFilledTexture(Eigen::Vector3f(0.5, 0.5, 1.f), 1);
+        textures_[kDefaultNormalMap] = MakeShared(normal_map, engine_);
+    } else if (id == kDefaultLit) {
+        LoadDefault(kDefaultTexture);
+        LoadDefault(kDefaultNormalMap);
+        auto texture = textures_[kDefaultTexture].get();
+        auto normal_map = textures_[kDefaultNormalMap].get();
+
+        const auto lit_path = resource_root + "/defaultLit.filamat";
+        auto lit_mat = LoadMaterialFromFile(lit_path, engine_);
+        lit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                     default_color);
+        lit_mat->setDefaultParameter("baseRoughness", 0.7f);
+        lit_mat->setDefaultParameter("reflectance", 0.5f);
+        lit_mat->setDefaultParameter("baseMetallic", 0.f);
+        lit_mat->setDefaultParameter("clearCoat", 0.f);
+        lit_mat->setDefaultParameter("clearCoatRoughness", 0.f);
+        lit_mat->setDefaultParameter("anisotropy", 0.f);
+        lit_mat->setDefaultParameter("pointSize", 3.f);
+        lit_mat->setDefaultParameter("albedo", texture, default_sampler);
+        lit_mat->setDefaultParameter("metallicMap", texture, default_sampler);
+        lit_mat->setDefaultParameter("roughnessMap", texture, default_sampler);
+        lit_mat->setDefaultParameter("normalMap", normal_map, default_sampler);
+        lit_mat->setDefaultParameter("ambientOcclusionMap", texture,
+                                     default_sampler);
+        lit_mat->setDefaultParameter("reflectanceMap", texture,
+                                     default_sampler);
+        lit_mat->setDefaultParameter("clearCoatMap", texture, default_sampler);
+        lit_mat->setDefaultParameter("clearCoatRoughnessMap", texture,
+                                     default_sampler);
+        lit_mat->setDefaultParameter("anisotropyMap", texture,
+                                     default_sampler);
+        materials_[kDefaultLit] = MakeShared(lit_mat, engine_);
+    } else if (id == kDefaultUnlit) {
+        LoadDefault(kDefaultTexture);
+        auto texture = textures_[kDefaultTexture].get();
+
+        const auto unlit_path = resource_root + "/defaultUnlit.filamat";
+        auto unlit_mat = LoadMaterialFromFile(unlit_path, engine_);
+        unlit_mat->setDefaultParameter("baseColor", filament::RgbType::sRGB,
+                                       default_color);
+        unlit_mat->setDefaultParameter("pointSize", 3.f);
+        unlit_mat->setDefaultParameter("albedo", texture, default_sampler);
+        materials_[kDefaultUnlit] = MakeShared(unlit_mat, engine_);
+    } else if (id == kDepthMaterial) {
+        auto depth_mat = load_material("/depth.filamat");
+        depth_mat->setDefaultParameter("pointSize", 3.f);
+        material_instances_[kDepthMaterial] =
+                MakeShared(depth_mat->createInstance(), engine_);
+    } else if (id == kLinearDepthMaterial) {
+        auto linear_depth_mat = load_material("/linearDepth.filamat");
+        linear_depth_mat->setDefaultParameter("pointSize", 3.f);
+        material_instances_[kLinearDepthMaterial] =
+                MakeShared(linear_depth_mat->createInstance(), engine_);
+    } else if (id == kNormalsMaterial) {
+        auto normals_mat = load_material("/normals.filamat");
+        normals_mat->setDefaultParameter("pointSize", 3.f);
+        material_instances_[kNormalsMaterial] =
+                MakeShared(normals_mat->createInstance(), engine_);
+    } else if (id == kColorMapMaterial) {
+        LoadDefault(kDefaultColorMap);
+        auto color_map = textures_[kDefaultColorMap].get();
+        auto colormap_mat = load_material("/colorMap.filamat");
+        auto colormap_mat_inst = colormap_mat->createInstance();
+        colormap_mat_inst->setParameter("colorMap", color_map,
+                                        default_sampler);
+        material_instances_[kColorMapMaterial] =
+                MakeShared(colormap_mat_inst, engine_);
+    }
 }
 
 }  // namespace visualization
@@ -26,9 +26,12 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Rendering/Renderer.h"
@@ -61,12 +64,19 @@ public:
     static const MaterialHandle kDefaultLit;
     static const MaterialHandle kDefaultUnlit;
     static const MaterialInstanceHandle kDepthMaterial;
+    static const MaterialInstanceHandle kLinearDepthMaterial;
     static const MaterialInstanceHandle kNormalsMaterial;
     static const MaterialInstanceHandle kColorMapMaterial;
     static const TextureHandle kDefaultTexture;
     static const TextureHandle kDefaultColorMap;
     static const TextureHandle kDefaultNormalMap;
 
+    // Default limit of the longest side of a texture, see SetMaxTextureSize().
+    static const size_t kDefaultMaxTextureSize;
+    // Textures with a longer side are streamed: a preview of at most this
+    // size is shown until the texture is ready.
+    static const size_t kStreamingPreviewSize;
+
     explicit FilamentResourceManager(filament::Engine& engine);
     ~FilamentResourceManager();
 
@@ -78,6 +88,10 @@ public:
     MaterialInstanceHandle CreateFromDescriptor(
             const geometry::TriangleMesh::Material& material_attributes);
 
+    // Textures get a full mipmap chain. Images larger than
+    // kStreamingPreviewSize are streamed: the texture first holds a small
+    // preview, and the full resolution version with its mipmaps is built on a
+    // worker thread and swapped in by UpdatePendingTextures().
     TextureHandle CreateTexture(const char* path);
     TextureHandle CreateTexture(const std::shared_ptr<geometry::Image>& image);
     // Slow, will make copy of image data and free it after.
@@ -86,6 +100,25 @@ public:
     TextureHandle CreateTextureFilled(const Eigen::Vector3f& color,
                                       size_t dimension);
 
+    // Textures whose longest side exceeds 'size' are downsampled before they
+    // are uploaded, which bounds the GPU memory of large textures. 0 disables
+    // the limit. Applies to textures created afterwards.
+    void SetMaxTextureSize(size_t size) { max_texture_size_ = size; }
+    size_t GetMaxTextureSize() const { return max_texture_size_; }
+
+    // Sets texture 'texture_id' as 'parameter' of material instance
+    // 'material_id'. The binding is remembered, so that the material follows
+    // when a streamed texture is replaced by its full resolution version.
+    void BindTexture(const MaterialInstanceHandle& material_id,
+                     const char* parameter,
+                     const TextureHandle& texture_id,
+                     const TextureSamplerParameters& sampler);
+
+    // Uploads the streamed textures that finished loading and rebinds them.
+    // Must be called from the thread that renders. Returns the number of
+    // textures that are still loading.
+    size_t UpdatePendingTextures();
+
     IndirectLightHandle CreateIndirectLight(const ResourceLoadRequest& request);
     SkyboxHandle CreateSkybox(const ResourceLoadRequest& request);
 
@@ -134,12 +167,35 @@ private:
     std::unordered_map<REHandle_abstract, std::unordered_set<REHandle_abstract>>
             dependencies_;
 
+    using ImageLevels = std::vector<std::shared_ptr<geometry::Image>>;
+
+    struct TextureBinding {
+        MaterialInstanceHandle material;
+        std::string parameter;
+        TextureSamplerParameters sampler;
+    };
+    // Material parameters each texture is bound to, see BindTexture().
+    std::unordered_map<REHandle_abstract, std::vector<TextureBinding>>
+            texture_bindings_;
+
+    struct PendingTexture {
+        TextureHandle handle;
+        std::future<ImageLevels> levels;
+    };
+    std::vector<PendingTexture> pending_textures_;
+
+    size_t max_texture_size_ = kDefaultMaxTextureSize;
+
+    // Builds the mipmaps of 'image' on the calling thread and uploads them.
     filament::Texture* LoadTextureFromImage(
             const std::shared_ptr<geometry::Image>& image);
+    filament::Texture* LoadTextureFromLevels(const ImageLevels& levels);
     filament::Texture* LoadFilledTexture(const Eigen::Vector3f& color,
                                          size_t dimension);
 
-    void LoadDefaults();
+    /// Loads the default resource \p id and the resources it depends on, if
+    /// it is a default resource that is not loaded yet.
+    void LoadDefault(const REHandle_abstract& id);
 };
 
 }  // namespace visualization
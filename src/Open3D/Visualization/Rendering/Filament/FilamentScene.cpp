@@ -39,7 +39,10 @@
 #include <filament/View.h>
 #include <utils/EntityManager.h>
 
+#include <chrono>
+
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -102,6 +105,9 @@ FilamentScene::FilamentScene(filament::Engine& engine,
 }
 
 FilamentScene::~FilamentScene() {
+    // Waits for the workers still building buffers.
+    pending_.clear();
+
     for (const auto& pair : entities_) {
         const auto& allocated_entity = pair.second;
 
@@ -113,6 +119,9 @@ FilamentScene::~FilamentScene() {
         }
 
         engine_.destroy(allocated_entity.info.self);
+        for (const auto& chunk : allocated_entity.info.chunks) {
+            engine_.destroy(chunk);
+        }
     }
 
     views_.clear();
@@ -183,10 +192,6 @@ GeometryHandle FilamentScene::AddGeometry(
             material_instance = resource_mgr_.CreateMaterialInstance(
                     defaults_mapping::kMesh);
 
-            auto wmaterial =
-                    resource_mgr_.GetMaterialInstance(material_instance);
-            auto mat = wmaterial.lock();
-
             auto htex = resource_mgr_.CreateTexture(
                     mesh.textures_[0].FlipVertical());
 
@@ -194,15 +199,8 @@ GeometryHandle FilamentScene::AddGeometry(
                 auto& entity = entities_[handle];
                 entity.texture = htex;
 
-                auto wtex = resource_mgr_.GetTexture(htex);
-                auto tex = wtex.lock();
-                if (tex) {
-                    static const auto kDefaultSampler =
-                            FilamentMaterialModifier::
-                                    SamplerFromSamplerParameters(
-                                            TextureSamplerParameters::Pretty());
-                    mat->setParameter("texture", tex.get(), kDefaultSampler);
-                }
+                resource_mgr_.BindTexture(material_instance, "texture", htex,
+                                          TextureSamplerParameters::Pretty());
             }
         } else {  // Mesh without any attributes set, only tangents are needed
             material_instance = resource_mgr_.CreateMaterialInstance(
@@ -217,6 +215,24 @@ GeometryHandle FilamentScene::AddGeometry(
                                   {0.75f, 0.75f, 0.75f});
             }
         }
+    } else if (geometry_type ==
+               geometry::Geometry::GeometryType::InstancedTriangleMesh) {
+        const auto& instances =
+                static_cast<const geometry::InstancedTriangleMesh&>(geometry);
+        if (instances.HasInstanceColors() ||
+            (instances.HasMesh() && instances.mesh_->HasVertexColors())) {
+            material_instance = resource_mgr_.CreateMaterialInstance(
+                    defaults_mapping::kColorOnlyMesh);
+        } else {
+            material_instance = resource_mgr_.CreateMaterialInstance(
+                    defaults_mapping::kPlainMesh);
+            auto mat = resource_mgr_.GetMaterialInstance(material_instance)
+                               .lock();
+            if (mat) {
+                mat->setParameter("baseColor", filament::RgbType::LINEAR,
+                                  {0.75f, 0.75f, 0.75f});
+            }
+        }
     } else if (geometry_type == geometry::Geometry::GeometryType::PointCloud) {
         const auto& pcd = static_cast<const geometry::PointCloud&>(geometry);
         if (pcd.HasColors()) {
@@ -250,9 +266,6 @@ GeometryHandle FilamentScene::AddGeometry(
         const geometry::Geometry3D& geometry,
         const MaterialInstanceHandle& material_id,
         const std::string& name) {
-    using namespace geometry;
-    using namespace filament;
-
     SceneEntity entity_entry;
     entity_entry.info.type = EntityType::Geometry;
     entity_entry.name = name;
@@ -264,45 +277,200 @@ GeometryHandle FilamentScene::AddGeometry(
         return {};
     }
 
-    auto buffers = geometry_buffer_builder->ConstructBuffers();
-    entity_entry.info.vb = std::get<0>(buffers);
-    entity_entry.info.ib = std::get<1>(buffers);
-
-    Box aabb = geometry_buffer_builder->ComputeAABB();
-
-    auto vbuf = resource_mgr_.GetVertexBuffer(entity_entry.info.vb).lock();
-    auto ibuf = resource_mgr_.GetIndexBuffer(entity_entry.info.ib).lock();
-
-    entity_entry.info.self = utils::EntityManager::get().create();
-    RenderableManager::Builder builder(1);
-    builder.boundingBox(aabb)
-            .layerMask(FilamentView::kAllLayersMask, FilamentView::kMainLayer)
-            .castShadows(true)
-            .receiveShadows(true)
-            .geometry(0, geometry_buffer_builder->GetPrimitiveType(),
-                      vbuf.get(), ibuf.get());
-
-    auto wmat_instance = resource_mgr_.GetMaterialInstance(material_id);
-    if (!wmat_instance.expired()) {
-        builder.material(0, wmat_instance.lock().get());
+    if (!resource_mgr_.GetMaterialInstance(material_id).expired()) {
         entity_entry.material = material_id;
     }
 
-    auto result = builder.build(engine_, entity_entry.info.self);
-
     GeometryHandle handle;
-    if (result == RenderableManager::Builder::Success) {
+    if (BuildRenderables(*geometry_buffer_builder, material_id,
+                         entity_entry.info)) {
         scene_->addEntity(entity_entry.info.self);
+        for (const auto& chunk : entity_entry.info.chunks) {
+            scene_->addEntity(chunk);
+        }
 
         handle = GeometryHandle::Next();
         entities_[handle] = entity_entry;
 
         SetEntityTransform(handle, Transform::Identity());
+
+        // Chunks follow the transform of the entity.
+        auto& transform_mgr = engine_.getTransformManager();
+        auto itransform = transform_mgr.getInstance(entity_entry.info.self);
+        for (const auto& chunk : entity_entry.info.chunks) {
+            transform_mgr.create(chunk, itransform);
+        }
     }
 
     return handle;
 }
 
+GeometryHandle FilamentScene::AddGeometryAsync(
+        std::shared_ptr<const geometry::Geometry3D> geometry,
+        const MaterialInstanceHandle& material_id,
+        std::function<void()> on_ready) {
+    auto geometry_buffer_builder =
+            GeometryBuffersBuilder::GetBuilder(*geometry);
+    if (!geometry_buffer_builder) {
+        utility::LogWarning("Geometry type {} is not supported yet!",
+                            static_cast<size_t>(geometry->GetGeometryType()));
+        return {};
+    }
+
+    SceneEntity entity_entry;
+    entity_entry.info.type = EntityType::Geometry;
+    entity_entry.name = geometry->GetName();
+    entity_entry.is_placeholder = true;
+    if (!resource_mgr_.GetMaterialInstance(material_id).expired()) {
+        entity_entry.material = material_id;
+    }
+
+    // The placeholder is the bounding box of the geometry, which is cheap to
+    // build here and already gives the entity its final extent.
+    if (!placeholder_material_) {
+        placeholder_material_ = resource_mgr_.CreateMaterialInstance(
+                defaults_mapping::kLineset);
+    }
+    auto box = geometry::LineSet::CreateFromAxisAlignedBoundingBox(
+            geometry->GetAxisAlignedBoundingBox());
+    LineSetBuffersBuilder box_builder(*box);
+    if (!BuildRenderables(box_builder, placeholder_material_,
+                          entity_entry.info)) {
+        return {};
+    }
+
+    scene_->addEntity(entity_entry.info.self);
+    auto handle = GeometryHandle::Next();
+    entities_[handle] = entity_entry;
+    SetEntityTransform(handle, Transform::Identity());
+
+    PendingGeometry pending;
+    pending.handle = handle;
+    pending.geometry = geometry;
+    pending.builder = std::move(geometry_buffer_builder);
+    auto* builder = pending.builder.get();
+    pending.prepared = std::async(std::launch::async, [builder, on_ready]() {
+        try {
+            builder->PrepareData();
+        } catch (...) {
+            if (on_ready) {
+                on_ready();
+            }
+            throw;
+        }
+        if (on_ready) {
+            on_ready();
+        }
+    });
+    pending_.push_back(std::move(pending));
+
+    return handle;
+}
+
+size_t FilamentScene::UpdatePendingGeometries() {
+    for (auto it = pending_.begin(); it != pending_.end();) {
+        if (it->prepared.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        const GeometryHandle handle = it->handle;
+        bool is_prepared = true;
+        try {
+            it->prepared.get();
+        } catch (const std::exception& e) {
+            utility::LogWarning("Failed to build buffers of geometry {}: {}",
+                                handle, e.what());
+            is_prepared = false;
+        }
+
+        // The geometry may have been removed while it was being built.
+        auto found = entities_.find(handle);
+        if (found != entities_.end()) {
+            auto& entity = found->second;
+            scene_->remove(entity.info.self);
+            entity.info.ReleaseResources(engine_, resource_mgr_);
+            entity.is_placeholder = false;
+
+            if (is_prepared && BuildRenderables(*it->builder, entity.material,
+                                                entity.info)) {
+                auto& transform_mgr = engine_.getTransformManager();
+                transform_mgr.create(entity.info.self,
+                                     transform_mgr.getInstance(entity.parent));
+                auto itransform = transform_mgr.getInstance(entity.info.self);
+                for (const auto& chunk : entity.info.chunks) {
+                    transform_mgr.create(chunk, itransform);
+                }
+
+                if (entity.enabled) {
+                    scene_->addEntity(entity.info.self);
+                    for (const auto& chunk : entity.info.chunks) {
+                        scene_->addEntity(chunk);
+                    }
+                }
+            } else {
+                RemoveEntity(handle);
+            }
+        }
+
+        it = pending_.erase(it);
+    }
+
+    return pending_.size();
+}
+
+bool FilamentScene::BuildRenderables(GeometryBuffersBuilder& builder,
+                                     const MaterialInstanceHandle& material_id,
+                                     SceneEntity::Details& info) {
+    using namespace filament;
+
+    auto buffers = builder.ConstructBuffers();
+    info.vb = std::get<0>(buffers);
+    info.ib = std::get<1>(buffers);
+
+    Box aabb = builder.ComputeAABB();
+
+    auto vbuf = resource_mgr_.GetVertexBuffer(info.vb).lock();
+    auto ibuf = resource_mgr_.GetIndexBuffer(info.ib).lock();
+
+    // Large geometries come split into spatial chunks. Each chunk is drawn
+    // by its own renderable so that Filament culls the chunks that are off
+    // screen.
+    auto chunks = builder.GetChunks();
+    if (chunks.empty()) {
+        chunks.push_back({0, ibuf->getIndexCount(), aabb});
+    }
+
+    auto wmat_instance = resource_mgr_.GetMaterialInstance(material_id);
+    auto build_renderable = [&](const GeometryBuffersBuilder::Chunk& chunk,
+                                utils::Entity entity) {
+        RenderableManager::Builder renderable_builder(1);
+        renderable_builder.boundingBox(chunk.aabb)
+                .layerMask(FilamentView::kAllLayersMask,
+                           FilamentView::kMainLayer)
+                .castShadows(true)
+                .receiveShadows(true)
+                .geometry(0, builder.GetPrimitiveType(), vbuf.get(),
+                          ibuf.get(), chunk.offset, chunk.count);
+        if (!wmat_instance.expired()) {
+            renderable_builder.material(0, wmat_instance.lock().get());
+        }
+        return renderable_builder.build(engine_, entity);
+    };
+
+    info.self = utils::EntityManager::get().create();
+    auto result = build_renderable(chunks[0], info.self);
+    for (size_t i = 1;
+         i < chunks.size() && result == RenderableManager::Builder::Success;
+         ++i) {
+        info.chunks.push_back(utils::EntityManager::get().create());
+        result = build_renderable(chunks[i], info.chunks.back());
+    }
+
+    return result == RenderableManager::Builder::Success;
+}
+
 std::vector<GeometryHandle> FilamentScene::FindGeometryByName(
         const std::string& name) {
     std::vector<GeometryHandle> found;
@@ -321,12 +489,20 @@ void FilamentScene::AssignMaterial(const GeometryHandle& geometry_id,
     auto found = entities_.find(geometry_id);
     if (found != entities_.end() && false == wmat_instance.expired()) {
         found->second.material = material_id;
+        if (found->second.is_placeholder) {
+            return;
+        }
 
         auto& renderable_mgr = engine_.getRenderableManager();
         filament::RenderableManager::Instance inst =
                 renderable_mgr.getInstance(found->second.info.self);
         renderable_mgr.setMaterialInstanceAt(inst, 0,
                                              wmat_instance.lock().get());
+        for (const auto& chunk : found->second.info.chunks) {
+            inst = renderable_mgr.getInstance(chunk);
+            renderable_mgr.setMaterialInstanceAt(inst, 0,
+                                                 wmat_instance.lock().get());
+        }
     } else {
         utility::LogWarning(
                 "Failed to assign material ({}) to geometry ({}): material or "
@@ -356,6 +532,11 @@ void FilamentScene::SetGeometryShadows(const GeometryHandle& geometry_id,
                 renderable_mgr.getInstance(found->second.info.self);
         renderable_mgr.setCastShadows(inst, casts_shadows);
         renderable_mgr.setReceiveShadows(inst, casts_shadows);
+        for (const auto& chunk : found->second.info.chunks) {
+            inst = renderable_mgr.getInstance(chunk);
+            renderable_mgr.setCastShadows(inst, casts_shadows);
+            renderable_mgr.setReceiveShadows(inst, casts_shadows);
+        }
     }
 }
 
@@ -556,8 +737,14 @@ void FilamentScene::SetEntityEnabled(const REHandle_abstract& entity_id,
 
             if (enabled) {
                 scene_->addEntity(entity.info.self);
+                for (const auto& chunk : entity.info.chunks) {
+                    scene_->addEntity(chunk);
+                }
             } else {
                 scene_->remove(entity.info.self);
+                for (const auto& chunk : entity.info.chunks) {
+                    scene_->remove(chunk);
+                }
             }
         }
     }
@@ -604,17 +791,25 @@ geometry::AxisAlignedBoundingBox FilamentScene::GetEntityBoundingBox(
     auto found = entities_.find(entity_id);
     if (found != entities_.end()) {
         auto& renderable_mgr = engine_.getRenderableManager();
-        auto inst = renderable_mgr.getInstance(found->second.info.self);
-        auto box = renderable_mgr.getAxisAlignedBoundingBox(inst);
-
         auto& transform_mgr = engine_.getTransformManager();
-        auto itransform = transform_mgr.getInstance(found->second.info.self);
-        auto transform = transform_mgr.getWorldTransform(itransform);
+        auto world_box = [&](utils::Entity entity) {
+            auto inst = renderable_mgr.getInstance(entity);
+            auto box = renderable_mgr.getAxisAlignedBoundingBox(inst);
 
-        box = rigidTransform(box, transform);
+            auto itransform = transform_mgr.getInstance(entity);
+            auto transform = transform_mgr.getWorldTransform(itransform);
 
+            return rigidTransform(box, transform);
+        };
+
+        auto box = world_box(found->second.info.self);
         auto min = box.center - box.halfExtent;
         auto max = box.center + box.halfExtent;
+        for (const auto& chunk : found->second.info.chunks) {
+            box = world_box(chunk);
+            min = filament::math::min(min, box.center - box.halfExtent);
+            max = filament::math::max(max, box.center + box.halfExtent);
+        }
         result = {{min.x, min.y, min.z}, {max.x, max.y, max.z}};
     }
 
@@ -622,6 +817,9 @@ geometry::AxisAlignedBoundingBox FilamentScene::GetEntityBoundingBox(
 }
 
 void FilamentScene::Draw(filament::Renderer& renderer) {
+    UpdatePendingGeometries();
+    resource_mgr_.UpdatePendingTextures();
+
     for (const auto& pair : views_) {
         auto& container = pair.second;
         if (container.is_active) {
@@ -665,6 +863,9 @@ void FilamentScene::RemoveEntity(REHandle_abstract id) {
     if (found != entities_.end()) {
         auto& data = found->second;
         scene_->remove(data.info.self);
+        for (const auto& chunk : data.info.chunks) {
+            scene_->remove(chunk);
+        }
 
         data.ReleaseResources(engine_, resource_mgr_);
 
@@ -676,13 +877,19 @@ void FilamentScene::SceneEntity::Details::ReleaseResources(
         filament::Engine& engine, FilamentResourceManager& manager) {
     if (vb) {
         manager.Destroy(vb);
+        vb = VertexBufferHandle();
     }
     if (ib) {
         manager.Destroy(ib);
+        ib = IndexBufferHandle();
     }
 
     engine.destroy(self);
     self.clear();
+    for (auto& chunk : chunks) {
+        engine.destroy(chunk);
+    }
+    chunks.clear();
 }
 
 void FilamentScene::SceneEntity::ReleaseResources(
@@ -29,8 +29,10 @@
 #include <utils/Entity.h>
 #include <utils/EntityInstance.h>
 
+#include <future>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "Open3D/Visualization/Rendering/Scene.h"
 
@@ -49,6 +51,7 @@ namespace visualization {
 
 class FilamentResourceManager;
 class FilamentView;
+class GeometryBuffersBuilder;
 
 class FilamentScene : public Scene {
 public:
@@ -74,6 +77,11 @@ public:
     GeometryHandle AddGeometry(const geometry::Geometry3D& geometry,
                                const MaterialInstanceHandle& material_id,
                                const std::string& name) override;
+    GeometryHandle AddGeometryAsync(
+            std::shared_ptr<const geometry::Geometry3D> geometry,
+            const MaterialInstanceHandle& material_id,
+            std::function<void()> on_ready = nullptr) override;
+    size_t UpdatePendingGeometries() override;
     std::vector<GeometryHandle> FindGeometryByName(
             const std::string& name) override;
     void AssignMaterial(const GeometryHandle& geometry_id,
@@ -128,6 +136,10 @@ private:
             EntityType type;
             VertexBufferHandle vb;
             IndexBufferHandle ib;
+            // Renderables for the spatial chunks of a large geometry beyond
+            // the first one, which is `self`. They share vb and ib with
+            // `self` and are its children in the transform hierarchy.
+            std::vector<utils::Entity> chunks;
 
             bool IsValid() const { return !self.isNull(); }
             void ReleaseResources(filament::Engine& engine,
@@ -137,6 +149,10 @@ private:
         // We can disable entities removing them from scene, but not
         // deallocating
         bool enabled = true;
+        // Set while the buffers of a geometry added by AddGeometryAsync()
+        // are being built. `info` then draws its bounding box and `material`
+        // is applied once the real renderables replace it.
+        bool is_placeholder = false;
         MaterialInstanceHandle material;
         TextureHandle texture;  // if none, default is used
         // Used for relocating transform to center of mass
@@ -148,6 +164,14 @@ private:
                               FilamentResourceManager& manager);
     };
 
+    struct PendingGeometry {
+        GeometryHandle handle;
+        // Keeps the geometry alive while the builder reads it
+        std::shared_ptr<const geometry::Geometry3D> geometry;
+        std::unique_ptr<GeometryBuffersBuilder> builder;
+        std::future<void> prepared;
+    };
+
     struct ViewContainer {
         std::unique_ptr<FilamentView> view;
         bool is_active = true;
@@ -156,6 +180,11 @@ private:
     utils::EntityInstance<filament::TransformManager>
     GetEntityTransformInstance(const REHandle_abstract& id);
     void RemoveEntity(REHandle_abstract id);
+    // Uploads the buffers of builder and creates the renderables of `info`,
+    // one per spatial chunk.
+    bool BuildRenderables(GeometryBuffersBuilder& builder,
+                          const MaterialInstanceHandle& material_id,
+                          SceneEntity::Details& info);
 
     filament::Scene* scene_ = nullptr;
 
@@ -164,6 +193,8 @@ private:
 
     std::unordered_map<REHandle_abstract, ViewContainer> views_;
     std::unordered_map<REHandle_abstract, SceneEntity> entities_;
+    std::vector<PendingGeometry> pending_;
+    MaterialInstanceHandle placeholder_material_;
     std::weak_ptr<filament::IndirectLight> indirect_light_;
     std::weak_ptr<filament::Skybox> skybox_;
 };
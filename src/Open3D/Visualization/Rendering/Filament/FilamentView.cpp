@@ -33,6 +33,8 @@
 #include <filament/View.h>
 #include <filament/Viewport.h>
 
+#include <algorithm>
+
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentCamera.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentEntitiesMods.h"
@@ -124,6 +126,7 @@ void FilamentView::SetMode(Mode mode) {
                     {clearColor_.x(), clearColor_.y(), clearColor_.z(), 1.f});
             break;
         case Mode::Depth:
+        case Mode::LinearDepth:
             view_->setVisibleLayers(kAllLayersMask, kMainLayer);
             view_->setClearColor(kDepthClearColor);
             break;
@@ -177,6 +180,24 @@ void FilamentView::SetSSAOEnabled(const bool enabled) {
     view_->setAmbientOcclusion(option);
 }
 
+bool FilamentView::IsSSAOEnabled() const {
+    return view_->getAmbientOcclusion() !=
+           filament::View::AmbientOcclusion::NONE;
+}
+
+void FilamentView::SetRenderScale(float scale) {
+    render_scale_ = std::min(std::max(scale, 0.1f), 1.f);
+    // A dynamic resolution range of a single scale renders at exactly that
+    // scale; Filament upscales the result during post-processing.
+    filament::View::DynamicResolutionOptions options;
+    options.enabled = render_scale_ < 1.f;
+    options.minScale = filament::math::float2(render_scale_);
+    options.maxScale = filament::math::float2(render_scale_);
+    view_->setDynamicResolutionOptions(options);
+}
+
+float FilamentView::GetRenderScale() const { return render_scale_; }
+
 Camera* FilamentView::GetCamera() const { return camera_.get(); }
 
 void FilamentView::CopySettingsFrom(const FilamentView& other) {
@@ -216,8 +237,11 @@ void FilamentView::PreRender() {
 
     MaterialInstanceHandle material_handle;
     std::shared_ptr<filament::MaterialInstance> selected_material;
-    if (mode_ == Mode::Depth) {
-        material_handle = FilamentResourceManager::kDepthMaterial;
+    if (mode_ == Mode::Depth || mode_ == Mode::LinearDepth) {
+        material_handle =
+                (mode_ == Mode::Depth)
+                        ? FilamentResourceManager::kDepthMaterial
+                        : FilamentResourceManager::kLinearDepthMaterial;
         // FIXME: Refresh parameters only then something ACTUALLY changed
         selected_material =
                 resource_mgr_.GetMaterialInstance(material_handle).lock();
@@ -265,7 +289,10 @@ void FilamentView::PreRender() {
     if (scene_) {
         for (const auto& pair : scene_->entities_) {
             const auto& entity = pair.second;
-            if (entity.info.type == EntityType::Geometry) {
+            // Placeholders keep their own material until the geometry
+            // replaces them.
+            if (entity.info.type == EntityType::Geometry &&
+                !entity.is_placeholder) {
                 std::shared_ptr<filament::MaterialInstance> mat_inst;
                 if (selected_material) {
                     mat_inst = selected_material;
@@ -292,6 +319,11 @@ void FilamentView::PreRender() {
                 filament::RenderableManager::Instance inst =
                         renderable_mgr.getInstance(entity.info.self);
                 renderable_mgr.setMaterialInstanceAt(inst, 0, mat_inst.get());
+                for (const auto& chunk : entity.info.chunks) {
+                    inst = renderable_mgr.getInstance(chunk);
+                    renderable_mgr.setMaterialInstanceAt(inst, 0,
+                                                         mat_inst.get());
+                }
             }
         }
     }
@@ -73,6 +73,10 @@ public:
     void SetClearColor(const Eigen::Vector3f& color) override;
 
     void SetSSAOEnabled(bool enabled) override;
+    bool IsSSAOEnabled() const override;
+
+    void SetRenderScale(float scale) override;
+    float GetRenderScale() const override;
 
     Camera* GetCamera() const override;
 
@@ -91,6 +95,7 @@ private:
     Eigen::Vector3f clear_color_;
     Mode mode_ = Mode::Color;
     TargetBuffers discard_buffers_;
+    float render_scale_ = 1.f;
 
     filament::Engine& engine_;
     FilamentScene* scene_ = nullptr;
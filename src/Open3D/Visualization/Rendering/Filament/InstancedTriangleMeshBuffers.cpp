@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Visualization/Rendering/Filament/FilamentGeometryBuffersBuilder.h"
+
+using namespace filament;
+
+namespace open3d {
+namespace visualization {
+
+InstancedTriangleMeshBuffersBuilder::InstancedTriangleMeshBuffersBuilder(
+        const geometry::InstancedTriangleMesh& geometry)
+    : geometry_(geometry) {}
+
+InstancedTriangleMeshBuffersBuilder::~InstancedTriangleMeshBuffersBuilder() {}
+
+RenderableManager::PrimitiveType
+InstancedTriangleMeshBuffersBuilder::GetPrimitiveType() const {
+    return RenderableManager::PrimitiveType::TRIANGLES;
+}
+
+void InstancedTriangleMeshBuffersBuilder::PrepareData() {
+    // Merging is the expensive part, so it runs here on the worker thread
+    // of FilamentScene::AddGeometryAsync().
+    GetMeshBuilder().PrepareData();
+}
+
+GeometryBuffersBuilder::Buffers
+InstancedTriangleMeshBuffersBuilder::ConstructBuffers() {
+    auto& mesh_builder = GetMeshBuilder();
+    auto buffers = mesh_builder.ConstructBuffers();
+    chunks_ = mesh_builder.GetChunks();
+    return buffers;
+}
+
+Box InstancedTriangleMeshBuffersBuilder::ComputeAABB() {
+    return GetMeshBuilder().ComputeAABB();
+}
+
+TriangleMeshBuffersBuilder&
+InstancedTriangleMeshBuffersBuilder::GetMeshBuilder() {
+    if (!mesh_builder_) {
+        merged_mesh_ = geometry_.CreateMergedMesh();
+        mesh_builder_ =
+                std::make_unique<TriangleMeshBuffersBuilder>(*merged_mesh_);
+    }
+    return *mesh_builder_;
+}
+
+}  // namespace visualization
+}  // namespace open3d
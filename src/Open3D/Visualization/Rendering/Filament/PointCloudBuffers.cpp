@@ -26,14 +26,15 @@
 
 #include <filament/IndexBuffer.h>
 #include <filament/VertexBuffer.h>
-#include <geometry/SurfaceOrientation.h>
 #include <Eigen/Core>
 
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentEngine.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentGeometryBuffersBuilder.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentResourceManager.h"
+#include "Open3D/Visualization/Utility/PointCloudLOD.h"
 
 using namespace filament;
 
@@ -41,6 +42,10 @@ namespace open3d {
 namespace visualization {
 
 namespace {
+// Point clouds larger than this are decimated to the coarsest levels of their
+// PointCloudLOD octree, which keeps the density uniform across the cloud.
+const size_t kPointBudget = 10000000;
+
 struct ColoredVertex {
     math::float3 position = {0.f, 0.f, 0.f};
     math::float4 color = {1.0f, 1.0f, 1.0f, 1.f};
@@ -80,11 +85,79 @@ RenderableManager::PrimitiveType PointCloudBuffersBuilder::GetPrimitiveType()
     return RenderableManager::PrimitiveType::POINTS;
 }
 
+void PointCloudBuffersBuilder::PrepareData() {
+    if (is_prepared_) {
+        return;
+    }
+    is_prepared_ = true;
+
+    // Breadth-first order of the octree nodes makes any prefix of the LOD
+    // order a uniform decimation, so the budget is simply a prefix.
+    std::shared_ptr<PointCloudLOD> lod;
+    if (geometry_.points_.size() > kPointBudget) {
+        lod = PointCloudLOD::CreateFromPointCloud(geometry_);
+    }
+    const size_t n_vertices = std::min(geometry_.points_.size(), kPointBudget);
+    auto source_index = [&lod](size_t i) { return lod ? lod->order_[i] : i; };
+
+    math::quatf* float4v_tagents = nullptr;
+    if (geometry_.HasNormals()) {
+        // Converting vertex normals to float base
+        std::vector<Eigen::Vector3f> normals;
+        normals.resize(n_vertices);
+        utility::ParallelFor(0, n_vertices, [&](int64_t i) {
+            normals[i] = geometry_.normals_[source_index(i)].cast<float>();
+        });
+
+        // Converting normals to Filament type - quaternions
+        float4v_tagents = ComputeTangents(normals);
+    }
+
+    const size_t vertices_byte_count = n_vertices * sizeof(ColoredVertex);
+    auto* vertices = static_cast<ColoredVertex*>(malloc(vertices_byte_count));
+    const ColoredVertex kDefault;
+    utility::ParallelFor(0, n_vertices, [&](int64_t i) {
+        ColoredVertex& element = vertices[i];
+        const size_t src = source_index(i);
+        element.SetVertexPosition(geometry_.points_[src]);
+        if (geometry_.HasColors()) {
+            element.SetVertexColor(geometry_.colors_[src]);
+        } else {
+            element.color = kDefault.color;
+        }
+
+        if (float4v_tagents) {
+            element.tangent = float4v_tagents[i];
+        } else {
+            element.tangent = kDefault.tangent;
+        }
+        element.uv = kDefault.uv;
+    });
+
+    free(float4v_tagents);
+
+    const size_t indices_byte_count = n_vertices * sizeof(IndexType);
+    auto* uint_indices = static_cast<IndexType*>(malloc(indices_byte_count));
+    for (std::uint32_t i = 0; i < n_vertices; ++i) {
+        uint_indices[i] = i;
+    }
+    SplitIntoChunks(uint_indices, n_vertices, 1, vertices,
+                    sizeof(ColoredVertex));
+
+    prepared_.vertices = vertices;
+    prepared_.vertex_count = n_vertices;
+    prepared_.vertex_bytes = vertices_byte_count;
+    prepared_.vertex_stride = sizeof(ColoredVertex);
+    prepared_.indices = uint_indices;
+    prepared_.index_count = n_vertices;
+}
+
 GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
-    const size_t n_vertices = geometry_.points_.size();
+    PrepareData();
+    const size_t n_vertices = prepared_.vertex_count;
 
     // We use CUSTOM0 for tangents along with TANGENTS attribute
     // because Filament would optimize out anything about normals and lightning
@@ -124,76 +197,29 @@ GeometryBuffersBuilder::Buffers PointCloudBuffersBuilder::ConstructBuffers() {
         return {};
     }
 
-    math::quatf* float4v_tagents = nullptr;
-    if (geometry_.HasNormals()) {
-        // Converting vertex normals to float base
-        std::vector<Eigen::Vector3f> normals;
-        normals.resize(n_vertices);
-        for (size_t i = 0; i < n_vertices; ++i) {
-            normals[i] = geometry_.normals_[i].cast<float>();
-        }
-
-        // Converting normals to Filament type - quaternions
-        const size_t tangents_byte_count = n_vertices * 4 * sizeof(float);
-        float4v_tagents =
-                static_cast<math::quatf*>(malloc(tangents_byte_count));
-        auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                   .vertexCount(n_vertices)
-                                   .normals(reinterpret_cast<math::float3*>(
-                                           normals.data()))
-                                   .build();
-        orientation.getQuats(float4v_tagents, n_vertices);
-    }
-
-    const size_t vertices_byte_count = n_vertices * sizeof(ColoredVertex);
-    auto* vertices = static_cast<ColoredVertex*>(malloc(vertices_byte_count));
-    const ColoredVertex kDefault;
-    for (size_t i = 0; i < geometry_.points_.size(); ++i) {
-        ColoredVertex& element = vertices[i];
-        element.SetVertexPosition(geometry_.points_[i]);
-        if (geometry_.HasColors()) {
-            element.SetVertexColor(geometry_.colors_[i]);
-        } else {
-            element.color = kDefault.color;
-        }
-
-        if (float4v_tagents) {
-            element.tangent = float4v_tagents[i];
-        } else {
-            element.tangent = kDefault.tangent;
-        }
-        element.uv = kDefault.uv;
-    }
-
-    free(float4v_tagents);
-
-    // Moving `vertices` to IndexBuffer, which will clean them up later
-    // with DeallocateBuffer
-    VertexBuffer::BufferDescriptor vb_descriptor(vertices, vertices_byte_count);
+    // Moving the prepared vertices to VertexBuffer, which will clean them up
+    // later with DeallocateBuffer
+    VertexBuffer::BufferDescriptor vb_descriptor(prepared_.vertices,
+                                                 prepared_.vertex_bytes);
     vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
     vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
-
-    const size_t indices_byte_count = n_vertices * sizeof(IndexType);
-    auto* uint_indices = static_cast<IndexType*>(malloc(indices_byte_count));
-    for (std::uint32_t i = 0; i < n_vertices; ++i) {
-        uint_indices[i] = i;
-    }
+    prepared_.vertices = nullptr;
 
     auto ib_handle =
             resource_mgr.CreateIndexBuffer(n_vertices, sizeof(IndexType));
     if (!ib_handle) {
-        free(uint_indices);
         return {};
     }
 
     auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
 
-    // Moving `uintIndices` to IndexBuffer, which will clean them up later
-    // with DeallocateBuffer
-    IndexBuffer::BufferDescriptor indices_descriptor(uint_indices,
-                                                     indices_byte_count);
+    // Moving the prepared indices to IndexBuffer, which will clean them up
+    // later with DeallocateBuffer
+    IndexBuffer::BufferDescriptor indices_descriptor(
+            prepared_.indices, n_vertices * sizeof(IndexType));
     indices_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
     ibuf->setBuffer(engine, std::move(indices_descriptor));
+    prepared_.indices = nullptr;
 
     return std::make_tuple(vb_handle, ib_handle);
 }
@@ -30,12 +30,14 @@
 #include <filament/Scene.h>
 #include <filament/TransformManager.h>
 #include <filament/VertexBuffer.h>
-#include <geometry/SurfaceOrientation.h>
 
+#include <cstring>
 #include <map>
 
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/TGeometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentEngine.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentGeometryBuffersBuilder.h"
 #include "Open3D/Visualization/Rendering/Filament/FilamentResourceManager.h"
@@ -179,7 +181,7 @@ std::tuple<vbdata, ibdata> CreatePlainBuffers(
 
     const BaseVertex kDefault;
     auto plain_vertices = static_cast<BaseVertex*>(vertex_data.bytes);
-    for (size_t i = 0; i < vertex_data.vertices_count; ++i) {
+    utility::ParallelFor(0, vertex_data.vertices_count, [&](int64_t i) {
         BaseVertex& element = plain_vertices[i];
 
         SetVertexPosition(element, geometry.vertices_[i]);
@@ -188,7 +190,7 @@ std::tuple<vbdata, ibdata> CreatePlainBuffers(
         } else {
             element.tangent = kDefault.tangent;
         }
-    }
+    });
 
     index_data.stride = sizeof(GeometryBuffersBuilder::IndexType);
     index_data.byte_count = geometry.triangles_.size() * 3 * index_data.stride;
@@ -217,7 +219,7 @@ std::tuple<vbdata, ibdata> CreateColoredBuffers(
 
     const ColoredVertex kDefault;
     auto colored_vertices = static_cast<ColoredVertex*>(vertex_data.bytes);
-    for (size_t i = 0; i < vertex_data.vertices_count; ++i) {
+    utility::ParallelFor(0, vertex_data.vertices_count, [&](int64_t i) {
         ColoredVertex& element = colored_vertices[i];
 
         SetVertexPosition(element, geometry.vertices_[i]);
@@ -232,7 +234,7 @@ std::tuple<vbdata, ibdata> CreateColoredBuffers(
         } else {
             element.color = kDefault.color;
         }
-    }
+    });
 
     index_data.stride = sizeof(GeometryBuffersBuilder::IndexType);
     index_data.byte_count = geometry.triangles_.size() * 3 * index_data.stride;
@@ -353,6 +355,50 @@ std::tuple<vbdata, ibdata> CreateTexturedBuffers(
 
 }  // namespace
 
+GeometryBuffersBuilder::Buffers GeometryBuffersBuilder::UploadBuffers(
+        PreparedData& prepared, bool has_uvs) {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // NOTE: Both default lit and unlit material shaders require per-vertex
+    // colors so we unconditionally assume the triangle mesh has color.
+    const bool has_colors = true;
+
+    VertexBuffer* vbuf = nullptr;
+    vbuf = BuildFilamentVertexBuffer(engine, prepared.vertex_count,
+                                     prepared.vertex_stride, has_uvs,
+                                     has_colors);
+
+    VertexBufferHandle vb_handle;
+    if (vbuf) {
+        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
+    } else {
+        return {};
+    }
+
+    // Gives ownership of the prepared vertices to VertexBuffer, which will
+    // be deallocated later with DeallocateBuffer.
+    VertexBuffer::BufferDescriptor vb_descriptor(prepared.vertices,
+                                                 prepared.vertex_bytes);
+    vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
+    prepared.vertices = nullptr;
+
+    auto ib_handle = resource_mgr.CreateIndexBuffer(prepared.index_count,
+                                                    sizeof(IndexType));
+    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
+
+    // Gives ownership of the prepared indices to IndexBuffer, which will
+    // be deallocated later with DeallocateBuffer.
+    IndexBuffer::BufferDescriptor ib_descriptor(
+            prepared.indices, prepared.index_count * sizeof(IndexType));
+    ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
+    ibuf->setBuffer(engine, std::move(ib_descriptor));
+    prepared.indices = nullptr;
+
+    return std::make_tuple(vb_handle, ib_handle);
+}
+
 TriangleMeshBuffersBuilder::TriangleMeshBuffersBuilder(
         const geometry::TriangleMesh& geometry)
     : geometry_(geometry) {}
@@ -362,9 +408,11 @@ RenderableManager::PrimitiveType TriangleMeshBuffersBuilder::GetPrimitiveType()
     return RenderableManager::PrimitiveType::TRIANGLES;
 }
 
-GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
-    auto& engine = EngineInstance::GetInstance();
-    auto& resource_mgr = EngineInstance::GetResourceManager();
+void TriangleMeshBuffersBuilder::PrepareData() {
+    if (is_prepared_) {
+        return;
+    }
+    is_prepared_ = true;
 
     const size_t n_vertices = geometry_.vertices_.size();
 
@@ -373,20 +421,12 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
         // Converting vertex normals to float base
         std::vector<Eigen::Vector3f> normals;
         normals.resize(n_vertices);
-        for (size_t i = 0; i < n_vertices; ++i) {
+        utility::ParallelFor(0, n_vertices, [&](int64_t i) {
             normals[i] = geometry_.vertex_normals_[i].cast<float>();
-        }
+        });
 
         // Converting normals to Filament type - quaternions
-        const size_t tangents_byte_count = n_vertices * 4 * sizeof(float);
-        float4v_tangents =
-                static_cast<math::quatf*>(malloc(tangents_byte_count));
-        auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                   .vertexCount(n_vertices)
-                                   .normals(reinterpret_cast<math::float3*>(
-                                           normals.data()))
-                                   .build();
-        orientation.getQuats(float4v_tangents, n_vertices);
+        float4v_tangents = ComputeTangents(normals);
     } else {
         utility::LogWarning(
                 "Trying to create mesh without vertex normals. Shading would "
@@ -417,39 +457,22 @@ GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
     const vbdata& vertex_data = std::get<0>(buffers_data);
     const ibdata& index_data = std::get<1>(buffers_data);
 
-    VertexBuffer* vbuf = nullptr;
-    vbuf = BuildFilamentVertexBuffer(engine, vertex_data.vertices_count, stride,
-                                     has_uvs, has_colors);
-
-    VertexBufferHandle vb_handle;
-    if (vbuf) {
-        vb_handle = resource_mgr.AddVertexBuffer(vbuf);
-    } else {
-        free(vertex_data.bytes);
-        free(index_data.bytes);
-
-        return {};
-    }
-
-    // Gives ownership of vertexData.bytes to VertexBuffer, which will
-    // be deallocated later with DeallocateBuffer.
-    VertexBuffer::BufferDescriptor vb_descriptor(vertex_data.bytes,
-                                                 vertex_data.bytes_to_copy);
-    vb_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(vb_descriptor));
-
-    auto ib_handle = resource_mgr.CreateIndexBuffer(
-            index_data.byte_count / index_data.stride, index_data.stride);
-    auto ibuf = resource_mgr.GetIndexBuffer(ib_handle).lock();
-
-    // Gives ownership of indexData.bytes to IndexBuffer, which will
-    // be deallocated later with DeallocateBuffer.
-    IndexBuffer::BufferDescriptor ib_descriptor(index_data.bytes,
-                                                index_data.byte_count);
-    ib_descriptor.setCallback(GeometryBuffersBuilder::DeallocateBuffer);
-    ibuf->setBuffer(engine, std::move(ib_descriptor));
+    prepared_.vertices = vertex_data.bytes;
+    prepared_.vertex_count = vertex_data.vertices_count;
+    prepared_.vertex_bytes = vertex_data.bytes_to_copy;
+    prepared_.vertex_stride = stride;
+    prepared_.indices = index_data.bytes;
+    prepared_.index_count = index_data.byte_count / index_data.stride;
+
+    // Positions lead every vertex layout, so chunking can read them from the
+    // final vertex data.
+    SplitIntoChunks(prepared_.indices, prepared_.index_count / 3, 3,
+                    prepared_.vertices, stride);
+}
 
-    return std::make_tuple(vb_handle, ib_handle);
+GeometryBuffersBuilder::Buffers TriangleMeshBuffersBuilder::ConstructBuffers() {
+    PrepareData();
+    return UploadBuffers(prepared_, geometry_.HasTriangleUvs());
 }
 
 filament::Box TriangleMeshBuffersBuilder::ComputeAABB() {
@@ -468,5 +491,114 @@ filament::Box TriangleMeshBuffersBuilder::ComputeAABB() {
     return aabb;
 }
 
+TMeshBuffersBuilder::TMeshBuffersBuilder(
+        const tgeometry::TriangleMesh& geometry)
+    : geometry_(geometry) {}
+
+RenderableManager::PrimitiveType TMeshBuffersBuilder::GetPrimitiveType()
+        const {
+    return RenderableManager::PrimitiveType::TRIANGLES;
+}
+
+void TMeshBuffersBuilder::PrepareData() {
+    if (is_prepared_) {
+        return;
+    }
+    is_prepared_ = true;
+
+    const Device host("CPU:0");
+    const size_t n_vertices = size_t(geometry_.NumVertices());
+    const size_t n_triangles = size_t(geometry_.NumTriangles());
+    // Float32 contiguous copies on the host, the layout of the vertex data.
+    auto to_host = [&](const TensorList& values, Dtype dtype) {
+        return values.AsTensor().To(dtype).Copy(host).Contiguous();
+    };
+    const Tensor vertices = to_host(geometry_.GetVertices(), Dtype::Float32);
+    const auto* positions = static_cast<const float*>(vertices.GetDataPtr());
+
+    math::quatf* tangents = nullptr;
+    if (geometry_.HasVertexNormals()) {
+        const Tensor normals_tensor = to_host(
+                geometry_.GetVertexAttr("normals"), Dtype::Float32);
+        std::vector<Eigen::Vector3f> normals(n_vertices);
+        std::memcpy(normals.data()->data(), normals_tensor.GetDataPtr(),
+                    n_vertices * 3 * sizeof(float));
+        tangents = ComputeTangents(normals);
+    } else {
+        utility::LogWarning(
+                "Trying to create mesh without vertex normals. Shading would "
+                "not work correctly. Consider to generate vertex normals "
+                "first.");
+    }
+
+    Tensor colors_tensor;
+    const float* colors = nullptr;
+    if (geometry_.HasVertexColors()) {
+        colors_tensor =
+                to_host(geometry_.GetVertexAttr("colors"), Dtype::Float32);
+        colors = static_cast<const float*>(colors_tensor.GetDataPtr());
+    }
+
+    const size_t stride = sizeof(ColoredVertex);
+    auto* colored_vertices =
+            static_cast<ColoredVertex*>(malloc(n_vertices * stride));
+    const ColoredVertex kDefault;
+    utility::ParallelFor(0, int64_t(n_vertices), [&](int64_t i) {
+        ColoredVertex& element = colored_vertices[i];
+        element.position = math::float3(positions[3 * i], positions[3 * i + 1],
+                                        positions[3 * i + 2]);
+        element.tangent = tangents != nullptr ? tangents[i] : kDefault.tangent;
+        if (colors != nullptr) {
+            element.color = math::float4(colors[3 * i], colors[3 * i + 1],
+                                         colors[3 * i + 2], 1.f);
+        } else {
+            element.color = kDefault.color;
+        }
+    });
+    free(tangents);
+
+    const Tensor triangles = to_host(geometry_.GetTriangles(), Dtype::Int64);
+    const auto* triangle_data =
+            static_cast<const int64_t*>(triangles.GetDataPtr());
+    auto* indices = static_cast<IndexType*>(
+            malloc(n_triangles * 3 * sizeof(IndexType)));
+    utility::ParallelFor(0, int64_t(n_triangles * 3), [&](int64_t i) {
+        indices[i] = IndexType(triangle_data[i]);
+    });
+
+    prepared_.vertices = colored_vertices;
+    prepared_.vertex_count = n_vertices;
+    prepared_.vertex_bytes = n_vertices * stride;
+    prepared_.vertex_stride = stride;
+    prepared_.indices = indices;
+    prepared_.index_count = n_triangles * 3;
+
+    SplitIntoChunks(prepared_.indices, n_triangles, 3, prepared_.vertices,
+                    stride);
+}
+
+GeometryBuffersBuilder::Buffers TMeshBuffersBuilder::ConstructBuffers() {
+    PrepareData();
+    return UploadBuffers(prepared_, false);
+}
+
+filament::Box TMeshBuffersBuilder::ComputeAABB() {
+    Box aabb;
+    if (!geometry_.HasVertices()) {
+        return aabb;
+    }
+    const std::vector<float> min_bound = geometry_.GetMinBound()
+                                                 .To(Dtype::Float32)
+                                                 .Copy(Device("CPU:0"))
+                                                 .ToFlatVector<float>();
+    const std::vector<float> max_bound = geometry_.GetMaxBound()
+                                                 .To(Dtype::Float32)
+                                                 .Copy(Device("CPU:0"))
+                                                 .ToFlatVector<float>();
+    aabb.set(filament::math::float3(min_bound[0], min_bound[1], min_bound[2]),
+             filament::math::float3(max_bound[0], max_bound[1], max_bound[2]));
+    return aabb;
+}
+
 }  // namespace visualization
 }  // namespace open3d
@@ -72,7 +72,7 @@ struct TextureSamplerParameters {
     static TextureSamplerParameters Simple();
 
     /* filterMag = MagFilter::Linear
-     * filterMin = MinFilter::Linear
+     * filterMin = MinFilter::LinearMipmapLinear
      * wrapU = WrapMode::ClampToEdge
      * wrapV = WrapMode::ClampToEdge
      * wrapW = WrapMode::ClampToEdge
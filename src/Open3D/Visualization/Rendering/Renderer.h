@@ -71,7 +71,9 @@ public:
 
     virtual void UpdateSwapChain() = 0;
 
-    virtual void BeginFrame() = 0;
+    /// Returns false if the frame is skipped, e.g. because the GPU is still
+    /// busy with previous frames. It then needs to be drawn again later.
+    virtual bool BeginFrame() = 0;
     virtual void Draw() = 0;
     virtual void EndFrame() = 0;
 
@@ -27,6 +27,8 @@
 #pragma once
 
 #include <Eigen/Geometry>
+#include <functional>
+#include <memory>
 
 #include "Open3D/Visualization/Rendering/RendererHandle.h"
 #include "Open3D/Visualization/Rendering/RendererStructs.h"
@@ -72,6 +74,18 @@ public:
             const geometry::Geometry3D& geometry,
             const MaterialInstanceHandle& material_id,
             const std::string& name) = 0;
+    // Like AddGeometry(), but the vertex data are built on a worker thread
+    // and the entity shows the bounding box of the geometry until they are
+    // uploaded by UpdatePendingGeometries(). 'on_ready' is called on the
+    // worker thread when the upload can happen. The geometry must not change
+    // until then.
+    virtual GeometryHandle AddGeometryAsync(
+            std::shared_ptr<const geometry::Geometry3D> geometry,
+            const MaterialInstanceHandle& material_id,
+            std::function<void()> on_ready = nullptr) = 0;
+    // Uploads the asynchronously added geometries whose data are ready.
+    // Returns the number of geometries still being built.
+    virtual size_t UpdatePendingGeometries() = 0;
     virtual void AssignMaterial(const GeometryHandle& geometry_id,
                                 const MaterialInstanceHandle& material_id) = 0;
     virtual MaterialInstanceHandle GetMaterial(
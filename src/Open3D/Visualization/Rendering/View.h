@@ -52,6 +52,9 @@ public:
         Color = 0u,
         Depth,
         Normals,
+        // Linear depth packed into the color channels, for reading back
+        // depth images. See FilamentBatchRenderer.
+        LinearDepth,
         // This three modes always stay at end
         ColorMapX,
         ColorMapY,
@@ -78,6 +81,12 @@ public:
     virtual void SetClearColor(const Eigen::Vector3f& color) = 0;
 
     virtual void SetSSAOEnabled(bool enabled) = 0;
+    virtual bool IsSSAOEnabled() const = 0;
+
+    // Renders at scale times the viewport resolution, in (0, 1], and upscales
+    // the result to the viewport. Trades sharpness for fill rate.
+    virtual void SetRenderScale(float scale) = 0;
+    virtual float GetRenderScale() const = 0;
 
     virtual Camera* GetCamera() const = 0;
 };
@@ -27,6 +27,7 @@
 #include "Open3D/Visualization/Shader/GeometryRenderer.h"
 
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -44,7 +45,10 @@ bool PointCloudRenderer::Render(const RenderOption &option,
     if (!is_visible_ || geometry_ptr_->IsEmpty()) return true;
     const auto &pointcloud = (const geometry::PointCloud &)(*geometry_ptr_);
     bool success = true;
-    if (pointcloud.HasNormals()) {
+    use_lod_ = pointcloud.points_.size() > option.point_budget_;
+    if (use_lod_) {
+        success &= lod_point_shader_.Render(pointcloud, option, view);
+    } else if (pointcloud.HasNormals()) {
         if (option.point_color_option_ ==
             RenderOption::PointColorOption::Normal) {
             success &= normal_point_shader_.Render(pointcloud, option, view);
@@ -76,9 +80,14 @@ bool PointCloudRenderer::UpdateGeometry() {
     phong_point_shader_.InvalidateGeometry();
     normal_point_shader_.InvalidateGeometry();
     simpleblack_normal_shader_.InvalidateGeometry();
+    lod_point_shader_.InvalidateGeometry();
     return true;
 }
 
+bool PointCloudRenderer::IsStreaming() const {
+    return use_lod_ && lod_point_shader_.IsStreaming();
+}
+
 bool PointCloudPickingRenderer::Render(const RenderOption &option,
                                        const ViewControl &view) {
     if (!is_visible_ || geometry_ptr_->IsEmpty()) return true;
@@ -298,6 +307,27 @@ bool TriangleMeshRenderer::UpdateGeometry() {
     return true;
 }
 
+bool InstancedTriangleMeshRenderer::Render(const RenderOption &option,
+                                           const ViewControl &view) {
+    if (!is_visible_ || geometry_ptr_->IsEmpty()) return true;
+    return phong_shader_.Render(*geometry_ptr_, option, view);
+}
+
+bool InstancedTriangleMeshRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    if (geometry_ptr->GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedTriangleMesh) {
+        return false;
+    }
+    geometry_ptr_ = geometry_ptr;
+    return UpdateGeometry();
+}
+
+bool InstancedTriangleMeshRenderer::UpdateGeometry() {
+    phong_shader_.InvalidateGeometry();
+    return true;
+}
+
 bool ImageRenderer::Render(const RenderOption &option,
                            const ViewControl &view) {
     if (!is_visible_ || geometry_ptr_->IsEmpty()) return true;
@@ -32,6 +32,7 @@
 #include "Open3D/Visualization/Shader/NormalShader.h"
 #include "Open3D/Visualization/Shader/PhongShader.h"
 #include "Open3D/Visualization/Shader/PickingShader.h"
+#include "Open3D/Visualization/Shader/PointCloudLODShader.h"
 #include "Open3D/Visualization/Shader/RGBDImageShader.h"
 #include "Open3D/Visualization/Shader/Simple2DShader.h"
 #include "Open3D/Visualization/Shader/SimpleBlackShader.h"
@@ -65,6 +66,10 @@ public:
     /// Programmer must call this function to notify a change of the geometry
     virtual bool UpdateGeometry() = 0;
 
+    /// Function to check whether the last Render() left data to be streamed
+    /// in, i.e. whether another frame should be drawn without user input.
+    virtual bool IsStreaming() const { return false; }
+
     bool HasGeometry() const { return bool(geometry_ptr_); }
     std::shared_ptr<const geometry::Geometry> GetGeometry() const {
         return geometry_ptr_;
@@ -92,12 +97,15 @@ public:
     bool AddGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
     bool UpdateGeometry() override;
+    bool IsStreaming() const override;
 
 protected:
     SimpleShaderForPointCloud simple_point_shader_;
     PhongShaderForPointCloud phong_point_shader_;
     NormalShaderForPointCloud normal_point_shader_;
     SimpleBlackShaderForPointCloudNormal simpleblack_normal_shader_;
+    PointCloudLODShader lod_point_shader_;
+    bool use_lod_ = false;
 };
 
 class PointCloudPickingRenderer : public GeometryRenderer {
@@ -190,6 +198,23 @@ protected:
     SimpleBlackShaderForTriangleMeshWireFrame simpleblack_wireframe_shader_;
 };
 
+/// Draws all instances of a geometry::InstancedTriangleMesh with a single
+/// instanced draw call. The mesh is uploaded once and every instance only
+/// adds a transform and a color to the GPU buffers.
+class InstancedTriangleMeshRenderer : public GeometryRenderer {
+public:
+    ~InstancedTriangleMeshRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool UpdateGeometry() override;
+
+protected:
+    PhongShaderForInstancedTriangleMesh phong_shader_;
+};
+
 class VoxelGridRenderer : public GeometryRenderer {
 public:
     ~VoxelGridRenderer() override {}
@@ -39,9 +39,7 @@ public:
     ~ImageMaskShader() override { Release(); }
 
 protected:
-    ImageMaskShader(const std::string &name) : ShaderWrapper(name) {
-        Compile();
-    }
+    ImageMaskShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
@@ -57,31 +57,29 @@ void NormalShader::Release() {
 bool NormalShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // Buffers survive InvalidateGeometry(). On a rebind the allocated storage
+    // is reused and only the vertex ranges that changed since the last upload
+    // are sent to the GPU.
 
     // Prepare data to be passed to GPU
-    std::vector<Eigen::Vector3f> points;
-    std::vector<Eigen::Vector3f> normals;
-    if (!PrepareBinding(geometry, option, view, points, normals)) {
+    staging_points_.clear();
+    staging_normals_.clear();
+    if (!PrepareBinding(geometry, option, view, staging_points_,
+                        staging_normals_)) {
         PrintShaderWarning("Binding failed when preparing data.");
+        UnbindGeometry();
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
+    // Create buffers on first use and upload the geometry
+    if (!bound_) {
+        glGenBuffers(1, &vertex_position_buffer_);
+        glGenBuffers(1, &vertex_normal_buffer_);
+    }
+    UploadArrayBuffer(vertex_position_buffer_, staging_points_,
+                      uploaded_points_);
+    UploadArrayBuffer(vertex_normal_buffer_, staging_normals_,
+                      uploaded_normals_);
     bound_ = true;
     return true;
 }
@@ -113,6 +111,8 @@ void NormalShader::UnbindGeometry() {
     if (bound_) {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_normal_buffer_);
+        uploaded_points_.clear();
+        uploaded_normals_.clear();
         bound_ = false;
     }
 }
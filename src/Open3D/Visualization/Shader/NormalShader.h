@@ -41,7 +41,7 @@ public:
     ~NormalShader() override { Release(); }
 
 protected:
-    NormalShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    NormalShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
@@ -72,6 +72,14 @@ protected:
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
+
+    // Staging vectors filled by PrepareBinding() and mirrors of the GPU
+    // buffers. Both are kept across rebinds so that only changed ranges are
+    // uploaded and no reallocation happens while the size is stable.
+    std::vector<Eigen::Vector3f> staging_points_;
+    std::vector<Eigen::Vector3f> staging_normals_;
+    std::vector<Eigen::Vector3f> uploaded_points_;
+    std::vector<Eigen::Vector3f> uploaded_normals_;
 };
 
 class NormalShaderForPointCloud : public NormalShader {
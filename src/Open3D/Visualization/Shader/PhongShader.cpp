@@ -26,6 +26,7 @@
 
 #include "Open3D/Visualization/Shader/PhongShader.h"
 
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Shader/Shader.h"
@@ -36,8 +37,86 @@ namespace visualization {
 
 namespace glsl {
 
+namespace {
+
+void SetTriangleMeshRenderState(const RenderOption &option) {
+    if (option.mesh_show_back_face_) {
+        glDisable(GL_CULL_FACE);
+    } else {
+        glEnable(GL_CULL_FACE);
+    }
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    if (option.mesh_show_wireframe_) {
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(1.0, 1.0);
+    } else {
+        glDisable(GL_POLYGON_OFFSET_FILL);
+    }
+}
+
+void PrepareTriangleMeshBinding(const geometry::TriangleMesh &mesh,
+                                const RenderOption &option,
+                                const ViewControl &view,
+                                std::vector<Eigen::Vector3f> &points,
+                                std::vector<Eigen::Vector3f> &normals,
+                                std::vector<Eigen::Vector3f> &colors) {
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    points.resize(mesh.triangles_.size() * 3);
+    normals.resize(mesh.triangles_.size() * 3);
+    colors.resize(mesh.triangles_.size() * 3);
+
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const auto &triangle = mesh.triangles_[i];
+        for (size_t j = 0; j < 3; j++) {
+            size_t idx = i * 3 + j;
+            size_t vi = triangle(j);
+            const auto &vertex = mesh.vertices_[vi];
+            points[idx] = vertex.cast<float>();
+
+            Eigen::Vector3d color;
+            switch (option.mesh_color_option_) {
+                case RenderOption::MeshColorOption::XCoordinate:
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetXPercentage(vertex(0)));
+                    break;
+                case RenderOption::MeshColorOption::YCoordinate:
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetYPercentage(vertex(1)));
+                    break;
+                case RenderOption::MeshColorOption::ZCoordinate:
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetZPercentage(vertex(2)));
+                    break;
+                case RenderOption::MeshColorOption::Color:
+                    if (mesh.HasVertexColors()) {
+                        color = mesh.vertex_colors_[vi];
+                        break;
+                    }
+                case RenderOption::MeshColorOption::Default:
+                default:
+                    color = option.default_mesh_color_;
+                    break;
+            }
+            colors[idx] = color.cast<float>();
+
+            if (option.mesh_shade_option_ ==
+                RenderOption::MeshShadeOption::FlatShade) {
+                normals[idx] = mesh.triangle_normals_[i].cast<float>();
+            } else {
+                normals[idx] = mesh.vertex_normals_[vi].cast<float>();
+            }
+        }
+    }
+}
+
+}  // unnamed namespace
+
 bool PhongShader::Compile() {
-    if (!CompileShaders(PhongVertexShader, NULL, PhongFragmentShader)) {
+    if (!CompileShaders(instanced_ ? InstancedPhongVertexShader
+                                   : PhongVertexShader,
+                        NULL, PhongFragmentShader)) {
         PrintShaderWarning("Compiling shaders failed.");
         return false;
     }
@@ -57,6 +136,13 @@ bool PhongShader::Compile() {
     light_specular_shininess_ =
             glGetUniformLocation(program_, "light_specular_shininess_4");
     light_ambient_ = glGetUniformLocation(program_, "light_ambient");
+    if (instanced_) {
+        instance_transform_ =
+                glGetAttribLocation(program_, "instance_transform");
+        instance_color_ = glGetAttribLocation(program_, "instance_color");
+        use_instance_color_ =
+                glGetUniformLocation(program_, "use_instance_color");
+    }
     return true;
 }
 
@@ -68,37 +154,55 @@ void PhongShader::Release() {
 bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
                                const RenderOption &option,
                                const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // Buffers survive InvalidateGeometry(). On a rebind the allocated storage
+    // is reused and only the vertex ranges that changed since the last upload
+    // are sent to the GPU.
 
     // Prepare data to be passed to GPU
-    std::vector<Eigen::Vector3f> points;
-    std::vector<Eigen::Vector3f> normals;
-    std::vector<Eigen::Vector3f> colors;
-    if (PrepareBinding(geometry, option, view, points, normals, colors) ==
-        false) {
+    staging_points_.clear();
+    staging_normals_.clear();
+    staging_colors_.clear();
+    if (!PrepareBinding(geometry, option, view, staging_points_,
+                        staging_normals_, staging_colors_)) {
         PrintShaderWarning("Binding failed when preparing data.");
+        UnbindGeometry();
         return false;
     }
+    if (instanced_) {
+        staging_instance_transforms_.clear();
+        staging_instance_colors_.clear();
+        if (!PrepareInstanceBinding(geometry, staging_instance_transforms_,
+                                    staging_instance_colors_)) {
+            PrintShaderWarning("Binding failed when preparing instances.");
+            UnbindGeometry();
+            return false;
+        }
+        instance_count_ = GLsizei(staging_instance_transforms_.size());
+        use_instance_colors_ = !staging_instance_colors_.empty();
+    }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Create buffers on first use and upload the geometry
+    if (!bound_) {
+        glGenBuffers(1, &vertex_position_buffer_);
+        glGenBuffers(1, &vertex_normal_buffer_);
+        glGenBuffers(1, &vertex_color_buffer_);
+        if (instanced_) {
+            glGenBuffers(1, &instance_transform_buffer_);
+            glGenBuffers(1, &instance_color_buffer_);
+        }
+    }
+    UploadArrayBuffer(vertex_position_buffer_, staging_points_,
+                      uploaded_points_);
+    UploadArrayBuffer(vertex_normal_buffer_, staging_normals_,
+                      uploaded_normals_);
+    UploadArrayBuffer(vertex_color_buffer_, staging_colors_, uploaded_colors_);
+    if (instanced_) {
+        UploadArrayBuffer(instance_transform_buffer_,
+                          staging_instance_transforms_,
+                          uploaded_instance_transforms_);
+        UploadArrayBuffer(instance_color_buffer_, staging_instance_colors_,
+                          uploaded_instance_colors_);
+    }
     bound_ = true;
     return true;
 }
@@ -131,7 +235,39 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glEnableVertexAttribArray(vertex_color_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    if (!instanced_) {
+        glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    } else {
+        // A mat4 attribute takes four consecutive locations, one per column.
+        glBindBuffer(GL_ARRAY_BUFFER, instance_transform_buffer_);
+        for (GLuint i = 0; i < 4; i++) {
+            glEnableVertexAttribArray(instance_transform_ + i);
+            glVertexAttribPointer(
+                    instance_transform_ + i, 4, GL_FLOAT, GL_FALSE,
+                    sizeof(InstanceTransform),
+                    reinterpret_cast<const GLvoid *>(sizeof(GLfloat) * 4 * i));
+            glVertexAttribDivisor(instance_transform_ + i, 1);
+        }
+        glUniform1i(use_instance_color_, use_instance_colors_ ? 1 : 0);
+        if (use_instance_colors_) {
+            glEnableVertexAttribArray(instance_color_);
+            glBindBuffer(GL_ARRAY_BUFFER, instance_color_buffer_);
+            glVertexAttribPointer(instance_color_, 3, GL_FLOAT, GL_FALSE, 0,
+                                  NULL);
+            glVertexAttribDivisor(instance_color_, 1);
+        }
+        glDrawArraysInstanced(draw_arrays_mode_, 0, draw_arrays_size_,
+                              instance_count_);
+        // The divisors are part of the shared vertex array state.
+        for (GLuint i = 0; i < 4; i++) {
+            glVertexAttribDivisor(instance_transform_ + i, 0);
+            glDisableVertexAttribArray(instance_transform_ + i);
+        }
+        if (use_instance_colors_) {
+            glVertexAttribDivisor(instance_color_, 0);
+            glDisableVertexAttribArray(instance_color_);
+        }
+    }
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_normal_);
     glDisableVertexAttribArray(vertex_color_);
@@ -143,6 +279,15 @@ void PhongShader::UnbindGeometry() {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_normal_buffer_);
         glDeleteBuffers(1, &vertex_color_buffer_);
+        uploaded_points_.clear();
+        uploaded_normals_.clear();
+        uploaded_colors_.clear();
+        if (instanced_) {
+            glDeleteBuffers(1, &instance_transform_buffer_);
+            glDeleteBuffers(1, &instance_color_buffer_);
+            uploaded_instance_transforms_.clear();
+            uploaded_instance_colors_.clear();
+        }
         bound_ = false;
     }
 }
@@ -274,20 +419,7 @@ bool PhongShaderForTriangleMesh::PrepareRendering(
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
-    if (option.mesh_show_back_face_) {
-        glDisable(GL_CULL_FACE);
-    } else {
-        glEnable(GL_CULL_FACE);
-    }
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    if (option.mesh_show_wireframe_) {
-        glEnable(GL_POLYGON_OFFSET_FILL);
-        glPolygonOffset(1.0, 1.0);
-    } else {
-        glDisable(GL_POLYGON_OFFSET_FILL);
-    }
+    SetTriangleMeshRenderState(option);
     SetLighting(view, option);
     return true;
 }
@@ -317,58 +449,80 @@ bool PhongShaderForTriangleMesh::PrepareBinding(
         PrintShaderWarning("Call ComputeVertexNormals() before binding.");
         return false;
     }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.resize(mesh.triangles_.size() * 3);
-    normals.resize(mesh.triangles_.size() * 3);
-    colors.resize(mesh.triangles_.size() * 3);
-
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
+    PrepareTriangleMeshBinding(mesh, option, view, points, normals, colors);
+    draw_arrays_mode_ = GL_TRIANGLES;
+    draw_arrays_size_ = GLsizei(points.size());
+    return true;
+}
 
-            Eigen::Vector3d color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    if (mesh.HasVertexColors()) {
-                        color = mesh.vertex_colors_[vi];
-                        break;
-                    }
-                case RenderOption::MeshColorOption::Default:
-                default:
-                    color = option.default_mesh_color_;
-                    break;
-            }
-            colors[idx] = color.cast<float>();
+bool PhongShaderForInstancedTriangleMesh::PrepareRendering(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedTriangleMesh) {
+        PrintShaderWarning(
+                "Rendering type is not geometry::InstancedTriangleMesh.");
+        return false;
+    }
+    SetTriangleMeshRenderState(option);
+    SetLighting(view, option);
+    return true;
+}
 
-            if (option.mesh_shade_option_ ==
-                RenderOption::MeshShadeOption::FlatShade) {
-                normals[idx] = mesh.triangle_normals_[i].cast<float>();
-            } else {
-                normals[idx] = mesh.vertex_normals_[vi].cast<float>();
-            }
-        }
+bool PhongShaderForInstancedTriangleMesh::PrepareBinding(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedTriangleMesh) {
+        PrintShaderWarning(
+                "Rendering type is not geometry::InstancedTriangleMesh.");
+        return false;
     }
+    const geometry::InstancedTriangleMesh &instances =
+            (const geometry::InstancedTriangleMesh &)geometry;
+    if (!instances.HasInstances()) {
+        PrintShaderWarning("Binding failed with empty instanced mesh.");
+        return false;
+    }
+    // The shared mesh is usually small, shade it without requiring the
+    // caller to compute normals.
+    const geometry::TriangleMesh *mesh = instances.mesh_.get();
+    geometry::TriangleMesh mesh_with_normals;
+    if (!mesh->HasTriangleNormals() || !mesh->HasVertexNormals()) {
+        mesh_with_normals = *mesh;
+        mesh_with_normals.ComputeVertexNormals();
+        mesh = &mesh_with_normals;
+    }
+    PrepareTriangleMeshBinding(*mesh, option, view, points, normals, colors);
     draw_arrays_mode_ = GL_TRIANGLES;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
 }
 
+bool PhongShaderForInstancedTriangleMesh::PrepareInstanceBinding(
+        const geometry::Geometry &geometry,
+        std::vector<InstanceTransform> &transforms,
+        std::vector<Eigen::Vector3f> &colors) {
+    const geometry::InstancedTriangleMesh &instances =
+            (const geometry::InstancedTriangleMesh &)geometry;
+    transforms.resize(instances.instance_transforms_.size());
+    for (size_t i = 0; i < transforms.size(); i++) {
+        transforms[i] = instances.instance_transforms_[i].cast<GLfloat>();
+    }
+    if (instances.HasInstanceColors()) {
+        colors.resize(instances.instance_colors_.size());
+        for (size_t i = 0; i < colors.size(); i++) {
+            colors[i] = instances.instance_colors_[i].cast<float>();
+        }
+    }
+    return true;
+}
+
 }  // namespace glsl
 
 }  // namespace visualization
@@ -41,7 +41,10 @@ public:
     ~PhongShader() override { Release(); }
 
 protected:
-    PhongShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    /// \p instanced selects the vertex shader that places the geometry once
+    /// for every transform filled in by PrepareInstanceBinding().
+    PhongShader(const std::string &name, bool instanced = false)
+        : ShaderWrapper(name), instanced_(instanced) {}
 
 protected:
     bool Compile() final;
@@ -65,6 +68,19 @@ protected:
                                 std::vector<Eigen::Vector3f> &normals,
                                 std::vector<Eigen::Vector3f> &colors) = 0;
 
+    /// Unaligned so that it can be stored in std::vector and uploaded as is.
+    using InstanceTransform = Eigen::Matrix<GLfloat, 4, 4, Eigen::DontAlign>;
+
+    /// Fills the transform of every instance, and the color of every instance
+    /// or nothing to keep the vertex colors. Called for instanced shaders
+    /// only.
+    virtual bool PrepareInstanceBinding(
+            const geometry::Geometry &geometry,
+            std::vector<InstanceTransform> &transforms,
+            std::vector<Eigen::Vector3f> &colors) {
+        return false;
+    }
+
 protected:
     void SetLighting(const ViewControl &view, const RenderOption &option);
 
@@ -84,6 +100,14 @@ protected:
     GLuint light_specular_power_;
     GLuint light_specular_shininess_;
     GLuint light_ambient_;
+    GLuint instance_transform_;
+    GLuint instance_transform_buffer_;
+    GLuint instance_color_;
+    GLuint instance_color_buffer_;
+    GLuint use_instance_color_;
+    const bool instanced_;
+    GLsizei instance_count_ = 0;
+    bool use_instance_colors_ = false;
 
     // At most support 4 lights
     GLHelper::GLMatrix4f light_position_world_data_;
@@ -92,6 +116,20 @@ protected:
     GLHelper::GLVector4f light_specular_power_data_;
     GLHelper::GLVector4f light_specular_shininess_data_;
     GLHelper::GLVector4f light_ambient_data_;
+
+    // Staging vectors filled by PrepareBinding() and mirrors of the GPU
+    // buffers. Both are kept across rebinds so that only changed ranges are
+    // uploaded and no reallocation happens while the size is stable.
+    std::vector<Eigen::Vector3f> staging_points_;
+    std::vector<Eigen::Vector3f> staging_normals_;
+    std::vector<Eigen::Vector3f> staging_colors_;
+    std::vector<Eigen::Vector3f> uploaded_points_;
+    std::vector<Eigen::Vector3f> uploaded_normals_;
+    std::vector<Eigen::Vector3f> uploaded_colors_;
+    std::vector<InstanceTransform> staging_instance_transforms_;
+    std::vector<Eigen::Vector3f> staging_instance_colors_;
+    std::vector<InstanceTransform> uploaded_instance_transforms_;
+    std::vector<Eigen::Vector3f> uploaded_instance_colors_;
 };
 
 class PhongShaderForPointCloud : public PhongShader {
@@ -126,6 +164,26 @@ protected:
                         std::vector<Eigen::Vector3f> &colors) final;
 };
 
+class PhongShaderForInstancedTriangleMesh : public PhongShader {
+public:
+    PhongShaderForInstancedTriangleMesh()
+        : PhongShader("PhongShaderForInstancedTriangleMesh", true) {}
+
+protected:
+    bool PrepareRendering(const geometry::Geometry &geometry,
+                          const RenderOption &option,
+                          const ViewControl &view) final;
+    bool PrepareBinding(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view,
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &normals,
+                        std::vector<Eigen::Vector3f> &colors) final;
+    bool PrepareInstanceBinding(const geometry::Geometry &geometry,
+                                std::vector<InstanceTransform> &transforms,
+                                std::vector<Eigen::Vector3f> &colors) final;
+};
+
 }  // namespace glsl
 
 }  // namespace visualization
@@ -41,7 +41,7 @@ public:
     ~PickingShader() override { Release(); }
 
 protected:
-    PickingShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    PickingShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
@@ -0,0 +1,245 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/PointCloudLODShader.h"
+
+#include <algorithm>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Visualization/Shader/Shader.h"
+#include "Open3D/Visualization/Utility/ColorMap.h"
+#include "Open3D/Visualization/Utility/PointCloudLOD.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+// At most 1/kUploadBudgetDivisor of the point budget is uploaded per frame,
+// so that a new view shows the coarse levels at once and refines over the
+// following frames instead of stalling on one large upload.
+static const size_t kUploadBudgetDivisor = 4;
+
+// Nodes are evicted once the buffers hold more than this many times the
+// point budget.
+static const size_t kResidentBudgetFactor = 2;
+
+bool PointCloudLODShader::Compile() {
+    if (!CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader)) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void PointCloudLODShader::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool PointCloudLODShader::BindGeometry(const geometry::Geometry &geometry,
+                                       const RenderOption &option,
+                                       const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    if (!pointcloud.HasPoints()) {
+        PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+
+    // Node contents are stale after any change, but the hierarchy is only
+    // rebuilt when the number of points changed.
+    ReleaseNodes();
+    if (!lod_ || lod_->NumPoints() != pointcloud.points_.size()) {
+        lod_ = PointCloudLOD::CreateFromPointCloud(pointcloud);
+    } else {
+        lod_->UpdateBounds(pointcloud.points_);
+    }
+    bound_ = true;
+    return true;
+}
+
+bool PointCloudLODShader::RenderGeometry(const geometry::Geometry &geometry,
+                                         const RenderOption &option,
+                                         const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    glPointSize(GLfloat(option.point_size_));
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+
+    // Refine until the point spacing on screen is below the point size.
+    const GLHelper::GLMatrix4f mvp = view.GetMVPMatrix();
+    const float pixels_per_unit = view.GetProjectionMatrix()(1, 1) *
+                                  float(view.GetWindowHeight()) * 0.5f;
+    const size_t point_budget = std::max(option.point_budget_, size_t(1));
+    const std::vector<int> selected = lod_->SelectNodes(
+            mvp, pixels_per_unit, float(option.point_size_), point_budget);
+
+    frame_++;
+    is_streaming_ = false;
+    size_t uploaded_points = 0;
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, mvp.data());
+    glEnableVertexAttribArray(vertex_position_);
+    glEnableVertexAttribArray(vertex_color_);
+    for (int node_index : selected) {
+        auto it = resident_nodes_.find(node_index);
+        if (it == resident_nodes_.end()) {
+            if (uploaded_points > 0 &&
+                uploaded_points >= point_budget / kUploadBudgetDivisor) {
+                is_streaming_ = true;
+                continue;
+            }
+            it = resident_nodes_.emplace(node_index, ResidentNode()).first;
+            UploadNode(geometry, option, view, node_index, it->second);
+            uploaded_points += lod_->nodes_[node_index].count_;
+        }
+        it->second.last_used_frame_ = frame_;
+        glBindBuffer(GL_ARRAY_BUFFER, it->second.position_buffer_);
+        glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glBindBuffer(GL_ARRAY_BUFFER, it->second.color_buffer_);
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glDrawArrays(GL_POINTS, 0, GLsizei(lod_->nodes_[node_index].count_));
+    }
+    glDisableVertexAttribArray(vertex_position_);
+    glDisableVertexAttribArray(vertex_color_);
+
+    EvictNodes(point_budget * kResidentBudgetFactor);
+    return true;
+}
+
+void PointCloudLODShader::UnbindGeometry() {
+    if (bound_) {
+        ReleaseNodes();
+        bound_ = false;
+    }
+}
+
+void PointCloudLODShader::UploadNode(const geometry::Geometry &geometry,
+                                     const RenderOption &option,
+                                     const ViewControl &view,
+                                     int node_index,
+                                     ResidentNode &resident) {
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    const PointCloudLOD::Node &node = lod_->nodes_[node_index];
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    staging_points_.resize(node.count_);
+    staging_colors_.resize(node.count_);
+    for (size_t i = 0; i < node.count_; i++) {
+        const size_t idx = lod_->order_[node.begin_ + i];
+        const auto &point = pointcloud.points_[idx];
+        staging_points_[i] = point.cast<float>();
+        Eigen::Vector3d color;
+        switch (option.point_color_option_) {
+            case RenderOption::PointColorOption::XCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(point(0)));
+                break;
+            case RenderOption::PointColorOption::YCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(point(1)));
+                break;
+            case RenderOption::PointColorOption::ZCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(point(2)));
+                break;
+            case RenderOption::PointColorOption::Color:
+            case RenderOption::PointColorOption::Default:
+            default:
+                if (pointcloud.HasColors()) {
+                    color = pointcloud.colors_[idx];
+                } else {
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetZPercentage(point(2)));
+                }
+                break;
+        }
+        staging_colors_[i] = color.cast<float>();
+    }
+
+    glGenBuffers(1, &resident.position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, resident.position_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, node.count_ * sizeof(Eigen::Vector3f),
+                 staging_points_.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &resident.color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, resident.color_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, node.count_ * sizeof(Eigen::Vector3f),
+                 staging_colors_.data(), GL_STATIC_DRAW);
+    resident_points_ += node.count_;
+}
+
+void PointCloudLODShader::EvictNodes(size_t max_resident_points) {
+    if (resident_points_ <= max_resident_points) {
+        return;
+    }
+    // Least recently drawn first; nodes drawn this frame are kept.
+    std::vector<std::pair<size_t, int>> candidates;
+    for (const auto &resident : resident_nodes_) {
+        if (resident.second.last_used_frame_ != frame_) {
+            candidates.emplace_back(resident.second.last_used_frame_,
+                                    resident.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto &candidate : candidates) {
+        if (resident_points_ <= max_resident_points) {
+            break;
+        }
+        ResidentNode &resident = resident_nodes_[candidate.second];
+        glDeleteBuffers(1, &resident.position_buffer_);
+        glDeleteBuffers(1, &resident.color_buffer_);
+        resident_points_ -= lod_->nodes_[candidate.second].count_;
+        resident_nodes_.erase(candidate.second);
+    }
+}
+
+void PointCloudLODShader::ReleaseNodes() {
+    for (auto &resident : resident_nodes_) {
+        glDeleteBuffers(1, &resident.second.position_buffer_);
+        glDeleteBuffers(1, &resident.second.color_buffer_);
+    }
+    resident_nodes_.clear();
+    resident_points_ = 0;
+    is_streaming_ = false;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
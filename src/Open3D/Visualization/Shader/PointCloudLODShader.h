@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Visualization/Shader/ShaderWrapper.h"
+
+namespace open3d {
+namespace visualization {
+
+class PointCloudLOD;
+
+namespace glsl {
+
+/// Shader for point clouds too large to draw every frame. The cloud is
+/// organized in a PointCloudLOD octree when bound; every frame the nodes that
+/// matter most for the current view are selected within
+/// RenderOption::point_budget_ and drawn from per-node buffers. Nodes missing
+/// on the GPU are uploaded coarse to fine over the next frames, and nodes
+/// that were not drawn recently are evicted.
+class PointCloudLODShader : public ShaderWrapper {
+public:
+    PointCloudLODShader() : ShaderWrapper("PointCloudLODShader") {}
+    ~PointCloudLODShader() override { Release(); }
+
+public:
+    /// Returns true if nodes selected in the last frame are still waiting to
+    /// be uploaded, i.e. another frame should be drawn.
+    bool IsStreaming() const { return is_streaming_; }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    struct ResidentNode {
+        GLuint position_buffer_;
+        GLuint color_buffer_;
+        size_t last_used_frame_;
+    };
+
+    void UploadNode(const geometry::Geometry &geometry,
+                    const RenderOption &option,
+                    const ViewControl &view,
+                    int node_index,
+                    ResidentNode &resident);
+    void EvictNodes(size_t max_resident_points);
+    void ReleaseNodes();
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_color_;
+    GLuint MVP_;
+
+    std::shared_ptr<PointCloudLOD> lod_;
+    std::unordered_map<int, ResidentNode> resident_nodes_;
+    size_t resident_points_ = 0;
+    size_t frame_ = 0;
+    bool is_streaming_ = false;
+    std::vector<Eigen::Vector3f> staging_points_;
+    std::vector<Eigen::Vector3f> staging_colors_;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
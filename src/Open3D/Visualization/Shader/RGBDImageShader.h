@@ -41,9 +41,7 @@ public:
     ~RGBDImageShader() override { Release(); }
 
 protected:
-    RGBDImageShader(const std::string &name) : ShaderWrapper(name) {
-        Compile();
-    }
+    RGBDImageShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
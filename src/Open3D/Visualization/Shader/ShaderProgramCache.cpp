@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/ShaderProgramCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <random>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+namespace {
+
+const char kFileMagic[4] = {'O', '3', 'D', 'P'};
+
+std::string GetGLString(GLenum name) {
+    const GLubyte *str = glGetString(name);
+    return str != nullptr ? reinterpret_cast<const char *>(str) : "";
+}
+
+}  // unnamed namespace
+
+ShaderProgramCache &ShaderProgramCache::GetInstance() {
+    static ShaderProgramCache instance;
+    return instance;
+}
+
+ShaderProgramCache::ShaderProgramCache() {
+    if (const char *directory = std::getenv("OPEN3D_SHADER_CACHE_DIR")) {
+        directory_ = directory;
+    }
+}
+
+void ShaderProgramCache::SetCacheDirectory(const std::string &directory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    directory_ = directory;
+}
+
+std::string ShaderProgramCache::MakeKey(
+        const char *const vertex_shader_code,
+        const char *const geometry_shader_code,
+        const char *const fragment_shader_code) {
+    std::string text = GetGLString(GL_VENDOR) + '\n' +
+                       GetGLString(GL_RENDERER) + '\n' +
+                       GetGLString(GL_VERSION) + '\n';
+    for (const char *code :
+         {vertex_shader_code, geometry_shader_code, fragment_shader_code}) {
+        text += code != nullptr ? code : "";
+        text += '\0';
+    }
+    return fmt::format("{:016x}{:08x}", std::hash<std::string>()(text),
+                       text.size());
+}
+
+bool ShaderProgramCache::IsSupported() {
+    if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary) {
+        return false;
+    }
+    GLint num_formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    return num_formats > 0;
+}
+
+bool ShaderProgramCache::Load(GLuint program, const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = binaries_.find(key);
+    if (it == binaries_.end()) {
+        ProgramBinary binary;
+        if (!ReadFile(key, binary)) {
+            return false;
+        }
+        it = binaries_.emplace(key, std::move(binary)).first;
+    }
+
+    const ProgramBinary &binary = it->second;
+    glProgramBinary(program, binary.format, binary.data.data(),
+                    GLsizei(binary.data.size()));
+    GLint result = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &result);
+    if (result == GL_FALSE) {
+        // The driver was updated without changing its version string, or the
+        // file is corrupt. Clear the error raised by glProgramBinary and
+        // forget the binary, it is replaced once the program is relinked.
+        while (glGetError() != GL_NO_ERROR) {
+        }
+        binaries_.erase(it);
+        if (!directory_.empty()) {
+            utility::filesystem::RemoveFile(GetFilename(key));
+        }
+        return false;
+    }
+    return true;
+}
+
+void ShaderProgramCache::Store(GLuint program, const std::string &key) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+    ProgramBinary binary;
+    binary.data.resize(length);
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &binary.format,
+                       binary.data.data());
+    if (written <= 0) {
+        return;
+    }
+    binary.data.resize(written);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    WriteFile(key, binary);
+    binaries_[key] = std::move(binary);
+}
+
+std::string ShaderProgramCache::GetFilename(const std::string &key) const {
+    return utility::filesystem::GetRegularizedDirectoryName(directory_) + key +
+           ".bin";
+}
+
+bool ShaderProgramCache::ReadFile(const std::string &key,
+                                  ProgramBinary &binary) const {
+    if (directory_.empty()) {
+        return false;
+    }
+    std::ifstream file(GetFilename(key), std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    const std::streamoff size = file.tellg();
+    const std::streamoff header_size = sizeof(kFileMagic) + sizeof(GLenum);
+    if (size <= header_size) {
+        return false;
+    }
+    char magic[sizeof(kFileMagic)];
+    file.seekg(0);
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&binary.format), sizeof(GLenum));
+    binary.data.resize(size_t(size - header_size));
+    file.read(binary.data.data(), binary.data.size());
+    return file && std::equal(magic, magic + sizeof(magic), kFileMagic);
+}
+
+void ShaderProgramCache::WriteFile(const std::string &key,
+                                   const ProgramBinary &binary) const {
+    if (directory_.empty()) {
+        return;
+    }
+    if (!utility::filesystem::DirectoryExists(directory_) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory_)) {
+        utility::LogWarning("Cannot create shader cache directory {}.",
+                            directory_);
+        return;
+    }
+    // Write to a unique temporary file first so that processes sharing the
+    // directory never read a partially written binary.
+    const std::string filename = GetFilename(key);
+    const std::string temp_filename =
+            fmt::format("{}.{:08x}", filename, std::random_device()());
+    {
+        std::ofstream file(temp_filename, std::ios::binary);
+        file.write(kFileMagic, sizeof(kFileMagic));
+        file.write(reinterpret_cast<const char *>(&binary.format),
+                   sizeof(GLenum));
+        file.write(binary.data.data(), binary.data.size());
+        if (!file) {
+            file.close();
+            std::remove(temp_filename.c_str());
+            return;
+        }
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+        // rename() does not replace an existing file on Windows.
+        std::remove(filename.c_str());
+        if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+            std::remove(temp_filename.c_str());
+        }
+    }
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
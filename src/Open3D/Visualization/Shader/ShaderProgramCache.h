@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// Cache of linked shader program binaries (glGetProgramBinary), so that a
+/// program only has to be compiled once per driver. Binaries are kept in
+/// memory for the lifetime of the process and, if a cache directory is set,
+/// written to disk so that later processes can reuse them. The directory
+/// defaults to the OPEN3D_SHADER_CACHE_DIR environment variable.
+///
+/// Binaries are keyed by the GL vendor, renderer and version strings and the
+/// shader sources. A binary the driver rejects is dropped and the program is
+/// compiled from source again.
+class ShaderProgramCache {
+public:
+    static ShaderProgramCache &GetInstance();
+
+    ShaderProgramCache(const ShaderProgramCache &) = delete;
+    ShaderProgramCache &operator=(const ShaderProgramCache &) = delete;
+
+public:
+    /// Sets the directory binaries are persisted in. An empty string keeps
+    /// them in memory only.
+    void SetCacheDirectory(const std::string &directory);
+    const std::string &GetCacheDirectory() const { return directory_; }
+
+    /// Returns the cache key of the program made of the given shaders for the
+    /// current context. Null shader codes are allowed.
+    static std::string MakeKey(const char *const vertex_shader_code,
+                               const char *const geometry_shader_code,
+                               const char *const fragment_shader_code);
+
+    /// True if the current context can save and load program binaries.
+    static bool IsSupported();
+
+    /// Loads the binary for \p key into \p program. Returns false if there is
+    /// none or the driver rejected it, the program must then be linked from
+    /// source.
+    bool Load(GLuint program, const std::string &key);
+
+    /// Stores the binary of the linked \p program under \p key. The program
+    /// should have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+    void Store(GLuint program, const std::string &key);
+
+private:
+    struct ProgramBinary {
+        GLenum format = 0;
+        std::vector<char> data;
+    };
+
+    ShaderProgramCache();
+
+    std::string GetFilename(const std::string &key) const;
+    bool ReadFile(const std::string &key, ProgramBinary &binary) const;
+    void WriteFile(const std::string &key, const ProgramBinary &binary) const;
+
+    std::mutex mutex_;
+    std::string directory_;
+    std::unordered_map<std::string, ProgramBinary> binaries_;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
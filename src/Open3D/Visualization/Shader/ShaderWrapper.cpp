@@ -28,6 +28,7 @@
 
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Visualization/Shader/ShaderProgramCache.h"
 
 namespace open3d {
 namespace visualization {
@@ -40,8 +41,9 @@ bool ShaderWrapper::Render(const geometry::Geometry &geometry,
     if (!compiled_) {
         Compile();
     }
-    if (!bound_) {
+    if (!bound_ || geometry_dirty_) {
         BindGeometry(geometry, option, view);
+        geometry_dirty_ = false;
     }
     if (!compiled_ || !bound_) {
         PrintShaderWarning("Something is wrong in compiling or binding.");
@@ -52,7 +54,7 @@ bool ShaderWrapper::Render(const geometry::Geometry &geometry,
 
 void ShaderWrapper::InvalidateGeometry() {
     if (bound_) {
-        UnbindGeometry();
+        geometry_dirty_ = true;
     }
 }
 
@@ -67,6 +69,21 @@ bool ShaderWrapper::CompileShaders(const char *const vertex_shader_code,
         return true;
     }
 
+    // Reuse the program binary linked by an earlier visualizer if possible.
+    auto &cache = ShaderProgramCache::GetInstance();
+    const bool use_cache = ShaderProgramCache::IsSupported();
+    std::string cache_key;
+    if (use_cache) {
+        cache_key = ShaderProgramCache::MakeKey(
+                vertex_shader_code, geometry_shader_code, fragment_shader_code);
+        program_ = glCreateProgram();
+        if (cache.Load(program_, cache_key)) {
+            compiled_ = true;
+            return true;
+        }
+        glDeleteProgram(program_);
+    }
+
     if (vertex_shader_code != NULL) {
         vertex_shader_ = glCreateShader(GL_VERTEX_SHADER);
         const GLchar *vertex_shader_code_buffer = vertex_shader_code;
@@ -107,10 +124,17 @@ bool ShaderWrapper::CompileShaders(const char *const vertex_shader_code,
     if (fragment_shader_code != NULL) {
         glAttachShader(program_, fragment_shader_);
     }
+    if (use_cache) {
+        glProgramParameteri(program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                            GL_TRUE);
+    }
     glLinkProgram(program_);
     if (!ValidateProgram(program_)) {
         return false;
     }
+    if (use_cache) {
+        cache.Store(program_, cache_key);
+    }
 
     // Mark shader objects as deletable.
     // They will be released as soon as program is deleted.
@@ -28,6 +28,10 @@
 
 #include <GL/glew.h>
 
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
@@ -55,8 +59,9 @@ public:
                 const RenderOption &option,
                 const ViewControl &view);
 
-    /// Function to invalidate the geometry (set the dirty flag and release
-    /// geometry resource)
+    /// Function to invalidate the geometry (set the dirty flag)
+    /// GPU buffers are kept alive so that the next Render() can rebind the
+    /// geometry into the already allocated storage.
     void InvalidateGeometry();
 
     const std::string &GetShaderName() const { return shader_name_; }
@@ -65,8 +70,9 @@ public:
 
 protected:
     /// Function to compile shader
-    /// In a derived class, this must be declared as final, and called from
-    /// the constructor.
+    /// In a derived class, this must be declared as final. It is called by
+    /// Render() the first time the shader is used, so shaders of render modes
+    /// that are never shown are not compiled.
     virtual bool Compile() = 0;
 
     /// Function to release resource
@@ -90,6 +96,41 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Function to upload \p data into the array buffer \p buffer.
+    /// \p uploaded mirrors what was last sent to the GPU. If the element
+    /// count is unchanged the existing storage is reused and only the range
+    /// of elements that differ is re-sent with glBufferSubData; otherwise the
+    /// storage is reallocated with glBufferData. On return \p uploaded holds
+    /// the new contents and \p data the previous ones, so both vectors keep
+    /// their capacity across updates.
+    template <typename T>
+    void UploadArrayBuffer(GLuint buffer,
+                           std::vector<T> &data,
+                           std::vector<T> &uploaded) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        if (data.size() != uploaded.size()) {
+            glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(T), data.data(),
+                         GL_STATIC_DRAW);
+        } else {
+            size_t first = 0, last = data.size();
+            while (first < last &&
+                   std::memcmp(&data[first], &uploaded[first], sizeof(T)) ==
+                           0) {
+                first++;
+            }
+            while (last > first &&
+                   std::memcmp(&data[last - 1], &uploaded[last - 1],
+                               sizeof(T)) == 0) {
+                last--;
+            }
+            if (first < last) {
+                glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(T),
+                                (last - first) * sizeof(T), &data[first]);
+            }
+        }
+        std::swap(data, uploaded);
+    }
+
 protected:
     GLuint vertex_shader_;
     GLuint geometry_shader_;
@@ -99,6 +140,7 @@ protected:
     GLsizei draw_arrays_size_ = 0;
     bool compiled_ = false;
     bool bound_ = false;
+    bool geometry_dirty_ = false;
 
     void SetShaderName(const std::string &shader_name) {
         shader_name_ = shader_name;
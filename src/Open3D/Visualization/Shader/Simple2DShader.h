@@ -41,7 +41,7 @@ public:
     ~Simple2DShader() override { Release(); }
 
 protected:
-    Simple2DShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    Simple2DShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
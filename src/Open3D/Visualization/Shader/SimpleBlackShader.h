@@ -41,9 +41,7 @@ public:
     ~SimpleBlackShader() override { Release(); }
 
 protected:
-    SimpleBlackShader(const std::string &name) : ShaderWrapper(name) {
-        Compile();
-    }
+    SimpleBlackShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
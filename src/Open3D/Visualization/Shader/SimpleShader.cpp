@@ -86,31 +86,28 @@ void SimpleShader::Release() {
 bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // Buffers survive InvalidateGeometry(). On a rebind the allocated storage
+    // is reused and only the vertex ranges that changed since the last upload
+    // are sent to the GPU.
 
     // Prepare data to be passed to GPU
-    std::vector<Eigen::Vector3f> points;
-    std::vector<Eigen::Vector3f> colors;
-    if (!PrepareBinding(geometry, option, view, points, colors)) {
+    staging_points_.clear();
+    staging_colors_.clear();
+    if (!PrepareBinding(geometry, option, view, staging_points_,
+                        staging_colors_)) {
         PrintShaderWarning("Binding failed when preparing data.");
+        UnbindGeometry();
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Create buffers on first use and upload the geometry
+    if (!bound_) {
+        glGenBuffers(1, &vertex_position_buffer_);
+        glGenBuffers(1, &vertex_color_buffer_);
+    }
+    UploadArrayBuffer(vertex_position_buffer_, staging_points_,
+                      uploaded_points_);
+    UploadArrayBuffer(vertex_color_buffer_, staging_colors_, uploaded_colors_);
     bound_ = true;
     return true;
 }
@@ -140,6 +137,8 @@ void SimpleShader::UnbindGeometry() {
     if (bound_) {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_color_buffer_);
+        uploaded_points_.clear();
+        uploaded_colors_.clear();
         bound_ = false;
     }
 }
@@ -41,7 +41,7 @@ public:
     ~SimpleShader() override { Release(); }
 
 protected:
-    SimpleShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+    SimpleShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
@@ -70,6 +70,14 @@ protected:
     GLuint vertex_color_;
     GLuint vertex_color_buffer_;
     GLuint MVP_;
+
+    // Staging vectors filled by PrepareBinding() and mirrors of the GPU
+    // buffers. Both are kept across rebinds so that only changed ranges are
+    // uploaded and no reallocation happens while the size is stable.
+    std::vector<Eigen::Vector3f> staging_points_;
+    std::vector<Eigen::Vector3f> staging_colors_;
+    std::vector<Eigen::Vector3f> uploaded_points_;
+    std::vector<Eigen::Vector3f> uploaded_colors_;
 };
 
 class SimpleShaderForPointCloud : public SimpleShader {
@@ -41,9 +41,7 @@ public:
     ~TexturePhongShader() override { Release(); }
 
 protected:
-    TexturePhongShader(const std::string &name) : ShaderWrapper(name) {
-        Compile();
-    }
+    TexturePhongShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
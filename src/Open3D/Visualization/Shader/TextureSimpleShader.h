@@ -41,9 +41,7 @@ public:
     ~TextureSimpleShader() override { Release(); }
 
 protected:
-    TextureSimpleShader(const std::string &name) : ShaderWrapper(name) {
-        Compile();
-    }
+    TextureSimpleShader(const std::string &name) : ShaderWrapper(name) {}
 
 protected:
     bool Compile() final;
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/ImageSequenceWriter.h"
+
+#include <exception>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace visualization {
+
+ImageSequenceWriter::ImageSequenceWriter(int max_queued_images /* = 8*/,
+                                         int num_writer_threads /* = 2*/)
+    : max_queued_images_(max_queued_images) {
+    if (max_queued_images < 1 || num_writer_threads < 1) {
+        utility::LogError(
+                "[ImageSequenceWriter] max_queued_images and "
+                "num_writer_threads must be positive, but got {} and {}.",
+                max_queued_images, num_writer_threads);
+    }
+    for (int i = 0; i < num_writer_threads; i++) {
+        writer_threads_.emplace_back([this]() { WriterLoop(); });
+    }
+}
+
+ImageSequenceWriter::~ImageSequenceWriter() {
+    Finish();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    image_pushed_.notify_all();
+    for (std::thread &thread : writer_threads_) {
+        thread.join();
+    }
+}
+
+void ImageSequenceWriter::Push(const std::string &filename,
+                               const ImageProducer &producer) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        image_done_.wait(lock, [this]() {
+            return num_pushed_images_ - num_done_images_ < max_queued_images_;
+        });
+        tasks_.push_back(Task{filename, producer});
+        num_pushed_images_++;
+    }
+    image_pushed_.notify_one();
+}
+
+void ImageSequenceWriter::Push(const std::string &filename,
+                               const std::shared_ptr<geometry::Image> &image) {
+    Push(filename, [image]() { return image; });
+}
+
+int64_t ImageSequenceWriter::Finish() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    image_done_.wait(lock, [this]() {
+        return num_done_images_ == num_pushed_images_;
+    });
+    int64_t num_failed_images = num_failed_images_;
+    num_failed_images_ = 0;
+    return num_failed_images;
+}
+
+void ImageSequenceWriter::WriterLoop() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            image_pushed_.wait(lock,
+                               [this]() { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        bool success = false;
+        try {
+            auto image = task.producer_();
+            success = image && io::WriteImage(task.filename_, *image);
+        } catch (const std::exception &e) {
+            utility::LogWarning("[ImageSequenceWriter] {}", e.what());
+        }
+        if (!success) {
+            utility::LogWarning("[ImageSequenceWriter] Failed to write {}.",
+                                task.filename_);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_done_images_++;
+            if (!success) {
+                num_failed_images_++;
+            }
+        }
+        image_done_.notify_all();
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
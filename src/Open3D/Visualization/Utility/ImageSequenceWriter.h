@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}  // namespace geometry
+
+namespace visualization {
+
+/// \class ImageSequenceWriter
+///
+/// \brief Writes images to files on background threads, e.g. the frames of a
+/// recorded animation, so that converting and encoding them overlaps with
+/// rendering the next frames.
+///
+/// At most max_queued_images images wait to be written at once; Push() blocks
+/// until there is room, which bounds the memory of captured frames.
+class ImageSequenceWriter {
+public:
+    /// Returns the image to write. Called by a writer thread.
+    typedef std::function<std::shared_ptr<geometry::Image>()> ImageProducer;
+
+    /// \brief Parameterized Constructor. Starts the threads.
+    ///
+    /// \param max_queued_images Maximum number of images pushed but not yet
+    /// written, at least 1.
+    /// \param num_writer_threads Number of threads writing images, at least 1.
+    ImageSequenceWriter(int max_queued_images = 8, int num_writer_threads = 2);
+    /// Waits for the queued images and stops the threads.
+    ~ImageSequenceWriter();
+    ImageSequenceWriter(const ImageSequenceWriter &) = delete;
+    ImageSequenceWriter &operator=(const ImageSequenceWriter &) = delete;
+
+public:
+    /// Queues writing the image returned by \p producer to \p filename,
+    /// blocking while max_queued_images images are queued.
+    void Push(const std::string &filename, const ImageProducer &producer);
+    /// Queues writing \p image to \p filename.
+    void Push(const std::string &filename,
+              const std::shared_ptr<geometry::Image> &image);
+    /// Waits until all pushed images are written. Returns the number of
+    /// images that failed since the last call, which are logged as warnings.
+    int64_t Finish();
+
+private:
+    struct Task {
+        std::string filename_;
+        ImageProducer producer_;
+    };
+
+    void WriterLoop();
+
+private:
+    const int64_t max_queued_images_;
+
+    std::mutex mutex_;
+    /// Signals writer threads: images to write, or stop.
+    std::condition_variable image_pushed_;
+    /// Signals Push() and Finish(): an image was written.
+    std::condition_variable image_done_;
+    std::deque<Task> tasks_;
+    int64_t num_pushed_images_ = 0;
+    int64_t num_done_images_ = 0;
+    int64_t num_failed_images_ = 0;
+    bool stop_ = false;
+
+    std::vector<std::thread> writer_threads_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
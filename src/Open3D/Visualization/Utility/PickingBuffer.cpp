@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/PickingBuffer.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Visualization/Visualizer/ViewControl.h"
+
+namespace open3d {
+namespace visualization {
+
+PickingBuffer::~PickingBuffer() { Release(); }
+
+void PickingBuffer::Release() {
+    if (framebuffer_ != 0) {
+        glDeleteFramebuffers(1, &framebuffer_);
+        glDeleteTextures(1, &color_texture_);
+        glDeleteRenderbuffers(1, &depth_renderbuffer_);
+        framebuffer_ = 0;
+        color_texture_ = 0;
+        depth_renderbuffer_ = 0;
+    }
+    width_ = 0;
+    height_ = 0;
+    is_up_to_date_ = false;
+}
+
+bool PickingBuffer::Bind(const ViewControl &view) {
+    if (!GLEW_ARB_framebuffer_object) {
+        // OpenGL 2.1 doesn't require this, 3.1+ does
+        utility::LogWarning(
+                "[PickingBuffer] Your GPU does not provide framebuffer "
+                "objects.");
+        return false;
+    }
+
+    const int width = view.GetWindowWidth();
+    const int height = view.GetWindowHeight();
+    if (framebuffer_ != 0 && width == width_ && height == height_) {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+        return true;
+    }
+
+    Release();
+    glGenFramebuffers(1, &framebuffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+    glGenTextures(1, &color_texture_);
+    glBindTexture(GL_TEXTURE_2D, color_texture_);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glGenRenderbuffers(1, &depth_renderbuffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_renderbuffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, depth_renderbuffer_);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           color_texture_, 0);
+    GLenum draw_buffers[1] = {GL_COLOR_ATTACHMENT0};
+    glDrawBuffers(1, draw_buffers);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        utility::LogWarning("[PickingBuffer] Something is wrong with FBO.");
+        Release();
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    return true;
+}
+
+void PickingBuffer::Unbind() { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
+
+bool PickingBuffer::IsUpToDate(const ViewControl &view) const {
+    return is_up_to_date_ && view.GetWindowWidth() == width_ &&
+           view.GetWindowHeight() == height_ &&
+           view.GetMVPMatrix() == mvp_matrix_;
+}
+
+void PickingBuffer::SetUpToDate(const ViewControl &view) {
+    mvp_matrix_ = view.GetMVPMatrix();
+    is_up_to_date_ = true;
+}
+
+std::vector<int> PickingBuffer::ReadIndices(int x,
+                                            int y,
+                                            int width,
+                                            int height) const {
+    // Clip the rectangle to the buffer
+    const int x0 = std::max(x, 0);
+    const int y0 = std::max(y, 0);
+    const int x1 = std::min(x + width, width_);
+    const int y1 = std::min(y + height, height_);
+    if (x0 >= x1 || y0 >= y1) {
+        return {};
+    }
+
+    std::vector<uint8_t> rgba(4 * (x1 - x0) * (y1 - y0), 0);
+    glReadPixels(x0, y0, x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 rgba.data());
+
+    std::unordered_set<int> index_set;
+    for (size_t i = 0; i < rgba.size(); i += 4) {
+        int index = GLHelper::ColorCodeToPickIndex(Eigen::Vector4i(
+                rgba[i], rgba[i + 1], rgba[i + 2], rgba[i + 3]));
+        if (index >= 0) {
+            index_set.insert(index);
+        }
+    }
+    return std::vector<int>(index_set.begin(), index_set.end());
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "Open3D/Visualization/Utility/GLHelper.h"
+
+namespace open3d {
+namespace visualization {
+
+class ViewControl;
+
+/// Offscreen framebuffer with the pick color code of every pixel
+/// (see GLHelper::ColorCodeToPickIndex). The buffer is kept between picks and
+/// only has to be redrawn when the view or the geometry changed; picks read
+/// back just the pixels under the cursor or the selection rectangle.
+class PickingBuffer {
+public:
+    PickingBuffer() {}
+    ~PickingBuffer();
+    PickingBuffer(const PickingBuffer &) = delete;
+    PickingBuffer &operator=(const PickingBuffer &) = delete;
+
+public:
+    /// Binds the framebuffer, (re)allocating it for the window size of
+    /// \p view. Returns false if framebuffer objects are not available.
+    bool Bind(const ViewControl &view);
+    /// Binds the default framebuffer again.
+    void Unbind();
+    /// True if the content was drawn with the current matrices and window
+    /// size of \p view and has not been invalidated since.
+    bool IsUpToDate(const ViewControl &view) const;
+    /// Marks the content as drawn for the current state of \p view.
+    void SetUpToDate(const ViewControl &view);
+    /// Marks the content as outdated, e.g. after the geometry changed.
+    void Invalidate() { is_up_to_date_ = false; }
+    /// Returns the distinct pick indices in the rectangle of \p width x
+    /// \p height pixels with lower left corner (\p x, \p y), in OpenGL window
+    /// coordinates. The buffer must be bound.
+    std::vector<int> ReadIndices(int x, int y, int width, int height) const;
+
+private:
+    void Release();
+
+    GLuint framebuffer_ = 0;
+    GLuint color_texture_ = 0;
+    GLuint depth_renderbuffer_ = 0;
+    int width_ = 0;
+    int height_ = 0;
+    bool is_up_to_date_ = false;
+    GLHelper::GLMatrix4f mvp_matrix_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/PixelBufferReader.h"
+
+#include <cstring>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace visualization {
+
+PixelBufferReader::~PixelBufferReader() { Release(); }
+
+void PixelBufferReader::Release() {
+    for (Slot &slot : slots_) {
+        if (slot.buffer_ != 0) {
+            glDeleteBuffers(1, &slot.buffer_);
+        }
+        slot = Slot();
+    }
+    next_slot_ = 0;
+}
+
+void PixelBufferReader::Read(int width,
+                             int height,
+                             GLenum format,
+                             GLenum type,
+                             int num_of_channels,
+                             int bytes_per_channel,
+                             geometry::Image &image) {
+    // Uses the slot of the next ReadAsync(), which is never pending
+    Slot &slot = slots_[next_slot_];
+    StartRead(slot, width, height, format, type, num_of_channels,
+              bytes_per_channel);
+    FinishRead(slot, image);
+}
+
+bool PixelBufferReader::ReadAsync(int width,
+                                  int height,
+                                  GLenum format,
+                                  GLenum type,
+                                  int num_of_channels,
+                                  int bytes_per_channel,
+                                  geometry::Image &previous_image) {
+    StartRead(slots_[next_slot_], width, height, format, type,
+              num_of_channels, bytes_per_channel);
+    next_slot_ = 1 - next_slot_;
+    Slot &previous_slot = slots_[next_slot_];
+    if (previous_slot.is_pending_) {
+        FinishRead(previous_slot, previous_image);
+        return true;
+    }
+    return false;
+}
+
+bool PixelBufferReader::Flush(geometry::Image &image) {
+    // ReadAsync() finishes the older read, so only the last one can be pending
+    Slot &last_slot = slots_[1 - next_slot_];
+    if (last_slot.is_pending_) {
+        FinishRead(last_slot, image);
+        return true;
+    }
+    return false;
+}
+
+void PixelBufferReader::StartRead(Slot &slot,
+                                  int width,
+                                  int height,
+                                  GLenum format,
+                                  GLenum type,
+                                  int num_of_channels,
+                                  int bytes_per_channel) {
+    const size_t size = size_t(width) * height * num_of_channels *
+                        bytes_per_channel;
+    if (slot.buffer_ == 0) {
+        glGenBuffers(1, &slot.buffer_);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer_);
+    if (size > slot.capacity_) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        slot.capacity_ = size;
+    }
+    // With a pack buffer bound, the last argument is an offset into it
+    glReadPixels(0, 0, width, height, format, type, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.width_ = width;
+    slot.height_ = height;
+    slot.num_of_channels_ = num_of_channels;
+    slot.bytes_per_channel_ = bytes_per_channel;
+    slot.is_pending_ = true;
+}
+
+void PixelBufferReader::FinishRead(Slot &slot, geometry::Image &image) {
+    slot.is_pending_ = false;
+    image.Prepare(slot.width_, slot.height_, slot.num_of_channels_,
+                  slot.bytes_per_channel_);
+    const size_t bytes_per_line = image.BytesPerLine();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer_);
+    const uint8_t *data = (const uint8_t *)glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER, 0, bytes_per_line * slot.height_,
+            GL_MAP_READ_BIT);
+    if (data != NULL) {
+        // glReadPixels returns the bottom row first
+        for (int i = 0; i < slot.height_; i++) {
+            memcpy(image.data_.data() + bytes_per_line * i,
+                   data + bytes_per_line * (slot.height_ - i - 1),
+                   bytes_per_line);
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    } else {
+        utility::LogWarning("[PixelBufferReader] Failed to map the buffer.");
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+}  // namespace visualization
+}  // namespace open3d
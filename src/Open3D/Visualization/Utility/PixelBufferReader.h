@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Open3D/Visualization/Utility/GLHelper.h"
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}  // namespace geometry
+
+namespace visualization {
+
+/// \class PixelBufferReader
+///
+/// Reads pixels of the current read buffer back through two pixel buffer
+/// objects (PBOs). ReadAsync() only starts the transfer, which the GPU
+/// performs while the next frame is rendered, and returns the pixels of the
+/// previous ReadAsync() call, whose transfer has finished by then. The rows
+/// are flipped from the bottom-up order of OpenGL to the top-down order of
+/// geometry::Image while copying them out of the mapped buffer.
+///
+/// All functions must be called with the OpenGL context current and
+/// GL_PACK_ALIGNMENT set to 1.
+class PixelBufferReader {
+public:
+    PixelBufferReader() {}
+    ~PixelBufferReader();
+    PixelBufferReader(const PixelBufferReader &) = delete;
+    PixelBufferReader &operator=(const PixelBufferReader &) = delete;
+
+public:
+    /// \brief Reads \p width x \p height pixels from the lower left corner
+    /// and waits for them.
+    ///
+    /// \param format Pixel format, e.g. GL_RGB or GL_DEPTH_COMPONENT.
+    /// \param type Channel type, e.g. GL_UNSIGNED_BYTE or GL_FLOAT.
+    /// \param num_of_channels Number of channels of \p format.
+    /// \param bytes_per_channel Size of \p type.
+    /// \param image Receives the pixels, top row first.
+    void Read(int width,
+              int height,
+              GLenum format,
+              GLenum type,
+              int num_of_channels,
+              int bytes_per_channel,
+              geometry::Image &image);
+    /// \brief Starts reading pixels like Read() without waiting for them.
+    ///
+    /// Returns true and stores the pixels of the previous ReadAsync() call in
+    /// \p previous_image if there is one.
+    bool ReadAsync(int width,
+                   int height,
+                   GLenum format,
+                   GLenum type,
+                   int num_of_channels,
+                   int bytes_per_channel,
+                   geometry::Image &previous_image);
+    /// Stores the pixels of the last ReadAsync() call in \p image and returns
+    /// true, or returns false if they were already returned.
+    bool Flush(geometry::Image &image);
+    /// Deletes the buffers and drops a pending read.
+    void Release();
+
+private:
+    struct Slot {
+        GLuint buffer_ = 0;
+        size_t capacity_ = 0;
+        int width_ = 0;
+        int height_ = 0;
+        int num_of_channels_ = 0;
+        int bytes_per_channel_ = 0;
+        bool is_pending_ = false;
+    };
+
+    void StartRead(Slot &slot,
+                   int width,
+                   int height,
+                   GLenum format,
+                   GLenum type,
+                   int num_of_channels,
+                   int bytes_per_channel);
+    void FinishRead(Slot &slot, geometry::Image &image);
+
+    Slot slots_[2];
+    /// Slot the next ReadAsync() writes to; the other one may be pending.
+    int next_slot_ = 0;
+};
+
+}  // namespace visualization
+}  // namespace open3d
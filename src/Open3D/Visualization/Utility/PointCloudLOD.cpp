@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/PointCloudLOD.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <unordered_set>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+/// Returns true if all corners of the box lie outside one clip plane.
+bool IsOutsideFrustum(const Eigen::Matrix4f& mvp,
+                      const Eigen::Vector3f& min_bound,
+                      const Eigen::Vector3f& max_bound) {
+    int outside[6] = {0, 0, 0, 0, 0, 0};
+    for (int c = 0; c < 8; c++) {
+        const Eigen::Vector4f corner((c & 1) ? max_bound(0) : min_bound(0),
+                                     (c & 2) ? max_bound(1) : min_bound(1),
+                                     (c & 4) ? max_bound(2) : min_bound(2),
+                                     1.0f);
+        const Eigen::Vector4f clip = mvp * corner;
+        for (int axis = 0; axis < 3; axis++) {
+            if (clip(axis) < -clip(3)) outside[2 * axis]++;
+            if (clip(axis) > clip(3)) outside[2 * axis + 1]++;
+        }
+    }
+    return std::any_of(outside, outside + 6, [](int n) { return n == 8; });
+}
+
+/// Projected node spacing in pixels, measured at the point of the bounding
+/// sphere closest to the camera.
+float ScreenSpaceError(const Eigen::Matrix4f& mvp,
+                       const PointCloudLOD::Node& node,
+                       float pixels_per_unit) {
+    const Eigen::Vector3f center = (node.min_bound_ + node.max_bound_) * 0.5f;
+    const float radius = (node.max_bound_ - node.min_bound_).norm() * 0.5f;
+    // Clip-space w is the depth along the view direction for perspective
+    // projections and 1 for orthographic ones.
+    const Eigen::Vector3f w_axis = mvp.block<1, 3>(3, 0).transpose();
+    const float w = w_axis.dot(center) + mvp(3, 3) - radius * w_axis.norm();
+    if (w <= 0.0f) {
+        return std::numeric_limits<float>::max();
+    }
+    return node.spacing_ * pixels_per_unit / w;
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<PointCloudLOD> PointCloudLOD::CreateFromPointCloud(
+        const geometry::PointCloud& pointcloud,
+        int grid_size /* = 128 */,
+        size_t max_leaf_points /* = 20000 */,
+        int max_depth /* = 20 */) {
+    if (grid_size < 1 || grid_size > (1 << 21)) {
+        utility::LogError("[PointCloudLOD] Invalid grid size {}.", grid_size);
+    }
+    auto lod = std::make_shared<PointCloudLOD>();
+    const auto& points = pointcloud.points_;
+    if (points.empty()) {
+        return lod;
+    }
+
+    // Pending node with the range of its points in `work`.
+    struct PendingNode {
+        int node;
+        size_t begin;
+        size_t end;
+        Eigen::Vector3d origin;
+        double size;
+    };
+    auto add_node = [&lod](const Eigen::Vector3d& origin, double size,
+                           double spacing, int depth) {
+        Node node;
+        node.origin_ = origin.cast<float>();
+        node.size_ = float(size);
+        node.spacing_ = float(spacing);
+        node.begin_ = 0;
+        node.count_ = 0;
+        node.depth_ = depth;
+        std::fill(node.children_, node.children_ + 8, -1);
+        lod->nodes_.push_back(node);
+        return int(lod->nodes_.size()) - 1;
+    };
+
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    const double extent = (pointcloud.GetMaxBound() - min_bound).maxCoeff();
+    // Grow the root cube slightly so that points on its upper faces fall
+    // inside the last grid cell.
+    const double root_size = std::max(extent, 1e-12) * (1.0 + 1e-6);
+
+    std::vector<size_t> work(points.size());
+    std::iota(work.begin(), work.end(), 0);
+    lod->order_.reserve(points.size());
+    std::deque<PendingNode> queue;
+    queue.push_back({add_node(min_bound, root_size, root_size / grid_size, 0),
+                     0, points.size(), min_bound, root_size});
+
+    std::unordered_set<uint64_t> occupied;
+    std::vector<size_t> rest;
+    std::vector<uint8_t> rest_octants;
+    while (!queue.empty()) {
+        const PendingNode pending = queue.front();
+        queue.pop_front();
+        const int depth = lod->nodes_[pending.node].depth_;
+        lod->nodes_[pending.node].begin_ = lod->order_.size();
+        if (pending.end - pending.begin <= max_leaf_points ||
+            depth >= max_depth) {
+            lod->order_.insert(lod->order_.end(), work.begin() + pending.begin,
+                               work.begin() + pending.end);
+            lod->nodes_[pending.node].count_ = pending.end - pending.begin;
+            continue;
+        }
+
+        // Keep the first point of every grid cell; the others go down.
+        const double cell_size = pending.size / grid_size;
+        const double half_size = pending.size * 0.5;
+        const Eigen::Vector3d center =
+                pending.origin + Eigen::Vector3d::Constant(half_size);
+        occupied.clear();
+        rest.clear();
+        rest_octants.clear();
+        size_t octant_counts[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        for (size_t i = pending.begin; i < pending.end; i++) {
+            const size_t idx = work[i];
+            const Eigen::Vector3d& point = points[idx];
+            uint64_t key = 0;
+            for (int axis = 0; axis < 3; axis++) {
+                const int cell = std::min(
+                        std::max(int((point(axis) - pending.origin(axis)) /
+                                     cell_size),
+                                 0),
+                        grid_size - 1);
+                key = (key << 21) | uint64_t(cell);
+            }
+            if (occupied.insert(key).second) {
+                lod->order_.push_back(idx);
+            } else {
+                const uint8_t octant = uint8_t((point(0) >= center(0)) |
+                                               (point(1) >= center(1)) << 1 |
+                                               (point(2) >= center(2)) << 2);
+                rest.push_back(idx);
+                rest_octants.push_back(octant);
+                octant_counts[octant]++;
+            }
+        }
+        lod->nodes_[pending.node].count_ =
+                lod->order_.size() - lod->nodes_[pending.node].begin_;
+
+        // Counting sort of the remaining points into the child octants.
+        size_t octant_offsets[8];
+        size_t offset = pending.begin;
+        for (int octant = 0; octant < 8; octant++) {
+            octant_offsets[octant] = offset;
+            offset += octant_counts[octant];
+        }
+        for (size_t i = 0; i < rest.size(); i++) {
+            work[octant_offsets[rest_octants[i]]++] = rest[i];
+        }
+        size_t child_begin = pending.begin;
+        for (int octant = 0; octant < 8; octant++) {
+            if (octant_counts[octant] == 0) {
+                continue;
+            }
+            const Eigen::Vector3d origin =
+                    pending.origin +
+                    half_size * Eigen::Vector3d(octant & 1, (octant >> 1) & 1,
+                                                (octant >> 2) & 1);
+            const int child = add_node(origin, half_size,
+                                       half_size / grid_size, depth + 1);
+            lod->nodes_[pending.node].children_[octant] = child;
+            queue.push_back({child, child_begin,
+                             child_begin + octant_counts[octant], origin,
+                             half_size});
+            child_begin += octant_counts[octant];
+        }
+    }
+    lod->UpdateBounds(points);
+    return lod;
+}
+
+void PointCloudLOD::UpdateBounds(const std::vector<Eigen::Vector3d>& points) {
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < int(nodes_.size()); i++) {
+        Node& node = nodes_[i];
+        Eigen::Vector3d min_bound =
+                Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+        Eigen::Vector3d max_bound = -min_bound;
+        for (size_t k = node.begin_; k < node.begin_ + node.count_; k++) {
+            min_bound = min_bound.cwiseMin(points[order_[k]]);
+            max_bound = max_bound.cwiseMax(points[order_[k]]);
+        }
+        node.min_bound_ = min_bound.cast<float>();
+        node.max_bound_ = max_bound.cast<float>();
+    }
+    // Children always come after their parent in breadth-first order.
+    for (int i = int(nodes_.size()) - 1; i >= 0; i--) {
+        Node& node = nodes_[i];
+        for (int child : node.children_) {
+            if (child >= 0) {
+                node.min_bound_ = node.min_bound_.cwiseMin(
+                        nodes_[child].min_bound_);
+                node.max_bound_ = node.max_bound_.cwiseMax(
+                        nodes_[child].max_bound_);
+            }
+        }
+    }
+}
+
+std::vector<int> PointCloudLOD::SelectNodes(const Eigen::Matrix4f& mvp,
+                                            float pixels_per_unit,
+                                            float max_error,
+                                            size_t point_budget) const {
+    std::vector<int> selected;
+    if (nodes_.empty()) {
+        return selected;
+    }
+    typedef std::pair<float, int> Candidate;
+    std::priority_queue<Candidate> candidates;
+    auto push_candidate = [&](int i) {
+        const Node& node = nodes_[i];
+        if (!IsOutsideFrustum(mvp, node.min_bound_, node.max_bound_)) {
+            candidates.emplace(ScreenSpaceError(mvp, node, pixels_per_unit),
+                               i);
+        }
+    };
+    push_candidate(0);
+    size_t num_points = 0;
+    while (!candidates.empty()) {
+        const Candidate candidate = candidates.top();
+        candidates.pop();
+        const Node& node = nodes_[candidate.second];
+        if (num_points + node.count_ > point_budget) {
+            continue;
+        }
+        selected.push_back(candidate.second);
+        num_points += node.count_;
+        if (candidate.first > max_error) {
+            for (int child : node.children_) {
+                if (child >= 0) {
+                    push_candidate(child);
+                }
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+namespace visualization {
+
+/// \class PointCloudLOD
+///
+/// Multi-resolution octree over a point cloud for level-of-detail rendering.
+/// Every node keeps at most one point per cell of a regular grid laid over
+/// its cube and hands the remaining points on to its children, so a node
+/// drawn together with its ancestors has a roughly uniform density (the
+/// layout used by Potree). Points are referenced through `order_`, where the
+/// points of each node are a contiguous range and nodes follow breadth-first
+/// order: any prefix of `order_` is a coarse-to-fine decimation of the cloud.
+class PointCloudLOD {
+public:
+    struct Node {
+        /// Lower corner of the octree cube of the node.
+        Eigen::Vector3f origin_;
+        /// Edge length of the octree cube.
+        float size_;
+        /// Grid cell size, i.e. the minimum distance between the points the
+        /// node keeps.
+        float spacing_;
+        /// Tight bounds of the points of the node and all its descendants.
+        Eigen::Vector3f min_bound_;
+        Eigen::Vector3f max_bound_;
+        /// Range of the node in `order_`.
+        size_t begin_;
+        size_t count_;
+        int depth_;
+        /// Indices of the child nodes in `nodes_`, -1 for empty octants.
+        int children_[8];
+    };
+
+public:
+    PointCloudLOD() {}
+
+    /// Factory function to build the hierarchy of \p pointcloud.
+    ///
+    /// \param grid_size Number of grid cells along each axis of a node.
+    /// \param max_leaf_points Nodes with at most this many points keep all of
+    /// them and are not subdivided.
+    /// \param max_depth Nodes at this depth keep all of their points.
+    static std::shared_ptr<PointCloudLOD> CreateFromPointCloud(
+            const geometry::PointCloud& pointcloud,
+            int grid_size = 128,
+            size_t max_leaf_points = 20000,
+            int max_depth = 20);
+
+    /// Recomputes the node bounds after the points moved. The assignment of
+    /// points to nodes is kept.
+    void UpdateBounds(const std::vector<Eigen::Vector3d>& points);
+
+    /// Selects the nodes to draw for a view.
+    ///
+    /// Nodes are refined in order of decreasing screen-space error, i.e. the
+    /// projected node spacing in pixels, until the error of every selected
+    /// node is below \p max_error or adding a node would exceed
+    /// \p point_budget. Nodes outside the view frustum are skipped. A node is
+    /// only selected after its parent, so the result is ordered coarse to
+    /// fine.
+    ///
+    /// \param mvp Model-view-projection matrix of the view.
+    /// \param pixels_per_unit Pixels covered by a unit length at clip-space
+    /// w = 1, i.e. projection(1, 1) * window_height / 2.
+    std::vector<int> SelectNodes(const Eigen::Matrix4f& mvp,
+                                 float pixels_per_unit,
+                                 float max_error,
+                                 size_t point_budget) const;
+
+    size_t NumPoints() const { return order_.size(); }
+
+public:
+    std::vector<Node> nodes_;
+    /// Indices into the source point cloud, grouped by node.
+    std::vector<size_t> order_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
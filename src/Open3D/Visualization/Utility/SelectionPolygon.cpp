@@ -29,6 +29,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Visualization/Utility/GLHelper.h"
 #include "Open3D/Visualization/Utility/SelectionPolygonVolume.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
@@ -37,6 +38,39 @@
 namespace open3d {
 namespace visualization {
 
+namespace {
+
+/// Returns the indices of the points in \p input for which \p is_selected,
+/// called in parallel with a projected window coordinate, returns true.
+/// Points that project to infinity are skipped.
+template <typename func_t>
+std::vector<size_t> SelectProjectedPoints(
+        const std::vector<Eigen::Vector3d> &input,
+        const ViewControl &view,
+        func_t is_selected) {
+    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
+    double half_width = (double)view.GetWindowWidth() * 0.5;
+    double half_height = (double)view.GetWindowHeight() * 0.5;
+    std::vector<uint8_t> mask(input.size(), 0);
+    utility::ParallelFor(0, int64_t(input.size()), [&](int64_t k) {
+        const auto &point = input[k];
+        Eigen::Vector4d pos =
+                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
+        if (pos(3) == 0.0) return;
+        pos /= pos(3);
+        double x = (pos(0) + 1.0) * half_width;
+        double y = (pos(1) + 1.0) * half_height;
+        mask[k] = is_selected(x, y) ? 1 : 0;
+    });
+    std::vector<size_t> output_index;
+    for (size_t k = 0; k < mask.size(); k++) {
+        if (mask[k]) output_index.push_back(k);
+    }
+    return output_index;
+}
+
+}  // namespace
+
 SelectionPolygon &SelectionPolygon::Clear() {
     polygon_.clear();
     is_closed_ = false;
@@ -229,67 +263,33 @@ SelectionPolygon::CropTriangleMeshInPolygon(const geometry::TriangleMesh &input,
 
 std::vector<size_t> SelectionPolygon::CropInRectangle(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
     auto min_bound = GetMinBound();
     auto max_bound = GetMaxBound();
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t i = 0; i < input.size(); i++) {
-        ++progress_bar;
-        const auto &point = input[i];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        if (x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
-            y <= max_bound(1)) {
-            output_index.push_back(i);
-        }
-    }
-    return output_index;
+    return SelectProjectedPoints(input, view, [&](double x, double y) {
+        return x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
+               y <= max_bound(1);
+    });
 }
 
 std::vector<size_t> SelectionPolygon::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        nodes.clear();
+    return SelectProjectedPoints(input, view, [&](double x, double y) {
+        // Even-odd rule: count the polygon edges crossing the scanline at y
+        // left of x.
+        bool inside = false;
         for (size_t i = 0; i < polygon_.size(); i++) {
             size_t j = (i + 1) % polygon_.size();
             if ((polygon_[i](1) < y && polygon_[j](1) >= y) ||
                 (polygon_[j](1) < y && polygon_[i](1) >= y)) {
-                nodes.push_back(polygon_[i](0) +
-                                (y - polygon_[i](1)) /
-                                        (polygon_[j](1) - polygon_[i](1)) *
-                                        (polygon_[j](0) - polygon_[i](0)));
+                double node = polygon_[i](0) +
+                              (y - polygon_[i](1)) /
+                                      (polygon_[j](1) - polygon_[i](1)) *
+                                      (polygon_[j](0) - polygon_[i](0));
+                if (node < x) inside = !inside;
             }
         }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), x);
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
-    }
-    return output_index;
+        return inside;
+    });
 }
 
 }  // namespace visualization
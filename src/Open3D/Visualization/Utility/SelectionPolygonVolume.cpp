@@ -31,6 +31,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
@@ -140,33 +141,32 @@ std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         v = 1;
         w = 2;
     }
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
+    std::vector<uint8_t> mask(input.size(), 0);
+    utility::ParallelFor(0, int64_t(input.size()), [&](int64_t k) {
         const auto &point = input[k];
-        if (point(w) < axis_min_ || point(w) > axis_max_) continue;
-        nodes.clear();
+        if (point(w) < axis_min_ || point(w) > axis_max_) return;
+        // Even-odd rule: count the polygon edges crossing the scanline at
+        // point(v) before point(u).
+        bool inside = false;
         for (size_t i = 0; i < bounding_polygon_.size(); i++) {
             size_t j = (i + 1) % bounding_polygon_.size();
             if ((bounding_polygon_[i](v) < point(v) &&
                  bounding_polygon_[j](v) >= point(v)) ||
                 (bounding_polygon_[j](v) < point(v) &&
                  bounding_polygon_[i](v) >= point(v))) {
-                nodes.push_back(bounding_polygon_[i](u) +
-                                (point(v) - bounding_polygon_[i](v)) /
-                                        (bounding_polygon_[j](v) -
-                                         bounding_polygon_[i](v)) *
-                                        (bounding_polygon_[j](u) -
-                                         bounding_polygon_[i](u)));
+                double node = bounding_polygon_[i](u) +
+                              (point(v) - bounding_polygon_[i](v)) /
+                                      (bounding_polygon_[j](v) -
+                                       bounding_polygon_[i](v)) *
+                                      (bounding_polygon_[j](u) -
+                                       bounding_polygon_[i](u));
+                if (node < point(u)) inside = !inside;
             }
         }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
+        mask[k] = inside ? 1 : 0;
+    });
+    for (size_t k = 0; k < mask.size(); k++) {
+        if (mask[k]) output_index.push_back(k);
     }
     return output_index;
 }
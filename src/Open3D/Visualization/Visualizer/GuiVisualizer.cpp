@@ -1501,6 +1501,9 @@ void GuiVisualizer::SetGeometry(
         const std::vector<std::shared_ptr<const geometry::Geometry>>
                 &geometries) {
     const std::size_t MIN_POINT_CLOUD_POINTS_FOR_DECIMATION = 6000000;
+    // Geometries with more points or triangles than this are uploaded
+    // asynchronously so that the window stays responsive.
+    const std::size_t MIN_ELEMENTS_FOR_ASYNC_UPLOAD = 1000000;
 
     gui::SceneWidget::ModelDescription desc;
 
@@ -1534,6 +1537,7 @@ void GuiVisualizer::SetGeometry(
         Impl::Materials materials = impl_->settings_.current_materials;
 
         visualization::MaterialInstanceHandle selected_material;
+        std::size_t num_elements = 0;  // points or triangles
 
         // If a point cloud or mesh has no vertex colors or a single uniform
         // color (usually white), then we want to display it normally, that is,
@@ -1544,6 +1548,7 @@ void GuiVisualizer::SetGeometry(
             case geometry::Geometry::GeometryType::PointCloud: {
                 auto pcd =
                         std::static_pointer_cast<const geometry::PointCloud>(g);
+                num_elements = pcd->points_.size();
 
                 if (pcd->HasColors() && !PointCloudHasUniformColor(*pcd)) {
                     selected_material = materials.unlit.handle;
@@ -1560,6 +1565,7 @@ void GuiVisualizer::SetGeometry(
                 auto mesh =
                         std::static_pointer_cast<const geometry::TriangleMesh>(
                                 g);
+                num_elements = mesh->triangles_.size();
 
                 bool albedo_only = true;
                 if (mesh->HasMaterials()) {
@@ -1649,7 +1655,16 @@ void GuiVisualizer::SetGeometry(
         }
 
         auto g3 = std::static_pointer_cast<const geometry::Geometry3D>(g);
-        auto handle = scene3d->AddGeometry(*g3, selected_material);
+        visualization::GeometryHandle handle;
+        if (num_elements > MIN_ELEMENTS_FOR_ASYNC_UPLOAD) {
+            // The scene uploads the buffers when it draws, so a redraw is
+            // all that is needed once they are built.
+            handle = scene3d->AddGeometryAsync(g3, selected_material, [this]() {
+                gui::Application::GetInstance().PostToMainThread(this, []() {});
+            });
+        } else {
+            handle = scene3d->AddGeometry(*g3, selected_material);
+        }
         bounds += scene3d->GetEntityBoundingBox(handle);
         impl_->geometry_handles_.push_back(handle);
 
@@ -1781,7 +1796,10 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
         ShowDialog(loading_dlg);
     });
 
-    gui::Application::GetInstance().RunInThread([this, path, progressbar]() {
+    // Loading a new file supersedes any load still in progress, so that
+    // quickly switching files does not pile up loader threads.
+    auto load = [this, path,
+                 progressbar](const gui::CancellationToken &token) {
         auto UpdateProgress = [this, progressbar](float value) {
             gui::Application::GetInstance().PostToMainThread(
                     this,
@@ -1801,6 +1819,9 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
                 mesh_success = false;
             }
         }
+        if (token.IsCancelled()) {
+            return;
+        }
         if (mesh_success) {
             if (mesh->triangles_.size() == 0) {
                 utility::LogWarning(
@@ -1833,15 +1854,18 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
             const float ioProgressAmount = 0.5f;
             try {
                 io::ReadPointCloudOption opt;
-                opt.update_progress = [ioProgressAmount,
-                                       UpdateProgress](double percent) -> bool {
+                opt.update_progress = [ioProgressAmount, UpdateProgress,
+                                       token](double percent) -> bool {
                     UpdateProgress(ioProgressAmount * percent / 100.0);
-                    return true;
+                    return !token.IsCancelled();
                 };
                 success = io::ReadPointCloud(path, *cloud, opt);
             } catch (...) {
                 success = false;
             }
+            if (token.IsCancelled()) {
+                return;
+            }
             if (success) {
                 utility::LogInfo("Successfully read {}", path.c_str());
                 UpdateProgress(ioProgressAmount);
@@ -1858,6 +1882,9 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
             }
         }
 
+        if (token.IsCancelled()) {
+            return;  // the newer load shows its own dialog and result
+        }
         if (geometry) {
             gui::Application::GetInstance().PostToMainThread(
                     this, [this, geometry]() {
@@ -1872,7 +1899,9 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
                 ShowMessageBox("Error", msg.c_str());
             });
         }
-    });
+    };
+    gui::Application::GetInstance().RunInThread(
+            load, gui::TaskPriority::HIGH, "GuiVisualizer::LoadGeometry");
 }
 
 void GuiVisualizer::ExportCurrentImage(int width,
@@ -100,6 +100,7 @@ bool RenderOption::ConvertToJsonValue(Json::Value &value) const {
     value["point_size"] = point_size_;
     value["point_color_option"] = (int)point_color_option_;
     value["point_show_normal"] = point_show_normal_;
+    value["point_budget"] = Json::UInt64(point_budget_);
 
     value["mesh_shade_option"] = (int)mesh_shade_option_;
     value["mesh_color_option"] = (int)mesh_color_option_;
@@ -223,6 +224,9 @@ bool RenderOption::ConvertFromJsonValue(const Json::Value &value) {
                     .asInt();
     point_show_normal_ =
             value.get("point_show_normal", point_show_normal_).asBool();
+    point_budget_ =
+            size_t(value.get("point_budget", Json::UInt64(point_budget_))
+                           .asUInt64());
 
     mesh_shade_option_ =
             (MeshShadeOption)value
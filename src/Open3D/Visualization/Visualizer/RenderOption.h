@@ -199,6 +199,10 @@ public:
     PointColorOption point_color_option_ = PointColorOption::Default;
     /// Whether to show normal for PointCloud.
     bool point_show_normal_ = false;
+    /// Maximum number of points drawn per frame for a PointCloud. Larger
+    /// point clouds are drawn through a level-of-detail octree that picks the
+    /// points most relevant to the view within this budget.
+    size_t point_budget_ = 10000000;
 
     // TriangleMesh options
     /// Mesh shading option for TriangleMesh.
@@ -205,6 +205,8 @@ bool Visualizer::CreateVisualizerWindow(
 
 void Visualizer::DestroyVisualizerWindow() {
     is_initialized_ = false;
+    EndCaptureSequence();
+    pixel_buffer_reader_.Release();
     glDeleteVertexArrays(1, &vao_id_);
     glfwDestroyWindow(window_);
 }
@@ -338,6 +340,12 @@ bool Visualizer::AddGeometry(
         if (!renderer_ptr->AddGeometry(geometry_ptr)) {
             return false;
         }
+    } else if (geometry_ptr->GetGeometryType() ==
+               geometry::Geometry::GeometryType::InstancedTriangleMesh) {
+        renderer_ptr = std::make_shared<glsl::InstancedTriangleMeshRenderer>();
+        if (!renderer_ptr->AddGeometry(geometry_ptr)) {
+            return false;
+        }
     } else if (geometry_ptr->GetGeometryType() ==
                geometry::Geometry::GeometryType::Image) {
         renderer_ptr = std::make_shared<glsl::ImageRenderer>();
@@ -42,6 +42,8 @@
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Shader/GeometryRenderer.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
+#include "Open3D/Visualization/Utility/ImageSequenceWriter.h"
+#include "Open3D/Visualization/Utility/PixelBufferReader.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
 
@@ -221,6 +223,30 @@ public:
                                 bool do_render = true,
                                 bool convert_to_world_coordinate = false);
     void CaptureRenderOption(const std::string &filename = "");
+    /// \brief Function to start capturing a sequence of screen or depth
+    /// images, e.g. the frames of an animation.
+    ///
+    /// CaptureSequenceFrame() does not wait for the pixels of a frame; they
+    /// are read back while the next frame is rendered, and converted and
+    /// written by background threads.
+    ///
+    /// \param capture_depth Set to `true` to capture depth images instead of
+    /// screen images.
+    /// \param depth_scale Scale depth value when capturing depth images.
+    /// \param num_writer_threads Number of threads writing the images.
+    void BeginCaptureSequence(bool capture_depth = false,
+                              double depth_scale = 1000.0,
+                              int num_writer_threads = 2);
+    /// \brief Function to capture a frame of the sequence started by
+    /// BeginCaptureSequence().
+    ///
+    /// \param filename Path to file.
+    /// \param do_render Set to `true` to do render.
+    void CaptureSequenceFrame(const std::string &filename,
+                              bool do_render = true);
+    /// Function to write the remaining frames of the sequence and wait for
+    /// them. Returns false if an image could not be written.
+    bool EndCaptureSequence();
     /// Function to reset view point.
     void ResetViewPoint(bool reset_bounding_box = false);
 
@@ -245,6 +271,9 @@ protected:
 
     void CopyViewStatusFromClipboard();
 
+    /// Reads the depth buffer, top row first, without converting it.
+    void ReadDepthBuffer(geometry::Image &depth_image);
+
     // callback functions
     virtual void WindowRefreshCallback(GLFWwindow *window);
     virtual void WindowResizeCallback(GLFWwindow *window, int w, int h);
@@ -259,6 +288,14 @@ protected:
     /// \brief Function to notify the window to be closed.
     virtual void WindowCloseCallback(GLFWwindow *window);
 
+    struct SequenceFrame {
+        std::string filename_;
+        double z_near_ = 0.0;
+        double z_far_ = 0.0;
+    };
+    void PushSequenceFrame(const SequenceFrame &frame,
+                           const std::shared_ptr<geometry::Image> &image);
+
 protected:
     // window
     GLFWwindow *window_ = NULL;
@@ -301,6 +338,14 @@ protected:
     std::unordered_map<std::shared_ptr<glsl::GeometryRenderer>, RenderOption>
             utility_renderer_opts_;
 
+    // screen capture
+    PixelBufferReader pixel_buffer_reader_;
+    std::unique_ptr<ImageSequenceWriter> sequence_writer_;
+    bool sequence_capture_depth_ = false;
+    double sequence_depth_scale_ = 1000.0;
+    /// Frame of the sequence whose pixels are being read back
+    SequenceFrame pending_sequence_frame_;
+
     // coordinate frame
     std::shared_ptr<geometry::TriangleMesh> coordinate_frame_mesh_ptr_;
     std::shared_ptr<glsl::CoordinateFrameRenderer>
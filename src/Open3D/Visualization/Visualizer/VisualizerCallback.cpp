@@ -33,6 +33,14 @@ void Visualizer::WindowRefreshCallback(GLFWwindow *window) {
     if (is_redraw_required_) {
         Render();
         is_redraw_required_ = false;
+        // Keep drawing while level-of-detail data is being streamed in.
+        for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+            if (renderer_ptr->IsStreaming()) {
+                is_redraw_required_ = true;
+                glfwPostEmptyEvent();
+                break;
+            }
+        }
     }
 }
 
@@ -29,6 +29,7 @@
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Profiler.h"
 #include "Open3D/Visualization/Utility/GLHelper.h"
 #include "Open3D/Visualization/Visualizer/ViewParameters.h"
 #include "Open3D/Visualization/Visualizer/ViewTrajectory.h"
@@ -65,6 +66,7 @@ bool Visualizer::InitOpenGL() {
 }
 
 void Visualizer::Render() {
+    OPEN3D_PROFILE_FUNCTION();
     glfwMakeContextCurrent(window_);
 
     view_control_ptr_->SetViewMatrices();
@@ -143,32 +145,79 @@ void Visualizer::CopyViewStatusFromClipboard() {
     }
 }
 
+namespace {
+
+/// Converts a value of the depth buffer to the depth of the point, or returns
+/// 0 for the background.
+double DepthBufferToDepth(float z_buffer, double z_near, double z_far) {
+    if (z_buffer == 1.0) {
+        return 0.0;
+    }
+    return 2.0 * z_near * z_far /
+           (z_far + z_near - (2.0 * (double)z_buffer - 1.0) * (z_far - z_near));
+}
+
+/// Converts the depth buffer to a 16 bit depth image scaled by depth_scale.
+std::shared_ptr<geometry::Image> DepthBufferToPNGImage(
+        const geometry::Image &depth_buffer,
+        double z_near,
+        double z_far,
+        double depth_scale) {
+    auto png_image = std::make_shared<geometry::Image>();
+    png_image->Prepare(depth_buffer.width_, depth_buffer.height_, 1, 2);
+    const float *p_depth = (const float *)depth_buffer.data_.data();
+    uint16_t *p_png = (uint16_t *)png_image->data_.data();
+    for (int i = 0; i < depth_buffer.width_ * depth_buffer.height_; i++) {
+        double z_depth = DepthBufferToDepth(p_depth[i], z_near, z_far);
+        p_png[i] = (uint16_t)std::min(std::round(depth_scale * z_depth),
+                                      (double)INT16_MAX);
+    }
+    return png_image;
+}
+
+}  // unnamed namespace
+
+void Visualizer::ReadDepthBuffer(geometry::Image &depth_image) {
+    const int width = view_control_ptr_->GetWindowWidth();
+    const int height = view_control_ptr_->GetWindowHeight();
+#if __APPLE__
+    // On OSX with Retina display and glfw3, there is a bug with glReadPixels().
+    // When using glReadPixels() to read a block of depth data. The data is
+    // horizontally stretched (vertically it is fine). This issue is related
+    // to GLFW_SAMPLES hint. When it is set to 0 (anti-aliasing disabled),
+    // glReadPixels() works fine. See this post for details:
+    // http://stackoverflow.com/questions/30608121/glreadpixel-one-pass-vs-looping-through-points
+    // The reason of this bug is unknown. The current workaround is to read
+    // depth buffer column by column. This is 15~30 times slower than one block
+    // reading glReadPixels().
+    depth_image.Prepare(width, height, 1, 4);
+    std::vector<float> float_buffer(height);
+    float *p = (float *)depth_image.data_.data();
+    for (int j = 0; j < width; j++) {
+        glReadPixels(j, 0, 1, height, GL_DEPTH_COMPONENT, GL_FLOAT,
+                     float_buffer.data());
+        // glReadPixels returns the bottom row first
+        for (int i = 0; i < height; i++) {
+            p[(height - i - 1) * width + j] = float_buffer[i];
+        }
+    }
+#else   //__APPLE__
+    pixel_buffer_reader_.Read(width, height, GL_DEPTH_COMPONENT, GL_FLOAT, 1,
+                              4, depth_image);
+#endif  //__APPLE__
+}
+
 std::shared_ptr<geometry::Image> Visualizer::CaptureScreenFloatBuffer(
         bool do_render /* = true*/) {
-    geometry::Image screen_image;
-    screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                         view_control_ptr_->GetWindowHeight(), 3, 4);
     if (do_render) {
         Render();
         is_redraw_required_ = false;
     }
     glFinish();
-    glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
-                 view_control_ptr_->GetWindowHeight(), GL_RGB, GL_FLOAT,
-                 screen_image.data_.data());
-
-    // glReadPixels get the screen in a vertically flipped manner
-    // Thus we should flip it back.
     auto image_ptr = std::make_shared<geometry::Image>();
-    image_ptr->Prepare(view_control_ptr_->GetWindowWidth(),
-                       view_control_ptr_->GetWindowHeight(), 3, 4);
-    int bytes_per_line = screen_image.BytesPerLine();
-    for (int i = 0; i < screen_image.height_; i++) {
-        memcpy(image_ptr->data_.data() + bytes_per_line * i,
-               screen_image.data_.data() +
-                       bytes_per_line * (screen_image.height_ - i - 1),
-               bytes_per_line);
-    }
+    pixel_buffer_reader_.Read(view_control_ptr_->GetWindowWidth(),
+                              view_control_ptr_->GetWindowHeight(), GL_RGB,
+                              GL_FLOAT, 3, 4, *image_ptr);
     return image_ptr;
 }
 
@@ -181,30 +230,15 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
         png_filename = "ScreenCapture_" + timestamp + ".png";
         camera_filename = "ScreenCamera_" + timestamp + ".json";
     }
-    geometry::Image screen_image;
-    screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                         view_control_ptr_->GetWindowHeight(), 3, 1);
     if (do_render) {
         Render();
         is_redraw_required_ = false;
     }
     glFinish();
-    glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
-                 view_control_ptr_->GetWindowHeight(), GL_RGB, GL_UNSIGNED_BYTE,
-                 screen_image.data_.data());
-
-    // glReadPixels get the screen in a vertically flipped manner
-    // Thus we should flip it back.
     geometry::Image png_image;
-    png_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                      view_control_ptr_->GetWindowHeight(), 3, 1);
-    int bytes_per_line = screen_image.BytesPerLine();
-    for (int i = 0; i < screen_image.height_; i++) {
-        memcpy(png_image.data_.data() + bytes_per_line * i,
-               screen_image.data_.data() +
-                       bytes_per_line * (screen_image.height_ - i - 1),
-               bytes_per_line);
-    }
+    pixel_buffer_reader_.Read(view_control_ptr_->GetWindowWidth(),
+                              view_control_ptr_->GetWindowHeight(), GL_RGB,
+                              GL_UNSIGNED_BYTE, 3, 1, png_image);
 
     utility::LogDebug("[Visualizer] Screen capture to {}",
                       png_filename.c_str());
@@ -220,64 +254,20 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
 
 std::shared_ptr<geometry::Image> Visualizer::CaptureDepthFloatBuffer(
         bool do_render /* = true*/) {
-    geometry::Image depth_image;
-    depth_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                        view_control_ptr_->GetWindowHeight(), 1, 4);
     if (do_render) {
         Render();
         is_redraw_required_ = false;
     }
     glFinish();
-
-#if __APPLE__
-    // On OSX with Retina display and glfw3, there is a bug with glReadPixels().
-    // When using glReadPixels() to read a block of depth data. The data is
-    // horizontally stretched (vertically it is fine). This issue is related
-    // to GLFW_SAMPLES hint. When it is set to 0 (anti-aliasing disabled),
-    // glReadPixels() works fine. See this post for details:
-    // http://stackoverflow.com/questions/30608121/glreadpixel-one-pass-vs-looping-through-points
-    // The reason of this bug is unknown. The current workaround is to read
-    // depth buffer column by column. This is 15~30 times slower than one block
-    // reading glReadPixels().
-    std::vector<float> float_buffer(depth_image.height_);
-    float *p = (float *)depth_image.data_.data();
-    for (int j = 0; j < depth_image.width_; j++) {
-        glReadPixels(j, 0, 1, depth_image.height_, GL_DEPTH_COMPONENT, GL_FLOAT,
-                     float_buffer.data());
-        for (int i = 0; i < depth_image.height_; i++) {
-            p[i * depth_image.width_ + j] = float_buffer[i];
-        }
-    }
-#else   //__APPLE__
-    // By default, glReadPixels read a block of depth buffer.
-    glReadPixels(0, 0, depth_image.width_, depth_image.height_,
-                 GL_DEPTH_COMPONENT, GL_FLOAT, depth_image.data_.data());
-#endif  //__APPLE__
-
-    // glReadPixels get the screen in a vertically flipped manner
-    // We should flip it back, and convert it to the correct depth value
     auto image_ptr = std::make_shared<geometry::Image>();
+    ReadDepthBuffer(*image_ptr);
+
+    // Convert the depth buffer to the correct depth value in place
     double z_near = view_control_ptr_->GetZNear();
     double z_far = view_control_ptr_->GetZFar();
-
-    image_ptr->Prepare(view_control_ptr_->GetWindowWidth(),
-                       view_control_ptr_->GetWindowHeight(), 1, 4);
-    for (int i = 0; i < depth_image.height_; i++) {
-        float *p_depth = (float *)(depth_image.data_.data() +
-                                   depth_image.BytesPerLine() *
-                                           (depth_image.height_ - i - 1));
-        float *p_image = (float *)(image_ptr->data_.data() +
-                                   image_ptr->BytesPerLine() * i);
-        for (int j = 0; j < depth_image.width_; j++) {
-            if (p_depth[j] == 1.0) {
-                continue;
-            }
-            double z_depth =
-                    2.0 * z_near * z_far /
-                    (z_far + z_near -
-                     (2.0 * (double)p_depth[j] - 1.0) * (z_far - z_near));
-            p_image[j] = (float)z_depth;
-        }
+    float *p_image = (float *)image_ptr->data_.data();
+    for (int i = 0; i < image_ptr->width_ * image_ptr->height_; i++) {
+        p_image[i] = (float)DepthBufferToDepth(p_image[i], z_near, z_far);
     }
     return image_ptr;
 }
@@ -292,70 +282,19 @@ void Visualizer::CaptureDepthImage(const std::string &filename /* = ""*/,
         png_filename = "DepthCapture_" + timestamp + ".png";
         camera_filename = "DepthCamera_" + timestamp + ".json";
     }
-    geometry::Image depth_image;
-    depth_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                        view_control_ptr_->GetWindowHeight(), 1, 4);
-
     if (do_render) {
         Render();
         is_redraw_required_ = false;
     }
     glFinish();
-
-#if __APPLE__
-    // On OSX with Retina display and glfw3, there is a bug with glReadPixels().
-    // When using glReadPixels() to read a block of depth data. The data is
-    // horizontally streched (vertically it is fine). This issue is related
-    // to GLFW_SAMPLES hint. When it is set to 0 (anti-aliasing disabled),
-    // glReadPixels() works fine. See this post for details:
-    // http://stackoverflow.com/questions/30608121/glreadpixel-one-pass-vs-looping-through-points
-    // The reason of this bug is unknown. The current workaround is to read
-    // depth buffer column by column. This is 15~30 times slower than one block
-    // reading glReadPixels().
-    std::vector<float> float_buffer(depth_image.height_);
-    float *p = (float *)depth_image.data_.data();
-    for (int j = 0; j < depth_image.width_; j++) {
-        glReadPixels(j, 0, 1, depth_image.width_, GL_DEPTH_COMPONENT, GL_FLOAT,
-                     float_buffer.data());
-        for (int i = 0; i < depth_image.height_; i++) {
-            p[i * depth_image.width_ + j] = float_buffer[i];
-        }
-    }
-#else   //__APPLE__
-    // By default, glReadPixels read a block of depth buffer.
-    glReadPixels(0, 0, depth_image.width_, depth_image.height_,
-                 GL_DEPTH_COMPONENT, GL_FLOAT, depth_image.data_.data());
-#endif  //__APPLE__
-
-    // glReadPixels get the screen in a vertically flipped manner
-    // We should flip it back, and convert it to the correct depth value
-    geometry::Image png_image;
-    double z_near = view_control_ptr_->GetZNear();
-    double z_far = view_control_ptr_->GetZFar();
-
-    png_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                      view_control_ptr_->GetWindowHeight(), 1, 2);
-    for (int i = 0; i < depth_image.height_; i++) {
-        float *p_depth = (float *)(depth_image.data_.data() +
-                                   depth_image.BytesPerLine() *
-                                           (depth_image.height_ - i - 1));
-        uint16_t *p_png = (uint16_t *)(png_image.data_.data() +
-                                       png_image.BytesPerLine() * i);
-        for (int j = 0; j < depth_image.width_; j++) {
-            if (p_depth[j] == 1.0) {
-                continue;
-            }
-            double z_depth =
-                    2.0 * z_near * z_far /
-                    (z_far + z_near -
-                     (2.0 * (double)p_depth[j] - 1.0) * (z_far - z_near));
-            p_png[j] = (uint16_t)std::min(std::round(depth_scale * z_depth),
-                                          (double)INT16_MAX);
-        }
-    }
+    geometry::Image depth_image;
+    ReadDepthBuffer(depth_image);
+    auto png_image = DepthBufferToPNGImage(
+            depth_image, view_control_ptr_->GetZNear(),
+            view_control_ptr_->GetZFar(), depth_scale);
 
     utility::LogDebug("[Visualizer] Depth capture to {}", png_filename.c_str());
-    io::WriteImage(png_filename, png_image);
+    io::WriteImage(png_filename, *png_image);
     if (!camera_filename.empty()) {
         utility::LogDebug("[Visualizer] Depth camera capture to {}",
                           camera_filename.c_str());
@@ -376,40 +315,13 @@ void Visualizer::CaptureDepthPointCloud(
         ply_filename = "DepthCapture_" + timestamp + ".ply";
         camera_filename = "DepthCamera_" + timestamp + ".json";
     }
-    geometry::Image depth_image;
-    depth_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                        view_control_ptr_->GetWindowHeight(), 1, 4);
-
     if (do_render) {
         Render();
         is_redraw_required_ = false;
     }
     glFinish();
-
-#if __APPLE__
-    // On OSX with Retina display and glfw3, there is a bug with glReadPixels().
-    // When using glReadPixels() to read a block of depth data. The data is
-    // horizontally stretched (vertically it is fine). This issue is related
-    // to GLFW_SAMPLES hint. When it is set to 0 (anti-aliasing disabled),
-    // glReadPixels() works fine. See this post for details:
-    // http://stackoverflow.com/questions/30608121/glreadpixel-one-pass-vs-looping-through-points
-    // The reason of this bug is unknown. The current workaround is to read
-    // depth buffer column by column. This is 15~30 times slower than one block
-    // reading glReadPixels().
-    std::vector<float> float_buffer(depth_image.height_);
-    float *p = (float *)depth_image.data_.data();
-    for (int j = 0; j < depth_image.width_; j++) {
-        glReadPixels(j, 0, 1, depth_image.width_, GL_DEPTH_COMPONENT, GL_FLOAT,
-                     float_buffer.data());
-        for (int i = 0; i < depth_image.height_; i++) {
-            p[i * depth_image.width_ + j] = float_buffer[i];
-        }
-    }
-#else   //__APPLE__
-    // By default, glReadPixels read a block of depth buffer.
-    glReadPixels(0, 0, depth_image.width_, depth_image.height_,
-                 GL_DEPTH_COMPONENT, GL_FLOAT, depth_image.data_.data());
-#endif  //__APPLE__
+    geometry::Image depth_image;
+    ReadDepthBuffer(depth_image);
 
     GLHelper::GLMatrix4f mvp_matrix;
     if (convert_to_world_coordinate) {
@@ -418,12 +330,13 @@ void Visualizer::CaptureDepthPointCloud(
         mvp_matrix = view_control_ptr_->GetProjectionMatrix();
     }
 
-    // glReadPixels get the screen in a vertically flipped manner
-    // We should flip it back, and convert it to the correct depth value
+    // Unproject the pixels in OpenGL window coordinates, with row 0 at the
+    // bottom, i.e. the last row of the image
     geometry::PointCloud depth_pointcloud;
     for (int i = 0; i < depth_image.height_; i++) {
         float *p_depth = (float *)(depth_image.data_.data() +
-                                   depth_image.BytesPerLine() * i);
+                                   depth_image.BytesPerLine() *
+                                           (depth_image.height_ - i - 1));
         for (int j = 0; j < depth_image.width_; j++) {
             if (p_depth[j] == 1.0) {
                 continue;
@@ -447,6 +360,87 @@ void Visualizer::CaptureDepthPointCloud(
     }
 }
 
+void Visualizer::BeginCaptureSequence(bool capture_depth /* = false*/,
+                                      double depth_scale /* = 1000.0*/,
+                                      int num_writer_threads /* = 2*/) {
+    EndCaptureSequence();
+    sequence_writer_ = std::unique_ptr<ImageSequenceWriter>(
+            new ImageSequenceWriter(8, num_writer_threads));
+    sequence_capture_depth_ = capture_depth;
+    sequence_depth_scale_ = depth_scale;
+}
+
+void Visualizer::CaptureSequenceFrame(const std::string &filename,
+                                      bool do_render /* = true*/) {
+    if (!sequence_writer_) {
+        utility::LogError(
+                "[Visualizer] CaptureSequenceFrame() requires "
+                "BeginCaptureSequence().");
+    }
+    if (do_render) {
+        Render();
+        is_redraw_required_ = false;
+    }
+    SequenceFrame frame;
+    frame.filename_ = filename;
+    frame.z_near_ = view_control_ptr_->GetZNear();
+    frame.z_far_ = view_control_ptr_->GetZFar();
+
+    // The pixels of the previous frame are returned while the pixels of this
+    // frame are transferred
+    const int width = view_control_ptr_->GetWindowWidth();
+    const int height = view_control_ptr_->GetWindowHeight();
+    auto image = std::make_shared<geometry::Image>();
+    bool has_previous_frame;
+    if (sequence_capture_depth_) {
+#if __APPLE__
+        // The column by column workaround of ReadDepthBuffer() is synchronous
+        ReadDepthBuffer(*image);
+        PushSequenceFrame(frame, image);
+        return;
+#else   //__APPLE__
+        has_previous_frame = pixel_buffer_reader_.ReadAsync(
+                width, height, GL_DEPTH_COMPONENT, GL_FLOAT, 1, 4, *image);
+#endif  //__APPLE__
+    } else {
+        has_previous_frame = pixel_buffer_reader_.ReadAsync(
+                width, height, GL_RGB, GL_UNSIGNED_BYTE, 3, 1, *image);
+    }
+    if (has_previous_frame) {
+        PushSequenceFrame(pending_sequence_frame_, image);
+    }
+    pending_sequence_frame_ = frame;
+}
+
+bool Visualizer::EndCaptureSequence() {
+    if (!sequence_writer_) {
+        return true;
+    }
+    auto image = std::make_shared<geometry::Image>();
+    if (pixel_buffer_reader_.Flush(*image)) {
+        PushSequenceFrame(pending_sequence_frame_, image);
+    }
+    int64_t num_failed_images = sequence_writer_->Finish();
+    sequence_writer_.reset();
+    return num_failed_images == 0;
+}
+
+void Visualizer::PushSequenceFrame(
+        const SequenceFrame &frame,
+        const std::shared_ptr<geometry::Image> &image) {
+    utility::LogDebug("[Visualizer] Sequence capture to {}", frame.filename_);
+    if (!sequence_capture_depth_) {
+        sequence_writer_->Push(frame.filename_, image);
+        return;
+    }
+    // Convert the depth on the writer threads
+    const double depth_scale = sequence_depth_scale_;
+    sequence_writer_->Push(frame.filename_, [image, frame, depth_scale]() {
+        return DepthBufferToPNGImage(*image, frame.z_near_, frame.z_far_,
+                                     depth_scale);
+    });
+}
+
 void Visualizer::CaptureRenderOption(const std::string &filename /* = ""*/) {
     std::string json_filename = filename;
     if (json_filename.empty()) {
@@ -108,13 +108,16 @@ void VisualizerWithCustomAnimation::Play(
             utility::filesystem::MakeDirectoryHierarchy(
                     recording_image_basedir_);
         }
+        BeginCaptureSequence(recording_depth);
     }
     RegisterAnimationCallback([=, &progress_bar](Visualizer *vis) {
         // The lambda function captures no references to avoid dangling
         // references
         auto &view_control =
                 (ViewControlWithCustomAnimation &)(*view_control_ptr_);
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (!recording) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
         recording_file_index_++;
         if (recording) {
             if (recording_trajectory) {
@@ -126,12 +129,12 @@ void VisualizerWithCustomAnimation::Play(
             if (recording_depth) {
                 buffer = fmt::format(recording_depth_filename_format_.c_str(),
                                      recording_file_index_);
-                CaptureDepthImage(
+                CaptureSequenceFrame(
                         recording_depth_basedir_ + std::string(buffer), false);
             } else {
                 buffer = fmt::format(recording_image_filename_format_.c_str(),
                                      recording_file_index_);
-                CaptureScreenImage(
+                CaptureSequenceFrame(
                         recording_image_basedir_ + std::string(buffer), false);
             }
         }
@@ -141,6 +144,9 @@ void VisualizerWithCustomAnimation::Play(
             view_control.SetAnimationMode(
                     ViewControlWithCustomAnimation::AnimationMode::FreeMode);
             RegisterAnimationCallback(nullptr);
+            if (recording) {
+                EndCaptureSequence();
+            }
             if (recording && recording_trajectory) {
                 if (recording_depth) {
                     io::WriteIJsonConvertible(
@@ -37,6 +37,7 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Visualization/Utility/GLHelper.h"
+#include "Open3D/Visualization/Utility/PickingBuffer.h"
 #include "Open3D/Visualization/Utility/PointCloudPicker.h"
 #include "Open3D/Visualization/Utility/SelectionPolygon.h"
 #include "Open3D/Visualization/Utility/SelectionPolygonVolume.h"
@@ -117,6 +118,18 @@ bool VisualizerWithEditing::AddGeometry(
     return UpdateGeometry();
 }
 
+bool VisualizerWithEditing::UpdateGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr /*= nullptr*/) {
+    bool result = Visualizer::UpdateGeometry(geometry_ptr);
+    if (picking_renderer_ptr_ &&
+        (geometry_ptr == nullptr ||
+         picking_renderer_ptr_->HasGeometry(geometry_ptr))) {
+        picking_renderer_ptr_->UpdateGeometry();
+        picking_buffer_ptr_->Invalidate();
+    }
+    return result;
+}
+
 void VisualizerWithEditing::PrintVisualizerHelp() {
     Visualizer::PrintVisualizerHelp();
     // clang-format off
@@ -190,69 +203,39 @@ void VisualizerWithEditing::BuildUtilities() {
 }
 
 int VisualizerWithEditing::PickPoint(double x, double y) {
-    auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
-    if (!renderer_ptr->AddGeometry(editing_geometry_ptr_)) {
-        return -1;
+    if (!picking_renderer_ptr_) {
+        auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
+        if (!renderer_ptr->AddGeometry(editing_geometry_ptr_)) {
+            return -1;
+        }
+        picking_renderer_ptr_ = renderer_ptr;
+        picking_buffer_ptr_ = std::make_shared<PickingBuffer>();
     }
     const auto &view = GetViewControl();
-    // Render to FBO and disable anti-aliasing
-    glDisable(GL_MULTISAMPLE);
-    GLuint frame_buffer_name = 0;
-    glGenFramebuffers(1, &frame_buffer_name);
-    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_name);
-    GLuint fbo_texture;
-    glGenTextures(1, &fbo_texture);
-    glBindTexture(GL_TEXTURE_2D, fbo_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, view.GetWindowWidth(),
-                 view.GetWindowHeight(), 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    if (!GLEW_ARB_framebuffer_object) {
-        // OpenGL 2.1 doesn't require this, 3.1+ does
-        utility::LogWarning(
-                "[PickPoint] Your GPU does not provide framebuffer objects. "
-                "Use a texture instead.");
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glEnable(GL_MULTISAMPLE);
+    // Render to FBO
+    if (!picking_buffer_ptr_->Bind(view)) {
+        picking_buffer_ptr_->Unbind();
         return -1;
     }
-    GLuint depth_render_buffer;
-    glGenRenderbuffers(1, &depth_render_buffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, depth_render_buffer);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT,
-                          view.GetWindowWidth(), view.GetWindowHeight());
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
-                              GL_RENDERBUFFER, depth_render_buffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                           fbo_texture, 0);
-    GLenum DrawBuffers[1] = {GL_COLOR_ATTACHMENT0};
-    glDrawBuffers(1, DrawBuffers);  // "1" is the size of DrawBuffers
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        utility::LogWarning("[PickPoint] Something is wrong with FBO.");
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    view_control_ptr_->SetViewMatrices();
+    if (!picking_buffer_ptr_->IsUpToDate(view)) {
+        // Disable anti-aliasing, we need pixelation for correct pick colors
+        glDisable(GL_MULTISAMPLE);
+        glDisable(GL_BLEND);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
+        glClearDepth(1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        picking_renderer_ptr_->Render(GetRenderOption(), GetViewControl());
+        glFinish();
         glEnable(GL_MULTISAMPLE);
-        return -1;
+        picking_buffer_ptr_->SetUpToDate(view);
     }
-    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_name);
-    view_control_ptr_->SetViewMatrices();
-    glDisable(GL_BLEND);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-    glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
-    glClearDepth(1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    renderer_ptr->Render(GetRenderOption(), GetViewControl());
-    glFinish();
-    uint8_t rgba[4];
-    glReadPixels((int)(x + 0.5), (int)(view.GetWindowHeight() - y + 0.5), 1, 1,
-                 GL_RGBA, GL_UNSIGNED_BYTE, rgba);
-    int index = GLHelper::ColorCodeToPickIndex(
-            Eigen::Vector4i(rgba[0], rgba[1], rgba[2], rgba[3]));
+    auto indices = picking_buffer_ptr_->ReadIndices(
+            (int)(x + 0.5), (int)(view.GetWindowHeight() - y + 0.5), 1, 1);
     // Recover rendering state
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glEnable(GL_MULTISAMPLE);
-    return index;
+    picking_buffer_ptr_->Unbind();
+    return indices.empty() ? -1 : indices[0];
 }
 
 std::vector<size_t> &VisualizerWithEditing::GetPickedPoints() {
@@ -276,6 +259,10 @@ void VisualizerWithEditing::KeyPressCallback(
         GLFWwindow *window, int key, int scancode, int action, int mods) {
     auto &view_control = (ViewControlWithEditing &)(*view_control_ptr_);
     auto &option = (RenderOptionWithEditing &)(*render_option_ptr_);
+    // Keys may change the point size or other render options used for picking
+    if (picking_buffer_ptr_) {
+        picking_buffer_ptr_->Invalidate();
+    }
     if (action == GLFW_RELEASE) {
         if (key == GLFW_KEY_LEFT_CONTROL || key == GLFW_KEY_RIGHT_CONTROL) {
             if (view_control.IsLocked() &&
@@ -326,7 +313,7 @@ void VisualizerWithEditing::KeyPressCallback(
             if (mods & GLFW_MOD_CONTROL) {
                 (geometry::PointCloud &)*editing_geometry_ptr_ =
                         (const geometry::PointCloud &)*original_geometry_ptr_;
-                editing_geometry_renderer_ptr_->UpdateGeometry();
+                UpdateGeometry(editing_geometry_ptr_);
             } else {
                 Visualizer::KeyPressCallback(window, key, scancode, action,
                                              mods);
@@ -387,7 +374,7 @@ void VisualizerWithEditing::KeyPressCallback(
                             (geometry::PointCloud &)*editing_geometry_ptr_;
                     pcd = *selection_polygon_ptr_->CropPointCloud(pcd,
                                                                   view_control);
-                    editing_geometry_renderer_ptr_->UpdateGeometry();
+                    UpdateGeometry(editing_geometry_ptr_);
                     const char *filename;
                     const char *pattern[1] = {"*.ply"};
                     std::string default_filename =
@@ -420,7 +407,7 @@ void VisualizerWithEditing::KeyPressCallback(
                             (geometry::TriangleMesh &)*editing_geometry_ptr_;
                     mesh = *selection_polygon_ptr_->CropTriangleMesh(
                             mesh, view_control);
-                    editing_geometry_renderer_ptr_->UpdateGeometry();
+                    UpdateGeometry(editing_geometry_ptr_);
                     const char *filename;
                     const char *pattern[1] = {"*.ply"};
                     std::string default_filename =
@@ -33,6 +33,7 @@ namespace open3d {
 namespace visualization {
 class SelectionPolygon;
 class PointCloudPicker;
+class PickingBuffer;
 
 /// \class VisualizerWithEditing
 ///
@@ -62,6 +63,8 @@ public:
     /// \param geometry_ptr The Geometry object.
     bool AddGeometry(std::shared_ptr<const geometry::Geometry> geometry_ptr,
                      bool reset_bounding_box = true) override;
+    bool UpdateGeometry(std::shared_ptr<const geometry::Geometry> geometry_ptr =
+                                nullptr) override;
     void PrintVisualizerHelp() override;
     void UpdateWindowTitle() override;
     void BuildUtilities() override;
@@ -101,6 +104,11 @@ protected:
     std::shared_ptr<geometry::Geometry> editing_geometry_ptr_;
     std::shared_ptr<glsl::GeometryRenderer> editing_geometry_renderer_ptr_;
 
+    /// Pick color codes of editing_geometry_ptr_, redrawn only when the view,
+    /// the render options or the geometry changed.
+    std::shared_ptr<PickingBuffer> picking_buffer_ptr_;
+    std::shared_ptr<glsl::PointCloudPickingRenderer> picking_renderer_ptr_;
+
     double voxel_size_ = -1.0;
     bool use_dialog_ = true;
     std::string default_directory_;
@@ -39,6 +39,7 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Visualization/Utility/GLHelper.h"
+#include "Open3D/Visualization/Utility/PickingBuffer.h"
 #include "Open3D/Visualization/Utility/PointCloudPicker.h"
 #include "Open3D/Visualization/Utility/SelectionPolygon.h"
 #include "Open3D/Visualization/Utility/SelectionPolygonVolume.h"
@@ -55,44 +56,6 @@ static const Eigen::Vector3d CHOOSE_POINTS_COLOR(1, 0, 1);
 static const Eigen::Vector3d SELECTED_POINTS_COLOR(0, 1, 0);
 static const int START_RECT_DIST = 3;
 
-bool BindFramebuffer(int width, int height) {
-    GLuint frame_buffer_name = 0;
-    glGenFramebuffers(1, &frame_buffer_name);
-    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_name);
-    GLuint fbo_texture;
-    glGenTextures(1, &fbo_texture);
-    glBindTexture(GL_TEXTURE_2D, fbo_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
-                 GL_UNSIGNED_BYTE, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    if (!GLEW_ARB_framebuffer_object) {
-        // OpenGL 2.1 doesn't require this, 3.1+ does
-        utility::LogWarning(
-                "[BindFramebuffwer] Your GPU does not provide framebuffer "
-                "objects. "
-                "Use a texture instead.");
-        return false;
-    }
-    GLuint depth_render_buffer;
-    glGenRenderbuffers(1, &depth_render_buffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, depth_render_buffer);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
-                              GL_RENDERBUFFER, depth_render_buffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                           fbo_texture, 0);
-    GLenum DrawBuffers[1] = {GL_COLOR_ATTACHMENT0};
-    glDrawBuffers(1, DrawBuffers);  // "1" is the size of DrawBuffers
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        utility::LogWarning("[BindFramebuffer] Something is wrong with FBO.");
-        return false;
-    }
-    return true;
-}
-
 }  // namespace
 
 bool VisualizerWithVertexSelection::AddGeometry(
@@ -154,6 +117,9 @@ bool VisualizerWithVertexSelection::AddGeometry(
     ui_selected_points_renderer_ptr_->AddGeometry(
             ui_selected_points_geometry_ptr_);
     utility_renderer_ptrs_.push_back(ui_selected_points_renderer_ptr_);
+    picking_renderer_ptr_ = std::make_shared<glsl::PointCloudPickingRenderer>();
+    picking_renderer_ptr_->AddGeometry(ui_points_geometry_ptr_);
+    picking_buffer_ptr_ = std::make_shared<PickingBuffer>();
 
     utility_renderer_opts_[ui_points_renderer_ptr_].depthFunc_ =
             RenderOption::DepthFunc::Less;
@@ -233,6 +199,8 @@ bool VisualizerWithVertexSelection::UpdateGeometry(
 
     ui_points_geometry_ptr_->PaintUniformColor(CHOOSE_POINTS_COLOR);
     ui_points_renderer_ptr_->UpdateGeometry();
+    picking_renderer_ptr_->UpdateGeometry();
+    picking_buffer_ptr_->Invalidate();
 
     geometry_renderer_ptr_->UpdateGeometry();
 
@@ -307,8 +275,9 @@ void VisualizerWithVertexSelection::BuildUtilities() {
 float VisualizerWithVertexSelection::GetDepth(int winX, int winY) {
     const auto &view = GetViewControl();
 
-    // Render to FBO
-    if (!BindFramebuffer(view.GetWindowWidth(), view.GetWindowHeight())) {
+    // Render to FBO. The color attachment is masked below, so the pick colors
+    // stored in the picking buffer stay valid.
+    if (!picking_buffer_ptr_ || !picking_buffer_ptr_->Bind(view)) {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
         return {};
     }
@@ -340,7 +309,7 @@ float VisualizerWithVertexSelection::GetDepth(int winX, int winY) {
     glReadPixels(lowerLeftX, lowerLeftY, width, height, GL_DEPTH_COMPONENT,
                  GL_FLOAT, &depth);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    picking_buffer_ptr_->Unbind();
     return depth;
 }
 
@@ -349,70 +318,59 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
                                                            double w,
                                                            double h) {
     points_in_rect_.clear();
-
-    auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
-    if (!renderer_ptr->AddGeometry(ui_points_geometry_ptr_)) {
+    if (!picking_renderer_ptr_) {
         return {};
     }
+
     const auto &view = GetViewControl();
     // Render to FBO
-    if (!BindFramebuffer(view.GetWindowWidth(), view.GetWindowHeight())) {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!picking_buffer_ptr_->Bind(view)) {
+        picking_buffer_ptr_->Unbind();
         return {};
     }
 
+    // The pick colors only depend on the view and the geometry, so the
+    // buffer is redrawn only if one of them changed since the last pick.
+    // Picking a rectangle on a large cloud then costs a readback of the
+    // rectangle instead of a full redraw.
     view_control_ptr_->SetViewMatrices();
-    glDisable(GL_MULTISAMPLE);  // we need pixelation for correct pick colors
-    glDisable(GL_BLEND);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-    glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
-    glClearDepth(1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-    // Render any triangle meshes to the depth buffer only (so that z-buffer
-    // prevents points that are behind them being drawn for selection)
-    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-    for (auto &renderer : geometry_renderer_ptrs_) {
-        if (renderer->GetGeometry()->GetGeometryType() ==
-            geometry::Geometry::GeometryType::TriangleMesh) {
-            renderer->Render(GetRenderOption(), GetViewControl());
+    if (!picking_buffer_ptr_->IsUpToDate(view)) {
+        glDisable(GL_MULTISAMPLE);  // we need pixelation for correct colors
+        glDisable(GL_BLEND);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
+        glClearDepth(1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        // Render any triangle meshes to the depth buffer only (so that
+        // z-buffer prevents points that are behind them being drawn for
+        // selection)
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        for (auto &renderer : geometry_renderer_ptrs_) {
+            if (renderer->GetGeometry()->GetGeometryType() ==
+                geometry::Geometry::GeometryType::TriangleMesh) {
+                renderer->Render(GetRenderOption(), GetViewControl());
+            }
         }
-    }
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
-    // Now render the points
-    renderer_ptr->Render(pick_point_opts_, GetViewControl());
-
-    glFinish();
+        // Now render the points
+        picking_renderer_ptr_->Render(pick_point_opts_, GetViewControl());
+        glFinish();
+        glEnable(GL_MULTISAMPLE);
+        picking_buffer_ptr_->SetUpToDate(view);
+    }
 
     // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
     int width = int(std::ceil(w));
     int height = int(std::ceil(h));
     int lowerLeftX = int(winX + 0.5);
     int lowerLeftY = int(view.GetWindowHeight() - winY - height + 0.5);
-    std::vector<uint8_t> rgba(4 * width * height, 0);
-
-    glReadPixels(lowerLeftX, lowerLeftY, width, height, GL_RGBA,
-                 GL_UNSIGNED_BYTE, rgba.data());
+    auto indices = picking_buffer_ptr_->ReadIndices(lowerLeftX, lowerLeftY,
+                                                    width, height);
     // Recover rendering state
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glEnable(GL_MULTISAMPLE);
-
-    std::unordered_set<int> indexSet;
-    for (int i = 0; i < width * height; ++i) {
-        const uint8_t *rgbaPtr = rgba.data() + 4 * i;
-        int index = GLHelper::ColorCodeToPickIndex(Eigen::Vector4i(
-                rgbaPtr[0], rgbaPtr[1], rgbaPtr[2], rgbaPtr[3]));
-        if (index >= 0) {
-            indexSet.insert(index);
-        }
-    }
+    picking_buffer_ptr_->Unbind();
 
-    std::vector<int> indices;
-    indices.reserve(indexSet.size());
-    for (int idx : indexSet) {
-        indices.push_back(idx);
-    }
     points_in_rect_ = indices;
     return indices;
 }
@@ -817,6 +775,9 @@ Eigen::Vector3d VisualizerWithVertexSelection::CalcDragDelta(double winX,
 void VisualizerWithVertexSelection::SetPointSize(double size) {
     size = std::max(size, MIN_POINT_SIZE);
     pick_point_opts_.SetPointSize(size);
+    if (picking_buffer_ptr_) {
+        picking_buffer_ptr_->Invalidate();
+    }
     auto *opt = &utility_renderer_opts_[ui_points_renderer_ptr_];
     opt->SetPointSize(size);
     opt = &utility_renderer_opts_[ui_selected_points_renderer_ptr_];
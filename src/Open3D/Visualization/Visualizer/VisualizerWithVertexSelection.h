@@ -39,6 +39,7 @@ class PointCloud;
 namespace visualization {
 class SelectionPolygon;
 class PointCloudPicker;
+class PickingBuffer;
 
 class VisualizerWithVertexSelection : public Visualizer {
 public:
@@ -119,6 +120,10 @@ protected:
     std::shared_ptr<glsl::GeometryRenderer> geometry_renderer_ptr_;
 
     RenderOption pick_point_opts_;
+    /// Pick color codes of ui_points_geometry_ptr_, redrawn only when the
+    /// view or the geometry changed.
+    std::shared_ptr<PickingBuffer> picking_buffer_ptr_;
+    std::shared_ptr<glsl::PointCloudPickingRenderer> picking_renderer_ptr_;
 
     std::shared_ptr<geometry::PointCloud> ui_points_geometry_ptr_;
     std::shared_ptr<glsl::GeometryRenderer> ui_points_renderer_ptr_;
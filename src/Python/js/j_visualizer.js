@@ -32,6 +32,43 @@ var OrbitControls = require("three-orbit-controls")(THREE);
 // Webpack automatically resolves path for assets
 import disc_path from "./assets/disc.png";
 
+// Returns the typed array of type dtype stored in a binary buffer received from
+// Python, which is a DataView (or ArrayBuffer) over the message.
+function toTypedArray(buffer, dtype) {
+    let types = {
+        float32: Float32Array,
+        uint32: Uint32Array,
+        uint16: Uint16Array,
+        uint8: Uint8Array,
+        int8: Int8Array
+    };
+    let Type = types[dtype];
+    if (Type === undefined) {
+        throw "Unsupported dtype " + dtype;
+    }
+    let array_buffer = buffer.buffer !== undefined ? buffer.buffer : buffer;
+    let offset = buffer.byteOffset || 0;
+    let length = buffer.byteLength;
+    if (offset % Type.BYTES_PER_ELEMENT != 0) {
+        // Typed arrays need aligned views
+        array_buffer = array_buffer.slice(offset, offset + length);
+        offset = 0;
+    }
+    return new Type(array_buffer, offset, length / Type.BYTES_PER_ELEMENT);
+}
+
+// Returns the BufferAttribute of the geometry_json array with the given key,
+// or null if the geometry has no such array. Quantized integer attributes are
+// normalized, i.e. mapped to [0, 1] (or [-1, 1] if signed) by the shader.
+function toBufferAttribute(geometry_json, key, item_size) {
+    if (geometry_json[key] === undefined) {
+        return null;
+    }
+    let dtype = geometry_json["dtypes"][key];
+    let array = toTypedArray(geometry_json[key], dtype);
+    return new THREE.BufferAttribute(array, item_size, dtype != "float32");
+}
+
 var JVisualizerModel = widgets.DOMWidgetModel.extend({
     defaults: _.extend(widgets.DOMWidgetModel.prototype.defaults(), {
         _model_name: "JVisualizerModel",
@@ -41,7 +78,37 @@ var JVisualizerModel = widgets.DOMWidgetModel.extend({
         _view_module: "open3d",
         _view_module_version: "@PROJECT_VERSION_THREE_NUMBER@",
         geometry_jsons: []
-    })
+    }),
+
+    initialize: function() {
+        widgets.DOMWidgetModel.prototype.initialize.apply(this, arguments);
+        this.on("msg:custom", this.onCustomMessage, this);
+    },
+
+    // Applies the incremental updates sent by JVisualizer to geometry_jsons.
+    // The views are notified by the change event. The values are not synced
+    // back to Python, which already has them.
+    onCustomMessage: function(content, buffers) {
+        let geometry_jsons = this.get("geometry_jsons").slice();
+        switch (content.type) {
+            case "set_geometry":
+                let geometry_json = _.clone(content.geometry);
+                _.each(geometry_json, function(value, key) {
+                    if (value && value.buffer_index !== undefined) {
+                        geometry_json[key] = buffers[value.buffer_index];
+                    }
+                });
+                geometry_jsons[content.index] = geometry_json;
+                break;
+            case "remove_geometry":
+                geometry_jsons.splice(content.index, 1);
+                break;
+            default:
+                console.error("ERROR: invalid custom message", content);
+                return;
+        }
+        this.set("geometry_jsons", geometry_jsons);
+    }
 });
 
 var JVisualizerView = widgets.DOMWidgetView.extend({
@@ -49,14 +116,22 @@ var JVisualizerView = widgets.DOMWidgetView.extend({
     control: null,
     scene: null,
     renderer: null,
-    geometry: null,
 
     initialize: function() {
         // TODO: fix frozen issue when creating multiple views
         widgets.DOMWidgetView.prototype.initialize.apply(this, arguments);
+        // Geometry Jsons and the objects created from them, to only recreate
+        // the objects of changed geometries
+        this.geometry_jsons = [];
+        this.objects = [];
     },
 
     remove: function() {
+        this.stopped = true;
+        this.updateObjects([]);
+        if (this.renderer) {
+            this.renderer.dispose();
+        }
         widgets.DOMWidgetView.prototype.remove.apply(this, arguments);
     },
 
@@ -67,63 +142,10 @@ var JVisualizerView = widgets.DOMWidgetView.extend({
         this.renderer = new THREE.WebGLRenderer({ alpha: true });
         this.renderer.setSize(800, 600);
 
-        // Collect vertices from point clouds
-        // TODO: handle different geometries
-        // TODO: handle multiple geometries, some with color, some without
-        let vertices = [];
-        let colors = [];
-        var geometry_idx;
-        for (
-            geometry_idx = 0;
-            geometry_idx < this.model.get("geometry_jsons").length;
-            geometry_idx++
-        ) {
-            let geometry_json = this.model.get("geometry_jsons")[geometry_idx];
-            if (geometry_json["type"] != "PointCloud") {
-                throw "Only support PointCloud in JS currently.";
-            }
-            // TODO: speed up
-            for (var i = 0; i < geometry_json["points"].length; i++) {
-                vertices.push(geometry_json["points"][i]);
-            }
-            for (var i = 0; i < geometry_json["colors"].length; i++) {
-                colors.push(geometry_json["colors"][i]);
-            }
-        }
-
-        // Geometry
-        this.geometry = new THREE.BufferGeometry();
-        this.geometry.addAttribute(
-            "position",
-            new THREE.Float32BufferAttribute(vertices, 3)
-        );
-        if (colors.length != 0) {
-            this.geometry.addAttribute(
-                "color",
-                new THREE.Float32BufferAttribute(colors, 3)
-            );
-        }
-
-        // Material
-        let sprite = new THREE.TextureLoader().load(disc_path);
-        let material = new THREE.PointsMaterial({
-            size: 10,
-            sizeAttenuation: false,
-            map: sprite,
-            alphaTest: 0.5,
-            transparent: true
-        });
-        if (colors.length != 0) {
-            material.vertexColors = THREE.VertexColors;
-        } else {
-            material.color.setRGB(0, 0, 0);
-        }
-        let particles = new THREE.Points(this.geometry, material);
-
         // Scene
         this.scene = new THREE.Scene();
-        this.scene.add(particles);
         this.scene.background = null;
+        this.scene.add(new THREE.AmbientLight(0xffffff, 0.4));
 
         // Camera
         this.camera = new THREE.PerspectiveCamera(
@@ -134,16 +156,132 @@ var JVisualizerView = widgets.DOMWidgetView.extend({
         );
         this.camera.position.set(0, 0, 1);
         this.camera.lookAt(this.scene.position);
+        // Headlight
+        let light = new THREE.DirectionalLight(0xffffff, 0.6);
+        this.camera.add(light);
+        this.scene.add(this.camera);
 
         // Control
         this.controls = new OrbitControls(
             this.camera,
             this.renderer.domElement
         );
+
+        this.sprite = new THREE.TextureLoader().load(disc_path);
+    },
+
+    createObject: function(geometry_json) {
+        let geometry = new THREE.BufferGeometry();
+        let position_key =
+            geometry_json["type"] == "TriangleMesh" ? "vertices" : "points";
+        geometry.addAttribute(
+            "position",
+            toBufferAttribute(geometry_json, position_key, 3)
+        );
+        let color_key =
+            geometry_json["type"] == "TriangleMesh"
+                ? "vertex_colors"
+                : "colors";
+        let colors = toBufferAttribute(geometry_json, color_key, 3);
+        if (colors) {
+            geometry.addAttribute("color", colors);
+        }
+
+        let object;
+        switch (geometry_json["type"]) {
+            case "PointCloud":
+                object = new THREE.Points(
+                    geometry,
+                    new THREE.PointsMaterial({
+                        size: 10,
+                        sizeAttenuation: false,
+                        map: this.sprite,
+                        alphaTest: 0.5,
+                        transparent: true
+                    })
+                );
+                break;
+            case "TriangleMesh":
+                geometry.setIndex(
+                    toBufferAttribute(geometry_json, "triangles", 1)
+                );
+                let normals = toBufferAttribute(
+                    geometry_json,
+                    "vertex_normals",
+                    3
+                );
+                if (normals) {
+                    geometry.addAttribute("normal", normals);
+                } else {
+                    // The normals are computed from the positions before
+                    // dequantization, which is a uniform scale and keeps them
+                    geometry.computeVertexNormals();
+                }
+                object = new THREE.Mesh(
+                    geometry,
+                    new THREE.MeshPhongMaterial({ side: THREE.DoubleSide })
+                );
+                break;
+            case "LineSet":
+                object = new THREE.LineSegments(
+                    geometry,
+                    new THREE.LineBasicMaterial()
+                );
+                break;
+            default:
+                throw "Unsupported geometry type " + geometry_json["type"];
+        }
+        if (colors) {
+            object.material.vertexColors = THREE.VertexColors;
+        } else if (geometry_json["type"] == "TriangleMesh") {
+            object.material.color.setRGB(0.7, 0.7, 0.7);
+        } else {
+            object.material.color.setRGB(0, 0, 0);
+        }
+
+        // Quantized positions are normalized to [0, 1] in the bounding box
+        if (geometry_json["scale"] !== undefined) {
+            let scale = geometry_json["scale"];
+            object.scale.set(scale, scale, scale);
+            object.position.fromArray(geometry_json["offset"]);
+        }
+        return object;
+    },
+
+    disposeObject: function(object) {
+        this.scene.remove(object);
+        object.geometry.dispose();
+        object.material.dispose();
+    },
+
+    // Recreates only the objects whose geometry Json changed
+    updateObjects: function(geometry_jsons) {
+        let objects = [];
+        for (let i = 0; i < geometry_jsons.length; i++) {
+            let old_idx = this.geometry_jsons.indexOf(geometry_jsons[i]);
+            if (old_idx >= 0 && this.objects[old_idx]) {
+                objects.push(this.objects[old_idx]);
+                this.objects[old_idx] = null;
+            } else {
+                let object = this.createObject(geometry_jsons[i]);
+                this.scene.add(object);
+                objects.push(object);
+            }
+        }
+        for (let i = 0; i < this.objects.length; i++) {
+            if (this.objects[i]) {
+                this.disposeObject(this.objects[i]);
+            }
+        }
+        this.geometry_jsons = geometry_jsons.slice();
+        this.objects = objects;
     },
 
     animate: function() {
         // console.log("[called] animate")
+        if (this.stopped) {
+            return;
+        }
         let self = this;
         requestAnimationFrame(function() {
             self.animate();
@@ -160,37 +298,17 @@ var JVisualizerView = widgets.DOMWidgetView.extend({
     // Called at IPython.display, i.e. at JVisualizer.show()
     render: function() {
         console.log("[called] render");
-        this.setupEventListeners();
+        this.initEnvironment();
         this.valueChanged();
         this.model.on("change:geometry_jsons", this.valueChanged, this);
 
-        this.initEnvironment();
         this.el.appendChild(this.renderer.domElement);
         this.animate();
     },
 
     valueChanged: function() {
         console.log("[called] valueChanged");
-        this.initEnvironment();
-    },
-
-    // TODO: consider using this mechanism to send geometry data
-    setupEventListeners: function() {
-        this.listenTo(
-            this.model,
-            "msg:custom",
-            this.onCustomMessage.bind(this)
-        );
-    },
-
-    onCustomMessage: function(content, buffers) {
-        switch (content.type) {
-            // case "dog":
-            //     console.log("dog received with name " + content.name);
-            //     break;
-            default:
-                console.error("ERROR: invalid custom message", content);
-        }
+        this.updateObjects(this.model.get("geometry_jsons"));
     }
 });
 
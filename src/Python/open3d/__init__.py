@@ -58,6 +58,7 @@ from open3d.open3d_pybind import Dtype
 from open3d.open3d_pybind import Device
 from open3d.open3d_pybind import DtypeUtil
 from open3d.open3d_pybind import cuda
+from open3d.open3d_pybind import memory_manager
 from open3d.core import SizeVector
 from open3d.core import Tensor
 from open3d.core import TensorList
@@ -71,7 +72,25 @@ if int(sys.version_info[0]) < 3:
     raise Exception("Open3D only supports Python 3.")
 
 if "@ENABLE_JUPYTER@" == "ON":
-    from .j_visualizer import *
+    # The Jupyter visualizer pulls in ipywidgets and IPython, which take a
+    # noticeable time to import, so it is only loaded when it is first used.
+    # Module level __getattr__ requires Python 3.7 (PEP 562).
+    _j_visualizer_names = ("JVisualizer", "geometry_to_json")
+
+    if sys.version_info >= (3, 7):
+
+        def __getattr__(name):
+            if name in _j_visualizer_names:
+                from . import j_visualizer
+                return getattr(j_visualizer, name)
+            raise AttributeError("module {!r} has no attribute {!r}".format(
+                __name__, name))
+
+        def __dir__():
+            return sorted(list(globals().keys()) +
+                          list(_j_visualizer_names))
+    else:
+        from .j_visualizer import JVisualizer, geometry_to_json
 
     def _jupyter_nbextension_paths():
         return [{
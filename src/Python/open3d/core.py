@@ -204,6 +204,29 @@ class Tensor(open3d_pybind.Tensor):
         """
         return super(Tensor, self).cpu()
 
+    @cast_to_py_tensor
+    def shard(self, devices, sizes=None):
+        """
+        Splits this tensor along dimension 0 into one shard per device.
+
+        Args:
+            devices: List of o3d.Device, the device of each shard.
+            sizes: List of shard sizes along dimension 0. If None, the shards
+                   are of (almost) equal size.
+        """
+        if sizes is None:
+            sizes = []
+        return super(Tensor, self).shard(devices, sizes)
+
+    @staticmethod
+    @cast_to_py_tensor
+    def from_shards(shards, device):
+        """
+        Concatenates tensors along dimension 0 into a new tensor on `device`.
+        The shards may be on different devices.
+        """
+        return super(Tensor, Tensor).from_shards(shards, device)
+
     def numpy(self):
         """
         Returns this tensor as a NumPy array. This tensor must be a CPU tensor,
@@ -236,15 +259,40 @@ class Tensor(open3d_pybind.Tensor):
     @cast_to_py_tensor
     def from_dlpack(dlpack):
         """
-        Returns a tensor converted from DLPack PyCapsule.
+        Returns a tensor converted from DLPack PyCapsule, or from an object
+        implementing ``__dlpack__``, e.g. a PyTorch or CuPy tensor. No copy is
+        performed.
         """
         return super(Tensor, Tensor).from_dlpack(dlpack)
 
+    @staticmethod
+    @cast_to_py_tensor
+    def from_cuda_array_interface(obj):
+        """
+        Returns a CUDA tensor sharing memory with an object implementing
+        ``__cuda_array_interface__``, e.g. a CuPy array. The object is kept
+        alive as long as the tensor references its memory.
+
+        Args:
+            obj: The object to be converted from.
+        """
+        return super(Tensor, Tensor).from_cuda_array_interface(obj)
+
+    def _to_tensor(self, value):
+        if isinstance(value, open3d_pybind.Tensor):
+            return value
+        return Tensor.full((), value, self.dtype, self.device)
+
     @cast_to_py_tensor
-    def add(self, value):
+    def add(self, value, out=None):
         """
         Adds a tensor and returns the resulting tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).add(self._to_tensor(value), out)
         return super(Tensor, self).add(value)
 
     @cast_to_py_tensor
@@ -255,10 +303,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).add_(value)
 
     @cast_to_py_tensor
-    def sub(self, value):
+    def sub(self, value, out=None):
         """
         Substracts a tensor and returns the resulting tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).sub(self._to_tensor(value), out)
         return super(Tensor, self).sub(value)
 
     @cast_to_py_tensor
@@ -269,10 +322,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).sub_(value)
 
     @cast_to_py_tensor
-    def mul(self, value):
+    def mul(self, value, out=None):
         """
         Multiplies a tensor and returns the resulting tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).mul(self._to_tensor(value), out)
         return super(Tensor, self).mul(value)
 
     @cast_to_py_tensor
@@ -283,10 +341,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).mul_(value)
 
     @cast_to_py_tensor
-    def div(self, value):
+    def div(self, value, out=None):
         """
         Divides a tensor and returns the resulting tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).div(self._to_tensor(value), out)
         return super(Tensor, self).div(value)
 
     @cast_to_py_tensor
@@ -297,10 +360,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).div_(value)
 
     @cast_to_py_tensor
-    def abs(self):
+    def abs(self, out=None):
         """
         Returns element-wise absolute value of a tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).abs(out)
         return super(Tensor, self).abs()
 
     @cast_to_py_tensor
@@ -311,13 +379,18 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).abs_()
 
     @cast_to_py_tensor
-    def logical_and(self, value):
+    def logical_and(self, value, out=None):
         """
         Element-wise logical and operation.
 
         If the tensor is not boolean, zero will be treated as False, while
         non-zero values will be treated as True.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).logical_and(value, out)
         return super(Tensor, self).logical_and(value)
 
     @cast_to_py_tensor
@@ -330,13 +403,18 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).logical_and_(value)
 
     @cast_to_py_tensor
-    def logical_or(self, value):
+    def logical_or(self, value, out=None):
         """
         Element-wise logical or operation.
 
         If the tensor is not boolean, zero will be treated as False, while
         non-zero values will be treated as True.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).logical_or(value, out)
         return super(Tensor, self).logical_or(value)
 
     @cast_to_py_tensor
@@ -349,13 +427,18 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).logical_or_(value)
 
     @cast_to_py_tensor
-    def logical_xor(self, value):
+    def logical_xor(self, value, out=None):
         """
         Element-wise logical exclusive-or operation.
 
         If the tensor is not boolean, zero will be treated as False, while
         non-zero values will be treated as True.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).logical_xor(value, out)
         return super(Tensor, self).logical_xor(value)
 
     @cast_to_py_tensor
@@ -368,10 +451,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).logical_xor_(value)
 
     @cast_to_py_tensor
-    def gt(self, value):
+    def gt(self, value, out=None):
         """
         Element-wise greater than operation, returning a new boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).gt(value, out)
         return super(Tensor, self).gt(value)
 
     @cast_to_py_tensor
@@ -384,10 +472,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).gt_(value)
 
     @cast_to_py_tensor
-    def lt(self, value):
+    def lt(self, value, out=None):
         """
         Element-wise less than operation, returning a new boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).lt(value, out)
         return super(Tensor, self).lt(value)
 
     @cast_to_py_tensor
@@ -400,11 +493,16 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).lt_(value)
 
     @cast_to_py_tensor
-    def ge(self, value):
+    def ge(self, value, out=None):
         """
         Element-wise greater-than-or-equals-to operation, returning a new
         boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).ge(value, out)
         return super(Tensor, self).ge(value)
 
     @cast_to_py_tensor
@@ -417,11 +515,16 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).ge_(value)
 
     @cast_to_py_tensor
-    def le(self, value):
+    def le(self, value, out=None):
         """
         Element-wise less-than-or-equals-to than operation, returning a new
         boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).le(value, out)
         return super(Tensor, self).le(value)
 
     @cast_to_py_tensor
@@ -434,10 +537,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).le_(value)
 
     @cast_to_py_tensor
-    def eq(self, value):
+    def eq(self, value, out=None):
         """
         Element-wise equal operation, returning a new boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).eq(value, out)
         return super(Tensor, self).eq(value)
 
     @cast_to_py_tensor
@@ -450,10 +558,15 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).eq_(value)
 
     @cast_to_py_tensor
-    def ne(self, value):
+    def ne(self, value, out=None):
         """
         Element-wise not-equal operation, returning a new boolean tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).ne(value, out)
         return super(Tensor, self).ne(value)
 
     @cast_to_py_tensor
@@ -466,7 +579,7 @@ class Tensor(open3d_pybind.Tensor):
         return super(Tensor, self).ne_(value)
 
     @cast_to_py_tensor
-    def to(self, dtype, copy=False):
+    def to(self, dtype, copy=False, out=None):
         """
         Returns a tensor with the specified dtype.
 
@@ -475,7 +588,11 @@ class Tensor(open3d_pybind.Tensor):
             copy: If true, a new tensor is always created; if false, the copy
                   is avoided when the original tensor already have the targeted
                   dtype.
+            out: If given, the converted values are written to this
+                 preallocated tensor, which is returned.
         """
+        if out is not None:
+            return super(Tensor, self).to(dtype, out)
         return super(Tensor, self).to(dtype, copy)
 
     @cast_to_py_tensor
@@ -547,38 +664,53 @@ class Tensor(open3d_pybind.Tensor):
                 "dim must be int, list or tuple, but was {}.".format(type(dim)))
 
     @cast_to_py_tensor
-    def sum(self, dim=None, keepdim=False):
+    def sum(self, dim=None, keepdim=False, out=None):
         """
         Returns the sum along each the specified dimension `dim`. If `dim` is
         None, the reduction happens for all elements of the tensor. If `dim` is
         a list or tuple, the reduction happens in all of the specified `dim`.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         dim = self._reduction_dim_to_size_vector(dim)
+        if out is not None:
+            return super(Tensor, self).sum(dim, keepdim, out)
         return super(Tensor, self).sum(dim, keepdim)
 
     @cast_to_py_tensor
-    def mean(self, dim=None, keepdim=False):
+    def mean(self, dim=None, keepdim=False, out=None):
         """
         Returns the mean along each the specified dimension `dim`. If `dim` is
         None, the reduction happens for all elements of the tensor. If `dim` is
         a list or tuple, the reduction happens in all of the specified `dim`.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         dim = self._reduction_dim_to_size_vector(dim)
+        if out is not None:
+            return super(Tensor, self).mean(dim, keepdim, out)
         return super(Tensor, self).mean(dim, keepdim)
 
     @cast_to_py_tensor
-    def prod(self, dim=None, keepdim=False):
+    def prod(self, dim=None, keepdim=False, out=None):
         """
         Returns the product along each the specified dimension `dim`. If
         `dim` is None, the reduction happens for all elements of the tensor.
         If `dim` is a list or tuple, the reduction happens in all of the
         specified `dim`.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         dim = self._reduction_dim_to_size_vector(dim)
+        if out is not None:
+            return super(Tensor, self).prod(dim, keepdim, out)
         return super(Tensor, self).prod(dim, keepdim)
 
     @cast_to_py_tensor
-    def min(self, dim=None, keepdim=False):
+    def min(self, dim=None, keepdim=False, out=None):
         """
         Returns the min along each the specified dimension `dim`. If
         `dim` is None, the reduction happens for all elements of the tensor.
@@ -586,12 +718,17 @@ class Tensor(open3d_pybind.Tensor):
         specified `dim`.
 
         Throws exception if the tensor has 0 element.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         dim = self._reduction_dim_to_size_vector(dim)
+        if out is not None:
+            return super(Tensor, self).min(dim, keepdim, out)
         return super(Tensor, self).min(dim, keepdim)
 
     @cast_to_py_tensor
-    def max(self, dim=None, keepdim=False):
+    def max(self, dim=None, keepdim=False, out=None):
         """
         Returns the max along each the specified dimension `dim`. If
         `dim` is None, the reduction happens for all elements of the tensor.
@@ -599,12 +736,39 @@ class Tensor(open3d_pybind.Tensor):
         specified `dim`.
 
         Throws exception if the tensor has 0 element.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         dim = self._reduction_dim_to_size_vector(dim)
+        if out is not None:
+            return super(Tensor, self).max(dim, keepdim, out)
         return super(Tensor, self).max(dim, keepdim)
 
     @cast_to_py_tensor
-    def argmin(self, dim=None):
+    def min_max(self, dim=None, keepdim=False):
+        """
+        Returns a tuple (min, max) along the specified dimension `dim`,
+        computed in a single pass over the tensor. `dim` is interpreted as in
+        `min`.
+
+        Throws exception if the tensor has 0 element.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).min_max(dim, keepdim)
+
+    @cast_to_py_tensor
+    def mean_var(self, dim=None, keepdim=False):
+        """
+        Returns a tuple (mean, var) along the specified dimension `dim`,
+        computed in a single pass over the tensor. `var` is the population
+        variance. `dim` is interpreted as in `mean`.
+        """
+        dim = self._reduction_dim_to_size_vector(dim)
+        return super(Tensor, self).mean_var(dim, keepdim)
+
+    @cast_to_py_tensor
+    def argmin(self, dim=None, out=None):
         """
         Returns minimum index of the tensor along the specified dimension. The
         returned tensor has dtype int64_t, and has the same shape as original
@@ -612,6 +776,9 @@ class Tensor(open3d_pybind.Tensor):
 
         Only one reduction dimension can be specified. If the specified
         dimension is None, the index is into the flattend tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         if dim is None:
             dim = self._reduction_dim_to_size_vector(list(range(self.ndim)))
@@ -619,10 +786,12 @@ class Tensor(open3d_pybind.Tensor):
             dim = self._reduction_dim_to_size_vector([dim])
         else:
             raise TypeError("dim must be int or None, but got {}".format(dim))
+        if out is not None:
+            return super(Tensor, self).argmin_(dim, out)
         return super(Tensor, self).argmin_(dim)
 
     @cast_to_py_tensor
-    def argmax(self, dim=None):
+    def argmax(self, dim=None, out=None):
         """
         Returns maximum index of the tensor along the specified dimension. The
         returned tensor has dtype int64_t, and has the same shape as original
@@ -630,6 +799,9 @@ class Tensor(open3d_pybind.Tensor):
 
         Only one reduction dimension can be specified. If the specified
         dimension is None, the index is into the flattend tensor.
+
+        If `out` is given, the result is written to the preallocated tensor
+        `out`, which is returned.
         """
         if dim is None:
             dim = self._reduction_dim_to_size_vector(list(range(self.ndim)))
@@ -637,8 +809,42 @@ class Tensor(open3d_pybind.Tensor):
             dim = self._reduction_dim_to_size_vector([dim])
         else:
             raise TypeError("dim must be int or None, but got {}".format(dim))
+        if out is not None:
+            return super(Tensor, self).argmax_(dim, out)
         return super(Tensor, self).argmax_(dim)
 
+    @cast_to_py_tensor
+    def argsort(self):
+        """
+        Returns the int64 indices that sort the 1-D tensor in ascending order.
+        The sort is stable.
+        """
+        return super(Tensor, self).argsort()
+
+    @cast_to_py_tensor
+    def sort(self):
+        """
+        Returns the 1-D tensor sorted in ascending order.
+        """
+        return super(Tensor, self).sort()
+
+    @cast_to_py_tensor
+    def unique(self):
+        """
+        Returns a tuple (values, inverse_indices, counts) of the 1-D tensor,
+        where `values` are the sorted unique values and
+        `values[inverse_indices]` is the original tensor.
+        """
+        return super(Tensor, self).unique()
+
+    @cast_to_py_tensor
+    def cumsum(self, dim, exclusive=False):
+        """
+        Returns the cumulative sum along `dim`. If `exclusive` is True, the
+        i-th output is the sum of the elements before the i-th one.
+        """
+        return super(Tensor, self).cumsum(dim, exclusive)
+
     def __lt__(self, value):
         return self.lt(value)
 
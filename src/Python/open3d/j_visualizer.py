@@ -25,30 +25,129 @@
 # ----------------------------------------------------------------------------
 
 import ipywidgets as widgets
-from traitlets import Unicode, Float, List, Instance
+from traitlets import Unicode, Float, List, Instance, Bool
 from IPython.display import display
 import open3d as o3
 import numpy as np
 
 
-def geometry_to_json(geometry):
-    """Convert Open3D geometry to Json (Dict)"""
-    json = dict()
+def _to_buffer(array, dtype):
+    """Returns array as a flat memoryview, which ipywidgets sends as a binary
+    buffer instead of JSON text."""
+    return memoryview(np.ascontiguousarray(array, dtype=dtype).reshape(-1))
+
+
+def _encode_positions(json, key, positions, quantize):
+    if not quantize or len(positions) == 0:
+        json[key] = _to_buffer(positions, np.float32)
+        json['dtypes'][key] = 'float32'
+        return
+    # Quantize relative to the bounding box with the same scale on all axes,
+    # so that the normals do not need to be rescaled.
+    min_bound = positions.min(axis=0)
+    scale = max(float((positions.max(axis=0) - min_bound).max()), 1e-12)
+    json[key] = _to_buffer(np.rint((positions - min_bound) / scale * 65535),
+                           np.uint16)
+    json['dtypes'][key] = 'uint16'
+    json['offset'] = min_bound.tolist()
+    json['scale'] = scale
+
+
+def _encode_colors(json, key, colors, quantize):
+    if quantize:
+        json[key] = _to_buffer(np.rint(np.clip(colors, 0, 1) * 255), np.uint8)
+        json['dtypes'][key] = 'uint8'
+    else:
+        json[key] = _to_buffer(colors, np.float32)
+        json['dtypes'][key] = 'float32'
+
+
+def _encode_normals(json, key, normals, quantize):
+    if quantize:
+        json[key] = _to_buffer(np.rint(np.clip(normals, -1, 1) * 127),
+                               np.int8)
+        json['dtypes'][key] = 'int8'
+    else:
+        json[key] = _to_buffer(normals, np.float32)
+        json['dtypes'][key] = 'float32'
+
+
+def geometry_to_json(geometry, quantize=False):
+    """Convert Open3D geometry to Json (Dict)
+
+    The arrays are stored as flat binary buffers (memoryview) in the dict,
+    which ipywidgets transfers without converting them to text. Their element
+    types are listed in json['dtypes']. Supports PointCloud, TriangleMesh and
+    LineSet.
+
+    Args:
+        geometry: The geometry to convert.
+        quantize (bool): Send the positions as uint16 relative to the bounding
+            box, the colors as uint8 and the normals as int8 instead of
+            float32. This reduces the size 2-4 times. The positions are
+            restored with json['offset'] and json['scale'].
+    """
+    json = {'dtypes': {}}
     if isinstance(geometry, o3.geometry.PointCloud):
         json['type'] = 'PointCloud'
-        # TODO: do not flatten
-        json['points'] = np.asarray(geometry.points,
-                                    dtype=np.float32).reshape(-1).tolist()
-        json['colors'] = np.asarray(geometry.colors,
-                                    dtype=np.float32).reshape(-1).tolist()
+        _encode_positions(json, 'points', np.asarray(geometry.points),
+                          quantize)
+        if geometry.has_colors():
+            _encode_colors(json, 'colors', np.asarray(geometry.colors),
+                           quantize)
+    elif isinstance(geometry, o3.geometry.TriangleMesh):
+        json['type'] = 'TriangleMesh'
+        _encode_positions(json, 'vertices', np.asarray(geometry.vertices),
+                          quantize)
+        json['triangles'] = _to_buffer(geometry.triangles, np.uint32)
+        json['dtypes']['triangles'] = 'uint32'
+        if geometry.has_vertex_colors():
+            _encode_colors(json, 'vertex_colors',
+                           np.asarray(geometry.vertex_colors), quantize)
+        if geometry.has_vertex_normals():
+            _encode_normals(json, 'vertex_normals',
+                            np.asarray(geometry.vertex_normals), quantize)
+    elif isinstance(geometry, o3.geometry.LineSet):
+        # Lines are drawn as segments between duplicated end points, because
+        # their colors are per line.
+        json['type'] = 'LineSet'
+        lines = np.asarray(geometry.lines)
+        _encode_positions(json, 'points',
+                          np.asarray(geometry.points)[lines].reshape(-1, 3),
+                          quantize)
+        if geometry.has_colors():
+            _encode_colors(json, 'colors',
+                           np.repeat(np.asarray(geometry.colors), 2, axis=0),
+                           quantize)
     else:
         raise NotImplementedError(
-            "Only supporting geometry_to_json for PointCloud")
+            "Only supporting geometry_to_json for PointCloud, TriangleMesh "
+            "and LineSet")
     return json
 
 
+def _split_buffers(json):
+    """Moves the binary buffers of a geometry Json out of it for
+    Widget.send(), which only sends buffers passed separately."""
+    content = dict(json)
+    buffers = []
+    for key, value in json.items():
+        if isinstance(value, memoryview):
+            content[key] = {'buffer_index': len(buffers)}
+            buffers.append(value)
+    return content, buffers
+
+
 @widgets.register
 class JVisualizer(widgets.DOMWidget):
+    """Jupyter widget displaying Open3D geometries.
+
+    The geometries are sent to the browser as binary buffers. Adding,
+    updating or removing a geometry only sends that geometry.
+
+    Args:
+        quantize (bool): Default for add_geometry(). See geometry_to_json().
+    """
     _view_name = Unicode('JVisualizerView').tag(sync=True)
     _view_module = Unicode('open3d').tag(sync=True)
     _view_module_version = Unicode('~@PROJECT_VERSION_THREE_NUMBER@').tag(
@@ -61,33 +160,67 @@ class JVisualizer(widgets.DOMWidget):
     # We need to declare class attributes for traitlets to work
     geometry_jsons = List(Instance(dict)).tag(sync=True)
 
-    def __init__(self):
+    def __init__(self, quantize=False):
         super(JVisualizer, self).__init__()
         self.geometry_jsons = []
         self.geometries = []
+        self.quantize = quantize
+        self._quantize = []
 
     def __repr__(self):
         return "JVisualizer with %s geometries" % len(self.geometry_jsons)
 
-    def add_geometry(self, geometry):
-        # TODO: See if we can use self.send(content=content)
-        #       For some reason self.geometry_jsons has to be directly assigned,
-        #       so we keep track of self.geometries and self.geometry_jsons.
+    # The geometry Jsons are changed in place, which does not sync the whole
+    # list, and the changes are sent to the model in the browser as custom
+    # messages. show() syncs the whole list, e.g. for changes made before the
+    # model in the browser existed.
+    def _send_geometry(self, index):
+        content, buffers = _split_buffers(self.geometry_jsons[index])
+        self.send({
+            'type': 'set_geometry',
+            'index': index,
+            'geometry': content
+        }, buffers)
+
+    def add_geometry(self, geometry, quantize=None):
+        """Adds a geometry and returns its index.
+
+        Args:
+            geometry: PointCloud, TriangleMesh or LineSet.
+            quantize (bool): See geometry_to_json(). Defaults to the quantize
+                argument of the constructor.
+        """
+        if quantize is None:
+            quantize = self.quantize
         self.geometries.append(geometry)
-        self.geometry_jsons = [geometry_to_json(g) for g in self.geometries]
+        self._quantize.append(quantize)
+        self.geometry_jsons.append(geometry_to_json(geometry, quantize))
+        index = len(self.geometries) - 1
+        self._send_geometry(index)
+        return index
+
+    def update_geometry(self, index, geometry=None):
+        """Sends the geometry with the given index again, e.g. after it was
+        modified, or replaces it with geometry."""
+        if geometry is not None:
+            self.geometries[index] = geometry
+        self.geometry_jsons[index] = geometry_to_json(self.geometries[index],
+                                                      self._quantize[index])
+        self._send_geometry(index)
+
+    def remove_geometry(self, index):
+        """Removes the geometry with the given index. The indices of the
+        following geometries decrease by one."""
+        del self.geometries[index]
+        del self._quantize[index]
+        del self.geometry_jsons[index]
+        self.send({'type': 'remove_geometry', 'index': index})
 
     def clear(self):
         self.geometries = []
+        self._quantize = []
         self.geometry_jsons = []
 
-    # TODO: consider using this mechanism to send geometry data
-    # def send_dog(self):
-    #     print("py: sending gwen")
-    #     content = {
-    #         "type": "dog",
-    #         "name": "gwen"
-    #     }
-    #     self.send(content=content)
-
     def show(self):
+        self.send_state('geometry_jsons')
         display(self)
@@ -0,0 +1,113 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+"""Transfer of Open3D objects between processes through shared memory.
+
+Pickling PointCloud, TriangleMesh, Image, RGBDImage, PoseGraph or Feature with
+protocol 5 exposes their buffers out-of-band, so frameworks that support
+out-of-band buffers, e.g. Ray, avoid copying them. For plain
+``multiprocessing``, ``SharedObject`` copies the buffers once into a shared
+memory block and is itself cheap to pickle. The receiving process rebuilds the
+object directly from the shared memory instead of reading the buffers from a
+pipe.
+
+Example usage
+
+.. code-block:: python
+
+    shared = open3d.shared_memory.SharedObject(pcd)
+    with multiprocessing.Pool() as pool:
+        results = pool.map(process, [shared] * 8)  # process calls shared.load()
+    shared.unlink()
+"""
+
+import pickle
+from multiprocessing import shared_memory
+
+
+def _attach(name):
+    try:
+        # Python >= 3.13. Only the creating process should unlink the block.
+        return shared_memory.SharedMemory(name=name, track=False)
+    except TypeError:
+        return shared_memory.SharedMemory(name=name)
+
+
+class SharedObject:
+    """Picklable handle of an object whose buffers live in shared memory.
+
+    The process creating the handle owns the shared memory block and must call
+    ``unlink`` once no process needs to load the object anymore.
+    """
+
+    def __init__(self, obj):
+        buffers = []
+        self._payload = pickle.dumps(obj,
+                                     protocol=5,
+                                     buffer_callback=buffers.append)
+        raw_buffers = [buffer.raw() for buffer in buffers]
+        self._sizes = [raw.nbytes for raw in raw_buffers]
+        self._shm = shared_memory.SharedMemory(create=True,
+                                               size=max(1, sum(self._sizes)))
+        offset = 0
+        for raw, size in zip(raw_buffers, self._sizes):
+            self._shm.buf[offset:offset + size] = raw.cast('B')
+            offset += size
+        self.name = self._shm.name
+
+    def __getstate__(self):
+        return self._payload, self._sizes, self.name
+
+    def __setstate__(self, state):
+        self._payload, self._sizes, self.name = state
+        self._shm = None
+
+    def load(self):
+        """Returns a new copy of the shared object."""
+        shm = self._shm if self._shm is not None else _attach(self.name)
+        views = []
+        offset = 0
+        for size in self._sizes:
+            views.append(shm.buf[offset:offset + size])
+            offset += size
+        obj = pickle.loads(self._payload, buffers=views)
+        try:
+            for view in views:
+                view.release()
+        except BufferError:
+            # The object references the shared memory, e.g. a numpy array.
+            return obj
+        if shm is not self._shm:
+            shm.close()
+        return obj
+
+    def unlink(self):
+        """Frees the shared memory block. Only valid in the owning process."""
+        if self._shm is None:
+            raise RuntimeError("Only the owner of a SharedObject can unlink "
+                               "it.")
+        self._shm.close()
+        self._shm.unlink()
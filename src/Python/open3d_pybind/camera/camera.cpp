@@ -68,6 +68,13 @@ void pybind_camera_classes(py::module &m) {
                  "Y-axis principle points")
             .def("get_skew", &camera::PinholeCameraIntrinsic::GetSkew,
                  "Returns the skew.")
+            .def("set_distortion",
+                 &camera::PinholeCameraIntrinsic::SetDistortion, "k1"_a,
+                 "k2"_a, "p1"_a, "p2"_a, "k3"_a = 0.0,
+                 "Set the lens distortion coefficients.")
+            .def("has_distortion",
+                 &camera::PinholeCameraIntrinsic::HasDistortion,
+                 "Returns True iff a distortion coefficient is not 0.")
             .def("is_valid", &camera::PinholeCameraIntrinsic::IsValid,
                  "Returns True iff both the width and height are greater than "
                  "0.")
@@ -80,6 +87,10 @@ void pybind_camera_classes(py::module &m) {
                            "3x3 numpy array: Intrinsic camera matrix ``[[fx, "
                            "0, cx], [0, fy, "
                            "cy], [0, 0, 1]]``")
+            .def_readwrite("distortion_coeffs",
+                           &camera::PinholeCameraIntrinsic::distortion_coeffs_,
+                           "5x1 numpy array: Lens distortion coefficients "
+                           "``[k1, k2, p1, p2, k3]``")
             .def("__repr__", [](const camera::PinholeCameraIntrinsic &c) {
                 return std::string(
                                "camera::PinholeCameraIntrinsic with width = ") +
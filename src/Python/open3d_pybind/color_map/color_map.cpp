@@ -143,6 +143,15 @@ void pybind_color_map_classes(py::module &m) {
                     "visible vertices to fill the invisible vertex. Set to "
                     "``0`` to disable this feature and all invisible vertices "
                     "will be black.")
+            .def_readwrite(
+                    "rigid_vertex_sample_stride",
+                    &color_map::ColorMapOptimizationOption::
+                            rigid_vertex_sample_stride_,
+                    "int: (Default ``1``) Only every "
+                    "``rigid_vertex_sample_stride``-th vertex visible from an "
+                    "image contributes to the rigid optimization of its "
+                    "camera. Set to a value larger than ``1`` to speed up the "
+                    "rigid optimization of large meshes.")
             .def("__repr__", [](const color_map::ColorMapOptimizationOption
                                         &to) {
                 // clang-format off
@@ -157,7 +166,8 @@ void pybind_color_map_classes(py::module &m) {
                     "- depth_threshold_for_discontinuity_check: {}\n"
                     "- half_dilation_kernel_size_for_discontinuity_map: {}\n"
                     "- image_boundary_margin: {}\n"
-                    "- invisible_vertex_color_knn: {}\n",
+                    "- invisible_vertex_color_knn: {}\n"
+                    "- rigid_vertex_sample_stride: {}\n",
                     to.non_rigid_camera_coordinate_,
                     to.number_of_vertical_anchors_,
                     to.non_rigid_anchor_point_weight_,
@@ -167,28 +177,43 @@ void pybind_color_map_classes(py::module &m) {
                     to.depth_threshold_for_discontinuity_check_,
                     to.half_dilation_kernel_size_for_discontinuity_map_,
                     to.image_boundary_margin_,
-                    to.invisible_vertex_color_knn_
+                    to.invisible_vertex_color_knn_,
+                    to.rigid_vertex_sample_stride_
                 );
                 // clang-format on
             });
 }
 
 void pybind_color_map_methods(py::module &m) {
-    m.def("color_map_optimization", &color_map::ColorMapOptimization,
+    m.def("color_map_optimization",
+          (void (*)(geometry::TriangleMesh &,
+                    const std::vector<std::shared_ptr<geometry::RGBDImage>> &,
+                    camera::PinholeCameraTrajectory &,
+                    const color_map::ColorMapOptimizationOption &)) &
+                  color_map::ColorMapOptimization,
           "Function for color mapping of reconstructed scenes via "
           "optimization, "
           "This is implementation of following by paper Q-Y Zhou and V Koltun: "
           "Color Map "
           "optimization for 3D Reconstruction with Consumer Depth Cameras, "
-          "SIGGRAPH 2014.",
+          "SIGGRAPH 2014. imgs_rgbd is the list of RGBD images seen by the "
+          "cameras.",
           "mesh"_a, "imgs_rgbd"_a, "camera"_a,
-          "option"_a = color_map::ColorMapOptimizationOption());
-    docstring::FunctionDocInject(
-            m, "color_map_optimization",
-            {{"mesh", "The input geometry mesh."},
-             {"imgs_rgbd", "A list of RGBD images seen by cameras."},
-             {"camera", "Cameras' parameters."},
-             {"option", "The ColorMap optimization option."}});
+          "option"_a = color_map::ColorMapOptimizationOption(),
+          py::call_guard<py::gil_scoped_release>());
+    m.def("color_map_optimization",
+          (void (*)(geometry::TriangleMesh &,
+                    const color_map::RGBDImageLoader &,
+                    camera::PinholeCameraTrajectory &,
+                    const color_map::ColorMapOptimizationOption &)) &
+                  color_map::ColorMapOptimization,
+          "Function for color mapping of reconstructed scenes via "
+          "optimization, with the RGBD image of camera i returned by "
+          "image_loader(i), so that the images do not all have to be held in "
+          "memory.",
+          "mesh"_a, "image_loader"_a, "camera"_a,
+          "option"_a = color_map::ColorMapOptimizationOption(),
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void pybind_color_map(py::module &m) {
@@ -34,6 +34,7 @@ void pybind_core(py::module &m) {
     pybind_core_blob(m);
     pybind_core_dtype(m);
     pybind_core_device(m);
+    pybind_core_memory_manager(m);
     pybind_core_size_vector(m);
     pybind_core_tensor_key(m);
     pybind_core_tensor(m);
@@ -35,11 +35,13 @@ namespace open3d {
 void pybind_core_dtype(py::module &m) {
     py::enum_<Dtype>(m, "Dtype")
             .value("Undefined", Dtype::Undefined)
+            .value("Float16", Dtype::Float16)
             .value("Float32", Dtype::Float32)
             .value("Float64", Dtype::Float64)
             .value("Int32", Dtype::Int32)
             .value("Int64", Dtype::Int64)
             .value("UInt8", Dtype::UInt8)
+            .value("UInt16", Dtype::UInt16)
             .value("Bool", Dtype::Bool)
             .export_values();
 
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <memory>
+#include <string>
+
+#include "open3d_pybind/core/container.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+#include "Open3D/Core/Device.h"
+#include "Open3D/Core/MemoryManager.h"
+
+namespace open3d {
+
+/// Python context manager for MemoryAllocationSite.
+class PyMemoryAllocationSite {
+public:
+    PyMemoryAllocationSite(const std::string& name) : name_(name) {}
+
+    void Enter() { site_ = std::make_unique<MemoryAllocationSite>(name_); }
+
+    void Exit() { site_.reset(); }
+
+protected:
+    std::string name_;
+    std::unique_ptr<MemoryAllocationSite> site_;
+};
+
+void pybind_core_memory_manager(py::module& m) {
+    py::module m_mm = m.def_submodule(
+            "memory_manager", "Memory usage statistics of Open3D devices.");
+
+    py::class_<MemoryStatistics>(m_mm, "MemoryStatistics",
+                                 "Memory usage statistics of a device, in "
+                                 "requested bytes.")
+            .def_readonly("bytes_in_use", &MemoryStatistics::bytes_in_use_)
+            .def_readonly("peak_bytes_in_use",
+                          &MemoryStatistics::peak_bytes_in_use_)
+            .def_readonly("num_live_allocations",
+                          &MemoryStatistics::num_live_allocations_)
+            .def_readonly("num_allocations",
+                          &MemoryStatistics::num_allocations_)
+            .def_readonly("num_frees", &MemoryStatistics::num_frees_)
+            .def_readonly("size_histogram", &MemoryStatistics::size_histogram_,
+                          "size_histogram[0] counts 0-byte allocations and "
+                          "size_histogram[i] counts sizes in [2^(i - 1), "
+                          "2^i).");
+
+    py::class_<MemoryAllocationRecord>(m_mm, "MemoryAllocationRecord",
+                                       "A live allocation.")
+            .def_property_readonly("ptr",
+                                   [](const MemoryAllocationRecord& record) {
+                                       return reinterpret_cast<uintptr_t>(
+                                               record.ptr_);
+                                   })
+            .def_readonly("byte_size", &MemoryAllocationRecord::byte_size_)
+            .def_readonly("site", &MemoryAllocationRecord::site_);
+
+    py::class_<PyMemoryAllocationSite>(
+            m_mm, "AllocationSite",
+            "Context manager naming the allocations made in its scope if "
+            "site tracking is enabled. Nested sites are joined with '/'.")
+            .def(py::init<const std::string&>(), "name"_a)
+            .def("__enter__",
+                 [](PyMemoryAllocationSite& site) {
+                     site.Enter();
+                     return &site;
+                 })
+            .def("__exit__",
+                 [](PyMemoryAllocationSite& site, py::object, py::object,
+                    py::object) { site.Exit(); });
+
+    m_mm.def("get_statistics", &MemoryManager::GetMemoryStatistics,
+             "Returns memory usage statistics of a device.", "device"_a);
+    m_mm.def("reset_statistics", &MemoryManager::ResetMemoryStatistics,
+             "Resets the peak usage to the current usage and clears the "
+             "counters and the size histogram of a device.",
+             "device"_a);
+    m_mm.def("set_site_tracking_enabled",
+             &MemoryManager::SetSiteTrackingEnabled,
+             "Enable or disable recording of allocation sites.", "enabled"_a);
+    m_mm.def("is_site_tracking_enabled",
+             &MemoryManager::IsSiteTrackingEnabled);
+    m_mm.def("get_live_allocations", &MemoryManager::GetLiveAllocations,
+             "Returns all live allocations of a device.", "device"_a);
+    m_mm.def("empty_cache", &MemoryManager::EmptyCache,
+             "Releases cached blocks that are not in use back to the device.",
+             "device"_a);
+}
+
+}  // namespace open3d
@@ -32,6 +32,7 @@
 #include "open3d_pybind/pybind_utils.h"
 
 #include "Open3D/Core/Blob.h"
+#include "Open3D/Core/CUDAStream.h"
 #include "Open3D/Core/CUDAUtils.h"
 #include "Open3D/Core/Device.h"
 #include "Open3D/Core/Dispatch.h"
@@ -60,9 +61,69 @@ static std::vector<T> ToFlatVector(
     return std::vector<T>(start, start + info.size);
 }
 
+template <typename T>
+static std::vector<T> ArrayToFlatVector(py::array np_array) {
+    return ToFlatVector<T>(np_array);
+}
+
+/// pybind11 has no NumPy dtype for Half, so the array is read as float.
+template <>
+std::vector<Half> ArrayToFlatVector<Half>(py::array np_array) {
+    std::vector<float> values = ToFlatVector<float>(np_array);
+    return std::vector<Half>(values.begin(), values.end());
+}
+
+/// Wraps memory owned by the Python object \p owner as a Tensor without
+/// copying. \p owner is kept alive until the Tensor's Blob is destroyed.
+static Tensor ExternalMemoryToTensor(const SizeVector& shape,
+                                     const SizeVector& strides,
+                                     void* data_ptr,
+                                     Dtype dtype,
+                                     const Device& device,
+                                     py::object owner) {
+    py::object* owner_ref = new py::object(std::move(owner));
+    // The Blob may be destroyed from C++ without holding the GIL.
+    std::function<void(void*)> deleter = [owner_ref](void*) -> void {
+        if (Py_IsInitialized()) {
+            py::gil_scoped_acquire acquire;
+            delete owner_ref;
+        }
+    };
+    auto blob = std::make_shared<Blob>(device, data_ptr, deleter);
+    return Tensor(shape, strides, data_ptr, dtype, blob);
+}
+
+/// Stream encoding of DLPack and the CUDA Array Interface: 1 is the legacy
+/// default stream, 2 the per-thread default stream, other values are
+/// cudaStream_t handles.
+static int64_t StreamToInt(const CUDAStream& stream) {
+    return stream.IsDefault() ? 1
+                              : reinterpret_cast<int64_t>(stream.GetHandle());
+}
+
+static CUDAStream IntToStream(const Device& device, int64_t stream) {
+    // 0 is disallowed by DLPack, but commonly means the default stream.
+    if (stream == 0 || stream == 1) {
+        return CUDAStream::Default(device);
+    }
+    return CUDAStream::FromHandle(device, reinterpret_cast<void*>(stream));
+}
+
+/// Makes future work on \p consumer wait for the work enqueued on
+/// \p producer so far, without blocking the host.
+static void OrderStreams(const CUDAStream& producer,
+                         const CUDAStream& consumer) {
+    if (producer == consumer) {
+        return;
+    }
+    CUDAEvent event(producer.GetDevice());
+    event.Record(producer);
+    consumer.WaitEvent(event);
+}
+
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor, std::shared_ptr<Tensor>> tensor(
-            m, "Tensor",
+            m, "Tensor", py::buffer_protocol(),
             "A Tensor is a view of a data Blob with shape, stride, data_ptr.");
 
     // Constructor from numpy array
@@ -72,7 +133,8 @@ void pybind_core_tensor(py::module& m) {
         SizeVector shape(info.shape.begin(), info.shape.end());
         Tensor t;
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
-            t = Tensor(ToFlatVector<scalar_t>(np_array), shape, dtype, device);
+            t = Tensor(ArrayToFlatVector<scalar_t>(np_array), shape, dtype,
+                       device);
         });
         return t;
     }));
@@ -87,6 +149,13 @@ void pybind_core_tensor(py::module& m) {
     tensor.def_static("full", &Tensor::Full<bool>);
     tensor.def_static("zeros", &Tensor::Zeros);
     tensor.def_static("ones", &Tensor::Ones);
+    tensor.def_static("eye", &Tensor::Eye);
+    tensor.def_static("rand", &Tensor::Rand, "shape"_a,
+                      "dtype"_a = Dtype::Float32, "device"_a = Device("CPU:0"),
+                      "low"_a = 0.0, "high"_a = 1.0, "seed"_a = -1);
+    tensor.def_static("randint", &Tensor::Randint, "low"_a, "high"_a,
+                      "shape"_a, "dtype"_a = Dtype::Int64,
+                      "device"_a = Device("CPU:0"), "seed"_a = -1);
 
     // Tensor copy
     tensor.def("shallow_copy_from", &Tensor::ShallowCopyFrom);
@@ -110,6 +179,18 @@ void pybind_core_tensor(py::module& m) {
             .def("cpu", [](const Tensor& tensor) {
                 return tensor.Copy(Device(Device::DeviceType::CPU, 0));
             });
+    tensor.def("pin_memory", &Tensor::PinMemory);
+    tensor.def("shard", &Tensor::Shard, "devices"_a,
+               "sizes"_a = std::vector<int64_t>());
+    tensor.def_static("from_shards", &Tensor::FromShards, "shards"_a,
+                      "device"_a);
+
+    // Linear algebra
+    tensor.def("matmul", &Tensor::Matmul);
+    tensor.def("__matmul__", &Tensor::Matmul);
+    tensor.def("solve", &Tensor::Solve);
+    tensor.def("inverse", &Tensor::Inverse);
+    tensor.def("is_pinned", &Tensor::IsPinned);
 
     // Buffer I/O for Numpy and DLPack(PyTorch)
     tensor.def("numpy", [](const Tensor& tensor) {
@@ -184,35 +265,82 @@ void pybind_core_tensor(py::module& m) {
             strides[i] /= info.itemsize;
         }
         Dtype dtype = pybind_utils::ArrayFormatToDtype(info.format);
-        Device device("CPU:0");
 
-        // Blob expects an std::function<void(void*)> deleter, a
-        // dummy deleter is used here, since the memory is
-        // managed by numpy.
-        std::function<void(void*)> deleter = [](void*) -> void {};
-        auto blob = std::make_shared<Blob>(device, info.ptr, deleter);
+        // The memory is managed by numpy. The Tensor holds a reference to the
+        // array, such that the array outlives the Tensor.
+        return ExternalMemoryToTensor(shape, strides, info.ptr, dtype,
+                                      Device("CPU:0"), np_array);
+    });
 
-        return Tensor(shape, strides, info.ptr, dtype, blob);
+    // Python buffer protocol, e.g. for np.asarray(tensor) and memoryview.
+    tensor.def_buffer([](Tensor& tensor) -> py::buffer_info {
+        if (tensor.GetDevice().GetType() != Device::DeviceType::CPU) {
+            utility::LogError(
+                    "Can only expose the buffer of a CPU Tensor. Copy "
+                    "Tensor to CPU first.");
+        }
+        int64_t element_byte_size = DtypeUtil::ByteSize(tensor.GetDtype());
+        SizeVector strides = tensor.GetStrides();
+        for (auto& s : strides) {
+            s *= element_byte_size;
+        }
+        SizeVector shape = tensor.GetShape();
+        return py::buffer_info(
+                tensor.GetDataPtr(), element_byte_size,
+                pybind_utils::DtypeToArrayFormat(tensor.GetDtype()),
+                static_cast<py::ssize_t>(shape.size()),
+                std::vector<py::ssize_t>(shape.begin(), shape.end()),
+                std::vector<py::ssize_t>(strides.begin(), strides.end()));
     });
 
-    tensor.def("to_dlpack", [](const Tensor& tensor) {
+    // See PyTorch's torch/csrc/Module.cpp
+    auto dlpack_capsule_destructor = [](PyObject* data) {
+        DLManagedTensor* dl_managed_tensor =
+                (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
+        if (dl_managed_tensor) {
+            // the dl_managed_tensor has not been consumed,
+            // call deleter ourselves
+            dl_managed_tensor->deleter(
+                    const_cast<DLManagedTensor*>(dl_managed_tensor));
+        } else {
+            // The dl_managed_tensor has been consumed
+            // PyCapsule_GetPointer has set an error indicator
+            PyErr_Clear();
+        }
+    };
+
+    tensor.def("to_dlpack", [=](const Tensor& tensor) {
         DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
-        // See PyTorch's torch/csrc/Module.cpp
-        auto capsule_destructor = [](PyObject* data) {
-            DLManagedTensor* dl_managed_tensor =
-                    (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
-            if (dl_managed_tensor) {
-                // the dl_managed_tensor has not been consumed,
-                // call deleter ourselves
-                dl_managed_tensor->deleter(
-                        const_cast<DLManagedTensor*>(dl_managed_tensor));
-            } else {
-                // The dl_managed_tensor has been consumed
-                // PyCapsule_GetPointer has set an error indicator
-                PyErr_Clear();
-            }
-        };
-        return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+        return py::capsule(dl_managed_tensor, "dltensor",
+                           dlpack_capsule_destructor);
+    });
+
+    // DLPack Python protocol. `stream` is the consumer's stream; the data is
+    // made ready on it without blocking the host.
+    tensor.def(
+            "__dlpack__",
+            [=](const Tensor& tensor, py::object stream) {
+                if (tensor.GetDevice().GetType() == Device::DeviceType::CUDA &&
+                    !stream.is_none()) {
+                    int64_t consumer = stream.cast<int64_t>();
+                    if (consumer != -1) {
+                        OrderStreams(
+                                CUDAStream::GetCurrent(tensor.GetDevice()),
+                                IntToStream(tensor.GetDevice(), consumer));
+                    }
+                }
+                return py::capsule(tensor.ToDLPack(), "dltensor",
+                                   dlpack_capsule_destructor);
+            },
+            "stream"_a = py::none());
+
+    tensor.def("__dlpack_device__", [](const Tensor& tensor) {
+        Device device = tensor.GetDevice();
+        DLDeviceType device_type =
+                device.GetType() == Device::DeviceType::CUDA
+                        ? DLDeviceType::kDLGPU
+                        : DLDeviceType::kDLCPU;
+        return py::make_tuple(static_cast<int>(device_type), device.GetID());
     });
 
     tensor.def_static("from_dlpack", [](py::capsule data) {
@@ -232,6 +360,104 @@ void pybind_core_tensor(py::module& m) {
         return t;
     });
 
+    // Consumes any object implementing the DLPack Python protocol, e.g. a
+    // PyTorch or CuPy tensor. The producer makes its data ready on the current
+    // stream.
+    tensor.def_static("from_dlpack", [](py::object obj) {
+        py::tuple dlpack_device = obj.attr("__dlpack_device__")();
+        py::capsule data;
+        if (dlpack_device[0].cast<int>() ==
+            static_cast<int>(DLDeviceType::kDLGPU)) {
+            Device device(Device::DeviceType::CUDA,
+                          dlpack_device[1].cast<int>());
+            data = obj.attr("__dlpack__")(
+                    "stream"_a = StreamToInt(CUDAStream::GetCurrent(device)));
+        } else {
+            data = obj.attr("__dlpack__")();
+        }
+        DLManagedTensor* dl_managed_tensor =
+                static_cast<DLManagedTensor*>(data);
+        Tensor t = Tensor::FromDLPack(dl_managed_tensor);
+        PyCapsule_SetName(data.ptr(), "used_dltensor");
+        return t;
+    });
+
+    // CUDA Array Interface (version 3), used by CuPy and Numba. Raising
+    // AttributeError for CPU tensors lets consumers fall back to other
+    // protocols.
+    tensor.def_property_readonly(
+            "__cuda_array_interface__", [](const Tensor& tensor) {
+                if (tensor.GetDevice().GetType() != Device::DeviceType::CUDA) {
+                    throw py::attribute_error(
+                            "__cuda_array_interface__ is only available for "
+                            "CUDA Tensors.");
+                }
+                int64_t element_byte_size =
+                        DtypeUtil::ByteSize(tensor.GetDtype());
+                py::list shape;
+                py::list strides;
+                for (int64_t i = 0; i < tensor.NumDims(); ++i) {
+                    shape.append(tensor.GetShape(i));
+                    strides.append(tensor.GetStride(i) * element_byte_size);
+                }
+                py::dict array_interface;
+                array_interface["shape"] = py::tuple(shape);
+                array_interface["strides"] = py::tuple(strides);
+                array_interface["typestr"] =
+                        pybind_utils::DtypeToArrayTypestr(tensor.GetDtype());
+                uintptr_t data_ptr =
+                        reinterpret_cast<uintptr_t>(tensor.GetDataPtr());
+                array_interface["data"] = py::make_tuple(data_ptr, false);
+                array_interface["version"] = 3;
+                // Consumers synchronize with the stream producing the data.
+                array_interface["stream"] = StreamToInt(
+                        CUDAStream::GetCurrent(tensor.GetDevice()));
+                return array_interface;
+            });
+
+    tensor.def_static("from_cuda_array_interface", [](py::object obj) {
+        py::dict array_interface = obj.attr("__cuda_array_interface__");
+        // Optional entries may be missing or None.
+        auto has_entry = [&array_interface](const char* key) {
+            return array_interface.contains(key) &&
+                   !array_interface[key].is_none();
+        };
+        if (has_entry("mask")) {
+            utility::LogError("Masked CUDA arrays are not supported.");
+        }
+        SizeVector shape;
+        for (py::handle dim : array_interface["shape"]) {
+            shape.push_back(dim.cast<int64_t>());
+        }
+        Dtype dtype = pybind_utils::ArrayTypestrToDtype(
+                array_interface["typestr"].cast<std::string>());
+        int64_t element_byte_size = DtypeUtil::ByteSize(dtype);
+        SizeVector strides = Tensor::DefaultStrides(shape);
+        if (has_entry("strides")) {
+            strides.clear();
+            for (py::handle stride : array_interface["strides"]) {
+                strides.push_back(stride.cast<int64_t>() / element_byte_size);
+            }
+        }
+        void* data_ptr = reinterpret_cast<void*>(
+                py::tuple(array_interface["data"])[0].cast<uintptr_t>());
+
+        // Zero-sized arrays may have a null pointer without a device.
+        int device_id =
+                data_ptr == nullptr ? 0 : cuda::GetPointerDeviceID(data_ptr);
+        Device device(Device::DeviceType::CUDA, device_id);
+
+        // The producer's pending work on its stream must finish before Open3D
+        // reads the data on the current stream.
+        if (has_entry("stream")) {
+            int64_t producer = array_interface["stream"].cast<int64_t>();
+            OrderStreams(IntToStream(device, producer),
+                         CUDAStream::GetCurrent(device));
+        }
+        return ExternalMemoryToTensor(shape, strides, data_ptr, dtype, device,
+                                      obj);
+    });
+
     tensor.def("_getitem", [](const Tensor& tensor, const TensorKey& tk) {
         return tensor.GetItem(tk);
     });
@@ -251,7 +477,9 @@ void pybind_core_tensor(py::module& m) {
                   const Tensor& value) { return tensor.SetItem(tks, value); });
 
     // Casting
-    tensor.def("to", &Tensor::To);
+    tensor.def("to", (Tensor(Tensor::*)(Dtype, bool) const) & Tensor::To);
+    tensor.def("to", (Tensor(Tensor::*)(Dtype, Tensor&) const) & Tensor::To,
+               "dtype"_a, "out"_a);
 
     // Binary element-wise ops
     tensor.def("add", [](const Tensor& self, const Tensor& other) {
@@ -263,6 +491,9 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("add", &Tensor::Add<int64_t>);
     tensor.def("add", &Tensor::Add<uint8_t>);
     tensor.def("add", &Tensor::Add<bool>);
+    tensor.def("add",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Add,
+               "value"_a, "out"_a);
     tensor.def("add_", [](Tensor& self, const Tensor& other) {
         return self.Add_(other);
     });
@@ -282,6 +513,9 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("sub", &Tensor::Sub<int64_t>);
     tensor.def("sub", &Tensor::Sub<uint8_t>);
     tensor.def("sub", &Tensor::Sub<bool>);
+    tensor.def("sub",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Sub,
+               "value"_a, "out"_a);
     tensor.def("sub_", [](Tensor& self, const Tensor& other) {
         return self.Sub_(other);
     });
@@ -301,6 +535,9 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("mul", &Tensor::Mul<int64_t>);
     tensor.def("mul", &Tensor::Mul<uint8_t>);
     tensor.def("mul", &Tensor::Mul<bool>);
+    tensor.def("mul",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Mul,
+               "value"_a, "out"_a);
     tensor.def("mul_", [](Tensor& self, const Tensor& other) {
         return self.Mul_(other);
     });
@@ -320,6 +557,9 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("div", &Tensor::Div<int64_t>);
     tensor.def("div", &Tensor::Div<uint8_t>);
     tensor.def("div", &Tensor::Div<bool>);
+    tensor.def("div",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Div,
+               "value"_a, "out"_a);
     tensor.def("div_", [](Tensor& self, const Tensor& other) {
         return self.Div_(other);
     });
@@ -331,23 +571,56 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("div_", &Tensor::Div_<bool>);
 
     // Binary boolean element-wise ops
-    tensor.def("logical_and", &Tensor::LogicalAnd);
+    tensor.def("logical_and",
+               (Tensor(Tensor::*)(const Tensor&) const) & Tensor::LogicalAnd);
+    tensor.def("logical_and",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) &
+                       Tensor::LogicalAnd,
+               "value"_a, "out"_a);
     tensor.def("logical_and_", &Tensor::LogicalAnd_);
-    tensor.def("logical_or", &Tensor::LogicalOr);
+    tensor.def("logical_or",
+               (Tensor(Tensor::*)(const Tensor&) const) & Tensor::LogicalOr);
+    tensor.def("logical_or",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) &
+                       Tensor::LogicalOr,
+               "value"_a, "out"_a);
     tensor.def("logical_or_", &Tensor::LogicalOr_);
-    tensor.def("logical_xor", &Tensor::LogicalXor);
+    tensor.def("logical_xor",
+               (Tensor(Tensor::*)(const Tensor&) const) & Tensor::LogicalXor);
+    tensor.def("logical_xor",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) &
+                       Tensor::LogicalXor,
+               "value"_a, "out"_a);
     tensor.def("logical_xor_", &Tensor::LogicalXor_);
-    tensor.def("gt", &Tensor::Gt);
+    tensor.def("gt", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Gt);
+    tensor.def("gt",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Gt,
+               "value"_a, "out"_a);
     tensor.def("gt_", &Tensor::Gt_);
-    tensor.def("lt", &Tensor::Lt);
+    tensor.def("lt", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Lt);
+    tensor.def("lt",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Lt,
+               "value"_a, "out"_a);
     tensor.def("lt_", &Tensor::Lt_);
-    tensor.def("ge", &Tensor::Ge);
+    tensor.def("ge", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Ge);
+    tensor.def("ge",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Ge,
+               "value"_a, "out"_a);
     tensor.def("ge_", &Tensor::Ge_);
-    tensor.def("le", &Tensor::Le);
+    tensor.def("le", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Le);
+    tensor.def("le",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Le,
+               "value"_a, "out"_a);
     tensor.def("le_", &Tensor::Le_);
-    tensor.def("eq", &Tensor::Eq);
+    tensor.def("eq", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Eq);
+    tensor.def("eq",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Eq,
+               "value"_a, "out"_a);
     tensor.def("eq_", &Tensor::Eq_);
-    tensor.def("ne", &Tensor::Ne);
+    tensor.def("ne", (Tensor(Tensor::*)(const Tensor&) const) & Tensor::Ne);
+    tensor.def("ne",
+               (Tensor(Tensor::*)(const Tensor&, Tensor&) const) & Tensor::Ne,
+               "value"_a, "out"_a);
     tensor.def("ne_", &Tensor::Ne_);
 
     // Getters and setters as peoperty
@@ -363,19 +636,34 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("num_elements", &Tensor::NumElements);
 
     // Unary element-wise ops
-    tensor.def("sqrt", &Tensor::Sqrt);
+    tensor.def("sqrt", (Tensor(Tensor::*)() const) & Tensor::Sqrt);
+    tensor.def("sqrt", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Sqrt,
+               "out"_a);
     tensor.def("sqrt_", &Tensor::Sqrt_);
-    tensor.def("sin", &Tensor::Sin);
+    tensor.def("sin", (Tensor(Tensor::*)() const) & Tensor::Sin);
+    tensor.def("sin", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Sin,
+               "out"_a);
     tensor.def("sin_", &Tensor::Sin_);
-    tensor.def("cos", &Tensor::Cos);
+    tensor.def("cos", (Tensor(Tensor::*)() const) & Tensor::Cos);
+    tensor.def("cos", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Cos,
+               "out"_a);
     tensor.def("cos_", &Tensor::Cos_);
-    tensor.def("neg", &Tensor::Neg);
+    tensor.def("neg", (Tensor(Tensor::*)() const) & Tensor::Neg);
+    tensor.def("neg", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Neg,
+               "out"_a);
     tensor.def("neg_", &Tensor::Neg_);
-    tensor.def("exp", &Tensor::Exp);
+    tensor.def("exp", (Tensor(Tensor::*)() const) & Tensor::Exp);
+    tensor.def("exp", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Exp,
+               "out"_a);
     tensor.def("exp_", &Tensor::Exp_);
-    tensor.def("abs", &Tensor::Abs);
+    tensor.def("abs", (Tensor(Tensor::*)() const) & Tensor::Abs);
+    tensor.def("abs", (Tensor(Tensor::*)(Tensor&) const) & Tensor::Abs,
+               "out"_a);
     tensor.def("abs_", &Tensor::Abs_);
-    tensor.def("logical_not", &Tensor::LogicalNot);
+    tensor.def("logical_not", (Tensor(Tensor::*)() const) & Tensor::LogicalNot);
+    tensor.def("logical_not",
+               (Tensor(Tensor::*)(Tensor&) const) & Tensor::LogicalNot,
+               "out"_a);
     tensor.def("logical_not_", &Tensor::LogicalNot_);
 
     // Boolean find
@@ -383,13 +671,61 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("_non_zero_numpy", &Tensor::NonZeroNumpy);
 
     // Reduction ops
-    tensor.def("sum", &Tensor::Sum);
-    tensor.def("mean", &Tensor::Mean);
-    tensor.def("prod", &Tensor::Prod);
-    tensor.def("min", &Tensor::Min);
-    tensor.def("max", &Tensor::Max);
-    tensor.def("argmin_", &Tensor::ArgMin);
-    tensor.def("argmax_", &Tensor::ArgMax);
+    tensor.def("sum",
+               (Tensor(Tensor::*)(const SizeVector&, bool) const) &
+                       Tensor::Sum);
+    tensor.def("sum",
+               (Tensor(Tensor::*)(const SizeVector&, bool, Tensor&) const) &
+                       Tensor::Sum,
+               "dims"_a, "keepdim"_a, "out"_a);
+    tensor.def("mean",
+               (Tensor(Tensor::*)(const SizeVector&, bool) const) &
+                       Tensor::Mean);
+    tensor.def("mean",
+               (Tensor(Tensor::*)(const SizeVector&, bool, Tensor&) const) &
+                       Tensor::Mean,
+               "dims"_a, "keepdim"_a, "out"_a);
+    tensor.def("prod",
+               (Tensor(Tensor::*)(const SizeVector&, bool) const) &
+                       Tensor::Prod);
+    tensor.def("prod",
+               (Tensor(Tensor::*)(const SizeVector&, bool, Tensor&) const) &
+                       Tensor::Prod,
+               "dims"_a, "keepdim"_a, "out"_a);
+    tensor.def("min",
+               (Tensor(Tensor::*)(const SizeVector&, bool) const) &
+                       Tensor::Min);
+    tensor.def("min",
+               (Tensor(Tensor::*)(const SizeVector&, bool, Tensor&) const) &
+                       Tensor::Min,
+               "dims"_a, "keepdim"_a, "out"_a);
+    tensor.def("max",
+               (Tensor(Tensor::*)(const SizeVector&, bool) const) &
+                       Tensor::Max);
+    tensor.def("max",
+               (Tensor(Tensor::*)(const SizeVector&, bool, Tensor&) const) &
+                       Tensor::Max,
+               "dims"_a, "keepdim"_a, "out"_a);
+    tensor.def("min_max", &Tensor::MinMax);
+    tensor.def("mean_var", &Tensor::MeanVar);
+    tensor.def("argmin_", (Tensor(Tensor::*)(const SizeVector&) const) &
+                                Tensor::ArgMin);
+    tensor.def("argmin_",
+               (Tensor(Tensor::*)(const SizeVector&, Tensor&) const) &
+                       Tensor::ArgMin,
+               "dims"_a, "out"_a);
+    tensor.def("argmax_", (Tensor(Tensor::*)(const SizeVector&) const) &
+                                Tensor::ArgMax);
+    tensor.def("argmax_",
+               (Tensor(Tensor::*)(const SizeVector&, Tensor&) const) &
+                       Tensor::ArgMax,
+               "dims"_a, "out"_a);
+
+    // Sort and scan ops
+    tensor.def("argsort", &Tensor::ArgSort);
+    tensor.def("sort", &Tensor::Sort);
+    tensor.def("unique", &Tensor::Unique);
+    tensor.def("cumsum", &Tensor::CumSum, "dim"_a, "exclusive"_a = false);
 
     tensor.def("__repr__",
                [](const Tensor& tensor) { return tensor.ToString(); });
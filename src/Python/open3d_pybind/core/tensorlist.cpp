@@ -75,6 +75,8 @@ void pybind_core_tensorlist(py::module& m) {
                  [](TensorList& tl_a, const TensorList& tl_b) {
                      return tl_a.Extend(tl_b);
                  })
+            .def("reserve",
+                 [](TensorList& tl, int64_t n) { return tl.Reserve(n); })
             .def("size", [](const TensorList& tl) { return tl.GetSize(); })
 
             .def("_getitem",
@@ -95,6 +97,8 @@ void pybind_core_tensorlist(py::module& m) {
     tensorlist.def_property_readonly("shape", &TensorList::GetShape);
     tensorlist.def_property_readonly("dtype", &TensorList::GetDtype);
     tensorlist.def_property_readonly("device", &TensorList::GetDevice);
+    tensorlist.def_property("chunked", &TensorList::IsChunked,
+                            &TensorList::SetChunked);
 }
 
 }  // namespace open3d
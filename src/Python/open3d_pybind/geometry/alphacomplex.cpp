@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AlphaComplex.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TetraMesh.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_alphacomplex(py::module &m) {
+    py::class_<geometry::AlphaComplex, std::shared_ptr<geometry::AlphaComplex>>
+            alpha_complex(m, "AlphaComplex",
+                          "The faces of the Delaunay tetrahedralization of a "
+                          "point cloud, with the range ``[min, max)`` of "
+                          "alpha values for which each face is on the alpha "
+                          "shape. Build it once to extract the alpha shapes "
+                          "of several alpha values.");
+    py::detail::bind_default_constructor<geometry::AlphaComplex>(
+            alpha_complex);
+    py::detail::bind_copy_functions<geometry::AlphaComplex>(alpha_complex);
+    alpha_complex
+            .def("__repr__",
+                 [](const geometry::AlphaComplex &alpha_complex) {
+                     return std::string("geometry::AlphaComplex with ") +
+                            std::to_string(alpha_complex.NumTetras()) +
+                            " tetras and " +
+                            std::to_string(alpha_complex.NumTriangles()) +
+                            " triangles.";
+                 })
+            .def("num_tetras", &geometry::AlphaComplex::NumTetras,
+                 "Returns the number of tetrahedra.")
+            .def("num_triangles", &geometry::AlphaComplex::NumTriangles,
+                 "Returns the number of triangles that are on the alpha "
+                 "shape of some alpha.")
+            .def("extract_alpha_shape",
+                 &geometry::AlphaComplex::ExtractAlphaShape,
+                 "Returns the alpha shape, the same mesh as "
+                 "``TriangleMesh.create_from_point_cloud_alpha_shape``.",
+                 "alpha"_a, py::call_guard<py::gil_scoped_release>())
+            .def_static(
+                    "create_from_point_cloud",
+                    [](const geometry::PointCloud &pcd) {
+                        return geometry::AlphaComplex::CreateFromPointCloud(
+                                pcd);
+                    },
+                    "Function to build the alpha complex of a point cloud.",
+                    "pcd"_a, py::call_guard<py::gil_scoped_release>())
+            .def_static(
+                    "create_from_point_cloud",
+                    [](const geometry::PointCloud &pcd,
+                       std::shared_ptr<geometry::TetraMesh> tetra_mesh,
+                       const std::vector<size_t> &pt_map) {
+                        return geometry::AlphaComplex::CreateFromPointCloud(
+                                pcd, tetra_mesh, &pt_map);
+                    },
+                    "Function to build the alpha complex of a point cloud.",
+                    "pcd"_a, "tetra_mesh"_a, "pt_map"_a,
+                    py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("vertices", &geometry::AlphaComplex::vertices_,
+                           "``float64`` array of shape ``(num_vertices, 3)``: "
+                           "Vertices of the tetrahedralization.")
+            .def_readwrite("vertex_normals",
+                           &geometry::AlphaComplex::vertex_normals_,
+                           "``float64`` array of shape ``(num_vertices, 3)``: "
+                           "Vertex normals, copied from the point cloud.")
+            .def_readwrite("vertex_colors",
+                           &geometry::AlphaComplex::vertex_colors_,
+                           "``float64`` array of shape ``(num_vertices, 3)``: "
+                           "Vertex colors, copied from the point cloud.")
+            .def_readwrite("tetra_radii", &geometry::AlphaComplex::tetra_radii_,
+                           "``float64`` array: Circumradius of every "
+                           "tetrahedron.")
+            .def_readwrite("triangles", &geometry::AlphaComplex::triangles_,
+                           "``int`` array of shape ``(num_triangles, 3)``: "
+                           "Faces that are on the alpha shape of some alpha.")
+            .def_readwrite("triangle_alphas",
+                           &geometry::AlphaComplex::triangle_alphas_,
+                           "``float64`` array of shape ``(num_triangles, "
+                           "2)``: Range ``[min, max)`` of the alpha values "
+                           "for which every triangle is on the alpha shape.");
+    docstring::ClassMethodDocInject(m, "AlphaComplex", "num_tetras");
+    docstring::ClassMethodDocInject(m, "AlphaComplex", "num_triangles");
+    docstring::ClassMethodDocInject(
+            m, "AlphaComplex", "extract_alpha_shape",
+            {{"alpha", "Circumradius up to which tetrahedra are included."}});
+    docstring::ClassMethodDocInject(
+            m, "AlphaComplex", "create_from_point_cloud",
+            {{"pcd", "The input point cloud."},
+             {"tetra_mesh",
+              "Delaunay tetrahedralization of the point cloud, e.g. from "
+              "``TetraMesh.create_from_point_cloud``."},
+             {"pt_map",
+              "Map from the vertex indices of ``tetra_mesh`` to the points "
+              "of ``pcd``."}});
+}
+
+}  // namespace open3d
@@ -90,6 +90,8 @@ void pybind_geometry_classes(py::module &m) {
             .value("Image", geometry::Geometry::GeometryType::Image)
             .value("RGBDImage", geometry::Geometry::GeometryType::RGBDImage)
             .value("TetraMesh", geometry::Geometry::GeometryType::TetraMesh)
+            .value("InstancedTriangleMesh",
+                   geometry::Geometry::GeometryType::InstancedTriangleMesh)
             .export_values();
 
     py::class_<geometry::Geometry3D, PyGeometry3D<geometry::Geometry3D>,
@@ -197,14 +199,19 @@ void pybind_geometry(py::module &m) {
     py::module m_submodule = m.def_submodule("geometry");
     pybind_geometry_classes(m_submodule);
     pybind_kdtreeflann(m_submodule);
+    pybind_neighborgraph(m_submodule);
     pybind_pointcloud(m_submodule);
     pybind_voxelgrid(m_submodule);
     pybind_lineset(m_submodule);
     pybind_meshbase(m_submodule);
     pybind_trianglemesh(m_submodule);
+    pybind_trianglemeshadjacency(m_submodule);
+    pybind_trianglemeshbvh(m_submodule);
     pybind_halfedgetrianglemesh(m_submodule);
     pybind_image(m_submodule);
     pybind_tetramesh(m_submodule);
+    pybind_alphacomplex(m_submodule);
+    pybind_instancedtrianglemesh(m_submodule);
     pybind_pointcloud_methods(m_submodule);
     pybind_voxelgrid_methods(m_submodule);
     pybind_meshbase_methods(m_submodule);
@@ -213,6 +220,7 @@ void pybind_geometry(py::module &m) {
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
     pybind_boundingvolume(m_submodule);
+    pybind_keypoint(m_submodule);
 }
 
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "Open3D/Geometry/Image.h"
 #include "open3d_pybind/open3d_pybind.h"
 
 namespace open3d {
@@ -40,7 +41,12 @@ void pybind_trianglemesh(py::module &m);
 void pybind_halfedgetrianglemesh(py::module &m);
 void pybind_image(py::module &m);
 void pybind_tetramesh(py::module &m);
+void pybind_instancedtrianglemesh(py::module &m);
 void pybind_kdtreeflann(py::module &m);
+void pybind_neighborgraph(py::module &m);
+void pybind_alphacomplex(py::module &m);
+void pybind_trianglemeshadjacency(py::module &m);
+void pybind_trianglemeshbvh(py::module &m);
 void pybind_pointcloud_methods(py::module &m);
 void pybind_voxelgrid_methods(py::module &m);
 void pybind_meshbase_methods(py::module &m);
@@ -50,5 +56,11 @@ void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
 void pybind_boundingvolume(py::module &m);
+void pybind_keypoint(py::module &m);
+
+/// Pickle state of an Image, also used by the classes holding images. The data
+/// buffer is a view kept alive by \p owner.
+py::tuple image_to_pickle_state(const geometry::Image &image, py::handle owner);
+void image_from_pickle_state(const py::tuple &state, geometry::Image &image);
 
 }  // namespace open3d
@@ -24,8 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/RGBDImageUndistorter.h"
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
 #include "open3d_pybind/geometry/geometry_trampoline.h"
@@ -54,6 +56,30 @@ static const std::unordered_map<std::string, std::string>
                  "When ``True``, image in the pyramid will first be filtered "
                  "by a 3x3 Gaussian kernel before downsampling."}};
 
+py::tuple image_to_pickle_state(const geometry::Image &image,
+                                py::handle owner) {
+    return py::make_tuple(
+            image.width_, image.height_, image.num_of_channels_,
+            image.bytes_per_channel_,
+            py::detail::vector_to_pickle_array<uint8_t>(image.data_, owner));
+}
+
+void image_from_pickle_state(const py::tuple &state, geometry::Image &image) {
+    if (state.size() != 5) {
+        throw std::runtime_error("Invalid pickle state.");
+    }
+    image.width_ = state[0].cast<int>();
+    image.height_ = state[1].cast<int>();
+    image.num_of_channels_ = state[2].cast<int>();
+    image.bytes_per_channel_ = state[3].cast<int>();
+    py::detail::pickle_array_to_vector<uint8_t>(state[4], image.data_);
+    if (image.data_.size() != size_t(image.width_) * image.height_ *
+                                      image.num_of_channels_ *
+                                      image.bytes_per_channel_) {
+        throw std::runtime_error("Invalid pickle state.");
+    }
+}
+
 void pybind_image(py::module &m) {
     py::enum_<geometry::Image::FilterType> image_filter_type(m,
                                                              "ImageFilterType");
@@ -163,6 +189,16 @@ void pybind_image(py::module &m) {
                                     "buffer "
                                     "data.");
                  })
+            .def(py::pickle(
+                    [](py::object self) {
+                        return image_to_pickle_state(
+                                self.cast<const geometry::Image &>(), self);
+                    },
+                    [](const py::tuple &state) {
+                        auto image = std::make_shared<geometry::Image>();
+                        image_from_pickle_state(state, *image);
+                        return image;
+                    }))
             .def("filter",
                  [](const geometry::Image &input,
                     geometry::Image::FilterType filter_type) {
@@ -176,7 +212,8 @@ void pybind_image(py::module &m) {
                          return *output;
                      }
                  },
-                 "Function to filter Image", "filter_type"_a)
+                 "Function to filter Image", "filter_type"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def("flip_vertical", &geometry::Image::FlipVertical,
                  "Function to flip image vertically (upside down)")
             .def("flip_horizontal", &geometry::Image::FlipHorizontal,
@@ -197,7 +234,8 @@ void pybind_image(py::module &m) {
                      }
                  },
                  "Function to create ImagePyramid", "num_of_levels"_a,
-                 "with_gaussian_filter"_a)
+                 "with_gaussian_filter"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def_static("filter_pyramid",
                         [](const geometry::ImagePyramid &input,
                            geometry::Image::FilterType filter_type) {
@@ -206,7 +244,8 @@ void pybind_image(py::module &m) {
                             return output;
                         },
                         "Function to filter ImagePyramid", "image_pyramid"_a,
-                        "filter_type"_a);
+                        "filter_type"_a,
+                        py::call_guard<py::gil_scoped_release>());
 
     docstring::ClassMethodDocInject(m, "Image", "filter",
                                     map_shared_argument_docstrings);
@@ -248,12 +287,33 @@ void pybind_image(py::module &m) {
                             std::string(
                                     "Use numpy.asarray to access buffer data.");
                  })
+            .def(py::pickle(
+                    [](py::object self) {
+                        const auto &rgbd_image =
+                                self.cast<const geometry::RGBDImage &>();
+                        return py::make_tuple(
+                                image_to_pickle_state(rgbd_image.color_, self),
+                                image_to_pickle_state(rgbd_image.depth_, self));
+                    },
+                    [](const py::tuple &state) {
+                        if (state.size() != 2) {
+                            throw std::runtime_error("Invalid pickle state.");
+                        }
+                        auto rgbd_image =
+                                std::make_shared<geometry::RGBDImage>();
+                        image_from_pickle_state(state[0].cast<py::tuple>(),
+                                                rgbd_image->color_);
+                        image_from_pickle_state(state[1].cast<py::tuple>(),
+                                                rgbd_image->depth_);
+                        return rgbd_image;
+                    }))
             .def_static("create_from_color_and_depth",
                         &geometry::RGBDImage::CreateFromColorAndDepth,
                         "Function to make RGBDImage from color and depth image",
                         "color"_a, "depth"_a, "depth_scale"_a = 1000.0,
                         "depth_trunc"_a = 3.0,
-                        "convert_rgb_to_intensity"_a = true)
+                        "convert_rgb_to_intensity"_a = true,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_redwood_format",
                         &geometry::RGBDImage::CreateFromRedwoodFormat,
                         "Function to make RGBDImage (for Redwood format)",
@@ -287,6 +347,42 @@ void pybind_image(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "RGBDImage", "create_from_nyu_format",
                                     map_shared_argument_docstrings);
+
+    py::class_<geometry::RGBDImageUndistorter> rgbd_image_undistorter(
+            m, "RGBDImageUndistorter",
+            "Removes the lens distortion of the color and depth images of a "
+            "camera while converting them into RGB-D images, frame after "
+            "frame. The remap tables are cached per intrinsic and the output "
+            "RGB-D image is overwritten in place.");
+    py::detail::bind_copy_functions<geometry::RGBDImageUndistorter>(
+            rgbd_image_undistorter);
+    rgbd_image_undistorter
+            .def(py::init<double, double, bool>(), "depth_scale"_a = 1000.0,
+                 "depth_trunc"_a = 3.0, "convert_rgb_to_intensity"_a = true)
+            .def("__repr__",
+                 [](const geometry::RGBDImageUndistorter &undistorter) {
+                     return std::string(
+                                    "geometry::RGBDImageUndistorter with "
+                                    "depth_scale = ") +
+                            std::to_string(undistorter.depth_scale_) +
+                            ", depth_trunc = " +
+                            std::to_string(undistorter.depth_trunc_);
+                 })
+            .def("create_from_color_and_depth",
+                 &geometry::RGBDImageUndistorter::CreateFromColorAndDepth,
+                 "Undistorts color and depth images into an RGB-D image.",
+                 "color"_a, "depth"_a, "intrinsic"_a, "image"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("depth_scale",
+                           &geometry::RGBDImageUndistorter::depth_scale_,
+                           "The depth is scaled by 1 / depth_scale.")
+            .def_readwrite("depth_trunc",
+                           &geometry::RGBDImageUndistorter::depth_trunc_,
+                           "Depth values of at least depth_trunc are 0.")
+            .def_readwrite(
+                    "convert_rgb_to_intensity",
+                    &geometry::RGBDImageUndistorter::convert_rgb_to_intensity_,
+                    "Whether to convert RGB image to intensity image.");
 }
 
 void pybind_image_methods(py::module &m) {}
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedTriangleMesh.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+#include "open3d_pybind/geometry/geometry_trampoline.h"
+
+namespace open3d {
+
+void pybind_instancedtrianglemesh(py::module &m) {
+    py::class_<geometry::InstancedTriangleMesh,
+               PyGeometry3D<geometry::InstancedTriangleMesh>,
+               std::shared_ptr<geometry::InstancedTriangleMesh>,
+               geometry::Geometry3D>
+            instances(m, "InstancedTriangleMesh",
+                      "InstancedTriangleMesh class. A triangle mesh drawn "
+                      "once for every instance transform, optionally with "
+                      "a color per instance. Use it instead of many copies "
+                      "of the same mesh, e.g. for the camera frustums or "
+                      "coordinate frames of a trajectory.");
+    py::detail::bind_default_constructor<geometry::InstancedTriangleMesh>(
+            instances);
+    py::detail::bind_copy_functions<geometry::InstancedTriangleMesh>(
+            instances);
+    instances
+            .def(py::init<std::shared_ptr<geometry::TriangleMesh>>(),
+                 "Create an instanced mesh without instances from the mesh "
+                 "shared by all instances.",
+                 "mesh"_a)
+            .def("__repr__",
+                 [](const geometry::InstancedTriangleMesh &instances) {
+                     return std::string(
+                                    "geometry::InstancedTriangleMesh with ") +
+                            std::to_string(
+                                    instances.instance_transforms_.size()) +
+                            " instances.";
+                 })
+            .def("has_instances",
+                 &geometry::InstancedTriangleMesh::HasInstances,
+                 "Returns ``True`` if there is a mesh with at least one "
+                 "instance.")
+            .def("has_instance_colors",
+                 &geometry::InstancedTriangleMesh::HasInstanceColors,
+                 "Returns ``True`` if every instance has a color.")
+            .def("add_instance",
+                 py::overload_cast<const Eigen::Matrix4d &>(
+                         &geometry::InstancedTriangleMesh::AddInstance),
+                 "Adds an instance placed by the transformation.",
+                 "transformation"_a)
+            .def("add_instance",
+                 py::overload_cast<const Eigen::Matrix4d &,
+                                   const Eigen::Vector3d &>(
+                         &geometry::InstancedTriangleMesh::AddInstance),
+                 "Adds an instance placed by the transformation and drawn "
+                 "with the color instead of the vertex colors of the mesh.",
+                 "transformation"_a, "color"_a)
+            .def("create_merged_mesh",
+                 &geometry::InstancedTriangleMesh::CreateMergedMesh,
+                 "Returns a single mesh with a transformed copy of the mesh "
+                 "for each instance.")
+            .def_readwrite("mesh", &geometry::InstancedTriangleMesh::mesh_,
+                           "The TriangleMesh drawn by every instance.")
+            .def_readwrite("instance_transforms",
+                           &geometry::InstancedTriangleMesh::
+                                   instance_transforms_,
+                           "List of ``4 x 4`` transformations, one per "
+                           "instance.")
+            .def_readwrite("instance_colors",
+                           &geometry::InstancedTriangleMesh::instance_colors_,
+                           "``float64`` array of shape ``(num_instances, "
+                           "3)``, range ``[0, 1]`` , use ``numpy.asarray()`` "
+                           "to access data: RGB colors of the instances.");
+    docstring::ClassMethodDocInject(m, "InstancedTriangleMesh",
+                                    "has_instances");
+    docstring::ClassMethodDocInject(m, "InstancedTriangleMesh",
+                                    "has_instance_colors");
+    docstring::ClassMethodDocInject(m, "InstancedTriangleMesh",
+                                    "create_merged_mesh");
+}
+
+}  // namespace open3d
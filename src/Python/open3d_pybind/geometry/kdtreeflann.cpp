@@ -39,7 +39,16 @@ void pybind_kdtreeflann(py::module &m) {
     kdtreesearchparam.def("get_search_type",
                           &geometry::KDTreeSearchParam::GetSearchType,
                           "Get the search type (KNN, Radius, Hybrid) for the "
-                          "search parameter.");
+                          "search parameter.")
+            .def_readwrite("eps", &geometry::KDTreeSearchParam::eps_,
+                           "Approximation factor of the search. A returned "
+                           "neighbor is at most ``1 + eps`` times farther "
+                           "than the true neighbor of the same rank. 0 is "
+                           "exact search.")
+            .def_readwrite("sorted", &geometry::KDTreeSearchParam::sorted_,
+                           "If false, neighbors are returned in arbitrary "
+                           "order, which skips sorting radius and hybrid "
+                           "search results.");
     docstring::ClassMethodDocInject(m, "KDTreeSearchParam", "get_search_type");
 
     // open3d.geometry.KDTreeSearchParam.Type
@@ -126,14 +135,16 @@ void pybind_kdtreeflann(py::module &m) {
     kdtreeflann.def(py::init<>())
             .def(py::init<const Eigen::MatrixXd &>(), "data"_a)
             .def("set_matrix_data", &geometry::KDTreeFlann::SetMatrixData,
-                 "Sets the data for the KDTree from a matrix.", "data"_a)
+                 "Sets the data for the KDTree from a matrix.", "data"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def(py::init<const geometry::Geometry &>(), "geometry"_a)
             .def("set_geometry", &geometry::KDTreeFlann::SetGeometry,
-                 "Sets the data for the KDTree from geometry.", "geometry"_a)
+                 "Sets the data for the KDTree from geometry.", "geometry"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def(py::init<const registration::Feature &>(), "feature"_a)
             .def("set_feature", &geometry::KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
-                 "feature"_a)
+                 "feature"_a, py::call_guard<py::gil_scoped_release>())
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
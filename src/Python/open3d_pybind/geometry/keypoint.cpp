@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Keypoint.h"
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_keypoint(py::module &m) {
+    py::module m_submodule =
+            m.def_submodule("keypoint", "Keypoint detectors of point clouds.");
+    m_submodule.def(
+            "compute_iss_keypoint_indices",
+            (std::vector<size_t>(*)(const geometry::PointCloud &, double,
+                                    double, double, double, int)) &
+                    geometry::keypoint::ComputeISSKeypointIndices,
+            "Detects Intrinsic Shape Signatures (ISS) keypoints and returns "
+            "their indices.",
+            "input"_a, "salient_radius"_a = 0.0, "non_max_radius"_a = 0.0,
+            "gamma_21"_a = 0.975, "gamma_32"_a = 0.975, "min_neighbors"_a = 5,
+            py::call_guard<py::gil_scoped_release>());
+    m_submodule.def(
+            "compute_iss_keypoint_indices",
+            (std::vector<size_t>(*)(const geometry::PointCloud &,
+                                    const geometry::NeighborGraph &, double,
+                                    double, double, double, int)) &
+                    geometry::keypoint::ComputeISSKeypointIndices,
+            "Detects ISS keypoints from a precomputed neighbor graph and "
+            "returns their indices.",
+            "input"_a, "graph"_a, "salient_radius"_a, "non_max_radius"_a,
+            "gamma_21"_a = 0.975, "gamma_32"_a = 0.975, "min_neighbors"_a = 5,
+            py::call_guard<py::gil_scoped_release>());
+    m_submodule.def("compute_iss_keypoints",
+                    &geometry::keypoint::ComputeISSKeypoints,
+                    "Detects Intrinsic Shape Signatures (ISS) keypoints.",
+                    "input"_a, "salient_radius"_a = 0.0,
+                    "non_max_radius"_a = 0.0, "gamma_21"_a = 0.975,
+                    "gamma_32"_a = 0.975, "min_neighbors"_a = 5,
+                    py::call_guard<py::gil_scoped_release>());
+    const std::unordered_map<std::string, std::string> map_docs = {
+            {"input", "The input point cloud."},
+            {"graph",
+             "Neighbor graph of the input point cloud, containing all "
+             "neighbors within max(salient_radius, non_max_radius)."},
+            {"salient_radius",
+             "Radius of the neighborhoods of the scatter matrices. If 0, 6 "
+             "times the average nearest neighbor distance is used."},
+            {"non_max_radius",
+             "Radius of the non-maximum suppression. If 0, 4 times the "
+             "average nearest neighbor distance is used."},
+            {"gamma_21",
+             "Upper bound of the ratio of the second to the first "
+             "eigenvalue."},
+            {"gamma_32",
+             "Upper bound of the ratio of the third to the second "
+             "eigenvalue."},
+            {"min_neighbors",
+             "Minimum number of neighbors of a keypoint within "
+             "salient_radius."}};
+    docstring::FunctionDocInject(m_submodule, "compute_iss_keypoint_indices",
+                                 map_docs);
+    docstring::FunctionDocInject(m_submodule, "compute_iss_keypoints",
+                                 map_docs);
+}
+
+}  // namespace open3d
@@ -83,12 +83,12 @@ void pybind_lineset(py::module &m) {
                         &geometry::LineSet::CreateFromTriangleMesh,
                         "Factory function to create a LineSet from edges of a "
                         "triangle mesh.",
-                        "mesh"_a)
+                        "mesh"_a, py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_tetra_mesh",
                         &geometry::LineSet::CreateFromTetraMesh,
                         "Factory function to create a LineSet from edges of a "
                         "tetra mesh.",
-                        "mesh"_a)
+                        "mesh"_a, py::call_guard<py::gil_scoped_release>())
             .def_readwrite("points", &geometry::LineSet::points_,
                            "``float64`` array of shape ``(num_points, 3)``, "
                            "use ``numpy.asarray()`` to access data: Points "
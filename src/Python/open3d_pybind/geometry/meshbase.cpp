@@ -54,6 +54,31 @@ void pybind_meshbase(py::module &m) {
                    "distance to the adjacent triangle planes.")
             .export_values();
 
+    py::enum_<geometry::MeshBase::QuadricDecimationMethod>(
+            m, "QuadricDecimationMethod")
+            .value("Sequential",
+                   geometry::MeshBase::QuadricDecimationMethod::Sequential,
+                   "Edges are collapsed one at a time in order of increasing "
+                   "cost.")
+            .value("Parallel",
+                   geometry::MeshBase::QuadricDecimationMethod::Parallel,
+                   "Spatial partitions of the mesh are decimated in "
+                   "parallel.")
+            .export_values();
+
+    py::enum_<geometry::MeshBase::PoissonDiskSamplingMethod>(
+            m, "PoissonDiskSamplingMethod")
+            .value("SampleElimination",
+                   geometry::MeshBase::PoissonDiskSamplingMethod::
+                           SampleElimination,
+                   "The samples with the largest weights are eliminated one "
+                   "at a time.")
+            .value("ParallelGrid",
+                   geometry::MeshBase::PoissonDiskSamplingMethod::ParallelGrid,
+                   "Samples are accepted by dart throwing on a grid in "
+                   "parallel.")
+            .export_values();
+
     py::enum_<geometry::MeshBase::FilterScope>(m, "FilterScope")
             .value("All", geometry::MeshBase::FilterScope::All,
                    "All properties (color, normal, vertex position) are "
@@ -77,6 +102,22 @@ void pybind_meshbase(py::module &m) {
                    "adds a rotation smoothing term to the rotations.")
             .export_values();
 
+    py::enum_<geometry::MeshBase::VertexNormalWeighting>(
+            m, "VertexNormalWeighting")
+            .value("TriangleNormals",
+                   geometry::MeshBase::VertexNormalWeighting::TriangleNormals,
+                   "Sums the stored triangle normals, which are computed "
+                   "area weighted if the mesh has none.")
+            .value("Uniform",
+                   geometry::MeshBase::VertexNormalWeighting::Uniform,
+                   "Sums the unit normals of the triangles.")
+            .value("Area", geometry::MeshBase::VertexNormalWeighting::Area,
+                   "Weights the triangle normals by the triangle areas.")
+            .value("Angle", geometry::MeshBase::VertexNormalWeighting::Angle,
+                   "Weights the unit triangle normals by the interior angles "
+                   "at the vertex.")
+            .export_values();
+
     meshbase.def("__repr__",
                  [](const geometry::MeshBase &mesh) {
                      return std::string("geometry::MeshBase with ") +
@@ -96,7 +137,8 @@ void pybind_meshbase(py::module &m) {
                  "Assigns each vertex in the MeshBase the same color.",
                  "color"_a)
             .def("compute_convex_hull", &geometry::MeshBase::ComputeConvexHull,
-                 "Computes the convex hull of the triangle mesh.")
+                 "Computes the convex hull of the triangle mesh.",
+                 py::call_guard<py::gil_scoped_release>())
             .def_readwrite("vertices", &geometry::MeshBase::vertices_,
                            "``float64`` array of shape ``(num_vertices, 3)``, "
                            "use ``numpy.asarray()`` to access data: Vertex "
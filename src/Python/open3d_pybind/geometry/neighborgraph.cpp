@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_neighborgraph(py::module &m) {
+    py::class_<geometry::NeighborGraph,
+               std::shared_ptr<geometry::NeighborGraph>>
+            neighborgraph(m, "NeighborGraph",
+                          "Neighborhoods of all points of a point cloud, "
+                          "stored in compressed sparse row layout. The "
+                          "neighbors of point i are "
+                          "``indices[offsets[i]:offsets[i + 1]]``, sorted by "
+                          "increasing distance.");
+    py::detail::bind_default_constructor<geometry::NeighborGraph>(
+            neighborgraph);
+    py::detail::bind_copy_functions<geometry::NeighborGraph>(neighborgraph);
+    neighborgraph
+            .def("__repr__",
+                 [](const geometry::NeighborGraph &graph) {
+                     return std::string("geometry::NeighborGraph with ") +
+                            std::to_string(graph.NumPoints()) +
+                            " points and " + std::to_string(graph.NumEdges()) +
+                            " edges.";
+                 })
+            .def("num_points", &geometry::NeighborGraph::NumPoints,
+                 "Returns number of points in the graph.")
+            .def("num_edges", &geometry::NeighborGraph::NumEdges,
+                 "Returns the total number of neighbors of all points.")
+            .def("num_neighbors", &geometry::NeighborGraph::NumNeighbors,
+                 "Returns the number of neighbors of a point.", "index"_a)
+            .def_static("create_from_point_cloud",
+                        &geometry::NeighborGraph::CreateFromPointCloud,
+                        "Function to build the neighbor graph of a point "
+                        "cloud with batched KDTree queries.",
+                        "point_cloud"_a,
+                        "search_param"_a = geometry::KDTreeSearchParamKNN(),
+                        py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("indices", &geometry::NeighborGraph::indices_,
+                           "``int`` array: Neighbor indices of all points, "
+                           "concatenated.")
+            .def_readwrite("distance2", &geometry::NeighborGraph::distance2_,
+                           "``float32`` array: Squared distances to the "
+                           "neighbors.")
+            .def_readwrite("offsets", &geometry::NeighborGraph::offsets_,
+                           "``int64`` array of size ``num_points + 1``: "
+                           "Offsets of the neighborhoods in ``indices``.");
+    docstring::ClassMethodDocInject(m, "NeighborGraph", "num_points");
+    docstring::ClassMethodDocInject(m, "NeighborGraph", "num_edges");
+    docstring::ClassMethodDocInject(m, "NeighborGraph", "num_neighbors",
+                                    {{"index", "Index of the point."}});
+    docstring::ClassMethodDocInject(
+            m, "NeighborGraph", "create_from_point_cloud",
+            {{"point_cloud", "The input point cloud."},
+             {"search_param",
+              "The KDTree search parameters for neighborhood search."}});
+}
+
+}  // namespace open3d
@@ -27,6 +27,8 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/LinearOctree.h"
 #include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/VoxelGrid.h"
@@ -227,7 +229,8 @@ void pybind_octree(py::module &m) {
                         "point < origin + size")
             .def("convert_from_point_cloud",
                  &geometry::Octree::ConvertFromPointCloud, "point_cloud"_a,
-                 "size_expand"_a = 0.01, "Convert octree from point cloud.")
+                 "size_expand"_a = 0.01, "Convert octree from point cloud.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("to_voxel_grid", &geometry::Octree::ToVoxelGrid,
                  "Convert to VoxelGrid.")
             .def("create_from_voxel_grid",
@@ -264,6 +267,82 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // geometry::LinearOctree
+    py::class_<geometry::LinearOctree, std::shared_ptr<geometry::LinearOctree>>
+            linear_octree(m, "LinearOctree",
+                          "Pointer-free octree for large point clouds, with "
+                          "the nodes stored in contiguous arrays.");
+    py::detail::bind_default_constructor<geometry::LinearOctree>(
+            linear_octree);
+    py::detail::bind_copy_functions<geometry::LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init([](size_t max_depth) {
+                     return new geometry::LinearOctree(max_depth);
+                 }),
+                 "max_depth"_a)
+            .def("__repr__",
+                 [](const geometry::LinearOctree &linear_octree) {
+                     std::ostringstream repr;
+                     repr << "geometry::LinearOctree with ";
+                     repr << linear_octree.nodes_.size() << " nodes, ";
+                     repr << linear_octree.points_.size() << " points";
+                     repr << ", max_depth: " << linear_octree.max_depth_;
+                     return repr.str();
+                 })
+            .def("convert_from_point_cloud",
+                 &geometry::LinearOctree::ConvertFromPointCloud,
+                 "point_cloud"_a, "size_expand"_a = 0.01,
+                 "Build the octree from a point cloud.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("is_empty", &geometry::LinearOctree::IsEmpty,
+                 "Returns true if the octree has no nodes.")
+            .def("get_child", &geometry::LinearOctree::GetChild, "node"_a,
+                 "child_index"_a,
+                 "Returns the index of a child of a node, or -1 if it does "
+                 "not exist.")
+            .def("get_node_info", &geometry::LinearOctree::GetNodeInfo,
+                 "node"_a, "Returns the OctreeNodeInfo of a node.")
+            .def("locate_leaf_node", &geometry::LinearOctree::LocateLeafNode,
+                 "point"_a,
+                 "Returns the index of the leaf node where the query point "
+                 "resides, or -1 if there is none.")
+            .def("traverse", &geometry::LinearOctree::Traverse, "f"_a,
+                 "DFS traversal of the octree from the root. The children of "
+                 "a node are skipped if f returns True.")
+            .def("get_point_indices_within_bounding_box",
+                 &geometry::LinearOctree::GetPointIndicesWithinBoundingBox,
+                 "bbox"_a,
+                 "Returns the indices of the input points within the "
+                 "bounding box.")
+            .def("to_octree", &geometry::LinearOctree::ToOctree,
+                 "point_cloud"_a, "Convert to a pointer-based Octree.")
+            .def_readonly("origin", &geometry::LinearOctree::origin_,
+                          "(3, 1) float numpy array: Global min bound "
+                          "(include).")
+            .def_readonly("size", &geometry::LinearOctree::size_,
+                          "float: Outer bounding box edge size for the whole "
+                          "octree.")
+            .def_readonly("max_depth", &geometry::LinearOctree::max_depth_,
+                          "int: Maximum depth of the octree.")
+            .def_readonly("point_indices",
+                          &geometry::LinearOctree::point_indices_,
+                          "List[int]: Indices of the input points "
+                          "within bound, sorted by leaf.");
+
+    docstring::ClassMethodDocInject(m, "LinearOctree", "__init__");
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "get_point_indices_within_bounding_box",
+            {{"bbox", "Query box. Points on its boundary are within."}});
+    docstring::ClassMethodDocInject(m, "LinearOctree", "to_octree",
+                                    {{"point_cloud",
+                                      "The point cloud the octree was built "
+                                      "from, providing the leaf colors."}});
 }
 
 void pybind_octree_methods(py::module &m) {}
@@ -27,9 +27,16 @@
 #include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/CompactPointCloud.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDBackProjector.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Utility/Parallel.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -37,6 +44,64 @@
 
 namespace open3d {
 
+namespace {
+
+// The batch functions below dereference every item of their input list.
+template <typename T>
+void CheckBatch(const std::vector<std::shared_ptr<T>> &items,
+                const char *name) {
+    for (const auto &item : items) {
+        if (!item) {
+            throw std::runtime_error(std::string(name) +
+                                     " must not contain None.");
+        }
+    }
+}
+
+typedef std::vector<std::shared_ptr<geometry::PointCloud>> PointCloudList;
+
+PointCloudList CreateFromRGBDImageBatch(
+        const std::vector<std::shared_ptr<geometry::RGBDImage>> &images,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const std::vector<Eigen::Matrix4d> &extrinsics,
+        bool project_valid_depth_only) {
+    CheckBatch(images, "images");
+    if (!extrinsics.empty() && extrinsics.size() != images.size()) {
+        throw std::runtime_error(
+                "extrinsics must be empty or have one matrix per image.");
+    }
+    const Eigen::Matrix4d identity = Eigen::Matrix4d::Identity();
+    PointCloudList pointclouds(images.size());
+    utility::ParallelFor(0, int64_t(images.size()), [&](int64_t i) {
+        pointclouds[i] = geometry::PointCloud::CreateFromRGBDImage(
+                *images[i], intrinsic,
+                extrinsics.empty() ? identity : extrinsics[i],
+                project_valid_depth_only);
+    });
+    return pointclouds;
+}
+
+PointCloudList VoxelDownSampleBatch(const PointCloudList &pointclouds,
+                                    double voxel_size) {
+    CheckBatch(pointclouds, "pointclouds");
+    PointCloudList downsampled(pointclouds.size());
+    utility::ParallelFor(0, int64_t(pointclouds.size()), [&](int64_t i) {
+        downsampled[i] = pointclouds[i]->VoxelDownSample(voxel_size);
+    });
+    return downsampled;
+}
+
+void EstimateNormalsBatch(const PointCloudList &pointclouds,
+                          const geometry::KDTreeSearchParam &search_param,
+                          bool fast_normal_computation) {
+    CheckBatch(pointclouds, "pointclouds");
+    utility::ParallelFor(0, int64_t(pointclouds.size()), [&](int64_t i) {
+        pointclouds[i]->EstimateNormals(search_param, fast_normal_computation);
+    });
+}
+
+}  // unnamed namespace
+
 void pybind_pointcloud(py::module &m) {
     py::class_<geometry::PointCloud, PyGeometry3D<geometry::PointCloud>,
                std::shared_ptr<geometry::PointCloud>, geometry::Geometry3D>
@@ -54,6 +119,35 @@ void pybind_pointcloud(py::module &m) {
                      return std::string("geometry::PointCloud with ") +
                             std::to_string(pcd.points_.size()) + " points.";
                  })
+            .def(py::pickle(
+                    [](py::object self) {
+                        const auto &pcd =
+                                self.cast<const geometry::PointCloud &>();
+                        return py::make_tuple(
+                                py::detail::vector_to_pickle_array<double>(
+                                        pcd.points_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        pcd.normals_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        pcd.colors_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        pcd.covariances_, self));
+                    },
+                    [](const py::tuple &state) {
+                        if (state.size() != 4) {
+                            throw std::runtime_error("Invalid pickle state.");
+                        }
+                        auto pcd = std::make_shared<geometry::PointCloud>();
+                        py::detail::pickle_array_to_vector<double>(
+                                state[0], pcd->points_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[1], pcd->normals_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[2], pcd->colors_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[3], pcd->covariances_);
+                        return pcd;
+                    }))
             .def(py::self + py::self)
             .def(py::self += py::self)
             .def("has_points", &geometry::PointCloud::HasPoints,
@@ -62,11 +156,19 @@ void pybind_pointcloud(py::module &m) {
                  "Returns ``True`` if the point cloud contains point normals.")
             .def("has_colors", &geometry::PointCloud::HasColors,
                  "Returns ``True`` if the point cloud contains point colors.")
+            .def("has_covariances", &geometry::PointCloud::HasCovariances,
+                 "Returns ``True`` if the point cloud contains per point "
+                 "covariances.")
             .def("normalize_normals", &geometry::PointCloud::NormalizeNormals,
                  "Normalize point normals to length 1.")
             .def("paint_uniform_color",
                  &geometry::PointCloud::PaintUniformColor, "color"_a,
                  "Assigns each point in the PointCloud the same color.")
+            .def("transform_into", &geometry::PointCloud::TransformInto,
+                 "Writes the point cloud transformed with the transformation "
+                 "to ``dst`` in a single pass, reusing its memory.",
+                 "transformation"_a, "dst"_a,
+                 py::return_value_policy::reference)
             .def("select_by_index", &geometry::PointCloud::SelectByIndex,
                  "Function to select points from input pointcloud into output "
                  "pointcloud.",
@@ -75,14 +177,22 @@ void pybind_pointcloud(py::module &m) {
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel. Normals and colors are averaged if they exist.",
-                 "voxel_size"_a)
+                 "voxel_size"_a, py::call_guard<py::gil_scoped_release>())
+            .def("voxel_down_sample_on_grid",
+                 &geometry::PointCloud::VoxelDownSampleOnGrid,
+                 "Function to downsample input pointcloud into output "
+                 "pointcloud with a voxel grid that has a voxel corner at "
+                 "grid_origin. Normals and colors are averaged if they exist.",
+                 "voxel_size"_a, "grid_origin"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def("voxel_down_sample_and_trace",
                  &geometry::PointCloud::VoxelDownSampleAndTrace,
                  "Function to downsample using "
                  "geometry::PointCloud::VoxelDownSample. Also records point "
                  "cloud index before downsampling",
                  "voxel_size"_a, "min_bound"_a, "max_bound"_a,
-                 "approximate_class"_a = false)
+                 "approximate_class"_a = false,
+                 py::call_guard<py::gil_scoped_release>())
             .def("uniform_down_sample",
                  &geometry::PointCloud::UniformDownSample,
                  "Function to downsample input pointcloud into output "
@@ -105,26 +215,132 @@ void pybind_pointcloud(py::module &m) {
                          geometry::PointCloud::Crop,
                  "Function to crop input pointcloud into output pointcloud",
                  "bounding_box"_a)
+            .def("crop",
+                 [](const geometry::PointCloud &pcd,
+                    const std::vector<geometry::AxisAlignedBoundingBox>
+                            &bboxes) { return pcd.Crop(bboxes); },
+                 "Function to crop input pointcloud into one output "
+                 "pointcloud per bounding box, with a single pass over the "
+                 "points.",
+                 "bounding_boxes"_a, py::call_guard<py::gil_scoped_release>())
+            .def("compute_tiles", &geometry::PointCloud::ComputeTiles,
+                 "Partitions the points into a regular grid of axis aligned, "
+                 "optionally overlapping tiles.",
+                 "tile_size"_a, "overlap"_a = 0.0,
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_non_finite_points",
                  &geometry::PointCloud::RemoveNonFinitePoints,
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier",
-                 &geometry::PointCloud::RemoveRadiusOutliers,
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double) const) &
+                         geometry::PointCloud::RemoveRadiusOutliers,
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
-                 "nb_points"_a, "radius"_a)
+                 "nb_points"_a, "radius"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("remove_radius_outlier",
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double,
+                         const geometry::NeighborGraph &) const) &
+                         geometry::PointCloud::RemoveRadiusOutliers,
+                 "Function to remove points that have less than nb_points"
+                 " in a given sphere of a given radius, using a precomputed "
+                 "neighbor graph",
+                 "nb_points"_a, "radius"_a, "graph"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_statistical_outlier",
-                 &geometry::PointCloud::RemoveStatisticalOutliers,
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double) const) &
+                         geometry::PointCloud::RemoveStatisticalOutliers,
                  "Function to remove points that are further away from their "
                  "neighbors in average",
-                 "nb_neighbors"_a, "std_ratio"_a)
-            .def("estimate_normals", &geometry::PointCloud::EstimateNormals,
+                 "nb_neighbors"_a, "std_ratio"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("remove_statistical_outlier",
+                 (std::tuple<std::shared_ptr<geometry::PointCloud>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         size_t, double,
+                         const geometry::NeighborGraph &) const) &
+                         geometry::PointCloud::RemoveStatisticalOutliers,
+                 "Function to remove points that are further away from their "
+                 "neighbors in average, using a precomputed neighbor graph",
+                 "nb_neighbors"_a, "std_ratio"_a, "graph"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_radius_inlier_mask",
+                 (std::vector<bool>(geometry::PointCloud::*)(size_t, double)
+                          const) &
+                         geometry::PointCloud::ComputeRadiusInlierMask,
+                 "Function to compute which points have more than nb_points "
+                 "in a sphere of a given radius, without copying them",
+                 "nb_points"_a, "radius"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_radius_inlier_mask",
+                 (std::vector<bool>(geometry::PointCloud::*)(
+                         size_t, double, const geometry::NeighborGraph &)
+                          const) &
+                         geometry::PointCloud::ComputeRadiusInlierMask,
+                 "Function to compute which points have more than nb_points "
+                 "in a sphere of a given radius, using a precomputed "
+                 "neighbor graph",
+                 "nb_points"_a, "radius"_a, "graph"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_statistical_inlier_mask",
+                 (std::vector<bool>(geometry::PointCloud::*)(size_t, double)
+                          const) &
+                         geometry::PointCloud::ComputeStatisticalInlierMask,
+                 "Function to compute which points are not further away from "
+                 "their neighbors in average, without copying them",
+                 "nb_neighbors"_a, "std_ratio"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_statistical_inlier_mask",
+                 (std::vector<bool>(geometry::PointCloud::*)(
+                         size_t, double, const geometry::NeighborGraph &)
+                          const) &
+                         geometry::PointCloud::ComputeStatisticalInlierMask,
+                 "Function to compute which points are not further away from "
+                 "their neighbors in average, using a precomputed neighbor "
+                 "graph",
+                 "nb_neighbors"_a, "std_ratio"_a, "graph"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("estimate_normals",
+                 (void (geometry::PointCloud::*)(
+                         const geometry::KDTreeSearchParam &, bool)) &
+                         geometry::PointCloud::EstimateNormals,
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = geometry::KDTreeSearchParamKNN(),
-                 "fast_normal_computation"_a = true)
+                 "fast_normal_computation"_a = true,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("estimate_normals",
+                 (void (geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &, bool)) &
+                         geometry::PointCloud::EstimateNormals,
+                 "Function to compute the normals of a point cloud from a "
+                 "precomputed neighbor graph. Normals are oriented with "
+                 "respect to the input point cloud if normals exist",
+                 "graph"_a, "fast_normal_computation"_a = true,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("estimate_covariances",
+                 (void (geometry::PointCloud::*)(
+                         const geometry::KDTreeSearchParam &)) &
+                         geometry::PointCloud::EstimateCovariances,
+                 "Function to compute the covariance of the neighborhood of "
+                 "every point.",
+                 "search_param"_a = geometry::KDTreeSearchParamKNN(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("estimate_covariances",
+                 (void (geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &)) &
+                         geometry::PointCloud::EstimateCovariances,
+                 "Function to compute the covariance of the neighborhood of "
+                 "every point from a precomputed neighbor graph.",
+                 "graph"_a, py::call_guard<py::gil_scoped_release>())
             .def("orient_normals_to_align_with_direction",
                  &geometry::PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -134,16 +350,51 @@ void pybind_pointcloud(py::module &m) {
                  "Function to orient the normals of a point cloud",
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
             .def("orient_normals_consistent_tangent_plane",
-                 &geometry::PointCloud::OrientNormalsConsistentTangentPlane,
+                 (void (geometry::PointCloud::*)(size_t)) &
+                         geometry::PointCloud::
+                                 OrientNormalsConsistentTangentPlane,
                  "Function to orient the normals with respect to consistent "
                  "tangent planes",
-                 "k"_a)
+                 "k"_a, py::call_guard<py::gil_scoped_release>())
+            .def("orient_normals_consistent_tangent_plane",
+                 (void (geometry::PointCloud::*)(
+                         const geometry::NeighborGraph &)) &
+                         geometry::PointCloud::
+                                 OrientNormalsConsistentTangentPlane,
+                 "Function to orient the normals with respect to consistent "
+                 "tangent planes, using a precomputed neighbor graph",
+                 "graph"_a, py::call_guard<py::gil_scoped_release>())
             .def("compute_point_cloud_distance",
                  &geometry::PointCloud::ComputePointCloudDistance,
                  "For each point in the source point cloud, compute the "
                  "distance to "
                  "the target point cloud.",
-                 "target"_a)
+                 "target"_a, py::call_guard<py::gil_scoped_release>())
+            .def("compute_chamfer_distance",
+                 &geometry::PointCloud::ComputeChamferDistance,
+                 "Function to compute the Chamfer distance, the sum of the "
+                 "mean distances from each point cloud to the other.",
+                 "target"_a, py::call_guard<py::gil_scoped_release>())
+            .def("compute_hausdorff_distance",
+                 &geometry::PointCloud::ComputeHausdorffDistance,
+                 "Function to compute the Hausdorff distance, the larger of "
+                 "the maximum distances from each point cloud to the other.",
+                 "target"_a, py::call_guard<py::gil_scoped_release>())
+            .def("compute_distance_to_mesh",
+                 (std::vector<double>(geometry::PointCloud::*)(
+                         const geometry::TriangleMesh &) const) &
+                         geometry::PointCloud::ComputeDistanceToMesh,
+                 "For each point, compute the distance to the surface of the "
+                 "triangle mesh.",
+                 "mesh"_a, py::call_guard<py::gil_scoped_release>())
+            .def("compute_distance_to_mesh",
+                 (std::vector<double>(geometry::PointCloud::*)(
+                         const geometry::TriangleMeshBVH &) const) &
+                         geometry::PointCloud::ComputeDistanceToMesh,
+                 "For each point, compute the distance to the surface of the "
+                 "triangle mesh, using its prebuilt bounding volume "
+                 "hierarchy.",
+                 "bvh"_a, py::call_guard<py::gil_scoped_release>())
             .def("compute_mean_and_covariance",
                  &geometry::PointCloud::ComputeMeanAndCovariance,
                  "Function to compute the mean and covariance matrix of a "
@@ -154,33 +405,53 @@ void pybind_pointcloud(py::module &m) {
                  "Function to compute the Mahalanobis distance for points in a "
                  "point "
                  "cloud. See: "
-                 "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
+                 "https://en.wikipedia.org/wiki/Mahalanobis_distance.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("compute_nearest_neighbor_distance",
                  &geometry::PointCloud::ComputeNearestNeighborDistance,
                  "Function to compute the distance from a point to its nearest "
-                 "neighbor in the point cloud")
+                 "neighbor in the point cloud",
+                 py::call_guard<py::gil_scoped_release>())
             .def("compute_convex_hull",
                  &geometry::PointCloud::ComputeConvexHull,
-                 "Computes the convex hull of the point cloud.")
+                 "Computes the convex hull of the point cloud.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("hidden_point_removal",
-                 &geometry::PointCloud::HiddenPointRemoval,
+                 (std::tuple<std::shared_ptr<geometry::TriangleMesh>,
+                             std::vector<size_t>>(geometry::PointCloud::*)(
+                         const Eigen::Vector3d &, double) const) &
+                         geometry::PointCloud::HiddenPointRemoval,
                  "Removes hidden points from a point cloud and returns a mesh "
                  "of the remaining points. Based on Katz et al. 'Direct "
                  "Visibility of Point Sets', 2007. Additional information "
                  "about the choice of radius for noisy point clouds can be "
                  "found in Mehra et. al. 'Visibility of Noisy Point Cloud "
                  "Data', 2010.",
-                 "camera_location"_a, "radius"_a)
+                 "camera_location"_a, "radius"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("hidden_point_removal",
+                 (std::vector<std::tuple<
+                          std::shared_ptr<geometry::TriangleMesh>,
+                          std::vector<size_t>>>(geometry::PointCloud::*)(
+                         const std::vector<Eigen::Vector3d> &, double) const) &
+                         geometry::PointCloud::HiddenPointRemoval,
+                 "Removes hidden points from a point cloud for every camera "
+                 "location in parallel, and returns the results in a list.",
+                 "camera_locations"_a, "radius"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def("cluster_dbscan", &geometry::PointCloud::ClusterDBSCAN,
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
-                 "eps"_a, "min_points"_a, "print_progress"_a = false)
+                 "eps"_a, "min_points"_a, "print_progress"_a = false,
+                 py::call_guard<py::gil_scoped_release>())
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999,
+                 py::call_guard<py::gil_scoped_release>())
             .def_static(
                     "create_from_depth_image",
                     &geometry::PointCloud::CreateFromDepthImage,
@@ -195,7 +466,8 @@ void pybind_pointcloud(py::module &m) {
                     "depth"_a, "intrinsic"_a,
                     "extrinsic"_a = Eigen::Matrix4d::Identity(),
                     "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0,
-                    "stride"_a = 1, "project_valid_depth_only"_a = true)
+                    "stride"_a = 1, "project_valid_depth_only"_a = true,
+                    py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_rgbd_image",
                         &geometry::PointCloud::CreateFromRGBDImage,
                         "Factory function to create a pointcloud from an RGB-D "
@@ -206,7 +478,28 @@ void pybind_pointcloud(py::module &m) {
               - y = (v - cy) * z / fy)",
                         "image"_a, "intrinsic"_a,
                         "extrinsic"_a = Eigen::Matrix4d::Identity(),
-                        "project_valid_depth_only"_a = true)
+                        "project_valid_depth_only"_a = true,
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("create_from_rgbd_image_batch",
+                        &CreateFromRGBDImageBatch,
+                        "Creates a pointcloud from each RGB-D image of a "
+                        "list, processing the images in parallel.",
+                        "images"_a, "intrinsic"_a,
+                        "extrinsics"_a = std::vector<Eigen::Matrix4d>(),
+                        "project_valid_depth_only"_a = true,
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("voxel_down_sample_batch", &VoxelDownSampleBatch,
+                        "Downsamples each pointcloud of a list with a voxel, "
+                        "processing the pointclouds in parallel.",
+                        "pointclouds"_a, "voxel_size"_a,
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("estimate_normals_batch", &EstimateNormalsBatch,
+                        "Computes the normals of each pointcloud of a list in "
+                        "place, processing the pointclouds in parallel.",
+                        "pointclouds"_a,
+                        "search_param"_a = geometry::KDTreeSearchParamKNN(),
+                        "fast_normal_computation"_a = true,
+                        py::call_guard<py::gil_scoped_release>())
             .def_readwrite("points", &geometry::PointCloud::points_,
                            "``float64`` array of shape ``(num_points, 3)``, "
                            "use ``numpy.asarray()`` to access data: Points "
@@ -219,14 +512,23 @@ void pybind_pointcloud(py::module &m) {
                     "colors", &geometry::PointCloud::colors_,
                     "``float64`` array of shape ``(num_points, 3)``, "
                     "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
-                    "data: RGB colors of points.");
+                    "data: RGB colors of points.")
+            .def_readwrite("covariances", &geometry::PointCloud::covariances_,
+                           "``float64`` array of shape ``(num_points, 3, "
+                           "3)``, use ``numpy.asarray()`` to access data: "
+                           "Covariances of the point neighborhoods.");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_colors");
+    docstring::ClassMethodDocInject(m, "PointCloud", "has_covariances");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_normals");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_points");
     docstring::ClassMethodDocInject(m, "PointCloud", "normalize_normals");
     docstring::ClassMethodDocInject(
             m, "PointCloud", "paint_uniform_color",
             {{"color", "RGB color for the PointCloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "transform_into",
+            {{"transformation", "A 4x4 transformation matrix."},
+             {"dst", "The output PointCloud, may be this PointCloud."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "select_by_index",
             {{"indices", "Indices of points to be selected."},
@@ -236,6 +538,10 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
              {"invert", "set to ``True`` to invert the selection of indices"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "voxel_down_sample_on_grid",
+            {{"voxel_size", "Voxel size to downsample into."},
+             {"grid_origin", "A corner of the voxel grid."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample_and_trace",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -247,7 +553,15 @@ void pybind_pointcloud(py::module &m) {
               "Sample rate, the selected point indices are [0, k, 2k, ...]"}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "crop",
-            {{"bounding_box", "AxisAlignedBoundingBox to crop points"}});
+            {{"bounding_box", "AxisAlignedBoundingBox to crop points"},
+             {"bounding_boxes", "AxisAlignedBoundingBoxes to crop points"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_tiles",
+            {{"tile_size",
+              "Size of the tiles along every axis. Use inf to not split the "
+              "points along an axis."},
+             {"overlap",
+              "Distance by which the tiles are extended on every side."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_non_finite_points",
             {{"remove_nan", "Remove NaN values from the PointCloud"},
@@ -256,19 +570,41 @@ void pybind_pointcloud(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_radius_outlier",
             {{"nb_points", "Number of points within the radius."},
-             {"radius", "Radius of the sphere."}});
+             {"radius", "Radius of the sphere."},
+             {"graph",
+              "Neighbor graph of the point cloud containing all neighbors "
+              "within the radius."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_statistical_outlier",
             {{"nb_neighbors", "Number of neighbors around the target point."},
-             {"std_ratio", "Standard deviation ratio."}});
+             {"std_ratio", "Standard deviation ratio."},
+             {"graph", "Neighbor graph of the point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_radius_inlier_mask",
+            {{"nb_points", "Number of points within the radius."},
+             {"radius", "Radius of the sphere."},
+             {"graph",
+              "Neighbor graph of the point cloud containing all neighbors "
+              "within the radius."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_statistical_inlier_mask",
+            {{"nb_neighbors", "Number of neighbors around the target point."},
+             {"std_ratio", "Standard deviation ratio."},
+             {"graph", "Neighbor graph of the point cloud."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "estimate_normals",
             {{"search_param",
               "The KDTree search parameters for neighborhood search."},
+             {"graph", "Neighbor graph of the point cloud."},
              {"fast_normal_computation",
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
               "faster, but is not as numerical stable."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "estimate_covariances",
+            {{"search_param",
+              "The KDTree search parameters for neighborhood search."},
+             {"graph", "Neighbor graph of the point cloud."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "orient_normals_to_align_with_direction",
             {{"orientation_reference",
@@ -281,10 +617,23 @@ void pybind_pointcloud(py::module &m) {
             m, "PointCloud", "orient_normals_consistent_tangent_plane",
             {{"k",
               "Number of k nearest neighbors used in constructing the "
-              "Riemannian graph used to propogate normal orientation."}});
+              "Riemannian graph used to propogate normal orientation."},
+             {"graph",
+              "Neighbor graph of the point cloud used in constructing the "
+              "Riemannian graph."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_point_cloud_distance",
                                     {{"target", "The target point cloud."}});
+    docstring::ClassMethodDocInject(m, "PointCloud",
+                                    "compute_chamfer_distance",
+                                    {{"target", "The target point cloud."}});
+    docstring::ClassMethodDocInject(m, "PointCloud",
+                                    "compute_hausdorff_distance",
+                                    {{"target", "The target point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_distance_to_mesh",
+            {{"mesh", "The target triangle mesh."},
+             {"bvh", "The bounding volume hierarchy of the target mesh."}});
     docstring::ClassMethodDocInject(m, "PointCloud",
                                     "compute_mean_and_covariance");
     docstring::ClassMethodDocInject(m, "PointCloud",
@@ -293,12 +642,6 @@ void pybind_pointcloud(py::module &m) {
                                     "compute_nearest_neighbor_distance");
     docstring::ClassMethodDocInject(m, "PointCloud", "compute_convex_hull",
                                     {{"input", "The input point cloud."}});
-    docstring::ClassMethodDocInject(
-            m, "PointCloud", "hidden_point_removal",
-            {{"input", "The input point cloud."},
-             {"camera_location",
-              "All points not visible from that location will be reomved"},
-             {"radius", "The radius of the sperical projection"}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "cluster_dbscan",
             {{"eps",
@@ -314,7 +657,10 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The search "
+              "stops early once it is reached."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -331,6 +677,206 @@ void pybind_pointcloud(py::module &m) {
             {{"image", "The input image."},
              {"intrinsic", "Intrinsic parameters of the camera."},
              {"extrnsic", "Extrinsic parameters of the camera."}});
+
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "create_from_rgbd_image_batch",
+            {{"images", "The input images."},
+             {"intrinsic", "Intrinsic parameters of the camera."},
+             {"extrinsics",
+              "Extrinsic parameters of the camera for each image. Identity "
+              "is used if empty."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "voxel_down_sample_batch",
+            {{"pointclouds", "The input pointclouds."},
+             {"voxel_size", "Voxel size to downsample into."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "estimate_normals_batch",
+            {{"pointclouds", "The pointclouds to compute normals for."},
+             {"search_param",
+              "The KDTree search parameters for neighborhood search."},
+             {"fast_normal_computation",
+              "If true, the normal estiamtion uses a non-iterative method to "
+              "extract the eigenvector from the covariance matrix. This is "
+              "faster, but is not as numerical stable."}});
+
+    py::class_<geometry::PointCloudTiles> pointcloud_tiles(
+            m, "PointCloudTiles",
+            "Partition of the points of a PointCloud into a regular grid of "
+            "axis aligned tiles. The points of tile t are "
+            "indices[offsets[t]:offsets[t + 1]].");
+    py::detail::bind_default_constructor<geometry::PointCloudTiles>(
+            pointcloud_tiles);
+    py::detail::bind_copy_functions<geometry::PointCloudTiles>(
+            pointcloud_tiles);
+    pointcloud_tiles
+            .def("__repr__",
+                 [](const geometry::PointCloudTiles &tiles) {
+                     return std::string("geometry::PointCloudTiles with ") +
+                            std::to_string(tiles.NumTiles()) + " tiles.";
+                 })
+            .def("num_tiles", &geometry::PointCloudTiles::NumTiles,
+                 "Returns the number of tiles.")
+            .def("get_tile_indices", &geometry::PointCloudTiles::GetTileIndices,
+                 "Returns the indices of the points in a tile.", "t"_a)
+            .def("get_tile_bounding_box",
+                 &geometry::PointCloudTiles::GetTileBoundingBox,
+                 "Returns the bounds of a tile, including the overlap.", "t"_a)
+            .def_readwrite("origin", &geometry::PointCloudTiles::origin_,
+                           "Minimum bound of the first tile, without the "
+                           "overlap.")
+            .def_readwrite("tile_size", &geometry::PointCloudTiles::tile_size_,
+                           "Size of the tiles along every axis.")
+            .def_readwrite("overlap", &geometry::PointCloudTiles::overlap_,
+                           "Distance by which the tiles are extended.")
+            .def_readwrite("grid_size", &geometry::PointCloudTiles::num_tiles_,
+                           "Number of tiles along every axis.")
+            .def_readwrite("offsets", &geometry::PointCloudTiles::offsets_,
+                           "Offsets of the tiles in indices.")
+            .def_readwrite("indices", &geometry::PointCloudTiles::indices_,
+                           "Point indices of all tiles.");
+
+    py::class_<geometry::RGBDBackProjector> rgbd_back_projector(
+            m, "RGBDBackProjector",
+            "Back-projects the depth or RGB-D images of a camera into point "
+            "clouds, frame after frame. The pixel rays are cached per "
+            "intrinsic and the output point cloud is overwritten in place.");
+    py::detail::bind_copy_functions<geometry::RGBDBackProjector>(
+            rgbd_back_projector);
+    rgbd_back_projector
+            .def(py::init<double, double, double, int, bool>(),
+                 "depth_scale"_a = 1000.0, "depth_min"_a = 0.0,
+                 "depth_max"_a = 1000.0, "stride"_a = 1,
+                 "project_valid_depth_only"_a = true)
+            .def("__repr__",
+                 [](const geometry::RGBDBackProjector &projector) {
+                     return std::string(
+                                    "geometry::RGBDBackProjector with "
+                                    "depth_scale = ") +
+                            std::to_string(projector.depth_scale_) +
+                            ", depth_min = " +
+                            std::to_string(projector.depth_min_) +
+                            ", depth_max = " +
+                            std::to_string(projector.depth_max_) +
+                            ", stride = " + std::to_string(projector.stride_);
+                 })
+            .def("create_from_depth_image",
+                 &geometry::RGBDBackProjector::CreateFromDepthImage,
+                 "Back-projects a float or uint16 depth image into "
+                 "pointcloud.",
+                 "depth"_a, "intrinsic"_a, "extrinsic"_a, "pointcloud"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("create_from_rgbd_image",
+                 &geometry::RGBDBackProjector::CreateFromRGBDImage,
+                 "Back-projects an RGB-D image into pointcloud, with colors.",
+                 "image"_a, "intrinsic"_a, "extrinsic"_a, "pointcloud"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("depth_scale",
+                           &geometry::RGBDBackProjector::depth_scale_,
+                           "The depth of uint16 images is scaled by 1 / "
+                           "depth_scale.")
+            .def_readwrite("depth_min",
+                           &geometry::RGBDBackProjector::depth_min_,
+                           "Pixels with a depth of at most depth_min are "
+                           "invalid.")
+            .def_readwrite("depth_max",
+                           &geometry::RGBDBackProjector::depth_max_,
+                           "Pixels with a depth of at least depth_max are "
+                           "invalid.")
+            .def_readwrite("stride", &geometry::RGBDBackProjector::stride_,
+                           "Only every stride-th row and column is projected.")
+            .def_readwrite(
+                    "project_valid_depth_only",
+                    &geometry::RGBDBackProjector::project_valid_depth_only_,
+                    "If false, invalid pixels result in NaN points.");
+
+    // geometry::CompactPointCloud
+    py::class_<geometry::CompactPointCloud,
+               std::shared_ptr<geometry::CompactPointCloud>>
+            compact_pointcloud(m, "CompactPointCloud",
+                               "Point cloud with single precision points, "
+                               "normals and colors, which uses half the "
+                               "memory of PointCloud.");
+    py::detail::bind_default_constructor<geometry::CompactPointCloud>(
+            compact_pointcloud);
+    py::detail::bind_copy_functions<geometry::CompactPointCloud>(
+            compact_pointcloud);
+    compact_pointcloud
+            .def("__repr__",
+                 [](const geometry::CompactPointCloud &pcd) {
+                     return std::string(
+                                    "geometry::CompactPointCloud with ") +
+                            std::to_string(pcd.points_.size()) + " points.";
+                 })
+            .def("is_empty", &geometry::CompactPointCloud::IsEmpty,
+                 "Returns ``True`` if the point cloud contains no points.")
+            .def("get_storage_bytes",
+                 &geometry::CompactPointCloud::GetStorageBytes,
+                 "Returns the number of bytes allocated for the attributes.")
+            .def("has_points", &geometry::CompactPointCloud::HasPoints,
+                 "Returns ``True`` if the point cloud contains points.")
+            .def("has_normals", &geometry::CompactPointCloud::HasNormals,
+                 "Returns ``True`` if the point cloud contains point normals.")
+            .def("has_colors", &geometry::CompactPointCloud::HasColors,
+                 "Returns ``True`` if the point cloud contains point colors.")
+            .def("get_min_bound", &geometry::CompactPointCloud::GetMinBound,
+                 "Returns min bounds for geometry coordinates.")
+            .def("get_max_bound", &geometry::CompactPointCloud::GetMaxBound,
+                 "Returns max bounds for geometry coordinates.")
+            .def("transform", &geometry::CompactPointCloud::Transform,
+                 "transformation"_a,
+                 "Apply transformation (4x4 matrix) to the geometry "
+                 "coordinates.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("remove_non_finite_points",
+                 &geometry::CompactPointCloud::RemoveNonFinitePoints,
+                 "remove_nan"_a = true, "remove_infinite"_a = true,
+                 "Function to remove non-finite points from the point cloud.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("voxel_down_sample",
+                 &geometry::CompactPointCloud::VoxelDownSample, "voxel_size"_a,
+                 "Function to downsample input pointcloud into output "
+                 "pointcloud with a voxel.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("estimate_normals",
+                 &geometry::CompactPointCloud::EstimateNormals,
+                 "search_param"_a = geometry::KDTreeSearchParamKNN(),
+                 "fast_normal_computation"_a = true,
+                 "Function to compute the normals of a point cloud from a "
+                 "single precision KDTree.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("to_point_cloud", &geometry::CompactPointCloud::ToPointCloud,
+                 "Convert to PointCloud.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def_static("create_from_point_cloud",
+                        &geometry::CompactPointCloud::CreateFromPointCloud,
+                        "pointcloud"_a,
+                        "Creates a point cloud by rounding the attributes of "
+                        "a PointCloud to single precision.",
+                        py::call_guard<py::gil_scoped_release>())
+            .def_property_readonly(
+                    "points",
+                    [](const geometry::CompactPointCloud &pcd) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                pcd.points_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_points, 3)``, a copy "
+                    "of the point coordinates.")
+            .def_property_readonly(
+                    "normals",
+                    [](const geometry::CompactPointCloud &pcd) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                pcd.normals_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_points, 3)``, a copy "
+                    "of the point normals.")
+            .def_property_readonly(
+                    "colors",
+                    [](const geometry::CompactPointCloud &pcd) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                pcd.colors_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_points, 3)``, a copy "
+                    "of the RGB colors of points.");
 }
 
 void pybind_pointcloud_methods(py::module &m) {}
@@ -85,7 +85,8 @@ void pybind_tetramesh(py::module &m) {
                  &geometry::TetraMesh::ExtractTriangleMesh,
                  "Function that generates a triangle mesh of the specified "
                  "iso-surface.",
-                 "values"_a, "level"_a)
+                 "values"_a, "level"_a,
+                 py::call_guard<py::gil_scoped_release>())
             .def_static(
                     "create_from_point_cloud",
                     &geometry::TetraMesh::CreateFromPointCloud,
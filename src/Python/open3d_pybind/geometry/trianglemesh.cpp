@@ -25,6 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/CompactTriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
 
@@ -35,6 +38,101 @@
 namespace open3d {
 
 void pybind_trianglemesh(py::module &m) {
+    py::class_<geometry::PoissonReconstructionOption> poisson_option(
+            m, "PoissonReconstructionOption",
+            "Options of TriangleMesh.create_from_point_cloud_poisson, "
+            "including the number of threads and a tiled mode with bounded "
+            "memory for large point clouds.");
+    py::detail::bind_copy_functions<geometry::PoissonReconstructionOption>(
+            poisson_option);
+    poisson_option
+            .def(py::init<size_t, size_t, float, bool, int, size_t, double>(),
+                 "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
+                 "linear_fit"_a = false, "num_threads"_a = 0,
+                 "max_points_per_tile"_a = 0, "tile_overlap"_a = 0.1)
+            .def_readwrite("depth",
+                           &geometry::PoissonReconstructionOption::depth_,
+                           "Maximum depth of the tree that will be used for "
+                           "surface reconstruction.")
+            .def_readwrite("width",
+                           &geometry::PoissonReconstructionOption::width_,
+                           "Target width of the finest level octree cells, "
+                           "overrides depth if larger than 0.")
+            .def_readwrite("scale",
+                           &geometry::PoissonReconstructionOption::scale_,
+                           "Ratio between the diameter of the cube used for "
+                           "reconstruction and the diameter of the samples' "
+                           "bounding cube.")
+            .def_readwrite("linear_fit",
+                           &geometry::PoissonReconstructionOption::linear_fit_,
+                           "If True, iso-vertices are placed by linear "
+                           "interpolation.")
+            .def_readwrite("num_threads",
+                           &geometry::PoissonReconstructionOption::num_threads_,
+                           "Number of threads, 0 uses the global setting.")
+            .def_readwrite(
+                    "max_points_per_tile",
+                    &geometry::PoissonReconstructionOption::
+                            max_points_per_tile_,
+                    "If larger than 0, point clouds with more points are "
+                    "split into tiles of at most this many points that are "
+                    "reconstructed one after the other.")
+            .def_readwrite(
+                    "tile_overlap",
+                    &geometry::PoissonReconstructionOption::tile_overlap_,
+                    "Overlap of neighboring tiles, relative to the extent of "
+                    "a tile.")
+            .def("__repr__",
+                 [](const geometry::PoissonReconstructionOption &option) {
+                     return fmt::format(
+                             "geometry::PoissonReconstructionOption with "
+                             "depth={:d}, num_threads={:d} and "
+                             "max_points_per_tile={:d}",
+                             option.depth_, option.num_threads_,
+                             option.max_points_per_tile_);
+                 });
+
+    py::class_<geometry::PoissonReconstructionStatistics> poisson_statistics(
+            m, "PoissonReconstructionStatistics",
+            "Per-stage timing in milliseconds and peak memory in MB of "
+            "TriangleMesh.create_from_point_cloud_poisson.");
+    py::detail::bind_default_constructor<
+            geometry::PoissonReconstructionStatistics>(poisson_statistics);
+    poisson_statistics
+            .def_readonly("num_points",
+                          &geometry::PoissonReconstructionStatistics::
+                                  num_points_)
+            .def_readonly("num_samples",
+                          &geometry::PoissonReconstructionStatistics::
+                                  num_samples_)
+            .def_readonly(
+                    "num_tiles",
+                    &geometry::PoissonReconstructionStatistics::num_tiles_)
+            .def_readonly(
+                    "octree_time",
+                    &geometry::PoissonReconstructionStatistics::octree_time_)
+            .def_readonly(
+                    "solve_time",
+                    &geometry::PoissonReconstructionStatistics::solve_time_)
+            .def_readonly("iso_surface_time",
+                          &geometry::PoissonReconstructionStatistics::
+                                  iso_surface_time_)
+            .def_readonly(
+                    "total_time",
+                    &geometry::PoissonReconstructionStatistics::total_time_)
+            .def_readonly("peak_memory_mb",
+                          &geometry::PoissonReconstructionStatistics::
+                                  peak_memory_mb_)
+            .def("__repr__",
+                 [](const geometry::PoissonReconstructionStatistics &s) {
+                     return fmt::format(
+                             "geometry::PoissonReconstructionStatistics with "
+                             "{:d} tiles, octree {:.1f} ms, solve {:.1f} ms, "
+                             "iso-surface {:.1f} ms and peak memory {:.1f} MB",
+                             s.num_tiles_, s.octree_time_, s.solve_time_,
+                             s.iso_surface_time_, s.peak_memory_mb_);
+                 });
+
     py::class_<geometry::TriangleMesh, PyGeometry3D<geometry::TriangleMesh>,
                std::shared_ptr<geometry::TriangleMesh>, geometry::MeshBase>
             trianglemesh(m, "TriangleMesh",
@@ -67,31 +165,92 @@ void pybind_trianglemesh(py::module &m) {
                      }
                      return info;
                  })
+            .def(py::pickle(
+                    [](py::object self) {
+                        const auto &mesh =
+                                self.cast<const geometry::TriangleMesh &>();
+                        py::tuple textures(mesh.textures_.size());
+                        for (size_t i = 0; i < mesh.textures_.size(); ++i) {
+                            textures[i] = image_to_pickle_state(
+                                    mesh.textures_[i], self);
+                        }
+                        return py::make_tuple(
+                                py::detail::vector_to_pickle_array<double>(
+                                        mesh.vertices_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        mesh.vertex_normals_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        mesh.vertex_colors_, self),
+                                py::detail::vector_to_pickle_array<int>(
+                                        mesh.triangles_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        mesh.triangle_normals_, self),
+                                py::detail::vector_to_pickle_array<double>(
+                                        mesh.triangle_uvs_, self),
+                                py::detail::vector_to_pickle_array<int>(
+                                        mesh.triangle_material_ids_, self),
+                                textures);
+                    },
+                    [](const py::tuple &state) {
+                        if (state.size() != 8) {
+                            throw std::runtime_error("Invalid pickle state.");
+                        }
+                        auto mesh = std::make_shared<geometry::TriangleMesh>();
+                        py::detail::pickle_array_to_vector<double>(
+                                state[0], mesh->vertices_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[1], mesh->vertex_normals_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[2], mesh->vertex_colors_);
+                        py::detail::pickle_array_to_vector<int>(
+                                state[3], mesh->triangles_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[4], mesh->triangle_normals_);
+                        py::detail::pickle_array_to_vector<double>(
+                                state[5], mesh->triangle_uvs_);
+                        py::detail::pickle_array_to_vector<int>(
+                                state[6], mesh->triangle_material_ids_);
+                        auto textures = state[7].cast<py::tuple>();
+                        mesh->textures_.resize(textures.size());
+                        for (size_t i = 0; i < textures.size(); ++i) {
+                            image_from_pickle_state(
+                                    textures[i].cast<py::tuple>(),
+                                    mesh->textures_[i]);
+                        }
+                        return mesh;
+                    }))
             .def(py::self + py::self)
             .def(py::self += py::self)
             .def("compute_triangle_normals",
                  &geometry::TriangleMesh::ComputeTriangleNormals,
                  "Function to compute triangle normals, usually called before "
                  "rendering",
-                 "normalized"_a = true)
+                 "normalized"_a = true,
+                 py::call_guard<py::gil_scoped_release>())
             .def("compute_vertex_normals",
                  &geometry::TriangleMesh::ComputeVertexNormals,
                  "Function to compute vertex normals, usually called before "
                  "rendering",
-                 "normalized"_a = true)
+                 "normalized"_a = true,
+                 "weighting"_a = geometry::MeshBase::VertexNormalWeighting::
+                         TriangleNormals,
+                 py::call_guard<py::gil_scoped_release>())
             .def("compute_adjacency_list",
                  &geometry::TriangleMesh::ComputeAdjacencyList,
                  "Function to compute adjacency list, call before adjacency "
-                 "list is needed")
+                 "list is needed",
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_duplicated_vertices",
                  &geometry::TriangleMesh::RemoveDuplicatedVertices,
                  "Function that removes duplicated verties, i.e., vertices "
-                 "that have identical coordinates.")
+                 "that have identical coordinates.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_duplicated_triangles",
                  &geometry::TriangleMesh::RemoveDuplicatedTriangles,
                  "Function that removes duplicated triangles, i.e., removes "
                  "triangles that reference the same three vertices, "
-                 "independent of their order.")
+                 "independent of their order.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_unreferenced_vertices",
                  &geometry::TriangleMesh::RemoveUnreferencedVertices,
                  "This function removes vertices from the triangle mesh that "
@@ -117,7 +276,7 @@ void pybind_trianglemesh(py::module &m) {
                  "defines the maximum distance of close by vertices.  This "
                  "function might help to "
                  "close triangle soups.",
-                 "eps"_a)
+                 "eps"_a, py::call_guard<py::gil_scoped_release>())
             .def("filter_sharpen", &geometry::TriangleMesh::FilterSharpen,
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
@@ -125,7 +284,8 @@ void pybind_trianglemesh(py::module &m) {
                  ":math:`v_o = v_i x strength (v_i * |N| - \\sum_{n \\in N} "
                  "v_n)`",
                  "number_of_iterations"_a = 1, "strength"_a = 1,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 py::call_guard<py::gil_scoped_release>())
             .def("filter_smooth_simple",
                  &geometry::TriangleMesh::FilterSmoothSimple,
                  "Function to smooth triangle mesh with simple neighbour "
@@ -134,7 +294,8 @@ void pybind_trianglemesh(py::module &m) {
                  ":math:`v_o` the output value, and :math:`N` is the set of "
                  "adjacent neighbours.",
                  "number_of_iterations"_a = 1,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 py::call_guard<py::gil_scoped_release>())
             .def("filter_smooth_laplacian",
                  &geometry::TriangleMesh::FilterSmoothLaplacian,
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
@@ -145,7 +306,8 @@ void pybind_trianglemesh(py::module &m) {
                  "inverse distance (closer neighbours have higher weight), and "
                  "lambda is the smoothing parameter.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 py::call_guard<py::gil_scoped_release>())
             .def("filter_smooth_taubin",
                  &geometry::TriangleMesh::FilterSmoothTaubin,
                  "Function to smooth triangle mesh using method of Taubin, "
@@ -155,7 +317,8 @@ void pybind_trianglemesh(py::module &m) {
                  "parameter mu as smoothing parameter. This method avoids "
                  "shrinkage of the triangle mesh.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5, "mu"_a = -0.53,
-                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 py::call_guard<py::gil_scoped_release>())
             .def("has_vertices", &geometry::TriangleMesh::HasVertices,
                  "Returns ``True`` if the mesh contains vertices.")
             .def("has_triangles", &geometry::TriangleMesh::HasTriangles,
@@ -204,18 +367,21 @@ void pybind_trianglemesh(py::module &m) {
                  "Tests if all vertices of the triangle mesh are manifold.")
             .def("is_self_intersecting",
                  &geometry::TriangleMesh::IsSelfIntersecting,
-                 "Tests if the triangle mesh is self-intersecting.")
+                 "Tests if the triangle mesh is self-intersecting.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("get_self_intersecting_triangles",
                  &geometry::TriangleMesh::GetSelfIntersectingTriangles,
                  "Returns a list of indices to triangles that intersect the "
-                 "mesh.")
+                 "mesh.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("is_intersecting", &geometry::TriangleMesh::IsIntersecting,
                  "Tests if the triangle mesh is intersecting the other "
                  "triangle mesh.")
             .def("is_orientable", &geometry::TriangleMesh::IsOrientable,
                  "Tests if the triangle mesh is orientable.")
             .def("is_watertight", &geometry::TriangleMesh::IsWatertight,
-                 "Tests if the triangle mesh is watertight.")
+                 "Tests if the triangle mesh is watertight.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("orient_triangles", &geometry::TriangleMesh::OrientTriangles,
                  "If the mesh is orientable this function orients all "
                  "triangles such that all normals point towards the same "
@@ -249,7 +415,7 @@ void pybind_trianglemesh(py::module &m) {
                  &geometry::TriangleMesh::SamplePointsUniformly,
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
-                 "seed"_a = -1)
+                 "seed"_a = -1, py::call_guard<py::gil_scoped_release>())
             .def("sample_points_poisson_disk",
                  &geometry::TriangleMesh::SamplePointsPoissonDisk,
                  "Function to sample points from the mesh, where each point "
@@ -259,31 +425,40 @@ void pybind_trianglemesh(py::module &m) {
                  "noise). Method is based on Yuksel, \"Sample Elimination for "
                  "Generating Poisson Disk Sample Sets\", EUROGRAPHICS, 2015.",
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
-                 "use_triangle_normal"_a = false, "seed"_a = -1)
+                 "use_triangle_normal"_a = false, "seed"_a = -1,
+                 "method"_a = geometry::MeshBase::PoissonDiskSamplingMethod::
+                         SampleElimination,
+                 py::call_guard<py::gil_scoped_release>())
             .def("subdivide_midpoint",
                  &geometry::TriangleMesh::SubdivideMidpoint,
                  "Function subdivide mesh using midpoint algorithm.",
-                 "number_of_iterations"_a = 1)
+                 "number_of_iterations"_a = 1,
+                 py::call_guard<py::gil_scoped_release>())
             .def("subdivide_loop", &geometry::TriangleMesh::SubdivideLoop,
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
-                 "number_of_iterations"_a = 1)
+                 "number_of_iterations"_a = 1,
+                 py::call_guard<py::gil_scoped_release>())
             .def("simplify_vertex_clustering",
                  &geometry::TriangleMesh::SimplifyVertexClustering,
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a =
-                         geometry::MeshBase::SimplificationContraction::Average)
+                         geometry::MeshBase::SimplificationContraction::Average,
+                 py::call_guard<py::gil_scoped_release>())
             .def("simplify_quadric_decimation",
                  &geometry::TriangleMesh::SimplifyQuadricDecimation,
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
-                 "target_number_of_triangles"_a)
+                 "target_number_of_triangles"_a,
+                 "method"_a = geometry::MeshBase::QuadricDecimationMethod::
+                         Sequential, py::call_guard<py::gil_scoped_release>())
             .def("compute_convex_hull",
                  &geometry::TriangleMesh::ComputeConvexHull,
-                 "Computes the convex hull of the triangle mesh.")
+                 "Computes the convex hull of the triangle mesh.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("cluster_connected_triangles",
                  &geometry::TriangleMesh::ClusterConnectedTriangles,
                  "Function that clusters connected triangles, i.e., triangles "
@@ -291,7 +466,8 @@ void pybind_trianglemesh(py::module &m) {
                  "index.  This function returns an array that contains the "
                  "cluster index per triangle, a second array contains the "
                  "number of triangles per cluster, and a third vector contains "
-                 "the surface area per cluster.")
+                 "the surface area per cluster.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("remove_triangles_by_index",
                  &geometry::TriangleMesh::RemoveTrianglesByIndex,
                  "This function removes the triangles with index in "
@@ -325,7 +501,8 @@ void pybind_trianglemesh(py::module &m) {
                  "max_iter"_a,
                  "energy"_a = geometry::MeshBase::
                          DeformAsRigidAsPossibleEnergy::Spokes,
-                 "smoothed_alpha"_a = 0.01)
+                 "smoothed_alpha"_a = 0.01,
+                 py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_point_cloud_alpha_shape",
                         [](const geometry::PointCloud &pcd, double alpha) {
                             return geometry::TriangleMesh::
@@ -335,14 +512,16 @@ void pybind_trianglemesh(py::module &m) {
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
-                        "pcd"_a, "alpha"_a)
+                        "pcd"_a, "alpha"_a,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_point_cloud_alpha_shape",
                         &geometry::TriangleMesh::CreateFromPointCloudAlphaShape,
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape schrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
-                        "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+                        "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &geometry::TriangleMesh::CreateFromPointCloudBallPivoting,
@@ -355,10 +534,16 @@ void pybind_trianglemesh(py::module &m) {
                     "Ball Pivoting Algorithm\", 2014. The surface "
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
-                    "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "three points a triangle is created. If "
+                    "max_points_per_tile is larger than 0, larger point "
+                    "clouds are split into tiles that are reconstructed in "
+                    "parallel and stitched along their boundaries.",
+                    "pcd"_a, "radii"_a, "max_points_per_tile"_a = 0)
             .def_static("create_from_point_cloud_poisson",
-                        &geometry::TriangleMesh::CreateFromPointCloudPoisson,
+                        py::overload_cast<const geometry::PointCloud &, size_t,
+                                          size_t, float, bool>(
+                                &geometry::TriangleMesh::
+                                        CreateFromPointCloudPoisson),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -366,7 +551,21 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false)
+                        "linear_fit"_a = false,
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static(
+                    "create_from_point_cloud_poisson",
+                    py::overload_cast<
+                            const geometry::PointCloud &,
+                            const geometry::PoissonReconstructionOption &>(
+                            &geometry::TriangleMesh::
+                                    CreateFromPointCloudPoisson),
+                    "Screened Poisson Reconstruction with the number of "
+                    "threads and the tiled mode set in option. Returns the "
+                    "mesh, the per vertex densities and the "
+                    "PoissonReconstructionStatistics.",
+                    "pcd"_a, "option"_a,
+                    py::call_guard<py::gil_scoped_release>())
             .def_static("create_box", &geometry::TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -475,8 +674,12 @@ void pybind_trianglemesh(py::module &m) {
                                     "compute_adjacency_list");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "compute_triangle_normals");
-    docstring::ClassMethodDocInject(m, "TriangleMesh",
-                                    "compute_vertex_normals");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "compute_vertex_normals",
+            {{"normalized",
+              "Set to ``True`` to normalize the normal to length 1."},
+             {"weighting",
+              "How the triangles around a vertex are weighted."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "has_adjacency_list");
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "has_triangle_normals",
@@ -598,7 +801,12 @@ void pybind_trianglemesh(py::module &m) {
               "necessary."},
              {"seed",
               "Seed value used in the random generator, set to -1 to use a "
-              "random seed value with each function call."}});
+              "random seed value with each function call."},
+             {"method",
+              "SampleElimination eliminates the samples of largest weight one "
+              "at a time. ParallelGrid accepts samples that keep a minimum "
+              "distance on a grid in parallel, which is faster on large "
+              "point counts."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "subdivide_midpoint",
             {{"number_of_iterations",
@@ -621,7 +829,11 @@ void pybind_trianglemesh(py::module &m) {
             m, "TriangleMesh", "simplify_quadric_decimation",
             {{"target_number_of_triangles",
               "The number of triangles that the simplified mesh should have. "
-              "It is not guaranteed that this number will be reached."}});
+              "It is not guaranteed that this number will be reached."},
+             {"method",
+              "Sequential collapses one edge at a time in order of cost. "
+              "Parallel decimates spatial partitions of the mesh in parallel, "
+              "which is faster and needs less memory on large meshes."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -787,6 +999,171 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Moebius strip."},
              {"width", "Width of the Moebius strip."},
              {"scale", "Scale the complete Moebius strip."}});
+
+    py::class_<geometry::AsRigidAsPossibleDeformer> arap_deformer(
+            m, "AsRigidAsPossibleDeformer",
+            "Deforms a triangle mesh as rigid as possible for a fixed set of "
+            "constrained vertices. The factorization of the system matrix is "
+            "computed once, so the constraint positions can be changed "
+            "interactively.");
+    arap_deformer
+            .def(py::init<const geometry::TriangleMesh &,
+                          const std::vector<int> &>(),
+                 "mesh"_a, "constraint_vertex_indices"_a)
+            .def("__repr__",
+                 [](const geometry::AsRigidAsPossibleDeformer &deformer) {
+                     return "geometry::AsRigidAsPossibleDeformer with " +
+                            std::to_string(deformer.NumConstraints()) +
+                            " constraints";
+                 })
+            .def("deform",
+                 (std::shared_ptr<geometry::TriangleMesh>(
+                         geometry::AsRigidAsPossibleDeformer::*)(
+                         const std::vector<Eigen::Vector3d> &, size_t,
+                         geometry::MeshBase::DeformAsRigidAsPossibleEnergy,
+                         double) const) &
+                         geometry::AsRigidAsPossibleDeformer::Deform,
+                 "Returns a copy of the mesh deformed from the rest pose.",
+                 "constraint_vertex_positions"_a, "max_iter"_a,
+                 "energy"_a = geometry::MeshBase::
+                         DeformAsRigidAsPossibleEnergy::Spokes,
+                 "smoothed_alpha"_a = 0.01)
+            .def("deform_vertices",
+                 [](const geometry::AsRigidAsPossibleDeformer &deformer,
+                    const std::vector<Eigen::Vector3d>
+                            &constraint_vertex_positions,
+                    std::vector<Eigen::Vector3d> vertices, size_t max_iter,
+                    geometry::MeshBase::DeformAsRigidAsPossibleEnergy energy,
+                    double smoothed_alpha) {
+                     deformer.Deform(constraint_vertex_positions, vertices,
+                                     max_iter, energy, smoothed_alpha);
+                     return vertices;
+                 },
+                 "Returns the deformed vertex positions, starting from the "
+                 "given vertices, e.g. the result of the previous call.",
+                 "constraint_vertex_positions"_a, "vertices"_a, "max_iter"_a,
+                 "energy"_a = geometry::MeshBase::
+                         DeformAsRigidAsPossibleEnergy::Spokes,
+                 "smoothed_alpha"_a = 0.01);
+    docstring::ClassMethodDocInject(
+            m, "AsRigidAsPossibleDeformer", "deform",
+            {{"constraint_vertex_positions",
+              "Positions of the constrained vertices, in the order of "
+              "constraint_vertex_indices."},
+             {"max_iter",
+              "Maximum number of iterations to minimize energy functional."},
+             {"energy",
+              "Energy model that is minimized in the deformation process"},
+             {"smoothed_alpha",
+              "trade-off parameter for the smoothed energy functional for the "
+              "regularization term."}});
+    docstring::ClassMethodDocInject(
+            m, "AsRigidAsPossibleDeformer", "deform_vertices",
+            {{"constraint_vertex_positions",
+              "Positions of the constrained vertices, in the order of "
+              "constraint_vertex_indices."},
+             {"vertices",
+              "Initial guess of the vertex positions. If it is empty, the "
+              "iterations start from the rest pose."},
+             {"max_iter",
+              "Maximum number of iterations to minimize energy functional."},
+             {"energy",
+              "Energy model that is minimized in the deformation process"},
+             {"smoothed_alpha",
+              "trade-off parameter for the smoothed energy functional for the "
+              "regularization term."}});
+
+    // geometry::CompactTriangleMesh
+    py::class_<geometry::CompactTriangleMesh,
+               std::shared_ptr<geometry::CompactTriangleMesh>>
+            compact_trianglemesh(m, "CompactTriangleMesh",
+                                 "Triangle mesh with single precision "
+                                 "vertices, vertex normals and vertex colors.");
+    py::detail::bind_default_constructor<geometry::CompactTriangleMesh>(
+            compact_trianglemesh);
+    py::detail::bind_copy_functions<geometry::CompactTriangleMesh>(
+            compact_trianglemesh);
+    compact_trianglemesh
+            .def("__repr__",
+                 [](const geometry::CompactTriangleMesh &mesh) {
+                     return std::string(
+                                    "geometry::CompactTriangleMesh with ") +
+                            std::to_string(mesh.vertices_.size()) +
+                            " points and " +
+                            std::to_string(mesh.triangles_.size()) +
+                            " triangles.";
+                 })
+            .def("is_empty", &geometry::CompactTriangleMesh::IsEmpty,
+                 "Returns ``True`` if the mesh contains no vertices.")
+            .def("get_storage_bytes",
+                 &geometry::CompactTriangleMesh::GetStorageBytes,
+                 "Returns the number of bytes allocated for the attributes.")
+            .def("has_vertices", &geometry::CompactTriangleMesh::HasVertices,
+                 "Returns ``True`` if the mesh contains vertices.")
+            .def("has_triangles", &geometry::CompactTriangleMesh::HasTriangles,
+                 "Returns ``True`` if the mesh contains triangles.")
+            .def("has_vertex_normals",
+                 &geometry::CompactTriangleMesh::HasVertexNormals,
+                 "Returns ``True`` if the mesh contains vertex normals.")
+            .def("has_vertex_colors",
+                 &geometry::CompactTriangleMesh::HasVertexColors,
+                 "Returns ``True`` if the mesh contains vertex colors.")
+            .def("transform", &geometry::CompactTriangleMesh::Transform,
+                 "transformation"_a,
+                 "Apply transformation (4x4 matrix) to the vertices and "
+                 "vertex normals.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_vertex_normals",
+                 &geometry::CompactTriangleMesh::ComputeVertexNormals,
+                 "normalized"_a = true, "Function to compute vertex normals.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("to_compact_point_cloud",
+                 &geometry::CompactTriangleMesh::ToCompactPointCloud,
+                 "Returns the vertices, vertex normals and vertex colors as a "
+                 "CompactPointCloud.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("to_triangle_mesh",
+                 &geometry::CompactTriangleMesh::ToTriangleMesh,
+                 "Convert to TriangleMesh.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def_static("create_from_triangle_mesh",
+                        &geometry::CompactTriangleMesh::CreateFromTriangleMesh,
+                        "mesh"_a,
+                        "Creates a mesh by rounding the vertex attributes of "
+                        "a TriangleMesh to single precision.",
+                        py::call_guard<py::gil_scoped_release>())
+            .def_property_readonly(
+                    "vertices",
+                    [](const geometry::CompactTriangleMesh &mesh) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                mesh.vertices_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_vertices, 3)``, a copy "
+                    "of the vertex coordinates.")
+            .def_property_readonly(
+                    "vertex_normals",
+                    [](const geometry::CompactTriangleMesh &mesh) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                mesh.vertex_normals_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_vertices, 3)``, a copy "
+                    "of the vertex normals.")
+            .def_property_readonly(
+                    "vertex_colors",
+                    [](const geometry::CompactTriangleMesh &mesh) {
+                        return py::detail::vector_to_pickle_array<float>(
+                                mesh.vertex_colors_, py::handle());
+                    },
+                    "``float32`` array of shape ``(num_vertices, 3)``, a copy "
+                    "of the RGB colors of vertices.")
+            .def_property_readonly(
+                    "triangles",
+                    [](const geometry::CompactTriangleMesh &mesh) {
+                        return py::detail::vector_to_pickle_array<int>(
+                                mesh.triangles_, py::handle());
+                    },
+                    "``int`` array of shape ``(num_triangles, 3)``, a copy "
+                    "of the vertex indices of the triangles.");
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_trianglemeshadjacency(py::module &m) {
+    py::class_<geometry::TriangleMeshAdjacency,
+               std::shared_ptr<geometry::TriangleMeshAdjacency>>
+            adjacency(m, "TriangleMeshAdjacency",
+                      "Vertex and edge adjacency of a triangle mesh, stored "
+                      "in compressed sparse row layout. The triangles of "
+                      "edge e are ``edge_triangles[edge_offsets[e]:"
+                      "edge_offsets[e + 1]]`` and the neighbors of vertex i "
+                      "are ``vertex_neighbors[vertex_offsets[i]:"
+                      "vertex_offsets[i + 1]]``.");
+    py::detail::bind_default_constructor<geometry::TriangleMeshAdjacency>(
+            adjacency);
+    py::detail::bind_copy_functions<geometry::TriangleMeshAdjacency>(
+            adjacency);
+    adjacency
+            .def("__repr__",
+                 [](const geometry::TriangleMeshAdjacency &adjacency) {
+                     return std::string(
+                                    "geometry::TriangleMeshAdjacency with ") +
+                            std::to_string(adjacency.NumVertices()) +
+                            " vertices, " +
+                            std::to_string(adjacency.NumEdges()) +
+                            " edges and " +
+                            std::to_string(adjacency.NumTriangles()) +
+                            " triangles.";
+                 })
+            .def("num_vertices",
+                 &geometry::TriangleMeshAdjacency::NumVertices,
+                 "Returns the number of vertices.")
+            .def("num_edges", &geometry::TriangleMeshAdjacency::NumEdges,
+                 "Returns the number of undirected edges.")
+            .def("num_triangles",
+                 &geometry::TriangleMeshAdjacency::NumTriangles,
+                 "Returns the number of triangles.")
+            .def("num_vertex_neighbors",
+                 &geometry::TriangleMeshAdjacency::NumVertexNeighbors,
+                 "Returns the number of neighbors of a vertex.", "index"_a)
+            .def("num_edge_triangles",
+                 &geometry::TriangleMeshAdjacency::NumEdgeTriangles,
+                 "Returns the number of triangle references of an edge.",
+                 "index"_a)
+            .def("get_edge_index",
+                 &geometry::TriangleMeshAdjacency::GetEdgeIndex,
+                 "Returns the index of an edge, or -1 if it is not an edge "
+                 "of the mesh.",
+                 "vertex0"_a, "vertex1"_a)
+            .def_static("create_from_triangle_mesh",
+                        &geometry::TriangleMeshAdjacency::
+                                CreateFromTriangleMesh,
+                        "Function to build the adjacency of a triangle mesh.",
+                        "mesh"_a, py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("edges", &geometry::TriangleMeshAdjacency::edges_,
+                           "``int`` array of shape ``(num_edges, 2)``: "
+                           "Undirected edges, sorted, with vertex0 <= "
+                           "vertex1.")
+            .def_readwrite("edge_triangles",
+                           &geometry::TriangleMeshAdjacency::edge_triangles_,
+                           "``int`` array: Triangles of all edges, "
+                           "concatenated.")
+            .def_readwrite("edge_offsets",
+                           &geometry::TriangleMeshAdjacency::edge_offsets_,
+                           "``int64`` array of size ``num_edges + 1``: "
+                           "Offsets of the edges in ``edge_triangles``.")
+            .def_readwrite("triangle_edges",
+                           &geometry::TriangleMeshAdjacency::triangle_edges_,
+                           "``int`` array of shape ``(num_triangles, 3)``: "
+                           "Edges (0, 1), (1, 2) and (2, 0) of every "
+                           "triangle.")
+            .def_readwrite(
+                    "vertex_neighbors",
+                    &geometry::TriangleMeshAdjacency::vertex_neighbors_,
+                    "``int`` array: Neighbors of all vertices, concatenated.")
+            .def_readwrite("vertex_offsets",
+                           &geometry::TriangleMeshAdjacency::vertex_offsets_,
+                           "``int64`` array of size ``num_vertices + 1``: "
+                           "Offsets of the vertices in "
+                           "``vertex_neighbors``.");
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency",
+                                    "num_vertices");
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency", "num_edges");
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency",
+                                    "num_triangles");
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency",
+                                    "num_vertex_neighbors",
+                                    {{"index", "Index of the vertex."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency",
+                                    "num_edge_triangles",
+                                    {{"index", "Index of the edge."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshAdjacency", "get_edge_index",
+            {{"vertex0", "First vertex of the edge."},
+             {"vertex1", "Second vertex of the edge."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshAdjacency",
+                                    "create_from_triangle_mesh",
+                                    {{"mesh", "The input mesh."}});
+}
+
+}  // namespace open3d
@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+
+namespace open3d {
+
+void pybind_trianglemeshbvh(py::module &m) {
+    py::class_<geometry::TriangleMeshBVH,
+               std::shared_ptr<geometry::TriangleMeshBVH>>
+            trianglemeshbvh(m, "TriangleMeshBVH",
+                            "Bounding volume hierarchy over the triangles of "
+                            "a TriangleMesh for ray casting, closest point "
+                            "queries and intersection tests.");
+    py::detail::bind_default_constructor<geometry::TriangleMeshBVH>(
+            trianglemeshbvh);
+    py::detail::bind_copy_functions<geometry::TriangleMeshBVH>(
+            trianglemeshbvh);
+
+    py::class_<geometry::TriangleMeshBVH::RayHit> ray_hit(
+            trianglemeshbvh, "RayHit", "First intersection of a ray.");
+    ray_hit.def("is_hit", &geometry::TriangleMeshBVH::RayHit::IsHit,
+                "Returns ``True`` if the ray hit a triangle.")
+            .def_readonly("t", &geometry::TriangleMeshBVH::RayHit::t_,
+                          "``float64`` Ray parameter of the hit, infinity if "
+                          "nothing was hit.")
+            .def_readonly("triangle_index",
+                          &geometry::TriangleMeshBVH::RayHit::triangle_index_,
+                          "``int`` Index of the triangle hit, -1 if nothing "
+                          "was hit.")
+            .def_readonly("u", &geometry::TriangleMeshBVH::RayHit::u_,
+                          "``float64`` Barycentric coordinate of the second "
+                          "vertex of the triangle.")
+            .def_readonly("v", &geometry::TriangleMeshBVH::RayHit::v_,
+                          "``float64`` Barycentric coordinate of the third "
+                          "vertex of the triangle.");
+
+    py::class_<geometry::TriangleMeshBVH::ClosestPoint> closest_point(
+            trianglemeshbvh, "ClosestPoint",
+            "Closest point on the mesh to a query point.");
+    closest_point
+            .def_readonly("point",
+                          &geometry::TriangleMeshBVH::ClosestPoint::point_,
+                          "``float64`` vector of length 3: The closest point.")
+            .def_readonly(
+                    "triangle_index",
+                    &geometry::TriangleMeshBVH::ClosestPoint::triangle_index_,
+                    "``int`` Index of the triangle of the closest point.")
+            .def_readonly("distance2",
+                          &geometry::TriangleMeshBVH::ClosestPoint::distance2_,
+                          "``float64`` Squared distance to the query point.");
+
+    trianglemeshbvh.def(py::init<const geometry::TriangleMesh &>(), "mesh"_a)
+            .def("__repr__",
+                 [](const geometry::TriangleMeshBVH &bvh) {
+                     return std::string("geometry::TriangleMeshBVH with ") +
+                            std::to_string(bvh.NumTriangles()) +
+                            " triangles and " +
+                            std::to_string(bvh.nodes_.size()) + " nodes.";
+                 })
+            .def("set_triangle_mesh",
+                 &geometry::TriangleMeshBVH::SetTriangleMesh,
+                 "Builds the hierarchy over the triangles of a mesh.",
+                 "mesh"_a, py::call_guard<py::gil_scoped_release>())
+            .def("is_empty", &geometry::TriangleMeshBVH::IsEmpty,
+                 "Returns ``True`` if the hierarchy has no triangles.")
+            .def("num_triangles", &geometry::TriangleMeshBVH::NumTriangles,
+                 "Returns the number of triangles in the hierarchy.")
+            .def("cast_ray", &geometry::TriangleMeshBVH::CastRay,
+                 "Returns the first intersection of a ray with the mesh.",
+                 "origin"_a, "direction"_a,
+                 "t_max"_a = std::numeric_limits<double>::infinity())
+            .def("cast_rays", &geometry::TriangleMeshBVH::CastRays,
+                 "Casts a batch of rays in parallel.", "origins"_a,
+                 "directions"_a,
+                 "t_max"_a = std::numeric_limits<double>::infinity(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("is_occluded", &geometry::TriangleMeshBVH::IsOccluded,
+                 "Returns ``True`` if the ray hits any triangle.", "origin"_a,
+                 "direction"_a,
+                 "t_max"_a = std::numeric_limits<double>::infinity())
+            .def("test_occlusions", &geometry::TriangleMeshBVH::TestOcclusions,
+                 "Tests a batch of rays for occlusion in parallel.",
+                 "origins"_a, "directions"_a,
+                 "t_max"_a = std::numeric_limits<double>::infinity(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("compute_closest_point",
+                 &geometry::TriangleMeshBVH::ComputeClosestPoint,
+                 "Returns the closest point on the mesh to a query point.",
+                 "query"_a)
+            .def("compute_closest_points",
+                 &geometry::TriangleMeshBVH::ComputeClosestPoints,
+                 "Computes the closest points to a batch of query points in "
+                 "parallel.",
+                 "queries"_a, py::call_guard<py::gil_scoped_release>())
+            .def(
+                    "get_triangles_overlapping_box",
+                    [](const geometry::TriangleMeshBVH &bvh,
+                       const Eigen::Vector3d &min_bound,
+                       const Eigen::Vector3d &max_bound) {
+                        std::vector<int> indices;
+                        bvh.GetTrianglesOverlappingBox(min_bound, max_bound,
+                                                       indices);
+                        return indices;
+                    },
+                    "Returns the triangles whose bounding box overlaps the "
+                    "box.",
+                    "min_bound"_a, "max_bound"_a)
+            .def("render_depth_image",
+                 &geometry::TriangleMeshBVH::RenderDepthImage,
+                 "Renders the depth image of the mesh seen from a pinhole "
+                 "camera.",
+                 "camera_parameter"_a, py::call_guard<py::gil_scoped_release>())
+            .def_readonly("triangle_indices",
+                          &geometry::TriangleMeshBVH::triangle_indices_,
+                          "``int`` array: Mesh indices of the triangles, in "
+                          "leaf order.");
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "set_triangle_mesh",
+                                    {{"mesh", "The input mesh."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "is_empty");
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH", "num_triangles");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "cast_ray",
+            {{"origin", "Origin of the ray."},
+             {"direction", "Direction of the ray, need not be normalized."},
+             {"t_max", "Maximum ray parameter."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "cast_rays",
+            {{"origins", "Origins of the rays."},
+             {"directions", "Directions of the rays."},
+             {"t_max", "Maximum ray parameter."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "is_occluded",
+            {{"origin", "Origin of the ray."},
+             {"direction", "Direction of the ray, need not be normalized."},
+             {"t_max", "Maximum ray parameter."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "test_occlusions",
+            {{"origins", "Origins of the rays."},
+             {"directions", "Directions of the rays."},
+             {"t_max", "Maximum ray parameter."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH",
+                                    "compute_closest_point",
+                                    {{"query", "The query point."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshBVH",
+                                    "compute_closest_points",
+                                    {{"queries", "The query points."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "get_triangles_overlapping_box",
+            {{"min_bound", "Minimum corner of the box."},
+             {"max_bound", "Maximum corner of the box."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshBVH", "render_depth_image",
+            {{"camera_parameter",
+              "Intrinsic and extrinsic camera parameters."}});
+}
+
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/CompactVoxelGrid.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -108,7 +110,8 @@ void pybind_voxelgrid(py::module &m) {
                  "smaller, or equal than the projected depth of the boundary "
                  "point. If keep_voxels_outside_image is true then voxels are "
                  "only carved if all boundary points project to a valid image "
-                 "location.")
+                 "location.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("carve_silhouette", &geometry::VoxelGrid::CarveSilhouette,
                  "silhouette_mask"_a, "camera_params"_a,
                  "keep_voxels_outside_image"_a = false,
@@ -116,12 +119,26 @@ void pybind_voxelgrid(py::module &m) {
                  "boundary points of the voxel projects to a valid mask pixel "
                  "(pixel value > 0). If keep_voxels_outside_image is true then "
                  "voxels are only carved if all boundary points project to a "
-                 "valid image location.")
+                 "valid image location.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("carve_depth_maps", &geometry::VoxelGrid::CarveDepthMaps,
+                 "depth_maps"_a, "camera_trajectory"_a,
+                 "keep_voxels_outside_image"_a = false,
+                 "Carves the VoxelGrid with many depth maps at once, as "
+                 "carve_depth_map does for each of them.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("carve_silhouettes", &geometry::VoxelGrid::CarveSilhouettes,
+                 "silhouette_masks"_a, "camera_trajectory"_a,
+                 "keep_voxels_outside_image"_a = false,
+                 "Carves the VoxelGrid with many silhouette masks at once, as "
+                 "carve_silhouette does for each of them.",
+                 py::call_guard<py::gil_scoped_release>())
             .def("to_octree", &geometry::VoxelGrid::ToOctree, "max_depth"_a,
-                 "Convert to Octree.")
+                 "Convert to Octree.", py::call_guard<py::gil_scoped_release>())
             .def("create_from_octree", &geometry::VoxelGrid::CreateFromOctree,
                  "octree"_a
-                 "Convert from Octree.")
+                 "Convert from Octree.",
+                 py::call_guard<py::gil_scoped_release>())
             .def_static("create_dense", &geometry::VoxelGrid::CreateDense,
                         "Creates a voxel grid where every voxel is set (hence "
                         "dense). This is a useful starting point for voxel "
@@ -135,7 +152,8 @@ void pybind_voxelgrid(py::module &m) {
                         "value of the points that fall into it (if the "
                         "PointCloud has colors). The bounds of the created "
                         "VoxelGrid are computed from the PointCloud.",
-                        "input"_a, "voxel_size"_a)
+                        "input"_a, "voxel_size"_a,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_point_cloud_within_bounds",
                         &geometry::VoxelGrid::CreateFromPointCloudWithinBounds,
                         "Creates a VoxelGrid from a given PointCloud. The "
@@ -143,14 +161,16 @@ void pybind_voxelgrid(py::module &m) {
                         "value of the points that fall into it (if the "
                         "PointCloud has colors). The bounds of the created "
                         "VoxelGrid are defined by the given parameters.",
-                        "input"_a, "voxel_size"_a, "min_bound"_a, "max_bound"_a)
+                        "input"_a, "voxel_size"_a, "min_bound"_a, "max_bound"_a,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_triangle_mesh",
                         &geometry::VoxelGrid::CreateFromTriangleMesh,
                         "Creates a VoxelGrid from a given TriangleMesh. No "
                         "color information is converted. The bounds of the "
                         "created VoxelGrid are computed from the  "
                         "TriangleMesh.",
-                        "input"_a, "voxel_size"_a)
+                        "input"_a, "voxel_size"_a,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static(
                     "create_from_triangle_mesh_within_bounds",
                     &geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds,
@@ -188,6 +208,25 @@ void pybind_voxelgrid(py::module &m) {
              {"keep_voxels_outside_image",
               "retain voxels that don't project"
               " to pixels in the image"}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_depth_maps",
+            {{"depth_maps", "Depth maps (Image) used for VoxelGrid carving."},
+             {"camera_trajectory",
+              "PinholeCameraTrajectory with the camera parameters of each "
+              "depth map."},
+             {"keep_voxels_outside_image",
+              "retain voxels that don't project"
+              " to pixels in the image"}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_silhouettes",
+            {{"silhouette_masks",
+              "Silhouette masks (Image) used for VoxelGrid carving."},
+             {"camera_trajectory",
+              "PinholeCameraTrajectory with the camera parameters of each "
+              "silhouette mask."},
+             {"keep_voxels_outside_image",
+              "retain voxels that don't project"
+              " to pixels in the image"}});
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "to_octree",
             {{"max_depth", "int: Maximum depth of the octree."}});
@@ -225,6 +264,98 @@ void pybind_voxelgrid(py::module &m) {
               "Minimum boundary point for the VoxelGrid to create."},
              {"max_bound",
               "Maximum boundary point for the VoxelGrid to create."}});
+
+    // geometry::CompactVoxelGrid
+    py::class_<geometry::CompactVoxelGrid,
+               std::shared_ptr<geometry::CompactVoxelGrid>>
+            compact_voxelgrid(m, "CompactVoxelGrid",
+                              "Memory-compact voxel grid with 8-bit colors, "
+                              "stored in an open-addressing hash table or a "
+                              "dense bitset.");
+    py::detail::bind_default_constructor<geometry::CompactVoxelGrid>(
+            compact_voxelgrid);
+    py::detail::bind_copy_functions<geometry::CompactVoxelGrid>(
+            compact_voxelgrid);
+    compact_voxelgrid
+            .def("__repr__",
+                 [](const geometry::CompactVoxelGrid &grid) {
+                     bool dense = grid.backend_ ==
+                                  geometry::CompactVoxelGrid::Backend::Dense;
+                     std::ostringstream repr;
+                     repr << "geometry::CompactVoxelGrid with "
+                          << grid.NumVoxels() << " voxels ("
+                          << (dense ? "dense" : "hashed") << " storage).";
+                     return repr.str();
+                 })
+            .def("is_empty", &geometry::CompactVoxelGrid::IsEmpty,
+                 "Returns ``True`` if the grid contains no voxels.")
+            .def("num_voxels", &geometry::CompactVoxelGrid::NumVoxels,
+                 "Returns the number of voxels.")
+            .def("get_storage_bytes",
+                 &geometry::CompactVoxelGrid::GetStorageBytes,
+                 "Returns the number of bytes allocated for the voxels.")
+            .def("get_voxel", &geometry::CompactVoxelGrid::GetVoxel, "point"_a,
+                 "Returns voxel index given query point.")
+            .def("has_voxel", &geometry::CompactVoxelGrid::HasVoxel, "index"_a,
+                 "Returns ``True`` if the voxel is set.")
+            .def("add_voxel", &geometry::CompactVoxelGrid::AddVoxel, "index"_a,
+                 "color"_a = Eigen::Vector3d::Zero(),
+                 "Add a voxel or overwrite its color.")
+            .def("remove_voxel", &geometry::CompactVoxelGrid::RemoveVoxel,
+                 "index"_a, "Removes a voxel. Returns ``True`` if it existed.")
+            .def("check_if_included",
+                 &geometry::CompactVoxelGrid::CheckIfIncluded, "queries"_a,
+                 "Element-wise check if a query in the list is included in "
+                 "the grid. Queries are double precision and are mapped to "
+                 "the closest voxel.")
+            .def("carve_depth_map", &geometry::CompactVoxelGrid::CarveDepthMap,
+                 "depth_map"_a, "camera_params"_a,
+                 "keep_voxels_outside_image"_a = false,
+                 "Remove all voxels where none of the boundary points of the "
+                 "voxel projects to depth value that is smaller, or equal "
+                 "than the projected depth of the boundary point.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("carve_silhouette",
+                 &geometry::CompactVoxelGrid::CarveSilhouette,
+                 "silhouette_mask"_a, "camera_params"_a,
+                 "keep_voxels_outside_image"_a = false,
+                 "Remove all voxels where none of the boundary points of the "
+                 "voxel projects to a valid mask pixel (pixel value > 0).",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("to_voxel_grid", &geometry::CompactVoxelGrid::ToVoxelGrid,
+                 "Convert to VoxelGrid.")
+            .def_static("create_from_voxel_grid",
+                        &geometry::CompactVoxelGrid::CreateFromVoxelGrid,
+                        "voxel_grid"_a,
+                        "Creates a grid with hashed storage from a VoxelGrid.")
+            .def_static("create_dense",
+                        &geometry::CompactVoxelGrid::CreateDense, "origin"_a,
+                        "voxel_size"_a, "width"_a, "height"_a, "depth"_a,
+                        "Creates a grid with dense storage where every voxel "
+                        "is set. This is a useful starting point for voxel "
+                        "carving")
+            .def_static("create_from_point_cloud",
+                        &geometry::CompactVoxelGrid::CreateFromPointCloud,
+                        "input"_a, "voxel_size"_a,
+                        "Creates a grid with hashed storage from a "
+                        "PointCloud. The bounds are computed from the "
+                        "PointCloud.",
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("create_from_point_cloud_within_bounds",
+                        &geometry::CompactVoxelGrid::
+                                CreateFromPointCloudWithinBounds,
+                        "input"_a, "voxel_size"_a, "min_bound"_a,
+                        "max_bound"_a,
+                        "Creates a grid with hashed storage from a "
+                        "PointCloud. The bounds are defined by the given "
+                        "parameters.",
+                        py::call_guard<py::gil_scoped_release>())
+            .def_readonly("origin", &geometry::CompactVoxelGrid::origin_,
+                          "``float64`` vector of length 3: Coorindate of the "
+                          "origin point.")
+            .def_readonly("voxel_size",
+                          &geometry::CompactVoxelGrid::voxel_size_,
+                          "``float64`` Size of the voxel.");
 }
 
 void pybind_voxelgrid_methods(py::module &m) {}
@@ -26,6 +26,7 @@
 
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/TSDFIntegrationPipeline.h"
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
 
@@ -53,6 +54,13 @@ public:
         PYBIND11_OVERLOAD_PURE(std::shared_ptr<geometry::TriangleMesh>,
                                TSDFVolumeBase, );
     }
+    integration::TSDFRaycastResult Raycast(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_max) override {
+        PYBIND11_OVERLOAD_PURE(integration::TSDFRaycastResult, TSDFVolumeBase,
+                               intrinsic, extrinsic, depth_max);
+    }
 };
 
 void pybind_integration_classes(py::module &m) {
@@ -71,6 +79,36 @@ void pybind_integration_classes(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.integration.TSDFVoxelPrecision
+    py::enum_<integration::TSDFVoxelPrecision> tsdf_voxel_precision(
+            m, "TSDFVoxelPrecision", py::arithmetic());
+    tsdf_voxel_precision
+            .value("Float32", integration::TSDFVoxelPrecision::Float32)
+            .value("Compact", integration::TSDFVoxelPrecision::Compact)
+            .export_values();
+    tsdf_voxel_precision.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for TSDFVoxelPrecision. Compact stores "
+                       "16-bit float TSDF, 16-bit weight and 8-bit RGB.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.integration.TSDFRaycastResult
+    py::class_<integration::TSDFRaycastResult> raycast_result(
+            m, "TSDFRaycastResult",
+            "Images of a TSDF volume rendered by ray casting. Pixels whose "
+            "rays do not hit the surface are zero in all images.");
+    raycast_result.def(py::init<>())
+            .def_readwrite("depth", &integration::TSDFRaycastResult::depth_,
+                           "open3d.geometry.Image: Float32 depth along the "
+                           "camera z axis in meters.")
+            .def_readwrite("normal", &integration::TSDFRaycastResult::normal_,
+                           "open3d.geometry.Image: 3-channel Float32 unit "
+                           "normals in camera coordinates.")
+            .def_readwrite("color", &integration::TSDFRaycastResult::color_,
+                           "open3d.geometry.Image: 3-channel Float32 RGB in "
+                           "[0, 1], empty without color.");
+
     // open3d.integration.TSDFVolume
     py::class_<integration::TSDFVolume, PyTSDFVolume<integration::TSDFVolume>>
             tsdfvolume(m, "TSDFVolume", R"(Base class of the Truncated
@@ -88,13 +126,48 @@ In SIGGRAPH, 1996)");
                  "Function to reset the integration::TSDFVolume")
             .def("integrate", &integration::TSDFVolume::Integrate,
                  "Function to integrate an RGB-D image into the volume",
-                 "image"_a, "intrinsic"_a, "extrinsic"_a)
+                 "image"_a, "intrinsic"_a, "extrinsic"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def(
+                    "integrate_multi_camera",
+                    [](integration::TSDFVolume &volume,
+                       const std::vector<std::shared_ptr<geometry::RGBDImage>>
+                               &images,
+                       const std::vector<camera::PinholeCameraIntrinsic>
+                               &intrinsics,
+                       const std::vector<Eigen::Matrix4d> &extrinsics) {
+                        if (intrinsics.size() != images.size() ||
+                            extrinsics.size() != images.size()) {
+                            utility::LogError(
+                                    "[integrate_multi_camera] images, "
+                                    "intrinsics and extrinsics must have the "
+                                    "same length.");
+                        }
+                        std::vector<integration::TSDFCameraView> views;
+                        for (size_t i = 0; i < images.size(); i++) {
+                            views.emplace_back(*images[i], intrinsics[i],
+                                               extrinsics[i]);
+                        }
+                        volume.IntegrateMultiCamera(views);
+                    },
+                    "Function to integrate the RGB-D images of synchronized "
+                    "cameras into the volume, visiting every voxel once for "
+                    "all cameras",
+                    "images"_a, "intrinsics"_a, "extrinsics"_a,
+                    py::call_guard<py::gil_scoped_release>())
             .def("extract_point_cloud",
                  &integration::TSDFVolume::ExtractPointCloud,
-                 "Function to extract a point cloud with normals")
+                 "Function to extract a point cloud with normals",
+                 py::call_guard<py::gil_scoped_release>())
             .def("extract_triangle_mesh",
                  &integration::TSDFVolume::ExtractTriangleMesh,
-                 "Function to extract a triangle mesh")
+                 "Function to extract a triangle mesh",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("raycast", &integration::TSDFVolume::Raycast,
+                 "Function to render depth, normal and color images of the "
+                 "surface by casting the ray of every pixel into the volume",
+                 "intrinsic"_a, "extrinsic"_a, "depth_max"_a = 3.0,
+                 py::call_guard<py::gil_scoped_release>())
             .def_readwrite("voxel_length",
                            &integration::TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -111,6 +184,17 @@ In SIGGRAPH, 1996)");
             {{"image", "RGBD image."},
              {"intrinsic", "Pinhole camera intrinsic parameters."},
              {"extrinsic", "Extrinsic parameters."}});
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "integrate_multi_camera",
+            {{"images", "RGBD images of the cameras."},
+             {"intrinsics", "Pinhole camera intrinsic parameters, one per "
+                            "image."},
+             {"extrinsics", "Extrinsic parameters, one per image."}});
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "raycast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."},
+             {"depth_max", "Depth in meters beyond which rays stop."}});
     docstring::ClassMethodDocInject(m, "TSDFVolume", "reset");
 
     // open3d.integration.UniformTSDFVolume: open3d.integration.TSDFVolume
@@ -125,11 +209,16 @@ In SIGGRAPH, 1996)");
             uniform_tsdfvolume);
     uniform_tsdfvolume
             .def(py::init([](double length, int resolution, double sdf_trunc,
-                             integration::TSDFVolumeColorType color_type) {
+                             integration::TSDFVolumeColorType color_type,
+                             const Eigen::Vector3d &origin,
+                             integration::TSDFVoxelPrecision precision) {
                      return new integration::UniformTSDFVolume(
-                             length, resolution, sdf_trunc, color_type);
+                             length, resolution, sdf_trunc, color_type, origin,
+                             precision);
                  }),
-                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a)
+                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a,
+                 "origin"_a = Eigen::Vector3d::Zero(),
+                 "precision"_a = integration::TSDFVoxelPrecision::Float32)
             .def("__repr__",
                  [](const integration::UniformTSDFVolume &vol) {
                      return std::string("integration::UniformTSDFVolume ") +
@@ -141,19 +230,36 @@ In SIGGRAPH, 1996)");
                  })  // todo: extend
             .def("extract_voxel_point_cloud",
                  &integration::UniformTSDFVolume::ExtractVoxelPointCloud,
-                 "Debug function to extract the voxel data into a point cloud.")
+                 "Debug function to extract the voxel data into a point cloud.",
+                 "min_weight"_a = 0.0f, "max_tsdf"_a = 0.98f,
+                 py::call_guard<py::gil_scoped_release>())
             .def("extract_voxel_grid",
                  &integration::UniformTSDFVolume::ExtractVoxelGrid,
-                 "Debug function to extract the voxel data VoxelGrid.")
+                 "Debug function to extract the voxel data VoxelGrid.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("get_voxel_storage_bytes",
+                 [](const integration::UniformTSDFVolume &vol) {
+                     return vol.voxels_.GetStorageBytes();
+                 },
+                 "Memory used by the voxel arrays, in bytes.")
             .def_readwrite("length", &integration::UniformTSDFVolume::length_,
                            "Total length, where ``voxel_length = length / "
                            "resolution``.")
             .def_readwrite("resolution",
                            &integration::UniformTSDFVolume::resolution_,
                            "Resolution over the total length, where "
-                           "``voxel_length = length / resolution``");
-    docstring::ClassMethodDocInject(m, "UniformTSDFVolume",
-                                    "extract_voxel_point_cloud");
+                           "``voxel_length = length / resolution``")
+            .def_readwrite("max_weight",
+                           &integration::UniformTSDFVolume::max_weight_,
+                           "Cap of the voxel weights. At the cap, new "
+                           "observations replace old ones at a rate of "
+                           "``1 / max_weight``. Infinite by default.");
+    docstring::ClassMethodDocInject(
+            m, "UniformTSDFVolume", "extract_voxel_point_cloud",
+            {{"min_weight", "Voxels with a weight of at most min_weight are "
+                            "skipped."},
+             {"max_tsdf", "Voxels whose TSDF is outside [-max_tsdf, "
+                          "max_tsdf) are skipped."}});
 
     // open3d.integration.ScalableTSDFVolume: open3d.integration.TSDFVolume
     py::class_<integration::ScalableTSDFVolume,
@@ -186,13 +292,16 @@ In SIGGRAPH, 2013)");
             .def(py::init([](double voxel_length, double sdf_trunc,
                              integration::TSDFVolumeColorType color_type,
                              int volume_unit_resolution,
-                             int depth_sampling_stride) {
+                             int depth_sampling_stride,
+                             integration::TSDFVoxelPrecision precision) {
                      return new integration::ScalableTSDFVolume(
                              voxel_length, sdf_trunc, color_type,
-                             volume_unit_resolution, depth_sampling_stride);
+                             volume_unit_resolution, depth_sampling_stride,
+                             precision);
                  }),
                  "voxel_length"_a, "sdf_trunc"_a, "color_type"_a,
-                 "volume_unit_resolution"_a = 16, "depth_sampling_stride"_a = 4)
+                 "volume_unit_resolution"_a = 16, "depth_sampling_stride"_a = 4,
+                 "precision"_a = integration::TSDFVoxelPrecision::Float32)
             .def("__repr__",
                  [](const integration::ScalableTSDFVolume &vol) {
                      return std::string("integration::ScalableTSDFVolume ") +
@@ -205,9 +314,98 @@ In SIGGRAPH, 2013)");
             .def("extract_voxel_point_cloud",
                  &integration::ScalableTSDFVolume::ExtractVoxelPointCloud,
                  "Debug function to extract the voxel data into a point "
-                 "cloud.");
+                 "cloud.",
+                 "min_weight"_a = 0.0f, "max_tsdf"_a = 0.98f,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("extract_updated_volume_unit_meshes",
+                 &integration::ScalableTSDFVolume::
+                         ExtractUpdatedVolumeUnitMeshes,
+                 "Function to extract the meshes of the volume units updated "
+                 "since the last call, as a list of (unit index, mesh) "
+                 "tuples. Every mesh holds the cubes of one unit, so that a "
+                 "renderer can replace the meshes of these units only.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("enable_out_of_core",
+                 &integration::ScalableTSDFVolume::EnableOutOfCore,
+                 "Function to keep at most ``max_volume_units`` volume units "
+                 "in memory. The units integrated into least recently are "
+                 "moved to files in ``directory`` and loaded back when "
+                 "integrated into again. 0 keeps all units in memory.",
+                 "directory"_a, "max_volume_units"_a)
+            .def("save_volume_units",
+                 &integration::ScalableTSDFVolume::SaveVolumeUnits,
+                 "Function to write all volume units, in memory and on disk, "
+                 "to a binary file.",
+                 "filename"_a, py::call_guard<py::gil_scoped_release>())
+            .def("load_volume_units",
+                 &integration::ScalableTSDFVolume::LoadVolumeUnits,
+                 "Function to replace the volume units with those written by "
+                 "save_volume_units from a volume with the same parameters.",
+                 "filename"_a, py::call_guard<py::gil_scoped_release>())
+            .def_readwrite("max_weight",
+                           &integration::ScalableTSDFVolume::max_weight_,
+                           "Cap of the voxel weights. At the cap, new "
+                           "observations replace old ones at a rate of "
+                           "``1 / max_weight``. Infinite by default.")
+            .def_readwrite(
+                    "remove_free_space_units",
+                    &integration::ScalableTSDFVolume::remove_free_space_units_,
+                    "If True, integration carves the free space in front of "
+                    "the surface and removes the volume units left without "
+                    "surface. False by default.");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "extract_voxel_point_cloud",
+            {{"min_weight", "Voxels with a weight of at most min_weight are "
+                            "skipped."},
+             {"max_tsdf", "Voxels whose TSDF is outside [-max_tsdf, "
+                          "max_tsdf) are skipped."}});
+    docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
+                                    "extract_updated_volume_unit_meshes");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "enable_out_of_core",
+            {{"directory", "Directory of the volume units out of memory."},
+             {"max_volume_units",
+              "Maximum number of volume units in memory."}});
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
-                                    "extract_voxel_point_cloud");
+                                    "save_volume_units",
+                                    {{"filename", "Path to file."}});
+    docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
+                                    "load_volume_units",
+                                    {{"filename", "Path to file."}});
+
+    // open3d.integration.TSDFIntegrationPipeline
+    py::class_<integration::TSDFIntegrationPipeline> pipeline(
+            m, "TSDFIntegrationPipeline",
+            "Integrates a sequence of frames into a TSDF volume, preparing "
+            "the next frames in background threads while the current one is "
+            "integrated. The volume must not be used otherwise until finish "
+            "returns.");
+    pipeline.def(py::init<integration::TSDFVolume &, int, int>(),
+                 "volume"_a, "max_queued_frames"_a = 8,
+                 "num_loader_threads"_a = 2, py::keep_alive<1, 2>())
+            .def("push",
+                 py::overload_cast<const std::shared_ptr<geometry::RGBDImage> &,
+                                   const camera::PinholeCameraIntrinsic &,
+                                   const Eigen::Matrix4d &>(
+                         &integration::TSDFIntegrationPipeline::Push),
+                 "Function to queue an RGB-D image, blocking while "
+                 "``max_queued_frames`` frames are in the pipeline.",
+                 "image"_a, "intrinsic"_a, "extrinsic"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("finish", &integration::TSDFIntegrationPipeline::Finish,
+                 "Function to wait until all queued frames are integrated. "
+                 "If a frame failed, the frames not yet integrated are "
+                 "skipped and the first error is raised.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("get_num_integrated_frames",
+                 &integration::TSDFIntegrationPipeline::GetNumIntegratedFrames,
+                 "Returns the number of frames integrated so far.");
+    docstring::ClassMethodDocInject(
+            m, "TSDFIntegrationPipeline", "push",
+            {{"image", "RGB-D image in the format of integrate."},
+             {"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "World to camera transformation."}});
+    docstring::ClassMethodDocInject(m, "TSDFIntegrationPipeline", "finish");
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -26,6 +26,8 @@
 
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
@@ -35,7 +37,11 @@
 #include "Open3D/IO/ClassIO/LineSetIO.h"
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudPipeline.h"
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDDatasetIO.h"
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
@@ -53,12 +59,15 @@ namespace open3d {
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                {"data", "The content of a file as ``bytes``."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
                 {"format",
                  "The format of the input file. When not specified or set as "
                  "``auto``, the format is inferred from file extension name."},
+                {"has_colors", "Set to ``True`` if the points have colors."},
+                {"has_normals", "Set to ``True`` if the points have normals."},
                 {"remove_nan_points",
                  "If true, all points that include a NaN are removed from "
                  "the PointCloud."},
@@ -89,19 +98,72 @@ static const std::unordered_map<std::string, std::string>
                  "The ``PinholeCameraParameters`` object for I/O"},
                 {"pose_graph", "The ``PoseGraph`` object for I/O"},
                 {"feature", "The ``Feature`` object for I/O"},
+                {"scale_denominator",
+                 "Reduces the resolution of the image by this factor while "
+                 "decoding, 1, 2, 4 or 8."},
+                {"fast_decode",
+                 "Decodes JPG files faster at a slightly lower accuracy."},
                 {"print_progress",
                  "If set to true a progress bar is visualized in the console"},
+                {"weld_vertices",
+                 "Merge the vertices that have identical positions, e.g. the "
+                 "copies of every vertex stored per triangle in STL files."},
+                // RGB-D datasets
+                {"path",
+                 "Path to the dataset directory, or to a ``.o3drgbd`` "
+                 "sequence file when opening a reader."},
+                {"color_format",
+                 "Format of the color images, ``jpg`` or ``png``."},
+                {"color_quality", "Quality of the JPG color images."},
+                {"color_files", "Paths to the color images of the frames."},
+                {"depth_files", "Paths to the depth images of the frames."},
+                {"depth_scale",
+                 "The ratio to scale depth values. The depth values will "
+                 "first be scaled and then truncated."},
+                {"depth_trunc",
+                 "Depth values larger than ``depth_trunc`` gets truncated to "
+                 "0. The depth values will first be scaled and then "
+                 "truncated."},
+                {"convert_rgb_to_intensity",
+                 "Whether to convert RGB image to intensity image."},
+                {"num_threads",
+                 "Number of threads decoding frames, 0 means the number of "
+                 "threads of parallel loops."},
+                {"max_prefetched_frames",
+                 "Maximum number of frames decoded ahead of the one "
+                 "returned."},
 };
 
+// The memory readers take a view of the bytes object instead of a copy.
+static std::pair<const uint8_t *, size_t> BytesView(const py::bytes &data) {
+    char *buffer = nullptr;
+    Py_ssize_t length = 0;
+    if (PYBIND11_BYTES_AS_STRING_AND_SIZE(data.ptr(), &buffer, &length) != 0) {
+        throw py::error_already_set();
+    }
+    return {reinterpret_cast<const uint8_t *>(buffer), size_t(length)};
+}
+
+static py::bytes ToBytes(const std::vector<uint8_t> &buffer) {
+    return py::bytes(reinterpret_cast<const char *>(buffer.data()),
+                     buffer.size());
+}
+
 void pybind_class_io(py::module &m_io) {
     // open3d::geometry::Image
     m_io.def("read_image",
-             [](const std::string &filename) {
+             [](const std::string &filename, int scale_denominator,
+                bool fast_decode) {
                  geometry::Image image;
-                 io::ReadImage(filename, image);
+                 io::ImageReadOption option;
+                 option.scale_denominator = scale_denominator;
+                 option.fast_decode = fast_decode;
+                 io::ReadImage(filename, image, option);
                  return image;
              },
-             "Function to read Image from file", "filename"_a);
+             "Function to read Image from file", "filename"_a,
+             "scale_denominator"_a = 1, "fast_decode"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_image",
                                  map_shared_argument_docstrings);
 
@@ -111,10 +173,39 @@ void pybind_class_io(py::module &m_io) {
                  return io::WriteImage(filename, image, quality);
              },
              "Function to write Image to file", "filename"_a, "image"_a,
-             "quality"_a = 90);
+             "quality"_a = 90, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_image",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_image_from_bytes",
+             [](const py::bytes &data, const std::string &format) {
+                 geometry::Image image;
+                 auto view = BytesView(data);
+                 py::gil_scoped_release release;
+                 io::ReadImageFromMemory(view.first, view.second, format,
+                                         image);
+                 return image;
+             },
+             "Function to read Image from the content of a png or jpg file",
+             "data"_a, "format"_a);
+    docstring::FunctionDocInject(m_io, "read_image_from_bytes",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_image_to_bytes",
+             [](const geometry::Image &image, const std::string &format,
+                int quality) {
+                 std::vector<uint8_t> buffer;
+                 {
+                     py::gil_scoped_release release;
+                     io::WriteImageToMemory(buffer, format, image, quality);
+                 }
+                 return ToBytes(buffer);
+             },
+             "Function to write Image as the content of a png or jpg file",
+             "image"_a, "format"_a, "quality"_a = 90);
+    docstring::FunctionDocInject(m_io, "write_image_to_bytes",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::LineSet
     m_io.def("read_line_set",
              [](const std::string &filename, const std::string &format,
@@ -124,7 +215,8 @@ void pybind_class_io(py::module &m_io) {
                  return line_set;
              },
              "Function to read LineSet from file", "filename"_a,
-             "format"_a = "auto", "print_progress"_a = false);
+             "format"_a = "auto", "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_line_set",
                                  map_shared_argument_docstrings);
 
@@ -136,7 +228,8 @@ void pybind_class_io(py::module &m_io) {
              },
              "Function to write LineSet to file", "filename"_a, "line_set"_a,
              "write_ascii"_a = false, "compressed"_a = false,
-             "print_progress"_a = false);
+             "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_line_set",
                                  map_shared_argument_docstrings);
 
@@ -153,10 +246,31 @@ void pybind_class_io(py::module &m_io) {
              },
              "Function to read PointCloud from file", "filename"_a,
              "format"_a = "auto", "remove_nan_points"_a = true,
-             "remove_infinite_points"_a = true, "print_progress"_a = false);
+             "remove_infinite_points"_a = true, "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_point_cloud",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_compact_point_cloud",
+             [](const std::string &filename, const std::string &format,
+                bool remove_nan_points, bool remove_infinite_points,
+                bool print_progress) {
+                 geometry::CompactPointCloud pcd;
+                 io::ReadCompactPointCloud(
+                         filename, pcd,
+                         {format, remove_nan_points, remove_infinite_points,
+                          print_progress});
+                 return pcd;
+             },
+             "Function to read CompactPointCloud from file. Binary ply files "
+             "are decoded to single precision without a double precision "
+             "copy.",
+             "filename"_a, "format"_a = "auto", "remove_nan_points"_a = true,
+             "remove_infinite_points"_a = true, "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "read_compact_point_cloud",
+                                 map_shared_argument_docstrings);
+
     m_io.def("write_point_cloud",
              [](const std::string &filename,
                 const geometry::PointCloud &pointcloud, bool write_ascii,
@@ -167,22 +281,328 @@ void pybind_class_io(py::module &m_io) {
              },
              "Function to write PointCloud to file", "filename"_a,
              "pointcloud"_a, "write_ascii"_a = false, "compressed"_a = false,
-             "print_progress"_a = false);
+             "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_point_cloud",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_point_cloud_from_bytes",
+             [](const py::bytes &data, const std::string &format,
+                bool remove_nan_points, bool remove_infinite_points,
+                bool print_progress) {
+                 geometry::PointCloud pcd;
+                 auto view = BytesView(data);
+                 py::gil_scoped_release release;
+                 io::ReadPointCloudFromMemory(
+                         view.first, view.second, format, pcd,
+                         {format, remove_nan_points, remove_infinite_points,
+                          print_progress});
+                 return pcd;
+             },
+             "Function to read PointCloud from the content of a file",
+             "data"_a, "format"_a, "remove_nan_points"_a = true,
+             "remove_infinite_points"_a = true, "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "read_point_cloud_from_bytes",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_point_cloud_to_bytes",
+             [](const geometry::PointCloud &pointcloud,
+                const std::string &format, bool write_ascii, bool compressed,
+                bool print_progress) {
+                 std::vector<uint8_t> buffer;
+                 {
+                     py::gil_scoped_release release;
+                     io::WritePointCloudToMemory(
+                             buffer, format, pointcloud,
+                             {write_ascii, compressed, print_progress});
+                 }
+                 return ToBytes(buffer);
+             },
+             "Function to write PointCloud as the content of a file",
+             "pointcloud"_a, "format"_a, "write_ascii"_a = false,
+             "compressed"_a = false, "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "write_point_cloud_to_bytes",
+                                 map_shared_argument_docstrings);
+
+    py::class_<io::PointCloudStreamReader> stream_reader(
+            m_io, "PointCloudStreamReader",
+            "Reads a point cloud file in chunks, created by "
+            "``create_point_cloud_stream_reader``.");
+    stream_reader
+            .def("read_chunk", &io::PointCloudStreamReader::ReadChunk,
+                 "Replaces the content of chunk by the next points of the "
+                 "file, at most max_points. Returns the number of points "
+                 "read, 0 at the end of the file, or -1 on error.",
+                 "chunk"_a, "max_points"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("close", &io::PointCloudStreamReader::Close,
+                 "Closes the file.")
+            .def("get_num_points", &io::PointCloudStreamReader::GetNumPoints,
+                 "Returns the number of points announced by the header, or "
+                 "-1 if the format does not store it.")
+            .def("has_normals", &io::PointCloudStreamReader::HasNormals,
+                 "Returns ``True`` if the points have normals.")
+            .def("has_colors", &io::PointCloudStreamReader::HasColors,
+                 "Returns ``True`` if the points have colors.");
+    m_io.def("create_point_cloud_stream_reader",
+             &io::CreatePointCloudStreamReader,
+             "Opens a point cloud file for reading in chunks. Returns None "
+             "if the file cannot be opened.",
+             "filename"_a, "format"_a = "auto",
+             py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "create_point_cloud_stream_reader",
+                                 map_shared_argument_docstrings);
+
+    py::class_<io::PointCloudStreamWriter> stream_writer(
+            m_io, "PointCloudStreamWriter",
+            "Writes a point cloud file in chunks, created by "
+            "``create_point_cloud_stream_writer``.");
+    stream_writer
+            .def("write_chunk", &io::PointCloudStreamWriter::WriteChunk,
+                 "Appends the points of chunk to the file.", "chunk"_a,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("close", &io::PointCloudStreamWriter::Close,
+                 "Completes the header and closes the file.")
+            .def("get_num_points_written",
+                 &io::PointCloudStreamWriter::GetNumPointsWritten,
+                 "Returns the number of points written so far.");
+    m_io.def("create_point_cloud_stream_writer",
+             [](const std::string &filename, bool has_normals,
+                bool has_colors, bool write_ascii, bool compressed) {
+                 return io::CreatePointCloudStreamWriter(
+                         filename, has_normals, has_colors,
+                         {write_ascii, compressed});
+             },
+             "Creates a point cloud file for writing in chunks. Returns None "
+             "if the file cannot be created.",
+             "filename"_a, "has_normals"_a = false, "has_colors"_a = false,
+             "write_ascii"_a = false, "compressed"_a = false,
+             py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "create_point_cloud_stream_writer",
+                                 map_shared_argument_docstrings);
+
+    py::class_<io::PointCloudPipeline> pipeline(
+            m_io, "PointCloudPipeline",
+            "Chains point cloud operations over the spatial tiles of a file "
+            "that may not fit in memory, and writes the result in chunks. "
+            "Tiles are extended by the sum of the halos of the stages.");
+    pipeline.def(py::init<>())
+            .def("add_crop",
+                 [](io::PointCloudPipeline &p,
+                    const geometry::AxisAlignedBoundingBox &bbox) {
+                     p.AddStage(io::PointCloudPipeline::Crop(bbox));
+                 },
+                 "Adds a stage keeping the points within bbox.", "bbox"_a)
+            .def("add_voxel_down_sample",
+                 [](io::PointCloudPipeline &p, double voxel_size) {
+                     p.AddStage(io::PointCloudPipeline::VoxelDownSample(
+                             voxel_size));
+                 },
+                 "Adds a stage averaging the points within voxels. The tile "
+                 "sizes must be multiples of voxel_size.",
+                 "voxel_size"_a)
+            .def("add_statistical_outlier_removal",
+                 [](io::PointCloudPipeline &p, size_t nb_neighbors,
+                    double std_ratio, double halo) {
+                     p.AddStage(io::PointCloudPipeline::
+                                        RemoveStatisticalOutliers(
+                                                nb_neighbors, std_ratio),
+                                halo);
+                 },
+                 "Adds a stage removing the points further away from their "
+                 "neighbors than the others.",
+                 "nb_neighbors"_a, "std_ratio"_a, "halo"_a)
+            .def("add_radius_outlier_removal",
+                 [](io::PointCloudPipeline &p, size_t nb_points,
+                    double radius) {
+                     p.AddStage(io::PointCloudPipeline::RemoveRadiusOutliers(
+                                        nb_points, radius),
+                                radius);
+                 },
+                 "Adds a stage removing the points that have less than "
+                 "nb_points neighbors within radius.",
+                 "nb_points"_a, "radius"_a)
+            .def("add_normal_estimation",
+                 [](io::PointCloudPipeline &p,
+                    const geometry::KDTreeSearchParam &search_param,
+                    double halo, bool fast_normal_computation) {
+                     p.AddStage(io::PointCloudPipeline::EstimateNormals(
+                                        search_param, fast_normal_computation),
+                                halo);
+                 },
+                 "Adds a stage estimating the normals of the points.",
+                 "search_param"_a, "halo"_a,
+                 "fast_normal_computation"_a = true)
+            .def("clear", &io::PointCloudPipeline::Clear,
+                 "Removes all stages.")
+            .def("run",
+                 [](const io::PointCloudPipeline &p,
+                    const std::string &input_filename,
+                    const std::string &output_filename,
+                    const Eigen::Vector3d &tile_size,
+                    int64_t max_buffered_bytes, int max_tiles_in_flight,
+                    int num_worker_threads, const std::string &temp_directory,
+                    bool write_ascii, bool compressed) {
+                     io::PointCloudPipelineOption option;
+                     option.tile_size = tile_size;
+                     option.max_buffered_bytes = max_buffered_bytes;
+                     option.max_tiles_in_flight = max_tiles_in_flight;
+                     option.num_worker_threads = num_worker_threads;
+                     option.temp_directory = temp_directory;
+                     option.write_option = {write_ascii, compressed};
+                     return p.Run(input_filename, output_filename, option);
+                 },
+                 "Runs the stages over the input file and writes the result "
+                 "to the output file. Returns ``False`` on error.",
+                 "input_filename"_a, "output_filename"_a, "tile_size"_a,
+                 "max_buffered_bytes"_a = int64_t(256) << 20,
+                 "max_tiles_in_flight"_a = 8, "num_worker_threads"_a = 0,
+                 "temp_directory"_a = "", "write_ascii"_a = false,
+                 "compressed"_a = false,
+                 py::call_guard<py::gil_scoped_release>());
+
+    // open3d::geometry::RGBDImage
+    m_io.def("read_rgbd_dataset_file_lists",
+             [](const std::string &path) {
+                 std::vector<std::string> color_files, depth_files;
+                 io::ReadRGBDDatasetFileLists(path, color_files, depth_files);
+                 return std::make_pair(color_files, depth_files);
+             },
+             "Lists the color and depth images of a TUM or Redwood RGB-D "
+             "dataset directory. Returns two empty lists if the directory is "
+             "not a dataset.",
+             "path"_a, py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "read_rgbd_dataset_file_lists",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_rgbd_sequence_from_dataset",
+             [](const std::string &path, const std::string &filename,
+                const std::string &color_format, int color_quality) {
+                 io::RGBDSequenceWriterOption option;
+                 option.color_format = color_format;
+                 option.color_quality = color_quality;
+                 return io::WriteRGBDSequenceFromDataset(path, filename,
+                                                         option);
+             },
+             "Writes an RGB-D dataset directory to a single ``.o3drgbd`` "
+             "sequence file, with the depth images compressed losslessly. "
+             "JPG and PNG color images are copied as they are.",
+             "path"_a, "filename"_a, "color_format"_a = "jpg",
+             "color_quality"_a = 90, py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "write_rgbd_sequence_from_dataset",
+                                 map_shared_argument_docstrings);
+
+    auto make_rgbd_dataset_option = [](double depth_scale, double depth_trunc,
+                                       bool convert_rgb_to_intensity,
+                                       int num_threads,
+                                       int max_prefetched_frames) {
+        io::RGBDDatasetReaderOption option;
+        option.depth_scale = depth_scale;
+        option.depth_trunc = depth_trunc;
+        option.convert_rgb_to_intensity = convert_rgb_to_intensity;
+        option.num_threads = num_threads;
+        option.max_prefetched_frames = max_prefetched_frames;
+        return option;
+    };
+    py::class_<io::RGBDDatasetReader> rgbd_dataset_reader(
+            m_io, "RGBDDatasetReader",
+            "Reads the frames of an RGB-D dataset in order as ``RGBDImage``, "
+            "decoding the next frames on worker threads. Iterating over the "
+            "reader yields the frames.");
+    rgbd_dataset_reader.def(py::init<>())
+            .def("open",
+                 [make_rgbd_dataset_option](
+                         io::RGBDDatasetReader &reader,
+                         const std::string &path, double depth_scale,
+                         double depth_trunc, bool convert_rgb_to_intensity,
+                         int num_threads, int max_prefetched_frames) {
+                     return reader.Open(
+                             path, make_rgbd_dataset_option(
+                                           depth_scale, depth_trunc,
+                                           convert_rgb_to_intensity,
+                                           num_threads,
+                                           max_prefetched_frames));
+                 },
+                 "Starts reading the frames of a dataset directory, or of a "
+                 "``.o3drgbd`` sequence file.",
+                 "path"_a, "depth_scale"_a = 1000.0, "depth_trunc"_a = 3.0,
+                 "convert_rgb_to_intensity"_a = true, "num_threads"_a = 0,
+                 "max_prefetched_frames"_a = 8)
+            .def("open",
+                 [make_rgbd_dataset_option](
+                         io::RGBDDatasetReader &reader,
+                         const std::vector<std::string> &color_files,
+                         const std::vector<std::string> &depth_files,
+                         double depth_scale, double depth_trunc,
+                         bool convert_rgb_to_intensity, int num_threads,
+                         int max_prefetched_frames) {
+                     return reader.Open(
+                             color_files, depth_files,
+                             make_rgbd_dataset_option(
+                                     depth_scale, depth_trunc,
+                                     convert_rgb_to_intensity, num_threads,
+                                     max_prefetched_frames));
+                 },
+                 "Starts reading the frames made of lists of color and depth "
+                 "images.",
+                 "color_files"_a, "depth_files"_a, "depth_scale"_a = 1000.0,
+                 "depth_trunc"_a = 3.0, "convert_rgb_to_intensity"_a = true,
+                 "num_threads"_a = 0, "max_prefetched_frames"_a = 8)
+            .def("close", &io::RGBDDatasetReader::Close,
+                 "Stops the worker threads.")
+            .def("read_next", &io::RGBDDatasetReader::ReadNext,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns the next frame, or None after the last frame or if "
+                 "the images of the frame cannot be read.")
+            .def("has_next", &io::RGBDDatasetReader::HasNext,
+                 "Returns ``True`` if there are frames left to read.")
+            .def("get_num_frames", &io::RGBDDatasetReader::GetNumFrames,
+                 "Returns the number of frames of the dataset.")
+            .def("__iter__",
+                 [](io::RGBDDatasetReader &reader)
+                         -> io::RGBDDatasetReader & { return reader; },
+                 py::return_value_policy::reference_internal)
+            .def("__next__", [](io::RGBDDatasetReader &reader) {
+                if (!reader.HasNext()) {
+                    throw py::stop_iteration();
+                }
+                py::gil_scoped_release release;
+                return reader.ReadNext();
+            });
+    docstring::ClassMethodDocInject(m_io, "RGBDDatasetReader", "open",
+                                    map_shared_argument_docstrings);
+
     // open3d::geometry::TriangleMesh
     m_io.def("read_triangle_mesh",
-             [](const std::string &filename, bool print_progress) {
+             [](const std::string &filename, bool print_progress,
+                bool weld_vertices) {
+                 py::gil_scoped_release release;
                  geometry::TriangleMesh mesh;
-                 io::ReadTriangleMesh(filename, mesh, print_progress);
+                 io::ReadTriangleMeshOption option;
+                 option.weld_vertices = weld_vertices;
+                 option.print_progress = print_progress;
+                 io::ReadTriangleMesh(filename, mesh, option);
                  return mesh;
              },
              "Function to read TriangleMesh from file", "filename"_a,
-             "print_progress"_a = false);
+             "print_progress"_a = false, "weld_vertices"_a = false);
     docstring::FunctionDocInject(m_io, "read_triangle_mesh",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_compact_triangle_mesh",
+             [](const std::string &filename, bool print_progress) {
+                 geometry::CompactTriangleMesh mesh;
+                 io::ReadCompactTriangleMesh(filename, mesh, print_progress);
+                 return mesh;
+             },
+             "Function to read CompactTriangleMesh from file. Binary ply "
+             "files are decoded to single precision without a double "
+             "precision copy.",
+             "filename"_a, "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(m_io, "read_compact_triangle_mesh",
+                                 map_shared_argument_docstrings);
+
     m_io.def("write_triangle_mesh",
              [](const std::string &filename, const geometry::TriangleMesh &mesh,
                 bool write_ascii, bool compressed, bool write_vertex_normals,
@@ -196,10 +616,49 @@ void pybind_class_io(py::module &m_io) {
              "Function to write TriangleMesh to file", "filename"_a, "mesh"_a,
              "write_ascii"_a = false, "compressed"_a = false,
              "write_vertex_normals"_a = true, "write_vertex_colors"_a = true,
-             "write_triangle_uvs"_a = true, "print_progress"_a = false);
+             "write_triangle_uvs"_a = true, "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_triangle_mesh",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_triangle_mesh_from_bytes",
+             [](const py::bytes &data, const std::string &format,
+                bool print_progress) {
+                 geometry::TriangleMesh mesh;
+                 auto view = BytesView(data);
+                 py::gil_scoped_release release;
+                 io::ReadTriangleMeshFromMemory(view.first, view.second,
+                                                format, mesh, print_progress);
+                 return mesh;
+             },
+             "Function to read TriangleMesh from the content of a ply file",
+             "data"_a, "format"_a = "ply", "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "read_triangle_mesh_from_bytes",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_triangle_mesh_to_bytes",
+             [](const geometry::TriangleMesh &mesh, const std::string &format,
+                bool write_ascii, bool compressed, bool write_vertex_normals,
+                bool write_vertex_colors, bool write_triangle_uvs,
+                bool print_progress) {
+                 std::vector<uint8_t> buffer;
+                 {
+                     py::gil_scoped_release release;
+                     io::WriteTriangleMeshToMemory(
+                             buffer, format, mesh, write_ascii, compressed,
+                             write_vertex_normals, write_vertex_colors,
+                             write_triangle_uvs, print_progress);
+                 }
+                 return ToBytes(buffer);
+             },
+             "Function to write TriangleMesh as the content of a ply file",
+             "mesh"_a, "format"_a = "ply", "write_ascii"_a = false,
+             "compressed"_a = false, "write_vertex_normals"_a = true,
+             "write_vertex_colors"_a = true, "write_triangle_uvs"_a = true,
+             "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "write_triangle_mesh_to_bytes",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::VoxelGrid
     m_io.def("read_voxel_grid",
              [](const std::string &filename, const std::string &format,
@@ -209,7 +668,8 @@ void pybind_class_io(py::module &m_io) {
                  return voxel_grid;
              },
              "Function to read VoxelGrid from file", "filename"_a,
-             "format"_a = "auto", "print_progress"_a = false);
+             "format"_a = "auto", "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_voxel_grid",
                                  map_shared_argument_docstrings);
 
@@ -222,7 +682,8 @@ void pybind_class_io(py::module &m_io) {
              },
              "Function to write VoxelGrid to file", "filename"_a,
              "voxel_grid"_a, "write_ascii"_a = false, "compressed"_a = false,
-             "print_progress"_a = false);
+             "print_progress"_a = false,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_voxel_grid",
                                  map_shared_argument_docstrings);
 
@@ -275,7 +736,7 @@ void pybind_class_io(py::module &m_io) {
                  return trajectory;
              },
              "Function to read PinholeCameraTrajectory from file",
-             "filename"_a);
+             "filename"_a, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_pinhole_camera_trajectory",
                                  map_shared_argument_docstrings);
 
@@ -285,7 +746,7 @@ void pybind_class_io(py::module &m_io) {
                  return io::WritePinholeCameraTrajectory(filename, trajectory);
              },
              "Function to write PinholeCameraTrajectory to file", "filename"_a,
-             "trajectory"_a);
+             "trajectory"_a, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_pinhole_camera_trajectory",
                                  map_shared_argument_docstrings);
 
@@ -296,7 +757,8 @@ void pybind_class_io(py::module &m_io) {
                  io::ReadFeature(filename, feature);
                  return feature;
              },
-             "Function to read registration.Feature from file", "filename"_a);
+             "Function to read registration.Feature from file", "filename"_a,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_feature",
                                  map_shared_argument_docstrings);
 
@@ -305,7 +767,8 @@ void pybind_class_io(py::module &m_io) {
                 const registration::Feature &feature) {
                  return io::WriteFeature(filename, feature);
              },
-             "Function to write Feature to file", "filename"_a, "feature"_a);
+             "Function to write Feature to file", "filename"_a, "feature"_a,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_feature",
                                  map_shared_argument_docstrings);
 
@@ -315,7 +778,8 @@ void pybind_class_io(py::module &m_io) {
                  io::ReadPoseGraph(filename, pose_graph);
                  return pose_graph;
              },
-             "Function to read PoseGraph from file", "filename"_a);
+             "Function to read PoseGraph from file", "filename"_a,
+             py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "read_pose_graph",
                                  map_shared_argument_docstrings);
 
@@ -325,7 +789,7 @@ void pybind_class_io(py::module &m_io) {
                  io::WritePoseGraph(filename, pose_graph);
              },
              "Function to write PoseGraph to file", "filename"_a,
-             "pose_graph"_a);
+             "pose_graph"_a, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
 
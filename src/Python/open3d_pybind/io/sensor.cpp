@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/Sensor/AzureKinect/AsyncAzureKinectRecorder.h"
+#include "Open3D/IO/Sensor/AzureKinect/AsyncMKVReader.h"
 #include "Open3D/IO/Sensor/AzureKinect/AzureKinectRecorder.h"
 #include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensor.h"
 #include "Open3D/IO/Sensor/AzureKinect/AzureKinectSensorConfig.h"
@@ -43,6 +45,12 @@ void pybind_sensor(py::module &m) {
                     {"timestamp", "Timestamp in the video (usec)."},
                     {"filename", "Path to the mkv file."},
                     {"enable_record", "Enable recording to mkv file."},
+                    {"queue_depth",
+                     "Maximum number of frames decoded ahead of the one "
+                     "returned."},
+                    {"num_decode_threads",
+                     "Number of threads decoding frames, 0 means the number "
+                     "of threads of parallel loops."},
                     {"enable_align_depth_to_color",
                      "Enable aligning WFOV depth image to the color image in "
                      "visualizer."}};
@@ -162,6 +170,105 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "next_frame",
                                     map_shared_argument_docstrings);
+
+    // Class asynchronous mkv reader
+    py::class_<io::AsyncMKVReader> azure_kinect_async_mkv_reader(
+            m, "AzureKinectAsyncMKVReader",
+            "AzureKinect mkv file reader that decodes frames ahead on worker "
+            "threads.");
+    azure_kinect_async_mkv_reader.def(py::init<>());
+    azure_kinect_async_mkv_reader
+            .def("is_opened", &io::AsyncMKVReader::IsOpened,
+                 "Check if the mkv file  is opened.")
+            .def("open", &io::AsyncMKVReader::Open, "filename"_a,
+                 "queue_depth"_a = 8, "num_decode_threads"_a = 0,
+                 "Open an mkv playback and start decoding its first frames.")
+            .def("close", &io::AsyncMKVReader::Close,
+                 "Stop the worker threads and close the opened mkv playback.")
+            .def("is_eof", &io::AsyncMKVReader::IsEOF,
+                 "Check if the mkv file is all read.")
+            .def("get_metadata", &io::AsyncMKVReader::GetMetadata,
+                 "Get metadata of the mkv playback.")
+            .def("seek_timestamp", &io::AsyncMKVReader::SeekTimestamp,
+                 "timestamp"_a, py::call_guard<py::gil_scoped_release>(),
+                 "Seek to the timestamp (in us).")
+            .def("next_frame", &io::AsyncMKVReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Get next frame from the mkv playback and returns the RGBD "
+                 "object.");
+    docstring::ClassMethodDocInject(m, "AzureKinectAsyncMKVReader", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectAsyncMKVReader",
+                                    "seek_timestamp",
+                                    map_shared_argument_docstrings);
+    // Class asynchronous multi-device recorder
+    py::class_<io::AsyncAzureKinectRecorderOption>
+            azure_kinect_async_recorder_option(
+                    m, "AzureKinectAsyncRecorderOption",
+                    "Optional parameters to AzureKinectAsyncRecorder.");
+    azure_kinect_async_recorder_option.def(py::init<>())
+            .def_readwrite("enable_preview",
+                           &io::AsyncAzureKinectRecorderOption::enable_preview)
+            .def_readwrite("enable_align_depth_to_color",
+                           &io::AsyncAzureKinectRecorderOption::
+                                   enable_align_depth_to_color)
+            .def_readwrite(
+                    "max_queued_captures",
+                    &io::AsyncAzureKinectRecorderOption::max_queued_captures)
+            .def_readwrite(
+                    "enable_hardware_sync",
+                    &io::AsyncAzureKinectRecorderOption::enable_hardware_sync)
+            .def_readwrite("subordinate_delay_usec",
+                           &io::AsyncAzureKinectRecorderOption::
+                                   subordinate_delay_usec);
+
+    py::class_<io::AsyncAzureKinectRecorder> azure_kinect_async_recorder(
+            m, "AzureKinectAsyncRecorder",
+            "AzureKinect recorder of one or several devices that writes "
+            "captures on background threads.");
+    azure_kinect_async_recorder
+            .def(py::init<const std::vector<io::AzureKinectSensorConfig> &,
+                          const std::vector<size_t> &,
+                          const io::AsyncAzureKinectRecorderOption &>(),
+                 "sensor_configs"_a, "sensor_indices"_a,
+                 "option"_a = io::AsyncAzureKinectRecorderOption())
+            .def("init_sensors", &io::AsyncAzureKinectRecorder::InitSensors,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Connect to the devices and start capturing.")
+            .def("stop", &io::AsyncAzureKinectRecorder::Stop,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop capturing, close the record and disconnect from the "
+                 "devices.")
+            .def("open_record", &io::AsyncAzureKinectRecorder::OpenRecord,
+                 "filenames"_a, "Create an mkv file per device.")
+            .def("close_record", &io::AsyncAzureKinectRecorder::CloseRecord,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Write the queued captures and close the mkv files.")
+            .def("is_record_created",
+                 &io::AsyncAzureKinectRecorder::IsRecordCreated,
+                 "Check if the mkv files are created.")
+            .def("set_recording", &io::AsyncAzureKinectRecorder::SetRecording,
+                 "recording"_a,
+                 "Enable or pause writing captures to the mkv files.")
+            .def("is_recording", &io::AsyncAzureKinectRecorder::IsRecording,
+                 "Check if captures are written to the mkv files.")
+            .def("get_num_devices",
+                 &io::AsyncAzureKinectRecorder::GetNumDevices,
+                 "Returns the number of devices.")
+            .def("get_preview_frame",
+                 &io::AsyncAzureKinectRecorder::GetPreviewFrame,
+                 "device_index"_a,
+                 "Returns the latest decoded frame of the device.")
+            .def("get_num_written_captures",
+                 &io::AsyncAzureKinectRecorder::GetNumWrittenCaptures,
+                 "device_index"_a,
+                 "Returns the number of captures of the device written to "
+                 "its mkv file.")
+            .def("get_num_dropped_captures",
+                 &io::AsyncAzureKinectRecorder::GetNumDroppedCaptures,
+                 "device_index"_a,
+                 "Returns the number of captures of the device dropped "
+                 "because its write queue was full.");
 }
 
 }  // namespace open3d
@@ -62,19 +62,37 @@ void pybind_odometry_classes(py::module &m) {
     // open3d.odometry.OdometryOption
     py::class_<odometry::OdometryOption> odometry_option(
             m, "OdometryOption", "Class that defines Odometry options.");
+    py::enum_<odometry::OdometryOption::PixelSelection>(
+            odometry_option, "PixelSelection",
+            "How the source pixels are chosen when a pyramid level has more "
+            "than max_pixels_per_level pixels with a depth.")
+            .value("Uniform", odometry::OdometryOption::PixelSelection::Uniform,
+                   "Pixels on a regular grid.")
+            .value("Gradient",
+                   odometry::OdometryOption::PixelSelection::Gradient,
+                   "The pixels with the largest intensity gradients.")
+            .export_values();
     odometry_option
-            .def(py::init(
-                         [](std::vector<int> iteration_number_per_pyramid_level,
-                            double max_depth_diff, double min_depth,
-                            double max_depth) {
-                             return new odometry::OdometryOption(
+            .def(py::init([](std::vector<int>
                                      iteration_number_per_pyramid_level,
-                                     max_depth_diff, min_depth, max_depth);
-                         }),
+                             double max_depth_diff, double min_depth,
+                             double max_depth, bool direct_projection,
+                             int max_pixels_per_level,
+                             odometry::OdometryOption::PixelSelection
+                                     pixel_selection) {
+                     return new odometry::OdometryOption(
+                             iteration_number_per_pyramid_level,
+                             max_depth_diff, min_depth, max_depth,
+                             direct_projection, max_pixels_per_level,
+                             pixel_selection);
+                 }),
                  "iteration_number_per_pyramid_level"_a =
                          std::vector<int>{20, 10, 5},
                  "max_depth_diff"_a = 0.03, "min_depth"_a = 0.0,
-                 "max_depth"_a = 4.0)
+                 "max_depth"_a = 4.0, "direct_projection"_a = false,
+                 "max_pixels_per_level"_a = 0,
+                 "pixel_selection"_a =
+                         odometry::OdometryOption::PixelSelection::Gradient)
             .def_readwrite("iteration_number_per_pyramid_level",
                            &odometry::OdometryOption::
                                    iteration_number_per_pyramid_level_,
@@ -97,6 +115,20 @@ void pybind_odometry_classes(py::module &m) {
             .def_readwrite("max_depth", &odometry::OdometryOption::max_depth_,
                            "Pixels that has larger than specified depth values "
                            "are ignored.")
+            .def_readwrite("direct_projection",
+                           &odometry::OdometryOption::direct_projection_,
+                           "If ``True``, every iteration projects the source "
+                           "pixels and accumulates their residuals in one "
+                           "pass, without a correspondence set.")
+            .def_readwrite("max_pixels_per_level",
+                           &odometry::OdometryOption::max_pixels_per_level_,
+                           "Maximum number of source pixels with a depth used "
+                           "at each pyramid level, 0 for all. Levels with more "
+                           "pixels are subsampled with ``pixel_selection``.")
+            .def_readwrite("pixel_selection",
+                           &odometry::OdometryOption::pixel_selection_,
+                           "How the source pixels are chosen on levels with "
+                           "more than ``max_pixels_per_level`` pixels.")
             .def("__repr__", [](const odometry::OdometryOption &c) {
                 int num_pyramid_level =
                         (int)c.iteration_number_per_pyramid_level_.size();
@@ -117,7 +149,18 @@ void pybind_odometry_classes(py::module &m) {
                        std::string("\nmin_depth = ") +
                        std::to_string(c.min_depth_) +
                        std::string("\nmax_depth = ") +
-                       std::to_string(c.max_depth_);
+                       std::to_string(c.max_depth_) +
+                       std::string("\ndirect_projection = ") +
+                       std::string(c.direct_projection_ ? "true" : "false") +
+                       std::string("\nmax_pixels_per_level = ") +
+                       std::to_string(c.max_pixels_per_level_) +
+                       std::string("\npixel_selection = ") +
+                       std::string(c.pixel_selection_ ==
+                                                   odometry::OdometryOption::
+                                                           PixelSelection::
+                                                                   Uniform
+                                           ? "Uniform"
+                                           : "Gradient");
             });
 
     // open3d.odometry.RGBDOdometryJacobian
@@ -178,6 +221,115 @@ Anonymous submission.)");
             [](const odometry::RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryJacobianFromPointToPlaneTerm:
+    // RGBDOdometryJacobian
+    py::class_<odometry::RGBDOdometryJacobianFromPointToPlaneTerm,
+               PyRGBDOdometryJacobian<
+                       odometry::RGBDOdometryJacobianFromPointToPlaneTerm>,
+               odometry::RGBDOdometryJacobian>
+            jacobian_point_to_plane(
+                    m, "RGBDOdometryJacobianFromPointToPlaneTerm",
+                    R"(Class to compute Jacobian using point-to-plane term
+
+Energy: :math:`(n_q \cdot (p'-q))^2 + \lambda_{color}(I_p-I_q)^2`
+
+The target normals are computed from the depth gradients.)");
+    jacobian_point_to_plane
+            .def(py::init<double>(), "lambda_color"_a = 0.0)
+            .def_readwrite("lambda_color",
+                           &odometry::RGBDOdometryJacobianFromPointToPlaneTerm::
+                                   lambda_color_,
+                           "float: Weight of the color term, 0 for depth only.")
+            .def("__repr__",
+                 [](const odometry::RGBDOdometryJacobianFromPointToPlaneTerm
+                            &te) {
+                     return std::string(
+                                    "RGBDOdometryJacobianFromPointToPlaneTerm "
+                                    "with lambda_color ") +
+                            std::to_string(te.lambda_color_);
+                 });
+    py::detail::bind_copy_functions<
+            odometry::RGBDOdometryJacobianFromPointToPlaneTerm>(
+            jacobian_point_to_plane);
+
+    // open3d.odometry.OdometryStatistics
+    py::class_<odometry::OdometryStatistics> statistics(
+            m, "OdometryStatistics",
+            "Counters and timing in milliseconds of an odometry estimation.");
+    py::detail::bind_default_constructor<odometry::OdometryStatistics>(
+            statistics);
+    py::detail::bind_copy_functions<odometry::OdometryStatistics>(statistics);
+    statistics
+            .def_readonly("num_iterations",
+                          &odometry::OdometryStatistics::num_iterations_,
+                          "int: Number of iterations over all pyramid levels.")
+            .def_readonly("num_iterations_per_level",
+                          &odometry::OdometryStatistics::
+                                  num_iterations_per_level_,
+                          "List of int: Iterations run per pyramid level, in "
+                          "the order of iteration_number_per_pyramid_level.")
+            .def_readonly("preprocessing_time",
+                          &odometry::OdometryStatistics::preprocessing_time_,
+                          "float: Preprocessing and building the pyramids.")
+            .def_readonly("correspondence_time",
+                          &odometry::OdometryStatistics::correspondence_time_,
+                          "float: Correspondence search and accumulation of "
+                          "the normal equations.")
+            .def_readonly("solve_time",
+                          &odometry::OdometryStatistics::solve_time_,
+                          "float: Solving the normal equations.")
+            .def_readonly("information_time",
+                          &odometry::OdometryStatistics::information_time_,
+                          "float: Computing the information matrix.")
+            .def_readonly("total_time",
+                          &odometry::OdometryStatistics::total_time_,
+                          "float: Duration of the whole call.")
+            .def("__repr__", [](const odometry::OdometryStatistics &s) {
+                return fmt::format(
+                        "odometry::OdometryStatistics with {:d} iterations "
+                        "and total {:.1f} ms",
+                        s.num_iterations_, s.total_time_);
+            });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<odometry::RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "Estimates the motion between consecutive frames of an RGBD "
+            "sequence, preprocessing every frame once.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const odometry::OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = odometry::OdometryOption())
+            .def("track", &odometry::RGBDOdometryTracker::Track,
+                 "Function to estimate the motion from the previous frame to "
+                 "a new frame, as ``compute_rgbd_odometry(previous, frame)``. "
+                 "The first frame only initializes the tracker. Output: "
+                 "(is_success, 4x4 motion matrix, 6x6 information matrix).",
+                 "frame"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm(),
+                 py::call_guard<py::gil_scoped_release>())
+            .def("reset", &odometry::RGBDOdometryTracker::Reset,
+                 "Forgets the previous frame.")
+            .def("has_previous_frame",
+                 &odometry::RGBDOdometryTracker::HasPreviousFrame,
+                 "Returns ``True`` if a frame has been tracked since the last "
+                 "reset.")
+            .def("get_statistics",
+                 &odometry::RGBDOdometryTracker::GetStatistics,
+                 "Returns the statistics of the last call of ``track``.")
+            .def("__repr__", [](const odometry::RGBDOdometryTracker &t) {
+                return std::string("RGBDOdometryTracker");
+            });
+    docstring::ClassMethodDocInject(
+            m, "RGBDOdometryTracker", "track",
+            {{"frame", "New RGBD image."},
+             {"odo_init", "Initial 4x4 motion matrix estimation."},
+             {"jacobian",
+              "The odometry Jacobian method to use. Can be "
+              "``odometry::RGBDOdometryJacobianFromHybridTerm()``, "
+              "``odometry::RGBDOdometryJacobianFromColorTerm()`` or "
+              "``odometry::RGBDOdometryJacobianFromPointToPlaneTerm()``."}});
 }
 
 void pybind_odometry_methods(py::module &m) {
@@ -188,7 +340,8 @@ void pybind_odometry_methods(py::module &m) {
           "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
           "odo_init"_a = Eigen::Matrix4d::Identity(),
           "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm(),
-          "option"_a = odometry::OdometryOption());
+          "option"_a = odometry::OdometryOption(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "compute_rgbd_odometry",
             {
@@ -198,8 +351,36 @@ void pybind_odometry_methods(py::module &m) {
                     {"odo_init", "Initial 4x4 motion matrix estimation."},
                     {"jacobian",
                      "The odometry Jacobian method to use. Can be "
-                     "``odometry::RGBDOdometryJacobianFromHybridTerm()`` or "
-                     "``odometry::RGBDOdometryJacobianFromColorTerm().``"},
+                     "``odometry::RGBDOdometryJacobianFromHybridTerm()``, "
+                     "``odometry::RGBDOdometryJacobianFromColorTerm()`` or "
+                     "``odometry::"
+                     "RGBDOdometryJacobianFromPointToPlaneTerm()``."},
+                    {"option", "Odometry hyper parameteres."},
+            });
+    m.def("compute_rgbd_odometry_with_statistics",
+          &odometry::ComputeRGBDOdometryWithStatistics,
+          "Function to estimate 6D rigid motion from two RGBD image pairs, as "
+          "``compute_rgbd_odometry``. Output: (is_success, 4x4 motion matrix, "
+          "6x6 information matrix, OdometryStatistics).",
+          "rgbd_source"_a, "rgbd_target"_a,
+          "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+          "odo_init"_a = Eigen::Matrix4d::Identity(),
+          "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm(),
+          "option"_a = odometry::OdometryOption(),
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "compute_rgbd_odometry_with_statistics",
+            {
+                    {"rgbd_source", "Source RGBD image."},
+                    {"rgbd_target", "Target RGBD image."},
+                    {"pinhole_camera_intrinsic", "Camera intrinsic parameters"},
+                    {"odo_init", "Initial 4x4 motion matrix estimation."},
+                    {"jacobian",
+                     "The odometry Jacobian method to use. Can be "
+                     "``odometry::RGBDOdometryJacobianFromHybridTerm()``, "
+                     "``odometry::RGBDOdometryJacobianFromColorTerm()`` or "
+                     "``odometry::"
+                     "RGBDOdometryJacobianFromPointToPlaneTerm()``."},
                     {"option", "Odometry hyper parameteres."},
             });
 }
@@ -42,6 +42,8 @@ namespace open3d {
 
 PYBIND11_MODULE(open3d_pybind, m) {
     open3d::utility::Logger::i().print_fcn_ = [](const std::string& msg) {
+        // Asynchronous logging prints from a background thread.
+        py::gil_scoped_acquire acquire;
         py::print(msg);
     };
 
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
 #include <pybind11/detail/internals.h>
 #include <pybind11/eigen.h>
 #include <pybind11/functional.h>
@@ -55,6 +59,7 @@ PYBIND11_MAKE_OPAQUE(std::vector<Eigen::Vector3d>);
 PYBIND11_MAKE_OPAQUE(std::vector<Eigen::Vector3i>);
 PYBIND11_MAKE_OPAQUE(std::vector<Eigen::Vector2d>);
 PYBIND11_MAKE_OPAQUE(std::vector<Eigen::Vector2i>);
+PYBIND11_MAKE_OPAQUE(std::vector<Eigen::Matrix3d>);
 PYBIND11_MAKE_OPAQUE(temp_eigen_matrix4d);
 PYBIND11_MAKE_OPAQUE(temp_eigen_vector4i);
 PYBIND11_MAKE_OPAQUE(std::vector<open3d::registration::PoseGraphEdge>);
@@ -76,5 +81,37 @@ void bind_copy_functions(Class_ &cl) {
     cl.def("__deepcopy__", [](T &v, py::dict &memo) { return T(v); });
 }
 
+/// Returns a numpy array of Scalar with one row per element of \p vec, used in
+/// the pickle state of geometries. The array is a view kept alive by \p owner,
+/// so pickle protocol 5 can transfer the buffer out-of-band. It is a copy if
+/// \p owner is null.
+template <typename Scalar, typename T, typename Alloc>
+py::array vector_to_pickle_array(const std::vector<T, Alloc> &vec,
+                                 py::handle owner) {
+    static_assert(sizeof(T) % sizeof(Scalar) == 0,
+                  "T must be an array of Scalar.");
+    const size_t cols = sizeof(T) / sizeof(Scalar);
+    return py::array_t<Scalar>({vec.size(), cols}, {sizeof(T), sizeof(Scalar)},
+                               reinterpret_cast<const Scalar *>(vec.data()),
+                               owner);
+}
+
+/// Restores \p vec from an array returned by vector_to_pickle_array().
+template <typename Scalar, typename T, typename Alloc>
+void pickle_array_to_vector(py::handle src, std::vector<T, Alloc> &vec) {
+    static_assert(sizeof(T) % sizeof(Scalar) == 0,
+                  "T must be an array of Scalar.");
+    const size_t cols = sizeof(T) / sizeof(Scalar);
+    auto array = py::array_t<Scalar, py::array::c_style |
+                                             py::array::forcecast>::ensure(src);
+    if (!array || size_t(array.size()) % cols != 0) {
+        throw std::runtime_error("Invalid pickle state.");
+    }
+    vec.resize(array.size() / cols);
+    if (!vec.empty()) {
+        std::memcpy(vec.data(), array.data(), array.size() * sizeof(Scalar));
+    }
+}
+
 }  // namespace detail
 }  // namespace pybind11
@@ -37,7 +37,10 @@ namespace open3d {
 namespace pybind_utils {
 
 Dtype ArrayFormatToDtype(const std::string& format) {
-    if (format == py::format_descriptor<float>::format()) {
+    // NumPy's buffer format for float16, pybind11 has no descriptor for it.
+    if (format == "e") {
+        return Dtype::Float16;
+    } else if (format == py::format_descriptor<float>::format()) {
         return Dtype::Float32;
     } else if (format == py::format_descriptor<double>::format()) {
         return Dtype::Float64;
@@ -47,6 +50,8 @@ Dtype ArrayFormatToDtype(const std::string& format) {
         return Dtype::Int64;
     } else if (format == py::format_descriptor<uint8_t>::format()) {
         return Dtype::UInt8;
+    } else if (format == py::format_descriptor<uint16_t>::format()) {
+        return Dtype::UInt16;
     } else if (format == py::format_descriptor<bool>::format()) {
         return Dtype::Bool;
     } else {
@@ -55,7 +60,9 @@ Dtype ArrayFormatToDtype(const std::string& format) {
 }
 
 std::string DtypeToArrayFormat(const Dtype& dtype) {
-    if (dtype == Dtype::Float32) {
+    if (dtype == Dtype::Float16) {
+        return "e";
+    } else if (dtype == Dtype::Float32) {
         return py::format_descriptor<float>::format();
     } else if (dtype == Dtype::Float64) {
         return py::format_descriptor<double>::format();
@@ -65,6 +72,8 @@ std::string DtypeToArrayFormat(const Dtype& dtype) {
         return py::format_descriptor<int64_t>::format();
     } else if (dtype == Dtype::UInt8) {
         return py::format_descriptor<uint8_t>::format();
+    } else if (dtype == Dtype::UInt16) {
+        return py::format_descriptor<uint16_t>::format();
     } else if (dtype == Dtype::Bool) {
         return py::format_descriptor<bool>::format();
     } else {
@@ -72,5 +81,55 @@ std::string DtypeToArrayFormat(const Dtype& dtype) {
     }
 }
 
+Dtype ArrayTypestrToDtype(const std::string& typestr) {
+    // Single-byte types may be marked "|" (not applicable). Open3D only
+    // supports little-endian data.
+    if (typestr.size() < 3 || (typestr[0] != '<' && typestr[0] != '|')) {
+        utility::LogError("Unsupported array typestr {}.", typestr);
+    }
+    std::string type = typestr.substr(1);
+    if (type == "f2") {
+        return Dtype::Float16;
+    } else if (type == "f4") {
+        return Dtype::Float32;
+    } else if (type == "f8") {
+        return Dtype::Float64;
+    } else if (type == "i4") {
+        return Dtype::Int32;
+    } else if (type == "i8") {
+        return Dtype::Int64;
+    } else if (type == "u1") {
+        return Dtype::UInt8;
+    } else if (type == "u2") {
+        return Dtype::UInt16;
+    } else if (type == "b1") {
+        return Dtype::Bool;
+    } else {
+        utility::LogError("Unsupported array typestr {}.", typestr);
+    }
+}
+
+std::string DtypeToArrayTypestr(const Dtype& dtype) {
+    if (dtype == Dtype::Float16) {
+        return "<f2";
+    } else if (dtype == Dtype::Float32) {
+        return "<f4";
+    } else if (dtype == Dtype::Float64) {
+        return "<f8";
+    } else if (dtype == Dtype::Int32) {
+        return "<i4";
+    } else if (dtype == Dtype::Int64) {
+        return "<i8";
+    } else if (dtype == Dtype::UInt8) {
+        return "|u1";
+    } else if (dtype == Dtype::UInt16) {
+        return "<u2";
+    } else if (dtype == Dtype::Bool) {
+        return "|b1";
+    } else {
+        utility::LogError("Unsupported data type.");
+    }
+}
+
 }  // namespace pybind_utils
 }  // namespace open3d
@@ -40,6 +40,12 @@ Dtype ArrayFormatToDtype(const std::string& format);
 
 std::string DtypeToArrayFormat(const Dtype& dtype);
 
+/// Converts a NumPy array interface type string, e.g. "<f4", to Dtype. Used by
+/// the CUDA Array Interface.
+Dtype ArrayTypestrToDtype(const std::string& typestr);
+
+std::string DtypeToArrayTypestr(const Dtype& dtype);
+
 }  // namespace pybind_utils
 
 }  // namespace open3d
@@ -25,7 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Parallel.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/registration/registration.h"
@@ -39,7 +41,16 @@ void pybind_feature(py::module &m) {
     py::detail::bind_default_constructor<registration::Feature>(feature);
     py::detail::bind_copy_functions<registration::Feature>(feature);
     feature.def("resize", &registration::Feature::Resize, "dim"_a, "n"_a,
+                "use_float"_a = false,
                 "Resize feature data buffer to ``dim x n``.")
+            .def("is_float", &registration::Feature::IsFloat,
+                 "Returns true if the features are stored in single "
+                 "precision.")
+            .def("convert_to_float", &registration::Feature::ConvertToFloat,
+                 "Moves the features to single precision storage.")
+            .def("convert_to_double",
+                 &registration::Feature::ConvertToDouble,
+                 "Moves the features to double precision storage.")
             .def("dimension", &registration::Feature::Dimension,
                  "Returns feature dimensions per point.")
             .def("num", &registration::Feature::Num,
@@ -47,6 +58,9 @@ void pybind_feature(py::module &m) {
             .def_readwrite("data", &registration::Feature::data_,
                            "``dim x n`` float64 numpy array: Data buffer "
                            "storing features.")
+            .def_readwrite("data_float", &registration::Feature::data_float_,
+                           "``dim x n`` float32 numpy array: Single precision "
+                           "data buffer storing features, see ``is_float``.")
             .def("__repr__", [](const registration::Feature &f) {
                 return std::string(
                                "registration::Feature class with dimension "
@@ -54,22 +68,132 @@ void pybind_feature(py::module &m) {
                        std::to_string(f.Dimension()) +
                        std::string(" and num = ") + std::to_string(f.Num()) +
                        std::string("\nAccess its data via data member.");
-            });
+            })
+            .def(py::pickle(
+                    [](py::object self) {
+                        const auto &f =
+                                self.cast<const registration::Feature &>();
+                        // Column-major views kept alive by self, as in
+                        // py::detail::vector_to_pickle_array().
+                        return py::make_tuple(
+                                py::array_t<double>(
+                                        {f.data_.rows(), f.data_.cols()},
+                                        {sizeof(double),
+                                         sizeof(double) * f.data_.rows()},
+                                        f.data_.data(), self),
+                                py::array_t<float>(
+                                        {f.data_float_.rows(),
+                                         f.data_float_.cols()},
+                                        {sizeof(float),
+                                         sizeof(float) * f.data_float_.rows()},
+                                        f.data_float_.data(), self));
+                    },
+                    [](const py::tuple &state) {
+                        if (state.size() != 2) {
+                            throw std::runtime_error("Invalid pickle state.");
+                        }
+                        auto f = std::make_shared<registration::Feature>();
+                        f->data_ = state[0].cast<Eigen::MatrixXd>();
+                        f->data_float_ = state[1].cast<Eigen::MatrixXf>();
+                        return f;
+                    }));
     docstring::ClassMethodDocInject(m, "Feature", "dimension");
     docstring::ClassMethodDocInject(m, "Feature", "num");
-    docstring::ClassMethodDocInject(m, "Feature", "resize",
-                                    {{"dim", "Feature dimension per point."},
-                                     {"n", "Number of points."}});
+    docstring::ClassMethodDocInject(m, "Feature", "is_float");
+    docstring::ClassMethodDocInject(m, "Feature", "convert_to_float");
+    docstring::ClassMethodDocInject(m, "Feature", "convert_to_double");
+    docstring::ClassMethodDocInject(
+            m, "Feature", "resize",
+            {{"dim", "Feature dimension per point."},
+             {"n", "Number of points."},
+             {"use_float", "Store the features in single precision."}});
 }
 
 void pybind_feature_methods(py::module &m) {
-    m.def("compute_fpfh_feature", &registration::ComputeFPFHFeature,
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::KDTreeSearchParam &, bool)) &
+                  registration::ComputeFPFHFeature,
           "Function to compute FPFH feature for a point cloud", "input"_a,
-          "search_param"_a);
+          "search_param"_a, "use_float"_a = false,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::NeighborGraph &, bool)) &
+                  registration::ComputeFPFHFeature,
+          "Function to compute FPFH feature for a point cloud from a "
+          "precomputed neighbor graph",
+          "input"_a, "graph"_a, "use_float"_a = false,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("compute_fpfh_feature",
+          (std::shared_ptr<registration::Feature>(*)(
+                  const geometry::PointCloud &,
+                  const geometry::KDTreeSearchParam &,
+                  const std::vector<size_t> &, bool)) &
+                  registration::ComputeFPFHFeature,
+          "Function to compute FPFH feature for a subset of the points of a "
+          "point cloud",
+          "input"_a, "search_param"_a, "indices"_a, "use_float"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
-             {"search_param", "KDTree KNN search parameter."}});
+             {"search_param", "KDTree KNN search parameter."},
+             {"graph", "Neighbor graph of the input point cloud."},
+             {"indices",
+              "Indices of the keypoints. Column i of the result is the "
+              "feature of point ``indices[i]``."},
+             {"use_float", "Store the features in single precision."}});
+    m.def("compute_fpfh_feature_batch",
+          [](const std::vector<std::shared_ptr<geometry::PointCloud>> &inputs,
+             const geometry::KDTreeSearchParam &search_param, bool use_float) {
+              for (const auto &input : inputs) {
+                  if (!input) {
+                      throw std::runtime_error("inputs must not contain None.");
+                  }
+              }
+              std::vector<std::shared_ptr<registration::Feature>> features(
+                      inputs.size());
+              utility::ParallelFor(0, int64_t(inputs.size()), [&](int64_t i) {
+                  features[i] = registration::ComputeFPFHFeature(
+                          *inputs[i], search_param, use_float);
+              });
+              return features;
+          },
+          "Function to compute FPFH features for each point cloud of a list, "
+          "processing the point clouds in parallel",
+          "inputs"_a, "search_param"_a, "use_float"_a = false,
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature_batch",
+            {{"inputs", "The input point clouds."},
+             {"search_param", "KDTree KNN search parameter."},
+             {"use_float", "Store the features in single precision."}});
+    m.def("correspondences_from_features",
+          (registration::CorrespondenceSet(*)(const registration::Feature &,
+                                              const registration::Feature &,
+                                              bool, double, double)) &
+                  registration::CorrespondencesFromFeatures,
+          "Function to find nearest neighbor correspondences between two "
+          "sets of features",
+          "source_feature"_a, "target_feature"_a, "mutual_filter"_a = false,
+          "max_ratio"_a = 1.0, "eps"_a = 0.0,
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_feature", "Features of the source point cloud."},
+             {"target_feature", "Features of the target point cloud."},
+             {"mutual_filter",
+              "Only keep pairs whose features are mutual nearest neighbors."},
+             {"max_ratio",
+              "Ratio test threshold in (0, 1]. A pair is only kept if the "
+              "nearest target feature is at most ``max_ratio`` times as far "
+              "as the second nearest one. 1 disables the test."},
+             {"eps",
+              "Approximation factor of the feature search. 0 is exact "
+              "search."}});
 }
 
 }  // namespace open3d
@@ -34,6 +34,82 @@
 
 namespace open3d {
 
+namespace {
+
+// The nodes and edges are not trivially copyable, so their fields are packed
+// into arrays.
+py::tuple PoseGraphToPickleState(const registration::PoseGraph &pose_graph) {
+    std::vector<Eigen::Matrix4d_u> poses;
+    poses.reserve(pose_graph.nodes_.size());
+    for (const auto &node : pose_graph.nodes_) {
+        poses.push_back(node.pose_);
+    }
+    const size_t num_edges = pose_graph.edges_.size();
+    std::vector<Eigen::Vector2i> node_ids(num_edges);
+    std::vector<Eigen::Matrix4d_u> transformations(num_edges);
+    std::vector<Eigen::Matrix6d_u> informations(num_edges);
+    std::vector<uint8_t> uncertain(num_edges);
+    std::vector<double> confidences(num_edges);
+    for (size_t i = 0; i < num_edges; ++i) {
+        const auto &edge = pose_graph.edges_[i];
+        node_ids[i] << edge.source_node_id_, edge.target_node_id_;
+        transformations[i] = edge.transformation_;
+        informations[i] = edge.information_;
+        uncertain[i] = edge.uncertain_;
+        confidences[i] = edge.confidence_;
+    }
+    return py::make_tuple(
+            py::detail::vector_to_pickle_array<double>(poses, py::handle()),
+            py::detail::vector_to_pickle_array<int>(node_ids, py::handle()),
+            py::detail::vector_to_pickle_array<double>(transformations,
+                                                       py::handle()),
+            py::detail::vector_to_pickle_array<double>(informations,
+                                                       py::handle()),
+            py::detail::vector_to_pickle_array<uint8_t>(uncertain,
+                                                        py::handle()),
+            py::detail::vector_to_pickle_array<double>(confidences,
+                                                       py::handle()));
+}
+
+std::shared_ptr<registration::PoseGraph> PoseGraphFromPickleState(
+        const py::tuple &state) {
+    if (state.size() != 6) {
+        throw std::runtime_error("Invalid pickle state.");
+    }
+    std::vector<Eigen::Matrix4d_u> poses;
+    std::vector<Eigen::Vector2i> node_ids;
+    std::vector<Eigen::Matrix4d_u> transformations;
+    std::vector<Eigen::Matrix6d_u> informations;
+    std::vector<uint8_t> uncertain;
+    std::vector<double> confidences;
+    py::detail::pickle_array_to_vector<double>(state[0], poses);
+    py::detail::pickle_array_to_vector<int>(state[1], node_ids);
+    py::detail::pickle_array_to_vector<double>(state[2], transformations);
+    py::detail::pickle_array_to_vector<double>(state[3], informations);
+    py::detail::pickle_array_to_vector<uint8_t>(state[4], uncertain);
+    py::detail::pickle_array_to_vector<double>(state[5], confidences);
+    const size_t num_edges = node_ids.size();
+    if (transformations.size() != num_edges ||
+        informations.size() != num_edges || uncertain.size() != num_edges ||
+        confidences.size() != num_edges) {
+        throw std::runtime_error("Invalid pickle state.");
+    }
+    auto pose_graph = std::make_shared<registration::PoseGraph>();
+    pose_graph->nodes_.reserve(poses.size());
+    for (const auto &pose : poses) {
+        pose_graph->nodes_.emplace_back(pose);
+    }
+    pose_graph->edges_.reserve(num_edges);
+    for (size_t i = 0; i < num_edges; ++i) {
+        pose_graph->edges_.emplace_back(node_ids[i](0), node_ids[i](1),
+                                        transformations[i], informations[i],
+                                        uncertain[i] != 0, confidences[i]);
+    }
+    return pose_graph;
+}
+
+}  // unnamed namespace
+
 template <class GlobalOptimizationMethodBase =
                   registration::GlobalOptimizationMethod>
 class PyGlobalOptimizationMethod : public GlobalOptimizationMethodBase {
@@ -167,7 +243,9 @@ void pybind_global_optimization(py::module &m) {
                        std::string(" nodes and ") +
                        std::to_string(rr.edges_.size()) +
                        std::string(" edges.");
-            });
+            })
+            .def(py::pickle(&PoseGraphToPickleState,
+                            &PoseGraphFromPickleState));
 
     // open3d.registration.GlobalOptimizationMethod
     py::class_<
@@ -362,6 +440,50 @@ void pybind_global_optimization(py::module &m) {
                             std::string("\n> reference_node : ") +
                             std::to_string(goo.reference_node_);
                  });
+
+    py::class_<registration::IncrementalGlobalOptimization> incremental(
+            m, "IncrementalGlobalOptimization",
+            "Online pose graph optimization for nodes added one at a time. "
+            "Every call of ``optimize`` only optimizes the last "
+            "``window_size`` nodes and the nodes spanned by newly added "
+            "edges, e.g. loop closures, while all other nodes are held "
+            "fixed.");
+    incremental
+            .def(py::init<int,
+                          const registration::
+                                  GlobalOptimizationConvergenceCriteria &,
+                          const registration::GlobalOptimizationOption &>(),
+                 "window_size"_a = 10,
+                 "criteria"_a =
+                         registration::GlobalOptimizationConvergenceCriteria(),
+                 "option"_a = registration::GlobalOptimizationOption())
+            .def("add_node",
+                 &registration::IncrementalGlobalOptimization::AddNode,
+                 "Adds a node to the pose graph and returns its id.", "node"_a)
+            .def("add_edge",
+                 &registration::IncrementalGlobalOptimization::AddEdge,
+                 "Adds an edge between two nodes of the pose graph.", "edge"_a)
+            .def("optimize",
+                 &registration::IncrementalGlobalOptimization::Optimize,
+                 "Optimizes the nodes affected by the nodes and edges added "
+                 "since the last call.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("get_pose_graph",
+                 &registration::IncrementalGlobalOptimization::GetPoseGraph,
+                 "Returns the pose graph.")
+            .def_readwrite("window_size",
+                           &registration::IncrementalGlobalOptimization::
+                                   window_size_,
+                           "int: Number of most recent nodes optimized by "
+                           "every call of ``optimize``.")
+            .def_readwrite(
+                    "criteria",
+                    &registration::IncrementalGlobalOptimization::criteria_,
+                    "Global optimization convergence criteria.")
+            .def_readwrite(
+                    "option",
+                    &registration::IncrementalGlobalOptimization::option_,
+                    "Global optimization option.");
 }
 
 void pybind_global_optimization_methods(py::module &m) {
@@ -375,7 +497,8 @@ void pybind_global_optimization_methods(py::module &m) {
                                                option);
           },
           "Function to optimize registration::PoseGraph", "pose_graph"_a,
-          "method"_a, "criteria"_a, "option"_a);
+          "method"_a, "criteria"_a, "option"_a,
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "global_optimization",
             {{"pose_graph", "The pose_graph to be optimized (in-place)."},
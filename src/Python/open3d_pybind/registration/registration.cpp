@@ -25,11 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Registration.h"
+#include "Open3D/Geometry/CompactPointCloud.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/ColoredICP.h"
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "Open3D/Registration/RegistrationTarget.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -77,6 +81,23 @@ public:
     }
 };
 
+// Binds a RobustKernel with a single scale parameter k_.
+template <class Kernel>
+static void pybind_scaled_kernel(py::module &m,
+                                 const char *name,
+                                 const char *doc,
+                                 const char *k_doc) {
+    py::class_<Kernel, std::shared_ptr<Kernel>, registration::RobustKernel>
+            kernel(m, name, doc);
+    kernel.def(py::init([](double k) { return new Kernel(k); }), "k"_a)
+            .def("__repr__",
+                 [name](const Kernel &kernel) {
+                     return std::string("registration::") + name +
+                            " with k=" + std::to_string(kernel.k_);
+                 })
+            .def_readwrite("k", &Kernel::k_, k_doc);
+}
+
 void pybind_registration_classes(py::module &m) {
     // open3d.registration.ICPConvergenceCriteria
     py::class_<registration::ICPConvergenceCriteria> convergence_criteria(
@@ -122,7 +143,9 @@ void pybind_registration_classes(py::module &m) {
             m, "RANSACConvergenceCriteria",
             "Class that defines the convergence criteria of RANSAC. RANSAC "
             "algorithm stops if the iteration number hits ``max_iteration``, "
-            "or the validation has been run for ``max_validation`` times. Note "
+            "or the validation has been run for ``max_validation`` times, or "
+            "enough iterations have been run to draw a sample without outliers "
+            "with probability ``confidence``. Note "
             "that the validation is the most computational expensive operator "
             "in an iteration. Most iterations do not do full validation. It is "
             "crucial to control ``max_validation`` so that the computation "
@@ -130,11 +153,13 @@ void pybind_registration_classes(py::module &m) {
     py::detail::bind_copy_functions<registration::RANSACConvergenceCriteria>(
             ransac_criteria);
     ransac_criteria
-            .def(py::init([](int max_iteration, int max_validation) {
+            .def(py::init([](int max_iteration, int max_validation,
+                             double confidence) {
                      return new registration::RANSACConvergenceCriteria(
-                             max_iteration, max_validation);
+                             max_iteration, max_validation, confidence);
                  }),
-                 "max_iteration"_a = 1000, "max_validation"_a = 1000)
+                 "max_iteration"_a = 1000, "max_validation"_a = 1000,
+                 "confidence"_a = 1.0)
             .def_readwrite(
                     "max_iteration",
                     &registration::RANSACConvergenceCriteria::max_iteration_,
@@ -144,13 +169,19 @@ void pybind_registration_classes(py::module &m) {
                     &registration::RANSACConvergenceCriteria::max_validation_,
                     "Maximum times the validation has been run before the "
                     "iteration stops.")
+            .def_readwrite(
+                    "confidence",
+                    &registration::RANSACConvergenceCriteria::confidence_,
+                    "Desired probability of drawing at least one sample "
+                    "without outliers. 1 disables the early stopping.")
             .def("__repr__",
                  [](const registration::RANSACConvergenceCriteria &c) {
                      return fmt::format(
                              "registration::RANSACConvergenceCriteria "
                              "class with max_iteration={:d}, "
-                             "and max_validation={:d}",
-                             c.max_iteration_, c.max_validation_);
+                             "max_validation={:d}, and confidence={:f}",
+                             c.max_iteration_, c.max_validation_,
+                             c.confidence_);
                  });
 
     // open3d.registration.TransformationEstimation
@@ -223,6 +254,44 @@ The homogeneous transformation is given by
 Sets :math:`c = 1` if ``with_scaling`` is ``False``.
 )");
 
+    // open3d.registration.RobustKernel
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>>
+            robust_kernel(m, "RobustKernel",
+                          "Base class of the robust loss functions used by "
+                          "ICP. Residuals are weighted by ``weight(r)`` in "
+                          "iteratively reweighted least squares.");
+    robust_kernel.def("weight", &registration::RobustKernel::Weight,
+                      "residual"_a, "Returns the weight of a residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               registration::RobustKernel>
+            l2_loss(m, "L2Loss",
+                    "Plain least squares. Every residual has weight 1.");
+    py::detail::bind_default_constructor<registration::L2Loss>(l2_loss);
+    l2_loss.def("__repr__", [](const registration::L2Loss &) {
+        return std::string("registration::L2Loss");
+    });
+
+    // open3d.registration.HuberLoss, CauchyLoss, GMLoss and TukeyLoss:
+    // RobustKernel
+    pybind_scaled_kernel<registration::HuberLoss>(
+            m, "HuberLoss",
+            "Huber loss. Quadratic for ``|r| <= k`` and linear beyond.",
+            "Residual at which the loss becomes linear.");
+    pybind_scaled_kernel<registration::CauchyLoss>(
+            m, "CauchyLoss", "Cauchy loss, ``k^2 / 2 * log(1 + (r / k)^2)``.",
+            "Scale of the residuals.");
+    pybind_scaled_kernel<registration::GMLoss>(
+            m, "GMLoss", "Geman-McClure loss, ``r^2 / 2 / (1 + (r / k)^2)``.",
+            "Scale of the residuals.");
+    pybind_scaled_kernel<registration::TukeyLoss>(
+            m, "TukeyLoss",
+            "Tukey's biweight. Residuals larger than ``k`` are ignored "
+            "entirely.",
+            "Residual beyond which the weight is zero.");
+
     // open3d.registration.TransformationEstimationPointToPlane:
     // TransformationEstimation
     py::class_<registration::TransformationEstimationPointToPlane,
@@ -236,11 +305,63 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(kernel);
+               }),
+               "kernel"_a)
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string("TransformationEstimationPointToPlane");
+                 })
+            .def_readwrite("kernel",
+                           &registration::TransformationEstimationPointToPlane::
+                                   kernel_,
+                           "Robust kernel that weights the point to plane "
+                           "residuals.");
+
+    // open3d.registration.TransformationEstimationForGeneralizedICP:
+    // TransformationEstimation
+    py::class_<registration::TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       registration::TransformationEstimationForGeneralizedICP>,
+               registration::TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation for Generalized ICP, "
+                    "which minimizes the distance between corresponding "
+                    "points under the sum of their covariances.");
+    py::detail::bind_copy_functions<
+            registration::TransformationEstimationForGeneralizedICP>(te_gicp);
+    te_gicp.def(py::init([](double epsilon,
+                            std::shared_ptr<registration::RobustKernel>
+                                    kernel) {
+                    return new registration::
+                            TransformationEstimationForGeneralizedICP(epsilon,
+                                                                      kernel);
+                }),
+                "epsilon"_a = 1e-3,
+                "kernel"_a = std::make_shared<registration::L2Loss>())
+            .def("__repr__",
+                 [](const registration::
+                            TransformationEstimationForGeneralizedICP &te) {
+                     return std::string(
+                                    "TransformationEstimationForGeneralizedICP "
+                                    "with epsilon=") +
+                            std::to_string(te.epsilon_);
+                 })
+            .def_readwrite("epsilon",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           epsilon_,
+                           "Variance of the points along their normal, "
+                           "relative to the variance in the tangent plane.")
+            .def_readwrite("kernel",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           kernel_,
+                           "Robust kernel that weights the Mahalanobis "
+                           "distances of the correspondences.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -447,6 +568,86 @@ must hold true for all edges.)");
                              c.maximum_tuple_count_);
                  });
 
+    // open3d.registration.RegistrationStopReason
+    py::enum_<registration::RegistrationStopReason>(m,
+                                                    "RegistrationStopReason")
+            .value("NotRun", registration::RegistrationStopReason::NotRun,
+                   "No iteration was run, e.g. for invalid arguments.")
+            .value("Converged",
+                   registration::RegistrationStopReason::Converged,
+                   "The relative change of fitness and RMSE fell below the "
+                   "ICP convergence criteria.")
+            .value("MaxIteration",
+                   registration::RegistrationStopReason::MaxIteration,
+                   "The maximum number of iterations was reached.")
+            .value("MaxValidation",
+                   registration::RegistrationStopReason::MaxValidation,
+                   "RANSAC reached the maximum number of validations.")
+            .value("Confidence",
+                   registration::RegistrationStopReason::Confidence,
+                   "RANSAC ran the iterations the confidence requires.")
+            .export_values();
+
+    // open3d.registration.RegistrationStatistics
+    py::class_<registration::RegistrationStatistics> registration_statistics(
+            m, "RegistrationStatistics",
+            "Counters and timing in milliseconds of a single registration "
+            "call.");
+    py::detail::bind_default_constructor<registration::RegistrationStatistics>(
+            registration_statistics);
+    py::detail::bind_copy_functions<registration::RegistrationStatistics>(
+            registration_statistics);
+    registration_statistics
+            .def_readonly(
+                    "num_iterations",
+                    &registration::RegistrationStatistics::num_iterations_,
+                    "int: Number of iterations run. For RANSAC, the number "
+                    "of hypotheses drawn.")
+            .def_readonly("stop_reason",
+                          &registration::RegistrationStatistics::stop_reason_,
+                          "RegistrationStopReason: Why the iterations stopped.")
+            .def_readonly("correspondence_time",
+                          &registration::RegistrationStatistics::
+                                  correspondence_time_,
+                          "float: Correspondence search and evaluation of "
+                          "transformations.")
+            .def_readonly(
+                    "solve_time",
+                    &registration::RegistrationStatistics::solve_time_,
+                    "float: Estimation of transformations.")
+            .def_readonly(
+                    "total_time",
+                    &registration::RegistrationStatistics::total_time_,
+                    "float: Duration of the whole call.")
+            .def_readonly(
+                    "iteration_times",
+                    &registration::RegistrationStatistics::iteration_times_,
+                    "List of float: Duration of every ICP iteration.")
+            .def_readonly("num_rejected_by_checkers",
+                          &registration::RegistrationStatistics::
+                                  num_rejected_by_checkers_,
+                          "int: Number of RANSAC hypotheses rejected by the "
+                          "correspondence checkers.")
+            .def_readonly("num_rejected_by_preview",
+                          &registration::RegistrationStatistics::
+                                  num_rejected_by_preview_,
+                          "int: Number of RANSAC hypotheses rejected by the "
+                          "preview on a subset of the points.")
+            .def_readonly(
+                    "num_validations",
+                    &registration::RegistrationStatistics::num_validations_,
+                    "int: Number of RANSAC hypotheses validated on all "
+                    "points.")
+            .def("__repr__", [](const registration::RegistrationStatistics
+                                        &s) {
+                return fmt::format(
+                        "registration::RegistrationStatistics with {:d} "
+                        "iterations, correspondences {:.1f} ms, solve {:.1f} "
+                        "ms and total {:.1f} ms",
+                        s.num_iterations_, s.correspondence_time_,
+                        s.solve_time_, s.total_time_);
+            });
+
     // open3d.registration.RegistrationResult
     py::class_<registration::RegistrationResult> registration_result(
             m, "RegistrationResult",
@@ -473,6 +674,10 @@ must hold true for all edges.)");
                     "fitness", &registration::RegistrationResult::fitness_,
                     "float: The overlapping area (# of inlier correspondences "
                     "/ # of points in target). Higher is better.")
+            .def_readonly("statistics",
+                          &registration::RegistrationResult::statistics_,
+                          "RegistrationStatistics: How the result was "
+                          "computed.")
             .def("__repr__", [](const registration::RegistrationResult &rr) {
                 return fmt::format(
                         "registration::RegistrationResult with "
@@ -483,6 +688,213 @@ must hold true for all edges.)");
                         rr.fitness_, rr.inlier_rmse_,
                         rr.correspondence_set_.size());
             });
+
+    // open3d.registration.RegistrationTarget
+    py::class_<registration::RegistrationTarget,
+               std::shared_ptr<registration::RegistrationTarget>>
+            registration_target(
+                    m, "RegistrationTarget",
+                    "Target point cloud that is registered against many "
+                    "times, e.g. a static map. Its KDTree and, optionally, "
+                    "the color gradients for colored ICP are computed once.");
+    registration_target
+            .def(py::init<const geometry::PointCloud &, double>(),
+                 "Copies the target point cloud and builds its KDTree. If "
+                 "color_gradient_radius is positive, the color gradients for "
+                 "colored ICP are computed from at most 30 neighbors within "
+                 "this radius.",
+                 "target"_a, "color_gradient_radius"_a = 0.0)
+            .def("get_point_cloud",
+                 &registration::RegistrationTarget::GetPointCloud,
+                 "Returns the target point cloud.",
+                 py::return_value_policy::reference_internal)
+            .def("has_color_gradients",
+                 &registration::RegistrationTarget::HasColorGradients,
+                 "Returns ``True`` if the color gradients have been computed.")
+            .def("__repr__", [](const registration::RegistrationTarget &t) {
+                return fmt::format(
+                        "registration::RegistrationTarget with {:d} points",
+                        t.GetPointCloud().points_.size());
+            });
+
+    // open3d.registration.MultiScaleICPLevelStatistics
+    py::class_<registration::MultiScaleICPLevelStatistics> level_statistics(
+            m, "MultiScaleICPLevelStatistics",
+            "Per-level timing in milliseconds and result of "
+            "registration_multi_scale_icp.");
+    py::detail::bind_default_constructor<
+            registration::MultiScaleICPLevelStatistics>(level_statistics);
+    level_statistics
+            .def_readonly("voxel_size",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  voxel_size_)
+            .def_readonly("num_source_points",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  num_source_points_)
+            .def_readonly("num_target_points",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  num_target_points_)
+            .def_readonly("num_iterations",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  num_iterations_)
+            .def_readonly(
+                    "fitness",
+                    &registration::MultiScaleICPLevelStatistics::fitness_)
+            .def_readonly("inlier_rmse",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  inlier_rmse_)
+            .def_readonly("preprocessing_time",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  preprocessing_time_)
+            .def_readonly("registration_time",
+                          &registration::MultiScaleICPLevelStatistics::
+                                  registration_time_)
+            .def("__repr__",
+                 [](const registration::MultiScaleICPLevelStatistics &s) {
+                     return fmt::format(
+                             "registration::MultiScaleICPLevelStatistics with "
+                             "voxel_size={:e}, {:d} iterations, fitness={:e}, "
+                             "inlier_rmse={:e}, preprocessing {:.1f} ms and "
+                             "registration {:.1f} ms",
+                             s.voxel_size_, s.num_iterations_, s.fitness_,
+                             s.inlier_rmse_, s.preprocessing_time_,
+                             s.registration_time_);
+                 });
+
+    // open3d.registration.PairwiseRegistrationOption
+    py::class_<registration::PairwiseRegistrationOption> pairwise_option(
+            m, "PairwiseRegistrationOption",
+            "Option for registration_pairwise. The defaults follow the "
+            "fragment registration of the reconstruction system for a voxel "
+            "size of 0.05.");
+    py::detail::bind_copy_functions<registration::PairwiseRegistrationOption>(
+            pairwise_option);
+    pairwise_option
+            .def(py::init([](double max_correspondence_distance,
+                             bool point_to_plane, double min_overlap) {
+                     return new registration::PairwiseRegistrationOption(
+                             max_correspondence_distance, point_to_plane,
+                             min_overlap);
+                 }),
+                 "max_correspondence_distance"_a = 0.07,
+                 "point_to_plane"_a = true, "min_overlap"_a = 0.3)
+            .def_readwrite("max_correspondence_distance",
+                           &registration::PairwiseRegistrationOption::
+                                   max_correspondence_distance_,
+                           "Maximum correspondence points-pair distance of "
+                           "RANSAC, ICP and the information matrix.")
+            .def_readwrite(
+                    "point_to_plane",
+                    &registration::PairwiseRegistrationOption::point_to_plane_,
+                    "Use point-to-plane ICP, which requires normals of the "
+                    "target fragments. Otherwise point-to-point ICP is used.")
+            .def_readwrite(
+                    "min_overlap",
+                    &registration::PairwiseRegistrationOption::min_overlap_,
+                    "Globally registered pairs fail if fewer than this ratio "
+                    "of the points of the smaller fragment have a "
+                    "correspondence.")
+            .def_readwrite("ransac_n",
+                           &registration::PairwiseRegistrationOption::ransac_n_,
+                           "Number of feature correspondences a RANSAC "
+                           "hypothesis is fit to.")
+            .def_readwrite("edge_length_threshold",
+                           &registration::PairwiseRegistrationOption::
+                                   edge_length_threshold_,
+                           "Similarity threshold of the edge length checker "
+                           "of RANSAC, or 0 to skip the check.")
+            .def_readwrite(
+                    "mutual_filter",
+                    &registration::PairwiseRegistrationOption::mutual_filter_,
+                    "Only sample from mutually nearest feature pairs.")
+            .def_readwrite(
+                    "ransac_criteria",
+                    &registration::PairwiseRegistrationOption::ransac_criteria_,
+                    "Convergence criteria of RANSAC.")
+            .def_readwrite(
+                    "icp_criteria",
+                    &registration::PairwiseRegistrationOption::icp_criteria_,
+                    "Convergence criteria of ICP.")
+            .def("__repr__",
+                 [](const registration::PairwiseRegistrationOption &o) {
+                     return fmt::format(
+                             "registration::PairwiseRegistrationOption with "
+                             "max_correspondence_distance={:e}, "
+                             "point_to_plane={}, and min_overlap={:e}",
+                             o.max_correspondence_distance_, o.point_to_plane_,
+                             o.min_overlap_);
+                 });
+
+    // open3d.registration.RegistrationPair
+    py::class_<registration::RegistrationPair> registration_pair(
+            m, "RegistrationPair",
+            "Pair of fragments registered by registration_pairwise. A pair "
+            "with an initial transformation, e.g. from odometry, is refined "
+            "with ICP. A pair without one is registered globally with RANSAC "
+            "on the features of the fragments.");
+    py::detail::bind_copy_functions<registration::RegistrationPair>(
+            registration_pair);
+    registration_pair
+            .def(py::init<int, int>(), "source_id"_a, "target_id"_a)
+            .def(py::init<int, int, const Eigen::Matrix4d &>(), "source_id"_a,
+                 "target_id"_a, "init"_a)
+            .def_readwrite("source_id",
+                           &registration::RegistrationPair::source_id_,
+                           "int: Index of the source fragment.")
+            .def_readwrite("target_id",
+                           &registration::RegistrationPair::target_id_,
+                           "int: Index of the target fragment.")
+            .def_readwrite("has_init",
+                           &registration::RegistrationPair::has_init_,
+                           "bool: Whether the pair is refined from ``init``.")
+            .def_readwrite("init", &registration::RegistrationPair::init_,
+                           "``4 x 4`` float64 numpy array: Initial "
+                           "transformation from source to target.")
+            .def("__repr__", [](const registration::RegistrationPair &p) {
+                return fmt::format(
+                        "registration::RegistrationPair from {:d} to {:d}{}",
+                        p.source_id_, p.target_id_,
+                        p.has_init_ ? " with init" : "");
+            });
+
+    // open3d.registration.PairwiseRegistrationResult
+    py::class_<registration::PairwiseRegistrationResult> pairwise_result(
+            m, "PairwiseRegistrationResult",
+            "Result of one pair of registration_pairwise.");
+    py::detail::bind_default_constructor<
+            registration::PairwiseRegistrationResult>(pairwise_result);
+    py::detail::bind_copy_functions<registration::PairwiseRegistrationResult>(
+            pairwise_result);
+    pairwise_result
+            .def_readwrite(
+                    "success",
+                    &registration::PairwiseRegistrationResult::success_,
+                    "bool: Whether the registration succeeded.")
+            .def_readwrite(
+                    "transformation",
+                    &registration::PairwiseRegistrationResult::transformation_,
+                    "``4 x 4`` float64 numpy array: The estimated "
+                    "transformation from source to target.")
+            .def_readwrite(
+                    "information",
+                    &registration::PairwiseRegistrationResult::information_,
+                    "``6 x 6`` float64 numpy array: The information matrix "
+                    "of the transformation.")
+            .def_readwrite(
+                    "fitness",
+                    &registration::PairwiseRegistrationResult::fitness_,
+                    "float: Fitness of the transformation.")
+            .def_readwrite(
+                    "inlier_rmse",
+                    &registration::PairwiseRegistrationResult::inlier_rmse_,
+                    "float: Inlier RMSE of the transformation.")
+            .def("__repr__",
+                 [](const registration::PairwiseRegistrationResult &r) {
+                     return fmt::format(
+                             "registration::PairwiseRegistrationResult with "
+                             "success={}, fitness={:e}, and inlier_rmse={:e}",
+                             r.success_, r.fitness_, r.inlier_rmse_);
+                 });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings
@@ -502,15 +914,24 @@ static const std::unordered_map<std::string, std::string>
                  "(``registration::TransformationEstimationPointToPoint``, "
                  "``registration::TransformationEstimationPointToPlane``)"},
                 {"init", "Initial transformation estimation"},
+                {"kernel",
+                 "Robust kernel that weights the residuals. One of "
+                 "(``registration::L2Loss``, ``registration::HuberLoss``, "
+                 "``registration::CauchyLoss``, ``registration::GMLoss``, "
+                 "``registration::TukeyLoss``)"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"mutual_filter",
+                 "Only sample from mutually nearest feature pairs."},
                 {"option", "Registration option"},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
+                {"target_features", "Features of the target point clouds."},
                 {"target", "The target point cloud."},
+                {"targets", "The target point clouds."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
                  "``target``"}};
@@ -519,28 +940,139 @@ void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &registration::EvaluateRegistration,
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
-          "transformation"_a = Eigen::Matrix4d::Identity());
+          "transformation"_a = Eigen::Matrix4d::Identity(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &registration::RegistrationICP,
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const registration::TransformationEstimation &,
+                            const registration::ICPConvergenceCriteria &>(
+                  &registration::RegistrationICP),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a =
                   registration::TransformationEstimationPointToPoint(false),
-          "criteria"_a = registration::ICPConvergenceCriteria());
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const registration::RegistrationTarget &, double,
+                            const Eigen::Matrix4d &,
+                            const registration::TransformationEstimation &,
+                            const registration::ICPConvergenceCriteria &>(
+                  &registration::RegistrationICP),
+          "Function for ICP registration against a prebuilt "
+          "RegistrationTarget, whose KDTree is reused",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          py::call_guard<py::gil_scoped_release>());
+    m.def("registration_icp",
+          py::overload_cast<const geometry::CompactPointCloud &,
+                            const geometry::CompactPointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const registration::TransformationEstimation &,
+                            const registration::ICPConvergenceCriteria &>(
+                  &registration::RegistrationICP),
+          "Function for ICP registration of single precision point clouds. "
+          "Only point-to-point without scaling and point-to-plane are "
+          "supported",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("registration_multi_scale_icp",
+          &registration::RegistrationMultiScaleICP,
+          "Function for coarse-to-fine ICP registration. Returns the result "
+          "of the last level and the statistics of every level.",
+          "source"_a, "target"_a, "voxel_sizes"_a,
+          "max_correspondence_distances"_a, "criteria"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "registration_multi_scale_icp",
+            {{"source", "The source point cloud."},
+             {"target", "The target point cloud."},
+             {"voxel_sizes",
+              "Voxel size of every level, usually decreasing. A voxel size "
+              "<= 0 uses the full resolution point clouds."},
+             {"max_correspondence_distances",
+              "Maximum correspondence points-pair distance of every level."},
+             {"criteria", "Convergence criteria of every level."},
+             {"init", "Initial transformation estimation"},
+             {"estimation_method",
+              "Estimation method. Normals of the target are estimated for "
+              "``registration::TransformationEstimationPointToPlane`` if it "
+              "has none."}});
 
-    m.def("registration_colored_icp", &registration::RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const registration::ICPConvergenceCriteria &,
+                            double,
+                            std::shared_ptr<registration::RobustKernel>>(
+                  &registration::RegistrationColoredICP),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "criteria"_a = registration::ICPConvergenceCriteria(),
-          "lambda_geometric"_a = 0.968);
+          "lambda_geometric"_a = 0.968,
+          "kernel"_a = std::make_shared<registration::L2Loss>(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_colored_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const registration::RegistrationTarget &, double,
+                            const Eigen::Matrix4d &,
+                            const registration::ICPConvergenceCriteria &,
+                            double,
+                            std::shared_ptr<registration::RobustKernel>>(
+                  &registration::RegistrationColoredICP),
+          "Function for Colored ICP registration against a prebuilt "
+          "RegistrationTarget with color gradients",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          "lambda_geometric"_a = 0.968,
+          "kernel"_a = std::make_shared<registration::L2Loss>(),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("registration_generalized_icp",
+          &registration::RegistrationGeneralizedICP,
+          "Function for Generalized ICP registration. The covariances of "
+          "both point clouds are taken from their covariances, their normals "
+          "or estimated from 20 nearest neighbors, and regularized once.",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationForGeneralizedICP(),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "registration_generalized_icp",
+            {{"source", "The source point cloud."},
+             {"target", "The target point cloud."},
+             {"max_correspondence_distance",
+              "Maximum correspondence points-pair distance."},
+             {"init", "Initial transformation estimation"},
+             {"estimation_method", "Estimation method."},
+             {"criteria", "Convergence criteria"}});
 
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
@@ -550,7 +1082,8 @@ void pybind_registration_methods(py::module &m) {
           "estimation_method"_a =
                   registration::TransformationEstimationPointToPoint(false),
           "ransac_n"_a = 6,
-          "criteria"_a = registration::RANSACConvergenceCriteria());
+          "criteria"_a = registration::RANSACConvergenceCriteria(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m,
                                  "registration_ransac_based_on_correspondence",
                                  map_shared_argument_docstrings);
@@ -565,16 +1098,36 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 4,
           "checkers"_a = std::vector<std::reference_wrapper<
                   const registration::CorrespondenceChecker>>(),
-          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100));
+          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100),
+          "mutual_filter"_a = false, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
 
     m.def("registration_fast_based_on_feature_matching",
-          &registration::FastGlobalRegistration,
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &,
+                            const registration::Feature &,
+                            const registration::Feature &,
+                            const registration::FastGlobalRegistrationOption
+                                    &>(&registration::FastGlobalRegistration),
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
-          "option"_a = registration::FastGlobalRegistrationOption());
+          "option"_a = registration::FastGlobalRegistrationOption(),
+          py::call_guard<py::gil_scoped_release>());
+    m.def("registration_fast_based_on_feature_matching",
+          py::overload_cast<
+                  const geometry::PointCloud &,
+                  const std::vector<std::shared_ptr<geometry::PointCloud>> &,
+                  const registration::Feature &,
+                  const std::vector<std::shared_ptr<registration::Feature>> &,
+                  const registration::FastGlobalRegistrationOption &>(
+                  &registration::FastGlobalRegistration),
+          "Function for fast global registration of one source against many "
+          "targets based on feature matching",
+          "source"_a, "targets"_a, "source_feature"_a, "target_features"_a,
+          "option"_a = registration::FastGlobalRegistrationOption(),
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m,
                                  "registration_fast_based_on_feature_matching",
                                  map_shared_argument_docstrings);
@@ -584,9 +1137,37 @@ void pybind_registration_methods(py::module &m) {
           "Function for computing information matrix from transformation "
           "matrix",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
-          "transformation"_a);
+          "transformation"_a, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(m, "get_information_matrix_from_point_clouds",
                                  map_shared_argument_docstrings);
+
+    m.def("get_information_matrix_from_correspondences",
+          &registration::GetInformationMatrixFromCorrespondences,
+          "Function for computing information matrix from the "
+          "correspondences of a transformation, e.g. the correspondence_set "
+          "of a RegistrationResult",
+          "target"_a, "corres"_a, py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "get_information_matrix_from_correspondences",
+            {{"target", "The target point cloud."},
+             {"corres",
+              "Correspondence set between source and target point cloud."}});
+
+    m.def("registration_pairwise", &registration::RegistrationPairwise,
+          "Function for registering many pairs of fragments in parallel, "
+          "e.g. to build the pose graph of a scene. KDTrees of the points and "
+          "features of every fragment are built once and shared by all pairs.",
+          "fragments"_a, "features"_a, "pairs"_a,
+          "option"_a = registration::PairwiseRegistrationOption(),
+          py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "registration_pairwise",
+            {{"fragments", "The fragments, usually downsampled."},
+             {"features",
+              "Features of the fragments. Only required if a pair is "
+              "registered globally."},
+             {"pairs", "Pairs of fragment indices to register."},
+             {"option", "Registration option"}});
 }
 
 void pybind_registration(py::module &m) {
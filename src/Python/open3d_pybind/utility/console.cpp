@@ -58,6 +58,23 @@ void pybind_console(py::module& m) {
           "Get global verbosity level of Open3D");
     docstring::FunctionDocInject(m, "get_verbosity_level");
 
+    m.def("set_async_logging", &utility::SetAsyncLogging,
+          "Format and print the log messages on a background thread. "
+          "Disabling it waits for the queued messages.",
+          "enabled"_a, py::call_guard<py::gil_scoped_release>());
+    m.def("is_async_logging", &utility::IsAsyncLogging,
+          "Return whether the log messages are printed on a background "
+          "thread.");
+    m.def("flush_log", &utility::FlushLog,
+          "Wait until the queued asynchronous log messages are printed.",
+          py::call_guard<py::gil_scoped_release>());
+    // The background thread needs the interpreter to print.
+    py::module::import("atexit").attr("register")(
+            py::cpp_function([]() {
+                py::gil_scoped_release release;
+                utility::SetAsyncLogging(false);
+            }));
+
     py::class_<utility::VerbosityContextManager>(m, "VerbosityContextManager",
                                                  "A context manager to "
                                                  "temporally change the "
@@ -27,6 +27,10 @@
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/open3d_pybind.h"
 
+#include <cstring>
+
+#include "Open3D/Utility/Parallel.h"
+
 namespace pybind11 {
 
 template <typename Vector,
@@ -45,76 +49,96 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
     return cl;
 }
 
-// - This function is used by Pybind for std::vector<SomeEigenType> constructor.
-//   This optional constructor is added to avoid too many Python <-> C++ API
-//   calls when the vector size is large using the default biding method.
-//   Pybind matches np.float64 array to py::array_t<double> buffer.
-// - Directly using templates for the py::array_t<double> and py::array_t<int>
-//   and etc. doesn't work. The current solution is to explicitly implement
-//   bindings for each py array types.
-template <typename EigenVector>
-std::vector<EigenVector> py_array_to_vectors_double(
-        py::array_t<double, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
-}
+namespace {
 
-template <typename EigenVector>
-std::vector<EigenVector> py_array_to_vectors_int(
-        py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
-    return eigen_vectors;
+// Copies the rows of a 2D array with arbitrary strides into eigen_vectors,
+// converting each element from SrcScalar. Elements are read with memcpy so that
+// unaligned numpy buffers are handled as well.
+template <typename SrcScalar, typename EigenVector, typename EigenAllocator>
+void copy_py_array_rows(
+        const py::array &array,
+        std::vector<EigenVector, EigenAllocator> &eigen_vectors) {
+    typedef typename EigenVector::Scalar Scalar;
+    const char *data = static_cast<const char *>(array.data());
+    const py::ssize_t row_stride = array.strides(0);
+    const py::ssize_t col_stride = array.strides(1);
+    open3d::utility::ParallelFor(
+            0, int64_t(eigen_vectors.size()), [&](int64_t i) {
+                const char *row = data + i * row_stride;
+                for (int j = 0; j < EigenVector::SizeAtCompileTime; ++j) {
+                    SrcScalar value;
+                    std::memcpy(&value, row + j * col_stride,
+                                sizeof(SrcScalar));
+                    eigen_vectors[i](j) = static_cast<Scalar>(value);
+                }
+            });
 }
 
+}  // unnamed namespace
+
+// - This function is used by Pybind for std::vector<SomeEigenType> constructor.
+//   This optional constructor is added to avoid too many Python <-> C++ API
+//   calls when the vector size is large using the default biding method.
+// - A C-contiguous array of the vector's own scalar type is copied with a
+//   single memcpy. float32/float64/int32/int64 arrays of any layout are
+//   converted element-wise in parallel without an intermediate numpy copy.
+//   Other dtypes fall back to a forcecast copy. The GIL is released while the
+//   data is copied.
+// - std::vector cannot adopt a foreign buffer, so a copy is unavoidable here.
+//   Use open3d.core.Tensor.from_numpy() to share memory with numpy instead.
 template <typename EigenVector,
-          typename EigenAllocator = Eigen::aligned_allocator<EigenVector>>
-std::vector<EigenVector, EigenAllocator>
-py_array_to_vectors_int_eigen_allocator(
-        py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
+          typename EigenAllocator = std::allocator<EigenVector>>
+std::vector<EigenVector, EigenAllocator> py_array_to_vectors(py::array array) {
+    typedef typename EigenVector::Scalar Scalar;
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(Scalar) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be tightly packed.");
+    if (array.ndim() != 2 ||
+        array.shape(1) != py::ssize_t(EigenVector::SizeAtCompileTime)) {
         throw py::cast_error();
     }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    enum class Source { Memcpy, Float32, Float64, Int32, Int64 } source;
+    if (py::isinstance<py::array_t<Scalar, py::array::c_style>>(array)) {
+        source = Source::Memcpy;
+    } else if (py::isinstance<py::array_t<float>>(array)) {
+        source = Source::Float32;
+    } else if (py::isinstance<py::array_t<double>>(array)) {
+        source = Source::Float64;
+    } else if (py::isinstance<py::array_t<int32_t>>(array)) {
+        source = Source::Int32;
+    } else if (py::isinstance<py::array_t<int64_t>>(array)) {
+        source = Source::Int64;
+    } else {
+        array = py::array_t<Scalar,
+                            py::array::c_style | py::array::forcecast>::ensure(
+                array);
+        if (!array) {
+            throw py::cast_error();
+        }
+        source = Source::Memcpy;
     }
-    return eigen_vectors;
-}
 
-template <typename EigenVector,
-          typename EigenAllocator = Eigen::aligned_allocator<EigenVector>>
-std::vector<EigenVector, EigenAllocator>
-py_array_to_vectors_int64_eigen_allocator(
-        py::array_t<int64_t, py::array::c_style | py::array::forcecast> array) {
-    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
     std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    py::gil_scoped_release release;
+    switch (source) {
+        case Source::Memcpy:
+            if (!eigen_vectors.empty()) {
+                std::memcpy(eigen_vectors.data(), array.data(),
+                            eigen_vectors.size() * sizeof(EigenVector));
+            }
+            break;
+        case Source::Float32:
+            copy_py_array_rows<float>(array, eigen_vectors);
+            break;
+        case Source::Float64:
+            copy_py_array_rows<double>(array, eigen_vectors);
+            break;
+        case Source::Int32:
+            copy_py_array_rows<int32_t>(array, eigen_vectors);
+            break;
+        case Source::Int64:
+            copy_py_array_rows<int64_t>(array, eigen_vectors);
+            break;
     }
     return eigen_vectors;
 }
@@ -166,6 +190,11 @@ py::class_<Vector, holder_type> pybind_eigen_vector_of_vector(
     auto vec = py::bind_vector_without_repr<std::vector<EigenVector>>(
             m, bind_name, py::buffer_protocol());
     vec.def(py::init(init_func));
+    // Lists and other array-likes are converted by numpy first.
+    typedef py::array_t<Scalar, py::array::c_style | py::array::forcecast>
+            ScalarArray;
+    vec.def(py::init(
+            [init_func](ScalarArray array) { return init_func(array); }));
     vec.def_buffer([](std::vector<EigenVector> &v) -> py::buffer_info {
         size_t rows = EigenVector::RowsAtCompileTime;
         return py::buffer_info(v.data(), sizeof(Scalar),
@@ -239,6 +268,11 @@ py::class_<Vector, holder_type> pybind_eigen_vector_of_vector_eigen_allocator(
             std::vector<EigenVector, EigenAllocator>>(m, bind_name,
                                                       py::buffer_protocol());
     vec.def(py::init(init_func));
+    // Lists and other array-likes are converted by numpy first.
+    typedef py::array_t<Scalar, py::array::c_style | py::array::forcecast>
+            ScalarArray;
+    vec.def(py::init(
+            [init_func](ScalarArray array) { return init_func(array); }));
     vec.def_buffer(
             [](std::vector<EigenVector, EigenAllocator> &v) -> py::buffer_info {
                 size_t rows = EigenVector::RowsAtCompileTime;
@@ -341,11 +375,15 @@ void pybind_eigen(py::module &m) {
 
     auto vector3dvector = pybind_eigen_vector_of_vector<Eigen::Vector3d>(
             m, "Vector3dVector", "std::vector<Eigen::Vector3d>",
-            py::py_array_to_vectors_double<Eigen::Vector3d>);
+            py::py_array_to_vectors<Eigen::Vector3d>);
     vector3dvector.attr("__doc__") = docstring::static_property(
             py::cpp_function([](py::handle arg) -> std::string {
                 return R"(Convert float64 numpy array of shape ``(n, 3)`` to Open3D format.
 
+C-contiguous float64 arrays are copied in bulk, and float32 arrays are
+converted directly without an intermediate numpy copy. The data is always
+copied; use ``open3d.core.Tensor.from_numpy`` to share memory with numpy.
+
 Example usage
 
 .. code-block:: python
@@ -367,7 +405,7 @@ Example usage
 
     auto vector3ivector = pybind_eigen_vector_of_vector<Eigen::Vector3i>(
             m, "Vector3iVector", "std::vector<Eigen::Vector3i>",
-            py::py_array_to_vectors_int<Eigen::Vector3i>);
+            py::py_array_to_vectors<Eigen::Vector3i>);
     vector3ivector.attr("__doc__") = docstring::static_property(
             py::cpp_function([](py::handle arg) -> std::string {
                 return R"(Convert int32 numpy array of shape ``(n, 3)`` to Open3D format..
@@ -410,7 +448,7 @@ Example usage
 
     auto vector2ivector = pybind_eigen_vector_of_vector<Eigen::Vector2i>(
             m, "Vector2iVector", "std::vector<Eigen::Vector2i>",
-            py::py_array_to_vectors_int<Eigen::Vector2i>);
+            py::py_array_to_vectors<Eigen::Vector2i>);
     vector2ivector.attr("__doc__") = docstring::static_property(
             py::cpp_function([](py::handle arg) -> std::string {
                 return "Convert int32 numpy array of shape ``(n, 2)`` to "
@@ -420,7 +458,7 @@ Example usage
 
     auto vector2dvector = pybind_eigen_vector_of_vector<Eigen::Vector2d>(
             m, "Vector2dVector", "std::vector<Eigen::Vector2d>",
-            py::py_array_to_vectors_double<Eigen::Vector2d>);
+            py::py_array_to_vectors<Eigen::Vector2d>);
     vector2dvector.attr("__doc__") = docstring::static_property(
             py::cpp_function([](py::handle arg) -> std::string {
                 return "Convert float64 numpy array of shape ``(n, 2)`` to "
@@ -428,6 +466,16 @@ Example usage
             }),
             py::none(), py::none(), "");
 
+    auto matrix3dvector = pybind_eigen_vector_of_matrix<
+            Eigen::Matrix3d, std::allocator<Eigen::Matrix3d>>(
+            m, "Matrix3dVector", "std::vector<Eigen::Matrix3d>");
+    matrix3dvector.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Convert float64 numpy array of shape ``(n, 3, 3)`` to "
+                       "Open3D format.";
+            }),
+            py::none(), py::none(), "");
+
     auto matrix4dvector = pybind_eigen_vector_of_matrix<Eigen::Matrix4d>(
             m, "Matrix4dVector", "std::vector<Eigen::Matrix4d>");
     matrix4dvector.attr("__doc__") = docstring::static_property(
@@ -440,7 +488,8 @@ Example usage
     auto vector4ivector = pybind_eigen_vector_of_vector_eigen_allocator<
             Eigen::Vector4i>(
             m, "Vector4iVector", "std::vector<Eigen::Vector4i>",
-            py::py_array_to_vectors_int_eigen_allocator<Eigen::Vector4i>);
+            py::py_array_to_vectors<Eigen::Vector4i,
+                                    Eigen::aligned_allocator<Eigen::Vector4i>>);
     vector4ivector.attr("__doc__") = docstring::static_property(
             py::cpp_function([](py::handle arg) -> std::string {
                 return "Convert int numpy array of shape ``(n, 4)`` to "
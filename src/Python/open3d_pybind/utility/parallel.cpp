@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <memory>
+
+#include "Open3D/Utility/Console.h"
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+#include "open3d_pybind/utility/utility.h"
+
+namespace open3d {
+
+namespace {
+
+/// Context manager around utility::ScopedNumThreads. The scope is opened and
+/// closed by the with statement, on the Python thread that runs the block.
+class PyScopedNumThreads {
+public:
+    explicit PyScopedNumThreads(int num_threads) : num_threads_(num_threads) {
+        if (num_threads < 0) {
+            utility::LogError(
+                    "Number of threads must be non-negative, but got {}.",
+                    num_threads);
+        }
+    }
+
+    void Enter() { scope_.reset(new utility::ScopedNumThreads(num_threads_)); }
+    void Exit() { scope_.reset(); }
+    int GetNumThreads() const { return num_threads_; }
+
+private:
+    int num_threads_;
+    std::unique_ptr<utility::ScopedNumThreads> scope_;
+};
+
+}  // unnamed namespace
+
+void pybind_parallel(py::module& m) {
+    py::enum_<utility::ParallelBackend>(m, "ParallelBackend",
+                                        "Runtime of Open3D's parallel loops.")
+            .value("OpenMP", utility::ParallelBackend::OpenMP)
+            .value("ThreadPool", utility::ParallelBackend::ThreadPool)
+            .export_values();
+
+    m.def("set_parallel_backend", &utility::SetParallelBackend,
+          "Set the runtime of Open3D's parallel loops. ThreadPool shares one "
+          "pool of workers between all calling threads.",
+          "backend"_a);
+    m.def("get_parallel_backend", &utility::GetParallelBackend,
+          "Get the runtime of Open3D's parallel loops.");
+    m.def("set_num_threads", &utility::SetNumThreads,
+          "Set the number of threads of Open3D's parallel loops, 0 restores "
+          "the default.",
+          "num_threads"_a);
+    m.def("get_num_threads", &utility::GetNumThreads,
+          "Get the number of threads of Open3D's parallel loops started from "
+          "the calling thread.");
+
+    py::class_<PyScopedNumThreads>(
+            m, "ScopedNumThreads",
+            "Context manager that limits the parallel loops started from the "
+            "calling thread to num_threads threads, without affecting other "
+            "threads. 0 lifts an enclosing limit.")
+            .def(py::init<int>(), "num_threads"_a)
+            .def("__enter__",
+                 [](PyScopedNumThreads& scope) -> PyScopedNumThreads& {
+                     scope.Enter();
+                     return scope;
+                 },
+                 py::return_value_policy::reference)
+            .def("__exit__",
+                 [](PyScopedNumThreads& scope, py::object, py::object,
+                    py::object) { scope.Exit(); })
+            .def_property_readonly("num_threads",
+                                   &PyScopedNumThreads::GetNumThreads)
+            .def("__repr__", [](const PyScopedNumThreads& scope) {
+                return fmt::format("ScopedNumThreads({:d})",
+                                   scope.GetNumThreads());
+            });
+}
+
+}  // namespace open3d
@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+#include "open3d_pybind/utility/utility.h"
+
+namespace open3d {
+
+void pybind_profiler(py::module& m) {
+    m.def("set_profiler_enabled", &utility::SetProfilerEnabled,
+          "Enable or disable the scoped profiler of Open3D's pipelines.",
+          "enabled"_a);
+    m.def("is_profiler_enabled", &utility::IsProfilerEnabled,
+          "Return whether the profiler records events.");
+    m.def("set_profiler_buffer_size", &utility::SetProfilerBufferSize,
+          "Set the number of events kept per thread, the oldest ones are "
+          "overwritten first.",
+          "num_events_per_thread"_a);
+    m.def("reset_profiler", &utility::ResetProfiler,
+          "Discard the recorded events.");
+    m.def("write_profiler_chrome_trace", &utility::WriteProfilerChromeTrace,
+          "Write the recorded events as a Chrome trace, which "
+          "chrome://tracing and Perfetto open.",
+          "filename"_a);
+    m.def("get_profiler_summary", &utility::GetProfilerSummary,
+          "Return a table of the recorded scopes with their calls, total and "
+          "self time.");
+}
+
+}  // namespace open3d
@@ -34,6 +34,8 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_console(m_submodule);
     pybind_eigen(m_submodule);
+    pybind_parallel(m_submodule);
+    pybind_profiler(m_submodule);
 }
 
 }  // namespace open3d
@@ -34,5 +34,7 @@ void pybind_utility(py::module &m);
 
 void pybind_console(py::module &m);
 void pybind_eigen(py::module &m);
+void pybind_parallel(py::module &m);
+void pybind_profiler(py::module &m);
 
 }  // namespace open3d
@@ -77,6 +77,11 @@ void pybind_renderoption(py::module &m) {
             .def_readwrite("point_show_normal",
                            &visualization::RenderOption::point_show_normal_,
                            "bool: Whether to show normal for ``PointCloud``.")
+            .def_readwrite(
+                    "point_budget", &visualization::RenderOption::point_budget_,
+                    "int: Maximum number of points drawn per frame for a "
+                    "``PointCloud``. Larger point clouds are drawn through a "
+                    "level-of-detail octree.")
             .def_readwrite("show_coordinate_frame",
                            &visualization::RenderOption::show_coordinate_frame_,
                            "bool: Whether to show coordinate frame.")
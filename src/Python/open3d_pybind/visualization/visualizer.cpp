@@ -40,6 +40,9 @@ namespace open3d {
 static const std::unordered_map<std::string, std::string>
         map_visualizer_docstrings = {
                 {"callback_func", "The call back function."},
+                {"capture_depth",
+                 "Set to ``True`` to capture depth images instead of screen "
+                 "images."},
                 {"depth_scale",
                  "Scale depth value when capturing the depth image."},
                 {"do_render", "Set to ``True`` to do render."},
@@ -47,6 +50,7 @@ static const std::unordered_map<std::string, std::string>
                 {"geometry", "The ``Geometry`` object."},
                 {"height", "Height of window."},
                 {"left", "Left margin of the window to the screen."},
+                {"num_writer_threads", "Number of threads writing the images."},
                 {"top", "Top margin of the window to the screen."},
                 {"visible", "Whether the window is visible."},
                 {"width", "Width of the window."},
@@ -136,6 +140,21 @@ void pybind_visualizer(py::module &m) {
                  &visualization::Visualizer::CaptureDepthPointCloud,
                  "Function to capture and save local point cloud", "filename"_a,
                  "do_render"_a = false, "convert_to_world_coordinate"_a = false)
+            .def("begin_capture_sequence",
+                 &visualization::Visualizer::BeginCaptureSequence,
+                 "Function to start capturing a sequence of screen or depth "
+                 "images, which are read back and written in the background",
+                 "capture_depth"_a = false, "depth_scale"_a = 1000.0,
+                 "num_writer_threads"_a = 2)
+            .def("capture_sequence_frame",
+                 &visualization::Visualizer::CaptureSequenceFrame,
+                 "Function to capture a frame of the sequence", "filename"_a,
+                 "do_render"_a = false)
+            .def("end_capture_sequence",
+                 &visualization::Visualizer::EndCaptureSequence,
+                 "Function to write the remaining frames of the sequence and "
+                 "wait for them. Returns ``False`` if an image could not be "
+                 "written")
             .def("get_window_name", &visualization::Visualizer::GetWindowName);
 
     py::class_<visualization::VisualizerWithKeyCallback,
@@ -249,6 +268,12 @@ void pybind_visualizer(py::module &m) {
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "capture_screen_image",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "begin_capture_sequence",
+                                    map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "capture_sequence_frame",
+                                    map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "end_capture_sequence",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "close",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "create_window",
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace tensorflow;
+
+REGISTER_OP("Open3DFixedRadiusSearch")
+        .Attr("T: {float, double}")
+        .Attr("return_distances: bool = false")
+        .Input("points: T")
+        .Input("queries: T")
+        .Input("radius: T")
+        .Output("neighbors_index: int32")
+        .Output("neighbors_row_splits: int64")
+        .Output("neighbors_distance: T")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            ShapeHandle points_shape, queries_shape, radius_shape;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &points_shape));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &queries_shape));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &radius_shape));
+
+            DimensionHandle dim;
+            TF_RETURN_IF_ERROR(c->WithValue(c->Dim(points_shape, 1), 3, &dim));
+            TF_RETURN_IF_ERROR(c->WithValue(c->Dim(queries_shape, 1), 3, &dim));
+
+            // the number of neighbors is only known at runtime
+            c->set_output(0, c->Vector(c->UnknownDim()));
+
+            DimensionHandle num_queries_plus_1;
+            TF_RETURN_IF_ERROR(c->Add(c->Dim(queries_shape, 0), 1,
+                                      &num_queries_plus_1));
+            c->set_output(1, c->Vector(num_queries_plus_1));
+
+            bool return_distances;
+            TF_RETURN_IF_ERROR(
+                    c->GetAttr("return_distances", &return_distances));
+            if (return_distances) {
+                c->set_output(2, c->Vector(c->UnknownDim()));
+            } else {
+                c->set_output(2, c->Vector(0));
+            }
+
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Computes the indices of all points within a radius for each query point.
+
+
+return_distances:
+  If True the squared distances to the neighbors are returned in
+  neighbors_distance. Otherwise neighbors_distance is an empty tensor.
+
+points:
+  The 3D positions of the points with shape [num_points,3].
+
+queries:
+  The 3D positions of the query points with shape [num_queries,3].
+
+radius:
+  A scalar with the search radius.
+
+neighbors_index:
+  The indices of the neighbors of all query points as a flat list. The
+  neighbors of query point i are
+  neighbors_index[neighbors_row_splits[i]:neighbors_row_splits[i+1]].
+
+neighbors_row_splits:
+  The exclusive prefix sum of the number of neighbors per query point with
+  shape [num_queries+1].
+
+neighbors_distance:
+  The squared distances to the neighbors with the same layout as
+  neighbors_index.
+
+)doc");
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/ML/Misc/Detail/KnnSearchCPU.h"
+#include "NeighborSearchOutputAllocator.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace open3d::ml::detail;
+using namespace tensorflow;
+
+template <class T>
+class KnnSearchOpKernelCPU : public OpKernel {
+public:
+    explicit KnnSearchOpKernelCPU(OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        OP_REQUIRES_OK(construction, construction->GetAttr("return_distances",
+                                                           &return_distances));
+    }
+
+    void Compute(OpKernelContext* context) override {
+        static_assert(sizeof(int64) == sizeof(int64_t),
+                      "int64 type is not compatible");
+
+        const Tensor& points = context->input(0);
+        const Tensor& queries = context->input(1);
+        const Tensor& k_tensor = context->input(2);
+        OP_REQUIRES(context,
+                    points.dims() == 2 && points.dim_size(1) == 3,
+                    errors::InvalidArgument("points must have shape [N,3]"));
+        OP_REQUIRES(context,
+                    queries.dims() == 2 && queries.dim_size(1) == 3,
+                    errors::InvalidArgument("queries must have shape [M,3]"));
+        OP_REQUIRES(context, TensorShapeUtils::IsScalar(k_tensor.shape()),
+                    errors::InvalidArgument("k must be a scalar"));
+        const int k = k_tensor.scalar<int32>()();
+        OP_REQUIRES(context, k >= 0,
+                    errors::InvalidArgument("k must not be negative"));
+
+        Tensor* row_splits = 0;
+        TensorShape row_splits_shape({queries.dim_size(0) + 1});
+        OP_REQUIRES_OK(context, context->allocate_output(1, row_splits_shape,
+                                                         &row_splits));
+
+        NeighborSearchOutputAllocator<T> output_allocator(context);
+        KnnSearchCPU((int64_t*)row_splits->flat<int64>().data(),
+                     points.dim_size(0), points.flat<T>().data(),
+                     queries.dim_size(0), queries.flat<T>().data(), k,
+                     return_distances, output_allocator);
+    }
+
+private:
+    bool return_distances;
+};
+
+#define REG_KB(type)                                            \
+    REGISTER_KERNEL_BUILDER(Name("Open3DKnnSearch")             \
+                                    .Device(DEVICE_CPU)         \
+                                    .TypeConstraint<type>("T"), \
+                            KnnSearchOpKernelCPU<type>);
+REG_KB(float)
+REG_KB(double)
+#undef REG_KB
@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+
+/// Output allocator for the neighbor search kernels. Allocates the
+/// neighbors_index and neighbors_distance outputs of the op as 1D tensors.
+template <class T>
+class NeighborSearchOutputAllocator {
+public:
+    explicit NeighborSearchOutputAllocator(
+            tensorflow::OpKernelContext* context)
+        : context(context) {}
+
+    void AllocIndices(int32_t** ptr, size_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num)});
+        OP_REQUIRES_OK(context, context->allocate_output(0, shape, &tensor));
+        auto flat_tensor = tensor->flat<int32>();
+        *ptr = (int32_t*)flat_tensor.data();
+    }
+
+    void AllocDistances(T** ptr, size_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num)});
+        OP_REQUIRES_OK(context, context->allocate_output(2, shape, &tensor));
+        auto flat_tensor = tensor->flat<T>();
+        *ptr = flat_tensor.data();
+    }
+
+private:
+    tensorflow::OpKernelContext* context;
+};
@@ -24,67 +24,33 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include "tensorflow/core/framework/op.h"
-#include "tensorflow/core/framework/op_kernel.h"
-#include "tensorflow/core/lib/core/errors.h"
-
 #include "Open3D/ML/Misc/Detail/ReduceSubarraysSumCPU.h"
+#include "ReduceSubarraysSumOpKernel.h"
 
 using namespace open3d::ml::detail;
 using namespace tensorflow;
 
 template <class T>
-class ReduceSubarraysSumOp : public OpKernel {
+class ReduceSubarraysSumOpKernelCPU : public ReduceSubarraysSumOpKernel {
 public:
-    explicit ReduceSubarraysSumOp(OpKernelConstruction* construction)
-        : OpKernel(construction) {}
-
-    void Compute(OpKernelContext* context) override {
-        static_assert(sizeof(int64) == sizeof(int64_t),
-                      "int64 type is not compatible");
-
-        const Tensor& values_tensor = context->input(0);
-        auto values = values_tensor.flat<T>();
-        const TensorShape values_shape(values_tensor.shape());
-        const int values_rank = values_shape.dims();
-        OP_REQUIRES(context, values_rank == 1,
-                    errors::InvalidArgument("values must be a rank 1 tensor"));
-
-        const Tensor& prefix_sum_tensor = context->input(1);
-        auto prefix_sum = prefix_sum_tensor.flat<int64>();
-        const TensorShape prefix_sum_shape(prefix_sum_tensor.shape());
-        const int prefix_sum_rank = prefix_sum_shape.dims();
-        OP_REQUIRES(
-                context, prefix_sum_rank == 1,
-                errors::InvalidArgument("prefix_sum must be a rank 1 tensor"));
-
-        // special treatment for empty values vector
-        if (values_shape.dim_size(0) == 0) {
-            Tensor* sums_tensor = 0;
-            OP_REQUIRES_OK(context, context->allocate_output(0, values_shape,
-                                                             &sums_tensor));
-            return;
-        }
-
-        Tensor* sums_tensor = 0;
-        TensorShape sums_shape(prefix_sum_shape);
-        OP_REQUIRES_OK(context,
-                       context->allocate_output(0, sums_shape, &sums_tensor));
-        auto sums = sums_tensor->flat<T>();
-
-        ReduceSubarraysSumCPU(values.data(), values_shape.dim_size(0),
-                              (int64_t*)prefix_sum.data(),
-                              prefix_sum_shape.dim_size(0), sums.data());
+    explicit ReduceSubarraysSumOpKernelCPU(OpKernelConstruction* construction)
+        : ReduceSubarraysSumOpKernel(construction) {}
+
+    void Kernel(OpKernelContext* context,
+                const Tensor& values,
+                const Tensor& prefix_sum,
+                Tensor& sums) override {
+        ReduceSubarraysSumCPU(values.flat<T>().data(), values.dim_size(0),
+                              (int64_t*)prefix_sum.flat<int64>().data(),
+                              prefix_sum.dim_size(0), sums.flat<T>().data());
     }
-
-private:
 };
 
 #define REG_KB(type)                                            \
     REGISTER_KERNEL_BUILDER(Name("Open3DReduceSubarraysSum")    \
                                     .Device(DEVICE_CPU)         \
                                     .TypeConstraint<type>("T"), \
-                            ReduceSubarraysSumOp<type>);
+                            ReduceSubarraysSumOpKernelCPU<type>);
 REG_KB(int32_t)
 REG_KB(int64)
 REG_KB(float)
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/ML/Misc/Detail/VoxelPoolingCPU.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace open3d::ml::detail;
+using namespace tensorflow;
+
+namespace {
+
+AccumulationFn ParseAccumulationFn(const std::string& str) {
+    if (str == "nearest_neighbor") {
+        return AccumulationFn::NEAREST_NEIGHBOR;
+    } else if (str == "max") {
+        return AccumulationFn::MAX;
+    } else if (str == "center") {
+        return AccumulationFn::CENTER;
+    }
+    return AccumulationFn::AVERAGE;
+}
+
+template <class TReal, class TFeat>
+class OutputAllocator {
+public:
+    explicit OutputAllocator(OpKernelContext* context) : context(context) {}
+
+    void AllocPooledPositions(TReal** ptr, size_t num) {
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num), 3});
+        OP_REQUIRES_OK(context, context->allocate_output(0, shape, &tensor));
+        *ptr = tensor->flat<TReal>().data();
+    }
+
+    void AllocPooledFeatures(TFeat** ptr, size_t num, int channels) {
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({int64_t(num), channels});
+        OP_REQUIRES_OK(context, context->allocate_output(1, shape, &tensor));
+        *ptr = tensor->flat<TFeat>().data();
+    }
+
+private:
+    OpKernelContext* context;
+};
+
+}  // namespace
+
+template <class TReal, class TFeat>
+class VoxelPoolingOpKernelCPU : public OpKernel {
+public:
+    explicit VoxelPoolingOpKernelCPU(OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        std::string position_fn_str, feature_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("position_fn", &position_fn_str));
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("feature_fn", &feature_fn_str));
+        position_fn = ParseAccumulationFn(position_fn_str);
+        feature_fn = ParseAccumulationFn(feature_fn_str);
+    }
+
+    void Compute(OpKernelContext* context) override {
+        const Tensor& positions = context->input(0);
+        const Tensor& features = context->input(1);
+        const Tensor& voxel_size_tensor = context->input(2);
+        OP_REQUIRES(
+                context, positions.dims() == 2 && positions.dim_size(1) == 3,
+                errors::InvalidArgument("positions must have shape [N,3]"));
+        OP_REQUIRES(context,
+                    features.dims() == 2 &&
+                            features.dim_size(0) == positions.dim_size(0),
+                    errors::InvalidArgument("features must have shape [N,C]"));
+        OP_REQUIRES(context,
+                    TensorShapeUtils::IsScalar(voxel_size_tensor.shape()),
+                    errors::InvalidArgument("voxel_size must be a scalar"));
+        const TReal voxel_size = voxel_size_tensor.scalar<TReal>()();
+        OP_REQUIRES(context, voxel_size > 0,
+                    errors::InvalidArgument("voxel_size must be positive"));
+
+        OutputAllocator<TReal, TFeat> output_allocator(context);
+        VoxelPoolingCPU(positions.dim_size(0), positions.flat<TReal>().data(),
+                        features.dim_size(1), features.flat<TFeat>().data(),
+                        voxel_size, output_allocator, position_fn, feature_fn);
+    }
+
+private:
+    AccumulationFn position_fn;
+    AccumulationFn feature_fn;
+};
+
+#define REG_KB(type, typefeat)                                          \
+    REGISTER_KERNEL_BUILDER(Name("Open3DVoxelPooling")                  \
+                                    .Device(DEVICE_CPU)                 \
+                                    .TypeConstraint<type>("TReal")      \
+                                    .TypeConstraint<typefeat>("TFeat"), \
+                            VoxelPoolingOpKernelCPU<type, typefeat>);
+REG_KB(float, float)
+REG_KB(float, double)
+REG_KB(float, int32)
+REG_KB(float, int64)
+REG_KB(double, float)
+REG_KB(double, double)
+REG_KB(double, int32)
+REG_KB(double, int64)
+#undef REG_KB
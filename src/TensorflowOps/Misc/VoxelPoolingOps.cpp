@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace tensorflow;
+
+REGISTER_OP("Open3DVoxelPooling")
+        .Attr("TReal: {float, double}")
+        .Attr("TFeat: {float, double, int32, int64}")
+        .Attr("position_fn: {'average', 'nearest_neighbor', 'center'} = "
+              "'average'")
+        .Attr("feature_fn: {'average', 'nearest_neighbor', 'max'} = 'average'")
+        .Input("positions: TReal")
+        .Input("features: TFeat")
+        .Input("voxel_size: TReal")
+        .Output("pooled_positions: TReal")
+        .Output("pooled_features: TFeat")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            ShapeHandle positions_shape, features_shape, voxel_size_shape;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &positions_shape));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &features_shape));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 0, &voxel_size_shape));
+
+            DimensionHandle dim;
+            TF_RETURN_IF_ERROR(
+                    c->WithValue(c->Dim(positions_shape, 1), 3, &dim));
+            TF_RETURN_IF_ERROR(c->Merge(c->Dim(positions_shape, 0),
+                                        c->Dim(features_shape, 0), &dim));
+
+            // the number of voxels is only known at runtime
+            c->set_output(0, c->Matrix(c->UnknownDim(), 3));
+            c->set_output(1, c->Matrix(c->UnknownDim(),
+                                       c->Dim(features_shape, 1)));
+
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Pools points and their features into a regular voxel grid. There is one output
+point for each voxel that contains at least one input point.
+
+
+position_fn:
+  Defines how the new point positions are computed.
+  'average' computes the mean of the points in the voxel,
+  'nearest_neighbor' selects the point closest to the voxel center,
+  'center' uses the voxel center.
+
+feature_fn:
+  Defines how the pooled features are computed.
+  'average' computes the mean of the features in the voxel,
+  'nearest_neighbor' selects the feature of the point closest to the voxel
+  center, 'max' computes the per channel maximum.
+
+positions:
+  The 3D positions of the points with shape [N,3].
+
+features:
+  The features of the points with shape [N,C].
+
+voxel_size:
+  A scalar with the edge length of the voxels.
+
+pooled_positions:
+  The positions of the pooled points with shape [M,3].
+
+pooled_features:
+  The pooled features with shape [M,C].
+
+)doc");
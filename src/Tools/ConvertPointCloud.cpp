@@ -24,9 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
 #include <limits>
 
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
 #include "Open3D/Open3D.h"
+#include "Open3D/Utility/Parallel.h"
 
 void PrintHelp() {
     using namespace open3d;
@@ -35,11 +40,21 @@ void PrintHelp() {
     utility::LogInfo("Usage:");
     utility::LogInfo("    > ConvertPointCloud source_file target_file [options]");
     utility::LogInfo("    > ConvertPointCloud source_directory target_directory [options]");
+    utility::LogInfo("    > ConvertPointCloud file_list target_directory --file_list [options]");
     utility::LogInfo("      Read point cloud from source file and convert it to target file.");
+    utility::LogInfo("      Batch mode converts every file in source_directory, or every file");
+    utility::LogInfo("      listed in the text file file_list (one path per line), with a pool");
+    utility::LogInfo("      of workers, and reports the timing and throughput of each file.");
+    utility::LogInfo("      Conversions that at most clip and uniformly downsample stream the");
+    utility::LogInfo("      points in chunks, so files larger than the memory can be converted.");
     utility::LogInfo("");
     utility::LogInfo("Options (listed in the order of execution priority):");
     utility::LogInfo("    --help, -h                : Print help information.");
     utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --num_workers n           : Number of files converted in parallel in batch");
+    utility::LogInfo("                                mode. Default is the number of threads.");
+    utility::LogInfo("    --chunk_size n            : Number of points per chunk when streaming.");
+    utility::LogInfo("                                Default is 1048576.");
     utility::LogInfo("    --clip_x_min x0           : Clip points with x coordinate < x0.");
     utility::LogInfo("    --clip_x_max x1           : Clip points with x coordinate > x1.");
     utility::LogInfo("    --clip_y_min y0           : Clip points with y coordinate < y0.");
@@ -65,39 +80,81 @@ void PrintHelp() {
     // clang-format on
 }
 
-void convert(int argc,
-             char **argv,
-             const std::string &file_in,
-             const std::string &file_out) {
+
+struct ConvertStatistics {
+    size_t point_num_in = 0;
+    size_t point_num_out = 0;
+};
+
+/// Returns the size of \p filename in bytes, or 0 if it cannot be opened.
+size_t GetFileSize(const std::string &filename) {
+    FILE *file = open3d::utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size > 0 ? size_t(size) : 0;
+}
+
+/// Reads the --clip_* options. Returns false if none is given.
+bool GetClipBox(int argc,
+                char **argv,
+                open3d::geometry::AxisAlignedBoundingBox &clip_box) {
     using namespace open3d;
-    using namespace open3d::utility::filesystem;
-    auto pointcloud_ptr = io::CreatePointCloudFromFile(file_in.c_str());
+    if (!utility::ProgramOptionExistsAny(
+                argc, argv,
+                {"--clip_x_min", "--clip_x_max", "--clip_y_min", "--clip_y_max",
+                 "--clip_z_min", "--clip_z_max"})) {
+        return false;
+    }
+    Eigen::Vector3d min_bound, max_bound;
+    min_bound(0) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_x_min", std::numeric_limits<double>::lowest());
+    min_bound(1) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_y_min", std::numeric_limits<double>::lowest());
+    min_bound(2) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_z_min", std::numeric_limits<double>::lowest());
+    max_bound(0) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_x_max", std::numeric_limits<double>::max());
+    max_bound(1) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_y_max", std::numeric_limits<double>::max());
+    max_bound(2) = utility::GetProgramOptionAsDouble(
+            argc, argv, "--clip_z_max", std::numeric_limits<double>::max());
+    clip_box = geometry::AxisAlignedBoundingBox(min_bound, max_bound);
+    return true;
+}
+
+/// Returns true if the options only need one point at a time, i.e. the
+/// conversion can stream the file in chunks.
+bool IsStreamable(int argc, char **argv) {
+    using namespace open3d;
+    return !utility::ProgramOptionExistsAny(
+            argc, argv,
+            {"--filter_mahalanobis", "--voxel_sample", "--estimate_normals",
+             "--estimate_normals_knn", "--orient_normals",
+             "--camera_location"});
+}
+
+bool ConvertInMemory(int argc,
+                     char **argv,
+                     const std::string &file_in,
+                     const std::string &file_out,
+                     ConvertStatistics &statistics) {
+    using namespace open3d;
+    auto pointcloud_ptr = std::make_shared<geometry::PointCloud>();
+    if (!io::ReadPointCloud(file_in, *pointcloud_ptr)) {
+        utility::LogWarning("Failed to read {}.", file_in);
+        return false;
+    }
     size_t point_num_in = pointcloud_ptr->points_.size();
     bool processed = false;
 
     // clip
-    if (utility::ProgramOptionExistsAny(
-                argc, argv,
-                {"--clip_x_min", "--clip_x_max", "--clip_y_min", "--clip_y_max",
-                 "--clip_z_min", "--clip_z_max"})) {
-        Eigen::Vector3d min_bound, max_bound;
-        min_bound(0) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_x_min",
-                std::numeric_limits<double>::lowest());
-        min_bound(1) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_y_min",
-                std::numeric_limits<double>::lowest());
-        min_bound(2) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_z_min",
-                std::numeric_limits<double>::lowest());
-        max_bound(0) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_x_max", std::numeric_limits<double>::max());
-        max_bound(1) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_y_max", std::numeric_limits<double>::max());
-        max_bound(2) = utility::GetProgramOptionAsDouble(
-                argc, argv, "--clip_z_max", std::numeric_limits<double>::max());
-        pointcloud_ptr = pointcloud_ptr->Crop(
-                geometry::AxisAlignedBoundingBox(min_bound, max_bound));
+    geometry::AxisAlignedBoundingBox clip_box;
+    if (GetClipBox(argc, argv, clip_box)) {
+        pointcloud_ptr = pointcloud_ptr->Crop(clip_box);
         processed = true;
     }
 
@@ -184,7 +241,189 @@ void convert(int argc,
                 "Processed point cloud from {:d} points to {:d} points.",
                 (int)point_num_in, (int)point_num_out);
     }
-    io::WritePointCloud(file_out.c_str(), *pointcloud_ptr, {false, true});
+    statistics.point_num_in = point_num_in;
+    statistics.point_num_out = point_num_out;
+    if (!io::WritePointCloud(file_out, *pointcloud_ptr, {false, true})) {
+        utility::LogWarning("Failed to write {}.", file_out);
+        return false;
+    }
+    return true;
+}
+
+/// Converts \p file_in chunk by chunk. Returns false without creating
+/// \p file_out if either format cannot be streamed.
+bool ConvertStreaming(int argc,
+                      char **argv,
+                      const std::string &file_in,
+                      const std::string &file_out,
+                      ConvertStatistics &statistics,
+                      bool &streamed) {
+    using namespace open3d;
+    streamed = false;
+    auto reader = io::CreatePointCloudStreamReader(file_in);
+    if (!reader) {
+        return false;
+    }
+    auto writer = io::CreatePointCloudStreamWriter(
+            file_out, reader->HasNormals(), reader->HasColors(), {false, true});
+    if (!writer) {
+        return false;
+    }
+    streamed = true;
+
+    geometry::AxisAlignedBoundingBox clip_box;
+    bool clip = GetClipBox(argc, argv, clip_box);
+    int every_k = utility::GetProgramOptionAsInt(argc, argv,
+                                                 "--uniform_sample_every", 0);
+    int64_t chunk_size = utility::GetProgramOptionAsInt(
+            argc, argv, "--chunk_size", 1 << 20);
+    chunk_size = std::max(chunk_size, int64_t(1));
+
+    geometry::PointCloud chunk;
+    // Index of the next clipped point, for the uniform downsampling.
+    size_t point_index = 0;
+    while (true) {
+        int64_t num_read = reader->ReadChunk(chunk, chunk_size);
+        if (num_read < 0) {
+            utility::LogWarning("Failed to read {}.", file_in);
+            return false;
+        }
+        if (num_read == 0) {
+            break;
+        }
+        statistics.point_num_in += num_read;
+
+        std::shared_ptr<geometry::PointCloud> clipped;
+        const geometry::PointCloud *output = &chunk;
+        if (clip) {
+            clipped = chunk.Crop(clip_box);
+            output = clipped.get();
+        }
+        std::shared_ptr<geometry::PointCloud> sampled;
+        if (every_k > 1) {
+            std::vector<size_t> indices;
+            for (size_t i = 0; i < output->points_.size(); i++) {
+                if ((point_index + i) % every_k == 0) {
+                    indices.push_back(i);
+                }
+            }
+            point_index += output->points_.size();
+            sampled = output->SelectByIndex(indices);
+            output = sampled.get();
+        }
+        if (!output->IsEmpty() && !writer->WriteChunk(*output)) {
+            utility::LogWarning("Failed to write {}.", file_out);
+            return false;
+        }
+    }
+    statistics.point_num_out = writer->GetNumPointsWritten();
+    if (!writer->Close()) {
+        utility::LogWarning("Failed to write {}.", file_out);
+        return false;
+    }
+    return true;
+}
+
+/// Converts one file, streaming it if the options and formats allow it, and
+/// logs its timing and throughput.
+bool convert(int argc,
+             char **argv,
+             const std::string &file_in,
+             const std::string &file_out) {
+    using namespace open3d;
+    utility::Timer timer;
+    timer.Start();
+    ConvertStatistics statistics;
+    bool streamed = false;
+    bool success = false;
+    try {
+        if (IsStreamable(argc, argv)) {
+            success = ConvertStreaming(argc, argv, file_in, file_out,
+                                       statistics, streamed);
+        }
+        if (!streamed) {
+            success = ConvertInMemory(argc, argv, file_in, file_out,
+                                      statistics);
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Failed to convert {}: {}", file_in, e.what());
+        success = false;
+    }
+    timer.Stop();
+    if (success) {
+        double seconds = std::max(timer.GetDuration() / 1000.0, 1e-6);
+        double megabytes = GetFileSize(file_in) / (1024.0 * 1024.0);
+        utility::LogInfo(
+                "Converted {} ({:d} -> {:d} points) in {:.1f} ms, {:.2f} MB/s, "
+                "{:.2f} M points/s{}.",
+                file_in, statistics.point_num_in, statistics.point_num_out,
+                timer.GetDuration(), megabytes / seconds,
+                statistics.point_num_in / seconds / 1e6,
+                streamed ? ", streamed" : "");
+    }
+    return success;
+}
+
+/// Converts \p filenames into \p target_directory with a pool of workers.
+/// Returns the number of failed files.
+size_t ConvertBatch(int argc,
+                    char **argv,
+                    const std::vector<std::string> &filenames,
+                    const std::string &target_directory) {
+    using namespace open3d;
+    using namespace open3d::utility::filesystem;
+    MakeDirectoryHierarchy(target_directory);
+    int num_workers =
+            utility::GetProgramOptionAsInt(argc, argv, "--num_workers", 0);
+    if (num_workers > 0) {
+        utility::SetNumThreads(num_workers);
+    }
+    utility::LogInfo("Converting {:d} files with {:d} workers.",
+                     filenames.size(), utility::GetNumThreads());
+
+    utility::Timer timer;
+    timer.Start();
+    std::atomic<size_t> num_failed(0);
+    std::atomic<size_t> total_bytes(0);
+    // Each worker converts whole files, the loops inside a conversion run
+    // serially on the worker thread.
+    utility::ParallelFor(0, int64_t(filenames.size()), [&](int64_t i) {
+        const std::string &fn = filenames[i];
+        if (convert(argc, argv, fn,
+                    GetRegularizedDirectoryName(target_directory) +
+                            GetFileNameWithoutDirectory(fn))) {
+            total_bytes += GetFileSize(fn);
+        } else {
+            num_failed++;
+        }
+    });
+    timer.Stop();
+
+    double seconds = std::max(timer.GetDuration() / 1000.0, 1e-6);
+    utility::LogInfo(
+            "Converted {:d} of {:d} files in {:.2f} s, {:.2f} files/s, "
+            "{:.2f} MB/s.",
+            filenames.size() - num_failed, filenames.size(), seconds,
+            (filenames.size() - num_failed) / seconds,
+            total_bytes / (1024.0 * 1024.0) / seconds);
+    return num_failed;
+}
+
+/// Reads the source files from \p file_list, one path per line.
+bool ReadFileList(const std::string &file_list,
+                  std::vector<std::string> &filenames) {
+    std::ifstream file(file_list);
+    if (!file) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(line.find_last_not_of(" \t\r\n") + 1);
+        if (!line.empty()) {
+            filenames.push_back(line);
+        }
+    }
+    return true;
 }
 
 int main(int argc, char **argv) {
@@ -200,21 +439,20 @@ int main(int argc, char **argv) {
     int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
     utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
 
-    if (FileExists(argv[1])) {
-        convert(argc, argv, argv[1], argv[2]);
+    std::vector<std::string> filenames;
+    if (utility::ProgramOptionExists(argc, argv, "--file_list")) {
+        if (!ReadFileList(argv[1], filenames)) {
+            utility::LogWarning("Failed to read file list {}.", argv[1]);
+            return 1;
+        }
+    } else if (FileExists(argv[1])) {
+        return convert(argc, argv, argv[1], argv[2]) ? 0 : 1;
     } else if (DirectoryExists(argv[1])) {
-        MakeDirectoryHierarchy(argv[2]);
-        std::vector<std::string> filenames;
         ListFilesInDirectory(argv[1], filenames);
-        for (const auto &fn : filenames) {
-            convert(argc, argv, fn,
-                    GetRegularizedDirectoryName(argv[2]) +
-                            GetFileNameWithoutDirectory(fn));
-        }
     } else {
         utility::LogWarning("File or directory does not exist.");
         return 1;
     }
 
-    return 0;
+    return ConvertBatch(argc, argv, filenames, argv[2]) == 0 ? 0 : 1;
 }
@@ -24,7 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
+#include <numeric>
+
 #include "Open3D/Open3D.h"
+#include "Open3D/Utility/Parallel.h"
 
 void PrintHelp() {
     using namespace open3d;
@@ -37,11 +41,97 @@ void PrintHelp() {
     utility::LogInfo("Options (listed in the order of execution priority):");
     utility::LogInfo("    --help, -h                : Print help information.");
     utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --num_workers n           : Number of threads used to load and merge the");
+    utility::LogInfo("                                meshes. Default is the number of threads.");
+    utility::LogInfo("    --weld_distance d         : Merge vertices closer than d, e.g. along the");
+    utility::LogInfo("                                seams of tiles.");
     utility::LogInfo("    --purge                   : Clear duplicated and unreferenced vertices and");
     utility::LogInfo("                                triangles.");
     // clang-format on
 }
 
+/// Concatenates \p meshes into a mesh allocated once. As with
+/// TriangleMesh::operator+=, an attribute is kept if all non-empty meshes
+/// have it.
+std::shared_ptr<open3d::geometry::TriangleMesh> ConcatenateMeshes(
+        const std::vector<open3d::geometry::TriangleMesh> &meshes) {
+    using namespace open3d;
+    const int64_t num_meshes = int64_t(meshes.size());
+    std::vector<int64_t> vertex_offsets(num_meshes + 1, 0);
+    std::vector<int64_t> triangle_offsets(num_meshes + 1, 0);
+    bool has_vertex_normals = true;
+    bool has_vertex_colors = true;
+    bool has_triangle_normals = true;
+    bool has_textures = false;
+    for (int64_t i = 0; i < num_meshes; i++) {
+        const geometry::TriangleMesh &mesh = meshes[i];
+        vertex_offsets[i + 1] = vertex_offsets[i] + mesh.vertices_.size();
+        triangle_offsets[i + 1] = triangle_offsets[i] + mesh.triangles_.size();
+        if (mesh.IsEmpty()) {
+            continue;
+        }
+        has_vertex_normals &= mesh.HasVertexNormals();
+        has_vertex_colors &= mesh.HasVertexColors();
+        has_triangle_normals &= mesh.HasTriangleNormals();
+        has_textures |= mesh.HasTriangleUvs() || mesh.HasTextures() ||
+                        mesh.HasTriangleMaterialIds();
+    }
+    if (has_textures) {
+        utility::LogWarning(
+                "Texture coordinates, textures and material ids are not "
+                "merged.");
+    }
+
+    auto merged_mesh_ptr = std::make_shared<geometry::TriangleMesh>();
+    const int64_t num_vertices = vertex_offsets.back();
+    const int64_t num_triangles = triangle_offsets.back();
+    if (num_vertices == 0) {
+        return merged_mesh_ptr;
+    }
+    merged_mesh_ptr->vertices_.resize(num_vertices);
+    if (has_vertex_normals) {
+        merged_mesh_ptr->vertex_normals_.resize(num_vertices);
+    }
+    if (has_vertex_colors) {
+        merged_mesh_ptr->vertex_colors_.resize(num_vertices);
+    }
+    merged_mesh_ptr->triangles_.resize(num_triangles);
+    if (has_triangle_normals && num_triangles > 0) {
+        merged_mesh_ptr->triangle_normals_.resize(num_triangles);
+    }
+    utility::ParallelFor(0, num_meshes, [&](int64_t i) {
+        const geometry::TriangleMesh &mesh = meshes[i];
+        if (mesh.IsEmpty()) {
+            return;
+        }
+        std::copy(mesh.vertices_.begin(), mesh.vertices_.end(),
+                  merged_mesh_ptr->vertices_.begin() + vertex_offsets[i]);
+        if (has_vertex_normals) {
+            std::copy(mesh.vertex_normals_.begin(), mesh.vertex_normals_.end(),
+                      merged_mesh_ptr->vertex_normals_.begin() +
+                              vertex_offsets[i]);
+        }
+        if (has_vertex_colors) {
+            std::copy(mesh.vertex_colors_.begin(), mesh.vertex_colors_.end(),
+                      merged_mesh_ptr->vertex_colors_.begin() +
+                              vertex_offsets[i]);
+        }
+        if (has_triangle_normals && num_triangles > 0) {
+            std::copy(mesh.triangle_normals_.begin(),
+                      mesh.triangle_normals_.end(),
+                      merged_mesh_ptr->triangle_normals_.begin() +
+                              triangle_offsets[i]);
+        }
+        const Eigen::Vector3i index_shift =
+                Eigen::Vector3i::Constant(int(vertex_offsets[i]));
+        for (size_t t = 0; t < mesh.triangles_.size(); t++) {
+            merged_mesh_ptr->triangles_[triangle_offsets[i] + t] =
+                    mesh.triangles_[t] + index_shift;
+        }
+    });
+    return merged_mesh_ptr;
+}
+
 int main(int argc, char **argv) {
     using namespace open3d;
     using namespace open3d::utility::filesystem;
@@ -53,25 +143,49 @@ int main(int argc, char **argv) {
     }
     int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
     utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    int num_workers =
+            utility::GetProgramOptionAsInt(argc, argv, "--num_workers", 0);
+    if (num_workers > 0) {
+        utility::SetNumThreads(num_workers);
+    }
 
     std::string directory(argv[1]);
     std::vector<std::string> filenames;
     ListFilesInDirectory(directory, filenames);
 
-    auto merged_mesh_ptr = std::make_shared<geometry::TriangleMesh>();
-    for (const auto &filename : filenames) {
-        auto mesh_ptr = std::make_shared<geometry::TriangleMesh>();
-        if (io::ReadTriangleMesh(filename, *mesh_ptr)) {
-            *merged_mesh_ptr += *mesh_ptr;
+    utility::ScopeTimer timer("Merging meshes");
+    // Each file is loaded by one thread, the loops inside the reader run
+    // serially on it.
+    std::vector<geometry::TriangleMesh> meshes(filenames.size());
+    std::atomic<int> num_loaded(0);
+    utility::ParallelFor(0, int64_t(filenames.size()), [&](int64_t i) {
+        if (io::ReadTriangleMesh(filenames[i], meshes[i])) {
+            num_loaded++;
+        } else {
+            meshes[i].Clear();
         }
-    }
+    });
+    utility::LogInfo("Loaded {:d} of {:d} meshes.", int(num_loaded),
+                     int(filenames.size()));
 
+    auto merged_mesh_ptr = ConcatenateMeshes(meshes);
+    meshes.clear();
+    meshes.shrink_to_fit();
+
+    double weld_distance = utility::GetProgramOptionAsDouble(
+            argc, argv, "--weld_distance", 0.0);
+    if (weld_distance > 0.0) {
+        merged_mesh_ptr->MergeCloseVertices(weld_distance);
+    }
     if (utility::ProgramOptionExists(argc, argv, "--purge")) {
         merged_mesh_ptr->RemoveDuplicatedVertices();
         merged_mesh_ptr->RemoveDuplicatedTriangles();
         merged_mesh_ptr->RemoveUnreferencedVertices();
         merged_mesh_ptr->RemoveDegenerateTriangles();
     }
+    utility::LogInfo("Merged mesh has {:d} vertices and {:d} triangles.",
+                     int(merged_mesh_ptr->vertices_.size()),
+                     int(merged_mesh_ptr->triangles_.size()));
     io::WriteTriangleMesh(argv[2], *merged_mesh_ptr);
 
     return 1;
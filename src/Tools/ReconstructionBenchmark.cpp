@@ -0,0 +1,688 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+// windows.h must come first.
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "Open3D/Integration/TSDFIntegrationPipeline.h"
+#include "Open3D/Open3D.h"
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Profiler.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > ReconstructionBenchmark dataset_directory [options]");
+    utility::LogInfo("      Run the reconstruction system on an RGBD sequence and report the wall");
+    utility::LogInfo("      time, throughput and peak memory of its stages. The directory has a");
+    utility::LogInfo("      color (or image, or rgb) folder and a depth folder of aligned frames.");
+    utility::LogInfo("");
+    utility::LogInfo("Options:");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --num_threads n           : Number of threads. Default is the number of");
+    utility::LogInfo("                                hardware threads.");
+    utility::LogInfo("    --intrinsic file          : Camera intrinsic json. Default is PrimeSense.");
+    utility::LogInfo("    --max_frames n            : Only use the first n frames.");
+    utility::LogInfo("    --frames_per_fragment n   : Default is 100.");
+    utility::LogInfo("    --max_depth d             : Default is 3.0.");
+    utility::LogInfo("    --max_depth_diff d        : Default is 0.07.");
+    utility::LogInfo("    --voxel_size d            : Voxel size of the registration, default is");
+    utility::LogInfo("                                0.05.");
+    utility::LogInfo("    --tsdf_cubic_size d       : TSDF voxels are d / 512, default is 3.0.");
+    utility::LogInfo("    --report file             : Write the report as json.");
+    utility::LogInfo("    --trace file              : Write a Chrome trace of the profiler.");
+    utility::LogInfo("    --profile                 : Print the profiler summary.");
+    utility::LogInfo("    --output file             : Write the mesh of the scene.");
+    // clang-format on
+}
+
+using namespace open3d;
+
+/// Parameters of the reconstruction system, see
+/// examples/Python/ReconstructionSystem/initialize_config.py.
+struct ReconstructionConfig {
+    camera::PinholeCameraIntrinsic intrinsic_ = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    int frames_per_fragment_ = 100;
+    double max_depth_ = 3.0;
+    double max_depth_diff_ = 0.07;
+    double voxel_size_ = 0.05;
+    double tsdf_cubic_size_ = 3.0;
+    double preference_loop_closure_odometry_ = 0.1;
+    double preference_loop_closure_registration_ = 5.0;
+};
+
+/// Wall time and throughput of a stage.
+struct StageResult {
+    std::string name_;
+    double seconds_ = 0.0;
+    /// Number of items processed, e.g. frames.
+    double items_ = 0.0;
+    std::string item_unit_;
+    /// Voxels of the allocated volume units, for the integration stages.
+    double voxels_ = 0.0;
+};
+
+/// A fragment: its frames, their optimized poses and its point cloud.
+struct Fragment {
+    int first_frame_;
+    registration::PoseGraph pose_graph_;
+    std::shared_ptr<geometry::PointCloud> point_cloud_;
+};
+
+/// Peak resident memory of the process in megabytes.
+double GetPeakMemoryMB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                              sizeof(counters))) {
+        return 0.0;
+    }
+    return counters.PeakWorkingSetSize / 1048576.0;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0.0;
+    }
+#ifdef __APPLE__
+    // Bytes on macOS.
+    return usage.ru_maxrss / 1048576.0;
+#else
+    // Kilobytes on Linux.
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+/// Lists the color and depth images of the dataset as
+/// examples/Python/Utility/file.py does.
+bool GetRGBDFileLists(const std::string &dataset,
+                      std::vector<std::string> &color_files,
+                      std::vector<std::string> &depth_files) {
+    std::string color_directory;
+    for (const char *name : {"image", "rgb", "color"}) {
+        if (utility::filesystem::DirectoryExists(dataset + "/" + name)) {
+            color_directory = dataset + "/" + name;
+        }
+    }
+    if (color_directory.empty()) {
+        return false;
+    }
+    std::vector<std::string> png_files;
+    if (!utility::filesystem::ListFilesInDirectoryWithExtension(
+                color_directory, "jpg", color_files) ||
+        !utility::filesystem::ListFilesInDirectoryWithExtension(
+                color_directory, "png", png_files) ||
+        !utility::filesystem::ListFilesInDirectoryWithExtension(
+                dataset + "/depth", "png", depth_files)) {
+        return false;
+    }
+    std::sort(color_files.begin(), color_files.end());
+    std::sort(png_files.begin(), png_files.end());
+    std::sort(depth_files.begin(), depth_files.end());
+    color_files.insert(color_files.end(), png_files.begin(), png_files.end());
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> ReadRGBDImage(
+        const std::string &color_file,
+        const std::string &depth_file,
+        bool convert_rgb_to_intensity,
+        const ReconstructionConfig &config) {
+    geometry::Image color, depth;
+    if (!io::ReadImage(color_file, color) ||
+        !io::ReadImage(depth_file, depth)) {
+        utility::LogError("Failed to read {} or {}.", color_file, depth_file);
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            color, depth, 1000.0, config.max_depth_, convert_rgb_to_intensity);
+}
+
+int64_t GetNumVoxels(const integration::ScalableTSDFVolume &volume) {
+    const int64_t resolution = volume.volume_unit_resolution_;
+    return int64_t(volume.volume_units_.size()) * resolution * resolution *
+           resolution;
+}
+
+void OptimizePoseGraph(registration::PoseGraph &pose_graph,
+                       double max_correspondence_distance,
+                       double preference_loop_closure) {
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(
+                    max_correspondence_distance, 0.25, preference_loop_closure,
+                    0));
+}
+
+/// Appends the result of the pair (s, t) to the pose graph of the scene, as
+/// update_posegraph_for_scene of register_fragments.py.
+void UpdatePoseGraphForScene(int s,
+                             int t,
+                             const Eigen::Matrix4d &transformation,
+                             const Eigen::Matrix6d &information,
+                             Eigen::Matrix4d &odometry,
+                             registration::PoseGraph &pose_graph) {
+    if (t == s + 1) {
+        odometry = transformation * odometry;
+        pose_graph.nodes_.push_back(
+                registration::PoseGraphNode(odometry.inverse()));
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                s, t, transformation, information, false));
+    } else {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                s, t, transformation, information, true));
+    }
+}
+
+/// Integrates frames into a new volume with the pipeline, which loads the
+/// next frames while one is integrated.
+std::shared_ptr<integration::ScalableTSDFVolume> IntegrateFrames(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const std::vector<std::pair<int, Eigen::Matrix4d>> &frame_poses,
+        const ReconstructionConfig &config) {
+    auto volume = std::make_shared<integration::ScalableTSDFVolume>(
+            config.tsdf_cubic_size_ / 512.0, 0.04,
+            integration::TSDFVolumeColorType::RGB8);
+    integration::TSDFIntegrationPipeline pipeline(*volume);
+    for (const auto &frame_pose : frame_poses) {
+        const int i = frame_pose.first;
+        pipeline.Push(
+                [&, i]() {
+                    return ReadRGBDImage(color_files[i], depth_files[i], false,
+                                         config);
+                },
+                config.intrinsic_, frame_pose.second.inverse());
+    }
+    pipeline.Finish();
+    return volume;
+}
+
+/// Odometry, pose graph optimization and integration of every fragment, as
+/// make_fragments.py without OpenCV, i.e. without keyframe loop closures.
+std::vector<Fragment> MakeFragments(const std::vector<std::string> &color_files,
+                                    const std::vector<std::string> &depth_files,
+                                    const ReconstructionConfig &config,
+                                    std::vector<StageResult> &results) {
+    const int num_files = int(color_files.size());
+    const int num_fragments =
+            (num_files + config.frames_per_fragment_ - 1) /
+            config.frames_per_fragment_;
+    std::vector<Fragment> fragments(num_fragments);
+    StageResult odometry{"Odometry", 0.0, 0.0, "frame pairs"};
+    StageResult optimization{"Fragment optimization", 0.0, 0.0, "fragments"};
+    StageResult integration{"Fragment integration", 0.0, 0.0, "frames"};
+    odometry::OdometryOption option;
+    option.max_depth_diff_ = config.max_depth_diff_;
+    odometry::RGBDOdometryTracker tracker(config.intrinsic_, option);
+    utility::Timer timer;
+    for (int f = 0; f < num_fragments; f++) {
+        Fragment &fragment = fragments[f];
+        fragment.first_frame_ = f * config.frames_per_fragment_;
+        const int end_frame = std::min(
+                num_files, fragment.first_frame_ + config.frames_per_fragment_);
+
+        timer.Start();
+        {
+            utility::ProfilerScope scope("ReconstructionBenchmark::Odometry");
+            Eigen::Matrix4d trans_odometry = Eigen::Matrix4d::Identity();
+            fragment.pose_graph_.nodes_.push_back(
+                    registration::PoseGraphNode(trans_odometry));
+            tracker.Reset();
+            for (int i = fragment.first_frame_; i < end_frame; i++) {
+                auto image = ReadRGBDImage(color_files[i], depth_files[i],
+                                           true, config);
+                bool success;
+                Eigen::Matrix4d trans;
+                Eigen::Matrix6d info;
+                std::tie(success, trans, info) = tracker.Track(*image);
+                if (i == fragment.first_frame_) {
+                    continue;
+                }
+                const int s = i - 1 - fragment.first_frame_;
+                trans_odometry = trans * trans_odometry;
+                fragment.pose_graph_.nodes_.push_back(
+                        registration::PoseGraphNode(trans_odometry.inverse()));
+                fragment.pose_graph_.edges_.push_back(
+                        registration::PoseGraphEdge(s, s + 1, trans, info,
+                                                    false));
+                scope.AddItems(1);
+                odometry.items_ += 1;
+            }
+        }
+        timer.Stop();
+        odometry.seconds_ += timer.GetDuration() / 1000.0;
+
+        timer.Start();
+        {
+            OPEN3D_PROFILE_SCOPE(
+                    "ReconstructionBenchmark::FragmentOptimization");
+            OptimizePoseGraph(fragment.pose_graph_, config.max_depth_diff_,
+                              config.preference_loop_closure_odometry_);
+        }
+        timer.Stop();
+        optimization.seconds_ += timer.GetDuration() / 1000.0;
+        optimization.items_ += 1;
+
+        timer.Start();
+        {
+            utility::ProfilerScope scope(
+                    "ReconstructionBenchmark::FragmentIntegration");
+            std::vector<std::pair<int, Eigen::Matrix4d>> frame_poses;
+            for (size_t i = 0; i < fragment.pose_graph_.nodes_.size(); i++) {
+                frame_poses.emplace_back(fragment.first_frame_ + int(i),
+                                         fragment.pose_graph_.nodes_[i].pose_);
+            }
+            auto volume = IntegrateFrames(color_files, depth_files,
+                                          frame_poses, config);
+            auto mesh = volume->ExtractTriangleMesh();
+            fragment.point_cloud_ = std::make_shared<geometry::PointCloud>();
+            fragment.point_cloud_->points_ = std::move(mesh->vertices_);
+            fragment.point_cloud_->colors_ = std::move(mesh->vertex_colors_);
+            scope.AddItems(int64_t(frame_poses.size()));
+            integration.items_ += double(frame_poses.size());
+            integration.voxels_ += double(GetNumVoxels(*volume));
+        }
+        timer.Stop();
+        integration.seconds_ += timer.GetDuration() / 1000.0;
+        utility::LogInfo("Fragment {:d} / {:d}: {:d} points.", f + 1,
+                         num_fragments,
+                         fragment.point_cloud_->points_.size());
+        utility::RecordProfilerCounter("PeakMemoryMB", GetPeakMemoryMB());
+    }
+    results.push_back(odometry);
+    results.push_back(optimization);
+    results.push_back(integration);
+    return fragments;
+}
+
+/// Registers all pairs of fragments and optimizes the pose graph of the
+/// scene, as register_fragments.py with RANSAC.
+registration::PoseGraph RegisterFragments(
+        const std::vector<Fragment> &fragments,
+        const ReconstructionConfig &config,
+        std::vector<StageResult> &results) {
+    const int num_fragments = int(fragments.size());
+    const double voxel_size = config.voxel_size_;
+    StageResult preprocessing{"Fragment preprocessing", 0.0, 0.0,
+                              "fragments"};
+    StageResult registration{"Fragment registration", 0.0, 0.0, "pairs"};
+    StageResult optimization{"Scene optimization", 0.0, 0.0, "graphs"};
+    utility::Timer timer;
+
+    timer.Start();
+    std::vector<std::shared_ptr<geometry::PointCloud>> downsampled(
+            num_fragments);
+    std::vector<std::shared_ptr<registration::Feature>> features(
+            num_fragments);
+    {
+        OPEN3D_PROFILE_SCOPE("ReconstructionBenchmark::FragmentPreprocessing");
+        for (int f = 0; f < num_fragments; f++) {
+            downsampled[f] = fragments[f].point_cloud_->VoxelDownSample(
+                    voxel_size);
+            downsampled[f]->EstimateNormals(
+                    geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+            features[f] = registration::ComputeFPFHFeature(
+                    *downsampled[f], geometry::KDTreeSearchParamHybrid(
+                                             voxel_size * 5.0, 100));
+        }
+    }
+    timer.Stop();
+    preprocessing.seconds_ = timer.GetDuration() / 1000.0;
+    preprocessing.items_ = num_fragments;
+
+    timer.Start();
+    std::vector<registration::RegistrationPair> pairs;
+    for (int s = 0; s < num_fragments; s++) {
+        for (int t = s + 1; t < num_fragments; t++) {
+            if (t == s + 1) {
+                // The last frame of s is the first frame of t.
+                const Eigen::Matrix4d init =
+                        fragments[s].pose_graph_.nodes_.back().pose_;
+                pairs.emplace_back(s, t, Eigen::Matrix4d(init.inverse()));
+            } else {
+                pairs.emplace_back(s, t);
+            }
+        }
+    }
+    std::vector<registration::PairwiseRegistrationResult> pair_results;
+    {
+        utility::ProfilerScope scope(
+                "ReconstructionBenchmark::FragmentRegistration");
+        pair_results = registration::RegistrationPairwise(
+                downsampled, features, pairs,
+                registration::PairwiseRegistrationOption(voxel_size * 1.4));
+        scope.AddItems(int64_t(pairs.size()));
+    }
+    timer.Stop();
+    registration.seconds_ = timer.GetDuration() / 1000.0;
+    registration.items_ = double(pairs.size());
+
+    timer.Start();
+    registration::PoseGraph pose_graph;
+    {
+        OPEN3D_PROFILE_SCOPE("ReconstructionBenchmark::SceneOptimization");
+        Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+        for (size_t i = 0; i < pairs.size(); i++) {
+            if (pair_results[i].success_) {
+                UpdatePoseGraphForScene(pairs[i].source_id_,
+                                        pairs[i].target_id_,
+                                        pair_results[i].transformation_,
+                                        pair_results[i].information_,
+                                        odometry, pose_graph);
+            }
+        }
+        OptimizePoseGraph(pose_graph, voxel_size * 1.4,
+                          config.preference_loop_closure_registration_);
+    }
+    timer.Stop();
+    optimization.seconds_ = timer.GetDuration() / 1000.0;
+    optimization.items_ = 1;
+    utility::RecordProfilerCounter("PeakMemoryMB", GetPeakMemoryMB());
+
+    results.push_back(preprocessing);
+    results.push_back(registration);
+    results.push_back(optimization);
+    return pose_graph;
+}
+
+/// Refines the edges of the pose graph of the scene with multi-scale
+/// point-to-plane ICP and optimizes it again, as refine_registration.py with
+/// the point_to_plane method.
+registration::PoseGraph RefineRegistration(
+        const std::vector<Fragment> &fragments,
+        const registration::PoseGraph &scene_pose_graph,
+        const ReconstructionConfig &config,
+        std::vector<StageResult> &results) {
+    const double voxel_size = config.voxel_size_;
+    const std::vector<double> voxel_sizes = {voxel_size, voxel_size / 2.0,
+                                             voxel_size / 4.0};
+    const std::vector<double> distances(3, voxel_size * 1.4);
+    const std::vector<registration::ICPConvergenceCriteria> criteria = {
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 50),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 30),
+            registration::ICPConvergenceCriteria(1e-6, 1e-6, 14)};
+    StageResult refinement{"Refinement", 0.0, 0.0, "pairs"};
+    StageResult optimization{"Refined scene optimization", 0.0, 0.0,
+                             "graphs"};
+    utility::Timer timer;
+
+    timer.Start();
+    const size_t num_edges = scene_pose_graph.edges_.size();
+    std::vector<Eigen::Matrix4d> transformations(num_edges);
+    std::vector<Eigen::Matrix6d> informations(num_edges);
+    {
+        utility::ProfilerScope scope("ReconstructionBenchmark::Refinement");
+        for (size_t i = 0; i < num_edges; i++) {
+            const registration::PoseGraphEdge &edge =
+                    scene_pose_graph.edges_[i];
+            const geometry::PointCloud &source =
+                    *fragments[edge.source_node_id_].point_cloud_;
+            const geometry::PointCloud &target =
+                    *fragments[edge.target_node_id_].point_cloud_;
+            auto result = std::get<0>(registration::RegistrationMultiScaleICP(
+                    source, target, voxel_sizes, distances, criteria,
+                    edge.transformation_,
+                    registration::TransformationEstimationPointToPlane()));
+            transformations[i] = result.transformation_;
+            informations[i] = registration::GetInformationMatrixFromPointClouds(
+                    *source.VoxelDownSample(voxel_sizes.back()),
+                    *target.VoxelDownSample(voxel_sizes.back()),
+                    voxel_sizes.back() * 1.4, transformations[i]);
+        }
+        scope.AddItems(int64_t(num_edges));
+    }
+    timer.Stop();
+    refinement.seconds_ = timer.GetDuration() / 1000.0;
+    refinement.items_ = double(num_edges);
+
+    timer.Start();
+    registration::PoseGraph pose_graph;
+    {
+        OPEN3D_PROFILE_SCOPE(
+                "ReconstructionBenchmark::RefinedSceneOptimization");
+        Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+        for (size_t i = 0; i < num_edges; i++) {
+            UpdatePoseGraphForScene(scene_pose_graph.edges_[i].source_node_id_,
+                                    scene_pose_graph.edges_[i].target_node_id_,
+                                    transformations[i], informations[i],
+                                    odometry, pose_graph);
+        }
+        OptimizePoseGraph(pose_graph, voxel_size * 1.4,
+                          config.preference_loop_closure_registration_);
+    }
+    timer.Stop();
+    optimization.seconds_ = timer.GetDuration() / 1000.0;
+    optimization.items_ = 1;
+    utility::RecordProfilerCounter("PeakMemoryMB", GetPeakMemoryMB());
+
+    results.push_back(refinement);
+    results.push_back(optimization);
+    return pose_graph;
+}
+
+/// Integrates all frames with their poses in the scene, as
+/// integrate_scene.py.
+std::shared_ptr<geometry::TriangleMesh> IntegrateScene(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const std::vector<Fragment> &fragments,
+        const registration::PoseGraph &scene_pose_graph,
+        const ReconstructionConfig &config,
+        std::vector<StageResult> &results) {
+    StageResult integration{"Scene integration", 0.0, 0.0, "frames"};
+    utility::Timer timer;
+    timer.Start();
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    {
+        utility::ProfilerScope scope(
+                "ReconstructionBenchmark::SceneIntegration");
+        std::vector<std::pair<int, Eigen::Matrix4d>> frame_poses;
+        const size_t num_fragments =
+                std::min(fragments.size(), scene_pose_graph.nodes_.size());
+        for (size_t f = 0; f < num_fragments; f++) {
+            const registration::PoseGraph &fragment_pose_graph =
+                    fragments[f].pose_graph_;
+            for (size_t i = 0; i < fragment_pose_graph.nodes_.size(); i++) {
+                frame_poses.emplace_back(
+                        fragments[f].first_frame_ + int(i),
+                        scene_pose_graph.nodes_[f].pose_ *
+                                fragment_pose_graph.nodes_[i].pose_);
+            }
+        }
+        auto volume =
+                IntegrateFrames(color_files, depth_files, frame_poses, config);
+        mesh = volume->ExtractTriangleMesh();
+        scope.AddItems(int64_t(frame_poses.size()));
+        integration.items_ = double(frame_poses.size());
+        integration.voxels_ = double(GetNumVoxels(*volume));
+    }
+    timer.Stop();
+    integration.seconds_ = timer.GetDuration() / 1000.0;
+    utility::RecordProfilerCounter("PeakMemoryMB", GetPeakMemoryMB());
+    results.push_back(integration);
+    return mesh;
+}
+
+void PrintReport(const std::vector<StageResult> &results,
+                 double total_seconds,
+                 double peak_memory_mb) {
+    utility::LogInfo("{:<28} {:>10} {:>27} {:>12}", "Stage", "Time (s)",
+                     "Throughput", "Voxels/s");
+    for (const StageResult &result : results) {
+        const double seconds = std::max(result.seconds_, 1e-9);
+        utility::LogInfo("{:<28} {:>10.3f} {:>12.2f} {:<14} {:>12}",
+                         result.name_, result.seconds_,
+                         result.items_ / seconds, result.item_unit_ + "/s",
+                         result.voxels_ > 0.0
+                                 ? fmt::format("{:.3g}",
+                                               result.voxels_ / seconds)
+                                 : std::string("-"));
+    }
+    utility::LogInfo("{:<28} {:>10.3f}", "Total", total_seconds);
+    utility::LogInfo("Peak memory: {:.1f} MB", peak_memory_mb);
+}
+
+bool WriteReport(const std::string &filename,
+                 const std::vector<StageResult> &results,
+                 double total_seconds,
+                 double peak_memory_mb,
+                 int num_frames,
+                 int num_fragments) {
+    std::ofstream file(filename);
+    if (!file) {
+        return false;
+    }
+    file << fmt::format(
+            "{{\n  \"num_frames\": {},\n  \"num_fragments\": {},\n  "
+            "\"num_threads\": {},\n  \"total_seconds\": {},\n  "
+            "\"peak_memory_mb\": {},\n  \"stages\": [",
+            num_frames, num_fragments, utility::GetNumThreads(),
+            total_seconds, peak_memory_mb);
+    for (size_t i = 0; i < results.size(); i++) {
+        const StageResult &result = results[i];
+        file << fmt::format(
+                "{}\n    {{\"name\": \"{}\", \"seconds\": {}, \"items\": {}, "
+                "\"item_unit\": \"{}\", \"voxels\": {}}}",
+                i == 0 ? "" : ",", result.name_, result.seconds_,
+                result.items_, result.item_unit_, result.voxels_);
+    }
+    file << "\n  ]\n}\n";
+    return bool(file);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 ||
+        utility::ProgramOptionExistsAny(argc, argv, {"-h", "--help"})) {
+        PrintHelp();
+        return 0;
+    }
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    int num_threads =
+            utility::GetProgramOptionAsInt(argc, argv, "--num_threads", 0);
+    if (num_threads > 0) {
+        utility::SetNumThreads(num_threads);
+    }
+
+    ReconstructionConfig config;
+    std::string intrinsic_file =
+            utility::GetProgramOptionAsString(argc, argv, "--intrinsic");
+    if (!intrinsic_file.empty() &&
+        !io::ReadIJsonConvertible(intrinsic_file, config.intrinsic_)) {
+        utility::LogWarning("Failed to read intrinsic {}.", intrinsic_file);
+        return 1;
+    }
+    config.frames_per_fragment_ = std::max(
+            1, utility::GetProgramOptionAsInt(argc, argv,
+                                              "--frames_per_fragment",
+                                              config.frames_per_fragment_));
+    config.max_depth_ = utility::GetProgramOptionAsDouble(
+            argc, argv, "--max_depth", config.max_depth_);
+    config.max_depth_diff_ = utility::GetProgramOptionAsDouble(
+            argc, argv, "--max_depth_diff", config.max_depth_diff_);
+    config.voxel_size_ = utility::GetProgramOptionAsDouble(
+            argc, argv, "--voxel_size", config.voxel_size_);
+    config.tsdf_cubic_size_ = utility::GetProgramOptionAsDouble(
+            argc, argv, "--tsdf_cubic_size", config.tsdf_cubic_size_);
+
+    std::vector<std::string> color_files, depth_files;
+    if (!GetRGBDFileLists(argv[1], color_files, depth_files) ||
+        color_files.size() != depth_files.size() || color_files.empty()) {
+        utility::LogWarning(
+                "{} needs color and depth folders with as many images.",
+                argv[1]);
+        return 1;
+    }
+    int max_frames = utility::GetProgramOptionAsInt(argc, argv, "--max_frames",
+                                                    int(color_files.size()));
+    if (max_frames > 0 && max_frames < int(color_files.size())) {
+        color_files.resize(max_frames);
+        depth_files.resize(max_frames);
+    }
+
+    std::string trace_file =
+            utility::GetProgramOptionAsString(argc, argv, "--trace");
+    bool profile = utility::ProgramOptionExists(argc, argv, "--profile");
+    utility::SetProfilerEnabled(profile || !trace_file.empty());
+
+    utility::LogInfo("Reconstructing {:d} frames with {:d} threads.",
+                     color_files.size(), utility::GetNumThreads());
+    std::vector<StageResult> results;
+    utility::Timer total_timer;
+    total_timer.Start();
+    std::vector<Fragment> fragments =
+            MakeFragments(color_files, depth_files, config, results);
+    registration::PoseGraph scene_pose_graph =
+            RegisterFragments(fragments, config, results);
+    scene_pose_graph =
+            RefineRegistration(fragments, scene_pose_graph, config, results);
+    auto mesh = IntegrateScene(color_files, depth_files, fragments,
+                               scene_pose_graph, config, results);
+    total_timer.Stop();
+    const double total_seconds = total_timer.GetDuration() / 1000.0;
+    const double peak_memory_mb = GetPeakMemoryMB();
+
+    utility::LogInfo("Scene mesh has {:d} vertices and {:d} triangles.",
+                     mesh->vertices_.size(), mesh->triangles_.size());
+    PrintReport(results, total_seconds, peak_memory_mb);
+
+    std::string report_file =
+            utility::GetProgramOptionAsString(argc, argv, "--report");
+    if (!report_file.empty() &&
+        !WriteReport(report_file, results, total_seconds, peak_memory_mb,
+                     int(color_files.size()), int(fragments.size()))) {
+        utility::LogWarning("Failed to write {}.", report_file);
+    }
+    if (profile) {
+        utility::LogInfo("{}", utility::GetProfilerSummary());
+    }
+    if (!trace_file.empty() && !utility::WriteProfilerChromeTrace(trace_file)) {
+        utility::LogWarning("Failed to write {}.", trace_file);
+    }
+    std::string output_file =
+            utility::GetProgramOptionAsString(argc, argv, "--output");
+    if (!output_file.empty()) {
+        io::WriteTriangleMesh(output_file, *mesh);
+    }
+    return 0;
+}
@@ -253,5 +253,42 @@ TEST(PinholeCameraIntrinsic, ConvertToFromJsonValue) {
     ExpectEQ(reference, dst.intrinsic_matrix_);
 }
 
+TEST(PinholeCameraIntrinsic, ConvertToFromJsonValueDistortion) {
+    camera::PinholeCameraIntrinsic src(640, 480, 525.0, 520.0, 319.5, 239.5);
+    camera::PinholeCameraIntrinsic dst;
+
+    Json::Value value;
+    EXPECT_TRUE(src.ConvertToJsonValue(value));
+    EXPECT_TRUE(value["distortion_coeffs"].isNull());
+
+    src.SetDistortion(0.1, -0.2, 0.001, -0.002, 0.05);
+    EXPECT_TRUE(src.HasDistortion());
+    EXPECT_TRUE(src.ConvertToJsonValue(value));
+    EXPECT_TRUE(dst.ConvertFromJsonValue(value));
+    ExpectEQ(src.distortion_coeffs_, dst.distortion_coeffs_);
+
+    // Reading an intrinsic without distortion resets it.
+    value.removeMember("distortion_coeffs");
+    EXPECT_TRUE(dst.ConvertFromJsonValue(value));
+    EXPECT_FALSE(dst.HasDistortion());
+}
+
+TEST(PinholeCameraIntrinsic, DistortNormalizedPoint) {
+    camera::PinholeCameraIntrinsic intrinsic(640, 480, 525.0, 520.0, 319.5,
+                                             239.5);
+    const Eigen::Vector2d xy(0.3, -0.2);
+    ExpectEQ(xy, intrinsic.DistortNormalizedPoint(xy));
+
+    intrinsic.SetDistortion(0.1, -0.2, 0.001, -0.002, 0.05);
+    const double r2 = 0.3 * 0.3 + 0.2 * 0.2;
+    const double radial = 1.0 + 0.1 * r2 - 0.2 * r2 * r2 + 0.05 * r2 * r2 * r2;
+    const Eigen::Vector2d reference(
+            0.3 * radial + 2.0 * 0.001 * 0.3 * -0.2 -
+                    0.002 * (r2 + 2.0 * 0.3 * 0.3),
+            -0.2 * radial + 0.001 * (r2 + 2.0 * 0.2 * 0.2) -
+                    2.0 * 0.002 * 0.3 * -0.2);
+    ExpectEQ(reference, intrinsic.DistortNormalizedPoint(xy));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -24,7 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/ColorMap/ColorMapOptimization.h"
+#include "Open3D/ColorMap/TriangleMeshAndImageUtilities.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -227,6 +231,174 @@ TEST(ColorMapOptimization, DISABLED_MakeVertexAndImageVisibility) {
         EXPECT_EQ(ref_second[0][i], second[0][i]);
 }
 
+TEST(ColorMapOptimization, CreateVertexAndImageVisibility) {
+    const int width = 64;
+    const int height = 48;
+    const int n_camera = 3;
+    const double maximum_allowable_depth = 2.5;
+    const double depth_threshold = 0.1;
+
+    // Vertices at the pixel centers of the first camera, in more than one
+    // block of vertices, every third one behind the observed depth.
+    geometry::TriangleMesh mesh;
+    const int n_vertex = 70000;
+    for (int i = 0; i < n_vertex; i++) {
+        const double z = i % 3 == 0 ? 1.5 : 1.0 + (i % 7) * 0.01;
+        const double u = i % width;
+        const double v = (i / width) % height;
+        mesh.vertices_.push_back(Eigen::Vector3d((u - 31.5) * z / 50.0,
+                                                 (v - 23.5) * z / 50.0, z));
+    }
+
+    camera::PinholeCameraTrajectory camera;
+    camera.parameters_.resize(n_camera);
+    std::vector<std::shared_ptr<geometry::Image>> images_depth;
+    std::vector<std::shared_ptr<geometry::Image>> images_mask;
+    for (int c = 0; c < n_camera; c++) {
+        camera.parameters_[c].intrinsic_.SetIntrinsics(width, height, 50.0,
+                                                       50.0, 31.5, 23.5);
+        camera.parameters_[c].extrinsic_.setIdentity();
+        camera.parameters_[c].extrinsic_(0, 3) = 0.1 * c;
+        auto depth = std::make_shared<geometry::Image>();
+        depth->Prepare(width, height, 1, 4);
+        auto mask = std::make_shared<geometry::Image>();
+        mask->Prepare(width, height, 1, 1);
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                *depth->PointerAt<float>(u, v) = u < 8 * (c + 1) ? 3.0f : 1.0f;
+                *mask->PointerAt<uint8_t>(u, v) = v == c ? 255 : 0;
+            }
+        }
+        images_depth.push_back(depth);
+        images_mask.push_back(mask);
+    }
+
+    color_map::VertexAndImageVisibility visibility =
+            color_map::CreateVertexAndImageVisibility(
+                    mesh, images_depth, images_mask, camera,
+                    maximum_allowable_depth, depth_threshold);
+    ASSERT_EQ(size_t(n_camera), visibility.NumImages());
+    ASSERT_EQ(size_t(n_vertex), visibility.NumVertices());
+    std::vector<std::vector<int>> vertex_to_image(n_vertex);
+    for (int i = 0; i < n_vertex; i++) {
+        vertex_to_image[i].assign(
+                visibility.VertexImages(i),
+                visibility.VertexImages(i) + visibility.NumVertexImages(i));
+    }
+    std::vector<std::vector<int>> image_to_vertex(n_camera);
+    for (int c = 0; c < n_camera; c++) {
+        image_to_vertex[c].assign(
+                visibility.ImageVertices(c),
+                visibility.ImageVertices(c) + visibility.NumImageVertices(c));
+    }
+
+    std::vector<std::vector<int>> ref_vertex_to_image(n_vertex);
+    std::vector<std::vector<int>> ref_image_to_vertex(n_camera);
+    for (int c = 0; c < n_camera; c++) {
+        for (int i = 0; i < n_vertex; i++) {
+            Eigen::Vector3d X = mesh.vertices_[i];
+            X(0) += 0.1 * c;
+            const int u = int(std::round(X(0) / X(2) * 50.0 + 31.5));
+            const int v = int(std::round(X(1) / X(2) * 50.0 + 23.5));
+            if (u < 0 || u >= width || v < 0 || v >= height) {
+                continue;
+            }
+            const float d = *images_depth[c]->PointerAt<float>(u, v);
+            if (d > maximum_allowable_depth ||
+                *images_mask[c]->PointerAt<uint8_t>(u, v) == 255 ||
+                std::fabs(X(2) - d) >= depth_threshold) {
+                continue;
+            }
+            ref_image_to_vertex[c].push_back(i);
+            ref_vertex_to_image[i].push_back(c);
+        }
+        EXPECT_GT(ref_image_to_vertex[c].size(), 0u);
+    }
+    EXPECT_EQ(ref_image_to_vertex, image_to_vertex);
+    EXPECT_EQ(ref_vertex_to_image, vertex_to_image);
+}
+
+TEST(ColorMapOptimization, ColorMapOptimizationWithImageLoader) {
+    const int width = 64;
+    const int height = 48;
+    const int n_camera = 3;
+
+    // Vertices at the pixel centers of the first camera, on a plane at depth 1
+    // seen by all cameras.
+    geometry::TriangleMesh mesh;
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            mesh.vertices_.push_back(
+                    Eigen::Vector3d((u - 31.5) / 50.0, (v - 23.5) / 50.0, 1.0));
+        }
+    }
+
+    camera::PinholeCameraTrajectory camera;
+    camera.parameters_.resize(n_camera);
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_rgbd;
+    for (int c = 0; c < n_camera; c++) {
+        camera.parameters_[c].intrinsic_.SetIntrinsics(width, height, 50.0,
+                                                       50.0, 31.5, 23.5);
+        camera.parameters_[c].extrinsic_.setIdentity();
+        camera.parameters_[c].extrinsic_(0, 3) = 0.1 * c;
+        auto image = std::make_shared<geometry::RGBDImage>();
+        image->depth_.Prepare(width, height, 1, 4);
+        image->color_.Prepare(width, height, 3, 1);
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                *image->depth_.PointerAt<float>(u, v) = 1.0f;
+            }
+        }
+        for (size_t i = 0; i < image->color_.data_.size(); i++) {
+            image->color_.data_[i] = uint8_t(i * 7 + c * 31);
+        }
+        images_rgbd.push_back(image);
+    }
+
+    // Without iterations, the colors are the averages of the cameras.
+    color_map::ColorMapOptimizationOption option;
+    option.maximum_iteration_ = 0;
+    option.image_boundary_margin_ = 2;
+    option.invisible_vertex_color_knn_ = 0;
+    std::vector<int> n_load(n_camera, 0);
+    color_map::ColorMapOptimization(
+            mesh,
+            [&](int i) {
+                n_load[i]++;
+                return images_rgbd[i];
+            },
+            camera, option);
+    // Once for the gradient images and visibility, once for the colors.
+    EXPECT_EQ(std::vector<int>(n_camera, 2), n_load);
+
+    ASSERT_EQ(mesh.vertices_.size(), mesh.vertex_colors_.size());
+    int n_colored = 0;
+    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+        Eigen::Vector3d color = Eigen::Vector3d::Zero();
+        int n_valid = 0;
+        for (int c = 0; c < n_camera; c++) {
+            const Eigen::Vector3d& X = mesh.vertices_[i];
+            const double u = (X(0) + 0.1 * c) / X(2) * 50.0 + 31.5;
+            const double v = X(1) / X(2) * 50.0 + 23.5;
+            // Visible and inside of the image boundary margin.
+            if (u < 2 || u >= width - 2 || v < 2 || v >= height - 2) {
+                continue;
+            }
+            const uint8_t* pc = images_rgbd[c]->color_.PointerAt<uint8_t>(
+                    int(std::round(u)), int(std::round(v)), 0);
+            color += Eigen::Vector3d(pc[0], pc[1], pc[2]) / 255.0;
+            n_valid++;
+        }
+        if (n_valid > 0) {
+            ExpectEQ(Eigen::Vector3d(color / n_valid), mesh.vertex_colors_[i]);
+            n_colored++;
+        } else {
+            ExpectEQ(Eigen::Vector3d(0.0, 0.0, 0.0), mesh.vertex_colors_[i]);
+        }
+    }
+    EXPECT_GT(n_colored, 0);
+}
+
 TEST(ColorMapOptimization, DISABLED_MakeWarpingFields) {
     // int ref_anchor_w = 4;
     // int ref_anchor_h = 4;
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "Open3D/ColorMap/EigenHelperForNonRigidOptimization.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(EigenHelperForNonRigidOptimization, ComputeSparseJTJandJTrNonRigid) {
+    const int anchor_w = 5;
+    const int anchor_h = 4;
+    const int nonrigidval = anchor_w * anchor_h * 2;
+    const int num_rows = 500;
+
+    // Rows in the layout of ComputeJacobianAndResidualNonRigid, every fifth
+    // row of a vertex outside of the image.
+    auto f = [&](int i, Eigen::Vector14d& J_r, double& r,
+                 Eigen::Vector14i& pattern) {
+        J_r.setZero();
+        pattern.setZero();
+        r = 0.0;
+        if (i % 5 == 0) {
+            return;
+        }
+        for (int k = 0; k < 14; k++) {
+            J_r(k) = std::sin(0.37 * i + 1.3 * k);
+        }
+        r = std::cos(0.11 * i);
+        const int ii = (i * 7) % (anchor_w - 1);
+        const int jj = (i / 3) % (anchor_h - 1);
+        for (int k = 0; k < 6; k++) {
+            pattern(k) = k;
+        }
+        const int anchors[4] = {ii + jj * anchor_w, ii + (jj + 1) * anchor_w,
+                                ii + 1 + jj * anchor_w,
+                                ii + 1 + (jj + 1) * anchor_w};
+        for (int a = 0; a < 4; a++) {
+            pattern(6 + a * 2) = 6 + anchors[a] * 2;
+            pattern(6 + a * 2 + 1) = 6 + anchors[a] * 2 + 1;
+        }
+    };
+
+    Eigen::MatrixXd JTJ;
+    Eigen::VectorXd JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            color_map::ComputeJTJandJTrNonRigid<Eigen::Vector14d,
+                                                Eigen::Vector14i,
+                                                Eigen::MatrixXd,
+                                                Eigen::VectorXd>(
+                    f, num_rows, nonrigidval, false);
+
+    Eigen::SparseMatrix<double> sparse_JTJ;
+    Eigen::VectorXd sparse_JTr;
+    double sparse_r2;
+    std::tie(sparse_JTJ, sparse_JTr, sparse_r2) =
+            color_map::ComputeSparseJTJandJTrNonRigid(f, num_rows, nonrigidval,
+                                                      anchor_w);
+
+    ExpectEQ(JTJ, Eigen::MatrixXd(sparse_JTJ), 1e-9);
+    ExpectEQ(JTr, sparse_JTr, 1e-9);
+    EXPECT_NEAR(r2, sparse_r2, 1e-9);
+    // Only the blocks of neighboring anchors are stored.
+    EXPECT_LT(sparse_JTJ.nonZeros(), JTJ.size() / 2);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
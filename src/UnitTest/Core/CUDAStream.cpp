@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/CUDAStream.h"
+
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(CUDAStream, DefaultStream) {
+    Device device("CUDA:0");
+    CUDAStream stream = CUDAStream::GetCurrent(device);
+    EXPECT_TRUE(stream.IsDefault());
+    EXPECT_EQ(stream, CUDAStream::Default(device));
+    EXPECT_EQ(stream.GetHandle(), nullptr);
+    EXPECT_THROW(CUDAStream::Default(Device("CPU:0")), std::runtime_error);
+}
+
+TEST(CUDAStream, CUDA_CONDITIONAL_TEST(StreamGuard)) {
+    Device device("CUDA:0");
+    CUDAStream stream = CUDAStream::Create(device);
+    EXPECT_FALSE(stream.IsDefault());
+    {
+        CUDAStreamGuard guard(stream);
+        EXPECT_EQ(CUDAStream::GetCurrent(device), stream);
+    }
+    EXPECT_TRUE(CUDAStream::GetCurrent(device).IsDefault());
+}
+
+TEST(CUDAStream, CUDA_CONDITIONAL_TEST(AsyncCopy)) {
+    Device cpu("CPU:0");
+    Device cuda("CUDA:0");
+    std::vector<float> vals(1 << 20);
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<float>(i);
+    }
+    Tensor src(vals, {static_cast<int64_t>(vals.size())}, Dtype::Float32, cpu);
+
+    CUDAStream stream = CUDAStream::Create(cuda);
+    CUDAEvent start(cuda);
+    CUDAEvent end(cuda);
+    Tensor dst;
+    {
+        CUDAStreamGuard guard(stream);
+        start.Record(stream);
+        dst = (src.Copy(cuda) + 1) * 2;
+        end.Record(stream);
+    }
+    CUDAStream::Default(cuda).WaitEvent(end);
+    end.Synchronize();
+    EXPECT_TRUE(end.IsCompleted());
+    EXPECT_TRUE(stream.IsIdle());
+    EXPECT_GE(start.ElapsedMilliseconds(end), 0);
+
+    std::vector<float> dst_vals = dst.ToFlatVector<float>();
+    for (size_t i = 0; i < vals.size(); ++i) {
+        EXPECT_EQ(dst_vals[i], (vals[i] + 1) * 2);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
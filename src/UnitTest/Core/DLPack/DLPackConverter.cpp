@@ -82,5 +82,20 @@ TEST_P(DLPackPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST_P(DLPackPermuteDevices, ToDLPackFromDLPack16Bit) {
+    Device device = GetParam();
+    for (Dtype dtype : {Dtype::Float16, Dtype::UInt16}) {
+        Tensor src_t = Tensor::Ones({2, 3}, dtype, device);
+        DLManagedTensor *dl_t = src_t.ToDLPack();
+        EXPECT_EQ(dl_t->dl_tensor.dtype.bits, 16);
+
+        Tensor dst_t = Tensor::FromDLPack(dl_t);
+        EXPECT_EQ(dst_t.GetDtype(), dtype);
+        EXPECT_EQ(dst_t.GetDataPtr(), src_t.GetDataPtr());
+        EXPECT_EQ(dst_t.To(Dtype::Int32).ToFlatVector<int32_t>(),
+                  std::vector<int32_t>(6, 1));
+    }
+}
+
 }  // namespace unit_test
 }  // namespace open3d
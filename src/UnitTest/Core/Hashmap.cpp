@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/Hashmap/Hashmap.h"
+
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class HashmapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Hashmap,
+                         HashmapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(HashmapPermuteDevices, InsertFind) {
+    Device device = GetParam();
+    Hashmap map(4, Dtype::Int32, {2}, Dtype::Float32, {1}, device);
+
+    // Duplicated keys within a batch are inserted once.
+    Tensor keys(std::vector<int32_t>{0, 1, 2, 3, 0, 1, 4, 5}, {4, 2},
+                Dtype::Int32, device);
+    Tensor values(std::vector<float>{10, 20, 30, 40}, {4, 1}, Dtype::Float32,
+                  device);
+    Tensor addrs, masks;
+    map.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(map.Size(), 3);
+    std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+    EXPECT_TRUE(masks_vec[1] && masks_vec[3]);
+    EXPECT_NE(masks_vec[0], masks_vec[2]);
+    std::vector<int64_t> addrs_vec = addrs.ToFlatVector<int64_t>();
+    EXPECT_EQ(addrs_vec[0], addrs_vec[2]);
+
+    // Existing keys keep their values.
+    Tensor query_keys(std::vector<int32_t>{4, 5, 2, 3, 7, 7}, {3, 2},
+                      Dtype::Int32, device);
+    map.Insert(query_keys.Slice(0, 0, 1),
+               Tensor::Full({1, 1}, 99.f, Dtype::Float32, device), addrs,
+               masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({false}));
+
+    map.Find(query_keys, addrs, masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, false}));
+    addrs_vec = addrs.ToFlatVector<int64_t>();
+    EXPECT_EQ(addrs_vec[2], -1);
+    Tensor found_indices = addrs.Slice(0, 0, 2);
+    EXPECT_EQ(map.GetValueTensor()
+                      .IndexGet({found_indices})
+                      .ToFlatVector<float>(),
+              std::vector<float>({40, 20}));
+    EXPECT_EQ(map.GetKeyTensor()
+                      .IndexGet({found_indices})
+                      .ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 5, 2, 3}));
+}
+
+TEST_P(HashmapPermuteDevices, Activate) {
+    Device device = GetParam();
+    Hashmap map(4, Dtype::Int64, {}, Dtype::Float64, {3}, device);
+
+    Tensor keys(std::vector<int64_t>{5, 7, 5}, {3}, Dtype::Int64, device);
+    Tensor addrs, masks;
+    map.Activate(keys, addrs, masks);
+    EXPECT_EQ(map.Size(), 2);
+    Tensor values = map.GetValueTensor().IndexGet({addrs});
+    EXPECT_EQ(values.ToFlatVector<double>(), std::vector<double>(9, 0));
+}
+
+TEST_P(HashmapPermuteDevices, Erase) {
+    Device device = GetParam();
+    Hashmap map(4, Dtype::Int32, {1}, Dtype::Int32, {1}, device);
+
+    Tensor keys(std::vector<int32_t>{1, 2, 3}, {3, 1}, Dtype::Int32, device);
+    Tensor addrs, masks;
+    map.Insert(keys, keys, addrs, masks);
+
+    Tensor erase_keys(std::vector<int32_t>{2, 4}, {2, 1}, Dtype::Int32,
+                      device);
+    map.Erase(erase_keys, masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({true, false}));
+    EXPECT_EQ(map.Size(), 2);
+
+    map.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, false, true}));
+    EXPECT_EQ(map.GetActiveIndices().GetShape(), SizeVector({2}));
+
+    // Erased keys can be inserted again.
+    map.Insert(erase_keys, erase_keys * 10, addrs, masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({true, true}));
+    EXPECT_EQ(map.Size(), 4);
+    EXPECT_EQ(map.GetValueTensor().IndexGet({addrs}).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({20, 40}));
+}
+
+TEST_P(HashmapPermuteDevices, Rehash) {
+    Device device = GetParam();
+    Hashmap map(16, Dtype::Int32, {3}, Dtype::Int64, {1}, device);
+    const int64_t capacity = map.GetCapacity();
+
+    const int64_t num_keys = 10000;
+    std::vector<int32_t> keys_vec(num_keys * 3);
+    std::vector<int64_t> values_vec(num_keys);
+    for (int64_t i = 0; i < num_keys; ++i) {
+        keys_vec[i * 3 + 0] = static_cast<int32_t>(i % 20);
+        keys_vec[i * 3 + 1] = static_cast<int32_t>(i / 20 % 25);
+        keys_vec[i * 3 + 2] = static_cast<int32_t>(i / 500);
+        values_vec[i] = i;
+    }
+    Tensor keys(keys_vec, {num_keys, 3}, Dtype::Int32, device);
+    Tensor values(values_vec, {num_keys, 1}, Dtype::Int64, device);
+
+    // Insert in two batches so that the second one triggers a rehash of
+    // existing entries.
+    Tensor addrs, masks;
+    map.Insert(keys.Slice(0, 0, 100), values.Slice(0, 0, 100), addrs, masks);
+    map.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(map.Size(), num_keys);
+    EXPECT_GT(map.GetCapacity(), capacity);
+
+    map.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(Dtype::Int64).Sum({0}).Item<int64_t>(), num_keys);
+    EXPECT_EQ(map.GetValueTensor().IndexGet({addrs}).ToFlatVector<int64_t>(),
+              values_vec);
+
+    EXPECT_THROW(map.Rehash(num_keys), std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -184,5 +184,75 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, GetLinearByteStride) {
+    Device device = GetParam();
+    int64_t dtype_byte_size = DtypeUtil::ByteSize(Dtype::Float32);
+
+    // Contiguous input and broadcasted scalar.
+    Tensor input0({3, 2}, Dtype::Float32, device);
+    Tensor input1({}, Dtype::Float32, device);
+    Tensor output({3, 2}, Dtype::Float32, device);
+    Indexer indexer({input0, input1}, output);
+    EXPECT_EQ(indexer.GetInputLinearByteStride(0), dtype_byte_size);
+    EXPECT_EQ(indexer.GetInputLinearByteStride(1), 0);
+    EXPECT_EQ(indexer.GetOutputLinearByteStride(), dtype_byte_size);
+
+    // Broadcasted row and transposed input cannot be addressed linearly.
+    Tensor input2({2}, Dtype::Float32, device);
+    Tensor input3 = Tensor({2, 3}, Dtype::Float32, device).T();
+    Indexer indexer_strided({input2, input3}, output);
+    EXPECT_EQ(indexer_strided.GetInputLinearByteStride(0), -1);
+    EXPECT_EQ(indexer_strided.GetInputLinearByteStride(1), -1);
+    EXPECT_EQ(indexer_strided.GetOutputLinearByteStride(), dtype_byte_size);
+}
+
+template <typename indexer_t>
+static void ExpectSamePointers(const Indexer& indexer,
+                               const indexer_t& specialized_indexer) {
+    for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+        for (int64_t input_idx = 0; input_idx < indexer.NumInputs();
+             ++input_idx) {
+            EXPECT_EQ(specialized_indexer.GetInputPtr(input_idx, i),
+                      indexer.GetInputPtr(input_idx, i));
+        }
+        EXPECT_EQ(specialized_indexer.GetOutputPtr(i), indexer.GetOutputPtr(i));
+    }
+}
+
+TEST_P(IndexerPermuteDevices, SpecializedIndexers) {
+    Device device = GetParam();
+
+    // Contiguous input and broadcasted scalar.
+    Tensor input0({3, 2}, Dtype::Float32, device);
+    Tensor input1({}, Dtype::Float32, device);
+    Tensor output({3, 2}, Dtype::Float32, device);
+    Indexer indexer_linear({input0, input1}, output);
+    EXPECT_TRUE(LinearIndexer<2>::CanUse(indexer_linear));
+    ExpectSamePointers(indexer_linear, LinearIndexer<2>(indexer_linear));
+
+    // Broadcasted row and transposed input.
+    Tensor input2({2}, Dtype::Float32, device);
+    Tensor input3 = Tensor({2, 3}, Dtype::Float32, device).T();
+    Indexer indexer_2d({input2, input3}, output);
+    EXPECT_FALSE(LinearIndexer<2>::CanUse(indexer_2d));
+    EXPECT_EQ(indexer_2d.NumDims(), 2);
+    ExpectSamePointers(indexer_2d, FixedRankIndexer<2, 2>(indexer_2d));
+
+    // Broadcasting in 3 dimensions.
+    Tensor input4({4, 1, 3}, Dtype::Float32, device);
+    Tensor input5({2, 1}, Dtype::Float32, device);
+    Tensor output_3d({4, 2, 3}, Dtype::Float32, device);
+    Indexer indexer_3d({input4, input5}, output_3d);
+    EXPECT_EQ(indexer_3d.NumDims(), 3);
+    ExpectSamePointers(indexer_3d, FixedRankIndexer<3, 2>(indexer_3d));
+
+    // Strided 1D input.
+    Tensor input6 = Tensor({6}, Dtype::Float32, device).Slice(0, 0, 6, 2);
+    Tensor output_1d({3}, Dtype::Float32, device);
+    Indexer indexer_1d({input6}, output_1d);
+    EXPECT_EQ(indexer_1d.NumDims(), 1);
+    ExpectSamePointers(indexer_1d, FixedRankIndexer<1, 1>(indexer_1d));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/LazyTensor.h"
+
+#include <cmath>
+#include <vector>
+
+#include "Open3D/Core/Kernel/FusedEW.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class LazyTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LazyTensor,
+                         LazyTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LazyTensorPermuteDevices, Arithmetic) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>{1, 2, 3, 4, 5, 6}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>{6, 5, 4, 3, 2, 1}, {2, 3}, Dtype::Float32,
+             device);
+    Tensor c(std::vector<float>{2, 2, 2, 2, 2, 2}, {2, 3}, Dtype::Float32,
+             device);
+
+    LazyTensor expr = (a.Lazy() + b) * c - a.Lazy() / c;
+    EXPECT_EQ(expr.NumOps(), 4);
+    EXPECT_EQ(expr.GetShape(), SizeVector({2, 3}));
+    Tensor dst = expr.Materialize();
+    Tensor ref = (a + b) * c - a / c;
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), ref.ToFlatVector<float>());
+
+    // Unary ops.
+    dst = (a.Lazy() * a).Sqrt().Neg().Abs().Materialize();
+    EXPECT_EQ(dst.ToFlatVector<float>(), a.ToFlatVector<float>());
+    dst = a.Lazy().Exp().Materialize();
+    std::vector<float> dst_vals = dst.ToFlatVector<float>();
+    std::vector<float> ref_vals = a.Exp().ToFlatVector<float>();
+    for (size_t i = 0; i < dst_vals.size(); ++i) {
+        EXPECT_FLOAT_EQ(dst_vals[i], ref_vals[i]);
+    }
+
+    // Leaves are returned as-is.
+    EXPECT_TRUE(a.Lazy().IsLeaf());
+    EXPECT_EQ(a.Lazy().Materialize().GetDataPtr(), a.GetDataPtr());
+}
+
+TEST_P(LazyTensorPermuteDevices, BroadcastAndScalar) {
+    Device device = GetParam();
+    Tensor a(std::vector<int32_t>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Int32,
+             device);
+    Tensor row(std::vector<int32_t>{10, 20, 30}, {3}, Dtype::Int32, device);
+
+    Tensor dst = (a.Lazy() + row - 1).Materialize();
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 3}));
+    EXPECT_EQ(dst.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({9, 20, 31, 12, 23, 34}));
+
+    // Non-contiguous leaf.
+    Tensor a_t = a.T();
+    dst = (a_t.Lazy() * 2).Materialize();
+    EXPECT_EQ(dst.GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 6, 2, 8, 4, 10}));
+
+    EXPECT_THROW(a.Lazy() + Tensor::Ones({2, 2}, Dtype::Int32, device),
+                 std::runtime_error);
+    EXPECT_THROW(a.Lazy() + Tensor::Ones({2, 3}, Dtype::Float32, device),
+                 std::runtime_error);
+    EXPECT_THROW(a.Lazy().Sqrt(), std::runtime_error);
+}
+
+TEST_P(LazyTensorPermuteDevices, SharedSubExpressions) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>{1, 2, 3, 4}, {4}, Dtype::Float32, device);
+
+    LazyTensor x = a.Lazy() + 1;
+    LazyTensor y = x * x + x;
+    EXPECT_EQ((a - x).Materialize().ToFlatVector<float>(),
+              std::vector<float>({-1, -1, -1, -1}));
+    EXPECT_EQ(y.NumOps(), 3);
+    EXPECT_EQ(y.Materialize().ToFlatVector<float>(),
+              std::vector<float>({6, 12, 20, 30}));
+}
+
+TEST_P(LazyTensorPermuteDevices, LargeExpression) {
+    Device device = GetParam();
+    const int64_t size = 10000;
+    Tensor a = Tensor::Ones({size}, Dtype::Float64, device);
+
+    // More ops and leaves than a single fused kernel accepts.
+    LazyTensor expr = a.Lazy();
+    for (int64_t i = 0; i < 3 * kernel::MAX_FUSED_INSTRUCTIONS; ++i) {
+        expr = expr + Tensor::Full({size}, 1.0, Dtype::Float64, device);
+    }
+    std::vector<double> vals = expr.Materialize().ToFlatVector<double>();
+    double expected = 1 + 3 * kernel::MAX_FUSED_INSTRUCTIONS;
+    EXPECT_EQ(vals, std::vector<double>(size, expected));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <vector>
+
+#include "Open3D/Core/Kernel/LinearAlgebra.h"
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class LinearAlgebraPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LinearAlgebra,
+                         LinearAlgebraPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static void ExpectAllNear(const std::vector<double>& actual,
+                          const std::vector<double>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 1e-9);
+    }
+}
+
+TEST_P(LinearAlgebraPermuteDevices, Eye) {
+    Device device = GetParam();
+    Tensor eye = Tensor::Eye(3, Dtype::Float32, device);
+    EXPECT_EQ(eye.GetShape(), SizeVector({3, 3}));
+    EXPECT_EQ(eye.ToFlatVector<float>(),
+              std::vector<float>({1, 0, 0, 0, 1, 0, 0, 0, 1}));
+}
+
+TEST_P(LinearAlgebraPermuteDevices, Matmul) {
+    Device device = GetParam();
+    Tensor lhs(std::vector<float>{1, 2, 3, 4, 5, 6}, {2, 3}, Dtype::Float32,
+               device);
+    Tensor rhs(std::vector<float>{1, 0, 0, 1, 1, 1}, {3, 2}, Dtype::Float32,
+               device);
+    Tensor dst = lhs.Matmul(rhs);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({4, 5, 10, 11}));
+
+    // Non-contiguous operand.
+    dst = rhs.T().Matmul(lhs.T());
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({4, 10, 5, 11}));
+
+    // Batched, with the 2-D operand broadcasted.
+    Tensor batch(std::vector<float>{1, 2, 3, 4, 5, 6, 6, 5, 4, 3, 2, 1},
+                 {2, 2, 3}, Dtype::Float32, device);
+    dst = batch.Matmul(rhs);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 2, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({4, 5, 10, 11, 10, 9, 4, 3}));
+    dst = lhs.T().Matmul(batch);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 3, 3}));
+
+    EXPECT_THROW(lhs.Matmul(lhs), std::runtime_error);
+    EXPECT_THROW(lhs.To(Dtype::Int32).Matmul(rhs.To(Dtype::Int32)),
+                 std::runtime_error);
+}
+
+TEST_P(LinearAlgebraPermuteDevices, SolveAndInverse) {
+    Device device = GetParam();
+    // Needs pivoting: the leading entry is zero.
+    Tensor a(std::vector<double>{0, 2, 1, 1, 1, 1, 2, 1, 3}, {3, 3},
+             Dtype::Float64, device);
+    Tensor b(std::vector<double>{3, 3, 6}, {3}, Dtype::Float64, device);
+    Tensor x = a.Solve(b);
+    EXPECT_EQ(x.GetShape(), SizeVector({3}));
+    ExpectAllNear(x.ToFlatVector<double>(), {1, 1, 1});
+
+    Tensor a_inv = a.Inverse();
+    ExpectAllNear(a.Matmul(a_inv).ToFlatVector<double>(),
+                  Tensor::Eye(3, Dtype::Float64).ToFlatVector<double>());
+
+    // Batch of 4x4 rigid transforms.
+    std::vector<double> vals;
+    for (int i = 0; i < 5; ++i) {
+        double c = std::cos(0.3 * i);
+        double s = std::sin(0.3 * i);
+        std::vector<double> t{c, -s, 0, 1.0 * i, s, c, 0, 2, 0, 0, 1, 3,
+                              0, 0,  0, 1};
+        vals.insert(vals.end(), t.begin(), t.end());
+    }
+    Tensor transforms(vals, {5, 4, 4}, Dtype::Float64, device);
+    Tensor products = transforms.Matmul(transforms.Inverse());
+    for (int i = 0; i < 5; ++i) {
+        ExpectAllNear(products[i].ToFlatVector<double>(),
+                      Tensor::Eye(4, Dtype::Float64).ToFlatVector<double>());
+    }
+
+    EXPECT_THROW(a.Solve(Tensor::Ones({2}, Dtype::Float64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(transforms[0].Slice(0, 0, 3).Inverse(), std::runtime_error);
+}
+
+TEST(LinearAlgebra, SolveLargeCPU) {
+    // Larger systems use LU decomposition on CPU.
+    const int64_t n = 10;
+    Tensor a = Tensor::Eye(n, Dtype::Float64) * 2.0;
+    Tensor b = Tensor::Ones({n, 2}, Dtype::Float64);
+    ExpectAllNear(a.Solve(b).ToFlatVector<double>(),
+                  std::vector<double>(n * 2, 0.5));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -26,11 +26,13 @@
 
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/Blob.h"
+#include "Open3D/Core/CPUAllocator.h"
 #include "Open3D/Core/Device.h"
 
 #include "Core/CoreTest.h"
 #include "TestUtility/UnitTest.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace open3d {
@@ -77,5 +79,178 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, CacheReuse) {
+    Device device = GetParam();
+    bool cache_enabled = MemoryManager::IsCacheEnabled(device.GetType());
+    MemoryManager::SetCacheEnabled(device.GetType(), true);
+    MemoryManager::EmptyCache(device);
+
+    MemoryCacheStatistics stats = MemoryManager::GetCacheStatistics(device);
+    size_t bytes_in_use = stats.bytes_in_use_;
+    int64_t num_cache_hits = stats.num_cache_hits_;
+
+    // Freed blocks are recycled for requests of the same size.
+    void* ptr = MemoryManager::Malloc(1000, device);
+    stats = MemoryManager::GetCacheStatistics(device);
+    EXPECT_EQ(stats.bytes_in_use_, bytes_in_use + 1024);
+    EXPECT_GE(stats.bytes_reserved_, stats.bytes_in_use_);
+    EXPECT_GE(stats.peak_bytes_in_use_, stats.bytes_in_use_);
+    MemoryManager::Free(ptr, device);
+    void* ptr_reused = MemoryManager::Malloc(1000, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    EXPECT_GT(MemoryManager::GetCacheStatistics(device).num_cache_hits_,
+              num_cache_hits);
+
+    // Blocks carved from the same segment do not overlap.
+    void* ptr_split = MemoryManager::Malloc(100, device);
+    EXPECT_NE(ptr_split, ptr_reused);
+    MemoryManager::Free(ptr_split, device);
+    MemoryManager::Free(ptr_reused, device);
+    EXPECT_EQ(MemoryManager::GetCacheStatistics(device).bytes_in_use_,
+              bytes_in_use);
+
+    MemoryManager::EmptyCache(device);
+    if (bytes_in_use == 0) {
+        EXPECT_EQ(MemoryManager::GetCacheStatistics(device).bytes_reserved_,
+                  0);
+    }
+    MemoryManager::SetCacheEnabled(device.GetType(), cache_enabled);
+}
+
+TEST_P(MemoryManagerPermuteDevices, CacheToggle) {
+    Device device = GetParam();
+    bool cache_enabled = MemoryManager::IsCacheEnabled(device.GetType());
+
+    // Blocks allocated with caching enabled can be freed after disabling it,
+    // and vice versa.
+    MemoryManager::SetCacheEnabled(device.GetType(), true);
+    void* cached_ptr = MemoryManager::Malloc(10, device);
+    MemoryManager::SetCacheEnabled(device.GetType(), false);
+    void* raw_ptr = MemoryManager::Malloc(10, device);
+    MemoryManager::Free(cached_ptr, device);
+    MemoryManager::SetCacheEnabled(device.GetType(), true);
+    MemoryManager::Free(raw_ptr, device);
+
+    MemoryManager::EmptyCache(device);
+    MemoryManager::SetCacheEnabled(device.GetType(), cache_enabled);
+}
+
+TEST_P(MemoryManagerPermuteDevices, MemoryStatistics) {
+    Device device = GetParam();
+    MemoryManager::ResetMemoryStatistics(device);
+    MemoryStatistics stats = MemoryManager::GetMemoryStatistics(device);
+    size_t bytes_in_use = stats.bytes_in_use_;
+    int64_t num_live_allocations = stats.num_live_allocations_;
+    EXPECT_EQ(stats.peak_bytes_in_use_, bytes_in_use);
+    EXPECT_EQ(stats.num_allocations_, 0);
+
+    void* ptr0 = MemoryManager::Malloc(1000, device);
+    void* ptr1 = MemoryManager::Malloc(24, device);
+    stats = MemoryManager::GetMemoryStatistics(device);
+    EXPECT_EQ(stats.bytes_in_use_, bytes_in_use + 1024);
+    EXPECT_EQ(stats.num_live_allocations_, num_live_allocations + 2);
+    EXPECT_EQ(stats.num_allocations_, 2);
+    // 1000 is in [512, 1024) and 24 is in [16, 32).
+    EXPECT_EQ(stats.size_histogram_[10], 1);
+    EXPECT_EQ(stats.size_histogram_[5], 1);
+
+    MemoryManager::Free(ptr0, device);
+    stats = MemoryManager::GetMemoryStatistics(device);
+    EXPECT_EQ(stats.bytes_in_use_, bytes_in_use + 24);
+    EXPECT_EQ(stats.peak_bytes_in_use_, bytes_in_use + 1024);
+    EXPECT_EQ(stats.num_frees_, 1);
+
+    // Reset keeps tracking the live allocation.
+    MemoryManager::ResetMemoryStatistics(device);
+    stats = MemoryManager::GetMemoryStatistics(device);
+    EXPECT_EQ(stats.peak_bytes_in_use_, bytes_in_use + 24);
+    EXPECT_EQ(stats.num_allocations_, 0);
+    EXPECT_EQ(stats.size_histogram_[5], 0);
+    MemoryManager::Free(ptr1, device);
+    EXPECT_EQ(MemoryManager::GetMemoryStatistics(device).bytes_in_use_,
+              bytes_in_use);
+}
+
+TEST_P(MemoryManagerPermuteDevices, LiveAllocations) {
+    Device device = GetParam();
+    bool site_tracking_enabled = MemoryManager::IsSiteTrackingEnabled();
+    MemoryManager::SetSiteTrackingEnabled(true);
+
+    void* ptr_untracked = MemoryManager::Malloc(10, device);
+    void* ptr_outer;
+    void* ptr_inner;
+    {
+        MemoryAllocationSite site("Outer");
+        ptr_outer = MemoryManager::Malloc(20, device);
+        {
+            MemoryAllocationSite nested_site("Inner");
+            ptr_inner = MemoryManager::Malloc(30, device);
+        }
+    }
+
+    std::vector<MemoryAllocationRecord> records =
+            MemoryManager::GetLiveAllocations(device);
+    auto find_record = [&](void* ptr) {
+        return *std::find_if(records.begin(), records.end(),
+                             [&](const MemoryAllocationRecord& record) {
+                                 return record.ptr_ == ptr;
+                             });
+    };
+    EXPECT_EQ(find_record(ptr_untracked).site_, "");
+    EXPECT_EQ(find_record(ptr_outer).site_, "Outer");
+    EXPECT_EQ(find_record(ptr_inner).site_, "Outer/Inner");
+    EXPECT_EQ(find_record(ptr_inner).byte_size_, 30);
+
+    MemoryManager::Free(ptr_untracked, device);
+    MemoryManager::Free(ptr_outer, device);
+    MemoryManager::Free(ptr_inner, device);
+    records = MemoryManager::GetLiveAllocations(device);
+    EXPECT_TRUE(std::none_of(records.begin(), records.end(),
+                             [&](const MemoryAllocationRecord& record) {
+                                 return record.ptr_ == ptr_inner;
+                             }));
+    MemoryManager::SetSiteTrackingEnabled(site_tracking_enabled);
+}
+
+TEST(MemoryManager, CPUAllocationPolicy) {
+    Device device("CPU:0");
+    CPUAllocationPolicy default_policy =
+            CPUMemoryManager::GetAllocationPolicy();
+    for (auto placement : {CPUAllocationPolicy::Placement::FirstTouch,
+                           CPUAllocationPolicy::Placement::Interleaved,
+                           CPUAllocationPolicy::Placement::Local}) {
+        CPUAllocationPolicy policy;
+        policy.placement_ = placement;
+        policy.huge_pages_ = placement != CPUAllocationPolicy::Placement::Local;
+        policy.large_block_size_ = 1 << 16;
+        CPUMemoryManager::SetAllocationPolicy(policy);
+
+        // A large block follows the policy and a small one comes from malloc.
+        size_t bytes_in_use =
+                MemoryManager::GetMemoryStatistics(device).bytes_in_use_;
+        std::vector<void*> ptrs = {MemoryManager::Malloc(3 << 20, device),
+                                   MemoryManager::Malloc(100, device)};
+        std::vector<size_t> sizes = {3 << 20, 100};
+        for (size_t i = 0; i < ptrs.size(); ++i) {
+            ASSERT_NE(ptrs[i], nullptr);
+            std::memset(ptrs[i], 1, sizes[i]);
+            EXPECT_EQ(static_cast<uint8_t*>(ptrs[i])[sizes[i] - 1], 1);
+        }
+        EXPECT_EQ(MemoryManager::GetMemoryStatistics(device).bytes_in_use_,
+                  bytes_in_use + (3 << 20) + 100);
+        for (void* ptr : ptrs) {
+            MemoryManager::Free(ptr, device);
+        }
+        EXPECT_EQ(MemoryManager::GetMemoryStatistics(device).bytes_in_use_,
+                  bytes_in_use);
+
+        std::vector<int, CPUAllocator<int>> values(1 << 20, 7);
+        values.push_back(8);
+        EXPECT_EQ(values[1 << 19], 7);
+        EXPECT_EQ(values.back(), 8);
+    }
+    CPUMemoryManager::SetAllocationPolicy(default_policy);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,228 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/NNS/NearestNeighborSearch.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class NNSPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(NearestNeighborSearch,
+                         NNSPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static std::vector<double> RandomPoints(int64_t num_points,
+                                        double scale,
+                                        unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-scale, scale);
+    std::vector<double> points(num_points * 3);
+    for (double& v : points) {
+        v = dist(rng);
+    }
+    return points;
+}
+
+/// Indices and squared distances of all points, sorted by distance.
+static std::vector<std::pair<double, int64_t>> BruteForce(
+        const std::vector<double>& points, const double* query) {
+    std::vector<std::pair<double, int64_t>> neighbors;
+    for (size_t j = 0; j < points.size() / 3; ++j) {
+        double distance2 = 0;
+        for (int d = 0; d < 3; ++d) {
+            const double diff = points[3 * j + d] - query[d];
+            distance2 += diff * diff;
+        }
+        neighbors.emplace_back(distance2, static_cast<int64_t>(j));
+    }
+    std::stable_sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST_P(NNSPermuteDevices, KnnSearch) {
+    Device device = GetParam();
+    std::vector<double> points = RandomPoints(500, 1.0, 0);
+    // Some queries lie outside of the bounds of the dataset.
+    std::vector<double> queries = RandomPoints(50, 2.0, 1);
+    for (Dtype dtype : {Dtype::Float32, Dtype::Float64}) {
+        nns::NearestNeighborSearch nns(
+                Tensor(points, {500, 3}, Dtype::Float64, device).To(dtype));
+        nns.KnnIndex();
+        EXPECT_GT(nns.GetCellSize(), 0);
+        Tensor indices, distances2;
+        std::tie(indices, distances2) = nns.KnnSearch(
+                Tensor(queries, {50, 3}, Dtype::Float64, device).To(dtype),
+                10);
+        EXPECT_EQ(indices.GetShape(), SizeVector({50, 10}));
+        EXPECT_EQ(distances2.GetDtype(), dtype);
+        std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+        std::vector<double> distances2_vec =
+                distances2.To(Dtype::Float64).ToFlatVector<double>();
+        for (int64_t i = 0; i < 50; ++i) {
+            auto ref = BruteForce(points, &queries[3 * i]);
+            for (int64_t t = 0; t < 10; ++t) {
+                EXPECT_EQ(indices_vec[i * 10 + t], ref[t].second);
+                EXPECT_NEAR(distances2_vec[i * 10 + t], ref[t].first, 1e-4);
+            }
+        }
+    }
+
+    // knn is clamped to the number of points.
+    nns::NearestNeighborSearch nns(Tensor(std::vector<float>{0, 0, 0, 1, 0, 0},
+                                          {2, 3}, Dtype::Float32, device));
+    nns.KnnIndex();
+    Tensor indices, distances2;
+    std::tie(indices, distances2) = nns.KnnSearch(
+            Tensor(std::vector<float>{0.9, 0, 0}, {1, 3}, Dtype::Float32,
+                   device),
+            5);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 0}));
+}
+
+TEST_P(NNSPermuteDevices, KnnSearchPlanar) {
+    Device device = GetParam();
+    // All points on the plane z = 0.
+    std::vector<double> points = RandomPoints(300, 1.0, 2);
+    for (size_t j = 0; j < 300; ++j) {
+        points[3 * j + 2] = 0;
+    }
+    std::vector<double> queries = RandomPoints(20, 1.0, 3);
+    nns::NearestNeighborSearch nns(
+            Tensor(points, {300, 3}, Dtype::Float64, device));
+    nns.KnnIndex();
+    Tensor indices, distances2;
+    std::tie(indices, distances2) = nns.KnnSearch(
+            Tensor(queries, {20, 3}, Dtype::Float64, device), 5);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < 20; ++i) {
+        auto ref = BruteForce(points, &queries[3 * i]);
+        for (int64_t t = 0; t < 5; ++t) {
+            EXPECT_EQ(indices_vec[i * 5 + t], ref[t].second);
+        }
+    }
+}
+
+TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
+    Device device = GetParam();
+    std::vector<double> points = RandomPoints(500, 1.0, 4);
+    std::vector<double> queries = RandomPoints(50, 1.2, 5);
+    const double radius = 0.3;
+    for (Dtype dtype : {Dtype::Float32, Dtype::Float64}) {
+        nns::NearestNeighborSearch nns(
+                Tensor(points, {500, 3}, Dtype::Float64, device).To(dtype));
+        nns.FixedRadiusIndex(radius);
+        Tensor indices, distances2, splits;
+        // A larger radius than the cell size is supported as well.
+        for (double search_radius : {radius, 2 * radius}) {
+            std::tie(indices, distances2, splits) = nns.FixedRadiusSearch(
+                    Tensor(queries, {50, 3}, Dtype::Float64, device).To(dtype),
+                    search_radius);
+            std::vector<int64_t> splits_vec = splits.ToFlatVector<int64_t>();
+            ASSERT_EQ(splits_vec.size(), 51u);
+            EXPECT_EQ(splits_vec[0], 0);
+            EXPECT_EQ(splits_vec[50], indices.GetShape(0));
+            std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+            std::vector<double> distances2_vec =
+                    distances2.To(Dtype::Float64).ToFlatVector<double>();
+            for (int64_t i = 0; i < 50; ++i) {
+                auto ref = BruteForce(points, &queries[3 * i]);
+                int64_t num_ref = 0;
+                while (num_ref < 500 &&
+                       ref[num_ref].first <= search_radius * search_radius) {
+                    ++num_ref;
+                }
+                ASSERT_EQ(splits_vec[i + 1] - splits_vec[i], num_ref);
+                for (int64_t t = 0; t < num_ref; ++t) {
+                    EXPECT_EQ(indices_vec[splits_vec[i] + t], ref[t].second);
+                    EXPECT_NEAR(distances2_vec[splits_vec[i] + t],
+                                ref[t].first, 1e-4);
+                }
+            }
+        }
+    }
+}
+
+TEST_P(NNSPermuteDevices, HybridSearch) {
+    Device device = GetParam();
+    std::vector<double> points = RandomPoints(500, 1.0, 6);
+    std::vector<double> queries = RandomPoints(50, 1.2, 7);
+    const double radius = 0.3;
+    const int max_knn = 4;
+    nns::NearestNeighborSearch nns(
+            Tensor(points, {500, 3}, Dtype::Float64, device));
+    nns.HybridIndex(radius);
+    Tensor indices, distances2, counts;
+    std::tie(indices, distances2, counts) = nns.HybridSearch(
+            Tensor(queries, {50, 3}, Dtype::Float64, device), radius, max_knn);
+    EXPECT_EQ(indices.GetShape(), SizeVector({50, max_knn}));
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<int64_t> counts_vec = counts.ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < 50; ++i) {
+        auto ref = BruteForce(points, &queries[3 * i]);
+        int64_t num_ref = 0;
+        while (num_ref < max_knn && ref[num_ref].first <= radius * radius) {
+            ++num_ref;
+        }
+        ASSERT_EQ(counts_vec[i], num_ref);
+        for (int64_t t = 0; t < max_knn; ++t) {
+            EXPECT_EQ(indices_vec[i * max_knn + t],
+                      t < num_ref ? ref[t].second : -1);
+        }
+    }
+}
+
+TEST_P(NNSPermuteDevices, InvalidInputs) {
+    Device device = GetParam();
+    EXPECT_ANY_THROW(nns::NearestNeighborSearch(
+            Tensor::Zeros({4, 2}, Dtype::Float32, device)));
+    EXPECT_ANY_THROW(nns::NearestNeighborSearch(
+            Tensor::Zeros({4, 3}, Dtype::Int32, device)));
+
+    nns::NearestNeighborSearch nns(
+            Tensor::Zeros({4, 3}, Dtype::Float32, device));
+    Tensor queries = Tensor::Zeros({2, 3}, Dtype::Float32, device);
+    // No index.
+    EXPECT_ANY_THROW(nns.KnnSearch(queries, 1));
+    nns.KnnIndex();
+    EXPECT_EQ(nns.KnnSearch(queries, 1).first.GetShape(), SizeVector({2, 1}));
+    EXPECT_ANY_THROW(nns.KnnSearch(queries, 0));
+    EXPECT_ANY_THROW(nns.KnnSearch(queries.To(Dtype::Float64), 1));
+    EXPECT_ANY_THROW(nns.FixedRadiusIndex(0));
+    EXPECT_ANY_THROW(nns.FixedRadiusSearch(queries, -1));
+    EXPECT_ANY_THROW(nns.HybridSearch(queries, 1, 0));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Core/SizeVector.h"
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(SizeVector, Constructors) {
+    EXPECT_TRUE(SizeVector().empty());
+    EXPECT_EQ(SizeVector({2, 3}).size(), 2);
+    EXPECT_EQ(SizeVector(3, 1), SizeVector({1, 1, 1}));
+    EXPECT_EQ(SizeVector(std::vector<int64_t>{4, 5}), SizeVector({4, 5}));
+
+    // Two integers are a size and a value, not an iterator range.
+    EXPECT_EQ(SizeVector(2, 7), SizeVector({7, 7}));
+
+    std::vector<int> values{1, 2, 3};
+    EXPECT_EQ(SizeVector(values.begin() + 1, values.end()), SizeVector({2, 3}));
+}
+
+TEST(SizeVector, NumElements) {
+    EXPECT_EQ(SizeVector({}).NumElements(), 1);
+    EXPECT_EQ(SizeVector({0}).NumElements(), 0);
+    EXPECT_EQ(SizeVector({2, 3, 4}).NumElements(), 24);
+}
+
+TEST(SizeVector, InsertErase) {
+    SizeVector shape{2, 3};
+    shape.insert(shape.begin(), 1);
+    EXPECT_EQ(shape, SizeVector({1, 2, 3}));
+    shape.insert(shape.end(), {4, 5});
+    EXPECT_EQ(shape, SizeVector({1, 2, 3, 4, 5}));
+
+    // Inserting a range of the vector itself.
+    shape.insert(shape.begin() + 1, shape.begin(), shape.end());
+    EXPECT_EQ(shape, SizeVector({1, 1, 2, 3, 4, 5, 2, 3, 4, 5}));
+
+    shape.erase(shape.begin() + 1, shape.begin() + 6);
+    EXPECT_EQ(shape, SizeVector({1, 2, 3, 4, 5}));
+    shape.erase(shape.begin());
+    EXPECT_EQ(shape, SizeVector({2, 3, 4, 5}));
+    shape.pop_back();
+    shape.push_back(shape.front());
+    EXPECT_EQ(shape, SizeVector({2, 3, 4, 2}));
+}
+
+TEST(SizeVector, MoreThanMaxDims) {
+    // Elements are stored on the heap past MAX_DIMS.
+    SizeVector shape;
+    for (int64_t i = 0; i < 2 * MAX_DIMS + 1; ++i) {
+        shape.push_back(i);
+    }
+    EXPECT_EQ(shape.size(), 2 * MAX_DIMS + 1);
+    for (int64_t i = 0; i < 2 * MAX_DIMS + 1; ++i) {
+        EXPECT_EQ(shape[i], i);
+    }
+
+    SizeVector copy = shape;
+    EXPECT_EQ(copy, shape);
+    EXPECT_NE(copy.data(), shape.data());
+
+    const int64_t* data = shape.data();
+    SizeVector moved = std::move(shape);
+    EXPECT_EQ(moved, copy);
+    EXPECT_EQ(moved.data(), data);
+    EXPECT_TRUE(shape.empty());
+
+    shape = {1, 2};
+    moved = shape;
+    EXPECT_EQ(moved, SizeVector({1, 2}));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
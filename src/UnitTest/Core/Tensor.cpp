@@ -24,12 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "Open3D/Core/AdvancedIndexing.h"
+#include "Open3D/Core/CUDAUtils.h"
 #include "Open3D/Core/Dtype.h"
 #include "Open3D/Core/Kernel/Kernel.h"
+#include "Open3D/Core/Kernel/Philox.h"
 #include "Open3D/Core/MemoryManager.h"
 #include "Open3D/Core/SizeVector.h"
 #include "Open3D/Core/Tensor.h"
@@ -179,6 +184,69 @@ TEST_P(TensorPermuteDevicePairs, Copy) {
     EXPECT_EQ(dst_t.ToFlatVector<float>(), vals);
 }
 
+TEST_P(TensorPermuteDevicePairs, ShardAndFromShards) {
+    Device dst_device;
+    Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    std::vector<float> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    Tensor src_t(vals, {5, 2}, Dtype::Float32, src_device);
+
+    // Even split, the first shard holds the extra row.
+    std::vector<Tensor> shards = src_t.Shard({dst_device, src_device});
+    ASSERT_EQ(shards.size(), 2);
+    EXPECT_EQ(shards[0].GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(shards[0].GetDevice(), dst_device);
+    EXPECT_EQ(shards[0].ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(shards[1].GetShape(), SizeVector({2, 2}));
+    EXPECT_EQ(shards[1].GetDevice(), src_device);
+    EXPECT_EQ(shards[1].ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 9}));
+    Tensor gathered = Tensor::FromShards(shards, src_device);
+    EXPECT_EQ(gathered.GetShape(), SizeVector({5, 2}));
+    EXPECT_EQ(gathered.GetDevice(), src_device);
+    EXPECT_EQ(gathered.ToFlatVector<float>(), vals);
+
+    // Explicit sizes, including an empty shard.
+    shards = src_t.Shard({dst_device, src_device, dst_device}, {1, 0, 4});
+    EXPECT_EQ(shards[0].ToFlatVector<float>(), std::vector<float>({0, 1}));
+    EXPECT_EQ(shards[1].GetShape(), SizeVector({0, 2}));
+    EXPECT_EQ(shards[2].GetShape(), SizeVector({4, 2}));
+    EXPECT_EQ(Tensor::FromShards(shards, dst_device).ToFlatVector<float>(),
+              vals);
+
+    EXPECT_THROW(src_t.Shard({dst_device}, {1, 4}), std::runtime_error);
+    EXPECT_THROW(src_t.Shard({dst_device, src_device}, {1, 3}),
+                 std::runtime_error);
+    EXPECT_THROW(Tensor::FromShards({src_t, src_t.T()}, dst_device),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, PinMemory) {
+    Device device = GetParam();
+
+    std::vector<float> vals{0, 1, 2, 3, 4, 5};
+    Tensor src_t(vals, {2, 3}, Dtype::Float32, Device("CPU:0"));
+    EXPECT_FALSE(src_t.IsPinned());
+    if (!cuda::IsAvailable()) {
+        EXPECT_THROW(src_t.PinMemory(), std::runtime_error);
+        return;
+    }
+
+    // Non-contiguous tensors are compacted.
+    Tensor pinned_t = src_t.T().PinMemory();
+    EXPECT_TRUE(pinned_t.IsPinned());
+    EXPECT_TRUE(pinned_t.IsContiguous());
+    EXPECT_EQ(pinned_t.PinMemory().GetDataPtr(), pinned_t.GetDataPtr());
+    EXPECT_EQ(pinned_t.T().Copy(device).ToFlatVector<float>(), vals);
+
+    Tensor empty_t = Tensor::EmptyPinned({2, 3}, Dtype::Float32);
+    EXPECT_TRUE(empty_t.IsPinned());
+    empty_t.CopyFrom(src_t.Copy(device));
+    EXPECT_EQ(empty_t.ToFlatVector<float>(), vals);
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBool) {
     Device dst_device;
     Device src_device;
@@ -216,6 +284,56 @@ TEST_P(TensorPermuteDevices, To) {
     EXPECT_EQ(dst_t.ToFlatVector<int>(), dst_vals);
 }
 
+TEST_P(TensorPermuteDevices, Float16) {
+    Device device = GetParam();
+
+    // Round-to-nearest-even, overflow, subnormals and signed zero.
+    std::vector<float> src_vals{1.f,     -2.5f, 1.f + 1.f / 2048, 65504.f,
+                                70000.f, 6e-8f, 1e-8f,            -0.f};
+    Tensor src_t(src_vals, {8}, Dtype::Float32, device);
+    Tensor half_t = src_t.To(Dtype::Float16);
+    EXPECT_EQ(half_t.GetDtype(), Dtype::Float16);
+    EXPECT_EQ(DtypeUtil::ByteSize(Dtype::Float16), 2);
+    std::vector<uint16_t> bits;
+    for (const Half& h : half_t.ToFlatVector<Half>()) {
+        bits.push_back(h.bits_);
+    }
+    EXPECT_EQ(bits, std::vector<uint16_t>({0x3c00, 0xc100, 0x3c00, 0x7bff,
+                                           0x7c00, 0x0001, 0x0000, 0x8000}));
+    std::vector<float> dst_vals =
+            half_t.To(Dtype::Float32).ToFlatVector<float>();
+    EXPECT_EQ(dst_vals[1], -2.5f);
+    EXPECT_EQ(dst_vals[5], std::pow(2.f, -24.f));
+
+    // Arithmetic and reductions.
+    Tensor a = Tensor::Full({2, 3}, 1.5, Dtype::Float16, device);
+    Tensor b(std::vector<Half>{0, 1, 2, 3, 4, 5}, {2, 3}, Dtype::Float16,
+             device);
+    EXPECT_EQ((a * b + a).To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({1.5, 3, 4.5, 6, 7.5, 9}));
+    EXPECT_EQ(b.Sum({0, 1}).Item<Half>(), 15.f);
+    EXPECT_EQ(b.Max({1}).To(Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({2, 5}));
+    EXPECT_EQ(b.Sqrt().To(Dtype::Float32).ToFlatVector<float>()[4], 2.f);
+    EXPECT_EQ(b.Gt(a).ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true, true, true}));
+}
+
+TEST_P(TensorPermuteDevices, UInt16) {
+    Device device = GetParam();
+
+    std::vector<uint16_t> vals{0, 1, 1000, 65535};
+    Tensor t(vals, {4}, Dtype::UInt16, device);
+    EXPECT_EQ(DtypeUtil::ByteSize(Dtype::UInt16), 2);
+    EXPECT_EQ(t.ToFlatVector<uint16_t>(), vals);
+    EXPECT_EQ(t.To(Dtype::Int32).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 1000, 65535}));
+    EXPECT_EQ((t / 10).ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({0, 0, 100, 6553}));
+    EXPECT_EQ(t.Max({0}).Item<uint16_t>(), 65535);
+    EXPECT_EQ(t.To(Dtype::Int64).Sum({0}).Item<int64_t>(), 66536);
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     Device dst_device;
     Device src_device;
@@ -998,6 +1116,79 @@ TEST_P(TensorPermuteDevices, T) {
     EXPECT_THROW(t_3d.T(), std::runtime_error);
 }
 
+TEST_P(TensorPermuteDevices, PermutedCopy) {
+    Device device = GetParam();
+
+    // Transpose with sizes that are not multiples of the tile size.
+    int64_t rows = 37;
+    int64_t cols = 45;
+    std::vector<float> vals(rows * cols);
+    std::iota(vals.begin(), vals.end(), 0);
+    Tensor t(vals, {rows, cols}, Dtype::Float32, device);
+    std::vector<float> vals_t(rows * cols);
+    for (int64_t r = 0; r < rows; ++r) {
+        for (int64_t c = 0; c < cols; ++c) {
+            vals_t[c * rows + r] = vals[r * cols + c];
+        }
+    }
+    Tensor t_t = t.T().Contiguous();
+    EXPECT_TRUE(t_t.IsContiguous());
+    EXPECT_EQ(t_t.GetShape(), SizeVector({cols, rows}));
+    EXPECT_EQ(t_t.ToFlatVector<float>(), vals_t);
+
+    // Points stored as (N, 3), copied to (3, N).
+    Tensor points(std::vector<float>(vals.begin(), vals.begin() + 30), {10, 3},
+                  Dtype::Float32, device);
+    std::vector<float> vals_points_t(30);
+    for (int64_t i = 0; i < 10; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            vals_points_t[j * 10 + i] = vals[i * 3 + j];
+        }
+    }
+    EXPECT_EQ(points.T().Contiguous().ToFlatVector<float>(), vals_points_t);
+
+    // HWC to CHW, with and without a dtype conversion.
+    int64_t h = 5;
+    int64_t w = 40;
+    int64_t ch = 3;
+    std::vector<uint8_t> vals_hwc(h * w * ch);
+    for (size_t i = 0; i < vals_hwc.size(); ++i) {
+        vals_hwc[i] = static_cast<uint8_t>(i % 251);
+    }
+    std::vector<uint8_t> vals_chw(h * w * ch);
+    for (int64_t y = 0; y < h; ++y) {
+        for (int64_t x = 0; x < w; ++x) {
+            for (int64_t c = 0; c < ch; ++c) {
+                vals_chw[(c * h + y) * w + x] = vals_hwc[(y * w + x) * ch + c];
+            }
+        }
+    }
+    Tensor hwc(vals_hwc, {h, w, ch}, Dtype::UInt8, device);
+    Tensor chw = hwc.Permute({2, 0, 1});
+    EXPECT_EQ(chw.Contiguous().ToFlatVector<uint8_t>(), vals_chw);
+    Tensor chw_float = chw.To(Dtype::Float32, /*copy=*/true);
+    EXPECT_TRUE(chw_float.IsContiguous());
+    EXPECT_EQ(chw_float.ToFlatVector<float>(),
+              std::vector<float>(vals_chw.begin(), vals_chw.end()));
+
+    // Batched transpose.
+    int64_t batch = 3;
+    std::vector<double> vals_batch(batch * rows * cols);
+    std::iota(vals_batch.begin(), vals_batch.end(), 0);
+    std::vector<double> vals_batch_t(batch * rows * cols);
+    for (int64_t b = 0; b < batch; ++b) {
+        for (int64_t r = 0; r < rows; ++r) {
+            for (int64_t c = 0; c < cols; ++c) {
+                vals_batch_t[(b * cols + c) * rows + r] =
+                        vals_batch[(b * rows + r) * cols + c];
+            }
+        }
+    }
+    Tensor t_batch(vals_batch, {batch, rows, cols}, Dtype::Float64, device);
+    EXPECT_EQ(t_batch.Transpose(1, 2).Contiguous().ToFlatVector<double>(),
+              vals_batch_t);
+}
+
 TEST_P(TensorPermuteDevices, ShallowCopyConstructor) {
     Device device = GetParam();
     Tensor t({2, 3}, Dtype::Float32, device);
@@ -1064,6 +1255,33 @@ TEST_P(TensorPermuteDevices, Add_) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, AddStridedAndScalar) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({10, 11, 12, 13, 14, 15}), {3, 2},
+             Dtype::Float32, device);
+
+    // Contiguous with scalar, on both sides.
+    EXPECT_EQ((a + 1.f).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ((1.f - a).ToFlatVector<float>(),
+              std::vector<float>({1, 0, -1, -2, -3, -4}));
+
+    // Contiguous with strided.
+    EXPECT_EQ((a + b.T()).ToFlatVector<float>(),
+              std::vector<float>({10, 13, 16, 14, 17, 20}));
+
+    // Contiguous with broadcasted row.
+    Tensor c(std::vector<float>({100, 200, 300}), {3}, Dtype::Float32, device);
+    EXPECT_EQ((a + c).ToFlatVector<float>(),
+              std::vector<float>({100, 201, 302, 103, 204, 305}));
+
+    // Strided unary op.
+    EXPECT_EQ(b.T().Neg().ToFlatVector<float>(),
+              std::vector<float>({-10, -12, -14, -11, -13, -15}));
+}
+
 TEST_P(TensorPermuteDevices, Add_BroadcastException) {
     // A.shape = (   3, 4)
     // B.shape = (2, 3, 4)
@@ -1723,6 +1941,305 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceMinMax) {
+    Device device = GetParam();
+    Tensor src(
+            std::vector<float>({22, 23, 20, 9, 6, 14, 18, 13, 15, 3, 17, 0,
+                                7,  21, 11, 1, 4, 2,  10, 19, 5,  8, 16, 12}),
+            {2, 3, 4}, Dtype::Float32, device);
+    Tensor min, max;
+
+    std::tie(min, max) = src.MinMax({0, 1, 2});
+    EXPECT_EQ(min.GetShape(), SizeVector({}));
+    EXPECT_EQ(min.ToFlatVector<float>(), std::vector<float>({0}));
+    EXPECT_EQ(max.ToFlatVector<float>(), std::vector<float>({23}));
+
+    std::tie(min, max) = src.MinMax({1});
+    EXPECT_EQ(min.GetShape(), SizeVector({2, 4}));
+    EXPECT_EQ(max.GetShape(), SizeVector({2, 4}));
+    EXPECT_EQ(min.ToFlatVector<float>(),
+              std::vector<float>({6, 3, 17, 0, 4, 2, 10, 1}));
+    EXPECT_EQ(max.ToFlatVector<float>(),
+              std::vector<float>({22, 23, 20, 13, 7, 21, 16, 19}));
+
+    std::tie(min, max) = src.MinMax({2}, true);
+    EXPECT_EQ(min.GetShape(), SizeVector({2, 3, 1}));
+    EXPECT_EQ(min.ToFlatVector<float>(),
+              std::vector<float>({9, 6, 0, 1, 2, 5}));
+    EXPECT_EQ(max.ToFlatVector<float>(),
+              std::vector<float>({23, 18, 17, 21, 19, 16}));
+
+    std::tie(min, max) = src.MinMax({});
+    EXPECT_EQ(min.ToFlatVector<float>(), src.ToFlatVector<float>());
+    EXPECT_EQ(max.ToFlatVector<float>(), src.ToFlatVector<float>());
+
+    // Same results as separate Min and Max, including Int dtypes.
+    Tensor src_int = src.To(Dtype::Int32);
+    std::tie(min, max) = src_int.MinMax({0, 2});
+    EXPECT_EQ(min.ToFlatVector<int32_t>(),
+              src_int.Min({0, 2}).ToFlatVector<int32_t>());
+    EXPECT_EQ(max.ToFlatVector<int32_t>(),
+              src_int.Max({0, 2}).ToFlatVector<int32_t>());
+
+    EXPECT_THROW(Tensor::Ones({0}, Dtype::Float32, device).MinMax({0}),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, ReduceMinMaxLargeArray) {
+    Device device = GetParam();
+    int64_t n = 1000003;
+    std::vector<float> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = static_cast<float>((i * 7919) % n);
+    }
+    Tensor src(vals, {n}, Dtype::Float32, device);
+    Tensor min, max;
+    std::tie(min, max) = src.MinMax({0});
+    EXPECT_EQ(min.Item<float>(), 0);
+    EXPECT_EQ(max.Item<float>(), static_cast<float>(n - 1));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMeanVar) {
+    Device device = GetParam();
+    Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+               device);
+    Tensor mean, var;
+
+    std::tie(mean, var) = src.MeanVar({0});
+    EXPECT_EQ(mean.GetShape(), SizeVector({3}));
+    EXPECT_EQ(mean.ToFlatVector<float>(), std::vector<float>({1.5, 2.5, 3.5}));
+    EXPECT_EQ(var.ToFlatVector<float>(),
+              std::vector<float>({2.25, 2.25, 2.25}));
+
+    std::tie(mean, var) = src.MeanVar({1}, true);
+    EXPECT_EQ(mean.GetShape(), SizeVector({2, 1}));
+    EXPECT_EQ(var.GetShape(), SizeVector({2, 1}));
+    EXPECT_EQ(mean.ToFlatVector<float>(), std::vector<float>({1, 4}));
+    for (float v : var.ToFlatVector<float>()) {
+        EXPECT_FLOAT_EQ(v, 2.f / 3.f);
+    }
+
+    std::tie(mean, var) = src.MeanVar({0, 1});
+    EXPECT_EQ(mean.GetShape(), SizeVector({}));
+    EXPECT_FLOAT_EQ(mean.Item<float>(), 2.5);
+    EXPECT_FLOAT_EQ(var.Item<float>(), 35.f / 12.f);
+
+    std::tie(mean, var) = src.MeanVar({});
+    EXPECT_EQ(mean.ToFlatVector<float>(), src.ToFlatVector<float>());
+    EXPECT_EQ(var.ToFlatVector<float>(), std::vector<float>(6, 0));
+
+    EXPECT_THROW(src.To(Dtype::Int64).MeanVar({0}), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, ReduceMeanVarLargeArray) {
+    Device device = GetParam();
+    // Values 0, 1, ..., n - 1 have mean (n - 1) / 2 and variance
+    // (n^2 - 1) / 12. A large offset checks the numerical stability.
+    int64_t n = 1000003;
+    double offset = 1e6;
+    std::vector<double> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = offset + i;
+    }
+    Tensor src(vals, {n}, Dtype::Float64, device);
+    Tensor mean, var;
+    std::tie(mean, var) = src.MeanVar({0});
+    double expected_var = (static_cast<double>(n) * n - 1) / 12;
+    EXPECT_NEAR(mean.Item<double>(), offset + (n - 1) / 2.0, 1e-6);
+    EXPECT_NEAR(var.Item<double>() / expected_var, 1, 1e-9);
+
+    // Two outputs, each reducing half of the values.
+    int64_t m = (n - 1) / 2;
+    std::tie(mean, var) = src.Slice(0, 0, n - 1).View({2, m}).MeanVar({1});
+    std::vector<double> means = mean.ToFlatVector<double>();
+    std::vector<double> vars = var.ToFlatVector<double>();
+    expected_var = (static_cast<double>(m) * m - 1) / 12;
+    EXPECT_NEAR(means[0], offset + (m - 1) / 2.0, 1e-6);
+    EXPECT_NEAR(means[1], offset + m + (m - 1) / 2.0, 1e-6);
+    EXPECT_NEAR(vars[0] / expected_var, 1, 1e-9);
+    EXPECT_NEAR(vars[1] / expected_var, 1, 1e-9);
+}
+
+TEST_P(TensorPermuteDevices, ArgSort) {
+    Device device = GetParam();
+
+    // Stable: equal values keep their order.
+    Tensor a(std::vector<int64_t>({3, -1, 2, 3, 0, -1, 3, 7}), {8},
+             Dtype::Int64, device);
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 5, 4, 2, 0, 3, 6, 7}));
+    EXPECT_EQ(a.Sort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-1, -1, 0, 2, 3, 3, 3, 7}));
+
+    Tensor b(std::vector<float>({1.5, -0.5, -2.5, 0, 100, -100}), {6},
+             Dtype::Float32, device);
+    EXPECT_EQ(b.Sort().ToFlatVector<float>(),
+              std::vector<float>({-100, -2.5, -0.5, 0, 1.5, 100}));
+
+    Tensor c(std::vector<double>({1e10, -1e-10, 0, -1e10}), {4},
+             Dtype::Float64, device);
+    EXPECT_EQ(c.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 1, 2, 0}));
+
+    Tensor d(std::vector<uint8_t>({255, 0, 128, 0}), {4}, Dtype::UInt8,
+             device);
+    EXPECT_EQ(d.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 2, 0}));
+
+    Tensor e(std::vector<bool>({true, false, true, false}), {4}, Dtype::Bool,
+             device);
+    EXPECT_EQ(e.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 0, 2}));
+
+    // Non-contiguous and empty inputs.
+    Tensor f = Tensor(std::vector<int32_t>({5, 0, 4, 0, 3, 0}), {3, 2},
+                      Dtype::Int32, device)
+                       .IndexExtract(1, 0);
+    EXPECT_EQ(f.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 0}));
+    EXPECT_EQ(Tensor::Empty({0}, Dtype::Float32, device).ArgSort().GetShape(),
+              SizeVector({0}));
+
+    EXPECT_ANY_THROW(Tensor::Zeros({2, 2}, Dtype::Float32, device).ArgSort());
+}
+
+TEST_P(TensorPermuteDevices, ArgSortLargeArray) {
+    Device device = GetParam();
+
+    // Spans several parallel chunks and radix passes on CPU.
+    const int64_t n = 200000;
+    std::vector<int64_t> vals(n);
+    uint64_t state = 12345;
+    for (int64_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        vals[i] = static_cast<int64_t>(state >> 20) - (int64_t(1) << 42);
+        if (i % 10 == 0) {
+            vals[i] = 42;
+        }
+    }
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](int64_t i, int64_t j) { return vals[i] < vals[j]; });
+
+    Tensor a(vals, {n}, Dtype::Int64, device);
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(), expected);
+
+    std::vector<float> vals_f(vals.begin(), vals.end());
+    std::vector<float> expected_f = vals_f;
+    std::sort(expected_f.begin(), expected_f.end());
+    Tensor b(vals_f, {n}, Dtype::Float32, device);
+    EXPECT_EQ(b.Sort().ToFlatVector<float>(), expected_f);
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    Device device = GetParam();
+
+    Tensor a(std::vector<int64_t>({3, -1, 2, 3, 0, -1, 3, 7}), {8},
+             Dtype::Int64, device);
+    Tensor values, inverse_indices, counts;
+    std::tie(values, inverse_indices, counts) = a.Unique();
+    EXPECT_EQ(values.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-1, 0, 2, 3, 7}));
+    EXPECT_EQ(inverse_indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 0, 2, 3, 1, 0, 3, 4}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 1, 3, 1}));
+    EXPECT_EQ(values.IndexGet({inverse_indices}).ToFlatVector<int64_t>(),
+              a.ToFlatVector<int64_t>());
+
+    std::tie(values, inverse_indices, counts) =
+            Tensor::Empty({0}, Dtype::Float32, device).Unique();
+    EXPECT_EQ(values.GetShape(), SizeVector({0}));
+    EXPECT_EQ(inverse_indices.GetShape(), SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, CumSum) {
+    Device device = GetParam();
+
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    EXPECT_EQ(a.CumSum(1).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 3, 3, 7, 12}));
+    EXPECT_EQ(a.CumSum(-1, true).ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 0, 3, 7}));
+    EXPECT_EQ(a.CumSum(0).ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 5, 7}));
+    EXPECT_EQ(a.CumSum(0, true).ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 0, 1, 2}));
+    EXPECT_EQ(a.T().CumSum(1).ToFlatVector<float>(),
+              std::vector<float>({0, 3, 1, 5, 2, 7}));
+
+    Tensor b(std::vector<int32_t>({1, 2, 3}), {3}, Dtype::Int32, device);
+    EXPECT_EQ(b.CumSum(0).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 3, 6}));
+
+    EXPECT_ANY_THROW(Tensor::Zeros({3}, Dtype::Bool, device).CumSum(0));
+}
+
+TEST_P(TensorPermuteDevices, CumSumLargeArray) {
+    Device device = GetParam();
+
+    // A single long line is scanned in parallel chunks on CPU.
+    const int64_t n = 300000;
+    std::vector<int64_t> vals(n);
+    std::vector<int64_t> expected(n);
+    std::vector<int64_t> expected_exclusive(n);
+    int64_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = i % 7 - 3;
+        expected_exclusive[i] = sum;
+        sum += vals[i];
+        expected[i] = sum;
+    }
+    Tensor a(vals, {n}, Dtype::Int64, device);
+    EXPECT_EQ(a.CumSum(0).ToFlatVector<int64_t>(), expected);
+    EXPECT_EQ(a.CumSum(0, true).ToFlatVector<int64_t>(), expected_exclusive);
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduce) {
+    Device device = GetParam();
+
+    Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}),
+               {6, 2}, Dtype::Float32, device);
+    // Segments [0, 1), [1, 4), [4, 4) and [4, 6).
+    Tensor offsets(std::vector<int64_t>({0, 1, 4, 4}), {4}, Dtype::Int64,
+                   device);
+
+    Tensor sum = src.SegmentSum(offsets);
+    EXPECT_EQ(sum.GetShape(), SizeVector({4, 2}));
+    EXPECT_EQ(sum.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 12, 15, 0, 0, 18, 20}));
+
+    Tensor min = src.SegmentMin(offsets);
+    std::vector<float> min_vals = min.ToFlatVector<float>();
+    EXPECT_EQ(min_vals[2], 2);
+    EXPECT_EQ(min_vals[3], 3);
+    EXPECT_EQ(min_vals[4], std::numeric_limits<float>::max());
+    EXPECT_EQ(min_vals[6], 8);
+
+    Tensor max = src.SegmentMax(offsets);
+    const float lowest = std::numeric_limits<float>::lowest();
+    EXPECT_EQ(max.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 6, 7, lowest, lowest, 10, 11}));
+
+    // Per-voxel mean of points sorted by voxel keys.
+    Tensor keys(std::vector<int64_t>({5, 2, 5, 2, 9}), {5}, Dtype::Int64,
+                device);
+    Tensor points(std::vector<float>({1, 1, 2, 2, 3, 3, 4, 4, 5, 5}), {5, 2},
+                  Dtype::Float32, device);
+    Tensor values, inverse_indices, counts;
+    std::tie(values, inverse_indices, counts) = keys.Unique();
+    Tensor sorted_points = points.IndexGet({keys.ArgSort()});
+    Tensor means = sorted_points.SegmentSum(counts.CumSum(0, true)) /
+                   counts.To(Dtype::Float32).View({3, 1});
+    EXPECT_EQ(means.ToFlatVector<float>(),
+              std::vector<float>({3, 3, 2, 2, 5, 5}));
+
+    EXPECT_ANY_THROW(src.SegmentSum(offsets.To(Dtype::Int32)));
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     Device device = GetParam();
     Tensor src(std::vector<float>({0, 1, 4, 9, 16, 25}), {2, 3}, Dtype::Float32,
@@ -2127,6 +2644,111 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, NonZeroLargeArray) {
+    Device device = GetParam();
+
+    // Spans several parallel chunks on CPU.
+    const int64_t rows = 1000;
+    const int64_t cols = 300;
+    std::vector<int32_t> vals(rows * cols, 0);
+    std::vector<int64_t> expected_rows;
+    std::vector<int64_t> expected_cols;
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        if (i % 7 == 0 || i % 11 == 0) {
+            vals[i] = static_cast<int32_t>(i);
+            if (i != 0) {
+                expected_rows.push_back(i / cols);
+                expected_cols.push_back(i % cols);
+            }
+        }
+    }
+    Tensor a(vals, {rows, cols}, Dtype::Int32, device);
+    Tensor result = a.NonZero();
+    EXPECT_EQ(result.GetShape(),
+              SizeVector({2, static_cast<int64_t>(expected_rows.size())}));
+    EXPECT_EQ(result[0].ToFlatVector<int64_t>(), expected_rows);
+    EXPECT_EQ(result[1].ToFlatVector<int64_t>(), expected_cols);
+
+    // Non-contiguous input.
+    Tensor b = a.T();
+    Tensor result_b = b.NonZero();
+    Tensor expected_b = b.Contiguous().NonZero();
+    EXPECT_EQ(result_b.ToFlatVector<int64_t>(),
+              expected_b.ToFlatVector<int64_t>());
+}
+
+TEST_P(TensorPermuteDevices, MaskedSelect) {
+    Device device = GetParam();
+
+    Tensor src(std::vector<float>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}),
+               {3, 2, 2}, Dtype::Float32, device);
+
+    // Mask over the first dimension selects rows.
+    Tensor mask_rows(std::vector<bool>({true, false, true}), {3}, Dtype::Bool,
+                     device);
+    Tensor dst = src.MaskedSelect(mask_rows);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 2, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 8, 9, 10, 11}));
+
+    // Mask over the leading dimensions.
+    Tensor mask_2d(std::vector<bool>({false, true, true, false, false, true}),
+                   {3, 2}, Dtype::Bool, device);
+    dst = src.MaskedSelect(mask_2d);
+    EXPECT_EQ(dst.GetShape(), SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({2, 3, 4, 5, 10, 11}));
+
+    // Full mask, same as IndexGet with the NonZero indices.
+    Tensor mask_full = src.Gt(Tensor::Full({}, 4.5, Dtype::Float32, device));
+    dst = src.MaskedSelect(mask_full);
+    EXPECT_EQ(dst.GetShape(), SizeVector({7}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              src.IndexGet(mask_full.NonZeroNumpy()).ToFlatVector<float>());
+    EXPECT_EQ(src.IndexGet({mask_full}).ToFlatVector<float>(),
+              dst.ToFlatVector<float>());
+
+    // Nothing selected.
+    Tensor mask_none(std::vector<bool>({false, false, false}), {3},
+                     Dtype::Bool, device);
+    dst = src.MaskedSelect(mask_none);
+    EXPECT_EQ(dst.GetShape(), SizeVector({0, 2, 2}));
+
+    // Non-contiguous source.
+    Tensor src_t = src.Slice(2, 1, 2);
+    dst = src_t.MaskedSelect(mask_rows);
+    EXPECT_EQ(dst.GetShape(), SizeVector({2, 2, 1}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), std::vector<float>({1, 3, 9, 11}));
+
+    // Invalid masks.
+    EXPECT_ANY_THROW(src.MaskedSelect(Tensor::Ones({3}, Dtype::Int64, device)));
+    EXPECT_ANY_THROW(src.MaskedSelect(Tensor::Ones({2}, Dtype::Bool, device)));
+}
+
+TEST_P(TensorPermuteDevices, MaskedSelectLargeArray) {
+    Device device = GetParam();
+
+    const int64_t num_points = 100000;
+    std::vector<float> vals(num_points * 3);
+    std::vector<bool> mask_vals(num_points);
+    std::vector<float> expected;
+    for (int64_t i = 0; i < num_points; ++i) {
+        mask_vals[i] = i % 3 != 0;
+        for (int64_t j = 0; j < 3; ++j) {
+            vals[i * 3 + j] = static_cast<float>(i * 3 + j);
+            if (mask_vals[i]) {
+                expected.push_back(vals[i * 3 + j]);
+            }
+        }
+    }
+    Tensor points(vals, {num_points, 3}, Dtype::Float32, device);
+    Tensor mask(mask_vals, {num_points}, Dtype::Bool, device);
+    Tensor dst = points.IndexGet({mask});
+    EXPECT_EQ(dst.GetShape(),
+              SizeVector({static_cast<int64_t>(expected.size() / 3), 3}));
+    EXPECT_EQ(dst.ToFlatVector<float>(), expected);
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     Device device = GetParam();
 
@@ -2204,6 +2826,83 @@ TEST_P(TensorPermuteDevices, CreationOnes) {
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>(a.NumElements(), 1));
 }
 
+TEST_P(TensorPermuteDevices, CreationRand) {
+    Device device = GetParam();
+
+    // Known answer of Philox4x32-10 for a zero key and counter.
+    kernel::Philox4x32::Result r = kernel::Philox4x32::Generate(0, 0);
+    EXPECT_EQ(r.x[0], 0x6627e8d5u);
+    EXPECT_EQ(r.x[1], 0xe169c58du);
+    EXPECT_EQ(r.x[2], 0xbc57ac4cu);
+    EXPECT_EQ(r.x[3], 0x9b00dbd8u);
+
+    Tensor a = Tensor::Rand({100, 10}, Dtype::Float32, device, -2, 2, 7);
+    EXPECT_EQ(a.GetShape(), SizeVector({100, 10}));
+    EXPECT_EQ(a.GetDevice(), device);
+    std::vector<float> values = a.ToFlatVector<float>();
+    double mean = 0;
+    for (float v : values) {
+        EXPECT_GE(v, -2);
+        EXPECT_LT(v, 2);
+        mean += v / values.size();
+    }
+    EXPECT_NEAR(mean, 0, 0.2);
+
+    // The values only depend on the seed, also across devices.
+    EXPECT_EQ(Tensor::Rand({100, 10}, Dtype::Float32, Device("CPU:0"), -2, 2,
+                           7)
+                      .ToFlatVector<float>(),
+              values);
+    EXPECT_NE(Tensor::Rand({100, 10}, Dtype::Float32, device, -2, 2, 8)
+                      .ToFlatVector<float>(),
+              values);
+
+    std::vector<double> values_f64 =
+            Tensor::Rand({1000}, Dtype::Float64, device).ToFlatVector<double>();
+    for (double v : values_f64) {
+        EXPECT_GE(v, 0);
+        EXPECT_LT(v, 1);
+    }
+
+    EXPECT_THROW(Tensor::Rand({2}, Dtype::Int32, device), std::runtime_error);
+    EXPECT_THROW(Tensor::Rand({2}, Dtype::Float32, device, 1, 1),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, CreationRandint) {
+    Device device = GetParam();
+
+    Tensor a = Tensor::Randint(-3, 4, {1000}, Dtype::Int32, device, 11);
+    EXPECT_EQ(a.GetDtype(), Dtype::Int32);
+    std::vector<int> counts(7, 0);
+    for (int32_t v : a.ToFlatVector<int32_t>()) {
+        ASSERT_GE(v, -3);
+        ASSERT_LT(v, 4);
+        counts[v + 3]++;
+    }
+    for (int count : counts) {
+        EXPECT_GT(count, 100);
+    }
+    EXPECT_EQ(a.ToFlatVector<int32_t>(),
+              Tensor::Randint(-3, 4, {1000}, Dtype::Int32, device, 11)
+                      .ToFlatVector<int32_t>());
+
+    std::vector<int64_t> values_i64 =
+            Tensor::Randint(0, int64_t(1) << 40, {100}, Dtype::Int64, device)
+                    .ToFlatVector<int64_t>();
+    for (int64_t v : values_i64) {
+        EXPECT_GE(v, 0);
+        EXPECT_LT(v, int64_t(1) << 40);
+    }
+
+    EXPECT_THROW(Tensor::Randint(0, 300, {2}, Dtype::UInt8, device),
+                 std::runtime_error);
+    EXPECT_THROW(Tensor::Randint(0, 2, {2}, Dtype::Float32, device),
+                 std::runtime_error);
+    EXPECT_THROW(Tensor::Randint(2, 2, {2}, Dtype::Int64, device),
+                 std::runtime_error);
+}
+
 TEST_P(TensorPermuteDevices, ScalarOperatorOverload) {
     Device device = GetParam();
     Tensor a;
@@ -2380,5 +3079,77 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+
+TEST_P(TensorPermuteDevices, OutVariants) {
+    Device device = GetParam();
+    Tensor a(std::vector<float>({0, 1, 2, 3, 4, 5}), {2, 3}, Dtype::Float32,
+             device);
+    Tensor b(std::vector<float>({1, 1, 1}), {3}, Dtype::Float32, device);
+
+    // Element-wise ops write to the preallocated output, broadcasting inputs.
+    Tensor dst = Tensor::Empty({2, 3}, Dtype::Float32, device);
+    void* dst_ptr = dst.GetDataPtr();
+    Tensor ret = a.Add(b, dst);
+    EXPECT_EQ(ret.GetDataPtr(), dst_ptr);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 4, 5, 6}));
+    a.Mul(b, dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+    a.Neg(dst);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, -1, -2, -3, -4, -5}));
+
+    // Steady-state calls do not allocate.
+    MemoryStatistics stats = MemoryManager::GetMemoryStatistics(device);
+    a.Sub(b, dst);
+    a.Sqrt(dst);
+    EXPECT_EQ(MemoryManager::GetMemoryStatistics(device).num_allocations_,
+              stats.num_allocations_);
+
+    Tensor mask = Tensor::Empty({2, 3}, Dtype::Bool, device);
+    a.Gt(b, mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({false, false, true, true, true, true}));
+    mask.LogicalNot(mask);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, false, false, false, false}));
+    // Boolean ops require a boolean output.
+    EXPECT_ANY_THROW(a.Gt(b, dst));
+
+    // Reductions.
+    Tensor sum = Tensor::Empty({3}, Dtype::Float32, device);
+    a.Sum({0}, false, sum);
+    EXPECT_EQ(sum.ToFlatVector<float>(), std::vector<float>({3, 5, 7}));
+    Tensor mean = Tensor::Empty({2, 1}, Dtype::Float32, device);
+    a.Mean({1}, true, mean);
+    EXPECT_EQ(mean.ToFlatVector<float>(), std::vector<float>({1, 4}));
+    Tensor argmax = Tensor::Empty({2}, Dtype::Int64, device);
+    a.ArgMax({1}, argmax);
+    EXPECT_EQ(argmax.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 2}));
+    EXPECT_ANY_THROW(a.Sum({0}, true, sum));
+
+    // Indexing, casting and copying.
+    Tensor index(std::vector<int64_t>({2, 0}), {2}, Dtype::Int64, device);
+    Tensor indexed = Tensor::Empty({2}, Dtype::Float32, device);
+    a[1].IndexGet({index}, indexed);
+    EXPECT_EQ(indexed.ToFlatVector<float>(), std::vector<float>({5, 3}));
+    Tensor a_int = Tensor::Empty({2, 3}, Dtype::Int32, device);
+    a.To(Dtype::Int32, a_int);
+    EXPECT_EQ(a_int.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 3, 4, 5}));
+    EXPECT_ANY_THROW(a.To(Dtype::Int64, a_int));
+    Tensor a_cpu = Tensor::Empty({2, 3}, Dtype::Float32, Device("CPU:0"));
+    a.Copy(a_cpu);
+    EXPECT_EQ(a_cpu.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    // Shapes must match exactly, no broadcasting of the output.
+    Tensor wrong_shape = Tensor::Empty({3}, Dtype::Float32, device);
+    EXPECT_ANY_THROW(a.Add(b, wrong_shape));
+    EXPECT_ANY_THROW(a.Sqrt(wrong_shape));
+    EXPECT_ANY_THROW(a.Copy(wrong_shape));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -318,6 +318,84 @@ TEST_P(TensorListPermuteDevices, Extend) {
                                   2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3}));
 }
 
+TEST_P(TensorListPermuteDevices, Reserve) {
+    Device device = GetParam();
+
+    TensorList tensor_list({3}, Dtype::Float32, device);
+    tensor_list.PushBack(Tensor::Ones({3}, Dtype::Float32, device));
+    tensor_list.Reserve(100);
+    const int64_t reserved_size = tensor_list.GetReservedSize();
+    EXPECT_GE(reserved_size, 100);
+    const void* data_ptr = tensor_list.GetInternalTensor().GetDataPtr();
+
+    for (int i = 0; i < 99; ++i) {
+        tensor_list.PushBack(Tensor::Zeros({3}, Dtype::Float32, device));
+    }
+    EXPECT_EQ(tensor_list.GetSize(), 100);
+    EXPECT_EQ(tensor_list.GetReservedSize(), reserved_size);
+    EXPECT_EQ(tensor_list.GetInternalTensor().GetDataPtr(), data_ptr);
+    EXPECT_EQ(tensor_list[0].ToFlatVector<float>(),
+              std::vector<float>({1, 1, 1}));
+
+    // Reserving less than the reserved size is a no-op.
+    tensor_list.Reserve(10);
+    EXPECT_EQ(tensor_list.GetReservedSize(), reserved_size);
+}
+
+TEST_P(TensorListPermuteDevices, Chunked) {
+    Device device = GetParam();
+
+    TensorList tensor_list({2}, Dtype::Float32, device);
+    tensor_list.SetChunked(true);
+    EXPECT_TRUE(tensor_list.IsChunked());
+    const void* data_ptr = tensor_list.GetInternalTensor().GetDataPtr();
+
+    // Frames of different sizes, each filled with its index.
+    std::vector<float> expected;
+    for (int frame = 0; frame < 6; ++frame) {
+        const int64_t frame_size = frame + 1;
+        tensor_list.Extend(TensorList(Tensor::Full(
+                {frame_size, 2}, static_cast<float>(frame), Dtype::Float32,
+                device)));
+        expected.insert(expected.end(), frame_size * 2,
+                        static_cast<float>(frame));
+    }
+    tensor_list.PushBack(Tensor::Full({2}, 6.f, Dtype::Float32, device));
+    expected.insert(expected.end(), 2, 6.f);
+    EXPECT_EQ(tensor_list.GetSize(), 22);
+    EXPECT_GE(tensor_list.GetReservedSize(), 22);
+
+    // Element access and assignment across the blocks without compaction.
+    EXPECT_EQ(tensor_list[0].ToFlatVector<float>(),
+              std::vector<float>({0, 0}));
+    EXPECT_EQ(tensor_list[20].ToFlatVector<float>(),
+              std::vector<float>({5, 5}));
+    EXPECT_EQ(tensor_list[-1].ToFlatVector<float>(),
+              std::vector<float>({6, 6}));
+    tensor_list[3] = Tensor::Full({2}, 10.f, Dtype::Float32, device);
+    expected[6] = expected[7] = 10.f;
+
+    // Compacted on access to the contiguous data.
+    const int64_t reserved_size = tensor_list.GetReservedSize();
+    EXPECT_EQ(tensor_list.AsTensor().ToFlatVector<float>(), expected);
+    EXPECT_EQ(tensor_list.GetReservedSize(), reserved_size);
+    EXPECT_NE(tensor_list.GetInternalTensor().GetDataPtr(), data_ptr);
+
+    // Copies keep the mode, and extending with itself copies first.
+    TensorList copied(tensor_list);
+    EXPECT_TRUE(copied.IsChunked());
+    copied += copied;
+    EXPECT_EQ(copied.GetSize(), 44);
+    std::vector<float> expected_twice = expected;
+    expected_twice.insert(expected_twice.end(), expected.begin(),
+                          expected.end());
+    EXPECT_EQ(copied.AsTensor().ToFlatVector<float>(), expected_twice);
+
+    tensor_list.Clear();
+    EXPECT_TRUE(tensor_list.IsChunked());
+    EXPECT_EQ(tensor_list.GetSize(), 0);
+}
+
 TEST_P(TensorListPermuteDevices, Clear) {
     Device device = GetParam();
 
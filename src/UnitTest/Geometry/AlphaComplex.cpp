@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AlphaComplex.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TetraMesh.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Tetrahedralization of a jittered grid of n x n x n points, each cube split
+/// into the 6 tetras around its diagonal.
+std::shared_ptr<geometry::TetraMesh> MakeGridTetraMesh(int n) {
+    auto tetra_mesh = std::make_shared<geometry::TetraMesh>();
+    tetra_mesh->vertices_.resize(n * n * n);
+    Rand(tetra_mesh->vertices_, Eigen::Vector3d(-0.2, -0.2, -0.2),
+         Eigen::Vector3d(0.2, 0.2, 0.2), 0);
+    auto index = [n](int x, int y, int z) { return (z * n + y) * n + x; };
+    for (int z = 0; z < n; ++z) {
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                tetra_mesh->vertices_[index(x, y, z)] +=
+                        Eigen::Vector3d(x, y, z);
+            }
+        }
+    }
+    const int paths[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2},
+                             {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    for (int z = 0; z + 1 < n; ++z) {
+        for (int y = 0; y + 1 < n; ++y) {
+            for (int x = 0; x + 1 < n; ++x) {
+                for (const auto &path : paths) {
+                    Eigen::Vector3i corner(x, y, z);
+                    Eigen::Vector4i tetra;
+                    tetra(0) = index(x, y, z);
+                    for (int k = 0; k < 3; ++k) {
+                        corner(path[k])++;
+                        tetra(k + 1) = index(corner(0), corner(1), corner(2));
+                    }
+                    tetra_mesh->tetras_.push_back(tetra);
+                }
+            }
+        }
+    }
+    return tetra_mesh;
+}
+
+/// The faces of the tetras with a circumradius of at most alpha that belong
+/// to exactly one of them, in the order of the tetras.
+std::vector<Eigen::Vector3i> ReferenceAlphaShapeTriangles(
+        const geometry::TetraMesh &tetra_mesh,
+        const std::vector<double> &tetra_radii,
+        double alpha) {
+    std::vector<Eigen::Vector3i> triangles;
+    for (size_t tidx = 0; tidx < tetra_mesh.tetras_.size(); ++tidx) {
+        const Eigen::Vector4i &tetra = tetra_mesh.tetras_[tidx];
+        if (tetra_radii[tidx] <= alpha) {
+            triangles.push_back(geometry::TriangleMesh::GetOrderedTriangle(
+                    tetra(0), tetra(1), tetra(2)));
+            triangles.push_back(geometry::TriangleMesh::GetOrderedTriangle(
+                    tetra(0), tetra(1), tetra(3)));
+            triangles.push_back(geometry::TriangleMesh::GetOrderedTriangle(
+                    tetra(0), tetra(2), tetra(3)));
+            triangles.push_back(geometry::TriangleMesh::GetOrderedTriangle(
+                    tetra(1), tetra(2), tetra(3)));
+        }
+    }
+    std::map<std::tuple<int, int, int>, int> count;
+    for (const Eigen::Vector3i &triangle : triangles) {
+        count[std::make_tuple(triangle(0), triangle(1), triangle(2))]++;
+    }
+    std::vector<Eigen::Vector3i> boundary;
+    for (const Eigen::Vector3i &triangle : triangles) {
+        if (count[std::make_tuple(triangle(0), triangle(1), triangle(2))] ==
+            1) {
+            boundary.push_back(triangle);
+        }
+    }
+    return boundary;
+}
+
+}  // unnamed namespace
+
+TEST(AlphaComplex, ExtractAlphaShape) {
+    auto tetra_mesh = MakeGridTetraMesh(5);
+    geometry::PointCloud pcd(tetra_mesh->vertices_);
+    pcd.colors_.resize(pcd.points_.size());
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+
+    auto alpha_complex =
+            geometry::AlphaComplex::CreateFromPointCloud(pcd, tetra_mesh);
+    ASSERT_EQ(alpha_complex->NumTetras(), tetra_mesh->tetras_.size());
+    ASSERT_EQ(alpha_complex->triangle_alphas_.size(),
+              alpha_complex->NumTriangles());
+    for (const Eigen::Vector2d &alphas : alpha_complex->triangle_alphas_) {
+        EXPECT_LT(alphas(0), alphas(1));
+    }
+
+    std::vector<double> radii = alpha_complex->tetra_radii_;
+    std::sort(radii.begin(), radii.end());
+    for (double alpha : {0.0, radii[radii.size() / 4], radii[radii.size() / 2],
+                         radii[radii.size() / 2] + 1e-6, radii.back(), 1e3}) {
+        auto mesh = alpha_complex->ExtractAlphaShape(alpha);
+
+        // Reference mesh, before removing the unreferenced vertices.
+        geometry::TriangleMesh mesh_gt;
+        mesh_gt.vertices_ = pcd.points_;
+        mesh_gt.vertex_colors_ = pcd.colors_;
+        mesh_gt.triangles_ = ReferenceAlphaShapeTriangles(
+                *tetra_mesh, alpha_complex->tetra_radii_, alpha);
+        mesh_gt.RemoveUnreferencedVertices();
+        ExpectEQ(mesh->vertices_, mesh_gt.vertices_);
+        ExpectEQ(mesh->vertex_colors_, mesh_gt.vertex_colors_);
+        ExpectEQ(mesh->triangles_, mesh_gt.triangles_);
+        EXPECT_EQ(mesh->triangles_.size() == 0, alpha < radii.front());
+    }
+
+    // The convex hull of the grid, 2 triangles per square on its faces.
+    EXPECT_EQ(alpha_complex->ExtractAlphaShape(1e3)->triangles_.size(),
+              size_t(6 * 4 * 4 * 2));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+// A sphere whose lower cap is fixed and whose top vertex is a handle.
+static void MakeSphereConstraints(const geometry::TriangleMesh &mesh,
+                                  std::vector<int> &constraint_ids,
+                                  std::vector<Eigen::Vector3d> &constraint_pos,
+                                  const Eigen::Vector3d &handle_offset) {
+    constraint_ids.clear();
+    constraint_pos.clear();
+    for (int i = 0; i < int(mesh.vertices_.size()); ++i) {
+        if (mesh.vertices_[i](2) < -0.8) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh.vertices_[i]);
+        } else if (mesh.vertices_[i](2) > 0.999) {
+            constraint_ids.push_back(i);
+            constraint_pos.push_back(mesh.vertices_[i] + handle_offset);
+        }
+    }
+}
+
+TEST(AsRigidAsPossibleDeformer, ReusesFactorization) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    MakeSphereConstraints(*sphere, constraint_ids, constraint_pos,
+                          Eigen::Vector3d(0.3, 0.0, 0.2));
+
+    geometry::AsRigidAsPossibleDeformer deformer(*sphere, constraint_ids);
+    EXPECT_EQ(deformer.NumConstraints(), constraint_ids.size());
+    auto mesh = deformer.Deform(constraint_pos, 10);
+    EXPECT_EQ(mesh->vertices_.size(), sphere->vertices_.size());
+    EXPECT_EQ(mesh->triangles_, sphere->triangles_);
+    for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+        ExpectEQ(mesh->vertices_[constraint_ids[idx]], constraint_pos[idx]);
+    }
+    // The handle pulls the upper half of the sphere along.
+    double mean_dx = 0;
+    int n_upper = 0;
+    for (size_t i = 0; i < sphere->vertices_.size(); ++i) {
+        if (sphere->vertices_[i](2) > 0.5) {
+            mean_dx += mesh->vertices_[i](0) - sphere->vertices_[i](0);
+            n_upper++;
+        }
+    }
+    EXPECT_GT(mean_dx / n_upper, 0.1);
+
+    // Other handle positions give the same result as a new deformer.
+    MakeSphereConstraints(*sphere, constraint_ids, constraint_pos,
+                          Eigen::Vector3d(-0.2, 0.1, 0.0));
+    auto mesh_ref = sphere->DeformAsRigidAsPossible(
+            constraint_ids, constraint_pos, 10,
+            geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed);
+    mesh = deformer.Deform(
+            constraint_pos, 10,
+            geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed);
+    ExpectEQ(mesh_ref->vertices_, mesh->vertices_);
+}
+
+TEST(AsRigidAsPossibleDeformer, WarmStart) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    MakeSphereConstraints(*sphere, constraint_ids, constraint_pos,
+                          Eigen::Vector3d(0.3, 0.0, 0.2));
+    geometry::AsRigidAsPossibleDeformer deformer(*sphere, constraint_ids);
+
+    // Continuing from the result of a previous call equals iterating longer.
+    std::vector<Eigen::Vector3d> vertices;
+    deformer.Deform(constraint_pos, vertices, 5);
+    EXPECT_EQ(vertices.size(), sphere->vertices_.size());
+    deformer.Deform(constraint_pos, vertices, 5);
+    std::vector<Eigen::Vector3d> vertices_ref;
+    deformer.Deform(constraint_pos, vertices_ref, 10);
+    ExpectEQ(vertices_ref, vertices);
+
+    utility::SetNumThreads(4);
+    std::vector<Eigen::Vector3d> vertices_threads;
+    deformer.Deform(constraint_pos, vertices_threads, 10);
+    utility::SetNumThreads(0);
+    ExpectEQ(vertices_ref, vertices_threads);
+}
+
+TEST(AsRigidAsPossibleDeformer, InvalidConstraints) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    EXPECT_THROW(geometry::AsRigidAsPossibleDeformer(
+                         *sphere, {int(sphere->vertices_.size())}),
+                 std::runtime_error);
+    geometry::AsRigidAsPossibleDeformer deformer(*sphere, {0, 1});
+    EXPECT_THROW(deformer.Deform({Eigen::Vector3d::Zero()}, 1),
+                 std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Random points, normals and colors that are exact in single precision.
+geometry::PointCloud CreateFloatExactPointCloud(size_t size) {
+    std::vector<float> points(size * 3);
+    std::vector<float> normals(size * 3);
+    std::vector<float> colors(size * 3);
+    Rand(points, 0.0f, 10.0f, 0);
+    Rand(normals, -1.0f, 1.0f, 1);
+    Rand(colors, 0.0f, 1.0f, 2);
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.normals_.resize(size);
+    pc.colors_.resize(size);
+    auto at = [](const std::vector<float> &values, size_t i) {
+        return Eigen::Vector3f(values[i * 3], values[i * 3 + 1],
+                               values[i * 3 + 2]);
+    };
+    for (size_t i = 0; i < size; i++) {
+        pc.points_[i] = at(points, i).cast<double>();
+        pc.normals_[i] = at(normals, i).normalized().cast<double>();
+        pc.colors_[i] = at(colors, i).cast<double>();
+    }
+    return pc;
+}
+
+}  // unnamed namespace
+
+TEST(CompactPointCloud, ConvertPointCloud) {
+    const geometry::PointCloud pc = CreateFloatExactPointCloud(1000);
+    auto compact = geometry::CompactPointCloud::CreateFromPointCloud(pc);
+    EXPECT_TRUE(compact->HasNormals());
+    EXPECT_TRUE(compact->HasColors());
+    EXPECT_EQ(compact->GetStorageBytes(), 1000u * 36u);
+    ExpectEQ(pc.GetMinBound(), compact->GetMinBound());
+    ExpectEQ(pc.GetMaxBound(), compact->GetMaxBound());
+
+    auto round_trip = compact->ToPointCloud();
+    ExpectEQ(pc.points_, round_trip->points_, 0.0);
+    ExpectEQ(pc.normals_, round_trip->normals_, 0.0);
+    ExpectEQ(pc.colors_, round_trip->colors_, 0.0);
+
+    compact->Clear();
+    EXPECT_TRUE(compact->IsEmpty());
+    ExpectEQ(Zero3d, compact->GetMinBound());
+}
+
+TEST(CompactPointCloud, Transform) {
+    const geometry::PointCloud pc = CreateFloatExactPointCloud(1000);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.2, 1.0});
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, 2.0, 3.0);
+    auto compact = geometry::CompactPointCloud::CreateFromPointCloud(pc);
+    compact->Transform(transformation);
+    geometry::PointCloud ref = pc;
+    ref.Transform(transformation);
+    auto result = compact->ToPointCloud();
+    ExpectEQ(ref.points_, result->points_, 1e-5);
+    ExpectEQ(ref.normals_, result->normals_, 1e-6);
+}
+
+TEST(CompactPointCloud, RemoveNonFinitePoints) {
+    geometry::CompactPointCloud compact;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    compact.points_ = {{0, 0, 0}, {nan, 0, 0}, {1, 0, 0}, {0, inf, 0}};
+    compact.colors_ = {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}};
+    compact.RemoveNonFinitePoints(true, false);
+    EXPECT_EQ(compact.points_.size(), 3u);
+    compact.RemoveNonFinitePoints();
+    ASSERT_EQ(compact.points_.size(), 2u);
+    ExpectEQ(compact.points_[1], Eigen::Vector3f(1, 0, 0));
+    ExpectEQ(compact.colors_[1], Eigen::Vector3f(2, 2, 2));
+}
+
+TEST(CompactPointCloud, VoxelDownSample) {
+    const geometry::PointCloud pc = CreateFloatExactPointCloud(10000);
+    auto compact = geometry::CompactPointCloud::CreateFromPointCloud(pc);
+    auto ref = pc.VoxelDownSample(0.7);
+    auto result = compact->VoxelDownSample(0.7)->ToPointCloud();
+    ExpectEQ(ref->points_, result->points_, 1e-5);
+    ExpectEQ(ref->normals_, result->normals_, 1e-6);
+    ExpectEQ(ref->colors_, result->colors_, 1e-6);
+
+    EXPECT_ANY_THROW(compact->VoxelDownSample(0.0));
+}
+
+TEST(CompactPointCloud, EstimateNormals) {
+    // More points than are searched at once.
+    const geometry::PointCloud pc = CreateFloatExactPointCloud(70000);
+    auto expect_normals_eq = [&](const geometry::KDTreeSearchParam &param) {
+        auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+        geometry::PointCloud ref = pc;
+        ref.EstimateNormals(*graph);
+        auto compact = geometry::CompactPointCloud::CreateFromPointCloud(pc);
+        compact->EstimateNormals(param);
+        ExpectEQ(ref.normals_, compact->ToPointCloud()->normals_, 1e-6);
+    };
+    expect_normals_eq(geometry::KDTreeSearchParamKNN(10));
+    expect_normals_eq(geometry::KDTreeSearchParamHybrid(0.5, 20));
+
+    geometry::CompactPointCloud empty;
+    empty.EstimateNormals();
+    EXPECT_FALSE(empty.HasNormals());
+}
+
+}  // namespace unit_test
+}  // namespace open3d
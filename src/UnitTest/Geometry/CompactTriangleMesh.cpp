@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactTriangleMesh.h"
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(CompactTriangleMesh, ConvertTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->ComputeVertexNormals();
+    mesh->PaintUniformColor(Eigen::Vector3d(0.25, 0.5, 0.75));
+    auto compact = geometry::CompactTriangleMesh::CreateFromTriangleMesh(*mesh);
+    EXPECT_TRUE(compact->HasTriangles());
+    EXPECT_TRUE(compact->HasVertexNormals());
+    EXPECT_TRUE(compact->HasVertexColors());
+    EXPECT_EQ(compact->GetStorageBytes(),
+              mesh->vertices_.size() * 36 + mesh->triangles_.size() * 12);
+
+    auto round_trip = compact->ToTriangleMesh();
+    ExpectEQ(mesh->vertices_, round_trip->vertices_, 1e-6);
+    ExpectEQ(mesh->vertex_normals_, round_trip->vertex_normals_, 1e-6);
+    ExpectEQ(mesh->vertex_colors_, round_trip->vertex_colors_, 0.0);
+    ExpectEQ(mesh->triangles_, round_trip->triangles_);
+
+    auto cloud = compact->ToCompactPointCloud();
+    EXPECT_EQ(cloud->points_.size(), mesh->vertices_.size());
+    EXPECT_TRUE(cloud->HasNormals());
+
+    compact->Clear();
+    EXPECT_TRUE(compact->IsEmpty());
+    EXPECT_FALSE(compact->HasTriangles());
+}
+
+TEST(CompactTriangleMesh, ComputeVertexNormals) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    auto compact = geometry::CompactTriangleMesh::CreateFromTriangleMesh(*mesh);
+    for (bool normalized : {true, false}) {
+        compact->vertex_normals_.clear();
+        geometry::TriangleMesh ref = *compact->ToTriangleMesh();
+        ref.ComputeVertexNormals(normalized);
+        compact->ComputeVertexNormals(normalized);
+        auto result = compact->ToTriangleMesh();
+        ExpectEQ(ref.vertex_normals_, result->vertex_normals_, 1e-6);
+    }
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.2, 1.0});
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, 2.0, 3.0);
+    compact->ComputeVertexNormals();
+    geometry::TriangleMesh ref = *compact->ToTriangleMesh();
+    ref.Transform(transformation);
+    compact->Transform(transformation);
+    auto result = compact->ToTriangleMesh();
+    ExpectEQ(ref.vertices_, result->vertices_, 1e-5);
+    ExpectEQ(ref.vertex_normals_, result->vertex_normals_, 1e-6);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,243 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/CompactVoxelGrid.h"
+
+#include <map>
+#include <random>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+struct IndexLess {
+    bool operator()(const Eigen::Vector3i &a, const Eigen::Vector3i &b) const {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                            b.data() + 3);
+    }
+};
+
+using ReferenceVoxels =
+        std::map<Eigen::Vector3i, Eigen::Vector3uint8, IndexLess>;
+
+/// Inserts and erases random voxels in \p storage and in a std::map, and
+/// checks that both hold the same voxels after each step.
+template <typename storage_t>
+void ExpectStorageEQ(storage_t &storage,
+                     const Eigen::Vector3i &min_index,
+                     const Eigen::Vector3i &max_index) {
+    std::mt19937 rng(0);
+    ReferenceVoxels reference;
+    for (int step = 0; step < 4; step++) {
+        for (int i = 0; i < 2000; i++) {
+            Eigen::Vector3i index;
+            for (int axis = 0; axis < 3; axis++) {
+                index(axis) = std::uniform_int_distribution<int>(
+                        min_index(axis), max_index(axis))(rng);
+            }
+            Eigen::Vector3uint8 color;
+            for (int channel = 0; channel < 3; channel++) {
+                color(channel) = uint8_t(rng());
+            }
+            bool insert = step % 2 == 0 ? rng() % 4 != 0 : rng() % 4 == 0;
+            if (insert) {
+                EXPECT_EQ(storage.Insert(index, color),
+                          reference.count(index) == 0);
+                reference[index] = color;
+            } else {
+                EXPECT_EQ(storage.Erase(index), reference.erase(index) > 0);
+            }
+        }
+        ASSERT_EQ(storage.Size(), reference.size());
+        ReferenceVoxels visited;
+        storage.ForEach([&visited](const Eigen::Vector3i &index,
+                                   const Eigen::Vector3uint8 &color) {
+            EXPECT_EQ(visited.count(index), 0u);
+            visited[index] = color;
+        });
+        EXPECT_TRUE(visited == reference);
+        for (const auto &it : reference) {
+            Eigen::Vector3uint8 color;
+            EXPECT_TRUE(storage.Contains(it.first));
+            EXPECT_TRUE(storage.GetColor(it.first, color));
+            EXPECT_TRUE(color == it.second);
+        }
+    }
+}
+
+/// Dense grid in front of a camera looking along z, and a depth map of a
+/// disc closer than the grid's far side.
+struct CarvingScene {
+    CarvingScene() {
+        camera.intrinsic_ =
+                camera::PinholeCameraIntrinsic(64, 48, 60, 60, 31.5, 23.5);
+        camera.extrinsic_ = Eigen::Matrix4d::Identity();
+        camera.extrinsic_.block<3, 1>(0, 3) = Eigen::Vector3d(0.5, 0.4, 1.0);
+        depth.Prepare(64, 48, 1, 4);
+        silhouette.Prepare(64, 48, 1, 4);
+        for (int v = 0; v < 48; v++) {
+            for (int u = 0; u < 64; u++) {
+                double r2 = (u - 32) * (u - 32) + (v - 24) * (v - 24);
+                *depth.PointerAt<float>(u, v) = r2 < 300 ? 1.4f : 0.0f;
+                *silhouette.PointerAt<float>(u, v) = r2 < 200 ? 1.0f : 0.0f;
+            }
+        }
+    }
+
+    camera::PinholeCameraParameters camera;
+    geometry::Image depth;
+    geometry::Image silhouette;
+};
+
+void ExpectVoxelsEQ(const geometry::VoxelGrid &expected,
+                    const geometry::CompactVoxelGrid &compact) {
+    ASSERT_EQ(expected.voxels_.size(), compact.NumVoxels());
+    for (const auto &it : expected.voxels_) {
+        Eigen::Vector3d color;
+        ASSERT_TRUE(compact.GetVoxelColor(it.first, color));
+        EXPECT_LE((color - it.second.color_).cwiseAbs().maxCoeff(),
+                  0.5 / 255 + 1e-12);
+    }
+}
+
+}  // unnamed namespace
+
+TEST(CompactVoxelGrid, HashedVoxelStorage) {
+    geometry::HashedVoxelStorage storage;
+    ExpectStorageEQ(storage, Eigen::Vector3i(-40, -1048576, -20),
+                    Eigen::Vector3i(40, -1048500, 1048575));
+    EXPECT_LT(storage.GetStorageBytes(), storage.Size() * 11 * 3);
+    EXPECT_FALSE(storage.Contains(Eigen::Vector3i(0, 1048576, 0)));
+    EXPECT_ANY_THROW(storage.Insert(Eigen::Vector3i(0, 1048576, 0),
+                                    Eigen::Vector3uint8(0, 0, 0)));
+    storage.Clear();
+    EXPECT_EQ(storage.Size(), 0u);
+    EXPECT_FALSE(storage.Contains(Eigen::Vector3i(0, 0, 0)));
+}
+
+TEST(CompactVoxelGrid, DenseVoxelStorage) {
+    geometry::DenseVoxelStorage storage(Eigen::Vector3i(-5, 3, 0),
+                                        Eigen::Vector3i(13, 7, 9));
+    ExpectStorageEQ(storage, Eigen::Vector3i(-5, 3, 0),
+                    Eigen::Vector3i(7, 9, 8));
+    EXPECT_FALSE(storage.Contains(Eigen::Vector3i(8, 3, 0)));
+    EXPECT_ANY_THROW(storage.Insert(Eigen::Vector3i(8, 3, 0),
+                                    Eigen::Vector3uint8(0, 0, 0)));
+    storage.Fill();
+    EXPECT_EQ(storage.Size(), size_t(13 * 7 * 9));
+    storage.Clear();
+    EXPECT_EQ(storage.Size(), 0u);
+
+    // Occupancy only takes a bit per voxel.
+    geometry::DenseVoxelStorage occupancy(Eigen::Vector3i(0, 0, 0),
+                                          Eigen::Vector3i(64, 64, 64));
+    occupancy.Fill();
+    EXPECT_EQ(occupancy.GetStorageBytes(), size_t(64 * 64 * 64 / 8));
+}
+
+TEST(CompactVoxelGrid, CreateFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(5000);
+    pcd.colors_.resize(5000);
+    Rand(pcd.points_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    auto expected = geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.2);
+    auto compact = geometry::CompactVoxelGrid::CreateFromPointCloud(pcd, 0.2);
+    ExpectEQ(compact->origin_, expected->origin_);
+    EXPECT_EQ(compact->voxel_size_, expected->voxel_size_);
+    ExpectVoxelsEQ(*expected, *compact);
+
+    auto converted = compact->ToVoxelGrid();
+    ExpectVoxelsEQ(*converted, *compact);
+    ExpectVoxelsEQ(*expected,
+                   *geometry::CompactVoxelGrid::CreateFromVoxelGrid(*expected));
+
+    pcd.colors_.clear();
+    compact = geometry::CompactVoxelGrid::CreateFromPointCloud(pcd, 0.2);
+    EXPECT_EQ(compact->NumVoxels(), expected->voxels_.size());
+
+    EXPECT_ANY_THROW(geometry::CompactVoxelGrid::CreateFromPointCloud(pcd, 0));
+}
+
+TEST(CompactVoxelGrid, CheckIfIncluded) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    auto voxel_grid = geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.25);
+    auto compact = geometry::CompactVoxelGrid::CreateFromPointCloud(pcd, 0.25);
+    std::vector<Eigen::Vector3d> queries(3000);
+    Rand(queries, Eigen::Vector3d(-1.5, -1.5, -1.5),
+         Eigen::Vector3d(1.5, 1.5, 1.5), 2);
+    EXPECT_EQ(compact->CheckIfIncluded(queries),
+              voxel_grid->CheckIfIncluded(queries));
+}
+
+TEST(CompactVoxelGrid, Carve) {
+    CarvingScene scene;
+    for (bool keep_outside : {false, true}) {
+        for (bool silhouette : {false, true}) {
+            auto voxel_grid = geometry::VoxelGrid::CreateDense(
+                    Eigen::Vector3d(-1, -1, 0), 0.1, 1, 0.8, 1);
+            auto dense = geometry::CompactVoxelGrid::CreateDense(
+                    Eigen::Vector3d(-1, -1, 0), 0.1, 1, 0.8, 1);
+            ASSERT_EQ(dense->backend_,
+                      geometry::CompactVoxelGrid::Backend::Dense);
+            ExpectVoxelsEQ(*voxel_grid, *dense);
+            auto hashed = geometry::CompactVoxelGrid::CreateFromVoxelGrid(
+                    *voxel_grid);
+            if (silhouette) {
+                voxel_grid->CarveSilhouette(scene.silhouette, scene.camera,
+                                            keep_outside);
+                dense->CarveSilhouette(scene.silhouette, scene.camera,
+                                       keep_outside);
+                hashed->CarveSilhouette(scene.silhouette, scene.camera,
+                                        keep_outside);
+            } else {
+                voxel_grid->CarveDepthMap(scene.depth, scene.camera,
+                                          keep_outside);
+                dense->CarveDepthMap(scene.depth, scene.camera, keep_outside);
+                hashed->CarveDepthMap(scene.depth, scene.camera, keep_outside);
+            }
+            EXPECT_GT(voxel_grid->voxels_.size(), 0u);
+            EXPECT_LT(voxel_grid->voxels_.size(), 800u);
+            ExpectVoxelsEQ(*voxel_grid, *dense);
+            ExpectVoxelsEQ(*voxel_grid, *hashed);
+        }
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ConvexHull.h"
+#include "Open3D/Geometry/Qhull.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <utility>
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Checks that \p mesh is a closed hull of \p points with outward triangles.
+void ExpectHullOf(const geometry::TriangleMesh &mesh,
+                  const std::vector<size_t> &pt_map,
+                  const std::vector<Eigen::Vector3d> &points) {
+    ASSERT_EQ(pt_map.size(), mesh.vertices_.size());
+    for (size_t vidx = 0; vidx < pt_map.size(); ++vidx) {
+        ExpectEQ(mesh.vertices_[vidx], points[pt_map[vidx]]);
+    }
+    std::set<std::pair<int, int>> edges;
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        const Eigen::Vector3d &p0 = mesh.vertices_[triangle(0)];
+        const Eigen::Vector3d normal =
+                (mesh.vertices_[triangle(1)] - p0)
+                        .cross(mesh.vertices_[triangle(2)] - p0)
+                        .normalized();
+        for (const Eigen::Vector3d &point : points) {
+            EXPECT_LE(normal.dot(point - p0), 1e-12);
+        }
+        for (int k = 0; k < 3; ++k) {
+            EXPECT_TRUE(edges.emplace(triangle(k), triangle((k + 1) % 3))
+                                .second);
+        }
+    }
+    for (const std::pair<int, int> &edge : edges) {
+        EXPECT_EQ(edges.count(std::make_pair(edge.second, edge.first)), 1u);
+    }
+    EXPECT_EQ(int(mesh.vertices_.size()) - int(edges.size() / 2) +
+                      int(mesh.triangles_.size()),
+              2);
+}
+
+}  // unnamed namespace
+
+TEST(ConvexHull, Cube) {
+    std::vector<Eigen::Vector3d> points(1000);
+    Rand(points, Eigen::Vector3d(0.1, 0.1, 0.1), Eigen::Vector3d(0.9, 0.9, 0.9),
+         0);
+    // Corners, and points on the faces and edges that are not vertices.
+    for (int corner = 0; corner < 8; ++corner) {
+        points.emplace_back(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+    }
+    points.emplace_back(0.5, 0.5, 0);
+    points.emplace_back(1, 0.25, 0.75);
+    points.emplace_back(0.5, 1, 1);
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<size_t> pt_map;
+    std::tie(mesh, pt_map) = geometry::ConvexHull::ComputeConvexHull(points);
+    ExpectHullOf(*mesh, pt_map, points);
+    EXPECT_EQ(mesh->triangles_.size(), 12u);
+    std::sort(pt_map.begin(), pt_map.end());
+    EXPECT_EQ(pt_map, std::vector<size_t>({1000, 1001, 1002, 1003, 1004, 1005,
+                                           1006, 1007}));
+}
+
+TEST(ConvexHull, Sphere) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<size_t> pt_map;
+    std::tie(mesh, pt_map) =
+            geometry::ConvexHull::ComputeConvexHull(sphere->vertices_);
+    ExpectHullOf(*mesh, pt_map, sphere->vertices_);
+    EXPECT_EQ(mesh->vertices_.size(), sphere->vertices_.size());
+    EXPECT_EQ(mesh->triangles_.size(), sphere->triangles_.size());
+}
+
+TEST(ConvexHull, SameVerticesAsQhull) {
+    std::vector<Eigen::Vector3d> points(2000);
+    Rand(points, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    std::vector<size_t> pt_map =
+            std::get<1>(geometry::ConvexHull::ComputeConvexHull(points));
+    std::vector<size_t> qhull_pt_map =
+            std::get<1>(geometry::Qhull::ComputeConvexHull(points));
+    std::sort(pt_map.begin(), pt_map.end());
+    std::sort(qhull_pt_map.begin(), qhull_pt_map.end());
+    EXPECT_EQ(pt_map, qhull_pt_map);
+}
+
+TEST(ConvexHull, Chunks) {
+    // More points than a chunk, so the hulls of several chunks are merged.
+    std::vector<Eigen::Vector3d> points(100000);
+    Rand(points, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    for (Eigen::Vector3d &point : points) {
+        point /= std::max(1.0, point.norm());
+    }
+    utility::SetNumThreads(1);
+    auto serial = geometry::ConvexHull::ComputeConvexHull(points);
+    utility::SetNumThreads(4);
+    auto parallel = geometry::ConvexHull::ComputeConvexHull(points);
+    utility::SetNumThreads(0);
+    ExpectHullOf(*std::get<0>(parallel), std::get<1>(parallel), points);
+    ExpectEQ(std::get<0>(parallel)->triangles_,
+             std::get<0>(serial)->triangles_);
+    EXPECT_EQ(std::get<1>(parallel), std::get<1>(serial));
+}
+
+TEST(ConvexHull, Flat) {
+    std::vector<Eigen::Vector3d> points(100);
+    Rand(points, Eigen::Vector3d(-1, -1, 0), Eigen::Vector3d(1, 1, 0), 0);
+    EXPECT_ANY_THROW(geometry::ConvexHull::ComputeConvexHull(points));
+    EXPECT_ANY_THROW(geometry::ConvexHull::ComputeConvexHull(
+            std::vector<Eigen::Vector3d>(3, Eigen::Vector3d(0, 0, 0))));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
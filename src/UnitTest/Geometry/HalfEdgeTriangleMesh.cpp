@@ -283,6 +283,31 @@ TEST(HalfEdgeTriangleMesh, Constructor_PartialHexagon) {
     EXPECT_FALSE(het_mesh->IsEmpty());
 }
 
+TEST(HalfEdgeTriangleMesh, Constructor_NonManifold) {
+    EXPECT_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+                         get_mesh_two_triangles_flipped()),
+                 std::runtime_error);
+    EXPECT_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+                         get_mesh_two_triangles_invalid_vertex()),
+                 std::runtime_error);
+}
+
+TEST(HalfEdgeTriangleMesh, Constructor_VertexNormals) {
+    geometry::TriangleMesh mesh = get_mesh_hexagon();
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    ASSERT_EQ(het_mesh->vertex_normals_.size(), mesh.vertices_.size());
+    ASSERT_EQ(het_mesh->triangle_normals_.size(), mesh.triangles_.size());
+    ExpectEQ(het_mesh->vertex_normals_[3], Eigen::Vector3d(0, 0, 1));
+
+    // Existing vertex normals are kept.
+    mesh.vertex_normals_.assign(mesh.vertices_.size(),
+                                Eigen::Vector3d(1, 0, 0));
+    het_mesh = geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh);
+    ExpectEQ(het_mesh->vertex_normals_, mesh.vertex_normals_);
+    EXPECT_EQ(het_mesh->triangle_normals_.size(), mesh.triangles_.size());
+}
+
 TEST(HalfEdgeTriangleMesh, Constructor_Sphere) {
     geometry::TriangleMesh mesh;
     io::ReadTriangleMesh(std::string(TEST_DATA_DIR) + "/sphere.ply", mesh);
@@ -1080,5 +1080,60 @@ TEST(Image, CreatePyramid) {
     }
 }
 
+TEST(Image, ImagePyramidBuilder) {
+    geometry::Image image;
+    image.Prepare(37, 22, 1, 4);
+    float *data = (float *)image.data_.data();
+    for (int i = 0; i < image.width_ * image.height_; i++) {
+        data[i] = float((i * 7919) % 101) / 100.0f;
+    }
+
+    geometry::ImagePyramidBuilder builder;
+    geometry::ImagePyramid pyramid;
+    geometry::ImagePyramid pyramid_dx;
+    for (int iter = 0; iter < 2; iter++) {
+        builder.CreatePyramid(image, 3, true, pyramid);
+        builder.FilterPyramid(pyramid, FilterType::Sobel3Dx, pyramid_dx);
+        auto pyramid_gt = image.CreatePyramid(3);
+        auto pyramid_dx_gt = geometry::Image::FilterPyramid(
+                pyramid_gt, FilterType::Sobel3Dx);
+        ASSERT_EQ(pyramid.size(), pyramid_gt.size());
+        ASSERT_EQ(pyramid_dx.size(), pyramid_dx_gt.size());
+        for (size_t p = 0; p < pyramid.size(); p++) {
+            EXPECT_EQ(pyramid_gt[p]->width_, pyramid[p]->width_);
+            EXPECT_EQ(pyramid_gt[p]->height_, pyramid[p]->height_);
+            ExpectEQ(pyramid_gt[p]->data_, pyramid[p]->data_);
+            ExpectEQ(pyramid_dx_gt[p]->data_, pyramid_dx[p]->data_);
+        }
+    }
+
+    // Unshared levels are written in place, shared ones are replaced.
+    const uint8_t *level1 = pyramid[1]->data_.data();
+    auto shared_level2 = pyramid[2];
+    builder.CreatePyramid(image, 3, true, pyramid);
+    EXPECT_EQ(level1, pyramid[1]->data_.data());
+    EXPECT_NE(shared_level2, pyramid[2]);
+    ExpectEQ(shared_level2->data_, pyramid[2]->data_);
+}
+
+TEST(Image, ConvertDepthToFloatImage16Bit) {
+    geometry::Image image;
+    image.Prepare(13, 7, 1, 2);
+    uint16_t *data = (uint16_t *)image.data_.data();
+    for (int i = 0; i < image.width_ * image.height_; i++) {
+        data[i] = uint16_t(i * 97);
+    }
+
+    auto float_image = image.ConvertDepthToFloatImage(1000.0, 3.0);
+    EXPECT_EQ(image.width_, float_image->width_);
+    EXPECT_EQ(image.height_, float_image->height_);
+    EXPECT_EQ(4, float_image->bytes_per_channel_);
+    for (int i = 0; i < image.width_ * image.height_; i++) {
+        float depth = float(data[i]) / 1000.0f;
+        EXPECT_EQ(depth >= 3.0 ? 0.0f : depth,
+                  ((float *)float_image->data_.data())[i]);
+    }
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,286 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/KDTreeIndex.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Points in the test clouds lie on a grid, so neighbors at equal distances
+/// may be returned in a different order. The distances are compared in order,
+/// and every index must be at its reported distance from the query.
+void ExpectNeighborsEQ(const geometry::PointCloud &pc,
+                       const Eigen::Vector3d &query,
+                       const std::vector<double> &ref_distance2,
+                       const int *indices,
+                       const float *distance2,
+                       size_t size) {
+    ASSERT_EQ(ref_distance2.size(), size);
+    for (size_t i = 0; i < size; i++) {
+        EXPECT_NEAR(ref_distance2[i], distance2[i], 1e-4);
+        EXPECT_NEAR((pc.points_[indices[i]] - query).squaredNorm(),
+                    distance2[i], 1e-4);
+    }
+}
+
+}  // unnamed namespace
+
+TEST(KDTreeIndex, SearchKNN) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    std::vector<Eigen::Vector3d> queries(200);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+
+    geometry::KDTreeFlann ref_kdtree(pc);
+    geometry::KDTreeIndex kdtree(pc);
+    EXPECT_EQ(kdtree.GetDatasetSize(), 1000u);
+    EXPECT_EQ(kdtree.GetDimension(), 3u);
+
+    int knn = 30;
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    EXPECT_EQ(kdtree.SearchKNN(queries, knn, indices, distance2), knn);
+    EXPECT_EQ(indices.size(), queries.size() * knn);
+    EXPECT_EQ(distance2.size(), queries.size() * knn);
+
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    for (size_t i = 0; i < queries.size(); i++) {
+        ref_kdtree.SearchKNN(queries[i], knn, ref_indices, ref_distance2);
+        ExpectNeighborsEQ(pc, queries[i], ref_distance2, &indices[i * knn],
+                          &distance2[i * knn], knn);
+    }
+
+    // More neighbors than points.
+    geometry::PointCloud small_pc;
+    small_pc.points_ = {{0, 0, 0}, {1, 0, 0}, {3, 0, 0}};
+    geometry::KDTreeIndex small_kdtree(small_pc);
+    EXPECT_EQ(small_kdtree.SearchKNN(std::vector<Eigen::Vector3d>{{0.9, 0, 0}},
+                                     10, indices, distance2),
+              3);
+    EXPECT_EQ(indices, std::vector<int>({1, 0, 2}));
+
+    // Invalid input.
+    EXPECT_EQ(kdtree.SearchKNN(Eigen::MatrixXd(Eigen::MatrixXd::Zero(2, 4)),
+                               knn, indices, distance2),
+              -1);
+    EXPECT_EQ(geometry::KDTreeIndex().SearchKNN(queries, knn, indices,
+                                                distance2),
+              -1);
+}
+
+TEST(KDTreeIndex, SearchRadius) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Eigen::MatrixXd queries(3, 200);
+    for (int i = 0; i < queries.cols(); i++) {
+        Eigen::Vector3d query;
+        Rand(query, 0.0, 10.0, i);
+        queries.col(i) = query;
+    }
+
+    geometry::KDTreeFlann ref_kdtree(pc);
+    geometry::KDTreeIndex kdtree(pc);
+
+    double radius = 1.5;
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    std::vector<int64_t> offsets;
+    int64_t num_neighbors =
+            kdtree.SearchRadius(queries, radius, indices, distance2, offsets);
+    ASSERT_EQ(offsets.size(), size_t(queries.cols() + 1));
+    EXPECT_EQ(offsets.front(), 0);
+    EXPECT_EQ(offsets.back(), num_neighbors);
+    EXPECT_EQ(indices.size(), size_t(num_neighbors));
+    EXPECT_EQ(distance2.size(), size_t(num_neighbors));
+
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    for (int i = 0; i < queries.cols(); i++) {
+        Eigen::Vector3d query = queries.col(i);
+        ref_kdtree.SearchRadius(query, radius, ref_indices, ref_distance2);
+        ExpectNeighborsEQ(pc, query, ref_distance2,
+                          indices.data() + offsets[i],
+                          distance2.data() + offsets[i],
+                          offsets[i + 1] - offsets[i]);
+    }
+
+    EXPECT_EQ(kdtree.SearchRadius(queries, -1.0, indices, distance2, offsets),
+              -1);
+}
+
+TEST(KDTreeIndex, SearchHybrid) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    std::vector<Eigen::Vector3d> queries(200);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+
+    geometry::KDTreeFlann ref_kdtree(pc);
+    geometry::KDTreeIndex kdtree(pc);
+
+    double radius = 2.0;
+    int max_nn = 10;
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    std::vector<int64_t> offsets;
+    int64_t num_neighbors = kdtree.SearchHybrid(queries, radius, max_nn,
+                                                indices, distance2, offsets);
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+    EXPECT_EQ(offsets.back(), num_neighbors);
+
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    for (size_t i = 0; i < queries.size(); i++) {
+        ref_kdtree.SearchHybrid(queries[i], radius, max_nn, ref_indices,
+                                ref_distance2);
+        EXPECT_LE(offsets[i + 1] - offsets[i], max_nn);
+        ExpectNeighborsEQ(pc, queries[i], ref_distance2,
+                          indices.data() + offsets[i],
+                          distance2.data() + offsets[i],
+                          offsets[i + 1] - offsets[i]);
+    }
+
+    EXPECT_EQ(kdtree.SearchHybrid(queries, radius, -1, indices, distance2,
+                                  offsets),
+              -1);
+}
+
+TEST(KDTreeIndex, ApproximateSearch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    std::vector<Eigen::Vector3d> queries(200);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+    geometry::KDTreeIndex kdtree(pc);
+
+    // The k-th approximate neighbor is at most (1 + eps) times as far, in
+    // squared distance, as the k-th exact neighbor.
+    const int knn = 10;
+    const double eps = 0.5;
+    std::vector<int> ref_indices, indices;
+    std::vector<float> ref_distance2, distance2;
+    kdtree.SearchKNN(queries, knn, ref_indices, ref_distance2);
+    EXPECT_EQ(kdtree.SearchKNN(queries, knn, indices, distance2, eps), knn);
+    for (size_t i = 0; i < queries.size(); i++) {
+        const size_t last = (i + 1) * knn - 1;
+        EXPECT_LE(distance2[last], (1.0 + eps) * ref_distance2[last] + 1e-4);
+        for (size_t j = i * knn; j <= last; j++) {
+            EXPECT_NEAR((pc.points_[indices[j]] - queries[i]).squaredNorm(),
+                        distance2[j], 1e-4);
+        }
+    }
+    EXPECT_EQ(kdtree.SearchKNN(queries, knn, indices, distance2, -1.0), -1);
+
+    // Unsorted radius search returns the same neighborhoods in any order.
+    std::vector<int64_t> ref_offsets, offsets;
+    kdtree.SearchRadius(queries, 1.5, ref_indices, ref_distance2, ref_offsets);
+    kdtree.SearchRadius(queries, 1.5, indices, distance2, offsets, 0.0, false);
+    EXPECT_EQ(ref_offsets, offsets);
+    for (size_t i = 0; i < queries.size(); i++) {
+        std::sort(ref_indices.begin() + ref_offsets[i],
+                  ref_indices.begin() + ref_offsets[i + 1]);
+        std::sort(indices.begin() + offsets[i],
+                  indices.begin() + offsets[i + 1]);
+    }
+    EXPECT_EQ(ref_indices, indices);
+
+    // Approximate hybrid search only returns points within the radius.
+    kdtree.SearchHybrid(queries, 2.0, knn, indices, distance2, offsets, eps);
+    for (float d2 : distance2) {
+        EXPECT_LE(d2, 4.0f);
+    }
+}
+
+TEST(KDTreeIndex, SetPoints) {
+    // A tree of float points answers float queries as a tree of the same
+    // points in double precision answers the double queries.
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    std::vector<Eigen::Vector3d> queries(200);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+    std::vector<Eigen::Vector3f> points_f(pc.points_.size());
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        points_f[i] = pc.points_[i].cast<float>();
+        pc.points_[i] = points_f[i].cast<double>();
+    }
+    std::vector<Eigen::Vector3f> queries_f(queries.size());
+    for (size_t i = 0; i < queries.size(); i++) {
+        queries_f[i] = queries[i].cast<float>();
+        queries[i] = queries_f[i].cast<double>();
+    }
+
+    geometry::KDTreeIndex ref_kdtree(pc);
+    geometry::KDTreeIndex kdtree;
+    EXPECT_TRUE(kdtree.SetPoints(points_f));
+    EXPECT_EQ(kdtree.GetDatasetSize(), 1000u);
+    EXPECT_EQ(kdtree.GetDimension(), 3u);
+
+    std::vector<int> ref_indices, indices;
+    std::vector<float> ref_distance2, distance2;
+    std::vector<int64_t> ref_offsets, offsets;
+    EXPECT_EQ(kdtree.SearchKNN(queries_f, 10, indices, distance2), 10);
+    ref_kdtree.SearchKNN(queries, 10, ref_indices, ref_distance2);
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(ref_distance2, distance2);
+
+    EXPECT_EQ(kdtree.SearchRadius(queries_f, 1.5, indices, distance2, offsets),
+              ref_kdtree.SearchRadius(queries, 1.5, ref_indices, ref_distance2,
+                                      ref_offsets));
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(ref_offsets, offsets);
+
+    EXPECT_EQ(kdtree.SearchHybrid(queries_f, 2.0, 5, indices, distance2,
+                                  offsets),
+              ref_kdtree.SearchHybrid(queries, 2.0, 5, ref_indices,
+                                      ref_distance2, ref_offsets));
+    EXPECT_EQ(ref_indices, indices);
+    EXPECT_EQ(ref_offsets, offsets);
+
+    EXPECT_FALSE(kdtree.SetPoints(std::vector<Eigen::Vector3f>()));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
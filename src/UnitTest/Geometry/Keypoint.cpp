@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Keypoint.h"
+
+#include <algorithm>
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(Keypoint, ComputeISSKeypoints) {
+    geometry::PointCloud pc;
+    pc.points_.resize(5000);
+    Rand(pc.points_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 0);
+    const double salient_radius = 0.1;
+    const double non_max_radius = 0.08;
+
+    std::vector<size_t> indices = geometry::keypoint::ComputeISSKeypointIndices(
+            pc, salient_radius, non_max_radius);
+    EXPECT_FALSE(indices.empty());
+    EXPECT_LT(indices.size(), pc.points_.size() / 10);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_TRUE(std::adjacent_find(indices.begin(), indices.end()) ==
+                indices.end());
+
+    // No two keypoints are within the non-maximum suppression radius.
+    for (size_t a = 0; a < indices.size(); a++) {
+        for (size_t b = a + 1; b < indices.size(); b++) {
+            EXPECT_GT((pc.points_[indices[a]] - pc.points_[indices[b]]).norm(),
+                      non_max_radius - 1e-6);
+        }
+    }
+
+    // A larger precomputed neighbor graph gives the same keypoints.
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pc, geometry::KDTreeSearchParamRadius(0.15));
+    EXPECT_EQ(indices, geometry::keypoint::ComputeISSKeypointIndices(
+                               pc, *graph, salient_radius, non_max_radius));
+
+    auto keypoints = geometry::keypoint::ComputeISSKeypoints(
+            pc, salient_radius, non_max_radius);
+    ASSERT_EQ(keypoints->points_.size(), indices.size());
+    for (size_t k = 0; k < indices.size(); k++) {
+        ExpectEQ(pc.points_[indices[k]], keypoints->points_[k]);
+    }
+}
+
+TEST(Keypoint, ComputeISSKeypointsPlane) {
+    // The smallest eigenvalue of planar neighborhoods is 0, so a plane has no
+    // keypoints.
+    geometry::PointCloud pc;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            pc.points_.emplace_back(i * 0.02, j * 0.02, 0.0);
+        }
+    }
+    EXPECT_TRUE(geometry::keypoint::ComputeISSKeypointIndices(pc).empty());
+    EXPECT_TRUE(geometry::keypoint::ComputeISSKeypointIndices(
+                        geometry::PointCloud())
+                        .empty());
+}
+
+}  // namespace unit_test
+}  // namespace open3d
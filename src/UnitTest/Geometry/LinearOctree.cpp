@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Random colored points. Half of them are snapped to a coarse grid, so that
+/// many points lie exactly on cell boundaries.
+geometry::PointCloud MakePointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-1.0, -2.0, 0.0),
+         Eigen::Vector3d(3.0, 2.0, 2.0), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (size_t i = 0; i < num_points; i += 2) {
+        pcd.points_[i] = (pcd.points_[i] * 4.0).array().round() / 4.0;
+    }
+    return pcd;
+}
+
+/// Octree::ConvertFromPointCloud by inserting the points one by one.
+geometry::Octree InsertPoints(const geometry::PointCloud& pcd,
+                              const geometry::LinearOctree& linear_octree) {
+    geometry::Octree octree(linear_octree.max_depth_, linear_octree.origin_,
+                            linear_octree.size_);
+    for (size_t idx = 0; idx < pcd.points_.size(); idx++) {
+        octree.InsertPoint(pcd.points_[idx],
+                           geometry::OctreeColorLeafNode::GetInitFunction(),
+                           geometry::OctreeColorLeafNode::GetUpdateFunction(
+                                   pcd.colors_[idx]));
+    }
+    return octree;
+}
+
+}  // unnamed namespace
+
+TEST(LinearOctree, ConvertFromPointCloud) {
+    geometry::PointCloud pcd = MakePointCloud(5000);
+    for (size_t max_depth : {0, 1, 4, 7}) {
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+        EXPECT_EQ(linear_octree.points_.size(),
+                  linear_octree.point_indices_.size());
+        EXPECT_EQ(linear_octree.nodes_[0].point_end_,
+                  int64_t(pcd.points_.size()));
+        EXPECT_TRUE(*linear_octree.ToOctree(pcd) ==
+                    InsertPoints(pcd, linear_octree));
+
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        EXPECT_TRUE(octree == InsertPoints(pcd, linear_octree));
+    }
+}
+
+TEST(LinearOctree, ConvertFromPointCloudOutOfBound) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1)};
+    pcd.colors_ = {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1)};
+
+    // Without expansion, the max bound is not within the octree.
+    geometry::LinearOctree linear_octree(2);
+    linear_octree.ConvertFromPointCloud(pcd, 0);
+    ASSERT_EQ(linear_octree.point_indices_.size(), 1u);
+    EXPECT_EQ(linear_octree.point_indices_[0], 0);
+    EXPECT_EQ(linear_octree.nodes_.size(), 3u);
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(1, 1, 1)), -1);
+    EXPECT_TRUE(*linear_octree.ToOctree(pcd) ==
+                InsertPoints(pcd, linear_octree));
+}
+
+TEST(LinearOctree, Empty) {
+    geometry::PointCloud pcd;
+    geometry::LinearOctree linear_octree(3);
+    linear_octree.ConvertFromPointCloud(pcd);
+    EXPECT_TRUE(linear_octree.IsEmpty());
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(0, 0, 0)), -1);
+    EXPECT_TRUE(linear_octree.ToOctree(pcd)->IsEmpty());
+
+    EXPECT_ANY_THROW(geometry::LinearOctree(22));
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    geometry::PointCloud pcd = MakePointCloud(2000);
+    size_t max_depth = 5;
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 10) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        int64_t node = linear_octree.LocateLeafNode(point);
+        ASSERT_GE(node, 0);
+        EXPECT_TRUE(linear_octree.nodes_[node].IsLeaf());
+        geometry::OctreeNodeInfo node_info = linear_octree.GetNodeInfo(node);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(point, node_info.origin_,
+                                                     node_info.size_));
+        EXPECT_EQ(node_info.depth_, max_depth);
+        EXPECT_EQ(node_info.size_, linear_octree.size_ / pow(2, max_depth));
+
+        const geometry::LinearOctreeNode& leaf = linear_octree.nodes_[node];
+        bool found = false;
+        for (int64_t i = leaf.point_begin_; i < leaf.point_end_; ++i) {
+            found = found || linear_octree.point_indices_[i] == int64_t(idx);
+        }
+        EXPECT_TRUE(found);
+    }
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(10, 0, 0)), -1);
+}
+
+TEST(LinearOctree, Traverse) {
+    geometry::PointCloud pcd = MakePointCloud(2000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::Octree octree(4);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::vector<geometry::OctreeNodeInfo> expected;
+    octree.Traverse([&expected](const std::shared_ptr<geometry::OctreeNode>&,
+                                const std::shared_ptr<geometry::OctreeNodeInfo>&
+                                        node_info) {
+        expected.push_back(*node_info);
+    });
+    std::vector<int64_t> nodes;
+    linear_octree.Traverse([&](int64_t node,
+                               const geometry::OctreeNodeInfo& node_info) {
+        size_t i = nodes.size();
+        nodes.push_back(node);
+        if (i < expected.size()) {
+            ExpectEQ(node_info.origin_, expected[i].origin_);
+            EXPECT_EQ(node_info.size_, expected[i].size_);
+            EXPECT_EQ(node_info.depth_, expected[i].depth_);
+            EXPECT_EQ(node_info.child_index_, expected[i].child_index_);
+            ExpectEQ(linear_octree.GetNodeInfo(node).origin_,
+                     node_info.origin_);
+        }
+        return false;
+    });
+    EXPECT_EQ(nodes.size(), expected.size());
+    EXPECT_EQ(nodes.size(), linear_octree.nodes_.size());
+
+    // Returning true skips the children, so only the root and the depth 1
+    // nodes are visited.
+    size_t num_visited = 0;
+    linear_octree.Traverse(
+            [&num_visited](int64_t, const geometry::OctreeNodeInfo& node_info) {
+                num_visited++;
+                return node_info.depth_ == 1;
+            });
+    size_t num_expected = 0;
+    for (const geometry::LinearOctreeNode& node : linear_octree.nodes_) {
+        num_expected += node.depth_ <= 1 ? 1 : 0;
+    }
+    EXPECT_EQ(num_visited, num_expected);
+}
+
+TEST(LinearOctree, GetPointIndicesWithinBoundingBox) {
+    geometry::PointCloud pcd = MakePointCloud(5000);
+    geometry::LinearOctree linear_octree(6);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    std::vector<geometry::AxisAlignedBoundingBox> boxes = {
+            geometry::AxisAlignedBoundingBox(Eigen::Vector3d(0, -1, 0.5),
+                                             Eigen::Vector3d(1, 1, 1.5)),
+            geometry::AxisAlignedBoundingBox(Eigen::Vector3d(-0.3, -0.7, 0.1),
+                                             Eigen::Vector3d(2.1, 0.6, 0.9)),
+            geometry::AxisAlignedBoundingBox(Eigen::Vector3d(-5, -5, -5),
+                                             Eigen::Vector3d(5, 5, 5)),
+            geometry::AxisAlignedBoundingBox(Eigen::Vector3d(4, 4, 4),
+                                             Eigen::Vector3d(5, 5, 5))};
+    for (const geometry::AxisAlignedBoundingBox& bbox : boxes) {
+        std::vector<size_t> indices =
+                linear_octree.GetPointIndicesWithinBoundingBox(bbox);
+        EXPECT_EQ(indices, bbox.GetPointIndicesWithinBoundingBox(pcd.points_));
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Every neighborhood of the graph must match a KDTreeFlann search. As the
+/// points lie on a grid, neighbors at equal distances may come in a different
+/// order, so distances are compared in order and every index must be at its
+/// reported distance.
+void ExpectGraphEQ(const geometry::PointCloud &pc,
+                   const geometry::KDTreeSearchParam &param,
+                   const geometry::NeighborGraph &graph) {
+    geometry::KDTreeFlann kdtree(pc);
+    ASSERT_EQ(pc.points_.size(), graph.NumPoints());
+    ASSERT_EQ(graph.NumEdges(), graph.distance2_.size());
+    ASSERT_EQ(graph.NumEdges(), size_t(graph.offsets_.back()));
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.Search(pc.points_[i], param, indices, distance2);
+        ASSERT_EQ(int64_t(indices.size()), graph.NumNeighbors(i));
+        for (int64_t k = 0; k < graph.NumNeighbors(i); k++) {
+            const int64_t edge = graph.offsets_[i] + k;
+            const int j = graph.indices_[edge];
+            EXPECT_NEAR(distance2[k], graph.distance2_[edge], 1e-4);
+            EXPECT_NEAR((pc.points_[j] - pc.points_[i]).squaredNorm(),
+                        graph.distance2_[edge], 1e-4);
+        }
+    }
+}
+
+}  // unnamed namespace
+
+TEST(NeighborGraph, CreateFromPointCloudKNN) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    const geometry::KDTreeSearchParamKNN param(20);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+    EXPECT_EQ(pc.points_.size() * 20, graph->NumEdges());
+    ExpectGraphEQ(pc, param, *graph);
+}
+
+TEST(NeighborGraph, CreateFromPointCloudRadius) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    const geometry::KDTreeSearchParamRadius param(1.5);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+    ExpectGraphEQ(pc, param, *graph);
+}
+
+TEST(NeighborGraph, CreateFromPointCloudHybrid) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    const geometry::KDTreeSearchParamHybrid param(1.5, 10);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+    ExpectGraphEQ(pc, param, *graph);
+}
+
+TEST(NeighborGraph, CreateFromEmptyPointCloud) {
+    geometry::PointCloud pc;
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc);
+    EXPECT_EQ(0u, graph->NumPoints());
+    EXPECT_EQ(0u, graph->NumEdges());
+    EXPECT_EQ(std::vector<int64_t>({0}), graph->offsets_);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
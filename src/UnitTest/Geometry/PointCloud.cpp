@@ -25,12 +25,20 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/NeighborGraph.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Utility/Parallel.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -193,6 +201,58 @@ TEST(PointCloud, Transform) {
     ExpectEQ(ref_normals, pc.normals_);
 }
 
+TEST(PointCloud, TransformInto) {
+    int size = 100;
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(1000.0, 1000.0, 1000.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+    pc.normals_.resize(size);
+    Rand(pc.normals_, vmin, vmax, 1);
+    pc.colors_.resize(size);
+    Rand(pc.colors_, vmin, vmax, 2);
+    pc.covariances_.resize(size, Eigen::Matrix3d::Identity());
+    pc.covariances_[0](0, 1) = pc.covariances_[0](1, 0) = 0.5;
+
+    Eigen::Matrix4d rigid = Eigen::Matrix4d::Identity();
+    rigid.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.1, 0.2, 0.3});
+    rigid.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, 2.0, 3.0);
+    Eigen::Matrix4d projective;
+    projective << 0.10, 0.20, 0.30, 0.40, 0.50, 0.60, 0.70, 0.80, 0.90, 0.10,
+            0.11, 0.12, 0.13, 0.14, 0.15, 0.16;
+
+    for (const Eigen::Matrix4d &transformation : {rigid, projective}) {
+        geometry::PointCloud ref = pc;
+        ref.Transform(transformation);
+
+        // The output has more points than the input to begin with.
+        geometry::PointCloud dst;
+        dst.points_.resize(2 * size);
+        dst.normals_.resize(3 * size);
+        geometry::PointCloud &ret = pc.TransformInto(transformation, dst);
+        EXPECT_EQ(&ret, &dst);
+        ExpectEQ(ref.points_, dst.points_);
+        ExpectEQ(ref.normals_, dst.normals_);
+        ExpectEQ(ref.colors_, dst.colors_);
+        ExpectEQ(ref.covariances_, dst.covariances_);
+
+        geometry::PointCloud in_place = pc;
+        in_place.TransformInto(transformation, in_place);
+        ExpectEQ(ref.points_, in_place.points_);
+        ExpectEQ(ref.normals_, in_place.normals_);
+    }
+
+    // Normals are dropped when the input has none.
+    geometry::PointCloud dst;
+    geometry::PointCloud(pc.points_).TransformInto(rigid, dst);
+    EXPECT_EQ(dst.points_.size(), pc.points_.size());
+    EXPECT_TRUE(dst.normals_.empty());
+}
+
 TEST(PointCloud, HasPoints) {
     int size = 100;
 
@@ -535,6 +595,35 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_colors, output_pc->colors_);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pc;
+    pc.points_ = {{0.1, 0.1, 0.1},
+                  {0.9, 0.2, 0.1},
+                  {1.5, 0.5, 0.5},
+                  {0.6, 0.6, 0.6}};
+    pc.colors_ = {{1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {2, 2, 2}};
+
+    std::shared_ptr<geometry::PointCloud> output_pc;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(output_pc, cubic_id, original_indices) =
+            pc.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                       Eigen::Vector3d(2, 2, 2), true);
+
+    // Voxels are ordered by their (z, y, x) index.
+    ExpectEQ(output_pc->points_,
+             std::vector<Eigen::Vector3d>({{1.6 / 3, 0.3, 0.8 / 3},
+                                           {1.5, 0.5, 0.5}}));
+    ExpectEQ(output_pc->colors_,
+             std::vector<Eigen::Vector3d>({{2, 2, 2}, {3, 3, 3}}));
+    EXPECT_EQ(original_indices,
+              std::vector<std::vector<int>>({{0, 1, 3}, {2}}));
+    Eigen::MatrixXi ref_cubic_id(2, 8);
+    ref_cubic_id << 0, 1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1,
+            2;
+    EXPECT_EQ(cubic_id, ref_cubic_id);
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> ref = {{839.215686, 392.156863, 780.392157},
                                         {364.705882, 509.803922, 949.019608},
@@ -596,6 +685,93 @@ TEST(PointCloud, CropPointCloud) {
     ExpectGE(maxBound, output_pc->points_);
 }
 
+TEST(PointCloud, CropPointCloudMultipleBoxes) {
+    geometry::PointCloud pc;
+    pc.points_.resize(100000);
+    Rand(pc.points_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(1000.0),
+         0);
+
+    std::vector<geometry::AxisAlignedBoundingBox> bboxes = {
+            {Eigen::Vector3d(200.0, 200.0, 200.0),
+             Eigen::Vector3d(800.0, 800.0, 800.0)},
+            {Eigen::Vector3d(0.0, 500.0, 0.0),
+             Eigen::Vector3d(300.0, 1000.0, 1000.0)},
+            {Eigen::Vector3d(1100.0, 0.0, 0.0),
+             Eigen::Vector3d(1200.0, 100.0, 100.0)}};
+    auto output_pcs = pc.Crop(bboxes);
+    ASSERT_EQ(output_pcs.size(), bboxes.size());
+    for (size_t b = 0; b < bboxes.size(); b++) {
+        auto ref = pc.Crop(bboxes[b]);
+        ExpectEQ(ref->points_, output_pcs[b]->points_);
+    }
+    EXPECT_TRUE(output_pcs[2]->points_.empty());
+
+    // Reference serial loop for the single box crop.
+    std::vector<size_t> ref_indices;
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        if ((pc.points_[i].array() >= bboxes[0].min_bound_.array()).all() &&
+            (pc.points_[i].array() <= bboxes[0].max_bound_.array()).all()) {
+            ref_indices.push_back(i);
+        }
+    }
+    EXPECT_EQ(ref_indices,
+              bboxes[0].GetPointIndicesWithinBoundingBox(pc.points_));
+}
+
+TEST(PointCloud, ComputeTiles) {
+    geometry::PointCloud pc;
+    pc.points_.resize(50000);
+    Rand(pc.points_, Eigen::Vector3d::Zero(),
+         Eigen::Vector3d(100.0, 50.0, 10.0), 0);
+
+    // Tiles along x and y only.
+    const Eigen::Vector3d tile_size(
+            30.0, 20.0, std::numeric_limits<double>::infinity());
+    for (double overlap : {0.0, 2.0}) {
+        geometry::PointCloudTiles tiles = pc.ComputeTiles(tile_size, overlap);
+        EXPECT_EQ(tiles.num_tiles_, Eigen::Vector3i(4, 3, 1));
+        ASSERT_EQ(tiles.NumTiles(), 12u);
+
+        size_t num_indices = 0;
+        for (size_t t = 0; t < tiles.NumTiles(); t++) {
+            auto bbox = tiles.GetTileBoundingBox(t);
+            std::vector<size_t> indices = tiles.GetTileIndices(t);
+            EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+            for (size_t idx : indices) {
+                EXPECT_TRUE((pc.points_[idx].array() >=
+                             bbox.min_bound_.array() - 1e-9)
+                                    .all());
+                EXPECT_TRUE((pc.points_[idx].array() <=
+                             bbox.max_bound_.array() + 1e-9)
+                                    .all());
+            }
+            num_indices += indices.size();
+        }
+        if (overlap == 0.0) {
+            // Every point is in exactly one tile.
+            EXPECT_EQ(num_indices, pc.points_.size());
+            std::vector<size_t> all_indices = tiles.indices_;
+            std::sort(all_indices.begin(), all_indices.end());
+            std::vector<size_t> ref(pc.points_.size());
+            std::iota(ref.begin(), ref.end(), 0);
+            EXPECT_EQ(all_indices, ref);
+        } else {
+            // Points close to the borders are in several tiles, and every
+            // tile contains all points within its bounds.
+            EXPECT_GT(num_indices, pc.points_.size());
+            for (size_t t = 0; t < tiles.NumTiles(); t++) {
+                auto bbox = tiles.GetTileBoundingBox(t);
+                bbox.min_bound_(2) = -1.0;
+                bbox.max_bound_(2) = 11.0;
+                auto ref = bbox.GetPointIndicesWithinBoundingBox(pc.points_);
+                EXPECT_EQ(ref.size(), tiles.GetTileIndices(t).size());
+            }
+        }
+    }
+
+    EXPECT_EQ(geometry::PointCloud().ComputeTiles(tile_size).NumTiles(), 0u);
+}
+
 TEST(PointCloud, EstimateNormals) {
     std::vector<Eigen::Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -647,6 +823,147 @@ TEST(PointCloud, EstimateNormals) {
     ExpectEQ(ref, pc.normals_);
 }
 
+TEST(PointCloud, EstimateNormalsFromNeighborGraph) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    const geometry::KDTreeSearchParamRadius param(1.5);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+
+    for (bool fast_normal_computation : {true, false}) {
+        geometry::PointCloud ref = pc;
+        ref.EstimateNormals(param, fast_normal_computation);
+        geometry::PointCloud result = pc;
+        result.EstimateNormals(*graph, fast_normal_computation);
+        ASSERT_EQ(ref.normals_.size(), result.normals_.size());
+        for (size_t i = 0; i < ref.normals_.size(); i++) {
+            EXPECT_NEAR(std::abs(ref.normals_[i].dot(result.normals_[i])),
+                        1.0, 1e-6);
+        }
+    }
+
+    geometry::NeighborGraph empty;
+    EXPECT_ANY_THROW(pc.EstimateNormals(empty));
+}
+
+TEST(PointCloud, EstimateCovariances) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    for (auto &point : pc.points_) {
+        point(2) = 0.0;
+    }
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pc, geometry::KDTreeSearchParamKNN(20));
+    pc.EstimateCovariances(*graph);
+    ASSERT_TRUE(pc.HasCovariances());
+    for (const auto &covariance : pc.covariances_) {
+        EXPECT_NEAR(0.0, covariance.col(2).norm(), 1e-12);
+        EXPECT_GT(covariance(0, 0), 0.0);
+        EXPECT_GT(covariance(1, 1), 0.0);
+    }
+
+    // Transforming the point cloud rotates its covariances.
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, -0.2, 1.0});
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, 2.0, 3.0);
+    geometry::PointCloud ref = pc;
+    ref.Transform(transformation);
+    ref.EstimateCovariances(*graph);
+    pc.Transform(transformation);
+    ExpectEQ(ref.covariances_, pc.covariances_);
+
+    geometry::NeighborGraph empty;
+    EXPECT_ANY_THROW(pc.EstimateCovariances(empty));
+}
+
+TEST(PointCloud, RemoveRadiusOutliersFromNeighborGraph) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    // A graph with a larger radius contains all neighbors needed.
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pc, geometry::KDTreeSearchParamRadius(2.0));
+
+    std::vector<size_t> ref;
+    std::tie(std::ignore, ref) = pc.RemoveRadiusOutliers(12, 1.5);
+    std::shared_ptr<geometry::PointCloud> result;
+    std::vector<size_t> indices;
+    std::tie(result, indices) = pc.RemoveRadiusOutliers(12, 1.5, *graph);
+    EXPECT_GT(ref.size(), 0u);
+    EXPECT_LT(ref.size(), pc.points_.size());
+    EXPECT_EQ(ref, indices);
+    EXPECT_EQ(indices.size(), result->points_.size());
+}
+
+TEST(PointCloud, RemoveStatisticalOutliersFromNeighborGraph) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    // Only the nearest 20 neighbors of the graph are used.
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pc, geometry::KDTreeSearchParamKNN(30));
+
+    std::vector<size_t> ref;
+    std::tie(std::ignore, ref) = pc.RemoveStatisticalOutliers(20, 1.0);
+    std::shared_ptr<geometry::PointCloud> result;
+    std::vector<size_t> indices;
+    std::tie(result, indices) = pc.RemoveStatisticalOutliers(20, 1.0, *graph);
+    EXPECT_GT(ref.size(), 0u);
+    EXPECT_LT(ref.size(), pc.points_.size());
+    EXPECT_EQ(ref, indices);
+    EXPECT_EQ(indices.size(), result->points_.size());
+}
+
+TEST(PointCloud, ComputeOutlierInlierMasks) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            pc, geometry::KDTreeSearchParamKNN(30));
+
+    auto MaskToIndices = [](const std::vector<bool> &mask) {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < mask.size(); i++) {
+            if (mask[i]) {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    };
+
+    std::vector<size_t> ref;
+    std::tie(std::ignore, ref) = pc.RemoveRadiusOutliers(12, 1.5);
+    std::vector<bool> mask = pc.ComputeRadiusInlierMask(12, 1.5);
+    EXPECT_EQ(mask.size(), pc.points_.size());
+    EXPECT_EQ(ref, MaskToIndices(mask));
+    // The 30 nearest neighbors are enough to count up to 12 points.
+    EXPECT_EQ(ref, MaskToIndices(pc.ComputeRadiusInlierMask(12, 1.5, *graph)));
+
+    std::tie(std::ignore, ref) = pc.RemoveStatisticalOutliers(20, 1.0);
+    mask = pc.ComputeStatisticalInlierMask(20, 1.0);
+    EXPECT_EQ(mask.size(), pc.points_.size());
+    EXPECT_EQ(ref, MaskToIndices(mask));
+    EXPECT_EQ(ref, MaskToIndices(
+                           pc.ComputeStatisticalInlierMask(20, 1.0, *graph)));
+
+    utility::SetNumThreads(4);
+    EXPECT_EQ(mask, pc.ComputeStatisticalInlierMask(20, 1.0, *graph));
+    utility::SetNumThreads(0);
+
+    EXPECT_THROW(pc.ComputeRadiusInlierMask(0, 1.5), std::runtime_error);
+    EXPECT_THROW(pc.ComputeStatisticalInlierMask(20, 0.0), std::runtime_error);
+    geometry::PointCloud empty;
+    EXPECT_TRUE(empty.ComputeRadiusInlierMask(12, 1.5).empty());
+    EXPECT_TRUE(empty.ComputeStatisticalInlierMask(20, 1.0).empty());
+}
+
 TEST(PointCloud, OrientNormalsToAlignWithDirection) {
     std::vector<Eigen::Vector3d> ref = {
             {0.282003, 0.866394, 0.412111},   {0.550791, 0.829572, -0.091869},
@@ -742,6 +1059,47 @@ TEST(PointCloud, OrientNormalsTowardsCameraLocation) {
     ExpectEQ(ref, pc.normals_);
 }
 
+TEST(PointCloud, OrientNormalsConsistentTangentPlane) {
+    // A Fibonacci sphere with radial normals, a third of them flipped.
+    const int size = 20000;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    geometry::PointCloud pc;
+    for (int i = 0; i < size; i++) {
+        const double z = 1.0 - (2.0 * i + 1.0) / size;
+        const double r = std::sqrt(1.0 - z * z);
+        pc.points_.emplace_back(r * std::cos(golden_angle * i),
+                                r * std::sin(golden_angle * i), z);
+        pc.normals_.push_back(pc.points_[i] * (i % 3 == 0 ? -1.0 : 1.0));
+    }
+    const geometry::PointCloud flipped = pc;
+
+    // The tree starts at the top of the sphere, whose normal faces up, so
+    // all normals face outward.
+    pc.OrientNormalsConsistentTangentPlane(10);
+    ASSERT_EQ(pc.normals_.size(), size_t(size));
+    for (int i = 0; i < size; i++) {
+        EXPECT_GT(pc.normals_[i].dot(pc.points_[i]), 0.99);
+    }
+
+    // The tree and the orientation do not depend on the number of threads.
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(
+            flipped, geometry::KDTreeSearchParamKNN(10));
+    geometry::PointCloud serial = flipped;
+    utility::SetNumThreads(1);
+    serial.OrientNormalsConsistentTangentPlane(*graph);
+    utility::SetNumThreads(4);
+    geometry::PointCloud parallel = flipped;
+    parallel.OrientNormalsConsistentTangentPlane(*graph);
+    utility::SetNumThreads(0);
+    EXPECT_EQ(parallel.normals_, serial.normals_);
+    EXPECT_EQ(parallel.normals_, pc.normals_);
+
+    geometry::PointCloud no_normals;
+    no_normals.points_ = flipped.points_;
+    EXPECT_THROW(no_normals.OrientNormalsConsistentTangentPlane(10),
+                 std::runtime_error);
+}
+
 TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     std::vector<double> ref = {
             157.498711, 127.737235, 113.386920, 192.476725, 134.367386,
@@ -776,6 +1134,79 @@ TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     ExpectEQ(ref, distance);
 }
 
+TEST(PointCloud, ComputeChamferAndHausdorffDistance) {
+    geometry::PointCloud pc0;
+    geometry::PointCloud pc1;
+    pc0.points_.resize(2000);
+    pc1.points_.resize(1500);
+    Rand(pc0.points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Rand(pc1.points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+
+    auto brute_force = [](const geometry::PointCloud &source,
+                          const geometry::PointCloud &target) {
+        std::vector<double> distances(source.points_.size());
+        for (size_t i = 0; i < source.points_.size(); i++) {
+            double min_distance2 = std::numeric_limits<double>::infinity();
+            for (const auto &point : target.points_) {
+                min_distance2 = std::min(
+                        min_distance2,
+                        (source.points_[i] - point).squaredNorm());
+            }
+            distances[i] = std::sqrt(min_distance2);
+        }
+        return distances;
+    };
+    std::vector<double> ref01 = brute_force(pc0, pc1);
+    std::vector<double> ref10 = brute_force(pc1, pc0);
+    ExpectEQ(ref01, pc0.ComputePointCloudDistance(pc1));
+    ExpectEQ(ref10, pc1.ComputePointCloudDistance(pc0));
+
+    double chamfer =
+            std::accumulate(ref01.begin(), ref01.end(), 0.0) / ref01.size() +
+            std::accumulate(ref10.begin(), ref10.end(), 0.0) / ref10.size();
+    double hausdorff = std::max(*std::max_element(ref01.begin(), ref01.end()),
+                                *std::max_element(ref10.begin(), ref10.end()));
+    EXPECT_NEAR(chamfer, pc0.ComputeChamferDistance(pc1), THRESHOLD_1E_6);
+    EXPECT_NEAR(chamfer, pc1.ComputeChamferDistance(pc0), THRESHOLD_1E_6);
+    EXPECT_NEAR(hausdorff, pc0.ComputeHausdorffDistance(pc1), THRESHOLD_1E_6);
+    EXPECT_NEAR(hausdorff, pc1.ComputeHausdorffDistance(pc0), THRESHOLD_1E_6);
+    EXPECT_EQ(0.0, pc0.ComputeChamferDistance(pc0));
+    EXPECT_EQ(0.0, pc0.ComputeHausdorffDistance(pc0));
+
+    geometry::PointCloud empty;
+    EXPECT_EQ(0.0, empty.ComputeChamferDistance(empty));
+    EXPECT_EQ(0.0, empty.ComputeHausdorffDistance(empty));
+    EXPECT_TRUE(std::isinf(pc0.ComputeChamferDistance(empty)));
+    EXPECT_TRUE(std::isinf(empty.ComputeHausdorffDistance(pc0)));
+    ExpectEQ(std::vector<double>(pc0.points_.size(), 0.0),
+             pc0.ComputePointCloudDistance(empty));
+}
+
+TEST(PointCloud, ComputeDistanceToMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(-2.0, -2.0, -2.0),
+         Eigen::Vector3d(2.0, 2.0, 2.0), 0);
+
+    std::vector<double> distances = pc.ComputeDistanceToMesh(*mesh);
+    ASSERT_EQ(pc.points_.size(), distances.size());
+    for (size_t i = 0; i < pc.points_.size(); i++) {
+        // The tessellation lies inside the unit sphere, at most a small
+        // chord sagitta away from it.
+        double sphere_distance = std::abs(pc.points_[i].norm() - 1.0);
+        EXPECT_NEAR(sphere_distance, distances[i], 5e-3);
+    }
+
+    geometry::TriangleMeshBVH bvh(*mesh);
+    ExpectEQ(distances, pc.ComputeDistanceToMesh(bvh));
+
+    geometry::TriangleMesh empty_mesh;
+    for (double distance : pc.ComputeDistanceToMesh(empty_mesh)) {
+        EXPECT_TRUE(std::isinf(distance));
+    }
+}
+
 TEST(PointCloud, ComputePointCloudMeanAndCovariance) {
     int size = 40;
     geometry::PointCloud pc;
@@ -874,6 +1305,48 @@ TEST(PointCloud, ComputePointCloudNearestNeighborDistance) {
     ExpectEQ(ref, distance);
 }
 
+TEST(PointCloud, HiddenPointRemoval) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::PointCloud pc;
+    pc.points_ = sphere->vertices_;
+    const std::vector<Eigen::Vector3d> camera_locations = {
+            {0, 0, 5}, {5, 0, 0}, {0, -3, 4}};
+    auto results = pc.HiddenPointRemoval(camera_locations, 100.0);
+    ASSERT_EQ(results.size(), camera_locations.size());
+    for (size_t cidx = 0; cidx < camera_locations.size(); ++cidx) {
+        std::shared_ptr<geometry::TriangleMesh> mesh;
+        std::vector<size_t> pt_map;
+        std::tie(mesh, pt_map) =
+                pc.HiddenPointRemoval(camera_locations[cidx], 100.0);
+        ExpectEQ(std::get<0>(results[cidx])->vertices_, mesh->vertices_);
+        ExpectEQ(std::get<0>(results[cidx])->triangles_, mesh->triangles_);
+        EXPECT_EQ(std::get<1>(results[cidx]), pt_map);
+
+        // The camera sees the points with a normal towards it, i.e. above
+        // the circle where its lines of sight touch the sphere.
+        ASSERT_EQ(pt_map.size(), mesh->vertices_.size());
+        std::vector<bool> is_visible(pc.points_.size(), false);
+        for (size_t vidx = 0; vidx < pt_map.size(); ++vidx) {
+            ExpectEQ(mesh->vertices_[vidx], pc.points_[pt_map[vidx]]);
+            is_visible[pt_map[vidx]] = true;
+        }
+        const Eigen::Vector3d dir = camera_locations[cidx].normalized();
+        for (size_t pidx = 0; pidx < pc.points_.size(); ++pidx) {
+            const double cos_angle = dir.dot(pc.points_[pidx]);
+            if (cos_angle > 0.4) {
+                EXPECT_TRUE(is_visible[pidx]);
+            } else if (cos_angle < 0) {
+                EXPECT_FALSE(is_visible[pidx]);
+            }
+        }
+        for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+            EXPECT_GE(triangle.minCoeff(), 0);
+            EXPECT_LT(triangle.maxCoeff(), int(mesh->vertices_.size()));
+        }
+    }
+    EXPECT_ANY_THROW(pc.HiddenPointRemoval(Eigen::Vector3d(0, 0, 5), 0.0));
+}
+
 TEST(PointCloud, CreatePointCloudFromDepthImage) {
     std::vector<Eigen::Vector3d> ref = {{-15.709662, -11.776101, 25.813999},
                                         {-31.647980, -23.798088, 52.167000},
@@ -1067,6 +1540,75 @@ TEST(PointCloud, CreatePointCloudFromRGBDImage_1_4) {
                                        ref_colors);
 }
 
+TEST(PointCloud, ClusterDBSCAN) {
+    // Three dense blobs in sparse noise.
+    geometry::PointCloud pc;
+    const std::vector<Eigen::Vector3d> centers = {
+            {1.0, 1.0, 1.0}, {5.0, 1.0, 2.0}, {3.0, 6.0, 4.0}};
+    for (size_t c = 0; c < centers.size(); c++) {
+        std::vector<Eigen::Vector3d> blob(500);
+        Rand(blob, centers[c] - Eigen::Vector3d(1.0, 1.0, 1.0),
+             centers[c] + Eigen::Vector3d(1.0, 1.0, 1.0), int(c));
+        pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    }
+    std::vector<Eigen::Vector3d> noise(500);
+    Rand(noise, Eigen::Vector3d(-2.0, -2.0, -2.0),
+         Eigen::Vector3d(8.0, 8.0, 8.0), 3);
+    pc.points_.insert(pc.points_.end(), noise.begin(), noise.end());
+    std::shuffle(pc.points_.begin(), pc.points_.end(), std::mt19937(0));
+
+    const double eps = 0.3;
+    const size_t min_points = 8;
+
+    // Reference DBSCAN with brute force neighborhoods. Clusters are grown in
+    // the order of their first core point.
+    const int num_points = int(pc.points_.size());
+    std::vector<std::vector<int>> nbs(num_points);
+    for (int i = 0; i < num_points; i++) {
+        for (int j = 0; j < num_points; j++) {
+            if ((pc.points_[i] - pc.points_[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(j);
+            }
+        }
+    }
+    std::vector<int> ref(num_points, -2);
+    int num_clusters = 0;
+    for (int i = 0; i < num_points; i++) {
+        if (ref[i] != -2) {
+            continue;
+        }
+        if (nbs[i].size() < min_points) {
+            ref[i] = -1;
+            continue;
+        }
+        std::vector<int> queue = {i};
+        ref[i] = num_clusters;
+        while (!queue.empty()) {
+            int p = queue.back();
+            queue.pop_back();
+            if (nbs[p].size() < min_points) {
+                continue;
+            }
+            for (int q : nbs[p]) {
+                if (ref[q] == -2 || ref[q] == -1) {
+                    if (ref[q] == -2) {
+                        queue.push_back(q);
+                    }
+                    ref[q] = num_clusters;
+                }
+            }
+        }
+        num_clusters++;
+    }
+    EXPECT_GE(num_clusters, 3);
+
+    EXPECT_EQ(ref, pc.ClusterDBSCAN(eps, min_points));
+    EXPECT_EQ(std::vector<int>(num_points, 0),
+              pc.ClusterDBSCAN(100.0, min_points));
+    EXPECT_EQ(std::vector<int>(), geometry::PointCloud().ClusterDBSCAN(eps, 1));
+    EXPECT_ANY_THROW(pc.ClusterDBSCAN(0.0, min_points));
+}
+
 TEST(PointCloud, SegmentPlane) {
     // Points sampled from the plane x + y + z + 1 = 0
     std::vector<Eigen::Vector3d> ref = {{1.0, 1.0, -3.0},
@@ -1089,5 +1631,39 @@ TEST(PointCloud, SegmentPlane) {
     ExpectEQ(ref, output_pc->points_);
 }
 
+TEST(PointCloud, SegmentPlaneWithOutliers) {
+    // 6000 points sampled from the plane 0.5x - 0.25y - z + 1 = 0, followed
+    // by 4000 outliers.
+    geometry::PointCloud pc;
+    pc.points_.resize(6000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 0.0), 0);
+    for (auto &point : pc.points_) {
+        point(2) = 0.5 * point(0) - 0.25 * point(1) + 1.0;
+    }
+    std::vector<Eigen::Vector3d> outliers(4000);
+    Rand(outliers, Eigen::Vector3d(0.0, 0.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pc.SegmentPlane(0.01, 3, 1000);
+
+    Eigen::Vector4d ref_model(0.5, -0.25, -1.0, 1.0);
+    ref_model /= ref_model.head<3>().norm();
+    if (plane_model.dot(ref_model) < 0) {
+        plane_model *= -1.0;
+    }
+    ExpectEQ(ref_model, plane_model, 1e-3);
+    ASSERT_GE(inliers.size(), 6000u);
+    for (size_t i = 0; i < 6000; i++) {
+        EXPECT_EQ(i, inliers[i]);
+    }
+
+    EXPECT_ANY_THROW(pc.SegmentPlane(0.01, 3, 1000, 0.0));
+    EXPECT_ANY_THROW(pc.SegmentPlane(0.01, 3, 1000, 1.5));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
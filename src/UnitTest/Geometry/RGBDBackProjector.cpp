@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RGBDBackProjector.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+// Depth of a 64x48 uint16_t image in mm, with invalid and far pixels.
+static geometry::Image MakeDepthImage() {
+    geometry::Image depth;
+    depth.Prepare(64, 48, 1, 2);
+    uint16_t *data = (uint16_t *)depth.data_.data();
+    for (int i = 0; i < depth.width_ * depth.height_; i++) {
+        data[i] = (i % 7 == 0) ? 0 : uint16_t(500 + (i * 37) % 3000);
+    }
+    return depth;
+}
+
+// Serial reference of the back-projection of the sampled pixels.
+static std::vector<Eigen::Vector3d> BackProject(
+        const geometry::Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min,
+        double depth_max,
+        int stride,
+        bool project_valid_depth_only) {
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    const auto f = intrinsic.GetFocalLength();
+    const auto c = intrinsic.GetPrincipalPoint();
+    std::vector<Eigen::Vector3d> points;
+    for (int v = 0; v < depth.height_; v += stride) {
+        for (int u = 0; u < depth.width_; u += stride) {
+            // Scaled in float as in Image::ConvertDepthToFloatImage.
+            double z = *depth.PointerAt<uint16_t>(u, v) / 1000.0f;
+            if (z > depth_min && z < depth_max) {
+                Eigen::Vector4d p(z * (u - c.first) / f.first,
+                                  z * (v - c.second) / f.second, z, 1.0);
+                points.push_back((pose * p).head<3>());
+            } else if (!project_valid_depth_only) {
+                points.push_back(Eigen::Vector3d::Constant(NAN));
+            }
+        }
+    }
+    return points;
+}
+
+TEST(RGBDBackProjector, CreateFromDepthImage) {
+    const geometry::Image depth = MakeDepthImage();
+    const camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 52.0, 31.5,
+                                                   23.5);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.2, 0.3);
+
+    geometry::RGBDBackProjector projector(1000.0, 0.8, 2.5, 1, true);
+    geometry::PointCloud pointcloud;
+    projector.CreateFromDepthImage(depth, intrinsic, extrinsic, pointcloud);
+    ExpectEQ(BackProject(depth, intrinsic, extrinsic, 0.8, 2.5, 1, true),
+             pointcloud.points_);
+    EXPECT_FALSE(pointcloud.HasColors());
+
+    // The capacity of the output is reused.
+    const Eigen::Vector3d *data = pointcloud.points_.data();
+    projector.CreateFromDepthImage(depth, intrinsic, extrinsic, pointcloud);
+    EXPECT_EQ(data, pointcloud.points_.data());
+
+    // Strides that do not divide the image size, with NaN points.
+    projector.stride_ = 5;
+    projector.project_valid_depth_only_ = false;
+    projector.CreateFromDepthImage(depth, intrinsic, extrinsic, pointcloud);
+    auto ref = BackProject(depth, intrinsic, extrinsic, 0.8, 2.5, 5, false);
+    ASSERT_EQ(ref.size(), pointcloud.points_.size());
+    EXPECT_EQ(size_t(13 * 10), pointcloud.points_.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        if (std::isnan(ref[i](0))) {
+            EXPECT_TRUE(std::isnan(pointcloud.points_[i](0)));
+        } else {
+            ExpectEQ(ref[i], pointcloud.points_[i]);
+        }
+    }
+
+    // Same as the factory function of PointCloud.
+    geometry::RGBDBackProjector default_projector;
+    default_projector.CreateFromDepthImage(depth, intrinsic,
+                                           Eigen::Matrix4d::Identity(),
+                                           pointcloud);
+    ExpectEQ(geometry::PointCloud::CreateFromDepthImage(depth, intrinsic)
+                     ->points_,
+             pointcloud.points_);
+}
+
+TEST(RGBDBackProjector, CreateFromRGBDImage) {
+    const geometry::Image depth = MakeDepthImage();
+    const camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 52.0, 31.5,
+                                                   23.5);
+    geometry::Image color;
+    color.Prepare(64, 48, 3, 1);
+    for (size_t i = 0; i < color.data_.size(); i++) {
+        color.data_[i] = uint8_t(i * 13);
+    }
+    geometry::RGBDImage rgbd(color, *depth.ConvertDepthToFloatImage());
+
+    geometry::RGBDBackProjector projector(1.0, 0.0, 2.0, 2, true);
+    geometry::PointCloud pointcloud;
+    projector.CreateFromRGBDImage(rgbd, intrinsic, Eigen::Matrix4d::Identity(),
+                                  pointcloud);
+    auto ref = BackProject(depth, intrinsic, Eigen::Matrix4d::Identity(), 0.0,
+                           2.0, 2, true);
+    ExpectEQ(ref, pointcloud.points_);
+    ASSERT_EQ(pointcloud.points_.size(), pointcloud.colors_.size());
+    size_t i = 0;
+    for (int v = 0; v < depth.height_; v += 2) {
+        for (int u = 0; u < depth.width_; u += 2) {
+            double z = *depth.PointerAt<uint16_t>(u, v) / 1000.0f;
+            if (z > 0.0 && z < 2.0) {
+                const uint8_t *pc = color.PointerAt<uint8_t>(u, v, 0);
+                ExpectEQ(Eigen::Vector3d(pc[0] / 255.0, pc[1] / 255.0,
+                                         pc[2] / 255.0),
+                         pointcloud.colors_[i++]);
+            }
+        }
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
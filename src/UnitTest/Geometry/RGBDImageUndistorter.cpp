@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/RGBDImageUndistorter.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+// Color and depth of 64x48 images, depth in mm with invalid and far pixels.
+static geometry::Image MakeColorImage() {
+    geometry::Image color;
+    color.Prepare(64, 48, 3, 1);
+    for (size_t i = 0; i < color.data_.size(); i++) {
+        color.data_[i] = uint8_t(i * 13);
+    }
+    return color;
+}
+
+static geometry::Image MakeDepthImage() {
+    geometry::Image depth;
+    depth.Prepare(64, 48, 1, 2);
+    uint16_t *data = (uint16_t *)depth.data_.data();
+    for (int i = 0; i < depth.width_ * depth.height_; i++) {
+        data[i] = (i % 7 == 0) ? 0 : uint16_t(500 + (i * 37) % 3000);
+    }
+    return depth;
+}
+
+TEST(RGBDImageUndistorter, CreateFromColorAndDepthWithoutDistortion) {
+    const geometry::Image color = MakeColorImage();
+    const geometry::Image depth = MakeDepthImage();
+    const camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 52.0, 31.5,
+                                                   23.5);
+
+    // Same as the factory function of RGBDImage.
+    geometry::RGBDImageUndistorter undistorter(1000.0, 2.5, true);
+    geometry::RGBDImage rgbd;
+    undistorter.CreateFromColorAndDepth(color, depth, intrinsic, rgbd);
+    auto ref = geometry::RGBDImage::CreateFromColorAndDepth(color, depth,
+                                                            1000.0, 2.5, true);
+    ASSERT_EQ(ref->depth_.data_.size(), rgbd.depth_.data_.size());
+    ExpectEQ((const float *)ref->depth_.data_.data(),
+             (const float *)rgbd.depth_.data_.data(),
+             ref->depth_.width_ * ref->depth_.height_);
+    ASSERT_EQ(ref->color_.data_.size(), rgbd.color_.data_.size());
+    const float *ref_color = (const float *)ref->color_.data_.data();
+    const float *color_out = (const float *)rgbd.color_.data_.data();
+    for (int i = 0; i < color.width_ * color.height_; i++) {
+        EXPECT_NEAR(ref_color[i], color_out[i], 1e-4);
+    }
+
+    // The buffers of the output are reused.
+    const uint8_t *data = rgbd.depth_.data_.data();
+    undistorter.CreateFromColorAndDepth(color, depth, intrinsic, rgbd);
+    EXPECT_EQ(data, rgbd.depth_.data_.data());
+
+    // Without the intensity conversion, the color keeps its format.
+    undistorter.convert_rgb_to_intensity_ = false;
+    undistorter.CreateFromColorAndDepth(color, depth, intrinsic, rgbd);
+    EXPECT_EQ(3, rgbd.color_.num_of_channels_);
+    EXPECT_EQ(1, rgbd.color_.bytes_per_channel_);
+    for (size_t i = 0; i < color.data_.size(); i++) {
+        EXPECT_NEAR(color.data_[i], rgbd.color_.data_[i], 1);
+    }
+}
+
+TEST(RGBDImageUndistorter, CreateFromColorAndDepthWithDistortion) {
+    const geometry::Image color = MakeColorImage();
+    const geometry::Image depth = MakeDepthImage();
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 52.0, 31.5, 23.5);
+    intrinsic.SetDistortion(0.2, -0.1, 0.002, -0.001);
+
+    geometry::RGBDImageUndistorter undistorter(1000.0, 2.5, true);
+    geometry::RGBDImage rgbd;
+    undistorter.CreateFromColorAndDepth(color, depth, intrinsic, rgbd);
+    ASSERT_EQ(depth.width_, rgbd.depth_.width_);
+    ASSERT_EQ(depth.height_, rgbd.depth_.height_);
+
+    // Depth is sampled at the nearest distorted pixel.
+    const auto f = intrinsic.GetFocalLength();
+    const auto c = intrinsic.GetPrincipalPoint();
+    int num_outside = 0;
+    for (int v = 0; v < depth.height_; v++) {
+        for (int u = 0; u < depth.width_; u++) {
+            const Eigen::Vector2d xy_d = intrinsic.DistortNormalizedPoint(
+                    Eigen::Vector2d((u - c.first) / f.first,
+                                    (v - c.second) / f.second));
+            const double u_d = f.first * xy_d(0) + c.first;
+            const double v_d = f.second * xy_d(1) + c.second;
+            float ref = 0.0f;
+            if (u_d >= 0.0 && u_d <= depth.width_ - 1 && v_d >= 0.0 &&
+                v_d <= depth.height_ - 1) {
+                ref = *depth.PointerAt<uint16_t>(int(std::round(u_d)),
+                                                 int(std::round(v_d))) /
+                      1000.0f;
+                ref = ref >= 2.5 ? 0.0f : ref;
+            } else {
+                num_outside++;
+            }
+            EXPECT_EQ(ref, *rgbd.depth_.PointerAt<float>(u, v));
+        }
+    }
+    // The corners are distorted outside of the image with k1 > 0.
+    EXPECT_GT(num_outside, 0);
+
+    // The map is updated when the distortion changes.
+    intrinsic.SetDistortion(0.0, 0.0, 0.0, 0.0);
+    undistorter.CreateFromColorAndDepth(color, depth, intrinsic, rgbd);
+    auto ref = depth.ConvertDepthToFloatImage(1000.0, 2.5);
+    ExpectEQ((const float *)ref->data_.data(),
+             (const float *)rgbd.depth_.data_.data(),
+             depth.width_ * depth.height_);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
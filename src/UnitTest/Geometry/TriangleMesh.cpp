@@ -24,9 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+#include <map>
+#include <set>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Parallel.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -455,6 +460,40 @@ TEST(TriangleMesh, ComputeVertexNormals) {
     ExpectEQ(ref, tm.vertex_normals_);
 }
 
+TEST(TriangleMesh, ComputeVertexNormalsWeighting) {
+    // Two right triangles folded at edge (0, 1): a unit triangle in the z = 0
+    // plane and a triangle of twice its area in the y = 0 plane.
+    geometry::TriangleMesh tm;
+    tm.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, -2}};
+    tm.triangles_ = {{0, 1, 2}, {0, 1, 3}};
+    const Eigen::Vector3d up(0, 0, 1);
+    const Eigen::Vector3d side(0, 1, 0);
+
+    tm.ComputeVertexNormals(true,
+                            geometry::MeshBase::VertexNormalWeighting::Area);
+    ExpectEQ(tm.vertex_normals_[0], (up + 2 * side).normalized());
+    ExpectEQ(tm.vertex_normals_[2], up);
+    ExpectEQ(tm.vertex_normals_[3], side);
+
+    tm.ComputeVertexNormals(true,
+                            geometry::MeshBase::VertexNormalWeighting::Uniform);
+    ExpectEQ(tm.vertex_normals_[0], (up + side).normalized());
+    ExpectEQ(tm.vertex_normals_[1], (up + side).normalized());
+
+    tm.ComputeVertexNormals(true,
+                            geometry::MeshBase::VertexNormalWeighting::Angle);
+    ExpectEQ(tm.vertex_normals_[0], (up + side).normalized());
+    ExpectEQ(tm.vertex_normals_[1],
+             (M_PI / 4 * up + std::atan(2.0) * side).normalized());
+
+    // Without stored triangle normals, the default is area weighting, and
+    // repeated calls do not accumulate.
+    tm.ComputeVertexNormals(false);
+    tm.ComputeVertexNormals(false);
+    ExpectEQ(tm.vertex_normals_[0], Eigen::Vector3d(up + 2 * side));
+    ExpectEQ(tm.triangle_normals_[1], Eigen::Vector3d(2 * side));
+}
+
 TEST(TriangleMesh, ComputeAdjacencyList) {
     // 4-sided pyramid with A as top vertex, bottom has two triangles
     Eigen::Vector3d A(0, 0, 1);    // 0
@@ -645,6 +684,26 @@ TEST(TriangleMesh, Purge) {
     ExpectEQ(ref_triangle_normals, tm.triangle_normals_);
 }
 
+TEST(TriangleMesh, RemoveDuplicatedTriangles) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 3, 2}, {1, 2, 0}, {2, 0, 1},
+                       {0, 2, 1}, {3, 1, 2}, {1, 3, 2}};
+    mesh.triangle_normals_ = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0},
+                              {4, 0, 0}, {5, 0, 0}, {6, 0, 0}};
+    mesh.RemoveDuplicatedTriangles();
+
+    // Rotations of a triangle are removed, the flipped triangles are kept.
+    ExpectEQ(mesh.triangles_, std::vector<Eigen::Vector3i>(
+                                      {{0, 1, 2}, {1, 3, 2}, {0, 2, 1},
+                                       {3, 1, 2}}));
+    ExpectEQ(mesh.triangle_normals_, std::vector<Eigen::Vector3d>(
+                                             {{0, 0, 0},
+                                              {1, 0, 0},
+                                              {4, 0, 0},
+                                              {5, 0, 0}}));
+}
+
 TEST(TriangleMesh, MergeCloseVertices) {
     geometry::TriangleMesh mesh;
     mesh.vertices_ = {{0.000000, 0.000000, 0.000000},
@@ -698,6 +757,169 @@ TEST(TriangleMesh, MergeCloseVertices) {
     ExpectEQ(mesh, ref);
 }
 
+TEST(TriangleMesh, MergeCloseVerticesMatchesGreedyMerge) {
+    utility::SetNumThreads(4);
+    geometry::TriangleMesh mesh;
+    mesh.vertices_.resize(2000);
+    Rand(mesh.vertices_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1),
+         0);
+    mesh.triangles_.resize(1000);
+    Rand(mesh.triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(1999, 1999, 1999), 0);
+    const double eps = 0.05;
+
+    // Every vertex that is not merged yet takes all unmerged vertices within
+    // eps, the definition of MergeCloseVertices.
+    std::vector<int> ref_mapping(mesh.vertices_.size(), -1);
+    std::vector<Eigen::Vector3d> ref_vertices;
+    for (size_t i = 0; i < mesh.vertices_.size(); ++i) {
+        if (ref_mapping[i] >= 0) {
+            continue;
+        }
+        ref_mapping[i] = int(ref_vertices.size());
+        Eigen::Vector3d sum = mesh.vertices_[i];
+        int count = 1;
+        for (size_t j = i + 1; j < mesh.vertices_.size(); ++j) {
+            if (ref_mapping[j] < 0 &&
+                (mesh.vertices_[i] - mesh.vertices_[j]).norm() < eps) {
+                ref_mapping[j] = int(ref_vertices.size());
+                sum += mesh.vertices_[j];
+                count++;
+            }
+        }
+        ref_vertices.push_back(sum / count);
+    }
+    std::vector<Eigen::Vector3i> ref_triangles;
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        ref_triangles.emplace_back(ref_mapping[triangle(0)],
+                                   ref_mapping[triangle(1)],
+                                   ref_mapping[triangle(2)]);
+    }
+    EXPECT_LT(ref_vertices.size(), mesh.vertices_.size());
+
+    mesh.MergeCloseVertices(eps);
+    ExpectEQ(mesh.vertices_, ref_vertices);
+    ExpectEQ(mesh.triangles_, ref_triangles);
+    utility::SetNumThreads(0);
+}
+
+TEST(TriangleMesh, RemoveDuplicatedVerticesKeepsFirstOccurrence) {
+    utility::SetNumThreads(4);
+    geometry::TriangleMesh mesh;
+    std::vector<Eigen::Vector3d> unique_vertices(300);
+    Rand(unique_vertices, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         0);
+    std::vector<int> picks(3000);
+    Rand(picks, 0, 299, 0);
+    for (int pick : picks) {
+        mesh.vertices_.push_back(unique_vertices[pick]);
+        mesh.vertex_colors_.push_back(unique_vertices[pick].cwiseAbs());
+    }
+    mesh.vertices_.push_back(Eigen::Vector3d(std::nan(""), 0, 0));
+    mesh.vertex_colors_.push_back(Eigen::Vector3d(0, 0, 0));
+    mesh.vertices_.push_back(Eigen::Vector3d(std::nan(""), 0, 0));
+    mesh.vertex_colors_.push_back(Eigen::Vector3d(0, 0, 0));
+    for (int i = 0; i + 2 < int(mesh.vertices_.size()); i += 3) {
+        mesh.triangles_.emplace_back(i, i + 1, i + 2);
+    }
+
+    std::vector<int> first_of(300, -1);
+    std::vector<int> ref_mapping;
+    std::vector<Eigen::Vector3d> ref_vertices;
+    for (int pick : picks) {
+        if (first_of[pick] < 0) {
+            first_of[pick] = int(ref_vertices.size());
+            ref_vertices.push_back(unique_vertices[pick]);
+        }
+        ref_mapping.push_back(first_of[pick]);
+    }
+    // NaN vertices are never duplicates.
+    ref_mapping.push_back(int(ref_vertices.size()));
+    ref_mapping.push_back(int(ref_vertices.size()) + 1);
+
+    auto triangles = mesh.triangles_;
+    mesh.RemoveDuplicatedVertices();
+    ASSERT_EQ(mesh.vertices_.size(), ref_vertices.size() + 2);
+    ExpectEQ(std::vector<Eigen::Vector3d>(mesh.vertices_.begin(),
+                                          mesh.vertices_.end() - 2),
+             ref_vertices);
+    EXPECT_EQ(mesh.vertex_colors_.size(), mesh.vertices_.size());
+    for (size_t t = 0; t < triangles.size(); ++t) {
+        for (int k = 0; k < 3; ++k) {
+            EXPECT_EQ(mesh.triangles_[t](k), ref_mapping[triangles[t](k)]);
+        }
+    }
+    utility::SetNumThreads(0);
+}
+
+TEST(TriangleMesh, SimplifyVertexClustering) {
+    utility::SetNumThreads(4);
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 60);
+    sphere->ComputeVertexNormals();
+    const double voxel_size = 0.2;
+    for (auto contraction :
+         {geometry::MeshBase::SimplificationContraction::Average,
+          geometry::MeshBase::SimplificationContraction::Quadric}) {
+        auto mesh = sphere->SimplifyVertexClustering(voxel_size, contraction);
+
+        // The vertices are numbered in the order their voxels are first seen.
+        const Eigen::Vector3d voxel_min_bound =
+                sphere->GetMinBound() - Eigen::Vector3d::Constant(0.1);
+        auto GetVoxel = [&](const Eigen::Vector3d &vertex) {
+            Eigen::Vector3d ref_coord = (vertex - voxel_min_bound) / voxel_size;
+            return std::make_tuple(int(floor(ref_coord(0))),
+                                   int(floor(ref_coord(1))),
+                                   int(floor(ref_coord(2))));
+        };
+        std::map<std::tuple<int, int, int>, int> voxel_to_new;
+        std::vector<Eigen::Vector3d> sums;
+        std::vector<int> counts;
+        for (const Eigen::Vector3d &vertex : sphere->vertices_) {
+            auto voxel = GetVoxel(vertex);
+            if (voxel_to_new.count(voxel) == 0) {
+                voxel_to_new[voxel] = int(sums.size());
+                sums.push_back(Eigen::Vector3d::Zero());
+                counts.push_back(0);
+            }
+            sums[voxel_to_new[voxel]] += vertex;
+            counts[voxel_to_new[voxel]]++;
+        }
+        ASSERT_EQ(mesh->vertices_.size(), sums.size());
+        EXPECT_EQ(mesh->vertex_normals_.size(), sums.size());
+        if (contraction ==
+            geometry::MeshBase::SimplificationContraction::Average) {
+            for (size_t i = 0; i < sums.size(); ++i) {
+                ExpectEQ(mesh->vertices_[i],
+                         Eigen::Vector3d(sums[i] / counts[i]));
+            }
+        }
+
+        std::set<std::tuple<int, int, int>> ref_triangles;
+        for (const Eigen::Vector3i &triangle : sphere->triangles_) {
+            int v0 = voxel_to_new[GetVoxel(sphere->vertices_[triangle(0)])];
+            int v1 = voxel_to_new[GetVoxel(sphere->vertices_[triangle(1)])];
+            int v2 = voxel_to_new[GetVoxel(sphere->vertices_[triangle(2)])];
+            if (v0 == v1 || v0 == v2 || v1 == v2) {
+                continue;
+            }
+            if (v1 < v0 && v1 < v2) {
+                ref_triangles.emplace(v1, v2, v0);
+            } else if (v2 < v0 && v2 < v1) {
+                ref_triangles.emplace(v2, v0, v1);
+            } else {
+                ref_triangles.emplace(v0, v1, v2);
+            }
+        }
+        std::set<std::tuple<int, int, int>> triangles;
+        for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+            triangles.emplace(triangle(0), triangle(1), triangle(2));
+        }
+        EXPECT_EQ(triangles.size(), mesh->triangles_.size());
+        EXPECT_TRUE(triangles == ref_triangles);
+    }
+    utility::SetNumThreads(0);
+}
+
 TEST(TriangleMesh, SamplePointsUniformly) {
     auto mesh_empty = geometry::TriangleMesh();
     EXPECT_THROW(mesh_empty.SamplePointsUniformly(100), std::runtime_error);
@@ -756,6 +978,64 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsUniformlyNumThreads) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    size_t n_points = 20000;
+
+    utility::SetNumThreads(1);
+    auto pcd_ref = sphere->SamplePointsUniformly(n_points, false, 42);
+    utility::SetNumThreads(4);
+    auto pcd = sphere->SamplePointsUniformly(n_points, false, 42);
+    utility::SetNumThreads(0);
+
+    EXPECT_EQ(pcd->points_.size(), n_points);
+    EXPECT_TRUE(pcd->points_ == pcd_ref->points_);
+    EXPECT_TRUE(pcd->normals_ == pcd_ref->normals_);
+    for (const Eigen::Vector3d &point : pcd->points_) {
+        EXPECT_LE(point.norm(), 1.0 + 1e-9);
+        EXPECT_GT(point.norm(), 0.99);
+    }
+}
+
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh_empty = geometry::TriangleMesh();
+    EXPECT_THROW(mesh_empty.SamplePointsPoissonDisk(100), std::runtime_error);
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    size_t n_points = 1000;
+    for (auto method :
+         {geometry::MeshBase::PoissonDiskSamplingMethod::SampleElimination,
+          geometry::MeshBase::PoissonDiskSamplingMethod::ParallelGrid}) {
+        utility::SetNumThreads(1);
+        auto pcd_ref = sphere->SamplePointsPoissonDisk(n_points, 5, nullptr,
+                                                       false, 7, method);
+        utility::SetNumThreads(4);
+        auto pcd = sphere->SamplePointsPoissonDisk(n_points, 5, nullptr,
+                                                   false, 7, method);
+        utility::SetNumThreads(0);
+
+        EXPECT_EQ(pcd->points_.size(), n_points);
+        EXPECT_EQ(pcd->normals_.size(), n_points);
+        EXPECT_TRUE(pcd->points_ == pcd_ref->points_);
+
+        // Blue noise: no two samples are much closer than the spacing of a
+        // hexagonal packing of the sphere area.
+        double r_max = 2 * std::sqrt((sphere->GetSurfaceArea() / n_points) /
+                                     (2 * std::sqrt(3.)));
+        double min_dist2 = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < n_points; ++i) {
+            for (size_t j = i + 1; j < n_points; ++j) {
+                min_dist2 = std::min(
+                        min_dist2,
+                        (pcd->points_[i] - pcd->points_[j]).squaredNorm());
+            }
+        }
+        EXPECT_GT(std::sqrt(min_dist2), 0.25 * r_max);
+    }
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -838,6 +1118,111 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    // Four threads give the parallel method several partitions.
+    utility::SetNumThreads(4);
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 200);
+    sphere->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    for (auto method :
+         {geometry::MeshBase::QuadricDecimationMethod::Sequential,
+          geometry::MeshBase::QuadricDecimationMethod::Parallel}) {
+        auto mesh = sphere->SimplifyQuadricDecimation(2000, method);
+        EXPECT_LE(mesh->triangles_.size(), 2000u);
+        EXPECT_GE(mesh->triangles_.size(), 1990u);
+        EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+        EXPECT_TRUE(mesh->IsEdgeManifold());
+        EXPECT_EQ(mesh->EulerPoincareCharacteristic(), 2);
+        for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+            EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+        }
+        for (const Eigen::Vector3d &color : mesh->vertex_colors_) {
+            ExpectEQ(color, Eigen::Vector3d(0.2, 0.4, 0.6));
+        }
+        for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+            EXPECT_GE(triangle.minCoeff(), 0);
+            EXPECT_LT(triangle.maxCoeff(), int(mesh->vertices_.size()));
+            EXPECT_NE(triangle(0), triangle(1));
+            EXPECT_NE(triangle(1), triangle(2));
+            EXPECT_NE(triangle(2), triangle(0));
+        }
+    }
+    utility::SetNumThreads(0);
+
+    // A target above the number of triangles returns a copy.
+    auto mesh = sphere->SimplifyQuadricDecimation(
+            int(sphere->triangles_.size()),
+            geometry::MeshBase::QuadricDecimationMethod::Parallel);
+    ExpectEQ(mesh->vertices_, sphere->vertices_);
+    ExpectEQ(mesh->triangles_, sphere->triangles_);
+}
+
+TEST(TriangleMesh, SubdivideMidpoint) {
+    geometry::TriangleMesh square;
+    square.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    square.vertex_colors_ = square.vertices_;
+    square.triangles_ = {{0, 1, 2}, {1, 3, 2}};
+
+    // The edge vertices are numbered in the order the triangles reference
+    // their edges.
+    auto mesh = square.SubdivideMidpoint(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {
+            {0, 0, 0},     {1, 0, 0},   {0, 1, 0},   {1, 1, 0},  {0.5, 0, 0},
+            {0.5, 0.5, 0}, {0, 0.5, 0}, {1, 0.5, 0}, {0.5, 1, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 4, 6}, {4, 1, 5}, {5, 2, 6}, {4, 5, 6},
+            {1, 7, 5}, {7, 3, 8}, {8, 2, 5}, {7, 8, 5}};
+    ExpectEQ(mesh->vertices_, ref_vertices);
+    ExpectEQ(mesh->vertex_colors_, ref_vertices);
+    ExpectEQ(mesh->triangles_, ref_triangles);
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh = sphere->SubdivideMidpoint(2);
+    EXPECT_EQ(mesh->triangles_.size(), 16 * sphere->triangles_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold());
+    EXPECT_EQ(mesh->EulerPoincareCharacteristic(), 2);
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    geometry::TriangleMesh square;
+    square.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    square.triangles_ = {{0, 1, 2}, {1, 3, 2}};
+
+    // The corners move along the boundary, the vertex on the diagonal
+    // is weighted by the opposite corners.
+    auto mesh = square.SubdivideLoop(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {
+            {0.125, 0.125, 0}, {0.875, 0.125, 0}, {0.125, 0.875, 0},
+            {0.875, 0.875, 0}, {0.5, 0, 0},       {0.5, 0.5, 0},
+            {0, 0.5, 0},       {1, 0.5, 0},       {0.5, 1, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 4, 6}, {4, 1, 5}, {5, 2, 6}, {4, 5, 6},
+            {1, 7, 5}, {7, 3, 8}, {8, 2, 5}, {7, 8, 5}};
+    ExpectEQ(mesh->vertices_, ref_vertices);
+    ExpectEQ(mesh->triangles_, ref_triangles);
+
+    // The result does not depend on the number of threads.
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    utility::SetNumThreads(1);
+    auto serial = sphere->SubdivideLoop(2);
+    utility::SetNumThreads(4);
+    mesh = sphere->SubdivideLoop(2);
+    utility::SetNumThreads(0);
+    ExpectEQ(mesh->vertices_, serial->vertices_);
+    ExpectEQ(mesh->vertex_normals_, serial->vertex_normals_);
+    ExpectEQ(mesh->triangles_, serial->triangles_);
+    EXPECT_EQ(mesh->triangles_.size(), 16 * sphere->triangles_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold());
+    EXPECT_EQ(mesh->EulerPoincareCharacteristic(), 2);
+    for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+    for (const Eigen::Vector3d &color : mesh->vertex_colors_) {
+        ExpectEQ(color, Eigen::Vector3d(0.2, 0.4, 0.6));
+    }
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1054,6 +1439,31 @@ TEST(TriangleMesh, IsVertexManifold) {
     EXPECT_EQ(mesh1.IsVertexManifold(), false);
 }
 
+TEST(TriangleMesh, OrientTriangles) {
+    EXPECT_TRUE(geometry::TriangleMesh::CreateSphere()->IsOrientable());
+    EXPECT_TRUE(geometry::TriangleMesh::CreateTorus()->IsOrientable());
+    EXPECT_FALSE(geometry::TriangleMesh::CreateMoebius()->IsOrientable());
+
+    // Flip every third triangle of a sphere, then all triangles must face
+    // the same side again.
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    for (size_t tidx = 0; tidx < mesh->triangles_.size(); tidx += 3) {
+        std::swap(mesh->triangles_[tidx](0), mesh->triangles_[tidx](1));
+    }
+    EXPECT_TRUE(mesh->IsOrientable());
+    EXPECT_TRUE(mesh->OrientTriangles());
+    int n_outward = 0;
+    for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+        const Eigen::Vector3d &p0 = mesh->vertices_[triangle(0)];
+        const Eigen::Vector3d &p1 = mesh->vertices_[triangle(1)];
+        const Eigen::Vector3d &p2 = mesh->vertices_[triangle(2)];
+        if ((p1 - p0).cross(p2 - p0).dot(p0 + p1 + p2) > 0) {
+            n_outward++;
+        }
+    }
+    EXPECT_TRUE(n_outward == 0 || n_outward == int(mesh->triangles_.size()));
+}
+
 TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_EQ(geometry::TriangleMesh::CreateBox()->IsSelfIntersecting(), false);
     EXPECT_EQ(geometry::TriangleMesh::CreateSphere()->IsSelfIntersecting(),
@@ -1881,6 +2291,100 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonOption) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<double> densities;
+    geometry::PoissonReconstructionStatistics statistics;
+    std::tie(mesh, densities, statistics) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, geometry::PoissonReconstructionOption(5));
+    EXPECT_EQ(statistics.num_points_, pcd.points_.size());
+    EXPECT_EQ(statistics.num_tiles_, 1u);
+    EXPECT_GT(statistics.num_samples_, 0u);
+    EXPECT_GE(statistics.total_time_,
+              statistics.octree_time_ + statistics.solve_time_ +
+                      statistics.iso_surface_time_);
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_EQ(densities.size(), mesh->vertices_.size());
+
+    // The tiled mode bounds the points per tile and covers the same surface.
+    geometry::PoissonReconstructionOption option(5);
+    option.num_threads_ = 2;
+    option.max_points_per_tile_ = pcd.points_.size() / 3;
+    std::shared_ptr<geometry::TriangleMesh> tiled_mesh;
+    std::vector<double> tiled_densities;
+    std::tie(tiled_mesh, tiled_densities, statistics) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option);
+    EXPECT_EQ(statistics.num_tiles_, 4u);
+    EXPECT_EQ(tiled_densities.size(), tiled_mesh->vertices_.size());
+    EXPECT_GT(tiled_mesh->triangles_.size(), mesh->triangles_.size() / 2);
+    for (const Eigen::Vector3d &vertex : tiled_mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.2);
+    }
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Fibonacci sphere, the points are evenly spaced at about 0.07.
+    const int n = 2500;
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1) / double(n);
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_.push_back({r * std::cos(phi), r * std::sin(phi), z});
+    }
+    pcd.normals_ = pcd.points_;
+    const std::vector<double> radii = {0.06, 0.12};
+
+    auto CountEdges = [](const geometry::TriangleMesh &mesh) {
+        std::map<std::pair<int, int>, int> edges;
+        for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+            for (int i = 0; i < 3; ++i) {
+                int v0 = triangle(i);
+                int v1 = triangle((i + 1) % 3);
+                edges[{std::min(v0, v1), std::max(v0, v1)}]++;
+            }
+        }
+        return edges;
+    };
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii);
+    EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(mesh->triangle_normals_.size(), mesh->triangles_.size());
+    EXPECT_GT(mesh->triangles_.size(), size_t(0.95 * (2 * n - 4)));
+    for (const auto &edge : CountEdges(*mesh)) {
+        EXPECT_LE(edge.second, 2);
+    }
+
+    // The tiled mode closes the seams between the tiles.
+    auto tiled_mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, n / 5);
+    EXPECT_EQ(tiled_mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(tiled_mesh->triangle_normals_.size(),
+              tiled_mesh->triangles_.size());
+    EXPECT_GT(tiled_mesh->triangles_.size(), size_t(0.95 * (2 * n - 4)));
+    std::set<std::tuple<int, int, int>> triangles;
+    for (Eigen::Vector3i triangle : tiled_mesh->triangles_) {
+        std::sort(triangle.data(), triangle.data() + 3);
+        EXPECT_TRUE(triangles.emplace(triangle(0), triangle(1), triangle(2))
+                            .second);
+    }
+    for (const auto &edge : CountEdges(*tiled_mesh)) {
+        EXPECT_LE(edge.second, 2);
+    }
+
+    geometry::PointCloud no_normals;
+    no_normals.points_ = pcd.points_;
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            no_normals, radii));
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
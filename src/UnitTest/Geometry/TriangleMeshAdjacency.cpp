@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshAdjacency.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+#include <set>
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// The adjacency must match TriangleMesh::GetEdgeToTrianglesMap and the
+/// vertex neighbors collected from every triangle.
+void ExpectAdjacencyEQ(const geometry::TriangleMesh &mesh,
+                       const geometry::TriangleMeshAdjacency &adjacency) {
+    ASSERT_EQ(adjacency.NumVertices(), mesh.vertices_.size());
+    ASSERT_EQ(adjacency.NumTriangles(), mesh.triangles_.size());
+    ASSERT_EQ(adjacency.edge_offsets_.size(), adjacency.NumEdges() + 1);
+    ASSERT_EQ(size_t(adjacency.edge_offsets_.back()),
+              adjacency.edge_triangles_.size());
+    ASSERT_EQ(size_t(adjacency.vertex_offsets_.back()),
+              adjacency.vertex_neighbors_.size());
+
+    const auto edges_to_triangles = mesh.GetEdgeToTrianglesMap();
+    ASSERT_EQ(edges_to_triangles.size(), adjacency.NumEdges());
+    for (size_t eidx = 0; eidx < adjacency.NumEdges(); ++eidx) {
+        const Eigen::Vector2i &edge = adjacency.edges_[eidx];
+        EXPECT_LE(edge(0), edge(1));
+        if (eidx > 0) {
+            const Eigen::Vector2i &prev = adjacency.edges_[eidx - 1];
+            EXPECT_TRUE(prev(0) < edge(0) ||
+                        (prev(0) == edge(0) && prev(1) < edge(1)));
+        }
+        EXPECT_EQ(adjacency.GetEdgeIndex(edge(1), edge(0)), int(eidx));
+        const std::vector<int> triangles(
+                adjacency.edge_triangles_.begin() +
+                        adjacency.edge_offsets_[eidx],
+                adjacency.edge_triangles_.begin() +
+                        adjacency.edge_offsets_[eidx + 1]);
+        EXPECT_EQ(triangles, edges_to_triangles.at(edge));
+    }
+
+    for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        for (int k = 0; k < 3; ++k) {
+            const int eidx = adjacency.triangle_edges_[tidx](k);
+            ExpectEQ(adjacency.edges_[eidx],
+                     geometry::TriangleMesh::GetOrderedEdge(
+                             triangle(k), triangle((k + 1) % 3)));
+        }
+    }
+
+    std::vector<std::set<int>> neighbors(mesh.vertices_.size());
+    for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+        for (int k = 0; k < 3; ++k) {
+            neighbors[triangle(k)].insert(triangle((k + 1) % 3));
+            neighbors[triangle((k + 1) % 3)].insert(triangle(k));
+        }
+    }
+    for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+        const std::vector<int> vertex_neighbors(
+                adjacency.vertex_neighbors_.begin() +
+                        adjacency.vertex_offsets_[vidx],
+                adjacency.vertex_neighbors_.begin() +
+                        adjacency.vertex_offsets_[vidx + 1]);
+        EXPECT_EQ(vertex_neighbors, std::vector<int>(neighbors[vidx].begin(),
+                                                     neighbors[vidx].end()));
+    }
+}
+
+}  // namespace
+
+TEST(TriangleMeshAdjacency, Empty) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_.resize(3);
+    auto adjacency =
+            geometry::TriangleMeshAdjacency::CreateFromTriangleMesh(mesh);
+    EXPECT_EQ(adjacency->NumVertices(), 3u);
+    EXPECT_EQ(adjacency->NumEdges(), 0u);
+    EXPECT_EQ(adjacency->NumTriangles(), 0u);
+    EXPECT_EQ(adjacency->NumVertexNeighbors(1), 0);
+    EXPECT_EQ(adjacency->GetEdgeIndex(0, 1), -1);
+    ExpectAdjacencyEQ(mesh, *adjacency);
+}
+
+TEST(TriangleMeshAdjacency, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    auto adjacency =
+            geometry::TriangleMeshAdjacency::CreateFromTriangleMesh(*mesh);
+    ExpectAdjacencyEQ(*mesh, *adjacency);
+    for (size_t eidx = 0; eidx < adjacency->NumEdges(); ++eidx) {
+        EXPECT_EQ(adjacency->NumEdgeTriangles(eidx), 2);
+    }
+    EXPECT_EQ(adjacency->GetEdgeIndex(0, 0), -1);
+
+    // Non-manifold edges, a degenerate triangle and an unreferenced vertex.
+    geometry::TriangleMesh soup;
+    soup.vertices_.resize(7);
+    soup.triangles_ = {{0, 1, 2}, {1, 0, 3}, {0, 1, 4}, {4, 4, 5}, {2, 1, 3}};
+    adjacency = geometry::TriangleMeshAdjacency::CreateFromTriangleMesh(soup);
+    ExpectAdjacencyEQ(soup, *adjacency);
+    EXPECT_EQ(adjacency->NumEdgeTriangles(adjacency->GetEdgeIndex(0, 1)), 3);
+    EXPECT_EQ(adjacency->NumEdgeTriangles(adjacency->GetEdgeIndex(5, 4)), 2);
+    EXPECT_EQ(adjacency->NumVertexNeighbors(6), 0);
+}
+
+TEST(TriangleMeshAdjacency, InvalidTriangle) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_.resize(3);
+    mesh.triangles_ = {{0, 1, 3}};
+    EXPECT_ANY_THROW(
+            geometry::TriangleMeshAdjacency::CreateFromTriangleMesh(mesh));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
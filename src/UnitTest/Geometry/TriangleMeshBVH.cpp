@@ -0,0 +1,351 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshBVH.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+#include <algorithm>
+#include <random>
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Random triangles of varying size in [-1, 1]^3, sharing no vertices.
+geometry::TriangleMesh CreateTriangleSoup(int num_triangles,
+                                          double max_size,
+                                          unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> center_dist(-1.0, 1.0);
+    std::uniform_real_distribution<double> offset_dist(-max_size, max_size);
+    geometry::TriangleMesh mesh;
+    for (int i = 0; i < num_triangles; ++i) {
+        Eigen::Vector3d center(center_dist(rng), center_dist(rng),
+                               center_dist(rng));
+        for (int j = 0; j < 3; ++j) {
+            mesh.vertices_.push_back(
+                    center + Eigen::Vector3d(offset_dist(rng), offset_dist(rng),
+                                             offset_dist(rng)));
+        }
+        mesh.triangles_.push_back(Eigen::Vector3i(3 * i, 3 * i + 1, 3 * i + 2));
+    }
+    return mesh;
+}
+
+std::vector<Eigen::Vector3d> CreateRandomPoints(int num_points,
+                                                double range,
+                                                unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-range, range);
+    std::vector<Eigen::Vector3d> points(num_points);
+    for (Eigen::Vector3d &point : points) {
+        point = Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+    }
+    return points;
+}
+
+/// Reference ray-triangle test by intersecting the ray with the plane of the
+/// triangle and solving for the barycentric coordinates.
+bool RayTriangle(const Eigen::Vector3d &origin,
+                 const Eigen::Vector3d &direction,
+                 const Eigen::Vector3d &p0,
+                 const Eigen::Vector3d &p1,
+                 const Eigen::Vector3d &p2,
+                 double &t) {
+    Eigen::Matrix3d system;
+    system << p1 - p0, p2 - p0, -direction;
+    if (std::abs(system.determinant()) < 1e-12) {
+        return false;
+    }
+    const Eigen::Vector3d solution = system.inverse() * (origin - p0);
+    t = solution(2);
+    return solution(0) >= 0 && solution(1) >= 0 &&
+           solution(0) + solution(1) <= 1 && t >= 0;
+}
+
+/// Reference closest point: the projection onto the plane of the triangle if
+/// it is inside, else the closest point on the edges.
+Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &point,
+                                       const Eigen::Vector3d &p0,
+                                       const Eigen::Vector3d &p1,
+                                       const Eigen::Vector3d &p2) {
+    const Eigen::Vector3d normal = (p1 - p0).cross(p2 - p0).normalized();
+    const Eigen::Vector3d projection =
+            point - normal.dot(point - p0) * normal;
+    const Eigen::Vector3d c0 = (p1 - p0).cross(projection - p0);
+    const Eigen::Vector3d c1 = (p2 - p1).cross(projection - p1);
+    const Eigen::Vector3d c2 = (p0 - p2).cross(projection - p2);
+    if (c0.dot(normal) >= 0 && c1.dot(normal) >= 0 && c2.dot(normal) >= 0) {
+        return projection;
+    }
+    Eigen::Vector3d closest;
+    double closest_distance2 = std::numeric_limits<double>::infinity();
+    const Eigen::Vector3d corners[4] = {p0, p1, p2, p0};
+    for (int i = 0; i < 3; ++i) {
+        const Eigen::Vector3d edge = corners[i + 1] - corners[i];
+        const double s = std::min(
+                std::max((point - corners[i]).dot(edge) / edge.squaredNorm(),
+                         0.0),
+                1.0);
+        const Eigen::Vector3d candidate = corners[i] + s * edge;
+        if ((candidate - point).squaredNorm() < closest_distance2) {
+            closest_distance2 = (candidate - point).squaredNorm();
+            closest = candidate;
+        }
+    }
+    return closest;
+}
+
+}  // namespace
+
+TEST(TriangleMeshBVH, Empty) {
+    geometry::TriangleMeshBVH bvh((geometry::TriangleMesh()));
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_EQ(bvh.NumTriangles(), 0u);
+    EXPECT_FALSE(bvh.CastRay({0, 0, 0}, {0, 0, 1}).IsHit());
+    EXPECT_FALSE(bvh.IsOccluded({0, 0, 0}, {0, 0, 1}));
+    EXPECT_EQ(bvh.ComputeClosestPoint({0, 0, 0}).triangle_index_, -1);
+    std::vector<int> indices = {0};
+    bvh.GetTrianglesOverlappingBox({-1, -1, -1}, {1, 1, 1}, indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(TriangleMeshBVH, CastRays) {
+    const geometry::TriangleMesh mesh = CreateTriangleSoup(3000, 0.1, 0);
+    const geometry::TriangleMeshBVH bvh(mesh);
+    EXPECT_EQ(bvh.NumTriangles(), mesh.triangles_.size());
+
+    const std::vector<Eigen::Vector3d> origins =
+            CreateRandomPoints(1000, 1.5, 1);
+    const std::vector<Eigen::Vector3d> directions =
+            CreateRandomPoints(1000, 1.0, 2);
+    const std::vector<geometry::TriangleMeshBVH::RayHit> hits =
+            bvh.CastRays(origins, directions);
+    const double t_max = 0.5;
+    const std::vector<bool> occluded =
+            bvh.TestOcclusions(origins, directions, t_max);
+    ASSERT_EQ(hits.size(), origins.size());
+    ASSERT_EQ(occluded.size(), origins.size());
+    int num_hits = 0;
+    for (size_t i = 0; i < origins.size(); ++i) {
+        int expected_index = -1;
+        double expected_t = std::numeric_limits<double>::infinity();
+        for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+            double t;
+            if (RayTriangle(origins[i], directions[i],
+                            mesh.vertices_[triangle(0)],
+                            mesh.vertices_[triangle(1)],
+                            mesh.vertices_[triangle(2)], t) &&
+                t < expected_t) {
+                expected_t = t;
+                expected_index = static_cast<int>(tidx);
+            }
+        }
+        EXPECT_EQ(hits[i].triangle_index_, expected_index);
+        EXPECT_EQ(occluded[i], expected_t < t_max);
+        if (expected_index < 0) {
+            continue;
+        }
+        num_hits++;
+        EXPECT_NEAR(hits[i].t_, expected_t, 1e-9);
+        // The hit point from the barycentric coordinates is on the ray.
+        const Eigen::Vector3i &triangle = mesh.triangles_[expected_index];
+        const Eigen::Vector3d point =
+                (1 - hits[i].u_ - hits[i].v_) * mesh.vertices_[triangle(0)] +
+                hits[i].u_ * mesh.vertices_[triangle(1)] +
+                hits[i].v_ * mesh.vertices_[triangle(2)];
+        const Eigen::Vector3d ray_point =
+                origins[i] + hits[i].t_ * directions[i];
+        ExpectEQ(point, ray_point, 1e-9);
+    }
+    EXPECT_GT(num_hits, 100);
+
+    EXPECT_ANY_THROW(bvh.CastRays(origins, {Eigen::Vector3d(0, 0, 1)}));
+}
+
+TEST(TriangleMeshBVH, ComputeClosestPoints) {
+    const geometry::TriangleMesh mesh = CreateTriangleSoup(2000, 0.2, 3);
+    const geometry::TriangleMeshBVH bvh(mesh);
+    const std::vector<Eigen::Vector3d> queries =
+            CreateRandomPoints(500, 1.5, 4);
+    const std::vector<geometry::TriangleMeshBVH::ClosestPoint> closest =
+            bvh.ComputeClosestPoints(queries);
+    ASSERT_EQ(closest.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        double expected_distance2 = std::numeric_limits<double>::infinity();
+        for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+            const Eigen::Vector3d point = ClosestPointOnTriangle(
+                    queries[i], mesh.vertices_[triangle(0)],
+                    mesh.vertices_[triangle(1)], mesh.vertices_[triangle(2)]);
+            expected_distance2 = std::min(expected_distance2,
+                                          (point - queries[i]).squaredNorm());
+        }
+        EXPECT_NEAR(closest[i].distance2_, expected_distance2, 1e-9);
+        EXPECT_NEAR((closest[i].point_ - queries[i]).squaredNorm(),
+                    closest[i].distance2_, 1e-9);
+        // The point is on the reported triangle.
+        ASSERT_GE(closest[i].triangle_index_, 0);
+        const Eigen::Vector3i &triangle =
+                mesh.triangles_[closest[i].triangle_index_];
+        const Eigen::Vector3d on_triangle = ClosestPointOnTriangle(
+                closest[i].point_, mesh.vertices_[triangle(0)],
+                mesh.vertices_[triangle(1)], mesh.vertices_[triangle(2)]);
+        ExpectEQ(on_triangle, closest[i].point_, 1e-9);
+    }
+}
+
+TEST(TriangleMeshBVH, GetTrianglesOverlappingBox) {
+    const geometry::TriangleMesh mesh = CreateTriangleSoup(5000, 0.05, 5);
+    const geometry::TriangleMeshBVH bvh(mesh);
+    const std::vector<Eigen::Vector3d> corners =
+            CreateRandomPoints(100, 1.0, 6);
+    for (size_t i = 0; i < corners.size(); i += 2) {
+        const Eigen::Vector3d min_bound = corners[i].cwiseMin(corners[i + 1]);
+        const Eigen::Vector3d max_bound = corners[i].cwiseMax(corners[i + 1]);
+        std::vector<int> expected;
+        for (size_t tidx = 0; tidx < mesh.triangles_.size(); ++tidx) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+            const Eigen::Vector3d &p0 = mesh.vertices_[triangle(0)];
+            const Eigen::Vector3d &p1 = mesh.vertices_[triangle(1)];
+            const Eigen::Vector3d &p2 = mesh.vertices_[triangle(2)];
+            if (geometry::IntersectionTest::AABBAABB(
+                        p0.cwiseMin(p1).cwiseMin(p2),
+                        p0.cwiseMax(p1).cwiseMax(p2), min_bound, max_bound)) {
+                expected.push_back(static_cast<int>(tidx));
+            }
+        }
+        std::vector<int> indices;
+        bvh.GetTrianglesOverlappingBox(min_bound, max_bound, indices);
+        std::sort(indices.begin(), indices.end());
+        EXPECT_EQ(indices, expected);
+    }
+}
+
+TEST(TriangleMeshBVH, RenderDepthImage) {
+    // A square at z = 2 in front of the camera, covering its left half, and
+    // a tilted square behind it.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{-10, -10, 2}, {0, -10, 2},  {0, 10, 2}, {-10, 10, 2},
+                      {-10, -10, 4}, {10, -10, 4}, {10, 10, 8}, {-10, 10, 8}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}, {4, 5, 6}, {4, 6, 7}};
+    const geometry::TriangleMeshBVH bvh(mesh);
+
+    camera::PinholeCameraParameters camera_parameter;
+    camera_parameter.intrinsic_.SetIntrinsics(64, 48, 40.0, 40.0, 31.5, 23.5);
+    camera_parameter.extrinsic_ = Eigen::Matrix4d::Identity();
+    const std::shared_ptr<geometry::Image> depth =
+            bvh.RenderDepthImage(camera_parameter);
+    ASSERT_EQ(depth->width_, 64);
+    ASSERT_EQ(depth->height_, 48);
+    ASSERT_EQ(depth->num_of_channels_, 1);
+    ASSERT_EQ(depth->bytes_per_channel_, 4);
+    for (int v = 0; v < 48; ++v) {
+        for (int u = 0; u < 64; ++u) {
+            const double x = (u - 31.5) / 40.0;
+            const double y = (v - 23.5) / 40.0;
+            // The tilted square is the plane z = 6 + 0.2 * y.
+            const double expected = x < 0 ? 2.0 : 6.0 / (1.0 - 0.2 * y);
+            EXPECT_NEAR(*depth->PointerAt<float>(u, v), expected, 1e-5);
+        }
+    }
+
+    // Looking away from the mesh.
+    camera_parameter.extrinsic_(2, 2) = -1;
+    camera_parameter.extrinsic_(0, 0) = -1;
+    const std::shared_ptr<geometry::Image> empty =
+            bvh.RenderDepthImage(camera_parameter);
+    for (int v = 0; v < 48; ++v) {
+        for (int u = 0; u < 64; ++u) {
+            EXPECT_EQ(*empty->PointerAt<float>(u, v), 0.0f);
+        }
+    }
+}
+
+TEST(TriangleMeshBVH, GetSelfIntersectingTriangles) {
+    geometry::TriangleMesh mesh = CreateTriangleSoup(1500, 0.1, 7);
+    // Connect some triangles, neighbors are not reported.
+    for (size_t i = 3; i < mesh.triangles_.size(); i += 7) {
+        mesh.triangles_[i](0) = mesh.triangles_[i - 1](1);
+    }
+    std::vector<Eigen::Vector2i> expected;
+    for (size_t tidx0 = 0; tidx0 < mesh.triangles_.size(); ++tidx0) {
+        const Eigen::Vector3i &tria_p = mesh.triangles_[tidx0];
+        for (size_t tidx1 = tidx0 + 1; tidx1 < mesh.triangles_.size();
+             ++tidx1) {
+            const Eigen::Vector3i &tria_q = mesh.triangles_[tidx1];
+            bool is_neighbor = false;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    is_neighbor |= tria_p(i) == tria_q(j);
+                }
+            }
+            if (!is_neighbor &&
+                geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[tria_p(0)], mesh.vertices_[tria_p(1)],
+                        mesh.vertices_[tria_p(2)], mesh.vertices_[tria_q(0)],
+                        mesh.vertices_[tria_q(1)],
+                        mesh.vertices_[tria_q(2)])) {
+                expected.push_back(Eigen::Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    const std::vector<Eigen::Vector2i> pairs =
+            mesh.GetSelfIntersectingTriangles();
+    EXPECT_GT(expected.size(), 10u);
+    ASSERT_EQ(pairs.size(), expected.size());
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        ExpectEQ(pairs[i], expected[i]);
+    }
+    EXPECT_TRUE(
+            geometry::TriangleMesh().GetSelfIntersectingTriangles().empty());
+}
+
+TEST(TriangleMeshBVH, IsIntersecting) {
+    const geometry::TriangleMesh mesh0 = CreateTriangleSoup(300, 0.05, 8);
+    for (unsigned seed = 9; seed < 19; ++seed) {
+        const geometry::TriangleMesh mesh1 =
+                CreateTriangleSoup(300, 0.05, seed);
+        bool expected = false;
+        for (const Eigen::Vector3i &tria_p : mesh0.triangles_) {
+            for (const Eigen::Vector3i &tria_q : mesh1.triangles_) {
+                expected |= geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh0.vertices_[tria_p(0)], mesh0.vertices_[tria_p(1)],
+                        mesh0.vertices_[tria_p(2)], mesh1.vertices_[tria_q(0)],
+                        mesh1.vertices_[tria_q(1)], mesh1.vertices_[tria_q(2)]);
+            }
+        }
+        EXPECT_EQ(mesh0.IsIntersecting(mesh1), expected);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
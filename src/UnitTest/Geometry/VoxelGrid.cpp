@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
@@ -61,6 +63,73 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CarveViews) {
+    // Three cameras looking along z, shifted in x, each seeing a disc that is
+    // closer than the far side of the grid.
+    camera::PinholeCameraTrajectory trajectory;
+    std::vector<std::shared_ptr<geometry::Image>> depth_maps;
+    std::vector<std::shared_ptr<geometry::Image>> silhouettes;
+    for (int view = 0; view < 3; view++) {
+        camera::PinholeCameraParameters camera;
+        camera.intrinsic_ =
+                camera::PinholeCameraIntrinsic(64, 48, 60, 60, 31.5, 23.5);
+        camera.extrinsic_ = Eigen::Matrix4d::Identity();
+        camera.extrinsic_.block<3, 1>(0, 3) =
+                Eigen::Vector3d(0.4 + 0.1 * view, 0.4, 1.0);
+        trajectory.parameters_.push_back(camera);
+        auto depth = std::make_shared<geometry::Image>();
+        auto silhouette = std::make_shared<geometry::Image>();
+        depth->Prepare(64, 48, 1, 4);
+        silhouette->Prepare(64, 48, 1, 4);
+        for (int v = 0; v < 48; v++) {
+            for (int u = 0; u < 64; u++) {
+                double r2 = (u - 32) * (u - 32) + (v - 24) * (v - 24);
+                *depth->PointerAt<float>(u, v) = r2 < 300 ? 1.4f : 0.0f;
+                *silhouette->PointerAt<float>(u, v) = r2 < 200 ? 1.0f : 0.0f;
+            }
+        }
+        depth_maps.push_back(depth);
+        silhouettes.push_back(silhouette);
+    }
+
+    // Carving all views at once equals carving them one after the other.
+    for (bool keep_outside : {false, true}) {
+        for (bool silhouette : {false, true}) {
+            auto ref = geometry::VoxelGrid::CreateDense(
+                    Eigen::Vector3d(-1, -1, 0), 0.1, 1, 0.8, 1);
+            auto voxel_grid = std::make_shared<geometry::VoxelGrid>(*ref);
+            for (size_t view = 0; view < depth_maps.size(); view++) {
+                if (silhouette) {
+                    ref->CarveSilhouette(*silhouettes[view],
+                                         trajectory.parameters_[view],
+                                         keep_outside);
+                } else {
+                    ref->CarveDepthMap(*depth_maps[view],
+                                       trajectory.parameters_[view],
+                                       keep_outside);
+                }
+            }
+            if (silhouette) {
+                voxel_grid->CarveSilhouettes(silhouettes, trajectory,
+                                             keep_outside);
+            } else {
+                voxel_grid->CarveDepthMaps(depth_maps, trajectory,
+                                           keep_outside);
+            }
+            EXPECT_GT(ref->voxels_.size(), 0u);
+            EXPECT_LT(ref->voxels_.size(), 800u);
+            ASSERT_EQ(ref->voxels_.size(), voxel_grid->voxels_.size());
+            for (const auto &it : ref->voxels_) {
+                EXPECT_TRUE(voxel_grid->voxels_.count(it.first));
+            }
+        }
+    }
+
+    trajectory.parameters_.pop_back();
+    EXPECT_ANY_THROW(
+            geometry::VoxelGrid().CarveDepthMaps(depth_maps, trajectory, true));
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
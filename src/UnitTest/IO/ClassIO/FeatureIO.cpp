@@ -24,14 +24,39 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/FeatureIO.h"
+
+#include <cstdio>
+
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
-TEST(FeatureIO, DISABLED_ReadFeature) { NotImplemented(); }
+TEST(FeatureIO, ReadWriteFeature) {
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_feature.bin";
+    for (bool use_float : {false, true}) {
+        registration::Feature feature;
+        feature.Resize(33, 10);
+        feature.data_ = Eigen::MatrixXd::Random(33, 10);
+        if (use_float) {
+            feature.ConvertToFloat();
+        }
+        EXPECT_TRUE(io::WriteFeature(file_name, feature));
 
-TEST(FeatureIO, DISABLED_WriteFeature) { NotImplemented(); }
+        registration::Feature read;
+        EXPECT_TRUE(io::ReadFeature(file_name, read));
+        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+        EXPECT_EQ(use_float, read.IsFloat());
+        EXPECT_EQ(feature.Dimension(), read.Dimension());
+        EXPECT_EQ(feature.Num(), read.Num());
+        if (use_float) {
+            EXPECT_TRUE(feature.data_float_ == read.data_float_);
+        } else {
+            EXPECT_TRUE(feature.data_ == read.data_);
+        }
+    }
+}
 
 TEST(FeatureIO, DISABLED_ReadFeatureFromBIN) { NotImplemented(); }
 
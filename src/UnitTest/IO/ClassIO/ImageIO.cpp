@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/ImageIO.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -43,5 +44,99 @@ TEST(ImageIO, DISABLED_ReadImageFromJPG) { NotImplemented(); }
 
 TEST(ImageIO, DISABLED_WriteImageToJPG) { NotImplemented(); }
 
+// The header tells the size and the pixel format that ReadImage returns.
+TEST(ImageIO, ReadImageInfo) {
+    for (const std::string filename : {"test_info.png", "test_info.jpg"}) {
+        for (int num_of_channels : {1, 3}) {
+            SCOPED_TRACE(filename);
+            geometry::Image image, image2;
+            image.Prepare(37, 21, num_of_channels, 1);
+            Rand(image.data_, 0, 255, 0);
+            EXPECT_TRUE(io::WriteImage(filename, image));
+            EXPECT_TRUE(io::ReadImage(filename, image2));
+
+            io::ImageInfo info;
+            EXPECT_TRUE(io::ReadImageInfo(filename, info));
+            EXPECT_EQ(info.width, image2.width_);
+            EXPECT_EQ(info.height, image2.height_);
+            EXPECT_EQ(info.num_of_channels, image2.num_of_channels_);
+            EXPECT_EQ(info.bytes_per_channel, image2.bytes_per_channel_);
+        }
+    }
+
+    io::ImageInfo info;
+    EXPECT_FALSE(io::ReadImageInfo("test_info.bmp", info));
+}
+
+// PNG keeps the top-left pixel of each block, JPG scales in the DCT.
+TEST(ImageIO, ReadImageScaled) {
+    geometry::Image depth;
+    depth.Prepare(37, 21, 1, 2);
+    uint16_t *depth_data =
+            reinterpret_cast<uint16_t *>(depth.data_.data());
+    for (int i = 0; i < depth.width_ * depth.height_; i++) {
+        depth_data[i] = uint16_t(i);
+    }
+    EXPECT_TRUE(io::WriteImage("test_scaled.png", depth));
+
+    for (int scale : {1, 2, 4, 8}) {
+        SCOPED_TRACE(scale);
+        io::ImageReadOption option;
+        option.scale_denominator = scale;
+        geometry::Image image;
+        EXPECT_TRUE(io::ReadImage("test_scaled.png", image, option));
+        EXPECT_EQ(image.width_, (37 + scale - 1) / scale);
+        EXPECT_EQ(image.height_, (21 + scale - 1) / scale);
+        EXPECT_EQ(image.bytes_per_channel_, 2);
+        for (int v = 0; v < image.height_; v++) {
+            for (int u = 0; u < image.width_; u++) {
+                EXPECT_EQ(*image.PointerAt<uint16_t>(u, v),
+                          *depth.PointerAt<uint16_t>(u * scale, v * scale));
+            }
+        }
+    }
+
+    geometry::Image color;
+    color.Prepare(37, 21, 3, 1);
+    Rand(color.data_, 0, 255, 0);
+    EXPECT_TRUE(io::WriteImage("test_scaled.jpg", color));
+    for (bool fast_decode : {false, true}) {
+        for (int scale : {1, 2, 4, 8}) {
+            SCOPED_TRACE(scale);
+            io::ImageReadOption option;
+            option.scale_denominator = scale;
+            option.fast_decode = fast_decode;
+            geometry::Image image;
+            EXPECT_TRUE(io::ReadImage("test_scaled.jpg", image, option));
+            EXPECT_EQ(image.width_, (37 + scale - 1) / scale);
+            EXPECT_EQ(image.height_, (21 + scale - 1) / scale);
+            EXPECT_EQ(image.num_of_channels_, 3);
+        }
+    }
+
+    io::ImageReadOption option;
+    option.scale_denominator = 3;
+    geometry::Image image;
+    EXPECT_FALSE(io::ReadImage("test_scaled.jpg", image, option));
+}
+
+// Reading into an Image of the same size does not reallocate its buffer.
+TEST(ImageIO, ReadImageReusesBuffer) {
+    geometry::Image color;
+    color.Prepare(37, 21, 3, 1);
+    Rand(color.data_, 0, 255, 0);
+    EXPECT_TRUE(io::WriteImage("test_reuse.jpg", color));
+    EXPECT_TRUE(io::WriteImage("test_reuse.png", color));
+
+    geometry::Image image;
+    EXPECT_TRUE(io::ReadImage("test_reuse.png", image));
+    const uint8_t *data = image.data_.data();
+    EXPECT_TRUE(io::ReadImage("test_reuse.jpg", image));
+    EXPECT_EQ(image.data_.data(), data);
+    EXPECT_TRUE(io::ReadImage("test_reuse.png", image));
+    EXPECT_EQ(image.data_.data(), data);
+    EXPECT_EQ(image.data_, color.data_);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
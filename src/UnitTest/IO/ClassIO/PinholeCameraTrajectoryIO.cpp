@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+
+#include <cstdio>
+
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -34,12 +38,33 @@ TEST(PinholeCameraTrajectoryIO,
     NotImplemented();
 }
 
-TEST(PinholeCameraTrajectoryIO, DISABLED_ReadPinholeCameraTrajectory) {
-    NotImplemented();
-}
+TEST(PinholeCameraTrajectoryIO, ReadWritePinholeCameraTrajectory) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 4; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0,
+                                            319.5, 239.5 + i);
+        parameters.extrinsic_ = Eigen::Matrix4d::Random();
+        trajectory.parameters_.push_back(parameters);
+    }
 
-TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectory) {
-    NotImplemented();
+    std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_trajectory.bin";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, trajectory));
+    camera::PinholeCameraTrajectory read;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, read));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    ASSERT_EQ(trajectory.parameters_.size(), read.parameters_.size());
+    for (size_t i = 0; i < read.parameters_.size(); i++) {
+        const auto &expected = trajectory.parameters_[i];
+        const auto &actual = read.parameters_[i];
+        EXPECT_EQ(expected.intrinsic_.width_, actual.intrinsic_.width_);
+        EXPECT_EQ(expected.intrinsic_.height_, actual.intrinsic_.height_);
+        ExpectEQ(expected.intrinsic_.intrinsic_matrix_,
+                 actual.intrinsic_.intrinsic_matrix_);
+        ExpectEQ(expected.extrinsic_, actual.extrinsic_);
+    }
 }
 
 TEST(PinholeCameraTrajectoryIO, DISABLED_ReadPinholeCameraTrajectoryFromLOG) {
@@ -24,17 +24,24 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <fstream>
+#include <iterator>
+
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/FileSystem.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
 using open3d::io::ReadPointCloud;
+using open3d::io::ReadPointCloudFromMemory;
+using open3d::io::ReadPointCloudInfo;
 using open3d::io::ReadPointCloudOption;
 using open3d::io::WritePointCloud;
 using open3d::io::WritePointCloudOption;
+using open3d::io::WritePointCloudToMemory;
 
 namespace {
 
@@ -134,6 +141,10 @@ std::vector<ReadWritePCArgs> pcArgs({
                             // test subsets of PTS
         {"testp.pts", IsAscii::BINARY, Compressed::UNCOMPRESSED,
          Compare::NONE},  // 24
+        {"test.o3dg", IsAscii::BINARY, Compressed::UNCOMPRESSED,
+         Compare::NORMALS_AND_COLORS},  // 25
+        {"testc.o3dg", IsAscii::BINARY, Compressed::COMPRESSED,
+         Compare::NORMALS_AND_COLORS},  // 26
 });
 
 class ReadWritePC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -444,6 +455,70 @@ TEST_P(ReadWritePC, UpdateProgressCallback) {
     }
 }
 
+// The memory writers produce the same bytes as the file writers and the
+// memory readers load them back.
+TEST_P(ReadWritePC, Memory) {
+    ReadWritePCArgs args = GetParam();
+    const std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(args.filename);
+    geometry::PointCloud pc;
+    RandPC(pc);
+    const WritePointCloudOption params(bool(args.write_ascii),
+                                       bool(args.compressed));
+
+    EXPECT_TRUE(WritePointCloud(args.filename, pc, params));
+    std::ifstream file(args.filename, std::ios::binary);
+    std::vector<uint8_t> file_content{std::istreambuf_iterator<char>(file),
+                                      std::istreambuf_iterator<char>()};
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(WritePointCloudToMemory(buffer, format, pc, params));
+    EXPECT_EQ(buffer, file_content);
+
+    geometry::PointCloud pc_file, pc_memory;
+    EXPECT_TRUE(ReadPointCloud(args.filename, pc_file));
+    EXPECT_TRUE(ReadPointCloudFromMemory(buffer.data(), buffer.size(), format,
+                                         pc_memory));
+    EXPECT_EQ(MaxDistance(pc_file.points_, pc_memory.points_), 0);
+    EXPECT_EQ(MaxDistance(pc_file.normals_, pc_memory.normals_), 0);
+    EXPECT_EQ(MaxDistance(pc_file.colors_, pc_memory.colors_), 0);
+
+    EXPECT_FALSE(ReadPointCloudFromMemory(buffer.data(), buffer.size(),
+                                          "unknown", pc_memory));
+    EXPECT_FALSE(WritePointCloudToMemory(buffer, "unknown", pc));
+}
+
+// The header tells the size and the attributes that ReadPointCloud finds.
+TEST_P(ReadWritePC, Info) {
+    ReadWritePCArgs args = GetParam();
+    geometry::PointCloud pc;
+    RandPC(pc);
+    EXPECT_TRUE(WritePointCloud(
+            args.filename, pc,
+            {bool(args.write_ascii), bool(args.compressed), true}));
+
+    io::PointCloudInfo info;
+    const std::string format =
+            utility::filesystem::GetFileExtensionInLowerCase(args.filename);
+    if (format == "xyz" || format == "xyzn" || format == "xyzrgb") {
+        // These formats have no header.
+        EXPECT_FALSE(ReadPointCloudInfo(args.filename, info));
+        return;
+    }
+    geometry::PointCloud pc2;
+    EXPECT_TRUE(ReadPointCloudInfo(args.filename, info));
+    EXPECT_TRUE(ReadPointCloud(args.filename, pc2));
+    EXPECT_EQ(info.num_points, int64_t(pc2.points_.size()));
+    EXPECT_EQ(info.has_normals, pc2.HasNormals());
+    EXPECT_EQ(info.has_colors, pc2.HasColors());
+    ASSERT_GE(info.attributes.size(), 3u);
+    EXPECT_EQ(info.attributes[0].name, format == "o3dg" ? "points" : "x");
+    EXPECT_EQ(info.has_bounds, format == "o3dg");
+    if (info.has_bounds) {
+        ExpectEQ(info.min_bound, pc.GetMinBound());
+        ExpectEQ(info.max_bound, pc.GetMaxBound());
+    }
+}
+
 TEST(PointCloudIO, DISABLED_CreatePointCloudFromFile) { NotImplemented(); }
 
 }  // namespace unit_test
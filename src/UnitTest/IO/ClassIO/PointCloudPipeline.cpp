@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <random>
+#include <stdexcept>
+
+#include "Open3D/IO/ClassIO/PointCloudPipeline.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// Writes random points in [0, 10]^3 and returns them as read back, so that
+// the reference results see the same precision as the pipeline.
+geometry::PointCloud WriteRandomPointCloud(const std::string &filename) {
+    // Rand() repeats a short sequence, so it would yield clusters of
+    // duplicate points.
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    geometry::PointCloud pc;
+    for (int i = 0; i < 20000; i++) {
+        pc.points_.emplace_back(10 * dist(gen), 10 * dist(gen),
+                                10 * dist(gen));
+        pc.colors_.emplace_back(dist(gen), dist(gen), dist(gen));
+    }
+    EXPECT_TRUE(io::WritePointCloud(filename, pc));
+    geometry::PointCloud pc2;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pc2));
+    return pc2;
+}
+
+}  // namespace
+
+TEST(PointCloudPipeline, CropAndVoxelDownSample) {
+    const geometry::PointCloud pc =
+            WriteRandomPointCloud("test_pipeline_in.ply");
+    const geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(1, 1, 1),
+                                                Eigen::Vector3d(9, 9, 9));
+    const double voxel_size = 0.5;
+
+    io::PointCloudPipeline pipeline;
+    pipeline.AddStage(io::PointCloudPipeline::Crop(bbox))
+            .AddStage(io::PointCloudPipeline::VoxelDownSample(voxel_size));
+    EXPECT_EQ(pipeline.NumStages(), 2u);
+    io::PointCloudPipelineOption option;
+    option.tile_size = Eigen::Vector3d(2.5, 2.5, 0);
+    option.max_buffered_bytes = 100000;
+    option.max_tiles_in_flight = 3;
+    option.num_worker_threads = 2;
+    EXPECT_TRUE(pipeline.Run("test_pipeline_in.ply", "test_pipeline_out.ply",
+                             option));
+
+    // The tiles are on the voxel grid, so no voxel is split.
+    const auto ref = pc.Crop(bbox)->VoxelDownSampleOnGrid(voxel_size,
+                                                          pc.GetMinBound());
+    geometry::PointCloud out;
+    EXPECT_TRUE(io::ReadPointCloud("test_pipeline_out.ply", out));
+    EXPECT_EQ(out.points_.size(), ref->points_.size());
+    EXPECT_TRUE(out.HasColors());
+    ExpectEQ(out.GetMinBound(), ref->GetMinBound(), 1e-5);
+    ExpectEQ(out.GetMaxBound(), ref->GetMaxBound(), 1e-5);
+    ExpectEQ(out.GetCenter(), ref->GetCenter(), 1e-5);
+}
+
+TEST(PointCloudPipeline, RadiusOutliersWithHalo) {
+    const geometry::PointCloud pc =
+            WriteRandomPointCloud("test_pipeline_in.ply");
+    const size_t nb_points = 6;
+    const double radius = 0.4;
+    const size_t num_inliers =
+            std::get<1>(pc.RemoveRadiusOutliers(nb_points, radius)).size();
+
+    io::PointCloudPipelineOption option;
+    option.tile_size = Eigen::Vector3d(3, 3, 3);
+    io::PointCloudPipeline pipeline;
+    pipeline.AddStage(
+            io::PointCloudPipeline::RemoveRadiusOutliers(nb_points, radius),
+            radius);
+    EXPECT_TRUE(pipeline.Run("test_pipeline_in.ply", "test_pipeline_out.ply",
+                             option));
+    geometry::PointCloud out;
+    EXPECT_TRUE(io::ReadPointCloud("test_pipeline_out.ply", out));
+    EXPECT_EQ(out.points_.size(), num_inliers);
+
+    // Without the halo, the points near the borders of the tiles lose
+    // neighbors.
+    pipeline.Clear();
+    pipeline.AddStage(
+            io::PointCloudPipeline::RemoveRadiusOutliers(nb_points, radius));
+    EXPECT_TRUE(pipeline.Run("test_pipeline_in.ply", "test_pipeline_out.ply",
+                             option));
+    EXPECT_TRUE(io::ReadPointCloud("test_pipeline_out.ply", out));
+    EXPECT_LT(out.points_.size(), num_inliers);
+}
+
+TEST(PointCloudPipeline, StageError) {
+    WriteRandomPointCloud("test_pipeline_in.ply");
+    io::PointCloudPipeline pipeline;
+    pipeline.AddStage([](const geometry::PointCloud &,
+                         const geometry::AxisAlignedBoundingBox &)
+                              -> std::shared_ptr<geometry::PointCloud> {
+        throw std::runtime_error("Stage failed.");
+    });
+    io::PointCloudPipelineOption option;
+    option.tile_size = Eigen::Vector3d(1, 1, 1);
+    EXPECT_FALSE(pipeline.Run("test_pipeline_in.ply", "test_pipeline_out.ply",
+                              option));
+    EXPECT_FALSE(pipeline.Run("does_not_exist.ply", "test_pipeline_out.ply"));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
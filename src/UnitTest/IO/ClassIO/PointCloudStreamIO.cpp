@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/PointCloudStreamIO.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+template <class T>
+double MaxDistance(const std::vector<T> &a, const std::vector<T> &b) {
+    // Note: cannot use ASSERT_EQ because we return non-void
+    EXPECT_EQ(a.size(), b.size());
+    double m = 0;
+    for (size_t i = 0; i < a.size() && i < b.size(); ++i) {
+        m = std::max(m, (a[i] - b[i]).norm());
+    }
+    return m;
+}
+
+}  // namespace
+
+struct PointCloudStreamArgs {
+    std::string filename;
+    bool write_ascii;
+    bool compressed;
+    bool has_normals;
+    bool has_colors;
+    // Whether the header stores the number of points.
+    bool has_count;
+};
+std::vector<PointCloudStreamArgs> streamArgs({
+        {"test_stream_a.pcd", true, false, true, true, true},    // 0
+        {"test_stream_b.pcd", false, false, true, true, true},   // 1
+        {"test_stream_bc.pcd", false, true, true, true, true},   // 2
+        {"test_stream_b.ply", false, false, true, true, true},   // 3
+        {"test_stream_a.ply", true, false, true, true, true},    // 4
+        {"test_stream_bp.ply", false, false, false, false, true},  // 5
+        {"test_stream.pts", false, false, false, true, true},    // 6
+        {"test_stream_p.pts", false, false, false, false, true},  // 7
+        {"test_stream.xyz", false, false, false, false, false},  // 8
+        {"test_stream.xyzn", false, false, true, false, false},  // 9
+        {"test_stream.xyzrgb", false, false, false, true, false},  // 10
+});
+
+class PointCloudStreamIO
+    : public testing::TestWithParam<PointCloudStreamArgs> {};
+INSTANTIATE_TEST_SUITE_P(PointCloudStreamIO,
+                         PointCloudStreamIO,
+                         testing::ValuesIn(streamArgs));
+
+TEST_P(PointCloudStreamIO, ChunkedRoundTrip) {
+    const PointCloudStreamArgs args = GetParam();
+    const int num_points = 1000;
+    const Eigen::Vector3d one(1, 1, 1);
+    geometry::PointCloud pc;
+    pc.points_.resize(num_points);
+    Rand(pc.points_, one * -1000, one * 1000, 0);
+    if (args.has_normals) {
+        pc.normals_.resize(num_points);
+        Rand(pc.normals_, one * -1, one, 0);
+    }
+    if (args.has_colors) {
+        pc.colors_.resize(num_points);
+        Rand(pc.colors_, one * 0, one * .9973143, 0);
+    }
+
+    // Write in chunks of 300 points, the last one is partial.
+    {
+        auto writer = io::CreatePointCloudStreamWriter(
+                args.filename, args.has_normals, args.has_colors,
+                {args.write_ascii, args.compressed});
+        ASSERT_NE(writer, nullptr);
+        for (int begin = 0; begin < num_points; begin += 300) {
+            const int end = std::min(num_points, begin + 300);
+            geometry::PointCloud chunk;
+            chunk.points_.assign(pc.points_.begin() + begin,
+                                 pc.points_.begin() + end);
+            if (args.has_normals) {
+                chunk.normals_.assign(pc.normals_.begin() + begin,
+                                      pc.normals_.begin() + end);
+            }
+            if (args.has_colors) {
+                chunk.colors_.assign(pc.colors_.begin() + begin,
+                                     pc.colors_.begin() + end);
+            }
+            EXPECT_TRUE(writer->WriteChunk(chunk));
+        }
+        EXPECT_EQ(writer->GetNumPointsWritten(), num_points);
+        EXPECT_TRUE(writer->Close());
+    }
+
+    // The regular reader reads the file written in chunks.
+    geometry::PointCloud pc2;
+    EXPECT_TRUE(io::ReadPointCloud(args.filename, pc2,
+                                   {"auto", false, false, false}));
+    EXPECT_LT(MaxDistance(pc.points_, pc2.points_), 1e-3);
+    EXPECT_LT(MaxDistance(pc.normals_, pc2.normals_), 1e-6);
+    EXPECT_LT(MaxDistance(pc.colors_, pc2.colors_), 1e-2);
+
+    // Reading in chunks gives the same points as the regular reader.
+    auto reader = io::CreatePointCloudStreamReader(args.filename);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(reader->GetNumPoints(), args.has_count ? num_points : -1);
+    EXPECT_EQ(reader->HasNormals(), args.has_normals);
+    EXPECT_EQ(reader->HasColors(), args.has_colors);
+    geometry::PointCloud chunk, pc3;
+    int64_t num_read;
+    while ((num_read = reader->ReadChunk(chunk, 256)) > 0) {
+        EXPECT_LE(num_read, 256);
+        EXPECT_EQ(int64_t(chunk.points_.size()), num_read);
+        pc3.points_.insert(pc3.points_.end(), chunk.points_.begin(),
+                           chunk.points_.end());
+        pc3.normals_.insert(pc3.normals_.end(), chunk.normals_.begin(),
+                            chunk.normals_.end());
+        pc3.colors_.insert(pc3.colors_.end(), chunk.colors_.begin(),
+                           chunk.colors_.end());
+    }
+    EXPECT_EQ(num_read, 0);
+    EXPECT_TRUE(chunk.points_.empty());
+    EXPECT_EQ(MaxDistance(pc2.points_, pc3.points_), 0);
+    EXPECT_EQ(MaxDistance(pc2.normals_, pc3.normals_), 0);
+    EXPECT_EQ(MaxDistance(pc2.colors_, pc3.colors_), 0);
+}
+
+TEST(PointCloudStreamIO, MissingAttributes) {
+    auto writer = io::CreatePointCloudStreamWriter("test_stream_m.ply", true,
+                                                   false);
+    ASSERT_NE(writer, nullptr);
+    geometry::PointCloud chunk;
+    chunk.points_.resize(10, Eigen::Vector3d::Zero());
+    EXPECT_FALSE(writer->WriteChunk(chunk));
+    chunk.normals_.resize(10, Eigen::Vector3d::UnitZ());
+    EXPECT_TRUE(writer->WriteChunk(chunk));
+    EXPECT_TRUE(writer->Close());
+
+    EXPECT_EQ(io::CreatePointCloudStreamWriter("test_stream.xyzn", false,
+                                               false),
+              nullptr);
+    EXPECT_EQ(io::CreatePointCloudStreamWriter("test_stream.unknown", false,
+                                               false),
+              nullptr);
+    EXPECT_EQ(io::CreatePointCloudStreamReader("does_not_exist.ply"),
+              nullptr);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
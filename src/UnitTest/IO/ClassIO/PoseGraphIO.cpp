@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
+
+#include <cstdio>
+
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -31,9 +35,53 @@ namespace unit_test {
 
 TEST(PoseGraphIO, DISABLED_CreatePoseGraphFromFile) { NotImplemented(); }
 
-TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
+TEST(PoseGraphIO, ReadWritePoseGraph) {
+    registration::PoseGraph pose_graph;
+    for (int i = 0; i < 5; i++) {
+        pose_graph.nodes_.push_back(
+                registration::PoseGraphNode(Eigen::Matrix4d::Random()));
+    }
+    for (int i = 0; i < 7; i++) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i % 5, (i + 2) % 5, Eigen::Matrix4d::Random(),
+                Eigen::Matrix6d::Random(), i % 2 == 0, 0.1 * i));
+    }
+
+    for (std::string ext : {"bin", "json"}) {
+        std::string file_name =
+                std::string(TEST_DATA_DIR) + "/temp_pose_graph." + ext;
+        EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+        registration::PoseGraph read;
+        EXPECT_TRUE(io::ReadPoseGraph(file_name, read));
+        EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+        ASSERT_EQ(pose_graph.nodes_.size(), read.nodes_.size());
+        ASSERT_EQ(pose_graph.edges_.size(), read.edges_.size());
+        for (size_t i = 0; i < read.nodes_.size(); i++) {
+            ExpectEQ(pose_graph.nodes_[i].pose_, read.nodes_[i].pose_);
+        }
+        for (size_t i = 0; i < read.edges_.size(); i++) {
+            const auto &edge = pose_graph.edges_[i];
+            EXPECT_EQ(edge.source_node_id_, read.edges_[i].source_node_id_);
+            EXPECT_EQ(edge.target_node_id_, read.edges_[i].target_node_id_);
+            ExpectEQ(edge.transformation_, read.edges_[i].transformation_);
+            ExpectEQ(edge.information_, read.edges_[i].information_);
+            EXPECT_EQ(edge.uncertain_, read.edges_[i].uncertain_);
+            EXPECT_NEAR(edge.confidence_, read.edges_[i].confidence_,
+                        THRESHOLD_1E_6);
+        }
+    }
 
-TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
+    // A truncated binary file is rejected.
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    FILE *file = fopen(file_name.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite("O3DPOSEG", 1, 8, file);
+    fclose(file);
+    registration::PoseGraph read;
+    EXPECT_FALSE(io::ReadPoseGraph(file_name, read));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
 
 }  // namespace unit_test
 }  // namespace open3d
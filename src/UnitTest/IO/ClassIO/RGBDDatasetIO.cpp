@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/RGBDDatasetIO.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// Writes num_frames frames of random images to the color/ and depth/
+// subdirectories of directory, and returns their paths.
+void WriteDataset(const std::string &directory,
+                  int num_frames,
+                  std::vector<std::string> &color_files,
+                  std::vector<std::string> &depth_files) {
+    utility::filesystem::MakeDirectoryHierarchy(directory + "color");
+    utility::filesystem::MakeDirectoryHierarchy(directory + "depth");
+    color_files.clear();
+    depth_files.clear();
+    for (int i = 0; i < num_frames; i++) {
+        geometry::Image color, depth;
+        color.Prepare(16, 12, 3, 1);
+        depth.Prepare(16, 12, 1, 2);
+        Rand(color.data_, 0, 255, i);
+        Rand(depth.data_, 0, 15, i);
+        const std::string name = std::to_string(100000 + i) + ".png";
+        color_files.push_back(directory + "color/" + name);
+        depth_files.push_back(directory + "depth/" + name);
+        EXPECT_TRUE(io::WriteImage(color_files.back(), color));
+        EXPECT_TRUE(io::WriteImage(depth_files.back(), depth));
+    }
+}
+
+}  // namespace
+
+// Frames come in order and equal the ones created one after the other.
+TEST(RGBDDatasetIO, ReadNext) {
+    std::vector<std::string> color_files, depth_files;
+    WriteDataset("rgbd_dataset/", 12, color_files, depth_files);
+
+    io::RGBDDatasetReaderOption option;
+    option.num_threads = 3;
+    option.max_prefetched_frames = 2;
+    io::RGBDDatasetReader reader;
+    EXPECT_TRUE(reader.Open("rgbd_dataset", option));
+    EXPECT_EQ(reader.GetNumFrames(), 12);
+    for (size_t i = 0; i < color_files.size(); i++) {
+        geometry::Image color, depth;
+        EXPECT_TRUE(io::ReadImage(color_files[i], color));
+        EXPECT_TRUE(io::ReadImage(depth_files[i], depth));
+        auto expected =
+                geometry::RGBDImage::CreateFromColorAndDepth(color, depth);
+        EXPECT_TRUE(reader.HasNext());
+        auto rgbd = reader.ReadNext();
+        ASSERT_NE(rgbd, nullptr);
+        ExpectEQ(rgbd->color_.data_, expected->color_.data_);
+        ExpectEQ(rgbd->depth_.data_, expected->depth_.data_);
+    }
+    EXPECT_FALSE(reader.HasNext());
+    EXPECT_EQ(reader.ReadNext(), nullptr);
+
+    // Closing with frames being decoded stops the workers.
+    EXPECT_TRUE(reader.Open(color_files, depth_files, option));
+    EXPECT_NE(reader.ReadNext(), nullptr);
+    reader.Close();
+    EXPECT_FALSE(reader.HasNext());
+
+    // A missing image fails its frame only.
+    std::vector<std::string> missing = color_files;
+    missing[1] = "rgbd_dataset/missing.png";
+    EXPECT_TRUE(reader.Open(missing, depth_files, option));
+    EXPECT_NE(reader.ReadNext(), nullptr);
+    EXPECT_EQ(reader.ReadNext(), nullptr);
+    EXPECT_TRUE(reader.HasNext());
+    EXPECT_NE(reader.ReadNext(), nullptr);
+
+    depth_files.pop_back();
+    EXPECT_FALSE(reader.Open(color_files, depth_files, option));
+}
+
+// Sequence files hold the same frames as the dataset they are written from.
+TEST(RGBDDatasetIO, RGBDSequence) {
+    std::vector<std::string> color_files, depth_files;
+    WriteDataset("rgbd_dataset_sequence/", 5, color_files, depth_files);
+    EXPECT_TRUE(io::WriteRGBDSequenceFromDataset("rgbd_dataset_sequence",
+                                                 "rgbd_sequence.o3drgbd"));
+
+    io::RGBDSequenceFile file;
+    ASSERT_TRUE(file.Open("rgbd_sequence.o3drgbd"));
+    EXPECT_EQ(file.GetNumFrames(), 5);
+    EXPECT_EQ(file.GetColorFormat(0), "png");
+    geometry::Image color, depth, expected;
+    EXPECT_TRUE(file.ReadFrame(3, color, depth));
+    EXPECT_TRUE(io::ReadImage(color_files[3], expected));
+    ExpectEQ(color.data_, expected.data_);
+    EXPECT_TRUE(io::ReadImage(depth_files[3], expected));
+    ExpectEQ(depth.data_, expected.data_);
+    EXPECT_FALSE(file.ReadFrame(5, color, depth));
+
+    io::RGBDDatasetReaderOption option;
+    option.num_threads = 2;
+    io::RGBDDatasetReader reader;
+    EXPECT_TRUE(reader.Open("rgbd_sequence.o3drgbd", option));
+    EXPECT_EQ(reader.GetNumFrames(), 5);
+    for (size_t i = 0; i < color_files.size(); i++) {
+        EXPECT_TRUE(io::ReadImage(color_files[i], color));
+        EXPECT_TRUE(io::ReadImage(depth_files[i], depth));
+        auto expected_rgbd =
+                geometry::RGBDImage::CreateFromColorAndDepth(color, depth);
+        auto rgbd = reader.ReadNext();
+        ASSERT_NE(rgbd, nullptr);
+        ExpectEQ(rgbd->color_.data_, expected_rgbd->color_.data_);
+        ExpectEQ(rgbd->depth_.data_, expected_rgbd->depth_.data_);
+    }
+    EXPECT_FALSE(reader.HasNext());
+
+    // Frames encoded by the writer, and unclosed files.
+    io::RGBDSequenceWriterOption writer_option;
+    writer_option.color_format = "png";
+    io::RGBDSequenceWriter writer;
+    EXPECT_TRUE(writer.Open("rgbd_sequence_written.o3drgbd", writer_option));
+    EXPECT_TRUE(writer.WriteFrame(color, depth));
+    EXPECT_FALSE(file.Open("rgbd_sequence_written.o3drgbd"));
+    EXPECT_TRUE(writer.Close());
+    ASSERT_TRUE(file.Open("rgbd_sequence_written.o3drgbd"));
+    geometry::Image color2, depth2;
+    EXPECT_TRUE(file.ReadFrame(0, color2, depth2));
+    ExpectEQ(color2.data_, color.data_);
+    ExpectEQ(depth2.data_, depth.data_);
+}
+
+// TUM datasets are associated by timestamp.
+TEST(RGBDDatasetIO, ReadRGBDDatasetFileLists) {
+    std::vector<std::string> color_files, depth_files;
+    WriteDataset("rgbd_dataset_tum/", 3, color_files, depth_files);
+    std::ofstream("rgbd_dataset_tum/rgb.txt")
+            << "# color images\n"
+            << "1.00 color/100000.png\n"
+            << "1.10 color/100001.png\n"
+            << "1.20 color/100002.png\n";
+    // The second color image has no depth image close enough.
+    std::ofstream("rgbd_dataset_tum/depth.txt")
+            << "# depth images\n"
+            << "1.01 depth/100000.png\n"
+            << "1.15 depth/100001.png\n"
+            << "1.19 depth/100002.png\n";
+
+    std::vector<std::string> colors, depths;
+    EXPECT_TRUE(
+            io::ReadRGBDDatasetFileLists("rgbd_dataset_tum", colors, depths));
+    EXPECT_EQ(colors, std::vector<std::string>(
+                              {color_files[0], color_files[2]}));
+    EXPECT_EQ(depths, std::vector<std::string>(
+                              {depth_files[0], depth_files[2]}));
+
+    EXPECT_FALSE(io::ReadRGBDDatasetFileLists("rgbd_dataset_missing", colors,
+                                              depths));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +40,44 @@ TEST(TriangleMeshIO, DISABLED_ReadTriangleMeshFromPLY) { NotImplemented(); }
 
 TEST(TriangleMeshIO, DISABLED_WriteTriangleMeshToPLY) { NotImplemented(); }
 
+// The header tells the sizes and the attributes that ReadTriangleMesh finds.
+TEST(TriangleMeshIO, ReadTriangleMeshInfo) {
+    geometry::TriangleMesh mesh;
+    Eigen::Vector3d one(1, 1, 1);
+    mesh.vertices_.resize(50);
+    mesh.vertex_colors_.resize(50);
+    mesh.triangles_.resize(40);
+    Rand(mesh.vertices_, one * -10, one * 10, 0);
+    Rand(mesh.vertex_colors_, one * 0, one, 0);
+    Rand(mesh.triangles_, Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(49, 49, 49),
+         0);
+    mesh.ComputeVertexNormals();
+
+    for (const std::string filename :
+         {"test_info.ply", "test_info.off", "test_info.stl",
+          "test_info.o3dg"}) {
+        SCOPED_TRACE(filename);
+        EXPECT_TRUE(io::WriteTriangleMesh(filename, mesh));
+        geometry::TriangleMesh mesh2;
+        io::TriangleMeshInfo info;
+        EXPECT_TRUE(io::ReadTriangleMesh(filename, mesh2));
+        EXPECT_TRUE(io::ReadTriangleMeshInfo(filename, info));
+        EXPECT_EQ(info.num_vertices, int64_t(mesh2.vertices_.size()));
+        EXPECT_EQ(info.num_triangles, int64_t(mesh2.triangles_.size()));
+        EXPECT_EQ(info.has_vertex_normals, mesh2.HasVertexNormals());
+        EXPECT_EQ(info.has_vertex_colors, mesh2.HasVertexColors());
+        EXPECT_EQ(info.has_triangle_normals, mesh2.HasTriangleNormals());
+        EXPECT_FALSE(info.triangle_attributes.empty());
+        EXPECT_EQ(info.has_bounds, filename == "test_info.o3dg");
+        if (info.has_bounds) {
+            ExpectEQ(info.min_bound, mesh.GetMinBound());
+            ExpectEQ(info.max_bound, mesh.GetMaxBound());
+        }
+    }
+
+    io::TriangleMeshInfo info;
+    EXPECT_FALSE(io::ReadTriangleMeshInfo("test_info.unknown", info));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TPointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+template <typename T>
+void Store(std::vector<char> &buffer, size_t offset, T value) {
+    memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+// Writes a LAS 1.4 file with two points of format 7 (GPS time and RGB) and
+// 8 bit colors.
+void WriteLAS14File(const std::string &filename, uint8_t point_format) {
+    const size_t header_size = 375;
+    const size_t record_length = 36;
+    std::vector<char> buffer(header_size + 2 * record_length, 0);
+    memcpy(buffer.data(), "LASF", 4);
+    Store<uint8_t>(buffer, 24, 1);
+    Store<uint8_t>(buffer, 25, 4);
+    Store<uint16_t>(buffer, 94, uint16_t(header_size));
+    Store<uint32_t>(buffer, 96, uint32_t(header_size));
+    Store<uint8_t>(buffer, 104, point_format);
+    Store<uint16_t>(buffer, 105, uint16_t(record_length));
+    for (int k = 0; k < 3; k++) {
+        Store<double>(buffer, 131 + 8 * k, 0.01);
+        Store<double>(buffer, 155 + 8 * k, 1000.0 * (k + 1));
+        Store<double>(buffer, 179 + 16 * k, 1000.0 * (k + 1) + 1);
+        Store<double>(buffer, 187 + 16 * k, 1000.0 * (k + 1));
+    }
+    Store<uint64_t>(buffer, 247, 2);
+    for (int i = 0; i < 2; i++) {
+        const size_t record = header_size + i * record_length;
+        for (int k = 0; k < 3; k++) {
+            Store<int32_t>(buffer, record + 4 * k, (i + 1) * (k + 1) * 10);
+        }
+        Store<uint16_t>(buffer, record + 12, uint16_t(100 + i));
+        Store<uint8_t>(buffer, record + 14, uint8_t((i + 1) | (2 << 4)));
+        Store<uint8_t>(buffer, record + 16, uint8_t(2 + 4 * i));
+        Store<uint16_t>(buffer, record + 20, uint16_t(7));
+        Store<double>(buffer, record + 22, 0.5 + i);
+        Store<uint16_t>(buffer, record + 30, uint16_t(255 * i));
+        Store<uint16_t>(buffer, record + 32, uint16_t(51));
+        Store<uint16_t>(buffer, record + 34, uint16_t(0));
+    }
+    std::ofstream(filename, std::ios::binary)
+            .write(buffer.data(), buffer.size());
+}
+
+}  // unnamed namespace
+
+TEST(FileLAS, WriteReadPointCloudFromLAS) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_ = {{500000.125, 4000000.5, 12.75},
+                      {500010.25, 4000100.0, -3.5},
+                      {500005.0, 4000050.25, 0.0}};
+    pcd_gt.colors_ = {{1, 0, 0}, {0, 0.5, 1}, {0.2, 0.4, 0.6}};
+    EXPECT_TRUE(io::WritePointCloud("tmp.las", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.las", pcd));
+    ASSERT_EQ(pcd.points_.size(), 3u);
+    ASSERT_EQ(pcd.colors_.size(), 3u);
+    for (size_t i = 0; i < 3; i++) {
+        ExpectEQ(pcd.points_[i], pcd_gt.points_[i], 1e-6);
+        ExpectEQ(pcd.colors_[i], pcd_gt.colors_[i], 1e-4);
+    }
+
+    io::PointCloudInfo info;
+    EXPECT_TRUE(io::ReadPointCloudInfo("tmp.las", info));
+    EXPECT_EQ(info.num_points, 3);
+    EXPECT_TRUE(info.has_colors);
+    EXPECT_TRUE(info.has_bounds);
+    ExpectEQ(info.min_bound, pcd.GetMinBound(), 1e-6);
+    ExpectEQ(info.max_bound, pcd.GetMaxBound(), 1e-6);
+}
+
+TEST(FileLAS, ReadPointCloudFromLAS14) {
+    WriteLAS14File("tmp.las", 7);
+
+    tgeometry::PointCloud pcd(Dtype::Float64);
+    EXPECT_TRUE(io::ReadPointCloud("tmp.las", pcd));
+    ASSERT_EQ(pcd.NumPoints(), 2);
+    ExpectEQ(pcd.GetPoints().AsTensor().ToFlatVector<double>(),
+             std::vector<double>(
+                     {1000.1, 2000.2, 3000.3, 1000.2, 2000.4, 3000.6}));
+    // 8 bit colors are detected.
+    ExpectEQ(pcd.GetColors().AsTensor().ToFlatVector<double>(),
+             std::vector<double>({0, 0.2, 0, 1, 0.2, 0}));
+    EXPECT_EQ(pcd["intensities"].AsTensor().ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({100, 101}));
+    EXPECT_EQ(pcd["classifications"].AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({2, 6}));
+    EXPECT_EQ(pcd["return_numbers"].AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({1, 2}));
+    EXPECT_EQ(pcd["number_of_returns"].AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({2, 2}));
+    EXPECT_EQ(pcd["point_source_ids"].AsTensor().ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({7, 7}));
+    ExpectEQ(pcd["gps_times"].AsTensor().ToFlatVector<double>(),
+             std::vector<double>({0.5, 1.5}));
+
+    // Write and read back the attributes.
+    EXPECT_TRUE(io::WritePointCloud("tmp2.las", pcd));
+    tgeometry::PointCloud pcd2(Dtype::Float64);
+    EXPECT_TRUE(io::ReadPointCloud("tmp2.las", pcd2));
+    ExpectEQ(pcd2.GetPoints().AsTensor().ToFlatVector<double>(),
+             pcd.GetPoints().AsTensor().ToFlatVector<double>(), 1e-6);
+    EXPECT_EQ(pcd2["intensities"].AsTensor().ToFlatVector<uint16_t>(),
+              pcd["intensities"].AsTensor().ToFlatVector<uint16_t>());
+    EXPECT_EQ(pcd2["classifications"].AsTensor().ToFlatVector<uint8_t>(),
+              pcd["classifications"].AsTensor().ToFlatVector<uint8_t>());
+    EXPECT_EQ(pcd2["return_numbers"].AsTensor().ToFlatVector<uint8_t>(),
+              pcd["return_numbers"].AsTensor().ToFlatVector<uint8_t>());
+    EXPECT_EQ(pcd2["number_of_returns"].AsTensor().ToFlatVector<uint8_t>(),
+              pcd["number_of_returns"].AsTensor().ToFlatVector<uint8_t>());
+    EXPECT_EQ(pcd2["point_source_ids"].AsTensor().ToFlatVector<uint16_t>(),
+              pcd["point_source_ids"].AsTensor().ToFlatVector<uint16_t>());
+    ExpectEQ(pcd2["gps_times"].AsTensor().ToFlatVector<double>(),
+             pcd["gps_times"].AsTensor().ToFlatVector<double>());
+    ExpectEQ(pcd2.GetColors().AsTensor().ToFlatVector<double>(),
+             pcd.GetColors().AsTensor().ToFlatVector<double>(), 1e-4);
+}
+
+TEST(FileLAS, ReadPointCloudFromLAZ) {
+    // LASzip marks compressed points with a high bit of the format id.
+    WriteLAS14File("tmp.laz", 7 | 0x80);
+    geometry::PointCloud pcd;
+    EXPECT_FALSE(io::ReadPointCloud("tmp.laz", pcd));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
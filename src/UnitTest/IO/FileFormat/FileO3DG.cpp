@@ -0,0 +1,243 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/LineSetIO.h"
+#include "Open3D/IO/ClassIO/O3DGIO.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/IO/ClassIO/VoxelGridIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+geometry::PointCloud RandPointCloud(int size) {
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.normals_.resize(size);
+    pc.colors_.resize(size);
+    Eigen::Vector3d one(1, 1, 1);
+    Rand(pc.points_, one * -1000, one * 1000, 0);
+    Rand(pc.normals_, one * -1, one, 0);
+    pc.NormalizeNormals();
+    Rand(pc.colors_, one * 0, one, 0);
+    return pc;
+}
+
+std::vector<uint8_t> ReadFileContent(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<uint8_t>{std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+TEST(FileO3DG, QuantizedPointCloud) {
+    const geometry::PointCloud pc = RandPointCloud(10000);
+    io::WriteO3DGOption option;
+    option.position_encoding =
+            io::WriteO3DGOption::PositionEncoding::Quantized16;
+    option.oct_encode_normals = true;
+    option.compressed = true;
+    option.chunk_size = 1000;
+    EXPECT_TRUE(io::WriteGeometryToO3DG("test_quantized.o3dg", pc, option));
+
+    io::O3DGFile file;
+    ASSERT_TRUE(file.Open("test_quantized.o3dg"));
+    EXPECT_EQ(file.GetGeometryType(),
+              geometry::Geometry::GeometryType::PointCloud);
+    EXPECT_EQ(file.GetNumPoints(), 10000);
+    EXPECT_EQ(file.GetNumChunks(), 10);
+    geometry::PointCloud pc2;
+    EXPECT_TRUE(file.ReadPointCloud(pc2));
+    // The quantization step is at most 2000 / 65535 per chunk.
+    ExpectEQ(pc.points_, pc2.points_, 0.02);
+    ExpectEQ(pc.normals_, pc2.normals_, 1e-4);
+    ExpectEQ(pc.colors_, pc2.colors_, 0.5 / 255);
+}
+
+TEST(FileO3DG, ReadPointCloudChunk) {
+    const geometry::PointCloud pc = RandPointCloud(2500);
+    io::WriteO3DGOption option;
+    option.position_encoding = io::WriteO3DGOption::PositionEncoding::Float64;
+    option.chunk_size = 1000;
+    EXPECT_TRUE(io::WriteGeometryToO3DG("test_chunks.o3dg", pc, option));
+
+    io::O3DGFile file;
+    ASSERT_TRUE(file.Open("test_chunks.o3dg"));
+    ASSERT_EQ(file.GetNumChunks(), 3);
+    geometry::PointCloud chunk;
+    EXPECT_TRUE(file.ReadPointCloudChunk(2, chunk));
+    ASSERT_EQ(chunk.points_.size(), 500u);
+    ASSERT_EQ(chunk.normals_.size(), 500u);
+    ASSERT_EQ(chunk.colors_.size(), 500u);
+    for (size_t i = 0; i < 500; ++i) {
+        ExpectEQ(chunk.points_[i], pc.points_[2000 + i], 0.0);
+        ExpectEQ(chunk.normals_[i], pc.normals_[2000 + i], 1e-6);
+    }
+    EXPECT_TRUE(file.ReadPointCloudChunk(0, chunk));
+    EXPECT_EQ(chunk.points_.size(), 1000u);
+    EXPECT_FALSE(file.ReadPointCloudChunk(3, chunk));
+    geometry::TriangleMesh mesh;
+    EXPECT_FALSE(file.ReadTriangleMesh(mesh));
+}
+
+TEST(FileO3DG, TriangleMesh) {
+    geometry::TriangleMesh mesh;
+    Eigen::Vector3d one(1, 1, 1);
+    mesh.vertices_.resize(300);
+    mesh.vertex_colors_.resize(300);
+    mesh.triangles_.resize(200);
+    mesh.triangle_uvs_.resize(600);
+    mesh.triangle_material_ids_.resize(200);
+    Rand(mesh.vertices_, one * -10, one * 10, 0);
+    Rand(mesh.vertex_colors_, one * 0, one, 0);
+    Rand(mesh.triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(299, 299, 299), 0);
+    Rand(mesh.triangle_material_ids_, 0, 3, 0);
+    for (size_t i = 0; i < mesh.triangle_uvs_.size(); ++i) {
+        mesh.triangle_uvs_[i] = Eigen::Vector2d(i / 600.0, 1 - i / 600.0);
+    }
+    mesh.ComputeVertexNormals();
+
+    geometry::TriangleMesh mesh2;
+    EXPECT_TRUE(io::WriteTriangleMesh("test.o3dg", mesh, false, true));
+    EXPECT_TRUE(io::ReadTriangleMesh("test.o3dg", mesh2));
+    ExpectEQ(mesh.vertices_, mesh2.vertices_, 1e-5);
+    ExpectEQ(mesh.vertex_normals_, mesh2.vertex_normals_, 1e-6);
+    ExpectEQ(mesh.vertex_colors_, mesh2.vertex_colors_, 0.5 / 255);
+    ExpectEQ(mesh.triangles_, mesh2.triangles_);
+    ExpectEQ(mesh.triangle_normals_, mesh2.triangle_normals_, 1e-6);
+    ExpectEQ(mesh.triangle_uvs_, mesh2.triangle_uvs_, 1e-6);
+    ExpectEQ(mesh.triangle_material_ids_, mesh2.triangle_material_ids_);
+
+    // Attributes can be left out.
+    EXPECT_TRUE(io::WriteTriangleMesh("test.o3dg", mesh, false, false, false,
+                                      false, false));
+    EXPECT_TRUE(io::ReadTriangleMesh("test.o3dg", mesh2));
+    EXPECT_EQ(mesh2.vertices_.size(), 300u);
+    EXPECT_FALSE(mesh2.HasVertexNormals());
+    EXPECT_FALSE(mesh2.HasVertexColors());
+    EXPECT_FALSE(mesh2.HasTriangleUvs());
+    EXPECT_EQ(io::ReadFileGeometryType("test.o3dg"), io::CONTAINS_TRIANGLES);
+}
+
+TEST(FileO3DG, LineSetAndVoxelGrid) {
+    geometry::LineSet lineset;
+    Eigen::Vector3d one(1, 1, 1);
+    lineset.points_.resize(100);
+    lineset.lines_.resize(50);
+    lineset.colors_.resize(50);
+    Rand(lineset.points_, one * -10, one * 10, 0);
+    Rand(lineset.lines_, Eigen::Vector2i(0, 0), Eigen::Vector2i(99, 99), 0);
+    Rand(lineset.colors_, one * 0, one, 0);
+    geometry::LineSet lineset2;
+    EXPECT_TRUE(io::WriteLineSet("test.o3dg", lineset));
+    EXPECT_TRUE(io::ReadLineSet("test.o3dg", lineset2));
+    ExpectEQ(lineset.points_, lineset2.points_, 1e-5);
+    ExpectEQ(lineset.lines_, lineset2.lines_);
+    ExpectEQ(lineset.colors_, lineset2.colors_, 0.5 / 255);
+
+    geometry::VoxelGrid voxelgrid;
+    voxelgrid.origin_ = Eigen::Vector3d(1.5, -2, 3);
+    voxelgrid.voxel_size_ = 0.25;
+    for (int i = 0; i < 100; ++i) {
+        voxelgrid.AddVoxel(geometry::Voxel(Eigen::Vector3i(i, -i, i % 7),
+                                           one * (i / 99.0)));
+    }
+    geometry::VoxelGrid voxelgrid2;
+    EXPECT_TRUE(io::WriteVoxelGrid("test.o3dg", voxelgrid, false, true));
+    EXPECT_TRUE(io::ReadVoxelGrid("test.o3dg", voxelgrid2));
+    ExpectEQ(voxelgrid.origin_, voxelgrid2.origin_);
+    EXPECT_EQ(voxelgrid.voxel_size_, voxelgrid2.voxel_size_);
+    ASSERT_EQ(voxelgrid2.voxels_.size(), 100u);
+    for (const auto &it : voxelgrid.voxels_) {
+        auto found = voxelgrid2.voxels_.find(it.first);
+        ASSERT_TRUE(found != voxelgrid2.voxels_.end());
+        ExpectEQ(found->second.color_, it.second.color_, 0.5 / 255);
+    }
+}
+
+TEST(FileO3DG, Octree) {
+    geometry::Octree octree(6);
+    octree.ConvertFromPointCloud(RandPointCloud(1000));
+    geometry::Octree octree2;
+    EXPECT_TRUE(io::WriteOctree("test.o3dg", octree));
+    EXPECT_TRUE(io::ReadOctree("test.o3dg", octree2));
+    EXPECT_TRUE(octree == octree2);
+    std::shared_ptr<geometry::Octree> octree3 =
+            io::CreateOctreeFromFile("test.o3dg");
+    EXPECT_TRUE(octree == *octree3);
+
+    // A single leaf as the root, and an empty octree.
+    geometry::Octree leaf_octree(0, Eigen::Vector3d(1, 2, 3), 4);
+    leaf_octree.InsertPoint(
+            Eigen::Vector3d(2, 3, 4),
+            geometry::OctreeColorLeafNode::GetInitFunction(),
+            geometry::OctreeColorLeafNode::GetUpdateFunction(
+                    Eigen::Vector3d(0.1, 0.2, 0.3)));
+    EXPECT_TRUE(io::WriteOctree("test.o3dg", leaf_octree));
+    EXPECT_TRUE(io::ReadOctree("test.o3dg", octree2));
+    EXPECT_TRUE(leaf_octree == octree2);
+    EXPECT_TRUE(io::WriteOctree("test.o3dg", geometry::Octree()));
+    EXPECT_TRUE(io::ReadOctree("test.o3dg", octree2));
+    EXPECT_TRUE(octree2.IsEmpty());
+}
+
+TEST(FileO3DG, Memory) {
+    const geometry::PointCloud pc = RandPointCloud(5000);
+    io::WriteO3DGOption option;
+    option.compressed = true;
+    EXPECT_TRUE(io::WriteGeometryToO3DG("test_memory.o3dg", pc, option));
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::WriteGeometryInMemoryToO3DG(buffer, pc, option));
+    EXPECT_EQ(buffer, ReadFileContent("test_memory.o3dg"));
+
+    io::O3DGFile file;
+    geometry::PointCloud pc2;
+    ASSERT_TRUE(file.Open(buffer.data(), buffer.size()));
+    EXPECT_TRUE(file.ReadPointCloud(pc2));
+    ExpectEQ(pc.points_, pc2.points_, 1e-3);
+
+    // Truncated and corrupted content is rejected.
+    EXPECT_FALSE(file.Open(buffer.data(), buffer.size() - 1));
+    buffer[buffer.size() / 2] ^= 0xff;
+    if (file.Open(buffer.data(), buffer.size())) {
+        file.ReadPointCloud(pc2);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
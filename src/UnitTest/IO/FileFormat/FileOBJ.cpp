@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <fstream>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJ) {
+    std::ofstream("tmp.mtl") << "newmtl blue\nKd 0 0 1\n"
+                                "newmtl red\nKd 1 0 0\n";
+    std::ofstream("tmp.obj")
+            << "# quad and triangle with relative indices\n"
+               "mtllib tmp.mtl\n"
+               "v 0 0 0\nv 1 0 0\r\nv 1 1 0\nv 0 1 0\n"
+               "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+               "vn 0 0 1\n"
+               "o object\ng group\ns 1\n"
+               "usemtl red\nf 1/1/1 2/2/1 3/3/1 4/4/1\n"
+               "usemtl blue\nf -4/-4/-1 -2/-2/-1 -1/-1/-1\n";
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh));
+    ExpectEQ(mesh.vertices_, std::vector<Eigen::Vector3d>({{0, 0, 0},
+                                                           {1, 0, 0},
+                                                           {1, 1, 0},
+                                                           {0, 1, 0}}));
+    ExpectEQ(mesh.triangles_,
+             std::vector<Eigen::Vector3i>({{0, 1, 2}, {0, 2, 3}, {0, 2, 3}}));
+    ExpectEQ(mesh.vertex_normals_,
+             std::vector<Eigen::Vector3d>(4, Eigen::Vector3d(0, 0, 1)));
+    EXPECT_FALSE(mesh.HasVertexColors());
+    ASSERT_EQ(mesh.triangle_uvs_.size(), 9u);
+    ExpectEQ(mesh.triangle_uvs_[4], Eigen::Vector2d(1, 1));
+    EXPECT_EQ(mesh.triangle_material_ids_, std::vector<int>({1, 1, 0}));
+    EXPECT_EQ(mesh.materials_.size(), 2u);
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJVertexColors) {
+    std::ofstream("tmp.obj") << "v 0 0 0 1 0 0\nv 1 0 0 0 1 0\n"
+                                "v 0 1 0 0 0 1\nf 1 2 3\n";
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh));
+    ExpectEQ(mesh.vertex_colors_, std::vector<Eigen::Vector3d>({{1, 0, 0},
+                                                                {0, 1, 0},
+                                                                {0, 0, 1}}));
+    EXPECT_FALSE(mesh.HasVertexNormals());
+    EXPECT_FALSE(mesh.HasTriangleUvs());
+    EXPECT_EQ(mesh.triangle_material_ids_, std::vector<int>({-1}));
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJInvalidFaces) {
+    geometry::TriangleMesh mesh;
+    std::ofstream("tmp.obj") << "v 0 0 0\nf 1 2 3\n";
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.obj", mesh));
+    std::ofstream("tmp.obj") << "v 0 0 0\nf 1 x 1\n";
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.obj", mesh));
+    std::ofstream("tmp.obj") << "v 0 0 0\nf -2 1 1\n";
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.obj", mesh));
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJManyChunks) {
+    // A strip of triangles large enough to be parsed in several batches.
+    const int num_vertices = 100000;
+    std::vector<Eigen::Vector3d> vertices;
+    {
+        std::ofstream file("tmp.obj");
+        for (int i = 0; i < num_vertices; i++) {
+            vertices.emplace_back(i % 100, i / 100, 0.5);
+            file << "v " << i % 100 << " " << i / 100 << " 0.5\n";
+            if (i >= 2) {
+                file << "f -1 " << i - 1 << " " << i << "\n";
+            }
+        }
+    }
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh));
+    ExpectEQ(mesh.vertices_, vertices);
+    ASSERT_EQ(mesh.triangles_.size(), size_t(num_vertices - 2));
+    for (int i = 2; i < num_vertices; i++) {
+        ExpectEQ(mesh.triangles_[i - 2], Eigen::Vector3i(i, i - 2, i - 1));
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
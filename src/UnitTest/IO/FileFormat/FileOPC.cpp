@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/OPCIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// Points on a grid of step 0.01, so that every point has its own leaf at
+// the precision of 0.001 and the octree order is known.
+geometry::PointCloud GridPointCloud(int size) {
+    geometry::PointCloud pc;
+    for (int z = 0; z < size; ++z) {
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                pc.points_.push_back(Eigen::Vector3d(x, y, z) * 0.01);
+                pc.colors_.push_back(Eigen::Vector3d(x, y, z) / size);
+            }
+        }
+    }
+    return pc;
+}
+
+// Returns the points of \p pc sorted lexicographically, with their colors.
+std::vector<Eigen::Matrix<double, 6, 1>> Sorted(
+        const geometry::PointCloud &pc) {
+    std::vector<Eigen::Matrix<double, 6, 1>> rows(pc.points_.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i] << pc.points_[i],
+                pc.HasColors() ? pc.colors_[i] : Eigen::Vector3d::Zero();
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const Eigen::Matrix<double, 6, 1> &a,
+                 const Eigen::Matrix<double, 6, 1> &b) {
+                  return std::lexicographical_compare(
+                          a.data(), a.data() + 3, b.data(), b.data() + 3);
+              });
+    return rows;
+}
+
+}  // namespace
+
+TEST(FileOPC, EncodeDecode) {
+    const geometry::PointCloud pc = GridPointCloud(20);
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::EncodePointCloudInMemoryToOPC(buffer, pc));
+    // Much smaller than the 27 bytes per point of binary PCD.
+    EXPECT_LT(buffer.size(), pc.points_.size() * 4);
+
+    geometry::PointCloud pc2;
+    ASSERT_TRUE(io::DecodePointCloudInMemoryFromOPC(buffer.data(),
+                                                    buffer.size(), pc2));
+    ASSERT_EQ(pc2.points_.size(), pc.points_.size());
+    ASSERT_EQ(pc2.colors_.size(), pc.colors_.size());
+    EXPECT_FALSE(pc2.HasNormals());
+    const auto rows = Sorted(pc);
+    const auto rows2 = Sorted(pc2);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        ExpectEQ(Eigen::Vector3d(rows[i].head<3>()),
+                 Eigen::Vector3d(rows2[i].head<3>()), 0.0005 + 1e-9);
+        ExpectEQ(Eigen::Vector3d(rows[i].tail<3>()),
+                 Eigen::Vector3d(rows2[i].tail<3>()), 0.5 / 255);
+    }
+}
+
+TEST(FileOPC, DuplicatesAndPrecision) {
+    geometry::PointCloud pc;
+    pc.points_ = {{1, 2, 3}, {1, 2, 3}, {1.04, 2, 3}, {5.02, 2, 3}};
+    io::EncodeOPCOption option;
+    option.precision = 0.1;
+    option.write_colors = false;
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::EncodePointCloudInMemoryToOPC(buffer, pc, option));
+
+    geometry::PointCloud pc2;
+    ASSERT_TRUE(io::DecodePointCloudInMemoryFromOPC(buffer.data(),
+                                                    buffer.size(), pc2));
+    ASSERT_EQ(pc2.points_.size(), 4u);
+    EXPECT_FALSE(pc2.HasColors());
+    // The first three points share a leaf.
+    ExpectEQ(pc2.points_[0], Eigen::Vector3d(1.05, 2.05, 3.05), 1e-9);
+    ExpectEQ(pc2.points_[1], pc2.points_[0]);
+    ExpectEQ(pc2.points_[2], pc2.points_[0]);
+    ExpectEQ(pc2.points_[3], Eigen::Vector3d(5.05, 2.05, 3.05), 1e-9);
+
+    option.precision = 1e-12;
+    EXPECT_FALSE(io::EncodePointCloudInMemoryToOPC(buffer, pc, option));
+}
+
+TEST(FileOPC, WritePointCloud) {
+    const geometry::PointCloud pc = GridPointCloud(10);
+    EXPECT_TRUE(io::WritePointCloud("test.opc", pc));
+
+    io::PointCloudInfo info;
+    EXPECT_TRUE(io::ReadPointCloudInfo("test.opc", info));
+    EXPECT_EQ(info.num_points, 1000);
+    EXPECT_TRUE(info.has_colors);
+    EXPECT_TRUE(info.has_bounds);
+    ExpectEQ(info.max_bound, Eigen::Vector3d(0.09, 0.09, 0.09));
+
+    geometry::PointCloud pc2;
+    EXPECT_TRUE(io::ReadPointCloud("test.opc", pc2));
+    EXPECT_EQ(pc2.points_.size(), 1000u);
+
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::WritePointCloudToMemory(buffer, "opc", pc));
+    // Truncated and corrupted content is rejected.
+    EXPECT_FALSE(io::ReadPointCloudFromMemory(buffer.data(), buffer.size() / 2,
+                                              "opc", pc2));
+    buffer[buffer.size() / 2] ^= 0xff;
+    io::ReadPointCloudFromMemory(buffer.data(), buffer.size(), "opc", pc2);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -24,6 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -55,9 +62,95 @@ TEST(FilePCD, DISABLED_ConvertRGBToFloat) { NotImplemented(); }
 
 TEST(FilePCD, DISABLED_WritePCDData) { NotImplemented(); }
 
-TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { NotImplemented(); }
-
-TEST(FilePCD, DISABLED_WritePointCloudToPCD) { NotImplemented(); }
+TEST(FilePCD, ReadPointCloudFromPCD) {
+    // Binary records with double positions, an ignored field, float normals
+    // and a packed color.
+    const std::vector<Eigen::Vector3d> points = {{1.0 / 3.0, -2.5, 1e10},
+                                                 {0.1, 0.2, 0.3}};
+    const std::vector<Eigen::Vector3d> normals = {{0, 0, 1}, {0.5, -0.5, 0}};
+    std::string body;
+    for (size_t i = 0; i < points.size(); i++) {
+        const float intensity = 7.0f;
+        const float normal[3] = {float(normals[i](0)), float(normals[i](1)),
+                                 float(normals[i](2))};
+        // Blue, green, red, alpha.
+        const uint8_t rgba[4] = {0, 128, 255, 0};
+        body.append(reinterpret_cast<const char *>(points[i].data()), 24);
+        body.append(reinterpret_cast<const char *>(&intensity), 4);
+        body.append(reinterpret_cast<const char *>(normal), 12);
+        body.append(reinterpret_cast<const char *>(rgba), 4);
+    }
+    {
+        std::ofstream file("test_fields.pcd", std::ios::binary);
+        file << "VERSION 0.7\n"
+             << "FIELDS x y z intensity normal_x normal_y normal_z rgb\n"
+             << "SIZE 8 8 8 4 4 4 4 4\n"
+             << "TYPE F F F F F F F U\n"
+             << "COUNT 1 1 1 1 1 1 1 1\n"
+             << "WIDTH 2\nHEIGHT 1\nPOINTS 2\nDATA binary\n"
+             << body;
+    }
+
+    geometry::PointCloud pointcloud;
+    EXPECT_TRUE(io::ReadPointCloud("test_fields.pcd", pointcloud,
+                                   {"auto", false, false, false}));
+    ASSERT_EQ(pointcloud.points_.size(), 2u);
+    ASSERT_TRUE(pointcloud.HasNormals());
+    ASSERT_TRUE(pointcloud.HasColors());
+    for (size_t i = 0; i < points.size(); i++) {
+        ExpectEQ(pointcloud.points_[i], points[i]);
+        ExpectEQ(pointcloud.normals_[i], normals[i]);
+        ExpectEQ(pointcloud.colors_[i],
+                 Eigen::Vector3d(1.0, 128.0 / 255.0, 0.0));
+    }
+}
+
+TEST(FilePCD, WritePointCloudToPCD) {
+    // Enough points for several independently compressed chunks.
+    const int num_points = 200000;
+    const Eigen::Vector3d one(1, 1, 1);
+    geometry::PointCloud pointcloud;
+    pointcloud.points_.resize(num_points);
+    pointcloud.normals_.resize(num_points);
+    pointcloud.colors_.resize(num_points);
+    Rand(pointcloud.points_, one * -1000, one * 1000, 0);
+    Rand(pointcloud.normals_, one * -1, one, 0);
+    Rand(pointcloud.colors_, one * 0, one, 0);
+    EXPECT_TRUE(io::WritePointCloud("test_chunks.pcd", pointcloud,
+                                    {false, true, false}));
+
+    geometry::PointCloud chunked;
+    EXPECT_TRUE(io::ReadPointCloud("test_chunks.pcd", chunked,
+                                   {"auto", false, false, false}));
+    ASSERT_EQ(chunked.points_.size(), pointcloud.points_.size());
+    for (int i = 0; i < num_points; i += 997) {
+        EXPECT_LT((chunked.points_[i] - pointcloud.points_[i]).norm(), 1e-3);
+        EXPECT_LT((chunked.normals_[i] - pointcloud.normals_[i]).norm(),
+                  1e-6);
+        EXPECT_LT((chunked.colors_[i] - pointcloud.colors_[i]).norm(), 1e-2);
+    }
+
+    // Without the chunk list, e.g. for PCL, the data is one LZF stream.
+    std::ifstream input("test_chunks.pcd", std::ios::binary);
+    std::stringstream content;
+    content << input.rdbuf();
+    std::string data = content.str();
+    int num_chunk_lines = 0;
+    size_t pos;
+    while ((pos = data.find("# OPEN3D_LZF_CHUNKS")) != std::string::npos) {
+        data.erase(pos, data.find('\n', pos) + 1 - pos);
+        num_chunk_lines++;
+    }
+    EXPECT_EQ(num_chunk_lines, 1);
+    std::ofstream("test_chunks_plain.pcd", std::ios::binary) << data;
+    geometry::PointCloud plain;
+    EXPECT_TRUE(io::ReadPointCloud("test_chunks_plain.pcd", plain,
+                                   {"auto", false, false, false}));
+    ASSERT_EQ(plain.points_.size(), chunked.points_.size());
+    EXPECT_TRUE(plain.points_ == chunked.points_);
+    EXPECT_TRUE(plain.normals_ == chunked.normals_);
+    EXPECT_TRUE(plain.colors_ == chunked.colors_);
+}
 
 }  // namespace unit_test
 }  // namespace open3d
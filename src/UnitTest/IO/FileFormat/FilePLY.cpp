@@ -24,11 +24,59 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/CompactTriangleMesh.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
+namespace {
+
+// Writes a PLY file from its header and binary body, in the given byte order.
+class PLYFileBuilder {
+public:
+    PLYFileBuilder(bool big_endian) : big_endian_(big_endian) {}
+
+    template <typename T>
+    PLYFileBuilder &Add(T value) {
+        char bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        const uint16_t one = 1;
+        const bool host_big_endian = *reinterpret_cast<const char *>(&one) == 0;
+        if (host_big_endian != big_endian_) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        body_.append(bytes, sizeof(T));
+        return *this;
+    }
+
+    void Write(const std::string &filename, const std::string &header) const {
+        std::ofstream file(filename, std::ios::binary);
+        file << "ply\nformat "
+             << (big_endian_ ? "binary_big_endian" : "binary_little_endian")
+             << " 1.0\n"
+             << header << "end_header\n"
+             << body_;
+    }
+
+private:
+    bool big_endian_;
+    std::string body_;
+};
+
+}  // unnamed namespace
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { NotImplemented(); }
@@ -39,11 +87,165 @@ TEST(FilePLY, DISABLED_ReadColorCallback) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ReadFaceCallBack) { NotImplemented(); }
 
-TEST(FilePLY, DISABLED_ReadPointCloudFromPLY) { NotImplemented(); }
+TEST(FilePLY, ReadPointCloudFromPLY) {
+    // Big endian, with a fixed-size element before the vertices, mixed
+    // property types and an unused property.
+    PLYFileBuilder builder(true);
+    builder.Add<int32_t>(7).Add<int32_t>(8);
+    for (int i = 0; i < 3; i++) {
+        builder.Add<float>(float(i))
+                .Add<double>(i * 0.5)
+                .Add<float>(float(-i))
+                .Add<float>(float(2 * i))
+                .Add<uint8_t>(uint8_t(10 * i))
+                .Add<uint8_t>(uint8_t(20 * i))
+                .Add<uint8_t>(uint8_t(30 * i));
+    }
+    const std::string filename = "read_pointcloud_from_ply.ply";
+    builder.Write(filename,
+                  "comment fast path\n"
+                  "element camera 1\n"
+                  "property int width\n"
+                  "property int height\n"
+                  "element vertex 3\n"
+                  "property float x\n"
+                  "property double intensity\n"
+                  "property float y\n"
+                  "property float z\n"
+                  "property uchar red\n"
+                  "property uchar green\n"
+                  "property uchar blue\n");
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPLY(filename, pcd,
+                                          io::ReadPointCloudOption()));
+    std::remove(filename.c_str());
+    ASSERT_EQ(pcd.points_.size(), 3u);
+    EXPECT_FALSE(pcd.HasNormals());
+    ASSERT_EQ(pcd.colors_.size(), 3u);
+    for (int i = 0; i < 3; i++) {
+        ExpectEQ(pcd.points_[i], Eigen::Vector3d(i, -i, 2 * i));
+        ExpectEQ(pcd.colors_[i],
+                 Eigen::Vector3d(10 * i / 255.0, 20 * i / 255.0,
+                                 30 * i / 255.0));
+    }
+}
+
+TEST(FilePLY, ReadCompactPointCloudFromPLY) {
+    PLYFileBuilder builder(false);
+    for (int i = 0; i < 3; i++) {
+        builder.Add<float>(i + 0.1f)
+                .Add<float>(-i - 0.2f)
+                .Add<float>(2 * i + 0.3f)
+                .Add<double>(0.0)
+                .Add<double>(1.0)
+                .Add<double>(0.0);
+    }
+    const std::string filename = "read_compact_pointcloud_from_ply.ply";
+    const std::string properties =
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property double nx\n"
+            "property double ny\n"
+            "property double nz\n";
+    builder.Write(filename, "element vertex 3\n" + properties);
+
+    // Float coordinates are read exactly.
+    geometry::CompactPointCloud compact;
+    EXPECT_TRUE(io::ReadCompactPointCloud(filename, compact));
+    ASSERT_EQ(compact.points_.size(), 3u);
+    ASSERT_TRUE(compact.HasNormals());
+    EXPECT_FALSE(compact.HasColors());
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(compact.points_[i],
+                  Eigen::Vector3f(i + 0.1f, -i - 0.2f, 2 * i + 0.3f));
+        EXPECT_EQ(compact.normals_[i], Eigen::Vector3f(0, 1, 0));
+    }
+
+    // ASCII files are read by rply.
+    {
+        std::ofstream file(filename);
+        file << "ply\nformat ascii 1.0\n"
+             << "element vertex 2\n"
+             << properties << "end_header\n"
+             << "0.5 1 2 0 0 1\nnan 0 0 0 0 1\n";
+    }
+    EXPECT_TRUE(io::ReadCompactPointCloud(filename, compact));
+    std::remove(filename.c_str());
+    ASSERT_EQ(compact.points_.size(), 1u);
+    EXPECT_EQ(compact.points_[0], Eigen::Vector3f(0.5f, 1.0f, 2.0f));
+}
 
 TEST(FilePLY, DISABLED_WritePointCloudToPLY) { NotImplemented(); }
 
-TEST(FilePLY, DISABLED_ReadTriangleMeshFromPLY) { NotImplemented(); }
+TEST(FilePLY, ReadTriangleMeshFromPLY) {
+    const std::string header =
+            "element vertex 4\n"
+            "property double x\n"
+            "property double y\n"
+            "property double z\n"
+            "element face 2\n"
+            "property list uchar int vertex_indices\n";
+    PLYFileBuilder triangles(false);
+    for (int i = 0; i < 4; i++) {
+        triangles.Add<double>(i).Add<double>(i % 2).Add<double>(0.0);
+    }
+    triangles.Add<uint8_t>(3).Add<int32_t>(0).Add<int32_t>(1).Add<int32_t>(2);
+    triangles.Add<uint8_t>(3).Add<int32_t>(1).Add<int32_t>(3).Add<int32_t>(2);
+    const std::string filename = "read_trianglemesh_from_ply.ply";
+    triangles.Write(filename, header);
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY(filename, mesh, false));
+    ASSERT_EQ(mesh.vertices_.size(), 4u);
+    ExpectEQ(mesh.vertices_[3], Eigen::Vector3d(3, 1, 0));
+    ASSERT_EQ(mesh.triangles_.size(), 2u);
+    ExpectEQ(mesh.triangles_[0], Eigen::Vector3i(0, 1, 2));
+    ExpectEQ(mesh.triangles_[1], Eigen::Vector3i(1, 3, 2));
+
+    // Polygons are read by rply and triangulated.
+    PLYFileBuilder polygons(false);
+    for (int i = 0; i < 4; i++) {
+        polygons.Add<double>(i % 2).Add<double>(i / 2).Add<double>(0.0);
+    }
+    polygons.Add<uint8_t>(4)
+            .Add<int32_t>(0)
+            .Add<int32_t>(1)
+            .Add<int32_t>(3)
+            .Add<int32_t>(2);
+    polygons.Add<uint8_t>(3).Add<int32_t>(0).Add<int32_t>(1).Add<int32_t>(3);
+    polygons.Write(filename, header);
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY(filename, mesh, false));
+    std::remove(filename.c_str());
+    EXPECT_EQ(mesh.vertices_.size(), 4u);
+    EXPECT_EQ(mesh.triangles_.size(), 3u);
+}
+
+TEST(FilePLY, ReadCompactTriangleMeshFromPLY) {
+    PLYFileBuilder builder(false);
+    for (int i = 0; i < 4; i++) {
+        builder.Add<float>(i).Add<float>(i % 2).Add<float>(0.5f);
+    }
+    builder.Add<uint8_t>(3).Add<int32_t>(0).Add<int32_t>(1).Add<int32_t>(2);
+    builder.Add<uint8_t>(3).Add<int32_t>(1).Add<int32_t>(3).Add<int32_t>(2);
+    const std::string filename = "read_compact_trianglemesh_from_ply.ply";
+    builder.Write(filename,
+                  "element vertex 4\n"
+                  "property float x\n"
+                  "property float y\n"
+                  "property float z\n"
+                  "element face 2\n"
+                  "property list uchar int vertex_indices\n");
+
+    geometry::CompactTriangleMesh mesh;
+    EXPECT_TRUE(io::ReadCompactTriangleMesh(filename, mesh));
+    std::remove(filename.c_str());
+    ASSERT_EQ(mesh.vertices_.size(), 4u);
+    EXPECT_EQ(mesh.vertices_[3], Eigen::Vector3f(3.0f, 1.0f, 0.5f));
+    ASSERT_EQ(mesh.triangles_.size(), 2u);
+    ExpectEQ(mesh.triangles_[1], Eigen::Vector3i(1, 3, 2));
+}
 
 TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { NotImplemented(); }
 
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// A depth image with holes, edges and smooth surfaces.
+geometry::Image DepthImage(int width, int height) {
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 2);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            uint16_t value = uint16_t(1000 + 3 * u + 7 * v);
+            if ((u / 8 + v / 8) % 5 == 0) {
+                value = 0;
+            } else if (u > width / 2) {
+                value = uint16_t(65535 - u);
+            }
+            *depth.PointerAt<uint16_t>(u, v) = value;
+        }
+    }
+    return depth;
+}
+
+}  // namespace
+
+TEST(FileRVL, WriteReadMemory) {
+    const geometry::Image depth = DepthImage(61, 47);
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::WriteImageToMemory(buffer, "rvl", depth));
+    EXPECT_LT(buffer.size(), depth.data_.size() / 2);
+
+    geometry::Image decoded;
+    EXPECT_TRUE(io::ReadImageFromMemory(buffer.data(), buffer.size(), "rvl",
+                                        decoded));
+    EXPECT_EQ(decoded.width_, 61);
+    EXPECT_EQ(decoded.height_, 47);
+    EXPECT_EQ(decoded.num_of_channels_, 1);
+    EXPECT_EQ(decoded.bytes_per_channel_, 2);
+    ExpectEQ(decoded.data_, depth.data_);
+
+    // Keeps the top-left pixel of every block.
+    io::ImageReadOption option;
+    option.scale_denominator = 4;
+    EXPECT_TRUE(io::ReadImageFromMemory(buffer.data(), buffer.size(), "rvl",
+                                        decoded, option));
+    EXPECT_EQ(decoded.width_, 16);
+    EXPECT_EQ(decoded.height_, 12);
+    EXPECT_EQ(*decoded.PointerAt<uint16_t>(15, 11),
+              *depth.PointerAt<uint16_t>(60, 44));
+
+    // Truncated content is rejected.
+    EXPECT_FALSE(io::ReadImageFromMemory(buffer.data(), buffer.size() - 4,
+                                         "rvl", decoded));
+}
+
+TEST(FileRVL, WriteReadFile) {
+    const geometry::Image depth = DepthImage(64, 48);
+    EXPECT_TRUE(io::WriteImage("test.rvl", depth));
+    io::ImageInfo info;
+    EXPECT_TRUE(io::ReadImageInfo("test.rvl", info));
+    EXPECT_EQ(info.width, 64);
+    EXPECT_EQ(info.height, 48);
+    EXPECT_EQ(info.bytes_per_channel, 2);
+    geometry::Image decoded;
+    EXPECT_TRUE(io::ReadImage("test.rvl", decoded));
+    ExpectEQ(decoded.data_, depth.data_);
+
+    // Only depth images can be written.
+    geometry::Image color;
+    color.Prepare(4, 4, 3, 1);
+    EXPECT_FALSE(io::WriteImage("test_color.rvl", color));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
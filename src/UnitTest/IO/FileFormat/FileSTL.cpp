@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <fstream>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
@@ -46,5 +48,43 @@ TEST(FileSTL, WriteReadTriangleMeshFromSTL) {
     ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
 }
 
+TEST(FileSTL, ReadTriangleMeshFromSTLWeldVertices) {
+    geometry::TriangleMesh tm_gt;
+    tm_gt.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    tm_gt.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+    tm_gt.ComputeTriangleNormals();
+    io::WriteTriangleMesh("tmp.stl", tm_gt);
+
+    geometry::TriangleMesh tm_test;
+    io::ReadTriangleMesh("tmp.stl", tm_test);
+    EXPECT_EQ(tm_test.vertices_.size(), 6u);
+
+    io::ReadTriangleMeshOption option;
+    option.weld_vertices = true;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.stl", tm_test, option));
+    ExpectEQ(tm_gt.vertices_, tm_test.vertices_);
+    ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
+    ExpectEQ(tm_gt.triangle_normals_, tm_test.triangle_normals_);
+}
+
+TEST(FileSTL, ReadTriangleMeshFromSTLTruncated) {
+    geometry::TriangleMesh tm_gt;
+    tm_gt.vertices_ = {{0, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    tm_gt.triangles_ = {{0, 1, 2}};
+    tm_gt.ComputeVertexNormals();
+    io::WriteTriangleMesh("tmp.stl", tm_gt);
+
+    // Drop the end of the only triangle.
+    std::ifstream input("tmp.stl", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(input)),
+                        std::istreambuf_iterator<char>());
+    input.close();
+    std::ofstream("tmp.stl", std::ios::binary)
+            << content.substr(0, content.size() - 10);
+
+    geometry::TriangleMesh tm_test;
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.stl", tm_test));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/Sensor/RGBDImagePool.h"
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(RGBDImagePool, Acquire) {
+    io::RGBDImagePool pool(2, 8, 4);
+    EXPECT_EQ(pool.GetNumFreeImages(), 2);
+
+    auto image = pool.Acquire();
+    EXPECT_EQ(pool.GetNumFreeImages(), 1);
+    EXPECT_EQ(image->color_.width_, 8);
+    EXPECT_EQ(image->color_.num_of_channels_, 3);
+    EXPECT_EQ(image->depth_.height_, 4);
+    EXPECT_EQ(image->depth_.bytes_per_channel_, 2);
+
+    // A released image is handed out again with its buffers.
+    const uint8_t *color_data = image->color_.data_.data();
+    geometry::RGBDImage *address = image.get();
+    image.reset();
+    EXPECT_EQ(pool.GetNumFreeImages(), 2);
+    image = pool.Acquire();
+    EXPECT_EQ(image.get(), address);
+    EXPECT_EQ(image->color_.data_.data(), color_data);
+}
+
+TEST(RGBDImagePool, Capacity) {
+    io::RGBDImagePool pool(2);
+    EXPECT_EQ(pool.GetNumFreeImages(), 0);
+
+    // Images kept by the caller do not block, the pool allocates new ones.
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images;
+    for (int i = 0; i < 5; i++) {
+        images.push_back(pool.Acquire());
+        EXPECT_TRUE(images.back() != nullptr);
+    }
+    images.clear();
+    EXPECT_EQ(pool.GetNumFreeImages(), 2);
+
+    // Images outlive the pool.
+    std::shared_ptr<geometry::RGBDImage> image;
+    {
+        io::RGBDImagePool other_pool(1, 4, 4);
+        image = other_pool.Acquire();
+    }
+    EXPECT_EQ(image->color_.width_, 4);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
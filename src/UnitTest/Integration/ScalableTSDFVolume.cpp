@@ -24,6 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Utility/FileSystem.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -39,17 +48,435 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    // Fronto-parallel plane at depth 1, seen from the origin.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::NoColor, 16, 4);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->vertices_.size(), 0u);
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex(2), 1.0, 0.01);
+        EXPECT_LE(std::abs(vertex(0)), 0.65);
+        EXPECT_LE(std::abs(vertex(1)), 0.49);
+    }
+
+    // Integrating the same frame again touches the same units and keeps the
+    // surface in place.
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_EQ(volume.ExtractTriangleMesh()->vertices_.size(),
+              mesh->vertices_.size());
+}
+
+TEST(ScalableTSDFVolume, IntegrateMultiCamera) {
+    // Three cameras around a slanted surface, with overlapping views.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    std::vector<geometry::RGBDImage> images(3);
+    std::vector<integration::TSDFCameraView> views;
+    for (int i = 0; i < 3; i++) {
+        geometry::RGBDImage& rgbd = images[i];
+        rgbd.depth_.Prepare(64, 48, 1, 4);
+        rgbd.color_.Prepare(64, 48, 1, 4);
+        for (int v = 0; v < 48; v++) {
+            for (int u = 0; u < 64; u++) {
+                *rgbd.depth_.PointerAt<float>(u, v) = 0.8f + 0.004f * u;
+                *rgbd.color_.PointerAt<float>(u, v) = 0.25f * i;
+            }
+        }
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic(0, 3) = 0.1 * (i - 1);
+        views.emplace_back(images[i], intrinsic, extrinsic);
+    }
+
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8, 1);
+    integration::ScalableTSDFVolume multi_camera_volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8, 1);
+    for (const auto& view : views) {
+        volume.Integrate(*view.image_, view.intrinsic_, view.extrinsic_);
+    }
+    multi_camera_volume.IntegrateMultiCamera(views);
+
+    // The frame touches the union of the units of the cameras, and every
+    // camera adds one observation to the voxels it sees.
+    EXPECT_EQ(multi_camera_volume.num_integrated_frames_, 1);
+    ASSERT_EQ(multi_camera_volume.volume_units_.size(),
+              volume.volume_units_.size());
+    int num_shared = 0;
+    for (const auto& unit : volume.volume_units_) {
+        ASSERT_EQ(multi_camera_volume.volume_units_.count(unit.first), 1u);
+        const auto& voxels = unit.second.volume_->voxels_;
+        const auto& multi_camera_voxels =
+                multi_camera_volume.volume_units_.at(unit.first)
+                        .volume_->voxels_;
+        for (int64_t i = 0; i < voxels.Size(); i++) {
+            ASSERT_EQ(multi_camera_voxels.GetWeight(i), voxels.GetWeight(i));
+            num_shared += voxels.GetWeight(i) > 1.0f;
+            EXPECT_NEAR(multi_camera_voxels.GetTSDF(i), voxels.GetTSDF(i),
+                        1e-5);
+            ExpectEQ(multi_camera_voxels.GetColor(i), voxels.GetColor(i),
+                     1e-5);
+        }
+    }
+    EXPECT_GT(num_shared, 0);
+    EXPECT_EQ(multi_camera_volume.ExtractTriangleMesh()->vertices_.size(),
+              volume.ExtractTriangleMesh()->vertices_.size());
+}
+
+TEST(ScalableTSDFVolume, ExtractPointCloud) {
+    // Fronto-parallel plane at depth 1, on the boundary between two layers
+    // of volume units.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    rgbd.color_.Prepare(64, 48, 3, 1);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+            for (int c = 0; c < 3; c++) {
+                *rgbd.color_.PointerAt<uint8_t>(u, v, c) = uint8_t(100 * c);
+            }
+        }
+    }
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::RGB8, 8, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    std::shared_ptr<geometry::PointCloud> pcd = volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    ASSERT_EQ(pcd->normals_.size(), pcd->points_.size());
+    ASSERT_EQ(pcd->colors_.size(), pcd->points_.size());
+    const Eigen::Vector3d color = Eigen::Vector3d(0.0, 100.0, 200.0) / 255.0;
+    int num_facing = 0;
+    for (size_t i = 0; i < pcd->points_.size(); i++) {
+        EXPECT_NEAR(pcd->points_[i](2), 1.0, 0.005);
+        ExpectEQ(pcd->colors_[i], color, 1e-6);
+        // The normals face the camera, except on the border of the plane.
+        num_facing += pcd->normals_[i](2) < -0.99;
+    }
+    EXPECT_GT(num_facing, int(pcd->points_.size()) * 9 / 10);
+
+    // The extraction is deterministic.
+    std::shared_ptr<geometry::PointCloud> pcd2 = volume.ExtractPointCloud();
+    EXPECT_EQ(pcd2->points_, pcd->points_);
+    EXPECT_EQ(pcd2->normals_, pcd->normals_);
+}
+
+TEST(ScalableTSDFVolume, ExtractTriangleMesh) {
+    // Tilted plane, crossing the boundaries of many volume units.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 0.8f + 0.005f * u;
+        }
+    }
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+
+    // Vertices on the boundaries of the units are shared, not duplicated.
+    std::vector<Eigen::Vector3d> vertices = mesh->vertices_;
+    std::sort(vertices.begin(), vertices.end(),
+              [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
+                  return std::lexicographical_compare(
+                          a.data(), a.data() + 3, b.data(), b.data() + 3);
+              });
+    EXPECT_EQ(std::unique(vertices.begin(), vertices.end()) -
+                      vertices.begin(),
+              int64_t(mesh->vertices_.size()));
+    std::vector<int> vertex_degrees(mesh->vertices_.size(), 0);
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        for (int i = 0; i < 3; i++) {
+            ASSERT_GE(triangle(i), 0);
+            ASSERT_LT(triangle(i), int(mesh->vertices_.size()));
+            vertex_degrees[triangle(i)]++;
+        }
+    }
+    for (int degree : vertex_degrees) {
+        EXPECT_GT(degree, 0);
+    }
+
+    // The extraction is deterministic.
+    std::shared_ptr<geometry::TriangleMesh> mesh2 =
+            volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh2->vertices_, mesh->vertices_);
+    EXPECT_EQ(mesh2->triangles_, mesh->triangles_);
+}
+
+TEST(ScalableTSDFVolume, ExtractUpdatedVolumeUnitMeshes) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 0.8f + 0.005f * u;
+        }
+    }
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    // After the first frame, the patches cover the whole mesh.
+    auto patches = volume.ExtractUpdatedVolumeUnitMeshes();
+    EXPECT_EQ(patches.size(), volume.volume_units_.size());
+    size_t num_triangles = 0;
+    for (const auto& patch : patches) {
+        EXPECT_EQ(volume.volume_units_.count(patch.first), 1u);
+        num_triangles += patch.second->triangles_.size();
+    }
+    EXPECT_EQ(num_triangles, volume.ExtractTriangleMesh()->triangles_.size());
+    EXPECT_TRUE(volume.ExtractUpdatedVolumeUnitMeshes().empty());
+
+    // A frame moved far away only updates its own units and their
+    // neighbors.
+    const size_t num_units = volume.volume_units_.size();
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = -10.0;
+    volume.Integrate(rgbd, intrinsic, extrinsic);
+    patches = volume.ExtractUpdatedVolumeUnitMeshes();
+    EXPECT_EQ(patches.size(), volume.volume_units_.size() - num_units);
+    for (const auto& patch : patches) {
+        EXPECT_GT(patch.first(0) * 0.04, 9.0);
+    }
+
+    volume.Integrate(rgbd, intrinsic, extrinsic);
+    volume.Reset();
+    EXPECT_TRUE(volume.ExtractUpdatedVolumeUnitMeshes().empty());
+}
+
+TEST(ScalableTSDFVolume, OutOfCore) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 0.8f + 0.005f * u;
+        }
+    }
+    Eigen::Matrix4d far_extrinsic = Eigen::Matrix4d::Identity();
+    far_extrinsic(0, 3) = -10.0;
+    auto integrate = [&](integration::ScalableTSDFVolume& volume) {
+        volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+        volume.Integrate(rgbd, intrinsic, far_extrinsic);
+        volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    };
+
+    integration::ScalableTSDFVolume reference(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 2);
+    integrate(reference);
+    // The far frame does not reach the units of the others.
+    integration::ScalableTSDFVolume near_reference(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 2);
+    near_reference.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    near_reference.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    const auto near_mesh = near_reference.ExtractTriangleMesh();
+
+    // Units of the far frame are moved out of memory by the last frame and
+    // the units of the first frame are loaded back.
+    const std::string directory = "tsdf_out_of_core";
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 2);
+    volume.EnableOutOfCore(directory, 1);
+    integrate(volume);
+    EXPECT_EQ(volume.volume_units_.size() + volume.stored_units_.size(),
+              reference.volume_units_.size());
+    EXPECT_LT(volume.volume_units_.size(), reference.volume_units_.size());
+    for (const auto& unit : volume.volume_units_) {
+        EXPECT_LT(unit.first(0) * 0.04, 9.0);
+    }
+    const auto mesh = volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh->vertices_, near_mesh->vertices_);
+    EXPECT_EQ(mesh->triangles_, near_mesh->triangles_);
+
+    // Save and load all units, including those on disk.
+    const std::string filename = "tsdf_volume_units.bin";
+    EXPECT_TRUE(volume.SaveVolumeUnits(filename));
+    integration::ScalableTSDFVolume loaded(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 2);
+    EXPECT_TRUE(loaded.LoadVolumeUnits(filename));
+    EXPECT_EQ(loaded.volume_units_.size(), reference.volume_units_.size());
+    EXPECT_EQ(loaded.ExtractTriangleMesh()->triangles_.size(),
+              reference.ExtractTriangleMesh()->triangles_.size());
+
+    integration::ScalableTSDFVolume other(
+            0.005, 0.02, integration::TSDFVolumeColorType::RGB8, 8, 2);
+    EXPECT_FALSE(other.LoadVolumeUnits(filename));
+
+    volume.Reset();
+    EXPECT_TRUE(volume.stored_units_.empty());
+    utility::filesystem::RemoveFile(filename);
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+TEST(ScalableTSDFVolume, Raycast) {
+    // Tilted plane z = 0.8 + 0.1 x with a color ramp, crossing many units.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    rgbd.color_.Prepare(64, 48, 3, 1);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            const double x = (u - 31.5) / 50.0;
+            *rgbd.depth_.PointerAt<float>(u, v) = float(0.8 / (1.0 - 0.1 * x));
+            *rgbd.color_.PointerAt<uint8_t>(u, v, 0) = uint8_t(4 * u);
+            *rgbd.color_.PointerAt<uint8_t>(u, v, 1) = 128;
+            *rgbd.color_.PointerAt<uint8_t>(u, v, 2) = uint8_t(5 * v);
+        }
+    }
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::RGB8, 8, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    // From the integrated pose and from 5 cm further back.
+    for (double back : {0.0, 0.05}) {
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic(2, 3) = back;
+        integration::TSDFRaycastResult result =
+                volume.Raycast(intrinsic, extrinsic);
+        const Eigen::Vector3d expected_normal =
+                (extrinsic.block<3, 3>(0, 0) * Eigen::Vector3d(0.1, 0.0, -1.0))
+                        .normalized();
+        int num_hits = 0;
+        for (int v = 4; v < 44; v++) {
+            for (int u = 4; u < 60; u++) {
+                const float depth = *result.depth_.PointerAt<float>(u, v);
+                if (depth == 0.0f) {
+                    continue;
+                }
+                num_hits++;
+                // The hit in world coordinates lies on the plane.
+                const double x = (u - 31.5) / 50.0 * depth;
+                EXPECT_NEAR(depth - back, 0.8 + 0.1 * x, 0.005);
+                const Eigen::Vector3d normal(
+                        *result.normal_.PointerAt<float>(u, v, 0),
+                        *result.normal_.PointerAt<float>(u, v, 1),
+                        *result.normal_.PointerAt<float>(u, v, 2));
+                EXPECT_GT(normal.dot(expected_normal), 0.99);
+                EXPECT_NEAR(*result.color_.PointerAt<float>(u, v, 1),
+                            128.0 / 255.0, 0.01);
+            }
+        }
+        EXPECT_GT(num_hits, 40 * 56 * 9 / 10);
+    }
+
+    // Rays that miss the surface leave zeros.
+    Eigen::Matrix4d away = Eigen::Matrix4d::Identity();
+    away(0, 0) = away(2, 2) = -1.0;
+    integration::TSDFRaycastResult result = volume.Raycast(intrinsic, away);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            EXPECT_EQ(*result.depth_.PointerAt<float>(u, v), 0.0f);
+        }
+    }
+}
+
+TEST(ScalableTSDFVolume, RemoveFreeSpaceUnits) {
+    // A wall at 0.6 m that moves to 1 m, as in a dynamic scene.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    auto integrate_wall = [&](integration::ScalableTSDFVolume& volume,
+                              float depth, int num_frames) {
+        geometry::RGBDImage rgbd;
+        rgbd.depth_.Prepare(64, 48, 1, 4);
+        for (int v = 0; v < 48; v++) {
+            for (int u = 0; u < 64; u++) {
+                *rgbd.depth_.PointerAt<float>(u, v) = depth;
+            }
+        }
+        for (int i = 0; i < num_frames; i++) {
+            volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+        }
+    };
+    auto count_vertices_near = [](integration::ScalableTSDFVolume& volume,
+                                  double z) {
+        int count = 0;
+        for (const auto& vertex : volume.ExtractTriangleMesh()->vertices_) {
+            count += std::abs(vertex(2) - z) < 0.05 ? 1 : 0;
+        }
+        return count;
+    };
+
+    // Without a weight cap, the old wall outweighs the new observations.
+    integration::ScalableTSDFVolume plain(
+            0.01, 0.04, integration::TSDFVolumeColorType::NoColor, 8, 1);
+    integrate_wall(plain, 0.6f, 10);
+    const size_t num_units = plain.volume_units_.size();
+    integrate_wall(plain, 1.0f, 3);
+    EXPECT_GT(count_vertices_near(plain, 0.6), 0);
+    EXPECT_GT(count_vertices_near(plain, 1.0), 0);
+
+    // With the cap and carving, it is replaced and its units are removed.
+    integration::ScalableTSDFVolume carving(
+            0.01, 0.04, integration::TSDFVolumeColorType::NoColor, 8, 1);
+    carving.max_weight_ = 2.0;
+    carving.remove_free_space_units_ = true;
+    integrate_wall(carving, 0.6f, 10);
+    EXPECT_EQ(carving.volume_units_.size(), num_units);
+    EXPECT_GT(count_vertices_near(carving, 0.6), 0);
+    integrate_wall(carving, 1.0f, 3);
+    EXPECT_EQ(count_vertices_near(carving, 0.6), 0);
+    EXPECT_GT(count_vertices_near(carving, 1.0), 0);
+    for (const auto& unit : carving.volume_units_) {
+        EXPECT_GT((unit.first(2) + 1) * carving.volume_unit_length_, 0.9);
+    }
+}
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
+TEST(ScalableTSDFVolume, ExtractVoxelPointCloud) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 0.8f + 0.005f * u;
+        }
+    }
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::NoColor, 8, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) { NotImplemented(); }
+    // The cloud holds the voxels of every unit.
+    std::shared_ptr<geometry::PointCloud> voxel_pcd =
+            volume.ExtractVoxelPointCloud();
+    size_t num_voxels = 0;
+    for (const auto& unit : volume.volume_units_) {
+        num_voxels +=
+                unit.second.volume_->ExtractVoxelPointCloud()->points_.size();
+    }
+    ASSERT_GT(voxel_pcd->points_.size(), 0u);
+    EXPECT_EQ(voxel_pcd->points_.size(), num_voxels);
+    EXPECT_EQ(volume.ExtractVoxelPointCloud()->points_, voxel_pcd->points_);
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) { NotImplemented(); }
+    // The thresholds are applied to every unit.
+    std::shared_ptr<geometry::PointCloud> near_pcd =
+            volume.ExtractVoxelPointCloud(0.0f, 0.5f);
+    ASSERT_GT(near_pcd->points_.size(), 0u);
+    EXPECT_LT(near_pcd->points_.size(), voxel_pcd->points_.size());
+    for (const Eigen::Vector3d& color : near_pcd->colors_) {
+        EXPECT_LE(std::abs(color(0) * 2.0 - 1.0), 0.5);
+    }
+    EXPECT_TRUE(volume.ExtractVoxelPointCloud(1.0f)->IsEmpty());
+}
 
 TEST(ScalableTSDFVolume, DISABLED_LocateVolumeUnit) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_OpenVolumeUnit) { NotImplemented(); }
+TEST(ScalableTSDFVolume, DISABLED_LocateTouchedVolumeUnits) {
+    NotImplemented();
+}
 
 TEST(ScalableTSDFVolume, DISABLED_GetNormalAt) { NotImplemented(); }
 
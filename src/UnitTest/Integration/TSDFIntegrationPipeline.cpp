@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFIntegrationPipeline.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// Tilted plane z = 0.8 + 0.1 x with a color ramp, seen from the origin.
+std::shared_ptr<geometry::RGBDImage> CreatePlaneImage() {
+    auto rgbd = std::make_shared<geometry::RGBDImage>();
+    rgbd->depth_.Prepare(64, 48, 1, 4);
+    rgbd->color_.Prepare(64, 48, 3, 1);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            const double x = (u - 31.5) / 50.0;
+            *rgbd->depth_.PointerAt<float>(u, v) = float(0.8 / (1.0 - 0.1 * x));
+            *rgbd->color_.PointerAt<uint8_t>(u, v, 0) = uint8_t(4 * u);
+            *rgbd->color_.PointerAt<uint8_t>(u, v, 1) = 128;
+            *rgbd->color_.PointerAt<uint8_t>(u, v, 2) = uint8_t(5 * v);
+        }
+    }
+    return rgbd;
+}
+
+// Camera moving sideways and back.
+Eigen::Matrix4d GetExtrinsic(int frame) {
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = 0.02 * frame;
+    extrinsic(2, 3) = 0.01 * frame;
+    return extrinsic;
+}
+
+const camera::PinholeCameraIntrinsic kIntrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+
+}  // unnamed namespace
+
+TEST(TSDFIntegrationPipeline, ScalableTSDFVolume) {
+    const int num_frames = 12;
+    integration::ScalableTSDFVolume expected(
+            0.005, 0.02, integration::TSDFVolumeColorType::RGB8, 8, 1);
+    for (int i = 0; i < num_frames; i++) {
+        expected.Integrate(*CreatePlaneImage(), kIntrinsic, GetExtrinsic(i));
+    }
+
+    integration::ScalableTSDFVolume volume(
+            0.005, 0.02, integration::TSDFVolumeColorType::RGB8, 8, 1);
+    {
+        integration::TSDFIntegrationPipeline pipeline(volume, 2, 2);
+        for (int i = 0; i < num_frames; i++) {
+            pipeline.Push([]() { return CreatePlaneImage(); }, kIntrinsic,
+                          GetExtrinsic(i));
+        }
+        pipeline.Finish();
+        EXPECT_EQ(pipeline.GetNumIntegratedFrames(), num_frames);
+    }
+    EXPECT_EQ(volume.num_integrated_frames_, num_frames);
+    EXPECT_EQ(volume.volume_units_.size(), expected.volume_units_.size());
+    auto mesh = volume.ExtractTriangleMesh();
+    auto expected_mesh = expected.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_EQ(mesh->vertices_, expected_mesh->vertices_);
+    EXPECT_EQ(mesh->vertex_colors_, expected_mesh->vertex_colors_);
+    EXPECT_EQ(mesh->triangles_, expected_mesh->triangles_);
+}
+
+TEST(TSDFIntegrationPipeline, UniformTSDFVolume) {
+    integration::UniformTSDFVolume expected(
+            1.6, 64, 0.05, integration::TSDFVolumeColorType::NoColor,
+            Eigen::Vector3d(-0.8, -0.8, 0.2));
+    integration::UniformTSDFVolume volume(
+            1.6, 64, 0.05, integration::TSDFVolumeColorType::NoColor,
+            Eigen::Vector3d(-0.8, -0.8, 0.2));
+    integration::TSDFIntegrationPipeline pipeline(volume);
+    for (int i = 0; i < 4; i++) {
+        expected.Integrate(*CreatePlaneImage(), kIntrinsic, GetExtrinsic(i));
+        pipeline.Push(CreatePlaneImage(), kIntrinsic, GetExtrinsic(i));
+    }
+    pipeline.Finish();
+    int64_t num_observed = 0;
+    for (int64_t i = 0; i < expected.voxels_.Size(); i++) {
+        num_observed += expected.voxels_.GetWeight(i) > 0.0f ? 1 : 0;
+        ASSERT_EQ(volume.voxels_.GetTSDF(i), expected.voxels_.GetTSDF(i));
+        ASSERT_EQ(volume.voxels_.GetWeight(i), expected.voxels_.GetWeight(i));
+    }
+    EXPECT_GT(num_observed, 0);
+}
+
+TEST(TSDFIntegrationPipeline, BackPressure) {
+    const int max_queued_frames = 2;
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::RGB8, 8, 2);
+    integration::TSDFIntegrationPipeline pipeline(volume, max_queued_frames,
+                                                  4);
+    std::atomic<int> max_ahead(0);
+    for (int i = 0; i < 10; i++) {
+        pipeline.Push(
+                [&, i]() {
+                    // Frames pushed before this one are at most
+                    // max_queued_frames - 1 frames behind.
+                    const int ahead =
+                            i - int(pipeline.GetNumIntegratedFrames());
+                    int previous = max_ahead.load();
+                    while (ahead > previous &&
+                           !max_ahead.compare_exchange_weak(previous, ahead)) {
+                    }
+                    return CreatePlaneImage();
+                },
+                kIntrinsic, GetExtrinsic(i));
+    }
+    pipeline.Finish();
+    EXPECT_LT(max_ahead.load(), max_queued_frames);
+    EXPECT_EQ(pipeline.GetNumIntegratedFrames(), 10);
+}
+
+TEST(TSDFIntegrationPipeline, Errors) {
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::RGB8, 8, 2);
+    integration::TSDFIntegrationPipeline pipeline(volume, 4, 2);
+    pipeline.Push(CreatePlaneImage(), kIntrinsic, GetExtrinsic(0));
+    pipeline.Push([]() -> std::shared_ptr<geometry::RGBDImage> {
+        throw std::runtime_error("Cannot read the frame.");
+    }, kIntrinsic, GetExtrinsic(1));
+    pipeline.Push(CreatePlaneImage(), kIntrinsic, GetExtrinsic(2));
+    EXPECT_THROW(pipeline.Finish(), std::runtime_error);
+    const int64_t num_integrated_frames = pipeline.GetNumIntegratedFrames();
+    EXPECT_LE(num_integrated_frames, 1);
+
+    // Images of the wrong format are reported the same way, and the
+    // pipeline goes on afterwards.
+    auto gray = CreatePlaneImage();
+    gray->color_.Prepare(64, 48, 1, 4);
+    pipeline.Push(gray, kIntrinsic, GetExtrinsic(3));
+    EXPECT_THROW(pipeline.Finish(), std::runtime_error);
+    pipeline.Push(CreatePlaneImage(), kIntrinsic, GetExtrinsic(4));
+    pipeline.Finish();
+    EXPECT_EQ(pipeline.GetNumIntegratedFrames(), num_integrated_frames + 1);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
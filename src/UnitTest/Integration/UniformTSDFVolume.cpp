@@ -94,10 +94,32 @@ TEST(UniformTSDFVolume, Constructor) {
     EXPECT_EQ(tsdf_volume.length_, length);
     EXPECT_EQ(tsdf_volume.resolution_, resolution);
     EXPECT_EQ(tsdf_volume.voxel_num_, resolution * resolution * resolution);
-    EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.voxels_.Size()), tsdf_volume.voxel_num_);
 }
 
-TEST(UniformTSDFVolume, RealData) {
+/// Reads the \p i-th frame of the RGBD test sequence.
+static std::shared_ptr<geometry::RGBDImage> ReadRealDataFrame(size_t i) {
+    // Color
+    geometry::Image im_color;
+    std::ostringstream im_color_path;
+    im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                  << std::setw(5) << i << ".jpg";
+    io::ReadImage(im_color_path.str(), im_color);
+
+    // Depth
+    geometry::Image im_depth;
+    std::ostringstream im_depth_path;
+    im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                  << std::setw(5) << i << ".png";
+    io::ReadImage(im_depth_path.str(), im_depth);
+
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            im_color, im_depth, /*depth_scale*/ 1000.0,
+            /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
+}
+
+/// Integrates the RGBD test sequence into \p tsdf_volume.
+static void IntegrateRealData(integration::TSDFVolume& tsdf_volume) {
     std::string test_data_dir = std::string(TEST_DATA_DIR);
 
     // Poses
@@ -117,33 +139,18 @@ TEST(UniformTSDFVolume, RealData) {
     camera::PinholeCameraIntrinsic intrinsic(
             camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
 
-    // TSDF init
-    integration::UniformTSDFVolume tsdf_volume(
-            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
-
     // Integrate RGBD frames
     for (size_t i = 0; i < poses.size(); ++i) {
-        // Color
-        geometry::Image im_color;
-        std::ostringstream im_color_path;
-        im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
-                      << std::setw(5) << i << ".jpg";
-        io::ReadImage(im_color_path.str(), im_color);
-
-        // Depth
-        geometry::Image im_depth;
-        std::ostringstream im_depth_path;
-        im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
-                      << std::setw(5) << i << ".png";
-        io::ReadImage(im_depth_path.str(), im_depth);
-
-        // Ingegrate
-        std::shared_ptr<geometry::RGBDImage> im_rgbd =
-                geometry::RGBDImage::CreateFromColorAndDepth(
-                        im_color, im_depth, /*depth_scale*/ 1000.0,
-                        /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
+        std::shared_ptr<geometry::RGBDImage> im_rgbd = ReadRealDataFrame(i);
         tsdf_volume.Integrate(*im_rgbd, intrinsic, extrinsics[i]);
     }
+}
+
+TEST(UniformTSDFVolume, RealData) {
+    // TSDF init
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
 
     // These hard-coded values are for unit test only. They are used to make
     // sure that after code refactoring, the numerical values still stay the
@@ -199,15 +206,214 @@ TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
 
-TEST(UniformTSDFVolume, DISABLED_Reset) {}
+TEST(UniformTSDFVolume, Reset) {
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
+    const size_t num_triangles =
+            tsdf_volume.ExtractTriangleMesh()->triangles_.size();
+    EXPECT_GT(num_triangles, 0u);
+
+    tsdf_volume.Reset();
+    EXPECT_EQ(int(tsdf_volume.voxels_.Size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->triangles_.size(), 0u);
+    IntegrateRealData(tsdf_volume);
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->triangles_.size(),
+              num_triangles);
+}
+
+TEST(UniformTSDFVolume, CompactPrecision) {
+    integration::UniformTSDFVolume volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d::Zero(), integration::TSDFVoxelPrecision::Float32);
+    integration::UniformTSDFVolume compact_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d::Zero(), integration::TSDFVoxelPrecision::Compact);
+    const size_t num_voxels = 100 * 100 * 100;
+    EXPECT_EQ(volume.voxels_.GetStorageBytes(), num_voxels * 20);
+    EXPECT_EQ(compact_volume.voxels_.GetStorageBytes(), num_voxels * 7);
+
+    IntegrateRealData(volume);
+    IntegrateRealData(compact_volume);
+    // Rounding moves a few zero crossings, the surface stays the same.
+    const auto mesh = volume.ExtractTriangleMesh();
+    const auto compact_mesh = compact_volume.ExtractTriangleMesh();
+    EXPECT_NEAR(double(compact_mesh->triangles_.size()),
+                double(mesh->triangles_.size()),
+                0.01 * mesh->triangles_.size());
+    ExpectEQ(compact_mesh->GetCenter(), mesh->GetCenter(), 1e-3);
+    Eigen::Vector3d color_sum(0, 0, 0), compact_color_sum(0, 0, 0);
+    for (const Eigen::Vector3d& color : mesh->vertex_colors_) {
+        color_sum += color;
+    }
+    for (const Eigen::Vector3d& color : compact_mesh->vertex_colors_) {
+        compact_color_sum += color;
+    }
+    color_sum /= double(mesh->vertex_colors_.size());
+    compact_color_sum /= double(compact_mesh->vertex_colors_.size());
+    ExpectEQ(compact_color_sum, color_sum, 1e-2);
+}
+
+TEST(UniformTSDFVolume, Raycast) {
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 200, 0.06, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
+    std::vector<Eigen::Matrix4d> poses;
+    ASSERT_TRUE(ReadPoses(std::string(TEST_DATA_DIR) + "/RGBD/odometry.log",
+                          poses));
+    geometry::Image im_depth;
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png",
+                  im_depth);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    // The model seen from the first frame matches its depth.
+    integration::TSDFRaycastResult result =
+            tsdf_volume.Raycast(intrinsic, poses[0].inverse(), 4.0);
+    ASSERT_EQ(result.depth_.width_, intrinsic.width_);
+    ASSERT_EQ(result.color_.num_of_channels_, 3);
+    int num_hits = 0, num_close = 0;
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            const float depth = *result.depth_.PointerAt<float>(u, v);
+            const float measured =
+                    *im_depth.PointerAt<uint16_t>(u, v) / 1000.0f;
+            if (depth == 0.0f || measured == 0.0f) {
+                continue;
+            }
+            num_hits++;
+            num_close += std::abs(depth - measured) < 0.04f;
+            const Eigen::Vector3d normal(
+                    *result.normal_.PointerAt<float>(u, v, 0),
+                    *result.normal_.PointerAt<float>(u, v, 1),
+                    *result.normal_.PointerAt<float>(u, v, 2));
+            EXPECT_NEAR(normal.norm(), 1.0, 1e-4);
+            for (int c = 0; c < 3; c++) {
+                const float color = *result.color_.PointerAt<float>(u, v, c);
+                EXPECT_TRUE(color >= 0.0f && color <= 1.0f);
+            }
+        }
+    }
+    EXPECT_GT(num_hits, intrinsic.width_ * intrinsic.height_ / 2);
+    EXPECT_GT(num_close, num_hits * 9 / 10);
+}
 
 TEST(UniformTSDFVolume, DISABLED_Integrate) {}
 
+TEST(UniformTSDFVolume, IntegrateMultiCamera) {
+    // The frames of the test sequence as the cameras of one multi-camera
+    // frame.
+    std::vector<Eigen::Matrix4d> poses;
+    ASSERT_TRUE(ReadPoses(std::string(TEST_DATA_DIR) + "/RGBD/odometry.log",
+                          poses));
+    ASSERT_GE(poses.size(), 3u);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images;
+    std::vector<integration::TSDFCameraView> views;
+    for (size_t i = 0; i < 3; i++) {
+        images.push_back(ReadRealDataFrame(i));
+        views.emplace_back(*images.back(), intrinsic, poses[i].inverse());
+    }
+
+    // Every camera adds one observation, as with one Integrate() per camera.
+    integration::UniformTSDFVolume volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    integration::UniformTSDFVolume multi_camera_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    for (const auto& view : views) {
+        volume.Integrate(*view.image_, view.intrinsic_, view.extrinsic_);
+    }
+    multi_camera_volume.IntegrateMultiCamera(views);
+    int num_observed = 0;
+    for (int64_t i = 0; i < volume.voxels_.Size(); i++) {
+        ASSERT_EQ(multi_camera_volume.voxels_.GetWeight(i),
+                  volume.voxels_.GetWeight(i));
+        num_observed += volume.voxels_.GetWeight(i) > 1.0f;
+        EXPECT_NEAR(multi_camera_volume.voxels_.GetTSDF(i),
+                    volume.voxels_.GetTSDF(i), 1e-5);
+        ExpectEQ(multi_camera_volume.voxels_.GetColor(i),
+                 volume.voxels_.GetColor(i), 1e-3);
+    }
+    EXPECT_GT(num_observed, 0);
+
+    // With a weight cap, the observations of the frame are weighted 1 each.
+    volume.Reset();
+    volume.max_weight_ = 2.0;
+    volume.IntegrateMultiCamera(views);
+    for (int64_t i = 0; i < volume.voxels_.Size(); i++) {
+        ASSERT_EQ(volume.voxels_.GetWeight(i),
+                  multi_camera_volume.voxels_.GetWeight(i));
+    }
+    volume.IntegrateMultiCamera(views);
+    for (int64_t i = 0; i < volume.voxels_.Size(); i++) {
+        const float weight = multi_camera_volume.voxels_.GetWeight(i);
+        ASSERT_EQ(volume.voxels_.GetWeight(i),
+                  weight + std::max(0.0f, std::min(weight, 2.0f - weight)));
+    }
+}
+
 TEST(UniformTSDFVolume, DISABLED_ExtractPointCloud) {}
 
 TEST(UniformTSDFVolume, DISABLED_ExtractTriangleMesh) {}
 
-TEST(UniformTSDFVolume, DISABLED_ExtractVoxelPointCloud) {}
+TEST(UniformTSDFVolume, ExtractVoxelPointCloud) {
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
+    std::shared_ptr<geometry::PointCloud> voxel_pcd =
+            tsdf_volume.ExtractVoxelPointCloud();
+    EXPECT_EQ(voxel_pcd->points_.size(), 4488u);
+
+    // A tighter TSDF threshold keeps a subset of the voxels, in order.
+    std::shared_ptr<geometry::PointCloud> near_pcd =
+            tsdf_volume.ExtractVoxelPointCloud(0.0f, 0.5f);
+    ASSERT_GT(near_pcd->points_.size(), 0u);
+    EXPECT_LT(near_pcd->points_.size(), voxel_pcd->points_.size());
+    ASSERT_EQ(near_pcd->colors_.size(), near_pcd->points_.size());
+    size_t j = 0;
+    for (size_t i = 0; i < near_pcd->points_.size(); i++) {
+        // The gray level is (tsdf + 1) / 2.
+        EXPECT_LE(std::abs(near_pcd->colors_[i](0) * 2.0 - 1.0), 0.5);
+        while (j < voxel_pcd->points_.size() &&
+               voxel_pcd->points_[j] != near_pcd->points_[i]) {
+            j++;
+        }
+        ASSERT_LT(j, voxel_pcd->points_.size());
+    }
+
+    // So does a weight threshold.
+    EXPECT_LE(tsdf_volume.ExtractVoxelPointCloud(1.0f)->points_.size(),
+              voxel_pcd->points_.size());
+    EXPECT_TRUE(tsdf_volume.ExtractVoxelPointCloud(1e6f)->IsEmpty());
+}
+
+TEST(UniformTSDFVolume, GetDepthToCameraDistanceMultiplier) {
+    integration::UniformTSDFVolume volume(
+            1.0, 16, 0.04, integration::TSDFVolumeColorType::NoColor);
+    const camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5,
+                                                   23.5);
+    auto multiplier = volume.GetDepthToCameraDistanceMultiplier(intrinsic);
+    const auto expected =
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    EXPECT_EQ(multiplier->data_, expected->data_);
+
+    // Computed once for a sequence of frames with the same intrinsic.
+    EXPECT_EQ(volume.GetDepthToCameraDistanceMultiplier(intrinsic), multiplier);
+    const camera::PinholeCameraIntrinsic other(64, 48, 60.0, 60.0, 31.5, 23.5);
+    auto other_multiplier = volume.GetDepthToCameraDistanceMultiplier(other);
+    EXPECT_NE(other_multiplier, multiplier);
+    EXPECT_EQ(other_multiplier->data_,
+              geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                      other)
+                      ->data_);
+
+    // The last few intrinsics stay cached, e.g. those of a camera rig.
+    EXPECT_EQ(volume.GetDepthToCameraDistanceMultiplier(intrinsic), multiplier);
+    EXPECT_EQ(volume.GetDepthToCameraDistanceMultiplier(other),
+              other_multiplier);
+}
 
 TEST(UniformTSDFVolume, DISABLED_IntegrateWithDepthToCameraDistanceMultiplier) {
 }
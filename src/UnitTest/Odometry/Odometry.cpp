@@ -24,6 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <iomanip>
+#include <sstream>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Odometry/Odometry.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +46,194 @@ TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
 
 TEST(Odometry, DISABLED_OdometryOption) { NotImplemented(); }
 
+/// Reads the i-th frame of the RGBD test sequence as intensity and depth.
+static std::shared_ptr<geometry::RGBDImage> ReadRGBDFrame(int i) {
+    geometry::Image color;
+    std::ostringstream color_path;
+    color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+               << std::setw(5) << i << ".jpg";
+    io::ReadImage(color_path.str(), color);
+    geometry::Image depth;
+    std::ostringstream depth_path;
+    depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+               << std::setw(5) << i << ".png";
+    io::ReadImage(depth_path.str(), depth);
+    return geometry::RGBDImage::CreateFromColorAndDepth(color, depth);
+}
+
+TEST(Odometry, RGBDOdometryTracker) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    odometry::RGBDOdometryTracker tracker(intrinsic);
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames;
+    for (int i = 0; i < 3; i++) {
+        frames.push_back(ReadRGBDFrame(i));
+    }
+
+    bool success;
+    Eigen::Matrix4d trans;
+    Eigen::Matrix6d info;
+    std::tie(success, trans, info) = tracker.Track(*frames[0]);
+    EXPECT_FALSE(success);
+    EXPECT_TRUE(tracker.HasPreviousFrame());
+
+    for (size_t i = 1; i < frames.size(); i++) {
+        bool ref_success;
+        Eigen::Matrix4d ref_trans;
+        Eigen::Matrix6d ref_info;
+        std::tie(ref_success, ref_trans, ref_info) =
+                odometry::ComputeRGBDOdometry(*frames[i - 1], *frames[i],
+                                              intrinsic);
+        std::tie(success, trans, info) = tracker.Track(*frames[i]);
+        EXPECT_TRUE(ref_success);
+        EXPECT_TRUE(success);
+        ExpectEQ(ref_trans, trans, 1e-4);
+        EXPECT_NEAR((ref_info - info).norm() / ref_info.norm(), 0.0, 1e-3);
+        EXPECT_EQ(35, tracker.GetStatistics().num_iterations_);
+        EXPECT_GT(tracker.GetStatistics().information_time_, 0.0);
+    }
+
+    // Frames of another size are rejected.
+    geometry::RGBDImage small_frame(*frames[0]->color_.Downsample(),
+                                    *frames[0]->depth_.Downsample());
+    std::tie(success, trans, info) = tracker.Track(small_frame);
+    EXPECT_FALSE(success);
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+}
+
+TEST(Odometry, ComputeRGBDOdometryWithStatistics) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = ReadRGBDFrame(0);
+    auto target = ReadRGBDFrame(1);
+
+    bool ref_success, success;
+    Eigen::Matrix4d ref_trans, trans;
+    Eigen::Matrix6d ref_info, info;
+    odometry::OdometryStatistics statistics;
+    std::tie(ref_success, ref_trans, ref_info) =
+            odometry::ComputeRGBDOdometry(*source, *target, intrinsic);
+    std::tie(success, trans, info, statistics) =
+            odometry::ComputeRGBDOdometryWithStatistics(*source, *target,
+                                                        intrinsic);
+    EXPECT_TRUE(success);
+    ExpectEQ(ref_trans, trans);
+    ExpectEQ(ref_info, info);
+
+    const std::vector<int> iterations = {20, 10, 5};
+    EXPECT_EQ(35, statistics.num_iterations_);
+    EXPECT_EQ(iterations, statistics.num_iterations_per_level_);
+    EXPECT_GT(statistics.preprocessing_time_, 0.0);
+    EXPECT_GT(statistics.correspondence_time_, 0.0);
+    EXPECT_GE(statistics.total_time_,
+              statistics.preprocessing_time_ +
+                      statistics.correspondence_time_ +
+                      statistics.solve_time_ + statistics.information_time_);
+
+    geometry::RGBDImage small_frame(*target->color_.Downsample(),
+                                    *target->depth_.Downsample());
+    std::tie(success, trans, info, statistics) =
+            odometry::ComputeRGBDOdometryWithStatistics(*source, small_frame,
+                                                        intrinsic);
+    EXPECT_FALSE(success);
+    EXPECT_EQ(0, statistics.num_iterations_);
+}
+
+TEST(Odometry, ComputeRGBDOdometryDirectProjection) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = ReadRGBDFrame(0);
+    auto target = ReadRGBDFrame(1);
+
+    odometry::OdometryOption option;
+    odometry::OdometryOption direct_option;
+    direct_option.direct_projection_ = true;
+    for (int term = 0; term < 2; term++) {
+        std::shared_ptr<odometry::RGBDOdometryJacobian> jacobian;
+        if (term == 0) {
+            jacobian = std::make_shared<
+                    odometry::RGBDOdometryJacobianFromColorTerm>();
+        } else {
+            jacobian = std::make_shared<
+                    odometry::RGBDOdometryJacobianFromHybridTerm>();
+        }
+        bool ref_success, success;
+        Eigen::Matrix4d ref_trans, trans;
+        Eigen::Matrix6d ref_info, info;
+        std::tie(ref_success, ref_trans, ref_info) =
+                odometry::ComputeRGBDOdometry(
+                        *source, *target, intrinsic,
+                        Eigen::Matrix4d::Identity(), *jacobian, option);
+        std::tie(success, trans, info) = odometry::ComputeRGBDOdometry(
+                *source, *target, intrinsic, Eigen::Matrix4d::Identity(),
+                *jacobian, direct_option);
+        EXPECT_TRUE(ref_success);
+        EXPECT_TRUE(success);
+        ExpectEQ(ref_trans, trans, 1e-6);
+        ExpectEQ(ref_info, info, 1e-6 * ref_info.norm());
+    }
+}
+
+TEST(Odometry, ComputeRGBDOdometryPixelSelection) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = ReadRGBDFrame(0);
+    auto target = ReadRGBDFrame(1);
+
+    bool ref_success;
+    Eigen::Matrix4d ref_trans;
+    Eigen::Matrix6d ref_info;
+    std::tie(ref_success, ref_trans, ref_info) =
+            odometry::ComputeRGBDOdometry(*source, *target, intrinsic);
+    EXPECT_TRUE(ref_success);
+
+    // About 15% of the pixels of the finest level.
+    using PixelSelection = odometry::OdometryOption::PixelSelection;
+    for (auto selection : {PixelSelection::Uniform, PixelSelection::Gradient}) {
+        odometry::OdometryOption option;
+        option.max_pixels_per_level_ = 640 * 480 * 15 / 100;
+        option.pixel_selection_ = selection;
+        bool success;
+        Eigen::Matrix4d trans;
+        Eigen::Matrix6d info;
+        std::tie(success, trans, info) = odometry::ComputeRGBDOdometry(
+                *source, *target, intrinsic, Eigen::Matrix4d::Identity(),
+                odometry::RGBDOdometryJacobianFromHybridTerm(), option);
+        EXPECT_TRUE(success);
+        ExpectEQ(ref_trans, trans, 1e-2);
+    }
+}
+
+TEST(Odometry, ComputeRGBDOdometryPointToPlane) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = ReadRGBDFrame(0);
+    auto target = ReadRGBDFrame(1);
+
+    bool ref_success;
+    Eigen::Matrix4d ref_trans;
+    Eigen::Matrix6d ref_info;
+    std::tie(ref_success, ref_trans, ref_info) =
+            odometry::ComputeRGBDOdometry(*source, *target, intrinsic);
+    EXPECT_TRUE(ref_success);
+
+    // Depth only and with the color term, close to the hybrid term.
+    for (double lambda_color : {0.0, 0.1}) {
+        bool success;
+        Eigen::Matrix4d trans;
+        Eigen::Matrix6d info;
+        std::tie(success, trans, info) = odometry::ComputeRGBDOdometry(
+                *source, *target, intrinsic, Eigen::Matrix4d::Identity(),
+                odometry::RGBDOdometryJacobianFromPointToPlaneTerm(
+                        lambda_color));
+        EXPECT_TRUE(success);
+        ExpectEQ(ref_trans, trans, 5e-3);
+    }
+}
+
 }  // namespace unit_test
 }  // namespace open3d
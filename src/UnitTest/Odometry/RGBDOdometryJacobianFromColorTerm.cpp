@@ -107,5 +107,71 @@ TEST(RGBDOdometryJacobianFromColorTerm, ComputeJacobianAndResidual) {
     }
 }
 
+TEST(RGBDOdometryJacobianFromColorTerm, ComputeJTJandJTr) {
+    int width = 10;
+    int height = 10;
+
+    auto srcColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto srcDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 0);
+    auto tgtColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 2);
+    auto tgtDepth = GenerateImage(width, height, 1, 4, 1.0f, 2.0f, 3);
+    auto dxColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 4);
+    auto dyColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 5);
+    auto dxDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 6);
+    auto dyDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 7);
+
+    geometry::RGBDImage source(*srcColor, *srcDepth);
+    geometry::RGBDImage target(*tgtColor, *tgtDepth);
+    auto source_xyz = GenerateImage(width, height, 3, 4, 1.0f, 2.0f, 8);
+    geometry::RGBDImage target_dx(*dxColor, *dxDepth);
+    geometry::RGBDImage target_dy(*dyColor, *dyDepth);
+
+    Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Identity();
+    intrinsic(0, 0) = 0.5;
+    intrinsic(1, 1) = 0.65;
+    intrinsic(0, 2) = 0.75;
+    intrinsic(1, 2) = 0.35;
+
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            utility::RotationMatrixZ(0.1) * utility::RotationMatrixX(0.05);
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.05, 0.2);
+
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> corresps(5000);
+    Rand(corresps, 0, 9, 0);
+
+    odometry::RGBDOdometryJacobianFromColorTerm jacobian_method;
+
+    Eigen::Matrix6d ref_JTJ, JTJ;
+    Eigen::Vector6d ref_JTr, JTr;
+    double ref_r2, r2;
+    std::tie(ref_JTJ, ref_JTr, ref_r2) =
+            jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTr(
+                    source, target, *source_xyz, target_dx, target_dy,
+                    intrinsic, extrinsic, corresps);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, *source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic, corresps);
+
+    ExpectEQ(ref_JTJ, JTJ, 1e-6 * ref_JTJ.norm());
+    ExpectEQ(ref_JTr, JTr, 1e-6 * ref_JTr.norm());
+    EXPECT_NEAR(ref_r2, r2, 1e-6 * ref_r2);
+
+    // Without a correspondence set, against the default implementation.
+    double max_depth_diff = 0.5;
+    std::tie(ref_JTJ, ref_JTr, ref_r2) =
+            jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTrDirect(
+                    target, target, *source_xyz, target_dx, target_dy,
+                    intrinsic, extrinsic, max_depth_diff);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTrDirect(
+            target, target, *source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic, max_depth_diff);
+
+    EXPECT_GT(ref_r2, 0.0);
+    ExpectEQ(ref_JTJ, JTJ, 1e-6 * ref_JTJ.norm());
+    ExpectEQ(ref_JTr, JTr, 1e-6 * ref_JTr.norm());
+    EXPECT_NEAR(ref_r2, r2, 1e-6 * ref_r2);
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Odometry/RGBDOdometryJacobian.h"
+#include "TestUtility/UnitTest.h"
+#include "UnitTest/Odometry/OdometryTools.h"
+
+namespace open3d {
+namespace unit_test {
+
+using namespace odometry_tools;
+
+TEST(RGBDOdometryJacobianFromPointToPlaneTerm, ComputeJacobianAndResidual) {
+    int width = 10;
+    int height = 10;
+
+    // The target is the plane z = 2, facing the camera.
+    auto srcColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto srcDepth = GenerateImage(width, height, 1, 4, 1.0f, 2.0f, 0);
+    auto tgtColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 2);
+    auto tgtDepth = GenerateImage(width, height, 1, 4, 2.0f, 2.0f, 0);
+    auto dxColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 3);
+    auto dyColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 4);
+    auto dDepth = GenerateImage(width, height, 1, 4, 0.0f, 0.0f, 0);
+
+    geometry::RGBDImage source(*srcColor, *srcDepth);
+    geometry::RGBDImage target(*tgtColor, *tgtDepth);
+    auto source_xyz = GenerateImage(width, height, 3, 4, 1.0f, 2.0f, 5);
+    geometry::RGBDImage target_dx(*dxColor, *dDepth);
+    geometry::RGBDImage target_dy(*dyColor, *dDepth);
+
+    Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Identity();
+    intrinsic(0, 0) = 0.5;
+    intrinsic(1, 1) = 0.65;
+    intrinsic(0, 2) = 0.75;
+    intrinsic(1, 2) = 0.35;
+
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.05, 0.2);
+
+    int rows = height;
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> corresps(rows);
+    Rand(corresps, 0, 9, 0);
+
+    const Eigen::Vector3d n(0.0, 0.0, -1.0);
+    const float *xyz =
+            reinterpret_cast<const float *>(source_xyz->data_.data());
+    odometry::RGBDOdometryJacobianFromPointToPlaneTerm depth_only;
+    odometry::RGBDOdometryJacobianFromPointToPlaneTerm with_color(0.25);
+    odometry::RGBDOdometryJacobianFromColorTerm color;
+
+    for (int row = 0; row < rows; row++) {
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> J_r;
+        std::vector<double> r;
+        depth_only.ComputeJacobianAndResidual(
+                row, J_r, r, source, target, *source_xyz, target_dx,
+                target_dy, intrinsic, extrinsic, corresps);
+
+        const int s = corresps[row](1) * width + corresps[row](0);
+        const Eigen::Vector3d p =
+                Eigen::Vector3d(xyz[3 * s], xyz[3 * s + 1], xyz[3 * s + 2]) +
+                extrinsic.block<3, 1>(0, 3);
+        Eigen::Vector6d ref_J_r;
+        ref_J_r << p.cross(n), n;
+
+        EXPECT_EQ(1u, r.size());
+        EXPECT_NEAR(2.0 - p(2), r[0], THRESHOLD_1E_6);
+        ExpectEQ(ref_J_r, J_r[0]);
+
+        // The color row is the weighted color term.
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> J_r_color;
+        std::vector<double> r_color;
+        with_color.ComputeJacobianAndResidual(
+                row, J_r, r, source, target, *source_xyz, target_dx,
+                target_dy, intrinsic, extrinsic, corresps);
+        color.ComputeJacobianAndResidual(
+                row, J_r_color, r_color, source, target, *source_xyz,
+                target_dx, target_dy, intrinsic, extrinsic, corresps);
+
+        EXPECT_EQ(2u, r.size());
+        EXPECT_NEAR(2.0 - p(2), r[0], THRESHOLD_1E_6);
+        EXPECT_NEAR(0.5 * r_color[0], r[1], THRESHOLD_1E_6);
+        ExpectEQ(ref_J_r, J_r[0]);
+        ExpectEQ((0.5 * J_r_color[0]).eval(), J_r[1]);
+    }
+}
+
+TEST(RGBDOdometryJacobianFromPointToPlaneTerm, ComputeJTJandJTr) {
+    int width = 10;
+    int height = 10;
+
+    auto srcColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 1);
+    auto srcDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 0);
+    auto tgtColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 2);
+    auto tgtDepth = GenerateImage(width, height, 1, 4, 1.0f, 2.0f, 3);
+    auto dxColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 4);
+    auto dyColor = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 5);
+    auto dxDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 6);
+    auto dyDepth = GenerateImage(width, height, 1, 4, 0.0f, 1.0f, 7);
+
+    geometry::RGBDImage source(*srcColor, *srcDepth);
+    geometry::RGBDImage target(*tgtColor, *tgtDepth);
+    auto source_xyz = GenerateImage(width, height, 3, 4, 1.0f, 2.0f, 8);
+    geometry::RGBDImage target_dx(*dxColor, *dxDepth);
+    geometry::RGBDImage target_dy(*dyColor, *dyDepth);
+
+    Eigen::Matrix3d intrinsic = Eigen::Matrix3d::Identity();
+    intrinsic(0, 0) = 0.5;
+    intrinsic(1, 1) = 0.65;
+    intrinsic(0, 2) = 0.75;
+    intrinsic(1, 2) = 0.35;
+
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            utility::RotationMatrixZ(0.1) * utility::RotationMatrixX(0.05);
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.05, 0.2);
+
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> corresps(5000);
+    Rand(corresps, 0, 9, 0);
+
+    for (double lambda_color : {0.0, 0.1}) {
+        odometry::RGBDOdometryJacobianFromPointToPlaneTerm jacobian_method(
+                lambda_color);
+
+        Eigen::Matrix6d ref_JTJ, JTJ;
+        Eigen::Vector6d ref_JTr, JTr;
+        double ref_r2, r2;
+        std::tie(ref_JTJ, ref_JTr, ref_r2) =
+                jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTr(
+                        source, target, *source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, corresps);
+        std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+                source, target, *source_xyz, target_dx, target_dy,
+                intrinsic, extrinsic, corresps);
+
+        EXPECT_GT(ref_r2, 0.0);
+        ExpectEQ(ref_JTJ, JTJ, 1e-6 * ref_JTJ.norm());
+        ExpectEQ(ref_JTr, JTr, 1e-6 * ref_JTr.norm());
+        EXPECT_NEAR(ref_r2, r2, 1e-6 * ref_r2);
+
+        // Without a correspondence set, against the default implementation.
+        double max_depth_diff = 0.5;
+        std::tie(ref_JTJ, ref_JTr, ref_r2) =
+                jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTrDirect(
+                        target, target, *source_xyz, target_dx, target_dy,
+                        intrinsic, extrinsic, max_depth_diff);
+        std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTrDirect(
+                target, target, *source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic, max_depth_diff);
+
+        EXPECT_GT(ref_r2, 0.0);
+        ExpectEQ(ref_JTJ, JTJ, 1e-6 * ref_JTJ.norm());
+        ExpectEQ(ref_JTr, JTr, 1e-6 * ref_JTr.norm());
+        EXPECT_NEAR(ref_r2, r2, 1e-6 * ref_r2);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
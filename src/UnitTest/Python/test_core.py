@@ -322,6 +322,62 @@ def test_tensor_numpy_to_open3d_to_pytorch():
     np.testing.assert_equal(r, c.cpu().numpy())
 
 
+def test_tensor_numpy_buffer_protocol():
+    # from_numpy keeps the numpy array alive.
+    b = o3d.Tensor.from_numpy(np.arange(6, dtype=np.float32).reshape((2, 3)))
+    np.testing.assert_equal(b.numpy(), np.arange(6).reshape((2, 3)))
+
+    # np.asarray shares memory with the tensor via the buffer protocol.
+    c = np.asarray(b)
+    c[1, 2] = 100
+    np.testing.assert_equal(b.numpy()[1, 2], 100)
+
+    # Special strides
+    d = np.asarray(b[:, 1:3:2])
+    np.testing.assert_equal(d, np.array([[1], [4]]))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensor_dlpack_protocol(device):
+    o3_t = o3d.Tensor(np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32),
+                      device=device)
+    device_type = 2 if device.get_type() == o3d.Device.DeviceType.CUDA else 1
+    assert o3_t.__dlpack_device__() == (device_type, device.get_id())
+
+    if not _torch_imported or not hasattr(torch, "from_dlpack"):
+        return
+
+    # Open3D -> PyTorch -> Open3D all share the same memory
+    th_t = torch.from_dlpack(o3_t)
+    o3_t2 = o3d.Tensor.from_dlpack(th_t)
+    th_t[0, 0] = 100
+    torch.from_dlpack(o3_t2)[1, 2] = 200
+    r = np.array([[100, 2, 3], [4, 5, 200]])
+    np.testing.assert_equal(r, o3_t.cpu().numpy())
+    np.testing.assert_equal(r, th_t.cpu().numpy())
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensor_cuda_array_interface(device):
+    o3_t = o3d.Tensor(np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int64),
+                      device=device)
+    if device.get_type() != o3d.Device.DeviceType.CUDA:
+        assert not hasattr(o3_t, "__cuda_array_interface__")
+        return
+
+    cai = o3_t.__cuda_array_interface__
+    assert cai["shape"] == (2, 3)
+    assert cai["strides"] == (24, 8)
+    assert cai["typestr"] == "<i8"
+    assert cai["version"] == 3
+
+    # Zero-copy round trip, also for non-contiguous tensors.
+    o3_t2 = o3d.Tensor.from_cuda_array_interface(o3_t[:, ::2])
+    o3_t2[1, 1] = o3d.Tensor(np.array(100), device=device)
+    r = np.array([[1, 2, 3], [4, 5, 100]])
+    np.testing.assert_equal(r, o3_t.cpu().numpy())
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_binary_ew_ops(device):
     a = o3d.Tensor(np.array([4, 6, 8, 10, 12, 14]), device=device)
@@ -667,6 +723,59 @@ def test_reduction_argmin_argmax(dim, device):
     np.testing.assert_allclose(o3_dst.cpu().numpy(), np_dst)
 
 
+@pytest.mark.parametrize(
+    "dim",
+    [0, 1, 2, (), (0,), (1,), (2,), (0, 1), (0, 2), (1, 2), (0, 1, 2), None])
+@pytest.mark.parametrize("keepdim", [True, False])
+@pytest.mark.parametrize("device", list_devices())
+def test_reduction_min_max_mean_var(dim, keepdim, device):
+    np_src = np.array(range(24))
+    np.random.shuffle(np_src)
+    np_src = np_src.reshape((2, 3, 4)).astype(np.float32)
+    o3_src = o3d.Tensor(np_src, device=device)
+
+    o3_min, o3_max = o3_src.min_max(dim=dim, keepdim=keepdim)
+    np.testing.assert_allclose(o3_min.cpu().numpy(),
+                               np_src.min(axis=dim, keepdims=keepdim))
+    np.testing.assert_allclose(o3_max.cpu().numpy(),
+                               np_src.max(axis=dim, keepdims=keepdim))
+
+    o3_mean, o3_var = o3_src.mean_var(dim=dim, keepdim=keepdim)
+    np.testing.assert_allclose(o3_mean.cpu().numpy(),
+                               np_src.mean(axis=dim, keepdims=keepdim),
+                               rtol=1e-5)
+    np.testing.assert_allclose(o3_var.cpu().numpy(),
+                               np_src.var(axis=dim, keepdims=keepdim),
+                               rtol=1e-5)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_sort_unique_cumsum(device):
+    np_src = np.array([3, -1, 2, 3, 0, -1, 3, 7], dtype=np.int64)
+    o3_src = o3d.Tensor(np_src, device=device)
+
+    np.testing.assert_equal(o3_src.argsort().cpu().numpy(),
+                            np.argsort(np_src, kind="stable"))
+    np.testing.assert_equal(o3_src.sort().cpu().numpy(), np.sort(np_src))
+
+    np_values, np_inverse, np_counts = np.unique(np_src,
+                                                 return_inverse=True,
+                                                 return_counts=True)
+    o3_values, o3_inverse, o3_counts = o3_src.unique()
+    np.testing.assert_equal(o3_values.cpu().numpy(), np_values)
+    np.testing.assert_equal(o3_inverse.cpu().numpy(), np_inverse)
+    np.testing.assert_equal(o3_counts.cpu().numpy(), np_counts)
+
+    np_src = np.array(range(24)).reshape((2, 3, 4)).astype(np.float32)
+    o3_src = o3d.Tensor(np_src, device=device)
+    for dim in range(3):
+        np.testing.assert_allclose(
+            o3_src.cumsum(dim).cpu().numpy(), np.cumsum(np_src, axis=dim))
+        np.testing.assert_allclose(
+            o3_src.cumsum(dim, exclusive=True).cpu().numpy(),
+            np.cumsum(np_src, axis=dim) - np_src)
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_advanced_index_get_mixed(device):
     np_src = np.array(range(24)).reshape((2, 3, 4))
@@ -944,3 +1053,81 @@ def test_scalar_op(device):
     np.testing.assert_equal(a.cpu().numpy(), np.full((2, 3), 2.5))
     a /= True
     np.testing.assert_equal(a.cpu().numpy(), np.full((2, 3), 2.5))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_memory_manager_statistics(device):
+    mm = o3d.memory_manager
+    mm.reset_statistics(device)
+    stats = mm.get_statistics(device)
+    a = o3d.Tensor.ones((256,), o3d.Dtype.Float32, device=device)
+    stats_alloc = mm.get_statistics(device)
+    assert stats_alloc.num_allocations == 1
+    assert stats_alloc.bytes_in_use == stats.bytes_in_use + 1024
+    assert stats_alloc.peak_bytes_in_use >= stats_alloc.bytes_in_use
+    assert stats_alloc.size_histogram[11] == 1
+    del a
+    stats_free = mm.get_statistics(device)
+    assert stats_free.num_frees == 1
+    assert stats_free.bytes_in_use == stats.bytes_in_use
+
+    mm.set_site_tracking_enabled(True)
+    with mm.AllocationSite("outer"):
+        with mm.AllocationSite("inner"):
+            a = o3d.Tensor.ones((8,), o3d.Dtype.Float32, device=device)
+    mm.set_site_tracking_enabled(False)
+    sites = [record.site for record in mm.get_live_allocations(device)]
+    assert "outer/inner" in sites
+    del a
+    sites = [record.site for record in mm.get_live_allocations(device)]
+    assert "outer/inner" not in sites
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensor_out_variants(device):
+    a = o3d.Tensor(np.array([[0, 1, 2], [3, 4, 5]], dtype=np.float32),
+                   device=device)
+    b = o3d.Tensor(np.array([1, 1, 1], dtype=np.float32), device=device)
+
+    out = o3d.Tensor.empty((2, 3), o3d.Dtype.Float32, device)
+    c = a.add(b, out=out)
+    np.testing.assert_equal(out.cpu().numpy(),
+                            np.array([[1, 2, 3], [4, 5, 6]]))
+    np.testing.assert_equal(c.cpu().numpy(), out.cpu().numpy())
+    a.mul(2, out=out)
+    np.testing.assert_equal(out.cpu().numpy(),
+                            np.array([[0, 2, 4], [6, 8, 10]]))
+
+    mask = o3d.Tensor.empty((2, 3), o3d.Dtype.Bool, device)
+    a.gt(b, out=mask)
+    np.testing.assert_equal(mask.cpu().numpy(), a.cpu().numpy() > 1)
+
+    out_sum = o3d.Tensor.empty((3,), o3d.Dtype.Float32, device)
+    a.sum(dim=0, out=out_sum)
+    np.testing.assert_equal(out_sum.cpu().numpy(), np.array([3, 5, 7]))
+    out_argmax = o3d.Tensor.empty((2,), o3d.Dtype.Int64, device)
+    a.argmax(dim=1, out=out_argmax)
+    np.testing.assert_equal(out_argmax.cpu().numpy(), np.array([2, 2]))
+
+    out_int = o3d.Tensor.empty((2, 3), o3d.Dtype.Int32, device)
+    a.to(o3d.Dtype.Int32, out=out_int)
+    np.testing.assert_equal(out_int.cpu().numpy(),
+                            np.array([[0, 1, 2], [3, 4, 5]]))
+
+    with pytest.raises(RuntimeError):
+        a.add(b, out=out_sum)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_tensor_shard(device):
+    np_t = np.arange(10, dtype=np.float32).reshape((5, 2))
+    o3_t = o3d.Tensor(np_t, device=device)
+    shards = o3_t.shard([device, o3d.Device("CPU:0")])
+    assert len(shards) == 2
+    np.testing.assert_equal(shards[0].cpu().numpy(), np_t[:3])
+    np.testing.assert_equal(shards[1].numpy(), np_t[3:])
+    gathered = o3d.Tensor.from_shards(shards, device)
+    np.testing.assert_equal(gathered.cpu().numpy(), np_t)
+
+    shards = o3_t.shard([device, device], sizes=[1, 4])
+    np.testing.assert_equal(shards[0].cpu().numpy(), np_t[:1])
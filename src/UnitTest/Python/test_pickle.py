@@ -0,0 +1,111 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import pickle
+import pytest
+
+
+def _random_point_cloud():
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(np.random.rand(100, 3))
+    pcd.normals = o3d.utility.Vector3dVector(np.random.rand(100, 3))
+    pcd.colors = o3d.utility.Vector3dVector(np.random.rand(100, 3))
+    return pcd
+
+
+@pytest.mark.parametrize("protocol", [2, pickle.HIGHEST_PROTOCOL])
+def test_pickle_point_cloud(protocol):
+    pcd = _random_point_cloud()
+    result = pickle.loads(pickle.dumps(pcd, protocol=protocol))
+    np.testing.assert_equal(np.asarray(result.points), np.asarray(pcd.points))
+    np.testing.assert_equal(np.asarray(result.normals),
+                            np.asarray(pcd.normals))
+    np.testing.assert_equal(np.asarray(result.colors), np.asarray(pcd.colors))
+    assert not result.has_covariances()
+
+
+def test_pickle_triangle_mesh():
+    mesh = o3d.geometry.TriangleMesh.create_box()
+    mesh.compute_vertex_normals()
+    result = pickle.loads(pickle.dumps(mesh))
+    np.testing.assert_equal(np.asarray(result.vertices),
+                            np.asarray(mesh.vertices))
+    np.testing.assert_equal(np.asarray(result.vertex_normals),
+                            np.asarray(mesh.vertex_normals))
+    np.testing.assert_equal(np.asarray(result.triangles),
+                            np.asarray(mesh.triangles))
+
+
+def test_pickle_image():
+    color = o3d.geometry.Image(
+        np.random.randint(0, 255, (48, 64, 3), dtype=np.uint8))
+    depth = o3d.geometry.Image(np.random.rand(48, 64).astype(np.float32))
+    result = pickle.loads(pickle.dumps(color))
+    np.testing.assert_equal(np.asarray(result), np.asarray(color))
+
+    rgbd = o3d.geometry.RGBDImage()
+    rgbd.color = color
+    rgbd.depth = depth
+    result = pickle.loads(pickle.dumps(rgbd))
+    np.testing.assert_equal(np.asarray(result.color), np.asarray(color))
+    np.testing.assert_equal(np.asarray(result.depth), np.asarray(depth))
+
+
+def test_pickle_pose_graph():
+    pose_graph = o3d.registration.PoseGraph()
+    pose = np.eye(4)
+    pose[:3, 3] = [1, 2, 3]
+    pose_graph.nodes.append(o3d.registration.PoseGraphNode(np.eye(4)))
+    pose_graph.nodes.append(o3d.registration.PoseGraphNode(pose))
+    pose_graph.edges.append(
+        o3d.registration.PoseGraphEdge(0, 1, pose, 2 * np.eye(6), True, 0.5))
+    result = pickle.loads(pickle.dumps(pose_graph))
+    assert len(result.nodes) == 2
+    np.testing.assert_equal(result.nodes[1].pose, pose)
+    edge = result.edges[0]
+    assert (edge.source_node_id, edge.target_node_id) == (0, 1)
+    np.testing.assert_equal(edge.transformation, pose)
+    np.testing.assert_equal(edge.information, 2 * np.eye(6))
+    assert edge.uncertain
+    assert edge.confidence == 0.5
+
+
+def test_pickle_feature():
+    feature = o3d.registration.compute_fpfh_feature(
+        _random_point_cloud(), o3d.geometry.KDTreeSearchParamKNN(10))
+    result = pickle.loads(pickle.dumps(feature))
+    np.testing.assert_equal(result.data, feature.data)
+
+
+def test_shared_object():
+    from open3d.shared_memory import SharedObject
+    pcd = _random_point_cloud()
+    shared = SharedObject(pcd)
+    result = pickle.loads(pickle.dumps(shared)).load()
+    np.testing.assert_equal(np.asarray(result.points), np.asarray(pcd.points))
+    shared.unlink()
@@ -52,3 +52,111 @@ def test_execute_tf_op():
     ans = ml3d.ops.reduce_subarrays_sum(values, prefix_sum)
     # test was a success if we reach this line but check correctness anyway
     assert np.all(ans.numpy() == [3, 3, 0, 39])
+
+
+def test_execute_tf_op_gpu():
+
+    if not o3d._build_config['BUILD_TENSORFLOW_OPS']:
+        return
+
+    import tensorflow as tf
+    import open3d.ml.tf as ml3d
+
+    if not tf.config.list_physical_devices('GPU'):
+        return
+
+    values = np.arange(0, 10, dtype=np.float32)
+    prefix_sum = np.array([0, 3, 4, 4])
+
+    with tf.device('/GPU:0'):
+        ans = ml3d.ops.reduce_subarrays_sum(values, prefix_sum)
+    assert 'GPU' in ans.device
+    assert np.all(ans.numpy() == [3, 3, 0, 39])
+
+
+def test_fixed_radius_search():
+
+    if not o3d._build_config['BUILD_TENSORFLOW_OPS']:
+        return
+
+    import open3d.ml.tf as ml3d
+
+    rng = np.random.RandomState(123)
+    points = rng.rand(100, 3).astype(np.float32)
+    queries = rng.rand(20, 3).astype(np.float32)
+    radius = 0.2
+
+    ans = ml3d.ops.fixed_radius_search(points,
+                                       queries,
+                                       radius,
+                                       return_distances=True)
+    index = ans.neighbors_index.numpy()
+    row_splits = ans.neighbors_row_splits.numpy()
+    distance = ans.neighbors_distance.numpy()
+    assert row_splits.shape == (21,)
+
+    for i, q in enumerate(queries):
+        dist = np.sum((points - q)**2, axis=1)
+        expected = np.flatnonzero(dist <= radius**2)
+        neighbors = index[row_splits[i]:row_splits[i + 1]]
+        assert np.all(np.sort(neighbors) == expected)
+        np.testing.assert_allclose(distance[row_splits[i]:row_splits[i + 1]],
+                                   dist[neighbors],
+                                   rtol=1e-5)
+
+
+def test_knn_search():
+
+    if not o3d._build_config['BUILD_TENSORFLOW_OPS']:
+        return
+
+    import open3d.ml.tf as ml3d
+
+    rng = np.random.RandomState(123)
+    points = rng.rand(100, 3)
+    queries = rng.rand(20, 3)
+    k = 5
+
+    ans = ml3d.ops.knn_search(points, queries, k, return_distances=True)
+    index = ans.neighbors_index.numpy()
+    row_splits = ans.neighbors_row_splits.numpy()
+    distance = ans.neighbors_distance.numpy()
+    assert np.all(row_splits == np.arange(0, 21 * k, k))
+
+    for i, q in enumerate(queries):
+        dist = np.sum((points - q)**2, axis=1)
+        np.testing.assert_allclose(distance[i * k:(i + 1) * k],
+                                   np.sort(dist)[:k])
+        np.testing.assert_allclose(dist[index[i * k:(i + 1) * k]],
+                                   np.sort(dist)[:k])
+
+
+def test_voxel_pooling():
+
+    if not o3d._build_config['BUILD_TENSORFLOW_OPS']:
+        return
+
+    import open3d.ml.tf as ml3d
+
+    positions = np.array([[0.1, 0.1, 0.1], [0.3, 0.3, 0.3], [1.2, 0.1, 0.1]],
+                         dtype=np.float32)
+    features = np.array([[1, 6], [3, 2], [5, 5]], dtype=np.float32)
+
+    ans = ml3d.ops.voxel_pooling(positions,
+                                 features,
+                                 1.0,
+                                 position_fn='average',
+                                 feature_fn='max')
+    np.testing.assert_allclose(ans.pooled_positions.numpy(),
+                               [[0.2, 0.2, 0.2], [1.2, 0.1, 0.1]],
+                               rtol=1e-6)
+    np.testing.assert_allclose(ans.pooled_features.numpy(), [[3, 6], [5, 5]])
+
+    ans = ml3d.ops.voxel_pooling(positions,
+                                 features,
+                                 1.0,
+                                 position_fn='center',
+                                 feature_fn='average')
+    np.testing.assert_allclose(ans.pooled_positions.numpy(),
+                               [[0.5, 0.5, 0.5], [1.5, 0.5, 0.5]])
+    np.testing.assert_allclose(ans.pooled_features.numpy(), [[2, 4], [5, 5]])
@@ -24,12 +24,54 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/ColoredICP.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Registration/RegistrationTarget.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
-TEST(ColoredICP, DISABLED_RegistrationColoredICP) { NotImplemented(); }
+TEST(ColoredICP, RegistrationColoredICP) {
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    box->ComputeVertexNormals();
+    auto target = box->SamplePointsUniformly(5000);
+    for (const auto &point : target->points_) {
+        const double intensity = 0.5 + 0.5 * std::sin(4.0 * point.sum());
+        target->colors_.push_back(Eigen::Vector3d::Constant(intensity));
+    }
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(3.0, 1.0, 2.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(-0.02, 0.01, 0.03);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+
+    const registration::ICPConvergenceCriteria criteria(1e-8, 1e-8, 50);
+    const registration::RegistrationTarget prepared(*target, 0.1);
+    for (auto kernel :
+         std::vector<std::shared_ptr<registration::RobustKernel>>{
+                 std::make_shared<registration::L2Loss>(),
+                 std::make_shared<registration::HuberLoss>(0.01)}) {
+        auto result = registration::RegistrationColoredICP(
+                source, prepared, 0.05, Eigen::Matrix4d::Identity(), criteria,
+                0.968, kernel);
+        EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+        EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+
+        // The sums are reduced in a fixed order, so the result is repeatable.
+        auto repeated = registration::RegistrationColoredICP(
+                source, prepared, 0.05, Eigen::Matrix4d::Identity(), criteria,
+                0.968, kernel);
+        ExpectEQ(result.transformation_, repeated.transformation_, 0.0);
+        EXPECT_EQ(result.inlier_rmse_, repeated.inlier_rmse_);
+    }
+}
 
 TEST(ColoredICP, DISABLED_ICPConvergenceCriteria) { NotImplemented(); }
 
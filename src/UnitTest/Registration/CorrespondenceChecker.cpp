@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/CorrespondenceChecker.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -35,18 +40,111 @@ TEST(CorrespondenceChecker, DISABLED_Destructor) { NotImplemented(); }
 
 TEST(CorrespondenceChecker, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(CorrespondenceChecker, DISABLED_Check) { NotImplemented(); }
+// Source and target related by a rigid transformation, and hypotheses of
+// four correspondences of which some are wrong.
+static void CreateHypotheses(
+        geometry::PointCloud &source,
+        geometry::PointCloud &target,
+        std::vector<registration::CorrespondenceSet> &corres,
+        std::vector<Eigen::Matrix4d_u> &transformations) {
+    const int num_points = 100;
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+                    .matrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.2, 0.3);
+    source.points_.resize(num_points);
+    Rand(source.points_, Zero3d, Eigen::Vector3d(1, 1, 1), 0);
+    source.normals_.resize(num_points);
+    Rand(source.normals_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         1);
+    for (auto &normal : source.normals_) {
+        normal.normalize();
+    }
+    target = source;
+    target.Transform(transformation);
+
+    std::vector<int> indices(4 * 64);
+    Rand(indices, 0, num_points - 1, 2);
+    for (size_t i = 0; i < indices.size() / 4; i++) {
+        registration::CorrespondenceSet hypothesis;
+        for (int j = 0; j < 4; j++) {
+            const int k = indices[i * 4 + j];
+            // Every third hypothesis has a wrong correspondence.
+            const int l = (i % 3 == 0 && j == 0) ? (k + 1) % num_points : k;
+            hypothesis.push_back(Eigen::Vector2i(k, l));
+        }
+        corres.push_back(hypothesis);
+        transformations.push_back(transformation);
+    }
+}
+
+static void ExpectCheckBatchEQ(
+        const registration::CorrespondenceChecker &checker) {
+    geometry::PointCloud source, target;
+    std::vector<registration::CorrespondenceSet> corres;
+    std::vector<Eigen::Matrix4d_u> transformations;
+    CreateHypotheses(source, target, corres, transformations);
 
-TEST(CorrespondenceChecker, DISABLED_CorrespondenceCheckerBasedOnEdgeLength) {
-    NotImplemented();
+    // Hypotheses marked invalid stay invalid and are not checked.
+    std::vector<uint8_t> valid(corres.size(), 1);
+    valid[1] = 0;
+    checker.CheckBatch(source, target, corres, transformations, valid);
+    int num_rejected = 0;
+    for (size_t i = 0; i < corres.size(); i++) {
+        const bool check = i != 1 && checker.Check(source, target, corres[i],
+                                                   transformations[i]);
+        EXPECT_EQ(check, valid[i] != 0);
+        num_rejected += i != 1 && !check;
+    }
+    EXPECT_GT(num_rejected, 0);
+    EXPECT_LT(num_rejected, int(corres.size()) - 1);
 }
 
-TEST(CorrespondenceChecker, DISABLED_CorrespondenceCheckerBasedOnDistance) {
-    NotImplemented();
+TEST(CorrespondenceChecker, CorrespondenceCheckerBasedOnEdgeLength) {
+    ExpectCheckBatchEQ(
+            registration::CorrespondenceCheckerBasedOnEdgeLength(0.9));
 }
 
-TEST(CorrespondenceChecker, DISABLED_CorrespondenceCheckerBasedOnNormal) {
-    NotImplemented();
+TEST(CorrespondenceChecker, CorrespondenceCheckerBasedOnDistance) {
+    ExpectCheckBatchEQ(registration::CorrespondenceCheckerBasedOnDistance(0.1));
+}
+
+TEST(CorrespondenceChecker, CorrespondenceCheckerBasedOnNormal) {
+    ExpectCheckBatchEQ(registration::CorrespondenceCheckerBasedOnNormal(0.5));
+}
+
+TEST(CorrespondenceChecker, CorrespondenceCheckerSchedule) {
+    geometry::PointCloud source, target;
+    std::vector<registration::CorrespondenceSet> corres;
+    std::vector<Eigen::Matrix4d_u> transformations;
+    CreateHypotheses(source, target, corres, transformations);
+
+    // Starts with the cheapest checkers, and after one batch runs the one that
+    // rejects most hypotheses first and the one that rejects none last.
+    const registration::CorrespondenceCheckerBasedOnEdgeLength edge_length(
+            0.9);
+    const registration::CorrespondenceCheckerBasedOnDistance loose(10.0);
+    const registration::CorrespondenceCheckerBasedOnDistance tight(1e-3);
+    registration::CorrespondenceCheckerSchedule schedule(
+            {edge_length, loose, tight}, 4);
+    auto checkers = schedule.GetCheckers();
+    ASSERT_EQ(checkers.size(), 3u);
+    EXPECT_EQ(&checkers[0].get(), &loose);
+    EXPECT_EQ(&checkers[1].get(), &tight);
+    EXPECT_EQ(&checkers[2].get(), &edge_length);
+
+    // The edge length checker requires no alignment, so it is skipped.
+    std::vector<uint8_t> valid(corres.size(), 1);
+    schedule.CheckBatch(source, target, corres, transformations, valid, true);
+    checkers = schedule.GetCheckers();
+    EXPECT_EQ(&checkers[0].get(), &tight);
+    EXPECT_EQ(&checkers[1].get(), &edge_length);
+    EXPECT_EQ(&checkers[2].get(), &loose);
+    for (size_t i = 0; i < corres.size(); i++) {
+        EXPECT_EQ(valid[i] != 0, tight.Check(source, target, corres[i],
+                                             transformations[i]));
+    }
 }
 
 }  // namespace unit_test
@@ -24,11 +24,107 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/FastGlobalRegistration.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
+namespace {
+
+// Random points with a distinct random feature per point, and the same
+// points moved by a rigid transformation with the same features.
+void CreateFeatureCloudPair(const Eigen::Matrix4d &transformation,
+                            geometry::PointCloud &source,
+                            geometry::PointCloud &target,
+                            registration::Feature &feature,
+                            bool use_float) {
+    const int size = 500;
+    const int dim = 33;
+    source.points_.resize(size);
+    Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    target = source;
+    target.Transform(transformation);
+    feature.Resize(dim, size);
+    feature.data_ = Eigen::MatrixXd::Random(dim, size);
+    if (use_float) {
+        feature.ConvertToFloat();
+    }
+}
+
+}  // unnamed namespace
+
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.7, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.5);
+
+    for (bool use_float : {false, true}) {
+        geometry::PointCloud source, target;
+        registration::Feature feature;
+        CreateFeatureCloudPair(transformation, source, target, feature,
+                               use_float);
+
+        auto result = registration::FastGlobalRegistration(
+                source, target, feature, feature);
+        ExpectEQ(transformation, Eigen::Matrix4d(result.transformation_), 1e-4);
+        EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+        const registration::FastGlobalRegistrationOption option;
+        EXPECT_EQ(option.iteration_number_,
+                  result.statistics_.num_iterations_);
+        EXPECT_EQ(registration::RegistrationStopReason::MaxIteration,
+                  result.statistics_.stop_reason_);
+        EXPECT_GE(result.statistics_.total_time_,
+                  result.statistics_.correspondence_time_ +
+                          result.statistics_.solve_time_);
+    }
+}
+
+TEST(FastGlobalRegistration, FastGlobalRegistrationManyTargets) {
+    geometry::PointCloud source, target;
+    registration::Feature source_feature;
+    CreateFeatureCloudPair(Eigen::Matrix4d::Identity(), source, target,
+                           source_feature, false);
+
+    std::vector<std::shared_ptr<geometry::PointCloud>> targets;
+    std::vector<std::shared_ptr<registration::Feature>> target_features;
+    std::vector<Eigen::Matrix4d> transformations;
+    for (int k = 0; k < 3; k++) {
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        transformation.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.3 * (k + 1), Eigen::Vector3d::UnitZ())
+                        .toRotationMatrix();
+        transformation(0, 3) = 0.1 * k;
+        auto target = std::make_shared<geometry::PointCloud>(source);
+        target->Transform(transformation);
+        targets.push_back(target);
+        target_features.push_back(
+                std::make_shared<registration::Feature>(source_feature));
+        transformations.push_back(transformation);
+    }
+
+    auto results = registration::FastGlobalRegistration(
+            source, targets, source_feature, target_features);
+    ASSERT_EQ(targets.size(), results.size());
+    for (size_t k = 0; k < targets.size(); k++) {
+        ExpectEQ(transformations[k],
+                 Eigen::Matrix4d(results[k].transformation_), 1e-4);
+    }
+
+    target_features.pop_back();
+    EXPECT_ANY_THROW(registration::FastGlobalRegistration(
+            source, targets, source_feature, target_features));
+}
+
 TEST(FastGlobalRegistration, DISABLED_FastGlobalRegistrationOption) {
     NotImplemented();
 }
@@ -24,12 +24,45 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/Feature.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "Open3D/Geometry/NeighborGraph.h"
+#include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
 namespace unit_test {
 
-TEST(Feature, DISABLED_Resize) { NotImplemented(); }
+TEST(Feature, Resize) {
+    registration::Feature feature;
+    feature.Resize(33, 10);
+    EXPECT_FALSE(feature.IsFloat());
+    EXPECT_EQ(33u, feature.Dimension());
+    EXPECT_EQ(10u, feature.Num());
+    EXPECT_EQ(0.0, feature.data_.norm());
+
+    feature.Resize(33, 20, true);
+    EXPECT_TRUE(feature.IsFloat());
+    EXPECT_EQ(33u, feature.Dimension());
+    EXPECT_EQ(20u, feature.Num());
+    EXPECT_EQ(0, feature.data_.size());
+    EXPECT_EQ(0.0f, feature.data_float_.norm());
+
+    feature.data_float_.setRandom();
+    const Eigen::MatrixXf data = feature.data_float_;
+    feature.ConvertToDouble();
+    EXPECT_FALSE(feature.IsFloat());
+    EXPECT_EQ(0, feature.data_float_.size());
+    EXPECT_TRUE(feature.data_.isApprox(data.cast<double>()));
+    feature.ConvertToFloat();
+    EXPECT_TRUE(feature.IsFloat());
+    EXPECT_EQ(0, feature.data_.size());
+    EXPECT_TRUE(feature.data_float_.isApprox(data));
+}
 
 TEST(Feature, DISABLED_Dimension) { NotImplemented(); }
 
@@ -37,6 +70,137 @@ TEST(Feature, DISABLED_Num) { NotImplemented(); }
 
 TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
 
+TEST(Feature, ComputeFPFHFeatureFromNeighborGraph) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    const geometry::KDTreeSearchParamRadius param(1.5);
+    pc.EstimateNormals(param);
+    auto graph = geometry::NeighborGraph::CreateFromPointCloud(pc, param);
+
+    auto ref = registration::ComputeFPFHFeature(pc, param);
+    auto result = registration::ComputeFPFHFeature(pc, *graph);
+    ASSERT_EQ(ref->Dimension(), result->Dimension());
+    ASSERT_EQ(ref->Num(), result->Num());
+    EXPECT_TRUE(ref->data_.isApprox(result->data_, 1e-4));
+
+    geometry::NeighborGraph empty;
+    EXPECT_ANY_THROW(registration::ComputeFPFHFeature(pc, empty));
+}
+
+TEST(Feature, ComputeFPFHFeatureKeypoints) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    const geometry::KDTreeSearchParamHybrid param(1.5, 30);
+    pc.EstimateNormals(param);
+    auto ref = registration::ComputeFPFHFeature(pc, param);
+    ASSERT_EQ(33u, ref->Dimension());
+    ASSERT_EQ(pc.points_.size(), ref->Num());
+    // Each of the three histograms of a point with neighbors sums to 200.
+    for (int i = 0; i < int(ref->Num()); i++) {
+        for (int h = 0; h < 3; h++) {
+            const double sum = ref->data_.block<11, 1>(11 * h, i).sum();
+            EXPECT_TRUE(sum == 0.0 || std::abs(sum - 200.0) < 1e-6);
+        }
+    }
+
+    auto result = registration::ComputeFPFHFeature(pc, param, true);
+    ASSERT_TRUE(result->IsFloat());
+    ASSERT_EQ(ref->Num(), result->Num());
+    EXPECT_TRUE(ref->data_.isApprox(result->data_float_.cast<double>(), 1e-5));
+
+    const std::vector<size_t> indices = {17, 3, 999, 500, 3, 0};
+    result = registration::ComputeFPFHFeature(pc, param, indices);
+    ASSERT_EQ(indices.size(), result->Num());
+    for (size_t c = 0; c < indices.size(); c++) {
+        ExpectEQ(Eigen::VectorXd(ref->data_.col(indices[c])),
+                 Eigen::VectorXd(result->data_.col(c)));
+    }
+    result = registration::ComputeFPFHFeature(pc, param, indices, true);
+    ASSERT_TRUE(result->IsFloat());
+    ASSERT_EQ(indices.size(), result->Num());
+
+    result = registration::ComputeFPFHFeature(pc, param,
+                                              std::vector<size_t>());
+    EXPECT_EQ(33u, result->Dimension());
+    EXPECT_EQ(0u, result->Num());
+    EXPECT_ANY_THROW(registration::ComputeFPFHFeature(
+            pc, param, std::vector<size_t>{pc.points_.size()}));
+}
+
+TEST(Feature, CorrespondencesFromFeatures) {
+    registration::Feature source, target;
+    source.Resize(8, 300);
+    target.Resize(8, 200);
+    source.data_.setRandom();
+    target.data_.setRandom();
+
+    std::vector<int> source_to_target(source.Num());
+    std::vector<double> ratios(source.Num());
+    for (int i = 0; i < int(source.Num()); i++) {
+        Eigen::VectorXd distance2 =
+                (target.data_.colwise() - source.data_.col(i))
+                        .colwise()
+                        .squaredNorm();
+        std::vector<int> order(target.Num());
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(
+                order.begin(), order.begin() + 2, order.end(),
+                [&](int a, int b) { return distance2(a) < distance2(b); });
+        source_to_target[i] = order[0];
+        ratios[i] = std::sqrt(distance2(order[0]) / distance2(order[1]));
+    }
+    std::vector<int> target_to_source(target.Num());
+    for (int j = 0; j < int(target.Num()); j++) {
+        (source.data_.colwise() - target.data_.col(j))
+                .colwise()
+                .squaredNorm()
+                .minCoeff(&target_to_source[j]);
+    }
+
+    auto corres = registration::CorrespondencesFromFeatures(source, target);
+    ASSERT_EQ(source.Num(), corres.size());
+    for (int i = 0; i < int(source.Num()); i++) {
+        EXPECT_EQ(Eigen::Vector2i(i, source_to_target[i]), corres[i]);
+    }
+
+    registration::CorrespondenceSet ref_mutual, ref_ratio;
+    for (int i = 0; i < int(source.Num()); i++) {
+        if (target_to_source[source_to_target[i]] == i) {
+            ref_mutual.push_back(Eigen::Vector2i(i, source_to_target[i]));
+        }
+        if (ratios[i] <= 0.8) {
+            ref_ratio.push_back(Eigen::Vector2i(i, source_to_target[i]));
+        }
+    }
+    corres = registration::CorrespondencesFromFeatures(source, target, true);
+    EXPECT_FALSE(ref_mutual.empty());
+    ExpectEQ(ref_mutual, corres);
+    corres = registration::CorrespondencesFromFeatures(source, target, false,
+                                                       0.8);
+    EXPECT_FALSE(ref_ratio.empty());
+    ExpectEQ(ref_ratio, corres);
+
+    source.ConvertToFloat();
+    target.ConvertToFloat();
+    corres = registration::CorrespondencesFromFeatures(source, target, true);
+    ExpectEQ(ref_mutual, corres);
+    source.ConvertToDouble();
+    target.ConvertToDouble();
+
+    EXPECT_TRUE(registration::CorrespondencesFromFeatures(
+                        source, registration::Feature())
+                        .empty());
+    registration::Feature other;
+    other.Resize(4, 10);
+    EXPECT_ANY_THROW(registration::CorrespondencesFromFeatures(source, other));
+    EXPECT_ANY_THROW(
+            registration::CorrespondencesFromFeatures(source, target, false, 0));
+}
+
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
 }  // namespace unit_test
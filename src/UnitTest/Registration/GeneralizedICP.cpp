@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GeneralizedICP.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(GeneralizedICP, RegistrationGeneralizedICP) {
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    auto target = box->SamplePointsUniformly(10000);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+    source.points_.resize(8000);
+
+    // Covariances are estimated from the points of both clouds.
+    auto result = registration::RegistrationGeneralizedICP(
+            source, *target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationForGeneralizedICP(),
+            registration::ICPConvergenceCriteria(1e-8, 1e-8, 30));
+    EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+    EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+    EXPECT_FALSE(source.HasCovariances());
+
+    // Covariances are built from the normals of both clouds.
+    target->EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    source.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    result = registration::RegistrationGeneralizedICP(
+            source, *target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationForGeneralizedICP(),
+            registration::ICPConvergenceCriteria(1e-8, 1e-8, 30));
+    EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+}
+
+TEST(GeneralizedICP, ComputeTransformation) {
+    // Without covariances the estimation does not move the source.
+    geometry::PointCloud source;
+    source.points_ = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}};
+    geometry::PointCloud target = source;
+    target.Translate(Eigen::Vector3d(0.0, 0.0, 1.0));
+    const registration::CorrespondenceSet corres = {{0, 0}, {1, 1}, {2, 2}};
+    registration::TransformationEstimationForGeneralizedICP estimation;
+    ExpectEQ(Eigen::Matrix4d::Identity().eval(),
+             estimation.ComputeTransformation(source, target, corres));
+
+    // Isotropic covariances reduce to point to point ICP.
+    source.covariances_.assign(3, Eigen::Matrix3d::Identity());
+    target.covariances_.assign(3, Eigen::Matrix3d::Identity());
+    Eigen::Matrix4d ref = Eigen::Matrix4d::Identity();
+    ref(2, 3) = 1.0;
+    ExpectEQ(ref, estimation.ComputeTransformation(source, target, corres));
+    EXPECT_NEAR(std::sqrt(0.5),
+                estimation.ComputeRMSE(source, target, corres), 1e-12);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
+#include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -33,8 +41,113 @@ TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+// Builds a pose graph with exact odometry and loop closure edges between
+// poses on a circle, and perturbs all nodes but the reference node 0.
+static registration::PoseGraph CreatePoseGraph(
+        int num_nodes,
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    poses.clear();
+    for (int i = 0; i < num_nodes; i++) {
+        const double angle = 2.0 * M_PI * i / num_nodes;
+        Eigen::Vector6d pose;
+        pose << 0.1 * std::sin(3.0 * angle), 0.05 * std::cos(angle), angle,
+                10.0 * std::cos(angle), 10.0 * std::sin(angle),
+                0.5 * std::sin(2.0 * angle);
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose));
+    }
+    registration::PoseGraph pose_graph;
+    for (int i = 0; i < num_nodes; i++) {
+        Eigen::Matrix4d pose = poses[i];
+        if (i > 0) {
+            Eigen::Vector6d noise;
+            noise << 0.01 * std::sin(i), 0.01 * std::cos(i),
+                    0.01 * std::sin(0.5 * i), 0.05 * std::cos(0.3 * i),
+                    0.05 * std::sin(0.7 * i), 0.05 * std::cos(1.1 * i);
+            pose = utility::TransformVector6dToMatrix4d(noise) * pose;
+        }
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+    }
+    auto add_edge = [&](int s, int t, bool uncertain) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                s, t, poses[t].inverse() * poses[s],
+                Eigen::Matrix6d::Identity() * 100.0, uncertain));
+    };
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        add_edge(i, i + 1, false);
+    }
+    for (int i = 0; i + 5 < num_nodes; i += 3) {
+        add_edge(i, i + 5, true);
+    }
+    add_edge(num_nodes - 1, 0, true);
+    return pose_graph;
+}
+
+static void TestGlobalOptimization(
+        const registration::GlobalOptimizationMethod &method) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    auto pose_graph = CreatePoseGraph(200, poses);
+    registration::GlobalOptimization(
+            pose_graph, method,
+            registration::GlobalOptimizationConvergenceCriteria(
+                    100, 1e-10, 1e-10, 1e-10, 1e-12),
+            registration::GlobalOptimizationOption(0.075, 0.25, 1.0, 0));
+    ASSERT_EQ(poses.size(), pose_graph.nodes_.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        EXPECT_TRUE(pose_graph.nodes_[i].pose_.isApprox(poses[i], 1e-4));
+    }
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    TestGlobalOptimization(registration::GlobalOptimizationGaussNewton());
+}
+
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    TestGlobalOptimization(
+            registration::GlobalOptimizationLevenbergMarquardt());
+}
+
+TEST(GlobalOptimization, IncrementalGlobalOptimization) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    const auto pose_graph = CreatePoseGraph(200, poses);
+    registration::IncrementalGlobalOptimization optimizer(
+            10, registration::GlobalOptimizationConvergenceCriteria(
+                        100, 1e-10, 1e-10, 1e-10, 1e-12));
+    // Add the nodes one at a time, with the edges ending at them.
+    size_t next_edge = 0;
+    Eigen::Matrix4d pose_before;
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        EXPECT_EQ(int(i), optimizer.AddNode(pose_graph.nodes_[i]));
+        while (next_edge < pose_graph.edges_.size()) {
+            const auto &edge = pose_graph.edges_[next_edge];
+            if ((std::max)(edge.source_node_id_, edge.target_node_id_) >
+                int(i)) {
+                break;
+            }
+            optimizer.AddEdge(edge);
+            next_edge++;
+        }
+        if (i == 150) {
+            pose_before = optimizer.GetPoseGraph().nodes_[100].pose_;
+        }
+        optimizer.Optimize();
+        if (i == 150) {
+            // Nodes outside of the window are not changed.
+            ExpectEQ(pose_before,
+                     Eigen::Matrix4d(
+                             optimizer.GetPoseGraph().nodes_[100].pose_));
+        }
+    }
+    // The last edge closes the loop, which distributes the error over all
+    // nodes.
+    const auto &result = optimizer.GetPoseGraph();
+    ASSERT_EQ(poses.size(), result.nodes_.size());
+    ASSERT_EQ(pose_graph.edges_.size(), result.edges_.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        EXPECT_TRUE(result.nodes_[i].pose_.isApprox(poses[i], 1e-4));
+    }
+
+    EXPECT_ANY_THROW(optimizer.AddEdge(
+            registration::PoseGraphEdge(0, int(poses.size()))));
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
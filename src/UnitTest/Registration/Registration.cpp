@@ -24,6 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/Registration.h"
+
+#include <Eigen/Geometry>
+#include <memory>
+
+#include "Open3D/Geometry/CompactPointCloud.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Registration/Feature.h"
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -37,28 +46,422 @@ TEST(Registration, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(Registration, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(Registration, DISABLED_RANSACConvergenceCriteria) { NotImplemented(); }
+TEST(Registration, RANSACConvergenceCriteria) {
+    registration::RANSACConvergenceCriteria criteria;
+    EXPECT_EQ(1000, criteria.max_iteration_);
+    EXPECT_EQ(1000, criteria.max_validation_);
+    EXPECT_EQ(1.0, criteria.confidence_);
+}
 
 TEST(Registration, DISABLED_RegistrationResult) { NotImplemented(); }
 
 TEST(Registration, DISABLED_EvaluateRegistration) { NotImplemented(); }
 
-TEST(Registration, DISABLED_RegistrationICP) { NotImplemented(); }
+TEST(Registration, RegistrationICPPointToPlane) {
+    // Subclasses take the general path that materializes the correspondences,
+    // the built-in estimation the fused one.
+    class PointToPlane
+        : public registration::TransformationEstimationPointToPlane {};
+
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    box->ComputeVertexNormals();
+    auto target = box->SamplePointsUniformly(10000);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+    source.points_.resize(8000);
+    source.normals_.clear();
+
+    for (int max_iteration : {0, 1, 5, 30}) {
+        const registration::ICPConvergenceCriteria criteria(1e-6, 1e-6,
+                                                            max_iteration);
+        auto ref = registration::RegistrationICP(
+                source, *target, 0.1, Eigen::Matrix4d::Identity(),
+                PointToPlane(), criteria);
+        auto result = registration::RegistrationICP(
+                source, *target, 0.1, Eigen::Matrix4d::Identity(),
+                registration::TransformationEstimationPointToPlane(),
+                criteria);
+        ExpectEQ(ref.transformation_, result.transformation_, 1e-10);
+        EXPECT_NEAR(ref.fitness_, result.fitness_, 1e-12);
+        EXPECT_NEAR(ref.inlier_rmse_, result.inlier_rmse_, 1e-10);
+        EXPECT_EQ(ref.correspondence_set_.size(),
+                  result.correspondence_set_.size());
+        for (const auto *r : {&ref, &result}) {
+            const auto &statistics = r->statistics_;
+            EXPECT_EQ(ref.statistics_.num_iterations_,
+                      statistics.num_iterations_);
+            EXPECT_LE(statistics.num_iterations_, max_iteration);
+            EXPECT_EQ(size_t(statistics.num_iterations_),
+                      statistics.iteration_times_.size());
+            EXPECT_EQ(statistics.num_iterations_ < max_iteration
+                              ? registration::RegistrationStopReason::Converged
+                              : registration::RegistrationStopReason::
+                                        MaxIteration,
+                      statistics.stop_reason_);
+            EXPECT_GE(statistics.total_time_,
+                      statistics.correspondence_time_ +
+                              statistics.solve_time_);
+        }
+    }
+    auto result = registration::RegistrationICP(
+            source, *target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPlane(),
+            registration::ICPConvergenceCriteria(1e-8, 1e-8, 30));
+    EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+    EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+}
+
+TEST(Registration, RegistrationICPCompactPointCloud) {
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    box->ComputeVertexNormals();
+    auto target = box->SamplePointsUniformly(10000);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+    source.points_.resize(8000);
+    source.normals_.clear();
+    auto compact_source =
+            geometry::CompactPointCloud::CreateFromPointCloud(source);
+    auto compact_target =
+            geometry::CompactPointCloud::CreateFromPointCloud(*target);
+
+    const registration::ICPConvergenceCriteria criteria(1e-8, 1e-8, 30);
+    const registration::TransformationEstimationPointToPoint point_to_point;
+    const registration::TransformationEstimationPointToPlane point_to_plane;
+    for (const registration::TransformationEstimation *estimation :
+         {static_cast<const registration::TransformationEstimation *>(
+                  &point_to_point),
+          static_cast<const registration::TransformationEstimation *>(
+                  &point_to_plane)}) {
+        auto ref = registration::RegistrationICP(source, *target, 0.1,
+                                                 Eigen::Matrix4d::Identity(),
+                                                 *estimation, criteria);
+        auto result = registration::RegistrationICP(
+                *compact_source, *compact_target, 0.1,
+                Eigen::Matrix4d::Identity(), *estimation, criteria);
+        EXPECT_TRUE(result.transformation_.isApprox(ref.transformation_,
+                                                    1e-4));
+        EXPECT_NEAR(ref.fitness_, result.fitness_, 1e-3);
+        EXPECT_NEAR(ref.inlier_rmse_, result.inlier_rmse_, 1e-4);
+        EXPECT_EQ(result.correspondence_set_.size(),
+                  size_t(result.fitness_ * 8000 + 0.5));
+        EXPECT_GT(result.statistics_.num_iterations_, 0);
+        EXPECT_EQ(size_t(result.statistics_.num_iterations_),
+                  result.statistics_.iteration_times_.size());
+    }
+    auto result = registration::RegistrationICP(
+            *compact_source, *compact_target, 0.1, Eigen::Matrix4d::Identity(),
+            point_to_plane, criteria);
+    EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+
+    EXPECT_ANY_THROW(registration::RegistrationICP(
+            *compact_source, *compact_target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPoint(true)));
+    EXPECT_ANY_THROW(registration::RegistrationICP(
+            *compact_target, *compact_source, 0.1, Eigen::Matrix4d::Identity(),
+            point_to_plane));
+}
+
+TEST(Registration, RegistrationMultiScaleICP) {
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    auto target = box->SamplePointsUniformly(20000);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.1, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, -0.03, 0.02);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation.inverse());
+    target->normals_.clear();
+
+    const std::vector<double> voxel_sizes = {0.2, 0.1, 0.0};
+    const std::vector<double> distances = {0.4, 0.2, 0.05};
+    const std::vector<registration::ICPConvergenceCriteria> criteria(
+            3, registration::ICPConvergenceCriteria(1e-8, 1e-8, 50));
+    for (bool point_to_plane : {false, true}) {
+        std::shared_ptr<registration::TransformationEstimation> estimation;
+        if (point_to_plane) {
+            estimation = std::make_shared<
+                    registration::TransformationEstimationPointToPlane>();
+        } else {
+            estimation = std::make_shared<
+                    registration::TransformationEstimationPointToPoint>();
+        }
+        registration::RegistrationResult result;
+        std::vector<registration::MultiScaleICPLevelStatistics> statistics;
+        std::tie(result, statistics) = registration::RegistrationMultiScaleICP(
+                source, *target, voxel_sizes, distances, criteria,
+                Eigen::Matrix4d::Identity(), *estimation);
+        EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+        EXPECT_NEAR(1.0, result.fitness_, 1e-12);
+        EXPECT_EQ(source.points_.size(), result.correspondence_set_.size());
+        EXPECT_FALSE(target->HasNormals());
+
+        ASSERT_EQ(3u, statistics.size());
+        for (size_t i = 0; i < statistics.size(); i++) {
+            EXPECT_EQ(voxel_sizes[i], statistics[i].voxel_size_);
+            EXPECT_GT(statistics[i].num_iterations_, 0);
+            EXPECT_GE(statistics[i].preprocessing_time_, 0.0);
+            EXPECT_GE(statistics[i].registration_time_, 0.0);
+        }
+        EXPECT_LT(statistics[0].num_source_points_,
+                  statistics[1].num_source_points_);
+        EXPECT_EQ(source.points_.size(), statistics[2].num_source_points_);
+        EXPECT_EQ(target->points_.size(), statistics[2].num_target_points_);
+        EXPECT_EQ(result.fitness_, statistics[2].fitness_);
+        EXPECT_EQ(result.inlier_rmse_, statistics[2].inlier_rmse_);
+    }
+
+    EXPECT_ANY_THROW(registration::RegistrationMultiScaleICP(
+            source, *target, voxel_sizes, {0.4, 0.2}, criteria));
+    EXPECT_ANY_THROW(registration::RegistrationMultiScaleICP(source, *target,
+                                                             {}, {}, {}));
+}
 
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    geometry::PointCloud target;
+    target.points_.resize(5000);
+    Rand(target.points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.4, Eigen::Vector3d(3.0, 1.0, 2.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(-0.1, 0.4, 0.2);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    // 40% of the correspondences are correct, the others are shifted. There
+    // are enough of them for the hypotheses to be previewed on a subset.
+    registration::CorrespondenceSet corres, inliers;
+    for (int i = 0; i < 5000; i++) {
+        if (i % 5 < 2) {
+            corres.push_back(Eigen::Vector2i(i, i));
+            inliers.push_back(corres.back());
+        } else {
+            corres.push_back(Eigen::Vector2i(i, (i + 1234) % 5000));
+        }
+    }
+
+    for (double confidence : {1.0, 0.999}) {
+        auto result = registration::RegistrationRANSACBasedOnCorrespondence(
+                source, target, corres, 0.001,
+                registration::TransformationEstimationPointToPoint(false), 3,
+                registration::RANSACConvergenceCriteria(100000, 1000,
+                                                        confidence));
+        EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-6));
+        EXPECT_NEAR(0.4, result.fitness_, 1e-12);
+        EXPECT_NEAR(0.0, result.inlier_rmse_, 1e-6);
+        ExpectEQ(inliers, result.correspondence_set_);
+
+        // Without early stopping, the all-inlier hypotheses exhaust the
+        // validations long before the iterations.
+        const auto &statistics = result.statistics_;
+        EXPECT_EQ(confidence < 1.0
+                          ? registration::RegistrationStopReason::Confidence
+                          : registration::RegistrationStopReason::
+                                    MaxValidation,
+                  statistics.stop_reason_);
+        EXPECT_LE(statistics.num_validations_, 1000);
+        EXPECT_GT(statistics.num_rejected_by_preview_, 0);
+        EXPECT_EQ(statistics.num_iterations_,
+                  statistics.num_rejected_by_preview_ +
+                          statistics.num_validations_);
+        EXPECT_EQ(0, statistics.num_rejected_by_checkers_);
+    }
+
+    auto result = registration::RegistrationRANSACBasedOnCorrespondence(
+            source, target, registration::CorrespondenceSet(corres.begin(),
+                                                            corres.begin() + 2),
+            0.001);
+    EXPECT_EQ(0.0, result.fitness_);
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    geometry::PointCloud target;
+    target.points_.resize(2000);
+    Rand(target.points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    registration::Feature target_feature;
+    target_feature.Resize(8, int(target.points_.size()));
+    target_feature.data_.setRandom();
+
+    // The source is a transformed subset of the target. Half of its features
+    // are copied from the matching target points, the rest are outliers.
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.7, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.5);
+    geometry::PointCloud source;
+    registration::Feature source_feature;
+    source_feature.Resize(8, 1000);
+    source_feature.data_.setRandom();
+    for (int i = 0; i < 1000; i++) {
+        source.points_.push_back(target.points_[2 * i]);
+        if (i % 2 == 0) {
+            source_feature.data_.col(i) = target_feature.data_.col(2 * i);
+        }
+    }
+    source.Transform(transformation.inverse());
+
+    registration::CorrespondenceCheckerBasedOnEdgeLength edge_length(0.9);
+    registration::CorrespondenceCheckerBasedOnDistance distance(0.01);
+    for (bool mutual_filter : {false, true}) {
+        auto result = registration::RegistrationRANSACBasedOnFeatureMatching(
+                source, target, source_feature, target_feature, 0.01,
+                registration::TransformationEstimationPointToPoint(false), 3,
+                {edge_length, distance},
+                registration::RANSACConvergenceCriteria(10000, 500, 0.999),
+                mutual_filter);
+        EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-6));
+        EXPECT_EQ(1.0, result.fitness_);
+        EXPECT_NEAR(0.0, result.inlier_rmse_, 1e-6);
+        EXPECT_EQ(source.points_.size(), result.correspondence_set_.size());
+
+        const auto &statistics = result.statistics_;
+        EXPECT_EQ(registration::RegistrationStopReason::Confidence,
+                  statistics.stop_reason_);
+        EXPECT_GT(statistics.num_validations_, 0);
+        EXPECT_EQ(statistics.num_iterations_,
+                  statistics.num_rejected_by_checkers_ +
+                          statistics.num_rejected_by_preview_ +
+                          statistics.num_validations_);
+    }
+
+    auto result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.01,
+            registration::TransformationEstimationPointToPoint(false), 3, {},
+            registration::RANSACConvergenceCriteria(0, 0));
+    EXPECT_EQ(0.0, result.fitness_);
+    EXPECT_TRUE(result.correspondence_set_.empty());
+    EXPECT_EQ(0, result.statistics_.num_iterations_);
 }
 
-TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
-    NotImplemented();
+TEST(Registration, GetInformationMatrixFromPointClouds) {
+    geometry::PointCloud target;
+    target.points_.resize(1000);
+    Rand(target.points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.001, 0.002, 0.0);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    // Reference: sum of G^T G with G = [[p]x^T, I] for every target point.
+    const Eigen::Matrix6d information =
+            registration::GetInformationMatrixFromPointClouds(
+                    source, target, 0.01, transformation);
+    Eigen::Matrix6d ref = Eigen::Matrix6d::Zero();
+    for (const Eigen::Vector3d &p : target.points_) {
+        Eigen::Matrix<double, 3, 6> G;
+        G << 0.0, p(2), -p(1), 1.0, 0.0, 0.0, -p(2), 0.0, p(0), 0.0, 1.0, 0.0,
+                p(1), -p(0), 0.0, 0.0, 0.0, 1.0;
+        ref += G.transpose() * G;
+    }
+    ExpectEQ(ref, information);
+
+    // The correspondences of an evaluated transformation give the same
+    // matrix without another search.
+    const auto result = registration::EvaluateRegistration(
+            source, target, 0.01, transformation);
+    ExpectEQ(information,
+             registration::GetInformationMatrixFromCorrespondences(
+                     target, result.correspondence_set_));
+    EXPECT_TRUE(registration::GetInformationMatrixFromCorrespondences(
+                        target, registration::CorrespondenceSet())
+                        .isZero());
+}
+
+TEST(Registration, RegistrationPairwise) {
+    auto target = std::make_shared<geometry::PointCloud>();
+    target->points_.resize(2000);
+    Rand(target->points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    auto target_feature = std::make_shared<registration::Feature>();
+    target_feature->Resize(8, int(target->points_.size()));
+    target_feature->data_.setRandom();
+
+    // As in RegistrationRANSACBasedOnFeatureMatching, plus an unrelated
+    // fragment that cannot be registered.
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.7, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.5);
+    auto source = std::make_shared<geometry::PointCloud>();
+    auto source_feature = std::make_shared<registration::Feature>();
+    source_feature->Resize(8, 1000);
+    source_feature->data_.setRandom();
+    for (int i = 0; i < 1000; i++) {
+        source->points_.push_back(target->points_[2 * i]);
+        if (i % 2 == 0) {
+            source_feature->data_.col(i) = target_feature->data_.col(2 * i);
+        }
+    }
+    source->Transform(transformation.inverse());
+    auto other = std::make_shared<geometry::PointCloud>();
+    other->points_.resize(1000);
+    Rand(other->points_, Zero3d, Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    auto other_feature = std::make_shared<registration::Feature>();
+    other_feature->Resize(8, 1000);
+    other_feature->data_.setRandom();
+
+    const std::vector<std::shared_ptr<geometry::PointCloud>> fragments = {
+            target, source, other};
+    const std::vector<std::shared_ptr<registration::Feature>> features = {
+            target_feature, source_feature, other_feature};
+    Eigen::Matrix4d init = transformation;
+    init.block<3, 1>(0, 3) += Eigen::Vector3d(0.002, 0.0, -0.002);
+    const std::vector<registration::RegistrationPair> pairs = {
+            registration::RegistrationPair(1, 0),
+            registration::RegistrationPair(1, 0, init),
+            registration::RegistrationPair(2, 0)};
+    registration::PairwiseRegistrationOption option(0.01, false);
+    option.ransac_n_ = 3;
+    option.ransac_criteria_ =
+            registration::RANSACConvergenceCriteria(10000, 500, 0.999);
+
+    const auto results = registration::RegistrationPairwise(
+            fragments, features, pairs, option);
+    ASSERT_EQ(3u, results.size());
+    const Eigen::Matrix6d information =
+            registration::GetInformationMatrixFromPointClouds(
+                    *source, *target, 0.01, transformation);
+    for (int k = 0; k < 2; k++) {
+        EXPECT_TRUE(results[k].success_);
+        EXPECT_TRUE(results[k].transformation_.isApprox(transformation, 1e-6));
+        ExpectEQ(Eigen::Matrix6d(results[k].information_), information,
+                 1e-3);
+        EXPECT_EQ(1.0, results[k].fitness_);
+        EXPECT_NEAR(0.0, results[k].inlier_rmse_, 1e-6);
+    }
+    EXPECT_FALSE(results[2].success_);
+    EXPECT_TRUE(results[2].transformation_.isIdentity());
+    EXPECT_TRUE(results[2].information_.isZero());
+
+    EXPECT_THROW(registration::RegistrationPairwise(
+                         fragments, features,
+                         {registration::RegistrationPair(0, 3)}, option),
+                 std::runtime_error);
+    EXPECT_THROW(registration::RegistrationPairwise(
+                         fragments, {}, {registration::RegistrationPair(1, 0)},
+                         option),
+                 std::runtime_error);
+    EXPECT_THROW(registration::RegistrationPairwise(
+                         fragments, features, pairs,
+                         registration::PairwiseRegistrationOption(0.01, true)),
+                 std::runtime_error);
 }
 
 }  // namespace unit_test
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RegistrationTarget.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/Registration.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+std::shared_ptr<geometry::PointCloud> CreateColoredBoxPointCloud() {
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    box->ComputeVertexNormals();
+    auto pcd = box->SamplePointsUniformly(5000);
+    for (const auto &point : pcd->points_) {
+        const double intensity = 0.5 + 0.5 * std::sin(4.0 * point.sum());
+        pcd->colors_.push_back(Eigen::Vector3d::Constant(intensity));
+    }
+    return pcd;
+}
+
+}  // unnamed namespace
+
+TEST(RegistrationTarget, Constructor) {
+    auto pcd = CreateColoredBoxPointCloud();
+    registration::RegistrationTarget target(*pcd);
+    EXPECT_EQ(pcd->points_.size(), target.GetPointCloud().points_.size());
+    EXPECT_FALSE(target.HasColorGradients());
+
+    registration::RegistrationTarget colored_target(*pcd, 0.1);
+    EXPECT_TRUE(colored_target.HasColorGradients());
+    EXPECT_EQ(pcd->points_.size(), colored_target.GetColorGradients().size());
+
+    geometry::PointCloud no_colors = *pcd;
+    no_colors.colors_.clear();
+    EXPECT_ANY_THROW(registration::RegistrationTarget(no_colors, 0.1));
+}
+
+TEST(RegistrationTarget, RegistrationICP) {
+    auto pcd = CreateColoredBoxPointCloud();
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    geometry::PointCloud source = *pcd;
+    source.Transform(transformation.inverse());
+
+    registration::RegistrationTarget target(*pcd, 0.1);
+    const registration::TransformationEstimationPointToPlane point_to_plane;
+    const registration::ICPConvergenceCriteria criteria(1e-8, 1e-8, 50);
+    auto ref = registration::RegistrationICP(source, *pcd, 0.1,
+                                             Eigen::Matrix4d::Identity(),
+                                             point_to_plane, criteria);
+    for (int i = 0; i < 2; i++) {
+        auto result = registration::RegistrationICP(
+                source, target, 0.1, Eigen::Matrix4d::Identity(),
+                point_to_plane, criteria);
+        ExpectEQ(ref.transformation_, result.transformation_);
+        EXPECT_EQ(ref.fitness_, result.fitness_);
+        EXPECT_EQ(ref.inlier_rmse_, result.inlier_rmse_);
+        ExpectEQ(ref.correspondence_set_, result.correspondence_set_);
+    }
+    EXPECT_TRUE(ref.transformation_.isApprox(transformation, 1e-4));
+
+    ref = registration::RegistrationColoredICP(
+            source, *pcd, 0.05, Eigen::Matrix4d::Identity(), criteria);
+    auto result = registration::RegistrationColoredICP(
+            source, target, 0.05, Eigen::Matrix4d::Identity(), criteria);
+    ExpectEQ(ref.transformation_, result.transformation_);
+    EXPECT_EQ(ref.fitness_, result.fitness_);
+    EXPECT_EQ(ref.inlier_rmse_, result.inlier_rmse_);
+    EXPECT_TRUE(result.transformation_.isApprox(transformation, 1e-4));
+
+    registration::RegistrationTarget no_gradients(*pcd);
+    EXPECT_ANY_THROW(registration::RegistrationColoredICP(source, no_gradients,
+                                                          0.05));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Registration/Registration.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+TEST(RobustKernel, Weight) {
+    EXPECT_EQ(1.0, registration::L2Loss().Weight(5.0));
+
+    registration::HuberLoss huber(0.5);
+    EXPECT_EQ(1.0, huber.Weight(-0.25));
+    EXPECT_NEAR(0.25, huber.Weight(-2.0), 1e-12);
+
+    registration::CauchyLoss cauchy(0.5);
+    EXPECT_EQ(1.0, cauchy.Weight(0.0));
+    EXPECT_NEAR(0.5, cauchy.Weight(0.5), 1e-12);
+
+    registration::GMLoss gm(0.5);
+    EXPECT_EQ(1.0, gm.Weight(0.0));
+    EXPECT_NEAR(0.25, gm.Weight(-0.5), 1e-12);
+
+    registration::TukeyLoss tukey(0.5);
+    EXPECT_EQ(1.0, tukey.Weight(0.0));
+    EXPECT_NEAR(0.5625, tukey.Weight(0.25), 1e-12);
+    EXPECT_EQ(0.0, tukey.Weight(-0.75));
+}
+
+TEST(RobustKernel, RegistrationICPPointToPlane) {
+    // The subclass takes the general path, the built-in estimation the fused
+    // one.
+    class PointToPlane
+        : public registration::TransformationEstimationPointToPlane {
+    public:
+        using TransformationEstimationPointToPlane::
+                TransformationEstimationPointToPlane;
+    };
+
+    auto box = geometry::TriangleMesh::CreateBox(1.0, 2.0, 3.0);
+    auto target = box->SamplePointsUniformly(10000);
+    target->EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.01, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.005, -0.002, 0.004);
+    geometry::PointCloud source = *target;
+    source.points_.resize(8000);
+    // Every fifth source point is shifted along z, which biases the top and
+    // bottom faces.
+    for (size_t i = 0; i < source.points_.size(); i += 5) {
+        source.points_[i] += Eigen::Vector3d(0.0, 0.0, 0.04);
+    }
+    source.normals_.clear();
+    source.Transform(transformation.inverse());
+
+    const registration::ICPConvergenceCriteria criteria(1e-8, 1e-8, 30);
+    auto l2 = registration::RegistrationICP(
+            source, *target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPlane(), criteria);
+    const double l2_error = (l2.transformation_ - transformation).norm();
+    EXPECT_GT(l2_error, 1e-3);
+
+    auto kernel = std::make_shared<registration::TukeyLoss>(0.01);
+    auto ref = registration::RegistrationICP(source, *target, 0.1,
+                                             Eigen::Matrix4d::Identity(),
+                                             PointToPlane(kernel), criteria);
+    auto result = registration::RegistrationICP(
+            source, *target, 0.1, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationPointToPlane(kernel),
+            criteria);
+    ExpectEQ(ref.transformation_, result.transformation_, 1e-10);
+    EXPECT_LT((result.transformation_ - transformation).norm(),
+              0.1 * l2_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/Image.h"
+
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Geometry/Image.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Returns a Float32 legacy image with a smooth pattern and a step.
+geometry::Image CreateFloatImage(int width, int height) {
+    geometry::Image image;
+    image.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *image.PointerAt<float>(u, v) =
+                    0.01f * float(u * u + 3 * v) + (u > width / 2 ? 1.0f : 0);
+        }
+    }
+    return image;
+}
+
+void ExpectImageEQ(const geometry::Image& expected,
+                   const geometry::Image& actual) {
+    EXPECT_EQ(expected.width_, actual.width_);
+    EXPECT_EQ(expected.height_, actual.height_);
+    EXPECT_EQ(expected.num_of_channels_, actual.num_of_channels_);
+    EXPECT_EQ(expected.bytes_per_channel_, actual.bytes_per_channel_);
+    EXPECT_EQ(expected.data_, actual.data_);
+}
+
+}  // namespace
+
+class TImagePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TImage,
+                         TImagePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TImagePermuteDevices, Constructor) {
+    Device device = GetParam();
+
+    tgeometry::Image image(4, 5, 3, Dtype::UInt8, device);
+    EXPECT_EQ(image.GetRows(), 4);
+    EXPECT_EQ(image.GetCols(), 5);
+    EXPECT_EQ(image.GetChannels(), 3);
+    EXPECT_EQ(image.GetDtype(), Dtype::UInt8);
+    EXPECT_EQ(image.GetDevice(), device);
+    EXPECT_FALSE(image.IsEmpty());
+    image.Clear();
+    EXPECT_TRUE(image.IsEmpty());
+    EXPECT_EQ(image.GetChannels(), 3);
+
+    tgeometry::Image from_tensor(Tensor::Zeros({2, 3}, Dtype::Float32, device));
+    EXPECT_EQ(from_tensor.AsTensor().GetShape(), SizeVector({2, 3, 1}));
+    EXPECT_THROW(tgeometry::Image(Tensor::Zeros({2}, Dtype::Float32, device)),
+                 std::runtime_error);
+}
+
+TEST_P(TImagePermuteDevices, LegacyConversion) {
+    Device device = GetParam();
+
+    geometry::Image image_legacy;
+    image_legacy.Prepare(5, 4, 1, 2);
+    for (int i = 0; i < 20; ++i) {
+        reinterpret_cast<uint16_t*>(image_legacy.data_.data())[i] =
+                uint16_t(i * 100);
+    }
+    tgeometry::Image image =
+            tgeometry::Image::FromLegacyImage(image_legacy, device);
+    EXPECT_EQ(image.GetRows(), 4);
+    EXPECT_EQ(image.GetCols(), 5);
+    EXPECT_EQ(image.GetDtype(), Dtype::UInt16);
+    EXPECT_EQ(image.GetDevice(), device);
+    ExpectImageEQ(image_legacy, image.ToLegacyImage());
+}
+
+TEST_P(TImagePermuteDevices, ConvertDepthToFloat) {
+    Device device = GetParam();
+
+    geometry::Image depth_legacy;
+    depth_legacy.Prepare(6, 3, 1, 2);
+    for (int i = 0; i < 18; ++i) {
+        reinterpret_cast<uint16_t*>(depth_legacy.data_.data())[i] =
+                uint16_t(i * 250);
+    }
+    tgeometry::Image depth = tgeometry::Image::FromLegacyImage(depth_legacy,
+                                                               device)
+                                     .ConvertDepthToFloat(1000.0, 3.0);
+    EXPECT_EQ(depth.GetDtype(), Dtype::Float32);
+    ExpectImageEQ(*depth_legacy.ConvertDepthToFloatImage(1000.0, 3.0),
+                  depth.ToLegacyImage());
+
+    EXPECT_THROW(tgeometry::Image(3, 3, 3, Dtype::UInt8, device)
+                         .ConvertDepthToFloat(),
+                 std::runtime_error);
+}
+
+TEST_P(TImagePermuteDevices, Filter) {
+    Device device = GetParam();
+
+    const geometry::Image image_legacy = CreateFloatImage(11, 9);
+    const tgeometry::Image image =
+            tgeometry::Image::FromLegacyImage(image_legacy, device);
+    for (auto type : {geometry::Image::FilterType::Gaussian3,
+                      geometry::Image::FilterType::Gaussian5,
+                      geometry::Image::FilterType::Gaussian7,
+                      geometry::Image::FilterType::Sobel3Dx,
+                      geometry::Image::FilterType::Sobel3Dy}) {
+        ExpectImageEQ(*image_legacy.Filter(type),
+                      image.Filter(type).ToLegacyImage());
+    }
+
+    EXPECT_THROW(tgeometry::Image(3, 3, 1, Dtype::UInt16, device)
+                         .Filter(geometry::Image::FilterType::Gaussian3),
+                 std::runtime_error);
+}
+
+TEST_P(TImagePermuteDevices, CreatePyramid) {
+    Device device = GetParam();
+
+    const geometry::Image image_legacy = CreateFloatImage(16, 13);
+    const tgeometry::Image image =
+            tgeometry::Image::FromLegacyImage(image_legacy, device);
+    ExpectImageEQ(*image_legacy.Downsample(),
+                  image.Downsample().ToLegacyImage());
+
+    for (bool with_gaussian_filter : {true, false}) {
+        geometry::ImagePyramid pyramid_legacy =
+                image_legacy.CreatePyramid(3, with_gaussian_filter);
+        std::vector<tgeometry::Image> pyramid =
+                image.CreatePyramid(3, with_gaussian_filter);
+        ASSERT_EQ(pyramid.size(), 3u);
+        for (size_t i = 0; i < pyramid.size(); ++i) {
+            EXPECT_EQ(pyramid[i].GetDevice(), device);
+            ExpectImageEQ(*pyramid_legacy[i], pyramid[i].ToLegacyImage());
+        }
+    }
+}
+
+TEST_P(TImagePermuteDevices, FilterBilateral) {
+    Device device = GetParam();
+
+    // A step of 1 m with a hole, on a 6 x 8 depth image.
+    std::vector<float> values(48);
+    for (int i = 0; i < 48; ++i) {
+        values[i] = i % 8 < 4 ? 1.0f : 2.0f;
+    }
+    values[10] = 0.0f;
+    tgeometry::Image image(Tensor(values, {6, 8}, Dtype::Float32, device));
+
+    std::vector<float> filtered = image.FilterBilateral(5, 0.05, 3.0)
+                                          .AsTensor()
+                                          .ToFlatVector<float>();
+    for (int i = 0; i < 48; ++i) {
+        EXPECT_NEAR(filtered[i], values[i], 1e-6);
+    }
+
+    // Without the value term, the step is blurred but the hole is kept.
+    filtered = image.FilterBilateral(3, 1e6, 3.0)
+                       .AsTensor()
+                       .ToFlatVector<float>();
+    EXPECT_EQ(filtered[10], 0.0f);
+    EXPECT_GT(filtered[3], 1.1f);
+    EXPECT_LT(filtered[4], 1.9f);
+    EXPECT_NEAR(filtered[0], 1.0f, 1e-6);
+
+    EXPECT_THROW(image.FilterBilateral(4), std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,286 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/PointCloud.h"
+
+#include <tuple>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorList.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TPointCloudPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TPointCloud,
+                         TPointCloudPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TPointCloudPermuteDevices, LegacyConversion) {
+    Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = {{0, 1, 2}, {3, 4, 5}};
+    pcd_legacy.colors_ = {{0.5, 0.25, 0}, {1, 1, 1}};
+
+    tgeometry::PointCloud pcd =
+            tgeometry::PointCloud::FromLegacyPointCloud(pcd_legacy,
+                                                        Dtype::Float32, device);
+    EXPECT_EQ(pcd.NumPoints(), 2);
+    EXPECT_EQ(pcd.GetDtype(), Dtype::Float32);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    EXPECT_TRUE(pcd.HasColors());
+    EXPECT_FALSE(pcd.HasNormals());
+    EXPECT_EQ(pcd.GetPoints().AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    geometry::PointCloud pcd_back = pcd.ToLegacyPointCloud();
+    ExpectEQ(pcd_back.points_, pcd_legacy.points_);
+    ExpectEQ(pcd_back.colors_, pcd_legacy.colors_);
+    EXPECT_FALSE(pcd_back.HasNormals());
+}
+
+TEST_P(TPointCloudPermuteDevices, PointAttr) {
+    Device device = GetParam();
+
+    tgeometry::PointCloud pcd(Dtype::Float32, device);
+    EXPECT_TRUE(pcd.IsEmpty());
+    pcd.GetPoints().PushBack(Tensor::Ones({3}, Dtype::Float32, device));
+    EXPECT_FALSE(pcd.IsEmpty());
+
+    pcd.SetPointAttr("labels", TensorList({}, Dtype::Int32, device, 1));
+    EXPECT_TRUE(pcd.HasPointAttr("labels"));
+    EXPECT_EQ(pcd["labels"].GetSize(), 1);
+    EXPECT_THROW(pcd.SetPointAttr("colors",
+                                  TensorList({3}, Dtype::Float32, device, 2)),
+                 std::runtime_error);
+    EXPECT_THROW(pcd["colors"], std::runtime_error);
+
+    pcd.RemovePointAttr("labels");
+    EXPECT_FALSE(pcd.HasPointAttr("labels"));
+    EXPECT_THROW(pcd.RemovePointAttr("points"), std::runtime_error);
+
+    pcd.Clear();
+    EXPECT_TRUE(pcd.IsEmpty());
+    EXPECT_EQ(pcd.GetDevice(), device);
+}
+
+TEST_P(TPointCloudPermuteDevices, Transform) {
+    Device device = GetParam();
+
+    tgeometry::PointCloud pcd(TensorList(
+            Tensor(std::vector<float>{1, 0, 0, 0, 2, 0}, {2, 3},
+                   Dtype::Float32, device)));
+    pcd.SetPointAttr("normals",
+                     TensorList(Tensor(std::vector<float>{1, 0, 0, 0, 1, 0},
+                                       {2, 3}, Dtype::Float32, device)));
+
+    // Rotation by 90 degrees around z, then translation by (1, 2, 3).
+    Tensor transformation(std::vector<double>{0, -1, 0, 1, 1, 0, 0, 2,
+                                              0, 0, 1, 3, 0, 0, 0, 1},
+                          {4, 4}, Dtype::Float64, Device("CPU:0"));
+    pcd.Transform(transformation);
+    EXPECT_EQ(pcd.GetPoints().AsTensor().ToFlatVector<float>(),
+              std::vector<float>({1, 3, 3, -1, 2, 3}));
+    EXPECT_EQ(pcd.GetNormals().AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 1, 0, -1, 0, 0}));
+}
+
+TEST_P(TPointCloudPermuteDevices, Crop) {
+    Device device = GetParam();
+
+    tgeometry::PointCloud pcd(TensorList(
+            Tensor(std::vector<float>{0, 0, 0, 1, 1, 1, 2, 2, 2, 0.5, 3, 0.5},
+                   {4, 3}, Dtype::Float32, device)));
+    pcd.SetPointAttr("labels",
+                     TensorList(Tensor(std::vector<int32_t>{0, 1, 2, 3}, {4},
+                                       Dtype::Int32, device)));
+
+    tgeometry::PointCloud cropped =
+            pcd.Crop(Tensor(std::vector<float>{0.5, 0.5, 0.5}, {3},
+                            Dtype::Float32, device),
+                     Tensor(std::vector<float>{2, 2, 2}, {3}, Dtype::Float32,
+                            device));
+    EXPECT_EQ(cropped.NumPoints(), 2);
+    EXPECT_EQ(cropped["labels"].AsTensor().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2}));
+}
+
+TEST_P(TPointCloudPermuteDevices, VoxelDownSample) {
+    Device device = GetParam();
+
+    // Two points in voxel (0, 0, 0), one each in (1, 0, 0) and (0, 0, 2).
+    tgeometry::PointCloud pcd(TensorList(Tensor(
+            std::vector<float>{0.1, 0.1, 0.1, 0.4, 0.2, 0.3, 0.9, 0.1, 0.1,
+                               0.1, 0.1, 1.2},
+            {4, 3}, Dtype::Float32, device)));
+    pcd.SetPointAttr("colors",
+                     TensorList(Tensor::Ones({4, 3}, Dtype::Float32, device)));
+
+    tgeometry::PointCloud pcd_down = pcd.VoxelDownSample(0.5);
+    EXPECT_EQ(pcd_down.NumPoints(), 3);
+    EXPECT_TRUE(pcd_down.HasColors());
+    EXPECT_EQ(pcd_down.GetDevice(), device);
+    EXPECT_THROW(pcd.VoxelDownSample(0), std::runtime_error);
+}
+
+TEST_P(TPointCloudPermuteDevices, EstimateNormals) {
+    Device device = GetParam();
+
+    // Points on the z = 0 plane.
+    std::vector<float> points;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            points.insert(points.end(), {float(x), float(y), 0});
+        }
+    }
+    tgeometry::PointCloud pcd(TensorList(
+            Tensor(points, {16, 3}, Dtype::Float32, device)));
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(8));
+    EXPECT_TRUE(pcd.HasNormals());
+    EXPECT_EQ(pcd.GetNormals().GetDevice(), device);
+
+    std::vector<float> normals =
+            pcd.GetNormals().AsTensor().ToFlatVector<float>();
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_NEAR(std::abs(normals[i * 3 + 2]), 1, 1e-5);
+    }
+}
+
+TEST_P(TPointCloudPermuteDevices, SegmentPlane) {
+    Device device = GetParam();
+
+    // A 20x20 grid on the plane z = 0.5 and 100 points above it.
+    std::vector<float> points;
+    for (int x = 0; x < 20; ++x) {
+        for (int y = 0; y < 20; ++y) {
+            points.insert(points.end(), {x * 0.1f, y * 0.1f, 0.5f});
+        }
+    }
+    for (int i = 0; i < 100; ++i) {
+        points.insert(points.end(),
+                      {(i % 10) * 0.2f, (i / 10) * 0.2f, 1.0f + i * 0.01f});
+    }
+    tgeometry::PointCloud pcd(
+            TensorList(Tensor(points, {500, 3}, Dtype::Float32, device)));
+
+    Tensor plane_model, inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 200, 3);
+    EXPECT_EQ(plane_model.GetShape(), SizeVector({4}));
+    EXPECT_EQ(inliers.GetDevice(), device);
+    EXPECT_EQ(inliers.GetShape(), SizeVector({400}));
+
+    std::vector<double> model = plane_model.ToFlatVector<double>();
+    const double sign = model[2] > 0 ? 1 : -1;
+    EXPECT_NEAR(model[0], 0, 1e-5);
+    EXPECT_NEAR(model[1], 0, 1e-5);
+    EXPECT_NEAR(sign * model[2], 1, 1e-5);
+    EXPECT_NEAR(sign * model[3], -0.5, 1e-5);
+    std::vector<int64_t> inlier_indices = inliers.ToFlatVector<int64_t>();
+    for (size_t i = 0; i < inlier_indices.size(); ++i) {
+        EXPECT_EQ(inlier_indices[i], int64_t(i));
+    }
+
+    EXPECT_THROW(pcd.SegmentPlane(0), std::runtime_error);
+    EXPECT_THROW(pcd.SegmentPlane(0.01, 0), std::runtime_error);
+}
+
+TEST_P(TPointCloudPermuteDevices, CreateFromRGBDImage) {
+    Device device = GetParam();
+
+    const int width = 8;
+    const int height = 6;
+    geometry::Image depth_legacy, color_legacy;
+    depth_legacy.Prepare(width, height, 1, 2);
+    color_legacy.Prepare(width, height, 3, 1);
+    for (int i = 0; i < width * height; ++i) {
+        // Some pixels have no depth, some are beyond 3 m.
+        reinterpret_cast<uint16_t*>(depth_legacy.data_.data())[i] =
+                i % 7 == 0 ? 0 : uint16_t(500 + 61 * i);
+        for (int c = 0; c < 3; ++c) {
+            color_legacy.data_[3 * i + c] = uint8_t(i * 5 + c);
+        }
+    }
+    const camera::PinholeCameraIntrinsic intrinsic_legacy(width, height, 5.0,
+                                                          6.0, 3.5, 2.5);
+    Eigen::Matrix4d extrinsic_legacy = Eigen::Matrix4d::Identity();
+    extrinsic_legacy.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(0, 1, 0)).toRotationMatrix();
+    extrinsic_legacy.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, -0.2, 0.5);
+    const Tensor intrinsic(std::vector<double>{5, 0, 3.5, 0, 6, 2.5, 0, 0, 1},
+                           {3, 3}, Dtype::Float64, Device("CPU:0"));
+    std::vector<double> extrinsic_values(16);
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            extrinsic_values[r * 4 + c] = extrinsic_legacy(r, c);
+        }
+    }
+    const Tensor extrinsic(extrinsic_values, {4, 4}, Dtype::Float64, device);
+
+    const tgeometry::RGBDImage rgbd(
+            tgeometry::Image::FromLegacyImage(color_legacy, device),
+            tgeometry::Image::FromLegacyImage(depth_legacy, device));
+    const tgeometry::PointCloud pcd =
+            tgeometry::PointCloud::CreateFromRGBDImage(
+                    rgbd, intrinsic, extrinsic, 1000.0, 3.0);
+    EXPECT_EQ(pcd.GetDevice(), device);
+
+    auto rgbd_legacy = geometry::RGBDImage::CreateFromColorAndDepth(
+            color_legacy, depth_legacy, 1000.0, 3.0, false);
+    auto pcd_legacy = geometry::PointCloud::CreateFromRGBDImage(
+            *rgbd_legacy, intrinsic_legacy, extrinsic_legacy);
+    geometry::PointCloud pcd_back = pcd.ToLegacyPointCloud();
+    ASSERT_EQ(pcd_back.points_.size(), pcd_legacy->points_.size());
+    for (size_t i = 0; i < pcd_back.points_.size(); ++i) {
+        ExpectEQ(pcd_back.points_[i], pcd_legacy->points_[i], 1e-5);
+        ExpectEQ(pcd_back.colors_[i], pcd_legacy->colors_[i], 1e-6);
+    }
+
+    // Every other row and column, without colors.
+    const tgeometry::PointCloud pcd_depth =
+            tgeometry::PointCloud::CreateFromDepthImage(
+                    rgbd.depth_, intrinsic, extrinsic, 1000.0, 3.0, 2);
+    auto pcd_depth_legacy = geometry::PointCloud::CreateFromDepthImage(
+            depth_legacy, intrinsic_legacy, extrinsic_legacy, 1000.0, 3.0, 2);
+    EXPECT_FALSE(pcd_depth.HasColors());
+    geometry::PointCloud pcd_depth_back = pcd_depth.ToLegacyPointCloud();
+    ASSERT_EQ(pcd_depth_back.points_.size(), pcd_depth_legacy->points_.size());
+    for (size_t i = 0; i < pcd_depth_back.points_.size(); ++i) {
+        ExpectEQ(pcd_depth_back.points_[i], pcd_depth_legacy->points_[i],
+                 1e-5);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,230 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TGeometry/TriangleMesh.h"
+
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Core/TensorList.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+/// Two triangles sharing an edge and an unreferenced vertex.
+tgeometry::TriangleMesh CreateQuad(const Device& device) {
+    tgeometry::TriangleMesh mesh(
+            TensorList(Tensor(std::vector<float>{0, 0, 0, 1, 0, 0, 1, 1, 0,
+                                                 0, 1, 0, 5, 5, 5},
+                              {5, 3}, Dtype::Float32, device)),
+            TensorList(Tensor(std::vector<int64_t>{0, 1, 2, 0, 2, 3}, {2, 3},
+                              Dtype::Int64, device)));
+    mesh.SetVertexAttr("colors",
+                       TensorList(Tensor(std::vector<float>{0, 0, 0, 1, 1, 1,
+                                                            2, 2, 2, 3, 3, 3,
+                                                            4, 4, 4},
+                                         {5, 3}, Dtype::Float32, device)));
+    mesh.SetTriangleAttr("labels",
+                         TensorList(Tensor(std::vector<int32_t>{7, 8}, {2, 1},
+                                           Dtype::Int32, device)));
+    return mesh;
+}
+
+}  // namespace
+
+class TTriangleMeshPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TTriangleMesh,
+                         TTriangleMeshPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TTriangleMeshPermuteDevices, LegacyConversion) {
+    Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateSphere(1.0, 5);
+    mesh_legacy->ComputeVertexNormals();
+    mesh_legacy->vertex_colors_.assign(mesh_legacy->vertices_.size(),
+                                       Eigen::Vector3d(0.5, 0.25, 0));
+
+    tgeometry::TriangleMesh mesh =
+            tgeometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, Dtype::Float64, device);
+    EXPECT_EQ(mesh.GetDevice(), device);
+    EXPECT_EQ(mesh.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(mesh.GetTriangles().GetDtype(), Dtype::Int64);
+    EXPECT_EQ(mesh.NumVertices(), int64_t(mesh_legacy->vertices_.size()));
+    EXPECT_EQ(mesh.NumTriangles(), int64_t(mesh_legacy->triangles_.size()));
+    EXPECT_TRUE(mesh.HasVertexNormals());
+    EXPECT_TRUE(mesh.HasVertexColors());
+    EXPECT_TRUE(mesh.HasTriangleNormals());
+
+    geometry::TriangleMesh mesh_back = mesh.ToLegacyTriangleMesh();
+    ExpectEQ(mesh_back.vertices_, mesh_legacy->vertices_);
+    ExpectEQ(mesh_back.triangles_, mesh_legacy->triangles_);
+    ExpectEQ(mesh_back.vertex_normals_, mesh_legacy->vertex_normals_);
+    ExpectEQ(mesh_back.vertex_colors_, mesh_legacy->vertex_colors_);
+    ExpectEQ(mesh_back.triangle_normals_, mesh_legacy->triangle_normals_);
+}
+
+TEST_P(TTriangleMeshPermuteDevices, Attributes) {
+    Device device = GetParam();
+
+    tgeometry::TriangleMesh mesh(Dtype::Float32, device);
+    EXPECT_TRUE(mesh.IsEmpty());
+    EXPECT_FALSE(mesh.HasTriangles());
+
+    mesh = CreateQuad(device);
+    EXPECT_FALSE(mesh.IsEmpty());
+    EXPECT_EQ(mesh.NumVertices(), 5);
+    EXPECT_EQ(mesh.NumTriangles(), 2);
+    EXPECT_TRUE(mesh.HasVertexColors());
+    EXPECT_TRUE(mesh.HasTriangleAttr("labels"));
+    EXPECT_THROW(mesh.GetVertexAttr("normals"), std::runtime_error);
+    EXPECT_THROW(mesh.SetVertexAttr("normals",
+                                    TensorList({3}, Dtype::Float32, device, 2)),
+                 std::runtime_error);
+    EXPECT_THROW(mesh.SetTriangleAttr("triangles",
+                                      TensorList({3}, Dtype::Int32, device)),
+                 std::runtime_error);
+    EXPECT_THROW(mesh.RemoveVertexAttr("vertices"), std::runtime_error);
+    EXPECT_THROW(mesh.RemoveTriangleAttr("triangles"), std::runtime_error);
+
+    mesh.RemoveTriangleAttr("labels");
+    EXPECT_FALSE(mesh.HasTriangleAttr("labels"));
+
+    tgeometry::TriangleMesh mesh_copy = mesh.Copy(Device("CPU:0"));
+    EXPECT_EQ(mesh_copy.GetDevice(), Device("CPU:0"));
+    EXPECT_EQ(mesh_copy.GetTriangles().AsTensor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 0, 2, 3}));
+
+    mesh.Clear();
+    EXPECT_TRUE(mesh.IsEmpty());
+    EXPECT_FALSE(mesh.HasVertexColors());
+    EXPECT_EQ(mesh.GetDevice(), device);
+}
+
+TEST_P(TTriangleMeshPermuteDevices, Transform) {
+    Device device = GetParam();
+
+    tgeometry::TriangleMesh mesh = CreateQuad(device);
+    mesh.ComputeVertexNormals();
+    // Rotation by 90 degrees around x and a translation.
+    Tensor transformation(std::vector<double>{1, 0, 0, 1, 0, 0, -1, 2, 0, 1, 0,
+                                              3, 0, 0, 0, 1},
+                          {4, 4}, Dtype::Float64, Device("CPU:0"));
+    mesh.Transform(transformation);
+
+    std::vector<float> vertices =
+            mesh.GetVertices().AsTensor().ToFlatVector<float>();
+    ExpectEQ(vertices, std::vector<float>({1, 2, 3, 2, 2, 3, 2, 2, 4, 1, 2, 4,
+                                           6, -3, 8}));
+    ExpectEQ(mesh.GetVertexAttr("normals").AsTensor().ToFlatVector<float>(),
+             std::vector<float>({0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0,
+                                 0}));
+    ExpectEQ(mesh.GetTriangleAttr("normals").AsTensor().ToFlatVector<float>(),
+             std::vector<float>({0, -1, 0, 0, -1, 0}));
+}
+
+TEST_P(TTriangleMeshPermuteDevices, ComputeVertexNormals) {
+    Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    for (Dtype dtype : {Dtype::Float32, Dtype::Float64}) {
+        tgeometry::TriangleMesh mesh =
+                tgeometry::TriangleMesh::FromLegacyTriangleMesh(*mesh_legacy,
+                                                                dtype, device);
+        mesh.ComputeVertexNormals();
+        EXPECT_EQ(mesh.GetVertexAttr("normals").GetDtype(), dtype);
+
+        geometry::TriangleMesh expected = *mesh_legacy;
+        expected.ComputeVertexNormals();
+        geometry::TriangleMesh mesh_back = mesh.ToLegacyTriangleMesh();
+        ExpectEQ(mesh_back.vertex_normals_, expected.vertex_normals_, 1e-5);
+        ExpectEQ(mesh_back.triangle_normals_, expected.triangle_normals_,
+                 1e-5);
+
+        mesh.ComputeTriangleNormals(false);
+        expected.ComputeTriangleNormals(false);
+        mesh_back = mesh.ToLegacyTriangleMesh();
+        ExpectEQ(mesh_back.triangle_normals_, expected.triangle_normals_,
+                 1e-5);
+    }
+}
+
+TEST_P(TTriangleMeshPermuteDevices, SelectTriangles) {
+    Device device = GetParam();
+
+    tgeometry::TriangleMesh mesh = CreateQuad(device);
+    tgeometry::TriangleMesh selected = mesh.SelectTriangles(
+            Tensor(std::vector<bool>{false, true}, {2}, Dtype::Bool, device));
+    EXPECT_EQ(selected.NumVertices(), 5);
+    EXPECT_EQ(selected.GetTriangles().AsTensor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 3}));
+    EXPECT_EQ(selected.GetTriangleAttr("labels")
+                      .AsTensor()
+                      .ToFlatVector<int32_t>(),
+              std::vector<int32_t>({8}));
+
+    EXPECT_THROW(mesh.SelectTriangles(Tensor::Ones({3}, Dtype::Bool, device)),
+                 std::runtime_error);
+}
+
+TEST_P(TTriangleMeshPermuteDevices, SelectVertices) {
+    Device device = GetParam();
+
+    tgeometry::TriangleMesh mesh = CreateQuad(device);
+    tgeometry::TriangleMesh selected =
+            mesh.SelectVertices(Tensor(std::vector<bool>{true, false, true,
+                                                         true, true},
+                                       {5}, Dtype::Bool, device));
+    EXPECT_EQ(selected.NumVertices(), 4);
+    EXPECT_EQ(selected.GetVertexAttr("colors")
+                      .AsTensor()
+                      .ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 2, 2, 2, 3, 3, 3, 4, 4, 4}));
+    EXPECT_EQ(selected.GetTriangles().AsTensor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2}));
+    EXPECT_EQ(selected.GetTriangleAttr("labels")
+                      .AsTensor()
+                      .ToFlatVector<int32_t>(),
+              std::vector<int32_t>({8}));
+
+    mesh.RemoveUnreferencedVertices();
+    EXPECT_EQ(mesh.NumVertices(), 4);
+    EXPECT_EQ(mesh.NumTriangles(), 2);
+    EXPECT_EQ(mesh.GetTriangles().AsTensor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 0, 2, 3}));
+    EXPECT_EQ(mesh.GetVertexAttr("colors").AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3}));
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TIntegration/VoxelBlockTSDFVolume.h"
+
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/TGeometry/PointCloud.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TIntegrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TIntegration,
+                         TIntegrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int kWidth = 64;
+static const int kHeight = 48;
+
+static Tensor PlaneIntrinsic() {
+    return Tensor(std::vector<double>{50, 0, 32, 0, 50, 24, 0, 0, 1}, {3, 3},
+                  Dtype::Float64);
+}
+
+/// Depth image in millimeters of the plane z = 1 seen from the origin.
+static Tensor PlaneDepth() {
+    return Tensor(std::vector<uint16_t>(kWidth * kHeight, 1000),
+                  {kHeight, kWidth}, Dtype::UInt16);
+}
+
+TEST_P(TIntegrationPermuteDevices, ExtractPointCloud) {
+    const Device device = GetParam();
+    tintegration::VoxelBlockTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::NoColor, 8, 100,
+            device, 2);
+    volume.Integrate(PlaneDepth(), Tensor(), PlaneIntrinsic(),
+                     Tensor::Eye(4, Dtype::Float64, Device("CPU:0")));
+    EXPECT_GT(volume.GetNumBlocks(), 0);
+
+    const tgeometry::PointCloud pcd = volume.ExtractTensorPointCloud();
+    EXPECT_EQ(pcd.GetDevice(), device);
+    EXPECT_FALSE(pcd.HasColors());
+    const geometry::PointCloud legacy = pcd.ToLegacyPointCloud();
+    ASSERT_GT(legacy.points_.size(), 100u);
+    ASSERT_EQ(legacy.normals_.size(), legacy.points_.size());
+    for (size_t i = 0; i < legacy.points_.size(); ++i) {
+        EXPECT_NEAR(legacy.points_[i](2), 1.0, 1e-3);
+        EXPECT_LT(legacy.normals_[i](2), -0.9);
+    }
+
+    volume.Reset();
+    EXPECT_EQ(volume.GetNumBlocks(), 0);
+    EXPECT_EQ(volume.ExtractTensorPointCloud().NumPoints(), 0);
+}
+
+TEST_P(TIntegrationPermuteDevices, ExtractTriangleMesh) {
+    const Device device = GetParam();
+    tintegration::VoxelBlockTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::NoColor, 8, 10,
+            device, 2);
+    // Integrating the same frame twice changes the weights, not the surface.
+    for (int i = 0; i < 2; ++i) {
+        volume.Integrate(PlaneDepth().To(Dtype::Float32), Tensor(),
+                         PlaneIntrinsic(),
+                         Tensor::Eye(4, Dtype::Float64, Device("CPU:0")),
+                         1000.0, 3.0);
+    }
+    const auto mesh = volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 100u);
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex(2), 1.0, 1e-3);
+    }
+    // The triangles face the camera, as in UniformTSDFVolume.
+    mesh->ComputeTriangleNormals();
+    for (const Eigen::Vector3d& normal : mesh->triangle_normals_) {
+        EXPECT_LT(normal(2), 0.0);
+    }
+}
+
+TEST_P(TIntegrationPermuteDevices, IntegrateRGBDImage) {
+    const Device device = GetParam();
+    geometry::Image depth, color;
+    depth.Prepare(kWidth, kHeight, 1, 4);
+    color.Prepare(kWidth, kHeight, 3, 1);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            *depth.PointerAt<float>(u, v) = 1.0f;
+            *color.PointerAt<uint8_t>(u, v, 0) = 255;
+            *color.PointerAt<uint8_t>(u, v, 1) = 0;
+            *color.PointerAt<uint8_t>(u, v, 2) = 51;
+        }
+    }
+    const geometry::RGBDImage rgbd(color, depth);
+    const camera::PinholeCameraIntrinsic intrinsic(kWidth, kHeight, 50, 50,
+                                                   32, 24);
+    tintegration::VoxelBlockTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::RGB8, 8, 100, device);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = 0.5;
+    volume.Integrate(rgbd, intrinsic, extrinsic);
+
+    const auto pcd = volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    ASSERT_EQ(pcd->colors_.size(), pcd->points_.size());
+    for (size_t i = 0; i < pcd->points_.size(); ++i) {
+        EXPECT_NEAR(pcd->points_[i](2), 1.0, 1e-3);
+        ExpectEQ(pcd->colors_[i], Eigen::Vector3d(1.0, 0.0, 0.2), 1e-6);
+    }
+}
+
+TEST_P(TIntegrationPermuteDevices, Raycast) {
+    const Device device = GetParam();
+    geometry::Image depth, color;
+    depth.Prepare(kWidth, kHeight, 1, 4);
+    color.Prepare(kWidth, kHeight, 3, 1);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            *depth.PointerAt<float>(u, v) = 1.0f;
+            *color.PointerAt<uint8_t>(u, v, 0) = 255;
+            *color.PointerAt<uint8_t>(u, v, 1) = 0;
+            *color.PointerAt<uint8_t>(u, v, 2) = 51;
+        }
+    }
+    const geometry::RGBDImage rgbd(color, depth);
+    const camera::PinholeCameraIntrinsic intrinsic(kWidth, kHeight, 50, 50,
+                                                   32, 24);
+    tintegration::VoxelBlockTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::RGB8, 8, 100, device);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    // Seen from 10 cm further back, the plane is at depth 1.1.
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 0.1;
+    const integration::TSDFRaycastResult result =
+            volume.Raycast(intrinsic, extrinsic);
+    ASSERT_EQ(result.depth_.width_, kWidth);
+    ASSERT_EQ(result.depth_.height_, kHeight);
+    ASSERT_EQ(result.color_.num_of_channels_, 3);
+    int num_hits = 0;
+    for (int v = 4; v < kHeight - 4; ++v) {
+        for (int u = 4; u < kWidth - 4; ++u) {
+            if (*result.depth_.PointerAt<float>(u, v) == 0.0f) {
+                continue;
+            }
+            ++num_hits;
+            EXPECT_NEAR(*result.depth_.PointerAt<float>(u, v), 1.1, 1e-3);
+            EXPECT_LT(*result.normal_.PointerAt<float>(u, v, 2), -0.99);
+            EXPECT_NEAR(*result.color_.PointerAt<float>(u, v, 0), 1.0, 1e-5);
+            EXPECT_NEAR(*result.color_.PointerAt<float>(u, v, 2), 0.2, 1e-5);
+        }
+    }
+    EXPECT_GT(num_hits, (kWidth - 8) * (kHeight - 8) * 9 / 10);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TOdometry/RGBDOdometry.h"
+
+#include <Eigen/Dense>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Odometry/Odometry.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TOdometryPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TOdometry,
+                         TOdometryPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Color and depth of the i-th frame of the RGBD test sequence.
+struct TestFrame {
+    geometry::Image color_;
+    geometry::Image depth_;
+};
+
+static TestFrame ReadTestFrame(int i) {
+    TestFrame frame;
+    std::ostringstream color_path;
+    color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+               << std::setw(5) << i << ".jpg";
+    io::ReadImage(color_path.str(), frame.color_);
+    std::ostringstream depth_path;
+    depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+               << std::setw(5) << i << ".png";
+    io::ReadImage(depth_path.str(), frame.depth_);
+    return frame;
+}
+
+static Tensor ImageToTensor(const geometry::Image& image,
+                            Dtype dtype,
+                            const Device& device) {
+    Tensor tensor({image.height_, image.width_, image.num_of_channels_},
+                  dtype);
+    std::memcpy(tensor.GetDataPtr(), image.data_.data(), image.data_.size());
+    if (image.num_of_channels_ == 1) {
+        tensor = tensor.Reshape({image.height_, image.width_});
+    }
+    return tensor.Copy(device);
+}
+
+static Tensor IntrinsicTensor(const camera::PinholeCameraIntrinsic& intrinsic) {
+    const Eigen::Matrix3d K = intrinsic.intrinsic_matrix_;
+    return Tensor(std::vector<double>(K.data(), K.data() + 9), {3, 3},
+                  Dtype::Float64)
+            .T();
+}
+
+template <int N>
+static Eigen::Matrix<double, N, N> ToEigen(const Tensor& matrix) {
+    const std::vector<double> values = matrix.ToFlatVector<double>();
+    return Eigen::Map<const Eigen::Matrix<double, N, N, Eigen::RowMajor>>(
+            values.data());
+}
+
+TEST_P(TOdometryPermuteDevices, ComputeRGBDOdometry) {
+    Device device = GetParam();
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const odometry::OdometryOption option({20, 10, 5}, 0.03, 0.0, 3.0);
+    const TestFrame source = ReadTestFrame(0);
+    const TestFrame target = ReadTestFrame(1);
+    auto source_rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+            source.color_, source.depth_);
+    auto target_rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+            target.color_, target.depth_);
+
+    const Tensor source_depth =
+            ImageToTensor(source.depth_, Dtype::UInt16, device);
+    const Tensor source_color =
+            ImageToTensor(source.color_, Dtype::UInt8, device);
+    const Tensor target_depth =
+            ImageToTensor(target.depth_, Dtype::UInt16, device);
+    const Tensor target_color =
+            ImageToTensor(target.color_, Dtype::UInt8, device);
+    const Tensor K = IntrinsicTensor(intrinsic);
+    const Tensor init = Tensor::Eye(4, Dtype::Float64, Device("CPU:0"));
+
+    bool success;
+    Tensor trans, info;
+    bool ref_success;
+    Eigen::Matrix4d ref_trans;
+    Eigen::Matrix6d ref_info;
+    std::tie(ref_success, ref_trans, ref_info) = odometry::ComputeRGBDOdometry(
+            *source_rgbd, *target_rgbd, intrinsic, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromColorTerm(), option);
+    std::tie(success, trans, info) = todometry::ComputeRGBDOdometry(
+            source_depth, source_color, target_depth, target_color, K, init,
+            todometry::RGBDOdometryMethod::Intensity, option);
+    EXPECT_TRUE(ref_success);
+    EXPECT_TRUE(success);
+    EXPECT_EQ(trans.GetDevice(), Device("CPU:0"));
+    ExpectEQ(ToEigen<4>(trans), ref_trans, 1e-4);
+    EXPECT_NEAR((ToEigen<6>(info) - ref_info).norm() / ref_info.norm(), 0.0,
+                1e-3);
+
+    std::tie(ref_success, ref_trans, ref_info) = odometry::ComputeRGBDOdometry(
+            *source_rgbd, *target_rgbd, intrinsic, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromHybridTerm(), option);
+    std::tie(success, trans, info) = todometry::ComputeRGBDOdometry(
+            source_depth, source_color, target_depth, target_color, K, init,
+            todometry::RGBDOdometryMethod::Hybrid, option);
+    EXPECT_TRUE(ref_success);
+    EXPECT_TRUE(success);
+    ExpectEQ(ToEigen<4>(trans), ref_trans, 1e-4);
+    EXPECT_NEAR((ToEigen<6>(info) - ref_info).norm() / ref_info.norm(), 0.0,
+                1e-3);
+
+    // Without a legacy counterpart, point-to-plane odometry is compared to
+    // the hybrid odometry, which is dominated by its depth term.
+    std::tie(success, trans, info) = todometry::ComputeRGBDOdometry(
+            source_depth, Tensor(), target_depth, Tensor(), K, init,
+            todometry::RGBDOdometryMethod::PointToPlane, option);
+    EXPECT_TRUE(success);
+    const Eigen::Matrix4d delta = ToEigen<4>(trans) * ref_trans.inverse();
+    ExpectEQ(delta, Eigen::Matrix4d::Identity().eval(), 5e-3);
+}
+
+TEST_P(TOdometryPermuteDevices, ComputeRGBDOdometryIdentity) {
+    Device device = GetParam();
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const TestFrame frame = ReadTestFrame(0);
+    const Tensor depth = ImageToTensor(frame.depth_, Dtype::UInt16, device);
+    const Tensor color = ImageToTensor(frame.color_, Dtype::UInt8, device);
+    for (auto method : {todometry::RGBDOdometryMethod::PointToPlane,
+                        todometry::RGBDOdometryMethod::Intensity,
+                        todometry::RGBDOdometryMethod::Hybrid}) {
+        bool success;
+        Tensor trans, info;
+        std::tie(success, trans, info) = todometry::ComputeRGBDOdometry(
+                depth, color, depth, color, IntrinsicTensor(intrinsic),
+                Tensor::Eye(4, Dtype::Float64, Device("CPU:0")), method);
+        EXPECT_TRUE(success);
+        ExpectEQ(ToEigen<4>(trans), Eigen::Matrix4d::Identity().eval(), 1e-6);
+    }
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TRegistration/Feature.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Registration/Feature.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TFeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TFeature,
+                         TFeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TFeaturePermuteDevices, CorrespondencesFromFeatures) {
+    Device device = GetParam();
+
+    // More features than fit in one tile or one block of queries.
+    registration::Feature source, target;
+    source.Resize(33, 300);
+    target.Resize(33, 600);
+    source.data_.setRandom();
+    target.data_.setRandom();
+
+    std::vector<int> source_to_target(source.Num());
+    std::vector<double> ratios(source.Num());
+    for (int i = 0; i < int(source.Num()); i++) {
+        Eigen::VectorXd distance2 =
+                (target.data_.colwise() - source.data_.col(i))
+                        .colwise()
+                        .squaredNorm();
+        std::vector<int> order(target.Num());
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(
+                order.begin(), order.begin() + 2, order.end(),
+                [&](int a, int b) { return distance2(a) < distance2(b); });
+        source_to_target[i] = order[0];
+        ratios[i] = std::sqrt(distance2(order[0]) / distance2(order[1]));
+    }
+    std::vector<int> target_to_source(target.Num());
+    for (int j = 0; j < int(target.Num()); j++) {
+        (source.data_.colwise() - target.data_.col(j))
+                .colwise()
+                .squaredNorm()
+                .minCoeff(&target_to_source[j]);
+    }
+    registration::CorrespondenceSet ref_all, ref_mutual, ref_ratio;
+    for (int i = 0; i < int(source.Num()); i++) {
+        const Eigen::Vector2i pair(i, source_to_target[i]);
+        ref_all.push_back(pair);
+        if (target_to_source[source_to_target[i]] == i) {
+            ref_mutual.push_back(pair);
+        }
+        if (ratios[i] <= 0.9) {
+            ref_ratio.push_back(pair);
+        }
+    }
+    EXPECT_FALSE(ref_mutual.empty());
+    EXPECT_FALSE(ref_ratio.empty());
+
+    Tensor source_features = tregistration::FeatureToTensor(source, device);
+    Tensor target_features = tregistration::FeatureToTensor(target, device);
+    EXPECT_EQ(source_features.GetShape(), SizeVector({300, 33}));
+    EXPECT_EQ(source_features.GetDtype(), Dtype::Float64);
+    EXPECT_EQ(source_features.GetDevice(), device);
+
+    Tensor corres = tregistration::CorrespondencesFromFeatures(
+            source_features, target_features);
+    EXPECT_EQ(corres.GetShape(), SizeVector({300, 2}));
+    EXPECT_EQ(corres.GetDevice(), device);
+    ExpectEQ(ref_all, tregistration::CorrespondencesFromFeatures(
+                              source, target, device));
+    ExpectEQ(ref_mutual, tregistration::CorrespondencesFromFeatures(
+                                 source, target, device, true));
+    ExpectEQ(ref_ratio, tregistration::CorrespondencesFromFeatures(
+                                source, target, device, false, 0.9));
+
+    source.ConvertToFloat();
+    target.ConvertToFloat();
+    EXPECT_EQ(tregistration::FeatureToTensor(source).GetDtype(),
+              Dtype::Float32);
+    ExpectEQ(ref_mutual, tregistration::CorrespondencesFromFeatures(
+                                 source, target, device, true));
+
+    registration::Feature empty;
+    empty.Resize(33, 0);
+    EXPECT_TRUE(tregistration::CorrespondencesFromFeatures(source, empty,
+                                                           device)
+                        .empty());
+    EXPECT_THROW(tregistration::CorrespondencesFromFeatures(
+                         source_features, target_features.Slice(1, 0, 8)),
+                 std::runtime_error);
+    EXPECT_THROW(tregistration::CorrespondencesFromFeatures(
+                         source_features, target_features, false, 0),
+                 std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
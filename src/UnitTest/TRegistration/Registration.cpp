@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/TRegistration/Registration.h"
+
+#include <Eigen/Geometry>
+#include <vector>
+
+#include "Open3D/Core/NNS/NearestNeighborSearch.h"
+#include "Open3D/Core/Tensor.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/TGeometry/PointCloud.h"
+
+#include "Core/CoreTest.h"
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class TRegistrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TRegistration,
+                         TRegistrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Three faces of the unit cube that meet at the origin, with normals. The
+/// edges between the faces are left out, so that every point is unique.
+static geometry::PointCloud CubeCorner() {
+    geometry::PointCloud pcd;
+    const int n = 20;
+    for (int face = 0; face < 3; ++face) {
+        for (int i = 1; i <= n; ++i) {
+            for (int j = 1; j <= n; ++j) {
+                Eigen::Vector3d point = Eigen::Vector3d::Zero();
+                point((face + 1) % 3) = double(i) / n;
+                point((face + 2) % 3) = double(j) / n;
+                pcd.points_.push_back(point);
+                pcd.normals_.push_back(Eigen::Vector3d::Unit(face));
+            }
+        }
+    }
+    return pcd;
+}
+
+static Eigen::Matrix4d SourceToTarget() {
+    Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+    T.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    T.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    return T;
+}
+
+static Eigen::Matrix4d ToEigen(const Tensor& transformation) {
+    const std::vector<double> values =
+            transformation.ToFlatVector<double>();
+    return Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+            values.data());
+}
+
+TEST_P(TRegistrationPermuteDevices, RegistrationICP) {
+    Device device = GetParam();
+    const geometry::PointCloud target_legacy = CubeCorner();
+    geometry::PointCloud source_legacy = target_legacy;
+    source_legacy.Transform(SourceToTarget().inverse());
+    const registration::ICPConvergenceCriteria criteria(1e-9, 1e-9, 100);
+
+    for (Dtype dtype : {Dtype::Float32, Dtype::Float64}) {
+        const double threshold = dtype == Dtype::Float32 ? 1e-4 : 1e-7;
+        tgeometry::PointCloud source =
+                tgeometry::PointCloud::FromLegacyPointCloud(source_legacy,
+                                                            dtype, device);
+        tgeometry::PointCloud target =
+                tgeometry::PointCloud::FromLegacyPointCloud(target_legacy,
+                                                            dtype, device);
+        for (auto estimation :
+             {registration::TransformationEstimationType::PointToPoint,
+              registration::TransformationEstimationType::PointToPlane}) {
+            tregistration::RegistrationResult result =
+                    tregistration::RegistrationICP(
+                            source, target, 0.1,
+                            Tensor::Eye(4, Dtype::Float64, device),
+                            estimation, criteria);
+            EXPECT_EQ(result.transformation_.GetDevice(), Device("CPU:0"));
+            ExpectEQ(ToEigen(result.transformation_), SourceToTarget(),
+                     threshold);
+            EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+            EXPECT_NEAR(result.inlier_rmse_, 0.0, threshold);
+            const std::vector<int64_t> correspondences =
+                    result.correspondences_.ToFlatVector<int64_t>();
+            ASSERT_EQ(correspondences.size(), source_legacy.points_.size());
+            for (size_t i = 0; i < correspondences.size(); ++i) {
+                EXPECT_EQ(correspondences[i], int64_t(i));
+            }
+        }
+    }
+}
+
+TEST_P(TRegistrationPermuteDevices, RegistrationICPMatchesLegacy) {
+    Device device = GetParam();
+    const geometry::PointCloud target_legacy = CubeCorner();
+    geometry::PointCloud source_legacy = target_legacy;
+    source_legacy.Transform(SourceToTarget().inverse());
+    // Few iterations, so that the results are compared before convergence.
+    const registration::ICPConvergenceCriteria criteria(1e-9, 1e-9, 3);
+    const registration::RegistrationResult expected =
+            registration::RegistrationICP(
+                    source_legacy, target_legacy, 0.1,
+                    Eigen::Matrix4d::Identity(),
+                    registration::TransformationEstimationPointToPlane(),
+                    criteria);
+
+    tgeometry::PointCloud source = tgeometry::PointCloud::FromLegacyPointCloud(
+            source_legacy, Dtype::Float64, device);
+    tgeometry::PointCloud target = tgeometry::PointCloud::FromLegacyPointCloud(
+            target_legacy, Dtype::Float64, device);
+    nns::NearestNeighborSearch target_index(target.GetPoints().AsTensor());
+    target_index.HybridIndex(0.1);
+    tregistration::RegistrationResult result = tregistration::RegistrationICP(
+            source, target, target_index, 0.1,
+            Tensor::Eye(4, Dtype::Float64, device),
+            registration::TransformationEstimationType::PointToPlane,
+            criteria);
+    ExpectEQ(ToEigen(result.transformation_),
+             Eigen::Matrix4d(expected.transformation_));
+    EXPECT_NEAR(result.fitness_, expected.fitness_, 1e-12);
+    EXPECT_NEAR(result.inlier_rmse_, expected.inlier_rmse_, 1e-9);
+}
+
+TEST_P(TRegistrationPermuteDevices, RegistrationICPInvalidArguments) {
+    Device device = GetParam();
+    geometry::PointCloud legacy = CubeCorner();
+    tgeometry::PointCloud target = tgeometry::PointCloud::FromLegacyPointCloud(
+            legacy, Dtype::Float32, device);
+    legacy.normals_.clear();
+    tgeometry::PointCloud source = tgeometry::PointCloud::FromLegacyPointCloud(
+            legacy, Dtype::Float32, device);
+    tgeometry::PointCloud source_float64 =
+            tgeometry::PointCloud::FromLegacyPointCloud(legacy, Dtype::Float64,
+                                                        device);
+
+    EXPECT_THROW(tregistration::RegistrationICP(source, target, 0.0),
+                 std::runtime_error);
+    EXPECT_THROW(tregistration::RegistrationICP(
+                         source, target, 0.1,
+                         Tensor::Eye(3, Dtype::Float64, device)),
+                 std::runtime_error);
+    EXPECT_THROW(tregistration::RegistrationICP(source_float64, target, 0.1),
+                 std::runtime_error);
+    EXPECT_THROW(
+            tregistration::RegistrationICP(
+                    target, source, 0.1, Tensor::Eye(4, Dtype::Float64, device),
+                    registration::TransformationEstimationType::PointToPlane),
+            std::runtime_error);
+    EXPECT_THROW(
+            tregistration::RegistrationICP(
+                    source, target, 0.1, Tensor::Eye(4, Dtype::Float64, device),
+                    registration::TransformationEstimationType::ColoredICP),
+            std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -25,6 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Utility/Console.h"
+
+#include <string>
+#include <vector>
+
 #include "TestUtility/UnitTest.h"
 
 namespace open3d {
@@ -35,6 +39,70 @@ TEST(Logger, LogError) {
                  std::runtime_error);
 }
 
+// Captures the printed messages and restores the logger afterwards.
+class LoggerCapture {
+public:
+    LoggerCapture(utility::VerbosityLevel level) {
+        print_fcn_backup_ = utility::Logger::i().print_fcn_;
+        level_backup_ = utility::GetVerbosityLevel();
+        utility::Logger::i().print_fcn_ = [this](const std::string &msg) {
+            messages_.push_back(msg);
+        };
+        utility::SetVerbosityLevel(level);
+    }
+    ~LoggerCapture() {
+        utility::SetAsyncLogging(false);
+        utility::Logger::i().print_fcn_ = print_fcn_backup_;
+        utility::SetVerbosityLevel(level_backup_);
+    }
+
+    std::vector<std::string> messages_;
+
+private:
+    std::function<void(const std::string &)> print_fcn_backup_;
+    utility::VerbosityLevel level_backup_;
+};
+
+TEST(Logger, DisabledLevelSkipsArguments) {
+    LoggerCapture capture(utility::VerbosityLevel::Info);
+    int evaluations = 0;
+    auto count = [&evaluations]() { return ++evaluations; };
+    OPEN3D_LOG_DEBUG("Debug {}", count());
+    OPEN3D_LOG_INFO("Info {}", count());
+    EXPECT_EQ(evaluations, 1);
+    ASSERT_EQ(capture.messages_.size(), 1u);
+    EXPECT_EQ(capture.messages_[0], "[Open3D INFO] Info 1");
+}
+
+TEST(Logger, AsyncLogging) {
+    LoggerCapture capture(utility::VerbosityLevel::Debug);
+    utility::SetAsyncLogging(true);
+    EXPECT_TRUE(utility::IsAsyncLogging());
+    std::string text = "text";
+    Eigen::Vector3d v(1, 2, 3);
+    for (int i = 0; i < 100; i++) {
+        utility::LogDebug("{} {} {}", i, text.c_str(), v.transpose());
+        // The message keeps its own copy of the arguments.
+        text[0] = 'n';
+        v(0) = 4;
+    }
+    utility::LogInfo("Done");
+    utility::FlushLog();
+    ASSERT_EQ(capture.messages_.size(), 101u);
+    EXPECT_EQ(capture.messages_[0],
+              fmt::format("[Open3D DEBUG] 0 text {}",
+                          Eigen::RowVector3d(1, 2, 3)));
+    EXPECT_EQ(capture.messages_[99],
+              fmt::format("[Open3D DEBUG] 99 next {}",
+                          Eigen::RowVector3d(4, 2, 3)));
+    EXPECT_EQ(capture.messages_[100], "[Open3D INFO] Done");
+
+    utility::SetAsyncLogging(false);
+    EXPECT_FALSE(utility::IsAsyncLogging());
+    utility::LogInfo("Sync");
+    ASSERT_EQ(capture.messages_.size(), 102u);
+}
+
 TEST(Console, DISABLED_SetVerbosityLevel) { NotImplemented(); }
 
 TEST(Console, DISABLED_GetVerbosityLevel) { NotImplemented(); }
@@ -545,5 +545,41 @@ TEST(FileSystem, GetPathComponents) {
     EXPECT_EQ(result, expected);
 }
 
+// ----------------------------------------------------------------------------
+// Map a file read-only into memory.
+// ----------------------------------------------------------------------------
+TEST(FileSystem, MappedFile) {
+    std::string fileName = "mappedFile.bin";
+    const std::string content = "mapped file content";
+
+    utility::filesystem::MappedFile file;
+    EXPECT_FALSE(file.Open(fileName));
+    EXPECT_FALSE(file.IsOpen());
+
+    FILE *fp = utility::filesystem::FOpen(fileName, "wb");
+    ASSERT_NE(fp, nullptr);
+    fwrite(content.data(), 1, content.size(), fp);
+    fclose(fp);
+
+    EXPECT_TRUE(file.Open(fileName));
+    EXPECT_TRUE(file.IsOpen());
+    ASSERT_EQ(int64_t(content.size()), file.GetSize());
+    EXPECT_EQ(content, std::string(file.GetData(), file.GetSize()));
+    file.Close();
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_EQ(0, file.GetSize());
+
+    // An empty file is mapped without data.
+    fp = utility::filesystem::FOpen(fileName, "wb");
+    ASSERT_NE(fp, nullptr);
+    fclose(fp);
+    EXPECT_TRUE(file.Open(fileName));
+    EXPECT_EQ(0, file.GetSize());
+    EXPECT_EQ(nullptr, file.GetData());
+    file.Close();
+
+    EXPECT_TRUE(utility::filesystem::RemoveFile(fileName));
+}
+
 }  // namespace unit_test
 }  // namespace open3d
@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+class ParallelBackends
+    : public testing::TestWithParam<utility::ParallelBackend> {
+protected:
+    void SetUp() override {
+        backend_ = utility::GetParallelBackend();
+        utility::SetParallelBackend(GetParam());
+        utility::SetNumThreads(4);
+    }
+
+    void TearDown() override {
+        utility::SetParallelBackend(backend_);
+        utility::SetNumThreads(0);
+    }
+
+private:
+    utility::ParallelBackend backend_;
+};
+
+INSTANTIATE_TEST_SUITE_P(Parallel,
+                         ParallelBackends,
+                         testing::Values(utility::ParallelBackend::OpenMP,
+                                         utility::ParallelBackend::ThreadPool));
+
+TEST_P(ParallelBackends, ParallelFor) {
+    EXPECT_EQ(utility::GetNumThreads(), 4);
+
+    std::vector<int> counts(10007, 0);
+    utility::ParallelFor(0, int64_t(counts.size()),
+                         [&](int64_t i) { counts[i]++; });
+    EXPECT_EQ(counts, std::vector<int>(counts.size(), 1));
+
+    // Empty and reversed ranges do nothing.
+    utility::ParallelFor(5, 5, [&](int64_t i) { counts[i]++; });
+    utility::ParallelFor(5, 0, [&](int64_t i) { counts[i]++; });
+    EXPECT_EQ(counts[0], 1);
+}
+
+TEST_P(ParallelBackends, Nested) {
+    std::vector<std::atomic<int>> counts(64 * 64);
+    for (std::atomic<int>& count : counts) {
+        count = 0;
+    }
+    utility::ParallelFor(0, 64, [&](int64_t i) {
+        EXPECT_TRUE(utility::InParallel());
+        utility::ParallelFor(0, 64, [&](int64_t j) { counts[i * 64 + j]++; });
+    });
+    EXPECT_FALSE(utility::InParallel());
+    for (const std::atomic<int>& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST_P(ParallelBackends, Exception) {
+    EXPECT_THROW(utility::ParallelFor(0, 100,
+                                      [](int64_t i) {
+                                          if (i == 42) {
+                                              throw std::runtime_error("42");
+                                          }
+                                      }),
+                 std::runtime_error);
+
+    // The backend stays usable.
+    std::atomic<int64_t> sum(0);
+    utility::ParallelFor(0, 100, [&](int64_t i) { sum += i; });
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST_P(ParallelBackends, ParallelReduce) {
+    std::vector<int64_t> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+    int64_t sum = utility::ParallelReduce(
+            0, int64_t(values.size()), int64_t(0),
+            [&](int64_t begin, int64_t end, int64_t partial) {
+                for (int64_t i = begin; i < end; ++i) {
+                    partial += values[i];
+                }
+                return partial;
+            },
+            [](int64_t lhs, int64_t rhs) { return lhs + rhs; });
+    EXPECT_EQ(sum, int64_t(99999) * 100000 / 2);
+
+    // Partial results are combined in index order.
+    std::vector<int64_t> concatenated = utility::ParallelReduce(
+            0, int64_t(values.size()), std::vector<int64_t>(),
+            [&](int64_t begin, int64_t end, std::vector<int64_t> partial) {
+                partial.insert(partial.end(), values.begin() + begin,
+                               values.begin() + end);
+                return partial;
+            },
+            [](std::vector<int64_t> lhs, const std::vector<int64_t>& rhs) {
+                lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+                return lhs;
+            },
+            /*grain_size=*/1000);
+    EXPECT_EQ(concatenated, values);
+}
+
+TEST_P(ParallelBackends, ParallelRadixSortPairs) {
+    // Few distinct keys, so that the sort must be stable.
+    std::vector<uint64_t> keys(50000);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = (i * 7919) % 97 + (uint64_t(1) << 40);
+    }
+    std::vector<int64_t> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<int64_t> ref_indices = indices;
+    std::stable_sort(ref_indices.begin(), ref_indices.end(),
+                     [&](int64_t lhs, int64_t rhs) {
+                         return keys[lhs] < keys[rhs];
+                     });
+    std::vector<uint64_t> ref_keys(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ref_keys[i] = keys[ref_indices[i]];
+    }
+
+    utility::ParallelRadixSortPairs(keys, indices, /*grain_size=*/1000);
+    EXPECT_EQ(keys, ref_keys);
+    EXPECT_EQ(indices, ref_indices);
+}
+
+TEST_P(ParallelBackends, ScopedNumThreads) {
+    {
+        utility::ScopedNumThreads scope(2);
+        EXPECT_EQ(utility::GetNumThreads(), 2);
+        {
+            utility::ScopedNumThreads inner_scope(1);
+            EXPECT_EQ(utility::GetNumThreads(), 1);
+            utility::ScopedNumThreads no_limit(0);
+            EXPECT_EQ(utility::GetNumThreads(), 4);
+        }
+        EXPECT_EQ(utility::GetNumThreads(), 2);
+
+        // Nested loops share the budget of the scope.
+        std::atomic<int> num_active(0);
+        std::atomic<int> max_active(0);
+        std::atomic<int> count(0);
+        utility::ParallelFor(0, 16, [&](int64_t i) {
+            EXPECT_EQ(utility::GetNumThreads(), 2);
+            utility::ParallelFor(0, 16, [&](int64_t j) {
+                const int active = ++num_active;
+                int max = max_active;
+                while (active > max &&
+                       !max_active.compare_exchange_weak(max, active)) {
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                count++;
+                num_active--;
+            });
+        });
+        EXPECT_EQ(count, 256);
+        EXPECT_LE(max_active, 2);
+    }
+    EXPECT_EQ(utility::GetNumThreads(), 4);
+
+    // The limit only applies to the thread that set it.
+    utility::ScopedNumThreads scope(3);
+    int other_num_threads = 0;
+    std::thread other([&]() {
+        utility::ScopedNumThreads other_scope(1);
+        other_num_threads = utility::GetNumThreads();
+    });
+    other.join();
+    EXPECT_EQ(other_num_threads, 1);
+    EXPECT_EQ(utility::GetNumThreads(), 3);
+    EXPECT_THROW(utility::ScopedNumThreads(-1), std::runtime_error);
+}
+
+TEST(Parallel, SetNumThreads) {
+    utility::SetNumThreads(1);
+    EXPECT_EQ(utility::GetNumThreads(), 1);
+    std::vector<int> counts(100, 0);
+    utility::ParallelFor(0, 100, [&](int64_t i) { counts[i]++; });
+    EXPECT_EQ(counts, std::vector<int>(100, 1));
+
+    utility::SetNumThreads(0);
+    EXPECT_GE(utility::GetNumThreads(), 1);
+    EXPECT_THROW(utility::SetNumThreads(-1), std::runtime_error);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
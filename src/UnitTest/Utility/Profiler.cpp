@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Profiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+void SleepMilliseconds(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Returns the columns of the summary row of \p scope.
+std::vector<std::string> SummaryRow(const std::string &summary,
+                                    const std::string &scope) {
+    std::istringstream lines(summary);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream columns(line);
+        std::vector<std::string> row;
+        std::string column;
+        while (columns >> column) {
+            row.push_back(column);
+        }
+        if (!row.empty() && row[0] == scope) {
+            return row;
+        }
+    }
+    return {};
+}
+
+}  // unnamed namespace
+
+TEST(Profiler, DisabledRecordsNothing) {
+    utility::SetProfilerEnabled(false);
+    utility::ResetProfiler();
+    {
+        OPEN3D_PROFILE_SCOPE("Disabled");
+        utility::RecordProfilerCounter("DisabledCounter", 1.0);
+    }
+    EXPECT_TRUE(SummaryRow(utility::GetProfilerSummary(), "Disabled").empty());
+}
+
+TEST(Profiler, NestedSelfTime) {
+    utility::ResetProfiler();
+    utility::SetProfilerEnabled(true);
+    {
+        utility::ProfilerScope outer("Outer");
+        outer.AddItems(3);
+        SleepMilliseconds(20);
+        for (int i = 0; i < 2; i++) {
+            utility::ProfilerScope inner("Inner");
+            inner.AddBytes(100);
+            SleepMilliseconds(10);
+        }
+    }
+    utility::SetProfilerEnabled(false);
+
+    const std::string summary = utility::GetProfilerSummary();
+    const std::vector<std::string> outer = SummaryRow(summary, "Outer");
+    const std::vector<std::string> inner = SummaryRow(summary, "Inner");
+    ASSERT_EQ(outer.size(), 7u);
+    ASSERT_EQ(inner.size(), 7u);
+    EXPECT_EQ(outer[1], "1");
+    EXPECT_EQ(inner[1], "2");
+    EXPECT_EQ(outer[5], "3");
+    EXPECT_EQ(inner[6], "200");
+
+    // The self time of Outer excludes the two nested scopes.
+    const double outer_total = std::stod(outer[2]);
+    const double outer_self = std::stod(outer[3]);
+    const double inner_total = std::stod(inner[2]);
+    EXPECT_GE(inner_total, 20.0);
+    EXPECT_GE(outer_self, 20.0);
+    EXPECT_NEAR(outer_self, outer_total - inner_total, 1e-2);
+    utility::ResetProfiler();
+}
+
+TEST(Profiler, WriteChromeTrace) {
+    utility::ResetProfiler();
+    utility::SetProfilerEnabled(true);
+    {
+        OPEN3D_PROFILE_SCOPE("TraceScope");
+        utility::RecordProfilerCounter("TraceCounter", 42.0);
+    }
+    utility::SetProfilerEnabled(false);
+
+    const std::string filename = "profiler_trace.json";
+    EXPECT_TRUE(utility::WriteProfilerChromeTrace(filename));
+    std::ifstream file(filename);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(filename.c_str());
+
+    const std::string trace = contents.str();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"TraceScope\",\"ph\":\"X\""),
+              std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"TraceCounter\",\"ph\":\"C\""),
+              std::string::npos);
+    utility::ResetProfiler();
+}
+
+TEST(Profiler, RingBufferKeepsLatestEvents) {
+    utility::SetProfilerBufferSize(4);
+    utility::ResetProfiler();
+    utility::SetProfilerEnabled(true);
+    for (int i = 0; i < 10; i++) {
+        OPEN3D_PROFILE_SCOPE("Ring");
+    }
+    utility::SetProfilerEnabled(false);
+
+    const std::vector<std::string> row =
+            SummaryRow(utility::GetProfilerSummary(), "Ring");
+    ASSERT_EQ(row.size(), 7u);
+    EXPECT_EQ(row[1], "4");
+    utility::SetProfilerBufferSize(65536);
+    utility::ResetProfiler();
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/SparseLinearSolver.h"
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+// Tridiagonal, diagonally dominant matrix of size n.
+Eigen::SparseMatrix<double> Tridiagonal(int n, double diagonal) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; i++) {
+        triplets.emplace_back(i, i, diagonal);
+        if (i > 0) {
+            triplets.emplace_back(i, i - 1, -1.0);
+            triplets.emplace_back(i - 1, i, -1.0);
+        }
+    }
+    Eigen::SparseMatrix<double> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+
+}  // namespace
+
+TEST(SparseLinearSolver, SolveLinearSystemPSD) {
+    Eigen::SparseMatrix<double> A = Tridiagonal(10, 4.0);
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(10, 1.0, 10.0);
+
+    bool success;
+    Eigen::VectorXd x;
+    std::tie(success, x) = utility::SolveLinearSystemPSD(A, b);
+    EXPECT_TRUE(success);
+    ExpectEQ(b, Eigen::VectorXd(A * x));
+}
+
+TEST(SparseLinearSolver, ReuseAnalysis) {
+    utility::SparseLinearSolverPSD solver;
+    Eigen::VectorXd b = Eigen::VectorXd::Ones(10);
+    bool success;
+    Eigen::VectorXd x;
+
+    // Same pattern with different values.
+    for (double diagonal : {3.0, 5.0, 7.0}) {
+        Eigen::SparseMatrix<double> A = Tridiagonal(10, diagonal);
+        EXPECT_TRUE(solver.Compute(A));
+        std::tie(success, x) = solver.Solve(b);
+        EXPECT_TRUE(success);
+        ExpectEQ(b, Eigen::VectorXd(A * x));
+    }
+
+    // A new pattern is analyzed again.
+    Eigen::SparseMatrix<double> A = Tridiagonal(6, 3.0);
+    b = Eigen::VectorXd::Ones(6);
+    EXPECT_TRUE(solver.Compute(A));
+    std::tie(success, x) = solver.Solve(b);
+    EXPECT_TRUE(success);
+    ExpectEQ(b, Eigen::VectorXd(A * x));
+}
+
+TEST(SparseLinearSolver, FailedFactorization) {
+    // Singular matrix.
+    Eigen::SparseMatrix<double> A(2, 2);
+    A.insert(0, 0) = 1.0;
+    utility::SparseLinearSolverPSD solver;
+    EXPECT_FALSE(solver.Compute(A));
+
+    bool success;
+    Eigen::VectorXd x;
+    std::tie(success, x) = solver.Solve(Eigen::VectorXd::Ones(2));
+    EXPECT_FALSE(success);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
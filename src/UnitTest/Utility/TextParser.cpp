@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/TextParser.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "TestUtility/UnitTest.h"
+
+namespace open3d {
+namespace unit_test {
+
+namespace {
+
+bool ParseDouble(const std::string &text, double &value, size_t &consumed) {
+    const char *ptr = text.data();
+    const bool ok = utility::ParseDouble(ptr, text.data() + text.size(), value);
+    consumed = size_t(ptr - text.data());
+    return ok;
+}
+
+}  // unnamed namespace
+
+TEST(TextParser, ParseDouble) {
+    double value;
+    size_t consumed;
+    const std::vector<std::string> numbers = {
+            "0",
+            "-0.5",
+            "+12.25",
+            "1e3",
+            "-2.5E-3",
+            ".125",
+            "3.",
+            "0.0000001",
+            "123456.7890123456",
+            "1.7976931348623157e308",
+            "4.9e-324",
+            "12345678901234567890123",
+            "0.1234567890123456789012"};
+    for (const std::string &number : numbers) {
+        EXPECT_TRUE(ParseDouble(number, value, consumed)) << number;
+        EXPECT_EQ(consumed, number.size()) << number;
+        EXPECT_EQ(value, std::strtod(number.c_str(), nullptr)) << number;
+    }
+
+    // Leading blanks are skipped, parsing stops at the first other character.
+    EXPECT_TRUE(ParseDouble(" \t 1.5,2", value, consumed));
+    EXPECT_EQ(value, 1.5);
+    EXPECT_EQ(consumed, 6u);
+    EXPECT_TRUE(ParseDouble("2e", value, consumed));
+    EXPECT_EQ(value, 2.0);
+    EXPECT_EQ(consumed, 1u);
+
+    EXPECT_TRUE(ParseDouble("nan", value, consumed));
+    EXPECT_TRUE(std::isnan(value));
+    EXPECT_TRUE(ParseDouble("-Infinity", value, consumed));
+    EXPECT_EQ(value, -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(consumed, 9u);
+
+    for (const std::string &text : {"", " ", "-", ".", "abc", ",1"}) {
+        EXPECT_FALSE(ParseDouble(text, value, consumed)) << text;
+        EXPECT_EQ(consumed, 0u);
+    }
+}
+
+TEST(TextParser, ParseInt) {
+    const std::string text = " 42 -7 x";
+    const char *ptr = text.data();
+    const char *end = text.data() + text.size();
+    int64_t value;
+    EXPECT_TRUE(utility::ParseInt(ptr, end, value));
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(utility::ParseInt(ptr, end, value));
+    EXPECT_EQ(value, -7);
+    EXPECT_FALSE(utility::ParseInt(ptr, end, value));
+    EXPECT_EQ(*ptr, ' ');
+}
+
+TEST(TextParser, ParseLinesInParallel) {
+    std::string text;
+    for (int i = 0; i < 1000; i++) {
+        text += std::to_string(i) + (i % 7 == 0 ? "\r\n" : "\n");
+        if (i % 10 == 0) {
+            text += "invalid\n";
+        }
+    }
+    text += "1000";
+
+    auto parse_line = [](const char *line, const char *end, int64_t &entry) {
+        return utility::ParseInt(line, end, entry) && line == end;
+    };
+    // Small chunks split the text in many batches.
+    std::vector<int64_t> entries;
+    int64_t num_batches = 0;
+    utility::ParseLinesInParallel<int64_t>(
+            text.data(), text.data() + text.size(), parse_line,
+            [&](const std::vector<int64_t> &batch, const char *parsed_end) {
+                entries.insert(entries.end(), batch.begin(), batch.end());
+                num_batches++;
+                EXPECT_TRUE(parsed_end == text.data() + text.size() ||
+                            parsed_end[-1] == '\n');
+            },
+            -1, 16);
+    ASSERT_EQ(entries.size(), 1001u);
+    for (int64_t i = 0; i <= 1000; i++) {
+        EXPECT_EQ(entries[i], i);
+    }
+    EXPECT_GT(num_batches, 1);
+
+    entries.clear();
+    utility::ParseLinesInParallel<int64_t>(
+            text.data(), text.data() + text.size(), parse_line,
+            [&](const std::vector<int64_t> &batch, const char *) {
+                entries.insert(entries.end(), batch.begin(), batch.end());
+            },
+            25, 16);
+    ASSERT_EQ(entries.size(), 25u);
+    EXPECT_EQ(entries.back(), 24);
+}
+
+}  // namespace unit_test
+}  // namespace open3d
@@ -103,7 +103,8 @@ echo
 if $runBenchmarks; then
     echo "running Open3D benchmarks..."
     date
-    reportRun ./bin/benchmarks
+    reportRun ./bin/benchmarks --benchmark_out=benchmarks.json \
+        --benchmark_out_format=json
     echo
 fi
 